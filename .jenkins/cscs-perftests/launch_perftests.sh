@@ -58,8 +58,8 @@ for executable in "${pika_algorithms_targets[@]}"; do
 done
 
 # Plot comparison of current result with references
-${perftests_dir}/driver.py -v -l "$logfile" perftest plot compare --references \
-    ${references_files[@]} --results ${result_files[@]} \
+${perftests_dir}/driver.py -v -l "$logfile" perftest plot compare --mode overlap \
+    --references ${references_files[@]} --results ${result_files[@]} \
     -o "${build_dir}/reports/reference-comparison" ||
     {
         echo 'Plotting failed: performance drop or unknown'
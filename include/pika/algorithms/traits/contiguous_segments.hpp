@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // Iterators into containers storing their elements in contiguous blocks
+    // (e.g. std::deque) specialize this trait to std::true_type and provide
+    //
+    //     static std::size_t segment_size(Iter const& it) noexcept;
+    //
+    // returning the number of elements from it to the end of its block. The
+    // copy and move algorithms transfer trivially copyable elements between
+    // such iterators (and contiguous iterators) one block at a time using
+    // std::memmove. The inner loops of for_each, transform, copy, fill,
+    // reduce and find run over the blocks through plain pointers, see
+    // pika::detail::for_each_contiguous_segment.
+    template <typename Iter, typename Enable = void>
+    struct contiguous_segments : std::false_type
+    {
+    };
+
+#if defined(__GLIBCXX__)
+    // libstdc++ exposes the bounds of the block of a deque iterator
+    template <typename T, typename Ref, typename Ptr>
+    struct contiguous_segments<std::_Deque_iterator<T, Ref, Ptr>>
+      : std::true_type
+    {
+        static std::size_t segment_size(
+            std::_Deque_iterator<T, Ref, Ptr> const& it) noexcept
+        {
+            return static_cast<std::size_t>(it._M_last - it._M_cur);
+        }
+    };
+#endif
+
+    template <typename Iter>
+    inline constexpr bool has_contiguous_segments_v =
+        contiguous_segments<Iter>::value;
+}    // namespace pika::traits
+
+namespace pika::detail {
+    // the number of elements starting at it (up to count) which are stored
+    // contiguously
+    template <typename Iter>
+    std::size_t contiguous_segment_size(
+        Iter const& it, std::size_t count) noexcept
+    {
+        if constexpr (pika::detail::is_contiguous_iterator_v<Iter>)
+        {
+            return count;
+        }
+        else
+        {
+            std::size_t const size =
+                pika::traits::contiguous_segments<Iter>::segment_size(it);
+            return size < count ? size : count;
+        }
+    }
+
+    template <typename Iter>
+    inline constexpr bool is_contiguous_or_segmented_v =
+        pika::detail::is_contiguous_iterator_v<Iter> ||
+        pika::traits::has_contiguous_segments_v<Iter>;
+
+    // at least one of the iterators is segmented, the other one is either
+    // segmented or contiguous
+    template <typename Iter1, typename Iter2>
+    inline constexpr bool iterators_are_segmented_v =
+        is_contiguous_or_segmented_v<Iter1> &&
+        is_contiguous_or_segmented_v<Iter2> &&
+        (pika::traits::has_contiguous_segments_v<Iter1> ||
+            pika::traits::has_contiguous_segments_v<Iter2>);
+
+    // Calls f(segment, size) for the contiguous blocks of the count elements
+    // starting at the segmented iterator it in turn, segment pointing to the
+    // first element of the block. f returns the pointer past the last
+    // element it processed, the walk stops if that is not the end of the
+    // block (e.g. once a search was cancelled). Returns the iterator past the
+    // last processed element.
+    template <typename Iter, typename F>
+    Iter for_each_contiguous_segment(Iter it, std::size_t count, F&& f)
+    {
+        while (count != 0)
+        {
+            std::size_t const size = contiguous_segment_size(it, count);
+            auto* const segment = pika::detail::to_address(it);
+            std::size_t const done =
+                static_cast<std::size_t>(f(segment, size) - segment);
+
+            std::advance(it, done);
+            if (done != size)
+            {
+                break;
+            }
+            count -= size;
+        }
+        return it;
+    }
+
+    // Calls f(segment, size, dest_segment) for the pieces of the count
+    // elements starting at first and of the elements starting at dest which
+    // are contiguous in both, see iterators_are_segmented_v. Returns the
+    // iterators past the last elements.
+    template <typename InIter, typename OutIter, typename F>
+    std::pair<InIter, OutIter> for_each_contiguous_segment(
+        InIter first, std::size_t count, OutIter dest, F&& f)
+    {
+        while (count != 0)
+        {
+            std::size_t const size = contiguous_segment_size(
+                dest, contiguous_segment_size(first, count));
+
+            f(pika::detail::to_address(first), size,
+                pika::detail::to_address(dest));
+
+            std::advance(first, size);
+            std::advance(dest, size);
+            count -= size;
+        }
+        return std::make_pair(PIKA_MOVE(first), PIKA_MOVE(dest));
+    }
+}    // namespace pika::detail
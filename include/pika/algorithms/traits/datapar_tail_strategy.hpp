@@ -0,0 +1,42 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <type_traits>
+
+namespace pika::traits {
+    enum class datapar_tail
+    {
+        // process the elements before the first aligned pack and after the
+        // last whole pack one at a time
+        peel,
+        // process the range with unaligned packs and the remaining elements
+        // with a single masked load and store
+        masked
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Specialize this trait for a vector pack execution policy to select how
+    // the datapar transform loops handle the elements which do not fill a
+    // whole pack. The masked tail avoids the scalar prologue and epilogue,
+    // which dominate for short ranges, but it is only used on targets with
+    // masked memory accesses (AVX-512), the others keep peeling. The lanes of
+    // the masked pack which are outside of the range hold copies of an
+    // element in it, the transformation is applied to them as well and their
+    // results are discarded, so it must not have side effects.
+    template <typename ExPolicy, typename Enable = void>
+    struct datapar_tail_strategy
+      : std::integral_constant<datapar_tail, datapar_tail::peel>
+    {
+    };
+
+    template <typename ExPolicy>
+    inline constexpr datapar_tail datapar_tail_strategy_v =
+        datapar_tail_strategy<std::decay_t<ExPolicy>>::value;
+}    // namespace pika::traits
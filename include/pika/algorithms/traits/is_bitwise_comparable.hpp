@@ -0,0 +1,59 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/algorithms/traits/pointer_category.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <type_traits>
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // Two objects of a bitwise comparable type T compare equal if and only if
+    // their object representations are equal, such that ranges of them can
+    // be compared with std::memcmp and searched with std::memchr. This holds
+    // for integral and enumeration types (including std::byte) and pointers,
+    // but not for floating point types (0.0 == -0.0 and NaN != NaN) or class
+    // types, which may have padding. Specialize this trait to std::true_type
+    // for other types whose equality compares all of their bytes.
+    template <typename T, typename Enable = void>
+    struct is_bitwise_comparable
+      : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> ||
+            std::is_pointer_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_bitwise_comparable_v =
+        is_bitwise_comparable<std::remove_cv_t<T>>::value;
+}    // namespace pika::traits
+
+namespace pika::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the elements of two contiguous sequences of the same bitwise
+    // comparable type can be compared for equality with std::memcmp.
+    template <typename Iter1, typename Iter2>
+    inline constexpr bool iterators_are_bitwise_comparable_v =
+        iterators_are_contiguous_v<Iter1, Iter2> &&
+        std::is_same_v<std::remove_cv_t<pika::traits::iter_value_t<Iter1>>,
+            std::remove_cv_t<pika::traits::iter_value_t<Iter2>>> &&
+        pika::traits::is_bitwise_comparable_v<
+            pika::traits::iter_value_t<Iter1>>;
+
+    // Whether the elements of a contiguous sequence are single bytes, which
+    // can be searched for with std::memchr.
+    template <typename Iter>
+    inline constexpr bool iterator_is_byte_searchable_v =
+        is_contiguous_iterator_v<Iter> &&
+        sizeof(pika::traits::iter_value_t<Iter>) == 1 &&
+        pika::traits::is_bitwise_comparable_v<
+            pika::traits::iter_value_t<Iter>> &&
+        !std::is_same_v<std::remove_cv_t<pika::traits::iter_value_t<Iter>>,
+            bool>;
+}    // namespace pika::detail
@@ -0,0 +1,71 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace pika::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the elements Iter refers to are stored contiguously, such that
+    // they can be transferred with std::memmove and loaded into vector packs
+    // through their address. This holds for the iterators known to
+    // pika::traits::is_contiguous_iterator (pointers and the iterators of
+    // std::vector, std::array and std::basic_string) and, if the standard
+    // library supports concepts, for every iterator modeling
+    // std::contiguous_iterator, e.g. the iterators of std::span and
+    // std::string_view or of user containers declaring
+    // std::contiguous_iterator_tag as their iterator_concept.
+    template <typename Iter, typename Enable = void>
+    struct is_contiguous_iterator
+      : std::bool_constant<pika::traits::is_contiguous_iterator_v<Iter>>
+    {
+    };
+
+#if defined(__cpp_lib_concepts)
+    template <typename Iter>
+    struct is_contiguous_iterator<Iter,
+        std::enable_if_t<std::contiguous_iterator<Iter>>> : std::true_type
+    {
+    };
+#endif
+
+    template <typename Iter>
+    inline constexpr bool is_contiguous_iterator_v =
+        is_contiguous_iterator<Iter>::value;
+
+    // The address of the element it refers to. Iterators modeling
+    // std::contiguous_iterator are not dereferenced, it may be the end of
+    // its sequence.
+    template <typename Iter>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr auto to_address(
+        Iter const& it) noexcept
+    {
+        if constexpr (std::is_pointer_v<Iter>)
+        {
+            return it;
+        }
+#if defined(__cpp_lib_concepts) && defined(__cpp_lib_to_address)
+        else if constexpr (std::contiguous_iterator<Iter>)
+        {
+            return std::to_address(it);
+        }
+#endif
+        else
+        {
+            return std::addressof(*it);
+        }
+    }
+}    // namespace pika::detail
@@ -0,0 +1,34 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+
+#include <type_traits>
+
+namespace pika::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether Iter is a pika::util::counting_iterator over an integral type.
+    // The loops over such index spaces run over the integers directly, with
+    // a plain trip count the compiler can unroll and vectorize.
+    template <typename Iter>
+    struct is_integral_counting_iterator : std::false_type
+    {
+    };
+
+    template <typename T, typename Traversal, typename Difference>
+    struct is_integral_counting_iterator<
+        pika::util::counting_iterator<T, Traversal, Difference>>
+      : std::is_integral<T>
+    {
+    };
+
+    template <typename Iter>
+    inline constexpr bool is_integral_counting_iterator_v =
+        is_integral_counting_iterator<Iter>::value;
+}    // namespace pika::detail
@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <type_traits>
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // A type T is trivially relocatable if moving an object of type T to a
+    // new location and destroying the original is equivalent to copying its
+    // bytes (and not running the destructor). This holds for all trivially
+    // copyable types. Specialize this trait to std::true_type for other types
+    // which don't refer to their own address, e.g. types holding a
+    // std::unique_ptr, to have pika::uninitialized_relocate copy their bytes
+    // instead of move constructing and destroying them.
+    template <typename T, typename Enable = void>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_trivially_relocatable_v =
+        is_trivially_relocatable<std::remove_cv_t<T>>::value;
+}    // namespace pika::traits
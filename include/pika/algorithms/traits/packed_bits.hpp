@@ -0,0 +1,71 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // Iterators over sequences of bits packed into words (e.g. the ones of
+    // std::vector<bool>) specialize this trait to std::true_type and provide
+    //
+    //     using word_type = ...;    // a (const) unsigned integral type
+    //     static word_type* word(Iter const& it) noexcept;
+    //     static std::size_t offset(Iter const& it) noexcept;
+    //
+    // returning the word holding the bit it refers to and the position of
+    // that bit in the word, bit i of a word being (word >> i) & 1. The bits
+    // following it are stored in the next bits and words. count, find,
+    // all_of, any_of, none_of, fill and copy then process such sequences a
+    // word at a time, see pika::parallel::detail::packed_bits_range.
+    template <typename Iter, typename Enable = void>
+    struct packed_bits : std::false_type
+    {
+    };
+
+#if defined(__GLIBCXX__)
+    // libstdc++ exposes the words of the iterators of std::vector<bool>
+    template <>
+    struct packed_bits<std::_Bit_iterator> : std::true_type
+    {
+        using word_type = std::_Bit_type;
+
+        static word_type* word(std::_Bit_iterator const& it) noexcept
+        {
+            return it._M_p;
+        }
+
+        static std::size_t offset(std::_Bit_iterator const& it) noexcept
+        {
+            return it._M_offset;
+        }
+    };
+
+    template <>
+    struct packed_bits<std::_Bit_const_iterator> : std::true_type
+    {
+        using word_type = std::_Bit_type const;
+
+        static word_type* word(std::_Bit_const_iterator const& it) noexcept
+        {
+            return it._M_p;
+        }
+
+        static std::size_t offset(std::_Bit_const_iterator const& it) noexcept
+        {
+            return it._M_offset;
+        }
+    };
+#endif
+
+    template <typename Iter>
+    inline constexpr bool has_packed_bits_v = packed_bits<Iter>::value;
+}    // namespace pika::traits
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 
 #include <type_traits>
@@ -85,8 +86,8 @@ namespace pika::detail {
     ///////////////////////////////////////////////////////////////////////
     template <typename Iter1, typename Iter2>
     inline constexpr bool iterators_are_contiguous_v =
-        pika::traits::is_contiguous_iterator_v<Iter1>&&
-            pika::traits::is_contiguous_iterator_v<Iter2>;
+        pika::detail::is_contiguous_iterator_v<Iter1>&&
+            pika::detail::is_contiguous_iterator_v<Iter2>;
 
     template <typename Source, typename Dest,
         bool non_contiguous = !iterators_are_contiguous_v<Source, Dest>>
@@ -0,0 +1,75 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+// Ranges whose static extent is at most this many elements are processed by
+// the sequential implementations of the algorithms on the calling thread.
+#if !defined(PIKA_ALGORITHMS_STATIC_EXTENT_INLINE_THRESHOLD)
+#define PIKA_ALGORITHMS_STATIC_EXTENT_INLINE_THRESHOLD 256
+#endif
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // The extent of ranges whose number of elements is not part of their type
+    inline constexpr std::size_t dynamic_extent = std::size_t(-1);
+
+    // The number of elements of ranges whose size is part of their type
+    // (built-in arrays, std::array and std::span of a fixed extent),
+    // dynamic_extent for all other ranges. Range types of a static size
+    // may specialize this.
+    template <typename Rng, typename Enable = void>
+    struct static_extent : std::integral_constant<std::size_t, dynamic_extent>
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct static_extent<T[N]> : std::integral_constant<std::size_t, N>
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct static_extent<std::array<T, N>>
+      : std::integral_constant<std::size_t, N>
+    {
+    };
+
+#if defined(__cpp_lib_span)
+    // std::dynamic_extent has the value of dynamic_extent
+    template <typename T, std::size_t N>
+    struct static_extent<std::span<T, N>>
+      : std::integral_constant<std::size_t, N>
+    {
+    };
+#endif
+
+    template <typename Rng>
+    inline constexpr std::size_t static_extent_v =
+        static_extent<std::remove_cv_t<std::remove_reference_t<Rng>>>::value;
+}    // namespace pika::traits
+
+namespace pika::detail {
+    // Whether the algorithms invoked with a range of type Rng run inline,
+    // see algorithm::call_range
+    template <typename Rng>
+    inline constexpr bool has_small_static_extent_v =
+        pika::traits::static_extent_v<Rng> <=
+        PIKA_ALGORITHMS_STATIC_EXTENT_INLINE_THRESHOLD;
+}    // namespace pika::detail
@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <type_traits>
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    // Specialize this trait to std::true_type for a reduction operation Op to
+    // have the partial results of the chunks (or the views of a for_loop
+    // reduction) combined in parallel along a binary tree instead of
+    // sequentially on the calling thread. This is only beneficial for
+    // operations which are expensive to apply (e.g. merging histograms).
+    // Op has to be associative; the order of the partial results is
+    // preserved, so it does not have to be commutative.
+    template <typename Op, typename Enable = void>
+    struct use_tree_reduction : std::false_type
+    {
+    };
+
+    template <typename Op>
+    inline constexpr bool use_tree_reduction_v =
+        use_tree_reduction<std::decay_t<Op>>::value;
+}    // namespace pika::traits
@@ -16,13 +16,21 @@
 // Parallelism TS V1
 #include <pika/parallel/algorithms/adjacent_difference.hpp>
 #include <pika/parallel/algorithms/adjacent_find.hpp>
+#include <pika/parallel/algorithms/adjacent_transform.hpp>
 #include <pika/parallel/algorithms/all_any_none.hpp>
+#include <pika/parallel/algorithms/batch.hpp>
+#include <pika/parallel/algorithms/batched_search.hpp>
+#include <pika/parallel/algorithms/chunk_pipeline.hpp>
 #include <pika/parallel/algorithms/copy.hpp>
 #include <pika/parallel/algorithms/count.hpp>
+#include <pika/parallel/algorithms/distinct.hpp>
 #include <pika/parallel/algorithms/equal.hpp>
+#include <pika/parallel/algorithms/eytzinger.hpp>
 #include <pika/parallel/algorithms/fill.hpp>
 #include <pika/parallel/algorithms/find.hpp>
+#include <pika/parallel/algorithms/find_all.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/gather.hpp>
 #include <pika/parallel/algorithms/generate.hpp>
 #include <pika/parallel/algorithms/includes.hpp>
 #include <pika/parallel/algorithms/is_heap.hpp>
@@ -30,10 +38,14 @@
 #include <pika/parallel/algorithms/is_sorted.hpp>
 #include <pika/parallel/algorithms/lexicographical_compare.hpp>
 #include <pika/parallel/algorithms/make_heap.hpp>
+#include <pika/parallel/algorithms/matrix_multiply.hpp>
 #include <pika/parallel/algorithms/merge.hpp>
+#include <pika/parallel/algorithms/merge_join.hpp>
 #include <pika/parallel/algorithms/minmax.hpp>
 #include <pika/parallel/algorithms/mismatch.hpp>
 #include <pika/parallel/algorithms/move.hpp>
+#include <pika/parallel/algorithms/multiway_merge.hpp>
+#include <pika/parallel/algorithms/multiway_set_operation.hpp>
 #include <pika/parallel/algorithms/nth_element.hpp>
 #include <pika/parallel/algorithms/partial_sort.hpp>
 #include <pika/parallel/algorithms/partial_sort_copy.hpp>
@@ -43,19 +55,28 @@
 #include <pika/parallel/algorithms/replace.hpp>
 #include <pika/parallel/algorithms/reverse.hpp>
 #include <pika/parallel/algorithms/rotate.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
 #include <pika/parallel/algorithms/search.hpp>
 #include <pika/parallel/algorithms/set_difference.hpp>
 #include <pika/parallel/algorithms/set_intersection.hpp>
 #include <pika/parallel/algorithms/set_symmetric_difference.hpp>
 #include <pika/parallel/algorithms/set_union.hpp>
+#include <pika/parallel/algorithms/shuffle.hpp>
 #include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/sort_heap.hpp>
+#include <pika/parallel/algorithms/sorted_unique.hpp>
+#include <pika/parallel/algorithms/split.hpp>
 #include <pika/parallel/algorithms/stable_sort.hpp>
 #include <pika/parallel/algorithms/swap_ranges.hpp>
+#include <pika/parallel/algorithms/transpose.hpp>
 #include <pika/parallel/algorithms/unique.hpp>
+#include <pika/parallel/algorithms/unordered_compaction.hpp>
 
 // Parallelism TS V2
 #include <pika/parallel/algorithms/ends_with.hpp>
 #include <pika/parallel/algorithms/for_loop.hpp>
+#include <pika/parallel/algorithms/for_loop_md.hpp>
+#include <pika/parallel/algorithms/for_loop_wavefront.hpp>
 #include <pika/parallel/algorithms/shift_left.hpp>
 #include <pika/parallel/algorithms/shift_right.hpp>
 #include <pika/parallel/algorithms/starts_with.hpp>
@@ -122,8 +122,9 @@ namespace pika {
 #include <pika/config.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
-#include <pika/parallel/algorithms/adjacent_find.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_find.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
@@ -157,9 +158,27 @@ namespace pika::parallel::detail {
         static InIter
         sequential(ExPolicy, InIter first, Sent_ last, Pred&& pred, Proj&& proj)
         {
-            return std::adjacent_find(first, last,
-                invoke_projected<Pred, Proj>(
-                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj)));
+            if constexpr (is_sized_range_v<InIter, Sent_>)
+            {
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last));
+                if (count < 2)
+                {
+                    return std::next(first, count);
+                }
+
+                std::size_t const found =
+                    sequential_adjacent_find_n<std::decay_t<ExPolicy>>(first,
+                        count - 1, PIKA_FORWARD(Pred, pred),
+                        PIKA_FORWARD(Proj, proj));
+                return std::next(first, found != count - 1 ? found : count);
+            }
+            else
+            {
+                return std::adjacent_find(first, last,
+                    invoke_projected<Pred, Proj>(
+                        PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj)));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent_,
@@ -168,8 +187,6 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent_ last, Pred&& pred,
             Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<FwdIter, FwdIter>;
-            using reference = typename zip_iterator::reference;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
 
@@ -179,23 +196,26 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(last));
             }
 
-            FwdIter next = first;
-            ++next;
             difference_type count = std::distance(first, last);
             util::cancellation_token<difference_type> tok(count);
 
-            invoke_projected<Pred, Proj> pred_projected{
-                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj)};
-
-            auto f1 = [pred_projected = PIKA_MOVE(pred_projected), tok](
-                          zip_iterator it, std::size_t part_size,
+            // the partitions cover the count - 1 adjacent pairs, the last
+            // pair of a partition reads the first element of the next one
+            auto f1 = [tok, pred = PIKA_FORWARD(Pred, pred),
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
+                          std::size_t part_size,
                           std::size_t base_idx) mutable {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size, tok,
-                    [&pred_projected, &tok](reference t, std::size_t i) {
-                        using std::get;
-                        if (pred_projected(get<0>(t), get<1>(t)))
-                            tok.cancel(i);
-                    });
+                std::size_t const found =
+                    adjacent_find_partition<std::decay_t<ExPolicy>>(
+                        part_begin, part_size,
+                        [&tok, base_idx](std::size_t offset) {
+                            return tok.was_cancelled(base_idx + offset);
+                        },
+                        pred, proj);
+                if (found != part_size)
+                {
+                    tok.cancel(base_idx + found);
+                }
             };
 
             auto f2 =
@@ -214,8 +234,7 @@ namespace pika::parallel::detail {
             };
 
             return partitioner<ExPolicy, FwdIter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first, next), count - 1, 1,
+                PIKA_FORWARD(ExPolicy, policy), first, count - 1, 1,
                 PIKA_MOVE(f1), PIKA_MOVE(f2));
         }
     };
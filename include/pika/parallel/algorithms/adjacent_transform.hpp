@@ -0,0 +1,224 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/adjacent_transform.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_transform.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // adjacent_transform
+    template <typename Iter>
+    struct adjacent_transform
+      : public algorithm<adjacent_transform<Iter>, Iter>
+    {
+        adjacent_transform()
+          : adjacent_transform::algorithm("adjacent_transform")
+        {
+        }
+
+        // Copies the first and the last radius elements, whose
+        // neighbourhoods reach beyond the ends of the range, and returns the
+        // number of the elements in between.
+        template <typename RandIter, typename FwdIter>
+        static std::size_t copy_boundaries(RandIter first, std::size_t count,
+            FwdIter dest, std::size_t radius)
+        {
+            std::size_t const boundary = (std::min)(radius, count);
+            std::copy_n(first, boundary, dest);
+            if (count <= 2 * radius)
+            {
+                std::copy(first + boundary, first + count,
+                    std::next(dest, boundary));
+                return 0;
+            }
+            std::copy_n(first + (count - radius), radius,
+                std::next(dest, count - radius));
+            return count - 2 * radius;
+        }
+
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename F>
+        static FwdIter sequential(ExPolicy, RandIter first, RandIter last,
+            FwdIter dest, std::size_t radius, F&& f)
+        {
+            std::size_t const count = detail::distance(first, last);
+            std::size_t const inner =
+                copy_boundaries(first, count, dest, radius);
+            if (inner != 0)
+            {
+                sequential_adjacent_transform<ExPolicy>(first + radius, inner,
+                    std::next(dest, radius), radius, PIKA_FORWARD(F, f));
+            }
+            return std::next(dest, count);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename F>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last, FwdIter dest,
+            std::size_t radius, F&& f)
+        {
+            using zip_iterator = pika::util::zip_iterator<RandIter, FwdIter>;
+            using result = algorithm_result<ExPolicy, FwdIter>;
+
+            std::size_t const count = detail::distance(first, last);
+            std::size_t const inner =
+                copy_boundaries(first, count, dest, radius);
+            if (inner == 0)
+            {
+                return result::get(std::next(dest, count));
+            }
+
+            // The neighbourhoods of the elements of a chunk reach radius
+            // elements into the adjacent chunks. The input is not written
+            // to, the halos are read in place.
+            auto f1 = [radius, f = PIKA_FORWARD(F, f)](
+                          zip_iterator part_begin,
+                          std::size_t part_size) mutable {
+                auto iters = part_begin.get_iterator_tuple();
+                sequential_adjacent_transform<std::decay_t<ExPolicy>>(
+                    std::get<0>(iters), part_size, std::get<1>(iters),
+                    radius, f);
+            };
+
+            auto f2 = [dest, count](
+                          std::vector<pika::future<void>>&& data) mutable
+                -> FwdIter {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+                std::advance(dest, count);
+                return dest;
+            };
+
+            using pika::util::make_zip_iterator;
+            return partitioner<ExPolicy, FwdIter, void>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                make_zip_iterator(first + radius, std::next(dest, radius)),
+                inner, PIKA_MOVE(f1), PIKA_MOVE(f2));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Assigns to each element of the range starting at \a dest the result
+    /// of \a f for the neighbourhood of the corresponding element of
+    /// [first, last), the window of the 2 * radius + 1 elements centered on
+    /// it:
+    /// \code
+    /// auto f(Window const& w);
+    /// \endcode
+    /// w[k] refers to the element k positions after the center for k in
+    /// [-radius, radius], w.radius() and w.size() return the radius and the
+    /// number of elements of the window. The first and the last \a radius
+    /// elements, whose neighbourhoods reach beyond the ends of the range,
+    /// are copied unchanged, as adjacent_difference does with the first
+    /// element.
+    ///
+    /// The range is partitioned as for \a transform. The neighbourhoods of
+    /// the elements of a chunk reach into the adjacent chunks, the elements
+    /// are read in place and are not copied. With \a simd and \a par_simd,
+    /// contiguous ranges of arithmetic types are transformed in packs if
+    /// \a f accepts a window of packs: w[k] is the pack of the elements k
+    /// positions after V::size() consecutive centers. Generic functions,
+    /// e.g. moving averages like
+    /// \code
+    /// [](auto const& w) { return (w[-1] + w[0] + w[1]) / 3; }
+    /// \endcode
+    /// are thus vectorized, the functions taking the windows by their type
+    /// are invoked one element at a time.
+    ///
+    /// The execution of adjacent_transform without specifying an execution
+    /// policy is equivalent to specifying \a pika::execution::seq as the
+    /// execution policy.
+    ///
+    /// Complexity: Exactly (last - first) - 2 * radius applications of
+    ///             \a f, if positive, and (last - first) assignments.
+    ///
+    /// \returns  The \a adjacent_transform algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise. It returns the iterator past
+    ///           the last element written.
+    ///
+    /// \note The output range must not overlap the input range, as the
+    ///       neighbourhoods are read while the results are written.
+    ///
+    inline constexpr struct adjacent_transform_t final
+      : pika::detail::tag_parallel_algorithm<adjacent_transform_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend pika::parallel::detail::algorithm_result_t<ExPolicy, FwdIter>
+        tag_fallback_invoke(pika::adjacent_transform_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::adjacent_transform<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest, radius,
+                PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename FwdIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(pika::adjacent_transform_t,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::adjacent_transform<FwdIter>().call(
+                pika::execution::seq, first, last, dest, radius,
+                PIKA_FORWARD(F, f));
+        }
+    } adjacent_transform{};
+}    // namespace pika
@@ -239,6 +239,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/find.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/invoke_projected.hpp>
 #include <pika/parallel/util/loop.hpp>
@@ -268,6 +269,16 @@ namespace pika::parallel::detail {
         static bool
         sequential(ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                std::size_t const pos = sequential_packed_bits_find(first,
+                    count, bool(PIKA_INVOKE(f, false)),
+                    bool(PIKA_INVOKE(f, true)));
+                return pos == count;
+            }
+
             return detail::sequential_find_if<ExPolicy>(first, last,
                        invoke_projected<F, Proj>(PIKA_FORWARD(F, f),
                            PIKA_FORWARD(Proj, proj))) == last;
@@ -283,6 +294,16 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, bool>::get(true);
             }
 
+            if constexpr (use_packed_bits_v<FwdIter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                return parallel_packed_bits_find<ExPolicy, bool>(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    bool(PIKA_INVOKE(op, false)), bool(PIKA_INVOKE(op, true)),
+                    [count](std::size_t pos) { return pos == count; });
+            }
+
             util::cancellation_token<> tok;
             auto f1 = [op = PIKA_FORWARD(F, op), tok,
                           proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
@@ -294,7 +315,7 @@ namespace pika::parallel::detail {
                 return !tok.was_cancelled();
             };
 
-            return detail::partitioner<ExPolicy, bool>::call(
+            return detail::partitioner<ExPolicy, bool>::call_cancellable(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
                 [](std::vector<pika::future<bool>>&& results) {
@@ -305,7 +326,8 @@ namespace pika::parallel::detail {
                                [](pika::future<bool>& val) {
                                    return val.get();
                                }) == pika::util::end(results);
-                });
+                },
+                [tok](std::size_t) { return tok.was_cancelled(); });
         }
     };
     /// \endcond
@@ -325,6 +347,16 @@ namespace pika::parallel::detail {
         static bool
         sequential(ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                std::size_t const pos = sequential_packed_bits_find(first,
+                    count, bool(PIKA_INVOKE(f, false)),
+                    bool(PIKA_INVOKE(f, true)));
+                return pos != count;
+            }
+
             return detail::sequential_find_if<ExPolicy>(first, last,
                        invoke_projected<F, Proj>(PIKA_FORWARD(F, f),
                            PIKA_FORWARD(Proj, proj))) != last;
@@ -340,6 +372,16 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, bool>::get(false);
             }
 
+            if constexpr (use_packed_bits_v<FwdIter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                return parallel_packed_bits_find<ExPolicy, bool>(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    bool(PIKA_INVOKE(op, false)), bool(PIKA_INVOKE(op, true)),
+                    [count](std::size_t pos) { return pos != count; });
+            }
+
             util::cancellation_token<> tok;
             auto f1 = [op = PIKA_FORWARD(F, op), tok,
                           proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
@@ -351,7 +393,7 @@ namespace pika::parallel::detail {
                 return tok.was_cancelled();
             };
 
-            return detail::partitioner<ExPolicy, bool>::call(
+            return detail::partitioner<ExPolicy, bool>::call_cancellable(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
                 [](std::vector<pika::future<bool>>&& results) {
@@ -362,7 +404,8 @@ namespace pika::parallel::detail {
                                [](pika::future<bool>& val) {
                                    return val.get();
                                }) != pika::util::end(results);
-                });
+                },
+                [tok](std::size_t) { return tok.was_cancelled(); });
         }
     };
     /// \endcond
@@ -382,6 +425,15 @@ namespace pika::parallel::detail {
         static bool
         sequential(ExPolicy, Iter first, Sent last, F&& f, Proj&& proj)
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                std::size_t const pos = sequential_packed_bits_find(first,
+                    count, !PIKA_INVOKE(f, false), !PIKA_INVOKE(f, true));
+                return pos == count;
+            }
+
             return detail::sequential_find_if_not<ExPolicy>(first, last,
                        PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj)) == last;
         }
@@ -396,6 +448,16 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, bool>::get(true);
             }
 
+            if constexpr (use_packed_bits_v<FwdIter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                return parallel_packed_bits_find<ExPolicy, bool>(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    !PIKA_INVOKE(op, false), !PIKA_INVOKE(op, true),
+                    [count](std::size_t pos) { return pos == count; });
+            }
+
             util::cancellation_token<> tok;
             auto f1 = [op = PIKA_FORWARD(F, op), tok,
                           proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
@@ -407,7 +469,7 @@ namespace pika::parallel::detail {
                 return !tok.was_cancelled();
             };
 
-            return detail::partitioner<ExPolicy, bool>::call(
+            return detail::partitioner<ExPolicy, bool>::call_cancellable(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
                 [](std::vector<pika::future<bool>>&& results) {
@@ -418,7 +480,8 @@ namespace pika::parallel::detail {
                                [](pika::future<bool>& val) {
                                    return val.get();
                                }) == pika::util::end(results);
-                });
+                },
+                [tok](std::size_t) { return tok.was_cancelled(); });
         }
     };
     /// \endcond
@@ -0,0 +1,488 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/batch.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Applies \a f to every element of many independent ranges in one call.
+    /// The range [rngs_first, rngs_last) holds the ranges, e.g. a
+    /// std::vector<std::vector<T>> holding one array per user. Calling
+    /// \a for_each for each of many small ranges partitions every one of
+    /// them on its own and leaves most cores idle; \a for_each_batch
+    /// partitions the elements of all ranges at once instead.
+    ///
+    /// \note   Complexity: Applies \a f exactly N times, where N is the
+    ///         total number of elements of the ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RngIter     The type of the iterator referring to the ranges
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its
+    ///                     value type must be a range whose iterators are
+    ///                     random access iterators.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rngs_first   Refers to the beginning of the sequence of ranges
+    ///                     the algorithm will be applied to.
+    /// \param rngs_last    Refers to the end of the sequence of ranges.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     ranges. The signature of this function should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(Type& a);
+    ///                     \endcode \n
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread. The
+    /// elements of all ranges are partitioned as a single sequence, in the
+    /// order of the ranges: the chunks hold about the same number of
+    /// elements however unevenly the elements are distributed over the
+    /// ranges, a chunk may span several ranges and a range may span several
+    /// chunks.
+    ///
+    /// \returns  The \a for_each_batch algorithm returns a
+    ///           \a pika::future<RngIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RngIter otherwise. The algorithm returns
+    ///           \a rngs_last.
+    ///
+    template <typename ExPolicy, typename RngIter, typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RngIter>::type
+    for_each_batch(ExPolicy&& policy, RngIter rngs_first, RngIter rngs_last,
+        F&& f);
+
+    /// Reduces many independent ranges in one call, writing one result per
+    /// range: for every range r of [rngs_first, rngs_last) the value
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(op, init, conv(*begin(r)), ...,
+    /// conv(*(end(r) - 1))) is written to the next element of the
+    /// destination range. Empty ranges yield \a init.
+    ///
+    /// \note   Complexity: O(N + S) applications of \a op and O(N)
+    ///         applications of \a conv, where N is the total number of
+    ///         elements of the ranges and S is the number of ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam RngIter     The type of the iterator referring to the ranges
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its
+    ///                     value type must be a range whose iterators are
+    ///                     random access iterators.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    /// \tparam Reduce      The type of the binary function object used for
+    ///                     the reduction operation.
+    /// \tparam Convert     The type of the unary function object used to
+    ///                     transform the elements of the ranges.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rngs_first   Refers to the beginning of the sequence of ranges
+    ///                     the algorithm will be applied to.
+    /// \param rngs_last    Refers to the end of the sequence of ranges.
+    /// \param dest         Refers to the beginning of the destination range,
+    ///                     which receives one value per range.
+    /// \param init         The initial value for the reduction of every
+    ///                     range.
+    /// \param op           Specifies the associative function (or function
+    ///                     object) which will be invoked to combine the
+    ///                     converted elements of a range with \a init and
+    ///                     with the intermediate results.
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     ranges. The result of \a conv must be convertible
+    ///                     to \a T.
+    ///
+    /// The elements of all ranges are partitioned as by
+    /// \a segmented_transform_reduce, with the ranges as the segments: the
+    /// chunks hold about the same number of elements and ranges, the
+    /// partial results of the ranges spanning several chunks are combined in
+    /// order.
+    ///
+    /// \returns  The \a transform_reduce_batch algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. The algorithm returns the
+    ///           iterator past the last written value.
+    ///
+    template <typename ExPolicy, typename RngIter, typename RandIter,
+        typename T, typename Reduce, typename Convert>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    transform_reduce_batch(ExPolicy&& policy, RngIter rngs_first,
+        RngIter rngs_last, RandIter dest, T init, Reduce&& op, Convert&& conv);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/traits/is_range.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/segmented_reduce.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // for_each_batch, transform_reduce_batch
+    /// \cond NOINTERNAL
+
+    // The offsets of the elements of the ranges [rngs_first, rngs_first +
+    // num_ranges) in the sequence of all of their elements, the ranges are
+    // the segments of that sequence. The offsets are shared by the chunks,
+    // which may outlive the call for asynchronous policies.
+    template <typename RngIter>
+    std::shared_ptr<std::vector<std::size_t>> get_batch_offsets(
+        RngIter rngs_first, std::size_t num_ranges)
+    {
+        auto offsets = std::make_shared<std::vector<std::size_t>>(
+            num_ranges + 1, std::size_t(0));
+        for (std::size_t i = 0; i != num_ranges; ++i)
+        {
+            auto&& rng = rngs_first[i];
+            (*offsets)[i + 1] = (*offsets)[i] +
+                std::size_t(std::distance(
+                    pika::util::begin(rng), pika::util::end(rng)));
+        }
+        return offsets;
+    }
+
+    // The element at position pos of the sequence of all elements, which
+    // belongs to the range segment, see segmented_range_elements
+    template <typename RngIter>
+    struct batch_elements
+    {
+        RngIter rngs_first;
+        std::shared_ptr<std::vector<std::size_t>> offsets;
+
+        auto operator()(std::size_t segment, std::size_t pos) const
+        {
+            return std::next(pika::util::begin(rngs_first[segment]),
+                pos - (*offsets)[segment]);
+        }
+    };
+
+    // for_each_batch
+    template <typename RngIter>
+    struct for_each_batch
+      : public algorithm<for_each_batch<RngIter>, RngIter>
+    {
+        for_each_batch()
+          : for_each_batch::algorithm("for_each_batch")
+        {
+        }
+
+        // the first two arguments bound the ranges, not the elements, the
+        // algorithm never runs inline, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&...)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        template <typename ExPolicy, typename F>
+        static RngIter sequential(
+            ExPolicy, RngIter rngs_first, RngIter rngs_last, F&& f)
+        {
+            for (/**/; rngs_first != rngs_last; ++rngs_first)
+            {
+                auto&& rng = *rngs_first;
+                auto const last = pika::util::end(rng);
+                for (auto it = pika::util::begin(rng); it != last; ++it)
+                {
+                    PIKA_INVOKE(f, *it);
+                }
+            }
+            return rngs_first;
+        }
+
+        template <typename ExPolicy, typename F>
+        static typename algorithm_result<ExPolicy, RngIter>::type parallel(
+            ExPolicy&& policy, RngIter rngs_first, RngIter rngs_last, F&& f)
+        {
+            std::size_t const num_ranges = std::distance(rngs_first, rngs_last);
+            auto offsets = get_batch_offsets(rngs_first, num_ranges);
+            std::size_t const count = offsets->back();
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, RngIter>::get(
+                    PIKA_MOVE(rngs_last));
+            }
+
+            // a chunk starts in the last range whose first element is not
+            // after the first element of the chunk and continues into the
+            // following ranges, skipping the empty ones
+            auto f1 = [elements = batch_elements<RngIter>{rngs_first, offsets},
+                          f = PIKA_FORWARD(F, f)](
+                          auto part_begin, std::size_t part_size) mutable {
+                std::vector<std::size_t> const& batch_offsets =
+                    *elements.offsets;
+
+                std::size_t pos = *part_begin;
+                std::size_t const last = pos + part_size;
+                std::size_t segment = std::upper_bound(batch_offsets.begin(),
+                                          batch_offsets.end(), pos) -
+                    batch_offsets.begin() - 1;
+
+                while (pos != last)
+                {
+                    std::size_t const end =
+                        (std::min)(batch_offsets[segment + 1], last);
+                    if (pos != end)
+                    {
+                        auto it = elements(segment, pos);
+                        for (/**/; pos != end; (void) ++pos, ++it)
+                        {
+                            PIKA_INVOKE(f, *it);
+                        }
+                    }
+                    ++segment;
+                }
+            };
+
+            auto f2 = [rngs_last](
+                          std::vector<pika::future<void>>&& data) -> RngIter {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+                return rngs_last;
+            };
+
+            return partitioner<ExPolicy, RngIter, void>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_counting_iterator(std::size_t(0)), count,
+                PIKA_MOVE(f1), PIKA_MOVE(f2));
+        }
+    };
+
+    // transform_reduce_batch
+    template <typename RandIter>
+    struct transform_reduce_batch
+      : public algorithm<transform_reduce_batch<RandIter>, RandIter>
+    {
+        transform_reduce_batch()
+          : transform_reduce_batch::algorithm("transform_reduce_batch")
+        {
+        }
+
+        // the first two arguments bound the ranges, not the elements, the
+        // algorithm never runs inline, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&...)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        template <typename ExPolicy, typename RngIter, typename T,
+            typename Reduce, typename Convert>
+        static RandIter sequential(ExPolicy, RngIter rngs_first,
+            RngIter rngs_last, RandIter dest, T const& init, Reduce&& r,
+            Convert&& conv)
+        {
+            for (/**/; rngs_first != rngs_last; (void) ++rngs_first, ++dest)
+            {
+                auto&& rng = *rngs_first;
+                auto const last = pika::util::end(rng);
+
+                T value = init;
+                for (auto it = pika::util::begin(rng); it != last; ++it)
+                {
+                    value = PIKA_INVOKE(
+                        r, PIKA_MOVE(value), PIKA_INVOKE(conv, *it));
+                }
+                *dest = PIKA_MOVE(value);
+            }
+            return dest;
+        }
+
+        template <typename ExPolicy, typename RngIter, typename T,
+            typename Reduce, typename Convert>
+        static typename algorithm_result<ExPolicy, RandIter>::type parallel(
+            ExPolicy&& policy, RngIter rngs_first, RngIter rngs_last,
+            RandIter dest, T const& init, Reduce&& r, Convert&& conv)
+        {
+            std::size_t const num_ranges = std::distance(rngs_first, rngs_last);
+            if (num_ranges == 0)
+            {
+                return algorithm_result<ExPolicy, RandIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            auto offsets = get_batch_offsets(rngs_first, num_ranges);
+            std::size_t const* offsets_first = offsets->data();
+            return parallel_segmented_reduce(PIKA_FORWARD(ExPolicy, policy),
+                batch_elements<RngIter>{rngs_first, PIKA_MOVE(offsets)},
+                offsets_first, num_ranges, dest, init, PIKA_FORWARD(Reduce, r),
+                PIKA_FORWARD(Convert, conv));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::for_each_batch
+    inline constexpr struct for_each_batch_t final
+      : pika::detail::tag_parallel_algorithm<for_each_batch_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RngIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RngIter>::type
+        tag_fallback_invoke(pika::for_each_batch_t, ExPolicy&& policy,
+            RngIter rngs_first, RngIter rngs_last, F&& f)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RngIter>::value,
+                "Requires a random access iterator for the ranges.");
+            using range_type =
+                typename std::iterator_traits<RngIter>::value_type;
+            using range_iterator = pika::traits::range_iterator_t<range_type>;
+            static_assert(
+                pika::traits::is_random_access_iterator<range_iterator>::value,
+                "Requires ranges of random access iterators.");
+
+            return pika::parallel::detail::for_each_batch<RngIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), rngs_first, rngs_last,
+                PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename RngIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value
+            )>
+        // clang-format on
+        friend RngIter tag_fallback_invoke(pika::for_each_batch_t,
+            RngIter rngs_first, RngIter rngs_last, F&& f)
+        {
+            return for_each_batch_t{}(pika::execution::seq, rngs_first,
+                rngs_last, PIKA_FORWARD(F, f));
+        }
+    } for_each_batch{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::transform_reduce_batch
+    inline constexpr struct transform_reduce_batch_t final
+      : pika::detail::tag_parallel_algorithm<transform_reduce_batch_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RngIter, typename RandIter,
+            typename T, typename Reduce, typename Convert,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(pika::transform_reduce_batch_t,
+            ExPolicy&& policy, RngIter rngs_first, RngIter rngs_last,
+            RandIter dest, T init, Reduce&& op, Convert&& conv)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RngIter>::value,
+                "Requires a random access iterator for the ranges.");
+            using range_type =
+                typename std::iterator_traits<RngIter>::value_type;
+            using range_iterator = pika::traits::range_iterator_t<range_type>;
+            static_assert(
+                pika::traits::is_random_access_iterator<range_iterator>::value,
+                "Requires ranges of random access iterators.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator for the destination.");
+
+            return pika::parallel::detail::transform_reduce_batch<RandIter>()
+                .call(PIKA_FORWARD(ExPolicy, policy), rngs_first, rngs_last,
+                    dest, PIKA_MOVE(init), PIKA_FORWARD(Reduce, op),
+                    PIKA_FORWARD(Convert, conv));
+        }
+
+        // clang-format off
+        template <typename RngIter, typename RandIter, typename T,
+            typename Reduce, typename Convert,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(pika::transform_reduce_batch_t,
+            RngIter rngs_first, RngIter rngs_last, RandIter dest, T init,
+            Reduce&& op, Convert&& conv)
+        {
+            return transform_reduce_batch_t{}(pika::execution::seq,
+                rngs_first, rngs_last, dest, PIKA_MOVE(init),
+                PIKA_FORWARD(Reduce, op), PIKA_FORWARD(Convert, conv));
+        }
+    } transform_reduce_batch{};
+}    // namespace pika
+
+#endif    // DOXYGEN
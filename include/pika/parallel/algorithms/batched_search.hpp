@@ -0,0 +1,679 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/batched_search.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// For every element q of the range of queries [queries_first,
+    /// queries_last) writes the iterator to the first element of the sorted
+    /// range [first, last) which is not ordered before q to the range
+    /// beginning at \a dest, as std::lower_bound(first, last, q, comp)
+    /// would. The results are written in the order of the queries.
+    ///
+    /// \note   Complexity: O(M log(N)) applications of the comparison
+    ///         \a comp, where M is the number of queries and N is
+    ///         std::distance(first, last). Runs of sorted queries take
+    ///         O(log(d)) comparisons per query, where d is the distance of
+    ///         the result from the result of the previous query.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the iterators representing the sorted
+    ///                     range searched in (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam FwdIter2    The type of the iterators representing the
+    ///                     queries (deduced). This iterator type must meet
+    ///                     the requirements of a forward iterator.
+    /// \tparam FwdIter3    The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a batched_lower_bound requires \a Comp
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///                     This defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sorted range
+    ///                     searched in.
+    /// \param last         Refers to the end of the sorted range searched in.
+    /// \param queries_first Refers to the beginning of the range of values
+    ///                     searched for.
+    /// \param queries_last Refers to the end of the range of values searched
+    ///                     for.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. It is invoked with an element of the searched
+    ///                     range and a query in both orders.
+    ///
+    /// The searches in the parallel \a batched_lower_bound algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The searches in the parallel \a batched_lower_bound algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a batched_lower_bound algorithm returns a
+    ///           \a pika::future<FwdIter3> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter3 otherwise. The \a batched_lower_bound
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+        typename FwdIter3, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter3>::type
+    batched_lower_bound(ExPolicy&& policy, RandIter1 first, RandIter1 last,
+        FwdIter2 queries_first, FwdIter2 queries_last, FwdIter3 dest,
+        Comp&& comp = Comp());
+
+    /// For every element q of the range of queries [queries_first,
+    /// queries_last) writes the iterator to the first element of the sorted
+    /// range [first, last) which is ordered after q to the range beginning
+    /// at \a dest, as std::upper_bound(first, last, q, comp) would.
+    ///
+    /// The parameters, complexity and the guarantees for the execution
+    /// policies are the same as for \a batched_lower_bound.
+    ///
+    /// \returns  The \a batched_upper_bound algorithm returns a
+    ///           \a pika::future<FwdIter3> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter3 otherwise. The \a batched_upper_bound
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+        typename FwdIter3, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter3>::type
+    batched_upper_bound(ExPolicy&& policy, RandIter1 first, RandIter1 last,
+        FwdIter2 queries_first, FwdIter2 queries_last, FwdIter3 dest,
+        Comp&& comp = Comp());
+
+    /// For every element q of the range of queries [queries_first,
+    /// queries_last) writes the pair of iterators delimiting the elements of
+    /// the sorted range [first, last) equivalent to q to the range beginning
+    /// at \a dest, as std::equal_range(first, last, q, comp) would. The
+    /// destination range must be assignable from
+    /// std::pair<RandIter1, RandIter1>.
+    ///
+    /// The parameters, complexity and the guarantees for the execution
+    /// policies are the same as for \a batched_lower_bound.
+    ///
+    /// \returns  The \a batched_equal_range algorithm returns a
+    ///           \a pika::future<FwdIter3> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter3 otherwise. The \a batched_equal_range
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+        typename FwdIter3, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter3>::type
+    batched_equal_range(ExPolicy&& policy, RandIter1 first, RandIter1 last,
+        FwdIter2 queries_first, FwdIter2 queries_last, FwdIter3 dest,
+        Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // batched_lower_bound, batched_upper_bound, batched_equal_range
+    /// \cond NOINTERNAL
+
+    enum class batched_search_kind
+    {
+        lower_bound,
+        upper_bound,
+        equal_range
+    };
+
+    // number of unsorted queries searched for at the same time
+    inline constexpr std::size_t batched_search_group_size = 16;
+
+    // the element of the searched range is ordered before the result
+    template <bool Upper, typename Comp, typename T1, typename T2>
+    constexpr bool batched_search_before(Comp& comp, T1&& elem, T2&& query)
+    {
+        if constexpr (Upper)
+        {
+            return !PIKA_INVOKE(comp, query, elem);
+        }
+        else
+        {
+            return PIKA_INVOKE(comp, elem, query);
+        }
+    }
+
+    // Queries can be tested for being sorted only if comp orders them.
+    template <typename QIter, typename Comp>
+    bool batched_search_is_sorted(QIter queries, std::size_t count, Comp& comp)
+    {
+        using reference = typename std::iterator_traits<QIter>::reference;
+        if constexpr (std::is_invocable_v<Comp&, reference, reference>)
+        {
+            if (count < 2)
+            {
+                return true;
+            }
+
+            QIter next = queries;
+            for (++next; --count != 0; ++queries, ++next)
+            {
+                if (PIKA_INVOKE(comp, *next, *queries))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // The results of sorted queries are sorted as well, every search
+    // gallops from the result of the previous query.
+    template <batched_search_kind Kind, typename Iter, typename QIter,
+        typename OutIter, typename Comp, typename Proj>
+    OutIter batched_search_sorted(Iter first, Iter last, QIter queries,
+        std::size_t count, OutIter dest, Comp& comp, Proj& proj)
+    {
+        for (/**/; count != 0; --count, ++queries, ++dest)
+        {
+            auto&& query = *queries;
+            if constexpr (Kind == batched_search_kind::upper_bound)
+            {
+                first =
+                    detail::gallop_upper_bound(first, last, query, comp, proj);
+                *dest = first;
+            }
+            else
+            {
+                first =
+                    detail::gallop_lower_bound(first, last, query, comp, proj);
+                if constexpr (Kind == batched_search_kind::lower_bound)
+                {
+                    *dest = first;
+                }
+                else
+                {
+                    *dest = std::make_pair(first,
+                        detail::gallop_upper_bound(
+                            first, last, query, comp, proj));
+                }
+            }
+        }
+        return dest;
+    }
+
+    // Branchless binary searches of a group of queries in [first, first +
+    // size). All searches halve ranges of the same length in lock step, the
+    // loads of different queries do not depend on each other and overlap in
+    // the memory system instead of waiting for each other.
+    template <bool Upper, typename Iter, typename QIter, typename Comp,
+        typename Proj>
+    void batched_search_group(Iter first,
+        typename std::iterator_traits<Iter>::difference_type size,
+        std::array<QIter, batched_search_group_size> const& queries,
+        std::size_t n, std::array<Iter, batched_search_group_size>& base,
+        Comp& comp, Proj& proj)
+    {
+        using difference_type =
+            typename std::iterator_traits<Iter>::difference_type;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            base[i] = first;
+        }
+
+        // the result for query i is in [base[i], base[i] + len]
+        for (difference_type len = size; len > 1; /**/)
+        {
+            difference_type const half = len / 2;
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                base[i] += batched_search_before<Upper>(comp,
+                               PIKA_INVOKE(proj, base[i][half]), *queries[i]) ?
+                    half :
+                    0;
+            }
+            len -= half;
+        }
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            if (batched_search_before<Upper>(
+                    comp, PIKA_INVOKE(proj, *base[i]), *queries[i]))
+            {
+                ++base[i];
+            }
+        }
+    }
+
+    template <batched_search_kind Kind, typename Iter, typename QIter,
+        typename OutIter, typename Comp, typename Proj>
+    OutIter batched_search_unsorted(Iter first, Iter last, QIter queries,
+        std::size_t count, OutIter dest, Comp& comp, Proj& proj)
+    {
+        auto const size = last - first;
+
+        std::array<QIter, batched_search_group_size> group;
+        std::array<Iter, batched_search_group_size> lower;
+        std::array<Iter, batched_search_group_size> upper;
+        while (count != 0)
+        {
+            std::size_t const n = (std::min)(count, batched_search_group_size);
+            for (std::size_t i = 0; i != n; ++i, ++queries)
+            {
+                group[i] = queries;
+            }
+            count -= n;
+
+            if constexpr (Kind != batched_search_kind::upper_bound)
+            {
+                batched_search_group<false>(
+                    first, size, group, n, lower, comp, proj);
+            }
+            if constexpr (Kind != batched_search_kind::lower_bound)
+            {
+                batched_search_group<true>(
+                    first, size, group, n, upper, comp, proj);
+            }
+
+            for (std::size_t i = 0; i != n; ++i, ++dest)
+            {
+                if constexpr (Kind == batched_search_kind::lower_bound)
+                {
+                    *dest = lower[i];
+                }
+                else if constexpr (Kind == batched_search_kind::upper_bound)
+                {
+                    *dest = upper[i];
+                }
+                else
+                {
+                    *dest = std::make_pair(lower[i], upper[i]);
+                }
+            }
+        }
+        return dest;
+    }
+
+    template <batched_search_kind Kind, typename Iter, typename QIter,
+        typename OutIter, typename Comp, typename Proj>
+    OutIter batched_search_n(Iter first, Iter last, QIter queries,
+        std::size_t count, OutIter dest, Comp& comp, Proj& proj)
+    {
+        if (first == last)
+        {
+            for (/**/; count != 0; --count, ++dest)
+            {
+                if constexpr (Kind == batched_search_kind::equal_range)
+                {
+                    *dest = std::make_pair(first, last);
+                }
+                else
+                {
+                    *dest = first;
+                }
+            }
+            return dest;
+        }
+
+        if (batched_search_is_sorted(queries, count, comp))
+        {
+            return batched_search_sorted<Kind>(
+                first, last, queries, count, dest, comp, proj);
+        }
+        return batched_search_unsorted<Kind>(
+            first, last, queries, count, dest, comp, proj);
+    }
+
+    template <batched_search_kind Kind>
+    constexpr char const* batched_search_name() noexcept
+    {
+        if constexpr (Kind == batched_search_kind::lower_bound)
+        {
+            return "batched_lower_bound";
+        }
+        else if constexpr (Kind == batched_search_kind::upper_bound)
+        {
+            return "batched_upper_bound";
+        }
+        else
+        {
+            return "batched_equal_range";
+        }
+    }
+
+    template <batched_search_kind Kind, typename OutIter>
+    struct batched_search
+      : public algorithm<batched_search<Kind, OutIter>, OutIter>
+    {
+        batched_search()
+          : batched_search::algorithm(batched_search_name<Kind>())
+        {
+        }
+
+        // the work is bounded by the number of queries, see inline_threshold
+        template <typename Iter, typename QIter, typename... Args>
+        static constexpr std::size_t get_inline_count(Iter const&,
+            Iter const&, QIter const& queries_first, QIter const& queries_last,
+            Args const&...)
+        {
+            return inline_count(queries_first, queries_last);
+        }
+
+        template <typename ExPolicy, typename Iter, typename QIter,
+            typename Comp, typename Proj>
+        static OutIter sequential(ExPolicy, Iter first, Iter last,
+            QIter queries_first, QIter queries_last, OutIter dest, Comp&& comp,
+            Proj&& proj)
+        {
+            return batched_search_n<Kind>(first, last, queries_first,
+                detail::distance(queries_first, queries_last), dest, comp,
+                proj);
+        }
+
+        // The queries are partitioned into chunks, every chunk checks
+        // whether its queries are sorted.
+        template <typename ExPolicy, typename Iter, typename QIter,
+            typename Comp, typename Proj>
+        static typename algorithm_result<ExPolicy, OutIter>::type parallel(
+            ExPolicy&& policy, Iter first, Iter last, QIter queries_first,
+            QIter queries_last, OutIter dest, Comp&& comp, Proj&& proj)
+        {
+            std::size_t const count =
+                detail::distance(queries_first, queries_last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, OutIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            auto f1 = [first, last, dest, comp = PIKA_FORWARD(Comp, comp),
+                          proj = PIKA_FORWARD(Proj, proj)](QIter it,
+                          std::size_t part_count,
+                          std::size_t base_idx) mutable -> void {
+                batched_search_n<Kind>(first, last, it, part_count,
+                    std::next(dest, base_idx), comp, proj);
+            };
+
+            auto f2 = [dest, count](
+                          std::vector<pika::future<void>>&& data) -> OutIter {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+                return std::next(dest, count);
+            };
+
+            return partitioner<ExPolicy, OutIter, void>::call_with_index(
+                PIKA_FORWARD(ExPolicy, policy), queries_first, count, 1,
+                PIKA_MOVE(f1), PIKA_MOVE(f2));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::batched_lower_bound
+    inline constexpr struct batched_lower_bound_t final
+      : pika::detail::tag_parallel_algorithm<batched_lower_bound_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+            typename FwdIter3, typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter3>::type
+        tag_fallback_invoke(batched_lower_bound_t, ExPolicy&& policy,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, FwdIter3 dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::lower_bound,
+                FwdIter3>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    queries_first, queries_last, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename FwdIter2, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(batched_lower_bound_t,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, OutIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::lower_bound,
+                OutIter>()
+                .call(pika::execution::seq, first, last, queries_first,
+                    queries_last, dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+    } batched_lower_bound{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::batched_upper_bound
+    inline constexpr struct batched_upper_bound_t final
+      : pika::detail::tag_parallel_algorithm<batched_upper_bound_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+            typename FwdIter3, typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter3>::type
+        tag_fallback_invoke(batched_upper_bound_t, ExPolicy&& policy,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, FwdIter3 dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::upper_bound,
+                FwdIter3>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    queries_first, queries_last, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename FwdIter2, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(batched_upper_bound_t,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, OutIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::upper_bound,
+                OutIter>()
+                .call(pika::execution::seq, first, last, queries_first,
+                    queries_last, dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+    } batched_upper_bound{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::batched_equal_range
+    inline constexpr struct batched_equal_range_t final
+      : pika::detail::tag_parallel_algorithm<batched_equal_range_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+            typename FwdIter3, typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter3>::type
+        tag_fallback_invoke(batched_equal_range_t, ExPolicy&& policy,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, FwdIter3 dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::equal_range,
+                FwdIter3>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    queries_first, queries_last, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename FwdIter2, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(batched_equal_range_t,
+            RandIter1 first, RandIter1 last, FwdIter2 queries_first,
+            FwdIter2 queries_last, OutIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::batched_search<
+                pika::parallel::detail::batched_search_kind::equal_range,
+                OutIter>()
+                .call(pika::execution::seq, first, last, queries_first,
+                    queries_last, dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+    } batched_equal_range{};
+}    // namespace pika
+
+#endif    // DOXYGEN
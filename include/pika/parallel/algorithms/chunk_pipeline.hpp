@@ -0,0 +1,244 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/chunk_pipeline.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The number of elements the sequential pipeline runs all stages on
+    // before it moves on, small enough for the chunks of a few ranges of
+    // small values to stay in the first level cache.
+    inline constexpr std::size_t chunk_pipeline_block_size = 1024;
+
+    template <typename... Stages>
+    struct chunk_pipeline_iteration
+    {
+        std::tuple<Stages...> stages;
+
+        template <typename Iter>
+        void operator()(Iter part_begin, std::size_t part_size, std::size_t)
+        {
+            std::size_t const begin = *part_begin;
+            std::apply(
+                [&](Stages&... s) { (s(begin, part_size), ...); }, stages);
+        }
+    };
+
+    template <typename Iter>
+    struct chunk_pipeline_algo
+      : public algorithm<chunk_pipeline_algo<Iter>, Iter>
+    {
+        constexpr chunk_pipeline_algo() noexcept
+          : chunk_pipeline_algo::algorithm("chunk_pipeline")
+        {
+        }
+
+        template <typename ExPolicy, typename... Stages>
+        static Iter sequential(
+            ExPolicy&&, Iter first, Iter last, Stages&&... stages)
+        {
+            std::size_t const count = detail::distance(first, last);
+            for (std::size_t begin = 0; begin < count;
+                 begin += chunk_pipeline_block_size)
+            {
+                std::size_t const size =
+                    (std::min)(chunk_pipeline_block_size, count - begin);
+                (stages(begin, size), ...);
+            }
+            return last;
+        }
+
+        template <typename ExPolicy, typename... Stages>
+        static typename algorithm_result<ExPolicy, Iter>::type parallel(
+            ExPolicy&& policy, Iter first, Iter last, Stages&&... stages)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(last));
+            }
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last),
+                chunk_pipeline_iteration<std::decay_t<Stages>...>{
+                    {PIKA_FORWARD(Stages, stages)...}},
+                projection_identity());
+        }
+    };
+
+    // The pipeline sent by a predecessor sender runs its chunks as a bulk
+    // operation, see partition_sender.
+    template <typename ExPolicy, typename... Ts>
+    struct is_chunk_pipeline_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename Size, typename... Stages>
+    struct is_chunk_pipeline_sender_available<ExPolicy, Size, Stages...>
+      : std::bool_constant<use_partition_sender_v<ExPolicy> &&
+            std::is_integral_v<Size> &&
+            (pika::detail::is_chunked_stage<Stages>::value && ...)>
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Binds the element-wise algorithm \a tag to the beginning \a first of
+    /// its first range and to its remaining arguments \a ts, for use as a
+    /// stage of \a chunk_pipeline. The end of the first range is given by
+    /// the pipeline. A stage run on the elements [begin, begin + size)
+    /// invokes
+    /// \code
+    /// tag(pika::execution::seq, first + begin, first + begin + size,
+    ///     ts...);
+    /// \endcode
+    /// where every random access iterator among \a ts is advanced by begin
+    /// as well. The supported algorithms are for_each, transform, fill and
+    /// copy.
+    ///
+    template <typename Tag, typename Iter, typename... Ts>
+    pika::detail::chunked_stage<Tag, Iter, std::decay_t<Ts>...> chunked(
+        Tag, Iter first, Ts&&... ts)
+    {
+        return {
+            first, std::tuple<std::decay_t<Ts>...>(PIKA_FORWARD(Ts, ts)...)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Runs the element-wise algorithms \a stages, created by \a chunked, on
+    /// the first \a count elements of their ranges such that the stages are
+    /// connected chunk by chunk: every chunk runs all stages one after the
+    /// other, the next stage reads the results of the previous one while
+    /// they are still in the cache. The chunks are determined by the
+    /// partitioner of the policy, there is no synchronization between the
+    /// stages of different chunks.
+    ///
+    /// \code
+    /// pika::chunk_pipeline(pika::execution::par, x.size(),
+    ///     pika::chunked(pika::transform, x.begin(), y.begin(), f),
+    ///     pika::chunked(pika::for_each, y.begin(), g));
+    /// \endcode
+    ///
+    /// Sent by a predecessor sender, the pipeline runs as a single bulk
+    /// operation without any future, whereas the same algorithms chained
+    /// as separate senders wait for all chunks of a stage before the next
+    /// stage starts.
+    ///
+    /// The execution of chunk_pipeline without specifying an execution
+    /// policy is equivalent to specifying \a pika::execution::seq as the
+    /// execution policy, which runs the stages on blocks of
+    /// chunk_pipeline_block_size elements.
+    ///
+    /// \returns  The parallel task overloads return a future<void>, the
+    ///           other overloads return nothing.
+    ///
+    /// \note The stages of a chunk only see the results of the previous
+    ///       stages for the same elements. Stages which read elements of
+    ///       other chunks, or ranges of different lengths, are not
+    ///       supported. A negative count does nothing.
+    ///
+    inline constexpr struct chunk_pipeline_t final
+      : pika::detail::tag_parallel_algorithm<chunk_pipeline_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Size, typename... Stages,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                std::is_integral<Size>::value &&
+                std::conjunction_v<pika::detail::is_chunked_stage<
+                    std::decay_t<Stages>>...>
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::chunk_pipeline_t, ExPolicy&& policy,
+            Size count, Stages&&... stages)
+        {
+            std::size_t const n =
+                parallel::detail::is_negative(count) ? 0 : std::size_t(count);
+            auto first = pika::util::make_counting_iterator(std::size_t(0));
+
+            return parallel::detail::algorithm_result<ExPolicy>::get(
+                parallel::detail::chunk_pipeline_algo<decltype(first)>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, first + n,
+                    PIKA_FORWARD(Stages, stages)...));
+        }
+
+        // clang-format off
+        template <typename Size, typename... Stages,
+            PIKA_CONCEPT_REQUIRES_(
+                std::is_integral<Size>::value &&
+                std::conjunction_v<pika::detail::is_chunked_stage<
+                    std::decay_t<Stages>>...>
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            pika::chunk_pipeline_t, Size count, Stages&&... stages)
+        {
+            std::size_t const n =
+                parallel::detail::is_negative(count) ? 0 : std::size_t(count);
+            auto first = pika::util::make_counting_iterator(std::size_t(0));
+
+            parallel::detail::chunk_pipeline_algo<decltype(first)>().call(
+                pika::execution::seq, first, first + n,
+                PIKA_FORWARD(Stages, stages)...);
+        }
+    } chunk_pipeline{};
+}    // namespace pika
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct algorithm_sender<pika::chunk_pipeline_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_chunk_pipeline_sender_available<
+                ExPolicy, Ts...>::value;
+
+        template <typename ExPolicy, typename Size, typename... Stages>
+        static auto call(ExPolicy&& policy, Size count, Stages... stages)
+        {
+            return pika::parallel::detail::partition_sender<void>(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::parallel::detail::is_negative(count) ?
+                    std::size_t(0) :
+                    std::size_t(count),
+                [stages = std::tuple<Stages...>(PIKA_MOVE(stages)...)](
+                    std::size_t begin, std::size_t size) mutable {
+                    std::apply(
+                        [&](Stages&... s) { (s(begin, size), ...); }, stages);
+                },
+                [] {});
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
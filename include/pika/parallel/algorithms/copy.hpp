@@ -204,6 +204,7 @@ namespace pika {
 #include <pika/assert.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
@@ -212,9 +213,12 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/detail/transfer.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/compaction_staging.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
@@ -263,6 +267,8 @@ namespace pika { namespace parallel {
             {
             }
 
+            static constexpr bool bandwidth_bound = true;
+
             template <typename ExPolicy, typename InIter, typename Sent,
                 typename OutIter>
             static constexpr std::enable_if_t<
@@ -283,6 +289,13 @@ namespace pika { namespace parallel {
                 in_out_result<InIter, OutIter>>
             sequential(ExPolicy, InIter first, Sent last, OutIter dest)
             {
+                // the bits packed into words are copied a word at a time
+                if constexpr (use_packed_bits_copy_v<InIter, OutIter>)
+                {
+                    return sequential_packed_bits_copy(
+                        first, detail::distance(first, last), dest);
+                }
+
                 in_out_result<InIter, OutIter> result = copy_n<ExPolicy>(
                     first, detail::distance(first, last), dest);
                 copy_synchronize(first, dest);
@@ -306,6 +319,13 @@ namespace pika { namespace parallel {
                     in_out_result<FwdIter1, FwdIter2>>::type* dummy = nullptr;
                 return PIKA_MOVE(*dummy);
 #else
+                if constexpr (use_packed_bits_copy_v<FwdIter1, FwdIter2>)
+                {
+                    return parallel_packed_bits_copy(
+                        PIKA_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), dest);
+                }
+
                 using zip_iterator =
                     pika::util::zip_iterator<FwdIter1, FwdIter2>;
 
@@ -350,10 +370,17 @@ namespace pika { namespace parallel {
             {
             }
 
+            static constexpr bool bandwidth_bound = true;
+
             template <typename ExPolicy, typename InIter, typename OutIter>
             static constexpr in_out_result<InIter, OutIter>
             sequential(ExPolicy, InIter first, std::size_t count, OutIter dest)
             {
+                if constexpr (use_packed_bits_copy_v<InIter, OutIter>)
+                {
+                    return sequential_packed_bits_copy(first, count, dest);
+                }
+
                 in_out_result<InIter, OutIter> result =
                     copy_n<ExPolicy>(first, count, dest);
                 copy_synchronize(first, dest);
@@ -366,6 +393,12 @@ namespace pika { namespace parallel {
             parallel(ExPolicy&& policy, FwdIter1 first, std::size_t count,
                 FwdIter2 dest)
             {
+                if constexpr (use_packed_bits_copy_v<FwdIter1, FwdIter2>)
+                {
+                    return parallel_packed_bits_copy(
+                        PIKA_FORWARD(ExPolicy, policy), first, count, dest);
+                }
+
                 using zip_iterator =
                     pika::util::zip_iterator<FwdIter1, FwdIter2>;
 
@@ -418,6 +451,8 @@ namespace pika { namespace parallel {
             {
             }
 
+            static constexpr bool allocation_free = true;
+
             template <typename ExPolicy, typename InIter1, typename InIter2,
                 typename OutIter, typename Pred,
                 typename Proj = projection_identity>
@@ -437,7 +472,8 @@ namespace pika { namespace parallel {
             parallel(ExPolicy&& policy, FwdIter1 first, FwdIter2 last,
                 FwdIter3 dest, Pred&& pred, Proj&& proj /* = Proj()*/)
             {
-                using zip_iterator = pika::util::zip_iterator<FwdIter1, bool*>;
+                using zip_iterator = pika::util::zip_iterator<FwdIter1,
+                    pika::util::counting_iterator<std::size_t>>;
                 using result = algorithm_result<ExPolicy,
                     in_out_result<FwdIter1, FwdIter3>>;
                 using difference_type =
@@ -451,7 +487,38 @@ namespace pika { namespace parallel {
 
                 difference_type count = detail::distance(first, last);
 
-                std::shared_ptr<bool[]> flags(new bool[count]);
+                // small inputs are not worth allocating the flags for
+                if (std::size_t(count) < flag_buffer_sequential_limit)
+                {
+                    return copy_if_algo()(PIKA_FORWARD(ExPolicy, policy),
+                        first, last, dest, PIKA_FORWARD(Pred, pred),
+                        PIKA_FORWARD(Proj, proj));
+                }
+
+                using value_type =
+                    typename std::iterator_traits<FwdIter1>::value_type;
+
+                switch (select_stream_compaction(policy.parameters()))
+                {
+                case pika::execution::stream_compaction_mode::recompute:
+                    return parallel_recompute(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, dest, PIKA_FORWARD(Pred, pred),
+                        PIKA_FORWARD(Proj, proj));
+
+                case pika::execution::stream_compaction_mode::staging:
+                    if constexpr (std::is_copy_constructible_v<value_type>)
+                    {
+                        return parallel_staging(PIKA_FORWARD(ExPolicy, policy),
+                            first, count, dest, PIKA_FORWARD(Pred, pred),
+                            PIKA_FORWARD(Proj, proj));
+                    }
+                    break;
+
+                default:
+                    break;
+                }
+
+                flag_buffer flags(count);
                 std::size_t init = 0;
 
                 using pika::util::make_zip_iterator;
@@ -460,35 +527,32 @@ namespace pika { namespace parallel {
                     in_out_result<FwdIter1, FwdIter3>, std::size_t>;
 
                 auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                              proj = PIKA_FORWARD(decltype(proj), proj)](
-                              zip_iterator part_begin,
-                              std::size_t part_size) -> std::size_t {
-                    std::size_t curr = 0;
+                              proj = PIKA_FORWARD(decltype(proj), proj),
+                              flags](zip_iterator part_begin,
+                              std::size_t part_size) mutable -> std::size_t {
+                    auto iters = part_begin.get_iterator_tuple();
+                    FwdIter1 it = get<0>(iters);
 
                     // Note: replacing the invoke() with PIKA_INVOKE()
                     // below makes gcc generate errors
-
-                    // MSVC complains if proj is captured by ref below
-                    loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&pred, proj, &curr](zip_iterator it) mutable -> void {
-                            bool f = pika::util::detail::invoke(pred,
-                                pika::util::detail::invoke(proj, get<0>(*it)));
-
-                            if ((get<1>(*it) = f))
-                                ++curr;
-                        });
-
-                    return curr;
+                    return flags.set(*get<1>(iters), part_size, [&]() {
+                        bool f = pika::util::detail::invoke(
+                            pred, pika::util::detail::invoke(proj, *it));
+                        ++it;
+                        return f;
+                    });
                 };
                 auto f3 = [dest, flags](zip_iterator part_begin,
                               std::size_t part_size, std::size_t val) mutable {
-                    PIKA_UNUSED(flags);
                     std::advance(dest, val);
-                    loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                        [&dest](zip_iterator it) mutable {
-                            if (get<1>(*it))
-                                *dest++ = get<0>(*it);
-                        });
+
+                    auto iters = part_begin.get_iterator_tuple();
+                    FwdIter1 it = get<0>(iters);
+                    flags.get(*get<1>(iters), part_size, [&](bool f) {
+                        if (f)
+                            *dest++ = *it;
+                        ++it;
+                    });
                 };
 
                 auto f4 = [first, dest, flags](std::vector<std::size_t>&& items,
@@ -510,7 +574,9 @@ namespace pika { namespace parallel {
 
                 return scan_partitioner_type::call(
                     PIKA_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, flags.get()), count, init,
+                    make_zip_iterator(first,
+                        pika::util::make_counting_iterator(std::size_t(0))),
+                    count, init,
                     // step 1 performs first part of scan algorithm
                     PIKA_MOVE(f1),
                     // step 2 propagates the partition results from left
@@ -521,6 +587,142 @@ namespace pika { namespace parallel {
                     // step 4 use this return value
                     PIKA_MOVE(f4));
             }
+
+        private:
+            template <typename FwdIter1, typename FwdIter3>
+            static in_out_result<FwdIter1, FwdIter3> make_result(
+                FwdIter1 first, FwdIter3 dest,
+                std::vector<std::size_t> const& items,
+                std::vector<pika::future<void>>& data)
+            {
+                auto dist = items.back();
+                std::advance(first, dist);
+                std::advance(dest, dist);
+
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+
+                return in_out_result<FwdIter1, FwdIter3>{
+                    PIKA_MOVE(first), PIKA_MOVE(dest)};
+            }
+
+            // Step 1 counts the elements to copy, step 3 evaluates the
+            // predicate again while copying them.
+            template <typename ExPolicy, typename FwdIter1, typename FwdIter3,
+                typename Pred, typename Proj>
+            static typename algorithm_result<ExPolicy,
+                in_out_result<FwdIter1, FwdIter3>>::type
+            parallel_recompute(ExPolicy&& policy, FwdIter1 first,
+                std::size_t count, FwdIter3 dest, Pred&& pred, Proj&& proj)
+            {
+                using scan_partitioner_type = scan_partitioner<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter3>, std::size_t>;
+
+                // Note: replacing the invoke() with PIKA_INVOKE()
+                // below makes gcc generate errors
+                auto f1 = [pred, proj](FwdIter1 it,
+                              std::size_t part_size) mutable -> std::size_t {
+                    std::size_t curr = 0;
+                    for (/**/; part_size != 0; --part_size, ++it)
+                    {
+                        if (pika::util::detail::invoke(
+                                pred, pika::util::detail::invoke(proj, *it)))
+                        {
+                            ++curr;
+                        }
+                    }
+                    return curr;
+                };
+                auto f3 = [dest, pred = PIKA_FORWARD(Pred, pred),
+                              proj = PIKA_FORWARD(Proj, proj)](FwdIter1 it,
+                              std::size_t part_size, std::size_t val) mutable {
+                    std::advance(dest, val);
+                    for (/**/; part_size != 0; --part_size, ++it)
+                    {
+                        if (pika::util::detail::invoke(
+                                pred, pika::util::detail::invoke(proj, *it)))
+                        {
+                            *dest++ = *it;
+                        }
+                    }
+                };
+
+                auto f4 = [first, dest](std::vector<std::size_t>&& items,
+                              std::vector<pika::future<void>>&& data) {
+                    return make_result(first, dest, items, data);
+                };
+
+                return scan_partitioner_type::call(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    std::size_t(0), PIKA_MOVE(f1), std::plus<std::size_t>(),
+                    PIKA_MOVE(f3), PIKA_MOVE(f4));
+            }
+
+            // Step 1 copies the elements to a buffer owned by the chunk, step
+            // 3 moves them on to the destination.
+            template <typename ExPolicy, typename FwdIter1, typename FwdIter3,
+                typename Pred, typename Proj>
+            static typename algorithm_result<ExPolicy,
+                in_out_result<FwdIter1, FwdIter3>>::type
+            parallel_staging(ExPolicy&& policy, FwdIter1 first,
+                std::size_t count, FwdIter3 dest, Pred&& pred, Proj&& proj)
+            {
+                using zip_iterator = pika::util::zip_iterator<FwdIter1,
+                    pika::util::counting_iterator<std::size_t>>;
+                using value_type =
+                    typename std::iterator_traits<FwdIter1>::value_type;
+                using scan_partitioner_type = scan_partitioner<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter3>, std::size_t>;
+
+                using pika::util::make_zip_iterator;
+                using std::get;
+
+                compaction_staging<value_type> staging;
+
+                auto f1 = [pred = PIKA_FORWARD(Pred, pred),
+                              proj = PIKA_FORWARD(Proj, proj), staging](
+                              zip_iterator part_begin,
+                              std::size_t part_size) mutable -> std::size_t {
+                    auto iters = part_begin.get_iterator_tuple();
+                    FwdIter1 it = get<0>(iters);
+
+                    std::vector<value_type> kept;
+                    for (/**/; part_size != 0; --part_size, ++it)
+                    {
+                        if (pika::util::detail::invoke(
+                                pred, pika::util::detail::invoke(proj, *it)))
+                        {
+                            kept.push_back(*it);
+                        }
+                    }
+
+                    std::size_t const curr = kept.size();
+                    staging.put(*get<1>(iters), PIKA_MOVE(kept));
+                    return curr;
+                };
+                auto f3 = [dest, staging](zip_iterator part_begin, std::size_t,
+                              std::size_t val) mutable {
+                    std::advance(dest, val);
+                    for (auto& element : staging.take(*get<1>(
+                             part_begin.get_iterator_tuple())))
+                    {
+                        *dest++ = PIKA_MOVE(element);
+                    }
+                };
+
+                auto f4 = [first, dest](std::vector<std::size_t>&& items,
+                              std::vector<pika::future<void>>&& data) {
+                    return make_result(first, dest, items, data);
+                };
+
+                return scan_partitioner_type::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    make_zip_iterator(first,
+                        pika::util::make_counting_iterator(std::size_t(0))),
+                    count, std::size_t(0), PIKA_MOVE(f1),
+                    std::plus<std::size_t>(), PIKA_MOVE(f3), PIKA_MOVE(f4));
+            }
         };
     }    // namespace detail
 }}       // namespace pika::parallel
@@ -707,4 +909,13 @@ namespace pika {
     } copy_if{};
 }    // namespace pika
 
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_shape_preserving_algorithm<pika::copy_t> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #endif    // DOXYGEN
@@ -158,14 +158,15 @@ namespace pika {
 #include <pika/functional/invoke.hpp>
 #include <pika/iterator_support/range.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
-#include <pika/pack_traversal/unwrap.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
 #include <pika/parallel/util/invoke_projected.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
@@ -258,6 +259,16 @@ namespace pika::parallel::detail {
         static difference_type sequential(ExPolicy&& policy, InIterB first,
             InIterE last, T const& value, Proj&& proj)
         {
+            // the bits packed into words are counted a word at a time
+            if constexpr (use_packed_bits_v<InIterB, Proj> &&
+                is_packed_bits_comparable_v<T>)
+            {
+                return static_cast<difference_type>(
+                    sequential_packed_bits_count(first,
+                        detail::distance(first, last), bool(value == false),
+                        bool(value == true)));
+            }
+
             auto f1 = count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
                 detail::compare_to<T>(value), PIKA_FORWARD(Proj, proj));
 
@@ -280,17 +291,27 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, difference_type>::get(0);
             }
 
+            if constexpr (use_packed_bits_v<IterB, Proj> &&
+                is_packed_bits_comparable_v<T>)
+            {
+                return parallel_packed_bits_count<ExPolicy, difference_type>(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), bool(value == false),
+                    bool(value == true));
+            }
+
             auto f1 = count_iteration<ExPolicy, detail::compare_to<T>, Proj>(
                 detail::compare_to<T>(value), PIKA_FORWARD(Proj, proj));
 
             return detail::partitioner<ExPolicy, difference_type>::call(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
-                pika::unwrapping([](std::vector<difference_type>&& results) {
-                    return accumulate_n(pika::util::begin(results),
-                        pika::util::size(results), difference_type(0),
-                        std::plus<difference_type>());
-                }));
+                make_chunk_values_reducer(
+                    [](std::vector<difference_type>&& results) {
+                        return accumulate_n(pika::util::begin(results),
+                            pika::util::size(results), difference_type(0),
+                            std::plus<difference_type>());
+                    }));
         }
     };
     /// \endcond
@@ -313,6 +334,16 @@ namespace pika::parallel::detail {
         static difference_type sequential(ExPolicy&& policy, InIterB first,
             InIterE last, Pred&& op, Proj&& proj)
         {
+            if constexpr (use_packed_bits_v<InIterB, Proj> &&
+                is_packed_bits_predicate_v<Pred>)
+            {
+                return static_cast<difference_type>(
+                    sequential_packed_bits_count(first,
+                        detail::distance(first, last),
+                        bool(PIKA_INVOKE(op, false)),
+                        bool(PIKA_INVOKE(op, true))));
+            }
+
             auto f1 = count_iteration<ExPolicy, Pred, Proj>(
                 op, PIKA_FORWARD(Proj, proj));
 
@@ -335,17 +366,27 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, difference_type>::get(0);
             }
 
+            if constexpr (use_packed_bits_v<IterB, Proj> &&
+                is_packed_bits_predicate_v<Pred>)
+            {
+                return parallel_packed_bits_count<ExPolicy, difference_type>(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), bool(PIKA_INVOKE(op, false)),
+                    bool(PIKA_INVOKE(op, true)));
+            }
+
             auto f1 = count_iteration<ExPolicy, Pred, Proj>(
                 op, PIKA_FORWARD(Proj, proj));
 
             return detail::partitioner<ExPolicy, difference_type>::call(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
-                pika::unwrapping([](std::vector<difference_type>&& results) {
-                    return accumulate_n(pika::util::begin(results),
-                        pika::util::size(results), difference_type(0),
-                        std::plus<difference_type>());
-                }));
+                make_chunk_values_reducer(
+                    [](std::vector<difference_type>&& results) {
+                        return accumulate_n(pika::util::begin(results),
+                            pika::util::size(results), difference_type(0),
+                            std::plus<difference_type>());
+                    }));
         }
     };
     /// \endcond
@@ -152,9 +152,14 @@ namespace pika::parallel::detail {
     parallel_sequential_destroy_n(
         ExPolicy&& policy, Iter first, std::size_t count)
     {
-        if (count == 0)
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        // there is nothing to do for trivially destructible values, don't
+        // spawn any tasks
+        if (count == 0 || std::is_trivially_destructible_v<value_type>)
         {
-            return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(first));
+            return algorithm_result<ExPolicy, Iter>::get(
+                std::next(first, count));
         }
 
         return foreach_partitioner<ExPolicy>::call(
@@ -162,9 +167,6 @@ namespace pika::parallel::detail {
             [](Iter first, std::size_t count, std::size_t) {
                 return loop_n<std::decay_t<ExPolicy>>(
                     first, count, [](Iter it) -> void {
-                        using value_type =
-                            typename std::iterator_traits<Iter>::value_type;
-
                         std::addressof(*it)->~value_type();
                     });
             },
@@ -7,20 +7,40 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
 #include <pika/functional/invoke.hpp>
 
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <type_traits>
 
 namespace pika::parallel::detail {
     // provide implementation of std::accumulate supporting iterators/sentinels
     template <typename Iter, typename Sent, typename T, typename F>
     inline constexpr T accumulate(Iter first, Sent last, T value, F&& reduce_op)
     {
-        for (/**/; first != last; ++first)
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter> &&
+            std::is_same_v<Iter, Sent>)
         {
-            value = PIKA_INVOKE(reduce_op, value, *first);
+            // reduce the blocks of segmented iterators one by one
+            pika::detail::for_each_contiguous_segment(first,
+                static_cast<std::size_t>(std::distance(first, last)),
+                [&](auto* segment, std::size_t size) {
+                    value = accumulate(
+                        segment, segment + size, PIKA_MOVE(value), reduce_op);
+                    return segment + size;
+                });
+            return value;
+        }
+        else
+        {
+            for (/**/; first != last; ++first)
+            {
+                value = PIKA_INVOKE(reduce_op, value, *first);
+            }
+            return value;
         }
-        return value;
     }
 
     template <typename Iter, typename Sent, typename T>
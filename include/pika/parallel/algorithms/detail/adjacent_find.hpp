@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The chunk kernel of adjacent_find, is_sorted and is_sorted_until:
+    // return the offset of the first of the count positions i at which f
+    // holds for the projected elements i and i + 1, or count if there is
+    // none. count + 1 elements are read if count is not zero. The datapar
+    // policies provide vectorized overloads for arithmetic types.
+    template <typename ExPolicy>
+    struct sequential_adjacent_find_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_adjacent_find_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename F, typename Proj>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_adjacent_find_n_t<ExPolicy>, Iter first,
+            std::size_t count, F&& f, Proj&& proj)
+        {
+            if (count == 0)
+            {
+                return count;
+            }
+
+            Iter next = first;
+            ++next;
+            for (std::size_t i = 0; i != count; (void) ++i, first = next++)
+            {
+                if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first),
+                        PIKA_INVOKE(proj, *next)))
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_adjacent_find_n_t<ExPolicy>
+        sequential_adjacent_find_n = sequential_adjacent_find_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename F, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t sequential_adjacent_find_n(
+        Iter first, std::size_t count, F&& f, Proj&& proj)
+    {
+        return sequential_adjacent_find_n_t<ExPolicy>{}(
+            first, count, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Holds if the second element is ordered before the first one, this is
+    // where a sorted sequence ends.
+    template <typename Compare>
+    struct reversed_comparison
+    {
+        Compare comp;
+
+        template <typename T1, typename T2>
+        constexpr bool operator()(T1&& t1, T2&& t2)
+        {
+            return PIKA_INVOKE(
+                comp, PIKA_FORWARD(T2, t2), PIKA_FORWARD(T1, t1));
+        }
+    };
+
+    // The number of adjacent pairs a partition compares between two checks
+    // of the cancellation token.
+    inline constexpr std::size_t adjacent_find_block_size = 512;
+
+    // Return the offset of the first of the count adjacent pairs in a
+    // partition for which f holds, or count if there is none or stop(offset)
+    // returned true for an offset at which the remaining pairs need not be
+    // compared anymore.
+    template <typename ExPolicy, typename Iter, typename Stop, typename F,
+        typename Proj>
+    std::size_t adjacent_find_partition(
+        Iter first, std::size_t count, Stop&& stop, F&& f, Proj&& proj)
+    {
+        for (std::size_t offset = 0; offset != count; /**/)
+        {
+            if (stop(offset))
+            {
+                break;
+            }
+
+            std::size_t const len =
+                (std::min)(adjacent_find_block_size, count - offset);
+            std::size_t const found =
+                sequential_adjacent_find_n<ExPolicy>(first, len, f, proj);
+            if (found != len)
+            {
+                return offset + found;
+            }
+
+            std::advance(first, len);
+            offset += len;
+        }
+        return count;
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The neighbourhood of an element adjacent_transform invokes its function
+    // with: w[k] refers to the element k positions after the center for k in
+    // [-radius(), radius()].
+    template <typename Iter>
+    class adjacent_window
+    {
+    public:
+        PIKA_HOST_DEVICE constexpr adjacent_window(
+            Iter center, std::size_t radius) noexcept
+          : center_(center)
+          , radius_(radius)
+        {
+        }
+
+        PIKA_HOST_DEVICE constexpr decltype(auto) operator[](
+            std::ptrdiff_t offset) const
+        {
+            return center_[offset];
+        }
+
+        PIKA_HOST_DEVICE constexpr std::size_t radius() const noexcept
+        {
+            return radius_;
+        }
+
+        PIKA_HOST_DEVICE constexpr std::size_t size() const noexcept
+        {
+            return 2 * radius_ + 1;
+        }
+
+    private:
+        Iter center_;
+        std::size_t radius_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Transforms the count elements starting at center, whose neighbourhoods
+    // are all inside the input range.
+    template <typename ExPolicy>
+    struct sequential_adjacent_transform_t
+      : pika::functional::detail::tag_fallback<
+            sequential_adjacent_transform_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename OutIter, typename F>
+        friend inline OutIter tag_fallback_invoke(
+            sequential_adjacent_transform_t<ExPolicy>, Iter center,
+            std::size_t count, OutIter dest, std::size_t radius, F&& f)
+        {
+            for (/**/; count != 0; (void) --count, ++center, ++dest)
+            {
+                *dest = PIKA_INVOKE(f, adjacent_window<Iter>(center, radius));
+            }
+            return dest;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_adjacent_transform_t<ExPolicy>
+        sequential_adjacent_transform =
+            sequential_adjacent_transform_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE OutIter sequential_adjacent_transform(
+        Iter center, std::size_t count, OutIter dest, std::size_t radius,
+        F&& f)
+    {
+        return sequential_adjacent_transform_t<ExPolicy>{}(
+            center, count, dest, radius, PIKA_FORWARD(F, f));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -0,0 +1,457 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/parallel/algorithms/detail/is_sorted.hpp>
+#include <pika/parallel/algorithms/detail/sorting_network.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
+#include <pika/parallel/util/stable_sort_memory_limit.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // runs of at most this many elements are sorted using insertion sort
+    inline constexpr std::ptrdiff_t bounded_stable_sort_run = 32;
+
+    template <typename Parameters>
+    inline constexpr bool use_bounded_stable_sort_v = std::is_same_v<
+        std::decay_t<Parameters>, pika::execution::stable_sort_memory_limit>;
+
+    // Returns the number of elements of the buffer used for sorting count
+    // elements, no merge needs more than half of them.
+    inline std::size_t get_bounded_stable_sort_buffer_size(
+        std::size_t max_buffer_elements, std::size_t count) noexcept
+    {
+        if (max_buffer_elements == 0)
+        {
+            max_buffer_elements =
+                static_cast<std::size_t>(std::sqrt(static_cast<double>(count)));
+        }
+        return (std::min)(max_buffer_elements, (count + 1) / 2);
+    }
+
+    // Reserves the scratch memory of sorting count elements of type T. If
+    // the buffer of half of the elements exceeds the budget, the merges use
+    // a buffer of the elements left in the budget (at least one) instead,
+    // whose size is returned through buffer_elements (zero otherwise).
+    template <typename T, typename Parameters>
+    util::detail::scratch_memory_reservation
+    reserve_stable_sort_scratch_memory(Parameters const& params,
+        std::size_t count, std::size_t& buffer_elements)
+    {
+        util::detail::scratch_memory_reservation reservation(
+            params, ((count + 1) / 2) * sizeof(T));
+        if (reservation)
+        {
+            buffer_elements = 0;
+            return reservation;
+        }
+
+        buffer_elements = get_bounded_stable_sort_buffer_size(
+            (std::max)(util::detail::available_scratch_memory(params) /
+                    sizeof(T),
+                std::size_t(1)),
+            count);
+        return util::detail::scratch_memory_reservation(
+            params, buffer_elements * sizeof(T), false);
+    }
+
+    // Uninitialized storage for the elements moved out of the sequence while
+    // merging. If the requested size can't be allocated, the size is halved
+    // until the allocation succeeds, in the worst case no buffer is used.
+    template <typename T>
+    struct bounded_stable_sort_buffer
+    {
+        explicit bounded_stable_sort_buffer(std::size_t size)
+        {
+            while (size != 0)
+            {
+                try
+                {
+                    data_ = static_cast<T*>(
+                        util::detail::allocate_temporary_buffer(
+                            size * sizeof(T)));
+                    size_ = size;
+                    return;
+                }
+                catch (std::bad_alloc const&)
+                {
+                    size /= 2;
+                }
+            }
+        }
+
+        bounded_stable_sort_buffer(bounded_stable_sort_buffer const&) = delete;
+        bounded_stable_sort_buffer& operator=(
+            bounded_stable_sort_buffer const&) = delete;
+
+        ~bounded_stable_sort_buffer()
+        {
+            util::detail::deallocate_temporary_buffer(data_);
+        }
+
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    template <typename T>
+    struct bounded_stable_sort_destroy_guard
+    {
+        ~bounded_stable_sort_destroy_guard()
+        {
+            std::destroy(first, last);
+        }
+
+        T* first;
+        T* last;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merges [first, middle) and [middle, last) by moving the shorter one of
+    // the two ranges into buf, which has to be large enough to hold it.
+    template <typename Iter, typename T, typename Comp>
+    void buffered_merge(Iter first, Iter middle, Iter last, T* buf, Comp& comp)
+    {
+        if (middle - first <= last - middle)
+        {
+            T* const buf_last = std::uninitialized_move(first, middle, buf);
+            bounded_stable_sort_destroy_guard<T> guard{buf, buf_last};
+
+            T* b = buf;
+            while (b != buf_last && middle != last)
+            {
+                if (PIKA_INVOKE(comp, *middle, *b))
+                {
+                    *first++ = PIKA_MOVE(*middle++);
+                }
+                else
+                {
+                    *first++ = PIKA_MOVE(*b++);
+                }
+            }
+            std::move(b, buf_last, first);
+        }
+        else
+        {
+            T* const buf_last = std::uninitialized_move(middle, last, buf);
+            bounded_stable_sort_destroy_guard<T> guard{buf, buf_last};
+
+            T* b = buf_last;
+            while (b != buf && middle != first)
+            {
+                if (PIKA_INVOKE(comp, *(b - 1), *(middle - 1)))
+                {
+                    *--last = PIKA_MOVE(*--middle);
+                }
+                else
+                {
+                    *--last = PIKA_MOVE(*--b);
+                }
+            }
+            std::move_backward(buf, b, last);
+        }
+    }
+
+    // Selects the positions at which [first, middle) and [middle, last) are
+    // split such that rotating [cut1, cut2) around middle leaves two
+    // independent merges, as done by std::inplace_merge without a buffer.
+    template <typename Iter, typename Comp>
+    std::pair<Iter, Iter> bounded_merge_split(
+        Iter first, Iter middle, Iter last, Comp& comp)
+    {
+        if (middle - first > last - middle)
+        {
+            Iter const cut1 = first + (middle - first) / 2;
+            return {cut1, std::lower_bound(middle, last, *cut1, comp)};
+        }
+
+        Iter const cut2 = middle + (last - middle) / 2;
+        return {std::upper_bound(first, middle, *cut2, comp), cut2};
+    }
+
+    // Stable merge of [first, middle) and [middle, last) using a buffer of
+    // buf_size elements. Ranges too large for the buffer are split and
+    // rotated until the pieces fit.
+    template <typename Iter, typename T, typename Comp>
+    void bounded_merge(Iter first, Iter middle, Iter last, Comp& comp, T* buf,
+        std::size_t buf_size)
+    {
+        while (first != middle && middle != last &&
+            PIKA_INVOKE(comp, *middle, *(middle - 1)))
+        {
+            std::size_t const len1 = middle - first;
+            std::size_t const len2 = last - middle;
+            if (len1 + len2 == 2)
+            {
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                std::ranges::iter_swap(first, middle);
+#else
+                std::iter_swap(first, middle);
+#endif
+                return;
+            }
+
+            if ((std::min)(len1, len2) <= buf_size)
+            {
+                buffered_merge(first, middle, last, buf, comp);
+                return;
+            }
+
+            auto const [cut1, cut2] =
+                bounded_merge_split(first, middle, last, comp);
+            Iter const new_middle = std::rotate(cut1, middle, cut2);
+
+            bounded_merge(first, cut1, new_middle, comp, buf, buf_size);
+            first = new_middle;
+            middle = cut2;
+        }
+    }
+
+    // Bottom up merge sort of [first, last) using a buffer of buf_size
+    // elements.
+    template <typename Iter, typename T, typename Comp>
+    void bounded_stable_sort_sequential(
+        Iter first, Iter last, Comp& comp, T* buf, std::size_t buf_size)
+    {
+        std::ptrdiff_t const count = last - first;
+        for (std::ptrdiff_t i = 0; i < count; i += bounded_stable_sort_run)
+        {
+            small_stable_sort(first + i,
+                first + (std::min)(i + bounded_stable_sort_run, count), comp);
+        }
+
+        for (std::ptrdiff_t width = bounded_stable_sort_run; width < count;
+             width *= 2)
+        {
+            for (std::ptrdiff_t i = 0; i + width < count; i += 2 * width)
+            {
+                bounded_merge(first + i, first + (i + width),
+                    first + (std::min)(i + 2 * width, count), comp, buf,
+                    buf_size);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reverses [first, last), ranges larger than chunk_size are reversed in
+    // parallel.
+    template <typename Exec, typename Iter>
+    void bounded_stable_sort_reverse(
+        Exec& exec, Iter first, Iter last, std::size_t chunk_size)
+    {
+        std::size_t const half = (last - first) / 2;
+        if (half <= chunk_size)
+        {
+            std::reverse(first, last);
+            return;
+        }
+
+        std::size_t const num_chunks = (half + chunk_size - 1) / chunk_size;
+        execution::bulk_sync_execute(
+            exec,
+            [&](std::size_t chunk) {
+                std::size_t const begin = chunk * chunk_size;
+                std::size_t const end = (std::min)(half, begin + chunk_size);
+                for (std::size_t i = begin; i != end; ++i)
+                {
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                    std::ranges::iter_swap(first + i, last - (i + 1));
+#else
+                    std::iter_swap(first + i, last - (i + 1));
+#endif
+                }
+            },
+            pika::detail::irange(std::size_t(0), num_chunks));
+    }
+
+    // Same as std::rotate, but the large ranges are rotated in parallel by
+    // reversing them three times.
+    template <typename Exec, typename Iter>
+    Iter bounded_stable_sort_rotate(Exec& exec, Iter first, Iter middle,
+        Iter last, std::size_t chunk_size)
+    {
+        if (std::size_t(last - first) <= chunk_size)
+        {
+            return std::rotate(first, middle, last);
+        }
+
+        bounded_stable_sort_reverse(exec, first, middle, chunk_size);
+        bounded_stable_sort_reverse(exec, middle, last, chunk_size);
+        bounded_stable_sort_reverse(exec, first, last, chunk_size);
+        return first + (last - middle);
+    }
+
+    // Runs f1 on a new task and f2 on the current one, returns once both
+    // have finished.
+    template <typename Exec, typename F1, typename F2>
+    void bounded_stable_sort_fork_join(Exec& exec, F1&& f1, F2&& f2)
+    {
+        pika::future<void> f = execution::async_execute(exec, f1);
+        try
+        {
+            f2();
+        }
+        catch (...)
+        {
+            // f1 refers to data only valid while this function is running
+            f.wait();
+            throw;
+        }
+        f.get();
+    }
+
+    // Stable merge of [first, middle) and [middle, last), the two merges
+    // left after splitting and rotating the ranges run in parallel and use
+    // a half of the buffer each.
+    template <typename Exec, typename Iter, typename T, typename Comp>
+    void parallel_bounded_merge(Exec& exec, Iter first, Iter middle, Iter last,
+        Comp& comp, T* buf, std::size_t buf_size, std::size_t chunk_size)
+    {
+        if (first == middle || middle == last ||
+            !PIKA_INVOKE(comp, *middle, *(middle - 1)))
+        {
+            return;
+        }
+
+        if (std::size_t(last - first) <= chunk_size)
+        {
+            bounded_merge(first, middle, last, comp, buf, buf_size);
+            return;
+        }
+
+        // the cuts are captured by the lambdas below, which is not possible
+        // for structured bindings
+        std::pair<Iter, Iter> const cuts =
+            bounded_merge_split(first, middle, last, comp);
+        Iter const cut1 = cuts.first;
+        Iter const cut2 = cuts.second;
+        Iter const new_middle =
+            bounded_stable_sort_rotate(exec, cut1, middle, cut2, chunk_size);
+
+        std::size_t const half = buf_size / 2;
+        bounded_stable_sort_fork_join(
+            exec,
+            [&, first, cut1, new_middle, buf, half]() {
+                parallel_bounded_merge(exec, first, cut1, new_middle, comp,
+                    buf, half, chunk_size);
+            },
+            [&]() {
+                parallel_bounded_merge(exec, new_middle, cut2, last, comp,
+                    buf + half, buf_size - half, chunk_size);
+            });
+    }
+
+    template <typename Exec, typename Iter, typename T, typename Comp>
+    void parallel_bounded_stable_sort_helper(Exec& exec, Iter first,
+        Iter last, Comp& comp, T* buf, std::size_t buf_size,
+        std::size_t chunk_size)
+    {
+        if (std::size_t(last - first) <= chunk_size)
+        {
+            bounded_stable_sort_sequential(first, last, comp, buf, buf_size);
+            return;
+        }
+
+        Iter const middle = first + (last - first) / 2;
+        std::size_t const half = buf_size / 2;
+        bounded_stable_sort_fork_join(
+            exec,
+            [&, first, middle, buf, half]() {
+                parallel_bounded_stable_sort_helper(
+                    exec, first, middle, comp, buf, half, chunk_size);
+            },
+            [&]() {
+                parallel_bounded_stable_sort_helper(exec, middle, last, comp,
+                    buf + half, buf_size - half, chunk_size);
+            });
+
+        parallel_bounded_merge(
+            exec, first, middle, last, comp, buf, buf_size, chunk_size);
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stable sort of [first, last) using a buffer of at most
+    // max_buffer_elements elements (sqrt(N) if zero).
+    template <typename Iter, typename Compare>
+    Iter bounded_stable_sort(Iter first, Iter last, Compare&& comp,
+        std::size_t max_buffer_elements)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const count = last - first;
+        if (count < 2 || is_sorted_sequential(first, last, comp))
+        {
+            return last;
+        }
+
+        bounded_stable_sort_buffer<value_type> buf(
+            get_bounded_stable_sort_buffer_size(max_buffer_elements, count));
+        bounded_stable_sort_sequential(
+            first, last, comp, buf.data_, buf.size_);
+        return last;
+    }
+
+    template <typename Exec, typename Iter, typename Compare>
+    Iter parallel_bounded_stable_sort(Exec&& exec, Iter first, Iter last,
+        std::size_t cores, std::size_t chunk_size, Compare&& comp,
+        std::size_t max_buffer_elements)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        try
+        {
+            std::size_t const count = last - first;
+            if (cores < 2 || count <= chunk_size)
+            {
+                return bounded_stable_sort(
+                    first, last, comp, max_buffer_elements);
+            }
+
+            if (is_sorted_sequential(first, last, comp))
+            {
+                return last;
+            }
+
+            bounded_stable_sort_buffer<value_type> buf(
+                get_bounded_stable_sort_buffer_size(
+                    max_buffer_elements, count));
+            parallel_bounded_stable_sort_helper(
+                exec, first, last, comp, buf.data_, buf.size_, chunk_size);
+            return last;
+        }
+        catch (std::bad_alloc const&)
+        {
+            throw;
+        }
+        catch (pika::exception_list const&)
+        {
+            throw;
+        }
+        catch (...)
+        {
+            throw pika::exception_list(std::current_exception());
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,275 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/parallel/algorithms/detail/radix_sort.hpp>
+#include <pika/parallel/util/sort_key_range.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The keys sorted by the counting sort, enumerations are sorted by their
+    // underlying values.
+    template <typename Key, typename Enable = void>
+    struct counting_sort_key
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename Key>
+    struct counting_sort_key<Key,
+        std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool>>>
+    {
+        static constexpr bool is_valid = true;
+        using type = Key;
+    };
+
+    template <typename Key>
+    struct counting_sort_key<Key,
+        std::enable_if_t<std::is_enum_v<Key> &&
+            counting_sort_key<std::underlying_type_t<Key>>::is_valid>>
+    {
+        static constexpr bool is_valid = true;
+        using type = std::underlying_type_t<Key>;
+    };
+
+    // The counting sort is used if the executor parameters give the range
+    // of the keys. The elements are moved through a temporary buffer, which
+    // requires them to be default constructible.
+    template <typename Parameters, typename RandomIt, typename Comp,
+        typename Proj, typename Enable = void>
+    struct use_counting_sort : std::false_type
+    {
+    };
+
+    template <typename Parameters, typename RandomIt, typename Comp,
+        typename Proj>
+    struct use_counting_sort<Parameters, RandomIt, Comp, Proj,
+        std::enable_if_t<std::is_same_v<std::decay_t<Parameters>,
+                             pika::execution::sort_key_range> &&
+            counting_sort_key<radix_sort_key_t<RandomIt, Proj>>::is_valid>>
+      : std::bool_constant<radix_sort_order<std::decay_t<Comp>,
+                               radix_sort_key_t<RandomIt, Proj>>::is_valid &&
+            std::is_default_constructible_v<
+                typename std::iterator_traits<RandomIt>::value_type>>
+    {
+    };
+
+    template <typename Parameters, typename RandomIt, typename Comp,
+        typename Proj>
+    inline constexpr bool use_counting_sort_v =
+        use_counting_sort<Parameters, RandomIt, Comp, Proj>::value;
+
+    // the largest number of keys the counting sort is used for
+    static const std::size_t counting_sort_max_keys = 65536ul;
+
+    // the minimal number of elements handled by a chunk of the counting sort
+    static const std::size_t counting_sort_chunk_limit = 16384ul;
+
+    // Whether the value of the key range lhs is smaller than the key rhs
+    template <typename Key>
+    constexpr bool counting_sort_less(std::intmax_t lhs, Key rhs) noexcept
+    {
+        if constexpr (std::is_signed_v<Key>)
+        {
+            return lhs < std::intmax_t(rhs);
+        }
+        else
+        {
+            return lhs < 0 || std::uintmax_t(lhs) < std::uintmax_t(rhs);
+        }
+    }
+
+    // Whether the key lhs is smaller than the value of the key range rhs
+    template <typename Key>
+    constexpr bool counting_sort_less(Key lhs, std::intmax_t rhs) noexcept
+    {
+        if constexpr (std::is_signed_v<Key>)
+        {
+            return std::intmax_t(lhs) < rhs;
+        }
+        else
+        {
+            return rhs >= 0 && std::uintmax_t(lhs) < std::uintmax_t(rhs);
+        }
+    }
+
+    // Returns the number of keys of type Key the range holds and sets
+    // min_key to the encoding of the smallest of them. Returns zero if it
+    // holds none or more than counting_sort_max_keys of them.
+    template <typename Key>
+    std::size_t counting_sort_num_keys(
+        pika::execution::sort_key_range const& range,
+        typename radix_key<Key>::type& min_key) noexcept
+    {
+        using key_traits = radix_key<Key>;
+        using key_type = typename key_traits::type;
+
+        constexpr Key lowest = (std::numeric_limits<Key>::min)();
+        constexpr Key highest = (std::numeric_limits<Key>::max)();
+
+        std::intmax_t const lo = range.get_min_key();
+        std::intmax_t const hi = range.get_max_key();
+        if (hi < lo || counting_sort_less(hi, lowest) ||
+            counting_sort_less(highest, lo))
+        {
+            return 0;
+        }
+
+        min_key = key_traits::encode(
+            counting_sort_less(lo, lowest) ? lowest : Key(lo));
+        key_type const max_key = key_traits::encode(
+            counting_sort_less(highest, hi) ? highest : Key(hi));
+
+        key_type const diff = key_type(max_key - min_key);
+        if (diff >= counting_sort_max_keys)
+        {
+            return 0;
+        }
+        return std::size_t(diff) + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel stable counting sort of [first, first + count), whose keys
+    // lie in the given range. Every chunk of the sequence counts the keys
+    // of its elements, the exclusive prefix sum over all histograms
+    // (ordered by key, then by chunk) gives every chunk the positions to
+    // scatter its elements to. Returns false if the range is not suitable
+    // or any key lies outside of it, the sequence is unchanged then.
+    template <bool Descending, typename ExPolicy, typename RandomIt,
+        typename Proj>
+    bool counting_sort(ExPolicy& policy, RandomIt first, std::size_t count,
+        Proj& proj, pika::execution::sort_key_range const& range)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using key = typename counting_sort_key<
+            radix_sort_key_t<RandomIt, Proj>>::type;
+        using key_traits = radix_key<key>;
+        using key_type = typename key_traits::type;
+
+        key_type min_key = 0;
+        std::size_t const num_keys =
+            counting_sort_num_keys<key>(range, min_key);
+        if (num_keys == 0 || num_keys > count)
+        {
+            return false;
+        }
+
+        // the histograms of all chunks hold at most count entries
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)({cores, count / counting_sort_chunk_limit,
+                count / num_keys}));
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        // returns num_keys for keys outside of the range
+        auto bucket = [&](auto&& elem) -> std::size_t {
+            key_type const k = key_type(
+                key_traits::encode(key(PIKA_INVOKE(proj, elem))) - min_key);
+            if (std::size_t(k) >= num_keys)
+            {
+                return num_keys;
+            }
+            if constexpr (Descending)
+            {
+                return num_keys - 1 - std::size_t(k);
+            }
+            else
+            {
+                return std::size_t(k);
+            }
+        };
+
+        std::vector<std::size_t> histograms(num_chunks * num_keys, 0);
+        std::vector<char> in_range(num_chunks, 1);
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t chunk) {
+                std::size_t* h = histograms.data() + chunk * num_keys;
+                for (std::size_t i = chunk_begin(chunk),
+                                 end = chunk_begin(chunk + 1);
+                     i != end; ++i)
+                {
+                    std::size_t const b = bucket(*(first + i));
+                    if (b == num_keys)
+                    {
+                        in_range[chunk] = 0;
+                        return;
+                    }
+                    ++h[b];
+                }
+            },
+            pika::detail::irange(std::size_t(0), num_chunks));
+
+        if (std::find(in_range.begin(), in_range.end(), 0) != in_range.end())
+        {
+            return false;
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b != num_keys; ++b)
+        {
+            std::size_t const start = offset;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t& n = histograms[chunk * num_keys + b];
+                std::size_t const bucket_count = n;
+                n = offset;
+                offset += bucket_count;
+            }
+
+            // all keys are equal
+            if (offset - start == count)
+            {
+                return true;
+            }
+        }
+
+        std::vector<value_type> buffer(count);
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t chunk) {
+                std::size_t* h = histograms.data() + chunk * num_keys;
+                for (std::size_t i = chunk_begin(chunk),
+                                 end = chunk_begin(chunk + 1);
+                     i != end; ++i)
+                {
+                    auto&& elem = *(first + i);
+                    buffer[h[bucket(elem)]++] = PIKA_MOVE(elem);
+                }
+            },
+            pika::detail::irange(std::size_t(0), num_chunks));
+
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t chunk) {
+                std::move(buffer.begin() + chunk_begin(chunk),
+                    buffer.begin() + chunk_begin(chunk + 1),
+                    first + chunk_begin(chunk));
+            },
+            pika::detail::irange(std::size_t(0), num_chunks));
+        return true;
+    }
+}    // namespace pika::parallel::detail
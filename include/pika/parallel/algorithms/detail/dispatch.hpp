@@ -8,19 +8,31 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/static_extent.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/execution/executors/execution.hpp>
 #include <pika/executors/exception_list.hpp>
 #include <pika/executors/execution_policy.hpp>
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/executors/datapar/execution_policy.hpp>
+#endif
 #include <pika/futures/future.hpp>
 #include <pika/modules/errors.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_latency_hook.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bandwidth_bound_algorithm.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
+#include <pika/parallel/util/inline_threshold.hpp>
+#include <pika/parallel/util/nesting_aware.hpp>
+#include <pika/parallel/util/no_allocation.hpp>
 #include <pika/parallel/util/result_types.hpp>
 
 #if defined(PIKA_HAVE_CXX17_STD_EXECUTION_POLICIES)
 #include <execution>
 #endif
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -63,6 +75,75 @@ namespace pika::parallel::detail {
     template <typename T>
     using local_algorithm_result_t = typename local_algorithm_result<T>::type;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of elements an algorithm is invoked with as seen by
+    // inline_threshold, the size of the range given by the first two
+    // arguments if it is known in constant time. Algorithms whose first two
+    // arguments don't bound their work override algorithm::get_inline_count.
+    template <typename Iter, typename Sent, typename... Args>
+    constexpr std::size_t inline_count(
+        Iter const& first, Sent const& last, Args const&...)
+    {
+        if constexpr (is_sized_range_v<Iter, Sent>)
+        {
+            auto const count = detail::distance(first, last);
+            return count > 0 ? static_cast<std::size_t>(count) : 0;
+        }
+        else
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+    }
+
+    template <typename... Args>
+    constexpr std::size_t inline_count(Args const&...)
+    {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    // The number of elements of algorithms invoked with an iterator into
+    // their range between its bounds (e.g. rotate, nth_element)
+    template <typename Iter, typename Middle, typename Sent, typename... Args>
+    constexpr std::size_t inline_count_outer(Iter const& first,
+        Middle const&, Sent const& last, Args const&...)
+    {
+        return inline_count(first, last);
+    }
+
+    // The number of elements of algorithms invoked with two input ranges
+    // (e.g. merge, the set operations)
+    template <typename Iter1, typename Sent1, typename Iter2, typename Sent2,
+        typename... Args>
+    constexpr std::size_t inline_count_two_ranges(Iter1 const& first1,
+        Sent1 const& last1, Iter2 const& first2, Sent2 const& last2,
+        Args const&...)
+    {
+        std::size_t const count1 = inline_count(first1, last1);
+        std::size_t const count2 = inline_count(first2, last2);
+        if (count1 > (std::numeric_limits<std::size_t>::max)() - count2)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+        return count1 + count2;
+    }
+
+    // The policy the sequential implementation of an algorithm is run
+    // with if it is run inline.
+    template <typename ExPolicy>
+    constexpr auto inline_execution_policy() noexcept
+    {
+#if defined(PIKA_HAVE_DATAPAR)
+        if constexpr (pika::is_vectorpack_execution_policy<ExPolicy>::value)
+        {
+            return pika::execution::simd;
+        }
+        else
+#endif
+        {
+            return pika::execution::seq;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Derived, typename Result = void>
     struct algorithm
@@ -82,6 +163,15 @@ namespace pika::parallel::detail {
         {
         }
 
+        // The number of elements the algorithm is invoked with, see
+        // inline_threshold. The algorithms override it if the first two
+        // arguments don't bound the work, the maximum means unknown.
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count(args...);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // this equivalent to sequential execution
         template <typename ExPolicy, typename... Args>
@@ -157,20 +247,136 @@ namespace pika::parallel::detail {
             local_result_type>
         call2(ExPolicy&& policy, std::false_type, Args&&... args)
         {
+            // other tasks may run on this OS thread while the algorithm
+            // waits, restore the nesting depth of the calling task
+            util::detail::nesting_depth_scope const scope;
             return Derived::parallel(
                 PIKA_FORWARD(ExPolicy, policy), PIKA_FORWARD(Args, args)...);
         }
 
+        // runs the sequential implementation on the calling thread, see
+        // inline_threshold
+        template <typename ExPolicy, typename... Args>
+        static algorithm_result_t<ExPolicy, local_result_type> call_inline(
+            Args&&... args)
+        {
+            try
+            {
+                return algorithm_result<ExPolicy, local_result_type>::get(
+                    Derived::sequential(
+                        inline_execution_policy<std::decay_t<ExPolicy>>(),
+                        PIKA_FORWARD(Args, args)...));
+            }
+            catch (...)
+            {
+                // this does not return
+                return handle_exception<ExPolicy, local_result_type>::call();
+            }
+        }
+
         template <typename ExPolicy, typename... Args>
         PIKA_FORCEINLINE constexpr algorithm_result_t<ExPolicy,
             local_result_type>
         call(ExPolicy&& policy, Args&&... args) const
+        {
+            // the latency of the asynchronous calls is not known when they
+            // return, recording it may allocate memory
+            if constexpr (!pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>> &&
+                !std::is_same_v<typename std::decay_t<
+                                    ExPolicy>::executor_parameters_type,
+                    pika::execution::no_allocation>)
+            {
+                if (auto hook = util::detail::get_algorithm_latency_hook())
+                {
+                    util::detail::algorithm_latency_recorder recorder(
+                        hook, name_, Derived::get_inline_count(args...));
+                    return call_dispatch(PIKA_FORWARD(ExPolicy, policy),
+                        PIKA_FORWARD(Args, args)...);
+                }
+            }
+            return call_dispatch(
+                PIKA_FORWARD(ExPolicy, policy), PIKA_FORWARD(Args, args)...);
+        }
+
+        template <typename ExPolicy, typename... Args>
+        PIKA_FORCEINLINE constexpr algorithm_result_t<ExPolicy,
+            local_result_type>
+        call_dispatch(ExPolicy&& policy, Args&&... args) const
         {
             using is_seq = pika::is_sequenced_execution_policy<ExPolicy>;
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+            if constexpr (std::is_same_v<parameters_type,
+                              pika::execution::no_allocation>)
+            {
+                static_assert(is_allocation_free_algorithm_v<Derived>,
+                    "the algorithm needs temporary storage, it can't be "
+                    "invoked with the no_allocation executor parameters");
+                static_assert(!pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>,
+                    "the no_allocation executor parameters require a "
+                    "synchronous execution policy");
+                return call_inline<ExPolicy>(PIKA_FORWARD(Args, args)...);
+            }
+            else if constexpr (!is_seq::value &&
+                std::is_same_v<parameters_type,
+                    pika::execution::inline_threshold>)
+            {
+                if (Derived::get_inline_count(args...) <=
+                    policy.parameters().get_count())
+                {
+                    return call_inline<ExPolicy>(PIKA_FORWARD(Args, args)...);
+                }
+            }
+            else if constexpr (!is_seq::value &&
+                std::is_same_v<parameters_type,
+                    pika::execution::nesting_aware>)
+            {
+                if (policy.parameters().run_inline())
+                {
+                    return call_inline<ExPolicy>(PIKA_FORWARD(Args, args)...);
+                }
+            }
+            else if constexpr (!is_seq::value &&
+                std::is_same_v<parameters_type,
+                    pika::execution::bandwidth_limit> &&
+                !is_bandwidth_bound_algorithm_v<Derived>)
+            {
+                // only the algorithms bound by the memory bandwidth are
+                // capped, see bandwidth_limit
+                return call2(
+                    policy.with(pika::execution::parallel_policy::
+                            executor_parameters_type()),
+                    is_seq(), PIKA_FORWARD(Args, args)...);
+            }
             return call2(PIKA_FORWARD(ExPolicy, policy), is_seq(),
                 PIKA_FORWARD(Args, args)...);
         }
 
+        // The entry point of the algorithms invoked with a range of type
+        // Rng. Ranges of a small static extent (see
+        // pika::traits::static_extent) are processed inline for all
+        // policies, the number of elements is then known at compile time and
+        // the loops of the sequential implementation can be unrolled and
+        // vectorized. No tasks are launched and no runtime size check is
+        // made.
+        template <typename Rng, typename ExPolicy, typename... Args>
+        PIKA_FORCEINLINE constexpr algorithm_result_t<ExPolicy,
+            local_result_type>
+        call_range(ExPolicy&& policy, Args&&... args) const
+        {
+            if constexpr (pika::detail::has_small_static_extent_v<Rng>)
+            {
+                return call_inline<ExPolicy>(PIKA_FORWARD(Args, args)...);
+            }
+            else
+            {
+                return call(PIKA_FORWARD(ExPolicy, policy),
+                    PIKA_FORWARD(Args, args)...);
+            }
+        }
+
 #if defined(PIKA_HAVE_CXX17_STD_EXECUTION_POLICIES)
         // main dispatch entry points for std execution policies
         template <typename... Args>
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/iterator_support/traits/is_sentinel_for.hpp>
 
 #include <iterator>
@@ -41,4 +42,11 @@ namespace pika::parallel::detail {
             return offset;
         }
     }
+
+    // The ranges whose length is known without traversing them.
+    template <typename Iter, typename Sent>
+    inline constexpr bool is_sized_range_v =
+        pika::traits::is_random_access_iterator_v<Iter> &&
+        (std::is_same_v<Iter, Sent> ||
+            pika::traits::is_sized_sentinel_for_v<Sent, Iter>);
 }    // namespace pika::parallel::detail
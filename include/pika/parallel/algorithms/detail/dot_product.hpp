@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/vector_pack_complex.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The binary transform_reduce computes a dot product if it multiplies
+    // the elements of two contiguous sequences of floating point or complex
+    // values and sums the products.
+    template <typename Iter1, typename Iter2, typename T, typename Op1,
+        typename Op2>
+    inline constexpr bool is_dot_product_v =
+        (std::is_same_v<T, float> || std::is_same_v<T, double> ||
+            traits::detail::is_vector_pack_complex_v<T>) &&
+        pika::detail::is_contiguous_iterator_v<Iter1> &&
+        pika::detail::is_contiguous_iterator_v<Iter2> &&
+        std::is_same_v<typename std::iterator_traits<Iter1>::value_type, T> &&
+        std::is_same_v<typename std::iterator_traits<Iter2>::value_type, T> &&
+        (std::is_same_v<std::decay_t<Op1>, std::plus<>> ||
+            std::is_same_v<std::decay_t<Op1>, std::plus<T>> ||
+            std::is_same_v<std::decay_t<Op1>, plus>) &&
+        (std::is_same_v<std::decay_t<Op2>, std::multiplies<>> ||
+            std::is_same_v<std::decay_t<Op2>, std::multiplies<T>> ||
+            std::is_same_v<std::decay_t<Op2>, multiplies>);
+
+    // The number of independent accumulators of the dot product kernels,
+    // enough to hide the latency of the fused multiply-adds on current
+    // hardware.
+    inline constexpr std::size_t dot_product_num_accumulators = 8;
+
+    // Holds if std::fma is implemented by a hardware instruction for T, it
+    // is emulated in software otherwise.
+    template <typename T>
+    inline constexpr bool has_fast_fma_v =
+#if defined(FP_FAST_FMA)
+        std::is_same_v<T, double> ||
+#endif
+#if defined(FP_FAST_FMAF)
+        std::is_same_v<T, float> ||
+#endif
+        false;
+
+    // a * b + c, rounded once if the target supports it
+    template <typename T>
+    PIKA_FORCEINLINE T fused_multiply_add(T a, T b, T c) noexcept
+    {
+        if constexpr (has_fast_fma_v<T>)
+        {
+            return std::fma(a, b, c);
+        }
+        else
+        {
+            return a * b + c;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The chunk kernel of the dot product: return the sum of the products
+    // first1[i] * first2[i] for i in [0, count). The products are
+    // accumulated into independent partial sums which are added at the
+    // end. The datapar policies provide an overload using vector packs.
+    template <typename ExPolicy>
+    struct dot_product_n_t
+      : pika::functional::detail::tag_fallback<dot_product_n_t<ExPolicy>>
+    {
+    private:
+        template <typename T>
+        friend T tag_fallback_invoke(dot_product_n_t<ExPolicy>,
+            T const* first1, T const* first2, std::size_t count) noexcept
+        {
+            constexpr std::size_t n = dot_product_num_accumulators;
+
+            std::array<T, n> acc{};
+            std::size_t i = 0;
+            for (/**/; count - i >= n; i += n)
+            {
+                for (std::size_t j = 0; j != n; ++j)
+                {
+                    acc[j] = fused_multiply_add(
+                        first1[i + j], first2[i + j], acc[j]);
+                }
+            }
+
+            for (/**/; i != count; ++i)
+            {
+                acc[0] = fused_multiply_add(first1[i], first2[i], acc[0]);
+            }
+
+            for (std::size_t k = n / 2; k != 0; k /= 2)
+            {
+                for (std::size_t j = 0; j != k; ++j)
+                {
+                    acc[j] += acc[j + k];
+                }
+            }
+            return acc[0];
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr dot_product_n_t<ExPolicy> dot_product_n =
+        dot_product_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename T>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T dot_product_n(
+        T const* first1, T const* first2, std::size_t count)
+    {
+        return dot_product_n_t<ExPolicy>{}(first1, first2, count);
+    }
+#endif
+
+    // The sum of init and the products of the count elements starting at
+    // the contiguous iterators first1 and first2
+    template <typename ExPolicy, typename T, typename Iter1, typename Iter2>
+    T dot_product(Iter1 first1, Iter2 first2, std::size_t count, T init)
+    {
+        if (count == 0)
+        {
+            return init;
+        }
+        return init +
+            dot_product_n<ExPolicy>(pika::detail::to_address(first1),
+                pika::detail::to_address(first2), count);
+    }
+}    // namespace pika::parallel::detail
@@ -8,13 +8,115 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
 #include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Contiguous (or segmented, see pika::traits::contiguous_segments)
+    // sequences of trivially copyable values are filled by writing the bytes
+    // of the value, see byte_fill_n. The value has to be of the value type of
+    // the sequence or both have to be arithmetic types. Device code always
+    // assigns the elements.
+    template <typename Iter, typename T,
+        typename V = typename std::iterator_traits<Iter>::value_type>
+    inline constexpr bool is_byte_fill_v =
+#if defined(PIKA_COMPUTE_DEVICE_CODE)
+        false &&
+#endif
+        pika::detail::is_contiguous_or_segmented_v<Iter> &&
+        std::is_trivially_copyable_v<V> && std::is_copy_constructible_v<V> &&
+        !std::is_volatile_v<V> &&
+        (std::is_same_v<std::decay_t<T>, V> ||
+            (std::is_arithmetic_v<V> && std::is_arithmetic_v<std::decay_t<T>>));
+
+    // the size of the block of copies of a value written at once
+    inline constexpr std::size_t byte_fill_block_size = 256;
+
+    // Write count copies of value to dest:
+    //  - by memset if all bytes of the value are equal (e.g. zero),
+    //  - by copying a block of byte_fill_block_size bytes holding copies of
+    //    the value for small values, which the compiler turns into wide
+    //    stores,
+    //  - element by element otherwise.
+    template <typename T>
+    void byte_fill_n(T* dest, std::size_t count, T const& value)
+    {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, std::addressof(value), sizeof(T));
+        if (std::all_of(bytes + 1, bytes + sizeof(T),
+                [&](unsigned char b) { return b == bytes[0]; }))
+        {
+            std::memset(static_cast<void*>(dest), bytes[0], count * sizeof(T));
+            return;
+        }
+
+        if constexpr (sizeof(T) <= byte_fill_block_size / 4)
+        {
+            constexpr std::size_t block = byte_fill_block_size / sizeof(T);
+            unsigned char pattern[block * sizeof(T)];
+            for (std::size_t i = 0; i != block; ++i)
+            {
+                std::memcpy(pattern + i * sizeof(T), bytes, sizeof(T));
+            }
+
+            for (/**/; count >= block; count -= block, dest += block)
+            {
+                std::memcpy(static_cast<void*>(dest), pattern, sizeof(pattern));
+            }
+            std::memcpy(static_cast<void*>(dest), pattern, count * sizeof(T));
+        }
+        else
+        {
+            for (/**/; count != 0; --count, ++dest)
+            {
+                std::memcpy(static_cast<void*>(dest), bytes, sizeof(T));
+            }
+        }
+    }
+
+    // Fill the count elements starting at the contiguous (or segmented)
+    // iterator dest, return the iterator past the last element
+    template <typename Iter, typename T>
+    Iter byte_fill(Iter dest, std::size_t count, T const& value)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            return pika::detail::for_each_contiguous_segment(dest, count,
+                [&](auto* segment, std::size_t size) {
+                    return byte_fill(segment, size, value);
+                });
+        }
+        else
+        {
+            if (count != 0)
+            {
+                if constexpr (std::is_same_v<T, value_type>)
+                {
+                    byte_fill_n(std::addressof(*dest), count, value);
+                }
+                else
+                {
+                    byte_fill_n(std::addressof(*dest), count,
+                        static_cast<value_type>(value));
+                }
+            }
+            return std::next(dest, count);
+        }
+    }
+
     template <typename Iter, typename Sent, typename T>
     constexpr Iter sequential_fill_helper(Iter first, Sent last, T const& value)
     {
@@ -33,7 +135,19 @@ namespace pika::parallel::detail {
         friend constexpr Iter tag_fallback_invoke(sequential_fill_t, ExPolicy&&,
             Iter first, Sent last, T const& value)
         {
-            return sequential_fill_helper(first, last, value);
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(
+                    first, detail::distance(first, last), value);
+            }
+            else if constexpr (is_byte_fill_v<Iter, T>)
+            {
+                return byte_fill(first, detail::distance(first, last), value);
+            }
+            else
+            {
+                return sequential_fill_helper(first, last, value);
+            }
         }
     };
 
@@ -65,7 +179,18 @@ namespace pika::parallel::detail {
         friend constexpr Iter tag_fallback_invoke(sequential_fill_n_t,
             ExPolicy&&, Iter first, std::size_t count, T const& value)
         {
-            return sequential_fill_n_helper(first, count, value);
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(first, count, value);
+            }
+            else if constexpr (is_byte_fill_v<Iter, T>)
+            {
+                return byte_fill(first, count, value);
+            }
+            else
+            {
+                return sequential_fill_n_helper(first, count, value);
+            }
         }
     };
 
@@ -9,18 +9,65 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
+#include <pika/algorithms/traits/is_bitwise_comparable.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/detail/tag_fallback_invoke.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
 namespace pika::parallel::detail {
+    // Whether find can search the elements Iter refers to for a value of
+    // type T with std::memchr. Integral values are converted to the type of
+    // the elements.
+    template <typename Iter, typename T, typename Proj>
+    inline constexpr bool use_memchr_v =
+        pika::detail::iterator_is_byte_searchable_v<Iter> &&
+        std::is_same_v<std::decay_t<Proj>, projection_identity> &&
+        (std::is_same_v<std::remove_cv_t<T>,
+             std::remove_cv_t<pika::traits::iter_value_t<Iter>>> ||
+            (std::is_integral_v<pika::traits::iter_value_t<Iter>> &&
+                std::is_integral_v<T> && !std::is_same_v<T, bool>));
+
+    // The number of bytes searched by one call to std::memchr between two
+    // checks of the cancellation token
+    inline constexpr std::size_t find_memchr_block_size = 4096;
+
+    // Returns the offset of the first of the count elements at p equal to
+    // value, or count if there is none
+    template <typename Value, typename T>
+    std::size_t find_memchr(Value const* p, std::size_t count, T const& value)
+    {
+        if constexpr (!std::is_same_v<std::remove_cv_t<T>,
+                          std::remove_cv_t<Value>>)
+        {
+            // no element is equal to a value the elements can't represent
+            if (!(static_cast<Value>(value) == value))
+            {
+                return count;
+            }
+        }
+
+        void const* found = std::memchr(p,
+            static_cast<unsigned char>(static_cast<Value>(value)), count);
+        return found == nullptr ?
+            count :
+            static_cast<std::size_t>(
+                static_cast<unsigned char const*>(found) -
+                reinterpret_cast<unsigned char const*>(p));
+    }
+
     // provide implementation of std::find supporting iterators/sentinels
     template <typename ExPolicy>
     struct sequential_find_t
@@ -33,14 +80,41 @@ namespace pika::parallel::detail {
         tag_fallback_invoke(sequential_find_t<ExPolicy>, Iterator first,
             Sentinel last, T const& value, Proj proj = Proj())
         {
-            for (; first != last; ++first)
+            if constexpr (use_memchr_v<Iterator, T, Proj> &&
+                std::is_same_v<Iterator, Sentinel>)
             {
-                if (PIKA_INVOKE(proj, *first) == value)
+                std::size_t const count =
+                    static_cast<std::size_t>(std::distance(first, last));
+                if (count == 0)
                 {
                     return first;
                 }
+                return first +
+                    find_memchr(pika::detail::to_address(first), count, value);
+            }
+            else if constexpr (pika::traits::has_contiguous_segments_v<
+                                   Iterator> &&
+                std::is_same_v<Iterator, Sentinel>)
+            {
+                // search the blocks of segmented iterators one by one
+                return pika::detail::for_each_contiguous_segment(first,
+                    static_cast<std::size_t>(std::distance(first, last)),
+                    [&](auto* segment, std::size_t size) {
+                        return sequential_find_t<ExPolicy>{}(
+                            segment, segment + size, value, proj);
+                    });
+            }
+            else
+            {
+                for (; first != last; ++first)
+                {
+                    if (PIKA_INVOKE(proj, *first) == value)
+                    {
+                        return first;
+                    }
+                }
+                return first;
             }
-            return first;
         }
 
         template <typename FwdIter, typename Token, typename T, typename Proj>
@@ -49,13 +123,42 @@ namespace pika::parallel::detail {
             FwdIter part_begin, std::size_t part_count, Token& tok,
             T const& val, Proj&& proj)
         {
-            loop_idx_n<ExPolicy>(base_idx, part_begin, part_count, tok,
-                [&val, &proj, &tok](auto& v, std::size_t i) -> void {
-                    if (PIKA_INVOKE(proj, v) == val)
+            if constexpr (use_memchr_v<FwdIter, T, Proj>)
+            {
+                if (part_count == 0)
+                {
+                    return;
+                }
+
+                auto const* p = pika::detail::to_address(part_begin);
+                for (std::size_t i = 0; i < part_count;
+                     i += find_memchr_block_size)
+                {
+                    if (tok.was_cancelled(base_idx + i))
                     {
-                        tok.cancel(i);
+                        return;
                     }
-                });
+
+                    std::size_t const len =
+                        (std::min)(find_memchr_block_size, part_count - i);
+                    std::size_t const pos = find_memchr(p + i, len, val);
+                    if (pos != len)
+                    {
+                        tok.cancel(base_idx + i + pos);
+                        return;
+                    }
+                }
+            }
+            else
+            {
+                loop_idx_n<ExPolicy>(base_idx, part_begin, part_count, tok,
+                    [&val, &proj, &tok](auto& v, std::size_t i) -> void {
+                        if (PIKA_INVOKE(proj, v) == val)
+                        {
+                            tok.cancel(i);
+                        }
+                    });
+            }
         }
     };
 
@@ -253,4 +356,57 @@ namespace pika::parallel::detail {
             part_count, tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
     }
 #endif
+
+    // The chunk kernel of find_first_of: return the offset of the first of
+    // the count elements which f relates to any of the elements in
+    // [s_first, s_last), or count if there is none. The datapar policies
+    // provide vectorized overloads for arithmetic types.
+    template <typename ExPolicy>
+    struct sequential_find_first_of_t
+      : pika::functional::detail::tag_fallback<
+            sequential_find_first_of_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename F, typename Proj1,
+            typename Proj2>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_find_first_of_t<ExPolicy>, Iter1 first,
+            std::size_t count, Iter2 s_first, Iter2 s_last, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            for (std::size_t i = 0; i != count; (void) ++i, ++first)
+            {
+                for (Iter2 it = s_first; it != s_last; ++it)
+                {
+                    if (PIKA_INVOKE(f, PIKA_INVOKE(proj1, *first),
+                            PIKA_INVOKE(proj2, *it)))
+                    {
+                        return i;
+                    }
+                }
+            }
+            return count;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_find_first_of_t<ExPolicy>
+        sequential_find_first_of = sequential_find_first_of_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t sequential_find_first_of(
+        Iter1 first, std::size_t count, Iter2 s_first, Iter2 s_last, F&& f,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_find_first_of_t<ExPolicy>{}(first, count, s_first,
+            s_last, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+            PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    // The number of elements a partition of find_first_of examines between
+    // two checks of the cancellation token.
+    inline constexpr std::size_t find_first_of_block_size = 512;
 }    // namespace pika::parallel::detail
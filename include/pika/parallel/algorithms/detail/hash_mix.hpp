@@ -0,0 +1,31 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <cstdint>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Spreads the bits of a hash value over all of its bits. Hash functions
+    // like std::hash of integers may be the identity, the algorithms using
+    // hash tables select the partition of a key by the high bits of the
+    // mixed value and its slot by the low bits.
+    constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -7,12 +7,19 @@
 
 #pragma once
 
+#include <pika/config.hpp>
 #include <pika/assert.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/indirect_sort_selection.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -105,4 +112,212 @@ namespace pika::parallel::detail {
             ++pos_in_vector;
         }
     }
+
+    // the minimal number of elements moved by a chunk of
+    // parallel_sort_index
+    static const std::size_t sort_index_chunk_limit = 4096ul;
+
+    /// \brief sort the elements according of the sort of the index, the
+    ///        cycles of the permutation are moved in parallel
+    /// \param [in] policy : execution policy to use
+    /// \param [in] first : iterator to the first element of the data
+    /// \param [in] v_iter : vector sorted of the iterators
+    /// \remarks the cycles are laid out one after the other, each chunk of
+    ///          them is moved by a separate task. The elements a chunk reads
+    ///          from the chunk to its right (the first element of that chunk
+    ///          and the first element of a cycle ending in the chunk) are
+    ///          moved aside before any of the tasks start.
+    template <typename ExPolicy, typename Iter>
+    void parallel_sort_index(
+        ExPolicy& policy, Iter first, std::vector<Iter> const& v_iter)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const nelem = v_iter.size();
+        std::size_t max_chunks = 1;
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            max_chunks = 4 *
+                parallel::execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+        }
+
+        // order holds the positions of the elements of all cycles, cycles
+        // the position of the first element of every cycle in order
+        std::vector<std::size_t> order;
+        std::vector<std::size_t> cycles;
+        order.reserve(nelem);
+        {
+            std::vector<bool> visited(nelem, false);
+            for (std::size_t pos = 0; pos != nelem; ++pos)
+            {
+                if (visited[pos] ||
+                    std::size_t(detail::distance(first, v_iter[pos])) == pos)
+                {
+                    continue;
+                }
+
+                cycles.push_back(order.size());
+                std::size_t k = pos;
+                do
+                {
+                    visited[k] = true;
+                    order.push_back(k);
+                    k = std::size_t(detail::distance(first, v_iter[k]));
+                } while (k != pos);
+            }
+        }
+
+        std::size_t const count = order.size();
+        if (count == 0)
+        {
+            return;
+        }
+        cycles.push_back(count);
+
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(max_chunks,
+                (count + sort_index_chunk_limit - 1) / sort_index_chunk_limit));
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+        auto element = [&](std::size_t k) -> decltype(auto) {
+            return *std::next(first, order[k]);
+        };
+        auto cycle_of = [&](std::size_t k) -> std::size_t {
+            return std::upper_bound(cycles.begin(), cycles.end(), k) -
+                cycles.begin() - 1;
+        };
+
+        // head[chunk] is the first element of the chunk if its cycle started
+        // in a chunk to its left, wrap[chunk] the first element of a cycle
+        // which started in a chunk to its left and ends in the chunk
+        std::vector<std::optional<value_type>> head(num_chunks + 1);
+        std::vector<std::optional<value_type>> wrap(num_chunks);
+        for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+        {
+            std::size_t const begin = chunk_begin(chunk);
+            std::size_t const cycle = cycle_of(begin);
+            if (cycles[cycle] < begin)
+            {
+                head[chunk].emplace(PIKA_MOVE(element(begin)));
+                if (cycles[cycle + 1] <= chunk_begin(chunk + 1))
+                {
+                    wrap[chunk].emplace(PIKA_MOVE(element(cycles[cycle])));
+                }
+            }
+        }
+
+        // every element is replaced by the next one of its cycle, the last
+        // one by the first one
+        auto move_chunk = [&](std::size_t chunk) {
+            std::size_t const begin = chunk_begin(chunk);
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t k = begin, cycle = cycle_of(begin); k != end;
+                 ++k, ++cycle)
+            {
+                std::size_t const cycle_begin = cycles[cycle];
+                std::size_t const cycle_end = cycles[cycle + 1];
+                bool const local = cycle_begin >= begin && cycle_end <= end;
+
+                std::optional<value_type> tmp;
+                if (local)
+                {
+                    tmp.emplace(PIKA_MOVE(element(k)));
+                }
+
+                std::size_t const last = (std::min)(cycle_end, end) - 1;
+                for (/**/; k != last; ++k)
+                {
+                    element(k) = PIKA_MOVE(element(k + 1));
+                }
+
+                if (cycle_end > end)
+                {
+                    element(k) = PIKA_MOVE(*head[chunk + 1]);
+                }
+                else
+                {
+                    element(k) = PIKA_MOVE(local ? *tmp : *wrap[chunk]);
+                }
+            }
+        };
+        parallel::detail::run_chunks(policy, num_chunks, move_chunk);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements of sequences at least this long which are at least
+    // indirect_sort_min_value_size bytes large are sorted indirectly unless
+    // requested otherwise, see indirect_sort_selection
+    static const std::size_t indirect_sort_limit = 4096ul;
+    static const std::size_t indirect_sort_min_value_size = 128ul;
+
+    // An element is moved aside for the duration of its cycle, an exception
+    // would leave the sequence without it.
+    template <typename Iter>
+    inline constexpr bool use_indirect_sort_v =
+        std::is_nothrow_move_constructible_v<
+            typename std::iterator_traits<Iter>::value_type> &&
+        std::is_nothrow_move_assignable_v<
+            typename std::iterator_traits<Iter>::value_type>;
+
+    template <typename T, typename Parameters>
+    constexpr bool select_indirect_sort(
+        Parameters const& params, std::size_t count) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::indirect_sort_selection>)
+        {
+            switch (params.get_indirect_sort_mode())
+            {
+            case pika::execution::indirect_sort_mode::always:
+                return true;
+            case pika::execution::indirect_sort_mode::never:
+                return false;
+            default:
+                break;
+            }
+        }
+        return sizeof(T) >= indirect_sort_min_value_size &&
+            count >= indirect_sort_limit;
+    }
+
+    /// \brief move the elements to the places given by the sorted index,
+    ///        in parallel unless the policy is sequenced
+    /// \param [in] policy : execution policy used to move the elements
+    /// \param [in] first : iterator to the first element of the data
+    /// \param [in] v_iter : vector sorted of the iterators
+    template <typename ExPolicy, typename Iter>
+    void apply_sort_index(
+        ExPolicy& policy, Iter first, std::vector<Iter>& v_iter)
+    {
+        if constexpr (pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            sort_index(first, v_iter);
+        }
+        else
+        {
+            parallel_sort_index(policy, first, v_iter);
+        }
+    }
+
+    /// \brief sort the elements through an index of iterators to them
+    /// \param [in] policy : execution policy used to move the elements
+    /// \param [in] first : iterator to the first element of the range
+    /// \param [in] last : iterator to the element after the last of the range
+    /// \param [in] comp : comparison object of the elements
+    /// \param [in] sort : sort(first, last, comp) sorts the index
+    template <typename ExPolicy, typename Iter, typename Comp, typename Sort>
+    void indirect_sort(
+        ExPolicy& policy, Iter first, Iter last, Comp comp, Sort&& sort)
+    {
+        std::vector<Iter> v_iter;
+        create_index(first, last, v_iter);
+        sort(v_iter.begin(), v_iter.end(),
+            less_ptr_no_null<Iter, Iter, Comp>(PIKA_MOVE(comp)));
+        apply_sort_index(policy, first, v_iter);
+    }
 }    // namespace pika::parallel::detail
@@ -8,8 +8,10 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_find.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 
@@ -57,4 +59,16 @@ namespace pika::parallel::detail {
             return first;
         }
     }
+
+    // is_sorted_sequential on the count elements starting at a random access
+    // iterator, which the datapar policies vectorize
+    template <typename ExPolicy, typename RandIter, typename Compare>
+    bool is_sorted_sequential_n(
+        RandIter first, std::size_t count, Compare&& comp)
+    {
+        return count < 2 ||
+            sequential_adjacent_find_n<ExPolicy>(first, count - 1,
+                reversed_comparison<Compare&>{comp},
+                projection_identity{}) == count - 1;
+    }
 }    // namespace pika::parallel::detail
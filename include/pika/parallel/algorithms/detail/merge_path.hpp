@@ -0,0 +1,47 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the number of elements of [first1, first1 + size1) among the
+    // first k elements of the merged sequence (the co-rank of k). Equivalent
+    // elements are taken from the first sequence first, which keeps the
+    // merge stable.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    std::size_t merge_path_split(Iter1 first1, std::size_t size1,
+        Iter2 first2, std::size_t size2, std::size_t k, Comp& comp,
+        Proj1& proj1, Proj2& proj2)
+    {
+        std::size_t low = k > size2 ? k - size2 : 0;
+        std::size_t high = (std::min)(k, size1);
+        while (low < high)
+        {
+            std::size_t const mid = low + (high - low) / 2;
+            if (PIKA_INVOKE(comp, PIKA_INVOKE(proj2, first2[k - mid - 1]),
+                    PIKA_INVOKE(proj1, first1[mid])))
+            {
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The chunk kernels of min_element, max_element and minmax_element: find
+    // the smallest (the first one of several) and the largest (the last one
+    // of several) of count elements. The datapar policies provide vectorized
+    // overloads for arithmetic types.
+    template <typename ExPolicy>
+    struct sequential_min_element_t
+      : pika::functional::detail::tag_fallback<
+            sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            auto smallest = it;
+
+            element_type value = PIKA_INVOKE(proj, *smallest);
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = PIKA_INVOKE(proj, *it);
+                if (PIKA_INVOKE(f, curr_value, value))
+                {
+                    smallest = it;
+                    value = PIKA_MOVE(curr_value);
+                }
+            }
+
+            return smallest;
+        }
+    };
+
+    template <typename ExPolicy>
+    struct sequential_max_element_t
+      : pika::functional::detail::tag_fallback<
+            sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            auto largest = it;
+
+            element_type value = PIKA_INVOKE(proj, *largest);
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = PIKA_INVOKE(proj, *it);
+                if (!PIKA_INVOKE(f, curr_value, value))
+                {
+                    largest = it;
+                    value = PIKA_MOVE(curr_value);
+                }
+            }
+
+            return largest;
+        }
+    };
+
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t
+      : pika::functional::detail::tag_fallback<
+            sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend constexpr min_max_result<FwdIter> tag_fallback_invoke(
+            sequential_minmax_element_t<ExPolicy>, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            min_max_result<FwdIter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            using element_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            element_type min_value = PIKA_INVOKE(proj, *it);
+            element_type max_value = min_value;
+            for (++it; --count != 0; ++it)
+            {
+                element_type curr_value = PIKA_INVOKE(proj, *it);
+                if (PIKA_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = it;
+                    min_value = curr_value;
+                }
+
+                if (!PIKA_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = it;
+                    max_value = PIKA_MOVE(curr_value);
+                }
+            }
+
+            return result;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_min_element_t<ExPolicy>
+        sequential_min_element = sequential_min_element_t<ExPolicy>{};
+
+    template <typename ExPolicy>
+    inline constexpr sequential_max_element_t<ExPolicy>
+        sequential_max_element = sequential_max_element_t<ExPolicy>{};
+
+    template <typename ExPolicy>
+    inline constexpr sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE FwdIter sequential_min_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_min_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE FwdIter sequential_max_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_max_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE min_max_result<FwdIter>
+    sequential_minmax_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+}    // namespace pika::parallel::detail
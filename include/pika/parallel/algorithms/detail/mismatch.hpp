@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_bitwise_comparable.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Holds if neither of the two elements is ordered before the other, this
+    // is where lexicographical_compare stops.
+    template <typename Pred>
+    struct equivalent_to
+    {
+        Pred pred;
+
+        template <typename T1, typename T2>
+        constexpr bool operator()(T1&& t1, T2&& t2)
+        {
+            return !PIKA_INVOKE(pred, t1, t2) && !PIKA_INVOKE(pred, t2, t1);
+        }
+    };
+
+    // Whether F holds for two elements of type T exactly if their object
+    // representations are equal: the equality predicates, and the
+    // equivalence given by the ordering predicates.
+    template <typename F, typename T>
+    struct is_bitwise_equality : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_bitwise_equality<equal_to, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_bitwise_equality<std::equal_to<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_bitwise_equality<std::equal_to<T>, T> : std::true_type
+    {
+    };
+
+    template <typename Pred, typename T>
+    struct is_bitwise_equality<equivalent_to<Pred>, T>
+      : std::bool_constant<std::is_same_v<Pred, less> ||
+            std::is_same_v<Pred, greater> ||
+            std::is_same_v<Pred, std::less<>> ||
+            std::is_same_v<Pred, std::less<T>> ||
+            std::is_same_v<Pred, std::greater<>> ||
+            std::is_same_v<Pred, std::greater<T>>>
+    {
+    };
+
+    // Whether mismatch can compare the elements with std::memcmp
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    inline constexpr bool use_memcmp_v =
+        pika::detail::iterators_are_bitwise_comparable_v<Iter1, Iter2> &&
+        std::is_same_v<std::decay_t<Proj1>, projection_identity> &&
+        std::is_same_v<std::decay_t<Proj2>, projection_identity> &&
+        is_bitwise_equality<std::decay_t<F>,
+            std::remove_cv_t<pika::traits::iter_value_t<Iter1>>>::value;
+
+    // The number of bytes compared by one call to std::memcmp
+    inline constexpr std::size_t mismatch_memcmp_block_size = 4096;
+
+    // The chunk kernel of mismatch, equal and lexicographical_compare:
+    // return the offset of the first of the count positions at which f does
+    // not hold for the projected elements, or count if there is none. The
+    // datapar policies provide vectorized overloads for arithmetic types,
+    // contiguous ranges of bitwise comparable types are compared with
+    // std::memcmp otherwise.
+    template <typename ExPolicy>
+    struct sequential_mismatch_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_mismatch_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename F, typename Proj1,
+            typename Proj2>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_mismatch_n_t<ExPolicy>, Iter1 first1, Iter2 first2,
+            std::size_t count, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            if constexpr (use_memcmp_v<Iter1, Iter2, F, Proj1, Proj2>)
+            {
+                // only a block holding a mismatch is compared element by
+                // element
+                if (count == 0)
+                {
+                    return 0;
+                }
+
+                auto const* p1 = pika::detail::to_address(first1);
+                auto const* p2 = pika::detail::to_address(first2);
+                std::size_t const block = (std::max)(std::size_t(1),
+                    mismatch_memcmp_block_size / sizeof(*p1));
+                for (std::size_t i = 0; i < count; i += block)
+                {
+                    std::size_t const len = (std::min)(block, count - i);
+                    if (std::memcmp(p1 + i, p2 + i, len * sizeof(*p1)) != 0)
+                    {
+                        while (p1[i] == p2[i])
+                        {
+                            ++i;
+                        }
+                        return i;
+                    }
+                }
+                return count;
+            }
+            else
+            {
+                for (std::size_t i = 0; i != count;
+                     (void) ++i, ++first1, ++first2)
+                {
+                    if (!PIKA_INVOKE(f, PIKA_INVOKE(proj1, *first1),
+                            PIKA_INVOKE(proj2, *first2)))
+                    {
+                        return i;
+                    }
+                }
+                return count;
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_mismatch_n_t<ExPolicy> sequential_mismatch_n =
+        sequential_mismatch_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t sequential_mismatch_n(
+        Iter1 first1, Iter2 first2, std::size_t count, F&& f, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        return sequential_mismatch_n_t<ExPolicy>{}(first1, first2, count,
+            PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+            PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    // The number of elements a partition compares between two checks of the
+    // cancellation token.
+    inline constexpr std::size_t mismatch_block_size = 512;
+
+    // Return the offset of the first mismatch in a partition, or count if
+    // there is none or stop(offset) returned true for an offset at which the
+    // remaining elements need not be compared anymore.
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename Stop,
+        typename F, typename Proj1, typename Proj2>
+    std::size_t mismatch_partition(Iter1 first1, Iter2 first2,
+        std::size_t count, Stop&& stop, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        for (std::size_t offset = 0; offset != count; /**/)
+        {
+            if (stop(offset))
+            {
+                break;
+            }
+
+            std::size_t const len =
+                (std::min)(mismatch_block_size, count - offset);
+            std::size_t const mismatched = sequential_mismatch_n<ExPolicy>(
+                first1, first2, len, f, proj1, proj2);
+            if (mismatched != len)
+            {
+                return offset + mismatched;
+            }
+
+            std::advance(first1, len);
+            std::advance(first2, len);
+            offset += len;
+        }
+        return count;
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,392 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/synchronization/stop_token.hpp>
+
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/parallel/util/detail/fork_join.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/low_level.hpp>
+#include <pika/parallel/util/range.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Nearly sorted sequences consist of few natural runs, maximal ascending
+    // or strictly descending sections. Those are detected in parallel, the
+    // descending ones are reversed (which keeps the sort stable) and the runs
+    // are merged following the merge tree of powersort (Munro and Wild),
+    // which is nearly optimal for runs of any lengths. The sort takes
+    // O(N log R) for R runs.
+
+    // sequences shorter than this are not checked for natural runs
+    static const std::size_t natural_merge_sort_limit = 4096ul;
+
+    // the runs are merged only if they are this long on average
+    static const std::size_t natural_merge_sort_min_run = 32ul;
+
+    // the minimal number of elements handled by a chunk of the loops
+    // detecting and reversing the runs
+    static const std::size_t natural_merge_sort_chunk_limit = 16384ul;
+
+    struct natural_run
+    {
+        std::size_t begin;
+        std::size_t end;
+        bool descending;
+    };
+
+    // Appends the runs of [begin, end) to runs, returns false if there are
+    // more than max_runs of them.
+    template <typename Iter, typename Compare>
+    bool find_natural_runs(Iter first, std::size_t begin, std::size_t end,
+        Compare& comp, std::size_t max_runs, std::vector<natural_run>& runs)
+    {
+        for (std::size_t i = begin; i != end; /**/)
+        {
+            if (runs.size() == max_runs)
+            {
+                return false;
+            }
+
+            std::size_t j = i + 1;
+            bool const descending =
+                j != end && comp(*(first + j), *(first + (j - 1)));
+            if (descending)
+            {
+                while (j != end && comp(*(first + j), *(first + (j - 1))))
+                {
+                    ++j;
+                }
+            }
+            else
+            {
+                while (j != end && !comp(*(first + j), *(first + (j - 1))))
+                {
+                    ++j;
+                }
+            }
+
+            runs.push_back(natural_run{i, j, descending});
+            i = j;
+        }
+        return true;
+    }
+
+    // Appends run to runs, joining it with the last of them if that one
+    // continues in its direction.
+    template <typename Iter, typename Compare>
+    void append_natural_run(Iter first, natural_run const& run, Compare& comp,
+        std::vector<natural_run>& runs)
+    {
+        if (!runs.empty())
+        {
+            natural_run& last = runs.back();
+            bool const single = last.end - last.begin == 1;
+            bool const run_single = run.end - run.begin == 1;
+            bool const less =
+                comp(*(first + run.begin), *(first + (last.end - 1)));
+
+            if (!less && (single || !last.descending) &&
+                (run_single || !run.descending))
+            {
+                last.end = run.end;
+                last.descending = false;
+                return;
+            }
+            if (less && (single || last.descending) &&
+                (run_single || run.descending))
+            {
+                last.end = run.end;
+                last.descending = true;
+                return;
+            }
+        }
+        runs.push_back(run);
+    }
+
+    // The power of the boundary between the runs [begin1, begin2) and
+    // [begin2, end2) of a sequence of size elements: the first bit in which
+    // the relative positions of their midpoints differ.
+    inline unsigned natural_merge_power(std::size_t size, std::size_t begin1,
+        std::size_t begin2, std::size_t end2) noexcept
+    {
+        // twice the midpoints, relative to twice the size
+        std::size_t const two_size = 2 * size;
+        std::size_t lhs = begin1 + begin2;
+        std::size_t rhs = begin2 + end2;
+
+        unsigned power = 0;
+        while (true)
+        {
+            ++power;
+            lhs <<= 1;
+            rhs <<= 1;
+            if (lhs >= two_size)
+            {
+                lhs -= two_size;
+                rhs -= two_size;
+            }
+            else if (rhs >= two_size)
+            {
+                return power;
+            }
+        }
+    }
+
+    // Merges the sorted runs [first, middle) and [middle, last), the smaller
+    // one is moved to buf, which must hold as many constructed elements.
+    template <typename Iter, typename Value, typename Compare>
+    void natural_merge(
+        Iter first, Iter middle, Iter last, Value* buf, Compare& comp)
+    {
+        if (first == middle || middle == last ||
+            !comp(*middle, *std::prev(middle)))
+        {
+            return;
+        }
+
+        // the elements already in their place
+        first = std::upper_bound(first, middle, *middle, comp);
+        last = std::lower_bound(middle, last, *std::prev(middle), comp);
+
+        if (middle - first <= last - middle)
+        {
+            Value* const buf_last = init_move(buf, first, middle);
+            half_merge(buf, buf_last, middle, last, first, comp);
+            return;
+        }
+
+        // the right run is merged from the back
+        Value* buf_last = init_move(buf, middle, last);
+        while (middle != first && buf_last != buf)
+        {
+            if (comp(*std::prev(buf_last), *std::prev(middle)))
+            {
+                *--last = PIKA_MOVE(*--middle);
+            }
+            else
+            {
+                *--last = PIKA_MOVE(*--buf_last);
+            }
+        }
+        std::move_backward(buf, buf_last, last);
+    }
+
+    // Merges the runs [lo, hi), the boundary of the smallest power is merged
+    // last. The merge of the runs [bounds[i], bounds[j]) uses the elements
+    // [(bounds[i] + 1) / 2, (bounds[j] + 1) / 2) of the buffer, the merges
+    // running concurrently use disjoint parts of it.
+    template <typename ExPolicy, typename Iter, typename Value,
+        typename Compare>
+    void natural_merge_runs(ExPolicy& policy, Iter first, Value* buf,
+        std::vector<std::size_t> const& bounds,
+        std::vector<unsigned> const& powers, std::size_t lo, std::size_t hi,
+        Compare& comp, pika::stop_token const& stop, std::size_t chunk_size)
+    {
+        if (hi - lo < 2)
+        {
+            return;
+        }
+
+        std::size_t const split =
+            std::min_element(powers.begin() + lo + 1, powers.begin() + hi) -
+            powers.begin();
+
+        auto merge_left = [&]() {
+            natural_merge_runs(
+                policy, first, buf, bounds, powers, lo, split, comp, stop,
+                chunk_size);
+        };
+        auto merge_right = [&]() {
+            natural_merge_runs(
+                policy, first, buf, bounds, powers, split, hi, comp, stop,
+                chunk_size);
+        };
+
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            if (bounds[hi] - bounds[lo] > chunk_size)
+            {
+                util::detail::throw_if_sort_stop_requested(stop);
+                fork_join(policy, merge_left, merge_right);
+            }
+            else
+            {
+                merge_left();
+                merge_right();
+            }
+        }
+        else
+        {
+            merge_left();
+            merge_right();
+        }
+
+        natural_merge(first + bounds[lo], first + bounds[split],
+            first + bounds[hi], buf + (bounds[lo] + 1) / 2, comp);
+    }
+
+    /// \brief sort the elements by merging their natural runs, provided
+    ///        there are few of them
+    /// \param [in] policy : execution policy used, the runs are detected and
+    ///                      merged sequentially if it is sequenced
+    /// \param [in] first : iterator to the first element of the range
+    /// \param [in] last : iterator to the element after the last of the range
+    /// \param [in] comp : comparison object of the elements
+    /// \param [in] arena : arena the temporary buffer is taken from, if any
+    /// \param [in] stop : stop token cancelling the parallel sort
+    /// \param [in] chunk_size : merges of at most this many elements are run
+    ///                          by a single task
+    /// \return false if the runs are too short, the sequence is unchanged
+    ///         then
+    template <typename ExPolicy, typename Iter, typename Compare>
+    bool natural_merge_sort(ExPolicy& policy, Iter first, Iter last,
+        Compare& comp, util::temporary_buffer_arena* arena = nullptr,
+        pika::stop_token const& stop = pika::stop_token(),
+        std::size_t chunk_size = natural_merge_sort_chunk_limit)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < natural_merge_sort_limit)
+        {
+            return false;
+        }
+
+        std::size_t num_chunks = 1;
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            std::size_t const cores =
+                parallel::execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+            num_chunks = (std::max)(std::size_t(1),
+                (std::min)(cores, count / natural_merge_sort_chunk_limit));
+        }
+
+        // the runs of every chunk, the search stops at the first chunk
+        // having too many of them
+        std::vector<std::vector<natural_run>> chunk_runs(num_chunks);
+        std::vector<char> found(num_chunks, 0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const begin = chunk * count / num_chunks;
+            std::size_t const end = (chunk + 1) * count / num_chunks;
+            found[chunk] = find_natural_runs(first, begin, end, comp,
+                (end - begin) / natural_merge_sort_min_run + 1,
+                chunk_runs[chunk]);
+        });
+        if (std::find(found.begin(), found.end(), 0) != found.end())
+        {
+            return false;
+        }
+
+        std::vector<natural_run> runs;
+        for (auto const& r : chunk_runs)
+        {
+            for (natural_run const& run : r)
+            {
+                append_natural_run(first, run, comp, runs);
+            }
+        }
+        std::vector<std::vector<natural_run>>().swap(chunk_runs);
+
+        if (runs.size() > count / natural_merge_sort_min_run)
+        {
+            return false;
+        }
+
+        // descending runs are strictly descending, reversing them keeps the
+        // order of equal elements
+        for (natural_run const& run : runs)
+        {
+            if (!run.descending)
+            {
+                continue;
+            }
+
+            std::size_t const half = (run.end - run.begin) / 2;
+            std::size_t const reverse_chunks = (std::max)(std::size_t(1),
+                (std::min)(num_chunks, half / natural_merge_sort_chunk_limit));
+            run_chunks(policy, reverse_chunks, [&](std::size_t chunk) {
+                Iter front = first + run.begin;
+                Iter back = first + run.end;
+                for (std::size_t i = chunk * half / reverse_chunks;
+                     i != (chunk + 1) * half / reverse_chunks; ++i)
+                {
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                    std::ranges::iter_swap(front + i, back - (i + 1));
+#else
+                    std::iter_swap(front + i, back - (i + 1));
+#endif
+                }
+            });
+        }
+
+        if (runs.size() == 1)
+        {
+            return true;
+        }
+
+        std::vector<std::size_t> bounds(runs.size() + 1);
+        std::vector<unsigned> powers(runs.size(), 0);
+        for (std::size_t i = 0; i != runs.size(); ++i)
+        {
+            bounds[i] = runs[i].begin;
+            if (i != 0)
+            {
+                powers[i] = natural_merge_power(
+                    count, runs[i - 1].begin, runs[i].begin, runs[i].end);
+            }
+        }
+        bounds[runs.size()] = count;
+
+        // the buffer holds constructed elements, see spin_sort
+        struct buffer_holder
+        {
+            ~buffer_holder()
+            {
+                if (constructed)
+                {
+                    destroy(data, data + size);
+                }
+                util::detail::deallocate_temporary_buffer(data, arena);
+            }
+
+            value_type* data;
+            std::size_t size;
+            util::temporary_buffer_arena* arena;
+            bool constructed;
+        } buffer{static_cast<value_type*>(
+                     util::detail::allocate_temporary_buffer(
+                         sizeof(value_type) * (count / 2), arena)),
+            count / 2, arena, false};
+
+        init(buffer.data, buffer.data + buffer.size, *first);
+        buffer.constructed = true;
+
+        natural_merge_runs(policy, first, buffer.data, bounds, powers, 0,
+            runs.size(), comp, stop, chunk_size);
+        return true;
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,478 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/packed_bits.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/parallel/util/cancellation_token.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the elements an iterator refers to are processed a word at a
+    // time, see pika::traits::packed_bits. Projections other than the
+    // identity see the elements one by one.
+    template <typename Iter, typename Proj = projection_identity>
+    inline constexpr bool use_packed_bits_v =
+        pika::traits::has_packed_bits_v<Iter> &&
+        std::is_same_v<std::decay_t<Proj>, projection_identity>;
+
+    // Whether the bits are copied a word at a time, which requires both
+    // sequences to be stored in words of the same type
+    template <typename Iter>
+    using packed_bits_word_t =
+        typename pika::traits::packed_bits<Iter>::word_type;
+
+    template <typename InIter, typename OutIter, typename Enable = void>
+    inline constexpr bool use_packed_bits_copy_v = false;
+
+    template <typename InIter, typename OutIter>
+    inline constexpr bool use_packed_bits_copy_v<InIter, OutIter,
+        std::enable_if_t<pika::traits::has_packed_bits_v<InIter> &&
+            pika::traits::has_packed_bits_v<OutIter>>> =
+        std::is_same_v<std::remove_const_t<packed_bits_word_t<InIter>>,
+            packed_bits_word_t<OutIter>>;
+
+    // Whether a value compared to the elements can be compared to bool,
+    // which tells the bits equal to it
+    template <typename T, typename Enable = void>
+    inline constexpr bool is_packed_bits_comparable_v = false;
+
+    template <typename T>
+    inline constexpr bool is_packed_bits_comparable_v<T,
+        std::enable_if_t<std::is_convertible_v<
+            decltype(std::declval<T const&>() == true), bool>>> = true;
+
+    // Whether a predicate of the elements can be applied to bool values
+    template <typename Pred>
+    inline constexpr bool is_packed_bits_predicate_v =
+        std::is_invocable_v<Pred&, bool>;
+
+    template <typename Word>
+    inline constexpr std::size_t packed_bits_word_size =
+        std::numeric_limits<std::remove_const_t<Word>>::digits;
+
+    template <typename Word>
+    PIKA_FORCEINLINE std::size_t packed_bits_popcount(Word w) noexcept
+    {
+        static_assert(packed_bits_word_size<Word> <= 64,
+            "the words of packed bits must not exceed 64 bits");
+#if defined(__GNUC__)
+        return static_cast<std::size_t>(
+            __builtin_popcountll(static_cast<unsigned long long>(w)));
+#else
+        std::size_t count = 0;
+        for (/**/; w != 0; w &= w - 1)
+        {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    // the position of the lowest set bit of w, which must not be zero
+    template <typename Word>
+    PIKA_FORCEINLINE std::size_t packed_bits_countr_zero(Word w) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>(
+            __builtin_ctzll(static_cast<unsigned long long>(w)));
+#else
+        std::size_t pos = 0;
+        for (/**/; (w & Word(1)) == 0; w >>= 1)
+        {
+            ++pos;
+        }
+        return pos;
+#endif
+    }
+
+    // the bits [first, last) of a word, first < last <= its size
+    template <typename Word>
+    PIKA_FORCEINLINE constexpr std::remove_const_t<Word> packed_bits_mask(
+        std::size_t first, std::size_t last) noexcept
+    {
+        using word_type = std::remove_const_t<Word>;
+
+        constexpr word_type all = static_cast<word_type>(~word_type(0));
+        return static_cast<word_type>(all << first) &
+            static_cast<word_type>(all >> (packed_bits_word_size<Word> - last));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The bits [first, last) of the words starting at words, first being
+    // less than the size of a word.
+    template <typename Word>
+    struct packed_bits_range
+    {
+        static constexpr std::size_t word_size = packed_bits_word_size<Word>;
+
+        Word* words;
+        std::size_t first;
+        std::size_t last;
+
+        // the number of words holding bits of the range
+        constexpr std::size_t num_words() const noexcept
+        {
+            return first == last ? 0 : (last - 1) / word_size + 1;
+        }
+
+        // the bits of the range held by count words starting at words[k],
+        // the ranges of disjoint words never share a word
+        constexpr packed_bits_range part(
+            std::size_t k, std::size_t count) const noexcept
+        {
+            return packed_bits_range{words, (std::max)(first, k * word_size),
+                (std::min)(last, (k + count) * word_size)};
+        }
+
+        // Calls f(k, first, last) for the words holding bits of the range,
+        // [first, last) being the bits of words[k] which are part of it. The
+        // walk stops once f returns false.
+        template <typename F>
+        void for_each_word(F&& f) const
+        {
+            if (first == last)
+            {
+                return;
+            }
+
+            std::size_t k = first / word_size;
+            std::size_t const last_word = (last - 1) / word_size;
+            std::size_t const last_bit = last - last_word * word_size;
+            if (k == last_word)
+            {
+                f(k, first - k * word_size, last_bit);
+                return;
+            }
+
+            if (!f(k, first - k * word_size, word_size))
+            {
+                return;
+            }
+            for (++k; k != last_word; ++k)
+            {
+                if (!f(k, std::size_t(0), word_size))
+                {
+                    return;
+                }
+            }
+            f(last_word, std::size_t(0), last_bit);
+        }
+    };
+
+    template <typename Iter>
+    packed_bits_range<typename pika::traits::packed_bits<Iter>::word_type>
+    make_packed_bits_range(Iter const& it, std::size_t count) noexcept
+    {
+        using traits = pika::traits::packed_bits<Iter>;
+        using word_type = typename traits::word_type;
+        constexpr std::size_t word_size = packed_bits_word_size<word_type>;
+
+        std::size_t const offset = traits::offset(it);
+        return packed_bits_range<word_type>{traits::word(it) +
+                offset / word_size,
+            offset % word_size, offset % word_size + count};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the number of set bits in r
+    template <typename Word>
+    std::size_t packed_bits_count(packed_bits_range<Word> const& r) noexcept
+    {
+        std::size_t count = 0;
+        r.for_each_word([&](std::size_t k, std::size_t first,
+                            std::size_t last) {
+            count += packed_bits_popcount(
+                r.words[k] & packed_bits_mask<Word>(first, last));
+            return true;
+        });
+        return count;
+    }
+
+    // the position of the first bit of r equal to value (relative to
+    // r.words), r.last if there is none
+    template <typename Word>
+    std::size_t packed_bits_find(
+        packed_bits_range<Word> const& r, bool value) noexcept
+    {
+        using word_type = std::remove_const_t<Word>;
+
+        std::size_t pos = r.last;
+        r.for_each_word([&](std::size_t k, std::size_t first,
+                            std::size_t last) {
+            word_type const w = value ? r.words[k] : word_type(~r.words[k]);
+            word_type const found = w & packed_bits_mask<Word>(first, last);
+            if (found != 0)
+            {
+                pos = k * r.word_size + packed_bits_countr_zero(found);
+                return false;
+            }
+            return true;
+        });
+        return pos;
+    }
+
+    // sets the bits of r to value
+    template <typename Word>
+    void packed_bits_fill(packed_bits_range<Word> const& r, bool value) noexcept
+    {
+        r.for_each_word([&](std::size_t k, std::size_t first,
+                            std::size_t last) {
+            Word const mask = packed_bits_mask<Word>(first, last);
+            r.words[k] = value ? static_cast<Word>(r.words[k] | mask) :
+                                 static_cast<Word>(r.words[k] & ~mask);
+            return true;
+        });
+    }
+
+    // Copies the bits of the words starting at src to the bits of r, bit
+    // dest_first of the destination words receiving bit src_first. The
+    // source bits must follow the destination bits if the sequences overlap.
+    template <typename SrcWord, typename Word>
+    void packed_bits_copy(SrcWord* src, std::size_t src_first,
+        std::size_t dest_first, packed_bits_range<Word> const& r) noexcept
+    {
+        constexpr std::size_t word_size = packed_bits_word_size<Word>;
+
+        r.for_each_word([&](std::size_t k, std::size_t first,
+                            std::size_t last) {
+            // the source bits are read as a word starting at the first of
+            // them, from two words unless they are aligned
+            std::size_t const pos =
+                src_first + k * word_size + first - dest_first;
+            std::size_t const shift = pos % word_size;
+            SrcWord* const w = src + pos / word_size;
+
+            Word bits = static_cast<Word>(*w >> shift);
+            if (shift != 0 && shift + (last - first) > word_size)
+            {
+                bits |= static_cast<Word>(w[1] << (word_size - shift));
+            }
+
+            Word const mask = packed_bits_mask<Word>(first, last);
+            r.words[k] = static_cast<Word>(r.words[k] & ~mask) |
+                static_cast<Word>(static_cast<Word>(bits << first) & mask);
+            return true;
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The algorithms below see the elements as values matching (or not) the
+    // value or predicate of the algorithm, match_false and match_true telling
+    // whether the bits equal to false and true do.
+
+    // the number of the count elements starting at first which match
+    template <typename Iter>
+    std::size_t sequential_packed_bits_count(Iter first, std::size_t count,
+        bool match_false, bool match_true) noexcept
+    {
+        if (match_false == match_true)
+        {
+            return match_true ? count : 0;
+        }
+
+        std::size_t const ones =
+            packed_bits_count(make_packed_bits_range(first, count));
+        return match_true ? ones : count - ones;
+    }
+
+    template <typename ExPolicy, typename R, typename Iter>
+    typename algorithm_result<ExPolicy, R>::type parallel_packed_bits_count(
+        ExPolicy&& policy, Iter first, std::size_t count, bool match_false,
+        bool match_true)
+    {
+        if (count == 0 || match_false == match_true)
+        {
+            return algorithm_result<ExPolicy, R>::get(
+                R(match_true ? count : 0));
+        }
+
+        auto const bits = make_packed_bits_range(first, count);
+        auto f1 = [bits](auto part_begin, std::size_t part_size) {
+            return packed_bits_count(bits.part(*part_begin, part_size));
+        };
+
+        return partitioner<ExPolicy, R, std::size_t>::call(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_counting_iterator(std::size_t(0)),
+            bits.num_words(), PIKA_MOVE(f1),
+            make_chunk_values_reducer(
+                [count, match_true](std::vector<std::size_t>&& results) {
+                    std::size_t ones = 0;
+                    for (std::size_t part : results)
+                    {
+                        ones += part;
+                    }
+                    return R(match_true ? ones : count - ones);
+                }));
+    }
+
+    // the position of the first of the count elements starting at first
+    // which matches, count if there is none
+    template <typename Iter>
+    std::size_t sequential_packed_bits_find(Iter first, std::size_t count,
+        bool match_false, bool match_true) noexcept
+    {
+        if (match_false == match_true)
+        {
+            return match_true ? 0 : count;
+        }
+
+        auto const bits = make_packed_bits_range(first, count);
+        return packed_bits_find(bits, match_true) - bits.first;
+    }
+
+    // Searches the words in parallel, the chunks holding the bits following
+    // a match are skipped. The result is f(position), see
+    // sequential_packed_bits_find.
+    template <typename ExPolicy, typename R, typename Iter, typename F>
+    typename algorithm_result<ExPolicy, R>::type parallel_packed_bits_find(
+        ExPolicy&& policy, Iter first, std::size_t count, bool match_false,
+        bool match_true, F&& f)
+    {
+        if (count == 0 || match_false == match_true)
+        {
+            return algorithm_result<ExPolicy, R>::get(
+                PIKA_INVOKE(f, match_true ? std::size_t(0) : count));
+        }
+
+        auto const bits = make_packed_bits_range(first, count);
+        constexpr std::size_t word_size = decltype(bits)::word_size;
+        util::cancellation_token<std::size_t> tok(bits.last);
+
+        auto f1 = [bits, tok, match_true](auto, std::size_t part_size,
+                      std::size_t base_idx) mutable {
+            auto const part = bits.part(base_idx, part_size);
+            if (!tok.was_cancelled(part.first))
+            {
+                std::size_t const pos = packed_bits_find(part, match_true);
+                if (pos != part.last)
+                {
+                    tok.cancel(pos);
+                }
+            }
+        };
+
+        auto f2 = [bits, tok, f = PIKA_FORWARD(F, f)](
+                      std::vector<pika::future<void>>&& data) mutable -> R {
+            // make sure iterators embedded in function object that is
+            // attached to futures are invalidated
+            data.clear();
+            return PIKA_INVOKE(f, tok.get_data() - bits.first);
+        };
+
+        return partitioner<ExPolicy, R, void>::call_with_index_cancellable(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_counting_iterator(std::size_t(0)),
+            bits.num_words(), 1, PIKA_MOVE(f1), PIKA_MOVE(f2),
+            [tok](std::size_t base_idx) {
+                return tok.was_cancelled(base_idx * word_size);
+            });
+    }
+
+    // sets the count elements starting at first to value
+    template <typename Iter>
+    Iter sequential_packed_bits_fill(
+        Iter first, std::size_t count, bool value) noexcept
+    {
+        packed_bits_fill(make_packed_bits_range(first, count), value);
+        return std::next(first, count);
+    }
+
+    // Every chunk sets the bits of whole words, no two chunks write the same
+    // word.
+    template <typename ExPolicy, typename Iter>
+    typename algorithm_result<ExPolicy, Iter>::type parallel_packed_bits_fill(
+        ExPolicy&& policy, Iter first, std::size_t count, bool value)
+    {
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(first));
+        }
+
+        auto const bits = make_packed_bits_range(first, count);
+        auto f1 = [bits, value](
+                      auto, std::size_t part_size, std::size_t base_idx) {
+            packed_bits_fill(bits.part(base_idx, part_size), value);
+        };
+
+        auto f2 = [first, count](
+                      std::vector<pika::future<void>>&& data) -> Iter {
+            data.clear();
+            return std::next(first, count);
+        };
+
+        return partitioner<ExPolicy, Iter, void>::call_with_index(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_counting_iterator(std::size_t(0)),
+            bits.num_words(), 1, PIKA_MOVE(f1), PIKA_MOVE(f2));
+    }
+
+    // copies the count elements starting at first to dest
+    template <typename InIter, typename OutIter>
+    in_out_result<InIter, OutIter> sequential_packed_bits_copy(
+        InIter first, std::size_t count, OutIter dest) noexcept
+    {
+        auto const src = make_packed_bits_range(first, count);
+        auto const bits = make_packed_bits_range(dest, count);
+        packed_bits_copy(src.words, src.first, bits.first, bits);
+        return in_out_result<InIter, OutIter>{
+            std::next(first, count), std::next(dest, count)};
+    }
+
+    // The chunks are split on the words of the destination, every chunk
+    // writes whole words no other chunk writes.
+    template <typename ExPolicy, typename InIter, typename OutIter>
+    typename algorithm_result<ExPolicy, in_out_result<InIter, OutIter>>::type
+    parallel_packed_bits_copy(
+        ExPolicy&& policy, InIter first, std::size_t count, OutIter dest)
+    {
+        using result_type = in_out_result<InIter, OutIter>;
+
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, result_type>::get(
+                result_type{PIKA_MOVE(first), PIKA_MOVE(dest)});
+        }
+
+        auto const src = make_packed_bits_range(first, count);
+        auto const bits = make_packed_bits_range(dest, count);
+        auto f1 = [src, bits](
+                      auto, std::size_t part_size, std::size_t base_idx) {
+            packed_bits_copy(src.words, src.first, bits.first,
+                bits.part(base_idx, part_size));
+        };
+
+        auto f2 = [first, count, dest](
+                      std::vector<pika::future<void>>&& data) -> result_type {
+            data.clear();
+            return result_type{
+                std::next(first, count), std::next(dest, count)};
+        };
+
+        return partitioner<ExPolicy, result_type, void>::call_with_index(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_counting_iterator(std::size_t(0)),
+            bits.num_words(), 1, PIKA_MOVE(f1), PIKA_MOVE(f2));
+    }
+}    // namespace pika::parallel::detail
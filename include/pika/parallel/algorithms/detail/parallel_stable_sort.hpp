@@ -13,6 +13,9 @@
 #include <pika/executors/exception_list.hpp>
 #include <pika/parallel/algorithms/detail/sample_sort.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+#include <pika/parallel/util/tunables.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -27,7 +30,10 @@
 #include <vector>
 
 namespace pika::parallel::detail {
-    static constexpr std::size_t stable_sort_limit_per_task = 1 << 16;
+    inline std::size_t stable_sort_limit_per_task() noexcept
+    {
+        return util::get_tunable(util::tunable::stable_sort_limit_per_task);
+    }
 
     /// \struct parallel_stable_sort
     /// \brief This a structure for to implement a parallel stable sort
@@ -41,8 +47,12 @@ namespace pika::parallel::detail {
         Compare comp;
         std::size_t nelem;
         value_type* ptr;
+        util::temporary_buffer_arena* arena;
+        pika::stop_token stop;
 
-        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp);
+        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp,
+            util::temporary_buffer_arena* arena = nullptr,
+            pika::stop_token stop = pika::stop_token());
 
         // / brief Perform sorting operation
         template <typename Exec>
@@ -53,10 +63,7 @@ namespace pika::parallel::detail {
         ///        temporary buffer used in the sorting process
         ~parallel_stable_sort_helper()
         {
-            if (ptr != nullptr)
-            {
-                std::free(ptr);
-            }
+            util::detail::deallocate_temporary_buffer(ptr, arena);
         }
     };    // end struct parallel_stable_sort
 
@@ -66,14 +73,19 @@ namespace pika::parallel::detail {
     /// \param [in] comp : object for to compare two elements
     /// \param [in] nthread : define the number of threads to use
     ///                  in the process. By default is the number of thread HW
+    /// \param [in] arena : arena the temporary buffer is taken from, if any
+    /// \param [in] stop : token checked before every phase of the sort
     template <typename Iter, typename Sent, typename Compare>
     parallel_stable_sort_helper<Iter, Sent,
         Compare>::parallel_stable_sort_helper(Iter first, Sent last,
-        Compare comp)
+        Compare comp, util::temporary_buffer_arena* arena,
+        pika::stop_token stop)
       : range_initial(first, last)
       , comp(comp)
       , nelem(range_initial.size())
       , ptr(nullptr)
+      , arena(arena)
+      , stop(PIKA_MOVE(stop))
     {
         PIKA_ASSERT(range_initial.size() >= 0);
     }
@@ -90,7 +102,8 @@ namespace pika::parallel::detail {
 
             if (nelem < chunk_size || nthreads < 2)
             {
-                spin_sort(range_initial.begin(), range_initial.end(), comp);
+                spin_sort(
+                    range_initial.begin(), range_initial.end(), comp, arena);
                 return last;
             }
 
@@ -103,11 +116,8 @@ namespace pika::parallel::detail {
             // leave memory uninitialized, sample_sort will manage construction
             // etc.
             ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+                util::detail::allocate_temporary_buffer(
+                    sizeof(value_type) * nptr, arena));
 
             // Parallel Process
             range<Iter, Sent> range_first(
@@ -120,9 +130,11 @@ namespace pika::parallel::detail {
                 range_initial.begin() + nptr, comp, nthreads, range_buffer,
                 chunk_size);
 
+            util::detail::throw_if_sort_stop_requested(stop);
             sample_sort(exec, range_initial.begin() + nptr, range_initial.end(),
                 comp, nthreads, range_buffer, chunk_size);
 
+            util::detail::throw_if_sort_stop_requested(stop);
             range_buffer = init_move(range_buffer, range_first);
             range_initial =
                 half_merge(range_initial, range_buffer, range_second, comp);
@@ -145,13 +157,15 @@ namespace pika::parallel::detail {
 
     template <typename Exec, typename Iter, typename Sent, typename Compare>
     Iter parallel_stable_sort(Exec&& exec, Iter first, Sent last,
-        std::size_t cores, std::size_t chunk_size, Compare&& comp)
+        std::size_t cores, std::size_t chunk_size, Compare&& comp,
+        util::temporary_buffer_arena* arena = nullptr,
+        pika::stop_token stop = pika::stop_token())
     {
         using parallel_stable_sort_helper_t =
             parallel_stable_sort_helper<Iter, Sent, std::decay_t<Compare>>;
 
-        parallel_stable_sort_helper_t sorter(
-            first, last, PIKA_FORWARD(Compare, comp));
+        parallel_stable_sort_helper_t sorter(first, last,
+            PIKA_FORWARD(Compare, comp), arena, PIKA_MOVE(stop));
 
         return sorter(PIKA_FORWARD(Exec, exec), cores, chunk_size);
     }
@@ -164,6 +178,6 @@ namespace pika::parallel::detail {
 
         return parallel_stable_sort(PIKA_FORWARD(Exec, exec), first, last,
             pika::threads::detail::hardware_concurrency(),
-            stable_sort_limit_per_task, compare{});
+            stable_sort_limit_per_task(), compare{});
     }
 }    // namespace pika::parallel::detail
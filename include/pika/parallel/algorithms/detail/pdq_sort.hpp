@@ -0,0 +1,443 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The partitioning scheme and the fallbacks follow pattern-defeating
+// quicksort (Orson Peters, https://github.com/orlp/pdqsort), the branchless
+// partitioning is derived from "BlockQuicksort: How Branch Mispredictions
+// don't affect Quicksort" (Stefan Edelkamp and Armin Weiss).
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <pika/parallel/algorithms/detail/sorting_network.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // partitions below this size are sorted using insertion sort (or a
+    // sorting network)
+    inline constexpr std::ptrdiff_t pdq_insertion_sort_threshold = 24;
+
+    // partitions above this size use Tukey's ninther to select the pivot
+    inline constexpr std::ptrdiff_t pdq_ninther_threshold = 128;
+
+    // when we detect an already sorted partition, attempt an insertion sort
+    // that allows this amount of element moves before giving up
+    inline constexpr std::size_t pdq_partial_insertion_sort_limit = 8;
+
+    // the number of elements classified before their offsets are swapped,
+    // must fit into an unsigned char
+    inline constexpr std::ptrdiff_t pdq_block_size = 64;
+
+    template <typename Iter>
+    PIKA_FORCEINLINE void pdq_iter_swap(Iter a, Iter b)
+    {
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+        std::ranges::iter_swap(a, b);
+#else
+        std::iter_swap(a, b);
+#endif
+    }
+
+    // returns floor(log2(n)), n > 0
+    inline int pdq_log2(std::ptrdiff_t n) noexcept
+    {
+        int log = 0;
+        while (n >>= 1)
+        {
+            ++log;
+        }
+        return log;
+    }
+
+    template <typename Iter, typename Comp>
+    void pdq_sort2(Iter a, Iter b, Comp& comp)
+    {
+        if (PIKA_INVOKE(comp, *b, *a))
+        {
+            pdq_iter_swap(a, b);
+        }
+    }
+
+    // sorts the elements *a, *b and *c
+    template <typename Iter, typename Comp>
+    void pdq_sort3(Iter a, Iter b, Iter c, Comp& comp)
+    {
+        pdq_sort2(a, b, comp);
+        pdq_sort2(b, c, comp);
+        pdq_sort2(a, b, comp);
+    }
+
+    template <typename Iter, typename Comp>
+    void pdq_heap_sort(Iter first, Iter last, Comp& comp)
+    {
+        std::make_heap(first, last, comp);
+        std::sort_heap(first, last, comp);
+    }
+
+    // Attempts to use insertion sort on [first, last). Gives up and returns
+    // false if more than pdq_partial_insertion_sort_limit elements had to be
+    // moved, returns true if the range has been sorted.
+    template <typename Iter, typename Comp>
+    bool pdq_partial_insertion_sort(Iter first, Iter last, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        if (first == last)
+        {
+            return true;
+        }
+
+        std::size_t limit = 0;
+        for (Iter cur = first + 1; cur != last; ++cur)
+        {
+            Iter sift = cur;
+            Iter sift_1 = cur - 1;
+
+            if (PIKA_INVOKE(comp, *sift, *sift_1))
+            {
+                value_type tmp = PIKA_MOVE(*sift);
+                do
+                {
+                    *sift-- = PIKA_MOVE(*sift_1);
+                } while (sift != first && PIKA_INVOKE(comp, tmp, *--sift_1));
+
+                *sift = PIKA_MOVE(tmp);
+                limit += std::size_t(cur - sift);
+            }
+
+            if (limit > pdq_partial_insertion_sort_limit)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Partitions [first, last) around the pivot *first. Elements equal to
+    // the pivot are put in the right-hand partition. Returns the position of
+    // the pivot after partitioning and whether the range already was
+    // correctly partitioned. Requires that some element of (first, last) is
+    // not smaller than the pivot, e.g. by having selected a median as the
+    // pivot.
+    //
+    // Instead of swapping each misplaced element as soon as it is found, the
+    // offsets of blocks of misplaced elements are collected first. The
+    // comparisons only affect the index the next offset is written to, which
+    // removes the data dependent branches of a classic Hoare partition.
+    template <typename Iter, typename Comp>
+    std::pair<Iter, bool> partition_right_branchless(
+        Iter first, Iter last, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        Iter const begin = first;
+        value_type pivot(PIKA_MOVE(*begin));
+
+        // find the first element not smaller than the pivot
+        while (PIKA_INVOKE(comp, *++first, pivot))
+        {
+        }
+
+        // find the last element smaller than the pivot, the search has to be
+        // guarded if there was no element smaller than the pivot to the left
+        if (first - 1 == begin)
+        {
+            while (first < last && !PIKA_INVOKE(comp, *--last, pivot))
+            {
+            }
+        }
+        else
+        {
+            while (!PIKA_INVOKE(comp, *--last, pivot))
+            {
+            }
+        }
+
+        // if the first pair of elements to swap is the same element, the
+        // range already was correctly partitioned
+        bool const already_partitioned = first >= last;
+        if (!already_partitioned)
+        {
+            pdq_iter_swap(first, last);
+            ++first;
+
+            unsigned char offsets_l[pdq_block_size];
+            unsigned char offsets_r[pdq_block_size];
+
+            Iter offsets_l_base = first;
+            Iter offsets_r_base = last;
+            std::ptrdiff_t num_l = 0;
+            std::ptrdiff_t num_r = 0;
+            std::ptrdiff_t start_l = 0;
+            std::ptrdiff_t start_r = 0;
+
+            while (first < last)
+            {
+                // decide how many elements are classified for each side
+                std::ptrdiff_t const num_unknown = last - first;
+                std::ptrdiff_t const left_split = num_l == 0 ?
+                    (num_r == 0 ? num_unknown / 2 : num_unknown) :
+                    0;
+                std::ptrdiff_t const right_split =
+                    num_r == 0 ? (num_unknown - left_split) : 0;
+
+                // record the offsets of the elements on the wrong side
+                std::ptrdiff_t const count_l =
+                    (std::min)(left_split, pdq_block_size);
+                for (std::ptrdiff_t i = 0; i != count_l; ++i, ++first)
+                {
+                    offsets_l[num_l] = static_cast<unsigned char>(i);
+                    num_l += !PIKA_INVOKE(comp, *first, pivot);
+                }
+
+                std::ptrdiff_t const count_r =
+                    (std::min)(right_split, pdq_block_size);
+                for (std::ptrdiff_t i = 0; i != count_r; ++i)
+                {
+                    offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+                    num_r +=
+                        static_cast<bool>(PIKA_INVOKE(comp, *--last, pivot));
+                }
+
+                // swap the misplaced elements pairwise
+                std::ptrdiff_t const num = (std::min)(num_l, num_r);
+                for (std::ptrdiff_t i = 0; i != num; ++i)
+                {
+                    pdq_iter_swap(offsets_l_base + offsets_l[start_l + i],
+                        offsets_r_base - offsets_r[start_r + i]);
+                }
+
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+
+                if (num_l == 0)
+                {
+                    start_l = 0;
+                    offsets_l_base = first;
+                }
+                if (num_r == 0)
+                {
+                    start_r = 0;
+                    offsets_r_base = last;
+                }
+            }
+
+            // all elements have been classified, move the remaining
+            // misplaced elements of one of the sides into place
+            if (num_l != 0)
+            {
+                while (num_l-- != 0)
+                {
+                    pdq_iter_swap(
+                        offsets_l_base + offsets_l[start_l + num_l], --last);
+                }
+                first = last;
+            }
+            if (num_r != 0)
+            {
+                while (num_r-- != 0)
+                {
+                    pdq_iter_swap(
+                        offsets_r_base - offsets_r[start_r + num_r], first);
+                    ++first;
+                }
+            }
+        }
+
+        // put the pivot in its final place
+        Iter pivot_pos = first - 1;
+        *begin = PIKA_MOVE(*pivot_pos);
+        *pivot_pos = PIKA_MOVE(pivot);
+
+        return std::make_pair(pivot_pos, already_partitioned);
+    }
+
+    // Partitions [first, last) around the pivot *first, putting elements
+    // equal to the pivot into the left-hand partition. Used if the pivot is
+    // equal to the preceding pivot, in which case all elements equal to it
+    // are in their final place. Returns the position of the pivot.
+    template <typename Iter, typename Comp>
+    Iter partition_left(Iter first, Iter last, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        Iter const begin = first;
+        Iter const end = last;
+        value_type pivot(PIKA_MOVE(*begin));
+
+        while (PIKA_INVOKE(comp, pivot, *--last))
+        {
+        }
+
+        if (last + 1 == end)
+        {
+            while (first < last && !PIKA_INVOKE(comp, pivot, *++first))
+            {
+            }
+        }
+        else
+        {
+            while (!PIKA_INVOKE(comp, pivot, *++first))
+            {
+            }
+        }
+
+        while (first < last)
+        {
+            pdq_iter_swap(first, last);
+            while (PIKA_INVOKE(comp, pivot, *--last))
+            {
+            }
+            while (!PIKA_INVOKE(comp, pivot, *++first))
+            {
+            }
+        }
+
+        Iter pivot_pos = last;
+        *begin = PIKA_MOVE(*pivot_pos);
+        *pivot_pos = PIKA_MOVE(pivot);
+
+        return pivot_pos;
+    }
+
+    // Selects a pivot for [first, last) and moves it to *first. The median
+    // of three (or Tukey's ninther for large ranges) guarantees that an
+    // element not smaller than the pivot remains in (first, last).
+    template <typename Iter, typename Comp>
+    void pdq_select_pivot(Iter first, Iter last, Comp& comp)
+    {
+        std::ptrdiff_t const size = last - first;
+        std::ptrdiff_t const s2 = size / 2;
+        if (size > pdq_ninther_threshold)
+        {
+            pdq_sort3(first, first + s2, last - 1, comp);
+            pdq_sort3(first + 1, first + (s2 - 1), last - 2, comp);
+            pdq_sort3(first + 2, first + (s2 + 1), last - 3, comp);
+            pdq_sort3(first + (s2 - 1), first + s2, first + (s2 + 1), comp);
+            pdq_iter_swap(first, first + s2);
+        }
+        else
+        {
+            pdq_sort3(first + s2, first, last - 1, comp);
+        }
+    }
+
+    // Breaks up patterns which made the previous partitioning highly
+    // unbalanced by swapping a few elements of each partition.
+    template <typename Iter>
+    void pdq_break_patterns(Iter first, Iter pivot_pos, Iter last)
+    {
+        std::ptrdiff_t const l_size = pivot_pos - first;
+        std::ptrdiff_t const r_size = last - (pivot_pos + 1);
+
+        if (l_size >= pdq_insertion_sort_threshold)
+        {
+            pdq_iter_swap(first, first + l_size / 4);
+            pdq_iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+            if (l_size > pdq_ninther_threshold)
+            {
+                pdq_iter_swap(first + 1, first + (l_size / 4 + 1));
+                pdq_iter_swap(first + 2, first + (l_size / 4 + 2));
+                pdq_iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                pdq_iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+            }
+        }
+
+        if (r_size >= pdq_insertion_sort_threshold)
+        {
+            pdq_iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+            pdq_iter_swap(last - 1, last - r_size / 4);
+
+            if (r_size > pdq_ninther_threshold)
+            {
+                pdq_iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                pdq_iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                pdq_iter_swap(last - 2, last - (1 + r_size / 4));
+                pdq_iter_swap(last - 3, last - (2 + r_size / 4));
+            }
+        }
+    }
+
+    template <typename Iter, typename Comp>
+    void pdq_sort_loop(
+        Iter first, Iter last, Comp& comp, int bad_allowed, bool leftmost)
+    {
+        while (true)
+        {
+            std::ptrdiff_t const size = last - first;
+            if (size < pdq_insertion_sort_threshold)
+            {
+                small_sort(first, last, comp);
+                return;
+            }
+
+            pdq_select_pivot(first, last, comp);
+
+            // if the pivot is equal to the preceding pivot, all elements
+            // equal to it are already in place
+            if (!leftmost && !PIKA_INVOKE(comp, *(first - 1), *first))
+            {
+                first = partition_left(first, last, comp) + 1;
+                continue;
+            }
+
+            auto const [pivot_pos, already_partitioned] =
+                partition_right_branchless(first, last, comp);
+
+            std::ptrdiff_t const l_size = pivot_pos - first;
+            std::ptrdiff_t const r_size = last - (pivot_pos + 1);
+            bool const highly_unbalanced =
+                l_size < size / 8 || r_size < size / 8;
+
+            if (highly_unbalanced)
+            {
+                // too many bad pivots, guarantee O(n log n)
+                if (--bad_allowed == 0)
+                {
+                    pdq_heap_sort(first, last, comp);
+                    return;
+                }
+                pdq_break_patterns(first, pivot_pos, last);
+            }
+            else if (already_partitioned &&
+                pdq_partial_insertion_sort(first, pivot_pos, comp) &&
+                pdq_partial_insertion_sort(pivot_pos + 1, last, comp))
+            {
+                return;
+            }
+
+            // recurse into the left partition, loop on the right one
+            pdq_sort_loop(first, pivot_pos, comp, bad_allowed, leftmost);
+            first = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+    // Sorts [first, last) using pattern-defeating quicksort, which is not
+    // stable. Runs in O(n log n) even for adversarial inputs and in O(n) for
+    // some patterns like already sorted sequences.
+    template <typename Iter, typename Comp>
+    void pdq_sort(Iter first, Iter last, Comp&& comp)
+    {
+        if (last - first < 2)
+        {
+            return;
+        }
+        pdq_sort_loop(first, last, comp, pdq_log2(last - first), true);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/invoke_result.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
+#include <pika/parallel/util/cache_projected_keys.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The projection of the (key, iterator) pairs sorted in place of the
+    // elements, which must not be cached again.
+    struct cached_key
+    {
+        template <typename Element>
+        constexpr auto const& operator()(Element const& element) const noexcept
+        {
+            return element.first;
+        }
+    };
+
+    template <typename Iter, typename Proj>
+    using projected_key_t =
+        std::decay_t<typename pika::util::detail::invoke_result<Proj&,
+            typename std::iterator_traits<Iter>::reference>::type>;
+
+    // The keys are cached if requested through the executor parameters and
+    // if there is a projection to save.
+    template <typename Parameters, typename Iter, typename Proj,
+        typename Enable = void>
+    inline constexpr bool use_projected_key_sort_v = false;
+
+    template <typename Parameters, typename Iter, typename Proj>
+    inline constexpr bool use_projected_key_sort_v<Parameters, Iter, Proj,
+        std::enable_if_t<std::is_same_v<std::decay_t<Parameters>,
+                             pika::execution::cache_projected_keys> &&
+            !std::is_same_v<std::decay_t<Proj>, projection_identity> &&
+            !std::is_same_v<std::decay_t<Proj>, cached_key>>> =
+        std::is_default_constructible_v<projected_key_t<Iter, Proj>> &&
+        use_indirect_sort_v<Iter>;
+
+    // the minimal number of elements handled by a chunk of the loop
+    // computing the keys
+    static const std::size_t projected_key_chunk_limit = 4096ul;
+
+    // Invokes f(begin, end) for chunks of [0, count), the chunks are run in
+    // parallel unless the policy is sequenced.
+    template <typename ExPolicy, typename F>
+    void projected_key_for_each_chunk(
+        ExPolicy& policy, std::size_t count, F&& f)
+    {
+        std::size_t num_chunks = 1;
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            std::size_t const cores =
+                parallel::execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+            num_chunks = (std::max)(std::size_t(1),
+                (std::min)(cores, count / projected_key_chunk_limit));
+        }
+
+        parallel::detail::run_chunks(
+            policy, num_chunks, [&](std::size_t chunk) {
+                f(chunk * count / num_chunks,
+                    (chunk + 1) * count / num_chunks);
+            });
+    }
+
+    /// \brief sort the elements by their projected keys, computing every
+    ///        key once
+    /// \param [in] policy : execution policy used to compute the keys and
+    ///                      to move the elements
+    /// \param [in] first : iterator to the first element of the range
+    /// \param [in] last : iterator to the element after the last of the range
+    /// \param [in] proj : projection computing the key of an element
+    /// \param [in] sort : sort(first, last) sorts (key, iterator) pairs by
+    ///                    their keys, projected by cached_key
+    template <typename ExPolicy, typename Iter, typename Proj, typename Sort>
+    void projected_key_sort(
+        ExPolicy& policy, Iter first, Iter last, Proj& proj, Sort&& sort)
+    {
+        using element = std::pair<projected_key_t<Iter, Proj>, Iter>;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::vector<element> elements(count);
+        projected_key_for_each_chunk(
+            policy, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    Iter it = first + i;
+                    elements[i].first = PIKA_INVOKE(proj, *it);
+                    elements[i].second = it;
+                }
+            });
+
+        sort(elements.begin(), elements.end());
+
+        std::vector<Iter> v_iter(count);
+        projected_key_for_each_chunk(
+            policy, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    v_iter[i] = elements[i].second;
+                }
+            });
+        std::vector<element>().swap(elements);
+
+        apply_sort_index(policy, first, v_iter);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
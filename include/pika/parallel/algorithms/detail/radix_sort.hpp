@@ -0,0 +1,285 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/invoke_result.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/radix_sort_selection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps a key onto an unsigned integer of the same size such that the
+    // integers compare in the same order as the keys do using operator<.
+    template <typename Key, typename Enable = void>
+    struct radix_key
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename Key>
+    struct radix_key<Key,
+        std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool>>>
+    {
+        static constexpr bool is_valid = true;
+        using type = std::make_unsigned_t<Key>;
+
+        static constexpr type encode(Key key) noexcept
+        {
+            if constexpr (std::is_signed_v<Key>)
+            {
+                // moves the negative values in front of the positive ones
+                return type(
+                    type(key) ^ (type(1) << (sizeof(Key) * CHAR_BIT - 1)));
+            }
+            else
+            {
+                return key;
+            }
+        }
+    };
+
+    template <typename Key>
+    struct radix_key<Key,
+        std::enable_if_t<std::is_floating_point_v<Key> &&
+            std::numeric_limits<Key>::is_iec559 &&
+            (sizeof(Key) == sizeof(std::uint32_t) ||
+                sizeof(Key) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool is_valid = true;
+        using type = std::conditional_t<sizeof(Key) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type encode(Key key) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+
+            // negative values are ordered by the inverse of their magnitude
+            constexpr type sign = type(1) << (sizeof(Key) * CHAR_BIT - 1);
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The comparators for which the order of the keys is known
+    template <typename Comp, typename Key>
+    struct radix_sort_order
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<less, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<>, Key> : radix_sort_order<less, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::less<Key>, Key> : radix_sort_order<less, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<greater, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = true;
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<>, Key>
+      : radix_sort_order<greater, Key>
+    {
+    };
+
+    template <typename Key>
+    struct radix_sort_order<std::greater<Key>, Key>
+      : radix_sort_order<greater, Key>
+    {
+    };
+
+    template <typename RandomIt, typename Proj>
+    using radix_sort_key_t =
+        std::decay_t<typename pika::util::detail::invoke_result<Proj&,
+            typename std::iterator_traits<RandomIt>::reference>::type>;
+
+    // The elements are moved through a temporary buffer, which requires them
+    // to be default constructible.
+    template <typename RandomIt, typename Comp, typename Proj>
+    inline constexpr bool use_radix_sort_v =
+        radix_key<radix_sort_key_t<RandomIt, Proj>>::is_valid &&
+        radix_sort_order<std::decay_t<Comp>,
+            radix_sort_key_t<RandomIt, Proj>>::is_valid &&
+        std::is_default_constructible_v<
+            typename std::iterator_traits<RandomIt>::value_type>;
+
+    // sequences shorter than this are sorted using the comparison based sort
+    // unless the radix sort engine is enforced
+    static const std::size_t radix_sort_limit = 65536ul;
+
+    // the minimal number of elements handled by a chunk of the radix sort
+    static const std::size_t radix_sort_chunk_limit = 16384ul;
+
+    template <typename Parameters>
+    constexpr bool select_radix_sort(
+        Parameters const& params, std::size_t count) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::radix_sort_selection>)
+        {
+            switch (params.get_radix_sort_mode())
+            {
+            case pika::execution::radix_sort_mode::always:
+                return true;
+            case pika::execution::radix_sort_mode::never:
+                return false;
+            default:
+                break;
+            }
+        }
+        return count >= radix_sort_limit;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel least significant digit radix sort of [first, first + count),
+    // the elements are sorted by 8 bits of their key per pass. Every chunk of
+    // the sequence builds a histogram of the digits of its elements, the
+    // exclusive prefix sum over all histograms (ordered by digit, then by
+    // chunk) gives every chunk the positions to scatter its elements to.
+    // Passes for which all elements have the same digit are skipped.
+    template <bool Descending, typename ExPolicy, typename RandomIt,
+        typename Proj>
+    void radix_sort(
+        ExPolicy&& policy, RandomIt first, std::size_t count, Proj& proj)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using key_traits = radix_key<radix_sort_key_t<RandomIt, Proj>>;
+        using key_type = typename key_traits::type;
+
+        constexpr std::size_t digit_bits = 8;
+        constexpr std::size_t num_buckets = std::size_t(1) << digit_bits;
+        constexpr std::size_t num_passes =
+            sizeof(key_type) * CHAR_BIT / digit_bits;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / radix_sort_chunk_limit));
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        auto digit = [&](auto&& elem, std::size_t shift) -> std::size_t {
+            key_type key = key_traits::encode(PIKA_INVOKE(proj, elem));
+            if constexpr (Descending)
+            {
+                key = key_type(~key);
+            }
+            return std::size_t(key >> shift) & (num_buckets - 1);
+        };
+
+        using histogram_type = std::array<std::size_t, num_buckets>;
+        std::vector<histogram_type> histograms(num_chunks);
+        std::vector<value_type> buffer(count);
+
+        // returns false if the pass has been skipped
+        auto run_pass = [&](auto src, auto dst, std::size_t shift) {
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    histogram_type h{};
+                    for (std::size_t i = chunk_begin(chunk),
+                                     end = chunk_begin(chunk + 1);
+                         i != end; ++i)
+                    {
+                        ++h[digit(*(src + i), shift)];
+                    }
+                    histograms[chunk] = h;
+                },
+                pika::detail::irange(std::size_t(0), num_chunks));
+
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != num_buckets; ++bucket)
+            {
+                std::size_t const start = offset;
+                for (auto& h : histograms)
+                {
+                    std::size_t const n = h[bucket];
+                    h[bucket] = offset;
+                    offset += n;
+                }
+
+                if (offset - start == count)
+                {
+                    return false;
+                }
+            }
+
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    histogram_type h = histograms[chunk];
+                    for (std::size_t i = chunk_begin(chunk),
+                                     end = chunk_begin(chunk + 1);
+                         i != end; ++i)
+                    {
+                        auto&& elem = *(src + i);
+                        *(dst + h[digit(elem, shift)]++) = PIKA_MOVE(elem);
+                    }
+                },
+                pika::detail::irange(std::size_t(0), num_chunks));
+            return true;
+        };
+
+        bool in_buffer = false;
+        for (std::size_t pass = 0; pass != num_passes; ++pass)
+        {
+            bool const moved = in_buffer ?
+                run_pass(buffer.begin(), first, pass * digit_bits) :
+                run_pass(first, buffer.begin(), pass * digit_bits);
+            in_buffer = in_buffer != moved;
+        }
+
+        if (in_buffer)
+        {
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::move(buffer.begin() + chunk_begin(chunk),
+                        buffer.begin() + chunk_begin(chunk + 1),
+                        first + chunk_begin(chunk));
+                },
+                pika::detail::irange(std::size_t(0), num_chunks));
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/parallel/algorithms/detail/find.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The sequential kernel of remove_if: move the elements for which pred
+    // does not hold to the front of the range and return its new end. The
+    // datapar policies provide vectorized overloads for arithmetic types and
+    // predicates which can be invoked with vector packs.
+    template <typename ExPolicy>
+    struct sequential_remove_if_t
+      : pika::functional::detail::tag_fallback<sequential_remove_if_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Sent, typename Pred, typename Proj>
+        friend constexpr Iter tag_fallback_invoke(
+            sequential_remove_if_t<ExPolicy>, Iter first, Sent last,
+            Pred&& pred, Proj&& proj)
+        {
+            first = pika::parallel::detail::sequential_find_if<
+                pika::execution::sequenced_policy>(first, last, pred, proj);
+
+            if (first != last)
+                for (Iter i = first; ++i != last;)
+                    if (!PIKA_INVOKE(pred, PIKA_INVOKE(proj, *i)))
+                    {
+                        *first++ = PIKA_MOVE(*i);
+                    }
+            return first;
+        }
+    };
+
+    // The sequential kernel of remove_copy_if: copy the elements for which
+    // pred does not hold to dest.
+    template <typename ExPolicy>
+    struct sequential_remove_copy_if_t
+      : pika::functional::detail::tag_fallback<
+            sequential_remove_copy_if_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename Sent, typename OutIter,
+            typename Pred, typename Proj>
+        friend constexpr in_out_result<InIter, OutIter> tag_fallback_invoke(
+            sequential_remove_copy_if_t<ExPolicy>, InIter first, Sent last,
+            OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            for (/* */; first != last; ++first)
+            {
+                if (!PIKA_INVOKE(pred, PIKA_INVOKE(proj, *first)))
+                {
+                    *dest++ = *first;
+                }
+            }
+            return in_out_result<InIter, OutIter>{first, dest};
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_remove_if_t<ExPolicy> sequential_remove_if =
+        sequential_remove_if_t<ExPolicy>{};
+
+    template <typename ExPolicy>
+    inline constexpr sequential_remove_copy_if_t<ExPolicy>
+        sequential_remove_copy_if = sequential_remove_copy_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE Iter sequential_remove_if(
+        Iter first, Sent last, Pred&& pred, Proj&& proj)
+    {
+        return sequential_remove_if_t<ExPolicy>{}(
+            first, last, PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+    }
+
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename Pred, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE in_out_result<InIter, OutIter>
+    sequential_remove_copy_if(
+        InIter first, Sent last, OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        return sequential_remove_copy_if_t<ExPolicy>{}(first, last, dest,
+            PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace pika::parallel::detail
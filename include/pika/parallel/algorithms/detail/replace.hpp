@@ -0,0 +1,74 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The chunk kernel of replace and replace_if: assign new_value to each of
+    // the count elements for which f holds and return the end of the range.
+    // The datapar policies provide vectorized overloads for arithmetic types
+    // and predicates which can be invoked with vector packs.
+    template <typename ExPolicy>
+    struct sequential_replace_if_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_replace_if_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename F, typename T, typename Proj>
+        friend constexpr InIter tag_fallback_invoke(
+            sequential_replace_if_n_t<ExPolicy>, InIter first,
+            std::size_t count, F&& f, T const& new_value, Proj&& proj)
+        {
+            for (/* */; count != 0; (void) --count, ++first)
+            {
+                if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
+                {
+                    *first = new_value;
+                }
+            }
+            return first;
+        }
+    };
+
+    // The predicate of replace. It compares in the same order as the scalar
+    // loop and it can be invoked with vector packs.
+    template <typename T>
+    struct replace_equal_to
+    {
+        T old_value;
+
+        template <typename U>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr auto operator()(
+            U const& u) const -> decltype(u == old_value)
+        {
+            return u == old_value;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_replace_if_n_t<ExPolicy>
+        sequential_replace_if_n = sequential_replace_if_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename F, typename T,
+        typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE InIter sequential_replace_if_n(
+        InIter first, std::size_t count, F&& f, T const& new_value,
+        Proj&& proj)
+    {
+        return sequential_replace_if_n_t<ExPolicy>{}(first, count,
+            PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -0,0 +1,111 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Contiguous sequences of trivially copyable values are reversed through
+    // pointers to mirrored blocks, without going through
+    // std::reverse_iterator element by element. The datapar policies reverse
+    // whole packs in registers, see datapar/reverse.hpp. Proxy references
+    // (std::vector<bool>) have no address to start from.
+    template <typename Iter,
+        typename V = typename std::iterator_traits<Iter>::value_type>
+    inline constexpr bool is_contiguous_reverse_v =
+#if defined(PIKA_COMPUTE_DEVICE_CODE)
+        false &&
+#endif
+        pika::detail::is_contiguous_iterator_v<Iter> &&
+        std::is_lvalue_reference_v<
+            typename std::iterator_traits<Iter>::reference> &&
+        std::is_trivially_copyable_v<V> && !std::is_volatile_v<V>;
+
+    // reverse_copy additionally requires the destination to hold the same
+    // values contiguously
+    template <typename Iter, typename OutIter>
+    inline constexpr bool is_contiguous_reverse_copy_v =
+        is_contiguous_reverse_v<Iter> &&
+        pika::detail::is_contiguous_iterator_v<OutIter> &&
+        std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+            typename std::iterator_traits<OutIter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Swaps first[i] with last[-1 - i] for the count first elements, the
+    // mirrored ranges must not overlap.
+    template <typename ExPolicy>
+    struct reverse_swap_n_t final
+      : pika::functional::detail::tag_fallback<reverse_swap_n_t<ExPolicy>>
+    {
+    private:
+        template <typename T>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
+        tag_fallback_invoke(
+            reverse_swap_n_t<ExPolicy>, T* first, T* last, std::size_t count)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                T tmp = first[i];
+                first[i] = last[-1 - std::ptrdiff_t(i)];
+                last[-1 - std::ptrdiff_t(i)] = tmp;
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr reverse_swap_n_t<ExPolicy> reverse_swap_n =
+        reverse_swap_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename T>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void reverse_swap_n(
+        T* first, T* last, std::size_t count)
+    {
+        reverse_swap_n_t<ExPolicy>{}(first, last, count);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Writes last[-1 - i] to dest[i] for the count first elements of dest,
+    // the ranges must not overlap.
+    template <typename ExPolicy>
+    struct reverse_copy_n_t final
+      : pika::functional::detail::tag_fallback<reverse_copy_n_t<ExPolicy>>
+    {
+    private:
+        template <typename T>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
+        tag_fallback_invoke(reverse_copy_n_t<ExPolicy>, T const* last,
+            std::size_t count, T* dest)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                dest[i] = last[-1 - std::ptrdiff_t(i)];
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr reverse_copy_n_t<ExPolicy> reverse_copy_n =
+        reverse_copy_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename T>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void reverse_copy_n(
+        T const* last, std::size_t count, T* dest)
+    {
+        reverse_copy_n_t<ExPolicy>{}(last, count, dest);
+    }
+#endif
+}    // namespace pika::parallel::detail
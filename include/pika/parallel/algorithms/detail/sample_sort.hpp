@@ -17,6 +17,8 @@
 #include <pika/parallel/util/merge_four.hpp>
 #include <pika/parallel/util/merge_vector.hpp>
 #include <pika/parallel/util/range.hpp>
+#include <pika/parallel/util/tunables.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -34,7 +36,29 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace pika::parallel::detail {
-    static constexpr std::uint32_t sample_sort_limit_per_task = (1 << 16);
+    inline std::size_t sample_sort_limit_per_task() noexcept
+    {
+        return util::get_tunable(util::tunable::sample_sort_limit_per_task);
+    }
+
+    // the intervals are made small enough to be merged within a cache of
+    // this size, which is typical for the cache private to a core
+    inline constexpr std::size_t sample_sort_cache_size = 262144;
+
+    // The number of intervals merged by separate jobs: at least 8 per thread
+    // to balance the load, more if the intervals would not fit into the
+    // cache otherwise. Every thread contributes nintervals - 1 samples, the
+    // samples are limited to a 64th of the elements.
+    inline std::uint32_t sample_sort_num_intervals(std::size_t nelem,
+        std::size_t value_size, std::uint32_t nthreads) noexcept
+    {
+        std::size_t const min_intervals = std::size_t(nthreads) << 3;
+        std::size_t const cache_intervals =
+            nelem / (sample_sort_cache_size / value_size + 1) + 1;
+        std::size_t const max_intervals = nelem / (std::size_t(nthreads) << 6);
+        return static_cast<std::uint32_t>((std::max)(min_intervals,
+            (std::min)(cache_intervals, max_intervals)));
+    }
 
     /// \struct sample_sort
     /// \brief This a structure for to implement a sample sort, exception
@@ -55,12 +79,15 @@ namespace pika::parallel::detail {
         Compare comp;
         range_it global_range;
         range_buf global_buf;
+        util::temporary_buffer_arena* arena;
 
         std::vector<std::vector<range_it>> vv_range_it;
         std::vector<std::vector<range_buf>> vv_range_buf;
         std::vector<range_it> vrange_it_ini;
         std::vector<range_buf> vrange_buf_ini;
-        std::atomic<std::uint32_t> njob;
+
+        // the next job of the contiguous block of intervals of every thread
+        std::unique_ptr<std::atomic<std::uint32_t>[]> next_job;
 
         template <typename Exec>
         void initial_configuration(Exec&);
@@ -75,49 +102,71 @@ namespace pika::parallel::detail {
         /// \param [in] comp : object for to Compare two elements
         /// \param [in] nthreads : define the number of threads to use
         ///              in the process. By default is the number of thread HW
-        sample_sort_helper(Compare cmp, std::uint32_t num_threads);
+        /// \param [in] arena : arena the temporary buffer is taken from, if
+        ///              any
+        sample_sort_helper(Compare cmp, std::uint32_t num_threads,
+            util::temporary_buffer_arena* arena = nullptr);
 
         /// \brief destructor of the typename. The utility is to destroy the
         ///        temporary buffer used in the sorting process
         ~sample_sort_helper();
 
-        /// \brief this a function to assign to each thread in the first merge
-        inline void execute_first()
+        // the first interval of the block of the given thread
+        std::uint32_t first_job(std::uint32_t thread) const noexcept
         {
-            std::uint32_t job = 0;
-            while ((job = njob++) < nintervals)
-            {
-                uninit_merge_level4(vrange_buf_ini[job], vv_range_it[job],
-                    vv_range_buf[job], comp);
-            }
+            return static_cast<std::uint32_t>(
+                std::uint64_t(thread) * nintervals / nthreads);
         }
 
-        /// \brief this is a function to assign each thread the final merge
-        inline void execute()
+        /// \brief run f(job) for all intervals, every thread starts with
+        ///        its own contiguous block of intervals, whose elements
+        ///        are close to the ones it has sorted initially, and helps
+        ///        with the blocks of the following threads afterwards
+        template <typename F>
+        void execute_jobs(std::uint32_t thread, F&& f)
         {
-            std::uint32_t job = 0;
-            while ((job = njob++) < nintervals)
+            for (std::uint32_t i = 0; i != nthreads; ++i)
             {
-                merge_vector4(vrange_buf_ini[job], vrange_it_ini[job],
-                    vv_range_buf[job], vv_range_it[job], comp);
+                std::uint32_t const block = (thread + i) % nthreads;
+                std::uint32_t const last_job = first_job(block + 1);
+
+                std::uint32_t job = 0;
+                while ((job = next_job[block]++) < last_job)
+                {
+                    f(job);
+                }
             }
         }
 
-        /// \brief Implement the merge of the initially sparse ranges
-        template <typename Exec>
-        inline void first_merge(Exec& exec)
+        template <typename Exec, typename F>
+        void run_jobs(Exec& exec, F&& f)
         {
-            njob = 0;
+            for (std::uint32_t i = 0; i != nthreads; ++i)
+            {
+                next_job[i] = first_job(i);
+            }
 
             auto shape = pika::util::make_iterator_range(
                 pika::util::make_counting_iterator(std::uint32_t(0)),
                 pika::util::make_counting_iterator(nthreads));
 
-            pika::when_all(
-                execution::bulk_async_execute(
-                    exec, [this](std::uint32_t) { this->execute_first(); },
-                    shape))
+            pika::when_all(execution::bulk_async_execute(
+                               exec,
+                               [this, &f](std::uint32_t thread) {
+                                   this->execute_jobs(thread, f);
+                               },
+                               shape))
                 .get();
+        }
+
+        /// \brief Implement the merge of the initially sparse ranges
+        template <typename Exec>
+        inline void first_merge(Exec& exec)
+        {
+            run_jobs(exec, [this](std::uint32_t job) {
+                uninit_merge_level4(vrange_buf_ini[job], vv_range_it[job],
+                    vv_range_buf[job], comp);
+            });
 
             construct = true;
         }
@@ -129,16 +178,10 @@ namespace pika::parallel::detail {
         template <typename Exec>
         inline void final_merge(Exec& exec)
         {
-            njob = 0;
-
-            auto shape = pika::util::make_iterator_range(
-                pika::util::make_counting_iterator(std::uint32_t(0)),
-                pika::util::make_counting_iterator(nthreads));
-
-            pika::when_all(
-                execution::bulk_async_execute(
-                    exec, [this](std::uint32_t) { this->execute(); }, shape))
-                .get();
+            run_jobs(exec, [this](std::uint32_t job) {
+                merge_vector4(vrange_buf_ini[job], vrange_it_ini[job],
+                    vv_range_buf[job], vv_range_it[job], comp);
+            });
         }
     };
 
@@ -149,14 +192,14 @@ namespace pika::parallel::detail {
     /// \param [in] nthreads : nthreads object for to define the number of threads
     ///            to use in the process. By default is the number of thread HW
     template <typename Iter, typename Sent, typename Compare>
-    sample_sort_helper<Iter, Sent, Compare>::sample_sort_helper(
-        Compare cmp, std::uint32_t num_threads)
+    sample_sort_helper<Iter, Sent, Compare>::sample_sort_helper(Compare cmp,
+        std::uint32_t num_threads, util::temporary_buffer_arena* arena)
       : nthreads(num_threads)
       , construct(false)
       , owner(false)
       , comp(cmp)
       , global_buf(nullptr, nullptr)
-      , njob(0)
+      , arena(arena)
     {
     }
 
@@ -179,14 +222,15 @@ namespace pika::parallel::detail {
             nthreads /= 2;
         }
 
-        nintervals = (nthreads << 3);
-
         if (nthreads < 2 || nelem <= chunk_size)
         {
-            spin_sort(first, last, comp);
+            spin_sort(first, last, comp, arena);
             return;
         }
 
+        nintervals =
+            sample_sort_num_intervals(nelem, sizeof(value_type), nthreads);
+
         if (detail::is_sorted_sequential(first, last, comp))
         {
             return;
@@ -202,11 +246,8 @@ namespace pika::parallel::detail {
         {
             // acquire uninitialized memory
             value_type* ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nelem));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+                util::detail::allocate_temporary_buffer(
+                    sizeof(value_type) * nelem, arena));
             global_buf = range_buf(ptr, ptr + nelem);
             owner = true;
         }
@@ -230,7 +271,8 @@ namespace pika::parallel::detail {
 
         if (owner)
         {
-            std::free(global_buf.begin());
+            util::detail::deallocate_temporary_buffer(
+                global_buf.begin(), arena);
         }
     }
 
@@ -324,24 +366,31 @@ namespace pika::parallel::detail {
             vmilestone.push_back(vsample[pos]);
         }
 
-        // Creation of the first vector of ranges
-        std::vector<std::vector<range<Iter>>> vv_range_first(nthreads);
+        // The table of the boundaries of the intervals within the sorted
+        // ranges, interval k of range i is [bounds[i * stride + k],
+        // bounds[i * stride + k + 1]). The ranges are split in parallel.
+        std::size_t const stride = std::size_t(nintervals) + 1;
+        std::vector<Iter> bounds(nthreads * stride);
 
-        for (std::uint32_t i = 0; i < nthreads; ++i)
-        {
-            Iter itaux = vmem_thread[i].begin();
-            for (std::uint32_t k = 0; k < (nintervals - 1); ++k)
-            {
-                Iter it2 = std::upper_bound(
-                    itaux, vmem_thread[i].end(), *vmilestone[k], comp);
-
-                vv_range_first[i].emplace_back(itaux, it2);
-                itaux = it2;
-            }
-            vv_range_first[i].emplace_back(itaux, vmem_thread[i].end());
-        }
+        pika::when_all(execution::bulk_async_execute(
+                           exec,
+                           [&, this](std::uint32_t i) {
+                               Iter* b = bounds.data() + i * stride;
+                               b[0] = vmem_thread[i].begin();
+                               for (std::uint32_t k = 0; k < nintervals - 1;
+                                    ++k)
+                               {
+                                   b[k + 1] = std::upper_bound(b[k],
+                                       vmem_thread[i].end(), *vmilestone[k],
+                                       comp);
+                               }
+                               b[nintervals] = vmem_thread[i].end();
+                           },
+                           shape))
+            .get();
 
         // Copy in buffer and creation of the final matrix of ranges
+        next_job.reset(new std::atomic<std::uint32_t>[nthreads]);
         vv_range_it.resize(nintervals);
         vv_range_buf.resize(nintervals);
         vrange_it_ini.reserve(nintervals);
@@ -362,12 +411,13 @@ namespace pika::parallel::detail {
 
             for (std::uint32_t i = 0; i < nthreads; ++i)
             {
-                size_t nelem_range = vv_range_first[i][k].size();
-                if (nelem_range != 0)
+                Iter const begin = bounds[i * stride + k];
+                Iter const end = bounds[i * stride + k + 1];
+                if (begin != end)
                 {
-                    vv_range_it[k].push_back(vv_range_first[i][k]);
+                    vv_range_it[k].emplace_back(begin, end);
                 }
-                nelem_interval += nelem_range;
+                nelem_interval += std::size_t(end - begin);
             }
 
             vrange_it_ini.emplace_back(it, it + nelem_interval);
@@ -383,12 +433,13 @@ namespace pika::parallel::detail {
         typename Value>
     void sample_sort(Exec&& exec, Iter first, Sent last, Compare&& comp,
         std::uint32_t num_threads, Value* paux, std::size_t naux,
-        std::size_t chunk_size)
+        std::size_t chunk_size, util::temporary_buffer_arena* arena = nullptr)
     {
         using sample_sort_helper_t =
             sample_sort_helper<Iter, Sent, std::decay_t<Compare>>;
 
-        sample_sort_helper_t sorter(PIKA_FORWARD(Compare, comp), num_threads);
+        sample_sort_helper_t sorter(
+            PIKA_FORWARD(Compare, comp), num_threads, arena);
         sorter(PIKA_FORWARD(Exec, exec), first, last, paux, naux, chunk_size);
     }
 
@@ -400,7 +451,7 @@ namespace pika::parallel::detail {
 
         return sample_sort(PIKA_FORWARD(Exec, exec), first, last,
             PIKA_FORWARD(Compare, comp), num_threads, (value_type*) nullptr,
-            std::size_t(0), std::size_t(sample_sort_limit_per_task));
+            std::size_t(0), sample_sort_limit_per_task());
     }
 
     template <typename Exec, typename Iter, typename Sent, typename Compare>
@@ -412,7 +463,7 @@ namespace pika::parallel::detail {
     {
         if (chunk_size == 0)
         {
-            chunk_size = sample_sort_limit_per_task;
+            chunk_size = sample_sort_limit_per_task();
         }
 
         return sample_sort(PIKA_FORWARD(Exec, exec), first, last,
@@ -429,7 +480,7 @@ namespace pika::parallel::detail {
 
         return sample_sort(PIKA_FORWARD(Exec, exec), first, last, compare{},
             num_threads, (value_type*) nullptr, std::size_t(0),
-            std::size_t(sample_sort_limit_per_task));
+            sample_sort_limit_per_task());
     }
 
     template <typename Exec, typename Iter, typename Sent>
@@ -441,6 +492,6 @@ namespace pika::parallel::detail {
         return sample_sort(PIKA_FORWARD(Exec, exec), first, last, compare{},
             (std::uint32_t) pika::threads::detail::hardware_concurrency(),
             (value_type*) nullptr, std::size_t(0),
-            std::size_t(sample_sort_limit_per_task));
+            sample_sort_limit_per_task());
     }
 }    // namespace pika::parallel::detail
@@ -0,0 +1,91 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The chunk kernels of inclusive_scan and exclusive_scan: scan count
+    // elements starting at first into dest, starting from init, and return
+    // the sum of init and all elements. The datapar policies provide
+    // vectorized overloads for arithmetic types.
+    template <typename ExPolicy>
+    struct sequential_inclusive_scan_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_inclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = PIKA_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+    template <typename ExPolicy>
+    struct sequential_exclusive_scan_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_exclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = PIKA_INVOKE(op, init, *first);
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_inclusive_scan_n_t<ExPolicy>
+        sequential_inclusive_scan_n = sequential_inclusive_scan_n_t<ExPolicy>{};
+
+    template <typename ExPolicy>
+    inline constexpr sequential_exclusive_scan_n_t<ExPolicy>
+        sequential_exclusive_scan_n = sequential_exclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T sequential_inclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_inclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, PIKA_MOVE(init), PIKA_FORWARD(Op, op));
+    }
+
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T sequential_exclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_exclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, PIKA_MOVE(init), PIKA_FORWARD(Op, op));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -11,7 +11,9 @@
 
 #include <pika/config.hpp>
 #include <pika/algorithms/traits/projected.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
@@ -19,7 +21,9 @@
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/searchers.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -28,6 +32,97 @@
 
 namespace pika::parallel::detail {
     /// \cond NOINTERNAL
+    ///////////////////////////////////////////////////////////////////////////
+    // The chunk kernel of search and search_n: return the offset of the first
+    // of the count candidate positions at which the s_count elements starting
+    // at s_first are found, or count if there is none. The s_count - 1
+    // elements following the last candidate have to be valid. The datapar
+    // policies provide vectorized overloads for arithmetic types.
+    template <typename ExPolicy>
+    struct sequential_search_n_t
+      : pika::functional::detail::tag_fallback<sequential_search_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename F, typename Proj1,
+            typename Proj2>
+        friend constexpr std::size_t tag_fallback_invoke(
+            sequential_search_n_t<ExPolicy>, Iter1 first, std::size_t count,
+            Iter2 s_first, std::size_t s_count, F&& f, Proj1&& proj1,
+            Proj2&& proj2)
+        {
+            for (std::size_t i = 0; i != count; (void) ++i, ++first)
+            {
+                Iter1 it1 = first;
+                Iter2 it2 = s_first;
+                std::size_t matched = 0;
+                for (/**/; matched != s_count; (void) ++matched, ++it1, ++it2)
+                {
+                    if (!PIKA_INVOKE(f, PIKA_INVOKE(proj1, *it1),
+                            PIKA_INVOKE(proj2, *it2)))
+                    {
+                        break;
+                    }
+                }
+                if (matched == s_count)
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_search_n_t<ExPolicy> sequential_search_n =
+        sequential_search_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t sequential_search_n(
+        Iter1 first, std::size_t count, Iter2 s_first, std::size_t s_count,
+        F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_search_n_t<ExPolicy>{}(first, count, s_first,
+            s_count, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+            PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    // The number of candidate positions a partition examines between two
+    // checks of the cancellation token.
+    inline constexpr std::size_t search_block_size = 512;
+
+    // Search the count candidate positions of a partition starting at
+    // base_idx in blocks and record the first match in tok.
+    template <typename ExPolicy, typename FwdIter, typename Token,
+        typename FwdIter2, typename F, typename Proj1, typename Proj2>
+    void search_partition(FwdIter it, std::size_t count, std::size_t base_idx,
+        Token& tok, FwdIter2 s_first, std::size_t s_count, F& f, Proj1& proj1,
+        Proj2& proj2)
+    {
+        for (std::size_t offset = 0; offset != count; /**/)
+        {
+            if (tok.was_cancelled(base_idx + offset))
+            {
+                break;
+            }
+
+            std::size_t const len =
+                (std::min)(search_block_size, count - offset);
+            std::size_t const found = sequential_search_n<ExPolicy>(
+                it, len, s_first, s_count, f, proj1, proj2);
+            if (found != len)
+            {
+                tok.cancel(base_idx + offset + found);
+                break;
+            }
+
+            std::advance(it, len);
+            offset += len;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // search
     template <typename FwdIter, typename Sent>
@@ -44,6 +139,24 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, FwdIter first, Sent last, FwdIter2 s_first,
             Sent2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
         {
+            if constexpr (is_sized_range_v<FwdIter, Sent> &&
+                is_sized_range_v<FwdIter2, Sent2>)
+            {
+                std::size_t const s_count = (distance) (s_first, s_last);
+                if (s_count == 0)
+                    return first;
+
+                std::size_t const count = (distance) (first, last);
+                if (s_count > count)
+                    return std::next(first, count);
+
+                std::size_t const candidates = count - (s_count - 1);
+                std::size_t const found =
+                    sequential_search_n<std::decay_t<ExPolicy>>(first,
+                        candidates, s_first, s_count, op, proj1, proj2);
+                return std::next(first, found == candidates ? count : found);
+            }
+
             for (;; ++first)
             {
                 FwdIter it1 = first;
@@ -66,8 +179,6 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, FwdIter2 s_first,
             Sent2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
         {
-            using reference = typename std::iterator_traits<FwdIter>::reference;
-
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
 
@@ -92,40 +203,13 @@ namespace pika::parallel::detail {
             pika::parallel::util::cancellation_token<difference_type> tok(
                 count);
 
-            auto f1 = [diff, count, tok, s_first, op = PIKA_FORWARD(Pred, op),
+            auto f1 = [diff, tok, s_first, op = PIKA_FORWARD(Pred, op),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size, tok,
-                    [diff, count, s_first, &tok, &curr,
-                        op = PIKA_FORWARD(Pred, op),
-                        proj1 = PIKA_FORWARD(Proj1, proj1),
-                        proj2 = PIKA_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (PIKA_INVOKE(op, PIKA_INVOKE(proj1, v),
-                                PIKA_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0;
-                                 local_count != diff && len != count;
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!PIKA_INVOKE(op, PIKA_INVOKE(proj1, *mid),
-                                        PIKA_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                search_partition<std::decay_t<ExPolicy>>(it, part_size,
+                    base_idx, tok, s_first, diff, op, proj1, proj2);
             };
 
             auto f2 =
@@ -163,8 +247,17 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, FwdIter first, std::size_t count, FwdIter2 s_first,
             FwdIter2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
         {
-            return std::search(first, std::next(first, count), s_first, s_last,
-                compare_projected<Pred&, Proj1&, Proj2&>(op, proj1, proj2));
+            std::size_t const s_count = std::distance(s_first, s_last);
+            if (s_count == 0)
+                return first;
+            if (s_count > count)
+                return std::next(first, count);
+
+            std::size_t const candidates = count - (s_count - 1);
+            std::size_t const found =
+                sequential_search_n<std::decay_t<ExPolicy>>(first, candidates,
+                    s_first, s_count, op, proj1, proj2);
+            return std::next(first, found == candidates ? count : found);
         }
 
         template <typename ExPolicy, typename FwdIter2, typename Pred,
@@ -174,7 +267,6 @@ namespace pika::parallel::detail {
             FwdIter2 s_first, FwdIter2 s_last, Pred&& op, Proj1&& proj1,
             Proj2&& proj2)
         {
-            using reference = typename std::iterator_traits<FwdIter>::reference;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
             using s_difference_type =
@@ -190,40 +282,13 @@ namespace pika::parallel::detail {
 
             util::cancellation_token<difference_type> tok(count);
 
-            auto f1 = [count, diff, tok, s_first, op = PIKA_FORWARD(Pred, op),
+            auto f1 = [diff, tok, s_first, op = PIKA_FORWARD(Pred, op),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter curr = it;
-
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size, tok,
-                    [count, diff, s_first, &tok, &curr,
-                        op = PIKA_FORWARD(Pred, op),
-                        proj1 = PIKA_FORWARD(Proj1, proj1),
-                        proj2 = PIKA_FORWARD(Proj2, proj2)](
-                        reference v, std::size_t i) -> void {
-                        ++curr;
-                        if (PIKA_INVOKE(op, PIKA_INVOKE(proj1, v),
-                                PIKA_INVOKE(proj2, *s_first)))
-                        {
-                            difference_type local_count = 1;
-                            FwdIter2 needle = s_first;
-                            FwdIter mid = curr;
-
-                            for (difference_type len = 0; local_count != diff &&
-                                 len != difference_type(count);
-                                 ++local_count, ++len, ++mid)
-                            {
-                                if (!PIKA_INVOKE(op, PIKA_INVOKE(proj1, *mid),
-                                        PIKA_INVOKE(proj2, *++needle)))
-                                    break;
-                            }
-
-                            if (local_count == diff)
-                                tok.cancel(i);
-                        }
-                    });
+                search_partition<std::decay_t<ExPolicy>>(it, part_size,
+                    base_idx, tok, s_first, diff, op, proj1, proj2);
             };
 
             auto f2 =
@@ -242,5 +307,116 @@ namespace pika::parallel::detail {
                 PIKA_MOVE(f1), PIKA_MOVE(f2));
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of candidate positions a partition hands to a searcher at
+    // once. Searchers skip over most of the candidates, the blocks are larger
+    // than the ones examined by search_partition.
+    inline constexpr std::size_t searcher_block_size = 16384;
+
+    // Search the count candidate positions of a partition starting at
+    // base_idx with the searcher in blocks and record the first match in tok.
+    template <typename Iter, typename Token, typename Searcher>
+    void searcher_partition(Iter it, std::size_t count, std::size_t base_idx,
+        Token& tok, Searcher const& searcher, std::size_t s_count)
+    {
+        for (std::size_t offset = 0; offset != count; /**/)
+        {
+            if (tok.was_cancelled(base_idx + offset))
+            {
+                break;
+            }
+
+            std::size_t const len =
+                (std::min)(searcher_block_size, count - offset);
+            Iter const window_last = std::next(it, len + s_count - 1);
+            Iter const found = searcher(it, window_last).first;
+            if (found != window_last)
+            {
+                tok.cancel(base_idx + offset +
+                    static_cast<std::size_t>(std::distance(it, found)));
+                break;
+            }
+
+            std::advance(it, len);
+            offset += len;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // search and search_n with a searcher object, not_found is returned if
+    // the pattern does not occur in [first, last)
+    template <typename FwdIter>
+    struct search_searcher
+      : public algorithm<search_searcher<FwdIter>, FwdIter>
+    {
+        search_searcher()
+          : search_searcher::algorithm("search")
+        {
+        }
+
+        template <typename ExPolicy, typename Searcher>
+        static FwdIter sequential(ExPolicy, FwdIter first, FwdIter last,
+            Searcher const& searcher, FwdIter not_found)
+        {
+            auto const found = searcher(first, last);
+            if (found.first == last && found.second == last)
+                return not_found;
+            return found.first;
+        }
+
+        template <typename ExPolicy, typename Searcher>
+        static typename algorithm_result<ExPolicy, FwdIter>::type
+        parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+            Searcher const& searcher, FwdIter not_found)
+        {
+            using result = algorithm_result<ExPolicy, FwdIter>;
+
+            if constexpr (!pika::detail::is_parallel_searcher_v<Searcher>)
+            {
+                // the sequence can't be split without knowing the length of
+                // the pattern
+                return result::get(
+                    sequential(policy, first, last, searcher, not_found));
+            }
+            else
+            {
+                using difference_type =
+                    typename std::iterator_traits<FwdIter>::difference_type;
+
+                std::size_t const s_count = searcher.pattern_size();
+                if (s_count == 0)
+                    return result::get(PIKA_MOVE(first));
+
+                std::size_t const count = std::distance(first, last);
+                if (s_count > count)
+                    return result::get(PIKA_MOVE(not_found));
+
+                util::cancellation_token<difference_type> tok(
+                    static_cast<difference_type>(count));
+
+                auto f1 = [tok, searcher, s_count](FwdIter it,
+                              std::size_t part_size,
+                              std::size_t base_idx) mutable -> void {
+                    searcher_partition(
+                        it, part_size, base_idx, tok, searcher, s_count);
+                };
+
+                auto f2 = [=](std::vector<pika::future<void>>&& data) mutable
+                    -> FwdIter {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+                    difference_type const search_res = tok.get_data();
+                    if (search_res == static_cast<difference_type>(count))
+                        return not_found;
+                    return std::next(first, search_res);
+                };
+                return partitioner<ExPolicy, FwdIter, void>::call_with_index(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    count - (s_count - 1), 1, PIKA_MOVE(f1), PIKA_MOVE(f2));
+            }
+        }
+    };
     /// \endcond
 }    // namespace pika::parallel::detail
@@ -9,18 +9,21 @@
 #include <pika/config.hpp>
 #include <pika/assert.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
 
 #include <pika/execution/executors/execution_information.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/merge_path.hpp>
 #include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/partitioner.hpp>
-#include <pika/type_support/unused.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -29,184 +32,281 @@
 namespace pika::parallel::detail {
     /// \cond NOINTERNAL
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // Output iterator counting the elements assigned through it, the elements
+    // themselves are dropped. The first pass of set_operation runs the
+    // set operation of every chunk on it to find where the chunk's output
+    // goes.
+    struct set_operation_counter
     {
-        template <typename T>
-        class rewritable_ref
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        set_operation_counter& operator*() noexcept
         {
-        public:
-            constexpr rewritable_ref()
-              : item_(0)
-            {
-            }
-            constexpr rewritable_ref(T const& item)
-              : item_(item)
-            {
-            }
+            return *this;
+        }
 
-            rewritable_ref& operator=(T const& item)
-            {
-                item_ = &item;
-                return *this;
-            }
+        template <typename T>
+        set_operation_counter& operator=(T const&) noexcept
+        {
+            return *this;
+        }
 
-            // different versions of clang-format produce different results
-            // clang-format off
-            operator T const&() const
-            {
-                PIKA_ASSERT(item_ != 0);
-                return *item_;
-            }
-            // clang-format on
+        set_operation_counter& operator++() noexcept
+        {
+            ++count;
+            return *this;
+        }
 
-        private:
-            T const* item_;
-        };
+        set_operation_counter operator++(int) noexcept
+        {
+            set_operation_counter tmp = *this;
+            ++count;
+            return tmp;
+        }
 
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
-        using type =
-            typename std::conditional<std::is_scalar<value_type>::value,
-                value_type, rewritable_ref<value_type>>::type;
+        std::size_t count = 0;
     };
 
     struct set_chunk_data
     {
-        std::size_t start = std::size_t(-1);
-        std::size_t len = std::size_t(-1);
-        std::size_t start_index = std::size_t(-1);
-        std::size_t first1 = std::size_t(-1);
-        std::size_t first2 = std::size_t(-1);
+        std::size_t start1 = 0;
+        std::size_t start2 = 0;
+        std::size_t end1 = 0;
+        std::size_t end2 = 0;
+        std::size_t len = 0;
+        std::size_t start_index = 0;
+        std::size_t first1 = 0;
+        std::size_t first2 = 0;
     };
 
+    // the minimal number of input elements handled by one chunk
+    inline constexpr std::size_t set_operation_min_chunk_size = 4096ul;
+
+    // Sequences whose lengths differ at least by this factor are skewed, the
+    // set operations search for the elements of the shorter sequence in the
+    // longer one by galloping instead of stepping through both.
+    inline constexpr std::size_t set_operation_gallop_ratio = 32ul;
+
+    // the minimal number of elements of the shorter sequence handled by one
+    // chunk if the set operation gallops
+    inline constexpr std::size_t set_operation_gallop_min_chunk_size = 256ul;
+
+    inline constexpr bool set_operation_skewed(
+        std::size_t len1, std::size_t len2) noexcept
+    {
+        return (std::min)(len1, len2) * set_operation_gallop_ratio <=
+            (std::max)(len1, len2);
+    }
+
+    // The set operations gallop through random access sequences only.
+    template <typename Iter1, typename Sent1, typename Iter2, typename Sent2>
+    inline constexpr bool set_operation_can_gallop_v =
+        std::is_same_v<Iter1, Sent1> && std::is_same_v<Iter2, Sent2> &&
+        pika::traits::is_random_access_iterator_v<Iter1> &&
+        pika::traits::is_random_access_iterator_v<Iter2>;
+
+    // Which of the sequences of a skewed set operation are split into
+    // chunks of the same size, the other sequence is split at the same
+    // values. The work of set operations that gallop depends on the length
+    // of the shorter sequence only (intersection), or on the length of the
+    // first one if that is the shorter one (difference).
+    enum class set_operation_gallop
+    {
+        none,
+        shorter_sequence,
+        first_sequence,
+    };
+
+    // Return the positions in both sequences where the chunk starting at
+    // the k-th element of the merged sequence begins. The split found along
+    // the merge path is moved back to the first element equivalent to the
+    // k-th element, elements comparing equal are never split between
+    // chunks.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_split(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t k, F& f,
+        Proj1& proj1, Proj2& proj2)
+    {
+        if (k == 0)
+        {
+            return {0, 0};
+        }
+        if (k >= len1 + len2)
+        {
+            return {len1, len2};
+        }
+
+        std::size_t const i =
+            merge_path_split(first1, len1, first2, len2, k, f, proj1, proj2);
+        std::size_t const j = k - i;
+
+        auto split_at = [&](auto const& value) {
+            std::size_t const start1 =
+                detail::lower_bound(first1, first1 + i, value, f, proj1) -
+                first1;
+            std::size_t const start2 =
+                detail::lower_bound(first2, first2 + j, value, f, proj2) -
+                first2;
+            return std::make_pair(start1, start2);
+        };
+
+        // the k-th element comes from the first sequence unless the second
+        // one holds a smaller element
+        if (j == len2 ||
+            (i != len1 &&
+                !PIKA_INVOKE(f, PIKA_INVOKE(proj2, first2[j]),
+                    PIKA_INVOKE(proj1, first1[i]))))
+        {
+            return split_at(PIKA_INVOKE(proj1, first1[i]));
+        }
+        return split_at(PIKA_INVOKE(proj2, first2[j]));
+    }
+
+    // Return the positions in both sequences where the chunk starting at
+    // the k-th element of the first sequence begins, moved back to the first
+    // element equivalent to it.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_split_first(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t k, F& f,
+        Proj1& proj1, Proj2& proj2)
+    {
+        if (k == 0)
+        {
+            return {0, 0};
+        }
+        if (k >= len1)
+        {
+            return {len1, len2};
+        }
+
+        auto&& value = PIKA_INVOKE(proj1, first1[k]);
+        std::size_t const start1 =
+            detail::lower_bound(first1, first1 + k, value, f, proj1) - first1;
+        std::size_t const start2 =
+            detail::lower_bound(first2, first2 + len2, value, f, proj2) -
+            first2;
+        return {start1, start2};
+    }
+
     ///////////////////////////////////////////////////////////////////////////
+    // The merged index space of both sequences is split into chunks along
+    // the merge path, so that skewed inputs still produce chunks of the same
+    // size. If the lengths are skewed and the set operation gallops, the
+    // shorter sequence is split into chunks of the same size instead. The set operation runs twice for every chunk: the first pass
+    // only counts its output elements, the second one writes them directly
+    // to their place in the destination range.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename F, typename Proj1,
-        typename Proj2, typename Combiner, typename SetOp>
+        typename Proj2, typename SetOp>
     typename algorithm_result<ExPolicy,
         in_in_out_result<Iter1, Iter2, Iter3>>::type
     set_operation(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2,
-        Combiner&& combiner, SetOp&& setop)
+        SetOp&& setop,
+        set_operation_gallop gallop = set_operation_gallop::none)
     {
         using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
 
-        using difference_type1 =
-            typename std::iterator_traits<Iter1>::difference_type;
-        using difference_type2 =
-            typename std::iterator_traits<Iter2>::difference_type;
+        std::size_t const len1 = (distance) (first1, last1);
+        std::size_t const len2 = (distance) (first2, last2);
+        std::size_t const count = len1 + len2;
 
-        // allocate intermediate buffers
-        difference_type1 len1 = (distance) (first1, last1);
-        difference_type2 len2 = (distance) (first2, last2);
+        bool const skewed = gallop != set_operation_gallop::none &&
+            set_operation_skewed(len1, len2);
+        bool const split_first = skewed && len1 < len2;
+        bool const split_second = skewed && len2 < len1 &&
+            gallop == set_operation_gallop::shorter_sequence;
 
-        using buffer_type = typename set_operations_buffer<Iter3>::type;
+        std::size_t split_count = count;
+        std::size_t min_chunk_size = set_operation_min_chunk_size;
+        if (split_first || split_second)
+        {
+            split_count = split_first ? len1 : len2;
+            min_chunk_size = set_operation_gallop_min_chunk_size;
+        }
 
-        std::size_t cores = execution::processing_units_count(
+        std::size_t const cores = execution::processing_units_count(
             policy.parameters(), policy.executor());
-
-        std::size_t step = (len1 + cores - 1) / cores;
-
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
-        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
-
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t part_size) mutable -> void {
-            PIKA_ASSERT(part_size == 1);
-            PIKA_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 = (std::min)(start1 + step, std::size_t(len1));
-
-            if (start1 >= end1)
-            {
-                return;
-            }
-
-            bool first_partition = (start1 == 0);
-            bool last_partition = (end1 == std::size_t(len1));
-
-            auto start_value = PIKA_INVOKE(proj1, first1[start1]);
-            auto end_value = PIKA_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all
-                // elements of this partition are equal
-                if (!PIKA_INVOKE(f, start_value, end_value))
+        std::size_t num_chunks = (std::max)(std::size_t(1),
+            (std::min)(4 * cores,
+                (split_count + min_chunk_size - 1) / min_chunk_size));
+
+        // the sequences are not split if the data of the chunks would
+        // exceed the scratch memory budget, the data are released from
+        // the budget with the last copy of them
+        util::detail::scratch_memory_reservation reservation(
+            policy.parameters(), num_chunks * sizeof(set_chunk_data));
+        if (!reservation)
+        {
+            num_chunks = 1;
+            reservation = util::detail::scratch_memory_reservation(
+                policy.parameters(), sizeof(set_chunk_data), false);
+        }
+
+        std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[num_chunks],
+            [usage = reservation.detach(), bytes = reservation.bytes()](
+                set_chunk_data* p) {
+                delete[] p;
+                if (usage != nullptr)
                 {
-                    return;
+                    usage->release(bytes);
                 }
+            });
 
-                // move backwards to find earliest element which is equal to
-                // the last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = PIKA_INVOKE(proj1, first1[end1 - 1]);
+        // first step, find the input and count the output of every chunk
+        auto f1 = [=](set_chunk_data* part_begin,
+                      std::size_t part_size) mutable -> void {
+            for (/**/; part_size != 0; --part_size, ++part_begin)
+            {
+                set_chunk_data* curr_chunk = part_begin;
+                std::size_t const chunk = curr_chunk - chunks.get();
 
-                    while (
-                        !PIKA_INVOKE(f, end_value1, end_value) && --end1 != 0)
+                auto split = [&](std::size_t k) {
+                    if (split_first)
                     {
-                        end_value = PIKA_MOVE(end_value1);
-                        end_value1 = PIKA_INVOKE(proj1, first1[end1 - 1]);
+                        return set_operation_split_first(
+                            first1, len1, first2, len2, k, f, proj1, proj2);
                     }
-                }
-            }
-
-            // move backwards to find earliest element which is equal to
-            // the first element of the current chunk
-            if (start1 != 0)
-            {
-                auto start_value1 = PIKA_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !PIKA_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = PIKA_MOVE(start_value1);
-                    start_value1 = PIKA_INVOKE(proj1, first1[start1 - 1]);
-                }
-            }
-
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
-            {
-                start2 =
-                    lower_bound(first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
-
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = lower_bound(first2 + start2, first2 + len2, end_value, f,
-                           proj2) -
-                    first2;
+                    if (split_second)
+                    {
+                        auto result = set_operation_split_first(
+                            first2, len2, first1, len1, k, f, proj2, proj1);
+                        return std::make_pair(result.second, result.first);
+                    }
+                    return set_operation_split(
+                        first1, len1, first2, len2, k, f, proj1, proj2);
+                };
+
+                auto start = split(chunk * split_count / num_chunks);
+                auto end = split((chunk + 1) * split_count / num_chunks);
+
+                curr_chunk->start1 = start.first;
+                curr_chunk->start2 = start.second;
+                curr_chunk->end1 = end.first;
+                curr_chunk->end2 = end.second;
+
+                auto op_result = setop(first1 + start.first,
+                    first1 + end.first, first2 + start.second,
+                    first2 + end.second, set_operation_counter{}, f);
+                curr_chunk->first1 = op_result.in1 - first1;
+                curr_chunk->first2 = op_result.in2 - first2;
+                curr_chunk->len = op_result.out.count;
             }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
         };
 
         // second step, is executed after all partitions are done running
-
-        // different versions of clang-format produce different formatting
-        // clang-format off
-        auto f2 = [buffer, chunks, cores, first1, first2, dest](
-                      std::vector<future<void>>&& data) -> result_type {
-            // clang-format on
-
+        auto f2 = [policy = policy(pika::execution::non_task), chunks,
+                      num_chunks, first1, first2, dest,
+                      f = PIKA_FORWARD(F, f),
+                      setop = PIKA_FORWARD(SetOp, setop)](
+                      std::vector<future<void>>&& data) mutable
+            -> result_type {
             // make sure iterators embedded in function object that is
             // attached to futures are invalidated
             data.clear();
@@ -214,48 +314,42 @@ namespace pika::parallel::detail {
             // accumulate real length and rightmost positions in input sequences
             std::size_t first1_pos = 0;
             std::size_t first2_pos = 0;
-
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
+            std::size_t start_index = 0;
+            for (std::size_t i = 0; i != num_chunks; ++i)
             {
-                set_chunk_data* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != std::size_t(-1))
-                {
-                    first1_pos = (std::max)(first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != std::size_t(-1))
-                {
-                    first2_pos = (std::max)(first2_pos, curr_chunk->first2);
-                }
+                set_chunk_data& chunk = chunks[i];
+                chunk.start_index = start_index;
+                start_index += chunk.len;
+                first1_pos = (std::max)(first1_pos, chunk.first1);
+                first2_pos = (std::max)(first2_pos, chunk.first2);
             }
 
-            // finally, copy data to destination
-            foreach_partitioner<pika::execution::parallel_policy>::call(
-                pika::execution::par, chunks.get(), cores,
-                [buffer, dest](
-                    set_chunk_data* chunk, std::size_t, std::size_t) {
-                    if (chunk->start == std::size_t(-1) ||
-                        chunk->start_index == std::size_t(-1) ||
-                        chunk->len == std::size_t(-1))
+            // finally, write the output of every chunk to its destination
+            using policy_type = std::decay_t<decltype(policy)>;
+            foreach_partitioner<policy_type>::call(
+                policy, chunks.get(), num_chunks,
+                [&](set_chunk_data* part_begin, std::size_t part_size,
+                    std::size_t) {
+                    for (/**/; part_size != 0; --part_size, ++part_begin)
                     {
-                        return;
+                        set_chunk_data const& chunk = *part_begin;
+                        if (chunk.len != 0)
+                        {
+                            setop(first1 + chunk.start1, first1 + chunk.end1,
+                                first2 + chunk.start2, first2 + chunk.end2,
+                                std::next(dest, chunk.start_index), f);
+                        }
                     }
-                    std::copy(buffer.get() + chunk->start,
-                        buffer.get() + chunk->start + chunk->len,
-                        dest + chunk->start_index);
                 },
                 [](set_chunk_data* last) -> set_chunk_data* { return last; });
 
             return {std::next(first1, first1_pos),
-                std::next(first2, first2_pos),
-                std::next(dest, chunk->start_index + chunk->len)};
+                std::next(first2, first2_pos), std::next(dest, start_index)};
         };
 
-        // fill the buffer piecewise
         return partitioner<ExPolicy, result_type, void>::call(
-            policy, chunks.get(), cores, PIKA_MOVE(f1), PIKA_MOVE(f2));
+            PIKA_FORWARD(ExPolicy, policy), chunks.get(), num_chunks,
+            PIKA_MOVE(f1), PIKA_MOVE(f2));
     }
     /// \endcond
 }    // namespace pika::parallel::detail
@@ -0,0 +1,256 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The networks are generated by Batcher's merge exchange (Knuth, The Art of
+// Computer Programming, Vol. 3, Algorithm 5.2.2M), which works for an
+// arbitrary number of elements.
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <pika/parallel/algorithms/detail/insertion_sort.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/compare_projected.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // the largest number of elements sorted by a sorting network
+    inline constexpr std::size_t sorting_network_limit = 32;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The comparators which are known to compare arithmetic values without
+    // side effects, for those the compare-exchange operations of a sorting
+    // network can be done without branches.
+    template <typename Comp>
+    struct sorting_network_comparison : std::false_type
+    {
+    };
+
+    template <>
+    struct sorting_network_comparison<less> : std::true_type
+    {
+    };
+
+    template <>
+    struct sorting_network_comparison<greater> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct sorting_network_comparison<std::less<T>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct sorting_network_comparison<std::greater<T>> : std::true_type
+    {
+    };
+
+    template <typename Comp, typename Proj>
+    struct sorting_network_comparison<compare_projected<Comp, Proj>>
+      : std::integral_constant<bool,
+            std::is_same_v<std::decay_t<Proj>, projection_identity> &&
+                sorting_network_comparison<std::decay_t<Comp>>::value>
+    {
+    };
+
+    template <typename Iter, typename Comp>
+    inline constexpr bool use_sorting_network_v =
+        std::is_arithmetic_v<typename std::iterator_traits<Iter>::value_type> &&
+        sorting_network_comparison<std::decay_t<Comp>>::value;
+
+    // A sorting network does not preserve the order of equal elements, which
+    // does not matter if equal elements can't be told apart. That is not
+    // true for floating point values (-0.0 and 0.0 are equal).
+    template <typename Iter, typename Comp>
+    inline constexpr bool use_stable_sorting_network_v =
+        use_sorting_network_v<Iter, Comp> &&
+        std::is_integral_v<typename std::iterator_traits<Iter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sorting_network_comparator
+    {
+        std::uint8_t first;
+        std::uint8_t second;
+    };
+
+    // Invokes f(i, j) for all comparators of the network for n elements
+    template <typename F>
+    constexpr void sorting_network_merge_exchange(std::size_t n, F&& f)
+    {
+        if (n < 2)
+        {
+            return;
+        }
+
+        std::size_t t = 0;
+        while ((std::size_t(1) << t) < n)
+        {
+            ++t;
+        }
+
+        for (std::size_t p = std::size_t(1) << (t - 1); p > 0; p >>= 1)
+        {
+            std::size_t q = std::size_t(1) << (t - 1);
+            std::size_t r = 0;
+            std::size_t d = p;
+            while (true)
+            {
+                for (std::size_t i = 0; i + d < n; ++i)
+                {
+                    if ((i & p) == r)
+                    {
+                        f(i, i + d);
+                    }
+                }
+                if (q == p)
+                {
+                    break;
+                }
+                d = q - p;
+                q >>= 1;
+                r = p;
+            }
+        }
+    }
+
+    template <std::size_t N>
+    constexpr std::size_t sorting_network_size()
+    {
+        std::size_t size = 0;
+        sorting_network_merge_exchange(
+            N, [&size](std::size_t, std::size_t) { ++size; });
+        return size;
+    }
+
+    template <std::size_t N>
+    constexpr std::array<sorting_network_comparator, sorting_network_size<N>()>
+    make_sorting_network()
+    {
+        std::array<sorting_network_comparator, sorting_network_size<N>()>
+            network{};
+        std::size_t k = 0;
+        sorting_network_merge_exchange(
+            N, [&network, &k](std::size_t i, std::size_t j) {
+                network[k].first = std::uint8_t(i);
+                network[k].second = std::uint8_t(j);
+                ++k;
+            });
+        return network;
+    }
+
+    template <std::size_t N>
+    inline constexpr auto sorting_network = make_sorting_network<N>();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Orders a and b without branches, which allows the compiler to use
+    // conditional moves or min/max instructions
+    template <typename T, typename Comp>
+    PIKA_FORCEINLINE void sorting_network_exchange(T& a, T& b, Comp& comp)
+    {
+        T const x = a;
+        T const y = b;
+        bool const swap = comp(y, x);
+        a = swap ? y : x;
+        b = swap ? x : y;
+    }
+
+    template <std::size_t N, typename T, typename Comp, std::size_t... Is>
+    PIKA_FORCEINLINE void sorting_network_apply(
+        T* values, Comp& comp, std::index_sequence<Is...>)
+    {
+        (sorting_network_exchange(values[sorting_network<N>[Is].first],
+             values[sorting_network<N>[Is].second], comp),
+            ...);
+    }
+
+    template <std::size_t N, typename Iter, typename Comp>
+    void sorting_network_sort_n(Iter first, Comp& comp)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        value_type values[N];
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            values[i] = first[i];
+        }
+
+        sorting_network_apply<N>(values, comp,
+            std::make_index_sequence<sorting_network<N>.size()>());
+
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            first[i] = values[i];
+        }
+    }
+
+    template <typename Iter, typename Comp, std::size_t... Is>
+    void sorting_network_sort(
+        Iter first, std::size_t n, Comp& comp, std::index_sequence<Is...>)
+    {
+        using sort_function = void (*)(Iter, Comp&);
+        static constexpr sort_function sort_functions[] = {
+            &sorting_network_sort_n<Is + 2, Iter, Comp>...};
+
+        sort_functions[n - 2](first, comp);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sorts the small range [first, last), using a sorting network for
+    // arithmetic values compared by one of the standard comparators and
+    // insertion sort otherwise.
+    template <typename Iter, typename Comp>
+    void small_sort(Iter first, Iter last, Comp& comp)
+    {
+        std::size_t const n = last - first;
+        if constexpr (use_sorting_network_v<Iter, Comp>)
+        {
+            if (n <= sorting_network_limit)
+            {
+                if (n > 1)
+                {
+                    sorting_network_sort(first, n, comp,
+                        std::make_index_sequence<sorting_network_limit - 1>());
+                }
+                return;
+            }
+        }
+        insertion_sort(first, last, comp);
+    }
+
+    // Sorts the small range [first, last) preserving the order of equal
+    // elements, the sorting network is used only if that order doesn't
+    // matter.
+    template <typename Iter, typename Comp>
+    void small_stable_sort(Iter first, Iter last, Comp& comp)
+    {
+        std::size_t const n = last - first;
+        if constexpr (use_stable_sorting_network_v<Iter, Comp>)
+        {
+            if (n <= sorting_network_limit)
+            {
+                if (n > 1)
+                {
+                    sorting_network_sort(first, n, comp,
+                        std::make_index_sequence<sorting_network_limit - 1>());
+                }
+                return;
+            }
+        }
+        insertion_sort(first, last, comp);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
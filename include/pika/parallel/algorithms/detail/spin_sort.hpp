@@ -8,10 +8,11 @@
 #pragma once
 
 #include <pika/assert.hpp>
-#include <pika/parallel/algorithms/detail/insertion_sort.hpp>
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
+#include <pika/parallel/algorithms/detail/sorting_network.hpp>
 #include <pika/parallel/util/nbits.hpp>
 #include <pika/parallel/util/range.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -30,7 +31,7 @@ namespace pika::parallel::detail {
     /// \param [in] r_input     range with the elements to sort
     /// \param [in] range_buf   range with the elements sorted
     /// \param [in] comp        object for to compare two elements
-    /// \param [in] level       when is 0, sort with the insertion_sort
+    /// \param [in] level       when is 0, sort with the small_stable_sort
     ///                         algorithm if not make a recursive call swapping
     ///                         the ranges
     /// \return range with all the elements sorted and moved
@@ -49,8 +50,8 @@ namespace pika::parallel::detail {
 
         if (level < 2)
         {
-            insertion_sort(rng_a1.begin(), rng_a1.end(), comp);
-            insertion_sort(rng_a2.begin(), rng_a2.end(), comp);
+            small_stable_sort(rng_a1.begin(), rng_a1.end(), comp);
+            small_stable_sort(rng_a2.begin(), rng_a2.end(), comp);
         }
         else
         {
@@ -79,6 +80,7 @@ namespace pika::parallel::detail {
 
         value_type* ptr;
         std::size_t nptr;
+        util::temporary_buffer_arena* arena;
         bool construct = false;
         bool owner = false;
 
@@ -86,14 +88,24 @@ namespace pika::parallel::detail {
         /// \param [in] R : range of elements to sort
         /// \param [in] comp : object for to compare two elements
         spin_sort_helper(Iter first, Sent last, Compare comp, value_type* paux,
-            std::size_t naux);
+            std::size_t naux, util::temporary_buffer_arena* arena);
 
     public:
         /// \brief constructor of the struct
         /// \param [in] r_input : range of elements to sort
         /// \param [in] comp : object for to Compare two elements
         spin_sort_helper(Iter first, Sent last, Compare comp = Compare())
-          : spin_sort_helper(first, last, comp, nullptr, 0)
+          : spin_sort_helper(first, last, comp, nullptr, 0, nullptr)
+        {
+        }
+
+        /// \brief constructor of the struct
+        /// \param [in] r_input : range of elements to sort
+        /// \param [in] comp : object for to Compare two elements
+        /// \param [in] arena : arena the temporary buffer is taken from
+        spin_sort_helper(Iter first, Sent last, Compare comp,
+            util::temporary_buffer_arena* arena)
+          : spin_sort_helper(first, last, comp, nullptr, 0, arena)
         {
         }
 
@@ -104,7 +116,7 @@ namespace pika::parallel::detail {
         spin_sort_helper(
             Iter first, Sent last, Compare comp, range_buf range_aux)
           : spin_sort_helper(first, last, comp, range_aux.begin(),
-                (std::size_t) range_aux.size())
+                (std::size_t) range_aux.size(), nullptr)
         {
         }
 
@@ -123,7 +135,7 @@ namespace pika::parallel::detail {
 
             if (owner)
             {
-                std::free(ptr);
+                util::detail::deallocate_temporary_buffer(ptr, arena);
             }
         }
     };    // End of class spin_sort_helper
@@ -132,10 +144,12 @@ namespace pika::parallel::detail {
     /// \param [in] r_input : range of elements to sort
     /// \param [in] comp : object for to Compare two elements
     template <typename Iter, typename Sent, typename Compare>
-    spin_sort_helper<Iter, Sent, Compare>::spin_sort_helper(
-        Iter first, Sent last, Compare comp, value_type* paux, std::size_t naux)
+    spin_sort_helper<Iter, Sent, Compare>::spin_sort_helper(Iter first,
+        Sent last, Compare comp, value_type* paux, std::size_t naux,
+        util::temporary_buffer_arena* arena)
       : ptr(paux)
       , nptr(naux)
+      , arena(arena)
       , construct(false)
       , owner(false)
     {
@@ -151,7 +165,7 @@ namespace pika::parallel::detail {
 
         if (nelem <= (sort_min << 1))
         {
-            insertion_sort(first, last, comp);
+            small_stable_sort(first, last, comp);
             return;
         }
 
@@ -162,11 +176,8 @@ namespace pika::parallel::detail {
         {
             // acquire uninitialized memory
             ptr = static_cast<value_type*>(
-                std::malloc(nptr * sizeof(value_type)));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+                util::detail::allocate_temporary_buffer(
+                    nptr * sizeof(value_type), arena));
             owner = true;
         }
 
@@ -226,6 +237,14 @@ namespace pika::parallel::detail {
             first, last, PIKA_FORWARD(Compare, comp));
     }
 
+    template <typename Iter, typename Sent, typename Compare>
+    void spin_sort(Iter first, Sent last, Compare&& comp,
+        util::temporary_buffer_arena* arena)
+    {
+        spin_sort_helper<Iter, Sent, std::decay_t<Compare>> sorter(
+            first, last, PIKA_FORWARD(Compare, comp), arena);
+    }
+
     template <typename Iter, typename Sent, typename Compare>
     void spin_sort(Iter first, Sent last, Compare&& comp,
         range<typename std::iterator_traits<Iter>::value_type*> range_aux)
@@ -239,6 +258,6 @@ namespace pika::parallel::detail {
         typename std::iterator_traits<Iter>::value_type* paux, std::size_t naux)
     {
         spin_sort_helper<Iter, Sent, std::decay_t<Compare>> sorter(
-            first, last, PIKA_FORWARD(Compare, comp), paux, naux);
+            first, last, PIKA_FORWARD(Compare, comp), paux, naux, nullptr);
     }
 }    // namespace pika::parallel::detail
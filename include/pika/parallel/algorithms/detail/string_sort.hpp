@@ -0,0 +1,407 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/invoke_result.hpp>
+#include <pika/synchronization/stop_token.hpp>
+
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/util/detail/fork_join.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The string sort engine is a multikey quicksort (Bentley and Sedgewick)
+    // of records caching eight characters of their key. The records are
+    // partitioned by the cached characters, the records with equal ones are
+    // sorted by the following eight characters, which are loaded once per
+    // record and level. The keys are only compared as a whole for small
+    // sections. The sorted records give the permutation applied to the
+    // elements afterwards, see apply_sort_index.
+    template <typename Key>
+    struct is_string_sort_key : std::false_type
+    {
+    };
+
+    template <typename Allocator>
+    struct is_string_sort_key<
+        std::basic_string<char, std::char_traits<char>, Allocator>>
+      : std::true_type
+    {
+    };
+
+    template <>
+    struct is_string_sort_key<std::string_view> : std::true_type
+    {
+    };
+
+    template <typename Comp, typename Key>
+    struct is_string_sort_order : std::false_type
+    {
+    };
+
+    template <typename Key>
+    struct is_string_sort_order<less, Key> : std::true_type
+    {
+    };
+
+    template <typename Key>
+    struct is_string_sort_order<std::less<>, Key> : std::true_type
+    {
+    };
+
+    template <typename Key>
+    struct is_string_sort_order<std::less<Key>, Key> : std::true_type
+    {
+    };
+
+    template <typename RandomIt, typename Proj>
+    using string_sort_key_t =
+        typename pika::util::detail::invoke_result<Proj&,
+            typename std::iterator_traits<RandomIt>::reference>::type;
+
+    // The records point to the characters of the keys, which therefore have
+    // to be part of the elements: the projection yields a reference to a
+    // string or a string_view.
+    template <typename RandomIt, typename Comp, typename Proj,
+        typename Key = string_sort_key_t<RandomIt, Proj>>
+    inline constexpr bool use_string_sort_v =
+        is_string_sort_key<std::decay_t<Key>>::value &&
+        (std::is_lvalue_reference_v<Key> ||
+            std::is_same_v<std::decay_t<Key>, std::string_view>) &&
+        is_string_sort_order<std::decay_t<Comp>, std::decay_t<Key>>::value &&
+        use_indirect_sort_v<RandomIt>;
+
+    // sequences shorter than this are sorted using the comparison based sort
+    static const std::size_t string_sort_limit = 4096ul;
+
+    // sections at most this long are sorted by comparing the keys
+    static const std::size_t string_sort_insertion_limit = 32ul;
+
+    // sections smaller than this are never partitioned in parallel
+    static const std::size_t string_sort_parallel_partition_limit = 1048576ul;
+
+    template <typename Iter>
+    struct string_sort_record
+    {
+        // the characters [depth, depth + 8) of the key, big endian, the
+        // characters past its end are '\0'
+        std::uint64_t cache;
+        char const* data;
+        std::size_t size;
+        Iter it;
+    };
+
+    inline std::uint64_t string_sort_cache(
+        char const* data, std::size_t size, std::size_t depth) noexcept
+    {
+        std::uint64_t cache = 0;
+        for (std::size_t i = depth; i != depth + 8; ++i)
+        {
+            cache <<= 8;
+            if (i < size)
+            {
+                cache |= static_cast<unsigned char>(data[i]);
+            }
+        }
+        return cache;
+    }
+
+    // Compares the keys of two records sharing their first depth characters.
+    // Equal keys are ordered by the position of their elements, which makes
+    // the engine stable.
+    template <typename Iter>
+    bool string_sort_less(string_sort_record<Iter> const& lhs,
+        string_sort_record<Iter> const& rhs, std::size_t depth) noexcept
+    {
+        if (lhs.cache != rhs.cache)
+        {
+            return lhs.cache < rhs.cache;
+        }
+
+        std::size_t const size = (std::min)(lhs.size, rhs.size);
+        if (size > depth)
+        {
+            if (int const result = std::memcmp(
+                    lhs.data + depth, rhs.data + depth, size - depth))
+            {
+                return result < 0;
+            }
+        }
+        if (lhs.size != rhs.size)
+        {
+            return lhs.size < rhs.size;
+        }
+        return lhs.it < rhs.it;
+    }
+
+    template <typename Iter>
+    std::uint64_t string_sort_pivot(
+        string_sort_record<Iter>* first, string_sort_record<Iter>* last)
+    {
+        std::uint64_t const a = first->cache;
+        std::uint64_t const b = first[(last - first) / 2].cache;
+        std::uint64_t const c = last[-1].cache;
+        return (std::max)((std::min)(a, b), (std::min)((std::max)(a, b), c));
+    }
+
+    // Partitions [first, last) into the records whose cache is smaller than,
+    // equal to and larger than the pivot.
+    template <typename Iter>
+    std::pair<string_sort_record<Iter>*, string_sort_record<Iter>*>
+    string_sort_partition3(string_sort_record<Iter>* first,
+        string_sort_record<Iter>* last, std::uint64_t pivot)
+    {
+        auto less_last = first;
+        auto greater_first = last;
+        for (auto it = first; it != greater_first; /**/)
+        {
+            if (it->cache < pivot)
+            {
+                std::swap(*less_last++, *it++);
+            }
+            else if (it->cache > pivot)
+            {
+                std::swap(*it, *--greater_first);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return {less_last, greater_first};
+    }
+
+    // Of records with equal caches, the ones whose key ends within the
+    // cached characters come first, ordered by size (the missing characters
+    // compare equal to '\0') and position. Returns the remaining records.
+    template <typename Iter>
+    string_sort_record<Iter>* string_sort_finish_equal(
+        string_sort_record<Iter>* first, string_sort_record<Iter>* last,
+        std::size_t depth)
+    {
+        auto rest = std::partition(first, last,
+            [depth](auto const& r) { return r.size <= depth + 8; });
+        std::sort(first, rest, [](auto const& lhs, auto const& rhs) {
+            return lhs.size < rhs.size ||
+                (lhs.size == rhs.size && lhs.it < rhs.it);
+        });
+        return rest;
+    }
+
+    template <typename Iter>
+    void string_sort_sequential(string_sort_record<Iter>* first,
+        string_sort_record<Iter>* last, std::size_t depth)
+    {
+        while (std::size_t(last - first) > string_sort_insertion_limit)
+        {
+            auto [less_last, greater_first] = string_sort_partition3(
+                first, last, string_sort_pivot(first, last));
+
+            string_sort_sequential(first, less_last, depth);
+            string_sort_sequential(greater_first, last, depth);
+
+            first = string_sort_finish_equal(less_last, greater_first, depth);
+            last = greater_first;
+            depth += 8;
+            for (auto it = first; it != last; ++it)
+            {
+                it->cache = string_sort_cache(it->data, it->size, depth);
+            }
+        }
+
+        for (auto it = first; it != last; ++it)
+        {
+            auto value = *it;
+            auto pos = it;
+            for (/**/; pos != first && string_sort_less(value, pos[-1], depth);
+                 --pos)
+            {
+                *pos = pos[-1];
+            }
+            *pos = value;
+        }
+    }
+
+    // The sections of at most chunk_size records are sorted sequentially,
+    // the larger ones fork for their three parts. The sections of the top
+    // levels of the recursion are partitioned in parallel.
+    template <typename ExPolicy, typename Iter>
+    void string_sort_thread(ExPolicy& policy, string_sort_record<Iter>* first,
+        string_sort_record<Iter>* last, std::size_t depth,
+        pika::stop_token const& stop, std::size_t chunk_size,
+        std::size_t parallel_partition_limit)
+    {
+        util::detail::throw_if_sort_stop_requested(stop);
+
+        std::size_t const count = last - first;
+        if (count <= chunk_size)
+        {
+            string_sort_sequential(first, last, depth);
+            return;
+        }
+
+        std::uint64_t const pivot = string_sort_pivot(first, last);
+        bool const parallel = count >= parallel_partition_limit;
+
+        string_sort_record<Iter>* less_last;
+        string_sort_record<Iter>* greater_first;
+        if (parallel)
+        {
+            std::tie(less_last, greater_first) = partition_helper::call3(
+                policy, first, last,
+                [pivot](auto const& r) { return r.cache < pivot; },
+                [pivot](auto const& r) { return r.cache == pivot; },
+                projection_identity{});
+        }
+        else
+        {
+            std::tie(less_last, greater_first) =
+                string_sort_partition3(first, last, pivot);
+        }
+
+        auto sort_equal = [&]() {
+            auto rest =
+                string_sort_finish_equal(less_last, greater_first, depth);
+            std::size_t const rest_count = greater_first - rest;
+            std::size_t const num_chunks = parallel ?
+                (std::max)(std::size_t(1), rest_count / chunk_size) :
+                1;
+            run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+                auto it = rest + chunk * rest_count / num_chunks;
+                auto const end = rest + (chunk + 1) * rest_count / num_chunks;
+                for (/**/; it != end; ++it)
+                {
+                    it->cache =
+                        string_sort_cache(it->data, it->size, depth + 8);
+                }
+            });
+            string_sort_thread(policy, rest, greater_first, depth + 8, stop,
+                chunk_size, parallel_partition_limit);
+        };
+
+        fork_join(
+            policy,
+            [&]() {
+                string_sort_thread(policy, first, less_last, depth, stop,
+                    chunk_size, parallel_partition_limit);
+            },
+            [&]() {
+                fork_join(
+                    policy,
+                    [&]() {
+                        string_sort_thread(policy, greater_first, last, depth,
+                            stop, chunk_size, parallel_partition_limit);
+                    },
+                    sort_equal);
+            });
+    }
+
+    /// \brief sort the elements by their string keys using the string sort
+    ///        engine, the order of equal keys is preserved
+    /// \param [in] policy : execution policy used, the records are sorted
+    ///                      sequentially if it is sequenced
+    /// \param [in] first : iterator to the first element of the range
+    /// \param [in] last : iterator to the element after the last of the range
+    /// \param [in] proj : projection yielding the key of an element
+    /// \param [in] stop : stop token cancelling the parallel sort
+    /// \param [in] chunk_size : sections at most this long are sorted by a
+    ///                          single task
+    template <typename ExPolicy, typename Iter, typename Proj>
+    void string_sort(ExPolicy& policy, Iter first, Iter last, Proj& proj,
+        pika::stop_token const& stop = pika::stop_token(),
+        std::size_t chunk_size = string_sort_limit)
+    {
+        using record = string_sort_record<Iter>;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < 2)
+        {
+            return;
+        }
+
+        constexpr bool sequenced = pika::is_sequenced_execution_policy_v<
+            std::decay_t<ExPolicy>>;
+
+        std::size_t cores = 1;
+        if constexpr (!sequenced)
+        {
+            cores = parallel::execution::processing_units_count(
+                policy.parameters(), policy.executor());
+        }
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / string_sort_limit));
+
+        auto for_each_chunk = [&](auto&& f) {
+            run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+                f(chunk * count / num_chunks,
+                    (chunk + 1) * count / num_chunks);
+            });
+        };
+
+        std::vector<record> records(count);
+        for_each_chunk([&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                Iter it = first + i;
+                std::string_view const key = PIKA_INVOKE(proj, *it);
+                records[i] =
+                    record{string_sort_cache(key.data(), key.size(), 0),
+                        key.data(), key.size(), it};
+            }
+        });
+
+        if constexpr (sequenced)
+        {
+            string_sort_sequential(
+                records.data(), records.data() + count, std::size_t(0));
+        }
+        else
+        {
+            string_sort_thread(policy, records.data(), records.data() + count,
+                std::size_t(0), stop, chunk_size,
+                cores <= 1 ? (std::numeric_limits<std::size_t>::max)() :
+                             (std::max)(count / cores,
+                                 string_sort_parallel_partition_limit));
+        }
+
+        std::vector<Iter> v_iter(count);
+        for_each_chunk([&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                v_iter[i] = records[i].it;
+            }
+        });
+        std::vector<record>().swap(records);
+
+        apply_sort_index(policy, first, v_iter);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
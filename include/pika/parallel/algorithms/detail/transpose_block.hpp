@@ -0,0 +1,185 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The edge of the square blocks transposed in registers, zero if
+    // values of type T are transposed element by element.
+    template <typename T>
+    inline constexpr std::size_t transpose_kernel_size =
+#if defined(__AVX__)
+        std::is_same_v<T, float> ? 8 : std::is_same_v<T, double> ? 4 : 0;
+#elif defined(__SSE2__) || defined(_M_X64)
+        std::is_same_v<T, float> ? 4 : std::is_same_v<T, double> ? 2 : 0;
+#else
+        0;
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+    // Transpose the transpose_kernel_size<T> square block at in, whose
+    // rows are ld_in elements apart, to out, whose rows are ld_out
+    // elements apart.
+    PIKA_FORCEINLINE void transpose_kernel(float const* in,
+        std::size_t ld_in, float* out, std::size_t ld_out) noexcept
+    {
+#if defined(__AVX__)
+        __m256 r0 = _mm256_loadu_ps(in + 0 * ld_in);
+        __m256 r1 = _mm256_loadu_ps(in + 1 * ld_in);
+        __m256 r2 = _mm256_loadu_ps(in + 2 * ld_in);
+        __m256 r3 = _mm256_loadu_ps(in + 3 * ld_in);
+        __m256 r4 = _mm256_loadu_ps(in + 4 * ld_in);
+        __m256 r5 = _mm256_loadu_ps(in + 5 * ld_in);
+        __m256 r6 = _mm256_loadu_ps(in + 6 * ld_in);
+        __m256 r7 = _mm256_loadu_ps(in + 7 * ld_in);
+
+        // interleave pairs of rows, then pairs of pairs, then exchange the
+        // 128 bit lanes
+        __m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 const t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 const t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 const t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 const t7 = _mm256_unpackhi_ps(r6, r7);
+
+        __m256 const s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 const s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 const s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 const s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 const s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 const s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 const s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 const s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+        r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+        r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+        r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+        r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+        r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+        r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+        r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+
+        _mm256_storeu_ps(out + 0 * ld_out, r0);
+        _mm256_storeu_ps(out + 1 * ld_out, r1);
+        _mm256_storeu_ps(out + 2 * ld_out, r2);
+        _mm256_storeu_ps(out + 3 * ld_out, r3);
+        _mm256_storeu_ps(out + 4 * ld_out, r4);
+        _mm256_storeu_ps(out + 5 * ld_out, r5);
+        _mm256_storeu_ps(out + 6 * ld_out, r6);
+        _mm256_storeu_ps(out + 7 * ld_out, r7);
+#else
+        __m128 r0 = _mm_loadu_ps(in + 0 * ld_in);
+        __m128 r1 = _mm_loadu_ps(in + 1 * ld_in);
+        __m128 r2 = _mm_loadu_ps(in + 2 * ld_in);
+        __m128 r3 = _mm_loadu_ps(in + 3 * ld_in);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        _mm_storeu_ps(out + 0 * ld_out, r0);
+        _mm_storeu_ps(out + 1 * ld_out, r1);
+        _mm_storeu_ps(out + 2 * ld_out, r2);
+        _mm_storeu_ps(out + 3 * ld_out, r3);
+#endif
+    }
+
+    PIKA_FORCEINLINE void transpose_kernel(double const* in,
+        std::size_t ld_in, double* out, std::size_t ld_out) noexcept
+    {
+#if defined(__AVX__)
+        __m256d const r0 = _mm256_loadu_pd(in + 0 * ld_in);
+        __m256d const r1 = _mm256_loadu_pd(in + 1 * ld_in);
+        __m256d const r2 = _mm256_loadu_pd(in + 2 * ld_in);
+        __m256d const r3 = _mm256_loadu_pd(in + 3 * ld_in);
+
+        __m256d const t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d const t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d const t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d const t3 = _mm256_unpackhi_pd(r2, r3);
+
+        _mm256_storeu_pd(
+            out + 0 * ld_out, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(
+            out + 1 * ld_out, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(
+            out + 2 * ld_out, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(
+            out + 3 * ld_out, _mm256_permute2f128_pd(t1, t3, 0x31));
+#else
+        __m128d const r0 = _mm_loadu_pd(in + 0 * ld_in);
+        __m128d const r1 = _mm_loadu_pd(in + 1 * ld_in);
+
+        _mm_storeu_pd(out + 0 * ld_out, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(out + 1 * ld_out, _mm_unpackhi_pd(r0, r1));
+#endif
+    }
+#endif
+
+    // Transpose the rows x cols block at in, whose rows are ld_in elements
+    // apart, to the cols x rows block at out, whose rows are ld_out
+    // elements apart. Float and double values in contiguous memory are
+    // transposed in registers by square blocks of transpose_kernel_size.
+    template <typename InIter, typename OutIter>
+    void transpose_block(InIter in, std::size_t ld_in, OutIter out,
+        std::size_t ld_out, std::size_t rows, std::size_t cols)
+    {
+        std::size_t full_rows = 0;
+        std::size_t full_cols = 0;
+
+        if constexpr (std::is_pointer_v<InIter> && std::is_pointer_v<OutIter>)
+        {
+            using value_type = std::remove_const_t<
+                std::remove_pointer_t<InIter>>;
+            constexpr std::size_t k = transpose_kernel_size<value_type>;
+
+            if constexpr (k != 0 &&
+                std::is_same_v<value_type, std::remove_pointer_t<OutIter>>)
+            {
+                full_rows = rows - rows % k;
+                full_cols = cols - cols % k;
+                for (std::size_t i = 0; i != full_rows; i += k)
+                {
+                    for (std::size_t j = 0; j != full_cols; j += k)
+                    {
+                        transpose_kernel(
+                            in + i * ld_in + j, ld_in, out + j * ld_out + i,
+                            ld_out);
+                    }
+                }
+            }
+        }
+
+        // the columns right of the blocks, then the rows below them
+        for (std::size_t i = 0; i != full_rows; ++i)
+        {
+            for (std::size_t j = full_cols; j != cols; ++j)
+            {
+                out[j * ld_out + i] = in[i * ld_in + j];
+            }
+        }
+        for (std::size_t i = full_rows; i != rows; ++i)
+        {
+            for (std::size_t j = 0; j != cols; ++j)
+            {
+                out[j * ld_out + i] = in[i * ld_in + j];
+            }
+        }
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -12,6 +12,7 @@
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 
@@ -130,4 +131,49 @@ namespace pika::parallel::detail {
         }
         return first;
     }
+
+    // Exponential (galloping) search: returns the same as lower_bound, but
+    // the number of comparisons grows with the logarithm of the distance of
+    // the result from first instead of the length of the range. This is
+    // faster when the result is expected to be close to first.
+    template <typename Iter, typename T, typename F, typename Proj>
+    constexpr Iter
+    gallop_lower_bound(Iter first, Iter last, T&& value, F&& f, Proj&& proj)
+    {
+        using difference_type =
+            typename std::iterator_traits<Iter>::difference_type;
+
+        difference_type const count = last - first;
+        difference_type bound = 1;
+        while (bound < count &&
+            PIKA_INVOKE(f, PIKA_INVOKE(proj, first[bound - 1]), value))
+        {
+            bound *= 2;
+        }
+
+        // the result is in [first + bound / 2, first + min(bound, count)]
+        return detail::lower_bound(first + bound / 2,
+            first + (std::min)(bound, count), value, f, proj);
+    }
+
+    // Exponential (galloping) search returning the same as upper_bound.
+    template <typename Iter, typename T, typename F, typename Proj>
+    constexpr Iter
+    gallop_upper_bound(Iter first, Iter last, T&& value, F&& f, Proj&& proj)
+    {
+        using difference_type =
+            typename std::iterator_traits<Iter>::difference_type;
+
+        difference_type const count = last - first;
+        difference_type bound = 1;
+        while (bound < count &&
+            !PIKA_INVOKE(f, value, PIKA_INVOKE(proj, first[bound - 1])))
+        {
+            bound *= 2;
+        }
+
+        // the result is in [first + bound / 2, first + min(bound, count)]
+        return detail::upper_bound(first + bound / 2,
+            first + (std::min)(bound, count), value, f, proj);
+    }
 }    // namespace pika::parallel::detail
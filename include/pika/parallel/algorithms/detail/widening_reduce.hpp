@@ -0,0 +1,104 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/vector_pack_complex.hpp>
+#include <pika/parallel/util/vector_pack_reduce.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The operations which reduce and transform_reduce apply lane by lane to
+    // packs of accumulators, the nested type is applied to the packs.
+    template <typename Reduce, typename T, typename Enable = void>
+    struct widening_reduce_op
+      : traits::detail::vector_pack_reduce_op<Reduce, T>
+    {
+    };
+
+    template <typename T>
+    struct widening_reduce_op<plus, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : traits::detail::vector_pack_reduce_op_base<std::plus<>>
+    {
+    };
+
+    template <typename T>
+    struct widening_reduce_op<multiplies, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : traits::detail::vector_pack_reduce_op_base<std::multiplies<>>
+    {
+    };
+
+    // A reduction widens if it accumulates the arithmetic elements of a
+    // contiguous sequence into a wider arithmetic type which represents all
+    // of their values, e.g. float into double or std::int16_t into
+    // std::int32_t. Converting the elements first then gives the same
+    // results as the mixed operations of the sequential loop.
+    template <typename Iter, typename T, typename Reduce,
+        typename ValueType = typename std::iterator_traits<Iter>::value_type>
+    inline constexpr bool is_widening_reduction_v =
+        pika::detail::is_contiguous_iterator_v<Iter> &&
+        std::is_arithmetic_v<ValueType> &&
+        !std::is_same_v<ValueType, bool> && std::is_arithmetic_v<T> &&
+        sizeof(T) > sizeof(ValueType) &&
+        (std::is_floating_point_v<T> || std::is_integral_v<ValueType>) &&
+        widening_reduce_op<std::decay_t<Reduce>, T>::value;
+
+    // Sums of contiguous sequences of std::complex<float> or
+    // std::complex<double> are accumulated through the same kernel, the
+    // datapar policies deinterleave the elements into packs of their real
+    // and imaginary parts.
+    template <typename Iter, typename T, typename Reduce,
+        typename ValueType = typename std::iterator_traits<Iter>::value_type>
+    inline constexpr bool is_complex_reduction_v =
+        pika::detail::is_contiguous_iterator_v<Iter> &&
+        traits::detail::is_vector_pack_complex_v<T> &&
+        std::is_same_v<ValueType, T> &&
+        (std::is_same_v<std::decay_t<Reduce>, std::plus<>> ||
+            std::is_same_v<std::decay_t<Reduce>, std::plus<T>> ||
+            std::is_same_v<std::decay_t<Reduce>, plus>);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The chunk kernel of the widening reductions: fold the converted
+    // elements of [first, first + count) into init. The datapar policies
+    // provide an overload which converts the elements to packs of T and
+    // accumulates in vector registers, see datapar/transform_reduce.hpp.
+    template <typename ExPolicy>
+    struct widening_reduce_n_t
+      : pika::functional::detail::tag_fallback<widening_reduce_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Reduce, typename Convert>
+        friend T tag_fallback_invoke(widening_reduce_n_t<ExPolicy>, Iter first,
+            std::size_t count, T init, Reduce& r, Convert& conv)
+        {
+            for (/**/; count != 0; (void) ++first, --count)
+            {
+                init = PIKA_INVOKE(r, init, PIKA_INVOKE(conv, *first));
+            }
+            return init;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    PIKA_FORCEINLINE T widening_reduce_n(
+        Iter first, std::size_t count, T init, Reduce& r, Convert& conv)
+    {
+        return widening_reduce_n_t<ExPolicy>{}(first, count, init, r, conv);
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,464 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/distinct.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Copies the first occurrence of every distinct element of the range
+    /// [first, last) to the range beginning at \a dest, keeping their order.
+    /// Two elements a and b are equal if equal(a, b) holds. Unlike
+    /// \a unique_copy, equal elements do not need to be consecutive, and
+    /// unlike \a sorted_unique_copy the range does not need to be sorted:
+    /// the elements are deduplicated by hash sets instead.
+    ///
+    /// Every chunk of the range inserts the positions of its elements into
+    /// open addressing hash sets, one per partition of the elements given by
+    /// the high bits of their hash values. The sets of a partition are merged
+    /// by a single task, keeping the smallest position of every distinct
+    /// element, and the elements at the kept positions are copied to the
+    /// destination in parallel.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a hash
+    ///         and on average O(\a last - \a first) applications of
+    ///         \a equal.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     to hash the elements (deduced). This defaults to
+    ///                     std::hash of the value type of \a RandIter.
+    /// \tparam Equal       The type of the function/function object to use
+    ///                     to compare the elements (deduced). This defaults
+    ///                     to std::equal_to<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param hash         Specifies the function (or function object)
+    ///                     computing the hash value of an element, equal
+    ///                     elements must have equal hash values.
+    /// \param equal        \a equal is a callable object which returns true
+    ///                     if the two arguments are equal, and false
+    ///                     otherwise.
+    ///
+    /// The invocations of \a hash and \a equal in the parallel \a distinct
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The invocations of \a hash and \a equal in the parallel \a distinct
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a distinct algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise. The \a distinct algorithm
+    ///           returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter>::value_type>,
+        typename Equal = detail::equal_to>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    distinct(ExPolicy&& policy, RandIter first, RandIter last, FwdIter2 dest,
+        Hash&& hash = Hash(), Equal&& equal = Equal());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/hash_mix.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // distinct
+    /// \cond NOINTERNAL
+
+    // Open addressing hash set of positions in a range, two positions are
+    // equal if the elements at them are. Collisions are resolved by linear
+    // probing.
+    class distinct_set
+    {
+    public:
+        // inserts the position unless an equal one is in the set already,
+        // returns whether it was inserted
+        template <typename Equal>
+        bool insert(std::uint64_t hash, std::size_t pos, Equal& equal)
+        {
+            if (2 * (size_ + 1) > slots_.size())
+            {
+                grow();
+            }
+
+            std::size_t const mask = slots_.size() - 1;
+            for (std::size_t i = std::size_t(hash) & mask;; i = (i + 1) & mask)
+            {
+                slot& s = slots_[i];
+                if (s.pos == 0)
+                {
+                    s.hash = hash;
+                    s.pos = pos + 1;
+                    ++size_;
+                    return true;
+                }
+                if (s.hash == hash && equal(s.pos - 1, pos))
+                {
+                    return false;
+                }
+            }
+        }
+
+        // calls f(hash, pos) for all positions in the set
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (slot const& s : slots_)
+            {
+                if (s.pos != 0)
+                {
+                    f(s.hash, s.pos - 1);
+                }
+            }
+        }
+
+    private:
+        // pos is the position plus one, zero marks an empty slot
+        struct slot
+        {
+            std::uint64_t hash = 0;
+            std::size_t pos = 0;
+        };
+
+        void grow()
+        {
+            std::vector<slot> slots(
+                (std::max)(std::size_t(16), 2 * slots_.size()));
+            std::size_t const mask = slots.size() - 1;
+            for (slot const& s : slots_)
+            {
+                if (s.pos != 0)
+                {
+                    std::size_t i = std::size_t(s.hash) & mask;
+                    while (slots[i].pos != 0)
+                    {
+                        i = (i + 1) & mask;
+                    }
+                    slots[i] = s;
+                }
+            }
+            slots_ = PIKA_MOVE(slots);
+        }
+
+        std::vector<slot> slots_;
+        std::size_t size_ = 0;
+    };
+
+    // the minimal number of elements deduplicated by one task
+    static const std::size_t distinct_min_chunk_size = 16384ul;
+
+    // the largest number of partitions the elements are merged in
+    static const std::size_t distinct_max_partitions = 256ul;
+
+    // copies every element not in the set yet
+    template <typename RandIter, typename OutIter, typename Hash,
+        typename Equal>
+    OutIter distinct_sequential(RandIter first, std::size_t count,
+        OutIter dest, Hash& hash, Equal& equal)
+    {
+        auto equal_at = [&](std::size_t lhs, std::size_t rhs) -> bool {
+            return PIKA_INVOKE(equal, first[lhs], first[rhs]);
+        };
+
+        distinct_set set;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (set.insert(hash_mix(std::uint64_t(PIKA_INVOKE(hash, first[i]))),
+                    i, equal_at))
+            {
+                *dest = first[i];
+                ++dest;
+            }
+        }
+        return dest;
+    }
+
+    // -----------------------------------------------------------------------
+    // The elements are split into chunks which are processed in three passes:
+    //  1. every chunk inserts the positions of its elements into a set per
+    //     partition, the partition of an element is given by the high bits
+    //     of its hash value
+    //  2. every partition merges the sets of all chunks for it, in the order
+    //     of the chunks, so that the first occurrence of every element is
+    //     kept. The kept positions are marked and counted per chunk.
+    //  3. the exclusive scan of the counts gives the output position of the
+    //     first kept element of each chunk, all chunks are copied in parallel
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename Hash, typename Equal>
+    FwdIter2 distinct_impl(ExPolicy& policy, RandIter first, std::size_t count,
+        FwdIter2 dest, Hash& hash, Equal& equal)
+    {
+        std::size_t num_chunks = 1;
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            num_chunks = (std::min)(cores,
+                (count + distinct_min_chunk_size - 1) /
+                    distinct_min_chunk_size);
+            num_chunks = (std::max)(num_chunks, std::size_t(1));
+        }
+
+        if (num_chunks == 1)
+        {
+            return distinct_sequential(first, count, dest, hash, equal);
+        }
+
+        auto hash_of = [&](std::size_t i) -> std::uint64_t {
+            return hash_mix(std::uint64_t(PIKA_INVOKE(hash, first[i])));
+        };
+        auto equal_at = [&](std::size_t lhs, std::size_t rhs) -> bool {
+            return PIKA_INVOKE(equal, first[lhs], first[rhs]);
+        };
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        // a power of two of partitions, at least one per chunk
+        unsigned partition_bits = 1;
+        while ((std::size_t(1) << partition_bits) < num_chunks &&
+            (std::size_t(1) << partition_bits) < distinct_max_partitions)
+        {
+            ++partition_bits;
+        }
+        std::size_t const num_partitions = std::size_t(1) << partition_bits;
+
+        // step 1, sets[chunk * num_partitions + partition]
+        std::vector<distinct_set> sets(num_chunks * num_partitions);
+        auto insert = [&](std::size_t chunk) {
+            distinct_set* chunk_sets = sets.data() + chunk * num_partitions;
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                std::uint64_t const h = hash_of(i);
+                chunk_sets[std::size_t(h >> (64 - partition_bits))].insert(
+                    h, i, equal_at);
+            }
+        };
+        run_chunks(policy, num_chunks, insert);
+
+        // step 2, the merged set of each partition replaces the one of the
+        // first chunk, counts[partition * num_chunks + chunk] is the number
+        // of kept positions of the partition in the chunk
+        std::vector<char> keep(count, 0);
+        std::vector<std::size_t> counts(num_partitions * num_chunks, 0);
+        auto merge = [&](std::size_t partition) {
+            distinct_set& merged = sets[partition];
+            std::size_t* partition_counts =
+                counts.data() + partition * num_chunks;
+            merged.for_each([&](std::uint64_t, std::size_t pos) {
+                keep[pos] = 1;
+                ++partition_counts[0];
+            });
+            for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+            {
+                distinct_set& set = sets[chunk * num_partitions + partition];
+                set.for_each([&](std::uint64_t h, std::size_t pos) {
+                    if (merged.insert(h, pos, equal_at))
+                    {
+                        keep[pos] = 1;
+                        ++partition_counts[chunk];
+                    }
+                });
+                set = distinct_set();
+            }
+        };
+        run_chunks(policy, num_partitions, merge);
+
+        // step 3, offsets[chunk] is the number of kept elements before the
+        // chunk
+        std::vector<std::size_t> offsets(num_chunks + 1, 0);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            std::size_t kept = 0;
+            for (std::size_t partition = 0; partition != num_partitions;
+                 ++partition)
+            {
+                kept += counts[partition * num_chunks + chunk];
+            }
+            offsets[chunk + 1] = offsets[chunk] + kept;
+        }
+
+        auto copy = [&](std::size_t chunk) {
+            FwdIter2 dst = std::next(dest, offsets[chunk]);
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                if (keep[i])
+                {
+                    *dst = first[i];
+                    ++dst;
+                }
+            }
+        };
+        run_chunks(policy, num_chunks, copy);
+
+        return std::next(dest, offsets.back());
+    }
+
+    template <typename FwdIter2>
+    struct distinct : public algorithm<distinct<FwdIter2>, FwdIter2>
+    {
+        distinct()
+          : distinct::algorithm("distinct")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename OutIter,
+            typename Hash, typename Equal>
+        static OutIter sequential(ExPolicy, RandIter first, RandIter last,
+            OutIter dest, Hash&& hash, Equal&& equal)
+        {
+            return distinct_sequential(first,
+                std::size_t(std::distance(first, last)), dest, hash, equal);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Hash,
+            typename Equal>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last, FwdIter2 dest,
+            Hash&& hash, Equal&& equal)
+        {
+            std::size_t const count = std::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            return run_length_parallel<ExPolicy, FwdIter2>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, count, dest, hash = PIKA_FORWARD(Hash, hash),
+                    equal = PIKA_FORWARD(Equal, equal)](
+                    auto& p) mutable -> FwdIter2 {
+                    return distinct_impl(p, first, count, dest, hash, equal);
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::distinct
+    inline constexpr struct distinct_t final
+      : pika::detail::tag_parallel_algorithm<distinct_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter>::value_type>,
+            typename Equal = pika::parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(distinct_t, ExPolicy&& policy, RandIter first,
+            RandIter last, FwdIter2 dest, Hash&& hash = Hash(),
+            Equal&& equal = Equal())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::distinct<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest,
+                PIKA_FORWARD(Hash, hash), PIKA_FORWARD(Equal, equal));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OutIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter>::value_type>,
+            typename Equal = pika::parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(distinct_t, RandIter first,
+            RandIter last, OutIter dest, Hash&& hash = Hash(),
+            Equal&& equal = Equal())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::distinct<OutIter>().call(
+                pika::execution::seq, first, last, dest,
+                PIKA_FORWARD(Hash, hash), PIKA_FORWARD(Equal, equal));
+        }
+    } distinct{};
+}    // namespace pika
+
+#endif    // DOXYGEN
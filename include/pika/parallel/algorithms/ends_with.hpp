@@ -175,7 +175,7 @@ namespace pika::parallel::detail {
             typename Iter2, typename Sent2, typename Pred, typename Proj1,
             typename Proj2>
         static bool
-        sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+        sequential(ExPolicy policy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Pred&& pred, Proj1&& proj1, Proj2&& proj2)
         {
             const auto drop = detail::distance(first1, last1) -
@@ -184,8 +184,8 @@ namespace pika::parallel::detail {
             if (drop < 0)
                 return false;
 
-            return pika::parallel::detail::equal_binary().call(
-                pika::execution::seq, std::next(PIKA_MOVE(first1), drop),
+            return pika::parallel::detail::equal_binary::sequential(
+                PIKA_MOVE(policy), std::next(PIKA_MOVE(first1), drop),
                 PIKA_MOVE(last1), PIKA_MOVE(first2), PIKA_MOVE(last2),
                 PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj1, proj1),
                 PIKA_FORWARD(Proj2, proj2));
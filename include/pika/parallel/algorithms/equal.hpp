@@ -180,6 +180,7 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
@@ -231,9 +232,27 @@ namespace pika::parallel ::detail {
         static bool sequential(ExPolicy, Iter1 first1, Sent1 last1,
             Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
-            return sequential_equal_binary(first1, last1, first2, last2,
-                PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
-                PIKA_FORWARD(Proj2, proj2));
+            if constexpr (is_sized_range_v<Iter1, Sent1> &&
+                is_sized_range_v<Iter2, Sent2>)
+            {
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first1, last1));
+                if (count != static_cast<std::size_t>(
+                                 detail::distance(first2, last2)))
+                {
+                    return false;
+                }
+                return sequential_mismatch_n<std::decay_t<ExPolicy>>(first1,
+                           first2, count, PIKA_FORWARD(F, f),
+                           PIKA_FORWARD(Proj1, proj1),
+                           PIKA_FORWARD(Proj2, proj2)) == count;
+            }
+            else
+            {
+                return sequential_equal_binary(first1, last1, first2, last2,
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+                    PIKA_FORWARD(Proj2, proj2));
+            }
         }
 
         template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -274,32 +293,25 @@ namespace pika::parallel ::detail {
             }
 
             using zip_iterator = pika::util::zip_iterator<Iter1, Iter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<> tok;
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](zip_iterator it,
                           std::size_t part_count) mutable -> bool {
-                loop_n<std::decay_t<ExPolicy>>(it, part_count, tok,
-                    [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                        reference t = *curr;
-                        if (!pika::util::detail::invoke(f,
-                                pika::util::detail::invoke(
-                                    proj1, std::get<0>(t)),
-                                pika::util::detail::invoke(
-                                    proj2, std::get<1>(t))))
-                        {
-                            tok.cancel();
-                        }
-                    });
+                auto iters = it.get_iterator_tuple();
+                if (mismatch_partition<std::decay_t<ExPolicy>>(
+                        std::get<0>(iters), std::get<1>(iters), part_count,
+                        [&tok](std::size_t) { return tok.was_cancelled(); },
+                        f, proj1, proj2) != part_count)
+                {
+                    tok.cancel();
+                }
                 return !tok.was_cancelled();
             };
 
-            return partitioner<ExPolicy, bool>::call(
+            return partitioner<ExPolicy, bool>::call_cancellable(
                 PIKA_FORWARD(ExPolicy, policy),
                 pika::util::make_zip_iterator(first1, first2), count1,
                 PIKA_MOVE(f1),
@@ -307,7 +319,8 @@ namespace pika::parallel ::detail {
                     return std::all_of(pika::util::begin(results),
                         pika::util::end(results),
                         [](pika::future<bool>& val) { return val.get(); });
-                });
+                },
+                [tok](std::size_t) { return tok.was_cancelled(); });
         }
     };
     /// \endcond
@@ -327,7 +340,20 @@ namespace pika::parallel ::detail {
         static bool sequential(
             ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
         {
-            return std::equal(first1, last1, first2, PIKA_FORWARD(F, f));
+            if constexpr (pika::traits::is_random_access_iterator_v<InIter1> &&
+                pika::traits::is_random_access_iterator_v<InIter2>)
+            {
+                std::size_t const count =
+                    static_cast<std::size_t>(std::distance(first1, last1));
+                return sequential_mismatch_n<std::decay_t<ExPolicy>>(first1,
+                           first2, count, PIKA_FORWARD(F, f),
+                           projection_identity{},
+                           projection_identity{}) == count;
+            }
+            else
+            {
+                return std::equal(first1, last1, first2, PIKA_FORWARD(F, f));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -346,30 +372,32 @@ namespace pika::parallel ::detail {
             difference_type count = std::distance(first1, last1);
 
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<> tok;
             auto f1 = [f, tok](zip_iterator it,
                           std::size_t part_count) mutable -> bool {
-                loop_n<std::decay_t<ExPolicy>>(it, part_count, tok,
-                    [&f, &tok](zip_iterator const& curr) mutable -> void {
-                        reference t = *curr;
-                        if (!PIKA_INVOKE(f, std::get<0>(t), std::get<1>(t)))
-                        {
-                            tok.cancel();
-                        }
-                    });
+                auto iters = it.get_iterator_tuple();
+                if (mismatch_partition<std::decay_t<ExPolicy>>(
+                        std::get<0>(iters), std::get<1>(iters), part_count,
+                        [&tok](std::size_t) { return tok.was_cancelled(); },
+                        f, projection_identity{},
+                        projection_identity{}) != part_count)
+                {
+                    tok.cancel();
+                }
                 return !tok.was_cancelled();
             };
 
-            return partitioner<ExPolicy, bool>::call(
+            return partitioner<ExPolicy, bool>::call_cancellable(
                 PIKA_FORWARD(ExPolicy, policy),
                 pika::util::make_zip_iterator(first1, first2), count,
-                PIKA_MOVE(f1), [](std::vector<pika::future<bool>>&& results) {
+                PIKA_MOVE(f1),
+                [](std::vector<pika::future<bool>>&& results) {
                     return std::all_of(pika::util::begin(results),
                         pika::util::end(results),
                         [](pika::future<bool>& val) { return val.get(); });
-                });
+                },
+                [tok](std::size_t) { return tok.was_cancelled(); });
         }
     };
     /// \endcond
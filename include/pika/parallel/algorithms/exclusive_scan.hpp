@@ -297,6 +297,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/scan.hpp>
 #include <pika/parallel/algorithms/inclusive_scan.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
@@ -304,6 +305,7 @@ namespace pika {
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/scan_look_back_partitioner.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 #include <pika/type_support/unused.hpp>
@@ -338,20 +340,6 @@ namespace pika::parallel::detail {
         return in_out_result<InIter, OutIter>{first, dest};
     }
 
-    template <typename InIter, typename OutIter, typename T, typename Op>
-    static constexpr T sequential_exclusive_scan_n(
-        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-    {
-        T temp = init;
-        for (/* */; count-- != 0; (void) ++first, ++dest)
-        {
-            init = PIKA_INVOKE(op, init, *first);
-            *dest = temp;
-            temp = init;
-        }
-        return init;
-    }
-
     ///////////////////////////////////////////////////////////////////////
     template <typename IterPair>
     struct exclusive_scan : public algorithm<exclusive_scan<IterPair>, IterPair>
@@ -366,8 +354,22 @@ namespace pika::parallel::detail {
         static constexpr in_out_result<InIter, OutIter> sequential(ExPolicy,
             InIter first, Sent last, OutIter dest, T const& init, Op&& op)
         {
-            return sequential_exclusive_scan(
-                first, last, dest, init, PIKA_FORWARD(Op, op));
+            if constexpr (pika::traits::is_random_access_iterator_v<InIter> &&
+                pika::traits::is_forward_iterator_v<OutIter> &&
+                std::is_same_v<InIter, Sent>)
+            {
+                // the chunk kernel is vectorized for the datapar policies
+                std::size_t const count = std::distance(first, last);
+                sequential_exclusive_scan_n<ExPolicy>(
+                    first, count, dest, init, PIKA_FORWARD(Op, op));
+                return in_out_result<InIter, OutIter>{
+                    last, std::next(dest, count)};
+            }
+            else
+            {
+                return sequential_exclusive_scan(
+                    first, last, dest, init, PIKA_FORWARD(Op, op));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -397,7 +399,9 @@ namespace pika::parallel::detail {
             // steps. The first calculates the scan results for each
             // partition. The second accumulates the result from left to
             // right to be used by the third step--which operates on the
-            // same partitions the first step operated on.
+            // same partitions the first step operated on. For random access
+            // iterators the steps are instead run for one chunk after the
+            // other, looking back at the results of the preceding chunks.
 
             using pika::util::make_zip_iterator;
             using std::get;
@@ -414,38 +418,67 @@ namespace pika::parallel::detail {
                     });
             };
 
-            return scan_partitioner<ExPolicy, in_out_result<FwdIter1, FwdIter2>,
-                T>::
-                call(
-                    PIKA_FORWARD(ExPolicy, policy),
-                    make_zip_iterator(first, dest), count, init,
-                    // step 1 performs first part of scan algorithm
-                    [op, last](
-                        zip_iterator part_begin, std::size_t part_size) -> T {
-                        T part_init = get<0>(*part_begin++);
-
-                        auto iters = part_begin.get_iterator_tuple();
-                        if (get<0>(iters) != last)
-                        {
-                            return sequential_exclusive_scan_n(get<0>(iters),
-                                part_size - 1, get<1>(iters), part_init, op);
-                        }
-                        return part_init;
-                    },
-                    // step 2 propagates the partition results from left
-                    // to right
-                    op,
-                    // step 3 runs final accumulation on each partition
-                    PIKA_MOVE(f3),
-                    // step 4 use this return value
-                    [last_iter, final_dest](std::vector<T>&&,
-                        std::vector<pika::future<void>>&& data) {
-                        // make sure iterators embedded in function object that is
-                        // attached to futures are invalidated
-                        data.clear();
-                        return in_out_result<FwdIter1, FwdIter2>{
-                            last_iter, final_dest};
-                    });
+            // step 1 performs first part of scan algorithm
+            auto f1 = [op, last](
+                          zip_iterator part_begin, std::size_t part_size) -> T {
+                T part_init = get<0>(*part_begin++);
+
+                auto iters = part_begin.get_iterator_tuple();
+                if (get<0>(iters) != last)
+                {
+                    return sequential_exclusive_scan_n<
+                        std::decay_t<ExPolicy>>(get<0>(iters),
+                        part_size - 1, get<1>(iters), part_init, op);
+                }
+                return part_init;
+            };
+
+            if constexpr (use_scan_look_back_v<ExPolicy, FwdIter1, FwdIter2,
+                              T>)
+            {
+                // all chunks are scanned in a single pass
+                return scan_look_back_partitioner<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter2>, T>::
+                    call(
+                        PIKA_FORWARD(ExPolicy, policy),
+                        make_zip_iterator(first, dest), count, init,
+                        // scans a chunk when its prefix is known
+                        [op](zip_iterator part_begin, std::size_t part_size,
+                            T val) -> T {
+                            auto iters = part_begin.get_iterator_tuple();
+                            return sequential_exclusive_scan_n<
+                                std::decay_t<ExPolicy>>(get<0>(iters),
+                                part_size, get<1>(iters), val, op);
+                        },
+                        PIKA_MOVE(f1), op, PIKA_MOVE(f3),
+                        [last_iter, final_dest]() {
+                            return in_out_result<FwdIter1, FwdIter2>{
+                                last_iter, final_dest};
+                        });
+            }
+            else
+            {
+                return scan_partitioner<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter2>, T>::
+                    call(
+                        PIKA_FORWARD(ExPolicy, policy),
+                        make_zip_iterator(first, dest), count, init,
+                        PIKA_MOVE(f1),
+                        // step 2 propagates the partition results from left
+                        // to right
+                        op,
+                        // step 3 runs final accumulation on each partition
+                        PIKA_MOVE(f3),
+                        // step 4 use this return value
+                        [last_iter, final_dest](std::vector<T>&&,
+                            std::vector<pika::future<void>>&& data) {
+                            // make sure iterators embedded in function object
+                            // that is attached to futures are invalidated
+                            data.clear();
+                            return in_out_result<FwdIter1, FwdIter2>{
+                                last_iter, final_dest};
+                        });
+            }
         }
     };
     /// \endcond
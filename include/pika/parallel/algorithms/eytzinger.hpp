@@ -0,0 +1,390 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/eytzinger.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Copies the sorted range [first, last) to the range beginning at
+    /// \a dest in Eytzinger order: the elements are stored in the order of
+    /// a breadth-first traversal of the complete binary search tree over
+    /// them. The root is the first element, the children of the element at
+    /// index i are at the indices 2 * i + 1 and 2 * i + 2. Searches through
+    /// this layout access the elements close to the root in few cache lines
+    /// and can prefetch the elements needed several steps ahead, see
+    /// \a eytzinger_lower_bound. The destination range cannot overlap with
+    /// the input range.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sorted sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sorted sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The assignments in the parallel \a eytzinger_layout algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a eytzinger_layout algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a eytzinger_layout algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise. The \a eytzinger_layout
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    eytzinger_layout(ExPolicy&& policy, RandIter1 first, RandIter1 last,
+        FwdIter2 dest);
+
+    /// Returns an iterator to the smallest element of the range [first,
+    /// last) in Eytzinger order (see \a eytzinger_layout) which is not
+    /// ordered before \a value, or \a last if there is no such element.
+    ///
+    /// \note   Complexity: At most log2(last - first) + 1 applications of
+    ///         the comparison \a comp.
+    ///
+    /// \param first        Refers to the beginning of the range in
+    ///                     Eytzinger order.
+    /// \param last         Refers to the end of the range in Eytzinger order.
+    /// \param value        The value searched for.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. It must be the ordering the
+    ///                     range was sorted by before it was converted to
+    ///                     Eytzinger order.
+    ///
+    template <typename RandIter, typename T, typename Comp = detail::less>
+    RandIter eytzinger_lower_bound(RandIter first, RandIter last,
+        T const& value, Comp&& comp = Comp());
+
+    /// Returns an iterator to the smallest element of the range [first,
+    /// last) in Eytzinger order (see \a eytzinger_layout) which is ordered
+    /// after \a value, or \a last if there is no such element.
+    ///
+    /// \note   Complexity: At most log2(last - first) + 1 applications of
+    ///         the comparison \a comp.
+    ///
+    template <typename RandIter, typename T, typename Comp = detail::less>
+    RandIter eytzinger_upper_bound(RandIter first, RandIter last,
+        T const& value, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/prefetching.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // eytzinger_layout, eytzinger_lower_bound, eytzinger_upper_bound
+    /// \cond NOINTERNAL
+
+    constexpr std::size_t eytzinger_floor_log2(std::size_t n) noexcept
+    {
+        std::size_t result = 0;
+        while (n >>= 1)
+        {
+            ++result;
+        }
+        return result;
+    }
+
+    // The index into the sorted range of the element stored at index i of
+    // the Eytzinger layout of count elements.
+    //
+    // In a perfect tree of height h, the node at position j of level d is
+    // preceded by (2 * j + 1) * 2^(h - 1 - d) - 1 nodes in order. The
+    // complete tree of count nodes lacks the nodes at the end of the last
+    // level of the perfect tree, these are the ones at even in-order
+    // positions past twice the number of nodes on the last level.
+    constexpr std::size_t eytzinger_rank(
+        std::size_t i, std::size_t count) noexcept
+    {
+        std::size_t const node = i + 1;
+        std::size_t const depth = eytzinger_floor_log2(node);
+        std::size_t const height = eytzinger_floor_log2(count) + 1;
+
+        std::size_t const pos = node - (std::size_t(1) << depth);
+        std::size_t const rank = ((2 * pos + 1) << (height - 1 - depth)) - 1;
+
+        std::size_t const last_level =
+            count - ((std::size_t(1) << (height - 1)) - 1);
+        std::size_t const leaves_before = (rank + 1) / 2;
+        return leaves_before > last_level ?
+            rank - (leaves_before - last_level) :
+            rank;
+    }
+
+    // distance in elements of the layout between the prefetched elements
+    // and the ones currently accessed
+    inline constexpr std::size_t eytzinger_prefetch_distance = 16;
+
+    template <typename Iter, typename OutIter>
+    OutIter eytzinger_layout_n(Iter first, std::size_t count, OutIter dest,
+        std::size_t base_idx, std::size_t part_count)
+    {
+        std::size_t const end = base_idx + part_count;
+        for (std::size_t i = base_idx; i != end; ++i, ++dest)
+        {
+            if (i + eytzinger_prefetch_distance < end)
+            {
+                prefetching::prefetch_address(first[eytzinger_rank(
+                    i + eytzinger_prefetch_distance, count)]);
+            }
+            *dest = first[eytzinger_rank(i, count)];
+        }
+        return dest;
+    }
+
+    template <typename OutIter>
+    struct eytzinger_layout
+      : public algorithm<eytzinger_layout<OutIter>, OutIter>
+    {
+        eytzinger_layout()
+          : eytzinger_layout::algorithm("eytzinger_layout")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter>
+        static OutIter sequential(ExPolicy, Iter first, Iter last, OutIter dest)
+        {
+            std::size_t const count = detail::distance(first, last);
+            return eytzinger_layout_n(first, count, dest, 0, count);
+        }
+
+        // Every element of the destination is computed independently, the
+        // destination is partitioned into chunks written sequentially.
+        template <typename ExPolicy, typename Iter>
+        static typename algorithm_result<ExPolicy, OutIter>::type parallel(
+            ExPolicy&& policy, Iter first, Iter last, OutIter dest)
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, OutIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            auto f1 = [first, count](OutIter it, std::size_t part_count,
+                          std::size_t base_idx) -> void {
+                eytzinger_layout_n(first, count, it, base_idx, part_count);
+            };
+
+            auto f2 = [dest, count](
+                          std::vector<pika::future<void>>&& data) -> OutIter {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+                return std::next(dest, count);
+            };
+
+            return partitioner<ExPolicy, OutIter, void>::call_with_index(
+                PIKA_FORWARD(ExPolicy, policy), dest, count, 1, PIKA_MOVE(f1),
+                PIKA_MOVE(f2));
+        }
+    };
+
+    // Descends from the root, the node index k is one-based: the children
+    // of k are 2 * k and 2 * k + 1. The descendants of k four levels further
+    // down are adjacent and are prefetched together while the levels in
+    // between are compared. The result is the last node the search went
+    // left at, the trailing right turns are stripped from k.
+    template <bool Upper, typename Iter, typename T, typename Comp,
+        typename Proj>
+    Iter eytzinger_search(
+        Iter first, Iter last, T const& value, Comp& comp, Proj& proj)
+    {
+        std::size_t const count = last - first;
+
+        std::size_t k = 1;
+        while (k <= count)
+        {
+            std::size_t const ahead = k * eytzinger_prefetch_distance;
+            if (ahead <= count)
+            {
+                prefetching::prefetch_address(first[ahead - 1]);
+            }
+
+            auto&& elem = PIKA_INVOKE(proj, first[k - 1]);
+            bool right = false;
+            if constexpr (Upper)
+            {
+                right = !PIKA_INVOKE(comp, value, elem);
+            }
+            else
+            {
+                right = PIKA_INVOKE(comp, elem, value);
+            }
+            k = 2 * k + right;
+        }
+
+        while (k & 1)
+        {
+            k >>= 1;
+        }
+        k >>= 1;
+
+        return k == 0 ? last : first + (k - 1);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::eytzinger_layout
+    inline constexpr struct eytzinger_layout_t final
+      : pika::detail::tag_parallel_algorithm<eytzinger_layout_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(eytzinger_layout_t, ExPolicy&& policy,
+            RandIter1 first, RandIter1 last, FwdIter2 dest)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::eytzinger_layout<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest);
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(
+            eytzinger_layout_t, RandIter1 first, RandIter1 last, OutIter dest)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::eytzinger_layout<OutIter>().call(
+                pika::execution::seq, first, last, dest);
+        }
+    } eytzinger_layout{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::eytzinger_lower_bound
+    inline constexpr struct eytzinger_lower_bound_t final
+      : pika::functional::detail::tag_fallback<eytzinger_lower_bound_t>
+    {
+    private:
+        // clang-format off
+        template <typename RandIter, typename T,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(eytzinger_lower_bound_t,
+            RandIter first, RandIter last, T const& value, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            pika::parallel::detail::projection_identity proj;
+            return pika::parallel::detail::eytzinger_search<false>(
+                first, last, value, comp, proj);
+        }
+    } eytzinger_lower_bound{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::eytzinger_upper_bound
+    inline constexpr struct eytzinger_upper_bound_t final
+      : pika::functional::detail::tag_fallback<eytzinger_upper_bound_t>
+    {
+    private:
+        // clang-format off
+        template <typename RandIter, typename T,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(eytzinger_upper_bound_t,
+            RandIter first, RandIter last, T const& value, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            pika::parallel::detail::projection_identity proj;
+            return pika::parallel::detail::eytzinger_search<true>(
+                first, last, value, comp, proj);
+        }
+    } eytzinger_upper_bound{};
+}    // namespace pika
+
+#endif    // DOXYGEN
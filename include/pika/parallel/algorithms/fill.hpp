@@ -117,8 +117,12 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/fill.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
@@ -143,6 +147,42 @@ namespace pika::parallel::detail {
         }
     };
 
+    // fill the chunks with non-temporal stores
+    template <typename ExPolicy, typename FwdIter, typename T>
+    typename algorithm_result<ExPolicy, FwdIter>::type fill_non_temporal(
+        ExPolicy&& policy, FwdIter first, std::size_t count, T const& val)
+    {
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, FwdIter>::get(PIKA_MOVE(first));
+        }
+
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), first, count,
+            [val](FwdIter part_begin, std::size_t part_size,
+                std::size_t) -> void {
+                non_temporal_fill(part_begin, part_size, val);
+            },
+            projection_identity());
+    }
+
+    // fill each chunk by writing the bytes of the value, see byte_fill_n
+    template <typename ExPolicy, typename FwdIter, typename T>
+    typename algorithm_result<ExPolicy, FwdIter>::type fill_bytes(
+        ExPolicy&& policy, FwdIter first, std::size_t count, T const& val)
+    {
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, FwdIter>::get(PIKA_MOVE(first));
+        }
+
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), first, count,
+            [val](FwdIter part_begin, std::size_t part_size,
+                std::size_t) -> void { byte_fill(part_begin, part_size, val); },
+            projection_identity());
+    }
+
     template <typename Iter>
     struct fill : public algorithm<fill<Iter>, Iter>
     {
@@ -151,12 +191,24 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         template <typename ExPolicy, typename InIter, typename Sent, typename T>
         PIKA_HOST_DEVICE static InIter
         sequential(ExPolicy&& policy, InIter first, Sent last, T const& val)
         {
-            return detail::sequential_fill(
-                PIKA_FORWARD(ExPolicy, policy), first, last, val);
+            // the bits packed into words are set a word at a time
+            if constexpr (use_packed_bits_v<InIter> &&
+                std::is_convertible_v<T const&, bool>)
+            {
+                return sequential_packed_bits_fill(
+                    first, detail::distance(first, last), bool(val));
+            }
+            else
+            {
+                return detail::sequential_fill(
+                    PIKA_FORWARD(ExPolicy, policy), first, last, val);
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -170,9 +222,29 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
-            return for_each_n<FwdIter>().call(PIKA_FORWARD(ExPolicy, policy),
-                first, detail::distance(first, last), fill_iteration<T>{val},
-                projection_identity());
+            if constexpr (use_packed_bits_v<FwdIter> &&
+                std::is_convertible_v<T const&, bool>)
+            {
+                return parallel_packed_bits_fill(PIKA_FORWARD(ExPolicy, policy),
+                    first, detail::distance(first, last), bool(val));
+            }
+            else if constexpr (use_non_temporal_stores_for_v<ExPolicy, FwdIter>)
+            {
+                return fill_non_temporal(PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), val);
+            }
+            else if constexpr (is_byte_fill_v<FwdIter, T>)
+            {
+                return fill_bytes(PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), val);
+            }
+            else
+            {
+                return for_each_n<FwdIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), fill_iteration<T>{val},
+                    projection_identity());
+            }
         }
     };
     /// \endcond
@@ -188,21 +260,51 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         template <typename ExPolicy, typename InIter, typename T>
         static InIter sequential(
             ExPolicy&& policy, InIter first, std::size_t count, T const& val)
         {
-            return detail::sequential_fill_n(
-                PIKA_FORWARD(ExPolicy, policy), first, count, val);
+            if constexpr (use_packed_bits_v<InIter> &&
+                std::is_convertible_v<T const&, bool>)
+            {
+                return sequential_packed_bits_fill(first, count, bool(val));
+            }
+            else
+            {
+                return detail::sequential_fill_n(
+                    PIKA_FORWARD(ExPolicy, policy), first, count, val);
+            }
         }
 
         template <typename ExPolicy, typename T>
         static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
             ExPolicy&& policy, FwdIter first, std::size_t count, T const& val)
         {
-            return for_each_n<FwdIter>().call(
-                PIKA_FORWARD(ExPolicy, policy), first, count,
-                [val](auto& v) -> void { v = val; }, projection_identity());
+            if constexpr (use_packed_bits_v<FwdIter> &&
+                std::is_convertible_v<T const&, bool>)
+            {
+                return parallel_packed_bits_fill(
+                    PIKA_FORWARD(ExPolicy, policy), first, count, bool(val));
+            }
+            else if constexpr (use_non_temporal_stores_for_v<ExPolicy, FwdIter>)
+            {
+                return fill_non_temporal(
+                    PIKA_FORWARD(ExPolicy, policy), first, count, val);
+            }
+            else if constexpr (is_byte_fill_v<FwdIter, T>)
+            {
+                return fill_bytes(
+                    PIKA_FORWARD(ExPolicy, policy), first, count, val);
+            }
+            else
+            {
+                return for_each_n<FwdIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    [val](auto& v) -> void { v = val; },
+                    projection_identity());
+            }
         }
     };
     /// \endcond
@@ -316,4 +418,118 @@ namespace pika {
     } fill_n{};
 }    // namespace pika
 
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // fill and fill_n of a random access range sent by a predecessor sender
+    // run as a bulk operation, see foreach_partition_sender. Every chunk is
+    // filled as by the sequential algorithm, with non-temporal stores or
+    // byte-wise where the policy and the value type allow it. Packed bits are
+    // left to the algorithm, whose chunks do not share words.
+    template <typename ExPolicy, typename FwdIter, typename T, typename F>
+    auto fill_sender(ExPolicy&& policy, FwdIter first, std::size_t count,
+        T const& val, F&& f)
+    {
+        using policy_type = std::decay_t<ExPolicy>;
+
+        return foreach_partition_sender(PIKA_FORWARD(ExPolicy, policy), first,
+            count,
+            [val](FwdIter part_begin, std::size_t part_size,
+                std::size_t) -> void {
+                if constexpr (use_non_temporal_stores_for_v<policy_type,
+                                  FwdIter>)
+                {
+                    non_temporal_fill(part_begin, part_size, val);
+                }
+                else if constexpr (is_byte_fill_v<FwdIter, T>)
+                {
+                    byte_fill(part_begin, part_size, val);
+                }
+                else
+                {
+                    std::fill_n(part_begin, part_size, val);
+                }
+            },
+            PIKA_FORWARD(F, f));
+    }
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_fill_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename T>
+    struct is_fill_sender_available<ExPolicy, FwdIter, FwdIter, T>
+      : std::bool_constant<use_partition_sender_v<ExPolicy> &&
+            pika::traits::is_random_access_iterator_v<FwdIter> &&
+            !pika::traits::has_packed_bits_v<FwdIter>>
+    {
+    };
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_fill_n_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Size, typename T>
+    struct is_fill_n_sender_available<ExPolicy, FwdIter, Size, T>
+      : std::bool_constant<use_partition_sender_v<ExPolicy> &&
+            pika::traits::is_random_access_iterator_v<FwdIter> &&
+            !pika::traits::has_packed_bits_v<FwdIter> &&
+            std::is_integral_v<Size>>
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_shape_preserving_algorithm<pika::fill_t> : std::true_type
+    {
+    };
+
+    template <>
+    struct algorithm_sender<pika::fill_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_fill_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter, typename T>
+        static auto call(
+            ExPolicy&& policy, FwdIter first, FwdIter last, T const& value)
+        {
+            return pika::parallel::detail::fill_sender(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                pika::parallel::detail::distance(first, last), value,
+                [](FwdIter) {});
+        }
+    };
+
+    template <>
+    struct algorithm_sender<pika::fill_n_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_fill_n_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter, typename Size,
+            typename T>
+        static auto call(
+            ExPolicy&& policy, FwdIter first, Size count, T const& value)
+        {
+            // if count is representing a negative value, we do nothing
+            return pika::parallel::detail::fill_sender(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                pika::parallel::detail::is_negative(count) ?
+                    std::size_t(0) :
+                    std::size_t(count),
+                value, [](FwdIter last) { return last; });
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #endif    // DOXYGEN
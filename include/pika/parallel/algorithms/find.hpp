@@ -273,6 +273,39 @@ namespace pika {
     find_end(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
         FwdIter2 first2, FwdIter2 last2, Pred&& op = Pred());
 
+    /// Searches the range [first, last) for the last occurrence of the
+    /// pattern the searcher has been constructed with, e.g. a
+    /// \a pika::boyer_moore_horspool_searcher. Searchers providing the length
+    /// of their pattern through a member function pattern_size() search the
+    /// chunks of the range concurrently, all other searchers are invoked on
+    /// the whole range by the calling thread.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     the searcher.
+    /// \tparam Searcher    The type of the searcher (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param searcher     The searcher invoked on subranges of
+    ///                     [first, last).
+    ///
+    /// \returns  The \a find_end algorithm returns a \a pika::future<FwdIter>
+    ///           if the execution policy is of type \a task_execution_policy
+    ///           and returns \a FwdIter otherwise. It returns an iterator to
+    ///           the beginning of the last occurrence of the pattern, \a last
+    ///           if the pattern is empty or not found.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Searcher>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    find_end(ExPolicy&& policy, FwdIter first, FwdIter last,
+        Searcher const& searcher);
+
     /// Searches the range [first, last) for any elements in the range [s_first, s_last).
     /// Uses binary predicate p to compare elements
     ///
@@ -385,13 +418,17 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/find.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/search.hpp>
 #include <pika/parallel/util/compare_projected.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/speculative_windows.hpp>
 #include <pika/parallel/util/invoke_projected.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/searchers.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -416,6 +453,15 @@ namespace pika::parallel::detail {
         static constexpr Iter sequential(
             ExPolicy, Iter first, Sent last, T const& val, Proj&& proj = Proj())
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_comparable_v<T>)
+            {
+                return std::next(first,
+                    sequential_packed_bits_find(first,
+                        detail::distance(first, last), bool(val == false),
+                        bool(val == true)));
+            }
+
             return sequential_find<ExPolicy>(
                 first, last, val, PIKA_FORWARD(Proj, proj));
         }
@@ -435,6 +481,15 @@ namespace pika::parallel::detail {
             if (count <= 0)
                 return result::get(PIKA_MOVE(last));
 
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_comparable_v<T>)
+            {
+                return parallel_packed_bits_find<ExPolicy, Iter>(
+                    PIKA_FORWARD(ExPolicy, policy), first, std::size_t(count),
+                    bool(val == false), bool(val == true),
+                    [first](std::size_t pos) { return std::next(first, pos); });
+            }
+
             util::cancellation_token<std::size_t> tok(count);
 
             // Note: replacing the invoke() with PIKA_INVOKE()
@@ -442,14 +497,23 @@ namespace pika::parallel::detail {
             auto f1 = [val, proj = PIKA_FORWARD(Proj, proj), tok](Iter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size, tok,
-                    [&val, &proj, &tok](
-                        type& v, std::size_t i) mutable -> void {
-                        if (pika::util::detail::invoke(proj, v) == val)
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                if constexpr (use_memchr_v<Iter, T, Proj>)
+                {
+                    sequential_find<std::decay_t<ExPolicy>>(
+                        base_idx, it, part_size, tok, val, proj);
+                }
+                else
+                {
+                    loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size,
+                        tok,
+                        [&val, &proj, &tok](
+                            type& v, std::size_t i) mutable -> void {
+                            if (pika::util::detail::invoke(proj, v) == val)
+                            {
+                                tok.cancel(i);
+                            }
+                        });
+                }
             };
 
             auto f2 =
@@ -473,9 +537,14 @@ namespace pika::parallel::detail {
                 return PIKA_MOVE(first);
             };
 
-            return partitioner<ExPolicy, Iter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy), first, count, 1, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+            decltype(auto) p = with_speculative_windows<Iter>(
+                PIKA_FORWARD(ExPolicy, policy), count);
+            return partitioner<decltype(p), Iter, void>::
+                call_with_index_cancellable(PIKA_FORWARD(decltype(p), p),
+                    first, count, 1, PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 
@@ -494,6 +563,16 @@ namespace pika::parallel::detail {
         static constexpr Iter
         sequential(ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                return std::next(first,
+                    sequential_packed_bits_find(first,
+                        detail::distance(first, last),
+                        bool(PIKA_INVOKE(f, false)),
+                        bool(PIKA_INVOKE(f, true))));
+            }
+
             return sequential_find_if<ExPolicy>(
                 first, last, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
@@ -513,6 +592,15 @@ namespace pika::parallel::detail {
             if (count <= 0)
                 return result::get(PIKA_MOVE(last));
 
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                return parallel_packed_bits_find<ExPolicy, Iter>(
+                    PIKA_FORWARD(ExPolicy, policy), first, std::size_t(count),
+                    bool(PIKA_INVOKE(f, false)), bool(PIKA_INVOKE(f, true)),
+                    [first](std::size_t pos) { return std::next(first, pos); });
+            }
+
             util::cancellation_token<std::size_t> tok(count);
 
             // Note: replacing the invoke() with PIKA_INVOKE()
@@ -551,9 +639,14 @@ namespace pika::parallel::detail {
                 return PIKA_MOVE(first);
             };
 
-            return partitioner<ExPolicy, Iter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy), first, count, 1, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+            decltype(auto) p = with_speculative_windows<Iter>(
+                PIKA_FORWARD(ExPolicy, policy), count);
+            return partitioner<decltype(p), Iter, void>::
+                call_with_index_cancellable(PIKA_FORWARD(decltype(p), p),
+                    first, count, 1, PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 
@@ -572,6 +665,15 @@ namespace pika::parallel::detail {
         static constexpr Iter
         sequential(ExPolicy, Iter first, Sent last, F&& f, Proj&& proj = Proj())
         {
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                return std::next(first,
+                    sequential_packed_bits_find(first,
+                        detail::distance(first, last), !PIKA_INVOKE(f, false),
+                        !PIKA_INVOKE(f, true)));
+            }
+
             return sequential_find_if_not<ExPolicy>(
                 first, last, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
@@ -591,6 +693,15 @@ namespace pika::parallel::detail {
             if (count <= 0)
                 return result::get(PIKA_MOVE(last));
 
+            if constexpr (use_packed_bits_v<Iter, Proj> &&
+                is_packed_bits_predicate_v<F>)
+            {
+                return parallel_packed_bits_find<ExPolicy, Iter>(
+                    PIKA_FORWARD(ExPolicy, policy), first, std::size_t(count),
+                    !PIKA_INVOKE(f, false), !PIKA_INVOKE(f, true),
+                    [first](std::size_t pos) { return std::next(first, pos); });
+            }
+
             util::cancellation_token<std::size_t> tok(count);
 
             // Note: replacing the invoke() with PIKA_INVOKE()
@@ -629,9 +740,14 @@ namespace pika::parallel::detail {
                 return PIKA_MOVE(first);
             };
 
-            return partitioner<ExPolicy, Iter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy), first, count, 1, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+            decltype(auto) p = with_speculative_windows<Iter>(
+                PIKA_FORWARD(ExPolicy, policy), count);
+            return partitioner<decltype(p), Iter, void>::
+                call_with_index_cancellable(PIKA_FORWARD(decltype(p), p),
+                    first, count, 1, PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 
@@ -805,6 +921,137 @@ namespace pika::parallel::detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // find_end with a searcher object
+
+    // Return the last occurrence of the pattern of the searcher in
+    // [first, last), or last if there is none
+    template <typename Iter, typename Searcher>
+    Iter sequential_find_end_searcher(
+        Iter first, Iter last, Searcher const& searcher)
+    {
+        Iter result = last;
+        while (true)
+        {
+            auto const found = searcher(first, last);
+            // no further match or an empty pattern
+            if (found.first == found.second)
+            {
+                break;
+            }
+            result = found.first;
+            first = std::next(found.first);
+        }
+        return result;
+    }
+
+    // Search the count candidate positions of a partition starting at
+    // base_idx with the searcher in blocks from the back and record the last
+    // match in tok. Blocks preceding a match found by another partition are
+    // skipped.
+    template <typename Iter, typename Token, typename Searcher>
+    void searcher_partition_last(Iter it, std::size_t count,
+        std::size_t base_idx, Token& tok, Searcher const& searcher,
+        std::size_t s_count)
+    {
+        for (std::size_t end = count; end != 0; /**/)
+        {
+            if (tok.was_cancelled(base_idx + end - 1))
+            {
+                break;
+            }
+
+            std::size_t const len = (std::min)(searcher_block_size, end);
+            Iter const block = std::next(it, end - len);
+            Iter const window_last = std::next(block, len + s_count - 1);
+            Iter const found =
+                sequential_find_end_searcher(block, window_last, searcher);
+            if (found != window_last)
+            {
+                tok.cancel(base_idx + end - len +
+                    static_cast<std::size_t>(std::distance(block, found)));
+                break;
+            }
+
+            end -= len;
+        }
+    }
+
+    template <typename FwdIter>
+    struct find_end_searcher
+      : public algorithm<find_end_searcher<FwdIter>, FwdIter>
+    {
+        find_end_searcher()
+          : find_end_searcher::algorithm("find_end")
+        {
+        }
+
+        template <typename ExPolicy, typename Searcher>
+        static FwdIter sequential(
+            ExPolicy, FwdIter first, FwdIter last, Searcher const& searcher)
+        {
+            return sequential_find_end_searcher(first, last, searcher);
+        }
+
+        template <typename ExPolicy, typename Searcher>
+        static typename algorithm_result<ExPolicy, FwdIter>::type
+        parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+            Searcher const& searcher)
+        {
+            using result_type = algorithm_result<ExPolicy, FwdIter>;
+
+            if constexpr (!pika::detail::is_parallel_searcher_v<Searcher>)
+            {
+                // the sequence can't be split without knowing the length of
+                // the pattern
+                return result_type::get(
+                    sequential_find_end_searcher(first, last, searcher));
+            }
+            else
+            {
+                using difference_type =
+                    typename std::iterator_traits<FwdIter>::difference_type;
+
+                std::size_t const s_count = searcher.pattern_size();
+                std::size_t const count = std::distance(first, last);
+                if (s_count == 0 || s_count > count)
+                {
+                    return result_type::get(PIKA_MOVE(last));
+                }
+
+                util::cancellation_token<difference_type,
+                    std::greater<difference_type>>
+                    tok(-1);
+
+                auto f1 = [tok, searcher, s_count](FwdIter it,
+                              std::size_t part_size,
+                              std::size_t base_idx) mutable -> void {
+                    searcher_partition_last(
+                        it, part_size, base_idx, tok, searcher, s_count);
+                };
+
+                auto f2 = [tok, first, last](
+                              std::vector<pika::future<void>>&& data) mutable
+                    -> FwdIter {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+
+                    difference_type const find_end_res = tok.get_data();
+                    if (find_end_res < 0)
+                    {
+                        return last;
+                    }
+                    return std::next(first, find_end_res);
+                };
+
+                return partitioner<ExPolicy, FwdIter, void>::call_with_index(
+                    PIKA_FORWARD(ExPolicy, policy), first, count - s_count + 1,
+                    1, PIKA_MOVE(f1), PIKA_MOVE(f2));
+            }
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // find_first_of
     template <typename FwdIter>
@@ -824,6 +1071,14 @@ namespace pika::parallel::detail {
             if (first == last)
                 return last;
 
+            if constexpr (is_sized_range_v<InIter1, InIter1>)
+            {
+                std::size_t const count = std::distance(first, last);
+                return std::next(first,
+                    sequential_find_first_of<std::decay_t<ExPolicy>>(
+                        first, count, s_first, s_last, op, proj1, proj2));
+            }
+
             compare_projected<Pred&, Proj1&, Proj2&> f(op, proj1, proj2);
             for (/* */; first != last; ++first)
             {
@@ -845,7 +1100,6 @@ namespace pika::parallel::detail {
             FwdIter2 s_last, Pred&& op, Proj1&& proj1, Proj2&& proj2)
         {
             using result = algorithm_result<ExPolicy, FwdIter>;
-            using reference = typename std::iterator_traits<FwdIter>::reference;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
             using s_difference_type =
@@ -866,19 +1120,27 @@ namespace pika::parallel::detail {
                           proj2 = PIKA_FORWARD(Proj2, proj2)](FwdIter it,
                           std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_size, tok,
-                    [&tok, &s_first, &s_last, &op, &proj1, &proj2](
-                        reference v, std::size_t i) mutable -> void {
-                        compare_projected<Pred&, Proj1&, Proj2&> f(
-                            op, proj1, proj2);
-                        for (FwdIter2 iter = s_first; iter != s_last; ++iter)
-                        {
-                            if (PIKA_INVOKE(f, v, *iter))
-                            {
-                                tok.cancel(i);
-                            }
-                        }
-                    });
+                for (std::size_t offset = 0; offset != part_size; /**/)
+                {
+                    if (tok.was_cancelled(base_idx + offset))
+                    {
+                        break;
+                    }
+
+                    std::size_t const len = (std::min)(
+                        find_first_of_block_size, part_size - offset);
+                    std::size_t const found =
+                        sequential_find_first_of<std::decay_t<ExPolicy>>(
+                            it, len, s_first, s_last, op, proj1, proj2);
+                    if (found != len)
+                    {
+                        tok.cancel(base_idx + offset + found);
+                        break;
+                    }
+
+                    std::advance(it, len);
+                    offset += len;
+                }
             };
 
             auto f2 =
@@ -902,9 +1164,12 @@ namespace pika::parallel::detail {
                 return PIKA_MOVE(first);
             };
 
-            return partitioner<ExPolicy, FwdIter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy), first, count, 1, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+            return partitioner<ExPolicy, FwdIter, void>::
+                call_with_index_cancellable(PIKA_FORWARD(ExPolicy, policy),
+                    first, count, 1, PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 }    // namespace pika::parallel::detail
@@ -1168,6 +1433,36 @@ namespace pika {
                 pika::parallel::detail::projection_identity(),
                 pika::parallel::detail::projection_identity());
         }
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(find_end_t, ExPolicy&& policy, FwdIter first,
+            FwdIter last, Searcher const& searcher)
+        {
+            return pika::parallel::detail::find_end_searcher<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, searcher);
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(
+            find_end_t, FwdIter first, FwdIter last, Searcher const& searcher)
+        {
+            return pika::parallel::detail::find_end_searcher<FwdIter>().call(
+                pika::execution::seq, first, last, searcher);
+        }
     } find_end{};
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,533 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/find_all.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Writes the positions of all elements of the range [first, last) for
+    /// which the predicate \a pred returns true to the range beginning at
+    /// \a dest, in increasing order.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first applications of the
+    ///         predicate.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a find_all requires \a Pred to meet
+    ///                     the requirements of \a CopyConstructible.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator,
+    ///                     a std::size_t has to be assignable to its elements.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         The unary predicate which returns true for the
+    ///                     elements whose position is written. The signature
+    ///                     of this predicate should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The predicate is applied once to each element, the positions are
+    /// collected by the chunks of the range and written to their final
+    /// location after an exclusive scan of the number of positions found by
+    /// each chunk.
+    ///
+    /// The invocations of \a pred in the parallel \a find_all algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a pred in the parallel \a find_all algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a find_all algorithm returns a \a pika::future<FwdIter2>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter2 otherwise.
+    ///           It returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename Pred,
+        typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    find_all(ExPolicy&& policy, FwdIter1 first, FwdIter1 last, Pred&& pred,
+        FwdIter2 dest);
+
+    /// Writes the positions of all, possibly overlapping, occurrences of the
+    /// sequence [s_first, s_last) in the range [first, last) to the range
+    /// beginning at \a dest, in increasing order. An empty sequence is not
+    /// searched for and no position is written.
+    ///
+    /// \note   Complexity: at most (S*N) comparisons where
+    ///         \a S = distance(s_first, s_last) and
+    ///         \a N = distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used for the
+    ///                     range searched in (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator.
+    /// \tparam FwdIter2    The type of the source iterators used for the
+    ///                     sequence searched for (deduced). This iterator
+    ///                     type must meet the requirements of a forward
+    ///                     iterator.
+    /// \tparam FwdIter3    The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator,
+    ///                     a std::size_t has to be assignable to its elements.
+    /// \tparam Pred        The type of an optional function/function object to
+    ///                     use. This defaults to std::equal_to<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param s_first      Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be searching for.
+    /// \param s_last       Refers to the end of the sequence of elements the
+    ///                     algorithm will be searching for.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param op           Refers to the binary predicate which returns true
+    ///                     if the elements should be treated as equal. The
+    ///                     signature of the function should be equivalent to
+    ///                     \code
+    ///                     bool pred(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///
+    /// The comparison operations in the parallel \a search_all algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a search_all algorithm returns a
+    ///           \a pika::future<FwdIter3> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter3 otherwise.
+    ///           It returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename FwdIter3, typename Pred = detail::equal_to>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter3>::type
+    search_all(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        FwdIter2 s_first, FwdIter2 s_last, FwdIter3 dest, Pred&& op = Pred());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/search.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/compaction_staging.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // find_all, search_all
+    /// \cond NOINTERNAL
+
+    // Write the positions reported by find(it, count, base_idx, positions)
+    // for the count elements starting at first to dest. Step 1 of the scan
+    // collects the positions of each chunk, step 3 writes them to the
+    // location given by the exclusive scan of the number of positions found
+    // by the chunks to its left.
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename F>
+    typename algorithm_result<ExPolicy, FwdIter2>::type find_all_positions(
+        ExPolicy&& policy, FwdIter1 first, std::size_t count, FwdIter2 dest,
+        F&& find)
+    {
+        using zip_iterator = pika::util::zip_iterator<FwdIter1,
+            pika::util::counting_iterator<std::size_t>>;
+        using scan_partitioner_type =
+            scan_partitioner<ExPolicy, FwdIter2, std::size_t>;
+
+        using pika::util::make_zip_iterator;
+        using std::get;
+
+        compaction_staging<std::size_t> staging;
+
+        auto f1 = [find = PIKA_FORWARD(F, find), staging](
+                      zip_iterator part_begin,
+                      std::size_t part_size) mutable -> std::size_t {
+            auto iters = part_begin.get_iterator_tuple();
+            std::size_t const base_idx = *get<1>(iters);
+
+            std::vector<std::size_t> positions;
+            find(get<0>(iters), part_size, base_idx, positions);
+
+            std::size_t const curr = positions.size();
+            staging.put(base_idx, PIKA_MOVE(positions));
+            return curr;
+        };
+        auto f3 = [dest, staging](zip_iterator part_begin, std::size_t,
+                      std::size_t val) mutable {
+            std::advance(dest, val);
+            for (std::size_t pos :
+                staging.take(*get<1>(part_begin.get_iterator_tuple())))
+            {
+                *dest++ = pos;
+            }
+        };
+
+        auto f4 = [dest](std::vector<std::size_t>&& items,
+                      std::vector<pika::future<void>>&& data) mutable
+            -> FwdIter2 {
+            // make sure iterators embedded in function object that is
+            // attached to futures are invalidated
+            data.clear();
+
+            std::advance(dest, items.back());
+            return dest;
+        };
+
+        return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
+            make_zip_iterator(
+                first, pika::util::make_counting_iterator(std::size_t(0))),
+            count, std::size_t(0), PIKA_MOVE(f1), std::plus<std::size_t>(),
+            PIKA_MOVE(f3), PIKA_MOVE(f4));
+    }
+
+    template <typename FwdIter2>
+    struct find_all : public algorithm<find_all<FwdIter2>, FwdIter2>
+    {
+        find_all()
+          : find_all::algorithm("find_all")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename Proj>
+        static FwdIter2 sequential(ExPolicy, FwdIter1 first, FwdIter1 last,
+            Pred&& pred, FwdIter2 dest, Proj&& proj)
+        {
+            for (std::size_t pos = 0; first != last; (void) ++first, ++pos)
+            {
+                if (PIKA_INVOKE(pred, PIKA_INVOKE(proj, *first)))
+                {
+                    *dest++ = pos;
+                }
+            }
+            return dest;
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            Pred&& pred, FwdIter2 dest, Proj&& proj)
+        {
+            using result = algorithm_result<ExPolicy, FwdIter2>;
+
+            std::size_t const count = detail::distance(first, last);
+
+            // small inputs are not worth collecting the positions by chunks
+            if (count < flag_buffer_sequential_limit)
+            {
+                return result::get(sequential(policy, first, last,
+                    PIKA_FORWARD(Pred, pred), dest, PIKA_FORWARD(Proj, proj)));
+            }
+
+            // Note: replacing the invoke() with PIKA_INVOKE()
+            // below makes gcc generate errors
+            auto find = [pred = PIKA_FORWARD(Pred, pred),
+                            proj = PIKA_FORWARD(Proj, proj)](FwdIter1 it,
+                            std::size_t part_size, std::size_t base_idx,
+                            std::vector<std::size_t>& positions) mutable {
+                for (std::size_t i = 0; i != part_size; (void) ++i, ++it)
+                {
+                    if (pika::util::detail::invoke(
+                            pred, pika::util::detail::invoke(proj, *it)))
+                    {
+                        positions.push_back(base_idx + i);
+                    }
+                }
+            };
+
+            return find_all_positions(PIKA_FORWARD(ExPolicy, policy), first,
+                count, dest, PIKA_MOVE(find));
+        }
+    };
+
+    template <typename FwdIter3>
+    struct search_all : public algorithm<search_all<FwdIter3>, FwdIter3>
+    {
+        search_all()
+          : search_all::algorithm("search_all")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred, typename Proj1, typename Proj2>
+        static FwdIter3 sequential(ExPolicy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 s_first, FwdIter2 s_last, FwdIter3 dest, Pred&& op,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            std::size_t const s_count = detail::distance(s_first, s_last);
+            std::size_t const count = detail::distance(first, last);
+            if (s_count == 0 || s_count > count)
+            {
+                return dest;
+            }
+
+            std::size_t const candidates = count - (s_count - 1);
+            for (std::size_t pos = 0; pos != candidates; /**/)
+            {
+                std::size_t const found =
+                    sequential_search_n<std::decay_t<ExPolicy>>(first,
+                        candidates - pos, s_first, s_count, op, proj1, proj2);
+                if (found == candidates - pos)
+                {
+                    break;
+                }
+
+                *dest++ = pos + found;
+                std::advance(first, found + 1);
+                pos += found + 1;
+            }
+            return dest;
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred, typename Proj1, typename Proj2>
+        static typename algorithm_result<ExPolicy, FwdIter3>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 s_first, FwdIter2 s_last, FwdIter3 dest, Pred&& op,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            using result = algorithm_result<ExPolicy, FwdIter3>;
+
+            std::size_t const s_count = detail::distance(s_first, s_last);
+            std::size_t const count = detail::distance(first, last);
+            if (s_count == 0 || s_count > count)
+            {
+                return result::get(PIKA_MOVE(dest));
+            }
+
+            std::size_t const candidates = count - (s_count - 1);
+            if (candidates < flag_buffer_sequential_limit)
+            {
+                return result::get(sequential(policy, first, last, s_first,
+                    s_last, dest, PIKA_FORWARD(Pred, op),
+                    PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2)));
+            }
+
+            // the chunks examine the candidate positions, the elements of
+            // the last occurrences of a chunk extend into the next chunk
+            auto find = [s_first, s_count, op = PIKA_FORWARD(Pred, op),
+                            proj1 = PIKA_FORWARD(Proj1, proj1),
+                            proj2 = PIKA_FORWARD(Proj2, proj2)](FwdIter1 it,
+                            std::size_t part_size, std::size_t base_idx,
+                            std::vector<std::size_t>& positions) mutable {
+                for (std::size_t pos = 0; pos != part_size; /**/)
+                {
+                    std::size_t const found =
+                        sequential_search_n<std::decay_t<ExPolicy>>(it,
+                            part_size - pos, s_first, s_count, op, proj1,
+                            proj2);
+                    if (found == part_size - pos)
+                    {
+                        break;
+                    }
+
+                    positions.push_back(base_idx + pos + found);
+                    std::advance(it, found + 1);
+                    pos += found + 1;
+                }
+            };
+
+            return find_all_positions(PIKA_FORWARD(ExPolicy, policy), first,
+                candidates, dest, PIKA_MOVE(find));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::find_all
+    inline constexpr struct find_all_t final
+      : pika::detail::tag_parallel_algorithm<find_all_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::find_all_t, ExPolicy&& policy,
+            FwdIter1 first, FwdIter1 last, Pred&& pred, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter2> ||
+                    (pika::is_sequenced_execution_policy_v<ExPolicy> &&
+                        pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least forward iterator or sequential execution.");
+
+            return pika::parallel::detail::find_all<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                PIKA_FORWARD(Pred, pred), dest,
+                pika::parallel::detail::projection_identity{});
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename Pred, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(pika::find_all_t, FwdIter1 first,
+            FwdIter1 last, Pred&& pred, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::find_all<FwdIter2>().call(
+                pika::execution::seq, first, last, PIKA_FORWARD(Pred, pred),
+                dest, pika::parallel::detail::projection_identity{});
+        }
+    } find_all{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::search_all
+    inline constexpr struct search_all_t final
+      : pika::detail::tag_parallel_algorithm<search_all_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename FwdIter3, typename Pred = parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter3>::type
+        tag_fallback_invoke(pika::search_all_t, ExPolicy&& policy,
+            FwdIter1 first, FwdIter1 last, FwdIter2 s_first, FwdIter2 s_last,
+            FwdIter3 dest, Pred&& op = Pred())
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter3> ||
+                    (pika::is_sequenced_execution_policy_v<ExPolicy> &&
+                        pika::traits::is_output_iterator_v<FwdIter3>),
+                "Requires at least forward iterator or sequential execution.");
+
+            return pika::parallel::detail::search_all<FwdIter3>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, s_first, s_last,
+                dest, PIKA_FORWARD(Pred, op),
+                pika::parallel::detail::projection_identity{},
+                pika::parallel::detail::projection_identity{});
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename FwdIter3,
+            typename Pred = parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter3 tag_fallback_invoke(pika::search_all_t,
+            FwdIter1 first, FwdIter1 last, FwdIter2 s_first, FwdIter2 s_last,
+            FwdIter3 dest, Pred&& op = Pred())
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_output_iterator_v<FwdIter3>),
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::search_all<FwdIter3>().call(
+                pika::execution::seq, first, last, s_first, s_last, dest,
+                PIKA_FORWARD(Pred, op),
+                pika::parallel::detail::projection_identity{},
+                pika::parallel::detail::projection_identity{});
+        }
+    } search_all{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -70,7 +70,7 @@ namespace pika {
     ///                     in which it applies user-provided function objects.
     /// \tparam FwdIte      The type of the source begin and end iterator used
     ///                     (deduced). This iterator type must meet the
-    ///                     requirements of an forward iterator.
+    ///                     requirements of an input iterator.
     /// \tparam F           The type of the function/function object to use
     ///                     (deduced). Unlike its sequential form, the parallel
     ///                     overload of \a for_each requires \a F to meet the
@@ -106,6 +106,10 @@ namespace pika {
     /// permitted to execute in an unordered fashion in unspecified
     /// threads, and indeterminately sequenced within each thread.
     ///
+    /// Single pass ranges (input iterators) are read by the calling thread
+    /// in batches of elements, \a f is applied to copies of the elements
+    /// of a batch by the workers while the next batches are read.
+    ///
     /// \returns  The \a for_each algorithm returns a
     ///           \a pika::future<void> if the execution policy is of
     ///           type
@@ -235,6 +239,7 @@ namespace pika {
 #else
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/detail/invoke.hpp>
@@ -244,6 +249,8 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/batch_partitioner.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
@@ -296,6 +303,35 @@ namespace pika::parallel::detail {
         }
     };
 
+    // Calls f with the iterators to the count elements starting at it, the
+    // blocks of segmented iterators are run over one by one through plain
+    // pointers, see pika::traits::contiguous_segments.
+    template <typename ExPolicy, typename Iter, typename F>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr Iter for_each_loop_n(
+        Iter it, std::size_t count, F&& f)
+    {
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            return pika::detail::for_each_contiguous_segment(it, count,
+                [&](auto* segment, std::size_t size) {
+                    return loop_n<ExPolicy>(segment, size, f);
+                });
+        }
+        else
+        {
+            return loop_n<ExPolicy>(it, count, PIKA_FORWARD(F, f));
+        }
+    }
+
+    // Whether the chunks of for_each can't throw: f doesn't throw for the
+    // elements. Vector packs are not considered, f may handle them
+    // differently.
+    template <typename ExPolicy, typename F, typename Iter>
+    inline constexpr bool is_nothrow_for_each_iteration_v =
+        !pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+        std::is_nothrow_invocable_v<F&,
+            typename std::iterator_traits<Iter>::reference>;
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename F,
         typename Proj = projection_identity>
@@ -338,7 +374,7 @@ namespace pika::parallel::detail {
         PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
         operator()(Iter part_begin, std::size_t part_size, std::size_t)
         {
-            loop_n<execution_policy_type>(part_begin, part_size,
+            for_each_loop_n<execution_policy_type>(part_begin, part_size,
                 for_each_invoke_projected<fun_type, proj_type>{f_, proj_});
         }
     };
@@ -382,9 +418,13 @@ namespace pika::parallel::detail {
         for_each_iteration& operator=(for_each_iteration const&) = default;
         for_each_iteration& operator=(for_each_iteration&&) = default;
 
+        // noexcept lets the partitioner skip collecting the exceptions of
+        // the chunks
         template <typename Iter>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
-        operator()(Iter part_begin, std::size_t part_size, std::size_t)
+        operator()(Iter part_begin, std::size_t part_size,
+            std::size_t) noexcept(is_nothrow_for_each_iteration_v<
+            execution_policy_type, fun_type, Iter>)
         {
             loop_n_ind<execution_policy_type>(part_begin, part_size, f_);
         }
@@ -403,7 +443,7 @@ namespace pika::parallel::detail {
         PIKA_HOST_DEVICE static constexpr Iter sequential(
             ExPolicy&&, InIter first, std::size_t count, F&& f, Proj&& proj)
         {
-            return loop_n<std::decay_t<ExPolicy>>(first, count,
+            return for_each_loop_n<std::decay_t<ExPolicy>>(first, count,
                 for_each_invoke_projected<F, std::decay_t<Proj>>{f, proj});
         }
 
@@ -455,7 +495,7 @@ namespace pika::parallel::detail {
             if constexpr (pika::traits::is_random_access_iterator_v<InIterB>)
             {
                 PIKA_UNUSED(policy);
-                return loop_n<std::decay_t<ExPolicy>>(first,
+                return for_each_loop_n<std::decay_t<ExPolicy>>(first,
                     static_cast<std::size_t>(detail::distance(first, last)),
                     for_each_invoke_projected<F, std::decay_t<Proj>>{f, proj});
             }
@@ -496,10 +536,25 @@ namespace pika::parallel::detail {
                 auto f1 = for_each_iteration<ExPolicy, F, std::decay_t<Proj>>(
                     PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
 
-                return foreach_partitioner<ExPolicy>::call(
-                    PIKA_FORWARD(ExPolicy, policy), first,
-                    detail::distance(first, last), PIKA_MOVE(f1),
-                    projection_identity());
+                if constexpr (!pika::traits::is_forward_iterator_v<FwdIterB>)
+                {
+                    // single pass ranges are read in batches of elements,
+                    // f is invoked with the elements of the batches
+                    return batch_partitioner<std::decay_t<ExPolicy>, FwdIterB,
+                        void>::call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                        [f1 = PIKA_MOVE(f1)](auto part_begin,
+                            std::size_t part_size) mutable {
+                            f1(part_begin, part_size, 0);
+                        },
+                        [](FwdIterB it) { return it; });
+                }
+                else
+                {
+                    return foreach_partitioner<ExPolicy>::call(
+                        PIKA_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), PIKA_MOVE(f1),
+                        projection_identity());
+                }
             }
 
             return algorithm_result<ExPolicy, FwdIterB>::get(PIKA_MOVE(first));
@@ -554,8 +609,8 @@ namespace pika {
         tag_fallback_invoke(pika::for_each_t, ExPolicy&& policy, FwdIter first,
             FwdIter last, F&& f)
         {
-            static_assert((pika::traits::is_forward_iterator<FwdIter>::value),
-                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_input_iterator<FwdIter>::value),
+                "Requires at least input iterator.");
 
             if (first == last)
             {
@@ -630,6 +685,95 @@ namespace pika {
     } for_each_n{};
 }    // namespace pika
 
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // for_each and for_each_n of a random access range sent by a predecessor
+    // sender run as a bulk operation, see foreach_partition_sender.
+    template <typename ExPolicy, typename FwdIter>
+    inline constexpr bool use_for_each_sender_v =
+        use_partition_sender_v<ExPolicy> &&
+        pika::traits::is_random_access_iterator_v<FwdIter>;
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_for_each_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename F>
+    struct is_for_each_sender_available<ExPolicy, FwdIter, FwdIter, F>
+      : std::bool_constant<use_for_each_sender_v<ExPolicy, FwdIter>>
+    {
+    };
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_for_each_n_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename Size, typename F>
+    struct is_for_each_n_sender_available<ExPolicy, FwdIter, Size, F>
+      : std::bool_constant<use_for_each_sender_v<ExPolicy, FwdIter> &&
+            std::is_integral_v<Size>>
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_shape_preserving_algorithm<pika::for_each_t> : std::true_type
+    {
+    };
+
+    template <>
+    struct algorithm_sender<pika::for_each_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_for_each_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter, typename F>
+        static auto call(ExPolicy&& policy, FwdIter first, FwdIter last, F f)
+        {
+            using f1_type = pika::parallel::detail::for_each_iteration<ExPolicy,
+                F, pika::parallel::detail::projection_identity>;
+
+            return pika::parallel::detail::foreach_partition_sender(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                pika::parallel::detail::distance(first, last),
+                f1_type(PIKA_MOVE(f)), [](FwdIter) {});
+        }
+    };
+
+    template <>
+    struct algorithm_sender<pika::for_each_n_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_for_each_n_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter, typename Size,
+            typename F>
+        static auto call(ExPolicy&& policy, FwdIter first, Size count, F f)
+        {
+            using f1_type = pika::parallel::detail::for_each_iteration<ExPolicy,
+                F, pika::parallel::detail::projection_identity>;
+
+            // if count is representing a negative value, we do nothing
+            return pika::parallel::detail::foreach_partition_sender(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                pika::parallel::detail::is_negative(count) ?
+                    std::size_t(0) :
+                    std::size_t(count),
+                f1_type(PIKA_MOVE(f)), [](FwdIter last) { return last; });
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #if defined(PIKA_HAVE_THREAD_DESCRIPTION)
 namespace pika::detail {
     template <typename ExPolicy, typename F, typename Proj>
@@ -170,6 +170,15 @@ namespace pika {
     ///
     /// Remarks: If \a f returns a result, the result is ignored.
     ///
+    /// \note Under the vectorpack policies (\a simd and \a par_simd), if
+    ///       \a I is an integral type or a random access iterator to an
+    ///       arithmetic type and all inductions and reductions have
+    ///       arithmetic value types, \a f is invoked for packs of
+    ///       consecutive iterations at once. It receives a pack of indices
+    ///       (or a pointer to a pack of elements), a pack of induction values
+    ///       and a reference to a pack of per-lane views for each reduction,
+    ///       all having the same number of elements.
+    ///
     /// \returns  The \a for_loop algorithm returns a
     ///           \a pika::future<void> if the execution policy is of
     ///           type
@@ -734,6 +743,7 @@ namespace pika {
 #include <pika/assert.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/modules/executors.hpp>
 #include <pika/modules/threading_base.hpp>
@@ -802,6 +812,58 @@ namespace pika {
             (void) _sequencer;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Run count iterations with unit stride starting at first, passing
+        // the values of the induction and reduction objects args to f. The
+        // vectorpack policies overload this to invoke f for whole packs of
+        // iterations at once (see datapar/for_loop.hpp).
+        template <typename B, typename F, typename... Ts, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
+        sequential_for_loop_iterations(B first, std::size_t count, F&& f,
+            std::tuple<Ts...>& args,
+            pika::util::detail::index_pack<Is...> pack)
+        {
+            while (count-- != 0)
+            {
+                invoke_iteration(args, pack, f, first++);
+                next_iteration(args, pack);
+            }
+        }
+
+        template <typename ExPolicy>
+        struct for_loop_iterations_t final
+          : pika::functional::detail::tag_fallback<
+                for_loop_iterations_t<ExPolicy>>
+        {
+        private:
+            template <typename B, typename F, typename... Ts,
+                std::size_t... Is>
+            friend PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
+            tag_fallback_invoke(for_loop_iterations_t<ExPolicy>, B first,
+                std::size_t count, F&& f, std::tuple<Ts...>& args,
+                pika::util::detail::index_pack<Is...> pack)
+            {
+                sequential_for_loop_iterations(
+                    first, count, PIKA_FORWARD(F, f), args, pack);
+            }
+        };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+        template <typename ExPolicy>
+        inline constexpr for_loop_iterations_t<ExPolicy> for_loop_iterations =
+            for_loop_iterations_t<ExPolicy>{};
+#else
+        template <typename ExPolicy, typename B, typename F, typename... Ts,
+            std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void for_loop_iterations(
+            B first, std::size_t count, F&& f, std::tuple<Ts...>& args,
+            pika::util::detail::index_pack<Is...> pack)
+        {
+            for_loop_iterations_t<ExPolicy>{}(
+                first, count, PIKA_FORWARD(F, f), args, pack);
+        }
+#endif
+
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename F, typename S,
             typename Tuple = std::tuple<>>
@@ -835,11 +897,8 @@ namespace pika {
 
                 if (stride_ == 1)
                 {
-                    while (part_steps-- != 0)
-                    {
-                        invoke_iteration(args_, pack, f_, part_begin++);
-                        next_iteration(args_, pack);
-                    }
+                    for_loop_iterations<std::decay_t<ExPolicy>>(
+                        part_begin, part_steps, f_, args_, pack);
                 }
                 else if (stride_ > 0)
                 {
@@ -1024,7 +1083,16 @@ namespace pika {
                 (void) init_sequencer;
 
                 std::size_t count = size;
-                if (stride > 0)
+                if (stride == 1)
+                {
+                    auto all_args = std::tie(arg, args...);
+                    for_loop_iterations<std::decay_t<ExPolicy>>(first, count,
+                        f, all_args,
+                        typename pika::util::detail::make_index_pack<
+                            sizeof...(Args) + 1>::type());
+                    count = 0;
+                }
+                else if (stride > 0)
                 {
                     while (count >= std::size_t(stride))
                     {
@@ -127,6 +127,12 @@ namespace pika {
                 curr_ = parallel::detail::next(curr_, stride_);
             }
 
+            PIKA_HOST_DEVICE
+            constexpr std::size_t stride() const noexcept
+            {
+                return stride_;
+            }
+
             PIKA_HOST_DEVICE
             constexpr void exit_iteration(std::size_t /*index*/) noexcept {}
 
@@ -166,6 +172,12 @@ namespace pika {
                 curr_ = parallel::detail::next(curr_, stride_);
             }
 
+            PIKA_HOST_DEVICE
+            constexpr std::size_t stride() const noexcept
+            {
+                return stride_;
+            }
+
             PIKA_HOST_DEVICE
             constexpr void exit_iteration(std::size_t index) noexcept
             {
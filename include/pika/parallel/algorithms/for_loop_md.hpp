@@ -0,0 +1,506 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_md.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/type_support/pack.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/for_loop.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    /// The order in which \a for_loop_md visits the tiles of a
+    /// multidimensional range. The points within a tile are always visited
+    /// in row-major order.
+    enum class md_tile_order
+    {
+        /// row-major order of the tiles, the last dimension varies fastest
+        row_major,
+        /// Z-order: the bits of the tile coordinates are interleaved
+        morton,
+        /// Hilbert curve for two-dimensional ranges, neighboring tiles are
+        /// visited one after the other. Ranges of other ranks use the
+        /// Morton order.
+        hilbert
+    };
+
+    /// A rectangular index space [first[0], last[0]) x ... x
+    /// [first[N - 1], last[N - 1]) split into tiles of tile[0] x ... x
+    /// tile[N - 1] points for \a for_loop_md. The last dimension is the
+    /// innermost one. A tile size of zero selects the full extent for the
+    /// last dimension and one for all others, by default the tiles are
+    /// single rows.
+    ///
+    /// \tparam I   The integral type of the indices.
+    /// \tparam N   The number of dimensions.
+    template <typename I, std::size_t N>
+    class md_range
+    {
+        static_assert(std::is_integral_v<I>, "Requires an integral type.");
+        static_assert(N != 0, "Requires at least one dimension.");
+
+    public:
+        md_range(std::array<I, N> const& first, std::array<I, N> const& last,
+            std::array<std::size_t, N> const& tile = {},
+            md_tile_order order = md_tile_order::row_major)
+          : first_(first)
+          , last_(last)
+          , tile_(tile)
+          , order_(order)
+        {
+        }
+
+        std::array<I, N> const& first() const noexcept
+        {
+            return first_;
+        }
+
+        std::array<I, N> const& last() const noexcept
+        {
+            return last_;
+        }
+
+        std::array<std::size_t, N> const& tile() const noexcept
+        {
+            return tile_;
+        }
+
+        md_tile_order order() const noexcept
+        {
+            return order_;
+        }
+
+    private:
+        std::array<I, N> first_;
+        std::array<I, N> last_;
+        std::array<std::size_t, N> tile_;
+        md_tile_order order_;
+    };
+
+    namespace parallel::detail {
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        // Z-order key of the tile with the given coordinates, the bits of
+        // the last dimension are the least significant ones of each group.
+        template <std::size_t N>
+        std::uint64_t md_morton_key(std::array<std::size_t, N> const& coord)
+        {
+            std::uint64_t key = 0;
+            std::size_t bit = 0;
+            for (std::size_t b = 0; bit < 64; ++b)
+            {
+                for (std::size_t d = N; d != 0 && bit < 64; --d, ++bit)
+                {
+                    key |= std::uint64_t((coord[d - 1] >> b) & 1) << bit;
+                }
+            }
+            return key;
+        }
+
+        // Position of (x, y) along the Hilbert curve filling the n x n grid,
+        // n is a power of two.
+        inline std::uint64_t md_hilbert_key(
+            std::size_t n, std::size_t x, std::size_t y)
+        {
+            std::uint64_t key = 0;
+            for (std::size_t s = n / 2; s != 0; s /= 2)
+            {
+                std::size_t const rx = (x & s) != 0;
+                std::size_t const ry = (y & s) != 0;
+                key += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+
+                // rotate the quadrant to the orientation of the curve
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = n - 1 - x;
+                        y = n - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return key;
+        }
+
+        // The extents of the range and its tiles, the tiles are numbered in
+        // row-major order. order lists the tiles in the order they are
+        // visited, it is empty for the row-major order.
+        template <typename I, std::size_t N>
+        struct md_tiling
+        {
+            explicit md_tiling(md_range<I, N> const& r)
+              : first(r.first())
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    extent[d] = r.last()[d] > r.first()[d] ?
+                        static_cast<std::size_t>(r.last()[d] - r.first()[d]) :
+                        0;
+                    if (r.tile()[d] != 0)
+                    {
+                        tile[d] = r.tile()[d];
+                    }
+                    else
+                    {
+                        tile[d] = d == N - 1 ?
+                            (std::max)(extent[d], std::size_t(1)) :
+                            1;
+                    }
+                    tiles[d] = (extent[d] + tile[d] - 1) / tile[d];
+                }
+
+                size = 1;
+                num_tiles = 1;
+                for (std::size_t d = N; d != 0; --d)
+                {
+                    pitch[d - 1] = size;
+                    size *= extent[d - 1];
+                    num_tiles *= tiles[d - 1];
+                }
+
+                if (size != 0 && r.order() != md_tile_order::row_major)
+                {
+                    init_order(r.order());
+                }
+            }
+
+            std::size_t tile_id(std::size_t ordinal) const noexcept
+            {
+                return order.empty() ? ordinal : order[ordinal];
+            }
+
+            std::array<I, N> first;
+            std::array<std::size_t, N> extent;
+            std::array<std::size_t, N> tile;
+            std::array<std::size_t, N> tiles;
+            std::array<std::size_t, N> pitch;    // row-major strides
+            std::size_t size;
+            std::size_t num_tiles;
+            std::vector<std::size_t> order;
+
+        private:
+            void init_order(md_tile_order tile_order)
+            {
+                std::size_t n = 1;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    while (n < tiles[d])
+                    {
+                        n *= 2;
+                    }
+                }
+
+                std::vector<std::pair<std::uint64_t, std::size_t>> keys(
+                    num_tiles);
+                for (std::size_t id = 0; id != num_tiles; ++id)
+                {
+                    std::array<std::size_t, N> coord;
+                    std::size_t rest = id;
+                    for (std::size_t d = N; d != 0; --d)
+                    {
+                        coord[d - 1] = rest % tiles[d - 1];
+                        rest /= tiles[d - 1];
+                    }
+
+                    if constexpr (N == 2)
+                    {
+                        if (tile_order == md_tile_order::hilbert)
+                        {
+                            keys[id] = std::make_pair(
+                                md_hilbert_key(n, coord[0], coord[1]), id);
+                            continue;
+                        }
+                    }
+                    keys[id] = std::make_pair(md_morton_key(coord), id);
+                }
+                std::sort(keys.begin(), keys.end());
+
+                order.resize(num_tiles);
+                for (std::size_t i = 0; i != num_tiles; ++i)
+                {
+                    order[i] = keys[i].second;
+                }
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F, typename I, std::size_t N, typename... Ts,
+            std::size_t... Is, std::size_t... Js>
+        PIKA_FORCEINLINE constexpr void invoke_md_iteration(F& f,
+            std::array<I, N> const& first,
+            std::array<std::size_t, N> const& idx, std::tuple<Ts...>& args,
+            pika::util::detail::index_pack<Is...>,
+            pika::util::detail::index_pack<Js...>)
+        {
+            PIKA_INVOKE(f, static_cast<I>(first[Is] + idx[Is])...,
+                std::get<Js>(args).iteration_value()...);
+        }
+
+        // Iterates over the points of the tiles with the given ordinals.
+        // Every row of a tile restarts the inductions at the row-major
+        // ordinal of its first point.
+        template <typename F, typename I, std::size_t N, typename... Ts>
+        struct md_tile_iterations
+        {
+            using fun_type = std::decay_t<F>;
+
+            fun_type f_;
+            std::shared_ptr<md_tiling<I, N> const> tiling_;
+            std::tuple<Ts...> args_;
+
+            template <typename F_, typename Args>
+            md_tile_iterations(F_&& f,
+                std::shared_ptr<md_tiling<I, N> const> tiling, Args&& args)
+              : f_(PIKA_FORWARD(F_, f))
+              , tiling_(PIKA_MOVE(tiling))
+              , args_(PIKA_FORWARD(Args, args))
+            {
+            }
+
+            void operator()(
+                std::size_t part_begin, std::size_t part_steps, std::size_t)
+            {
+                for (/**/; part_steps != 0; --part_steps, ++part_begin)
+                {
+                    iterate_tile(tiling_->tile_id(part_begin));
+                }
+            }
+
+        private:
+            void iterate_tile(std::size_t id)
+            {
+                md_tiling<I, N> const& t = *tiling_;
+
+                std::array<std::size_t, N> lo;
+                std::array<std::size_t, N> hi;
+                for (std::size_t d = N; d != 0; --d)
+                {
+                    std::size_t const coord = id % t.tiles[d - 1];
+                    id /= t.tiles[d - 1];
+                    lo[d - 1] = coord * t.tile[d - 1];
+                    hi[d - 1] =
+                        (std::min)(lo[d - 1] + t.tile[d - 1], t.extent[d - 1]);
+                }
+
+                auto indices =
+                    typename pika::util::detail::make_index_pack<N>::type();
+                auto pack = typename pika::util::detail::make_index_pack<
+                    sizeof...(Ts)>::type();
+
+                std::array<std::size_t, N> idx = lo;
+                while (true)
+                {
+                    std::size_t ordinal = 0;
+                    for (std::size_t d = 0; d != N; ++d)
+                    {
+                        ordinal += idx[d] * t.pitch[d];
+                    }
+                    init_iteration(args_, pack, ordinal);
+
+                    for (/**/; idx[N - 1] != hi[N - 1]; ++idx[N - 1])
+                    {
+                        invoke_md_iteration(
+                            f_, t.first, idx, args_, indices, pack);
+                        next_iteration(args_, pack);
+                    }
+                    idx[N - 1] = lo[N - 1];
+
+                    // advance to the next row of the tile
+                    std::size_t d = N - 1;
+                    while (true)
+                    {
+                        if (d == 0)
+                        {
+                            return;
+                        }
+                        --d;
+                        if (++idx[d] != hi[d])
+                        {
+                            break;
+                        }
+                        idx[d] = lo[d];
+                    }
+                }
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct for_loop_md_algo : public algorithm<for_loop_md_algo>
+        {
+            constexpr for_loop_md_algo() noexcept
+              : for_loop_md_algo::algorithm("for_loop_md")
+            {
+            }
+
+            template <typename ExPolicy, typename I, std::size_t N,
+                typename F, typename... Args>
+            static pika::util::detail::unused_type sequential(ExPolicy&&,
+                std::shared_ptr<md_tiling<I, N> const> tiling, F&& f,
+                Args&&... args)
+            {
+                using args_type = std::tuple<std::decay_t<Args>...>;
+
+                std::size_t const num_tiles = tiling->num_tiles;
+                std::size_t const size = tiling->size;
+
+                md_tile_iterations<F, I, N, std::decay_t<Args>...> iterations(
+                    PIKA_FORWARD(F, f), PIKA_MOVE(tiling),
+                    args_type(PIKA_FORWARD(Args, args)...));
+                if (size != 0)
+                {
+                    iterations(0, num_tiles, 0);
+                }
+
+                // make sure live-out variables are properly set on return
+                exit_iteration(iterations.args_,
+                    typename pika::util::detail::make_index_pack<sizeof...(
+                        Args)>::type(),
+                    size);
+
+                return pika::util::detail::unused_type();
+            }
+
+            template <typename ExPolicy, typename I, std::size_t N,
+                typename F, typename... Args>
+            static typename algorithm_result<ExPolicy>::type parallel(
+                ExPolicy&& policy,
+                std::shared_ptr<md_tiling<I, N> const> tiling, F&& f,
+                Args&&... args)
+            {
+                // we need to decay copy here to properly transport
+                // everything to a GPU device
+                using args_type = std::tuple<std::decay_t<Args>...>;
+
+                std::size_t const num_tiles = tiling->num_tiles;
+                std::size_t const size = tiling->size;
+
+                args_type args_tuple(PIKA_FORWARD(Args, args)...);
+                if (size == 0)
+                {
+                    exit_iteration(args_tuple,
+                        typename pika::util::detail::make_index_pack<sizeof...(
+                            Args)>::type(),
+                        size);
+                    return algorithm_result<ExPolicy>::get();
+                }
+
+                return partitioner<ExPolicy>::call_with_index(
+                    PIKA_FORWARD(ExPolicy, policy), std::size_t(0), num_tiles,
+                    1,
+                    md_tile_iterations<F, I, N, std::decay_t<Args>...>{
+                        PIKA_FORWARD(F, f), PIKA_MOVE(tiling), args_tuple},
+                    [=](std::vector<pika::future<void>>&&) mutable -> void {
+                        auto pack =
+                            typename pika::util::detail::make_index_pack<
+                                sizeof...(Args)>::type();
+                        // make sure live-out variables are properly set on
+                        // return
+                        exit_iteration(args_tuple, pack, size);
+                    });
+            }
+        };
+
+        // reshuffle arguments, last argument is function object, will go first
+        template <typename ExPolicy, typename I, std::size_t N,
+            std::size_t... Is, typename... Args>
+        typename algorithm_result<ExPolicy>::type for_loop_md(
+            ExPolicy&& policy, md_range<I, N> const& r,
+            pika::util::detail::index_pack<Is...>, Args&&... args)
+        {
+            auto tiling = std::make_shared<md_tiling<I, N> const>(r);
+            auto&& t = std::forward_as_tuple(PIKA_FORWARD(Args, args)...);
+
+            return for_loop_md_algo().call(PIKA_FORWARD(ExPolicy, policy),
+                PIKA_MOVE(tiling), std::get<sizeof...(Args) - 1>(t),
+                std::get<Is>(t)...);
+        }
+        /// \endcond
+    }    // namespace parallel::detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The for_loop_md implements a loop over the points of a
+    /// multidimensional index space \a r. The points are visited tile by
+    /// tile, the tiles are distributed among the tasks executing the loop.
+    ///
+    /// The function object receives one index per dimension of the range
+    /// followed by one argument for each of the induction or reduction
+    /// objects passed to the algorithm:
+    /// \code
+    /// <ignored> f(I i0, ..., I iN_1, ...);
+    /// \endcode
+    /// The ordinal position of a point, which determines the value passed
+    /// for induction objects, is its position in the row-major order of the
+    /// complete range, independent of the tiles and their order. The
+    /// live-out objects of inductions are advanced by the number of points
+    /// of the range.
+    ///
+    /// The execution of for_loop_md without specifying an execution policy
+    /// is equivalent to specifying \a pika::execution::seq as the execution
+    /// policy.
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the range.
+    ///
+    inline constexpr struct for_loop_md_t final
+      : pika::detail::tag_parallel_algorithm<for_loop_md_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N,
+            typename... Args,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::for_loop_md_t, ExPolicy&& policy,
+            md_range<I, N> const& r, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_md must be called with at least a function object");
+
+            using pika::util::detail::make_index_pack;
+            return parallel::detail::for_loop_md(
+                PIKA_FORWARD(ExPolicy, policy), r,
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                PIKA_FORWARD(Args, args)...);
+        }
+
+        template <typename I, std::size_t N, typename... Args>
+        friend void tag_fallback_invoke(
+            pika::for_loop_md_t, md_range<I, N> const& r, Args&&... args)
+        {
+            static_assert(sizeof...(Args) >= 1,
+                "for_loop_md must be called with at least a function object");
+
+            using pika::util::detail::make_index_pack;
+            return parallel::detail::for_loop_md(pika::execution::seq, r,
+                typename make_index_pack<sizeof...(Args) - 1>::type(),
+                PIKA_FORWARD(Args, args)...);
+        }
+    } for_loop_md{};
+}    // namespace pika
@@ -10,64 +10,293 @@
 
 #include <pika/config.hpp>
 #include <pika/assert.hpp>
+#include <pika/algorithms/traits/use_tree_reduction.hpp>
 #include <pika/concurrency/cache_line_data.hpp>
 #include <pika/execution/detail/execution_parameter_callbacks.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/parallel_executor.hpp>
+#include <pika/iterator_support/irange.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
-#include <pika/threading_base/thread_num_tss.hpp>
+#include <pika/parallel/util/detail/tree_reduce.hpp>
+#include <pika/synchronization/spinlock.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace pika {
     namespace parallel::detail {
         /// \cond NOINTERNAL
         ///////////////////////////////////////////////////////////////////////
+        // The views of a reduction. A view is created on first use by a chunk
+        // of the algorithm (or by a copy of the reduction object running
+        // several chunks one after the other), so a reduction only touches
+        // as many views as chunks were run concurrently, independently of the
+        // number of cores and of the worker threads the chunks ended up on.
+        template <typename T>
+        class reduction_views
+        {
+        public:
+            explicit reduction_views(T const& identity)
+              : identity_(identity)
+            {
+            }
+
+            // the returned reference stays valid while views are added
+            T& acquire()
+            {
+                std::lock_guard<pika::spinlock> l(mtx_);
+                return views_.emplace_back(identity_).data_;
+            }
+
+            T const& identity() const noexcept
+            {
+                return identity_;
+            }
+
+            std::size_t size() const noexcept
+            {
+                return views_.size();
+            }
+
+            T& operator[](std::size_t i) noexcept
+            {
+                return views_[i].data_;
+            }
+
+        private:
+            pika::spinlock mtx_;
+            T identity_;
+            std::deque<pika::concurrency::detail::cache_line_data<T>> views_;
+        };
+
         template <typename T, typename Op>
         struct reduction_helper
         {
             template <typename Op_>
-            constexpr reduction_helper(T& var, T const& identity, Op_&& op)
+            reduction_helper(T& var, T const& identity, Op_&& op)
               : var_(var)
               , op_(PIKA_FORWARD(Op_, op))
+              , views_(std::make_shared<reduction_views<T>>(identity))
+            {
+            }
+
+            // copies share the views with the original, but acquire a view
+            // of their own once they start iterating
+            reduction_helper(reduction_helper const& rhs)
+              : var_(rhs.var_)
+              , op_(rhs.op_)
+              , views_(rhs.views_)
             {
-                std::size_t cores =
-                    pika::parallel::execution::detail::get_os_thread_count();
-                data_.reset(
-                    new pika::concurrency::detail::cache_line_data<T>[cores]);
-                for (std::size_t i = 0; i != cores; ++i)
-                    data_[i].data_ = identity;
             }
 
-            constexpr void init_iteration(std::size_t)
+            void init_iteration(std::size_t)
             {
-                PIKA_ASSERT(pika::get_worker_thread_num() <
-                    pika::parallel::execution::detail::get_os_thread_count());
+                if (view_ == nullptr)
+                    view_ = &views_->acquire();
             }
 
-            constexpr T& iteration_value()
+            T& iteration_value() noexcept
             {
-                return data_[pika::get_worker_thread_num()].data_;
+                PIKA_ASSERT(view_ != nullptr);
+                return *view_;
             }
 
             constexpr void next_iteration() noexcept {}
 
+            T const& identity() const noexcept
+            {
+                return views_->identity();
+            }
+
+            Op const& combiner() const noexcept
+            {
+                return op_;
+            }
+
             void exit_iteration(std::size_t /*index*/)
             {
-                std::size_t cores =
-                    pika::parallel::execution::detail::get_os_thread_count();
-                for (std::size_t i = 0; i != cores; ++i)
-                    var_ = op_(var_, data_[i].data_);
+                reduction_views<T>& views = *views_;
+                std::size_t count = views.size();
+
+                if constexpr (pika::traits::use_tree_reduction_v<Op>)
+                {
+                    // combine the views in parallel, leaving the result in
+                    // the first one
+                    if (count > 2)
+                    {
+                        tree_reduce(pika::execution::parallel_executor(),
+                            count,
+                            [this, &views](std::size_t i, std::size_t j) {
+                                views[i] = op_(views[i], views[j]);
+                            });
+                        count = 1;
+                    }
+                }
+
+                for (std::size_t i = 0; i != count; ++i)
+                    var_ = op_(var_, views[i]);
             }
 
         private:
             T& var_;
             Op op_;
-            std::shared_ptr<pika::concurrency::detail::cache_line_data<T>[]>
-                data_;
+            std::shared_ptr<reduction_views<T>> views_;
+            T* view_ = nullptr;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The views of an array reduction, each holding n elements. Views are
+        // created (and filled with the identity) on first use only.
+        template <typename T>
+        class reduction_array_views
+        {
+        public:
+            reduction_array_views(std::size_t n, T const& identity)
+              : n_(n)
+              , identity_(identity)
+            {
+            }
+
+            // the returned pointer stays valid while views are added
+            T* acquire()
+            {
+                // initialize the view outside of the lock, the arrays may be
+                // large
+                std::vector<T> view(n_, identity_);
+                T* data = view.data();
+
+                std::lock_guard<pika::spinlock> l(mtx_);
+                views_.push_back(PIKA_MOVE(view));
+                return data;
+            }
+
+            std::size_t size() const noexcept
+            {
+                return views_.size();
+            }
+
+            T const* operator[](std::size_t i) const noexcept
+            {
+                return views_[i].data();
+            }
+
+        private:
+            pika::spinlock mtx_;
+            std::size_t n_;
+            T identity_;
+            std::deque<std::vector<T>> views_;
+        };
+
+        template <typename T, typename Op>
+        struct reduction_array_helper
+        {
+            // the minimal number of elements combined by one task on exit
+            static constexpr std::size_t min_slab_size = 4096;
+
+            template <typename Op_>
+            reduction_array_helper(
+                T* var, std::size_t n, T const& identity, Op_&& op)
+              : var_(var)
+              , n_(n)
+              , op_(PIKA_FORWARD(Op_, op))
+              , views_(std::make_shared<reduction_array_views<T>>(n, identity))
+            {
+            }
+
+            // copies share the views with the original, but acquire a view
+            // of their own once they start iterating
+            reduction_array_helper(reduction_array_helper const& rhs)
+              : var_(rhs.var_)
+              , n_(rhs.n_)
+              , op_(rhs.op_)
+              , views_(rhs.views_)
+            {
+            }
+
+            void init_iteration(std::size_t)
+            {
+                if (view_ == nullptr)
+                    view_ = views_->acquire();
+            }
+
+            T* iteration_value() noexcept
+            {
+                PIKA_ASSERT(view_ != nullptr);
+                return view_;
+            }
+
+            constexpr void next_iteration() noexcept {}
+
+            void exit_iteration(std::size_t /*index*/)
+            {
+                reduction_array_views<T> const& views = *views_;
+                std::size_t const count = views.size();
+                if (count == 0 || n_ == 0)
+                    return;
+
+                // every slab of the live-out array is combined with the
+                // corresponding slabs of all views by a separate task
+                std::size_t const cores =
+                    pika::parallel::execution::detail::get_os_thread_count();
+                std::size_t const num_slabs =
+                    (std::min)((std::max)(n_ / min_slab_size, std::size_t(1)),
+                        (std::max)(cores, std::size_t(1)));
+
+                auto combine_slab = [&](std::size_t slab) {
+                    std::size_t const first = slab * n_ / num_slabs;
+                    std::size_t const last = (slab + 1) * n_ / num_slabs;
+                    for (std::size_t v = 0; v != count; ++v)
+                    {
+                        T const* view = views[v];
+                        for (std::size_t i = first; i != last; ++i)
+                            var_[i] = op_(var_[i], view[i]);
+                    }
+                };
+
+                if (num_slabs == 1)
+                {
+                    combine_slab(0);
+                }
+                else
+                {
+                    pika::parallel::execution::bulk_sync_execute(
+                        pika::execution::parallel_executor(), combine_slab,
+                        pika::detail::irange(std::size_t(0), num_slabs));
+                }
+            }
+
+        private:
+            T* var_;
+            std::size_t n_;
+            Op op_;
+            std::shared_ptr<reduction_array_views<T>> views_;
+            T* view_ = nullptr;
+        };
+
+        // applies a reduction operation element by element to two arrays
+        template <typename Op>
+        struct elementwise_op
+        {
+            Op op_;
+
+            template <typename T, std::size_t N>
+            std::array<T, N> operator()(
+                std::array<T, N> const& lhs, std::array<T, N> const& rhs) const
+            {
+                std::array<T, N> result;
+                for (std::size_t i = 0; i != N; ++i)
+                    result[i] = op_(lhs[i], rhs[i]);
+                return result;
+            }
         };
 
         /// \endcond
@@ -244,4 +473,70 @@ namespace pika {
         return reduction(var, identity, parallel::detail::max_of<T>());
     }
     /// \endcond
+
+    /// The function template returns a reduction object for the elements of
+    /// an array. Each view of the reduction is an array of \a n elements,
+    /// which is initialized to \a identity when it is first used by the
+    /// algorithm. The element-access function is passed a pointer to the
+    /// first element of its view. At the end of the algorithm the views are
+    /// combined element by element into the live-out array, with disjoint
+    /// slabs of the array combined in parallel.
+    ///
+    /// \tparam T       The value type of the elements of the array.
+    /// \tparam Op      The type of the binary function (object) used to
+    ///                 perform the reduction operation.
+    ///
+    /// \param var      [in,out] The pointer to the first element of the
+    ///                 live-out array. This will hold the reduced values after
+    ///                 the algorithm is finished executing.
+    /// \param n        [in] The number of elements of the array.
+    /// \param identity [in] The identity value to use for the reduction
+    ///                 operation.
+    /// \param combiner [in] The binary function (object) used to perform a
+    ///                 pairwise reduction on the elements.
+    ///
+    /// T shall meet the requirements of CopyConstructible and MoveAssignable.
+    /// The expression var[i] = combiner(var[i], var[i]) shall be well formed.
+    ///
+    /// \returns This returns a reduction object of unspecified type having a
+    ///          value type of \a T*.
+    ///
+    template <typename T, typename Op>
+    PIKA_FORCEINLINE parallel::detail::reduction_array_helper<T,
+        std::decay_t<Op>>
+    reduction_array(T* var, std::size_t n, T const& identity, Op&& combiner)
+    {
+        return parallel::detail::reduction_array_helper<T, std::decay_t<Op>>(
+            var, n, identity, PIKA_FORWARD(Op, combiner));
+    }
+
+    /// The function template returns a reduction object for the elements of
+    /// a fixed-size array. The views are arrays of the same size which are
+    /// stored directly in the reduction's storage for views, so creating a
+    /// view does not allocate an array on the heap. The element-access
+    /// function is passed a reference to its view.
+    ///
+    /// \param var      [in,out] The live-out array.
+    /// \param identity [in] The identity value to use for the reduction
+    ///                 operation, all elements of a view are initialized to it.
+    /// \param combiner [in] The binary function (object) used to perform a
+    ///                 pairwise reduction on the elements.
+    ///
+    /// \returns This returns a reduction object of unspecified type having a
+    ///          value type of \a std::array<T, N>.
+    ///
+    template <typename T, std::size_t N, typename Op>
+    PIKA_FORCEINLINE parallel::detail::reduction_helper<std::array<T, N>,
+        parallel::detail::elementwise_op<std::decay_t<Op>>>
+    reduction_array(std::array<T, N>& var, T const& identity, Op&& combiner)
+    {
+        std::array<T, N> identity_array;
+        identity_array.fill(identity);
+
+        return parallel::detail::reduction_helper<std::array<T, N>,
+            parallel::detail::elementwise_op<std::decay_t<Op>>>(var,
+            identity_array,
+            parallel::detail::elementwise_op<std::decay_t<Op>>{
+                PIKA_FORWARD(Op, combiner)});
+    }
 }    // namespace pika
@@ -0,0 +1,355 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_wavefront.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution_base/this_thread.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/for_loop_md.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <list>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The number of tiles along every dimension for which no tile size was
+    // given, per core executing the loop. The tiles along the diagonals of
+    // the range run concurrently, enough of them keep all cores busy while
+    // the wavefront ramps up and down.
+    inline constexpr std::size_t wavefront_tiles_per_core = 4;
+
+    enum class wavefront_state : std::uint8_t
+    {
+        pending,    // the tile has not finished yet
+        done,       // all points of the tile have been visited
+        failed      // the tile or one of its predecessors has failed
+    };
+
+    // Lists the tiles in the order of the sum of their coordinates, every
+    // tile follows the tiles it depends on.
+    template <typename I, std::size_t N>
+    std::vector<std::size_t> wavefront_order(md_tiling<I, N> const& t)
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> keys(t.num_tiles);
+        for (std::size_t id = 0; id != t.num_tiles; ++id)
+        {
+            std::size_t diagonal = 0;
+            std::size_t rest = id;
+            for (std::size_t d = N; d != 0; --d)
+            {
+                diagonal += rest % t.tiles[d - 1];
+                rest /= t.tiles[d - 1];
+            }
+            keys[id] = std::make_pair(diagonal, id);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<std::size_t> order(t.num_tiles);
+        for (std::size_t i = 0; i != t.num_tiles; ++i)
+        {
+            order[i] = keys[i].second;
+        }
+        return order;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct for_loop_wavefront_algo
+      : public algorithm<for_loop_wavefront_algo>
+    {
+        constexpr for_loop_wavefront_algo() noexcept
+          : for_loop_wavefront_algo::algorithm("for_loop_wavefront")
+        {
+        }
+
+        // Visiting the points in row-major order satisfies all
+        // dependencies, the range is a single tile.
+        template <typename ExPolicy, typename I, std::size_t N, typename F>
+        static pika::util::detail::unused_type sequential(
+            ExPolicy&&, md_range<I, N> const& r, F&& f)
+        {
+            std::array<std::size_t, N> tile;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                tile[d] = r.last()[d] > r.first()[d] ?
+                    static_cast<std::size_t>(r.last()[d] - r.first()[d]) :
+                    1;
+            }
+
+            auto tiling = std::make_shared<md_tiling<I, N> const>(
+                md_range<I, N>(r.first(), r.last(), tile));
+            if (tiling->size != 0)
+            {
+                md_tile_iterations<F, I, N> iterations(
+                    PIKA_FORWARD(F, f), PIKA_MOVE(tiling), std::tuple<>());
+                iterations(0, 1, 0);
+            }
+            return pika::util::detail::unused_type();
+        }
+
+        template <typename ExPolicy, typename I, std::size_t N, typename F>
+        static typename algorithm_result<ExPolicy>::type parallel(
+            ExPolicy&& policy, md_range<I, N> const& r, F&& f)
+        {
+            using result = algorithm_result<ExPolicy>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, r, f = PIKA_FORWARD(F, f)]() mutable {
+                        auto p = policy(pika::execution::non_task);
+                        run_wavefront(p, r, f);
+                    }));
+            }
+            else
+            {
+                run_wavefront(policy, r, f);
+                return result::get();
+            }
+        }
+
+    private:
+        // The tiles are handed out in the order of their diagonals to one
+        // task per core. A tile waits for the tiles preceding it along
+        // every dimension to publish their completion, there is no barrier
+        // between the diagonals. All tiles a tile depends on have been
+        // handed out before it, every tile being waited for has been taken
+        // by a running task.
+        template <typename ExPolicy, typename I, std::size_t N, typename F>
+        static void run_wavefront(
+            ExPolicy& policy, md_range<I, N> const& r, F& f)
+        {
+            using handle_exceptions = handle_local_exceptions<ExPolicy>;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            std::array<std::size_t, N> tile = r.tile();
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (tile[d] == 0)
+                {
+                    std::size_t const extent = r.last()[d] > r.first()[d] ?
+                        static_cast<std::size_t>(r.last()[d] - r.first()[d]) :
+                        0;
+                    std::size_t const tiles = wavefront_tiles_per_core * cores;
+                    tile[d] = (std::max)(
+                        (extent + tiles - 1) / tiles, std::size_t(1));
+                }
+            }
+
+            auto tiling = std::make_shared<md_tiling<I, N>>(
+                md_range<I, N>(r.first(), r.last(), tile));
+            if (tiling->size == 0)
+            {
+                return;
+            }
+
+            std::size_t const num_tiles = tiling->num_tiles;
+            std::size_t const num_workers = (std::min)(cores, num_tiles);
+            if (num_workers <= 1)
+            {
+                try
+                {
+                    sequential(policy, r, f);
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return;
+            }
+
+            tiling->order = wavefront_order(*tiling);
+
+            // the distance between the ids of neighbouring tiles along
+            // every dimension
+            std::array<std::size_t, N> tile_pitch;
+            std::size_t pitch = 1;
+            for (std::size_t d = N; d != 0; --d)
+            {
+                tile_pitch[d - 1] = pitch;
+                pitch *= tiling->tiles[d - 1];
+            }
+
+            std::vector<std::atomic<wavefront_state>> status(num_tiles);
+            for (auto& s : status)
+            {
+                s.store(wavefront_state::pending, std::memory_order_relaxed);
+            }
+            std::atomic<std::size_t> next_tile(0);
+            std::atomic<bool> failed(false);
+
+            // waits for the given tile, returns false if it failed
+            auto wait_for = [&](std::size_t id) {
+                auto state = status[id].load(std::memory_order_acquire);
+                if (state == wavefront_state::pending)
+                {
+                    pika::util::yield_while(
+                        [&]() {
+                            state = status[id].load(std::memory_order_acquire);
+                            return state == wavefront_state::pending;
+                        },
+                        "for_loop_wavefront");
+                }
+                return state == wavefront_state::done;
+            };
+
+            // runs the tile at the given position of the order once its
+            // predecessors are done
+            auto run_tile = [&](auto& iterations, std::size_t ordinal) {
+                std::size_t const id = tiling->order[ordinal];
+
+                std::size_t rest = id;
+                for (std::size_t d = N; d != 0; --d)
+                {
+                    std::size_t const coord = rest % tiling->tiles[d - 1];
+                    rest /= tiling->tiles[d - 1];
+                    if (coord != 0 && !wait_for(id - tile_pitch[d - 1]))
+                    {
+                        status[id].store(
+                            wavefront_state::failed, std::memory_order_release);
+                        failed.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+
+                iterations(ordinal, 1, 0);
+                status[id].store(
+                    wavefront_state::done, std::memory_order_release);
+            };
+
+            auto worker = [&](std::size_t) {
+                // every task invokes its own copy of the function object
+                md_tile_iterations<F, I, N> iterations(
+                    f, tiling, std::tuple<>());
+
+                while (!failed.load(std::memory_order_relaxed))
+                {
+                    std::size_t const ordinal =
+                        next_tile.fetch_add(1, std::memory_order_relaxed);
+                    if (ordinal >= num_tiles)
+                    {
+                        break;
+                    }
+
+                    try
+                    {
+                        run_tile(iterations, ordinal);
+                    }
+                    catch (...)
+                    {
+                        status[tiling->order[ordinal]].store(
+                            wavefront_state::failed, std::memory_order_release);
+                        failed.store(true, std::memory_order_relaxed);
+                        throw;
+                    }
+                }
+            };
+
+            std::vector<pika::future<void>> workers;
+            std::list<std::exception_ptr> errors;
+            try
+            {
+                workers = execution::bulk_async_execute(policy.executor(),
+                    worker, pika::detail::irange(std::size_t(0), num_workers));
+                pika::wait_all_nothrow(workers);
+            }
+            catch (...)
+            {
+                handle_exceptions::call(std::current_exception(), errors);
+            }
+
+            // rethrow the exceptions of all failed tiles
+            handle_exceptions::call(workers, errors);
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The for_loop_wavefront implements a loop over the points of a
+    /// multidimensional index space \a r in which a point may depend on the
+    /// results of all points which precede it along every dimension, e.g.
+    /// the cells of a dynamic programming table which depend on their
+    /// north, west and north-west neighbours.
+    ///
+    /// The range is split into the tiles given by \a r, the points of a
+    /// tile are visited in row-major order. A tile runs as soon as the
+    /// tiles preceding it along every dimension are done, the tiles on the
+    /// same diagonal of the range run concurrently. The order of the tiles
+    /// given by \a r is ignored. A tile size of zero splits the dimension
+    /// into a few tiles per core executing the loop.
+    ///
+    /// The function object receives one index per dimension of the range:
+    /// \code
+    /// <ignored> f(I i0, ..., I iN_1);
+    /// \endcode
+    ///
+    /// The execution of for_loop_wavefront without specifying an execution
+    /// policy is equivalent to specifying \a pika::execution::seq as the
+    /// execution policy, which visits the points in row-major order.
+    ///
+    /// Complexity: Applies \a f exactly once for each point of the range.
+    ///
+    /// \note The tasks executing the loop wait for the tiles they depend
+    ///       on, the policy should not limit the number of concurrently
+    ///       running tasks below the number of cores it reports.
+    ///
+    inline constexpr struct for_loop_wavefront_t final
+      : pika::detail::tag_parallel_algorithm<for_loop_wavefront_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename I, std::size_t N, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::for_loop_wavefront_t, ExPolicy&& policy,
+            md_range<I, N> const& r, F&& f)
+        {
+            return parallel::detail::for_loop_wavefront_algo().call(
+                PIKA_FORWARD(ExPolicy, policy), r, PIKA_FORWARD(F, f));
+        }
+
+        template <typename I, std::size_t N, typename F>
+        friend void tag_fallback_invoke(
+            pika::for_loop_wavefront_t, md_range<I, N> const& r, F&& f)
+        {
+            parallel::detail::for_loop_wavefront_algo().call(
+                pika::execution::seq, r, PIKA_FORWARD(F, f));
+        }
+    } for_loop_wavefront{};
+}    // namespace pika
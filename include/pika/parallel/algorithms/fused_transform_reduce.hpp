@@ -0,0 +1,493 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/fused_transform_reduce.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Composes the given element-wise stages into a single unary function
+    /// object. The stages are applied from left to right, i.e. invoking the
+    /// returned object with a value v returns fN(...f2(f1(v))).
+    ///
+    /// \param fs           The unary function objects to compose.
+    ///
+    /// \returns  A function object of unspecified type applying all stages.
+    ///
+    template <typename... Fs>
+    unspecified fused_stages(Fs&&... fs);
+
+    /// Returns a terminal for \a fused_transform_reduce which computes
+    /// GENERALIZED_SUM(op, init, v1, ..., vN) over the values produced by the
+    /// stages.
+    ///
+    /// \param init         The initial value for the generalized sum.
+    /// \param op           The binary function object used to combine the
+    ///                     values. It must be associative and commutative.
+    ///
+    template <typename T, typename Op>
+    unspecified fused_reduction(T init, Op&& op);
+
+    /// Returns a terminal for \a fused_transform_reduce which counts the
+    /// values produced by the stages for which \a pred returns true. The
+    /// result is of type std::ptrdiff_t.
+    ///
+    /// \param pred         The unary predicate deciding whether a value is
+    ///                     counted.
+    ///
+    template <typename Pred>
+    unspecified fused_count_if(Pred&& pred);
+
+    /// Applies \a stages to every element of [first, last) and feeds the
+    /// resulting value to all of the given \a terminals, all in a single pass
+    /// through the sequence. Every chunk of the sequence is only touched
+    /// once, in particular no intermediate sequences are materialized
+    /// between the stages.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a stages
+    ///         and of each of the terminals.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Stages      The type of the unary function object applied to
+    ///                     the elements (deduced).
+    /// \tparam Terminals   The types of the terminals (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param stages       Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence, usually created by \a fused_stages.
+    /// \param terminals    The reductions to compute over the values returned
+    ///                     from \a stages, as created by \a fused_reduction or
+    ///                     \a fused_count_if.
+    ///
+    /// The operations in the parallel \a fused_transform_reduce algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The operations in the parallel \a fused_transform_reduce algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a fused_transform_reduce algorithm returns a
+    ///           \a pika::future<std::tuple<R...>> if the execution policy is
+    ///           of type \a parallel_task_policy and returns
+    ///           \a std::tuple<R...> otherwise, holding the result of each of
+    ///           the terminals in the order they were passed.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Stages,
+        typename... Terminals>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        std::tuple<R...>>::type
+    fused_transform_reduce(ExPolicy&& policy, FwdIter first, FwdIter last,
+        Stages&& stages, Terminals&&... terminals);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // All stages are applied to a value from left to right. Intermediate
+    // values only ever live on the stack of the invoking chunk.
+    template <typename... Fs>
+    struct fused_stages
+    {
+        std::tuple<Fs...> fs_;
+
+        template <typename T>
+        PIKA_HOST_DEVICE decltype(auto) operator()(T&& t)
+        {
+            return apply<0>(PIKA_FORWARD(T, t));
+        }
+
+    private:
+        template <std::size_t I, typename T>
+        PIKA_HOST_DEVICE decltype(auto) apply(T&& t)
+        {
+            if constexpr (I == sizeof...(Fs))
+            {
+                // references into the sequence are passed on as they are,
+                // the result of the last stage is returned by value
+                if constexpr (std::is_lvalue_reference_v<T>)
+                {
+                    return static_cast<T>(t);
+                }
+                else
+                {
+                    return std::decay_t<T>(PIKA_FORWARD(T, t));
+                }
+            }
+            else
+            {
+                return apply<I + 1>(
+                    PIKA_INVOKE(std::get<I>(fs_), PIKA_FORWARD(T, t)));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A terminal accumulates the values of a chunk into a partial result
+    // (seeded from the first value of the chunk), and combines the partial
+    // results of all chunks with its initial value.
+    template <typename T, typename Op>
+    struct fused_reduction_terminal
+    {
+        using result_type = T;
+
+        T init_;
+        Op op_;
+
+        T init() const
+        {
+            return init_;
+        }
+
+        template <typename U>
+        T first(U const& v)
+        {
+            return T(v);
+        }
+
+        template <typename U>
+        void next(T& acc, U const& v)
+        {
+            acc = PIKA_INVOKE(op_, PIKA_MOVE(acc), v);
+        }
+
+        T combine(T&& acc, T&& part)
+        {
+            return PIKA_INVOKE(op_, PIKA_MOVE(acc), PIKA_MOVE(part));
+        }
+    };
+
+    template <typename Pred>
+    struct fused_count_if_terminal
+    {
+        using result_type = std::ptrdiff_t;
+
+        Pred pred_;
+
+        std::ptrdiff_t init() const noexcept
+        {
+            return 0;
+        }
+
+        template <typename U>
+        std::ptrdiff_t first(U const& v)
+        {
+            return PIKA_INVOKE(pred_, v) ? 1 : 0;
+        }
+
+        template <typename U>
+        void next(std::ptrdiff_t& acc, U const& v)
+        {
+            if (PIKA_INVOKE(pred_, v))
+            {
+                ++acc;
+            }
+        }
+
+        std::ptrdiff_t combine(std::ptrdiff_t acc, std::ptrdiff_t part) noexcept
+        {
+            return acc + part;
+        }
+    };
+
+    template <typename T>
+    struct is_fused_terminal : std::false_type
+    {
+    };
+
+    template <typename T, typename Op>
+    struct is_fused_terminal<fused_reduction_terminal<T, Op>> : std::true_type
+    {
+    };
+
+    template <typename Pred>
+    struct is_fused_terminal<fused_count_if_terminal<Pred>> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Drives all terminals at once, the partial results of a chunk are
+    // stored as a tuple with one element per terminal.
+    template <typename... Terminals>
+    struct fused_terminals
+    {
+        using result_type = std::tuple<typename Terminals::result_type...>;
+        using indices_type = std::index_sequence_for<Terminals...>;
+
+        std::tuple<Terminals...> terminals_;
+
+        result_type init() const
+        {
+            return init(indices_type{});
+        }
+
+        template <typename U>
+        result_type first(U const& v)
+        {
+            return first(indices_type{}, v);
+        }
+
+        template <typename U>
+        void next(result_type& acc, U const& v)
+        {
+            next(indices_type{}, acc, v);
+        }
+
+        void combine(result_type& acc, result_type&& part)
+        {
+            combine(indices_type{}, acc, PIKA_MOVE(part));
+        }
+
+    private:
+        template <std::size_t... Is>
+        result_type init(std::index_sequence<Is...>) const
+        {
+            return result_type(std::get<Is>(terminals_).init()...);
+        }
+
+        template <std::size_t... Is, typename U>
+        result_type first(std::index_sequence<Is...>, U const& v)
+        {
+            return result_type(std::get<Is>(terminals_).first(v)...);
+        }
+
+        template <std::size_t... Is, typename U>
+        void next(std::index_sequence<Is...>, result_type& acc, U const& v)
+        {
+            (std::get<Is>(terminals_).next(std::get<Is>(acc), v), ...);
+        }
+
+        template <std::size_t... Is>
+        void combine(
+            std::index_sequence<Is...>, result_type& acc, result_type&& part)
+        {
+            ((std::get<Is>(acc) = std::get<Is>(terminals_).combine(
+                  PIKA_MOVE(std::get<Is>(acc)), PIKA_MOVE(std::get<Is>(part)))),
+                ...);
+        }
+    };
+
+    template <typename Stages, typename Terminals>
+    struct fused_transform_reduce_iteration
+    {
+        using result_type = typename Terminals::result_type;
+
+        Stages stages_;
+        Terminals terminals_;
+
+        template <typename Iter>
+        result_type operator()(Iter part_begin, std::size_t part_size)
+        {
+            result_type acc = [&]() -> result_type {
+                auto&& v = stages_(*part_begin);
+                return terminals_.first(v);
+            }();
+
+            // the stages are arbitrary function objects, which are not
+            // invoked with vector packs
+            loop_n_ind<pika::execution::sequenced_policy>(++part_begin,
+                --part_size, [&](auto&& elem) {
+                    auto&& v = stages_(PIKA_FORWARD(decltype(elem), elem));
+                    terminals_.next(acc, v);
+                });
+            return acc;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct fused_transform_reduce
+      : public algorithm<fused_transform_reduce<T>, T>
+    {
+        fused_transform_reduce()
+          : fused_transform_reduce::algorithm("fused_transform_reduce")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Stages, typename Terminals>
+        static T sequential(ExPolicy, Iter first, Sent last, Stages&& stages,
+            Terminals&& terminals)
+        {
+            T acc = terminals.init();
+            for (/**/; first != last; ++first)
+            {
+                auto&& v = stages(*first);
+                terminals.next(acc, v);
+            }
+            return acc;
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Stages, typename Terminals>
+        static typename algorithm_result<ExPolicy, T>::type parallel(
+            ExPolicy&& policy, Iter first, Sent last, Stages&& stages,
+            Terminals&& terminals)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, T>::get(terminals.init());
+            }
+
+            using stages_type = std::decay_t<Stages>;
+            using terminals_type = std::decay_t<Terminals>;
+
+            auto f1 =
+                fused_transform_reduce_iteration<stages_type, terminals_type>{
+                    PIKA_FORWARD(Stages, stages), terminals};
+
+            return detail::partitioner<ExPolicy, T>::call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), PIKA_MOVE(f1),
+                make_chunk_values_reducer(
+                    [terminals = PIKA_FORWARD(Terminals, terminals)](
+                        std::vector<T>&& results) mutable -> T {
+                        T acc = terminals.init();
+                        for (auto&& part : results)
+                        {
+                            terminals.combine(acc, PIKA_MOVE(part));
+                        }
+                        return acc;
+                    }));
+        }
+    };
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Fs>
+    parallel::detail::fused_stages<std::decay_t<Fs>...> fused_stages(
+        Fs&&... fs)
+    {
+        return parallel::detail::fused_stages<std::decay_t<Fs>...>{
+            std::tuple<std::decay_t<Fs>...>(PIKA_FORWARD(Fs, fs)...)};
+    }
+
+    template <typename T, typename Op>
+    parallel::detail::fused_reduction_terminal<T, std::decay_t<Op>>
+    fused_reduction(T init, Op&& op)
+    {
+        return parallel::detail::fused_reduction_terminal<T,
+            std::decay_t<Op>>{PIKA_MOVE(init), PIKA_FORWARD(Op, op)};
+    }
+
+    template <typename Pred>
+    parallel::detail::fused_count_if_terminal<std::decay_t<Pred>>
+    fused_count_if(Pred&& pred)
+    {
+        return parallel::detail::fused_count_if_terminal<std::decay_t<Pred>>{
+            PIKA_FORWARD(Pred, pred)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::fused_transform_reduce
+    inline constexpr struct fused_transform_reduce_t final
+      : pika::detail::tag_parallel_algorithm<fused_transform_reduce_t>
+    {
+    private:
+        template <typename... Terminals>
+        using terminals_type = parallel::detail::fused_terminals<
+            std::decay_t<Terminals>...>;
+
+        template <typename... Terminals>
+        using result_type = typename terminals_type<Terminals...>::result_type;
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Stages,
+            typename... Terminals,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                (sizeof...(Terminals) != 0) &&
+                (pika::parallel::detail::is_fused_terminal<
+                    std::decay_t<Terminals>>::value && ...)
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            result_type<Terminals...>>::type
+        tag_fallback_invoke(fused_transform_reduce_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, Stages&& stages,
+            Terminals&&... terminals)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::fused_transform_reduce<
+                result_type<Terminals...>>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Stages, stages),
+                    terminals_type<Terminals...>{
+                        {PIKA_FORWARD(Terminals, terminals)...}});
+        }
+
+        // clang-format off
+        template <typename InIter, typename Stages, typename... Terminals,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                (sizeof...(Terminals) != 0) &&
+                (pika::parallel::detail::is_fused_terminal<
+                    std::decay_t<Terminals>>::value && ...)
+            )>
+        // clang-format on
+        friend result_type<Terminals...> tag_fallback_invoke(
+            fused_transform_reduce_t, InIter first, InIter last,
+            Stages&& stages, Terminals&&... terminals)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+
+            return pika::parallel::detail::fused_transform_reduce<
+                result_type<Terminals...>>()
+                .call(pika::execution::seq, first, last,
+                    PIKA_FORWARD(Stages, stages),
+                    terminals_type<Terminals...>{
+                        {PIKA_FORWARD(Terminals, terminals)...}});
+        }
+    } fused_transform_reduce{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -0,0 +1,671 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/gather.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Copies the elements input_first[*it] to the range beginning at
+    /// \a dest for each iterator \a it in the range [map_first, map_last).
+    ///
+    /// \note   Complexity: Exactly \a map_last - \a map_first assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the iterators referring to the indices
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its
+    ///                     value type must be an integral type.
+    /// \tparam RandIter2   The type of the iterator referring to the source
+    ///                     elements (deduced). This iterator type must meet
+    ///                     the requirements of a random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param map_first    Refers to the beginning of the indices of the
+    ///                     elements to copy.
+    /// \param map_last     Refers to the end of the indices of the elements
+    ///                     to copy.
+    /// \param input_first  Refers to the beginning of the source range, all
+    ///                     indices have to refer to elements of this range.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The assignments in the parallel \a gather algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a gather algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a gather algorithm returns a \a pika::future<FwdIter>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter otherwise.
+    ///           The \a gather algorithm returns the end of the destination
+    ///           range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    gather(ExPolicy&& policy, RandIter1 map_first, RandIter1 map_last,
+        RandIter2 input_first, FwdIter dest);
+
+    /// Copies each element of the range [first, last) to dest[map_first[i]],
+    /// where \a i is the position of the element in the range.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators (deduced). This
+    ///                     iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandIter1   The type of the iterator referring to the indices
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its
+    ///                     value type must be an integral type.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the source range.
+    /// \param last         Refers to the end of the source range.
+    /// \param map_first    Refers to the beginning of the indices the
+    ///                     elements are copied to. No index may occur more
+    ///                     than once.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The assignments in the parallel \a scatter algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a scatter algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a scatter algorithm returns a \a pika::future<void> if
+    ///           the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns void otherwise.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter1,
+        typename RandIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+    scatter(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter1 map_first, RandIter2 dest);
+
+    /// Copies each element of the range [first, last) to dest[map_first[i]]
+    /// if pred(stencil_first[i]) returns true, where \a i is the position of
+    /// the element in the range.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first applications of
+    ///         \a pred and at most as many assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators (deduced). This
+    ///                     iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandIter1   The type of the iterator referring to the indices
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its
+    ///                     value type must be an integral type.
+    /// \tparam RandIter2   The type of the iterator referring to the stencil
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam RandIter3   The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a scatter_if requires \a Pred to meet
+    ///                     the requirements of \a CopyConstructible. This
+    ///                     defaults to converting the stencil value to bool.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the source range.
+    /// \param last         Refers to the end of the source range.
+    /// \param map_first    Refers to the beginning of the indices the
+    ///                     elements are copied to. No index of a copied
+    ///                     element may occur more than once.
+    /// \param stencil_first Refers to the beginning of the stencil values
+    ///                     which are passed to \a pred.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     decides whether an element is copied. The
+    ///                     signature of this predicate should be equivalent
+    ///                     to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///
+    /// The assignments in the parallel \a scatter_if algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a scatter_if algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a scatter_if algorithm returns a \a pika::future<void>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns void otherwise.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter1,
+        typename RandIter2, typename RandIter3,
+        typename Pred = detail::projection_identity>
+    typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+    scatter_if(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter1 map_first, RandIter2 stencil_first, RandIter3 dest,
+        Pred&& pred = Pred());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/prefetching.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // gather, scatter, scatter_if
+    /// \cond NOINTERNAL
+
+    // the default number of indices the prefetching of the accessed elements
+    // runs ahead of the copying, see pika::execution::software_prefetching
+    inline constexpr std::size_t gather_prefetch_distance = 16;
+
+    // runs of at least this many consecutive indices are copied as a block,
+    // which can use vectorized loads and stores
+    inline constexpr std::size_t gather_min_contiguous = 8;
+
+    // Returns the number of consecutive indices starting at map[i], but not
+    // more than count - i.
+    template <typename RandIter>
+    std::size_t contiguous_indices(
+        RandIter map, std::size_t i, std::size_t count)
+    {
+        std::size_t run = 1;
+        while (i + run != count &&
+            static_cast<std::ptrdiff_t>(map[i + run]) ==
+                static_cast<std::ptrdiff_t>(map[i]) +
+                    static_cast<std::ptrdiff_t>(run))
+        {
+            ++run;
+        }
+        return run;
+    }
+
+    template <typename RandIter1, typename RandIter2, typename FwdIter>
+    FwdIter gather_n(RandIter1 map, std::size_t count, RandIter2 input,
+        FwdIter dest, pika::execution::software_prefetching const& prefetch)
+    {
+        std::size_t const distance = prefetch.distance();
+        for (std::size_t i = 0; i != count; /**/)
+        {
+            std::size_t const run = contiguous_indices(map, i, count);
+            if (run >= gather_min_contiguous)
+            {
+                dest = std::copy_n(std::next(input, map[i]), run, dest);
+                i += run;
+                continue;
+            }
+
+            for (std::size_t const end = i + run; i != end; ++i, ++dest)
+            {
+                if (i + distance < count)
+                {
+                    prefetching::prefetch_address(
+                        input[map[i + distance]], prefetch.locality());
+                }
+                *dest = input[map[i]];
+            }
+        }
+        return dest;
+    }
+
+    template <typename FwdIter, typename RandIter1, typename RandIter2>
+    FwdIter scatter_n(FwdIter first, std::size_t count, RandIter1 map,
+        RandIter2 dest, pika::execution::software_prefetching const& prefetch)
+    {
+        std::size_t const distance = prefetch.distance();
+        for (std::size_t i = 0; i != count; /**/)
+        {
+            std::size_t const run = contiguous_indices(map, i, count);
+            if (run >= gather_min_contiguous)
+            {
+                auto r = std::next(first, run);
+                std::copy(first, r, std::next(dest, map[i]));
+                first = r;
+                i += run;
+                continue;
+            }
+
+            for (std::size_t const end = i + run; i != end; ++i, ++first)
+            {
+                if (i + distance < count)
+                {
+                    prefetching::prefetch_address(
+                        dest[map[i + distance]], prefetch.locality());
+                }
+                dest[map[i]] = *first;
+            }
+        }
+        return first;
+    }
+
+    template <typename FwdIter, typename RandIter1, typename RandIter2,
+        typename RandIter3, typename Pred>
+    FwdIter scatter_if_n(FwdIter first, std::size_t count, RandIter1 map,
+        RandIter2 stencil, RandIter3 dest, Pred& pred,
+        pika::execution::software_prefetching const& prefetch)
+    {
+        std::size_t const distance = prefetch.distance();
+        for (std::size_t i = 0; i != count; ++i, ++first)
+        {
+            if (i + distance < count)
+            {
+                prefetching::prefetch_address(
+                    dest[map[i + distance]], prefetch.locality());
+            }
+            if (PIKA_INVOKE(pred, stencil[i]))
+            {
+                dest[map[i]] = *first;
+            }
+        }
+        return first;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename IterPair>
+    struct gather : public algorithm<gather<IterPair>, IterPair>
+    {
+        gather()
+          : gather::algorithm("gather")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter>
+        static in_out_result<RandIter1, FwdIter> sequential(ExPolicy policy,
+            RandIter1 map_first, RandIter1 map_last, RandIter2 input_first,
+            FwdIter dest)
+        {
+            std::size_t const count = std::distance(map_first, map_last);
+            return {map_last,
+                gather_n(map_first, count, input_first, dest,
+                    get_software_prefetching(
+                        policy, gather_prefetch_distance))};
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter>
+        static typename algorithm_result<ExPolicy,
+            in_out_result<RandIter1, FwdIter>>::type
+        parallel(ExPolicy&& policy, RandIter1 map_first, RandIter1 map_last,
+            RandIter2 input_first, FwdIter dest)
+        {
+            if (map_first == map_last)
+            {
+                using result_type = in_out_result<RandIter1, FwdIter>;
+                return algorithm_result<ExPolicy, result_type>::get(
+                    result_type{PIKA_MOVE(map_first), PIKA_MOVE(dest)});
+            }
+
+            auto f1 = [input_first,
+                          prefetch = get_software_prefetching(
+                              policy, gather_prefetch_distance)](
+                          auto part_begin, std::size_t part_size,
+                          std::size_t) {
+                auto iters = part_begin.get_iterator_tuple();
+                gather_n(std::get<0>(iters), part_size, input_first,
+                    std::get<1>(iters), prefetch);
+            };
+
+            return get_in_out_result(foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(map_first, dest),
+                std::distance(map_first, map_last), PIKA_MOVE(f1),
+                projection_identity()));
+        }
+    };
+
+    template <typename Iter>
+    struct scatter : public algorithm<scatter<Iter>, Iter>
+    {
+        scatter()
+          : scatter::algorithm("scatter")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2>
+        static FwdIter sequential(ExPolicy policy, FwdIter first,
+            FwdIter last, RandIter1 map_first, RandIter2 dest)
+        {
+            return scatter_n(first, std::distance(first, last), map_first,
+                dest,
+                get_software_prefetching(policy, gather_prefetch_distance));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandIter1 map_first, RandIter2 dest)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            auto f1 = [map_first, dest,
+                          prefetch = get_software_prefetching(
+                              policy, gather_prefetch_distance)](
+                          FwdIter part_begin, std::size_t part_size,
+                          std::size_t base_idx) {
+                scatter_n(part_begin, part_size,
+                    std::next(map_first, base_idx), dest, prefetch);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                std::distance(first, last), PIKA_MOVE(f1),
+                projection_identity());
+        }
+    };
+
+    template <typename Iter>
+    struct scatter_if : public algorithm<scatter_if<Iter>, Iter>
+    {
+        scatter_if()
+          : scatter_if::algorithm("scatter_if")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2, typename RandIter3, typename Pred>
+        static FwdIter sequential(ExPolicy policy, FwdIter first,
+            FwdIter last, RandIter1 map_first, RandIter2 stencil_first,
+            RandIter3 dest, Pred&& pred)
+        {
+            return scatter_if_n(first, std::distance(first, last), map_first,
+                stencil_first, dest, pred,
+                get_software_prefetching(policy, gather_prefetch_distance));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2, typename RandIter3, typename Pred>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, FwdIter first, FwdIter last,
+            RandIter1 map_first, RandIter2 stencil_first, RandIter3 dest,
+            Pred&& pred)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            auto f1 = [map_first, stencil_first, dest,
+                          pred = PIKA_FORWARD(Pred, pred),
+                          prefetch = get_software_prefetching(
+                              policy, gather_prefetch_distance)](
+                          FwdIter part_begin, std::size_t part_size,
+                          std::size_t base_idx) mutable {
+                scatter_if_n(part_begin, part_size,
+                    std::next(map_first, base_idx),
+                    std::next(stencil_first, base_idx), dest, pred,
+                    prefetch);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                std::distance(first, last), PIKA_MOVE(f1),
+                projection_identity());
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::gather
+    inline constexpr struct gather_t final
+      : pika::detail::tag_parallel_algorithm<gather_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(pika::gather_t, ExPolicy&& policy,
+            RandIter1 map_first, RandIter1 map_last, RandIter2 input_first,
+            FwdIter dest)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            using result_type =
+                pika::parallel::detail::in_out_result<RandIter1, FwdIter>;
+
+            return pika::parallel::detail::get_second_element(
+                pika::parallel::detail::gather<result_type>().call(
+                    PIKA_FORWARD(ExPolicy, policy), map_first, map_last,
+                    input_first, dest));
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(pika::gather_t, RandIter1 map_first,
+            RandIter1 map_last, RandIter2 input_first, OutIter dest)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+
+            using result_type =
+                pika::parallel::detail::in_out_result<RandIter1, OutIter>;
+
+            return pika::parallel::detail::gather<result_type>()
+                .call(pika::execution::seq, map_first, map_last, input_first,
+                    dest)
+                .out;
+        }
+    } gather{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::scatter
+    inline constexpr struct scatter_t final
+      : pika::detail::tag_parallel_algorithm<scatter_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::scatter_t, ExPolicy&& policy, FwdIter first,
+            FwdIter last, RandIter1 map_first, RandIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::algorithm_result<ExPolicy>::get(
+                pika::parallel::detail::scatter<FwdIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last, map_first,
+                    dest));
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename RandIter1, typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(pika::scatter_t, FwdIter first,
+            FwdIter last, RandIter1 map_first, RandIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+
+            pika::parallel::detail::scatter<FwdIter>().call(
+                pika::execution::seq, first, last, map_first, dest);
+        }
+    } scatter{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::scatter_if
+    inline constexpr struct scatter_if_t final
+      : pika::detail::tag_parallel_algorithm<scatter_if_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter1,
+            typename RandIter2, typename RandIter3,
+            typename Pred = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<RandIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::scatter_if_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, RandIter1 map_first,
+            RandIter2 stencil_first, RandIter3 dest, Pred&& pred = Pred())
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value &&
+                    pika::traits::is_random_access_iterator<RandIter3>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::algorithm_result<ExPolicy>::get(
+                pika::parallel::detail::scatter_if<FwdIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last, map_first,
+                    stencil_first, dest, PIKA_FORWARD(Pred, pred)));
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename RandIter1, typename RandIter2,
+            typename RandIter3,
+            typename Pred = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<RandIter3>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(pika::scatter_if_t, FwdIter first,
+            FwdIter last, RandIter1 map_first, RandIter2 stencil_first,
+            RandIter3 dest, Pred&& pred = Pred())
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value &&
+                    pika::traits::is_random_access_iterator<RandIter3>::value,
+                "Requires a random access iterator.");
+
+            pika::parallel::detail::scatter_if<FwdIter>().call(
+                pika::execution::seq, first, last, map_first, stencil_first,
+                dest, PIKA_FORWARD(Pred, pred));
+        }
+    } scatter_if{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -122,6 +122,61 @@ namespace pika {
     typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
     generate_n(ExPolicy&& policy, FwdIter first, Size count, F&& f);
 
+    /// Assigns each element in range [first, last) a random number drawn
+    /// from the distribution \a dist. The number assigned to the element at
+    /// position i is drawn by a copy of \a dist from a
+    /// \a pika::philox4x32 engine seeded with \a seed and started at the
+    /// beginning of stream i. The result therefore only depends on
+    /// \a seed, unlike for \a generate with a stateful generator it is the
+    /// same for every execution policy and partitioning of the range.
+    ///
+    /// \note   Complexity: Exactly \a distance(first, last) copies and
+    ///         invocations of \a dist and assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Dist        The type of the random number distribution
+    ///                     (deduced), for instance
+    ///                     std::uniform_real_distribution<double>. It must
+    ///                     meet the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dist         The distribution the random numbers are drawn
+    ///                     from. It is invoked as dist(engine) with an lvalue
+    ///                     of type \a pika::philox4x32.
+    /// \param seed         The seed of the random number engines.
+    ///
+    /// The assignments in the parallel \a generate_random algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a generate_random algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a generate_random algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise. It returns \a last.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Dist>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    generate_random(ExPolicy&& policy, FwdIter first, FwdIter last,
+        Dist const& dist,
+        std::uint64_t seed = pika::philox4x32::default_seed);
+
     // clang-format on
 }    // namespace pika
 
@@ -141,10 +196,12 @@ namespace pika {
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/philox.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -224,6 +281,74 @@ namespace pika::parallel::detail {
                 });
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // generate_random
+
+    // Assigns a number drawn by a copy of dist to every element, the engine
+    // of the element at position base_idx + i of the whole range starts at
+    // the beginning of stream base_idx + i
+    template <typename Iter, typename Dist>
+    Iter sequential_generate_random(Iter first, std::size_t count,
+        std::size_t base_idx, Dist const& dist, std::uint64_t seed)
+    {
+        for (std::size_t i = 0; i != count; ++i, ++first)
+        {
+            pika::philox4x32 engine(seed, std::uint64_t(base_idx + i));
+            Dist d(dist);
+            *first = d(engine);
+        }
+        return first;
+    }
+
+    template <typename FwdIter>
+    struct generate_random
+      : public algorithm<generate_random<FwdIter>, FwdIter>
+    {
+        generate_random()
+          : generate_random::algorithm("generate_random")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Dist>
+        static Iter sequential(ExPolicy&&, Iter first, Iter last,
+            Dist const& dist, std::uint64_t seed)
+        {
+            return sequential_generate_random(first,
+                detail::distance(first, last), 0, dist, seed);
+        }
+
+        template <typename ExPolicy, typename Dist>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, FwdIter first, FwdIter last, Dist const& dist,
+            std::uint64_t seed)
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            auto f1 = [dist, seed](FwdIter part_begin, std::size_t part_size,
+                          std::size_t base_idx) -> void {
+                sequential_generate_random(
+                    part_begin, part_size, base_idx, dist, seed);
+            };
+
+            auto f2 = [first, count](
+                          std::vector<pika::future<void>>&& data) -> FwdIter {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+                return std::next(first, count);
+            };
+
+            return partitioner<ExPolicy, FwdIter, void>::call_with_index(
+                PIKA_FORWARD(ExPolicy, policy), first, count, 1,
+                PIKA_MOVE(f1), PIKA_MOVE(f2));
+        }
+    };
 }    // namespace pika::parallel::detail
 
 namespace pika {
@@ -324,5 +449,49 @@ namespace pika {
                 PIKA_FORWARD(F, f));
         }
     } generate_n{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::generate_random
+    inline constexpr struct generate_random_t final
+      : pika::detail::tag_parallel_algorithm<generate_random_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Dist,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(generate_random_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, Dist const& dist,
+            std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::generate_random<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dist, seed);
+        }
+
+        // clang-format off
+        template <typename FwdIter, typename Dist,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(generate_random_t, FwdIter first,
+            FwdIter last, Dist const& dist,
+            std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::generate_random<FwdIter>().call(
+                pika::execution::seq, first, last, dist, seed);
+        }
+    } generate_random{};
 }    // namespace pika
 #endif    // DOXYGEN
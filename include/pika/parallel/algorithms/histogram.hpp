@@ -0,0 +1,450 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Counts the elements of the range [first, last) falling into each of
+    /// the bins [bins_first, bins_last). An element *it is counted in the bin
+    /// bins_first[bin_fn(*it)], elements for which \a bin_fn returns a value
+    /// outside of [0, bins_last - bins_first) are not counted. The previous
+    /// contents of the bins are overwritten.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a bin_fn
+    ///         and O(\a bins_last - \a bins_first) assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source begin and end iterators used
+    ///                     (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the iterators referring to the bins
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its value
+    ///                     type must be an arithmetic type.
+    /// \tparam BinFn       The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a histogram requires \a BinFn to meet
+    ///                     the requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param bins_first   Refers to the beginning of the bins.
+    /// \param bins_last    Refers to the end of the bins.
+    /// \param bin_fn       Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last) to determine
+    ///                     the bin of the element. The signature of this
+    ///                     function should be equivalent to:
+    ///                     \code
+    ///                     Integral fun(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The type \a Type must be such that an object of
+    ///                     type \a FwdIter can be dereferenced and then
+    ///                     implicitly converted to it.
+    ///
+    /// The invocations of \a bin_fn in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a bin_fn in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread. Every chunk of the elements is counted into bins
+    /// of its own, which are merged along a tree afterwards. Histograms with
+    /// too many bins for a copy per chunk are counted into one set of atomic
+    /// counters instead.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a RandIter otherwise.
+    ///           The \a histogram algorithm returns \a bins_last.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename BinFn>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, RandIter>::type
+    histogram(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandIter bins_first, RandIter bins_last, BinFn&& bin_fn);
+
+    /// Counts the elements of the range [first, last) falling into each of
+    /// the bins [bins_first, bins_last). An element *it is counted in the bin
+    /// bins_first[bin_fn(*it)], elements for which \a bin_fn returns a value
+    /// outside of [0, bins_last - bins_first) are not counted. The previous
+    /// contents of the bins are overwritten.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a bin_fn
+    ///         and O(\a bins_last - \a bins_first) assignments.
+    ///
+    /// \tparam InIter      The type of the source begin and end iterators used
+    ///                     (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     input iterator.
+    /// \tparam RandIter    The type of the iterators referring to the bins
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator, its value
+    ///                     type must be an arithmetic type.
+    /// \tparam BinFn       The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param bins_first   Refers to the beginning of the bins.
+    /// \param bins_last    Refers to the end of the bins.
+    /// \param bin_fn       Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last) to determine
+    ///                     the bin of the element.
+    ///
+    /// \returns  The \a histogram algorithm returns \a bins_last.
+    ///
+    template <typename InIter, typename RandIter, typename BinFn>
+    RandIter histogram(InIter first, InIter last, RandIter bins_first,
+        RandIter bins_last, BinFn&& bin_fn);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/tree_reduce.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    /// \cond NOINTERNAL
+
+    // histograms with more bins than this are counted into one shared set of
+    // atomic counters instead of a private set of bins for every chunk
+    inline constexpr std::size_t histogram_private_bins_limit = 65536ul;
+
+    // the minimal number of elements counted by one task
+    inline constexpr std::size_t histogram_min_chunk_size = 4096ul;
+
+    template <typename BinFn, typename T>
+    std::size_t histogram_bin(BinFn& bin_fn, T&& value)
+    {
+        // negative bins are converted to (large) bins past the end
+        return static_cast<std::size_t>(
+            PIKA_INVOKE(bin_fn, PIKA_FORWARD(T, value)));
+    }
+
+    template <typename InIter, typename Sent, typename RandIter,
+        typename BinFn>
+    RandIter sequential_histogram(InIter first, Sent last,
+        RandIter bins_first, RandIter bins_last, BinFn&& bin_fn)
+    {
+        using count_type = typename std::iterator_traits<RandIter>::value_type;
+
+        std::size_t const num_bins = std::distance(bins_first, bins_last);
+        std::fill(bins_first, bins_last, count_type(0));
+        for (/**/; first != last; ++first)
+        {
+            std::size_t const bin = histogram_bin(bin_fn, *first);
+            if (bin < num_bins)
+            {
+                ++bins_first[bin];
+            }
+        }
+        return bins_last;
+    }
+
+    // -----------------------------------------------------------------------
+    // The elements are split into one chunk per core. For few bins every
+    // chunk counts into bins of its own, which are merged pairwise along a
+    // tree. For many bins that would take too much memory (and the merge
+    // would take longer than the counting), the chunks increment shared
+    // atomic counters instead.
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename FwdIter, typename RandIter,
+        typename BinFn>
+    RandIter histogram_impl(ExPolicy& policy, FwdIter first, std::size_t count,
+        RandIter bins_first, RandIter bins_last, BinFn& bin_fn)
+    {
+        using count_type = typename std::iterator_traits<RandIter>::value_type;
+
+        std::size_t const num_bins = std::distance(bins_first, bins_last);
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t num_chunks = (std::min)(cores,
+            (count + histogram_min_chunk_size - 1) / histogram_min_chunk_size);
+        num_chunks = (std::max)(num_chunks, std::size_t(1));
+
+        // the beginning of every chunk
+        std::vector<FwdIter> chunk_first;
+        chunk_first.reserve(num_chunks + 1);
+        chunk_first.push_back(first);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            chunk_first.push_back(std::next(chunk_first.back(),
+                (chunk + 1) * count / num_chunks - chunk * count / num_chunks));
+        }
+
+        if (num_bins <= histogram_private_bins_limit)
+        {
+            // the bins of every chunk are allocated (and touched first) by
+            // the task counting into them
+            std::vector<std::vector<count_type>> partial(num_chunks);
+            auto count_chunk = [&](std::size_t chunk) {
+                std::vector<count_type> bins(num_bins, count_type(0));
+                FwdIter const last = chunk_first[chunk + 1];
+                for (FwdIter it = chunk_first[chunk]; it != last; ++it)
+                {
+                    std::size_t const bin = histogram_bin(bin_fn, *it);
+                    if (bin < num_bins)
+                    {
+                        ++bins[bin];
+                    }
+                }
+                partial[chunk] = PIKA_MOVE(bins);
+            };
+            run_chunks(policy, num_chunks, count_chunk);
+
+            auto merge = [&](std::size_t i, std::size_t j) {
+                for (std::size_t bin = 0; bin != num_bins; ++bin)
+                {
+                    partial[i][bin] += partial[j][bin];
+                }
+                std::vector<count_type>().swap(partial[j]);
+            };
+            tree_reduce(policy.executor(), num_chunks, merge);
+
+            return std::copy(partial[0].begin(), partial[0].end(), bins_first);
+        }
+
+        // std::size_t is the widest type std::atomic supports fetch_add for
+        // before C++20
+        std::unique_ptr<std::atomic<std::size_t>[]> shared(
+            new std::atomic<std::size_t>[num_bins]);
+
+        auto bin_range = [&](std::size_t chunk) {
+            return std::make_pair(chunk * num_bins / num_chunks,
+                (chunk + 1) * num_bins / num_chunks);
+        };
+
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            auto const [begin, end] = bin_range(chunk);
+            for (std::size_t bin = begin; bin != end; ++bin)
+            {
+                shared[bin].store(0, std::memory_order_relaxed);
+            }
+        });
+
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            FwdIter const last = chunk_first[chunk + 1];
+            for (FwdIter it = chunk_first[chunk]; it != last; ++it)
+            {
+                std::size_t const bin = histogram_bin(bin_fn, *it);
+                if (bin < num_bins)
+                {
+                    shared[bin].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            auto const [begin, end] = bin_range(chunk);
+            for (std::size_t bin = begin; bin != end; ++bin)
+            {
+                bins_first[bin] = static_cast<count_type>(
+                    shared[bin].load(std::memory_order_relaxed));
+            }
+        });
+
+        return bins_last;
+    }
+
+    template <typename RandIter>
+    struct histogram : public algorithm<histogram<RandIter>, RandIter>
+    {
+        histogram()
+          : histogram::algorithm("histogram")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename BinFn>
+        static RandIter sequential(ExPolicy, InIter first, Sent last,
+            RandIter bins_first, RandIter bins_last, BinFn&& bin_fn)
+        {
+            return sequential_histogram(first, last, bins_first, bins_last,
+                PIKA_FORWARD(BinFn, bin_fn));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename BinFn>
+        static typename algorithm_result<ExPolicy, RandIter>::type
+        parallel(ExPolicy&& policy, FwdIter first, Sent last,
+            RandIter bins_first, RandIter bins_last, BinFn&& bin_fn)
+        {
+            using result = algorithm_result<ExPolicy, RandIter>;
+
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0 || bins_first == bins_last)
+            {
+                return result::get(sequential_histogram(first, first,
+                    bins_first, bins_last, PIKA_FORWARD(BinFn, bin_fn)));
+            }
+
+            try
+            {
+                if constexpr (pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, count, bins_first, bins_last,
+                            bin_fn = PIKA_FORWARD(BinFn, bin_fn)]() mutable
+                        -> RandIter {
+                            try
+                            {
+                                auto p = policy(pika::execution::non_task);
+                                return histogram_impl(p, first, count,
+                                    bins_first, bins_last, bin_fn);
+                            }
+                            catch (std::bad_alloc const&)
+                            {
+                                throw;
+                            }
+                            catch (pika::exception_list const&)
+                            {
+                                throw;
+                            }
+                            catch (...)
+                            {
+                                throw pika::exception_list(
+                                    std::current_exception());
+                            }
+                        }));
+                }
+                else
+                {
+                    return result::get(histogram_impl(
+                        policy, first, count, bins_first, bins_last, bin_fn));
+                }
+            }
+            catch (...)
+            {
+                return result::get(handle_exception<ExPolicy, RandIter>::call(
+                    std::current_exception()));
+            }
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::histogram
+    inline constexpr struct histogram_t final
+      : pika::detail::tag_parallel_algorithm<histogram_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandIter,
+            typename BinFn,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(pika::histogram_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, RandIter bins_first,
+            RandIter bins_last, BinFn&& bin_fn)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator for the bins.");
+            using count_type =
+                typename std::iterator_traits<RandIter>::value_type;
+            static_assert(std::is_arithmetic_v<count_type>,
+                "The bins have to be of an arithmetic type.");
+
+            return pika::parallel::detail::histogram<RandIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, bins_first,
+                bins_last, PIKA_FORWARD(BinFn, bin_fn));
+        }
+
+        // clang-format off
+        template <typename InIter, typename RandIter, typename BinFn,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(pika::histogram_t, InIter first,
+            InIter last, RandIter bins_first, RandIter bins_last,
+            BinFn&& bin_fn)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator for the bins.");
+            using count_type =
+                typename std::iterator_traits<RandIter>::value_type;
+            static_assert(std::is_arithmetic_v<count_type>,
+                "The bins have to be of an arithmetic type.");
+
+            return pika::parallel::detail::histogram<RandIter>().call(
+                pika::execution::seq, first, last, bins_first, bins_last,
+                PIKA_FORWARD(BinFn, bin_fn));
+        }
+    } histogram{};
+}    // namespace pika
+
+#endif    // DOXYGEN
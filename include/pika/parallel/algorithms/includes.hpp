@@ -102,6 +102,7 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/set_operation.hpp>
 #include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
@@ -184,6 +185,62 @@ namespace pika::parallel::detail {
         return true;
     }
 
+    // includes for a second sequence much shorter than the first one: the
+    // elements of the second sequence are searched for by galloping through
+    // the first sequence
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2, typename CancelToken>
+    bool sequential_includes_gallop(Iter1 first1, Iter1 last1, Iter2 first2,
+        Iter2 last2, F&& f, Proj1&& proj1, Proj2&& proj2, CancelToken& tok)
+    {
+        for (/**/; first2 != last2; ++first2)
+        {
+            if (tok.was_cancelled())
+            {
+                return false;
+            }
+
+            auto&& value2 = PIKA_INVOKE(proj2, *first2);
+            first1 =
+                detail::gallop_lower_bound(first1, last1, value2, f, proj1);
+            if (first1 == last1 ||
+                PIKA_INVOKE(f, value2, PIKA_INVOKE(proj1, *first1)))
+            {
+                return false;
+            }
+            ++first1;
+        }
+        return true;
+    }
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    bool sequential_includes_gallop(Iter1 first1, Iter1 last1, Iter2 first2,
+        Iter2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        for (/**/; first2 != last2; ++first2)
+        {
+            auto&& value2 = PIKA_INVOKE(proj2, *first2);
+            first1 =
+                detail::gallop_lower_bound(first1, last1, value2, f, proj1);
+            if (first1 == last1 ||
+                PIKA_INVOKE(f, value2, PIKA_INVOKE(proj1, *first1)))
+            {
+                return false;
+            }
+            ++first1;
+        }
+        return true;
+    }
+
+    template <typename Iter1, typename Iter2>
+    constexpr bool includes_gallop(
+        Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2)
+    {
+        return std::size_t(last2 - first2) * set_operation_gallop_ratio <=
+            std::size_t(last1 - first1);
+    }
+
     ///////////////////////////////////////////////////////////////////////
     struct includes : public algorithm<includes, bool>
     {
@@ -192,12 +249,29 @@ namespace pika::parallel::detail {
         {
         }
 
+        // both input ranges make up the work, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_two_ranges(args...);
+        }
+
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename F, typename Proj1,
             typename Proj2>
         static bool sequential(ExPolicy, Iter1 first1, Sent1 last1,
             Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
+            if constexpr (set_operation_can_gallop_v<Iter1, Sent1, Iter2,
+                              Sent2>)
+            {
+                if (includes_gallop(first1, last1, first2, last2))
+                {
+                    return sequential_includes_gallop(first1, last1, first2,
+                        last2, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+                        PIKA_FORWARD(Proj2, proj2));
+                }
+            }
             return sequential_includes(first1, last1, first2, last2,
                 PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
                 PIKA_FORWARD(Proj2, proj2));
@@ -274,8 +348,28 @@ namespace pika::parallel::detail {
                     }
                 }
 
-                if (!sequential_includes(
-                        low, high, part_begin, part_end, f, proj1, proj2, tok))
+                bool found = false;
+                if constexpr (set_operation_can_gallop_v<Iter1, Iter1, Iter2,
+                                  Iter2>)
+                {
+                    if (includes_gallop(low, high, part_begin, part_end))
+                    {
+                        found = sequential_includes_gallop(low, high,
+                            part_begin, part_end, f, proj1, proj2, tok);
+                    }
+                    else
+                    {
+                        found = sequential_includes(low, high, part_begin,
+                            part_end, f, proj1, proj2, tok);
+                    }
+                }
+                else
+                {
+                    found = sequential_includes(
+                        low, high, part_begin, part_end, f, proj1, proj2, tok);
+                }
+
+                if (!found)
                 {
                     tok.cancel();
                 }
@@ -226,7 +226,9 @@ namespace pika {
 #include <pika/functional/invoke.hpp>
 #include <pika/iterator_support/range.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_find.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
@@ -260,8 +262,25 @@ namespace pika::parallel::detail {
         static bool
         sequential(ExPolicy, FwdIter first, Sent last, Pred&& pred, Proj&& proj)
         {
-            return is_sorted_sequential(first, last, PIKA_FORWARD(Pred, pred),
-                PIKA_FORWARD(Proj, proj));
+            if constexpr (is_sized_range_v<FwdIter, Sent>)
+            {
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last));
+                if (count < 2)
+                {
+                    return true;
+                }
+
+                return sequential_adjacent_find_n<std::decay_t<ExPolicy>>(
+                           first, count - 1,
+                           reversed_comparison<Pred&>{pred},
+                           PIKA_FORWARD(Proj, proj)) == count - 1;
+            }
+            else
+            {
+                return is_sorted_sequential(first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            }
         }
 
         template <typename ExPolicy, typename Pred, typename Proj>
@@ -277,35 +296,22 @@ namespace pika::parallel::detail {
             if (count <= 1)
                 return result::get(true);
 
-            invoke_projected<Pred, Proj> pred_projected{
-                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj)};
-
             util::cancellation_token<> tok;
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
-            auto f1 = [tok, last, pred_projected = PIKA_MOVE(pred_projected)](
-                          FwdIter part_begin,
+            // the partitions cover the count - 1 adjacent pairs, the last
+            // pair of a partition reads the first element of the next one
+            auto f1 = [tok, pred = PIKA_FORWARD(Pred, pred),
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
                           std::size_t part_size) mutable -> bool {
-                FwdIter trail = part_begin++;
-                loop_n<std::decay_t<ExPolicy>>(part_begin, part_size - 1,
-                    [&trail, &tok, &pred_projected](
-                        FwdIter it) mutable -> void {
-                        if (pika::util::detail::invoke(
-                                pred_projected, *it, *trail++))
-                        {
-                            tok.cancel();
-                        }
-                    });
-
-                FwdIter i = trail++;
-                // trail now points one past the current grouping
-                // unless canceled
-
-                if (!tok.was_cancelled() && trail != last)
+                std::size_t const found =
+                    adjacent_find_partition<std::decay_t<ExPolicy>>(
+                        part_begin, part_size,
+                        [&tok](std::size_t) { return tok.was_cancelled(); },
+                        reversed_comparison<decltype(pred)&>{pred}, proj);
+                if (found != part_size)
                 {
-                    return !pika::util::detail::invoke(
-                        pred_projected, *trail, *i);
+                    tok.cancel();
+                    return false;
                 }
                 return !tok.was_cancelled();
             };
@@ -317,8 +323,8 @@ namespace pika::parallel::detail {
             };
 
             return partitioner<ExPolicy, bool>::call(
-                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+                PIKA_FORWARD(ExPolicy, policy), first, count - 1,
+                PIKA_MOVE(f1), PIKA_MOVE(f2));
         }
     };
     /// \endcond
@@ -339,8 +345,26 @@ namespace pika::parallel::detail {
         static FwdIter
         sequential(ExPolicy, FwdIter first, Sent last, Pred&& pred, Proj&& proj)
         {
-            return is_sorted_until_sequential(first, last,
-                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            if constexpr (is_sized_range_v<FwdIter, Sent>)
+            {
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last));
+                if (count < 2)
+                {
+                    return std::next(first, count);
+                }
+
+                std::size_t const found =
+                    sequential_adjacent_find_n<std::decay_t<ExPolicy>>(first,
+                        count - 1, reversed_comparison<Pred&>{pred},
+                        PIKA_FORWARD(Proj, proj));
+                return std::next(first, found + 1);
+            }
+            else
+            {
+                return is_sorted_until_sequential(first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            }
         }
 
         template <typename ExPolicy, typename Pred, typename Proj>
@@ -348,7 +372,6 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, Pred&& pred,
             Proj&& proj)
         {
-            using reference = typename std::iterator_traits<FwdIter>::reference;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
             using result = algorithm_result<ExPolicy, FwdIter>;
@@ -357,38 +380,26 @@ namespace pika::parallel::detail {
             if (count <= 1)
                 return result::get(PIKA_MOVE(last));
 
-            invoke_projected<Pred, Proj> pred_projected{
-                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj)};
-
-            util::cancellation_token<difference_type> tok(count);
+            // the position of the first pair out of order, the pair
+            // (count - 2, count - 1) is the last one
+            util::cancellation_token<difference_type> tok(count - 1);
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
-            auto f1 = [tok, last, pred_projected = PIKA_MOVE(pred_projected)](
-                          FwdIter part_begin, std::size_t part_size,
+            // the partitions cover the count - 1 adjacent pairs, the last
+            // pair of a partition reads the first element of the next one
+            auto f1 = [tok, pred = PIKA_FORWARD(Pred, pred),
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
+                          std::size_t part_size,
                           std::size_t base_idx) mutable -> void {
-                FwdIter trail = part_begin++;
-                loop_idx_n<std::decay_t<ExPolicy>>(++base_idx, part_begin,
-                    part_size - 1, tok,
-                    [&trail, &tok, &pred_projected](
-                        reference& v, std::size_t ind) -> void {
-                        if (pika::util::detail::invoke(
-                                pred_projected, v, *trail++))
-                        {
-                            tok.cancel(ind);
-                        }
-                    });
-
-                FwdIter i = trail++;
-
-                //trail now points one past the current grouping
-                //unless canceled
-                if (!tok.was_cancelled(base_idx + part_size) && trail != last)
+                std::size_t const found =
+                    adjacent_find_partition<std::decay_t<ExPolicy>>(
+                        part_begin, part_size,
+                        [&tok, base_idx](std::size_t offset) {
+                            return tok.was_cancelled(base_idx + offset);
+                        },
+                        reversed_comparison<decltype(pred)&>{pred}, proj);
+                if (found != part_size)
                 {
-                    if (PIKA_INVOKE(pred_projected, *trail, *i))
-                    {
-                        tok.cancel(base_idx + part_size);
-                    }
+                    tok.cancel(base_idx + found);
                 }
             };
             auto f2 =
@@ -398,13 +409,15 @@ namespace pika::parallel::detail {
                 // attached to futures are invalidated
                 data.clear();
 
-                difference_type loc = tok.get_data();
+                // the second element of the pair is the first one out of
+                // order
+                difference_type loc = tok.get_data() + 1;
                 std::advance(first, loc);
                 return PIKA_MOVE(first);
             };
             return partitioner<ExPolicy, FwdIter, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy), first, count, 1, PIKA_MOVE(f1),
-                PIKA_MOVE(f2));
+                PIKA_FORWARD(ExPolicy, policy), first, count - 1, 1,
+                PIKA_MOVE(f1), PIKA_MOVE(f2));
         }
     };
     /// \endcond
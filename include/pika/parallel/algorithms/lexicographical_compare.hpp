@@ -164,6 +164,8 @@ namespace pika {
 
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/algorithms/mismatch.hpp>
@@ -198,17 +200,41 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, InIter1 first1, Sent1 last1, InIter2 first2,
             Sent2 last2, Pred&& pred, Proj1&& proj1, Proj2&& proj2)
         {
-            for (; (first1 != last1) && (first2 != last2);
-                 ++first1, (void) ++first2)
+            if constexpr (is_sized_range_v<InIter1, Sent1> &&
+                is_sized_range_v<InIter2, Sent2>)
             {
-                if (PIKA_INVOKE(pred, PIKA_INVOKE(proj1, *first1),
-                        PIKA_INVOKE(proj2, *first2)))
-                    return true;
-                if (PIKA_INVOKE(pred, PIKA_INVOKE(proj2, *first2),
-                        PIKA_INVOKE(proj1, *first1)))
-                    return false;
+                std::size_t const count1 =
+                    static_cast<std::size_t>(detail::distance(first1, last1));
+                std::size_t const count2 =
+                    static_cast<std::size_t>(detail::distance(first2, last2));
+                std::size_t const count = (std::min)(count1, count2);
+
+                std::size_t const mismatched =
+                    sequential_mismatch_n<std::decay_t<ExPolicy>>(first1,
+                        first2, count, equivalent_to<std::decay_t<Pred>>{pred},
+                        proj1, proj2);
+                if (mismatched != count)
+                {
+                    return PIKA_INVOKE(pred,
+                        PIKA_INVOKE(proj1, *std::next(first1, mismatched)),
+                        PIKA_INVOKE(proj2, *std::next(first2, mismatched)));
+                }
+                return count1 < count2;
+            }
+            else
+            {
+                for (; (first1 != last1) && (first2 != last2);
+                     ++first1, (void) ++first2)
+                {
+                    if (PIKA_INVOKE(pred, PIKA_INVOKE(proj1, *first1),
+                            PIKA_INVOKE(proj2, *first2)))
+                        return true;
+                    if (PIKA_INVOKE(pred, PIKA_INVOKE(proj2, *first2),
+                            PIKA_INVOKE(proj1, *first1)))
+                        return false;
+                }
+                return (first1 == last1) && (first2 != last2);
             }
-            return (first1 == last1) && (first2 != last2);
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent1,
@@ -219,7 +245,6 @@ namespace pika::parallel::detail {
             Sent2 last2, Pred&& pred, Proj1&& proj1, Proj2&& proj2)
         {
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             std::size_t count1 = detail::distance(first1, last1);
             std::size_t count2 = detail::distance(first2, last2);
@@ -239,22 +264,25 @@ namespace pika::parallel::detail {
             std::size_t count = (std::min)(count1, count2);
             util::cancellation_token<std::size_t> tok(count);
 
-            auto f1 = [tok, pred, proj1, proj2](zip_iterator it,
-                          std::size_t part_count,
+            // the elements are compared until the first position at which
+            // one of them is ordered before the other
+            using equivalent_type = equivalent_to<std::decay_t<Pred>>;
+
+            auto f1 = [tok, equivalent = equivalent_type{pred}, proj1, proj2](
+                          zip_iterator it, std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&pred, &tok, &proj1, &proj2](
-                        reference t, std::size_t i) mutable -> void {
-                        using std::get;
-                        if (PIKA_INVOKE(pred, PIKA_INVOKE(proj1, get<0>(t)),
-                                PIKA_INVOKE(proj2, get<1>(t))) ||
-                            PIKA_INVOKE(pred, PIKA_INVOKE(proj2, get<1>(t)),
-                                PIKA_INVOKE(proj1, get<0>(t))))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto iters = it.get_iterator_tuple();
+                std::size_t const mismatched =
+                    mismatch_partition<std::decay_t<ExPolicy>>(
+                        std::get<0>(iters), std::get<1>(iters), part_count,
+                        [&tok, base_idx](std::size_t offset) {
+                            return tok.was_cancelled(base_idx + offset);
+                        },
+                        equivalent, proj1, proj2);
+                if (mismatched != part_count)
+                {
+                    tok.cancel(base_idx + mismatched);
+                }
             };
 
             auto f2 =
@@ -95,12 +95,48 @@ namespace pika {
     typename pika::parallel::detail::algorithm_result<ExPolicy>::type
     make_heap(ExPolicy&& policy, RndIter first, RndIter last);
 
+    /// Inserts the last \a count elements of the range [first, last) into
+    /// the \a max \a heap [first, last - count), making [first, last) a
+    /// heap. The ancestors of the inserted elements are sifted down level by
+    /// level starting with the lowest one, the levels holding many of them
+    /// are sifted down concurrently.
+    ///
+    /// \note Complexity: O(\a count + log(N)) sift downs where
+    ///       \a N = distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RndIter     The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the comparison function object
+    ///                     (deduced). This defaults to std::less<>
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the inserted elements.
+    /// \param count        The number of elements at the end of the range
+    ///                     which are inserted into the heap.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second.
+    ///
+    /// \returns  The \a push_heap_n algorithm returns a \a pika::future<void>
+    ///           if the execution policy is of type \a task_execution_policy
+    ///           and returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename RndIter, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+    push_heap_n(ExPolicy&& policy, RndIter first, RndIter last,
+        std::size_t count, Comp&& comp = Comp());
+
     // clang-format on
 }    // namespace pika
 
 #else    // DOXYGEN
 
 #include <pika/config.hpp>
+#include <pika/assert.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/bind_front.hpp>
 #include <pika/functional/invoke.hpp>
@@ -122,14 +158,12 @@ namespace pika {
 #include <pika/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <exception>
 #include <functional>
 #include <iterator>
 #include <list>
 #include <memory>
-#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -138,72 +172,106 @@ namespace pika::parallel::detail {
     //////////////////////////////////////////////////////////////////////
     // make_heap
     // Perform bottom up heap construction given a range of elements.
-    // sift_down_range will take a range from [start,start-count) and
-    // apply sift_down to each element in the range
+    // sift_down moves the element at start down to its place in the heap
+    // rooted at start. It descends along the larger children to a leaf with
+    // one comparison per level first and then climbs back up to the place
+    // of the element (Wegener's bottom-up sift). Most elements end up close
+    // to the leaves, this needs about half the comparisons of a sift down
+    // which compares the element to the larger child on every level.
     template <typename RndIter, typename Comp, typename Proj>
     void sift_down(RndIter first, Comp&& comp, Proj&& proj,
         typename std::iterator_traits<RndIter>::difference_type len,
         RndIter start)
     {
-        typename std::iterator_traits<RndIter>::difference_type child =
-            start - first;
+        using difference_type =
+            typename std::iterator_traits<RndIter>::difference_type;
 
-        if (len < 2 || (len - 2) / 2 < child)
+        difference_type const hole = start - first;
+        if (len < 2 || (len - 2) / 2 < hole)
             return;
 
-        child = 2 * child + 1;
-        RndIter child_i = first + child;
+        // the leaf at the end of the path of larger children
+        difference_type leaf = hole;
+        while (2 * leaf + 2 < len)
+        {
+            difference_type child = 2 * leaf + 1;
+            if (PIKA_INVOKE(comp, PIKA_INVOKE(proj, first[child]),
+                    PIKA_INVOKE(proj, first[child + 1])))
+            {
+                ++child;
+            }
+            leaf = child;
+        }
+        if (2 * leaf + 1 < len)
+        {
+            leaf = 2 * leaf + 1;
+        }
 
-        if ((child + 1) < len &&
-            PIKA_INVOKE(comp, PIKA_INVOKE(proj, *child_i),
-                PIKA_INVOKE(proj, *(child_i + 1))))
+        // the first element on the path which is not less than the sifted
+        // element takes its place
+        while (leaf != hole &&
+            PIKA_INVOKE(comp, PIKA_INVOKE(proj, first[leaf]),
+                PIKA_INVOKE(proj, *start)))
         {
-            ++child_i;
-            ++child;
+            leaf = (leaf - 1) / 2;
         }
 
-        if (PIKA_INVOKE(
-                comp, PIKA_INVOKE(proj, *child_i), PIKA_INVOKE(proj, *start)))
+        difference_type levels = 0;
+        for (difference_type l = leaf; l != hole; l = (l - 1) / 2)
+        {
+            ++levels;
+        }
+        if (levels == 0)
             return;
 
-        typename std::iterator_traits<RndIter>::value_type top = *start;
-
-        do
+        // move the elements on the path from hole to leaf up by one level,
+        // the ancestor of leaf k levels above it is ((leaf + 1) >> k) - 1
+        typename std::iterator_traits<RndIter>::value_type top =
+            PIKA_MOVE(*start);
+        difference_type pos = hole;
+        for (difference_type k = levels - 1; k >= 0; --k)
         {
-            *start = *child_i;
-            start = child_i;
-
-            if ((len - 2) / 2 < child)
-                break;
-
-            child = 2 * child + 1;
-            child_i = first + child;
-
-            if ((child + 1) < len &&
-                PIKA_INVOKE(comp, PIKA_INVOKE(proj, *child_i),
-                    PIKA_INVOKE(proj, *(child_i + 1))))
-            {
-                ++child_i;
-                ++child;
-            }
-
-        } while (!PIKA_INVOKE(
-            comp, PIKA_INVOKE(proj, *child_i), PIKA_INVOKE(proj, top)));
-
-        *start = top;
+            difference_type const next = ((leaf + 1) >> k) - 1;
+            first[pos] = PIKA_MOVE(first[next]);
+            pos = next;
+        }
+        first[pos] = PIKA_MOVE(top);
     }
 
+    // Build the heap rooted at root, the subtrees of different roots are
+    // independent of each other. The descendants of root d levels below it
+    // are the 2^d elements starting at (root + 1) * 2^d - 1.
     template <typename RndIter, typename Comp, typename Proj>
-    void sift_down_range(RndIter first, Comp&& comp, Proj&& proj,
+    void sift_down_subtree(RndIter first, Comp&& comp, Proj&& proj,
         typename std::iterator_traits<RndIter>::difference_type len,
-        RndIter start, std::size_t count)
+        typename std::iterator_traits<RndIter>::difference_type root)
     {
-        for (std::size_t i = 0; i != count; ++i)
+        using difference_type =
+            typename std::iterator_traits<RndIter>::difference_type;
+
+        // the deepest level of the subtree holding elements with children
+        difference_type const last_parent = (len - 2) / 2;
+        difference_type depth = 0;
+        while (((root + 1) << (depth + 1)) - 1 <= last_parent)
         {
-            sift_down(first, comp, proj, len, start - i);
+            ++depth;
+        }
+
+        for (/**/; depth >= 0; --depth)
+        {
+            difference_type const level_first = ((root + 1) << depth) - 1;
+            difference_type const level_last = (std::min)(
+                level_first + (difference_type(1) << depth) - 1, last_parent);
+            for (difference_type i = level_last; i >= level_first; --i)
+            {
+                sift_down(first, comp, proj, len, first + i);
+            }
         }
     }
 
+    // make_heap runs sequentially below this number of elements
+    inline constexpr std::size_t make_heap_sequential_limit = 65536;
+
     template <typename Iter, typename Sent, typename Comp, typename Proj>
     Iter sequential_make_heap(Iter first, Sent last, Comp&& comp, Proj&& proj)
     {
@@ -240,14 +308,76 @@ namespace pika::parallel::detail {
                 PIKA_FORWARD(Proj, proj));
         }
 
+        // The subtrees rooted at the level holding at least four nodes per
+        // core are built concurrently without synchronizing between their
+        // levels. The few nodes above that level are sifted down
+        // sequentially afterwards.
+        template <typename ExPolicy, typename RndIter, typename Comp,
+            typename Proj>
+        static void make_heap_subtrees(ExPolicy&& policy, RndIter first,
+            typename std::iterator_traits<RndIter>::difference_type n,
+            Comp& comp, Proj& proj,
+            std::vector<pika::future<void>>& workitems,
+            std::list<std::exception_ptr>& errors)
+        {
+            using difference_type =
+                typename std::iterator_traits<RndIter>::difference_type;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            difference_type const last_parent = (n - 2) / 2;
+            difference_type split_first = 0;
+            while (split_first + 1 < difference_type(4 * cores) &&
+                2 * split_first + 1 <= last_parent)
+            {
+                split_first = 2 * split_first + 1;
+            }
+
+            std::vector<difference_type> roots;
+            difference_type const split_last =
+                (std::min)(2 * split_first, last_parent);
+            roots.reserve(split_last - split_first + 1);
+            for (difference_type root = split_first; root <= split_last;
+                 ++root)
+            {
+                roots.push_back(root);
+            }
+
+            auto op = [=](difference_type root) {
+                sift_down_subtree(first, comp, proj, n, root);
+            };
+            workitems =
+                execution::bulk_async_execute(policy.executor(), op, roots);
+
+            // the only synchronization needed
+            pika::wait_all_nothrow(workitems);
+
+            // collect exceptions
+            handle_local_exceptions<ExPolicy>::call(workitems, errors, false);
+            workitems.clear();
+
+            // Perform sift down for the nodes above the subtrees
+            if (errors.empty())
+            {
+                for (difference_type start = split_first - 1; start >= 0;
+                     --start)
+                {
+                    sift_down(first, comp, proj, n, first + start);
+                }
+            }
+        }
+
         template <typename ExPolicy, typename RndIter, typename Sent,
             typename Comp, typename Proj>
         static typename algorithm_result<ExPolicy, RndIter>::type
         make_heap_thread(ExPolicy&& policy, RndIter first, Sent last,
             Comp&& comp, Proj&& proj)
         {
-            typename std::iterator_traits<RndIter>::difference_type n =
-                last - first;
+            using difference_type =
+                typename std::iterator_traits<RndIter>::difference_type;
+
+            difference_type n = last - first;
             if (n <= 1)
             {
                 return algorithm_result<ExPolicy, RndIter>::get(
@@ -268,95 +398,20 @@ namespace pika::parallel::detail {
             std::vector<pika::future<void>> workitems;
             std::list<std::exception_ptr> errors;
 
-            using tuple_type = std::tuple<RndIter, std::size_t>;
-
-            auto op = [=](tuple_type const& t) {
-                sift_down_range(first, comp, proj, (std::size_t) n,
-                    std::get<0>(t), std::get<1>(t));
-            };
-
-            std::size_t const cores = execution::processing_units_count(
-                policy.parameters(), policy.executor());
-
-            // Take a standard chunk size (amount of work / cores), and only
-            // take a quarter of that. If our chunk size is too large a LOT
-            // of the work will be done sequentially due to the level
-            // barrier of heap parallelism.
-            // 1/4 of the standard chunk size is an estimate to lower the
-            // average number of levels done sequentially
-            std::size_t chunk_size = execution::get_chunk_size(
-                policy.parameters(), policy.executor(),
-                [](std::size_t) { return 0; }, cores, n);
-            chunk_size /= 4;
-
-            std::size_t max_chunks = execution::maximal_number_of_chunks(
-                policy.parameters(), policy.executor(), cores, n);
-
-            adjust_chunk_size_and_max_chunks(cores, n, chunk_size, max_chunks);
-
             try
             {
-                // Get workitems that are to be run in parallel
-                std::size_t start = (n - 2) / 2;
-                while (start > 0)
+                // small heaps are built sequentially
+                if (std::size_t(n) < make_heap_sequential_limit)
                 {
-                    // Index of start of level, and amount of items in level
-                    std::size_t end_exclusive =
-                        (std::size_t) std::pow(
-                            2, std::floor(std::log2(start))) -
-                        2;
-                    std::size_t level_items = (start - end_exclusive);
-
-                    // If we can't at least run two chunks in parallel,
-                    // don't bother parallelizing and simply run sequentially
-                    if (chunk_size * 2 > level_items)
-                    {
-                        op(std::make_tuple(first + start, level_items));
-                    }
-                    else
-                    {
-                        std::vector<tuple_type> shapes;
-                        shapes.reserve(level_items / chunk_size + 1);
-
-                        std::size_t cnt = 0;
-                        while (cnt + chunk_size < level_items)
-                        {
-                            shapes.push_back(std::make_tuple(
-                                first + start - cnt, chunk_size));
-                            cnt += chunk_size;
-                        }
-
-                        // Schedule any left-over work
-                        if (cnt < level_items)
-                        {
-                            shapes.push_back(std::make_tuple(
-                                first + start - cnt, level_items - cnt));
-                        }
-
-                        // Reserve items/chunk_size spaces for async calls
-                        workitems = execution::bulk_async_execute(
-                            policy.executor(), op, shapes);
-
-                        // Required synchronization per level
-                        pika::wait_all_nothrow(workitems);
-
-                        // collect exceptions
-                        handle_local_exceptions<ExPolicy>::call(
-                            workitems, errors, false);
-                        workitems.clear();
-                    }
-
-                    if (!errors.empty())
-                        break;    // stop on errors
-
-                    start = end_exclusive;
+                    sequential_make_heap(first, last, comp, proj);
+                }
+                else
+                {
+                    make_heap_subtrees(PIKA_FORWARD(ExPolicy, policy), first,
+                        n, comp, proj, workitems, errors);
                 }
 
                 scoped_params.mark_end_of_scheduling();
-
-                // Perform sift down for the head node
-                sift_down(first, comp = PIKA_FORWARD(Comp, comp),
-                    proj = PIKA_FORWARD(Proj, proj), n, first);
             }
             catch (...)
             {
@@ -395,6 +450,236 @@ namespace pika::parallel::detail {
                 });
         }
     };
+
+    //////////////////////////////////////////////////////////////////////
+    // push_heap_n
+    // Call f(begin, end) for the ranges of nodes with children on the given
+    // level (above the deepest one) of a heap of n elements whose subtrees
+    // hold one of the elements [m, n). The subtrees of the nodes on the left
+    // of a level reach down to the deepest level of the heap, the subtrees
+    // of the nodes on its right end one level above. The largest element in
+    // the subtree of a node grows from left to right on both sides, the
+    // affected nodes are a suffix of each side.
+    template <typename Size, typename F>
+    void heap_affected_nodes(Size n, Size m, Size depth, Size level, F&& f)
+    {
+        Size const last_parent = (n - 2) / 2;
+        Size const level_first = (Size(1) << level) - 1;
+        Size const level_last = (std::min)(2 * level_first, last_parent);
+        if (level_first > level_last)
+        {
+            return;
+        }
+
+        // the first node x whose subtree ends above the deepest level, the
+        // largest element of the subtree of x is (x + 2) * 2^j - 2 if it
+        // ends j levels below x
+        Size const split = n >> (depth - level);
+        auto first_affected = [&](Size j) {
+            Size const scale = Size(1) << j;
+            Size const x = (m + 2 + scale - 1) / scale;
+            return x < 2 ? Size(0) : x - 2;
+        };
+
+        Size const left_begin =
+            (std::max)(level_first, first_affected(depth - level));
+        Size const left_end = (std::min)(split, level_last + 1);
+        if (left_begin < left_end)
+        {
+            f(left_begin, left_end);
+        }
+
+        Size const right_begin = (std::max)(
+            (std::max)(split, level_first), first_affected(depth - 1 - level));
+        if (right_begin <= level_last)
+        {
+            f(right_begin, level_last + 1);
+        }
+    }
+
+    // Restore the heap property of the n elements starting at first after
+    // the elements [m, n) have been appended to the heap [first, first + m)
+    // by sifting down their ancestors level by level, starting with the
+    // lowest. sift_level(begin, end) sifts down the nodes [begin, end) of a
+    // level, which are independent of each other.
+    template <typename Size, typename F>
+    void push_heap_levels(Size n, Size m, F&& sift_level)
+    {
+        if (n < 2 || m >= n)
+        {
+            return;
+        }
+
+        Size depth = 0;
+        while ((n >> (depth + 1)) != 0)
+        {
+            ++depth;
+        }
+
+        for (Size level = depth; level-- != 0;)
+        {
+            heap_affected_nodes(n, m, depth, level, sift_level);
+        }
+    }
+
+    template <typename RndIter, typename Comp, typename Proj>
+    RndIter sequential_push_heap_n(RndIter first,
+        typename std::iterator_traits<RndIter>::difference_type n,
+        typename std::iterator_traits<RndIter>::difference_type m,
+        Comp&& comp, Proj&& proj)
+    {
+        using difference_type =
+            typename std::iterator_traits<RndIter>::difference_type;
+
+        push_heap_levels(n, m, [&](difference_type begin, difference_type end) {
+            for (difference_type i = end; i != begin; --i)
+            {
+                sift_down(first, comp, proj, n, first + (i - 1));
+            }
+        });
+        return first + n;
+    }
+
+    // the levels holding fewer affected nodes are sifted down sequentially
+    inline constexpr std::size_t push_heap_min_parallel_nodes = 4096;
+
+    template <typename Iter>
+    struct push_heap_n : public algorithm<push_heap_n<Iter>, Iter>
+    {
+        push_heap_n()
+          : push_heap_n::algorithm("push_heap_n")
+        {
+        }
+
+        template <typename ExPolicy, typename RndIter, typename Comp,
+            typename Proj>
+        static RndIter sequential(ExPolicy, RndIter first, RndIter last,
+            std::size_t count, Comp&& comp, Proj&& proj)
+        {
+            auto const n = last - first;
+            return sequential_push_heap_n(first, n,
+                n - static_cast<decltype(n)>(count), comp, proj);
+        }
+
+        template <typename ExPolicy, typename RndIter, typename Comp,
+            typename Proj>
+        static RndIter push_heap_thread(ExPolicy&& policy, RndIter first,
+            RndIter last, std::size_t count, Comp& comp, Proj& proj)
+        {
+            using difference_type =
+                typename std::iterator_traits<RndIter>::difference_type;
+
+            difference_type const n = last - first;
+            difference_type const m = n - difference_type(count);
+
+            std::vector<pika::future<void>> workitems;
+            std::list<std::exception_ptr> errors;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            try
+            {
+                push_heap_levels(n, m,
+                    [&](difference_type begin, difference_type end) {
+                        // stop at the first level which failed
+                        if (!errors.empty())
+                        {
+                            return;
+                        }
+
+                        std::size_t const nodes = std::size_t(end - begin);
+                        if (nodes < push_heap_min_parallel_nodes)
+                        {
+                            sift_down_nodes(first, comp, proj, n,
+                                std::make_pair(begin, end));
+                            return;
+                        }
+
+                        // Only the levels close to the appended elements
+                        // hold enough nodes to be sifted concurrently, each
+                        // of them needs to be complete before the next one
+                        std::size_t const chunks = (std::min)(4 * cores,
+                            4 * nodes / push_heap_min_parallel_nodes);
+                        std::vector<std::pair<difference_type, difference_type>>
+                            shapes;
+                        shapes.reserve(chunks);
+                        for (std::size_t i = 0; i != chunks; ++i)
+                        {
+                            shapes.emplace_back(
+                                begin + difference_type(i * nodes / chunks),
+                                begin +
+                                    difference_type((i + 1) * nodes / chunks));
+                        }
+
+                        auto op = [=](std::pair<difference_type,
+                                      difference_type> const& shape) {
+                            sift_down_nodes(first, comp, proj, n, shape);
+                        };
+                        workitems = execution::bulk_async_execute(
+                            policy.executor(), op, shapes);
+                        pika::wait_all_nothrow(workitems);
+
+                        // collect exceptions
+                        handle_local_exceptions<ExPolicy>::call(
+                            workitems, errors, false);
+                        workitems.clear();
+                    });
+            }
+            catch (...)
+            {
+                handle_local_exceptions<ExPolicy>::call(
+                    std::current_exception(), errors);
+            }
+
+            // rethrow exceptions, if any
+            handle_local_exceptions<ExPolicy>::call(workitems, errors);
+
+            return last;
+        }
+
+        template <typename ExPolicy, typename RndIter, typename Comp,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, RndIter>::type
+        parallel(ExPolicy&& policy, RndIter first, RndIter last,
+            std::size_t count, Comp&& comp, Proj&& proj)
+        {
+            using result = algorithm_result<ExPolicy, RndIter>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, last, count,
+                        comp = PIKA_FORWARD(Comp, comp),
+                        proj = PIKA_FORWARD(Proj, proj)]() mutable {
+                        auto p = policy(pika::execution::non_task);
+                        return push_heap_thread(
+                            p, first, last, count, comp, proj);
+                    }));
+            }
+            else
+            {
+                return result::get(
+                    push_heap_thread(policy, first, last, count, comp, proj));
+            }
+        }
+
+    private:
+        // sift down the nodes [shape.first, shape.second) of one level
+        template <typename RndIter, typename Comp, typename Proj>
+        static void sift_down_nodes(RndIter first, Comp&& comp, Proj&& proj,
+            typename std::iterator_traits<RndIter>::difference_type n,
+            std::pair<typename std::iterator_traits<RndIter>::difference_type,
+                typename std::iterator_traits<RndIter>::difference_type> const&
+                shape)
+        {
+            for (auto i = shape.second; i != shape.first; --i)
+            {
+                sift_down(first, comp, proj, n, first + (i - 1));
+            }
+        }
+    };
 }    // namespace pika::parallel::detail
 
 namespace pika {
@@ -498,6 +783,68 @@ namespace pika {
                 pika::parallel::detail::projection_identity{});
         }
     } make_heap{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::push_heap_n
+    inline constexpr struct push_heap_n_t final
+      : pika::detail::tag_parallel_algorithm<push_heap_n_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RndIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RndIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RndIter>::value_type,
+                    typename std::iterator_traits<RndIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(push_heap_n_t, ExPolicy&& policy, RndIter first,
+            RndIter last, std::size_t count, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RndIter>::value,
+                "Requires random access iterator.");
+
+            PIKA_ASSERT(count <= std::size_t(last - first));
+
+            return pika::parallel::detail::algorithm_result<ExPolicy>::get(
+                pika::parallel::detail::push_heap_n<RndIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last, count,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename RndIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RndIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RndIter>::value_type,
+                    typename std::iterator_traits<RndIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(push_heap_n_t, RndIter first,
+            RndIter last, std::size_t count, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RndIter>::value,
+                "Requires random access iterator.");
+
+            PIKA_ASSERT(count <= std::size_t(last - first));
+
+            pika::parallel::detail::push_heap_n<RndIter>().call(
+                pika::execution::seq, first, last, count,
+                PIKA_FORWARD(Comp, comp),
+                pika::parallel::detail::projection_identity{});
+        }
+    } push_heap_n{};
 }    // namespace pika
 
 #endif    // DOXYGEN
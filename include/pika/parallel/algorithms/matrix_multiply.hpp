@@ -0,0 +1,398 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/matrix_multiply.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The blocking of the product C = A B. C is split into tiles of
+    // mc x nc elements, the tiles are the units of parallel work. The
+    // product of a tile is accumulated over panels of kc columns of A and
+    // kc rows of B. The panels are packed into buffers of micro-panels of
+    // mr rows of A and nr columns of B, the micro-kernel keeps the mr x nr
+    // block of C it computes in registers.
+    template <typename T>
+    struct matrix_multiply_blocking
+    {
+        // two vectors of 32 bytes per row of the register block
+        static constexpr std::size_t nr =
+            (std::max)(std::size_t(64) / sizeof(T), std::size_t(1));
+        static constexpr std::size_t mr = 4;
+
+        // the packed micro-panels of A stay in the second level cache, a
+        // micro-panel of B in the first level cache
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t mc = 16 * mr;
+        static constexpr std::size_t nc =
+            (std::max)(256 / nr, std::size_t(1)) * nr;
+    };
+
+    // Packs the mc x kc block of A starting at a, whose rows are lda
+    // elements apart, into micro-panels of mr rows. A micro-panel holds
+    // the mr values of its rows for every column, rows beyond mc are zero.
+    template <std::size_t MR, typename T, typename Iter>
+    void matrix_multiply_pack_a(Iter a, std::size_t lda, std::size_t mc,
+        std::size_t kc, T* packed)
+    {
+        for (std::size_t i = 0; i < mc; i += MR)
+        {
+            std::size_t const rows = (std::min)(MR, mc - i);
+            for (std::size_t p = 0; p != kc; ++p)
+            {
+                for (std::size_t r = 0; r != rows; ++r)
+                {
+                    packed[r] = a[(i + r) * lda + p];
+                }
+                for (std::size_t r = rows; r != MR; ++r)
+                {
+                    packed[r] = T();
+                }
+                packed += MR;
+            }
+        }
+    }
+
+    // Packs the kc x nc block of B starting at b, whose rows are ldb
+    // elements apart, into micro-panels of nr columns. A micro-panel holds
+    // the nr values of its columns for every row, columns beyond nc are
+    // zero.
+    template <std::size_t NR, typename T, typename Iter>
+    void matrix_multiply_pack_b(Iter b, std::size_t ldb, std::size_t kc,
+        std::size_t nc, T* packed)
+    {
+        for (std::size_t j = 0; j < nc; j += NR)
+        {
+            std::size_t const cols = (std::min)(NR, nc - j);
+            for (std::size_t p = 0; p != kc; ++p)
+            {
+                for (std::size_t c = 0; c != cols; ++c)
+                {
+                    packed[c] = b[p * ldb + j + c];
+                }
+                for (std::size_t c = cols; c != NR; ++c)
+                {
+                    packed[c] = T();
+                }
+                packed += NR;
+            }
+        }
+    }
+
+    // Computes the MR x NR block of the product of a micro-panel of A and
+    // a micro-panel of B. The block is kept in an array of fixed size,
+    // the loop over its columns is vectorized by the compiler. The first
+    // rows x cols elements are stored to c, whose rows are ldc elements
+    // apart, or added to it if accumulate is set.
+    template <std::size_t MR, std::size_t NR, typename T, typename Iter>
+    void matrix_multiply_micro_kernel(std::size_t kc, T const* a, T const* b,
+        Iter c, std::size_t ldc, std::size_t rows, std::size_t cols,
+        bool accumulate)
+    {
+        T acc[MR][NR] = {};
+        for (std::size_t p = 0; p != kc; ++p, a += MR, b += NR)
+        {
+            for (std::size_t i = 0; i != MR; ++i)
+            {
+                T const ai = a[i];
+                for (std::size_t j = 0; j != NR; ++j)
+                {
+                    acc[i][j] += ai * b[j];
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            for (std::size_t j = 0; j != cols; ++j)
+            {
+                auto&& value = c[i * ldc + j];
+                value = accumulate ? T(value + acc[i][j]) : acc[i][j];
+            }
+        }
+    }
+
+    // Computes the tile of C with the rows [i0, i1) and the columns
+    // [j0, j1). The buffers hold the packed panels of A and B.
+    template <typename T, typename IterA, typename IterB, typename IterC>
+    void matrix_multiply_tile(IterA a, IterB b, IterC c, std::size_t n,
+        std::size_t k, std::size_t i0, std::size_t i1, std::size_t j0,
+        std::size_t j1, std::vector<T>& packed_a, std::vector<T>& packed_b)
+    {
+        using blocking = matrix_multiply_blocking<T>;
+        constexpr std::size_t mr = blocking::mr;
+        constexpr std::size_t nr = blocking::nr;
+
+        std::size_t const mc = i1 - i0;
+        std::size_t const nc = j1 - j0;
+
+        // C is overwritten by the first panel, the product is C = A B
+        if (k == 0)
+        {
+            for (std::size_t i = i0; i != i1; ++i)
+            {
+                for (std::size_t j = j0; j != j1; ++j)
+                {
+                    c[i * n + j] = T();
+                }
+            }
+            return;
+        }
+
+        packed_a.resize(((mc + mr - 1) / mr) * mr * blocking::kc);
+        packed_b.resize(((nc + nr - 1) / nr) * nr * blocking::kc);
+
+        for (std::size_t p0 = 0; p0 < k; p0 += blocking::kc)
+        {
+            std::size_t const kc = (std::min)(blocking::kc, k - p0);
+
+            matrix_multiply_pack_b<nr>(
+                b + p0 * n + j0, n, kc, nc, packed_b.data());
+            matrix_multiply_pack_a<mr>(
+                a + i0 * k + p0, k, mc, kc, packed_a.data());
+
+            for (std::size_t j = 0; j < nc; j += nr)
+            {
+                T const* pb = packed_b.data() + j * kc;
+                for (std::size_t i = 0; i < mc; i += mr)
+                {
+                    matrix_multiply_micro_kernel<mr, nr>(kc,
+                        packed_a.data() + i * kc, pb,
+                        c + (i0 + i) * n + j0 + j, n, (std::min)(mr, mc - i),
+                        (std::min)(nr, nc - j), p0 != 0);
+                }
+            }
+        }
+    }
+
+    // The tiles of C, numbered row by row.
+    struct matrix_multiply_tiles
+    {
+        std::size_t m;
+        std::size_t n;
+        std::size_t mc;
+        std::size_t nc;
+
+        std::size_t cols() const noexcept
+        {
+            return (n + nc - 1) / nc;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return ((m + mc - 1) / mc) * cols();
+        }
+
+        template <typename F>
+        void run(std::size_t tile, F& f) const
+        {
+            std::size_t const i0 = (tile / cols()) * mc;
+            std::size_t const j0 = (tile % cols()) * nc;
+            f(i0, (std::min)(i0 + mc, m), j0, (std::min)(j0 + nc, n));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename IterC>
+    struct matrix_multiply_algo
+      : public algorithm<matrix_multiply_algo<IterC>, IterC>
+    {
+        constexpr matrix_multiply_algo() noexcept
+          : matrix_multiply_algo::algorithm("matrix_multiply")
+        {
+        }
+
+        template <typename ExPolicy, typename IterA, typename IterB>
+        static IterC sequential(ExPolicy&&, IterA a, IterA, IterB b, IterC c,
+            std::size_t m, std::size_t n, std::size_t k)
+        {
+            using value_type = typename std::iterator_traits<IterC>::value_type;
+            using blocking = matrix_multiply_blocking<value_type>;
+
+            matrix_multiply_tiles const tiles{m, n, blocking::mc, blocking::nc};
+            std::vector<value_type> packed_a;
+            std::vector<value_type> packed_b;
+            auto f = [&](std::size_t i0, std::size_t i1, std::size_t j0,
+                         std::size_t j1) {
+                matrix_multiply_tile(
+                    a, b, c, n, k, i0, i1, j0, j1, packed_a, packed_b);
+            };
+
+            for (std::size_t tile = 0; tile != tiles.size(); ++tile)
+            {
+                tiles.run(tile, f);
+            }
+            return std::next(c, m * n);
+        }
+
+        template <typename ExPolicy, typename IterA, typename IterB>
+        static typename algorithm_result<ExPolicy, IterC>::type parallel(
+            ExPolicy&& policy, IterA a, IterA, IterB b, IterC c, std::size_t m,
+            std::size_t n, std::size_t k)
+        {
+            using result = algorithm_result<ExPolicy, IterC>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, a, b, c, m, n, k]() mutable {
+                        return run(policy(pika::execution::non_task), a, b, c,
+                            m, n, k);
+                    }));
+            }
+            else
+            {
+                return result::get(run(policy, a, b, c, m, n, k));
+            }
+        }
+
+    private:
+        // The tiles of C are distributed by the partitioner of the policy,
+        // every chunk of tiles packs into its own buffers.
+        template <typename ExPolicy, typename IterA, typename IterB>
+        static IterC run(ExPolicy&& policy, IterA a, IterB b, IterC c,
+            std::size_t m, std::size_t n, std::size_t k)
+        {
+            using value_type = typename std::iterator_traits<IterC>::value_type;
+            using blocking = matrix_multiply_blocking<value_type>;
+
+            matrix_multiply_tiles const tiles{m, n, blocking::mc, blocking::nc};
+            if (tiles.size() != 0)
+            {
+                foreach_partitioner<std::decay_t<ExPolicy>>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_counting_iterator(std::size_t(0)),
+                    tiles.size(),
+                    [tiles, a, b, c, n, k](auto part_begin,
+                        std::size_t part_size, std::size_t) -> void {
+                        std::vector<value_type> packed_a;
+                        std::vector<value_type> packed_b;
+                        auto f = [&](std::size_t i0, std::size_t i1,
+                                     std::size_t j0, std::size_t j1) {
+                            matrix_multiply_tile(a, b, c, n, k, i0, i1, j0, j1,
+                                packed_a, packed_b);
+                        };
+
+                        for (std::size_t i = 0; i != part_size;
+                             ++i, ++part_begin)
+                        {
+                            tiles.run(*part_begin, f);
+                        }
+                    },
+                    projection_identity());
+            }
+            return std::next(c, m * n);
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Computes the matrix product C = A B of the \a m x \a k matrix A
+    /// starting at \a a and the \a k x \a n matrix B starting at \a b, and
+    /// writes the \a m x \a n matrix C to \a c. All matrices are stored row
+    /// by row.
+    ///
+    /// C is split into tiles, which are distributed by the partitioner of
+    /// the execution policy. The product of a tile is accumulated over
+    /// panels of A and B, which are packed into buffers such that the
+    /// micro-kernel reads them contiguously. The micro-kernel keeps a block
+    /// of a few rows and two vectors of columns of C in registers and is
+    /// vectorized by the compiler.
+    ///
+    /// The execution of matrix_multiply without specifying an execution
+    /// policy is equivalent to specifying \a pika::execution::seq as the
+    /// execution policy.
+    ///
+    /// Complexity: \a m times \a n times \a k multiplications and
+    ///             additions.
+    ///
+    /// \returns  The iterator past the last element of C, \a c plus \a m
+    ///           times \a n. The parallel task overloads return a future of
+    ///           it.
+    ///
+    /// \note The value type of C is used for the products and the sums, it
+    ///       has to be default constructible to zero. C must not overlap
+    ///       with A or B.
+    ///
+    inline constexpr struct matrix_multiply_t final
+      : pika::detail::tag_parallel_algorithm<matrix_multiply_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename IterA, typename IterB,
+            typename IterC,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<IterA>::value &&
+                pika::traits::is_iterator<IterB>::value &&
+                pika::traits::is_iterator<IterC>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy,
+            IterC>::type
+        tag_fallback_invoke(pika::matrix_multiply_t, ExPolicy&& policy,
+            IterA a, IterB b, IterC c, std::size_t m, std::size_t n,
+            std::size_t k)
+        {
+            static_assert(pika::traits::is_random_access_iterator<IterA>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator<IterB>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator<IterC>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::matrix_multiply_algo<IterC>().call(
+                PIKA_FORWARD(ExPolicy, policy), a, std::next(a, m * k), b, c,
+                m, n, k);
+        }
+
+        // clang-format off
+        template <typename IterA, typename IterB, typename IterC,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<IterA>::value &&
+                pika::traits::is_iterator<IterB>::value &&
+                pika::traits::is_iterator<IterC>::value
+            )>
+        // clang-format on
+        friend IterC tag_fallback_invoke(pika::matrix_multiply_t, IterA a,
+            IterB b, IterC c, std::size_t m, std::size_t n, std::size_t k)
+        {
+            static_assert(pika::traits::is_random_access_iterator<IterA>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator<IterB>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator<IterC>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::matrix_multiply_algo<IterC>().call(
+                pika::execution::seq, a, std::next(a, m * k), b, c, m, n, k);
+        }
+    } matrix_multiply{};
+}    // namespace pika
@@ -176,24 +176,32 @@ namespace pika {
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/destroy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/algorithms/detail/merge_path.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/detail/rotate.hpp>
 #include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/algorithms/rotate.hpp>
+#include <pika/parallel/algorithms/uninitialized_move.hpp>
 #include <pika/parallel/util/compare_projected.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/fork_join.hpp>
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+#include <pika/parallel/util/tunables.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <iterator>
-#include <list>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -273,139 +281,57 @@ namespace pika::parallel::detail {
         using another_type = upper_bound_helper;
     };
 
-    ///////////////////////////////////////////////////////////////////////
-    template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
-        typename Sent2, typename Iter3, typename Comp, typename Proj1,
-        typename Proj2, typename BinarySearchHelper>
-    void parallel_merge_helper(ExPolicy policy, Iter1 first1, Sent1 last1,
-        Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
-        Proj2&& proj2, bool range_reversal, BinarySearchHelper)
-    {
-        constexpr std::size_t threshold = 65536;
-
-        std::size_t size1 = detail::distance(first1, last1);
-        std::size_t size2 = detail::distance(first2, last2);
-
-        // Perform sequential merge if data size is smaller than threshold.
-        if (size1 + size2 <= threshold)
-        {
-            if (range_reversal)
-            {
-                sequential_merge(first2, last2, first1, last1, dest,
-                    PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj2, proj2),
-                    PIKA_FORWARD(Proj1, proj1));
-            }
-            else
-            {
-                sequential_merge(first1, last1, first2, last2, dest,
-                    PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj1, proj1),
-                    PIKA_FORWARD(Proj2, proj2));
-            }
-            return;
-        }
-
-        // Let size1 is bigger than size2 always.
-        if (size1 < size2)
-        {
-            // For stability of algorithm, must switch binary search methods
-            // when swapping size1 and size2.
-            parallel_merge_helper(policy, first2, last2, first1, last1, dest,
-                PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj2, proj2),
-                PIKA_FORWARD(Proj1, proj1), !range_reversal,
-                typename BinarySearchHelper::another_type());
-            return;
-        }
-
-        PIKA_ASSERT(size1 >= size2);
-        PIKA_ASSERT(size1 >= 1ul);
-
-        Iter1 mid1 = first1 + size1 / 2;
-        Iter2 boundary2 = BinarySearchHelper::call(
-            first2, last2, PIKA_INVOKE(proj1, *mid1), comp, proj2);
-        Iter3 target = dest + (mid1 - first1) + (boundary2 - first2);
-
-        *target = *mid1;
-
-        pika::future<void> fut =
-            execution::async_execute(policy.executor(), [&]() -> void {
-                // Process left side ranges.
-                parallel_merge_helper(policy, first1, mid1, first2, boundary2,
-                    dest, comp, proj1, proj2, range_reversal,
-                    BinarySearchHelper());
-            });
-
-        try
-        {
-            // Process right side ranges.
-            parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                target + 1, PIKA_FORWARD(Comp, comp),
-                PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2),
-                range_reversal, BinarySearchHelper());
-        }
-        catch (...)
-        {
-            fut.wait();
-
-            std::vector<pika::future<void>> futures;
-            futures.reserve(2);
-            futures.emplace_back(PIKA_MOVE(fut));
-            futures.emplace_back(
-                pika::make_exceptional_future<void>(std::current_exception()));
-
-            std::list<std::exception_ptr> errors;
-            handle_local_exceptions<ExPolicy>::call(futures, errors);
-
-            // Not reachable.
-            PIKA_ASSERT(false);
-            return;
-        }
-
-        fut.get();
-    }
-
+    // The output is partitioned into equally sized chunks, each of which
+    // finds the parts of the input sequences it is merged from by a binary
+    // search along the merge path and merges them sequentially.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename Comp, typename Proj1,
         typename Proj2>
-    pika::future<in_in_out_result<Iter1, Iter2, Iter3>>
+    typename algorithm_result<ExPolicy,
+        in_in_out_result<Iter1, Iter2, Iter3>>::type
     parallel_merge(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1, Proj2&& proj2)
     {
         using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
 
-        auto f1 = [first1, last1, first2, last2, dest,
-                      policy = PIKA_FORWARD(ExPolicy, policy),
+        std::size_t const size1 = detail::distance(first1, last1);
+        std::size_t const size2 = detail::distance(first2, last2);
+        std::size_t const count = size1 + size2;
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, result_type>::get(
+                result_type{first1, first2, dest});
+        }
+
+        auto f1 = [first1, size1, first2, size2,
                       comp = PIKA_FORWARD(Comp, comp),
                       proj1 = PIKA_FORWARD(Proj1, proj1),
-                      proj2 =
-                          PIKA_FORWARD(Proj2, proj2)]() mutable -> result_type {
-            try
-            {
-                parallel_merge_helper(PIKA_MOVE(policy), first1, last1, first2,
-                    last2, dest, PIKA_MOVE(comp), PIKA_MOVE(proj1),
-                    PIKA_MOVE(proj2), false, lower_bound_helper());
-
-                auto len1 = detail::distance(first1, last1);
-                auto len2 = detail::distance(first2, last2);
-                return {std::next(first1, len1), std::next(first2, len2),
-                    std::next(dest, len1 + len2)};
-            }
-            catch (...)
-            {
-                handle_local_exceptions<ExPolicy>::call(
-                    std::current_exception());
-                PIKA_ASSERT(false);
-                // To silence no return statement in all control blocks
-                auto len1 = detail::distance(first1, last1);
-                auto len2 = detail::distance(first2, last2);
-                return {std::next(first1, len1), std::next(first2, len2),
-                    std::next(dest, len1 + len2)};
-            }
+                      proj2 = PIKA_FORWARD(Proj2, proj2)](Iter3 it,
+                      std::size_t part_count,
+                      std::size_t base_idx) mutable -> void {
+            std::size_t const begin1 = merge_path_split(
+                first1, size1, first2, size2, base_idx, comp, proj1, proj2);
+            std::size_t const end1 = merge_path_split(first1, size1, first2,
+                size2, base_idx + part_count, comp, proj1, proj2);
+
+            sequential_merge(std::next(first1, begin1),
+                std::next(first1, end1), std::next(first2, base_idx - begin1),
+                std::next(first2, base_idx + part_count - end1), it, comp,
+                proj1, proj2);
+        };
 
-            // Not reachable.
-            PIKA_ASSERT(false);
+        auto f2 = [first1, size1, first2, size2, dest, count](
+                      std::vector<pika::future<void>>&& data) -> result_type {
+            // make sure iterators embedded in function object that is
+            // attached to futures are invalidated
+            data.clear();
+            return {std::next(first1, size1), std::next(first2, size2),
+                std::next(dest, count)};
         };
 
-        return execution::async_execute(policy.executor(), PIKA_MOVE(f1));
+        return partitioner<ExPolicy, result_type, void>::call_with_index(
+            PIKA_FORWARD(ExPolicy, policy), dest, count, 1, PIKA_MOVE(f1),
+            PIKA_MOVE(f2));
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -417,6 +343,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // both input ranges make up the work, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_two_ranges(args...);
+        }
+
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename Comp,
             typename Proj1, typename Proj2>
@@ -437,22 +370,9 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1, Proj2&& proj2)
         {
-            using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
-            using algorithm_result = algorithm_result<ExPolicy, result_type>;
-
-            try
-            {
-                return algorithm_result::get(parallel_merge(
-                    PIKA_FORWARD(ExPolicy, policy), first1, last1, first2,
-                    last2, dest, PIKA_FORWARD(Comp, comp),
-                    PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2)));
-            }
-            catch (...)
-            {
-                return algorithm_result::get(
-                    detail::handle_exception<ExPolicy, result_type>::call(
-                        std::current_exception()));
-            }
+            return parallel_merge(PIKA_FORWARD(ExPolicy, policy), first1,
+                last1, first2, last2, dest, PIKA_FORWARD(Comp, comp),
+                PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2));
         }
     };
     /// \endcond
@@ -472,13 +392,153 @@ namespace pika::parallel::detail {
         return last;
     }
 
+    // Ranges up to this size are merged sequentially by inplace_merge, and
+    // blocks up to this size are rotated sequentially.
+    inline std::size_t parallel_inplace_merge_threshold() noexcept
+    {
+        return util::get_tunable(util::tunable::inplace_merge_threshold);
+    }
+
+    // sequential merge with projection function, moving the elements.
+    template <typename Iter1, typename Iter2, typename OutIter, typename Comp,
+        typename Proj>
+    OutIter sequential_move_merge(Iter1 first1, Iter1 last1, Iter2 first2,
+        Iter2 last2, OutIter dest, Comp& comp, Proj& proj)
+    {
+        for (/**/; first1 != last1 && first2 != last2; ++dest)
+        {
+            if (PIKA_INVOKE(comp, PIKA_INVOKE(proj, *first2),
+                    PIKA_INVOKE(proj, *first1)))
+            {
+                *dest = PIKA_MOVE(*first2);
+                ++first2;
+            }
+            else
+            {
+                *dest = PIKA_MOVE(*first1);
+                ++first1;
+            }
+        }
+        dest = std::move(first1, last1, dest);
+        return std::move(first2, last2, dest);
+    }
+
+    // Merge [first, middle) and [middle, last) through a temporary buffer.
+    // The elements are moved to the buffer and merged back along the merge
+    // path, both steps (and destroying the moved-from elements in the
+    // buffer) are partitioned. Returns false without touching the elements
+    // if no buffer can be obtained.
+    template <typename ExPolicy, typename Iter, typename Comp, typename Proj>
+    bool buffered_inplace_merge(ExPolicy&& policy, Iter first, Iter middle,
+        Iter last, Comp& comp, Proj& proj)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        // the temporary buffers are aligned for std::max_align_t only
+        if constexpr (alignof(value_type) > alignof(std::max_align_t))
+        {
+            return false;
+        }
+        else
+        {
+            std::size_t const size1 = middle - first;
+            std::size_t const size2 = last - middle;
+            std::size_t const count = size1 + size2;
+
+            util::temporary_buffer_arena* arena =
+                util::detail::get_temporary_buffer_arena(policy.parameters());
+
+            value_type* buffer = nullptr;
+            try
+            {
+                buffer = static_cast<value_type*>(
+                    util::detail::allocate_temporary_buffer(
+                        count * sizeof(value_type), arena));
+            }
+            catch (std::bad_alloc const&)
+            {
+                return false;
+            }
+
+            try
+            {
+                parallel_sequential_uninitialized_move_n(
+                    policy, first, count, buffer);
+            }
+            catch (...)
+            {
+                util::detail::deallocate_temporary_buffer(buffer, arena);
+                throw;
+            }
+
+            try
+            {
+                auto f1 = [buffer, size1, size2, &comp, &proj](Iter it,
+                              std::size_t part_count,
+                              std::size_t base_idx) -> void {
+                    value_type* first2 = buffer + size1;
+                    std::size_t const begin1 = merge_path_split(buffer, size1,
+                        first2, size2, base_idx, comp, proj, proj);
+                    std::size_t const end1 = merge_path_split(buffer, size1,
+                        first2, size2, base_idx + part_count, comp, proj,
+                        proj);
+
+                    sequential_move_merge(buffer + begin1, buffer + end1,
+                        first2 + (base_idx - begin1),
+                        first2 + (base_idx + part_count - end1), it, comp,
+                        proj);
+                };
+
+                auto f2 = [last](std::vector<pika::future<void>>&& data)
+                    -> Iter {
+                    // make sure iterators embedded in function object that
+                    // is attached to futures are invalidated
+                    data.clear();
+                    return last;
+                };
+
+                partitioner<ExPolicy, Iter, void>::call_with_index(
+                    policy, first, count, 1, PIKA_MOVE(f1), PIKA_MOVE(f2));
+            }
+            catch (...)
+            {
+                sequential_destroy_n(buffer, count);
+                util::detail::deallocate_temporary_buffer(buffer, arena);
+                throw;
+            }
+
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
+            {
+                parallel_sequential_destroy_n(policy, buffer, count);
+            }
+            util::detail::deallocate_temporary_buffer(buffer, arena);
+            return true;
+        }
+    }
+
+    // Rotate a block of the recursive inplace_merge, in parallel if it is
+    // large.
+    template <typename ExPolicy, typename Iter>
+    void parallel_inplace_merge_rotate(
+        ExPolicy& policy, Iter first, Iter new_first, Iter last)
+    {
+        if (std::size_t(last - first) <= parallel_inplace_merge_threshold())
+        {
+            detail::sequential_rotate(first, new_first, last);
+            return;
+        }
+
+        rotate<in_out_result<Iter, Iter>>().call(
+            policy(pika::execution::non_task), first, new_first, last);
+    }
+
     template <typename ExPolicy, typename Iter, typename Sent, typename Comp,
         typename Proj>
     void parallel_inplace_merge_helper(ExPolicy&& policy, Iter first,
         Iter middle, Sent last, Comp&& comp, Proj&& proj)
     {
-        const std::size_t threshold = 65536ul;
-        PIKA_ASSERT(threshold >= 5ul);
+        // the tunable is at least 5
+        std::size_t const threshold = parallel_inplace_merge_threshold();
 
         std::size_t left_size = middle - first;
         std::size_t right_size = last - middle;
@@ -510,42 +570,20 @@ namespace pika::parallel::detail {
             //   the thing of target.
             // And all elements of [target+1, last) are greater or equal than
             //   the thing of target.
-            detail::sequential_rotate(pivot, middle, boundary);
+            parallel_inplace_merge_rotate(policy, pivot, middle, boundary);
 
-            pika::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
+            fork_join(
+                policy,
+                [&]() {
                     // Process the range which is left-side of 'target'.
                     parallel_inplace_merge_helper(
                         policy, first, pivot, target, comp, proj);
+                },
+                [&]() {
+                    // Process the range which is right-side of 'target'.
+                    parallel_inplace_merge_helper(
+                        policy, target + 1, boundary, last, comp, proj);
                 });
-
-            try
-            {
-                // Process the range which is right-side of 'target'.
-                parallel_inplace_merge_helper(
-                    policy, target + 1, boundary, last, comp, proj);
-            }
-            catch (...)
-            {
-                fut.wait();
-
-                std::vector<pika::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(PIKA_MOVE(fut));
-                futures.emplace_back(pika::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                handle_local_exceptions<ExPolicy>::call(futures, errors);
-
-                // Not reachable.
-                PIKA_ASSERT(false);
-            }
-
-            if (fut.valid())    // NOLINT
-            {
-                fut.get();
-            }
         }
         else    // left_size < right_size
         {
@@ -565,42 +603,21 @@ namespace pika::parallel::detail {
             //   the thing of target.
             // And all elements of [target+1, last) are greater or equal than
             //   the thing of target.
-            detail::sequential_rotate(boundary, middle, pivot + 1);
+            parallel_inplace_merge_rotate(
+                policy, boundary, middle, pivot + 1);
 
-            pika::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
+            fork_join(
+                policy,
+                [&]() {
                     // Process the range which is left-side of 'target'.
                     parallel_inplace_merge_helper(
                         policy, first, boundary, target, comp, proj);
+                },
+                [&]() {
+                    // Process the range which is right-side of 'target'.
+                    parallel_inplace_merge_helper(
+                        policy, target + 1, pivot + 1, last, comp, proj);
                 });
-
-            try
-            {
-                // Process the range which is right-side of 'target'.
-                parallel_inplace_merge_helper(
-                    policy, target + 1, pivot + 1, last, comp, proj);
-            }
-            catch (...)
-            {
-                fut.wait();
-
-                std::vector<pika::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(PIKA_MOVE(fut));
-                futures.emplace_back(pika::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                handle_local_exceptions<ExPolicy>::call(futures, errors);
-
-                // Not reachable.
-                PIKA_ASSERT(false);
-            }
-
-            if (fut.valid())    // NOLINT
-            {
-                fut.get();
-            }
         }
     }
 
@@ -614,8 +631,18 @@ namespace pika::parallel::detail {
                 proj = PIKA_FORWARD(Proj, proj)]() mutable -> Iter {
                 try
                 {
-                    parallel_inplace_merge_helper(policy, first, middle, last,
-                        PIKA_MOVE(comp), PIKA_MOVE(proj));
+                    // merge through a temporary buffer if one can be
+                    // obtained, otherwise by rotating blocks recursively
+                    Iter const end = advance_to_sentinel(middle, last);
+                    if (std::size_t(end - first) <=
+                            parallel_inplace_merge_threshold() ||
+                        !buffered_inplace_merge(
+                            policy(pika::execution::non_task), first, middle,
+                            end, comp, proj))
+                    {
+                        parallel_inplace_merge_helper(policy, first, middle,
+                            last, PIKA_MOVE(comp), PIKA_MOVE(proj));
+                    }
                     return last;
                 }
                 catch (...)
@@ -638,6 +665,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // the work is bounded by the outer iterators, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_outer(args...);
+        }
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         static Iter sequential(ExPolicy, Iter first, Iter middle, Sent last,
@@ -0,0 +1,344 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/merge_join.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Joins the sorted ranges [first1, last1) and [first2, last2): for every
+    /// pair of equivalent elements first1[i] and first2[j] the pair of
+    /// indices (i, j) is written to the range beginning at \a dest. If an
+    /// element is found m times in the first range and n times in the
+    /// second one, m * n pairs are written for it. The pairs are ordered by
+    /// the elements they refer to, then by i, then by j. This algorithm
+    /// expects both input ranges to be sorted with the given comparison
+    /// \a comp.
+    ///
+    /// \note   Complexity: O(N1 + N2) applications of the comparison
+    ///         \a comp and M assignments, where \a N1 and \a N2 are the
+    ///         lengths of the sequences and \a M is the number of pairs
+    ///         written.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterators used (deduced)
+    ///                     representing the first sequence.
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the source iterators used (deduced)
+    ///                     representing the second sequence.
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced). Its value type must
+    ///                     be assignable from std::pair<std::size_t,
+    ///                     std::size_t>. This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a merge_join requires \a Comp to meet
+    ///                     the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first1       Refers to the beginning of the sequence of elements
+    ///                     of the first range the algorithm will be applied to.
+    /// \param last1        Refers to the end of the sequence of elements of
+    ///                     the first range the algorithm will be applied to.
+    /// \param first2       Refers to the beginning of the sequence of elements
+    ///                     of the second range the algorithm will be applied to.
+    /// \param last2        Refers to the end of the sequence of elements of
+    ///                     the second range the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. It is invoked with elements of either range in
+    ///                     either position.
+    ///
+    /// The assignments in the parallel \a merge_join algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a merge_join algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a merge_join algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise. The \a merge_join algorithm
+    ///           returns the end of the range of pairs written.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    merge_join(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+        RandIter2 first2, RandIter2 last2, FwdIter dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/set_operation.hpp>
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // merge_join
+    /// \cond NOINTERNAL
+
+    // Writes the index pairs of all equivalent elements of [first1, last1)
+    // and [first2, last2), index1 and index2 are the indices of first1 and
+    // first2 in the complete sequences. The counting pass of set_operation
+    // adds up the sizes of the cross products instead of stepping through
+    // them.
+    template <typename Iter1, typename Iter2, typename Iter3, typename Comp,
+        typename Proj1, typename Proj2>
+    in_in_out_result<Iter1, Iter2, Iter3> sequential_merge_join(Iter1 first1,
+        Iter1 last1, Iter2 first2, Iter2 last2, std::size_t index1,
+        std::size_t index2, Iter3 dest, Comp&& comp, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            auto&& value1 = PIKA_INVOKE(proj1, *first1);
+            auto&& value2 = PIKA_INVOKE(proj2, *first2);
+
+            if (PIKA_INVOKE(comp, value1, value2))
+            {
+                ++first1;
+                ++index1;
+            }
+            else if (PIKA_INVOKE(comp, value2, value1))
+            {
+                ++first2;
+                ++index2;
+            }
+            else
+            {
+                std::size_t const count1 = detail::gallop_upper_bound(
+                                               first1 + 1, last1, value2, comp,
+                                               proj1) -
+                    first1;
+                std::size_t const count2 = detail::gallop_upper_bound(
+                                               first2 + 1, last2, value1, comp,
+                                               proj2) -
+                    first2;
+
+                if constexpr (std::is_same_v<Iter3, set_operation_counter>)
+                {
+                    dest.count += count1 * count2;
+                }
+                else
+                {
+                    for (std::size_t i = 0; i != count1; ++i)
+                    {
+                        for (std::size_t j = 0; j != count2; ++j)
+                        {
+                            *dest = std::make_pair(index1 + i, index2 + j);
+                            ++dest;
+                        }
+                    }
+                }
+
+                first1 += count1;
+                first2 += count2;
+                index1 += count1;
+                index2 += count2;
+            }
+        }
+        return {first1, first2, dest};
+    }
+
+    template <typename Result>
+    struct merge_join : public algorithm<merge_join<Result>, Result>
+    {
+        merge_join()
+          : merge_join::algorithm("merge_join")
+        {
+        }
+
+        // both input ranges make up the work, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_two_ranges(args...);
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Iter3, typename F, typename Proj1, typename Proj2>
+        static in_in_out_result<Iter1, Iter2, Iter3> sequential(ExPolicy,
+            Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Iter3 dest,
+            F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            return sequential_merge_join(first1, last1, first2, last2, 0, 0,
+                dest, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+                PIKA_FORWARD(Proj2, proj2));
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Iter3, typename F, typename Proj1, typename Proj2>
+        static typename algorithm_result<ExPolicy,
+            in_in_out_result<Iter1, Iter2, Iter3>>::type
+        parallel(ExPolicy&& policy, Iter1 first1, Iter1 last1, Iter2 first2,
+            Iter2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
+            using result = algorithm_result<ExPolicy, result_type>;
+
+            if (first1 == last1 || first2 == last2)
+            {
+                return result::get(result_type{
+                    PIKA_MOVE(first1), PIKA_MOVE(first2), PIKA_MOVE(dest)});
+            }
+
+            using func_type = std::decay_t<F>;
+
+            // join the elements of one chunk, the chunks begin at the first
+            // element of a group of equivalent elements in both sequences
+            auto setop = [first1, first2, proj1, proj2](Iter1 part_first1,
+                             Iter1 part_last1, Iter2 part_first2,
+                             Iter2 part_last2, auto dest,
+                             func_type const& f) {
+                return sequential_merge_join(part_first1, part_last1,
+                    part_first2, part_last2, part_first1 - first1,
+                    part_first2 - first2, dest, f, proj1, proj2);
+            };
+
+            return set_operation(PIKA_FORWARD(ExPolicy, policy), first1, last1,
+                first2, last2, dest, PIKA_FORWARD(F, f),
+                PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2),
+                PIKA_MOVE(setop));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::merge_join
+    inline constexpr struct merge_join_t final
+      : pika::detail::tag_parallel_algorithm<merge_join_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter, typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandIter1>::value_type,
+                    typename std::iterator_traits<RandIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(merge_join_t, ExPolicy&& policy, RandIter1 first1,
+            RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            using result_type =
+                pika::parallel::detail::in_in_out_result<RandIter1, RandIter2,
+                    FwdIter>;
+
+            return pika::parallel::detail::get_third_element(
+                pika::parallel::detail::merge_join<result_type>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first1, last1, first2,
+                    last2, dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity(),
+                    pika::parallel::detail::projection_identity()));
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RandIter1>::value_type,
+                    typename std::iterator_traits<RandIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(merge_join_t, RandIter1 first1,
+            RandIter1 last1, RandIter2 first2, RandIter2 last2, OutIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            using result_type =
+                pika::parallel::detail::in_in_out_result<RandIter1, RandIter2,
+                    OutIter>;
+
+            return pika::parallel::detail::get_third_element(
+                pika::parallel::detail::merge_join<result_type>().call(
+                    pika::execution::seq, first1, last1, first2, last2, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity(),
+                    pika::parallel::detail::projection_identity()));
+        }
+    } merge_join{};
+}    // namespace pika
+
+#endif    // DOXYGEN
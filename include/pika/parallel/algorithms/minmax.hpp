@@ -375,7 +375,9 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/minmax.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
@@ -394,31 +396,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // min_element
     /// \cond NOINTERNAL
-    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
-    constexpr FwdIter sequential_min_element(
-        ExPolicy&&, FwdIter it, std::size_t count, F const& f, Proj const& proj)
-    {
-        if (count == 0 || count == 1)
-            return it;
-
-        using element_type = typename std::iterator_traits<FwdIter>::value_type;
-
-        auto smallest = it;
-
-        element_type value = PIKA_INVOKE(proj, *smallest);
-        loop_n<std::decay_t<ExPolicy>>(
-            ++it, count - 1, [&](FwdIter const& curr) -> void {
-                element_type curr_value = PIKA_INVOKE(proj, *curr);
-                if (PIKA_INVOKE(f, curr_value, value))
-                {
-                    smallest = curr;
-                    value = PIKA_MOVE(curr_value);
-                }
-            });
-
-        return smallest;
-    }
-
     ///////////////////////////////////////////////////////////////////////
     template <typename Iter>
     struct min_element : public algorithm<min_element<Iter>, Iter>
@@ -442,7 +419,8 @@ namespace pika::parallel::detail {
                 typename std::iterator_traits<decltype(smallest)>::value_type;
 
             element_type value = PIKA_INVOKE(proj, *smallest);
-            loop_n<std::decay_t<ExPolicy>>(
+            // the chunk results are iterators, which are not vectorizable
+            loop_n<pika::execution::sequenced_policy>(
                 ++it, count - 1, [&](FwdIter const& curr) -> void {
                     element_type curr_value = PIKA_INVOKE(proj, **curr);
                     if (PIKA_INVOKE(f, curr_value, value))
@@ -463,28 +441,37 @@ namespace pika::parallel::detail {
         template <typename ExPolicy, typename FwdIter, typename Sent,
             typename F, typename Proj>
         static FwdIter sequential(
-            ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+            ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
         {
             if (first == last)
                 return first;
 
-            using element_type =
-                typename std::iterator_traits<FwdIter>::value_type;
-
-            auto smallest = first;
-
-            element_type value = PIKA_INVOKE(proj, *smallest);
-            loop(PIKA_FORWARD(ExPolicy, policy), ++first, last,
-                [&](FwdIter const& curr) -> void {
-                    element_type curr_value = PIKA_INVOKE(proj, *curr);
-                    if (PIKA_INVOKE(f, curr_value, value))
-                    {
-                        smallest = curr;
-                        value = PIKA_MOVE(curr_value);
-                    }
-                });
-
-            return smallest;
+            if constexpr (is_sized_range_v<FwdIter, Sent>)
+            {
+                return sequential_min_element<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)), f,
+                    proj);
+            }
+            else
+            {
+                using element_type =
+                    typename std::iterator_traits<FwdIter>::value_type;
+
+                auto smallest = first;
+
+                element_type value = PIKA_INVOKE(proj, *smallest);
+                loop(pika::execution::seq, ++first, last,
+                    [&](FwdIter const& curr) -> void {
+                        element_type curr_value = PIKA_INVOKE(proj, *curr);
+                        if (PIKA_INVOKE(f, curr_value, value))
+                        {
+                            smallest = curr;
+                            value = PIKA_MOVE(curr_value);
+                        }
+                    });
+
+                return smallest;
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -498,9 +485,10 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
-            auto f1 = [f, proj, policy](
+            auto f1 = [f, proj](
                           FwdIter it, std::size_t part_count) -> FwdIter {
-                return sequential_min_element(policy, it, part_count, f, proj);
+                return sequential_min_element<std::decay_t<ExPolicy>>(
+                    it, part_count, f, proj);
             };
             auto f2 = [policy, f = PIKA_FORWARD(F, f),
                           proj = PIKA_FORWARD(Proj, proj)](
@@ -511,7 +499,7 @@ namespace pika::parallel::detail {
 
             return partitioner<ExPolicy, FwdIter, FwdIter>::call(
                 PIKA_FORWARD(ExPolicy, policy), first, (distance) (first, last),
-                PIKA_MOVE(f1), pika::unwrapping(PIKA_MOVE(f2)));
+                PIKA_MOVE(f1), make_chunk_values_reducer(PIKA_MOVE(f2)));
         }
     };
 
@@ -520,31 +508,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // max_element
     /// \cond NOINTERNAL
-    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
-    constexpr FwdIter sequential_max_element(
-        ExPolicy&&, FwdIter it, std::size_t count, F const& f, Proj const& proj)
-    {
-        if (count == 0 || count == 1)
-            return it;
-
-        using element_type = typename std::iterator_traits<FwdIter>::value_type;
-
-        auto largest = it;
-
-        element_type value = PIKA_INVOKE(proj, *largest);
-        loop_n<std::decay_t<ExPolicy>>(
-            ++it, count - 1, [&](FwdIter const& curr) -> void {
-                element_type curr_value = PIKA_INVOKE(proj, *curr);
-                if (!PIKA_INVOKE(f, curr_value, value))
-                {
-                    largest = curr;
-                    value = PIKA_MOVE(curr_value);
-                }
-            });
-
-        return largest;
-    }
-
     ///////////////////////////////////////////////////////////////////////
     template <typename Iter>
     struct max_element : public algorithm<max_element<Iter>, Iter>
@@ -568,7 +531,8 @@ namespace pika::parallel::detail {
                 typename std::iterator_traits<decltype(largest)>::value_type;
 
             element_type value = PIKA_INVOKE(proj, *largest);
-            loop_n<std::decay_t<ExPolicy>>(
+            // the chunk results are iterators, which are not vectorizable
+            loop_n<pika::execution::sequenced_policy>(
                 ++it, count - 1, [&](FwdIter const& curr) -> void {
                     element_type curr_value = PIKA_INVOKE(proj, **curr);
                     if (!PIKA_INVOKE(f, curr_value, value))
@@ -589,28 +553,37 @@ namespace pika::parallel::detail {
         template <typename ExPolicy, typename FwdIter, typename Sent,
             typename F, typename Proj>
         static FwdIter sequential(
-            ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+            ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
         {
             if (first == last)
                 return first;
 
-            using element_type =
-                typename std::iterator_traits<FwdIter>::value_type;
-
-            auto largest = first;
-
-            element_type value = PIKA_INVOKE(proj, *largest);
-            loop(PIKA_FORWARD(ExPolicy, policy), ++first, last,
-                [&](FwdIter const& curr) -> void {
-                    element_type curr_value = PIKA_INVOKE(proj, *curr);
-                    if (!PIKA_INVOKE(f, curr_value, value))
-                    {
-                        largest = curr;
-                        value = PIKA_MOVE(curr_value);
-                    }
-                });
-
-            return largest;
+            if constexpr (is_sized_range_v<FwdIter, Sent>)
+            {
+                return sequential_max_element<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)), f,
+                    proj);
+            }
+            else
+            {
+                using element_type =
+                    typename std::iterator_traits<FwdIter>::value_type;
+
+                auto largest = first;
+
+                element_type value = PIKA_INVOKE(proj, *largest);
+                loop(pika::execution::seq, ++first, last,
+                    [&](FwdIter const& curr) -> void {
+                        element_type curr_value = PIKA_INVOKE(proj, *curr);
+                        if (!PIKA_INVOKE(f, curr_value, value))
+                        {
+                            largest = curr;
+                            value = PIKA_MOVE(curr_value);
+                        }
+                    });
+
+                return largest;
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -624,9 +597,10 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
-            auto f1 = [f, proj, policy](
+            auto f1 = [f, proj](
                           FwdIter it, std::size_t part_count) -> FwdIter {
-                return sequential_max_element(policy, it, part_count, f, proj);
+                return sequential_max_element<std::decay_t<ExPolicy>>(
+                    it, part_count, f, proj);
             };
             auto f2 = [policy, f = PIKA_FORWARD(F, f),
                           proj = PIKA_FORWARD(Proj, proj)](
@@ -637,7 +611,7 @@ namespace pika::parallel::detail {
 
             return partitioner<ExPolicy, FwdIter, FwdIter>::call(
                 PIKA_FORWARD(ExPolicy, policy), first, (distance) (first, last),
-                PIKA_MOVE(f1), pika::unwrapping(PIKA_MOVE(f2)));
+                PIKA_MOVE(f1), make_chunk_values_reducer(PIKA_MOVE(f2)));
         }
     };
 
@@ -646,38 +620,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // minmax_element
     /// \cond NOINTERNAL
-    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
-    minmax_element_result<FwdIter> sequential_minmax_element(
-        ExPolicy&&, FwdIter it, std::size_t count, F const& f, Proj const& proj)
-    {
-        minmax_element_result<FwdIter> result = {it, it};
-
-        if (count == 0 || count == 1)
-            return result;
-
-        using element_type = typename std::iterator_traits<FwdIter>::value_type;
-
-        element_type min_value = PIKA_INVOKE(proj, *it);
-        element_type max_value = min_value;
-        loop_n<std::decay_t<ExPolicy>>(
-            ++it, count - 1, [&](FwdIter const& curr) -> void {
-                element_type curr_value = PIKA_INVOKE(proj, *curr);
-                if (PIKA_INVOKE(f, curr_value, min_value))
-                {
-                    result.min = curr;
-                    min_value = curr_value;
-                }
-
-                if (!PIKA_INVOKE(f, curr_value, max_value))
-                {
-                    result.max = curr;
-                    max_value = PIKA_MOVE(curr_value);
-                }
-            });
-
-        return result;
-    }
-
     template <typename Iter>
     struct minmax_element
       : public algorithm<minmax_element<Iter>, minmax_element_result<Iter>>
@@ -702,7 +644,8 @@ namespace pika::parallel::detail {
 
             element_type min_value = PIKA_INVOKE(proj, *result.min);
             element_type max_value = PIKA_INVOKE(proj, *result.max);
-            loop_n<std::decay_t<ExPolicy>>(
+            // the chunk results are iterators, which are not vectorizable
+            loop_n<pika::execution::sequenced_policy>(
                 ++it, count - 1, [&](PairIter const& curr) -> void {
                     element_type curr_min_value = PIKA_INVOKE(proj, *curr->min);
                     if (PIKA_INVOKE(f, curr_min_value, min_value))
@@ -730,37 +673,46 @@ namespace pika::parallel::detail {
         template <typename ExPolicy, typename FwdIter, typename Sent,
             typename F, typename Proj>
         static minmax_element_result<FwdIter> sequential(
-            ExPolicy&& policy, FwdIter first, Sent last, F&& f, Proj&& proj)
+            ExPolicy&&, FwdIter first, Sent last, F&& f, Proj&& proj)
         {
-            auto min = first, max = first;
-
-            if (first == last || ++first == last)
+            if constexpr (is_sized_range_v<FwdIter, Sent>)
             {
-                return minmax_element_result<FwdIter>{min, max};
+                return sequential_minmax_element<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)), f,
+                    proj);
             }
+            else
+            {
+                auto min = first, max = first;
 
-            using element_type =
-                typename std::iterator_traits<FwdIter>::value_type;
-
-            element_type min_value = PIKA_INVOKE(proj, *min);
-            element_type max_value = PIKA_INVOKE(proj, *max);
-            loop(PIKA_FORWARD(ExPolicy, policy), first, last,
-                [&](FwdIter const& curr) -> void {
-                    element_type curr_value = PIKA_INVOKE(proj, *curr);
-                    if (PIKA_INVOKE(f, curr_value, min_value))
-                    {
-                        min = curr;
-                        min_value = curr_value;
-                    }
+                if (first == last || ++first == last)
+                {
+                    return minmax_element_result<FwdIter>{min, max};
+                }
 
-                    if (!PIKA_INVOKE(f, curr_value, max_value))
-                    {
-                        max = curr;
-                        max_value = PIKA_MOVE(curr_value);
-                    }
-                });
+                using element_type =
+                    typename std::iterator_traits<FwdIter>::value_type;
+
+                element_type min_value = PIKA_INVOKE(proj, *min);
+                element_type max_value = PIKA_INVOKE(proj, *max);
+                loop(pika::execution::seq, first, last,
+                    [&](FwdIter const& curr) -> void {
+                        element_type curr_value = PIKA_INVOKE(proj, *curr);
+                        if (PIKA_INVOKE(f, curr_value, min_value))
+                        {
+                            min = curr;
+                            min_value = curr_value;
+                        }
+
+                        if (!PIKA_INVOKE(f, curr_value, max_value))
+                        {
+                            max = curr;
+                            max_value = PIKA_MOVE(curr_value);
+                        }
+                    });
 
-            return minmax_element_result<FwdIter>{min, max};
+                return minmax_element_result<FwdIter>{min, max};
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -780,10 +732,10 @@ namespace pika::parallel::detail {
             }
 
             auto f1 =
-                [f, proj, policy](FwdIter it,
+                [f, proj](FwdIter it,
                     std::size_t part_count) -> minmax_element_result<FwdIter> {
-                return sequential_minmax_element(
-                    policy, it, part_count, f, proj);
+                return sequential_minmax_element<std::decay_t<ExPolicy>>(
+                    it, part_count, f, proj);
             };
             auto f2 = [policy, f = PIKA_FORWARD(F, f),
                           proj = PIKA_FORWARD(Proj, proj)](
@@ -795,7 +747,7 @@ namespace pika::parallel::detail {
             return partitioner<ExPolicy, result_type, result_type>::call(
                 PIKA_FORWARD(ExPolicy, policy), result.min,
                 (distance) (result.min, last), PIKA_MOVE(f1),
-                pika::unwrapping(PIKA_MOVE(f2)));
+                make_chunk_values_reducer(PIKA_MOVE(f2)));
         }
     };
     /// \endcond
@@ -180,10 +180,12 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -229,9 +231,27 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
-            return sequential_mismatch_binary(first1, last1, first2, last2,
-                PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
-                PIKA_FORWARD(Proj2, proj2));
+            if constexpr (is_sized_range_v<Iter1, Sent1> &&
+                is_sized_range_v<Iter2, Sent2>)
+            {
+                std::size_t const count =
+                    (std::min)(static_cast<std::size_t>(
+                                   detail::distance(first1, last1)),
+                        static_cast<std::size_t>(
+                            detail::distance(first2, last2)));
+                std::size_t const mismatched =
+                    sequential_mismatch_n<std::decay_t<ExPolicy>>(first1,
+                        first2, count, PIKA_FORWARD(F, f),
+                        PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2));
+                return {std::next(first1, mismatched),
+                    std::next(first2, mismatched)};
+            }
+            else
+            {
+                return sequential_mismatch_binary(first1, last1, first2, last2,
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+                    PIKA_FORWARD(Proj2, proj2));
+            }
         }
 
         template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -270,30 +290,26 @@ namespace pika::parallel::detail {
             }
 
             using zip_iterator = pika::util::zip_iterator<Iter1, Iter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<std::size_t> tok(count1);
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](zip_iterator it,
                           std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&f, &proj1, &proj2, &tok](
-                        reference t, std::size_t i) mutable -> void {
-                        if (!pika::util::detail::invoke(f,
-                                pika::util::detail::invoke(
-                                    proj1, std::get<0>(t)),
-                                pika::util::detail::invoke(
-                                    proj2, std::get<1>(t))))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto iters = it.get_iterator_tuple();
+                std::size_t const mismatched =
+                    mismatch_partition<std::decay_t<ExPolicy>>(
+                        std::get<0>(iters), std::get<1>(iters), part_count,
+                        [&tok, base_idx](std::size_t offset) {
+                            return tok.was_cancelled(base_idx + offset);
+                        },
+                        f, proj1, proj2);
+                if (mismatched != part_count)
+                {
+                    tok.cancel(base_idx + mismatched);
+                }
             };
 
             auto f2 = [=](std::vector<pika::future<void>>&& data) mutable
@@ -316,10 +332,13 @@ namespace pika::parallel::detail {
                 return {first1, first2};
             };
 
-            return partitioner<ExPolicy, in_in_result<Iter1, Iter2>,
-                void>::call_with_index(PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first1, first2), count1, 1,
-                PIKA_MOVE(f1), PIKA_MOVE(f2));
+            return partitioner<ExPolicy, in_in_result<Iter1, Iter2>, void>::
+                call_with_index_cancellable(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(first1, first2), count1, 1,
+                    PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 
@@ -355,11 +374,27 @@ namespace pika::parallel::detail {
         static constexpr IterPair
         sequential(ExPolicy, InIter1 first1, Sent last1, InIter2 first2, F&& f)
         {
-            while (first1 != last1 && PIKA_INVOKE(f, *first1, *first2))
+            if constexpr (is_sized_range_v<InIter1, Sent> &&
+                pika::traits::is_random_access_iterator_v<InIter2>)
             {
-                ++first1, ++first2;
+                std::size_t const mismatched =
+                    sequential_mismatch_n<std::decay_t<ExPolicy>>(first1,
+                        first2,
+                        static_cast<std::size_t>(
+                            detail::distance(first1, last1)),
+                        PIKA_FORWARD(F, f), projection_identity{},
+                        projection_identity{});
+                return std::make_pair(std::next(first1, mismatched),
+                    std::next(first2, mismatched));
+            }
+            else
+            {
+                while (first1 != last1 && PIKA_INVOKE(f, *first1, *first2))
+                {
+                    ++first1, ++first2;
+                }
+                return std::make_pair(first1, first2);
             }
-            return std::make_pair(first1, first2);
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -379,24 +414,24 @@ namespace pika::parallel::detail {
             difference_type count = (distance) (first1, last1);
 
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<std::size_t> tok(count);
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f)](zip_iterator it,
                           std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&f, &tok](reference t, std::size_t i) mutable -> void {
-                        if (!pika::util::detail::invoke(
-                                f, std::get<0>(t), std::get<1>(t)))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto iters = it.get_iterator_tuple();
+                std::size_t const mismatched =
+                    mismatch_partition<std::decay_t<ExPolicy>>(
+                        std::get<0>(iters), std::get<1>(iters), part_count,
+                        [&tok, base_idx](std::size_t offset) {
+                            return tok.was_cancelled(base_idx + offset);
+                        },
+                        f, projection_identity{}, projection_identity{});
+                if (mismatched != part_count)
+                {
+                    tok.cancel(base_idx + mismatched);
+                }
             };
 
             auto f2 = [=](std::vector<pika::future<void>>&& data) mutable
@@ -415,10 +450,13 @@ namespace pika::parallel::detail {
                 return std::make_pair(first1, first2);
             };
 
-            return partitioner<ExPolicy, IterPair, void>::call_with_index(
-                PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first1, first2), count, 1,
-                PIKA_MOVE(f1), PIKA_MOVE(f2));
+            return partitioner<ExPolicy, IterPair, void>::
+                call_with_index_cancellable(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(first1, first2), count, 1,
+                    PIKA_MOVE(f1), PIKA_MOVE(f2),
+                    [tok](std::size_t base_idx) {
+                        return tok.was_cancelled(base_idx);
+                    });
         }
     };
 }    // namespace pika::parallel::detail
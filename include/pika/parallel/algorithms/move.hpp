@@ -101,6 +101,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter>
         static constexpr std::enable_if_t<
@@ -0,0 +1,425 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/multiway_merge.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Merges the sorted ranges referred to by [runs_first, runs_last) into
+    /// one sorted range beginning at \a dest. The order of equivalent
+    /// elements within each run is preserved, equivalent elements from
+    /// different runs are ordered by the position of their runs in
+    /// [runs_first, runs_last). The destination range cannot overlap with
+    /// any of the runs.
+    ///
+    /// \note   Complexity: O(N log(k)) applications of the comparison
+    ///         \a comp, where N is the total number of elements and k is
+    ///         std::distance(runs_first, runs_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RunIter     The type of the iterators referring to the runs
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator. Its value
+    ///                     type must be a range whose iterators meet the
+    ///                     requirements of a random access iterator, for
+    ///                     instance std::vector<T> or a pair of iterators
+    ///                     wrapped in pika::util::iterator_range.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a multiway_merge requires \a Comp to
+    ///                     meet the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param runs_first   Refers to the beginning of the sequence of runs
+    ///                     the algorithm will be applied to.
+    /// \param runs_last    Refers to the end of the sequence of runs the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked
+    /// with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a multiway_merge algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. The \a multiway_merge
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RunIter, typename RandIter,
+        typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    multiway_merge(ExPolicy&& policy, RunIter runs_first, RunIter runs_last,
+        RandIter dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/traits/is_range.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/loser_tree.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // multiway_merge
+    /// \cond NOINTERNAL
+
+    template <typename RunIter>
+    using multiway_merge_run_iterator_t = decltype(pika::util::begin(
+        std::declval<typename std::iterator_traits<RunIter>::reference>()));
+
+    // The beginning of every run and the number of its elements.
+    template <typename RunIter>
+    struct multiway_merge_runs
+    {
+        using iterator = multiway_merge_run_iterator_t<RunIter>;
+
+        multiway_merge_runs(RunIter runs_first, RunIter runs_last)
+        {
+            for (/**/; runs_first != runs_last; ++runs_first)
+            {
+                auto&& run = *runs_first;
+                iterator first = pika::util::begin(run);
+                std::size_t const size =
+                    std::distance(first, pika::util::end(run));
+
+                firsts.push_back(first);
+                sizes.push_back(size);
+                total += size;
+            }
+        }
+
+        std::vector<iterator> firsts;
+        std::vector<std::size_t> sizes;
+        std::size_t total = 0;
+    };
+
+    // Multi-sequence selection: find the number of elements splits[i] of
+    // every run which are among the first rank elements of the merged
+    // sequence. Equivalent elements of different runs are ordered by the
+    // index of their run, which keeps the merge stable.
+    //
+    // Every run keeps a window [lo, hi) known to contain its split. The
+    // middle element of the widest window is ranked in all runs by binary
+    // searches restricted to their windows, and all windows are narrowed to
+    // the side of the pivot the element of the given rank is on.
+    template <typename Iter, typename Comp, typename Proj>
+    std::vector<std::size_t> multiway_merge_split(
+        std::vector<Iter> const& firsts, std::vector<std::size_t> const& sizes,
+        std::size_t total, std::size_t rank, Comp& comp, Proj& proj)
+    {
+        std::size_t const k = firsts.size();
+
+        std::vector<std::size_t> lo(k);
+        std::vector<std::size_t> hi(k);
+        std::size_t sum_lo = 0;
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            std::size_t const others = total - sizes[i];
+            lo[i] = rank > others ? rank - others : 0;
+            hi[i] = (std::min)(sizes[i], rank);
+            sum_lo += lo[i];
+        }
+
+        std::vector<std::size_t> pivot_rank(k);
+        while (sum_lo != rank)
+        {
+            std::size_t j = 0;
+            for (std::size_t i = 1; i != k; ++i)
+            {
+                if (hi[i] - lo[i] > hi[j] - lo[j])
+                {
+                    j = i;
+                }
+            }
+            PIKA_ASSERT(hi[j] > lo[j]);
+
+            std::size_t const mid = lo[j] + (hi[j] - lo[j]) / 2;
+            auto&& pivot = PIKA_INVOKE(proj, firsts[j][mid]);
+
+            // number of elements in each window ordered before the pivot
+            std::size_t sum = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (i == j)
+                {
+                    pivot_rank[i] = mid;
+                }
+                else if (i < j)
+                {
+                    pivot_rank[i] = detail::upper_bound(firsts[i] + lo[i],
+                                        firsts[i] + hi[i], pivot, comp, proj) -
+                        firsts[i];
+                }
+                else
+                {
+                    pivot_rank[i] = detail::lower_bound(firsts[i] + lo[i],
+                                        firsts[i] + hi[i], pivot, comp, proj) -
+                        firsts[i];
+                }
+                sum += pivot_rank[i];
+            }
+
+            if (sum < rank)
+            {
+                // the pivot precedes the element of the given rank
+                lo = pivot_rank;
+                lo[j] = mid + 1;
+            }
+            else if (sum > rank)
+            {
+                hi = pivot_rank;
+            }
+            else
+            {
+                return pivot_rank;
+            }
+
+            sum_lo = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                sum_lo += lo[i];
+            }
+        }
+        return lo;
+    }
+
+    // The output is partitioned into equally sized chunks. Every chunk
+    // finds the parts of the runs it is merged from by multi-sequence
+    // selection at both of its ends and merges them with a loser tree.
+    template <typename ExPolicy, typename RunIter, typename Iter,
+        typename Comp, typename Proj>
+    typename algorithm_result<ExPolicy, Iter>::type parallel_multiway_merge(
+        ExPolicy&& policy, RunIter runs_first, RunIter runs_last, Iter dest,
+        Comp&& comp, Proj&& proj)
+    {
+        using run_iterator = multiway_merge_run_iterator_t<RunIter>;
+
+        multiway_merge_runs<RunIter> runs(runs_first, runs_last);
+        std::size_t const count = runs.total;
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(dest));
+        }
+
+        auto f1 = [runs = PIKA_MOVE(runs), comp = PIKA_FORWARD(Comp, comp),
+                      proj = PIKA_FORWARD(Proj, proj)](Iter it,
+                      std::size_t part_count,
+                      std::size_t base_idx) mutable -> void {
+            std::vector<std::size_t> const begin =
+                multiway_merge_split(runs.firsts, runs.sizes, runs.total,
+                    base_idx, comp, proj);
+            std::vector<std::size_t> const end =
+                multiway_merge_split(runs.firsts, runs.sizes, runs.total,
+                    base_idx + part_count, comp, proj);
+
+            std::size_t const k = runs.firsts.size();
+            std::vector<run_iterator> first(k);
+            std::vector<run_iterator> last(k);
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                first[i] = runs.firsts[i] + begin[i];
+                last[i] = runs.firsts[i] + end[i];
+            }
+
+            loser_tree<run_iterator, std::remove_reference_t<Comp>,
+                std::remove_reference_t<Proj>>
+                tree(PIKA_MOVE(first), PIKA_MOVE(last), comp, proj);
+            tree.merge_n(it, part_count);
+        };
+
+        auto f2 = [dest, count](
+                      std::vector<pika::future<void>>&& data) -> Iter {
+            // make sure iterators embedded in function object that is
+            // attached to futures are invalidated
+            data.clear();
+            return std::next(dest, count);
+        };
+
+        return partitioner<ExPolicy, Iter, void>::call_with_index(
+            PIKA_FORWARD(ExPolicy, policy), dest, count, 1, PIKA_MOVE(f1),
+            PIKA_MOVE(f2));
+    }
+
+    template <typename Iter>
+    struct multiway_merge : public algorithm<multiway_merge<Iter>, Iter>
+    {
+        multiway_merge()
+          : multiway_merge::algorithm("multiway_merge")
+        {
+        }
+
+        // the first two arguments bound the runs, not the elements, the
+        // algorithm never runs inline, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&...)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        template <typename ExPolicy, typename RunIter, typename OutIter,
+            typename Comp, typename Proj>
+        static OutIter sequential(ExPolicy, RunIter runs_first,
+            RunIter runs_last, OutIter dest, Comp&& comp, Proj&& proj)
+        {
+            using run_iterator = multiway_merge_run_iterator_t<RunIter>;
+
+            std::vector<run_iterator> first;
+            std::vector<run_iterator> last;
+            std::size_t count = 0;
+            for (/**/; runs_first != runs_last; ++runs_first)
+            {
+                auto&& run = *runs_first;
+                first.push_back(pika::util::begin(run));
+                last.push_back(pika::util::end(run));
+                count += std::distance(first.back(), last.back());
+            }
+
+            loser_tree<run_iterator, std::remove_reference_t<Comp>,
+                std::remove_reference_t<Proj>>
+                tree(PIKA_MOVE(first), PIKA_MOVE(last), comp, proj);
+            return tree.merge_n(dest, count);
+        }
+
+        template <typename ExPolicy, typename RunIter, typename Comp,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, Iter>::type parallel(
+            ExPolicy&& policy, RunIter runs_first, RunIter runs_last, Iter dest,
+            Comp&& comp, Proj&& proj)
+        {
+            return parallel_multiway_merge(PIKA_FORWARD(ExPolicy, policy),
+                runs_first, runs_last, dest, PIKA_FORWARD(Comp, comp),
+                PIKA_FORWARD(Proj, proj));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::multiway_merge
+    inline constexpr struct multiway_merge_t final
+      : pika::detail::tag_parallel_algorithm<multiway_merge_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RunIter, typename RandIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(multiway_merge_t, ExPolicy&& policy,
+            RunIter runs_first, RunIter runs_last, RandIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_forward_iterator<RunIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_random_access_iterator<
+                              pika::parallel::detail::
+                                  multiway_merge_run_iterator_t<RunIter>>::value,
+                "Requires random access iterators for the runs.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::multiway_merge<RandIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), runs_first, runs_last, dest,
+                PIKA_FORWARD(Comp, comp),
+                pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RunIter, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(multiway_merge_t, RunIter runs_first,
+            RunIter runs_last, OutIter dest, Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_input_iterator<RunIter>::value,
+                "Requires at least input iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::multiway_merge<OutIter>().call(
+                pika::execution::seq, runs_first, runs_last, dest,
+                PIKA_FORWARD(Comp, comp),
+                pika::parallel::detail::projection_identity());
+        }
+    } multiway_merge{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -0,0 +1,653 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/multiway_set_operation.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Constructs the union of all sorted ranges referred to by
+    /// [runs_first, runs_last) in a single sorted range beginning at
+    /// \a dest. If an element is found m_i times in the i-th run, the
+    /// union contains max(m_i) copies of it: all m_0 equivalent elements of
+    /// the first run, followed by the equivalent elements of every further
+    /// run in excess of the largest count of the runs before it. This is
+    /// the result of folding \a set_union over the runs from left to right,
+    /// computed without any intermediate ranges. The destination range
+    /// cannot overlap with any of the runs.
+    ///
+    /// \note   Complexity: O(N log(k)) applications of the comparison
+    ///         \a comp, where N is the total number of elements and k is
+    ///         std::distance(runs_first, runs_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RunIter     The type of the iterators referring to the runs
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator. Its value
+    ///                     type must be a range whose iterators meet the
+    ///                     requirements of a random access iterator, for
+    ///                     instance std::vector<T> or a pair of iterators
+    ///                     wrapped in pika::util::iterator_range.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a multiway_set_union requires \a Comp
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///                     This defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param runs_first   Refers to the beginning of the sequence of runs
+    ///                     the algorithm will be applied to.
+    /// \param runs_last    Refers to the end of the sequence of runs the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    ///
+    /// The assignments in the parallel \a multiway_set_union algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a multiway_set_union algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a multiway_set_union algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise. The \a multiway_set_union
+    ///           algorithm returns the end of the constructed range.
+    ///
+    template <typename ExPolicy, typename RunIter, typename FwdIter,
+        typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    multiway_set_union(ExPolicy&& policy, RunIter runs_first,
+        RunIter runs_last, FwdIter dest, Comp&& comp = Comp());
+
+    /// Constructs the intersection of all sorted ranges referred to by
+    /// [runs_first, runs_last) in a single sorted range beginning at
+    /// \a dest. If an element is found m_i times in the i-th run, the
+    /// intersection contains the first min(m_i) of the equivalent elements
+    /// of the first run. This is the result of folding \a set_intersection
+    /// over the runs from left to right, computed without any intermediate
+    /// ranges. The intersection of no runs is empty. The destination range
+    /// cannot overlap with any of the runs.
+    ///
+    /// \note   Complexity: At most O(N log(k)) applications of the
+    ///         comparison \a comp, where N is the total number of elements
+    ///         and k is std::distance(runs_first, runs_last). The runs are
+    ///         searched by galloping, the intersection of a short run with
+    ///         long ones performs far fewer comparisons.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RunIter     The type of the iterators referring to the runs
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator. Its value
+    ///                     type must be a range whose iterators meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a multiway_set_intersection requires
+    ///                     \a Comp to meet the requirements of
+    ///                     \a CopyConstructible. This defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param runs_first   Refers to the beginning of the sequence of runs
+    ///                     the algorithm will be applied to.
+    /// \param runs_last    Refers to the end of the sequence of runs the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    ///
+    /// The assignments in the parallel \a multiway_set_intersection
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a multiway_set_intersection
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// \returns  The \a multiway_set_intersection algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise. The
+    ///           \a multiway_set_intersection algorithm returns the end of
+    ///           the constructed range.
+    ///
+    template <typename ExPolicy, typename RunIter, typename FwdIter,
+        typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    multiway_set_intersection(ExPolicy&& policy, RunIter runs_first,
+        RunIter runs_last, FwdIter dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/traits/is_range.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/set_operation.hpp>
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/algorithms/multiway_merge.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/loser_tree.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // multiway_set_union, multiway_set_intersection
+    /// \cond NOINTERNAL
+
+    enum class multiway_set_kind
+    {
+        set_union,
+        set_intersection
+    };
+
+    template <multiway_set_kind Kind>
+    constexpr char const* multiway_set_name() noexcept
+    {
+        if constexpr (Kind == multiway_set_kind::set_union)
+        {
+            return "multiway_set_union";
+        }
+        else
+        {
+            return "multiway_set_intersection";
+        }
+    }
+
+    // The loser tree hands out the equivalent elements of a group run by
+    // run in the order of the runs. The j-th element of a run's group is
+    // copied if none of the runs before it has more than j elements in the
+    // group.
+    template <typename Iter, typename OutIter, typename Comp, typename Proj>
+    OutIter multiway_set_union_runs(std::vector<Iter> first,
+        std::vector<Iter> last, OutIter dest, Comp& comp, Proj& proj)
+    {
+        loser_tree<Iter, Comp, Proj> tree(
+            PIKA_MOVE(first), PIKA_MOVE(last), comp, proj);
+        if (tree.empty())
+        {
+            return dest;
+        }
+
+        Iter group = tree.front();
+        std::size_t run = tree.winner();
+        std::size_t taken = 0;    // elements of the group taken from run
+        std::size_t copied = 0;    // largest group size of the runs before
+        while (!tree.empty())
+        {
+            Iter const& it = tree.front();
+            if (PIKA_INVOKE(comp, PIKA_INVOKE(proj, *group),
+                    PIKA_INVOKE(proj, *it)))
+            {
+                group = it;
+                run = tree.winner();
+                taken = 0;
+                copied = 0;
+            }
+            else if (tree.winner() != run)
+            {
+                run = tree.winner();
+                copied = (std::max)(copied, taken);
+                taken = 0;
+            }
+
+            if (taken++ >= copied)
+            {
+                *dest = *it;
+                ++dest;
+            }
+            tree.skip();
+        }
+        return dest;
+    }
+
+    // Leapfrogging: every run gallops to the first element not ordered
+    // before the current candidate, an element ordered after it becomes the
+    // new candidate. Once the heads of all runs are equivalent the
+    // candidate's group is measured in every run and copied from the first.
+    template <typename Iter, typename OutIter, typename Comp, typename Proj>
+    OutIter multiway_set_intersection_runs(std::vector<Iter> first,
+        std::vector<Iter> last, OutIter dest, Comp& comp, Proj& proj)
+    {
+        std::size_t const k = first.size();
+        if (k == 0)
+        {
+            return dest;
+        }
+
+        while (first[0] != last[0])
+        {
+            Iter candidate = first[0];
+            std::size_t agreed = 0;
+            for (std::size_t i = 0; agreed != k; i = (i + 1) % k)
+            {
+                auto&& value = PIKA_INVOKE(proj, *candidate);
+                first[i] = detail::gallop_lower_bound(
+                    first[i], last[i], value, comp, proj);
+                if (first[i] == last[i])
+                {
+                    return dest;
+                }
+
+                if (PIKA_INVOKE(comp, value, PIKA_INVOKE(proj, *first[i])))
+                {
+                    candidate = first[i];
+                    agreed = 1;
+                }
+                else
+                {
+                    ++agreed;
+                }
+            }
+
+            auto&& value = PIKA_INVOKE(proj, *candidate);
+            Iter const group = first[0];
+            std::size_t count = std::size_t(-1);
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                Iter const end = detail::gallop_upper_bound(
+                    first[i] + 1, last[i], value, comp, proj);
+                count = (std::min)(
+                    count, static_cast<std::size_t>(end - first[i]));
+                first[i] = end;
+            }
+            dest = std::copy_n(group, count, dest);
+        }
+        return dest;
+    }
+
+    template <multiway_set_kind Kind, typename Iter, typename OutIter,
+        typename Comp, typename Proj>
+    OutIter multiway_set_operation_runs(std::vector<Iter> first,
+        std::vector<Iter> last, OutIter dest, Comp& comp, Proj& proj)
+    {
+        if constexpr (Kind == multiway_set_kind::set_union)
+        {
+            return multiway_set_union_runs(
+                PIKA_MOVE(first), PIKA_MOVE(last), dest, comp, proj);
+        }
+        else
+        {
+            return multiway_set_intersection_runs(
+                PIKA_MOVE(first), PIKA_MOVE(last), dest, comp, proj);
+        }
+    }
+
+    // The multi-sequence selection of the given rank moved back to the
+    // beginning of the group of the smallest element not selected, all
+    // elements before the returned positions are ordered before all
+    // elements after them.
+    template <typename Iter, typename Comp, typename Proj>
+    std::vector<std::size_t> multiway_set_split(
+        std::vector<Iter> const& firsts, std::vector<std::size_t> const& sizes,
+        std::size_t total, std::size_t rank, Comp& comp, Proj& proj)
+    {
+        std::vector<std::size_t> splits =
+            multiway_merge_split(firsts, sizes, total, rank, comp, proj);
+
+        std::size_t const k = firsts.size();
+        std::size_t pivot = k;
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            if (splits[i] != sizes[i] &&
+                (pivot == k ||
+                    PIKA_INVOKE(comp,
+                        PIKA_INVOKE(proj, firsts[i][splits[i]]),
+                        PIKA_INVOKE(proj, firsts[pivot][splits[pivot]]))))
+            {
+                pivot = i;
+            }
+        }
+        if (pivot == k)
+        {
+            return splits;
+        }
+
+        auto&& value = PIKA_INVOKE(proj, firsts[pivot][splits[pivot]]);
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            splits[i] = detail::lower_bound(firsts[i], firsts[i] + splits[i],
+                            value, comp, proj) -
+                firsts[i];
+        }
+        return splits;
+    }
+
+    // -----------------------------------------------------------------------
+    // The merged sequence is split into chunks of about equal size whose
+    // bounds are moved to the beginning of a group of equivalent elements,
+    // no group is split between chunks and every chunk is processed
+    // independently in two passes:
+    //  1. count the output of each chunk, the exclusive scan of the counts
+    //     gives the output position of each chunk
+    //  2. write the output of each chunk to its place
+    // -----------------------------------------------------------------------
+    template <multiway_set_kind Kind, typename ExPolicy, typename Iter,
+        typename FwdIter, typename Comp, typename Proj>
+    FwdIter multiway_set_operation_impl(ExPolicy& policy,
+        std::vector<Iter> const& firsts, std::vector<std::size_t> const& sizes,
+        std::size_t total, FwdIter dest, Comp& comp, Proj& proj)
+    {
+        std::size_t const k = firsts.size();
+        std::size_t const num_chunks = run_length_num_chunks(policy, total);
+
+        std::vector<std::vector<std::size_t>> bounds(num_chunks + 1);
+        bounds[0].assign(k, 0);
+        bounds[num_chunks] = sizes;
+        auto split = [&](std::size_t chunk) {
+            if (chunk != 0)
+            {
+                bounds[chunk] = multiway_set_split(firsts, sizes, total,
+                    chunk * total / num_chunks, comp, proj);
+            }
+        };
+        run_chunks(policy, num_chunks, split);
+
+        auto chunk_runs = [&](std::size_t chunk, std::vector<Iter>& first,
+                              std::vector<Iter>& last) {
+            first.resize(k);
+            last.resize(k);
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                first[i] = firsts[i] + bounds[chunk][i];
+                last[i] = firsts[i] + bounds[chunk + 1][i];
+            }
+        };
+
+        // step 1, offsets[chunk] is the number of elements written before
+        // the chunk
+        std::vector<std::size_t> offsets(num_chunks + 1, 0);
+        auto count_output = [&](std::size_t chunk) {
+            std::vector<Iter> first, last;
+            chunk_runs(chunk, first, last);
+            offsets[chunk + 1] =
+                multiway_set_operation_runs<Kind>(PIKA_MOVE(first),
+                    PIKA_MOVE(last), set_operation_counter{}, comp, proj)
+                    .count;
+        };
+        run_chunks(policy, num_chunks, count_output);
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        // step 2
+        auto write_output = [&](std::size_t chunk) {
+            std::vector<Iter> first, last;
+            chunk_runs(chunk, first, last);
+            multiway_set_operation_runs<Kind>(PIKA_MOVE(first),
+                PIKA_MOVE(last), std::next(dest, offsets[chunk]), comp, proj);
+        };
+        run_chunks(policy, num_chunks, write_output);
+
+        return std::next(dest, offsets.back());
+    }
+
+    template <multiway_set_kind Kind, typename Iter>
+    struct multiway_set_operation
+      : public algorithm<multiway_set_operation<Kind, Iter>, Iter>
+    {
+        multiway_set_operation()
+          : multiway_set_operation::algorithm(multiway_set_name<Kind>())
+        {
+        }
+
+        // the first two arguments bound the runs, not the elements, the
+        // algorithm never runs inline, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&...)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        template <typename ExPolicy, typename RunIter, typename OutIter,
+            typename Comp, typename Proj>
+        static OutIter sequential(ExPolicy, RunIter runs_first,
+            RunIter runs_last, OutIter dest, Comp&& comp, Proj&& proj)
+        {
+            using run_iterator = multiway_merge_run_iterator_t<RunIter>;
+
+            std::vector<run_iterator> first;
+            std::vector<run_iterator> last;
+            for (/**/; runs_first != runs_last; ++runs_first)
+            {
+                auto&& run = *runs_first;
+                first.push_back(pika::util::begin(run));
+                last.push_back(pika::util::end(run));
+            }
+
+            return multiway_set_operation_runs<Kind>(
+                PIKA_MOVE(first), PIKA_MOVE(last), dest, comp, proj);
+        }
+
+        template <typename ExPolicy, typename RunIter, typename Comp,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, Iter>::type parallel(
+            ExPolicy&& policy, RunIter runs_first, RunIter runs_last, Iter dest,
+            Comp&& comp, Proj&& proj)
+        {
+            multiway_merge_runs<RunIter> runs(runs_first, runs_last);
+            if (runs.total == 0)
+            {
+                return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(dest));
+            }
+
+            return run_length_parallel<ExPolicy, Iter>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [runs = PIKA_MOVE(runs), dest, comp = PIKA_FORWARD(Comp, comp),
+                    proj = PIKA_FORWARD(Proj, proj)](auto& p) mutable -> Iter {
+                    return multiway_set_operation_impl<Kind>(p, runs.firsts,
+                        runs.sizes, runs.total, dest, comp, proj);
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::multiway_set_union
+    inline constexpr struct multiway_set_union_t final
+      : pika::detail::tag_parallel_algorithm<multiway_set_union_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RunIter, typename FwdIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(multiway_set_union_t, ExPolicy&& policy,
+            RunIter runs_first, RunIter runs_last, FwdIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_forward_iterator<RunIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_random_access_iterator<
+                              pika::parallel::detail::
+                                  multiway_merge_run_iterator_t<RunIter>>::value,
+                "Requires random access iterators for the runs.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::multiway_set_operation<
+                pika::parallel::detail::multiway_set_kind::set_union,
+                FwdIter>()
+                .call(PIKA_FORWARD(ExPolicy, policy), runs_first, runs_last,
+                    dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RunIter, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(multiway_set_union_t,
+            RunIter runs_first, RunIter runs_last, OutIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_input_iterator<RunIter>::value,
+                "Requires at least input iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::multiway_set_operation<
+                pika::parallel::detail::multiway_set_kind::set_union,
+                OutIter>()
+                .call(pika::execution::seq, runs_first, runs_last, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+    } multiway_set_union{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::multiway_set_intersection
+    inline constexpr struct multiway_set_intersection_t final
+      : pika::detail::tag_parallel_algorithm<multiway_set_intersection_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RunIter, typename FwdIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(multiway_set_intersection_t, ExPolicy&& policy,
+            RunIter runs_first, RunIter runs_last, FwdIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_forward_iterator<RunIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_random_access_iterator<
+                              pika::parallel::detail::
+                                  multiway_merge_run_iterator_t<RunIter>>::value,
+                "Requires random access iterators for the runs.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::multiway_set_operation<
+                pika::parallel::detail::multiway_set_kind::set_intersection,
+                FwdIter>()
+                .call(PIKA_FORWARD(ExPolicy, policy), runs_first, runs_last,
+                    dest, PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RunIter, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RunIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RunIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(multiway_set_intersection_t,
+            RunIter runs_first, RunIter runs_last, OutIter dest,
+            Comp&& comp = Comp())
+        {
+            static_assert(pika::traits::is_input_iterator<RunIter>::value,
+                "Requires at least input iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::multiway_set_operation<
+                pika::parallel::detail::multiway_set_kind::set_intersection,
+                OutIter>()
+                .call(pika::execution::seq, runs_first, runs_last, dest,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity());
+        }
+    } multiway_set_intersection{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -135,6 +135,8 @@ namespace pika {
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/exception_list.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/pivot.hpp>
@@ -142,12 +144,16 @@ namespace pika {
 #include <pika/parallel/algorithms/minmax.hpp>
 #include <pika/parallel/algorithms/partial_sort.hpp>
 #include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/util/compare_projected.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <iterator>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -233,6 +239,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // the work is bounded by the outer iterators, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_outer(args...);
+        }
+
         template <typename ExPolicy, typename RandomIt, typename Sent,
             typename Pred, typename Proj>
         static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
@@ -266,83 +279,71 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, RandomIt first, RandomIt nth, Sent last,
             Pred&& pred, Proj&& proj)
         {
-            auto end = detail::advance_to_sentinel(first, last);
-            [[maybe_unused]] auto nelem = end - first;
-
-            PIKA_ASSERT(0 <= nelem && first <= nth && (nth - first) <= nelem);
-
-            using value_type =
-                typename std::iterator_traits<RandomIt>::value_type;
+            using result = algorithm_result<ExPolicy, RandomIt>;
 
-            RandomIt partitionIter, return_last;
-
-            if (first == last)
+            try
             {
-                return algorithm_result<ExPolicy, RandomIt>::get(
-                    PIKA_MOVE(first));
-            }
+                util::detail::throw_if_sort_stop_requested(
+                    util::detail::get_sort_stop_token(policy.parameters()));
 
-            if (nth == last)
-            {
-                return algorithm_result<ExPolicy, RandomIt>::get(
-                    PIKA_MOVE(nth));
-            }
+                RandomIt end = detail::advance_to_sentinel(first, last);
+                [[maybe_unused]] auto nelem = end - first;
 
-            try
-            {
-                RandomIt last_iter = detail::advance_to_sentinel(first, last);
-                return_last = last_iter;
+                PIKA_ASSERT(
+                    0 <= nelem && first <= nth && (nth - first) <= nelem);
 
-                while (first != last_iter)
+                if (first == end)
                 {
-                    detail::pivot9(first, last_iter, pred);
-
-                    partitionIter =
-                        pika::parallel::detail::partition_algo<RandomIt>().call(
-                            policy(pika::execution::non_task), first + 1,
-                            last_iter,
-                            [val = PIKA_INVOKE(proj, *first), &pred](
-                                value_type const& elem) {
-                                return PIKA_INVOKE(pred, elem, val);
-                            },
-                            proj);
-
-                    --partitionIter;
-                    // swap first element and partitionIter
-                    // (ending element of first group)
-#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                    std::ranges::iter_swap(first, partitionIter);
-#else
-                    std::iter_swap(first, partitionIter);
-#endif
+                    return result::get(PIKA_MOVE(first));
+                }
 
-                    // if nth element < partitioned index,
-                    // it lies in [first, partitionIter)
-                    if (partitionIter < nth)
-                    {
-                        first = partitionIter + 1;
-                    }
-                    // else it lies in [partitionIter + 1, last)
-                    else if (partitionIter > nth)
-                    {
-                        last_iter = partitionIter;
-                    }
-                    // partitionIter == nth
-                    else
-                    {
-                        break;
-                    }
+                if (nth == end)
+                {
+                    return result::get(PIKA_MOVE(nth));
+                }
+
+                if constexpr (pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, nth, end,
+                            comp = compare_projected<Pred&, Proj&>(
+                                pred, proj)]() mutable -> RandomIt {
+                            try
+                            {
+                                auto p = policy(pika::execution::non_task);
+                                parallel_select(p, first, nth, end, comp);
+                                return end;
+                            }
+                            catch (std::bad_alloc const&)
+                            {
+                                throw;
+                            }
+                            catch (pika::exception_list const&)
+                            {
+                                throw;
+                            }
+                            catch (...)
+                            {
+                                throw pika::exception_list(
+                                    std::current_exception());
+                            }
+                        }));
+                }
+                else
+                {
+                    compare_projected<Pred&, Proj&> comp(pred, proj);
+                    parallel_select(policy, first, nth, end, comp);
+                    return result::get(PIKA_MOVE(end));
                 }
             }
             catch (...)
             {
-                return algorithm_result<ExPolicy, RandomIt>::get(
+                return result::get(
                     detail::handle_exception<ExPolicy, RandomIt>::call(
                         std::current_exception()));
             }
-
-            return algorithm_result<ExPolicy, RandomIt>::get(
-                PIKA_MOVE(return_last));
         }
     };
     /// \endcond
@@ -125,6 +125,7 @@ namespace pika {
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/nbits.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -133,8 +134,10 @@ namespace pika {
 #include <functional>
 #include <iterator>
 #include <list>
+#include <new>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
@@ -293,104 +296,164 @@ namespace pika::parallel::detail {
             first, middle, c_last, level - 1, PIKA_FORWARD(Comp, comp));
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // sections smaller than this are selected sequentially
+    static const std::size_t parallel_select_limit = 262144ul;
+
+    // the number of elements sampled for choosing a pivot of the selection
+    static const std::size_t parallel_select_sample_size = 1024ul;
+
     ///////////////////////////////////////////////////////////////////////
     ///
-    /// Internal function to divide and sort the ranges
+    /// Chooses the pivot of a selection step from a sample of the range and
+    /// moves it to the first position. The pivot is taken from slightly
+    /// beyond the relative position of nth in the sample (towards the
+    /// closer end of the range), which makes nth end up in the smaller
+    /// section with a high probability.
     ///
     /// \param first : iterator to the first element
-    /// \param middle: iterator defining the last element to be sorted
+    /// \param nth : iterator to the element to select
     /// \param end : iterator to the element after the end in the range
-    /// \param level : level of depth from the top level call
     /// \param comp : object for to Comp elements
     ///
-    struct sort_thread_helper
+    template <typename Iter, typename Comp>
+    void parallel_select_pivot(Iter first, Iter nth, Iter end, Comp& comp)
     {
-        template <typename... Ts>
-        decltype(auto) operator()(Ts&&... ts) const
+        std::size_t const N = end - first;
+        std::size_t const sample_size =
+            (std::min)(N, parallel_select_sample_size);
+
+        std::vector<Iter> sample(sample_size);
+        for (std::size_t i = 0; i != sample_size; ++i)
         {
-            return sort_thread(PIKA_FORWARD(Ts, ts)...);
+            sample[i] = first + (i * N) / sample_size;
         }
-    };
 
-    template <typename ExPolicy, typename Iter, typename Comp>
-    pika::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-        Iter middle, Iter last, std::uint32_t level, Comp&& comp = Comp());
+        // roughly the square root of the sample size
+        std::size_t const delta = std::size_t(1)
+            << (pdq_log2(std::ptrdiff_t(sample_size)) / 2);
+        std::size_t const rank = (std::size_t(nth - first) * sample_size) / N;
+        std::size_t const pos = rank < sample_size / 2 ?
+            (std::min)(rank + delta, sample_size - 1) :
+            (rank > delta ? rank - delta : 0);
 
-    struct parallel_partial_sort_helper
-    {
-        template <typename... Ts>
-        decltype(auto) operator()(Ts&&... ts) const
-        {
-            return parallel_partial_sort(PIKA_FORWARD(Ts, ts)...);
-        }
-    };
+        std::nth_element(sample.begin(), sample.begin() + pos, sample.end(),
+            [&comp](Iter lhs, Iter rhs) {
+                return PIKA_INVOKE(comp, *lhs, *rhs);
+            });
+
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+        std::ranges::iter_swap(first, sample[pos]);
+#else
+        std::iter_swap(first, sample[pos]);
+#endif
+    }
 
+    ///////////////////////////////////////////////////////////////////////
+    ///
+    /// Internal function placing the element at nth which would occur there
+    /// if the range was fully sorted, all elements before it are not greater
+    /// and all elements after it are not less than that element. The large
+    /// sections are partitioned in parallel around pivots chosen from a
+    /// sample, only the section containing nth is processed further. The
+    /// sections below parallel_select_limit are selected sequentially. A stop
+    /// request on the sort_stop_token of the policy is checked before every
+    /// parallel partitioning step.
+    ///
+    /// \param policy : execution policy used for partitioning in parallel
+    /// \param first : iterator to the first element
+    /// \param nth : iterator to the element to select
+    /// \param end : iterator to the element after the end in the range
+    /// \param comp : object for to Comp elements
+    ///
     template <typename ExPolicy, typename Iter, typename Comp>
-    pika::future<Iter> parallel_partial_sort(ExPolicy&& policy, Iter first,
-        Iter middle, Iter last, std::uint32_t level, Comp&& comp)
+    void parallel_select(
+        ExPolicy& policy, Iter first, Iter nth, Iter end, Comp& comp)
     {
-        std::int64_t nelem = last - first;
-        std::int64_t nmid = middle - first;
-        PIKA_ASSERT(nelem >= nmid);
-
-        if (nelem == 0 || nmid == 0)
-        {
-            return pika::make_ready_future(last);
-        }
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
 
-        if (nmid < 4096 || level < 12)
-        {
-            recursive_partial_sort(first, middle, last, level, comp);
-            return pika::make_ready_future(last);
-        }
+        pika::stop_token const stop =
+            util::detail::get_sort_stop_token(policy.parameters());
 
-        Iter c_last = filter(first, last, comp);
-        if (middle >= c_last)
+        int bad_allowed = pdq_log2(end - first);
+        while (cores > 1 && first <= nth && nth < end &&
+            std::size_t(end - first) >= parallel_select_limit)
         {
-            // figure out the chunk size to use
-            std::size_t const cores = execution::processing_units_count(
-                policy.parameters(), policy.executor());
+            util::detail::throw_if_sort_stop_requested(stop);
 
-            // number of elements to sort
-            std::size_t chunk_size = execution::get_chunk_size(
-                policy.parameters(), policy.executor(), 0, cores, nelem);
+            std::ptrdiff_t const N = end - first;
 
-            pika::future<Iter> left = execution::async_execute(
-                policy.executor(), sort_thread_helper(), policy, first, c_last,
-                comp, chunk_size);
+            parallel_select_pivot(first, nth, end, comp);
+            Iter const pivot_pos =
+                sort_parallel_partition(policy, first, end, comp);
 
-            pika::future<Iter> right;
-            if (middle != c_last)
+            if (nth < pivot_pos)
             {
-                right = execution::async_execute(policy.executor(),
-                    parallel_partial_sort_helper(), policy, c_last + 1, middle,
-                    last, level - 1, comp);
+                end = pivot_pos;
+            }
+            else if (pivot_pos < nth)
+            {
+                // many elements equal to the pivot are moved out of the way
+                // at once, nth might be one of them
+                if (end - (pivot_pos + 1) > N - N / 8)
+                {
+                    auto pred = [&comp, pivot_pos](auto const& value) -> bool {
+                        return !PIKA_INVOKE(comp, *pivot_pos, value);
+                    };
+                    Iter const equal_last = partition_helper::call(policy,
+                        pivot_pos + 1, end, pred, projection_identity{});
+                    if (nth < equal_last)
+                    {
+                        return;
+                    }
+                    first = equal_last;
+                }
+                else
+                {
+                    first = pivot_pos + 1;
+                }
             }
             else
             {
-                right = pika::make_ready_future(last);
+                return;
             }
 
-            return pika::dataflow(
-                [last](pika::future<Iter>&& left,
-                    pika::future<Iter>&& right) -> Iter {
-                    if (left.has_exception() || right.has_exception())
-                    {
-                        std::list<std::exception_ptr> errors;
-                        if (left.has_exception())
-                            errors.push_back(left.get_exception_ptr());
-                        if (right.has_exception())
-                            errors.push_back(right.get_exception_ptr());
+            // too many bad pivots, leave the rest to the sequential selection
+            // which guarantees linear complexity
+            if (end - first > N - N / 8 && --bad_allowed <= 0)
+            {
+                break;
+            }
+        }
 
-                        throw exception_list(PIKA_MOVE(errors));
-                    }
-                    return last;
-                },
-                PIKA_MOVE(left), PIKA_MOVE(right));
+        if (first <= nth && nth < end)
+        {
+            std::nth_element(first, nth, end, comp);
         }
+    }
 
-        return parallel_partial_sort(PIKA_FORWARD(ExPolicy, policy), first,
-            middle, c_last, level - 1, PIKA_FORWARD(Comp, comp));
+    ///////////////////////////////////////////////////////////////////////
+    ///
+    /// Internal function selecting the middle - first smallest elements and
+    /// sorting them in parallel afterwards
+    ///
+    /// \param policy : non-task execution policy to use
+    /// \param first : iterator to the first element
+    /// \param middle: iterator defining the last element to be sorted
+    /// \param end : iterator to the element after the end in the range
+    /// \param comp : object for to Comp elements
+    ///
+    template <typename ExPolicy, typename Iter, typename Comp>
+    Iter parallel_partial_sort_select_and_sort(
+        ExPolicy&& policy, Iter first, Iter middle, Iter end, Comp comp)
+    {
+        if (middle != end)
+        {
+            parallel_select(policy, first, middle, end, comp);
+        }
+        parallel_sort_async(policy, first, middle, comp).get();
+        return end;
     }
     /// \endcond NOINTERNAL
 
@@ -414,14 +477,6 @@ namespace pika::parallel::detail {
         std::int64_t nmid = middle - first;
         PIKA_ASSERT(nmid >= 0 && nmid <= nelem);
 
-        if (nmid > 1024)
-        {
-            if (is_sorted_sequential(first, middle, comp))
-            {
-                return first + nelem;
-            }
-        }
-
         std::uint32_t level = nbits64(nelem) * 2;
         recursive_partial_sort(
             first, middle, first + nelem, level, PIKA_FORWARD(Comp, comp));
@@ -449,17 +504,50 @@ namespace pika::parallel::detail {
         std::int64_t nmid = middle - first;
         PIKA_ASSERT(nmid >= 0 && nmid <= nelem);
 
-        if (nmid > 1024)
+        Iter last = first + nelem;
+        if (nmid == 0)
         {
-            if (is_sorted_sequential(first, middle, comp))
-            {
-                return pika::make_ready_future(first + nelem);
-            }
+            return pika::make_ready_future(last);
         }
 
-        std::uint32_t level = nbits64(nelem) * 2;
-        return parallel_partial_sort(PIKA_FORWARD(ExPolicy, policy), first,
-            middle, first + nelem, level, PIKA_FORWARD(Comp, comp));
+        if (std::size_t(nelem) < sort_limit_per_task())
+        {
+            return pika::make_ready_future(sequential_partial_sort(
+                first, middle, last, PIKA_FORWARD(Comp, comp)));
+        }
+
+        if constexpr (pika::is_async_execution_policy_v<std::decay_t<ExPolicy>>)
+        {
+            return execution::async_execute(policy.executor(),
+                [policy, first, middle, last,
+                    comp = PIKA_FORWARD(Comp, comp)]() mutable -> Iter {
+                    try
+                    {
+                        return parallel_partial_sort_select_and_sort(
+                            policy(pika::execution::non_task), first, middle,
+                            last, PIKA_MOVE(comp));
+                    }
+                    catch (std::bad_alloc const&)
+                    {
+                        throw;
+                    }
+                    catch (pika::exception_list const&)
+                    {
+                        throw;
+                    }
+                    catch (...)
+                    {
+                        throw pika::exception_list(std::current_exception());
+                    }
+                });
+        }
+        else
+        {
+            return pika::make_ready_future(
+                parallel_partial_sort_select_and_sort(
+                    PIKA_FORWARD(ExPolicy, policy), first, middle, last,
+                    PIKA_FORWARD(Comp, comp)));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -472,6 +560,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // the work is bounded by the outer iterators, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_outer(args...);
+        }
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         static Iter sequential(ExPolicy, Iter first, Iter middle, Sent last,
@@ -489,6 +584,9 @@ namespace pika::parallel::detail {
         {
             try
             {
+                util::detail::throw_if_sort_stop_requested(
+                    util::detail::get_sort_stop_token(policy.parameters()));
+
                 // call the sort routine and return the right type,
                 // depending on execution policy
                 return algorithm_result<ExPolicy, Iter>::get(
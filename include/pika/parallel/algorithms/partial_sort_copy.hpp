@@ -149,14 +149,18 @@ namespace pika {
 #include <pika/assert.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/irange.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 
 #include <pika/algorithms/traits/projected.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
 #include <pika/executors/exception_list.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/copy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/partial_sort.hpp>
@@ -167,11 +171,55 @@ namespace pika {
 #include <pika/parallel/util/result_types.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <utility>
 #include <vector>
 
 namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////
+    // the minimal number of elements of the chunks of the input for which
+    // the smallest elements are selected independently
+    static const std::size_t partial_sort_copy_chunk_limit = 65536ul;
+
+    ///////////////////////////////////////////////////////////////////////
+    ///
+    /// \brief : Returns copies of the count smallest elements of the range
+    ///          [first, first + size) (in no particular order), which are
+    ///          kept in a max-heap while traversing the range.
+    ///
+    /// \param first : iterator to the first element
+    /// \param size : number of elements in the range
+    /// \param count : number of elements to select
+    /// \param comp : object for to compare elements
+    ///
+    template <typename FwdIter, typename Compare>
+    std::vector<typename std::iterator_traits<FwdIter>::value_type>
+    partial_sort_copy_select(
+        FwdIter first, std::size_t size, std::size_t count, Compare& comp)
+    {
+        std::vector<typename std::iterator_traits<FwdIter>::value_type> top;
+        top.reserve((std::min)(size, count));
+
+        for (/**/; size != 0 && top.size() != count; --size, ++first)
+        {
+            top.push_back(*first);
+        }
+        std::make_heap(top.begin(), top.end(), comp);
+
+        for (/**/; size != 0; --size, ++first)
+        {
+            if (PIKA_INVOKE(comp, *first, top.front()))
+            {
+                std::pop_heap(top.begin(), top.end(), comp);
+                top.back() = *first;
+                std::push_heap(top.begin(), top.end(), comp);
+            }
+        }
+        return top;
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // partial_sort_copy
     template <typename Iter>
@@ -294,14 +342,61 @@ namespace pika::parallel::detail {
                     return result_type::get(
                         in_out_result<FwdIter, RandIter>{last_iter, d_first});
 
-                std::vector<value_t> aux(first, last_iter);
-                std::int64_t ninput = aux.size();
+                std::int64_t ninput = (distance) (first, last_iter);
                 std::int64_t noutput = d_last_iter - d_first;
                 PIKA_ASSERT(ninput >= 0 and noutput >= 0);
 
                 compare_projected<Compare&, Proj1&, Proj2&> proj_comp{
                     comp, proj1, proj2};
 
+                // If the input is much larger than the output, the smallest
+                // elements of every chunk of the input are selected
+                // independently, only those are sorted afterwards.
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+                std::size_t const num_chunks = (std::min)(cores,
+                    std::size_t(ninput) /
+                        (std::max)(partial_sort_copy_chunk_limit,
+                            4 * std::size_t(noutput)));
+
+                std::vector<value_t> aux;
+                if (num_chunks > 1)
+                {
+                    std::vector<FwdIter> chunk_first(num_chunks);
+                    std::vector<std::size_t> chunk_size(num_chunks);
+
+                    FwdIter it = first;
+                    for (std::size_t i = 0; i != num_chunks; ++i)
+                    {
+                        chunk_first[i] = it;
+                        chunk_size[i] =
+                            ((i + 1) * std::size_t(ninput)) / num_chunks -
+                            (i * std::size_t(ninput)) / num_chunks;
+                        std::advance(it, chunk_size[i]);
+                    }
+
+                    std::vector<std::vector<value_t>> tops(num_chunks);
+                    execution::bulk_sync_execute(
+                        policy.executor(),
+                        [&](std::size_t i) {
+                            tops[i] = partial_sort_copy_select(chunk_first[i],
+                                chunk_size[i], std::size_t(noutput),
+                                proj_comp);
+                        },
+                        pika::detail::irange(std::size_t(0), num_chunks));
+
+                    aux.reserve(num_chunks * noutput);
+                    for (auto& top : tops)
+                    {
+                        std::move(
+                            top.begin(), top.end(), std::back_inserter(aux));
+                    }
+                }
+                else
+                {
+                    aux.assign(first, last_iter);
+                }
+
                 auto nmin = ninput < noutput ? ninput : noutput;
                 if (noutput >= ninput)
                 {
@@ -311,7 +406,6 @@ namespace pika::parallel::detail {
                 }
                 else
                 {
-                    //
                     partial_sort<vec_iter_t>().call(
                         policy(pika::execution::non_task), aux.begin(),
                         aux.begin() + nmin, aux.end(), PIKA_MOVE(proj_comp),
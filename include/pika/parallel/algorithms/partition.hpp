@@ -137,6 +137,156 @@ namespace pika {
     partition(ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& pred,
         Proj&& proj);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Reorders the elements in the range [first, last) into three groups:
+    /// the elements for which the predicate \a less returns true, followed
+    /// by the elements for which the predicate \a equal returns true, followed
+    /// by all other elements. This is the three-way (Dutch national flag)
+    /// partition around a pivot, which puts all elements equal to the pivot
+    /// between the smaller and the greater ones. Relative order of the
+    /// elements is not preserved.
+    ///
+    /// \note   Complexity: At most 4 * (last - first) swaps.
+    ///         At most 2 * (last - first) applications of the predicates and
+    ///         the projection.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam PredLess    The type of the function/function object selecting
+    ///                     the first group (deduced). It has to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam PredEqual   The type of the function/function object selecting
+    ///                     the second group (deduced). It has to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a pika::parallel::detail::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param less         The unary predicate which returns true for the
+    ///                     elements of the first group, e.g. the elements
+    ///                     smaller than the pivot.
+    /// \param equal        The unary predicate which returns true for the
+    ///                     elements of the second group, e.g. the elements
+    ///                     equal to the pivot. It is only invoked for the
+    ///                     elements for which \a less returns false.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicates
+    ///                     are invoked.
+    ///
+    /// The assignments in the parallel \a partition3 algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a partition3 algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partition3 algorithm returns a
+    ///           \a pika::future<std::pair<FwdIter, FwdIter>>
+    ///           if the execution policy is of type \a parallel_task_policy
+    ///           and returns \a std::pair<FwdIter, FwdIter> otherwise.
+    ///           The \a partition3 algorithm returns the iterators to the
+    ///           first element of the second and of the third group.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename PredLess,
+        typename PredEqual, typename Proj>
+    pika::parallel::detail::algorithm_result_t<ExPolicy,
+        std::pair<FwdIter, FwdIter>>
+    partition3(ExPolicy&& policy, FwdIter first, FwdIter last,
+        PredLess&& less, PredEqual&& equal, Proj&& proj);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Distributes the elements in the range [first, last) into \a k
+    /// contiguous buckets: the elements for which the classifier returns 0,
+    /// followed by the ones for which it returns 1, and so on. Relative
+    /// order of the elements within a bucket is preserved. This is the
+    /// building block of radix sorts, hash partitioning and sample sort
+    /// splitting.
+    ///
+    /// \note   Complexity: At most 2 * (last - first) applications of the
+    ///         classifier and the projection, at most 2 * (last - first)
+    ///         move assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type has to be
+    ///                     default constructible.
+    /// \tparam Classifier  The type of the function/function object
+    ///                     selecting the bucket of an element (deduced). It
+    ///                     has to meet the requirements of
+    ///                     \a CopyConstructible.
+    /// \tparam OutIter     The type of the iterator the bucket offsets are
+    ///                     written to (deduced). This iterator type must meet
+    ///                     the requirements of an output iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a pika::parallel::detail::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param k            The number of buckets.
+    /// \param classifier   Returns the bucket of an element, a value of type
+    ///                     std::size_t smaller than \a k. The signature of
+    ///                     this function should be equivalent to:
+    ///                     \code
+    ///                     std::size_t classifier(const Type &a);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it and has to return the same bucket every time it
+    ///                     is invoked for an element.
+    /// \param bucket_offsets Refers to the beginning of the destination range
+    ///                     of the k + 1 offsets of the buckets from \a first,
+    ///                     bucket i holds the elements
+    ///                     [first + offsets[i], first + offsets[i + 1]).
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the classifier is
+    ///                     invoked.
+    ///
+    /// The assignments in the parallel \a partition_k algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a partition_k algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partition_k algorithm returns a
+    ///           \a pika::future<OutIter> if the execution policy is of type
+    ///           \a parallel_task_policy and returns \a OutIter otherwise.
+    ///           The \a partition_k algorithm returns the iterator to the
+    ///           element after the last offset written.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Classifier,
+        typename OutIter, typename Proj>
+    pika::parallel::detail::algorithm_result_t<ExPolicy, OutIter>
+    partition_k(ExPolicy&& policy, RandomIt first, RandomIt last,
+        std::size_t k, Classifier&& classifier, OutIter bucket_offsets,
+        Proj&& proj);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Permutes the elements in the range [first, last) such that there exists
     /// an iterator i such that for every iterator j in the range [first, i)
@@ -270,6 +420,87 @@ namespace pika {
     stable_partition(ExPolicy&& policy, BidirIter first, BidirIter last,
         F&& f, Proj&& proj);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Permutes the elements in the range [first, last) such that there exists
+    /// an iterator i such that for every iterator j in the range [first, i)
+    /// INVOKE(f, INVOKE (proj, *j)) != false, and for every iterator k in the
+    /// range [i, last), INVOKE(f, INVOKE (proj, *k)) == false. The elements
+    /// are moved through the caller provided \a buffer, the algorithm does
+    /// not allocate any memory for them.
+    ///
+    /// The parallel overload splits the range into chunks. It counts the
+    /// elements satisfying the predicate in each chunk first, moves the
+    /// elements of all chunks to their final position in the buffer
+    /// concurrently and finally moves them back. By default the predicate
+    /// is invoked twice for each element. If the policy's executor parameters
+    /// are \a pika::execution::stream_compaction with a mode other than
+    /// \a stream_compaction_mode::recompute, the results of the first
+    /// invocation are cached in one bit per element instead, which suits
+    /// expensive predicates.
+    ///
+    /// \note   Complexity: Exactly 2 * (last - first) moves. At most
+    ///         2 * (last - first) applications of the predicate and
+    ///         projection.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the invocations of \a f.
+    /// \tparam BidirIter   The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     bidirectional iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced). It has to meet the requirements of
+    ///                     \a CopyConstructible.
+    /// \tparam RandIter    The type of the iterator referring to the buffer
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a pika::parallel::detail::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param f            Unary predicate which returns true if the element
+    ///                     should be ordered before other elements.
+    /// \param buffer       Refers to the beginning of a range of at least
+    ///                     \a last - \a first objects of the value type of
+    ///                     \a BidirIter, which the elements are move assigned
+    ///                     to. The objects are left in a moved-from state.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a f is invoked.
+    ///
+    /// The invocations of \a f in the parallel \a stable_partition algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy executes in sequential order in the
+    /// calling thread.
+    ///
+    /// The invocations of \a f in the parallel \a stable_partition algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an
+    /// unordered fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a stable_partition algorithm returns an iterator i such
+    ///           that INVOKE(f, INVOKE(proj, *j)) != false for every iterator
+    ///           j in the range [first, i), and
+    ///           INVOKE(f, INVOKE (proj, *k)) == false for every iterator k in
+    ///           the range [i, last). The relative order of the elements in
+    ///           both groups is preserved.
+    ///           If the execution policy is of type \a parallel_task_policy
+    ///           the algorithm returns a future<> referring to this iterator.
+    ///
+    template <typename ExPolicy, typename BidirIter, typename F,
+        typename RandIter, typename Proj>
+    pika::parallel::detail::algorithm_result_t<ExPolicy, BidirIter>
+    stable_partition(ExPolicy&& policy, BidirIter first, BidirIter last,
+        F&& f, RandIter buffer, Proj&& proj);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Copies the elements in the range, defined by [first, last),
     /// to two different ranges depending on the value returned by
@@ -450,6 +681,7 @@ namespace pika {
 #include <pika/functional/invoke.hpp>
 #include <pika/functional/traits/is_invocable.hpp>
 #include <pika/futures/future.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/modules/async.hpp>
 #include <pika/synchronization/spinlock.hpp>
@@ -467,12 +699,16 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/invoke_projected.hpp>
 #include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/partition_cache_size.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/stream_compaction.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -483,6 +719,7 @@ namespace pika {
 #include <iterator>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -691,6 +928,246 @@ namespace pika::parallel::detail {
             return algorithm_result::get(PIKA_MOVE(result));
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_partition using a caller provided buffer
+
+    // inputs smaller than this are partitioned sequentially
+    inline constexpr std::size_t stable_partition_min_chunk_size = 4096;
+
+    // The results of the predicate are cached in one bit per element if
+    // requested through the stream_compaction executor parameters
+    template <typename Parameters>
+    constexpr bool use_stable_partition_flags(Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::stream_compaction>)
+        {
+            return params.get_stream_compaction_mode() !=
+                pika::execution::stream_compaction_mode::recompute;
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+            return false;
+        }
+    }
+
+    template <typename BidirIter, typename Sent, typename RandIter,
+        typename F, typename Proj>
+    BidirIter stable_partition_seq_buffer(
+        BidirIter first, Sent last, RandIter buffer, F&& f, Proj&& proj)
+    {
+        BidirIter next = first;
+        RandIter buffer_last = buffer;
+        for (/**/; first != last; ++first)
+        {
+            if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
+            {
+                if (next != first)
+                {
+                    *next = PIKA_MOVE(*first);
+                }
+                ++next;
+            }
+            else
+            {
+                *buffer_last++ = PIKA_MOVE(*first);
+            }
+        }
+
+        std::move(buffer, buffer_last, next);
+        return next;
+    }
+
+    template <typename Iter>
+    struct stable_partition_buffer_algo
+      : public algorithm<stable_partition_buffer_algo<Iter>, Iter>
+    {
+        stable_partition_buffer_algo()
+          : stable_partition_buffer_algo::algorithm("stable_partition")
+        {
+        }
+
+        template <typename ExPolicy, typename BidirIter, typename Sent,
+            typename RandIter, typename F, typename Proj>
+        static BidirIter sequential(ExPolicy&&, BidirIter first, Sent last,
+            RandIter buffer, F&& f, Proj&& proj)
+        {
+            return stable_partition_seq_buffer(first, last, buffer,
+                PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename Sent,
+            typename RandIter2, typename F, typename Proj>
+        static typename algorithm_result<ExPolicy, RandIter1>::type parallel(
+            ExPolicy&& policy, RandIter1 first, Sent last, RandIter2 buffer,
+            F&& f, Proj&& proj)
+        {
+            using result = algorithm_result<ExPolicy, RandIter1>;
+
+            RandIter1 last_iter = first;
+            std::size_t const size =
+                detail::advance_and_get_distance(last_iter, last);
+
+            if (size < 2 * stable_partition_min_chunk_size)
+            {
+                return result::get(stable_partition_seq_buffer(first,
+                    last_iter, buffer, PIKA_FORWARD(F, f),
+                    PIKA_FORWARD(Proj, proj)));
+            }
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, size, buffer, f = PIKA_FORWARD(F, f),
+                        proj = PIKA_FORWARD(Proj, proj)]() mutable {
+                        auto p = policy(pika::execution::non_task);
+                        return stable_partition_thread(
+                            p, first, size, buffer, f, proj);
+                    }));
+            }
+            else
+            {
+                return result::get(stable_partition_thread(
+                    policy, first, size, buffer, f, proj));
+            }
+        }
+
+    private:
+        // Runs op(chunk) for all chunks, rethrows the exceptions thrown by
+        // any of them
+        template <typename ExPolicy, typename Op, typename Shape>
+        static std::vector<pika::future<std::size_t>> run_chunks(
+            ExPolicy&& policy, Op const& op, Shape const& shape)
+        {
+            std::vector<pika::future<std::size_t>> workitems;
+            std::list<std::exception_ptr> errors;
+            try
+            {
+                workitems =
+                    execution::bulk_async_execute(policy.executor(), op, shape);
+                pika::wait_all_nothrow(workitems);
+            }
+            catch (...)
+            {
+                handle_local_exceptions<ExPolicy>::call(
+                    std::current_exception(), errors);
+            }
+            handle_local_exceptions<ExPolicy>::call(workitems, errors);
+            return workitems;
+        }
+
+        // Partitions in three passes over the same chunks: count the
+        // elements satisfying the predicate, move the elements to their
+        // final position in the buffer, and move them back.
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename F, typename Proj>
+        static RandIter1 stable_partition_thread(ExPolicy&& policy,
+            RandIter1 first, std::size_t size, RandIter2 buffer, F& f,
+            Proj& proj)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_chunks = (std::min)(
+                4 * cores, size / stable_partition_min_chunk_size);
+
+            // the index of the first element of each chunk and of the first
+            // element after the last chunk
+            std::vector<std::size_t> bounds(num_chunks + 1);
+            for (std::size_t i = 0; i <= num_chunks; ++i)
+            {
+                bounds[i] = i * size / num_chunks;
+            }
+
+            std::vector<std::size_t> chunks(num_chunks);
+            std::iota(chunks.begin(), chunks.end(), std::size_t(0));
+
+            bool const use_flags =
+                use_stable_partition_flags(policy.parameters());
+            flag_buffer flags = use_flags ? flag_buffer(size) : flag_buffer();
+
+            // count the elements satisfying the predicate in each chunk
+            auto count_op = [&](std::size_t chunk) -> std::size_t {
+                std::size_t const begin = bounds[chunk];
+                std::size_t const count = bounds[chunk + 1] - begin;
+                RandIter1 it = first + begin;
+                if (use_flags)
+                {
+                    return flags.set(begin, count, [&]() -> bool {
+                        return PIKA_INVOKE(f, PIKA_INVOKE(proj, *it++));
+                    });
+                }
+
+                std::size_t num_true = 0;
+                for (std::size_t i = 0; i != count; ++i, ++it)
+                {
+                    num_true += PIKA_INVOKE(f, PIKA_INVOKE(proj, *it)) ? 1 : 0;
+                }
+                return num_true;
+            };
+            auto counts = run_chunks(policy, count_op, chunks);
+
+            // the position of the first element satisfying the predicate of
+            // each chunk in the result
+            std::vector<std::size_t> true_offsets(num_chunks);
+            std::size_t num_true = 0;
+            for (std::size_t i = 0; i != num_chunks; ++i)
+            {
+                true_offsets[i] = num_true;
+                num_true += counts[i].get();
+            }
+
+            // move the elements of each chunk to their final position in the
+            // buffer
+            auto scatter_op = [&](std::size_t chunk) -> std::size_t {
+                std::size_t const begin = bounds[chunk];
+                std::size_t const count = bounds[chunk + 1] - begin;
+                RandIter1 it = first + begin;
+                RandIter2 dest_true = buffer + true_offsets[chunk];
+                RandIter2 dest_false =
+                    buffer + (num_true + begin - true_offsets[chunk]);
+                auto move_element = [&](bool value) {
+                    if (value)
+                    {
+                        *dest_true++ = PIKA_MOVE(*it);
+                    }
+                    else
+                    {
+                        *dest_false++ = PIKA_MOVE(*it);
+                    }
+                    ++it;
+                };
+
+                if (use_flags)
+                {
+                    flags.get(begin, count, move_element);
+                }
+                else
+                {
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        move_element(static_cast<bool>(
+                            PIKA_INVOKE(f, PIKA_INVOKE(proj, *it))));
+                    }
+                }
+                return count;
+            };
+            run_chunks(policy, scatter_op, chunks);
+
+            // move the elements back
+            auto move_back_op = [&](std::size_t chunk) -> std::size_t {
+                std::size_t const begin = bounds[chunk];
+                std::size_t const end = bounds[chunk + 1];
+                std::move(buffer + begin, buffer + end, first + begin);
+                return end - begin;
+            };
+            run_chunks(policy, move_back_op, chunks);
+
+            return first + num_true;
+        }
+    };
     /// \endcond
 
     /////////////////////////////////////////////////////////////////////////////
@@ -756,6 +1233,47 @@ namespace pika::parallel::detail {
         return first;
     }
 
+    // the number of elements classified before the misplaced ones are
+    // swapped, must fit into an unsigned char
+    inline constexpr std::size_t partition_batch_size = 64;
+
+    // the blocks handed out to the threads hold at least this many elements
+    inline constexpr std::size_t partition_min_block_size = 512;
+
+    // the cache size assumed if no partition_cache_size is given
+    inline constexpr std::size_t partition_default_cache_size = 262144;
+
+    template <typename Parameters>
+    constexpr std::size_t get_partition_cache_size(
+        Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::partition_cache_size>)
+        {
+            if (params.get_cache_size() != 0)
+            {
+                return params.get_cache_size();
+            }
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+        }
+        return partition_default_cache_size;
+    }
+
+    // Each thread works on a block on either side of the boundary at a time,
+    // both of them fit into the cache. Every core gets a few blocks at
+    // least.
+    constexpr std::size_t get_partition_block_size(std::size_t cache_size,
+        std::size_t element_size, std::size_t count, std::size_t cores) noexcept
+    {
+        std::size_t const block_size = (std::max)(
+            cache_size / (2 * element_size), partition_min_block_size);
+        return (std::min)(block_size,
+            (std::max)(count / (4 * cores), partition_min_block_size));
+    }
+
     struct partition_helper
     {
         template <typename FwdIter>
@@ -983,11 +1501,108 @@ namespace pika::parallel::detail {
             return dest;
         }
 
+        // The function which performs sub-partitioning for random access
+        //     iterators.
+        // The elements of both blocks are classified in batches, recording
+        //     the offsets of the misplaced ones, which are swapped pairwise
+        //     afterwards. The predicate only affects the index the next
+        //     offset is written to, which avoids data dependent branches.
+        template <typename RandIter, typename Pred, typename Proj>
+        static block<RandIter> partition_thread_branchless(
+            block_manager<RandIter>& block_manager, Pred& pred, Proj& proj)
+        {
+            block<RandIter> left_block = block_manager.get_left_block();
+            block<RandIter> right_block = block_manager.get_right_block();
+
+            unsigned char offsets_l[partition_batch_size];
+            unsigned char offsets_r[partition_batch_size];
+            RandIter base_l = left_block.first;
+            RandIter base_r = right_block.first;
+            std::size_t num_l = 0, num_r = 0;
+            std::size_t start_l = 0, start_r = 0;
+
+            while (true)
+            {
+                // A new block is taken only once all misplaced elements of
+                //     the previous one have been swapped. If there is none
+                //     left, the misplaced elements of the other side remain
+                //     unpartitioned.
+                if (num_l == 0)
+                {
+                    if (left_block.empty() &&
+                        (left_block = block_manager.get_left_block()).empty())
+                    {
+                        if (num_r != 0)
+                            right_block.first = base_r + offsets_r[start_r];
+                        return right_block;
+                    }
+
+                    start_l = 0;
+                    base_l = left_block.first;
+                    std::size_t const count = (std::min)(partition_batch_size,
+                        std::size_t(left_block.last - left_block.first));
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i);
+                        num_l +=
+                            !PIKA_INVOKE(pred, PIKA_INVOKE(proj, base_l[i]));
+                    }
+                    left_block.first += count;
+                }
+
+                if (num_r == 0)
+                {
+                    if (right_block.empty() &&
+                        (right_block = block_manager.get_right_block())
+                            .empty())
+                    {
+                        if (num_l != 0)
+                            left_block.first = base_l + offsets_l[start_l];
+                        return left_block;
+                    }
+
+                    start_r = 0;
+                    base_r = right_block.first;
+                    std::size_t const count = (std::min)(partition_batch_size,
+                        std::size_t(right_block.last - right_block.first));
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(i);
+                        num_r += static_cast<bool>(
+                            PIKA_INVOKE(pred, PIKA_INVOKE(proj, base_r[i])));
+                    }
+                    right_block.first += count;
+                }
+
+                std::size_t const num = (std::min)(num_l, num_r);
+                for (std::size_t i = 0; i != num; ++i)
+                {
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+                    std::ranges::iter_swap(base_l + offsets_l[start_l + i],
+                        base_r + offsets_r[start_r + i]);
+#else
+                    std::iter_swap(base_l + offsets_l[start_l + i],
+                        base_r + offsets_r[start_r + i]);
+#endif
+                }
+
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+            }
+        }
+
         // The function which performs sub-partitioning.
         template <typename FwdIter, typename Pred, typename Proj>
         static block<FwdIter> partition_thread(
             block_manager<FwdIter>& block_manager, Pred pred, Proj proj)
         {
+            if constexpr (pika::traits::is_random_access_iterator_v<FwdIter>)
+            {
+                return partition_thread_branchless(block_manager, pred, proj);
+            }
+
             block<FwdIter> left_block, right_block;
 
             left_block = block_manager.get_left_block();
@@ -1263,8 +1878,36 @@ namespace pika::parallel::detail {
             std::size_t const cores = execution::processing_units_count(
                 policy.parameters(), policy.executor());
 
-            // TODO: Find more better block size.
-            const std::size_t block_size = std::size_t(20000);
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            std::size_t const block_size = get_partition_block_size(
+                get_partition_cache_size(policy.parameters()),
+                sizeof(value_type), detail::distance(first, last), cores);
+
+            return call_blocks(
+                policy, first, last, pred, proj, cores, block_size);
+        }
+
+        // Partitions [first, last) into the elements satisfying less, the
+        //     ones satisfying equal and all others. The second pass only
+        //     visits the elements not satisfying less.
+        template <typename ExPolicy, typename FwdIter, typename PredLess,
+            typename PredEqual, typename Proj>
+        static std::pair<FwdIter, FwdIter> call3(ExPolicy&& policy,
+            FwdIter first, FwdIter last, PredLess&& less, PredEqual&& equal,
+            Proj&& proj)
+        {
+            FwdIter const less_last = call(policy, first, last, less, proj);
+            return std::make_pair(
+                less_last, call(policy, less_last, last, equal, proj));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        static FwdIter call_blocks(ExPolicy&& policy, FwdIter first,
+            FwdIter last, Pred& pred, Proj& proj, std::size_t cores,
+            std::size_t block_size)
+        {
             block_manager<FwdIter> block_manager(first, last, block_size);
 
             std::vector<pika::future<block<FwdIter>>> remaining_block_futures(
@@ -1307,20 +1950,51 @@ namespace pika::parallel::detail {
             // Sort remaining blocks to be listed from left to right.
             std::sort(std::begin(remaining_blocks), std::end(remaining_blocks));
 
-            // Collapse remaining blocks each other.
-            collapse_remaining_blocks(remaining_blocks, pred, proj);
+            std::size_t remaining_count = 0;
+            for (auto const& block : remaining_blocks)
+                remaining_count += detail::distance(block.first, block.last);
+
+            if (remaining_count < 4 * cores * partition_min_block_size)
+            {
+                // Collapse remaining blocks each other.
+                collapse_remaining_blocks(remaining_blocks, pred, proj);
+
+                // Merge remaining blocks into one block
+                //     which is adjacent to boundary.
+                block<FwdIter> unpartitioned_block =
+                    merge_remaining_blocks(remaining_blocks, boundary, first);
 
-            // Merge remaining blocks into one block
-            //     which is adjacent to boundary.
-            block<FwdIter> unpartitioned_block =
-                merge_remaining_blocks(remaining_blocks, boundary, first);
+                // Perform sequential partition to unpartitioned range.
+                FwdIter real_boundary =
+                    sequential_partition(unpartitioned_block.first,
+                        unpartitioned_block.last, pred, proj);
 
-            // Perform sequential partition to unpartitioned range.
-            FwdIter real_boundary =
-                sequential_partition(unpartitioned_block.first,
-                    unpartitioned_block.last, pred, proj);
+                return real_boundary;
+            }
 
-            return real_boundary;
+            // Merge the remaining blocks of either side into one block
+            //     adjacent to the boundary and partition both of them in
+            //     parallel using smaller blocks. This leaves at most a
+            //     quarter of the elements unpartitioned.
+            auto const right_blocks_first = std::find_if(
+                std::begin(remaining_blocks), std::end(remaining_blocks),
+                [](block<FwdIter> const& block) -> bool {
+                    return block.block_no > 0;
+                });
+            std::vector<block<FwdIter>> right_blocks(
+                right_blocks_first, std::end(remaining_blocks));
+            remaining_blocks.erase(
+                right_blocks_first, std::end(remaining_blocks));
+
+            FwdIter unpartitioned_first =
+                merge_remaining_blocks(remaining_blocks, boundary, first)
+                    .first;
+            FwdIter unpartitioned_last =
+                merge_remaining_blocks(right_blocks, boundary, first).last;
+
+            return call_blocks(policy, unpartitioned_first,
+                unpartitioned_last, pred, proj, cores,
+                remaining_count / (4 * cores));
         }
     };
 
@@ -1357,6 +2031,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename Sent, typename Pred,
             typename Proj = projection_identity>
         static FwdIter
@@ -1392,6 +2068,251 @@ namespace pika::parallel::detail {
     };
     /// \endcond
 
+    /////////////////////////////////////////////////////////////////////////////
+    // partition3
+    /// \cond NOINTERNAL
+    template <typename FwdIter, typename PredLess, typename PredEqual,
+        typename Proj>
+    std::pair<FwdIter, FwdIter> sequential_partition3(FwdIter first,
+        FwdIter last, PredLess&& less, PredEqual&& equal, Proj&& proj)
+    {
+        FwdIter const less_last = sequential_partition(first, last, less, proj);
+        return std::make_pair(less_last,
+            sequential_partition(less_last, last, equal, proj));
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename PredLess,
+        typename PredEqual, typename Proj>
+    pika::future<std::pair<FwdIter, FwdIter>> parallel_partition3(
+        ExPolicy&& policy, FwdIter first, FwdIter last, PredLess&& less,
+        PredEqual&& equal, Proj&& proj)
+    {
+        return execution::async_execute(policy.executor(),
+            [=]() mutable -> std::pair<FwdIter, FwdIter> {
+                try
+                {
+                    return partition_helper::call3(
+                        policy, first, last, less, equal, proj);
+                }
+                catch (...)
+                {
+                    handle_local_exceptions<ExPolicy>::call(
+                        std::current_exception());
+                }
+
+                // Not reachable.
+                PIKA_ASSERT(false);
+                return std::make_pair(last, last);
+            });
+    }
+
+    template <typename FwdIter>
+    struct partition3
+      : public algorithm<partition3<FwdIter>, std::pair<FwdIter, FwdIter>>
+    {
+        partition3()
+          : partition3::algorithm("partition3")
+        {
+        }
+
+        template <typename ExPolicy, typename Sent, typename PredLess,
+            typename PredEqual, typename Proj>
+        static std::pair<FwdIter, FwdIter> sequential(ExPolicy, FwdIter first,
+            Sent last, PredLess&& less, PredEqual&& equal, Proj&& proj)
+        {
+            auto last_iter = detail::advance_to_sentinel(first, last);
+            return sequential_partition3(first, last_iter,
+                PIKA_FORWARD(PredLess, less), PIKA_FORWARD(PredEqual, equal),
+                PIKA_FORWARD(Proj, proj));
+        }
+
+        template <typename ExPolicy, typename Sent, typename PredLess,
+            typename PredEqual, typename Proj>
+        static typename algorithm_result<ExPolicy,
+            std::pair<FwdIter, FwdIter>>::type
+        parallel(ExPolicy&& policy, FwdIter first, Sent last, PredLess&& less,
+            PredEqual&& equal, Proj&& proj)
+        {
+            using algorithm_result =
+                algorithm_result<ExPolicy, std::pair<FwdIter, FwdIter>>;
+            auto last_iter = detail::advance_to_sentinel(first, last);
+
+            try
+            {
+                return algorithm_result::get(parallel_partition3(
+                    PIKA_FORWARD(ExPolicy, policy), first, last_iter,
+                    PIKA_FORWARD(PredLess, less),
+                    PIKA_FORWARD(PredEqual, equal), PIKA_FORWARD(Proj, proj)));
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy,
+                        std::pair<FwdIter, FwdIter>>::call(
+                        std::current_exception()));
+            }
+        }
+    };
+    /// \endcond
+
+    /////////////////////////////////////////////////////////////////////////////
+    // partition_k
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements handled by a chunk of partition_k
+    static const std::size_t partition_k_chunk_limit = 16384ul;
+
+    // Distributes [first, first + count) stably into k buckets. Every chunk
+    // of the sequence counts the elements of each bucket, the exclusive
+    // prefix sum over all histograms (ordered by bucket, then by chunk)
+    // gives every chunk the positions to move its elements to, through a
+    // temporary buffer. Writes the k + 1 boundaries of the buckets to dest.
+    template <typename ExPolicy, typename RandomIt, typename Classifier,
+        typename OutIter, typename Proj>
+    OutIter partition_k_helper(ExPolicy& policy, RandomIt first,
+        std::size_t count, std::size_t k, Classifier& classifier, OutIter dest,
+        Proj& proj)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+        std::size_t num_chunks = 1;
+        if constexpr (!pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            // the histograms of all chunks hold at most count entries
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            num_chunks = (std::max)(std::size_t(1),
+                (std::min)({cores, count / partition_k_chunk_limit,
+                    count / (std::max)(k, std::size_t(1))}));
+        }
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        auto bucket = [&](auto&& elem) -> std::size_t {
+            std::size_t const b =
+                PIKA_INVOKE(classifier, PIKA_INVOKE(proj, elem));
+            PIKA_ASSERT(b < k);
+            return b;
+        };
+
+        std::vector<std::size_t> histograms(num_chunks * k, 0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* h = histograms.data() + chunk * k;
+            for (std::size_t i = chunk_begin(chunk),
+                             end = chunk_begin(chunk + 1);
+                 i != end; ++i)
+            {
+                ++h[bucket(*(first + i))];
+            }
+        });
+
+        bool partitioned = false;
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b != k; ++b)
+        {
+            *dest++ = offset;
+
+            std::size_t const start = offset;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t& n = histograms[chunk * k + b];
+                std::size_t const bucket_count = n;
+                n = offset;
+                offset += bucket_count;
+            }
+
+            // all elements belong to the same bucket
+            partitioned = partitioned || offset - start == count;
+        }
+        *dest++ = count;
+
+        if (partitioned || count < 2)
+        {
+            return dest;
+        }
+
+        std::vector<value_type> buffer(count);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* h = histograms.data() + chunk * k;
+            for (std::size_t i = chunk_begin(chunk),
+                             end = chunk_begin(chunk + 1);
+                 i != end; ++i)
+            {
+                auto&& elem = *(first + i);
+                buffer[h[bucket(elem)]++] = PIKA_MOVE(elem);
+            }
+        });
+
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::move(buffer.begin() + chunk_begin(chunk),
+                buffer.begin() + chunk_begin(chunk + 1),
+                first + chunk_begin(chunk));
+        });
+        return dest;
+    }
+
+    template <typename OutIter>
+    struct partition_k : public algorithm<partition_k<OutIter>, OutIter>
+    {
+        partition_k()
+          : partition_k::algorithm("partition_k")
+        {
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Sent,
+            typename Classifier, typename Proj>
+        static OutIter sequential(ExPolicy&& policy, RandomIt first, Sent last,
+            std::size_t k, Classifier&& classifier, OutIter dest, Proj&& proj)
+        {
+            auto last_iter = detail::advance_to_sentinel(first, last);
+            return partition_k_helper(policy, first,
+                std::size_t(last_iter - first), k, classifier, dest, proj);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Sent,
+            typename Classifier, typename Proj>
+        static typename algorithm_result<ExPolicy, OutIter>::type parallel(
+            ExPolicy&& policy, RandomIt first, Sent last, std::size_t k,
+            Classifier&& classifier, OutIter dest, Proj&& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, OutIter>;
+            auto last_iter = detail::advance_to_sentinel(first, last);
+            std::size_t const count = std::size_t(last_iter - first);
+
+            try
+            {
+                if constexpr (pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return algorithm_result::get(
+                        execution::async_execute(policy.executor(),
+                            [policy, first, count, k, classifier, dest,
+                                proj]() mutable -> OutIter {
+                                auto non_task_policy =
+                                    policy(pika::execution::non_task);
+                                return partition_k_helper(non_task_policy,
+                                    first, count, k, classifier, dest, proj);
+                            }));
+                }
+                else
+                {
+                    return algorithm_result::get(partition_k_helper(
+                        policy, first, count, k, classifier, dest, proj));
+                }
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy, OutIter>::call(
+                        std::current_exception()));
+            }
+        }
+    };
+    /// \endcond
+
     /////////////////////////////////////////////////////////////////////////////
     // partition_copy
     /// \cond NOINTERNAL
@@ -1424,6 +2345,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter1, typename OutIter2, typename Pred,
             typename Proj = projection_identity>
@@ -1444,7 +2367,8 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter1 first, Sent last,
             FwdIter2 dest_true, FwdIter3 dest_false, Pred&& pred, Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<FwdIter1, bool*>;
+            using zip_iterator = pika::util::zip_iterator<FwdIter1,
+                pika::util::counting_iterator<std::size_t>>;
             using result = algorithm_result<ExPolicy,
                 std::tuple<FwdIter1, FwdIter2, FwdIter3>>;
             using difference_type =
@@ -1459,7 +2383,15 @@ namespace pika::parallel::detail {
             difference_type count =
                 detail::advance_and_get_distance(last_iter, last);
 
-            std::shared_ptr<bool[]> flags(new bool[count]);
+            // small inputs are not worth allocating the flags for
+            if (std::size_t(count) < flag_buffer_sequential_limit)
+            {
+                return partition_copy()(PIKA_FORWARD(ExPolicy, policy), first,
+                    last_iter, dest_true, dest_false, PIKA_FORWARD(Pred, pred),
+                    PIKA_FORWARD(Proj, proj));
+            }
+
+            flag_buffer flags(count);
             output_iterator_offset init = {0, 0};
 
             using pika::util::make_zip_iterator;
@@ -1471,19 +2403,18 @@ namespace pika::parallel::detail {
             // Note: replacing the invoke() with PIKA_INVOKE()
             // below makes gcc generate errors
             auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                          proj = PIKA_FORWARD(Proj, proj)](
+                          proj = PIKA_FORWARD(Proj, proj), flags](
                           zip_iterator part_begin,
-                          std::size_t part_size) -> output_iterator_offset {
-                std::size_t true_count = 0;
-
-                // MSVC complains if pred or proj is captured by ref below
-                loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                    [pred, proj, &true_count](zip_iterator it) mutable -> void {
-                        bool f = pika::util::detail::invoke(pred,
-                            pika::util::detail::invoke(proj, get<0>(*it)));
-
-                        if ((get<1>(*it) = f))
-                            ++true_count;
+                          std::size_t part_size) mutable
+                -> output_iterator_offset {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 it = get<0>(iters);
+                std::size_t const true_count =
+                    flags.set(*get<1>(iters), part_size, [&]() {
+                        bool f = pika::util::detail::invoke(
+                            pred, pika::util::detail::invoke(proj, *it));
+                        ++it;
+                        return f;
                     });
 
                 return output_iterator_offset(
@@ -1499,20 +2430,21 @@ namespace pika::parallel::detail {
             auto f3 = [dest_true, dest_false, flags](zip_iterator part_begin,
                           std::size_t part_size,
                           output_iterator_offset val) mutable -> void {
-                PIKA_UNUSED(flags);
                 output_iterator_offset offset = val;
                 std::size_t count_true = get<0>(offset);
                 std::size_t count_false = get<1>(offset);
                 std::advance(dest_true, count_true);
                 std::advance(dest_false, count_false);
 
-                loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                    [&dest_true, &dest_false](zip_iterator it) mutable {
-                        if (get<1>(*it))
-                            *dest_true++ = get<0>(*it);
-                        else
-                            *dest_false++ = get<0>(*it);
-                    });
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 it = get<0>(iters);
+                flags.get(*get<1>(iters), part_size, [&](bool f) {
+                    if (f)
+                        *dest_true++ = *it;
+                    else
+                        *dest_false++ = *it;
+                    ++it;
+                });
             };
 
             auto f4 = [last_iter, dest_true, dest_false, flags](
@@ -1531,7 +2463,9 @@ namespace pika::parallel::detail {
             };
 
             return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
-                make_zip_iterator(first, flags.get()), count, init,
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count, init,
                 // step 1 performs first part of scan algorithm
                 PIKA_MOVE(f1),
                 // step 2 propagates the partition results from left
@@ -1601,6 +2535,67 @@ namespace pika {
                 .call2(PIKA_FORWARD(ExPolicy, policy), is_seq(), first, last,
                     PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
+
+        // clang-format off
+        template <typename BidirIter, typename F, typename RandIter,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<BidirIter> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                parallel::detail::is_projected_v<Proj, BidirIter> &&
+                parallel::detail::is_indirect_callable_v<
+                    pika::execution::sequenced_policy, F,
+                    parallel::detail::projected<Proj, BidirIter>>
+            )>
+        // clang-format on
+        friend BidirIter tag_fallback_invoke(pika::stable_partition_t,
+            BidirIter first, BidirIter last, F&& f, RandIter buffer,
+            Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_bidirectional_iterator_v<BidirIter>,
+                "Requires at least bidirectional iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator for the buffer.");
+
+            return pika::parallel::detail::stable_partition_buffer_algo<
+                BidirIter>()
+                .call(pika::execution::seq, first, last, buffer,
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename BidirIter, typename F,
+            typename RandIter,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<BidirIter> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                parallel::detail::is_projected_v<Proj, BidirIter> &&
+                parallel::detail::is_indirect_callable_v<ExPolicy, F,
+                    parallel::detail::projected<Proj, BidirIter>>
+            )>
+        // clang-format on
+        friend
+            typename parallel::detail::algorithm_result_t<ExPolicy, BidirIter>
+            tag_fallback_invoke(pika::stable_partition_t, ExPolicy&& policy,
+                BidirIter first, BidirIter last, F&& f, RandIter buffer,
+                Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_bidirectional_iterator_v<BidirIter>,
+                "Requires at least bidirectional iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires a random access iterator for the buffer.");
+
+            using is_seq = std::integral_constant<bool,
+                pika::is_sequenced_execution_policy_v<ExPolicy> ||
+                    !pika::traits::is_random_access_iterator_v<BidirIter>>;
+
+            return pika::parallel::detail::stable_partition_buffer_algo<
+                BidirIter>()
+                .call2(PIKA_FORWARD(ExPolicy, policy), is_seq(), first, last,
+                    buffer, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+        }
     } stable_partition{};
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1654,6 +2649,131 @@ namespace pika {
         }
     } partition{};
 
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::partition3
+    inline constexpr struct partition3_t final
+      : pika::detail::tag_parallel_algorithm<partition3_t>
+    {
+        // clang-format off
+        template <typename FwdIter, typename PredLess, typename PredEqual,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter> &&
+                parallel::detail::is_projected_v<Proj, FwdIter> &&
+                parallel::detail::is_indirect_callable_v<
+                    pika::execution::sequenced_policy,
+                    PredLess, parallel::detail::projected<Proj, FwdIter>> &&
+                parallel::detail::is_indirect_callable_v<
+                    pika::execution::sequenced_policy,
+                    PredEqual, parallel::detail::projected<Proj, FwdIter>>
+        )>
+        // clang-format on
+        friend std::pair<FwdIter, FwdIter> tag_fallback_invoke(
+            pika::partition3_t, FwdIter first, FwdIter last, PredLess&& less,
+            PredEqual&& equal, Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::partition3<FwdIter>().call(
+                pika::execution::seq, first, last,
+                PIKA_FORWARD(PredLess, less), PIKA_FORWARD(PredEqual, equal),
+                PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename PredLess,
+            typename PredEqual,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter> &&
+                parallel::detail::is_projected_v<Proj, FwdIter> &&
+                parallel::detail::is_indirect_callable_v<ExPolicy,
+                    PredLess, parallel::detail::projected<Proj, FwdIter>> &&
+                parallel::detail::is_indirect_callable_v<ExPolicy,
+                    PredEqual, parallel::detail::projected<Proj, FwdIter>>
+        )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result_t<ExPolicy,
+            std::pair<FwdIter, FwdIter>>
+        tag_fallback_invoke(pika::partition3_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, PredLess&& less, PredEqual&& equal,
+            Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Required at least forward iterator.");
+
+            return pika::parallel::detail::partition3<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                PIKA_FORWARD(PredLess, less), PIKA_FORWARD(PredEqual, equal),
+                PIKA_FORWARD(Proj, proj));
+        }
+    } partition3{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::partition_k
+    inline constexpr struct partition_k_t final
+      : pika::detail::tag_parallel_algorithm<partition_k_t>
+    {
+        // clang-format off
+        template <typename RandomIt, typename Classifier, typename OutIter,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandomIt> &&
+                pika::traits::is_iterator_v<OutIter> &&
+                parallel::detail::is_projected_v<Proj, RandomIt> &&
+                parallel::detail::is_indirect_callable_v<
+                    pika::execution::sequenced_policy,
+                    Classifier, parallel::detail::projected<Proj, RandomIt>>
+        )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(pika::partition_k_t, RandomIt first,
+            RandomIt last, std::size_t k, Classifier&& classifier,
+            OutIter bucket_offsets, Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator_v<OutIter>,
+                "Required at least output iterator.");
+
+            return pika::parallel::detail::partition_k<OutIter>().call(
+                pika::execution::seq, first, last, k,
+                PIKA_FORWARD(Classifier, classifier), bucket_offsets,
+                PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt, typename Classifier,
+            typename OutIter,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandomIt> &&
+                pika::traits::is_iterator_v<OutIter> &&
+                parallel::detail::is_projected_v<Proj, RandomIt> &&
+                parallel::detail::is_indirect_callable_v<ExPolicy,
+                    Classifier, parallel::detail::projected<Proj, RandomIt>>
+        )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result_t<ExPolicy, OutIter>
+        tag_fallback_invoke(pika::partition_k_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last, std::size_t k,
+            Classifier&& classifier, OutIter bucket_offsets,
+            Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator_v<OutIter>,
+                "Required at least output iterator.");
+
+            return pika::parallel::detail::partition_k<OutIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, k,
+                PIKA_FORWARD(Classifier, classifier), bucket_offsets,
+                PIKA_FORWARD(Proj, proj));
+        }
+    } partition_k{};
+
     ///////////////////////////////////////////////////////////////////////////
     // CPO for pika::partition_copy
     inline constexpr struct partition_copy_t final
@@ -26,7 +26,7 @@ namespace pika {
     /// \tparam FwdIter     The type of the source begin and end iterators used
     ///                     (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     /// \tparam F           The type of the function/function object to use
     ///                     (deduced). Unlike its sequential form, the parallel
     ///                     overload of \a copy_if requires \a F to meet the
@@ -85,6 +85,15 @@ namespace pika {
     /// that the behavior of reduce may be non-deterministic for
     /// non-associative or non-commutative binary predicate.
     ///
+    /// Floating point sums (\a f being \a std::plus) can be computed with
+    /// a compensated, pairwise or reproducible summation by passing the
+    /// executor parameters \a pika::execution::summation to the policy.
+    ///
+    /// Single pass ranges (input iterators) are read by the calling thread
+    /// in batches of elements which are reduced by the workers while the
+    /// next batches are read. The size of the batches is the chunk size of
+    /// the executor parameters if they specify one.
+    ///
     template <typename ExPolicy, typename FwdIter, typename T, typename F>
     typename pika::parallel::detail::algorithm_result<ExPolicy, T>::type
     reduce(ExPolicy&& policy, FwdIter first, FwdIter last, T init, F&& f);
@@ -101,7 +110,7 @@ namespace pika {
     /// \tparam FwdIter     The type of the source begin and end iterators used
     ///                     (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     /// \tparam T           The type of the value to be used as initial (and
     ///                     intermediate) values (deduced).
     ///
@@ -159,7 +168,7 @@ namespace pika {
     /// \tparam FwdIter     The type of the source begin and end iterators used
     ///                     (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     ///
     /// \param policy       The execution policy to use for the scheduling of
     ///                     the iterations.
@@ -216,20 +225,27 @@ namespace pika {
 #include <pika/config.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/iterator_support/range.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/iterator_support/traits/is_sentinel_for.hpp>
-#include <pika/pack_traversal/unwrap.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/accumulate.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/widening_reduce.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/batch_partitioner.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/detail/summation.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <numeric>
 #include <type_traits>
@@ -250,9 +266,39 @@ namespace pika::parallel::detail {
 
         template <typename ExPolicy, typename InIterB, typename InIterE,
             typename T_, typename Reduce>
-        static T
-        sequential(ExPolicy, InIterB first, InIterE last, T_&& init, Reduce&& r)
+        static T sequential(ExPolicy policy, InIterB first, InIterE last,
+            T_&& init, Reduce&& r)
         {
+            if constexpr (is_floating_point_sum_v<T, Reduce>)
+            {
+                auto const mode = select_summation(policy.parameters());
+                if (mode != pika::execution::summation_mode::standard)
+                {
+                    return sequential_summation<T>(mode, first, last,
+                        PIKA_FORWARD(T_, init),
+                        [](InIterB const& it) -> decltype(auto) {
+                            return *it;
+                        });
+                }
+            }
+            else
+            {
+                PIKA_UNUSED(policy);
+            }
+
+            // the elements are widened to T, or split into their real and
+            // imaginary parts, in vector registers
+            if constexpr (pika::is_vectorpack_execution_policy<
+                              ExPolicy>::value &&
+                (is_widening_reduction_v<InIterB, T, Reduce> ||
+                    is_complex_reduction_v<InIterB, T, Reduce>))
+            {
+                projection_identity conv;
+                return widening_reduce_n<ExPolicy>(first,
+                    detail::distance(first, last), T(PIKA_FORWARD(T_, init)),
+                    r, conv);
+            }
+
             return detail::accumulate(
                 first, last, PIKA_FORWARD(T_, init), PIKA_FORWARD(Reduce, r));
         }
@@ -269,21 +315,93 @@ namespace pika::parallel::detail {
                     PIKA_FORWARD(T_, init));
             }
 
-            auto f1 = [r](FwdIterB part_begin, std::size_t part_size) -> T {
+            if constexpr (!pika::traits::is_forward_iterator_v<FwdIterB>)
+            {
+                return parallel_batched(PIKA_FORWARD(ExPolicy, policy), first,
+                    last, PIKA_FORWARD(T_, init), PIKA_FORWARD(Reduce, r));
+            }
+            else
+            {
+                if constexpr (is_floating_point_sum_v<T, Reduce>)
+                {
+                    if (select_summation(policy.parameters()) !=
+                        pika::execution::summation_mode::standard)
+                    {
+                        return parallel_summation<T>(
+                            PIKA_FORWARD(ExPolicy, policy), first,
+                            detail::distance(first, last),
+                            PIKA_FORWARD(T_, init),
+                            [](FwdIterB const& it) -> decltype(auto) {
+                                return *it;
+                            });
+                    }
+                }
+
+                auto f1 = [r](FwdIterB part_begin,
+                              std::size_t part_size) -> T {
+                    T val = *part_begin;
+                    if constexpr (pika::is_vectorpack_execution_policy<
+                                      std::decay_t<ExPolicy>>::value &&
+                        (is_widening_reduction_v<FwdIterB, T, Reduce> ||
+                            is_complex_reduction_v<FwdIterB, T, Reduce>))
+                    {
+                        projection_identity conv;
+                        return widening_reduce_n<std::decay_t<ExPolicy>>(
+                            ++part_begin, --part_size, PIKA_MOVE(val), r,
+                            conv);
+                    }
+                    else
+                    {
+                        return accumulate_n(
+                            ++part_begin, --part_size, PIKA_MOVE(val), r);
+                    }
+                };
+
+                return partitioner<ExPolicy, T>::call(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), PIKA_MOVE(f1),
+                    make_chunk_values_reducer(
+                        [init = PIKA_FORWARD(T_, init), r](
+                            std::vector<T>&& results) -> T {
+                            return accumulate_n(pika::util::begin(results),
+                                pika::util::size(results), init, r);
+                        },
+                        PIKA_FORWARD(Reduce, r)));
+            }
+        }
+
+        // single pass ranges are reduced in batches of elements which are
+        // read ahead, see batch_partitioner
+        template <typename ExPolicy, typename InIterB, typename InIterE,
+            typename T_, typename Reduce>
+        static typename algorithm_result<ExPolicy, T>::type parallel_batched(
+            ExPolicy&& policy, InIterB first, InIterE last, T_&& init,
+            Reduce&& r)
+        {
+            if constexpr (is_floating_point_sum_v<T, Reduce>)
+            {
+                // the summation modes are applied to the whole sequence
+                if (select_summation(policy.parameters()) !=
+                    pika::execution::summation_mode::standard)
+                {
+                    return algorithm_result<ExPolicy, T>::get(sequential(
+                        policy, first, last, PIKA_FORWARD(T_, init), r));
+                }
+            }
+
+            auto f1 = [r](auto part_begin, std::size_t part_size) -> T {
                 T val = *part_begin;
                 return accumulate_n(
                     ++part_begin, --part_size, PIKA_MOVE(val), r);
             };
 
-            return partitioner<ExPolicy, T>::call(
-                PIKA_FORWARD(ExPolicy, policy), first,
-                detail::distance(first, last), PIKA_MOVE(f1),
-                pika::unwrapping([init = PIKA_FORWARD(T_, init),
-                                     r = PIKA_FORWARD(Reduce, r)](
-                                     std::vector<T>&& results) -> T {
+            return batch_partitioner<std::decay_t<ExPolicy>, T>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(f1),
+                [init = PIKA_FORWARD(T_, init), r](
+                    InIterB, std::vector<T>&& results) -> T {
                     return accumulate_n(pika::util::begin(results),
                         pika::util::size(results), init, r);
-                }));
+                });
         }
     };
     /// \endcond
@@ -309,8 +427,8 @@ namespace pika {
             tag_fallback_invoke(pika::reduce_t, ExPolicy&& policy,
                 FwdIter first, FwdIter last, T init, F&& f)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             return pika::parallel::detail::reduce<T>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
@@ -330,8 +448,8 @@ namespace pika {
             tag_fallback_invoke(pika::reduce_t, ExPolicy&& policy,
                 FwdIter first, FwdIter last, T init)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             return pika::parallel::detail::reduce<T>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
@@ -350,8 +468,8 @@ namespace pika {
         tag_fallback_invoke(
             pika::reduce_t, ExPolicy&& policy, FwdIter first, FwdIter last)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             using value_type =
                 typename std::iterator_traits<FwdIter>::value_type;
@@ -419,4 +537,109 @@ namespace pika {
     } reduce{};
 }    // namespace pika
 
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // reduce of a random access range sent by a predecessor sender runs as a
+    // bulk operation, see partition_sender. Summation modes other than the
+    // standard one are handled by the future based implementation.
+    template <typename ExPolicy, typename FwdIter, typename T,
+        typename Reduce>
+    inline constexpr bool use_reduce_sender_v =
+        use_partition_sender_v<ExPolicy> &&
+        pika::traits::is_random_access_iterator_v<FwdIter> &&
+        std::is_default_constructible_v<T> &&
+        !(is_floating_point_sum_v<T, Reduce> &&
+            std::is_same_v<typename ExPolicy::executor_parameters_type,
+                pika::execution::summation>);
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_reduce_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename T,
+        typename Reduce>
+    struct is_reduce_sender_available<ExPolicy, FwdIter, FwdIter, T, Reduce>
+      : std::bool_constant<use_reduce_sender_v<ExPolicy, FwdIter, T, Reduce>>
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter, typename T>
+    struct is_reduce_sender_available<ExPolicy, FwdIter, FwdIter, T>
+      : is_reduce_sender_available<ExPolicy, FwdIter, FwdIter, T,
+            std::plus<T>>
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter>
+    struct is_reduce_sender_available<ExPolicy, FwdIter, FwdIter>
+      : is_reduce_sender_available<ExPolicy, FwdIter, FwdIter,
+            typename std::iterator_traits<FwdIter>::value_type>
+    {
+    };
+
+    template <typename T, typename ExPolicy, typename FwdIter,
+        typename Reduce>
+    auto reduce_sender(
+        ExPolicy&& policy, FwdIter first, FwdIter last, T init, Reduce r)
+    {
+        auto f1 = [first, r](std::size_t begin, std::size_t size) -> T {
+            FwdIter it = std::next(first, begin);
+            T val = *it;
+            return accumulate_n(++it, --size, PIKA_MOVE(val), r);
+        };
+
+        return partition_sender<T>(PIKA_FORWARD(ExPolicy, policy),
+            detail::distance(first, last), PIKA_MOVE(f1),
+            [init = PIKA_MOVE(init), r = PIKA_MOVE(r)](
+                std::vector<T>&& results) -> T {
+                return accumulate_n(pika::util::begin(results),
+                    pika::util::size(results), init, r);
+            });
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct algorithm_sender<pika::reduce_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_reduce_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter, typename T,
+            typename Reduce>
+        static auto call(ExPolicy&& policy, FwdIter first, FwdIter last,
+            T init, Reduce r)
+        {
+            return pika::parallel::detail::reduce_sender<T>(
+                PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
+                PIKA_MOVE(r));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename T>
+        static auto call(ExPolicy&& policy, FwdIter first, FwdIter last, T init)
+        {
+            return pika::parallel::detail::reduce_sender<T>(
+                PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
+                std::plus<T>{});
+        }
+
+        template <typename ExPolicy, typename FwdIter>
+        static auto call(ExPolicy&& policy, FwdIter first, FwdIter last)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            return pika::parallel::detail::reduce_sender<value_type>(
+                PIKA_FORWARD(ExPolicy, policy), first, last, value_type{},
+                std::plus<value_type>{});
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #endif    // DOXYGEN
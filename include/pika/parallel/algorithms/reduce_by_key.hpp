@@ -9,19 +9,26 @@
 #pragma once
 //
 #include <pika/config.hpp>
+#include <pika/assert.hpp>
 #include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
 //
 #include <pika/iterator_support/range.hpp>
 #include <pika/iterator_support/transform_iterator.hpp>
+#include <pika/parallel/algorithms/detail/hash_mix.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
-#include <pika/parallel/algorithms/inclusive_scan.hpp>
 #include <pika/parallel/algorithms/sort.hpp>
-#include <pika/parallel/container_algorithms/copy.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 //
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <numeric>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -162,60 +169,17 @@ namespace pika {
         };
 
         // -------------------------------------------------------------------
-        // helper that extracts the final output iterators from copy_if
+        // Determines for each key whether it starts and/or ends a series of
+        // equal consecutive keys, comp(a, b) yields true if the keys a and b
+        // belong to the same series.
         // -------------------------------------------------------------------
-        // Zip iterator has 3 iterators inside
-        // Iter1, key type : Iter2, value type : Iter3, state type
-        template <typename ZIter, typename iKey, typename iVal>
-        parallel::detail::in_out_result<iKey, iVal>
-        make_pair_result(ZIter zipiter, iKey key_start, iVal val_start)
+        template <typename ExPolicy, typename RanIter, typename Compare>
+        void compute_key_series_states(ExPolicy&& policy, RanIter key_first,
+            RanIter key_last, std::vector<reduce_key_series_states>& key_state,
+            Compare& comp)
         {
-            // the iterator we want is 'second' part of pair type (from copy_if)
-            auto t = zipiter.out.get_iterator_tuple();
-            iKey key_end = std::get<0>(t);
-            return parallel::detail::in_out_result<iKey, iVal>{key_end,
-                std::next(val_start, std::distance(key_start, key_end))};
-        }
-
-        // async version that returns future<pair> from future<zip_iterator<blah>>
-        template <typename ZIter, typename iKey, typename iVal>
-        pika::future<parallel::detail::in_out_result<iKey, iVal>>
-        make_pair_result(
-            pika::future<ZIter>&& ziter, iKey key_start, iVal val_start)
-        {
-            using result_type = parallel::detail::in_out_result<iKey, iVal>;
-
-            return pika::make_future<result_type>(
-                PIKA_MOVE(ziter), [=](ZIter zipiter) {
-                    auto t = zipiter.second.get_iterator_tuple();
-                    iKey key_end = std::get<0>(t);
-                    return result_type{key_end,
-                        std::next(
-                            val_start, std::distance(key_start, key_end))};
-                });
-        }
-
-        // -------------------------------------------------------------------
-        // The main algorithm is implemented here, it replaces any async
-        // execution policy with a non async one so that no waits are
-        // necessry on the internal algorithms. Async execution is handled
-        // by the wrapper layer that calls this.
-        // -------------------------------------------------------------------
-        template <typename ExPolicy, typename RanIter, typename RanIter2,
-            typename FwdIter1, typename FwdIter2, typename Compare,
-            typename Func>
-        static parallel::detail::in_out_result<FwdIter1, FwdIter2>
-        reduce_by_key_impl(ExPolicy&& policy, RanIter key_first,
-            RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
-            FwdIter2 values_output, Compare&& comp, Func&& func)
-        {
-            using namespace pika::parallel::detail;
             using namespace pika::util;
 
-            // we need to determine based on the keys what is the keystate for
-            // each key. The states are start, middle, end of a series and the special
-            // state start and end of the sequence
-            std::vector<reduce_key_series_states> key_state;
             using keystate_iter_type =
                 std::vector<reduce_key_series_states>::iterator;
             using reducebykey_iter =
@@ -229,134 +193,241 @@ namespace pika {
                 std::distance(key_first, key_last);
             //
             key_state.assign(number_of_keys, reduce_key_series_states());
+
+            if (number_of_keys == 0)
             {
-                reduce_stencil_transformer r_s_t;
-                reducebykey_iter reduce_begin =
-                    make_reduce_stencil_iterator(key_first, r_s_t);
-                reducebykey_iter reduce_end =
-                    make_reduce_stencil_iterator(key_last, r_s_t);
+                return;
+            }
+            if (number_of_keys == 1)
+            {
+                key_state[0] = reduce_key_series_states(true, true);
+                return;
+            }
+
+            reduce_stencil_transformer r_s_t;
+            reducebykey_iter reduce_begin =
+                make_reduce_stencil_iterator(key_first, r_s_t);
+            reducebykey_iter reduce_end =
+                make_reduce_stencil_iterator(key_last, r_s_t);
+
+            if (number_of_keys == 2)
+            {
+                // for two entries, one is a start, the other an end,
+                // if they are different, then they are both start/end
+                element_type left = *key_first;
+                element_type right = *std::next(key_first);
+                key_state[0] =
+                    reduce_key_series_states(true, !comp(left, right));
+                key_state[1] =
+                    reduce_key_series_states(!comp(left, right), true);
+            }
+            else
+            {
+                // do the first and last elements by hand to simplify the
+                // iterator traversal as there is no prev/next for first/last
+                element_type elem0 = *key_first;
+                element_type elem1 = *std::next(key_first);
+                key_state[0] =
+                    reduce_key_series_states(true, !comp(elem0, elem1));
+                // middle elements
+                reduce_stencil_generate<reduce_stencil_transformer, RanIter,
+                    keystate_iter_type, Compare>
+                    kernel;
+                pika::for_each(policy(pika::execution::non_task),
+                    make_zip_iterator(reduce_begin + 1, key_state.begin() + 1),
+                    make_zip_iterator(reduce_end - 1, key_state.end() - 1),
+                    [&kernel, &comp](zip_ref ref) {
+                        kernel(std::get<0>(ref), std::get<1>(ref), comp);
+                    });
+                // Last element
+                element_type elemN = *std::prev(key_last);
+                element_type elemn = *std::prev(std::prev(key_last));
+                key_state.back() =
+                    reduce_key_series_states(!comp(elemn, elemN), true);
+            }
+        }
 
-                // FIXME: handle cases number_of_keys == 0 and
-                //        number_of_keys == 1
+        // the minimal number of keys reduced by one task
+        static const std::size_t reduce_by_key_min_chunk_size = 4096ul;
 
-                if (number_of_keys == 2)
+        // -------------------------------------------------------------------
+        // The main algorithm is implemented here, async execution is handled
+        // by the wrapper layer that calls this. The keys are split into
+        // chunks which are processed in two passes:
+        //  1. count the runs of equal keys starting in each chunk, the
+        //     exclusive scan of the counts gives the output position of the
+        //     first run of each chunk
+        //  2. reduce the runs starting in each chunk as far as they extend
+        //     into the chunk and write them to the output, the values before
+        //     the first run of a chunk continue the last run of a chunk to
+        //     the left and are combined with it afterwards
+        // -------------------------------------------------------------------
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Compare,
+            typename Func>
+        static parallel::detail::in_out_result<FwdIter1, FwdIter2>
+        reduce_by_key_impl(ExPolicy&& policy, RanIter key_first,
+            RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Compare&& comp, Func&& func)
+        {
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+
+            std::size_t const number_of_keys =
+                std::distance(key_first, key_last);
+
+            std::size_t num_chunks = 1;
+            if constexpr (!pika::is_sequenced_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                std::size_t const cores =
+                    parallel::execution::processing_units_count(
+                        policy.parameters(), policy.executor());
+                num_chunks = (std::min)(4 * cores,
+                    (number_of_keys + reduce_by_key_min_chunk_size - 1) /
+                        reduce_by_key_min_chunk_size);
+                num_chunks = (std::max)(num_chunks, std::size_t(1));
+            }
+
+            auto chunk_begin = [&](std::size_t chunk) {
+                return chunk * number_of_keys / num_chunks;
+            };
+
+            // the key at position i starts a new run of equal keys
+            auto starts_run = [&](std::size_t i) -> bool {
+                return i == 0 ||
+                    !PIKA_INVOKE(comp, key_first[i - 1], key_first[i]);
+            };
+
+            // the offsets, the output locations and the leading values of
+            // the chunks are not allocated if they would exceed the scratch
+            // memory budget, the keys are reduced in a single chunk then
+            pika::parallel::util::detail::scratch_memory_reservation
+                reservation;
+            if (num_chunks != 1)
+            {
+                reservation =
+                    pika::parallel::util::detail::scratch_memory_reservation(
+                        policy.parameters(),
+                        num_chunks *
+                            (2 * sizeof(std::size_t) + sizeof(value_type) +
+                                sizeof(FwdIter1) + sizeof(FwdIter2)));
+                if (!reservation)
                 {
-                    // for two entries, one is a start, the other an end,
-                    // if they are different, then they are both start/end
-                    element_type left = *key_first;
-                    element_type right = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, !comp(left, right));
-                    key_state[1] =
-                        reduce_key_series_states(!comp(left, right), true);
+                    num_chunks = 1;
                 }
-                else
+            }
+
+            // a single chunk is reduced in one pass, without allocating the
+            // offsets and the leading values, see no_allocation
+            if (num_chunks == 1)
+            {
+                std::size_t i = 0;
+                while (i != number_of_keys)
                 {
-                    // do the first and last elements by hand to simplify the iterator
-                    // traversal as there is no prev/next for first/last
-                    element_type elem0 = *key_first;
-                    element_type elem1 = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, elem0 != elem1);
-                    // middle elements
-                    reduce_stencil_generate<reduce_stencil_transformer, RanIter,
-                        keystate_iter_type, Compare>
-                        kernel;
-                    pika::for_each(policy(pika::execution::non_task),
-                        make_zip_iterator(
-                            reduce_begin + 1, key_state.begin() + 1),
-                        make_zip_iterator(reduce_end - 1, key_state.end() - 1),
-                        [&kernel, &comp](zip_ref ref) {
-                            kernel(std::get<0>(ref), std::get<1>(ref), comp);
-                        });
-                    // Last element
-                    element_type elemN = *std::prev(key_last);
-                    element_type elemn = *std::prev(std::prev(key_last));
-                    key_state.back() =
-                        reduce_key_series_states(elemN != elemn, true);
+                    *keys_output = key_first[i];
+                    value_type acc = values_first[i];
+                    while (++i != number_of_keys && !starts_run(i))
+                    {
+                        acc = PIKA_INVOKE(func, acc, values_first[i]);
+                    }
+                    *values_output = PIKA_MOVE(acc);
+                    ++keys_output;
+                    ++values_output;
                 }
+                return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                    keys_output, values_output};
             }
+
+            // step 1, offsets[chunk] is the number of runs starting before
+            // the chunk
+            std::vector<std::size_t> offsets(num_chunks + 1, 0);
+            auto count_runs = [&](std::size_t chunk) {
+                std::size_t const end = chunk_begin(chunk + 1);
+                std::size_t runs = 0;
+                for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+                {
+                    if (starts_run(i))
+                    {
+                        ++runs;
+                    }
+                }
+                offsets[chunk + 1] = runs;
+            };
+            parallel::detail::run_chunks(policy, num_chunks, count_runs);
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            // the output locations of the first run of each chunk
+            std::vector<FwdIter1> keys_dest;
+            std::vector<FwdIter2> values_dest;
+            keys_dest.reserve(num_chunks + 1);
+            values_dest.reserve(num_chunks + 1);
+            keys_dest.push_back(keys_output);
+            values_dest.push_back(values_output);
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t const runs = offsets[chunk + 1] - offsets[chunk];
+                keys_dest.push_back(std::next(keys_dest.back(), runs));
+                values_dest.push_back(std::next(values_dest.back(), runs));
+            }
+
+            // step 2, leading[chunk] holds the reduction of the values before
+            // the first run starting in the chunk, first_run[chunk] is the
+            // position of that run
+            std::vector<value_type> leading(num_chunks);
+            std::vector<std::size_t> first_run(num_chunks);
+            auto reduce_runs = [&](std::size_t chunk) {
+                std::size_t i = chunk_begin(chunk);
+                std::size_t const end = chunk_begin(chunk + 1);
+                PIKA_ASSERT(i != end);
+
+                if (!starts_run(i))
+                {
+                    value_type acc = values_first[i];
+                    while (++i != end && !starts_run(i))
+                    {
+                        acc = PIKA_INVOKE(func, acc, values_first[i]);
+                    }
+                    leading[chunk] = PIKA_MOVE(acc);
+                }
+                first_run[chunk] = i;
+
+                FwdIter1 keys_dst = keys_dest[chunk];
+                FwdIter2 values_dst = values_dest[chunk];
+                while (i != end)
+                {
+                    *keys_dst = key_first[i];
+                    value_type acc = values_first[i];
+                    while (++i != end && !starts_run(i))
+                    {
+                        acc = PIKA_INVOKE(func, acc, values_first[i]);
+                    }
+                    *values_dst = PIKA_MOVE(acc);
+                    ++keys_dst;
+                    ++values_dst;
+                }
+            };
+            parallel::detail::run_chunks(policy, num_chunks, reduce_runs);
+
+            // combine the leading values of each chunk with the run to their
+            // left, from left to right
+            FwdIter2 last_run = values_output;
+            std::size_t last_run_pos = 0;
+            for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
             {
-                using zip_iterator_in = zip_iterator<RanIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
-                using zip_type_in = typename zip_iterator_in::value_type;
-
-                using zip_iterator_vout = zip_iterator<FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
-
-                using value_type =
-                    typename std::iterator_traits<RanIter2>::value_type;
-
-                zip_iterator_in states_begin = make_zip_iterator(
-                    values_first, pika::util::begin(key_state));
-                zip_iterator_in states_end = make_zip_iterator(
-                    values_first + number_of_keys, pika::util::end(key_state));
-                zip_iterator_vout states_out_begin = make_zip_iterator(
-                    values_output, pika::util::begin(key_state));
-                //
-
-                zip_type_in initial;
-                //
-                using lambda_type =
-                    std::tuple<value_type, reduce_key_series_states>;
-                pika::inclusive_scan(
-                    policy(pika::execution::non_task), states_begin, states_end,
-                    states_out_begin,
-                    // B is the current entry, A is the one passed in from 'previous'
-                    [&func](zip_type_in a, zip_type_in b) -> lambda_type {
-                        value_type a_val = std::get<0>(a);
-                        reduce_key_series_states a_state = std::get<1>(a);
-                        value_type b_val = std::get<0>(b);
-                        reduce_key_series_states b_state = std::get<1>(b);
-                        debug_reduce_by_key("{ " << a_val << "+" << b_val
-                                                 << " },\t" << a_state
-                                                 << b_state);
-                        // if carrying a start flag, then copy - don't add
-                        if (b_state.start)
-                        {
-                            debug_reduce_by_key(" = " << b_val << std::endl);
-                            return std::make_tuple(b_val,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
-                        // normal add of previous + this
-                        else
-                        {
-                            debug_reduce_by_key(
-                                " = " << func(a_val, b_val) << std::endl);
-                            value_type temp = func(a_val, b_val);
-                            return std::make_tuple(temp,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
-                    },
-                    initial);
-
-                // now copy the values and keys for each element that
-                // is marked by an 'END' state to the final output
-                using zip2_ref = typename pika::util::zip_iterator<RanIter,
-                    FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>::reference;
-
-                std::vector<value_type> temp(number_of_keys);
-                pika::copy(policy(pika::execution::non_task), values_output,
-                    values_output + number_of_keys, temp.begin());
-
-                return make_pair_result(
-                    pika::ranges::copy_if(policy(pika::execution::non_task),
-                        make_zip_iterator(key_first, temp.begin(),
-                            pika::util::begin(key_state)),
-                        make_zip_iterator(key_last,
-                            temp.begin() + number_of_keys,
-                            pika::util::end(key_state)),
-                        make_zip_iterator(keys_output, values_output,
-                            pika::util::begin(key_state)),
-                        // copies to dest only when 'end' state is true
-                        [](zip2_ref it) { return std::get<2>(it).end; }),
-                    keys_output, values_output);
+                if (first_run[chunk] == chunk_begin(chunk))
+                {
+                    continue;
+                }
+
+                PIKA_ASSERT(offsets[chunk] != 0);
+                std::advance(last_run, offsets[chunk] - 1 - last_run_pos);
+                last_run_pos = offsets[chunk] - 1;
+                *last_run = PIKA_INVOKE(func, *last_run, leading[chunk]);
             }
+
+            return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                keys_dest.back(), values_dest.back()};
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -372,6 +443,8 @@ namespace pika {
             {
             }
 
+            static constexpr bool allocation_free = true;
+
             template <typename ExPolicy, typename RanIter, typename RanIter2,
                 typename Compare, typename Func>
             static parallel::detail::in_out_result<FwdIter1, FwdIter2>
@@ -405,6 +478,307 @@ namespace pika {
                             PIKA_FORWARD(Func, func))));
             }
         };
+
+        // -------------------------------------------------------------------
+        // Open addressing hash table combining the values of equal keys. The
+        // entries are kept in the order their keys were first inserted, the
+        // slots hold the index of an entry plus one (zero marks an empty
+        // slot), collisions are resolved by linear probing.
+        // -------------------------------------------------------------------
+        template <typename Key, typename Value>
+        class hash_reduce_table
+        {
+        public:
+            struct entry
+            {
+                std::uint64_t hash;
+                Key key;
+                Value value;
+            };
+
+            // inserts the key, or combines the value with the one of an equal
+            // key as func(old_value, value)
+            template <typename K, typename V, typename KeyEqual,
+                typename Func>
+            void insert(std::uint64_t hash, K&& key, V&& value,
+                KeyEqual& equal, Func& func)
+            {
+                if (2 * (entries_.size() + 1) > slots_.size())
+                {
+                    grow();
+                }
+
+                std::size_t const mask = slots_.size() - 1;
+                for (std::size_t slot = std::size_t(hash) & mask;;
+                     slot = (slot + 1) & mask)
+                {
+                    std::size_t const index = slots_[slot];
+                    if (index == 0)
+                    {
+                        entries_.push_back(entry{hash,
+                            Key(PIKA_FORWARD(K, key)),
+                            Value(PIKA_FORWARD(V, value))});
+                        slots_[slot] = entries_.size();
+                        return;
+                    }
+
+                    entry& e = entries_[index - 1];
+                    if (e.hash == hash && PIKA_INVOKE(equal, e.key, key))
+                    {
+                        e.value =
+                            PIKA_INVOKE(func, e.value, PIKA_FORWARD(V, value));
+                        return;
+                    }
+                }
+            }
+
+            std::vector<entry>& entries() noexcept
+            {
+                return entries_;
+            }
+
+        private:
+            void grow()
+            {
+                std::vector<std::size_t> slots(
+                    (std::max)(std::size_t(16), 2 * slots_.size()), 0);
+                std::size_t const mask = slots.size() - 1;
+                for (std::size_t i = 0; i != entries_.size(); ++i)
+                {
+                    std::size_t slot = std::size_t(entries_[i].hash) & mask;
+                    while (slots[slot] != 0)
+                    {
+                        slot = (slot + 1) & mask;
+                    }
+                    slots[slot] = i + 1;
+                }
+                slots_ = PIKA_MOVE(slots);
+            }
+
+            std::vector<entry> entries_;
+            std::vector<std::size_t> slots_;
+        };
+
+        // the minimal number of keys aggregated by one task
+        static const std::size_t hash_reduce_by_key_min_chunk_size = 16384ul;
+
+        // the largest number of partitions the keys are merged in
+        static const std::size_t hash_reduce_by_key_max_partitions = 256ul;
+
+        // -------------------------------------------------------------------
+        // Aggregates the values of equal keys without sorting them. A single
+        // chunk inserts all keys into one table. Otherwise the keys are split
+        // into chunks which are processed in three passes:
+        //  1. every chunk aggregates its keys into a table per partition,
+        //     the partition of a key is given by the high bits of its hash
+        //  2. every partition merges the tables of all chunks for it, in the
+        //     order of the chunks
+        //  3. the exclusive scan of the sizes of the partitions gives their
+        //     output positions, all partitions are written in parallel
+        // The values of a key are combined in the order they appear in.
+        // -------------------------------------------------------------------
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Func,
+            typename Hash, typename KeyEqual>
+        static parallel::detail::in_out_result<FwdIter1, FwdIter2>
+        hash_reduce_by_key_impl(ExPolicy&& policy, RanIter key_first,
+            RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Func&& func, Hash&& hash,
+            KeyEqual&& equal)
+        {
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+            using table_type = hash_reduce_table<key_type, value_type>;
+
+            std::size_t const number_of_keys =
+                std::distance(key_first, key_last);
+
+            std::size_t num_chunks = 1;
+            if constexpr (!pika::is_sequenced_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                std::size_t const cores =
+                    parallel::execution::processing_units_count(
+                        policy.parameters(), policy.executor());
+                num_chunks = (std::min)(cores,
+                    (number_of_keys + hash_reduce_by_key_min_chunk_size - 1) /
+                        hash_reduce_by_key_min_chunk_size);
+                num_chunks = (std::max)(num_chunks, std::size_t(1));
+            }
+
+            auto hash_of = [&](std::size_t i) -> std::uint64_t {
+                return parallel::detail::hash_mix(
+                    std::uint64_t(PIKA_INVOKE(hash, key_first[i])));
+            };
+
+            // the tables of the chunks hold up to one entry per key, a key
+            // is stored once per chunk it appears in. A single table is used
+            // if they could exceed the scratch memory budget.
+            pika::parallel::util::detail::scratch_memory_reservation
+                reservation;
+            if (num_chunks != 1)
+            {
+                reservation =
+                    pika::parallel::util::detail::scratch_memory_reservation(
+                        policy.parameters(),
+                        number_of_keys *
+                            (sizeof(typename table_type::entry) +
+                                2 * sizeof(std::size_t)));
+                if (!reservation)
+                {
+                    num_chunks = 1;
+                }
+            }
+
+            // a single table writes the keys in the order of their first
+            // occurrence
+            if (num_chunks == 1)
+            {
+                table_type table;
+                for (std::size_t i = 0; i != number_of_keys; ++i)
+                {
+                    table.insert(hash_of(i), key_first[i], values_first[i],
+                        equal, func);
+                }
+                for (auto& e : table.entries())
+                {
+                    *keys_output = PIKA_MOVE(e.key);
+                    *values_output = PIKA_MOVE(e.value);
+                    ++keys_output;
+                    ++values_output;
+                }
+                return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                    keys_output, values_output};
+            }
+
+            // a power of two of partitions, at least one per chunk
+            unsigned partition_bits = 1;
+            while ((std::size_t(1) << partition_bits) < num_chunks &&
+                (std::size_t(1) << partition_bits) <
+                    hash_reduce_by_key_max_partitions)
+            {
+                ++partition_bits;
+            }
+            std::size_t const num_partitions = std::size_t(1)
+                << partition_bits;
+
+            // step 1, tables[chunk * num_partitions + partition]
+            std::vector<table_type> tables(num_chunks * num_partitions);
+            auto aggregate = [&](std::size_t chunk) {
+                table_type* chunk_tables =
+                    tables.data() + chunk * num_partitions;
+                std::size_t const end =
+                    (chunk + 1) * number_of_keys / num_chunks;
+                for (std::size_t i = chunk * number_of_keys / num_chunks;
+                     i != end; ++i)
+                {
+                    std::uint64_t const h = hash_of(i);
+                    chunk_tables[std::size_t(h >> (64 - partition_bits))]
+                        .insert(h, key_first[i], values_first[i], equal, func);
+                }
+            };
+            parallel::detail::run_chunks(policy, num_chunks, aggregate);
+
+            // step 2, the merged table of each partition replaces the one of
+            // the first chunk
+            auto merge = [&](std::size_t partition) {
+                table_type& merged = tables[partition];
+                for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+                {
+                    table_type& table =
+                        tables[chunk * num_partitions + partition];
+                    for (auto& e : table.entries())
+                    {
+                        merged.insert(e.hash, PIKA_MOVE(e.key),
+                            PIKA_MOVE(e.value), equal, func);
+                    }
+                    table = table_type();
+                }
+            };
+            parallel::detail::run_chunks(policy, num_partitions, merge);
+
+            // step 3, the output locations of each partition
+            std::vector<FwdIter1> keys_dest;
+            std::vector<FwdIter2> values_dest;
+            keys_dest.reserve(num_partitions + 1);
+            values_dest.reserve(num_partitions + 1);
+            keys_dest.push_back(keys_output);
+            values_dest.push_back(values_output);
+            for (std::size_t partition = 0; partition != num_partitions;
+                 ++partition)
+            {
+                std::size_t const size = tables[partition].entries().size();
+                keys_dest.push_back(std::next(keys_dest.back(), size));
+                values_dest.push_back(std::next(values_dest.back(), size));
+            }
+
+            auto write = [&](std::size_t partition) {
+                FwdIter1 keys_dst = keys_dest[partition];
+                FwdIter2 values_dst = values_dest[partition];
+                for (auto& e : tables[partition].entries())
+                {
+                    *keys_dst = PIKA_MOVE(e.key);
+                    *values_dst = PIKA_MOVE(e.value);
+                    ++keys_dst;
+                    ++values_dst;
+                }
+            };
+            parallel::detail::run_chunks(policy, num_partitions, write);
+
+            return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                keys_dest.back(), values_dest.back()};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // hash_reduce_by_key wrapper struct
+        template <typename FwdIter1, typename FwdIter2>
+        struct hash_reduce_by_key
+          : public parallel::detail::algorithm<
+                hash_reduce_by_key<FwdIter1, FwdIter2>,
+                parallel::detail::in_out_result<FwdIter1, FwdIter2>>
+        {
+            hash_reduce_by_key()
+              : hash_reduce_by_key::algorithm("hash_reduce_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual>
+            static parallel::detail::in_out_result<FwdIter1, FwdIter2>
+            sequential(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func&& func, Hash&& hash,
+                KeyEqual&& equal)
+            {
+                return hash_reduce_by_key_impl(PIKA_FORWARD(ExPolicy, policy),
+                    key_first, key_last, values_first, keys_output,
+                    values_output, PIKA_FORWARD(Func, func),
+                    PIKA_FORWARD(Hash, hash), PIKA_FORWARD(KeyEqual, equal));
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual>
+            static typename parallel::detail::algorithm_result<ExPolicy,
+                parallel::detail::in_out_result<FwdIter1, FwdIter2>>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func&& func, Hash&& hash,
+                KeyEqual&& equal)
+            {
+                return parallel::detail::algorithm_result<ExPolicy,
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>::
+                    get(parallel::execution::async_execute(policy.executor(),
+                        pika::util::detail::deferred_call(
+                            &hash_reduce_by_key_impl<ExPolicy&&, RanIter,
+                                RanIter2, FwdIter1, FwdIter2, Func&&, Hash&&,
+                                KeyEqual&&>,
+                            policy, key_first, key_last, values_first,
+                            keys_output, values_output,
+                            PIKA_FORWARD(Func, func), PIKA_FORWARD(Hash, hash),
+                            PIKA_FORWARD(KeyEqual, equal))));
+            }
+        };
         /// \endcond
     }    // namespace detail
 
@@ -551,4 +925,129 @@ namespace pika {
             keys_output, values_output, PIKA_FORWARD(Compare, comp),
             PIKA_FORWARD(Func, func));
     }
+
+    //-----------------------------------------------------------------------------
+    /// Hash Reduce by Key aggregates the values of equal keys supplied in
+    /// key/value pairs without requiring equal keys to be consecutive. The
+    /// algorithm produces a single output value for each distinct key in
+    /// [key_first, key_last), the value being the
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(func, *(values_first + i), ...) of the
+    /// values of all keys equal to it, in the order they appear in. The
+    /// distinct keys are written in an unspecified order, the sequential
+    /// version writes them in the order of their first occurrence. The number
+    /// of keys supplied must match the number of values.
+    ///
+    /// Instead of sorting the keys as \a reduce_by_key requires, every chunk
+    /// of the keys is aggregated into open addressing hash tables, one per
+    /// partition of the keys given by the high bits of their hash values.
+    /// The tables of a partition are merged by a single task, and all
+    /// partitions are written to the output in parallel.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of
+    ///         \a func and \a hash, and on average
+    ///         O(\a key_last - \a key_first) applications of \a equal.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Assumed to be std::plus otherwise.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     to hash keys (deduced).
+    ///                     Assumed to be std::hash otherwise.
+    /// \tparam KeyEqual    The type of the function/function object to use
+    ///                     to compare keys (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param func         Specifies the associative binary function (or
+    ///                     function object) combining the values of equal
+    ///                     keys. The signature of this function should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    /// \param hash         Specifies the function (or function object)
+    ///                     computing the hash value of a key, equal keys must
+    ///                     have equal hash values.
+    /// \param equal        Specifies the binary predicate which returns true
+    ///                     if two keys are equal.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a hash_reduce_by_key algorithm returns a
+    ///           \a pika::future<in_out_result<FwdIter1,FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1,FwdIter2> otherwise. The result
+    ///           refers to the ends of the written keys and values.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Func =
+            std::plus<typename std::iterator_traits<RanIter2>::value_type>,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        PIKA_CONCEPT_REQUIRES_(pika::is_execution_policy<ExPolicy>::value&&
+                pika::traits::is_iterator<RanIter>::value&&
+                    pika::traits::is_iterator<RanIter2>::value&&
+                        pika::traits::is_iterator<FwdIter1>::value&&
+                            pika::traits::is_iterator<FwdIter2>::value)>
+    typename parallel::detail::algorithm_result<ExPolicy,
+        parallel::detail::in_out_result<FwdIter1, FwdIter2>>::type
+    hash_reduce_by_key(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+        RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+        Func&& func = Func(), Hash&& hash = Hash(),
+        KeyEqual&& equal = KeyEqual())
+    {
+        static_assert(
+            (pika::traits::is_random_access_iterator<RanIter>::value) &&
+                (pika::traits::is_random_access_iterator<RanIter2>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter1>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return detail::hash_reduce_by_key<FwdIter1, FwdIter2>().call(
+            PIKA_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
+            keys_output, values_output, PIKA_FORWARD(Func, func),
+            PIKA_FORWARD(Hash, hash), PIKA_FORWARD(KeyEqual, equal));
+    }
 }    // namespace pika
@@ -211,6 +211,7 @@ namespace pika {
 #include <pika/config.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/type_support/unused.hpp>
@@ -218,11 +219,13 @@ namespace pika {
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
-#include <pika/parallel/algorithms/detail/find.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/remove.hpp>
 #include <pika/parallel/algorithms/detail/transfer.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/compaction_staging.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/invoke_projected.hpp>
 #include <pika/parallel/util/loop.hpp>
@@ -234,6 +237,7 @@ namespace pika {
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -245,21 +249,6 @@ namespace pika::parallel::detail {
     // remove_if
     /// \cond NOINTERNAL
 
-    template <typename Iter, typename Sent, typename Pred, typename Proj>
-    Iter sequential_remove_if(Iter first, Sent last, Pred pred, Proj proj)
-    {
-        first = pika::parallel::detail::sequential_find_if<
-            pika::execution::sequenced_policy>(first, last, pred, proj);
-
-        if (first != last)
-            for (Iter i = first; ++i != last;)
-                if (!PIKA_INVOKE(pred, PIKA_INVOKE(proj, *i)))
-                {
-                    *first++ = PIKA_MOVE(*i);
-                }
-        return first;
-    }
-
     template <typename FwdIter>
     struct remove_if : public algorithm<remove_if<FwdIter>, FwdIter>
     {
@@ -268,13 +257,15 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Pred, typename Proj>
         static Iter
         sequential(ExPolicy, Iter first, Sent last, Pred&& pred, Proj&& proj)
         {
-            return sequential_remove_if(first, last, PIKA_FORWARD(Pred, pred),
-                PIKA_FORWARD(Proj, proj));
+            return sequential_remove_if<std::decay_t<ExPolicy>>(first, last,
+                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
         }
 
         template <typename ExPolicy, typename Iter, typename Sent,
@@ -282,7 +273,8 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, Iter>::type parallel(
             ExPolicy&& policy, Iter first, Sent last, Pred&& pred, Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<Iter, bool*>;
+            using zip_iterator = pika::util::zip_iterator<Iter,
+                pika::util::counting_iterator<std::size_t>>;
             using algorithm_result = algorithm_result<ExPolicy, Iter>;
             using difference_type =
                 typename std::iterator_traits<Iter>::difference_type;
@@ -292,7 +284,36 @@ namespace pika::parallel::detail {
             if (count == 0)
                 return algorithm_result::get(PIKA_MOVE(first));
 
-            std::shared_ptr<bool[]> flags(new bool[count]);
+            // small inputs are not worth allocating the flags for
+            if (std::size_t(count) < flag_buffer_sequential_limit)
+            {
+                return remove_if()(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            }
+
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            switch (select_stream_compaction(policy.parameters()))
+            {
+            case pika::execution::stream_compaction_mode::recompute:
+                // the chunks have to be compacted one after the other
+                return remove_if()(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+
+            case pika::execution::stream_compaction_mode::staging:
+                if constexpr (std::is_move_constructible_v<value_type>)
+                {
+                    return parallel_staging(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, PIKA_FORWARD(Pred, pred),
+                        PIKA_FORWARD(Proj, proj));
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            flag_buffer flags(count);
             std::size_t init = 0u;
 
             using pika::util::make_zip_iterator;
@@ -303,17 +324,17 @@ namespace pika::parallel::detail {
             // Note: replacing the invoke() with PIKA_INVOKE()
             // below makes gcc generate errors
             auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                          proj = PIKA_FORWARD(Proj, proj)](
+                          proj = PIKA_FORWARD(Proj, proj), flags](
                           zip_iterator part_begin,
-                          std::size_t part_size) -> std::size_t {
-                // MSVC complains if pred or proj is captured by ref below
-                loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
-                    [pred, proj](zip_iterator it) mutable {
-                        bool f = pika::util::detail::invoke(pred,
-                            pika::util::detail::invoke(proj, get<0>(*it)));
-
-                        get<1>(*it) = f;
-                    });
+                          std::size_t part_size) mutable -> std::size_t {
+                auto iters = part_begin.get_iterator_tuple();
+                Iter it = get<0>(iters);
+                flags.set(*get<1>(iters), part_size, [&]() {
+                    bool f = pika::util::detail::invoke(
+                        pred, pika::util::detail::invoke(proj, *it));
+                    ++it;
+                    return f;
+                });
 
                 // There is no need to return the partition result.
                 // But, the scan_partitioner doesn't support 'void' as
@@ -336,36 +357,35 @@ namespace pika::parallel::detail {
                     std::size_t part_size,
                     pika::shared_future<std::size_t> curr,
                     pika::shared_future<std::size_t> next) mutable -> void {
-                PIKA_UNUSED(flags);
-
                 curr.get();    // rethrow exceptions
                 next.get();    // rethrow exceptions
 
                 Iter& dest = *dest_ptr;
 
-                using execution_policy_type = std::decay_t<ExPolicy>;
-                if (dest == get<0>(part_begin.get_iterator_tuple()))
+                auto iters = part_begin.get_iterator_tuple();
+                Iter it = get<0>(iters);
+                if (dest == it)
                 {
                     // Self-assignment must be detected.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                            {
-                                if (dest != get<0>(it.get_iterator_tuple()))
-                                    *dest++ = PIKA_MOVE(get<0>(*it));
-                                else
-                                    ++dest;
-                            }
-                        });
+                    flags.get(*get<1>(iters), part_size, [&](bool f) {
+                        if (!f)
+                        {
+                            if (dest != it)
+                                *dest++ = PIKA_MOVE(*it);
+                            else
+                                ++dest;
+                        }
+                        ++it;
+                    });
                 }
                 else
                 {
                     // Self-assignment can't be performed.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                                *dest++ = PIKA_MOVE(get<0>(*it));
-                        });
+                    flags.get(*get<1>(iters), part_size, [&](bool f) {
+                        if (!f)
+                            *dest++ = PIKA_MOVE(*it);
+                        ++it;
+                    });
                 }
             };
 
@@ -384,7 +404,9 @@ namespace pika::parallel::detail {
             };
 
             return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
-                make_zip_iterator(first, flags.get()), count, init,
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count, init,
                 // step 1 performs first part of scan algorithm
                 PIKA_MOVE(f1),
                 // step 2 propagates the partition results from left
@@ -395,6 +417,78 @@ namespace pika::parallel::detail {
                 // step 4 use this return value
                 PIKA_MOVE(f4));
         }
+
+    private:
+        // Step 1 moves the elements to keep to a buffer owned by the chunk.
+        // All elements a chunk moves to are to the left of the elements of
+        // the chunks to its right, so step 3 moves them to their final
+        // position without waiting for the chunks to its left.
+        template <typename ExPolicy, typename Iter, typename Pred,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, Iter>::type
+        parallel_staging(ExPolicy&& policy, Iter first, std::size_t count,
+            Pred&& pred, Proj&& proj)
+        {
+            using zip_iterator = pika::util::zip_iterator<Iter,
+                pika::util::counting_iterator<std::size_t>>;
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using scan_partitioner_type =
+                scan_partitioner<ExPolicy, Iter, std::size_t>;
+
+            using pika::util::make_zip_iterator;
+            using std::get;
+
+            compaction_staging<value_type> staging;
+
+            auto f1 = [pred = PIKA_FORWARD(Pred, pred),
+                          proj = PIKA_FORWARD(Proj, proj), staging](
+                          zip_iterator part_begin,
+                          std::size_t part_size) mutable -> std::size_t {
+                auto iters = part_begin.get_iterator_tuple();
+                Iter it = get<0>(iters);
+
+                std::vector<value_type> kept;
+                for (/**/; part_size != 0; --part_size, ++it)
+                {
+                    if (!pika::util::detail::invoke(
+                            pred, pika::util::detail::invoke(proj, *it)))
+                    {
+                        kept.push_back(PIKA_MOVE(*it));
+                    }
+                }
+
+                std::size_t const curr = kept.size();
+                staging.put(*get<1>(iters), PIKA_MOVE(kept));
+                return curr;
+            };
+            auto f3 = [first, staging](zip_iterator part_begin, std::size_t,
+                          std::size_t val) mutable {
+                std::advance(first, val);
+                for (auto& element :
+                    staging.take(*get<1>(part_begin.get_iterator_tuple())))
+                {
+                    *first++ = PIKA_MOVE(element);
+                }
+            };
+
+            auto f4 = [first](std::vector<std::size_t>&& items,
+                          std::vector<pika::future<void>>&& data) mutable
+                -> Iter {
+                std::advance(first, items.back());
+
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+
+                return first;
+            };
+
+            return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count, std::size_t(0), PIKA_MOVE(f1), std::plus<std::size_t>(),
+                PIKA_MOVE(f3), PIKA_MOVE(f4));
+        }
     };
     /// \endcond
 }    // namespace pika::parallel::detail
@@ -468,10 +562,8 @@ namespace pika {
         friend FwdIter tag_fallback_invoke(
             pika::remove_t, FwdIter first, FwdIter last, T const& value)
         {
-            using Type = typename std::iterator_traits<FwdIter>::value_type;
-
             return pika::remove_if(pika::execution::seq, first, last,
-                [value](Type const& a) -> bool { return value == a; });
+                pika::parallel::detail::compare_to<T>(value));
         }
 
         // clang-format off
@@ -487,10 +579,8 @@ namespace pika {
             tag_fallback_invoke(pika::remove_t, ExPolicy&& policy,
                 FwdIter first, FwdIter last, T const& value)
         {
-            using Type = typename std::iterator_traits<FwdIter>::value_type;
-
             return pika::remove_if(PIKA_FORWARD(ExPolicy, policy), first, last,
-                [value](Type const& a) -> bool { return value == a; });
+                pika::parallel::detail::compare_to<T>(value));
         }
     } remove{};
 }    // namespace pika
@@ -260,6 +260,8 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/copy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/remove.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
@@ -299,6 +301,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter, typename T, typename Proj>
         static in_out_result<InIter, OutIter> sequential(ExPolicy, InIter first,
@@ -327,22 +331,6 @@ namespace pika::parallel::detail {
     // remove_copy_if
     /// \cond NOINTERNAL
 
-    // sequential remove_copy_if
-    template <typename InIter, typename Sent, typename OutIter, typename F,
-        typename Proj>
-    inline in_out_result<InIter, OutIter> sequential_remove_copy_if(
-        InIter first, Sent last, OutIter dest, F p, Proj&& proj)
-    {
-        for (/* */; first != last; ++first)
-        {
-            if (!PIKA_INVOKE(p, PIKA_INVOKE(proj, *first)))
-            {
-                *dest++ = *first;
-            }
-        }
-        return in_out_result<InIter, OutIter>{first, dest};
-    }
-
     template <typename IterPair>
     struct remove_copy_if : public algorithm<remove_copy_if<IterPair>, IterPair>
     {
@@ -351,13 +339,15 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter, typename F, typename Proj>
         static in_out_result<InIter, OutIter> sequential(
             ExPolicy, InIter first, Sent last, OutIter dest, F&& f, Proj&& proj)
         {
-            return sequential_remove_copy_if(first, last, dest,
-                PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+            return sequential_remove_copy_if<std::decay_t<ExPolicy>>(first,
+                last, dest, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -469,10 +459,8 @@ namespace pika {
             static_assert((pika::traits::is_output_iterator<InIter>::value),
                 "Requires at least output iterator.");
 
-            using Type = typename std::iterator_traits<InIter>::value_type;
-
             return pika::remove_copy_if(first, last, dest,
-                [value](Type const& a) -> bool { return value == a; });
+                pika::parallel::detail::compare_to<T>(value));
         }
 
         // clang-format off
@@ -495,11 +483,8 @@ namespace pika {
             static_assert((pika::traits::is_forward_iterator<FwdIter2>::value),
                 "Required at least forward iterator.");
 
-            using Type = typename std::iterator_traits<FwdIter1>::value_type;
-
             return pika::remove_copy_if(PIKA_FORWARD(ExPolicy, policy), first,
-                last, dest,
-                [value](Type const& a) -> bool { return value == a; });
+                last, dest, pika::parallel::detail::compare_to<T>(value));
         }
 
     } remove_copy{};
@@ -479,12 +479,16 @@ namespace pika {
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/replace.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -521,8 +525,18 @@ namespace pika::parallel::detail {
         static InIter sequential(ExPolicy, InIter first, InIter last,
             T1 const& old_value, T2 const& new_value, Proj&& proj)
         {
-            return sequential_replace(
-                first, last, old_value, new_value, PIKA_FORWARD(Proj, proj));
+            if constexpr (is_sized_range_v<InIter, InIter>)
+            {
+                return sequential_replace_if_n<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)),
+                    replace_equal_to<T1>{old_value}, new_value,
+                    PIKA_FORWARD(Proj, proj));
+            }
+            else
+            {
+                return sequential_replace(first, last, old_value, new_value,
+                    PIKA_FORWARD(Proj, proj));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename T1, typename T2,
@@ -531,18 +545,22 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
             T1 const& old_value, T2 const& new_value, Proj&& proj)
         {
-            using type = typename std::iterator_traits<FwdIter>::value_type;
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
 
-            return for_each_n<FwdIter>().call(
-                PIKA_FORWARD(ExPolicy, policy), first,
-                std::distance(first, last),
-                [old_value, new_value, proj = PIKA_FORWARD(Proj, proj)](
-                    type& t) -> void {
-                    if (PIKA_INVOKE(proj, t) == old_value)
-                    {
-                        t = new_value;
-                    }
-                },
+            auto f1 = [pred = replace_equal_to<T1>{old_value}, new_value,
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
+                          std::size_t part_size, std::size_t) -> void {
+                sequential_replace_if_n<std::decay_t<ExPolicy>>(
+                    part_begin, part_size, pred, new_value, proj);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
                 projection_identity());
         }
     };
@@ -581,8 +599,17 @@ namespace pika::parallel::detail {
         static InIter sequential(ExPolicy, InIter first, Sent last, F&& f,
             T const& new_value, Proj&& proj)
         {
-            return sequential_replace_if(first, last, PIKA_FORWARD(F, f),
-                new_value, PIKA_FORWARD(Proj, proj));
+            if constexpr (is_sized_range_v<InIter, Sent>)
+            {
+                return sequential_replace_if_n<std::decay_t<ExPolicy>>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)),
+                    PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
+            }
+            else
+            {
+                return sequential_replace_if(first, last, PIKA_FORWARD(F, f),
+                    new_value, PIKA_FORWARD(Proj, proj));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -591,17 +618,22 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, F&& f,
             T const& new_value, Proj&& proj)
         {
-            using type = typename std::iterator_traits<FwdIter>::value_type;
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
 
-            return for_each_n<FwdIter>().call(
-                PIKA_FORWARD(ExPolicy, policy), first, (distance) (first, last),
-                [new_value, f = PIKA_FORWARD(F, f),
-                    proj = PIKA_FORWARD(Proj, proj)](type& t) mutable -> void {
-                    if (PIKA_INVOKE(f, PIKA_INVOKE(proj, t)))
-                    {
-                        t = new_value;
-                    }
-                },
+            auto f1 = [new_value, f = PIKA_FORWARD(F, f),
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
+                          std::size_t part_size, std::size_t) mutable -> void {
+                sequential_replace_if_n<std::decay_t<ExPolicy>>(
+                    part_begin, part_size, f, new_value, proj);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
                 projection_identity());
         }
     };
@@ -183,18 +183,23 @@ namespace pika {
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/copy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/reverse.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/ranges_facilities.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -202,6 +207,29 @@ namespace pika {
 namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // reverse
+    /// \cond NOINTERNAL
+
+    // Reverses the contiguous sequence of count elements starting at first,
+    // the chunks of its first half are swapped with their mirrored blocks of
+    // the second half, see reverse_swap_n. Returns the end of the first half,
+    // count must be at least 2.
+    template <typename ExPolicy, typename T>
+    typename algorithm_result<ExPolicy, T*>::type reverse_contiguous(
+        ExPolicy&& policy, T* first, std::size_t count)
+    {
+        using policy_type = std::decay_t<ExPolicy>;
+        T* last = first + count;
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), first, count / 2,
+            [first, last](T* part_begin, std::size_t part_size,
+                std::size_t) -> void {
+                reverse_swap_n<policy_type>(
+                    part_begin, last - (part_begin - first), part_size);
+            },
+            projection_identity());
+    }
+    /// \endcond
+
     /// \cond NOINTERNAL
     template <typename Iter>
     struct reverse : public algorithm<reverse<Iter>, Iter>
@@ -216,13 +244,28 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, BidirIter first, Sent last)
         {
             auto last2{pika::ranges::next(first, last)};
-            for (auto tail{last2}; !(first == tail || first == --tail); ++first)
+            if constexpr (is_contiguous_reverse_v<BidirIter>)
             {
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last2));
+                if (count > 1)
+                {
+                    auto* begin = pika::detail::to_address(first);
+                    reverse_swap_n<std::decay_t<ExPolicy>>(
+                        begin, begin + count, count / 2);
+                }
+            }
+            else
+            {
+                for (auto tail{last2}; !(first == tail || first == --tail);
+                     ++first)
+                {
 #if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                std::ranges::iter_swap(first, tail);
+                    std::ranges::iter_swap(first, tail);
 #else
-                std::iter_swap(first, tail);
+                    std::iter_swap(first, tail);
 #endif
+                }
             }
             return last2;
         }
@@ -232,22 +275,45 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, BidirIter first, Sent last)
         {
             auto last2{pika::ranges::next(first, last)};
-            using destination_iterator = std::reverse_iterator<BidirIter>;
-            using zip_iterator =
-                pika::util::zip_iterator<BidirIter, destination_iterator>;
-            using reference = typename zip_iterator::reference;
-
-            return convert_to_result(for_each_n<zip_iterator>().call(
-                                         PIKA_FORWARD(ExPolicy, policy),
-                                         pika::util::make_zip_iterator(first,
-                                             destination_iterator(last2)),
-                                         (distance) (first, last2) / 2,
-                                         [](reference t) -> void {
-                                             using std::get;
-                                             std::swap(get<0>(t), get<1>(t));
-                                         },
-                                         projection_identity()),
-                [last2](zip_iterator const&) -> BidirIter { return last2; });
+            if constexpr (is_contiguous_reverse_v<BidirIter>)
+            {
+                using pointer =
+                    typename std::iterator_traits<BidirIter>::value_type*;
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last2));
+                if (count < 2)
+                {
+                    return algorithm_result<ExPolicy, BidirIter>::get(
+                        PIKA_MOVE(last2));
+                }
+
+                return convert_to_result(
+                    reverse_contiguous(PIKA_FORWARD(ExPolicy, policy),
+                        pika::detail::to_address(first), count),
+                    [last2](pointer const&) -> BidirIter { return last2; });
+            }
+            else
+            {
+                using destination_iterator = std::reverse_iterator<BidirIter>;
+                using zip_iterator =
+                    pika::util::zip_iterator<BidirIter, destination_iterator>;
+                using reference = typename zip_iterator::reference;
+
+                return convert_to_result(
+                    for_each_n<zip_iterator>().call(
+                        PIKA_FORWARD(ExPolicy, policy),
+                        pika::util::make_zip_iterator(
+                            first, destination_iterator(last2)),
+                        (distance) (first, last2) / 2,
+                        [](reference t) -> void {
+                            using std::get;
+                            std::swap(get<0>(t), get<1>(t));
+                        },
+                        projection_identity()),
+                    [last2](zip_iterator const&) -> BidirIter {
+                        return last2;
+                    });
+            }
         }
     };
     /// \endcond
@@ -269,6 +335,26 @@ namespace pika::parallel::detail {
         return in_out_result<BidirIt, OutIter>{iter, dest};
     }
 
+    // Writes the contiguous sequence of count elements ending at last in
+    // reverse order to the contiguous sequence starting at dest, every chunk
+    // of the destination is copied from its mirrored block, see
+    // reverse_copy_n. Returns the end of the destination, count must not be
+    // zero.
+    template <typename ExPolicy, typename T>
+    typename algorithm_result<ExPolicy, T*>::type reverse_copy_contiguous(
+        ExPolicy&& policy, T const* last, std::size_t count, T* dest)
+    {
+        using policy_type = std::decay_t<ExPolicy>;
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), dest, count,
+            [last, dest](T* part_begin, std::size_t part_size,
+                std::size_t) -> void {
+                reverse_copy_n<policy_type>(
+                    last - (part_begin - dest), part_size, part_begin);
+            },
+            projection_identity());
+    }
+
     template <typename IterPair>
     struct reverse_copy : public algorithm<reverse_copy<IterPair>, IterPair>
     {
@@ -282,7 +368,24 @@ namespace pika::parallel::detail {
         constexpr static in_out_result<BidirIter, OutIter>
         sequential(ExPolicy, BidirIter first, Sent last, OutIter dest_first)
         {
-            return sequential_reverse_copy(first, last, dest_first);
+            if constexpr (is_contiguous_reverse_copy_v<BidirIter, OutIter>)
+            {
+                auto last2{pika::ranges::next(first, last)};
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last2));
+                if (count != 0)
+                {
+                    reverse_copy_n<std::decay_t<ExPolicy>>(
+                        pika::detail::to_address(first) + count, count,
+                        pika::detail::to_address(dest_first));
+                }
+                return in_out_result<BidirIter, OutIter>{
+                    first, std::next(dest_first, count)};
+            }
+            else
+            {
+                return sequential_reverse_copy(first, last, dest_first);
+            }
         }
 
         template <typename ExPolicy, typename BidirIter, typename Sent,
@@ -293,17 +396,43 @@ namespace pika::parallel::detail {
             ExPolicy&& policy, BidirIter first, Sent last, FwdIter dest_first)
         {
             auto last2{pika::ranges::next(first, last)};
-            using iterator = std::reverse_iterator<BidirIter>;
-
-            return convert_to_result(
-                copy_algo<in_out_result<iterator, FwdIter>>().call(
-                    PIKA_FORWARD(ExPolicy, policy), iterator(last2),
-                    iterator(first), dest_first),
-                [](in_out_result<iterator, FwdIter> const& p)
-                    -> in_out_result<BidirIter, FwdIter> {
-                    return in_out_result<BidirIter, FwdIter>{
-                        p.in.base(), p.out};
-                });
+            if constexpr (is_contiguous_reverse_copy_v<BidirIter, FwdIter>)
+            {
+                using pointer =
+                    typename std::iterator_traits<FwdIter>::value_type*;
+                std::size_t const count =
+                    static_cast<std::size_t>(detail::distance(first, last2));
+                using result_type = in_out_result<BidirIter, FwdIter>;
+                if (count == 0)
+                {
+                    return algorithm_result<ExPolicy, result_type>::get(
+                        result_type{first, dest_first});
+                }
+
+                return convert_to_result(
+                    reverse_copy_contiguous(PIKA_FORWARD(ExPolicy, policy),
+                        pika::detail::to_address(first) + count, count,
+                        pika::detail::to_address(dest_first)),
+                    [first, dest_first, count](
+                        pointer const&) -> result_type {
+                        return result_type{
+                            first, std::next(dest_first, count)};
+                    });
+            }
+            else
+            {
+                using iterator = std::reverse_iterator<BidirIter>;
+
+                return convert_to_result(
+                    copy_algo<in_out_result<iterator, FwdIter>>().call(
+                        PIKA_FORWARD(ExPolicy, policy), iterator(last2),
+                        iterator(first), dest_first),
+                    [](in_out_result<iterator, FwdIter> const& p)
+                        -> in_out_result<BidirIter, FwdIter> {
+                        return in_out_result<BidirIter, FwdIter>{
+                            p.in.base(), p.out};
+                    });
+            }
         }
     };
     /// \endcond
@@ -192,12 +192,15 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/rotate.hpp>
 #include <pika/parallel/algorithms/reverse.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/parallel_memmove.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/transfer.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -235,6 +238,114 @@ namespace pika::parallel::detail {
             r.call2(p, non_seq(), new_first, last));
     }
 
+    // Rotate trivially copyable elements by saving the shorter of the two
+    // parts to a buffer and moving the longer one in place
+    template <typename ExPolicy, typename FwdIter>
+    in_out_result<FwdIter, FwdIter> parallel_memmove_rotate(
+        ExPolicy& policy, FwdIter first, FwdIter new_first, FwdIter last)
+    {
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        std::size_t const head =
+            static_cast<std::size_t>((distance) (first, new_first));
+        std::size_t const tail =
+            static_cast<std::size_t>((distance) (new_first, last));
+        FwdIter result = std::next(first, tail);
+        if (head == 0 || tail == 0)
+        {
+            return in_out_result<FwdIter, FwdIter>{result, last};
+        }
+
+        std::size_t const saved = (std::min)(head, tail) * sizeof(value_type);
+        std::unique_ptr<char[]> buffer(new char[saved]);
+        if (head <= tail)
+        {
+            parallel_memcpy(policy, buffer.get(), to_const_ptr(first), saved);
+            parallel_memmove_n(policy, new_first, tail, first);
+            parallel_memcpy(policy, to_ptr(result), buffer.get(), saved);
+        }
+        else
+        {
+            parallel_memcpy(
+                policy, buffer.get(), to_const_ptr(new_first), saved);
+            parallel_memmove_n(policy, first, head, result);
+            parallel_memcpy(policy, to_ptr(first), buffer.get(), saved);
+        }
+        return in_out_result<FwdIter, FwdIter>{result, last};
+    }
+
+    // Rotate random access sequences of elements which are moved without
+    // throwing in the same way: every element is moved once, the elements
+    // of the shorter part twice, instead of twice for the three reverses of
+    // rotate_helper. The reverses are used if the buffer can not be
+    // allocated.
+    template <typename ExPolicy, typename Iter>
+    in_out_result<Iter, Iter> parallel_move_rotate(
+        ExPolicy& policy, Iter first, Iter new_first, Iter last)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const head =
+            static_cast<std::size_t>((distance) (first, new_first));
+        std::size_t const tail =
+            static_cast<std::size_t>((distance) (new_first, last));
+        Iter result = std::next(first, tail);
+        if (head == 0 || tail == 0)
+        {
+            return in_out_result<Iter, Iter>{result, last};
+        }
+
+        if (head == tail)
+        {
+            parallel_move_blocks<value_type>(policy, head,
+                [&](std::size_t begin, std::size_t end) {
+                    std::swap_ranges(std::next(first, begin),
+                        std::next(first, end), std::next(new_first, begin));
+                });
+            return in_out_result<Iter, Iter>{result, last};
+        }
+
+        std::size_t const saved = (std::min)(head, tail);
+        uninitialized_buffer<value_type> buffer(saved);
+        if (buffer.data() == nullptr)
+        {
+            reverse<Iter> r;
+            r.call(policy, first, new_first);
+            r.call(policy, new_first, last);
+            r.call(policy, first, last);
+            return in_out_result<Iter, Iter>{result, last};
+        }
+
+        // the shorter part is moved to the buffer and back to its place
+        // after the longer part has been moved
+        Iter const saved_first = head <= tail ? first : new_first;
+        Iter const saved_dest = head <= tail ? result : first;
+        value_type* const p = buffer.data();
+
+        parallel_move_blocks<value_type>(
+            policy, saved, [&](std::size_t begin, std::size_t end) {
+                std::uninitialized_move(std::next(saved_first, begin),
+                    std::next(saved_first, end), p + begin);
+            });
+
+        if (head <= tail)
+        {
+            parallel_move_n(policy, new_first, tail, first);
+        }
+        else
+        {
+            parallel_move_n(policy, first, head, result);
+        }
+
+        parallel_move_blocks<value_type>(
+            policy, saved, [&](std::size_t begin, std::size_t end) {
+                std::move(p + begin, p + end, std::next(saved_dest, begin));
+                std::destroy(p + begin, p + end);
+            });
+
+        return in_out_result<Iter, Iter>{result, last};
+    }
+
     template <typename IterPair>
     struct rotate : public algorithm<rotate<IterPair>, IterPair>
     {
@@ -243,6 +354,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // the work is bounded by the outer iterators, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_outer(args...);
+        }
+
         template <typename ExPolicy, typename InIter, typename Sent>
         static IterPair
         sequential(ExPolicy, InIter first, InIter new_first, Sent last)
@@ -254,8 +372,31 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, IterPair>::type
         parallel(ExPolicy&& policy, FwdIter first, FwdIter new_first, Sent last)
         {
-            return algorithm_result<ExPolicy, IterPair>::get(rotate_helper(
-                PIKA_FORWARD(ExPolicy, policy), first, new_first, last));
+            if constexpr (is_memmove_iterator_v<FwdIter> &&
+                std::is_same_v<FwdIter, Sent>)
+            {
+                return run_parallel_memmove<ExPolicy, IterPair>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [=](auto& p) -> IterPair {
+                        return parallel_memmove_rotate(
+                            p, first, new_first, last);
+                    });
+            }
+            else if constexpr (is_nothrow_move_iterator_v<FwdIter> &&
+                std::is_same_v<FwdIter, Sent>)
+            {
+                return run_parallel_memmove<ExPolicy, IterPair>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [=](auto& p) -> IterPair {
+                        return parallel_move_rotate(p, first, new_first, last);
+                    });
+            }
+            else
+            {
+                return algorithm_result<ExPolicy, IterPair>::get(
+                    rotate_helper(PIKA_FORWARD(ExPolicy, policy), first,
+                        new_first, last));
+            }
         }
     };
     /// \endcond
@@ -310,6 +451,13 @@ namespace pika::parallel::detail {
         {
         }
 
+        // the work is bounded by the outer iterators, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_outer(args...);
+        }
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter>
         static in_out_result<InIter, OutIter> sequential(ExPolicy, InIter first,
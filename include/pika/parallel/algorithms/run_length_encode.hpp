@@ -0,0 +1,680 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/run_length_encode.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Replaces every run of consecutive equal elements of the range
+    /// [first, last) by one copy of its first element, written to
+    /// \a values_dest, and the length of the run, written to \a counts_dest.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a pred.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination of the values (deduced). This
+    ///                     iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter3    The type of the iterator representing the
+    ///                     destination of the lengths of the runs (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator, its value type must be an
+    ///                     arithmetic type.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a run_length_encode requires \a Pred
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///                     This defaults to std::equal_to<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param values_dest  Refers to the beginning of the destination range
+    ///                     of the values of the runs.
+    /// \param counts_dest  Refers to the beginning of the destination range
+    ///                     of the lengths of the runs.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for pairs of adjacent elements of
+    ///                     the sequence specified by [first, last). It
+    ///                     returns true if the two elements belong to the
+    ///                     same run. The signature of this predicate should
+    ///                     be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a, const Type &b);
+    ///                     \endcode \n
+    ///
+    /// The comparisons in the parallel \a run_length_encode algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a run_length_encode algorithm invoked
+    /// with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a run_length_encode algorithm returns a
+    ///           \a pika::future<in_out_out_result<RandIter, FwdIter2,
+    ///           FwdIter3>>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_out_result<RandIter, FwdIter2, FwdIter3>
+    ///           otherwise. The result holds \a last and the ends of the two
+    ///           destination ranges.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename FwdIter3, typename Pred = detail::equal_to>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        pika::parallel::detail::in_out_out_result<RandIter, FwdIter2,
+            FwdIter3>>::type
+    run_length_encode(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter2 values_dest, FwdIter3 counts_dest, Pred&& pred = Pred());
+
+    /// Writes counts_first[i] copies of values_first[i] to \a dest for each
+    /// run i of the range [values_first, values_last), this reverts
+    /// \a run_length_encode.
+    ///
+    /// \note   Complexity: O(\a values_last - \a values_first) reads of the
+    ///         lengths and as many assignments as the lengths add up to.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the iterators referring to the values
+    ///                     of the runs (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam RandIter2   The type of the iterator referring to the lengths
+    ///                     of the runs (deduced). This iterator type must
+    ///                     meet the requirements of a random access iterator,
+    ///                     its value type must be an arithmetic type.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param values_first Refers to the beginning of the values of the runs.
+    /// \param values_last  Refers to the end of the values of the runs.
+    /// \param counts_first Refers to the beginning of the lengths of the runs.
+    ///                     Runs with a length of zero or less are skipped.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The assignments in the parallel \a run_length_decode algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a run_length_decode algorithm invoked
+    /// with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a run_length_decode algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter otherwise.
+    ///           The \a run_length_decode algorithm returns the end of the
+    ///           destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    run_length_decode(ExPolicy&& policy, RandIter1 values_first,
+        RandIter1 values_last, RandIter2 counts_first, FwdIter dest);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // run_length_encode, run_length_decode
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements (or runs) handled by one task
+    inline constexpr std::size_t run_length_min_chunk_size = 4096ul;
+
+    template <typename ExPolicy>
+    std::size_t run_length_num_chunks(ExPolicy& policy, std::size_t count)
+    {
+        if constexpr (pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            return 1;
+        }
+        else
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_chunks = (std::min)(4 * cores,
+                (count + run_length_min_chunk_size - 1) /
+                    run_length_min_chunk_size);
+            return (std::max)(num_chunks, std::size_t(1));
+        }
+    }
+
+    template <typename T>
+    std::size_t run_length(T const& count)
+    {
+        return count > T(0) ? static_cast<std::size_t>(count) : 0;
+    }
+
+    // Runs f(policy) on the executor of the given policy if it is a task
+    // policy, on the calling thread otherwise.
+    template <typename ExPolicy, typename R, typename F>
+    typename algorithm_result<ExPolicy, R>::type run_length_parallel(
+        ExPolicy&& policy, F&& f)
+    {
+        using result = algorithm_result<ExPolicy, R>;
+
+        try
+        {
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, f = PIKA_FORWARD(F, f)]() mutable -> R {
+                        try
+                        {
+                            auto p = policy(pika::execution::non_task);
+                            return f(p);
+                        }
+                        catch (std::bad_alloc const&)
+                        {
+                            throw;
+                        }
+                        catch (pika::exception_list const&)
+                        {
+                            throw;
+                        }
+                        catch (...)
+                        {
+                            throw pika::exception_list(
+                                std::current_exception());
+                        }
+                    }));
+            }
+            else
+            {
+                return result::get(f(policy));
+            }
+        }
+        catch (...)
+        {
+            return result::get(
+                handle_exception<ExPolicy, R>::call(std::current_exception()));
+        }
+    }
+
+    template <typename FwdIter1, typename Sent, typename FwdIter2,
+        typename FwdIter3, typename Pred>
+    in_out_out_result<FwdIter1, FwdIter2, FwdIter3>
+    sequential_run_length_encode(FwdIter1 first, Sent last,
+        FwdIter2 values_dest, FwdIter3 counts_dest, Pred&& pred)
+    {
+        using count_type = typename std::iterator_traits<FwdIter3>::value_type;
+
+        if (first == last)
+        {
+            return {PIKA_MOVE(first), PIKA_MOVE(values_dest),
+                PIKA_MOVE(counts_dest)};
+        }
+
+        FwdIter1 run = first;
+        FwdIter1 prev = first;
+        std::size_t length = 1;
+        while (++first != last)
+        {
+            if (!PIKA_INVOKE(pred, *prev, *first))
+            {
+                *values_dest++ = *run;
+                *counts_dest++ = static_cast<count_type>(length);
+                run = first;
+                length = 0;
+            }
+            prev = first;
+            ++length;
+        }
+        *values_dest++ = *run;
+        *counts_dest++ = static_cast<count_type>(length);
+
+        return {
+            PIKA_MOVE(first), PIKA_MOVE(values_dest), PIKA_MOVE(counts_dest)};
+    }
+
+    // -----------------------------------------------------------------------
+    // As for reduce_by_key, the elements are split into chunks which are
+    // processed in two passes:
+    //  1. count the runs starting in each chunk, the exclusive scan of the
+    //     counts gives the output position of the first run of each chunk
+    //  2. write the runs starting in each chunk with their length as far as
+    //     they extend into the chunk, the elements before the first run of
+    //     a chunk continue the last run of a chunk to the left and are added
+    //     to its length afterwards
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename FwdIter3, typename Pred>
+    in_out_out_result<RandIter, FwdIter2, FwdIter3> run_length_encode_impl(
+        ExPolicy& policy, RandIter first, std::size_t count,
+        FwdIter2 values_dest, FwdIter3 counts_dest, Pred& pred)
+    {
+        using count_type = typename std::iterator_traits<FwdIter3>::value_type;
+
+        std::size_t const num_chunks = run_length_num_chunks(policy, count);
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        // the element at position i starts a new run
+        auto starts_run = [&](std::size_t i) -> bool {
+            return i == 0 || !PIKA_INVOKE(pred, first[i - 1], first[i]);
+        };
+
+        // step 1, offsets[chunk] is the number of runs starting before the
+        // chunk
+        std::vector<std::size_t> offsets(num_chunks + 1, 0);
+        auto count_runs = [&](std::size_t chunk) {
+            std::size_t const end = chunk_begin(chunk + 1);
+            std::size_t runs = 0;
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                if (starts_run(i))
+                {
+                    ++runs;
+                }
+            }
+            offsets[chunk + 1] = runs;
+        };
+        run_chunks(policy, num_chunks, count_runs);
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        // the output locations of the first run of each chunk
+        std::vector<FwdIter2> values_chunk;
+        std::vector<FwdIter3> counts_chunk;
+        values_chunk.reserve(num_chunks + 1);
+        counts_chunk.reserve(num_chunks + 1);
+        values_chunk.push_back(values_dest);
+        counts_chunk.push_back(counts_dest);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            std::size_t const runs = offsets[chunk + 1] - offsets[chunk];
+            values_chunk.push_back(std::next(values_chunk.back(), runs));
+            counts_chunk.push_back(std::next(counts_chunk.back(), runs));
+        }
+
+        // step 2, leading[chunk] is the number of elements before the first
+        // run starting in the chunk, last_count[chunk] refers to the length
+        // of the last run starting in the chunk
+        std::vector<std::size_t> leading(num_chunks);
+        std::vector<FwdIter3> last_count(num_chunks);
+        auto write_runs = [&](std::size_t chunk) {
+            std::size_t const begin = chunk_begin(chunk);
+            std::size_t const end = chunk_begin(chunk + 1);
+
+            std::size_t i = begin;
+            while (i != end && !starts_run(i))
+            {
+                ++i;
+            }
+            leading[chunk] = i - begin;
+
+            FwdIter2 values = values_chunk[chunk];
+            FwdIter3 counts = counts_chunk[chunk];
+            while (i != end)
+            {
+                std::size_t const run = i;
+                while (++i != end && !starts_run(i))
+                {
+                }
+
+                *values++ = first[run];
+                last_count[chunk] = counts;
+                *counts++ = static_cast<count_type>(i - run);
+            }
+        };
+        run_chunks(policy, num_chunks, write_runs);
+
+        // the elements before the first run of a chunk belong to the last
+        // run starting in a chunk to its left
+        FwdIter3 open_run = counts_dest;
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            if (leading[chunk] != 0)
+            {
+                PIKA_ASSERT(offsets[chunk] != 0);
+                *open_run += static_cast<count_type>(leading[chunk]);
+            }
+            if (offsets[chunk + 1] != offsets[chunk])
+            {
+                open_run = last_count[chunk];
+            }
+        }
+
+        return {std::next(first, count), values_chunk.back(),
+            counts_chunk.back()};
+    }
+
+    template <typename IterTuple>
+    struct run_length_encode : public algorithm<run_length_encode<IterTuple>,
+                                   IterTuple>
+    {
+        run_length_encode()
+          : run_length_encode::algorithm("run_length_encode")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2, typename FwdIter3, typename Pred>
+        static in_out_out_result<FwdIter1, FwdIter2, FwdIter3> sequential(
+            ExPolicy, FwdIter1 first, Sent last, FwdIter2 values_dest,
+            FwdIter3 counts_dest, Pred&& pred)
+        {
+            return sequential_run_length_encode(first, last, values_dest,
+                counts_dest, PIKA_FORWARD(Pred, pred));
+        }
+
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename FwdIter3, typename Pred>
+        static typename algorithm_result<ExPolicy,
+            in_out_out_result<RandIter, FwdIter2, FwdIter3>>::type
+        parallel(ExPolicy&& policy, RandIter first, RandIter last,
+            FwdIter2 values_dest, FwdIter3 counts_dest, Pred&& pred)
+        {
+            using result_type = in_out_out_result<RandIter, FwdIter2, FwdIter3>;
+
+            std::size_t const count = std::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, result_type>::get(
+                    result_type{first, values_dest, counts_dest});
+            }
+
+            return run_length_parallel<ExPolicy, result_type>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, count, values_dest, counts_dest,
+                    pred = PIKA_FORWARD(Pred, pred)](auto& p) mutable {
+                    return run_length_encode_impl(
+                        p, first, count, values_dest, counts_dest, pred);
+                });
+        }
+    };
+
+    template <typename RandIter1, typename RandIter2, typename FwdIter>
+    FwdIter sequential_run_length_decode(RandIter1 values_first,
+        RandIter1 values_last, RandIter2 counts_first, FwdIter dest)
+    {
+        for (/**/; values_first != values_last; ++values_first, ++counts_first)
+        {
+            dest = std::fill_n(dest, run_length(*counts_first), *values_first);
+        }
+        return dest;
+    }
+
+    // -----------------------------------------------------------------------
+    // The runs are split into chunks, the lengths of the runs of every chunk
+    // are added up to find the position of its first output element, then
+    // all chunks write their runs. The chunks hold the same number of runs,
+    // not the same number of output elements.
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter>
+    FwdIter run_length_decode_impl(ExPolicy& policy, RandIter1 values_first,
+        std::size_t num_runs, RandIter2 counts_first, FwdIter dest)
+    {
+        std::size_t const num_chunks = run_length_num_chunks(policy, num_runs);
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * num_runs / num_chunks;
+        };
+
+        // step 1, sizes[chunk] is the number of elements written by the
+        // chunks to the left of the chunk
+        std::vector<std::size_t> sizes(num_chunks + 1, 0);
+        auto add_lengths = [&](std::size_t chunk) {
+            std::size_t const end = chunk_begin(chunk + 1);
+            std::size_t size = 0;
+            for (std::size_t run = chunk_begin(chunk); run != end; ++run)
+            {
+                size += run_length(counts_first[run]);
+            }
+            sizes[chunk + 1] = size;
+        };
+        run_chunks(policy, num_chunks, add_lengths);
+
+        std::vector<FwdIter> dest_chunk;
+        dest_chunk.reserve(num_chunks + 1);
+        dest_chunk.push_back(dest);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            dest_chunk.push_back(
+                std::next(dest_chunk.back(), sizes[chunk + 1]));
+        }
+
+        // step 2
+        auto write_runs = [&](std::size_t chunk) {
+            std::size_t const end = chunk_begin(chunk + 1);
+            FwdIter out = dest_chunk[chunk];
+            for (std::size_t run = chunk_begin(chunk); run != end; ++run)
+            {
+                out = std::fill_n(
+                    out, run_length(counts_first[run]), values_first[run]);
+            }
+        };
+        run_chunks(policy, num_chunks, write_runs);
+
+        return dest_chunk.back();
+    }
+
+    template <typename FwdIter>
+    struct run_length_decode
+      : public algorithm<run_length_decode<FwdIter>, FwdIter>
+    {
+        run_length_decode()
+          : run_length_decode::algorithm("run_length_decode")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2>
+        static FwdIter sequential(ExPolicy, RandIter1 values_first,
+            RandIter1 values_last, RandIter2 counts_first, FwdIter dest)
+        {
+            return sequential_run_length_decode(
+                values_first, values_last, counts_first, dest);
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, RandIter1 values_first, RandIter1 values_last,
+            RandIter2 counts_first, FwdIter dest)
+        {
+            std::size_t const num_runs =
+                std::distance(values_first, values_last);
+            if (num_runs == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            return run_length_parallel<ExPolicy, FwdIter>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [values_first, num_runs, counts_first, dest](auto& p) {
+                    return run_length_decode_impl(
+                        p, values_first, num_runs, counts_first, dest);
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::run_length_encode
+    inline constexpr struct run_length_encode_t final
+      : pika::detail::tag_parallel_algorithm<run_length_encode_t>
+    {
+    private:
+        template <typename I, typename O1, typename O2>
+        using result_type =
+            pika::parallel::detail::in_out_out_result<I, O1, O2>;
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename FwdIter3,
+            typename Pred = pika::parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            result_type<RandIter, FwdIter2, FwdIter3>>::type
+        tag_fallback_invoke(pika::run_length_encode_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter2 values_dest,
+            FwdIter3 counts_dest, Pred&& pred = Pred())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value &&
+                    pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::run_length_encode<
+                result_type<RandIter, FwdIter2, FwdIter3>>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    values_dest, counts_dest, PIKA_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename FwdIter3,
+            typename Pred = pika::parallel::detail::equal_to,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<FwdIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend result_type<FwdIter1, FwdIter2, FwdIter3> tag_fallback_invoke(
+            pika::run_length_encode_t, FwdIter1 first, FwdIter1 last,
+            FwdIter2 values_dest, FwdIter3 counts_dest, Pred&& pred = Pred())
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value &&
+                    pika::traits::is_forward_iterator<FwdIter2>::value &&
+                    pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::run_length_encode<
+                result_type<FwdIter1, FwdIter2, FwdIter3>>()
+                .call(pika::execution::seq, first, last, values_dest,
+                    counts_dest, PIKA_FORWARD(Pred, pred));
+        }
+    } run_length_encode{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::run_length_decode
+    inline constexpr struct run_length_decode_t final
+      : pika::detail::tag_parallel_algorithm<run_length_decode_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(pika::run_length_decode_t, ExPolicy&& policy,
+            RandIter1 values_first, RandIter1 values_last,
+            RandIter2 counts_first, FwdIter dest)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::run_length_decode<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), values_first, values_last,
+                counts_first, dest);
+        }
+
+        // clang-format off
+        template <typename InIter1, typename InIter2, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter1>::value &&
+                pika::traits::is_iterator<InIter2>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(pika::run_length_decode_t,
+            InIter1 values_first, InIter1 values_last, InIter2 counts_first,
+            OutIter dest)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter1>::value &&
+                    pika::traits::is_input_iterator<InIter2>::value,
+                "Requires at least input iterator.");
+
+            return pika::parallel::detail::run_length_decode<OutIter>().call(
+                pika::execution::seq, values_first, values_last, counts_first,
+                dest);
+        }
+    } run_length_decode{};
+}    // namespace pika
+
+#endif    // DOXYGEN
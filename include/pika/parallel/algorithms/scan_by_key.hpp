@@ -0,0 +1,737 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/scan_by_key.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/reduce_by_key.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/scan_look_back_partitioner.hpp>
+#include <pika/parallel/util/scan_partitioner.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    // inclusive_scan_by_key, exclusive_scan_by_key
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // The partial result of a segmented scan is the value accumulated
+        // since the last start of a series of keys together with a flag
+        // telling whether a series started at all. The partial result of a
+        // partition which contains the start of a series does not depend on
+        // the partitions to its left.
+        template <typename T, typename Func>
+        auto make_scan_by_key_combine(Func& func)
+        {
+            return [func](std::pair<T, bool> const& lhs,
+                       std::pair<T, bool> const& rhs) mutable
+                   -> std::pair<T, bool> {
+                if (rhs.second)
+                {
+                    return rhs;
+                }
+                return std::pair<T, bool>(
+                    PIKA_INVOKE(func, lhs.first, rhs.first), lhs.second);
+            };
+        }
+
+        // Runs the given segmented scan through the scan partitioner, the
+        // function objects operate on zip iterators of the values, the key
+        // states and the destination.
+        template <typename ExPolicy, typename T, typename FwdIter1,
+            typename FwdIter2, typename FS, typename F1, typename Op,
+            typename F3>
+        FwdIter2 scan_by_key_partitioned(ExPolicy& policy,
+            FwdIter1 values_first,
+            std::vector<reduce_key_series_states>& key_state,
+            FwdIter2 values_output, std::pair<T, bool> init, FS&& single_pass,
+            F1&& f1, Op&& op, F3&& f3)
+        {
+            using namespace pika::parallel::detail;
+            using policy_type = std::decay_t<ExPolicy>;
+            using partial_type = std::pair<T, bool>;
+
+            std::size_t const count = key_state.size();
+            FwdIter2 final_dest = std::next(values_output, count);
+
+            auto first = pika::util::make_zip_iterator(
+                values_first, key_state.begin(), values_output);
+
+            if constexpr (use_scan_look_back_v<policy_type, FwdIter1,
+                              FwdIter2, partial_type>)
+            {
+                // all chunks are scanned in a single pass
+                scan_look_back_partitioner<policy_type, FwdIter2,
+                    partial_type>::call(policy, first, count,
+                    PIKA_MOVE(init), PIKA_FORWARD(FS, single_pass),
+                    PIKA_FORWARD(F1, f1), PIKA_FORWARD(Op, op),
+                    PIKA_FORWARD(F3, f3),
+                    [final_dest]() { return final_dest; });
+            }
+            else
+            {
+                scan_partitioner<policy_type, FwdIter2, partial_type>::call(
+                    policy, first, count, PIKA_MOVE(init),
+                    PIKA_FORWARD(F1, f1), PIKA_FORWARD(Op, op),
+                    PIKA_FORWARD(F3, f3),
+                    [final_dest](std::vector<partial_type>&&,
+                        std::vector<pika::future<void>>&& data) {
+                        // make sure iterators embedded in function object
+                        // that is attached to futures are invalidated
+                        data.clear();
+                        return final_dest;
+                    });
+            }
+            return final_dest;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The key states mark the starts of the series of equal keys, the
+        // values are scanned by a segmented operator which restarts at every
+        // start of a series.
+        template <typename ExPolicy, typename RanIter, typename FwdIter1,
+            typename FwdIter2, typename Compare, typename Func>
+        FwdIter2 inclusive_scan_by_key_impl(ExPolicy& policy,
+            RanIter key_first, RanIter key_last, FwdIter1 values_first,
+            FwdIter2 values_output, Compare& comp, Func& func)
+        {
+            using std::get;
+            using value_type =
+                typename std::iterator_traits<FwdIter1>::value_type;
+            using partial_type = std::pair<value_type, bool>;
+
+            std::vector<reduce_key_series_states> key_state;
+            compute_key_series_states(
+                policy, key_first, key_last, key_state, comp);
+
+            // scans a chunk when its prefix is known
+            auto single_pass = [func](auto part_begin, std::size_t part_size,
+                                   partial_type prefix) mutable
+                -> partial_type {
+                auto iters = part_begin.get_iterator_tuple();
+                auto val = get<0>(iters);
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                value_type acc = PIKA_MOVE(prefix.first);
+                for (/**/; part_size-- != 0; (void) ++val, ++state, ++dst)
+                {
+                    if (state->start)
+                    {
+                        acc = *val;
+                    }
+                    else
+                    {
+                        acc = PIKA_INVOKE(func, acc, *val);
+                    }
+                    *dst = acc;
+                }
+                return partial_type(PIKA_MOVE(acc), true);
+            };
+
+            // scans a chunk on its own
+            auto f1 = [func](auto part_begin,
+                          std::size_t part_size) mutable -> partial_type {
+                auto iters = part_begin.get_iterator_tuple();
+                auto val = get<0>(iters);
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                bool started = state->start;
+                value_type acc = *val;
+                *dst = acc;
+                while (--part_size != 0)
+                {
+                    ++val;
+                    ++state;
+                    ++dst;
+                    if (state->start)
+                    {
+                        acc = *val;
+                        started = true;
+                    }
+                    else
+                    {
+                        acc = PIKA_INVOKE(func, acc, *val);
+                    }
+                    *dst = acc;
+                }
+                return partial_type(PIKA_MOVE(acc), started);
+            };
+
+            // combines the elements before the first start of a series in a
+            // chunk with the prefix of the chunk
+            auto f3 = [func](auto part_begin, std::size_t part_size,
+                          partial_type prefix) mutable -> void {
+                auto iters = part_begin.get_iterator_tuple();
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                for (/**/; part_size-- != 0 && !state->start;
+                     (void) ++state, ++dst)
+                {
+                    *dst = PIKA_INVOKE(func, prefix.first, *dst);
+                }
+            };
+
+            // the first key always starts a series
+            partial_type init(*values_first, true);
+
+            return scan_by_key_partitioned(policy, values_first, key_state,
+                values_output, PIKA_MOVE(init), PIKA_MOVE(single_pass),
+                PIKA_MOVE(f1), make_scan_by_key_combine<value_type>(func),
+                PIKA_MOVE(f3));
+        }
+
+        // The partial results carry the inclusive sums, every series of keys
+        // starts with init.
+        template <typename ExPolicy, typename RanIter, typename FwdIter1,
+            typename FwdIter2, typename T, typename Compare, typename Func>
+        FwdIter2 exclusive_scan_by_key_impl(ExPolicy& policy,
+            RanIter key_first, RanIter key_last, FwdIter1 values_first,
+            FwdIter2 values_output, T const& init, Compare& comp, Func& func)
+        {
+            using std::get;
+            using value_type =
+                typename std::iterator_traits<FwdIter1>::value_type;
+            using partial_type = std::pair<T, bool>;
+
+            std::vector<reduce_key_series_states> key_state;
+            compute_key_series_states(
+                policy, key_first, key_last, key_state, comp);
+
+            // scans a chunk when its prefix is known, the values are read
+            // before the results are written to allow for in-place scans
+            auto single_pass = [func, init](auto part_begin,
+                                   std::size_t part_size,
+                                   partial_type prefix) mutable
+                -> partial_type {
+                auto iters = part_begin.get_iterator_tuple();
+                auto val = get<0>(iters);
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                T acc = PIKA_MOVE(prefix.first);
+                for (/**/; part_size-- != 0; (void) ++val, ++state, ++dst)
+                {
+                    value_type v = *val;
+                    if (state->start)
+                    {
+                        *dst = init;
+                        acc = PIKA_INVOKE(func, init, PIKA_MOVE(v));
+                    }
+                    else
+                    {
+                        *dst = acc;
+                        acc = PIKA_INVOKE(func, acc, PIKA_MOVE(v));
+                    }
+                }
+                return partial_type(PIKA_MOVE(acc), true);
+            };
+
+            // scans a chunk on its own, the results before the first start
+            // of a series are stored without the prefix of the chunk, the
+            // first of them is written by f3
+            auto f1 = [func, init](auto part_begin,
+                          std::size_t part_size) mutable -> partial_type {
+                auto iters = part_begin.get_iterator_tuple();
+                auto val = get<0>(iters);
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                bool started = state->start;
+                T acc = init;
+                if (started)
+                {
+                    value_type v = *val;
+                    *dst = init;
+                    acc = PIKA_INVOKE(func, init, PIKA_MOVE(v));
+                }
+                else
+                {
+                    acc = *val;
+                }
+                while (--part_size != 0)
+                {
+                    ++val;
+                    ++state;
+                    ++dst;
+                    value_type v = *val;
+                    if (state->start)
+                    {
+                        *dst = init;
+                        acc = PIKA_INVOKE(func, init, PIKA_MOVE(v));
+                        started = true;
+                    }
+                    else
+                    {
+                        *dst = acc;
+                        acc = PIKA_INVOKE(func, acc, PIKA_MOVE(v));
+                    }
+                }
+                return partial_type(PIKA_MOVE(acc), started);
+            };
+
+            // combines the elements before the first start of a series in a
+            // chunk with the prefix of the chunk
+            auto f3 = [func](auto part_begin, std::size_t part_size,
+                          partial_type prefix) mutable -> void {
+                auto iters = part_begin.get_iterator_tuple();
+                auto state = get<1>(iters);
+                auto dst = get<2>(iters);
+
+                if (state->start)
+                {
+                    return;
+                }
+                *dst = prefix.first;
+                for (++state, ++dst; --part_size != 0 && !state->start;
+                     (void) ++state, ++dst)
+                {
+                    *dst = PIKA_INVOKE(func, prefix.first, *dst);
+                }
+            };
+
+            // the first key always starts a series
+            return scan_by_key_partitioned(policy, values_first, key_state,
+                values_output, partial_type(init, true),
+                PIKA_MOVE(single_pass), PIKA_MOVE(f1),
+                make_scan_by_key_combine<T>(func), PIKA_MOVE(f3));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Runs the given scan on the calling thread for synchronous policies
+        // and on a new task for asynchronous policies.
+        template <typename ExPolicy, typename FwdIter2, typename F>
+        typename parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+        scan_by_key_parallel(ExPolicy&& policy, F&& f)
+        {
+            using algorithm_result =
+                parallel::detail::algorithm_result<ExPolicy, FwdIter2>;
+
+            try
+            {
+                if constexpr (pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, f = PIKA_FORWARD(F, f)]() mutable
+                        -> FwdIter2 {
+                            try
+                            {
+                                auto p = policy(pika::execution::non_task);
+                                return f(p);
+                            }
+                            catch (std::bad_alloc const&)
+                            {
+                                throw;
+                            }
+                            catch (pika::exception_list const&)
+                            {
+                                throw;
+                            }
+                            catch (...)
+                            {
+                                throw pika::exception_list(
+                                    std::current_exception());
+                            }
+                        }));
+                }
+                else
+                {
+                    return algorithm_result::get(f(policy));
+                }
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    parallel::detail::handle_exception<ExPolicy,
+                        FwdIter2>::call(std::current_exception()));
+            }
+        }
+
+        template <typename FwdIter2>
+        struct inclusive_scan_by_key
+          : public parallel::detail::algorithm<inclusive_scan_by_key<FwdIter2>,
+                FwdIter2>
+        {
+            inclusive_scan_by_key()
+              : inclusive_scan_by_key::algorithm("inclusive_scan_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename FwdIter1,
+                typename Compare, typename Func>
+            static FwdIter2 sequential(ExPolicy&&, RanIter key_first,
+                RanIter key_last, FwdIter1 values_first,
+                FwdIter2 values_output, Compare&& comp, Func&& func)
+            {
+                using value_type =
+                    typename std::iterator_traits<FwdIter1>::value_type;
+
+                if (key_first == key_last)
+                {
+                    return values_output;
+                }
+
+                value_type acc = *values_first;
+                *values_output = acc;
+                for (RanIter prev = key_first++; key_first != key_last;
+                     prev = key_first++)
+                {
+                    ++values_first, ++values_output;
+                    if (PIKA_INVOKE(comp, *prev, *key_first))
+                    {
+                        acc = PIKA_INVOKE(func, acc, *values_first);
+                    }
+                    else
+                    {
+                        acc = *values_first;
+                    }
+                    *values_output = acc;
+                }
+                return ++values_output;
+            }
+
+            template <typename ExPolicy, typename RanIter, typename FwdIter1,
+                typename Compare, typename Func>
+            static typename parallel::detail::algorithm_result<ExPolicy,
+                FwdIter2>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                FwdIter1 values_first, FwdIter2 values_output, Compare&& comp,
+                Func&& func)
+            {
+                if (key_first == key_last)
+                {
+                    return parallel::detail::algorithm_result<ExPolicy,
+                        FwdIter2>::get(PIKA_MOVE(values_output));
+                }
+
+                return scan_by_key_parallel<ExPolicy, FwdIter2>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [key_first, key_last, values_first, values_output,
+                        comp = PIKA_FORWARD(Compare, comp),
+                        func = PIKA_FORWARD(Func, func)](auto& p) mutable {
+                        return inclusive_scan_by_key_impl(p, key_first,
+                            key_last, values_first, values_output, comp, func);
+                    });
+            }
+        };
+
+        template <typename FwdIter2>
+        struct exclusive_scan_by_key
+          : public parallel::detail::algorithm<exclusive_scan_by_key<FwdIter2>,
+                FwdIter2>
+        {
+            exclusive_scan_by_key()
+              : exclusive_scan_by_key::algorithm("exclusive_scan_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename FwdIter1,
+                typename T, typename Compare, typename Func>
+            static FwdIter2 sequential(ExPolicy&&, RanIter key_first,
+                RanIter key_last, FwdIter1 values_first,
+                FwdIter2 values_output, T const& init, Compare&& comp,
+                Func&& func)
+            {
+                using value_type =
+                    typename std::iterator_traits<FwdIter1>::value_type;
+
+                if (key_first == key_last)
+                {
+                    return values_output;
+                }
+
+                // the values are read before the results are written to allow
+                // for in-place scans
+                value_type v = *values_first;
+                *values_output = init;
+                T acc = PIKA_INVOKE(func, init, PIKA_MOVE(v));
+                for (RanIter prev = key_first++; key_first != key_last;
+                     prev = key_first++)
+                {
+                    ++values_first, ++values_output;
+                    v = *values_first;
+                    if (PIKA_INVOKE(comp, *prev, *key_first))
+                    {
+                        *values_output = acc;
+                        acc = PIKA_INVOKE(func, acc, PIKA_MOVE(v));
+                    }
+                    else
+                    {
+                        *values_output = init;
+                        acc = PIKA_INVOKE(func, init, PIKA_MOVE(v));
+                    }
+                }
+                return ++values_output;
+            }
+
+            template <typename ExPolicy, typename RanIter, typename FwdIter1,
+                typename T, typename Compare, typename Func>
+            static typename parallel::detail::algorithm_result<ExPolicy,
+                FwdIter2>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                FwdIter1 values_first, FwdIter2 values_output, T const& init,
+                Compare&& comp, Func&& func)
+            {
+                if (key_first == key_last)
+                {
+                    return parallel::detail::algorithm_result<ExPolicy,
+                        FwdIter2>::get(PIKA_MOVE(values_output));
+                }
+
+                return scan_by_key_parallel<ExPolicy, FwdIter2>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [key_first, key_last, values_first, values_output, init,
+                        comp = PIKA_FORWARD(Compare, comp),
+                        func = PIKA_FORWARD(Func, func)](auto& p) mutable {
+                        return exclusive_scan_by_key_impl(p, key_first,
+                            key_last, values_first, values_output, init, comp,
+                            func);
+                    });
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Inclusive scan by key performs an inclusive scan on elements supplied
+    /// in key/value pairs. The scan restarts for each set of equal
+    /// consecutive keys in [key_first, key_last): the value assigned to the
+    /// i-th output element is the
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(func, *(values_first + j), ...,
+    /// *(values_first + i)), where j is the position of the first of the
+    /// consecutive keys which are equal to the i-th key.
+    /// The number of keys supplied must match the number of values.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of the
+    ///         predicates \a comp and \a func.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Compare     The type of the optional function/function object to
+    ///                     use to compare keys (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Assumed to be std::plus otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param values_output Refers to the start output location for the
+    ///                     values produced by the algorithm.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type
+    ///                     Compare, when contextually converted to bool,
+    ///                     yields true if the two keys passed to it are
+    ///                     equal, and false otherwise.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked for the values of each set of
+    ///                     equal consecutive keys. This is a binary
+    ///                     associative operation. The signature of this
+    ///                     function should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The types \a Type1 \a Ret must be
+    ///                     such that an object of type \a FwdIter1 can be
+    ///                     dereferenced and then implicitly converted to any
+    ///                     of those types.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a inclusive_scan_by_key algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy
+    ///           and returns \a FwdIter2 otherwise.
+    ///           The algorithm returns the output iterator to the element in
+    ///           the destination range, one past the last element written.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename FwdIter1,
+        typename FwdIter2,
+        typename Compare =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Func =
+            std::plus<typename std::iterator_traits<FwdIter1>::value_type>,
+        PIKA_CONCEPT_REQUIRES_(pika::is_execution_policy<ExPolicy>::value&&
+                pika::traits::is_iterator<RanIter>::value&&
+                    pika::traits::is_iterator<FwdIter1>::value&&
+                        pika::traits::is_iterator<FwdIter2>::value)>
+    typename parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    inclusive_scan_by_key(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, FwdIter1 values_first, FwdIter2 values_output,
+        Compare&& comp = Compare(), Func&& func = Func())
+    {
+        static_assert((pika::traits::is_random_access_iterator_v<RanIter>) &&
+                (pika::traits::is_forward_iterator_v<FwdIter1>) &&
+                (pika::traits::is_forward_iterator_v<FwdIter2>),
+            "iterators : Random_access for keys and forward for values.");
+
+        return detail::inclusive_scan_by_key<FwdIter2>().call(
+            PIKA_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
+            values_output, PIKA_FORWARD(Compare, comp),
+            PIKA_FORWARD(Func, func));
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Exclusive scan by key performs an exclusive scan on elements supplied
+    /// in key/value pairs. The scan restarts with \a init for each set of
+    /// equal consecutive keys in [key_first, key_last): the value assigned
+    /// to the i-th output element is the
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(func, init, *(values_first + j), ...,
+    /// *(values_first + i - 1)), where j is the position of the first of the
+    /// consecutive keys which are equal to the i-th key.
+    /// The number of keys supplied must match the number of values.
+    ///
+    /// \note   Complexity: O(\a key_last - \a key_first) applications of the
+    ///         predicates \a comp and \a func.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam T           The type of the value to be used as the initial
+    ///                     value of each set of equal consecutive keys
+    ///                     (deduced).
+    /// \tparam Compare     The type of the optional function/function object to
+    ///                     use to compare keys (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Assumed to be std::plus otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param values_output Refers to the start output location for the
+    ///                     values produced by the algorithm.
+    /// \param init         The initial value of the scan of each set of equal
+    ///                     consecutive keys.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type
+    ///                     Compare, when contextually converted to bool,
+    ///                     yields true if the two keys passed to it are
+    ///                     equal, and false otherwise.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked for the values of each set of
+    ///                     equal consecutive keys. This is a binary
+    ///                     associative operation. The signature of this
+    ///                     function should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The types \a Type1 \a Ret must be
+    ///                     such that objects of type \a T and objects of type
+    ///                     \a FwdIter1 dereferenced can be implicitly
+    ///                     converted to any of those types.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a exclusive_scan_by_key algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy
+    ///           and returns \a FwdIter2 otherwise.
+    ///           The algorithm returns the output iterator to the element in
+    ///           the destination range, one past the last element written.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename FwdIter1,
+        typename FwdIter2, typename T,
+        typename Compare =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        typename Func = std::plus<T>,
+        PIKA_CONCEPT_REQUIRES_(pika::is_execution_policy<ExPolicy>::value&&
+                pika::traits::is_iterator<RanIter>::value&&
+                    pika::traits::is_iterator<FwdIter1>::value&&
+                        pika::traits::is_iterator<FwdIter2>::value)>
+    typename parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    exclusive_scan_by_key(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, FwdIter1 values_first, FwdIter2 values_output,
+        T init, Compare&& comp = Compare(), Func&& func = Func())
+    {
+        static_assert((pika::traits::is_random_access_iterator_v<RanIter>) &&
+                (pika::traits::is_forward_iterator_v<FwdIter1>) &&
+                (pika::traits::is_forward_iterator_v<FwdIter2>),
+            "iterators : Random_access for keys and forward for values.");
+
+        return detail::exclusive_scan_by_key<FwdIter2>().call(
+            PIKA_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
+            values_output, PIKA_MOVE(init), PIKA_FORWARD(Compare, comp),
+            PIKA_FORWARD(Func, func));
+    }
+}    // namespace pika
@@ -17,6 +17,7 @@
 #include <pika/parallel/algorithms/detail/search.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/searchers.hpp>
 
 #include <cstddef>
 #include <iterator>
@@ -297,6 +298,76 @@ namespace pika {
     typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
     search_n(ExPolicy&& policy, FwdIter first, std::size_t count,
         FwdIter2 s_first, FwdIter2 s_last, Pred&& op = Pred());
+    /// Searches the range [first, last) for the pattern the searcher has
+    /// been constructed with, e.g. a \a pika::boyer_moore_horspool_searcher
+    /// or one of the searchers of the standard library.
+    ///
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     the searcher.
+    /// \tparam Searcher    The type of the searcher (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param searcher     The searcher invoked as searcher(first, last).
+    ///
+    /// \returns  The \a search algorithm returns the first element of the
+    ///           pair returned by the searcher, \a last if the pattern is
+    ///           not found.
+    ///
+    template <typename FwdIter, typename Searcher>
+    FwdIter search(FwdIter first, FwdIter last, Searcher const& searcher);
+
+    /// Searches the range [first, last) for the pattern the searcher has
+    /// been constructed with. Searchers providing the length of their pattern
+    /// through a member function pattern_size(), such as
+    /// \a pika::boyer_moore_horspool_searcher, search the chunks of the
+    /// range concurrently, all other searchers are invoked once on the whole
+    /// range.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of
+    ///                     the searcher.
+    /// \tparam Searcher    The type of the searcher (deduced). It has to be
+    ///                     copy constructible, the copies are invoked
+    ///                     concurrently.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param searcher     The searcher invoked on subranges of
+    ///                     [first, last).
+    ///
+    /// \returns  The \a search algorithm returns a \a pika::future<FwdIter> if
+    ///           the execution policy is of type \a task_execution_policy and
+    ///           returns \a FwdIter otherwise. It returns an iterator to the
+    ///           first occurrence of the pattern, \a last if the pattern is
+    ///           not found and \a first if the pattern is empty.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Searcher>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    search(ExPolicy&& policy, FwdIter first, FwdIter last,
+        Searcher const& searcher);
+
+    /// Searches the range [first, first + count) for the pattern the searcher
+    /// has been constructed with, see \a search.
+    ///
+    /// \returns  The \a search_n algorithm returns a \a pika::future<FwdIter>
+    ///           if the execution policy is of type \a task_execution_policy
+    ///           and returns \a FwdIter otherwise. It returns an iterator to
+    ///           the first occurrence of the pattern, \a first if the pattern
+    ///           is empty or not found.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Searcher>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+    search_n(ExPolicy&& policy, FwdIter first, std::size_t count,
+        Searcher const& searcher);
 }    // namespace pika
 
 #else
@@ -354,6 +425,36 @@ namespace pika {
                 pika::parallel::detail::projection_identity{});
         }
 
+        // clang-format off
+        template <typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(pika::search_t, FwdIter first,
+            FwdIter last, Searcher const& searcher)
+        {
+            return pika::parallel::detail::search_searcher<FwdIter>().call(
+                pika::execution::seq, first, last, searcher, last);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                is_execution_policy<ExPolicy>::value &&
+                traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend
+            typename parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+            tag_fallback_invoke(pika::search_t, ExPolicy&& policy,
+                FwdIter first, FwdIter last, Searcher const& searcher)
+        {
+            return pika::parallel::detail::search_searcher<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, searcher, last);
+        }
     } search{};
 
     inline constexpr struct search_n_t final
@@ -409,6 +510,38 @@ namespace pika {
                 pika::parallel::detail::projection_identity{});
         }
 
+        // clang-format off
+        template <typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(pika::search_n_t, FwdIter first,
+            std::size_t count, Searcher const& searcher)
+        {
+            return pika::parallel::detail::search_searcher<FwdIter>().call(
+                pika::execution::seq, first, std::next(first, count),
+                searcher, first);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Searcher,
+            PIKA_CONCEPT_REQUIRES_(
+                is_execution_policy<ExPolicy>::value &&
+                traits::is_forward_iterator<FwdIter>::value &&
+                pika::detail::is_invocable_v<Searcher const&, FwdIter, FwdIter>
+            )>
+        // clang-format on
+        friend
+            typename parallel::detail::algorithm_result<ExPolicy, FwdIter>::type
+            tag_fallback_invoke(pika::search_n_t, ExPolicy&& policy,
+                FwdIter first, std::size_t count, Searcher const& searcher)
+        {
+            return pika::parallel::detail::search_searcher<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, std::next(first, count),
+                searcher, first);
+        }
     } search_n{};
 }    // namespace pika
 
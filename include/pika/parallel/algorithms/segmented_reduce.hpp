@@ -0,0 +1,619 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/segmented_reduce.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Reduces many independent segments of a range in one call. The offsets
+    /// in the range [offsets_first, offsets_last) delimit the segments, like
+    /// the row pointers of a matrix in compressed sparse row format delimit
+    /// its rows: for every two consecutive offsets o1 and o2 the value
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(op, init, *(first + o1), ...,
+    /// *(first + o2 - 1)) is written to the next element of the destination
+    /// range. Empty segments yield \a init.
+    ///
+    /// \note   Complexity: O(N + S) applications of \a op, where
+    ///         N = *(offsets_last - 1) - *offsets_first and S is the number
+    ///         of segments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam OffsetIter  The type of the offset iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator, its value type must be an
+    ///                     integral type.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    /// \tparam Reduce      The type of the binary function object used for
+    ///                     the reduction operation.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the offsets refer to.
+    /// \param offsets_first Refers to the beginning of the sequence of
+    ///                     non-decreasing offsets delimiting the segments.
+    /// \param offsets_last Refers to the end of the sequence of offsets.
+    /// \param dest         Refers to the beginning of the destination range,
+    ///                     which receives one value per segment.
+    /// \param init         The initial value for the reduction of every
+    ///                     segment.
+    /// \param op           Specifies the associative function (or function
+    ///                     object) which will be invoked to combine the
+    ///                     elements of a segment with \a init and with the
+    ///                     intermediate results. The signature of this
+    ///                     function should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread. The work
+    /// is split into chunks of equal length along the merge path of the
+    /// segment ends and the elements, such that every chunk reduces about
+    /// the same number of elements and segments regardless of how unevenly
+    /// the elements are distributed over the segments. The partial results
+    /// of the segments spanning several chunks are combined in order.
+    ///
+    /// \returns  The \a segmented_reduce algorithm returns a
+    ///           \a pika::future<RandIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy
+    ///           and returns \a RandIter2 otherwise. The algorithm returns
+    ///           the iterator past the last written value.
+    ///
+    template <typename ExPolicy, typename RandIter, typename OffsetIter,
+        typename RandIter2, typename T, typename Reduce = std::plus<>>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter2>::type
+    segmented_reduce(ExPolicy&& policy, RandIter first,
+        OffsetIter offsets_first, OffsetIter offsets_last, RandIter2 dest,
+        T init, Reduce&& op = Reduce());
+
+    /// Reduces the segments of a range delimited by offsets like
+    /// \a segmented_reduce, the elements are transformed by \a conv before
+    /// being reduced: for every two consecutive offsets o1 and o2 the value
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(op, init, conv(*(first + o1)), ...,
+    /// conv(*(first + o2 - 1))) is written to the next element of the
+    /// destination range.
+    ///
+    /// \note   Complexity: O(N + S) applications of \a op and O(N)
+    ///         applications of \a conv, where
+    ///         N = *(offsets_last - 1) - *offsets_first and S is the number
+    ///         of segments.
+    ///
+    /// \tparam Convert     The type of the unary function object used to
+    ///                     transform the elements of the input sequence.
+    ///
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements of the
+    ///                     segments. The result of \a conv must be
+    ///                     convertible to \a T.
+    ///
+    /// The other parameters and the result are the ones of
+    /// \a segmented_reduce.
+    ///
+    template <typename ExPolicy, typename RandIter, typename OffsetIter,
+        typename RandIter2, typename T, typename Reduce, typename Convert>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter2>::type
+    segmented_transform_reduce(ExPolicy&& policy, RandIter first,
+        OffsetIter offsets_first, OffsetIter offsets_last, RandIter2 dest,
+        T init, Reduce&& op, Convert&& conv);
+
+    /// Multiplies a sparse matrix in compressed sparse row format with a
+    /// dense vector, y = A x. The row offsets
+    /// [row_offsets_first, row_offsets_last) delimit the nonzero elements of
+    /// the rows of A: the nonzero elements of row i are
+    /// values[j] for j in [row_offsets_first[i], row_offsets_first[i + 1]),
+    /// located in the columns column_indices[j]. Every row i writes
+    /// y[i] = sum(values[j] * x[column_indices[j]]).
+    ///
+    /// The products are summed by \a segmented_transform_reduce, which
+    /// balances the nonzero elements and the rows over the chunks such that
+    /// rows of very different lengths do not leave cores idle.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam OffsetIter  The type of the row offset iterators (deduced),
+    ///                     a random access iterator with an integral value
+    ///                     type.
+    /// \tparam IndexIter   The type of the column index iterator (deduced),
+    ///                     a random access iterator with an integral value
+    ///                     type.
+    /// \tparam ValueIter   The type of the iterator of the nonzero values
+    ///                     (deduced), a random access iterator.
+    /// \tparam XIter       The type of the iterator of the dense vector
+    ///                     multiplied with (deduced), a random access
+    ///                     iterator.
+    /// \tparam YIter       The type of the iterator of the result vector
+    ///                     (deduced), a random access iterator. Its value
+    ///                     type is the type the products are summed in.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param row_offsets_first Refers to the beginning of the row offsets,
+    ///                     the number of rows is one less than their number.
+    /// \param row_offsets_last Refers to the end of the row offsets.
+    /// \param column_indices Refers to the column indices of the nonzero
+    ///                     elements.
+    /// \param values       Refers to the nonzero elements.
+    /// \param x            Refers to the vector multiplied with.
+    /// \param y            Refers to the result vector, one element per row.
+    ///
+    /// \returns  The \a spmv algorithm returns a \a pika::future<YIter> if
+    ///           the execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a YIter otherwise. The
+    ///           algorithm returns the iterator past the last row of \a y.
+    ///
+    template <typename ExPolicy, typename OffsetIter, typename IndexIter,
+        typename ValueIter, typename XIter, typename YIter>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, YIter>::type
+    spmv(ExPolicy&& policy, OffsetIter row_offsets_first,
+        OffsetIter row_offsets_last, IndexIter column_indices,
+        ValueIter values, XIter x, YIter y);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/merge_path.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_reduce
+    /// \cond NOINTERNAL
+
+    // The elements of the segments are accessed through elements(segment,
+    // pos), which returns an iterator referring to the element at position
+    // pos of the given segment, the elements of a segment being consecutive.
+    // The segments of a single range are positions relative to its first
+    // element.
+    template <typename RandIter>
+    struct segmented_range_elements
+    {
+        RandIter first;
+
+        RandIter operator()(std::size_t, std::size_t pos) const
+        {
+            return first + pos;
+        }
+    };
+
+    // folds the converted elements [begin, end) of a segment into init
+    template <typename Elements, typename T, typename Reduce, typename Convert>
+    T segmented_reduce_fold(Elements& elements, std::size_t segment,
+        std::size_t begin, std::size_t end, T init, Reduce& r, Convert& conv)
+    {
+        if (begin == end)
+        {
+            return init;
+        }
+
+        auto it = elements(segment, begin);
+        for (/**/; begin != end; (void) ++begin, ++it)
+        {
+            init = PIKA_INVOKE(r, PIKA_MOVE(init), PIKA_INVOKE(conv, *it));
+        }
+        return init;
+    }
+
+    // the reduction of a non-empty range of elements of a segment without
+    // an initial value
+    template <typename T, typename Elements, typename Reduce, typename Convert>
+    T segmented_reduce_partial(Elements& elements, std::size_t segment,
+        std::size_t begin, std::size_t end, Reduce& r, Convert& conv)
+    {
+        T init = PIKA_INVOKE(conv, *elements(segment, begin));
+        return segmented_reduce_fold(elements, segment, begin + 1, end,
+            PIKA_MOVE(init), r, conv);
+    }
+
+    template <typename Elements, typename OffsetIter, typename RandIter2,
+        typename T, typename Reduce, typename Convert>
+    RandIter2 sequential_segmented_reduce(Elements elements,
+        OffsetIter offsets, std::size_t num_segments, RandIter2 dest,
+        T const& init, Reduce& r, Convert& conv)
+    {
+        for (std::size_t i = 0; i != num_segments; (void) ++i, ++dest)
+        {
+            *dest = segmented_reduce_fold(elements, i,
+                std::size_t(offsets[i]), std::size_t(offsets[i + 1]), init, r,
+                conv);
+        }
+        return dest;
+    }
+
+    // What a chunk leaves to the segments it shares with its neighbors: the
+    // reduction of its elements of the first segment if that started in an
+    // earlier chunk and ends in this one, and the reduction of its elements
+    // of the segment it does not finish.
+    template <typename T>
+    struct segmented_reduce_chunk
+    {
+        std::size_t first_segment = 0;
+        bool finishes_earlier_segment = false;
+        std::optional<T> head;
+        std::optional<T> tail;
+    };
+
+    // The merge path of the segment ends and the elements, a segment end
+    // being ordered before the elements following it, is split into chunks
+    // of equal length. A chunk finds its start and end by a binary search
+    // along the path and reduces the segments it holds completely into the
+    // destination. The parts of the segments spanning several chunks are
+    // combined in order once all chunks are done.
+    template <typename ExPolicy, typename Elements, typename OffsetIter,
+        typename RandIter2, typename T, typename Reduce, typename Convert>
+    typename algorithm_result<ExPolicy, RandIter2>::type
+    parallel_segmented_reduce(ExPolicy&& policy, Elements elements,
+        OffsetIter offsets, std::size_t num_segments, RandIter2 dest,
+        T const& init, Reduce&& r, Convert&& conv)
+    {
+        using chunk_type = segmented_reduce_chunk<T>;
+
+        std::size_t const base = offsets[0];
+        std::size_t const num_elements =
+            std::size_t(offsets[num_segments]) - base;
+        std::size_t const path_length = num_segments + num_elements;
+
+        // the number of segment ends before position k of the path
+        auto segment_ends = [offsets, num_segments, num_elements, base](
+                                std::size_t k) {
+            std::less<std::size_t> comp;
+            auto proj1 = [](auto offset) { return std::size_t(offset); };
+            projection_identity proj2;
+            return merge_path_split(std::next(offsets), num_segments,
+                pika::util::make_counting_iterator(base), num_elements, k,
+                comp, proj1, proj2);
+        };
+
+        auto f1 = [elements, offsets, dest, init, base, r, conv, segment_ends](
+                      auto, std::size_t part_size,
+                      std::size_t base_idx) mutable -> chunk_type {
+            std::size_t segment = segment_ends(base_idx);
+            std::size_t const last_segment =
+                segment_ends(base_idx + part_size);
+            std::size_t pos = base + base_idx - segment;
+            std::size_t const last_pos =
+                base + base_idx + part_size - last_segment;
+
+            chunk_type chunk;
+            chunk.first_segment = segment;
+            if (segment != last_segment && std::size_t(offsets[segment]) < pos)
+            {
+                chunk.finishes_earlier_segment = true;
+                std::size_t const end = offsets[segment + 1];
+                if (pos != end)
+                {
+                    chunk.head = segmented_reduce_partial<T>(
+                        elements, segment, pos, end, r, conv);
+                }
+                pos = end;
+                ++segment;
+            }
+
+            for (/**/; segment != last_segment; ++segment)
+            {
+                std::size_t const end = offsets[segment + 1];
+                dest[segment] = segmented_reduce_fold(
+                    elements, segment, pos, end, init, r, conv);
+                pos = end;
+            }
+
+            if (pos != last_pos)
+            {
+                chunk.tail = segmented_reduce_partial<T>(
+                    elements, segment, pos, last_pos, r, conv);
+            }
+            return chunk;
+        };
+
+        auto f2 = [dest, init, num_segments, r](
+                      std::vector<chunk_type>&& chunks) mutable -> RandIter2 {
+            // the reduction of the parts of the segment continuing into
+            // the next chunk
+            std::optional<T> carry;
+            for (chunk_type& chunk : chunks)
+            {
+                if (chunk.finishes_earlier_segment)
+                {
+                    T value = carry ? PIKA_MOVE(*carry) : init;
+                    if (chunk.head)
+                    {
+                        value = PIKA_INVOKE(
+                            r, PIKA_MOVE(value), PIKA_MOVE(*chunk.head));
+                    }
+                    dest[chunk.first_segment] = PIKA_MOVE(value);
+                    carry.reset();
+                }
+
+                if (chunk.tail)
+                {
+                    T value = carry ? PIKA_MOVE(*carry) : init;
+                    carry = PIKA_INVOKE(
+                        r, PIKA_MOVE(value), PIKA_MOVE(*chunk.tail));
+                }
+            }
+            return std::next(dest, num_segments);
+        };
+
+        return partitioner<ExPolicy, RandIter2, chunk_type>::call_with_index(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_counting_iterator(std::size_t(0)), path_length,
+            1, PIKA_MOVE(f1), make_chunk_values_reducer(PIKA_MOVE(f2)));
+    }
+
+    template <typename RandIter2>
+    struct segmented_reduce
+      : public algorithm<segmented_reduce<RandIter2>, RandIter2>
+    {
+        segmented_reduce()
+          : segmented_reduce::algorithm("segmented_reduce")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename OffsetIter,
+            typename T, typename Reduce, typename Convert>
+        static RandIter2 sequential(ExPolicy, RandIter first,
+            OffsetIter offsets_first, OffsetIter offsets_last, RandIter2 dest,
+            T const& init, Reduce&& r, Convert&& conv)
+        {
+            std::ptrdiff_t const num_offsets =
+                std::distance(offsets_first, offsets_last);
+            if (num_offsets <= 1)
+            {
+                return dest;
+            }
+            return sequential_segmented_reduce(
+                segmented_range_elements<RandIter>{first}, offsets_first,
+                std::size_t(num_offsets - 1), dest, init, r, conv);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename OffsetIter,
+            typename T, typename Reduce, typename Convert>
+        static typename algorithm_result<ExPolicy, RandIter2>::type
+        parallel(ExPolicy&& policy, RandIter first, OffsetIter offsets_first,
+            OffsetIter offsets_last, RandIter2 dest, T const& init,
+            Reduce&& r, Convert&& conv)
+        {
+            std::ptrdiff_t const num_offsets =
+                std::distance(offsets_first, offsets_last);
+            if (num_offsets <= 1)
+            {
+                return algorithm_result<ExPolicy, RandIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+            return parallel_segmented_reduce(PIKA_FORWARD(ExPolicy, policy),
+                segmented_range_elements<RandIter>{first}, offsets_first,
+                std::size_t(num_offsets - 1), dest, init,
+                PIKA_FORWARD(Reduce, r), PIKA_FORWARD(Convert, conv));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::segmented_transform_reduce
+    inline constexpr struct segmented_transform_reduce_t final
+      : pika::detail::tag_parallel_algorithm<segmented_transform_reduce_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename OffsetIter,
+            typename RandIter2, typename T, typename Reduce, typename Convert,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter2>::type
+        tag_fallback_invoke(pika::segmented_transform_reduce_t,
+            ExPolicy&& policy, RandIter first, OffsetIter offsets_first,
+            OffsetIter offsets_last, RandIter2 dest, T init, Reduce&& op,
+            Convert&& conv)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value &&
+                    pika::traits::is_random_access_iterator<RandIter2>::value,
+                "Requires random access iterators.");
+            static_assert(
+                pika::traits::is_random_access_iterator<OffsetIter>::value,
+                "Requires a random access iterator for the offsets.");
+            using offset_type =
+                typename std::iterator_traits<OffsetIter>::value_type;
+            static_assert(
+                std::is_integral_v<offset_type>, "Requires integral offsets.");
+
+            return pika::parallel::detail::segmented_reduce<RandIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, offsets_first,
+                offsets_last, dest, PIKA_MOVE(init), PIKA_FORWARD(Reduce, op),
+                PIKA_FORWARD(Convert, conv));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OffsetIter, typename RandIter2,
+            typename T, typename Reduce, typename Convert,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(
+            pika::segmented_transform_reduce_t, RandIter first,
+            OffsetIter offsets_first, OffsetIter offsets_last, RandIter2 dest,
+            T init, Reduce&& op, Convert&& conv)
+        {
+            return segmented_transform_reduce_t{}(pika::execution::seq, first,
+                offsets_first, offsets_last, dest, PIKA_MOVE(init),
+                PIKA_FORWARD(Reduce, op), PIKA_FORWARD(Convert, conv));
+        }
+    } segmented_transform_reduce{};
+
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::segmented_reduce
+    inline constexpr struct segmented_reduce_t final
+      : pika::detail::tag_parallel_algorithm<segmented_reduce_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename OffsetIter,
+            typename RandIter2, typename T, typename Reduce = std::plus<>,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter2>::type
+        tag_fallback_invoke(pika::segmented_reduce_t, ExPolicy&& policy,
+            RandIter first, OffsetIter offsets_first, OffsetIter offsets_last,
+            RandIter2 dest, T init, Reduce&& op = Reduce())
+        {
+            return pika::segmented_transform_reduce(
+                PIKA_FORWARD(ExPolicy, policy), first, offsets_first,
+                offsets_last, dest, PIKA_MOVE(init), PIKA_FORWARD(Reduce, op),
+                pika::parallel::detail::projection_identity());
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OffsetIter, typename RandIter2,
+            typename T, typename Reduce = std::plus<>,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(pika::segmented_reduce_t,
+            RandIter first, OffsetIter offsets_first, OffsetIter offsets_last,
+            RandIter2 dest, T init, Reduce&& op = Reduce())
+        {
+            return pika::segmented_transform_reduce(pika::execution::seq,
+                first, offsets_first, offsets_last, dest, PIKA_MOVE(init),
+                PIKA_FORWARD(Reduce, op),
+                pika::parallel::detail::projection_identity());
+        }
+    } segmented_reduce{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::spmv
+    inline constexpr struct spmv_t final
+      : pika::detail::tag_parallel_algorithm<spmv_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename OffsetIter, typename IndexIter,
+            typename ValueIter, typename XIter, typename YIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<IndexIter>::value &&
+                pika::traits::is_iterator<ValueIter>::value &&
+                pika::traits::is_iterator<XIter>::value &&
+                pika::traits::is_iterator<YIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            YIter>::type
+        tag_fallback_invoke(pika::spmv_t, ExPolicy&& policy,
+            OffsetIter row_offsets_first, OffsetIter row_offsets_last,
+            IndexIter column_indices, ValueIter values, XIter x, YIter y)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<IndexIter>::value &&
+                    pika::traits::is_random_access_iterator<ValueIter>::value &&
+                    pika::traits::is_random_access_iterator<XIter>::value,
+                "Requires random access iterators.");
+
+            using value_type = typename std::iterator_traits<YIter>::value_type;
+
+            // the products of the nonzero elements, which are identified by
+            // their positions
+            return pika::segmented_transform_reduce(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_counting_iterator(std::size_t(0)),
+                row_offsets_first, row_offsets_last, y, value_type(0),
+                std::plus<>(),
+                [column_indices, values, x](std::size_t j) -> value_type {
+                    return values[j] * x[column_indices[j]];
+                });
+        }
+
+        // clang-format off
+        template <typename OffsetIter, typename IndexIter, typename ValueIter,
+            typename XIter, typename YIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<OffsetIter>::value &&
+                pika::traits::is_iterator<IndexIter>::value &&
+                pika::traits::is_iterator<ValueIter>::value &&
+                pika::traits::is_iterator<XIter>::value &&
+                pika::traits::is_iterator<YIter>::value
+            )>
+        // clang-format on
+        friend YIter tag_fallback_invoke(pika::spmv_t,
+            OffsetIter row_offsets_first, OffsetIter row_offsets_last,
+            IndexIter column_indices, ValueIter values, XIter x, YIter y)
+        {
+            return spmv_t{}(pika::execution::seq, row_offsets_first,
+                row_offsets_last, column_indices, values, x, y);
+        }
+    } spmv{};
+}    // namespace pika
+
+#endif    // DOXYGEN
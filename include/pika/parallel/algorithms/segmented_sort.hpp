@@ -0,0 +1,313 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/pdq_sort.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/sorting_network.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace parallel::detail {
+        /// \cond NOINTERNAL
+
+        // segments of at most this size are sorted by insertion sort, the
+        // segments sorted by a sorting network may be larger
+        static const std::size_t segmented_sort_insertion_limit = 16ul;
+
+        // segments of at least this size are sorted by the parallel sort
+        static const std::size_t segmented_sort_parallel_limit = 262144ul;
+
+        // the minimal number of elements of the segments sorted by one task
+        static const std::size_t segmented_sort_batch_size = 65536ul;
+
+        template <typename RandIter, typename Compare>
+        void segmented_sort_segment(
+            RandIter first, RandIter last, Compare& comp)
+        {
+            std::size_t const size = last - first;
+            if (size <= segmented_sort_insertion_limit ||
+                (use_sorting_network_v<RandIter, Compare> &&
+                    size <= sorting_network_limit))
+            {
+                small_sort(first, last, comp);
+            }
+            else
+            {
+                pdq_sort(first, last, comp);
+            }
+        }
+
+        // Sorts the segments [first + offsets[i], first + offsets[i + 1]).
+        // The small segments are grouped into batches of at least
+        // segmented_sort_batch_size elements which are sorted by one task
+        // each, the large segments are sorted one after the other by the
+        // parallel sort afterwards.
+        template <typename ExPolicy, typename RandIter, typename OffsetIter,
+            typename Compare>
+        void segmented_sort_segments(ExPolicy& policy, RandIter first,
+            OffsetIter offsets, std::size_t num_segments, Compare& comp)
+        {
+            auto segment_size = [&](std::size_t i) -> std::size_t {
+                return std::size_t(offsets[i + 1] - offsets[i]);
+            };
+
+            if constexpr (pika::is_sequenced_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                for (std::size_t i = 0; i != num_segments; ++i)
+                {
+                    segmented_sort_segment(
+                        first + offsets[i], first + offsets[i + 1], comp);
+                }
+            }
+            else
+            {
+                // the segment indices at which the batches start
+                std::vector<std::size_t> batches(1, 0);
+                std::vector<std::size_t> large_segments;
+
+                std::size_t batch_elements = 0;
+                for (std::size_t i = 0; i != num_segments; ++i)
+                {
+                    std::size_t const size = segment_size(i);
+                    if (size >= segmented_sort_parallel_limit)
+                    {
+                        large_segments.push_back(i);
+                        continue;
+                    }
+
+                    // empty segments still cost a little
+                    batch_elements += size + 1;
+                    if (batch_elements >= segmented_sort_batch_size)
+                    {
+                        batches.push_back(i + 1);
+                        batch_elements = 0;
+                    }
+                }
+                if (batches.back() != num_segments)
+                {
+                    batches.push_back(num_segments);
+                }
+
+                execution::bulk_sync_execute(
+                    policy.executor(),
+                    [&](std::size_t batch) {
+                        for (std::size_t i = batches[batch];
+                             i != batches[batch + 1]; ++i)
+                        {
+                            if (segment_size(i) < segmented_sort_parallel_limit)
+                            {
+                                segmented_sort_segment(first + offsets[i],
+                                    first + offsets[i + 1], comp);
+                            }
+                        }
+                    },
+                    pika::detail::irange(std::size_t(0), batches.size() - 1));
+
+                for (std::size_t i : large_segments)
+                {
+                    sort<RandIter>().call(policy, first + offsets[i],
+                        first + offsets[i + 1], comp, projection_identity{});
+                }
+            }
+        }
+
+        template <typename RandIter>
+        struct segmented_sort : public algorithm<segmented_sort<RandIter>,
+                                    RandIter>
+        {
+            segmented_sort()
+              : segmented_sort::algorithm("segmented_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename OffsetIter, typename Compare>
+            static RandIter sequential(ExPolicy&& policy, RandIter first,
+                RandIter last, OffsetIter offsets_first,
+                OffsetIter offsets_last, Compare&& comp)
+            {
+                std::ptrdiff_t const num_offsets =
+                    std::distance(offsets_first, offsets_last);
+                if (num_offsets > 1)
+                {
+                    segmented_sort_segments(policy, first, offsets_first,
+                        std::size_t(num_offsets - 1), comp);
+                }
+                return last;
+            }
+
+            template <typename ExPolicy, typename OffsetIter, typename Compare>
+            static typename algorithm_result<ExPolicy, RandIter>::type
+            parallel(ExPolicy&& policy, RandIter first, RandIter last,
+                OffsetIter offsets_first, OffsetIter offsets_last,
+                Compare&& comp)
+            {
+                using algorithm_result = algorithm_result<ExPolicy, RandIter>;
+
+                try
+                {
+                    if constexpr (pika::is_async_execution_policy_v<
+                                      std::decay_t<ExPolicy>>)
+                    {
+                        return algorithm_result::get(execution::async_execute(
+                            policy.executor(),
+                            [policy, first, last, offsets_first, offsets_last,
+                                comp]() mutable -> RandIter {
+                                try
+                                {
+                                    return sequential(
+                                        policy(pika::execution::non_task),
+                                        first, last, offsets_first,
+                                        offsets_last, comp);
+                                }
+                                catch (std::bad_alloc const&)
+                                {
+                                    throw;
+                                }
+                                catch (pika::exception_list const&)
+                                {
+                                    throw;
+                                }
+                                catch (...)
+                                {
+                                    throw pika::exception_list(
+                                        std::current_exception());
+                                }
+                            }));
+                    }
+                    else
+                    {
+                        return algorithm_result::get(
+                            sequential(PIKA_FORWARD(ExPolicy, policy), first,
+                                last, offsets_first, offsets_last, comp));
+                    }
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        handle_exception<ExPolicy, RandIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace parallel::detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts many independent segments of a range in one call. The offsets
+    /// in the range [offsets_first, offsets_last) delimit the segments:
+    /// for every two consecutive offsets o1 and o2 the elements in the range
+    /// [first + o1, first + o2) are sorted in ascending order, like the row
+    /// pointers of a matrix in compressed sparse row format delimit its rows.
+    /// Elements which are not part of any segment are not modified.
+    /// The algorithm is not stable, the order of equal elements is not
+    /// guaranteed to be preserved.
+    /// The function uses the given comparison function object comp (defaults
+    /// to using operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(S)), where N = std::distance(first, last)
+    ///                     and S is the size of the largest segment.
+    ///
+    /// Small segments are grouped into batches which are sorted by one task
+    /// each, tiny segments are sorted by insertion sort. Segments with at
+    /// least 262144 elements are sorted by the parallel \a sort.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter    The type of the iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam OffsetIter  The type of the offset iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator, its value type must be an
+    ///                     integral type.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param offsets_first Refers to the beginning of the sequence of
+    ///                     non-decreasing offsets delimiting the segments,
+    ///                     all offsets must not be larger than
+    ///                     std::distance(first, last).
+    /// \param offsets_last Refers to the end of the sequence of offsets.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a segmented_sort algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy
+    ///           and returns \a RandIter otherwise.
+    ///           The algorithm returns an iterator equal to \a last.
+    //-----------------------------------------------------------------------------
+
+    template <typename ExPolicy, typename RandIter, typename OffsetIter,
+        typename Compare = parallel::detail::less>
+    parallel::detail::algorithm_result_t<ExPolicy, RandIter> segmented_sort(
+        ExPolicy&& policy, RandIter first, RandIter last,
+        OffsetIter offsets_first, OffsetIter offsets_last,
+        Compare&& comp = Compare())
+    {
+        static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+            "Requires a random access iterator.");
+        static_assert((pika::traits::is_random_access_iterator_v<OffsetIter>),
+            "Requires a random access iterator.");
+        using offset_type =
+            typename std::iterator_traits<OffsetIter>::value_type;
+        static_assert(
+            std::is_integral_v<offset_type>, "Requires integral offsets.");
+
+        return parallel::detail::segmented_sort<RandIter>().call(
+            PIKA_FORWARD(ExPolicy, policy), first, last, offsets_first,
+            offsets_last, PIKA_FORWARD(Compare, comp));
+    }
+}    // namespace pika
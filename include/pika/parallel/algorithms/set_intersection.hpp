@@ -157,6 +157,56 @@ namespace pika::parallel::detail {
         return {first1, first2, dest};
     }
 
+    // set_intersection of sequences with skewed lengths: every element of
+    // the shorter sequence is searched for in the longer one by galloping
+    template <typename Iter1, typename Iter2, typename Iter3, typename Comp,
+        typename Proj1, typename Proj2>
+    in_in_out_result<Iter1, Iter2, Iter3> sequential_set_intersection_gallop(
+        Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, Iter3 dest,
+        Comp&& comp, Proj1&& proj1, Proj2&& proj2)
+    {
+        if (last1 - first1 <= last2 - first2)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                auto&& value1 = PIKA_INVOKE(proj1, *first1);
+                first2 = detail::gallop_lower_bound(
+                    first2, last2, value1, comp, proj2);
+                if (first2 == last2)
+                {
+                    break;
+                }
+
+                if (!PIKA_INVOKE(comp, value1, PIKA_INVOKE(proj2, *first2)))
+                {
+                    *dest++ = *first1;
+                    ++first2;
+                }
+                ++first1;
+            }
+        }
+        else
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                auto&& value2 = PIKA_INVOKE(proj2, *first2);
+                first1 = detail::gallop_lower_bound(
+                    first1, last1, value2, comp, proj1);
+                if (first1 == last1)
+                {
+                    break;
+                }
+
+                if (!PIKA_INVOKE(comp, value2, PIKA_INVOKE(proj1, *first1)))
+                {
+                    *dest++ = *first1++;
+                }
+                ++first2;
+            }
+        }
+        return {first1, first2, dest};
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Result>
     struct set_intersection : public algorithm<set_intersection<Result>, Result>
@@ -166,6 +216,15 @@ namespace pika::parallel::detail {
         {
         }
 
+        // both input ranges make up the work, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_two_ranges(args...);
+        }
+
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename F,
             typename Proj1, typename Proj2>
@@ -173,6 +232,16 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
+            if constexpr (set_operation_can_gallop_v<Iter1, Sent1, Iter2,
+                              Sent2>)
+            {
+                if (set_operation_skewed(last1 - first1, last2 - first2))
+                {
+                    return sequential_set_intersection_gallop(first1, last1,
+                        first2, last2, dest, PIKA_FORWARD(F, f),
+                        PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2));
+                }
+            }
             return sequential_set_intersection(first1, last1, first2, last2,
                 dest, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
                 PIKA_FORWARD(Proj2, proj2));
@@ -186,11 +255,6 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
-            using difference_type1 =
-                typename std::iterator_traits<Iter1>::difference_type;
-            using difference_type2 =
-                typename std::iterator_traits<Iter2>::difference_type;
-
             using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
             using result = algorithm_result<ExPolicy, result_type>;
 
@@ -200,19 +264,19 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first1), PIKA_MOVE(first2), PIKA_MOVE(dest)});
             }
 
-            using buffer_type = typename set_operations_buffer<Iter3>::type;
             using func_type = std::decay_t<F>;
 
-            // calculate approximate destination index
-            auto f1 = [](difference_type1 idx1,
-                          difference_type2 idx2) -> difference_type1 {
-                return (std::min)(idx1, idx2);
-            };
-
             // perform required set operation for one chunk
-            auto f2 = [proj1, proj2](Iter1 part_first1, Sent1 part_last1,
-                          Iter2 part_first2, Sent2 part_last2,
-                          buffer_type* dest, func_type const& f) {
+            auto setop = [proj1, proj2](Iter1 part_first1, Iter1 part_last1,
+                             Iter2 part_first2, Iter2 part_last2, auto dest,
+                             func_type const& f) {
+                if (set_operation_skewed(part_last1 - part_first1,
+                        part_last2 - part_first2))
+                {
+                    return sequential_set_intersection_gallop(part_first1,
+                        part_last1, part_first2, part_last2, dest, f, proj1,
+                        proj2);
+                }
                 return sequential_set_intersection(part_first1, part_last1,
                     part_first2, part_last2, dest, f, proj1, proj2);
             };
@@ -220,7 +284,7 @@ namespace pika::parallel::detail {
             return set_operation(PIKA_FORWARD(ExPolicy, policy), first1, last1,
                 first2, last2, dest, PIKA_FORWARD(F, f),
                 PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2),
-                PIKA_MOVE(f1), PIKA_MOVE(f2));
+                PIKA_MOVE(setop), set_operation_gallop::shorter_sequence);
         }
     };
 }    // namespace pika::parallel::detail
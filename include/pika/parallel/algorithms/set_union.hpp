@@ -176,6 +176,15 @@ namespace pika::parallel::detail {
         {
         }
 
+        // both input ranges make up the work, see inline_threshold
+        template <typename... Args>
+        static constexpr std::size_t get_inline_count(Args const&... args)
+        {
+            return inline_count_two_ranges(args...);
+        }
+
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename F,
             typename Proj1, typename Proj2>
@@ -196,11 +205,6 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2)
         {
-            using difference_type1 =
-                typename std::iterator_traits<Iter1>::difference_type;
-            using difference_type2 =
-                typename std::iterator_traits<Iter2>::difference_type;
-
             using result_type = in_in_out_result<Iter1, Iter2, Iter3>;
 
             if (first1 == last1)
@@ -225,19 +229,12 @@ namespace pika::parallel::detail {
                     });
             }
 
-            using buffer_type = typename set_operations_buffer<Iter3>::type;
             using func_type = std::decay_t<F>;
 
-            // calculate approximate destination index
-            auto f1 = [](difference_type1 idx1,
-                          difference_type2 idx2) -> difference_type1 {
-                return idx1 + idx2;
-            };
-
             // perform required set operation for one chunk
-            auto f2 = [proj1, proj2](Iter1 part_first1, Sent1 part_last1,
-                          Iter2 part_first2, Sent2 part_last2,
-                          buffer_type* dest, func_type const& f) {
+            auto setop = [proj1, proj2](Iter1 part_first1, Iter1 part_last1,
+                             Iter2 part_first2, Iter2 part_last2, auto dest,
+                             func_type const& f) {
                 return sequential_set_union(part_first1, part_last1,
                     part_first2, part_last2, dest, f, proj1, proj2);
             };
@@ -245,7 +242,7 @@ namespace pika::parallel::detail {
             return set_operation(PIKA_FORWARD(ExPolicy, policy), first1, last1,
                 first2, last2, dest, PIKA_FORWARD(F, f),
                 PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2),
-                PIKA_MOVE(f1), PIKA_MOVE(f2));
+                PIKA_MOVE(setop));
         }
     };
 }    // namespace pika::parallel::detail
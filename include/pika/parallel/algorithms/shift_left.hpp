@@ -116,6 +116,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/reverse.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/parallel_memmove.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/transfer.hpp>
 
@@ -206,8 +207,25 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
-            return algorithm_result<ExPolicy, FwdIter2>::get(
-                shift_left_helper(policy, first, last, std::next(first, n)));
+            if constexpr (is_memmove_iterator_v<FwdIter2>)
+            {
+                // move the elements in place instead of rotating them
+                return run_parallel_memmove<ExPolicy, FwdIter2>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [=](auto& p) -> FwdIter2 {
+                        std::size_t const count =
+                            dist - static_cast<std::size_t>(n);
+                        parallel_memmove_n(
+                            p, std::next(first, n), count, first);
+                        return std::next(first, count);
+                    });
+            }
+            else
+            {
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    shift_left_helper(
+                        policy, first, last, std::next(first, n)));
+            }
         }
     };
     /// \endcond
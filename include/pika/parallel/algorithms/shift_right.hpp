@@ -116,6 +116,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/reverse.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/parallel_memmove.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/transfer.hpp>
 
@@ -247,9 +248,24 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
-            auto new_first = std::next(first, dist - n);
-            return algorithm_result<ExPolicy, FwdIter2>::get(
-                shift_right_helper(policy, first, last, new_first));
+            if constexpr (is_memmove_iterator_v<FwdIter2>)
+            {
+                // move the elements in place instead of rotating them
+                return run_parallel_memmove<ExPolicy, FwdIter2>(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    [=](auto& p) -> FwdIter2 {
+                        auto result = std::next(first, n);
+                        parallel_memmove_n(p, first,
+                            dist - static_cast<std::size_t>(n), result);
+                        return result;
+                    });
+            }
+            else
+            {
+                auto new_first = std::next(first, dist - n);
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    shift_right_helper(policy, first, last, new_first));
+            }
         }
     };
     /// \endcond
@@ -0,0 +1,611 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/shuffle.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Reorders the elements in the range [first, last) such that each
+    /// possible permutation of them has the same probability of appearance.
+    /// The random numbers are taken from \a pika::philox4x32 engines seeded
+    /// with \a seed, and the permutation only depends on \a seed and the
+    /// number of elements: it is the same for every execution policy and
+    /// number of threads.
+    ///
+    /// Every element is assigned to one of up to 4096 buckets at random, the
+    /// elements are distributed to their buckets in parallel, keeping their
+    /// order, and every bucket is shuffled by a single task. Ranges of up to
+    /// 32768 elements form a single bucket.
+    ///
+    /// \note   Complexity: O(\a last - \a first) swaps and moves.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type must be
+    ///                     default constructible and move assignable.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param seed         The seed of the random number engines.
+    ///
+    /// The assignments in the parallel \a shuffle algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a shuffle algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a shuffle algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. It returns \a last.
+    ///
+    template <typename ExPolicy, typename RandIter>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    shuffle(ExPolicy&& policy, RandIter first, RandIter last,
+        std::uint64_t seed = pika::philox4x32::default_seed);
+
+    /// Copies \a count elements of the range [first, last) to the range
+    /// beginning at \a dest, such that each possible selection has the same
+    /// probability of appearance. The selected elements keep their order.
+    /// If \a count is at least the number of elements, all of them are
+    /// copied. Like for \a shuffle, the selection only depends on \a seed
+    /// and the number of elements.
+    ///
+    /// The positions of the elements are shuffled, the elements at the
+    /// first \a count of them are marked and copied to the destination in
+    /// parallel.
+    ///
+    /// \note   Complexity: O(\a last - \a first) operations and
+    ///         min(\a count, \a last - \a first) assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param count        The number of elements to select.
+    /// \param seed         The seed of the random number engines.
+    ///
+    /// The assignments in the parallel \a sample algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a sample algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a sample algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise. The \a sample algorithm
+    ///           returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    sample(ExPolicy&& policy, RandIter first, RandIter last, FwdIter2 dest,
+        std::size_t count,
+        std::uint64_t seed = pika::philox4x32::default_seed);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/philox.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // shuffle
+    /// \cond NOINTERNAL
+
+    // the number of elements per bucket the shuffle aims for, every bucket
+    // is permuted by a single task
+    static const std::size_t shuffle_bucket_size = 32768ul;
+
+    // the largest number of buckets
+    static const std::size_t shuffle_max_buckets = 4096ul;
+
+    // the minimal number of elements handled by one task
+    static const std::size_t shuffle_min_chunk_size = 16384ul;
+
+    // Returns a uniformly distributed integer in [0, bound) for bound > 0.
+    // Bounds below 2^32 use the multiply-shift method with rejection of
+    // Lemire ("Fast random integer generation in an interval", 2019).
+    inline std::uint64_t shuffle_random_below(
+        pika::philox4x32& engine, std::uint64_t bound) noexcept
+    {
+        if (bound <= 0xffffffffu)
+        {
+            std::uint32_t const b = std::uint32_t(bound);
+            std::uint64_t m = std::uint64_t(engine()) * b;
+            if (std::uint32_t(m) < b)
+            {
+                std::uint32_t const threshold = std::uint32_t(-b) % b;
+                while (std::uint32_t(m) < threshold)
+                {
+                    m = std::uint64_t(engine()) * b;
+                }
+            }
+            return m >> 32;
+        }
+
+        std::uint64_t mask = bound - 1;
+        mask |= mask >> 1;
+        mask |= mask >> 2;
+        mask |= mask >> 4;
+        mask |= mask >> 8;
+        mask |= mask >> 16;
+        mask |= mask >> 32;
+        while (true)
+        {
+            std::uint64_t const hi = engine();
+            std::uint64_t const r = ((hi << 32) | engine()) & mask;
+            if (r < bound)
+            {
+                return r;
+            }
+        }
+    }
+
+    // Fisher-Yates shuffle of [first, first + count)
+    template <typename RandIter>
+    void shuffle_sequential(
+        RandIter first, std::size_t count, pika::philox4x32& engine)
+    {
+        for (std::size_t i = count; i > 1; --i)
+        {
+            std::size_t const j = std::size_t(shuffle_random_below(engine, i));
+            if (j != i - 1)
+            {
+                std::iter_swap(first + (i - 1), first + j);
+            }
+        }
+    }
+
+    // the binary logarithm of the number of buckets, which only depends on
+    // the number of elements
+    inline unsigned shuffle_bucket_bits(std::size_t count) noexcept
+    {
+        unsigned bits = 0;
+        while ((shuffle_bucket_size << bits) < count &&
+            (std::size_t(1) << bits) < shuffle_max_buckets)
+        {
+            ++bits;
+        }
+        return bits;
+    }
+
+    template <typename ExPolicy>
+    std::size_t shuffle_num_chunks(ExPolicy& policy, std::size_t count)
+    {
+        if constexpr (pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            PIKA_UNUSED(policy);
+            PIKA_UNUSED(count);
+            return 1;
+        }
+        else
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_chunks = (std::min)(cores,
+                (count + shuffle_min_chunk_size - 1) / shuffle_min_chunk_size);
+            return (std::max)(num_chunks, std::size_t(1));
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // Parallel random permutation (Sanders, "Random permutations on
+    // distributed, external and hierarchical memory", 1998):
+    //  1. every element is assigned to one of 2^bits buckets uniformly at
+    //     random and the elements of every bucket are counted per chunk
+    //  2. the exclusive scan of the counts, ordered by bucket and then by
+    //     chunk, gives the position of every bucket and chunk in a buffer
+    //  3. every chunk moves its elements to their buckets in the buffer,
+    //     keeping their order
+    //  4. every bucket is shuffled sequentially and moved back
+    // The bucket of the element at position i is given by output i of
+    // stream 0 and bucket b is shuffled by stream b + 1 of the engine, so
+    // the permutation does not depend on the number of chunks.
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter>
+    void shuffle_impl(ExPolicy& policy, RandIter first, std::size_t count,
+        std::uint64_t seed)
+    {
+        using value_type = typename std::iterator_traits<RandIter>::value_type;
+
+        unsigned const bits = shuffle_bucket_bits(count);
+        if (bits == 0)
+        {
+            pika::philox4x32 engine(seed, 1);
+            shuffle_sequential(first, count, engine);
+            return;
+        }
+
+        std::size_t const num_buckets = std::size_t(1) << bits;
+        std::size_t const num_chunks = shuffle_num_chunks(policy, count);
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        // step 1, histograms[chunk * num_buckets + bucket]
+        std::vector<std::uint16_t> buckets(count);
+        std::vector<std::size_t> histograms(num_chunks * num_buckets, 0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* h = histograms.data() + chunk * num_buckets;
+            std::size_t const begin = chunk_begin(chunk);
+            std::size_t const end = chunk_begin(chunk + 1);
+
+            pika::philox4x32 engine(seed, 0);
+            engine.discard(begin);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                std::uint16_t const b = std::uint16_t(engine() >> (32 - bits));
+                buckets[i] = b;
+                ++h[b];
+            }
+        });
+
+        // step 2, the counts are replaced by the positions in the buffer
+        std::vector<std::size_t> bucket_begin(num_buckets + 1, 0);
+        std::size_t offset = 0;
+        for (std::size_t b = 0; b != num_buckets; ++b)
+        {
+            bucket_begin[b] = offset;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t& n = histograms[chunk * num_buckets + b];
+                std::size_t const bucket_count = n;
+                n = offset;
+                offset += bucket_count;
+            }
+        }
+        bucket_begin[num_buckets] = count;
+
+        // step 3
+        std::vector<value_type> buffer(count);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t* h = histograms.data() + chunk * num_buckets;
+            std::size_t const end = chunk_begin(chunk + 1);
+            for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+            {
+                buffer[h[buckets[i]]++] = PIKA_MOVE(first[i]);
+            }
+        });
+
+        // step 4, every chunk handles a contiguous group of buckets
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const end = (chunk + 1) * num_buckets / num_chunks;
+            for (std::size_t b = chunk * num_buckets / num_chunks; b != end;
+                 ++b)
+            {
+                std::size_t const size = bucket_begin[b + 1] - bucket_begin[b];
+                auto const bucket_first = buffer.begin() + bucket_begin[b];
+
+                pika::philox4x32 engine(seed, std::uint64_t(b) + 1);
+                shuffle_sequential(bucket_first, size, engine);
+                std::move(bucket_first, bucket_first + size,
+                    first + bucket_begin[b]);
+            }
+        });
+    }
+
+    template <typename RandIter>
+    struct shuffle : public algorithm<shuffle<RandIter>, RandIter>
+    {
+        shuffle()
+          : shuffle::algorithm("shuffle")
+        {
+        }
+
+        template <typename ExPolicy>
+        static RandIter sequential(
+            ExPolicy policy, RandIter first, RandIter last, std::uint64_t seed)
+        {
+            shuffle_impl(policy, first, std::size_t(last - first), seed);
+            return last;
+        }
+
+        template <typename ExPolicy>
+        static typename algorithm_result<ExPolicy, RandIter>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last,
+            std::uint64_t seed)
+        {
+            std::size_t const count = last - first;
+            if (count < 2)
+            {
+                return algorithm_result<ExPolicy, RandIter>::get(
+                    PIKA_MOVE(last));
+            }
+
+            return run_length_parallel<ExPolicy, RandIter>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, last, count, seed](auto& p) -> RandIter {
+                    shuffle_impl(p, first, count, seed);
+                    return last;
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sample
+
+    // Marks min(count, size) positions of [0, size), chosen uniformly at
+    // random: the positions are shuffled and the first count of them are
+    // selected.
+    template <typename ExPolicy>
+    std::vector<char> sample_selection(ExPolicy& policy, std::size_t size,
+        std::size_t count, std::uint64_t seed)
+    {
+        if (count >= size)
+        {
+            return std::vector<char>(size, 1);
+        }
+
+        std::size_t const num_chunks = shuffle_num_chunks(policy, size);
+
+        std::vector<std::size_t> positions(size);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const end = (chunk + 1) * size / num_chunks;
+            for (std::size_t i = chunk * size / num_chunks; i != end; ++i)
+            {
+                positions[i] = i;
+            }
+        });
+
+        shuffle_impl(policy, positions.begin(), size, seed);
+
+        std::vector<char> selected(size, 0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const end = (chunk + 1) * count / num_chunks;
+            for (std::size_t i = chunk * count / num_chunks; i != end; ++i)
+            {
+                selected[positions[i]] = 1;
+            }
+        });
+        return selected;
+    }
+
+    template <typename FwdIter2>
+    struct sample : public algorithm<sample<FwdIter2>, FwdIter2>
+    {
+        sample()
+          : sample::algorithm("sample")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename OutIter>
+        static OutIter sequential(ExPolicy policy, RandIter first,
+            RandIter last, OutIter dest, std::size_t count,
+            std::uint64_t seed)
+        {
+            std::size_t const size = last - first;
+            std::vector<char> const selected =
+                sample_selection(policy, size, count, seed);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                if (selected[i])
+                {
+                    *dest = first[i];
+                    ++dest;
+                }
+            }
+            return dest;
+        }
+
+        template <typename ExPolicy, typename RandIter>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last, FwdIter2 dest,
+            std::size_t count, std::uint64_t seed)
+        {
+            std::size_t const size = last - first;
+            if (size == 0 || count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            return run_length_parallel<ExPolicy, FwdIter2>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, size, dest, count, seed](auto& p) -> FwdIter2 {
+                    std::vector<char> const selected =
+                        sample_selection(p, size, count, seed);
+
+                    std::size_t const num_chunks = shuffle_num_chunks(p, size);
+                    auto chunk_begin = [&](std::size_t chunk) {
+                        return chunk * size / num_chunks;
+                    };
+
+                    // offsets[chunk] is the number of selected elements
+                    // before the chunk
+                    std::vector<std::size_t> offsets(num_chunks + 1, 0);
+                    run_chunks(p, num_chunks, [&](std::size_t chunk) {
+                        offsets[chunk + 1] = std::size_t(std::count(
+                            selected.begin() + chunk_begin(chunk),
+                            selected.begin() + chunk_begin(chunk + 1), 1));
+                    });
+                    for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                    {
+                        offsets[chunk + 1] += offsets[chunk];
+                    }
+
+                    run_chunks(p, num_chunks, [&](std::size_t chunk) {
+                        FwdIter2 dst = std::next(dest, offsets[chunk]);
+                        std::size_t const end = chunk_begin(chunk + 1);
+                        for (std::size_t i = chunk_begin(chunk); i != end; ++i)
+                        {
+                            if (selected[i])
+                            {
+                                *dst = first[i];
+                                ++dst;
+                            }
+                        }
+                    });
+
+                    return std::next(dest, offsets.back());
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::shuffle
+    inline constexpr struct shuffle_t final
+      : pika::detail::tag_parallel_algorithm<shuffle_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(shuffle_t, ExPolicy&& policy, RandIter first,
+            RandIter last, std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::shuffle<RandIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, seed);
+        }
+
+        // clang-format off
+        template <typename RandIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(shuffle_t, RandIter first,
+            RandIter last, std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::shuffle<RandIter>().call(
+                pika::execution::seq, first, last, seed);
+        }
+    } shuffle{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::sample
+    inline constexpr struct sample_t final
+      : pika::detail::tag_parallel_algorithm<sample_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(sample_t, ExPolicy&& policy, RandIter first,
+            RandIter last, FwdIter2 dest, std::size_t count,
+            std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::sample<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest, count,
+                seed);
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(sample_t, RandIter first,
+            RandIter last, OutIter dest, std::size_t count,
+            std::uint64_t seed = pika::philox4x32::default_seed)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::sample<OutIter>().call(
+                pika::execution::seq, first, last, dest, count, seed);
+        }
+    } sample{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -0,0 +1,364 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/sketch.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Builds a \a quantile_sketch of the elements of the range
+    /// [first, last), from which approximate quantiles and ranks of the
+    /// elements can be queried without sorting or copying them, e.g. the
+    /// 99th percentile as make_quantile_sketch(par, first, last).quantile(0.99).
+    ///
+    /// \note   Complexity: O(\a last - \a first) insertions into sketches
+    ///         and O(k log(\a last - \a first)) memory per core.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source begin and end iterators used
+    ///                     (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Compare     The type of the ordering of the elements, defaults
+    ///                     to std::less<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param k            The accuracy of the sketch, see
+    ///                     \a quantile_sketch.
+    /// \param comp         The ordering of the elements.
+    ///
+    /// The insertions in the parallel \a make_quantile_sketch algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The insertions in the parallel \a make_quantile_sketch algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread. Every chunk of the elements is inserted into a
+    /// sketch of its own, the sketches are merged along a tree afterwards.
+    ///
+    /// \returns  The \a make_quantile_sketch algorithm returns a
+    ///           \a pika::future<quantile_sketch<T, Compare>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a quantile_sketch<T, Compare> otherwise, where \a T is the
+    ///           value type of \a FwdIter.
+    ///
+    template <typename ExPolicy, typename FwdIter,
+        typename Compare = std::less<>>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        quantile_sketch<typename std::iterator_traits<FwdIter>::value_type,
+            Compare>>::type
+    make_quantile_sketch(ExPolicy&& policy, FwdIter first, FwdIter last,
+        std::size_t k = 200, Compare&& comp = Compare());
+
+    /// Builds a \a distinct_count_sketch of the elements of the range
+    /// [first, last), which estimates the number of distinct elements in
+    /// constant memory.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a hash
+    ///         and O(2^\a precision) memory per core.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source begin and end iterators used
+    ///                     (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the hash function of the elements,
+    ///                     defaults to std::hash of the value type.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param precision    The accuracy of the sketch, see
+    ///                     \a distinct_count_sketch.
+    /// \param hash         The hash function of the elements.
+    ///
+    /// The invocations of \a hash in the parallel
+    /// \a make_distinct_count_sketch algorithm invoked with an execution
+    /// policy object of type \a sequenced_policy execute in sequential order
+    /// in the calling thread.
+    ///
+    /// The invocations of \a hash in the parallel
+    /// \a make_distinct_count_sketch algorithm invoked with an execution
+    /// policy object of type \a parallel_policy or \a parallel_task_policy
+    /// are permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread. Every
+    /// chunk of the elements is inserted into a sketch of its own, the
+    /// sketches are merged along a tree afterwards.
+    ///
+    /// \returns  The \a make_distinct_count_sketch algorithm returns a
+    ///           \a pika::future<distinct_count_sketch<T, Hash>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a distinct_count_sketch<T, Hash> otherwise, where \a T is
+    ///           the value type of \a FwdIter.
+    ///
+    template <typename ExPolicy, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<FwdIter>::value_type>>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        distinct_count_sketch<
+            typename std::iterator_traits<FwdIter>::value_type, Hash>>::type
+    make_distinct_count_sketch(ExPolicy&& policy, FwdIter first,
+        FwdIter last, unsigned precision = 14, Hash&& hash = Hash());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/tree_reduce.hpp>
+#include <pika/parallel/util/sketches.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // sketch_reduce
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements inserted by one task
+    inline constexpr std::size_t sketch_min_chunk_size = 16384ul;
+
+    template <typename InIter, typename Sent, typename Sketch>
+    Sketch sequential_sketch_reduce(InIter first, Sent last, Sketch sketch)
+    {
+        for (/**/; first != last; ++first)
+        {
+            sketch.update(*first);
+        }
+        return sketch;
+    }
+
+    // -----------------------------------------------------------------------
+    // The elements are split into one chunk per core, every chunk is
+    // inserted into a copy of the empty sketch. The sketches are merged
+    // pairwise along a tree.
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename FwdIter, typename Sketch>
+    Sketch sketch_reduce_impl(ExPolicy& policy, FwdIter first,
+        std::size_t count, Sketch const& empty)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t num_chunks = (std::min)(cores,
+            (count + sketch_min_chunk_size - 1) / sketch_min_chunk_size);
+        num_chunks = (std::max)(num_chunks, std::size_t(1));
+
+        // the beginning of every chunk
+        std::vector<FwdIter> chunk_first;
+        chunk_first.reserve(num_chunks + 1);
+        chunk_first.push_back(first);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            chunk_first.push_back(std::next(chunk_first.back(),
+                (chunk + 1) * count / num_chunks - chunk * count / num_chunks));
+        }
+
+        std::vector<std::optional<Sketch>> partial(num_chunks);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            partial[chunk] = sequential_sketch_reduce(
+                chunk_first[chunk], chunk_first[chunk + 1], empty);
+        });
+
+        tree_reduce(policy.executor(), num_chunks,
+            [&](std::size_t i, std::size_t j) {
+                partial[i]->merge(*partial[j]);
+                partial[j].reset();
+            });
+
+        return PIKA_MOVE(*partial[0]);
+    }
+
+    template <typename Sketch>
+    struct sketch_reduce : public algorithm<sketch_reduce<Sketch>, Sketch>
+    {
+        sketch_reduce()
+          : sketch_reduce::algorithm("sketch_reduce")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent>
+        static Sketch sequential(
+            ExPolicy, InIter first, Sent last, Sketch const& empty)
+        {
+            return sequential_sketch_reduce(first, last, empty);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent>
+        static typename algorithm_result<ExPolicy, Sketch>::type parallel(
+            ExPolicy&& policy, FwdIter first, Sent last, Sketch const& empty)
+        {
+            using result = algorithm_result<ExPolicy, Sketch>;
+
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return result::get(Sketch(empty));
+            }
+
+            try
+            {
+                if constexpr (pika::is_async_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [policy, first, count, empty]() mutable -> Sketch {
+                            try
+                            {
+                                auto p = policy(pika::execution::non_task);
+                                return sketch_reduce_impl(
+                                    p, first, count, empty);
+                            }
+                            catch (std::bad_alloc const&)
+                            {
+                                throw;
+                            }
+                            catch (pika::exception_list const&)
+                            {
+                                throw;
+                            }
+                            catch (...)
+                            {
+                                throw pika::exception_list(
+                                    std::current_exception());
+                            }
+                        }));
+                }
+                else
+                {
+                    return result::get(
+                        sketch_reduce_impl(policy, first, count, empty));
+                }
+            }
+            catch (...)
+            {
+                return result::get(handle_exception<ExPolicy, Sketch>::call(
+                    std::current_exception()));
+            }
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::make_quantile_sketch
+    inline constexpr struct make_quantile_sketch_t final
+      : pika::detail::tag_parallel_algorithm<make_quantile_sketch_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter,
+            typename Compare = std::less<>,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            quantile_sketch<typename std::iterator_traits<FwdIter>::value_type,
+                std::decay_t<Compare>>>::type
+        tag_fallback_invoke(pika::make_quantile_sketch_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last,
+            std::size_t k = quantile_sketch<int>::default_k,
+            Compare&& comp = Compare())
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            using sketch_type = quantile_sketch<
+                typename std::iterator_traits<FwdIter>::value_type,
+                std::decay_t<Compare>>;
+
+            return pika::parallel::detail::sketch_reduce<sketch_type>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                sketch_type(k, PIKA_FORWARD(Compare, comp)));
+        }
+    } make_quantile_sketch{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::make_distinct_count_sketch
+    inline constexpr struct make_distinct_count_sketch_t final
+      : pika::detail::tag_parallel_algorithm<make_distinct_count_sketch_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<FwdIter>::value_type>,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            distinct_count_sketch<
+                typename std::iterator_traits<FwdIter>::value_type,
+                std::decay_t<Hash>>>::type
+        tag_fallback_invoke(pika::make_distinct_count_sketch_t,
+            ExPolicy&& policy, FwdIter first, FwdIter last,
+            unsigned precision = distinct_count_sketch<int>::default_precision,
+            Hash&& hash = Hash())
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            using sketch_type = distinct_count_sketch<
+                typename std::iterator_traits<FwdIter>::value_type,
+                std::decay_t<Hash>>;
+
+            return pika::parallel::detail::sketch_reduce<sketch_type>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                sketch_type(precision, PIKA_FORWARD(Hash, hash)));
+        }
+    } make_distinct_count_sketch{};
+}    // namespace pika
+
+#endif    // DOXYGEN
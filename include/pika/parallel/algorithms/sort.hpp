@@ -197,6 +197,36 @@ namespace pika {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// If the projected values are of an integral or floating point type and
+    /// \a comp is std::less or std::greater, sufficiently large sequences are
+    /// sorted using a parallel radix sort instead. This can be controlled
+    /// by passing \a pika::execution::radix_sort_selection as the executor
+    /// parameters of the execution policy.
+    ///
+    /// If all projected keys are known to lie in a small range, passing
+    /// \a pika::execution::sort_key_range as the executor parameters sorts
+    /// keys of an integral or enumeration type using a parallel counting
+    /// sort, which takes linear time.
+    ///
+    /// Sufficiently large sequences of large elements are sorted through an
+    /// index of iterators, the elements are moved to their final place once
+    /// the index is sorted. This can be controlled by passing
+    /// \a pika::execution::indirect_sort_selection as the executor
+    /// parameters of the execution policy.
+    ///
+    /// Passing \a pika::execution::cache_projected_keys as the executor
+    /// parameters makes the algorithm invoke \a proj once per element, the
+    /// projected keys are sorted instead of the elements.
+    ///
+    /// If the projected values are references to std::string or
+    /// std::string_view objects and \a comp is std::less, sufficiently large
+    /// sequences are sorted using a multikey quicksort instead.
+    ///
+    /// The parallel sort is cancelled by a stop request on the stop token of
+    /// \a pika::execution::sort_stop_token passed as the executor parameters
+    /// of the execution policy, it then reports
+    /// \a pika::execution::sort_cancelled.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -228,7 +258,6 @@ namespace pika {
 
 #include <pika/config.hpp>
 #include <pika/assert.hpp>
-#include <pika/async/dataflow.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/invoke.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
@@ -240,22 +269,33 @@ namespace pika {
 #include <pika/executors/exception_list.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <pika/parallel/algorithms/detail/counting_sort.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
-#include <pika/parallel/algorithms/detail/is_sorted.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
+#include <pika/parallel/algorithms/detail/pdq_sort.hpp>
 #include <pika/parallel/algorithms/detail/pivot.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/projected_key_sort.hpp>
+#include <pika/parallel/algorithms/detail/radix_sort.hpp>
+#include <pika/parallel/algorithms/detail/string_sort.hpp>
+#include <pika/parallel/algorithms/is_sorted.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
 #include <pika/parallel/util/compare_projected.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/fork_join.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+#include <pika/parallel/util/tunables.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <functional>
 #include <iterator>
-#include <list>
+#include <limits>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -283,97 +323,192 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // sort
     /// \cond NOINTERNAL
-    static const std::size_t sort_limit_per_task = 65536ul;
+    inline std::size_t sort_limit_per_task() noexcept
+    {
+        return util::get_tunable(util::tunable::sort_limit_per_task);
+    }
+
+    // sections smaller than this are never partitioned in parallel
+    static const std::size_t sort_parallel_partition_limit = 1048576ul;
+
+    // Returns the minimal size of the sections of a sort of count elements
+    // which are partitioned in parallel, those are the sections of roughly
+    // the first log2(cores) levels of the recursion.
+    inline std::size_t get_sort_parallel_partition_limit(
+        std::size_t cores, std::size_t count) noexcept
+    {
+        if (cores <= 1)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+        return (std::max)(count / cores, sort_parallel_partition_limit);
+    }
+
+    // Partitions [first, last) around the pivot *first using all cores
+    // available to the policy. Returns the position of the pivot after
+    // partitioning, the elements before it are smaller than the pivot.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    RandomIt sort_parallel_partition(
+        ExPolicy& policy, RandomIt first, RandomIt last, Comp& comp)
+    {
+        auto pred = [&comp, first](auto const& value) -> bool {
+            return PIKA_INVOKE(comp, value, *first);
+        };
+
+        RandomIt pivot_pos = partition_helper::call(
+            policy, first + 1, last, pred, projection_identity{});
+        --pivot_pos;
+
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+        std::ranges::iter_swap(first, pivot_pos);
+#else
+        std::iter_swap(first, pivot_pos);
+#endif
+        return pivot_pos;
+    }
+
+    // Returns whether at least two other elements of the sample the pivot
+    // *first was selected from by pivot9 are equal to it, which indicates
+    // many keys equal to the pivot.
+    template <typename RandomIt, typename Comp>
+    bool sort_many_equal_keys(RandomIt first, RandomIt last, Comp& comp)
+    {
+        std::size_t const chunk = (last - first) >> 3;
+        auto const equal = [&](RandomIt it) -> int {
+            return !PIKA_INVOKE(comp, *it, *first) &&
+                !PIKA_INVOKE(comp, *first, *it);
+        };
+
+        int count = equal(first + 1) + equal(last - 1);
+        for (std::size_t i = 1; i != 8; ++i)
+        {
+            count += equal(first + i * chunk);
+        }
+        return count >= 2;
+    }
+
+    // Partitions [first, last) into the elements smaller than the pivot
+    // *first, the ones equal to it and the greater ones, in parallel if
+    // the section is large. Returns the range of the elements equal to the
+    // pivot, the pivot itself is moved to its beginning.
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    std::pair<RandomIt, RandomIt> sort_partition3(ExPolicy& policy,
+        RandomIt first, RandomIt last, Comp& comp, bool parallel)
+    {
+        auto less = [&comp, first](auto const& value) -> bool {
+            return PIKA_INVOKE(comp, value, *first);
+        };
+        auto equal = [&comp, first](auto const& value) -> bool {
+            return !PIKA_INVOKE(comp, *first, value);
+        };
+
+        auto [less_last, equal_last] = parallel ?
+            partition_helper::call3(policy, first + 1, last, less, equal,
+                projection_identity{}) :
+            sequential_partition3(
+                first + 1, last, less, equal, projection_identity{});
+        --less_last;
+
+#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
+        std::ranges::iter_swap(first, less_last);
+#else
+        std::iter_swap(first, less_last);
+#endif
+        return std::make_pair(less_last, equal_last);
+    }
 
     /// \brief this function is the work assigned to each thread in the
     ///        parallel process
     /// \exception
     /// \return
-    /// \remarks
+    /// \remarks the two sections of a partitioned section are sorted by
+    ///          fork_join: the left one is spawned, the right one is sorted
+    ///          by the current thread, which then sorts the left one as well
+    ///          if no other thread has started it
     template <typename ExPolicy, typename RandomIt, typename Comp>
-    pika::future<RandomIt> sort_thread(ExPolicy&& policy, RandomIt first,
-        RandomIt last, Comp comp, std::size_t chunk_size)
+    void sort_thread(ExPolicy& policy, RandomIt first, RandomIt last,
+        Comp comp, pika::stop_token const& stop, std::size_t chunk_size,
+        int bad_allowed, std::size_t parallel_partition_limit)
     {
+        // a cancelled sort doesn't do any further work, the check of every
+        // section releases the threads quickly
+        util::detail::throw_if_sort_stop_requested(stop);
+
         std::ptrdiff_t N = last - first;
         if (std::size_t(N) <= chunk_size)
         {
-            return execution::async_execute(policy.executor(),
-                [first, last, comp = PIKA_MOVE(comp)]() -> RandomIt {
-                    std::sort(first, last, comp);
-                    return last;
-                });
-        }
-
-        // check if sorted
-        if (is_sorted_sequential(first, last, comp))
-        {
-            return pika::make_ready_future(last);
+            pdq_sort(first, last, comp);
+            return;
         }
 
         // pivot selections
         pivot9(first, last, comp);
 
-        using reference = typename std::iterator_traits<RandomIt>::reference;
-
-        reference val = *first;
-        RandomIt c_first = first + 1, c_last = last - 1;
+        // the large sections of the top levels of the recursion are
+        // partitioned in parallel, as otherwise there would be no parallelism
+        // available yet
+        bool const parallel = std::size_t(N) >= parallel_partition_limit;
 
-        while (comp(*c_first, val))
+        RandomIt left_last, right_first;
+        if (sort_many_equal_keys(first, last, comp))
         {
-            ++c_first;
+            // the elements equal to the pivot are in their final place
+            // already, excluding them keeps low cardinality input from
+            // degrading to quadratic behavior
+            std::tie(left_last, right_first) =
+                sort_partition3(policy, first, last, comp, parallel);
         }
-        while (comp(val, *c_last))
+        else
         {
-            --c_last;
-        }
-        while (c_first < c_last)
-        {
-#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-            std::ranges::iter_swap(c_first++, c_last--);
-#else
-            std::iter_swap(c_first++, c_last--);
-#endif
-            while (comp(*c_first, val))
+            // the sequential partitioning tells whether it had to swap any
+            // elements, the whole sequence was checked for being sorted
+            // only once before the recursion started
+            RandomIt pivot_pos;
+            bool already_partitioned = false;
+            if (parallel)
             {
-                ++c_first;
+                pivot_pos = sort_parallel_partition(policy, first, last, comp);
             }
-            while (comp(val, *c_last))
+            else
             {
-                --c_last;
+                std::tie(pivot_pos, already_partitioned) =
+                    partition_right_branchless(first, last, comp);
             }
-        }
-
-#if defined(PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-        std::ranges::iter_swap(first, c_last);
-#else
-        std::iter_swap(first, c_last);
-#endif
-
-        // spawn tasks for each sub section
-        pika::future<RandomIt> left = execution::async_execute(
-            policy.executor(), &sort_thread<ExPolicy, RandomIt, Comp>, policy,
-            first, c_last, comp, chunk_size);
 
-        pika::future<RandomIt> right = execution::async_execute(
-            policy.executor(), &sort_thread<ExPolicy, RandomIt, Comp>, policy,
-            c_first, last, comp, chunk_size);
-
-        return pika::dataflow(
-            [last](pika::future<RandomIt>&& left,
-                pika::future<RandomIt>&& right) -> RandomIt {
-                if (left.has_exception() || right.has_exception())
+            // too many bad pivots, guarantee O(n log n) for this section
+            std::ptrdiff_t const l_size = pivot_pos - first;
+            std::ptrdiff_t const r_size = last - (pivot_pos + 1);
+            if (l_size < N / 8 || r_size < N / 8)
+            {
+                if (--bad_allowed <= 0)
                 {
-                    std::list<std::exception_ptr> errors;
-                    if (left.has_exception())
-                        errors.push_back(left.get_exception_ptr());
-                    if (right.has_exception())
-                        errors.push_back(right.get_exception_ptr());
-
-                    throw exception_list(PIKA_MOVE(errors));
+                    pdq_heap_sort(first, last, comp);
+                    return;
                 }
-                return last;
+                pdq_break_patterns(first, pivot_pos, last);
+            }
+            else if (already_partitioned &&
+                pdq_partial_insertion_sort(first, pivot_pos, comp) &&
+                pdq_partial_insertion_sort(pivot_pos + 1, last, comp))
+            {
+                // the section was (nearly) sorted
+                return;
+            }
+
+            left_last = pivot_pos;
+            right_first = pivot_pos + 1;
+        }
+
+        fork_join(
+            policy,
+            [&]() {
+                sort_thread(policy, first, left_last, comp, stop, chunk_size,
+                    bad_allowed, parallel_partition_limit);
             },
-            PIKA_MOVE(left), PIKA_MOVE(right));
+            [&]() {
+                sort_thread(policy, right_first, last, comp, stop, chunk_size,
+                    bad_allowed, parallel_partition_limit);
+            });
     }
 
     /// \param [in] first   iterator to the first element to sort
@@ -403,27 +538,52 @@ namespace pika::parallel::detail {
         adjust_chunk_size_and_max_chunks(cores, count, max_chunks, chunk_size);
 
         // we should not get smaller than our sort_limit_per_task
-        chunk_size = (std::max)(chunk_size, sort_limit_per_task);
+        chunk_size = (std::max)(chunk_size, sort_limit_per_task());
 
         std::ptrdiff_t N = last - first;
         PIKA_ASSERT(N >= 0);
 
         if (std::size_t(N) < chunk_size)
         {
-            std::sort(first, last, comp);
-            return pika::make_ready_future(last);
-        }
-
-        // check if already sorted
-        if (is_sorted_sequential(first, last, comp))
-        {
+            pdq_sort(first, last, comp);
             return pika::make_ready_future(last);
         }
 
         return execution::async_execute(policy.executor(),
-            &sort_thread<std::decay_t<ExPolicy>, RandomIt, Comp>,
-            PIKA_FORWARD(ExPolicy, policy), first, last,
-            PIKA_FORWARD(Comp, comp), chunk_size);
+            [policy, first, last, comp = PIKA_FORWARD(Comp, comp), chunk_size,
+                bad_allowed = pdq_log2(N),
+                parallel_partition_limit = get_sort_parallel_partition_limit(
+                    cores, count)]() mutable -> RandomIt {
+                try
+                {
+                    // check if already sorted, in parallel and only once,
+                    // the recursion detects sorted sections while
+                    // partitioning them
+                    if (is_sorted<RandomIt, RandomIt>::parallel(
+                            policy(pika::execution::non_task), first, last,
+                            comp, projection_identity{}))
+                    {
+                        return last;
+                    }
+
+                    sort_thread(policy, first, last, comp,
+                        util::detail::get_sort_stop_token(policy.parameters()),
+                        chunk_size, bad_allowed, parallel_partition_limit);
+                    return last;
+                }
+                catch (std::bad_alloc const&)
+                {
+                    throw;
+                }
+                catch (pika::exception_list const&)
+                {
+                    throw;
+                }
+                catch (...)
+                {
+                    throw pika::exception_list(std::current_exception());
+                }
+            });
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -436,12 +596,266 @@ namespace pika::parallel::detail {
         {
         }
 
+        template <typename Comp, typename ExPolicy, typename Proj>
+        static typename algorithm_result<ExPolicy, RandomIt>::type
+        parallel_radix_sort(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Proj& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
+            constexpr bool descending = radix_sort_order<std::decay_t<Comp>,
+                radix_sort_key_t<RandomIt, Proj>>::descending;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return algorithm_result::get(
+                    execution::async_execute(policy.executor(),
+                        [policy, first, last, proj]() mutable -> RandomIt {
+                            radix_sort<descending>(
+                                policy, first, last - first, proj);
+                            return last;
+                        }));
+            }
+            else
+            {
+                radix_sort<descending>(policy, first, last - first, proj);
+                return algorithm_result::get(PIKA_MOVE(last));
+            }
+        }
+
+        // Sorts the elements by counting their keys, see counting_sort. The
+        // radix or comparison based sort is used instead if any key lies
+        // outside of the range given by the executor parameters.
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static void parallel_counting_sort_sync(ExPolicy& policy,
+            RandomIt first, RandomIt last, Comp& comp, Proj& proj)
+        {
+            constexpr bool descending = radix_sort_order<std::decay_t<Comp>,
+                radix_sort_key_t<RandomIt, Proj>>::descending;
+
+            std::size_t const count = last - first;
+            auto non_task_policy = policy(pika::execution::non_task);
+            if (counting_sort<descending>(
+                    non_task_policy, first, count, proj, policy.parameters()))
+            {
+                return;
+            }
+
+            if constexpr (use_radix_sort_v<RandomIt, Comp, Proj>)
+            {
+                if (count >= radix_sort_limit)
+                {
+                    radix_sort<descending>(non_task_policy, first, count, proj);
+                    return;
+                }
+            }
+
+            parallel_sort_async(non_task_policy, first, last,
+                compare_projected<Comp&, Proj&>(comp, proj))
+                .get();
+        }
+
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static typename algorithm_result<ExPolicy, RandomIt>::type
+        parallel_counting_sort(ExPolicy&& policy, RandomIt first,
+            RandomIt last, Comp& comp, Proj& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return algorithm_result::get(
+                    execution::async_execute(policy.executor(),
+                        [policy, first, last, comp, proj]() mutable
+                        -> RandomIt {
+                            parallel_counting_sort_sync(
+                                policy, first, last, comp, proj);
+                            return last;
+                        }));
+            }
+            else
+            {
+                parallel_counting_sort_sync(policy, first, last, comp, proj);
+                return algorithm_result::get(PIKA_MOVE(last));
+            }
+        }
+
+        // Sorts the iterators referring to the elements in parallel and
+        // moves the elements to their place afterwards, see indirect_sort
+        template <typename ExPolicy, typename Compare>
+        static void parallel_indirect_sort_sync(ExPolicy& policy,
+            RandomIt first, RandomIt last, Compare const& comp)
+        {
+            auto non_task_policy = policy(pika::execution::non_task);
+            indirect_sort(non_task_policy, first, last, comp,
+                [&](auto index_first, auto index_last, auto index_comp) {
+                    parallel_sort_async(non_task_policy, index_first,
+                        index_last, PIKA_MOVE(index_comp))
+                        .get();
+                });
+        }
+
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static typename algorithm_result<ExPolicy, RandomIt>::type
+        parallel_indirect_sort(ExPolicy&& policy, RandomIt first,
+            RandomIt last, Comp& comp, Proj& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
+            using compare_type =
+                compare_projected<std::decay_t<Comp>, std::decay_t<Proj>>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return algorithm_result::get(execution::async_execute(
+                    policy.executor(),
+                    [policy, first, last,
+                        comp = compare_type(comp, proj)]() mutable
+                    -> RandomIt {
+                        parallel_indirect_sort_sync(policy, first, last, comp);
+                        return last;
+                    }));
+            }
+            else
+            {
+                parallel_indirect_sort_sync(
+                    policy, first, last, compare_type(comp, proj));
+                return algorithm_result::get(PIKA_MOVE(last));
+            }
+        }
+
+        // Sorts (key, iterator) pairs instead of the elements and moves the
+        // elements to their place afterwards, see projected_key_sort
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static void parallel_projected_key_sort_sync(ExPolicy& policy,
+            RandomIt first, RandomIt last, Comp& comp, Proj& proj)
+        {
+            auto non_task_policy = policy(pika::execution::non_task);
+            projected_key_sort(non_task_policy, first, last, proj,
+                [&](auto elements_first, auto elements_last) {
+                    sort<decltype(elements_first)>::parallel(non_task_policy,
+                        elements_first, elements_last, comp, cached_key());
+                });
+        }
+
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static typename algorithm_result<ExPolicy, RandomIt>::type
+        parallel_projected_key_sort(ExPolicy&& policy, RandomIt first,
+            RandomIt last, Comp& comp, Proj& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return algorithm_result::get(execution::async_execute(
+                    policy.executor(),
+                    [policy, first, last, comp, proj]() mutable -> RandomIt {
+                        parallel_projected_key_sort_sync(
+                            policy, first, last, comp, proj);
+                        return last;
+                    }));
+            }
+            else
+            {
+                parallel_projected_key_sort_sync(
+                    policy, first, last, comp, proj);
+                return algorithm_result::get(PIKA_MOVE(last));
+            }
+        }
+
+        // Sorts the elements by their string keys, see string_sort
+        template <typename ExPolicy, typename Proj>
+        static typename algorithm_result<ExPolicy, RandomIt>::type
+        parallel_string_sort(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Proj& proj)
+        {
+            using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
+
+            auto sort_strings = [first, last](
+                                    auto& sort_policy, auto& sort_proj) {
+                auto non_task_policy = sort_policy(pika::execution::non_task);
+                string_sort(non_task_policy, first, last, sort_proj,
+                    util::detail::get_sort_stop_token(sort_policy.parameters()),
+                    sort_limit_per_task());
+            };
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return algorithm_result::get(execution::async_execute(
+                    policy.executor(),
+                    [policy, last, proj, sort_strings]() mutable -> RandomIt {
+                        sort_strings(policy, proj);
+                        return last;
+                    }));
+            }
+            else
+            {
+                sort_strings(policy, proj);
+                return algorithm_result::get(PIKA_MOVE(last));
+            }
+        }
+
         template <typename ExPolicy, typename Sent, typename Comp,
             typename Proj>
-        static RandomIt sequential(
-            ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
+        static RandomIt sequential(ExPolicy policy, RandomIt first, Sent last,
+            Comp&& comp, Proj&& proj)
         {
             auto last_iter = advance_to_sentinel(first, last);
+            if constexpr (use_projected_key_sort_v<
+                              decltype(policy.parameters()), RandomIt, Proj>)
+            {
+                projected_key_sort(policy, first, last_iter, proj,
+                    [&](auto elements_first, auto elements_last) {
+                        sort<decltype(elements_first)>::sequential(policy,
+                            elements_first, elements_last, comp,
+                            cached_key());
+                    });
+                return last_iter;
+            }
+
+            if constexpr (use_string_sort_v<RandomIt, Comp, Proj>)
+            {
+                if (std::size_t(last_iter - first) >= string_sort_limit)
+                {
+                    string_sort(policy, first, last_iter, proj);
+                    return last_iter;
+                }
+            }
+
+            if constexpr (use_counting_sort_v<decltype(policy.parameters()),
+                              RandomIt, Comp, Proj>)
+            {
+                constexpr bool descending =
+                    radix_sort_order<std::decay_t<Comp>,
+                        radix_sort_key_t<RandomIt, Proj>>::descending;
+                if (counting_sort<descending>(policy, first,
+                        std::size_t(last_iter - first), proj,
+                        policy.parameters()))
+                {
+                    return last_iter;
+                }
+            }
+
+            if constexpr (use_indirect_sort_v<RandomIt>)
+            {
+                using value_type =
+                    typename std::iterator_traits<RandomIt>::value_type;
+                if (select_indirect_sort<value_type>(
+                        policy.parameters(), std::size_t(last_iter - first)))
+                {
+                    indirect_sort(policy, first, last_iter,
+                        compare_projected<Comp&, Proj&>(comp, proj),
+                        [](auto index_first, auto index_last,
+                            auto index_comp) {
+                            std::sort(index_first, index_last, index_comp);
+                        });
+                    return last_iter;
+                }
+            }
+
             std::sort(
                 first, last_iter, compare_projected<Comp&, Proj&>(comp, proj));
             return last_iter;
@@ -458,6 +872,59 @@ namespace pika::parallel::detail {
 
             try
             {
+                util::detail::throw_if_sort_stop_requested(
+                    util::detail::get_sort_stop_token(policy.parameters()));
+
+                if constexpr (use_projected_key_sort_v<
+                                  decltype(policy.parameters()), RandomIt,
+                                  Proj>)
+                {
+                    return parallel_projected_key_sort(
+                        PIKA_FORWARD(ExPolicy, policy), first, last, comp,
+                        proj);
+                }
+
+                if constexpr (use_string_sort_v<RandomIt, Comp, Proj>)
+                {
+                    if (std::size_t(last - first) >= string_sort_limit)
+                    {
+                        return parallel_string_sort(
+                            PIKA_FORWARD(ExPolicy, policy), first, last, proj);
+                    }
+                }
+
+                if constexpr (use_counting_sort_v<
+                                  decltype(policy.parameters()), RandomIt,
+                                  Comp, Proj>)
+                {
+                    return parallel_counting_sort(
+                        PIKA_FORWARD(ExPolicy, policy), first, last, comp,
+                        proj);
+                }
+
+                if constexpr (use_indirect_sort_v<RandomIt>)
+                {
+                    using value_type =
+                        typename std::iterator_traits<RandomIt>::value_type;
+                    if (select_indirect_sort<value_type>(
+                            policy.parameters(), std::size_t(last - first)))
+                    {
+                        return parallel_indirect_sort(
+                            PIKA_FORWARD(ExPolicy, policy), first, last, comp,
+                            proj);
+                    }
+                }
+
+                if constexpr (use_radix_sort_v<RandomIt, Comp, Proj>)
+                {
+                    if (select_radix_sort(policy.parameters(),
+                            std::size_t(last - first)))
+                    {
+                        return parallel_radix_sort<Comp>(
+                            PIKA_FORWARD(ExPolicy, policy), first, last, proj);
+                    }
+                }
+
                 // call the sort routine and return the right type,
                 // depending on execution policy
                 return algorithm_result::get(
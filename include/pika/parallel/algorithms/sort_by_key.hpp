@@ -8,15 +8,29 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <exception>
 #include <iterator>
+#include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace pika {
     template <typename KeyIter, typename ValueIter>
@@ -35,6 +49,180 @@ namespace pika {
                 return std::get<0>(PIKA_FORWARD(Tuple, t));
             }
         };
+
+        // Moving the values along with the keys is cheaper than permuting
+        // them afterwards only if they are not larger than an index. The
+        // permutation requires default constructible keys and values which
+        // can be moved without throwing.
+        template <typename Key, typename Value>
+        inline constexpr bool use_sort_by_key_permutation_v =
+#if defined(PIKA_HAVE_TUPLE_RVALUE_SWAP)
+            !(sizeof(Value) <= sizeof(std::size_t) &&
+                std::is_trivially_copyable_v<Value>) &&
+#endif
+            std::is_default_constructible_v<Key> &&
+            std::is_nothrow_move_constructible_v<Value> &&
+            std::is_nothrow_move_assignable_v<Value>;
+
+        // the minimal number of elements handled by a chunk of the loops
+        // moving the keys and values
+        static const std::size_t sort_by_key_chunk_limit = 16384ul;
+
+        // Invokes f(begin, end) for chunks of [0, count), the chunks are run
+        // in parallel unless the policy is sequenced.
+        template <typename ExPolicy, typename F>
+        void sort_by_key_for_each_chunk(
+            ExPolicy& policy, std::size_t count, F&& f)
+        {
+            if constexpr (pika::is_sequenced_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                f(std::size_t(0), count);
+            }
+            else
+            {
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+                std::size_t const num_chunks = (std::max)(std::size_t(1),
+                    (std::min)(cores, count / sort_by_key_chunk_limit));
+
+                execution::bulk_sync_execute(
+                    policy.executor(),
+                    [&](std::size_t chunk) {
+                        f(chunk * count / num_chunks,
+                            (chunk + 1) * count / num_chunks);
+                    },
+                    pika::detail::irange(std::size_t(0), num_chunks));
+            }
+        }
+
+        // Sorts (key, index) pairs, afterwards the keys are moved back and
+        // the values are gathered into a temporary buffer according to the
+        // sorted indices, which moves every value exactly twice. Arithmetic
+        // keys are sorted by the radix sort engine of sort.
+        template <typename ExPolicy, typename KeyIter, typename ValueIter,
+            typename Compare>
+        void sort_by_key_permutation(ExPolicy&& policy, KeyIter key_first,
+            KeyIter key_last, ValueIter value_first, Compare& comp)
+        {
+            using key_type = typename std::iterator_traits<KeyIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<ValueIter>::value_type;
+            using element = std::pair<key_type, std::size_t>;
+            using element_iterator = typename std::vector<element>::iterator;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count < 2)
+            {
+                return;
+            }
+
+            std::vector<element> elements(count);
+            sort_by_key_for_each_chunk(
+                policy, count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        elements[i].first = PIKA_MOVE(*(key_first + i));
+                        elements[i].second = i;
+                    }
+                });
+
+            sort<element_iterator>().call(policy, elements.begin(),
+                elements.end(), comp, extract_key());
+
+            struct buffer_holder
+            {
+                ~buffer_holder()
+                {
+                    util::detail::deallocate_temporary_buffer(data);
+                }
+
+                value_type* data;
+            } buffer{static_cast<value_type*>(
+                util::detail::allocate_temporary_buffer(
+                    count * sizeof(value_type)))};
+
+            sort_by_key_for_each_chunk(
+                policy, count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        *(key_first + i) = PIKA_MOVE(elements[i].first);
+                        ::new (static_cast<void*>(buffer.data + i)) value_type(
+                            PIKA_MOVE(*(value_first + elements[i].second)));
+                    }
+                });
+
+            sort_by_key_for_each_chunk(
+                policy, count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        *(value_first + i) = PIKA_MOVE(buffer.data[i]);
+                        std::destroy_at(buffer.data + i);
+                    }
+                });
+        }
+
+        template <typename KeyIter, typename ValueIter>
+        struct sort_by_key_permuted
+          : public algorithm<sort_by_key_permuted<KeyIter, ValueIter>,
+                std::pair<KeyIter, ValueIter>>
+        {
+            using result_type = std::pair<KeyIter, ValueIter>;
+
+            sort_by_key_permuted()
+              : sort_by_key_permuted::algorithm("sort_by_key")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare>
+            static result_type sequential(ExPolicy&& policy,
+                KeyIter key_first, KeyIter key_last, ValueIter value_first,
+                Compare&& comp)
+            {
+                sort_by_key_permutation(PIKA_FORWARD(ExPolicy, policy),
+                    key_first, key_last, value_first, comp);
+                return result_type(key_last,
+                    std::next(value_first, std::distance(key_first, key_last)));
+            }
+
+            template <typename ExPolicy, typename Compare>
+            static typename algorithm_result<ExPolicy, result_type>::type
+            parallel(ExPolicy&& policy, KeyIter key_first, KeyIter key_last,
+                ValueIter value_first, Compare&& comp)
+            {
+                using algorithm_result =
+                    algorithm_result<ExPolicy, result_type>;
+
+                try
+                {
+                    if constexpr (pika::is_async_execution_policy_v<
+                                      std::decay_t<ExPolicy>>)
+                    {
+                        return algorithm_result::get(
+                            execution::async_execute(policy.executor(),
+                                [policy, key_first, key_last, value_first,
+                                    comp]() mutable -> result_type {
+                                    return sequential(
+                                        policy(pika::execution::non_task),
+                                        key_first, key_last, value_first,
+                                        comp);
+                                }));
+                    }
+                    else
+                    {
+                        return algorithm_result::get(
+                            sequential(PIKA_FORWARD(ExPolicy, policy),
+                                key_first, key_last, value_first, comp));
+                    }
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        handle_exception<ExPolicy, result_type>::call(
+                            std::current_exception()));
+                }
+            }
+        };
         /// \endcond
     }    // namespace parallel::detail
 
@@ -89,6 +277,14 @@ namespace pika {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// \note Unless the values are trivially copyable and not larger than an
+    ///       index, the algorithm sorts the keys together with their original
+    ///       positions and moves the values into place afterwards. This
+    ///       requires the keys to be default constructible and the values to
+    ///       be nothrow move constructible and assignable. Otherwise, or for
+    ///       small values, the keys and values are sorted together, which is
+    ///       only supported if PIKA_HAVE_TUPLE_RVALUE_SWAP is defined.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -122,26 +318,42 @@ namespace pika {
         [[maybe_unused]] ValueIter value_first,
         [[maybe_unused]] Compare&& comp = Compare())
     {
-#if !defined(PIKA_HAVE_TUPLE_RVALUE_SWAP)
-        static_assert(sizeof(KeyIter) == 0,    // always false
-            "sort_by_key is not supported unless PIKA_HAVE_TUPLE_RVALUE_SWAP "
-            "is defined");
-#else
         static_assert((pika::traits::is_random_access_iterator_v<KeyIter>),
             "Requires a random access iterator.");
         static_assert((pika::traits::is_random_access_iterator_v<ValueIter>),
             "Requires a random access iterator.");
 
-        ValueIter value_last = value_first;
-        std::advance(value_last, std::distance(key_first, key_last));
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using value_type = typename std::iterator_traits<ValueIter>::value_type;
+
+        if constexpr (parallel::detail::use_sort_by_key_permutation_v<key_type,
+                          value_type>)
+        {
+            return parallel::detail::sort_by_key_permuted<KeyIter, ValueIter>()
+                .call(PIKA_FORWARD(ExPolicy, policy), key_first, key_last,
+                    value_first, PIKA_FORWARD(Compare, comp));
+        }
+        else
+        {
+#if !defined(PIKA_HAVE_TUPLE_RVALUE_SWAP)
+            static_assert(sizeof(KeyIter) == 0,    // always false
+                "sort_by_key requires default constructible keys and nothrow "
+                "movable values unless PIKA_HAVE_TUPLE_RVALUE_SWAP is defined");
+#else
+            ValueIter value_last = value_first;
+            std::advance(value_last, std::distance(key_first, key_last));
 
-        using iterator_type = pika::util::zip_iterator<KeyIter, ValueIter>;
+            using iterator_type =
+                pika::util::zip_iterator<KeyIter, ValueIter>;
 
-        return detail::get_iter_pair<iterator_type>(
-            detail::sort<iterator_type>().call(PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(key_first, value_first),
-                pika::util::make_zip_iterator(key_last, value_last),
-                PIKA_FORWARD(Compare, comp), parallel::detail::extract_key()));
+            return detail::get_iter_pair<iterator_type>(
+                detail::sort<iterator_type>().call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(key_first, value_first),
+                    pika::util::make_zip_iterator(key_last, value_last),
+                    PIKA_FORWARD(Compare, comp),
+                    parallel::detail::extract_key()));
 #endif
+        }
     }
 }    // namespace pika
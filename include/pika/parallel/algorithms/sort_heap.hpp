@@ -0,0 +1,211 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/sort_heap.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Converts the \a max \a heap [first, last) into a range sorted in
+    /// ascending order. The parallel overloads sort the range with the
+    /// parallel \a sort algorithm. A heap which is already sorted in
+    /// descending order is reversed instead.
+    ///
+    /// \note Complexity: O(N log(N)) comparisons where
+    ///       \a N = distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RndIter     The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the comparison function object
+    ///                     (deduced). This defaults to std::less<>
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the heap.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second. It has to be the predicate the heap was
+    ///                     built with.
+    ///
+    /// The comparison operations in the parallel \a sort_heap algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparison operations in the parallel \a sort_heap algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a sort_heap algorithm returns a \a pika::future<void>
+    ///           if the execution policy is of type \a task_execution_policy
+    ///           and returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename RndIter, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+    sort_heap(ExPolicy&& policy, RndIter first, RndIter last,
+        Comp&& comp = Comp());
+
+    /// Converts the \a max \a heap [first, last) into a range sorted in
+    /// ascending order.
+    ///
+    /// \note Complexity: at most 2*N*log(N) comparisons where
+    ///       \a N = distance(first, last).
+    ///
+    /// \tparam RndIter     The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the comparison function object
+    ///                     (deduced). This defaults to std::less<>
+    /// \param first        Refers to the beginning of the heap.
+    /// \param last         Refers to the end of the heap.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second.
+    ///
+    template <typename RndIter, typename Comp = detail::less>
+    void sort_heap(RndIter first, RndIter last, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/traits/is_invocable.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/is_sorted.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/reverse.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/util/compare_projected.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // sort_heap
+    template <typename RndIter>
+    struct sort_heap : public algorithm<sort_heap<RndIter>, RndIter>
+    {
+        sort_heap()
+          : sort_heap::algorithm("sort_heap")
+        {
+        }
+
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static RndIter sequential(
+            ExPolicy, RndIter first, RndIter last, Comp&& comp, Proj&& proj)
+        {
+            std::sort_heap(
+                first, last, compare_projected<Comp&, Proj&>(comp, proj));
+            return last;
+        }
+
+        template <typename ExPolicy, typename Comp, typename Proj>
+        static typename algorithm_result<ExPolicy, RndIter>::type
+        parallel(ExPolicy&& policy, RndIter first, RndIter last, Comp&& comp,
+            Proj&& proj)
+        {
+            // A range sorted in descending order is a heap, which is the
+            // case for heaps built from presorted input. The check stops at
+            // the first pair out of order, after a few elements for most
+            // other heaps.
+            auto greater = [&comp](auto&& lhs, auto&& rhs) {
+                return PIKA_INVOKE(comp, PIKA_FORWARD(decltype(rhs), rhs),
+                    PIKA_FORWARD(decltype(lhs), lhs));
+            };
+            if (is_sorted_sequential(first, last, greater, proj))
+            {
+                return reverse<RndIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last);
+            }
+
+            // The order of the heap helps little when sorting it, all but
+            // the largest elements are far from their final positions.
+            return sort<RndIter>().call(PIKA_FORWARD(ExPolicy, policy), first,
+                last, PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj, proj));
+        }
+    };
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::sort_heap
+    inline constexpr struct sort_heap_t final
+      : pika::detail::tag_parallel_algorithm<sort_heap_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RndIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RndIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RndIter>::value_type,
+                    typename std::iterator_traits<RndIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(sort_heap_t, ExPolicy&& policy, RndIter first,
+            RndIter last, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RndIter>::value,
+                "Requires random access iterator.");
+
+            return pika::parallel::detail::algorithm_result<ExPolicy>::get(
+                pika::parallel::detail::sort_heap<RndIter>().call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Comp, comp),
+                    pika::parallel::detail::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename RndIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RndIter>::value &&
+                pika::detail::is_invocable_v<Comp,
+                    typename std::iterator_traits<RndIter>::value_type,
+                    typename std::iterator_traits<RndIter>::value_type
+                >
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(
+            sort_heap_t, RndIter first, RndIter last, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RndIter>::value,
+                "Requires random access iterator.");
+
+            pika::parallel::detail::sort_heap<RndIter>().call(
+                pika::execution::seq, first, last, PIKA_FORWARD(Comp, comp),
+                pika::parallel::detail::projection_identity{});
+        }
+    } sort_heap{};
+}    // namespace pika
+
+#endif    // DOXYGEN
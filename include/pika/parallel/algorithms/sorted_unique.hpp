@@ -0,0 +1,453 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/sorted_unique.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Copies the first element of every group of equivalent elements of the
+    /// sorted range [first, last) to the range beginning at \a dest. Two
+    /// elements a and b are equivalent if neither comp(a, b) nor comp(b, a)
+    /// holds. Unlike \a unique_copy, this relies on the range being sorted:
+    /// the range is split into chunks at the beginning of groups, and long
+    /// groups are skipped by exponential searches instead of comparing all
+    /// of their elements.
+    ///
+    /// \note   Complexity: O(min(N, G log(N / G))) applications of
+    ///         \a comp, where N is \a last - \a first and G is the number
+    ///         of groups.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a sorted_unique_copy requires \a Comp
+    ///                     to meet the requirements of \a CopyConstructible.
+    ///                     This defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sorted sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sorted sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The range must be sorted with
+    ///                     respect to it.
+    ///
+    /// The comparisons in the parallel \a sorted_unique_copy algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The comparisons in the parallel \a sorted_unique_copy algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a sorted_unique_copy algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise. The \a sorted_unique_copy
+    ///           algorithm returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    sorted_unique_copy(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter2 dest, Comp&& comp = Comp());
+
+    /// Copies the first element of every group of equivalent elements of the
+    /// sorted range [first, last) to the range beginning at \a values_dest
+    /// and the number of elements of the group to the range beginning at
+    /// \a counts_dest. This is \a run_length_encode for sorted ranges, see
+    /// \a sorted_unique_copy.
+    ///
+    /// \note   Complexity: O(min(N, G log(N / G))) applications of
+    ///         \a comp, where N is \a last - \a first and G is the number
+    ///         of groups.
+    ///
+    /// \tparam FwdIter3    The type of the iterator representing the
+    ///                     destination of the sizes of the groups (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator, its value type must be an
+    ///                     arithmetic type.
+    ///
+    /// \returns  The \a sorted_unique_count algorithm returns a
+    ///           \a pika::future<in_out_out_result<RandIter, FwdIter2,
+    ///           FwdIter3>>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_out_result<RandIter, FwdIter2, FwdIter3>
+    ///           otherwise. The result holds \a last and the ends of the two
+    ///           destination ranges.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename FwdIter3, typename Comp = detail::less>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        in_out_out_result<RandIter, FwdIter2, FwdIter3>>::type
+    sorted_unique_count(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter2 values_dest, FwdIter3 counts_dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // sorted_unique_copy, sorted_unique_count
+    /// \cond NOINTERNAL
+
+    // sorted_unique_copy does not write the sizes of the groups
+    struct sorted_unique_no_counts
+    {
+    };
+
+    // The end of the group of elements equivalent to *it. Most groups of
+    // inputs with few duplicates end after one or two elements, only longer
+    // groups are skipped by galloping.
+    template <typename Iter, typename Comp>
+    Iter sorted_unique_group_end(Iter it, Iter last, Comp& comp)
+    {
+        auto&& value = *it;
+        Iter next = it + 1;
+        if (next == last || PIKA_INVOKE(comp, value, *next))
+        {
+            return next;
+        }
+        return detail::gallop_upper_bound(
+            next + 1, last, value, comp, projection_identity());
+    }
+
+    template <typename Iter, typename Comp>
+    std::size_t sorted_unique_count_groups(Iter first, Iter last, Comp& comp)
+    {
+        std::size_t groups = 0;
+        for (/**/; first != last; ++groups)
+        {
+            first = sorted_unique_group_end(first, last, comp);
+        }
+        return groups;
+    }
+
+    template <typename Iter, typename OutIter, typename CountIter,
+        typename Comp>
+    in_out_out_result<Iter, OutIter, CountIter> sorted_unique_write(
+        Iter first, Iter last, OutIter values_dest, CountIter counts_dest,
+        Comp& comp)
+    {
+        while (first != last)
+        {
+            Iter next = sorted_unique_group_end(first, last, comp);
+            *values_dest++ = *first;
+            if constexpr (!std::is_same_v<CountIter, sorted_unique_no_counts>)
+            {
+                using count_type =
+                    typename std::iterator_traits<CountIter>::value_type;
+                *counts_dest++ = static_cast<count_type>(next - first);
+            }
+            first = next;
+        }
+        return {PIKA_MOVE(first), PIKA_MOVE(values_dest),
+            PIKA_MOVE(counts_dest)};
+    }
+
+    // -----------------------------------------------------------------------
+    // The chunks begin at the first element of a group, no group is split
+    // between chunks and every chunk is processed independently in two
+    // passes:
+    //  1. count the groups of each chunk, the exclusive scan of the counts
+    //     gives the output position of the first group of each chunk
+    //  2. write the groups of each chunk to their place
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter, typename FwdIter2,
+        typename CountIter, typename Comp>
+    in_out_out_result<RandIter, FwdIter2, CountIter> sorted_unique_impl(
+        ExPolicy& policy, RandIter first, std::size_t count,
+        FwdIter2 values_dest, CountIter counts_dest, Comp& comp)
+    {
+        std::size_t const num_chunks = run_length_num_chunks(policy, count);
+
+        // bounds[chunk] is moved back to the beginning of its group
+        std::vector<std::size_t> bounds(num_chunks + 1, count);
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            std::size_t const begin = chunk * count / num_chunks;
+            bounds[chunk] = begin == 0 ?
+                0 :
+                detail::lower_bound(first, first + begin, first[begin], comp,
+                    projection_identity()) -
+                    first;
+        }
+
+        // step 1, offsets[chunk] is the number of groups before the chunk
+        std::vector<std::size_t> offsets(num_chunks + 1, 0);
+        auto count_groups = [&](std::size_t chunk) {
+            offsets[chunk + 1] = sorted_unique_count_groups(
+                first + bounds[chunk], first + bounds[chunk + 1], comp);
+        };
+        run_chunks(policy, num_chunks, count_groups);
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        // step 2
+        auto write_groups = [&](std::size_t chunk) {
+            if constexpr (std::is_same_v<CountIter, sorted_unique_no_counts>)
+            {
+                sorted_unique_write(first + bounds[chunk],
+                    first + bounds[chunk + 1],
+                    std::next(values_dest, offsets[chunk]), counts_dest, comp);
+            }
+            else
+            {
+                sorted_unique_write(first + bounds[chunk],
+                    first + bounds[chunk + 1],
+                    std::next(values_dest, offsets[chunk]),
+                    std::next(counts_dest, offsets[chunk]), comp);
+            }
+        };
+        run_chunks(policy, num_chunks, write_groups);
+
+        std::size_t const groups = offsets.back();
+        if constexpr (std::is_same_v<CountIter, sorted_unique_no_counts>)
+        {
+            return {std::next(first, count), std::next(values_dest, groups),
+                counts_dest};
+        }
+        else
+        {
+            return {std::next(first, count), std::next(values_dest, groups),
+                std::next(counts_dest, groups)};
+        }
+    }
+
+    template <typename Result>
+    struct sorted_unique : public algorithm<sorted_unique<Result>, Result>
+    {
+        sorted_unique()
+          : sorted_unique::algorithm("sorted_unique")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename OutIter,
+            typename CountIter, typename Comp>
+        static Result sequential(ExPolicy, RandIter first, RandIter last,
+            OutIter values_dest, CountIter counts_dest, Comp&& comp)
+        {
+            auto result = sorted_unique_write(
+                first, last, values_dest, counts_dest, comp);
+            if constexpr (std::is_same_v<CountIter, sorted_unique_no_counts>)
+            {
+                return result.out1;
+            }
+            else
+            {
+                return result;
+            }
+        }
+
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename CountIter, typename Comp>
+        static typename algorithm_result<ExPolicy, Result>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last,
+            FwdIter2 values_dest, CountIter counts_dest, Comp&& comp)
+        {
+            std::size_t const count = std::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, Result>::get(sequential(
+                    policy, first, last, values_dest, counts_dest, comp));
+            }
+
+            return run_length_parallel<ExPolicy, Result>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, count, values_dest, counts_dest,
+                    comp = PIKA_FORWARD(Comp, comp)](auto& p) mutable
+                -> Result {
+                    auto result = sorted_unique_impl(
+                        p, first, count, values_dest, counts_dest, comp);
+                    if constexpr (std::is_same_v<CountIter,
+                                      sorted_unique_no_counts>)
+                    {
+                        return result.out1;
+                    }
+                    else
+                    {
+                        return result;
+                    }
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::sorted_unique_copy
+    inline constexpr struct sorted_unique_copy_t final
+      : pika::detail::tag_parallel_algorithm<sorted_unique_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(sorted_unique_copy_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter2 dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::sorted_unique<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest,
+                pika::parallel::detail::sorted_unique_no_counts{},
+                PIKA_FORWARD(Comp, comp));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OutIter,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(sorted_unique_copy_t,
+            RandIter first, RandIter last, OutIter dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::sorted_unique<OutIter>().call(
+                pika::execution::seq, first, last, dest,
+                pika::parallel::detail::sorted_unique_no_counts{},
+                PIKA_FORWARD(Comp, comp));
+        }
+    } sorted_unique_copy{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::sorted_unique_count
+    inline constexpr struct sorted_unique_count_t final
+      : pika::detail::tag_parallel_algorithm<sorted_unique_count_t>
+    {
+    private:
+        template <typename I, typename O1, typename O2>
+        using result_type =
+            pika::parallel::detail::in_out_out_result<I, O1, O2>;
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter2,
+            typename FwdIter3, typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::traits::is_iterator<FwdIter3>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            result_type<RandIter, FwdIter2, FwdIter3>>::type
+        tag_fallback_invoke(sorted_unique_count_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter2 values_dest,
+            FwdIter3 counts_dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value &&
+                    pika::traits::is_forward_iterator<FwdIter3>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::sorted_unique<
+                result_type<RandIter, FwdIter2, FwdIter3>>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    values_dest, counts_dest, PIKA_FORWARD(Comp, comp));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OutIter1, typename OutIter2,
+            typename Comp = pika::parallel::detail::less,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OutIter1>::value &&
+                pika::traits::is_iterator<OutIter2>::value
+            )>
+        // clang-format on
+        friend result_type<RandIter, OutIter1, OutIter2> tag_fallback_invoke(
+            sorted_unique_count_t, RandIter first, RandIter last,
+            OutIter1 values_dest, OutIter2 counts_dest, Comp&& comp = Comp())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter1>::value &&
+                    pika::traits::is_output_iterator<OutIter2>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::sorted_unique<
+                result_type<RandIter, OutIter1, OutIter2>>()
+                .call(pika::execution::seq, first, last, values_dest,
+                    counts_dest, PIKA_FORWARD(Comp, comp));
+        }
+    } sorted_unique_count{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -0,0 +1,542 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/split.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Writes the positions of the delimiters of the range [first, last), the
+    /// elements for which \a pred returns true, to the range beginning at
+    /// \a dest in increasing order. For the delimiter positions d0, d1, ...,
+    /// dn the fields of the range are [0, d0), [d0 + 1, d1), ...,
+    /// [dn + 1, last - first).
+    ///
+    /// \note   Complexity: Exactly \a last - \a first applications of the
+    ///         predicate.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a split requires \a Pred to meet the
+    ///                     requirements of \a CopyConstructible.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced). This iterator type
+    ///                     must meet the requirements of a forward iterator,
+    ///                     a std::size_t has to be assignable to its elements.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         The unary predicate which returns true for the
+    ///                     delimiters. The signature of this predicate should
+    ///                     be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The elements are examined in blocks of 64, the results of \a pred for
+    /// a block are gathered into a bit mask before the positions are
+    /// extracted from the mask. For simple predicates over contiguous
+    /// characters compilers turn the gathering into vector comparisons.
+    ///
+    /// The invocations of \a pred in the parallel \a split algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a pred in the parallel \a split algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a split algorithm returns a \a pika::future<FwdIter2>
+    ///           if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter2 otherwise.
+    ///           It returns the end of the destination range.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename Pred,
+        typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    split(ExPolicy&& policy, FwdIter1 first, FwdIter1 last, Pred&& pred,
+        FwdIter2 dest);
+
+    /// Writes the positions of the delimiters of the range [first, last)
+    /// which are not quoted to the range beginning at \a dest in increasing
+    /// order, like the field separators of a CSV record. Every element for
+    /// which \a quote returns true opens or closes a quoted section, the
+    /// elements for which \a pred returns true are delimiters if they are
+    /// not part of a quoted section. Quotes are never delimiters. An escaped
+    /// quote written as two quotes closes and reopens the quoted section.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first applications of each
+    ///         of the predicates.
+    ///
+    /// \tparam Quote       The type of the function/function object
+    ///                     recognizing quotes (deduced). The parallel
+    ///                     overload of \a split_quoted requires \a Quote to
+    ///                     meet the requirements of \a CopyConstructible.
+    ///
+    /// \param quote        The unary predicate which returns true for the
+    ///                     quotes. The signature of this predicate should be
+    ///                     equivalent to:
+    ///                     \code
+    ///                     bool quote(const Type &a);
+    ///                     \endcode \n
+    ///
+    /// Whether a chunk of the range starts inside a quoted section is not
+    /// known before the chunks to its left have been examined. The chunks
+    /// therefore collect the delimiters for both cases, and an exclusive
+    /// scan over the chunks combines the number of quotes and delimiters of
+    /// each chunk to the state the following chunk starts in.
+    ///
+    /// The other parameters and the result are the ones of \a split.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename Pred,
+        typename Quote, typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    split_quoted(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        Pred&& pred, Quote&& quote, FwdIter2 dest);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/packed_bits.hpp>
+#include <pika/parallel/algorithms/find_all.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/compaction_staging.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // split, split_quoted
+    /// \cond NOINTERNAL
+
+    // the number of elements whose predicates are gathered into one mask
+    inline constexpr std::size_t split_block_size = 64;
+
+    // sets bit i to the parity of the bits [0, i] of x
+    constexpr std::uint64_t split_prefix_parity(std::uint64_t x) noexcept
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    // the quote predicate of split, which has no quotes
+    struct split_no_quote
+    {
+    };
+
+    // Calls f(pos, quoted) for the delimiters among the count elements
+    // starting at first, pos counting from base_idx and quoted telling
+    // whether an odd number of quotes precedes the delimiter in the range.
+    // Returns whether the range holds an odd number of quotes.
+    template <typename FwdIter, typename Pred, typename Quote, typename F>
+    bool split_scan(FwdIter first, std::size_t count, std::size_t base_idx,
+        Pred& pred, Quote& quote, F&& f)
+    {
+        constexpr bool has_quotes = !std::is_same_v<Quote, split_no_quote>;
+
+        // all bits are set inside a quoted section
+        std::uint64_t quoted = 0;
+        for (std::size_t block = 0; block < count; block += split_block_size)
+        {
+            std::size_t const size =
+                (std::min)(count - block, split_block_size);
+
+            std::uint64_t delimiters = 0;
+            std::uint64_t quotes = 0;
+            for (std::size_t i = 0; i != size; (void) ++i, ++first)
+            {
+                auto&& c = *first;
+                delimiters |= std::uint64_t(bool(PIKA_INVOKE(pred, c))) << i;
+                if constexpr (has_quotes)
+                {
+                    quotes |= std::uint64_t(bool(PIKA_INVOKE(quote, c))) << i;
+                }
+            }
+
+            std::uint64_t inside = quoted;
+            if constexpr (has_quotes)
+            {
+                delimiters &= ~quotes;
+                inside ^= split_prefix_parity(quotes);
+
+                // the bits past the end of the block are not set, the last
+                // bit tells the state at the end of the block
+                quoted = std::uint64_t(0) - (inside >> 63);
+            }
+
+            for (/**/; delimiters != 0; delimiters &= delimiters - 1)
+            {
+                std::size_t const i = packed_bits_countr_zero(delimiters);
+                f(base_idx + block + i, ((inside >> i) & 1) != 0);
+            }
+        }
+        return quoted != 0;
+    }
+
+    template <typename FwdIter1, typename FwdIter2, typename Pred,
+        typename Quote>
+    FwdIter2 sequential_split(FwdIter1 first, std::size_t count, Pred& pred,
+        Quote& quote, FwdIter2 dest)
+    {
+        split_scan(first, count, 0, pred, quote, [&](std::size_t pos, bool q) {
+            if (!q)
+            {
+                *dest++ = pos;
+            }
+        });
+        return dest;
+    }
+
+    template <typename FwdIter2>
+    struct split : public algorithm<split<FwdIter2>, FwdIter2>
+    {
+        split()
+          : split::algorithm("split")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Pred>
+        static FwdIter2 sequential(
+            ExPolicy, FwdIter1 first, FwdIter1 last, Pred&& pred, FwdIter2 dest)
+        {
+            split_no_quote quote;
+            return sequential_split(
+                first, detail::distance(first, last), pred, quote, dest);
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Pred>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            Pred&& pred, FwdIter2 dest)
+        {
+            using result = algorithm_result<ExPolicy, FwdIter2>;
+
+            std::size_t const count = detail::distance(first, last);
+
+            // small inputs are not worth collecting the positions by chunks
+            if (count < flag_buffer_sequential_limit)
+            {
+                split_no_quote quote;
+                return result::get(
+                    sequential_split(first, count, pred, quote, dest));
+            }
+
+            auto find = [pred = PIKA_FORWARD(Pred, pred)](FwdIter1 it,
+                            std::size_t part_size, std::size_t base_idx,
+                            std::vector<std::size_t>& positions) mutable {
+                split_no_quote quote;
+                split_scan(it, part_size, base_idx, pred, quote,
+                    [&](std::size_t pos, bool) { positions.push_back(pos); });
+            };
+
+            return find_all_positions(PIKA_FORWARD(ExPolicy, policy), first,
+                count, dest, PIKA_MOVE(find));
+        }
+    };
+
+    // The delimiters of a range outside quoted sections if the range starts
+    // outside and inside of a quoted section, and whether the range holds
+    // an odd number of quotes. The states of adjacent ranges combine like
+    // the transitions of a state machine.
+    struct split_quoted_state
+    {
+        std::size_t delimiters_if_outside = 0;
+        std::size_t delimiters_if_inside = 0;
+        bool toggles = false;
+    };
+
+    inline split_quoted_state combine_split_quoted_states(
+        split_quoted_state const& lhs, split_quoted_state const& rhs) noexcept
+    {
+        return split_quoted_state{lhs.delimiters_if_outside +
+                (lhs.toggles ? rhs.delimiters_if_inside :
+                               rhs.delimiters_if_outside),
+            lhs.delimiters_if_inside +
+                (lhs.toggles ? rhs.delimiters_if_outside :
+                               rhs.delimiters_if_inside),
+            lhs.toggles != rhs.toggles};
+    }
+
+    template <typename FwdIter2>
+    struct split_quoted : public algorithm<split_quoted<FwdIter2>, FwdIter2>
+    {
+        split_quoted()
+          : split_quoted::algorithm("split_quoted")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename Quote>
+        static FwdIter2 sequential(ExPolicy, FwdIter1 first, FwdIter1 last,
+            Pred&& pred, Quote&& quote, FwdIter2 dest)
+        {
+            return sequential_split(
+                first, detail::distance(first, last), pred, quote, dest);
+        }
+
+        // Step 1 of the scan collects the delimiters of each chunk for both
+        // states the chunk may start in, step 3 writes the ones for the
+        // state the chunks to its left leave.
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename Quote>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            Pred&& pred, Quote&& quote, FwdIter2 dest)
+        {
+            using result = algorithm_result<ExPolicy, FwdIter2>;
+
+            std::size_t const count = detail::distance(first, last);
+            if (count < flag_buffer_sequential_limit)
+            {
+                return result::get(
+                    sequential_split(first, count, pred, quote, dest));
+            }
+
+            using zip_iterator = pika::util::zip_iterator<FwdIter1,
+                pika::util::counting_iterator<std::size_t>>;
+            using scan_partitioner_type =
+                scan_partitioner<ExPolicy, FwdIter2, split_quoted_state>;
+
+            using pika::util::make_zip_iterator;
+            using std::get;
+
+            compaction_staging<std::size_t> outside;
+            compaction_staging<std::size_t> inside;
+
+            auto f1 = [pred = PIKA_FORWARD(Pred, pred),
+                          quote = PIKA_FORWARD(Quote, quote), outside, inside](
+                          zip_iterator part_begin,
+                          std::size_t part_size) mutable -> split_quoted_state {
+                auto iters = part_begin.get_iterator_tuple();
+                std::size_t const base_idx = *get<1>(iters);
+
+                // the delimiters outside quoted sections if the chunk starts
+                // outside (inside) of a quoted section
+                std::vector<std::size_t> if_outside;
+                std::vector<std::size_t> if_inside;
+                bool const toggles = split_scan(get<0>(iters), part_size,
+                    base_idx, pred, quote, [&](std::size_t pos, bool q) {
+                        (q ? if_inside : if_outside).push_back(pos);
+                    });
+
+                split_quoted_state state{
+                    if_outside.size(), if_inside.size(), toggles};
+                outside.put(base_idx, PIKA_MOVE(if_outside));
+                inside.put(base_idx, PIKA_MOVE(if_inside));
+                return state;
+            };
+            auto f3 = [dest, outside, inside](zip_iterator part_begin,
+                          std::size_t,
+                          split_quoted_state const& val) mutable {
+                std::size_t const base_idx =
+                    *get<1>(part_begin.get_iterator_tuple());
+                std::vector<std::size_t> if_outside = outside.take(base_idx);
+                std::vector<std::size_t> if_inside = inside.take(base_idx);
+
+                std::advance(dest, val.delimiters_if_outside);
+                for (std::size_t pos : val.toggles ? if_inside : if_outside)
+                {
+                    *dest++ = pos;
+                }
+            };
+
+            auto f4 = [dest](std::vector<split_quoted_state>&& items,
+                          std::vector<pika::future<void>>&& data) mutable
+                -> FwdIter2 {
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+
+                std::advance(dest, items.back().delimiters_if_outside);
+                return dest;
+            };
+
+            return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
+                make_zip_iterator(
+                    first, pika::util::make_counting_iterator(std::size_t(0))),
+                count, split_quoted_state{}, PIKA_MOVE(f1),
+                &combine_split_quoted_states, PIKA_MOVE(f3), PIKA_MOVE(f4));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::split
+    inline constexpr struct split_t final
+      : pika::detail::tag_parallel_algorithm<split_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::split_t, ExPolicy&& policy, FwdIter1 first,
+            FwdIter1 last, Pred&& pred, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter2> ||
+                    (pika::is_sequenced_execution_policy_v<ExPolicy> &&
+                        pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least forward iterator or sequential execution.");
+
+            return pika::parallel::detail::split<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                PIKA_FORWARD(Pred, pred), dest);
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename Pred, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(pika::split_t, FwdIter1 first,
+            FwdIter1 last, Pred&& pred, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::split<FwdIter2>().call(
+                pika::execution::seq, first, last, PIKA_FORWARD(Pred, pred),
+                dest);
+        }
+    } split{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::split_quoted
+    inline constexpr struct split_quoted_t final
+      : pika::detail::tag_parallel_algorithm<split_quoted_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename Pred,
+            typename Quote, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                > &&
+                pika::detail::is_invocable_v<Quote,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::split_quoted_t, ExPolicy&& policy,
+            FwdIter1 first, FwdIter1 last, Pred&& pred, Quote&& quote,
+            FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter2> ||
+                    (pika::is_sequenced_execution_policy_v<ExPolicy> &&
+                        pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least forward iterator or sequential execution.");
+
+            return pika::parallel::detail::split_quoted<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last,
+                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Quote, quote), dest);
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename Pred, typename Quote,
+            typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::detail::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                > &&
+                pika::detail::is_invocable_v<Quote,
+                    typename std::iterator_traits<FwdIter1>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(pika::split_quoted_t,
+            FwdIter1 first, FwdIter1 last, Pred&& pred, Quote&& quote,
+            FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_output_iterator_v<FwdIter2>),
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::split_quoted<FwdIter2>().call(
+                pika::execution::seq, first, last, PIKA_FORWARD(Pred, pred),
+                PIKA_FORWARD(Quote, quote), dest);
+        }
+    } split_quoted{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -61,6 +61,38 @@ namespace pika {
     /// pointing to an element of the sequence, and
     /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
     ///
+    /// The temporary buffer used by the algorithm is recycled between calls
+    /// through a cache local to each OS thread. A reusable
+    /// \a pika::parallel::util::temporary_buffer_arena can be supplied using
+    /// the \a pika::execution::temporary_buffer executor parameters. The
+    /// \a pika::execution::stable_sort_memory_limit executor parameters
+    /// select a mode which uses a buffer of at most the given size (sqrt(N)
+    /// elements by default) at the expense of speed.
+    ///
+    /// Sufficiently large sequences of large elements are sorted through an
+    /// index of iterators, the elements are moved to their final place once
+    /// the index is sorted. This can be controlled by passing
+    /// \a pika::execution::indirect_sort_selection as the executor
+    /// parameters of the execution policy.
+    ///
+    /// Passing \a pika::execution::cache_projected_keys as the executor
+    /// parameters makes the algorithm invoke \a proj once per element, the
+    /// projected keys are sorted instead of the elements.
+    ///
+    /// If the projected values are references to std::string or
+    /// std::string_view objects and \a comp is std::less, sufficiently large
+    /// sequences are sorted using a multikey quicksort, which keeps equal
+    /// keys in order.
+    ///
+    /// Sequences consisting of few natural runs, ascending or strictly
+    /// descending sections, are sorted by merging these runs, which takes
+    /// O(N log(R)) comparisons for R runs. This is the case for nearly
+    /// sorted, reversed or concatenated sorted sequences.
+    ///
+    /// The parallel stable sort is cancelled between its phases by a stop
+    /// request on the token of the \a pika::execution::sort_stop_token
+    /// executor parameters, it then reports \a pika::execution::sort_cancelled.
+    ///
     /// \tparam ExPolicy    The type of the execution policy to use (deduced).
     ///                     It describes the manner in which the execution
     ///                     of the algorithm may be parallelized and the manner
@@ -239,16 +271,24 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <pika/parallel/algorithms/detail/bounded_stable_sort.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
+#include <pika/parallel/algorithms/detail/natural_merge_sort.hpp>
 #include <pika/parallel/algorithms/detail/parallel_stable_sort.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/projected_key_sort.hpp>
 #include <pika/parallel/algorithms/detail/spin_sort.hpp>
+#include <pika/parallel/algorithms/detail/string_sort.hpp>
 #include <pika/parallel/util/compare_projected.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+#include <pika/parallel/util/stable_sort_memory_limit.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -275,15 +315,94 @@ namespace pika::parallel::detail {
 
         template <typename ExPolicy, typename Sentinel, typename Compare,
             typename Proj>
-        static RandomIt sequential(ExPolicy, RandomIt first, Sentinel last,
-            Compare&& comp, Proj&& proj)
+        static RandomIt sequential(ExPolicy&& policy, RandomIt first,
+            Sentinel last, Compare&& comp, Proj&& proj)
         {
             using compare_type = compare_projected<Compare&, Proj&>;
 
             auto last_iter = advance_to_sentinel(first, last);
 
-            spin_sort(first, last_iter, compare_type(comp, proj));
-            return last_iter;
+            if constexpr (util::detail::has_scratch_memory_limit_v<
+                              decltype(policy.parameters())>)
+            {
+                std::size_t buffer_elements = 0;
+                auto reservation = reserve_stable_sort_scratch_memory<
+                    typename std::iterator_traits<RandomIt>::value_type>(
+                    policy.parameters(), std::size_t(last_iter - first),
+                    buffer_elements);
+                if (buffer_elements != 0)
+                {
+                    return bounded_stable_sort(first, last_iter,
+                        compare_type(comp, proj), buffer_elements);
+                }
+                spin_sort(first, last_iter, compare_type(comp, proj));
+                return last_iter;
+            }
+            else if constexpr (use_bounded_stable_sort_v<
+                                   decltype(policy.parameters())>)
+            {
+                return bounded_stable_sort(first, last_iter,
+                    compare_type(comp, proj),
+                    policy.parameters().get_max_buffer_elements());
+            }
+            else if constexpr (use_projected_key_sort_v<
+                                   decltype(policy.parameters()), RandomIt,
+                                   Proj>)
+            {
+                // the pairs of equal keys keep the order of their elements
+                projected_key_sort(policy, first, last_iter, proj,
+                    [&](auto elements_first, auto elements_last) {
+                        stable_sort<decltype(elements_first)>::sequential(
+                            policy, elements_first, elements_last, comp,
+                            cached_key());
+                    });
+                return last_iter;
+            }
+            else
+            {
+                // nearly sorted sequences are merged from their runs
+                compare_type natural_comp(comp, proj);
+                if (natural_merge_sort(policy, first, last_iter, natural_comp,
+                        util::detail::get_temporary_buffer_arena(
+                            policy.parameters())))
+                {
+                    return last_iter;
+                }
+
+                if constexpr (use_string_sort_v<RandomIt, Compare, Proj>)
+                {
+                    if (std::size_t(last_iter - first) >= string_sort_limit)
+                    {
+                        string_sort(policy, first, last_iter, proj);
+                        return last_iter;
+                    }
+                }
+
+                if constexpr (use_indirect_sort_v<RandomIt>)
+                {
+                    using value_type =
+                        typename std::iterator_traits<RandomIt>::value_type;
+                    if (select_indirect_sort<value_type>(policy.parameters(),
+                            std::size_t(last_iter - first)))
+                    {
+                        indirect_sort(policy, first, last_iter,
+                            compare_type(comp, proj),
+                            [&](auto index_first, auto index_last,
+                                auto index_comp) {
+                                spin_sort(index_first, index_last,
+                                    PIKA_MOVE(index_comp),
+                                    util::detail::get_temporary_buffer_arena(
+                                        policy.parameters()));
+                            });
+                        return last_iter;
+                    }
+                }
+
+                spin_sort(first, last_iter, compare_type(comp, proj),
+                    util::detail::get_temporary_buffer_arena(
+                        policy.parameters()));
+                return last_iter;
+            }
         }
 
         template <typename ExPolicy, typename Sentinel, typename Compare,
@@ -314,17 +433,115 @@ namespace pika::parallel::detail {
                 cores, count, max_chunks, chunk_size);
 
             // we should not get smaller than our sort_limit_per_task
-            chunk_size = (std::max)(chunk_size, stable_sort_limit_per_task);
+            chunk_size = (std::max)(chunk_size, stable_sort_limit_per_task());
 
             try
             {
+                pika::stop_token stop =
+                    util::detail::get_sort_stop_token(policy.parameters());
+                util::detail::throw_if_sort_stop_requested(stop);
+
                 // call the sort routine and return the right type,
                 // depending on execution policy
                 compare_type comp(compare, proj);
 
+                if constexpr (util::detail::has_scratch_memory_limit_v<
+                                  decltype(policy.parameters())>)
+                {
+                    std::size_t buffer_elements = 0;
+                    auto reservation = reserve_stable_sort_scratch_memory<
+                        typename std::iterator_traits<RandomIt>::value_type>(
+                        policy.parameters(), count, buffer_elements);
+                    if (buffer_elements != 0)
+                    {
+                        return algorithm_result::get(
+                            parallel_bounded_stable_sort(policy.executor(),
+                                first, last_iter, cores, chunk_size,
+                                PIKA_MOVE(comp), buffer_elements));
+                    }
+                    return algorithm_result::get(
+                        parallel_stable_sort(policy.executor(), first,
+                            last_iter, cores, chunk_size, PIKA_MOVE(comp),
+                            nullptr, PIKA_MOVE(stop)));
+                }
+
+                if constexpr (use_bounded_stable_sort_v<
+                                  decltype(policy.parameters())>)
+                {
+                    return algorithm_result::get(
+                        parallel_bounded_stable_sort(policy.executor(), first,
+                            last_iter, cores, chunk_size, PIKA_MOVE(comp),
+                            policy.parameters().get_max_buffer_elements()));
+                }
+
+                if constexpr (use_projected_key_sort_v<
+                                  decltype(policy.parameters()), RandomIt,
+                                  Proj>)
+                {
+                    auto non_task_policy = policy(pika::execution::non_task);
+                    projected_key_sort(non_task_policy, first, last_iter, proj,
+                        [&](auto elements_first, auto elements_last) {
+                            stable_sort<decltype(elements_first)>::parallel(
+                                non_task_policy, elements_first,
+                                elements_last, compare, cached_key());
+                        });
+                    return algorithm_result::get(PIKA_MOVE(last_iter));
+                }
+
+                // nearly sorted sequences are merged from their runs
+                if (count >= natural_merge_sort_limit)
+                {
+                    auto non_task_policy = policy(pika::execution::non_task);
+                    if (natural_merge_sort(non_task_policy, first, last_iter,
+                            comp,
+                            util::detail::get_temporary_buffer_arena(
+                                policy.parameters()),
+                            stop, chunk_size))
+                    {
+                        return algorithm_result::get(PIKA_MOVE(last_iter));
+                    }
+                }
+
+                if constexpr (use_string_sort_v<RandomIt, Compare, Proj>)
+                {
+                    if (count >= string_sort_limit)
+                    {
+                        auto non_task_policy =
+                            policy(pika::execution::non_task);
+                        string_sort(non_task_policy, first, last_iter, proj,
+                            stop, chunk_size);
+                        return algorithm_result::get(PIKA_MOVE(last_iter));
+                    }
+                }
+
+                if constexpr (use_indirect_sort_v<RandomIt>)
+                {
+                    using value_type =
+                        typename std::iterator_traits<RandomIt>::value_type;
+                    if (select_indirect_sort<value_type>(
+                            policy.parameters(), count))
+                    {
+                        // the index is stably sorted, so is the sequence
+                        indirect_sort(policy, first, last_iter, PIKA_MOVE(comp),
+                            [&](auto index_first, auto index_last,
+                                auto index_comp) {
+                                parallel_stable_sort(policy.executor(),
+                                    index_first, index_last, cores, chunk_size,
+                                    PIKA_MOVE(index_comp),
+                                    util::detail::get_temporary_buffer_arena(
+                                        policy.parameters()),
+                                    stop);
+                            });
+                        return algorithm_result::get(PIKA_MOVE(last_iter));
+                    }
+                }
+
                 return algorithm_result::get(
                     parallel_stable_sort(policy.executor(), first, last_iter,
-                        cores, chunk_size, PIKA_MOVE(comp)));
+                        cores, chunk_size, PIKA_MOVE(comp),
+                        util::detail::get_temporary_buffer_arena(
+                            policy.parameters()),
+                        PIKA_MOVE(stop)));
             }
             catch (...)
             {
@@ -58,7 +58,7 @@ namespace pika::parallel::detail {
             typename Iter2, typename Sent2, typename Pred, typename Proj1,
             typename Proj2>
         static bool
-        sequential(ExPolicy, Iter1 first1, Sent1 last1, Iter2 first2,
+        sequential(ExPolicy policy, Iter1 first1, Sent1 last1, Iter2 first2,
             Sent2 last2, Pred&& pred, Proj1&& proj1, Proj2&& proj2)
         {
             auto dist1 = (distance) (first1, last1);
@@ -71,8 +71,8 @@ namespace pika::parallel::detail {
 
             auto end_first = std::next(first1, dist2);
             return get_starts_with_result<Iter1, Iter2, Sent2>(
-                mismatch_binary<in_in_result<Iter1, Iter2>>().call(
-                    pika::execution::seq, PIKA_MOVE(first1),
+                mismatch_binary<in_in_result<Iter1, Iter2>>::sequential(
+                    PIKA_MOVE(policy), PIKA_MOVE(first1),
                     PIKA_MOVE(end_first), PIKA_MOVE(first2), last2,
                     PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj1, proj1),
                     PIKA_FORWARD(Proj2, proj2)),
@@ -0,0 +1,455 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stencil.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/stencil_blocking.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    /// The values \a stencil assumes beyond the ends of the grid.
+    enum class stencil_boundary
+    {
+        /// the first and the last radius points keep their values, they are
+        /// the neighbours of the points next to the ends
+        fixed,
+        /// the grid wraps around, the first point follows the last one
+        periodic
+    };
+}    // namespace pika
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The cache both buffers of a tile fit into by default, a typical size
+    // of the cache private to a core.
+    inline constexpr std::size_t stencil_default_cache_size = 256 * 1024;
+
+    // The largest number of time steps a tile is advanced by at once by
+    // default, the halos grow with every step.
+    inline constexpr std::size_t stencil_max_time_steps = 16;
+
+    struct stencil_shape
+    {
+        std::size_t tile;          // the number of points of a tile
+        std::size_t time_steps;    // the steps a tile is advanced by at once
+    };
+
+    template <typename T, typename Parameters>
+    stencil_shape get_stencil_shape(Parameters const& params,
+        std::size_t size, std::size_t radius, std::size_t steps,
+        std::size_t cores)
+    {
+        std::size_t tile = 0;
+        std::size_t time_steps = 0;
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::stencil_blocking>)
+        {
+            tile = params.get_tile_size();
+            time_steps = params.get_time_steps();
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+        }
+
+        // every core gets a few tiles at least
+        if (tile == 0)
+        {
+            tile = (std::min)(stencil_default_cache_size / (2 * sizeof(T)),
+                (size + 4 * cores - 1) / (4 * cores));
+            tile = (std::max)(tile, std::size_t(1));
+        }
+
+        // the halos on both sides are updated by the tasks of the adjacent
+        // tiles as well, they add time_steps * radius / tile of redundant
+        // updates
+        if (time_steps == 0)
+        {
+            time_steps = (std::clamp)(
+                tile / (8 * (std::max)(radius, std::size_t(1))),
+                std::size_t(1), stencil_max_time_steps);
+        }
+
+        return {tile, (std::min)(time_steps, steps)};
+    }
+
+    // Advances the points [lo, hi) of the grid src of size points by
+    // time_steps steps and writes them to dst. The tile and its halos are
+    // copied to the first half of scratch, the steps alternate between
+    // both halves. A point updated by a step is needed by the following
+    // steps, the updated part shrinks by radius points on either side with
+    // every step.
+    template <typename T, typename F>
+    void stencil_tile(T const* src, T* dst, std::size_t size, std::size_t lo,
+        std::size_t hi, std::size_t radius, std::size_t time_steps,
+        stencil_boundary boundary, F& op, std::vector<T>& scratch)
+    {
+        bool const periodic = boundary == stencil_boundary::periodic;
+        std::size_t const halo = time_steps * radius;
+
+        // the index of the first point of the scratch buffers in the grid
+        // and their size
+        std::size_t first = 0;
+        std::size_t len = 0;
+        if (periodic)
+        {
+            first = (lo + size - halo % size) % size;
+            len = hi - lo + 2 * halo;
+        }
+        else
+        {
+            first = lo > halo ? lo - halo : 0;
+            len = (std::min)(hi + halo, size) - first;
+        }
+
+        scratch.resize(2 * len);
+        T* cur = scratch.data();
+        T* next = cur + len;
+
+        // the halos of a periodic grid may wrap around more than once
+        for (std::size_t j = 0, g = first; j != len; g = 0)
+        {
+            std::size_t const n = (std::min)(len - j, size - g);
+            std::copy(src + g, src + g + n, cur + j);
+            j += n;
+        }
+
+        // the boundary points are read from either buffer
+        if (!periodic)
+        {
+            std::copy(cur, cur + len, next);
+        }
+
+        for (std::size_t t = 1; t <= time_steps; ++t)
+        {
+            std::size_t out_lo = t * radius;
+            std::size_t out_hi = len - t * radius;
+            if (!periodic)
+            {
+                std::size_t const reach = (time_steps - t) * radius;
+                out_lo = (std::max)(radius, lo > reach ? lo - reach : 0);
+                out_hi = (std::min)(size - radius, hi + reach);
+                out_lo -= first;
+                out_hi = out_hi > first ? out_hi - first : 0;
+            }
+
+            for (std::size_t j = out_lo; j < out_hi; ++j)
+            {
+                next[j] = PIKA_INVOKE(op, static_cast<T const*>(cur + j));
+            }
+            std::swap(cur, next);
+        }
+
+        T const* result = cur + (periodic ? halo : lo - first);
+        std::copy(result, result + (hi - lo), dst + lo);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct stencil_algo : public algorithm<stencil_algo>
+    {
+        constexpr stencil_algo() noexcept
+          : stencil_algo::algorithm("stencil")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename F>
+        static pika::util::detail::unused_type sequential(ExPolicy&& policy,
+            RandIter first, RandIter last, std::size_t radius, F&& op,
+            std::size_t steps, stencil_boundary boundary)
+        {
+            run(policy, first, last, radius, op, steps, boundary, 1);
+            return pika::util::detail::unused_type();
+        }
+
+        template <typename ExPolicy, typename RandIter, typename F>
+        static typename algorithm_result<ExPolicy>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last,
+            std::size_t radius, F&& op, std::size_t steps,
+            stencil_boundary boundary)
+        {
+            using result = algorithm_result<ExPolicy>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, last, radius, op = PIKA_FORWARD(F, op),
+                        steps, boundary]() mutable {
+                        auto p = policy(pika::execution::non_task);
+                        run(p, first, last, radius, op, steps, boundary,
+                            execution::processing_units_count(
+                                p.parameters(), p.executor()));
+                    }));
+            }
+            else
+            {
+                run(policy, first, last, radius, op, steps, boundary,
+                    execution::processing_units_count(
+                        policy.parameters(), policy.executor()));
+                return result::get();
+            }
+        }
+
+    private:
+        // The grid is double buffered. Every round advances all tiles by
+        // the same number of time steps, reading from one buffer and
+        // writing to the other one. The tiles of a round are handed out to
+        // one task per core.
+        template <typename ExPolicy, typename RandIter, typename F>
+        static void run(ExPolicy& policy, RandIter first, RandIter last,
+            std::size_t radius, F& op, std::size_t steps,
+            stencil_boundary boundary, std::size_t cores)
+        {
+            using value_type =
+                typename std::iterator_traits<RandIter>::value_type;
+            using handle_exceptions = handle_local_exceptions<ExPolicy>;
+
+            std::size_t const size = std::distance(first, last);
+            if (steps == 0 || size == 0 ||
+                (boundary == stencil_boundary::fixed && size <= 2 * radius))
+            {
+                return;
+            }
+
+            stencil_shape const shape = get_stencil_shape<value_type>(
+                policy.parameters(), size, radius, steps, cores);
+            std::size_t const num_tiles = (size + shape.tile - 1) / shape.tile;
+            std::size_t const num_workers = (std::min)(cores, num_tiles);
+
+            std::vector<value_type> buffers[2] = {
+                std::vector<value_type>(first, last),
+                std::vector<value_type>(size)};
+            std::size_t current = 0;
+
+            for (std::size_t done = 0; done != steps; /**/)
+            {
+                std::size_t const time_steps =
+                    (std::min)(shape.time_steps, steps - done);
+                value_type const* src = buffers[current].data();
+                value_type* dst = buffers[1 - current].data();
+
+                auto run_tile = [&](std::size_t tile,
+                                    std::vector<value_type>& scratch) {
+                    std::size_t const lo = tile * shape.tile;
+                    std::size_t const hi = (std::min)(lo + shape.tile, size);
+                    stencil_tile(src, dst, size, lo, hi, radius, time_steps,
+                        boundary, op, scratch);
+                };
+
+                if (num_workers <= 1)
+                {
+                    std::vector<value_type> scratch;
+                    try
+                    {
+                        for (std::size_t tile = 0; tile != num_tiles; ++tile)
+                        {
+                            run_tile(tile, scratch);
+                        }
+                    }
+                    catch (...)
+                    {
+                        // rethrow either bad_alloc or exception_list
+                        handle_exceptions::call(std::current_exception());
+                    }
+                }
+                else
+                {
+                    std::atomic<std::size_t> next_tile(0);
+                    std::atomic<bool> failed(false);
+
+                    auto worker = [&](std::size_t) {
+                        std::vector<value_type> scratch;
+                        while (!failed.load(std::memory_order_relaxed))
+                        {
+                            std::size_t const tile = next_tile.fetch_add(
+                                1, std::memory_order_relaxed);
+                            if (tile >= num_tiles)
+                            {
+                                break;
+                            }
+
+                            try
+                            {
+                                run_tile(tile, scratch);
+                            }
+                            catch (...)
+                            {
+                                failed.store(true, std::memory_order_relaxed);
+                                throw;
+                            }
+                        }
+                    };
+
+                    std::vector<pika::future<void>> workers;
+                    std::list<std::exception_ptr> errors;
+                    try
+                    {
+                        workers = execution::bulk_async_execute(
+                            policy.executor(), worker,
+                            pika::detail::irange(std::size_t(0), num_workers));
+                        pika::wait_all_nothrow(workers);
+                    }
+                    catch (...)
+                    {
+                        handle_exceptions::call(
+                            std::current_exception(), errors);
+                    }
+                    handle_exceptions::call(workers, errors);
+                }
+
+                current = 1 - current;
+                done += time_steps;
+            }
+
+            std::copy(buffers[current].begin(), buffers[current].end(), first);
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Advances the one-dimensional grid [first, last) by \a steps time
+    /// steps of an explicit stencil of the given \a radius. Every step
+    /// replaces each point by the result of \a op for the values of the
+    /// point and its neighbours before the step:
+    /// \code
+    /// T op(T const* center);
+    /// \endcode
+    /// \a center points to the value of the point, its neighbours are
+    /// center[-radius] to center[radius]. The neighbours beyond the ends of
+    /// the grid are given by \a boundary, which defaults to
+    /// \a stencil_boundary::fixed.
+    ///
+    /// The grid is copied into two buffers the steps alternate between,
+    /// and is split into tiles. A task advances a tile by several steps at
+    /// once while it resides in the cache, recomputing the halos the
+    /// following steps of the tile depend on, see \a stencil_blocking. The
+    /// values of the grid are written once all steps are done.
+    ///
+    /// The execution of stencil without specifying an execution policy is
+    /// equivalent to specifying \a pika::execution::seq as the execution
+    /// policy.
+    ///
+    /// Complexity: Applies \a op about \a steps times for each point of the
+    ///             grid, the halos of the tiles add a fraction of time
+    ///             steps times radius divided by the tile size.
+    ///
+    /// \note The values have to be default constructible and copy
+    ///       assignable. \a op is invoked concurrently and the points of the
+    ///       halos are updated more than once, it must not have side
+    ///       effects.
+    ///
+    inline constexpr struct stencil_t final
+      : pika::detail::tag_parallel_algorithm<stencil_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::stencil_t, ExPolicy&& policy,
+            RandIter first, RandIter last, std::size_t radius, F&& op,
+            std::size_t steps, stencil_boundary boundary)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::stencil_algo().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, radius,
+                PIKA_FORWARD(F, op), steps, boundary);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::stencil_t, ExPolicy&& policy,
+            RandIter first, RandIter last, std::size_t radius, F&& op,
+            std::size_t steps)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::stencil_algo().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, radius,
+                PIKA_FORWARD(F, op), steps, stencil_boundary::fixed);
+        }
+
+        // clang-format off
+        template <typename RandIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(pika::stencil_t, RandIter first,
+            RandIter last, std::size_t radius, F&& op, std::size_t steps,
+            stencil_boundary boundary)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            parallel::detail::stencil_algo().call(pika::execution::seq, first,
+                last, radius, PIKA_FORWARD(F, op), steps, boundary);
+        }
+
+        // clang-format off
+        template <typename RandIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(pika::stencil_t, RandIter first,
+            RandIter last, std::size_t radius, F&& op, std::size_t steps)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            parallel::detail::stencil_algo().call(pika::execution::seq, first,
+                last, radius, PIKA_FORWARD(F, op), steps,
+                stencil_boundary::fixed);
+        }
+    } stencil{};
+}    // namespace pika
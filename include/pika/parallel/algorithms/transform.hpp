@@ -188,6 +188,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/transform_loop.hpp>
@@ -350,6 +351,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         // sequential execution with non-trivial projection
         template <typename ExPolicy, typename InIterB, typename InIterE,
             typename OutIter, typename F, typename Proj>
@@ -410,8 +413,9 @@ namespace pika::parallel::detail {
         std::decay_t<Proj2>& proj2_;
 
         template <typename Iter1, typename Iter2>
-        PIKA_HOST_DEVICE PIKA_FORCEINLINE auto
-        operator()(Iter1 curr1, Iter2 curr2)
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE auto operator()(
+            Iter1 curr1, Iter2 curr2) -> decltype(PIKA_INVOKE(f_,
+            PIKA_INVOKE(proj1_, *curr1), PIKA_INVOKE(proj2_, *curr2)))
         {
             return PIKA_INVOKE(
                 f_, PIKA_INVOKE(proj1_, *curr1), PIKA_INVOKE(proj2_, *curr2));
@@ -547,6 +551,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         // sequential execution with non-trivial projection
         template <typename ExPolicy, typename InIter1, typename InIter2,
             typename OutIter, typename F, typename Proj1, typename Proj2>
@@ -610,6 +616,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool bandwidth_bound = true;
+
         // sequential execution with non-trivial projection
         template <typename ExPolicy, typename InIter1, typename InIter2,
             typename OutIter, typename F, typename Proj1, typename Proj2>
@@ -865,4 +873,92 @@ namespace pika {
     } transform{};
 }    // namespace pika
 
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // transform of random access ranges sent by a predecessor sender runs as
+    // a bulk operation, see foreach_partition_sender.
+    template <typename ExPolicy, typename... Iters>
+    inline constexpr bool use_transform_sender_v =
+        use_partition_sender_v<ExPolicy> &&
+        (pika::traits::is_random_access_iterator_v<Iters> && ...);
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_transform_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename F>
+    struct is_transform_sender_available<ExPolicy, FwdIter1, FwdIter1,
+        FwdIter2, F>
+      : std::bool_constant<
+            use_transform_sender_v<ExPolicy, FwdIter1, FwdIter2>>
+    {
+    };
+
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename FwdIter3, typename F>
+    struct is_transform_sender_available<ExPolicy, FwdIter1, FwdIter1,
+        FwdIter2, FwdIter3, F>
+      : std::bool_constant<
+            use_transform_sender_v<ExPolicy, FwdIter1, FwdIter2, FwdIter3>>
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_shape_preserving_algorithm<pika::transform_t> : std::true_type
+    {
+    };
+
+    template <>
+    struct algorithm_sender<pika::transform_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_transform_sender_available<ExPolicy,
+                Ts...>::value;
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F>
+        static auto call(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 dest, F f)
+        {
+            using proj_id = pika::parallel::detail::projection_identity;
+            using f1_type = pika::parallel::detail::transform_iteration<
+                ExPolicy, F, proj_id>;
+
+            return pika::parallel::detail::foreach_partition_sender(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(first, dest),
+                pika::parallel::detail::distance(first, last),
+                f1_type(PIKA_MOVE(f), proj_id()), [](auto last) {
+                    return std::get<1>(last.get_iterator_tuple());
+                });
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename FwdIter3, typename F>
+        static auto call(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, FwdIter3 dest, F f)
+        {
+            using proj_id = pika::parallel::detail::projection_identity;
+            using f1_type = pika::parallel::detail::transform_binary_iteration<
+                ExPolicy, F, proj_id, proj_id>;
+
+            return pika::parallel::detail::foreach_partition_sender(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(first1, first2, dest),
+                pika::parallel::detail::distance(first1, last1),
+                f1_type(PIKA_MOVE(f), proj_id(), proj_id()), [](auto last) {
+                    return std::get<2>(last.get_iterator_tuple());
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #endif    // DOXYGEN
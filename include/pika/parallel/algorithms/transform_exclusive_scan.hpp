@@ -231,6 +231,7 @@ namespace pika {
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/scan_look_back_partitioner.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -325,7 +326,9 @@ namespace pika::parallel::detail {
             // The overall scan algorithm is performed by executing 2
             // subsequent parallel steps. The first calculates the scan
             // results for each partition and the second produces the
-            // overall result
+            // overall result. For random access iterators all partitions are
+            // instead scanned in a single pass, looking back at the results
+            // of the preceding partitions.
 
             using pika::util::make_zip_iterator;
             using std::get;
@@ -341,32 +344,62 @@ namespace pika::parallel::detail {
                     });
             };
 
-            return scan_partitioner<ExPolicy, result_type, T>::call(
-                PIKA_FORWARD(ExPolicy, policy), make_zip_iterator(first, dest),
-                count, init,
-                // step 1 performs first part of scan algorithm
-                [op, conv](zip_iterator part_begin,
-                    std::size_t part_size) mutable -> T {
-                    T part_init = PIKA_INVOKE(conv, get<0>(*part_begin++));
-
-                    auto iters = part_begin.get_iterator_tuple();
-                    return sequential_transform_exclusive_scan_n(get<0>(iters),
-                        part_size - 1, get<1>(iters), conv, part_init, op);
-                },
-                // step 2 propagates the partition results from left
-                // to right
-                op,
-                // step 3 runs final accumulation on each partition
-                PIKA_MOVE(f3),
-                // use this return value
-                [last_iter, final_dest](std::vector<T>&&,
-                    std::vector<pika::future<void>>&& data) -> result_type {
-                    // make sure iterators embedded in function object that is
-                    // attached to futures are invalidated
-                    data.clear();
-
-                    return result_type{last_iter, final_dest};
-                });
+            // step 1 performs first part of scan algorithm, it stores the
+            // partial results of the partition in the destination, which is
+            // the only place where conv is applied; step 3 combines them with
+            // the prefix in place without evaluating conv again
+            auto f1 = [op, conv](zip_iterator part_begin,
+                          std::size_t part_size) mutable -> T {
+                T part_init = PIKA_INVOKE(conv, get<0>(*part_begin++));
+
+                auto iters = part_begin.get_iterator_tuple();
+                return sequential_transform_exclusive_scan_n(get<0>(iters),
+                    part_size - 1, get<1>(iters), conv, part_init, op);
+            };
+
+            if constexpr (use_scan_look_back_v<ExPolicy, FwdIter1, FwdIter2,
+                              T>)
+            {
+                // all chunks are scanned in a single pass
+                return scan_look_back_partitioner<ExPolicy, result_type, T>::
+                    call(
+                        PIKA_FORWARD(ExPolicy, policy),
+                        make_zip_iterator(first, dest), count, init,
+                        // scans a chunk when its prefix is known
+                        [op, conv](zip_iterator part_begin,
+                            std::size_t part_size, T val) mutable -> T {
+                            auto iters = part_begin.get_iterator_tuple();
+                            return sequential_transform_exclusive_scan_n(
+                                get<0>(iters), part_size, get<1>(iters), conv,
+                                val, op);
+                        },
+                        PIKA_MOVE(f1), op, PIKA_MOVE(f3),
+                        [last_iter, final_dest]() -> result_type {
+                            return result_type{last_iter, final_dest};
+                        });
+            }
+            else
+            {
+                return scan_partitioner<ExPolicy, result_type, T>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    make_zip_iterator(first, dest), count, init,
+                    PIKA_MOVE(f1),
+                    // step 2 propagates the partition results from left
+                    // to right
+                    op,
+                    // step 3 runs final accumulation on each partition
+                    PIKA_MOVE(f3),
+                    // use this return value
+                    [last_iter, final_dest](std::vector<T>&&,
+                        std::vector<pika::future<void>>&& data)
+                        -> result_type {
+                        // make sure iterators embedded in function object
+                        // that is attached to futures are invalidated
+                        data.clear();
+
+                        return result_type{last_iter, final_dest};
+                    });
+            }
         }
     };
     /// \endcond
@@ -105,6 +105,11 @@ namespace pika {
     /// that the behavior of transform_reduce may be non-deterministic for
     /// non-associative or non-commutative binary predicate.
     ///
+    /// Floating point sums (\a red_op being \a std::plus) can be computed
+    /// with a compensated, pairwise or reproducible summation by passing
+    /// the executor parameters \a pika::execution::summation to the
+    /// policy.
+    ///
     template <typename ExPolicy, typename FwdIter, typename T, typename Reduce,
         typename Convert>
     typename pika::parallel::detail::algorithm_result<ExPolicy, T>::type
@@ -246,6 +251,67 @@ namespace pika {
     transform_reduce(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
         FwdIter2 first2, T init, Reduce&& red_op, Convert&& conv_op);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a reduction for the \a transform_reduce overload computing
+    /// several reductions in one pass, which computes
+    /// GENERALIZED_SUM(red_op, init, conv_op(*first), ...,
+    /// conv_op(*(first + (last - first) - 1))).
+    ///
+    /// \param init         The initial value for the generalized sum.
+    /// \param red_op       Specifies the function (or function object) which
+    ///                     will be invoked to combine two values of type
+    ///                     \a T.
+    /// \param conv_op      Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence. Its result must be convertible to
+    ///                     \a T.
+    ///
+    template <typename T, typename Reduce, typename Convert>
+    unspecified transform_reduction(T init, Reduce&& red_op, Convert&& conv_op);
+
+    /// Computes all of the given \a reductions (created by
+    /// \a transform_reduction) in a single pass through the sequence. Each
+    /// chunk of the sequence transforms and reduces every element for all
+    /// of the reductions while it is in cache.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of each of
+    ///         the reductions.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Reductions  The types of the reductions (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param reductions   The reductions to compute.
+    ///
+    /// With the vectorizing execution policies (\a simd, \a par_simd) the
+    /// conversions and reduction operations are invoked with vector packs
+    /// (one accumulator per lane and reduction) if all reductions produce
+    /// values of the value type of the sequence, and with the elements
+    /// otherwise.
+    ///
+    /// \returns  The \a transform_reduce algorithm returns a
+    ///           \a pika::future<std::tuple<T...>> if the execution policy is
+    ///           of type \a parallel_task_policy and returns
+    ///           \a std::tuple<T...> otherwise, holding the result of each of
+    ///           the reductions in the order they were passed.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename... Reductions>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        std::tuple<T...>>::type
+    transform_reduce(ExPolicy&& policy, FwdIter first, FwdIter last,
+        std::tuple<Reductions...> reductions);
+
     // clang-format on
 }    // namespace pika
 
@@ -253,20 +319,25 @@ namespace pika {
 
 #include <pika/config.hpp>
 #include <pika/concepts/concepts.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
 #include <pika/functional/invoke.hpp>
 #include <pika/functional/invoke_result.hpp>
 #include <pika/functional/traits/is_invocable.hpp>
 #include <pika/iterator_support/range.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
-#include <pika/pack_traversal/unwrap.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/accumulate.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/dot_product.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/widening_reduce.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_sender.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/detail/summation.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
@@ -274,7 +345,9 @@ namespace pika {
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -331,6 +404,18 @@ namespace pika::parallel::detail {
         {
             using reference = typename std::iterator_traits<Iter>::reference;
 
+            // the elements are widened to T, or split into their real and
+            // imaginary parts, in vector registers
+            if constexpr (pika::is_vectorpack_execution_policy<
+                              execution_policy_type>::value &&
+                (is_widening_reduction_v<Iter, T, Reduce> ||
+                    is_complex_reduction_v<Iter, T, Reduce>))
+            {
+                T val = T(PIKA_INVOKE(convert_, T(*part_begin)));
+                return widening_reduce_n<execution_policy_type>(++part_begin,
+                    --part_size, PIKA_MOVE(val), reduce_, convert_);
+            }
+
             T val = PIKA_INVOKE(convert_, *part_begin);
             return accumulate_n(++part_begin, --part_size, PIKA_MOVE(val),
                 [PIKA_CXX20_CAPTURE_THIS(=)](
@@ -351,11 +436,40 @@ namespace pika::parallel::detail {
 
         template <typename ExPolicy, typename Iter, typename Sent, typename T_,
             typename Reduce, typename Convert>
-        static T sequential(ExPolicy, Iter first, Sent last, T_&& init,
+        static T sequential(ExPolicy policy, Iter first, Sent last, T_&& init,
             Reduce&& r, Convert&& conv)
         {
             using value_type = typename std::iterator_traits<Iter>::value_type;
 
+            if constexpr (is_floating_point_sum_v<T, Reduce>)
+            {
+                auto const mode = select_summation(policy.parameters());
+                if (mode != pika::execution::summation_mode::standard)
+                {
+                    return sequential_summation<T>(mode, first, last,
+                        PIKA_FORWARD(T_, init),
+                        [&conv](Iter const& it) -> decltype(auto) {
+                            return PIKA_INVOKE(conv, *it);
+                        });
+                }
+            }
+            else
+            {
+                PIKA_UNUSED(policy);
+            }
+
+            // the elements are widened to T, or split into their real and
+            // imaginary parts, in vector registers
+            if constexpr (pika::is_vectorpack_execution_policy<
+                              ExPolicy>::value &&
+                (is_widening_reduction_v<Iter, T, Reduce> ||
+                    is_complex_reduction_v<Iter, T, Reduce>))
+            {
+                return widening_reduce_n<ExPolicy>(first,
+                    detail::distance(first, last), T(PIKA_FORWARD(T_, init)),
+                    r, conv);
+            }
+
             return detail::accumulate(first, last, PIKA_FORWARD(T_, init),
                 [&r, &conv](T const& res, value_type const& next) -> T {
                     return PIKA_INVOKE(r, res, PIKA_INVOKE(conv, next));
@@ -374,18 +488,34 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, T>::get(PIKA_MOVE(init_));
             }
 
+            if constexpr (is_floating_point_sum_v<T, Reduce>)
+            {
+                if (select_summation(policy.parameters()) !=
+                    pika::execution::summation_mode::standard)
+                {
+                    return parallel_summation<T>(
+                        PIKA_FORWARD(ExPolicy, policy), first,
+                        detail::distance(first, last), PIKA_FORWARD(T_, init),
+                        [conv = PIKA_FORWARD(Convert, conv)](
+                            Iter const& it) mutable -> decltype(auto) {
+                            return PIKA_INVOKE(conv, *it);
+                        });
+                }
+            }
+
             auto f1 = transform_reduce_iteration<T, ExPolicy, Reduce, Convert>(
-                PIKA_FORWARD(Reduce, r), PIKA_FORWARD(Convert, conv));
+                r, PIKA_FORWARD(Convert, conv));
 
             return detail::partitioner<ExPolicy, T>::call(
                 PIKA_FORWARD(ExPolicy, policy), first,
                 detail::distance(first, last), PIKA_MOVE(f1),
-                pika::unwrapping([init = PIKA_FORWARD(T_, init),
-                                     r = PIKA_FORWARD(Reduce, r)](
-                                     std::vector<T>&& results) mutable -> T {
-                    return accumulate_n(pika::util::begin(results),
-                        pika::util::size(results), init, r);
-                }));
+                make_chunk_values_reducer(
+                    [init = PIKA_FORWARD(T_, init), r](
+                        std::vector<T>&& results) mutable -> T {
+                        return accumulate_n(pika::util::begin(results),
+                            pika::util::size(results), init, r);
+                    },
+                    PIKA_FORWARD(Reduce, r)));
         }
     };
 
@@ -433,7 +563,7 @@ namespace pika::parallel::detail {
 
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Iter2, typename T_, typename Op1, typename Op2>
-        static T sequential(ExPolicy&& /* policy */, Iter first1, Sent last1,
+        static T sequential(ExPolicy&& policy, Iter first1, Sent last1,
             Iter2 first2, T_ init, Op1&& op1, Op2&& op2)
         {
             if (first1 == last1)
@@ -441,6 +571,28 @@ namespace pika::parallel::detail {
                 return init;
             }
 
+            if constexpr (is_floating_point_sum_v<T, Op1>)
+            {
+                auto const mode = select_summation(policy.parameters());
+                if (mode != pika::execution::summation_mode::standard)
+                {
+                    return sequential_summation<T>(mode, first1, last1,
+                        PIKA_MOVE(init), [&first2, &op2](Iter const& it) {
+                            return PIKA_INVOKE(op2, *it, *first2++);
+                        });
+                }
+            }
+            else
+            {
+                PIKA_UNUSED(policy);
+            }
+
+            if constexpr (is_dot_product_v<Iter, Iter2, T, Op1, Op2>)
+            {
+                return dot_product<std::decay_t<ExPolicy>, T>(
+                    first1, first2, detail::distance(first1, last1), init);
+            }
+
             // check whether we should apply vectorization
             if (!loop_optimization<ExPolicy>(first1, last1))
             {
@@ -459,13 +611,10 @@ namespace pika::parallel::detail {
                 transform_reduce_binary_partition<Op1, Op2, decltype(part_sum)>{
                     op1, op2, part_sum});
 
-            // this is to support vectorization, it will call op1 for each
-            // of the elements of a value-pack
+            // this is to support vectorization, it will reduce the elements
+            // of a value-pack using op1
             auto result = accumulate_values<ExPolicy>(
-                [&op1](T const& sum, T&& val) -> T {
-                    return PIKA_INVOKE(op1, sum, val);
-                },
-                PIKA_MOVE(part_sum), PIKA_MOVE(init));
+                op1, PIKA_MOVE(part_sum), PIKA_MOVE(init));
 
             // the vectorization might not cover all of the sequences,
             // handle the remainder directly
@@ -498,6 +647,26 @@ namespace pika::parallel::detail {
 
             difference_type count = detail::distance(first1, last1);
 
+            using pika::util::make_zip_iterator;
+
+            if constexpr (is_floating_point_sum_v<T, Op1>)
+            {
+                if (select_summation(policy.parameters()) !=
+                    pika::execution::summation_mode::standard)
+                {
+                    return parallel_summation<T>(
+                        PIKA_FORWARD(ExPolicy, policy),
+                        make_zip_iterator(first1, first2), count,
+                        PIKA_FORWARD(T_, init),
+                        [op2 = PIKA_FORWARD(Op2, op2)](
+                            zip_iterator const& it) mutable {
+                            auto iters = it.get_iterator_tuple();
+                            return PIKA_INVOKE(
+                                op2, *std::get<0>(iters), *std::get<1>(iters));
+                        });
+                }
+            }
+
             auto f1 = [op1, op2 = PIKA_FORWARD(Op2, op2)](
                           zip_iterator part_begin,
                           std::size_t part_size) mutable -> T {
@@ -505,6 +674,12 @@ namespace pika::parallel::detail {
                 Iter it1 = std::get<0>(iters);
                 Iter2 it2 = std::get<1>(iters);
 
+                if constexpr (is_dot_product_v<Iter, Iter2, T, Op1, Op2>)
+                {
+                    return dot_product_n<std::decay_t<ExPolicy>>(
+                        std::addressof(*it1), std::addressof(*it2), part_size);
+                }
+
                 Iter last1 = it1;
                 std::advance(last1, part_size);
 
@@ -531,13 +706,9 @@ namespace pika::parallel::detail {
                         transform_reduce_binary_partition<Op1, Op2,
                             decltype(part_sum)>{op1, op2, part_sum});
 
-                // this is to support vectorization, it will call op1
-                // for each of the elements of a value-pack
-                auto result = accumulate_values<ExPolicy>(
-                    [&op1](T const& sum, T&& val) -> T {
-                        return PIKA_INVOKE(op1, sum, val);
-                    },
-                    part_sum);
+                // this is to support vectorization, it will reduce the
+                // elements of a value-pack using op1
+                auto result = accumulate_values<ExPolicy>(op1, part_sum);
 
                 // the vectorization might not cover all of the sequences,
                 // handle the remainder directly
@@ -552,8 +723,6 @@ namespace pika::parallel::detail {
                 return extract_value<ExPolicy>(result);
             };
 
-            using pika::util::make_zip_iterator;
-
             return detail::partitioner<ExPolicy, T>::call(
                 PIKA_FORWARD(ExPolicy, policy),
                 make_zip_iterator(first1, first2), count, PIKA_MOVE(f1),
@@ -568,6 +737,188 @@ namespace pika::parallel::detail {
                 });
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // transform_reduce with several reductions
+    template <typename T, typename Reduce, typename Convert>
+    struct transform_reduction
+    {
+        using result_type = T;
+
+        T init_;
+        Reduce reduce_;
+        Convert convert_;
+    };
+
+    template <typename T>
+    struct is_transform_reduction : std::false_type
+    {
+    };
+
+    template <typename T, typename Reduce, typename Convert>
+    struct is_transform_reduction<transform_reduction<T, Reduce, Convert>>
+      : std::true_type
+    {
+    };
+
+    template <typename Reductions>
+    struct is_transform_reductions : std::false_type
+    {
+    };
+
+    template <typename... Rs>
+    struct is_transform_reductions<std::tuple<Rs...>>
+      : std::integral_constant<bool,
+            sizeof...(Rs) != 0 && (is_transform_reduction<Rs>::value && ...)>
+    {
+    };
+
+    template <typename... Rs>
+    using transform_reductions_result_t =
+        std::tuple<typename Rs::result_type...>;
+
+    // Fold the elements in [first, first + count) into acc, which holds the
+    // partial result of each of the reductions.
+    template <typename Iter, typename... Rs, typename... Ts, std::size_t... Is>
+    void sequential_transform_reduce_multi(Iter first, std::size_t count,
+        std::tuple<Rs...>& reductions, std::tuple<Ts...>& acc,
+        std::index_sequence<Is...>)
+    {
+        for (/* */; count != 0; (void) ++first, --count)
+        {
+            auto&& elem = *first;
+            ((std::get<Is>(acc) = PIKA_INVOKE(std::get<Is>(reductions).reduce_,
+                  PIKA_MOVE(std::get<Is>(acc)),
+                  PIKA_INVOKE(std::get<Is>(reductions).convert_, elem))),
+                ...);
+        }
+    }
+
+    template <typename ExPolicy>
+    struct transform_reduce_multi_chunk_t final
+      : pika::functional::detail::tag_fallback<
+            transform_reduce_multi_chunk_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename... Rs, typename... Ts>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE void tag_fallback_invoke(
+            transform_reduce_multi_chunk_t<ExPolicy>, Iter first,
+            std::size_t count, std::tuple<Rs...>& reductions,
+            std::tuple<Ts...>& acc)
+        {
+            sequential_transform_reduce_multi(first, count, reductions, acc,
+                std::index_sequence_for<Rs...>());
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr transform_reduce_multi_chunk_t<ExPolicy>
+        transform_reduce_multi_chunk =
+            transform_reduce_multi_chunk_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename... Rs,
+        typename... Ts>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void transform_reduce_multi_chunk(
+        Iter first, std::size_t count, std::tuple<Rs...>& reductions,
+        std::tuple<Ts...>& acc)
+    {
+        return transform_reduce_multi_chunk_t<ExPolicy>{}(
+            first, count, reductions, acc);
+    }
+#endif
+
+    template <typename... Rs, std::size_t... Is>
+    transform_reductions_result_t<Rs...> transform_reductions_init(
+        std::tuple<Rs...> const& reductions, std::index_sequence<Is...>)
+    {
+        return transform_reductions_result_t<Rs...>(
+            std::get<Is>(reductions).init_...);
+    }
+
+    // The partial results of a chunk are seeded from its first element
+    template <typename... Rs, typename Elem, std::size_t... Is>
+    transform_reductions_result_t<Rs...> transform_reductions_first(
+        std::tuple<Rs...>& reductions, Elem&& elem,
+        std::index_sequence<Is...>)
+    {
+        return transform_reductions_result_t<Rs...>(
+            typename Rs::result_type(
+                PIKA_INVOKE(std::get<Is>(reductions).convert_, elem))...);
+    }
+
+    template <typename... Rs, std::size_t... Is>
+    void transform_reductions_combine(std::tuple<Rs...>& reductions,
+        transform_reductions_result_t<Rs...>& acc,
+        transform_reductions_result_t<Rs...>&& part,
+        std::index_sequence<Is...>)
+    {
+        ((std::get<Is>(acc) = PIKA_INVOKE(std::get<Is>(reductions).reduce_,
+              PIKA_MOVE(std::get<Is>(acc)), PIKA_MOVE(std::get<Is>(part)))),
+            ...);
+    }
+
+    template <typename T>
+    struct transform_reduce_multi
+      : public algorithm<transform_reduce_multi<T>, T>
+    {
+        transform_reduce_multi()
+          : transform_reduce_multi::algorithm("transform_reduce_multi")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename... Rs>
+        static T sequential(
+            ExPolicy, Iter first, Sent last, std::tuple<Rs...> reductions)
+        {
+            T acc = transform_reductions_init(
+                reductions, std::index_sequence_for<Rs...>());
+            transform_reduce_multi_chunk<ExPolicy>(
+                first, detail::distance(first, last), reductions, acc);
+            return acc;
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename... Rs>
+        static typename algorithm_result<ExPolicy, T>::type parallel(
+            ExPolicy&& policy, Iter first, Sent last,
+            std::tuple<Rs...> reductions)
+        {
+            using indices_type = std::index_sequence_for<Rs...>;
+
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, T>::get(
+                    transform_reductions_init(reductions, indices_type()));
+            }
+
+            auto f1 = [reductions](
+                          Iter part_begin, std::size_t part_size) mutable -> T {
+                T acc = transform_reductions_first(
+                    reductions, *part_begin, indices_type());
+                transform_reduce_multi_chunk<std::decay_t<ExPolicy>>(
+                    ++part_begin, --part_size, reductions, acc);
+                return acc;
+            };
+
+            return detail::partitioner<ExPolicy, T>::call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), PIKA_MOVE(f1),
+                make_chunk_values_reducer(
+                    [reductions = PIKA_MOVE(reductions)](
+                        std::vector<T>&& results) mutable -> T {
+                        T acc = transform_reductions_init(
+                            reductions, indices_type());
+                        for (auto&& part : results)
+                        {
+                            transform_reductions_combine(reductions, acc,
+                                PIKA_MOVE(part), indices_type());
+                        }
+                        return acc;
+                    }));
+        }
+    };
 }    // namespace pika::parallel::detail
 
 #if defined(PIKA_HAVE_THREAD_DESCRIPTION)
@@ -626,6 +977,17 @@ namespace pika::detail {
 #endif
 
 namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Reduce, typename Convert>
+    parallel::detail::transform_reduction<T, std::decay_t<Reduce>,
+        std::decay_t<Convert>>
+    transform_reduction(T init, Reduce&& red_op, Convert&& conv_op)
+    {
+        return parallel::detail::transform_reduction<T, std::decay_t<Reduce>,
+            std::decay_t<Convert>>{PIKA_MOVE(init),
+            PIKA_FORWARD(Reduce, red_op), PIKA_FORWARD(Convert, conv_op)};
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // CPO for pika::transform_reduce
     inline constexpr struct transform_reduce_t final
@@ -814,7 +1176,163 @@ namespace pika {
                 pika::execution::seq, first1, last1, first2, PIKA_MOVE(init),
                 PIKA_FORWARD(Reduce, red_op), PIKA_FORWARD(Convert, conv_op));
         }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename... Rs,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter>::value &&
+                pika::parallel::detail::is_transform_reductions<
+                    std::tuple<Rs...>>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            pika::parallel::detail::transform_reductions_result_t<Rs...>>::type
+        tag_fallback_invoke(transform_reduce_t, ExPolicy&& policy,
+            FwdIter first, FwdIter last, std::tuple<Rs...> reductions)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::transform_reduce_multi<
+                pika::parallel::detail::transform_reductions_result_t<Rs...>>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_MOVE(reductions));
+        }
+
+        // clang-format off
+        template <typename InIter, typename... Rs,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                pika::parallel::detail::is_transform_reductions<
+                    std::tuple<Rs...>>::value
+            )>
+        // clang-format on
+        friend pika::parallel::detail::transform_reductions_result_t<Rs...>
+        tag_fallback_invoke(transform_reduce_t, InIter first, InIter last,
+            std::tuple<Rs...> reductions)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+
+            return pika::parallel::detail::transform_reduce_multi<
+                pika::parallel::detail::transform_reductions_result_t<Rs...>>()
+                .call(pika::execution::seq, first, last, PIKA_MOVE(reductions));
+        }
     } transform_reduce{};
 }    // namespace pika
 
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // The binary transform_reduce of random access ranges sent by a
+    // predecessor sender runs as a bulk operation, see partition_sender.
+    // Summation modes other than the standard one are handled by the future
+    // based implementation.
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename T,
+        typename Op1>
+    inline constexpr bool use_transform_reduce_binary_sender_v =
+        use_partition_sender_v<ExPolicy> &&
+        pika::traits::is_random_access_iterator_v<Iter1> &&
+        pika::traits::is_random_access_iterator_v<Iter2> &&
+        std::is_default_constructible_v<T> &&
+        !(is_floating_point_sum_v<T, Op1> &&
+            std::is_same_v<typename ExPolicy::executor_parameters_type,
+                pika::execution::summation>);
+
+    template <typename ExPolicy, typename... Ts>
+    struct is_transform_reduce_sender_available : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename T,
+        typename Op1, typename Op2>
+    struct is_transform_reduce_sender_available<ExPolicy, Iter1, Iter1, Iter2,
+        T, Op1, Op2>
+      : std::bool_constant<use_transform_reduce_binary_sender_v<ExPolicy,
+            Iter1, Iter2, T, Op1>>
+    {
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename T>
+    struct is_transform_reduce_sender_available<ExPolicy, Iter1, Iter1, Iter2,
+        T> : is_transform_reduce_sender_available<ExPolicy, Iter1, Iter1, Iter2,
+             T, plus, multiplies>
+    {
+    };
+
+    template <typename T, typename ExPolicy, typename Iter1, typename Iter2,
+        typename Op1, typename Op2>
+    auto transform_reduce_binary_sender(ExPolicy&& policy, Iter1 first1,
+        Iter1 last1, Iter2 first2, T init, Op1 op1, Op2 op2)
+    {
+        auto f1 = [first1, first2, op1, op2](
+                      std::size_t begin, std::size_t size) mutable -> T {
+            Iter1 it1 = std::next(first1, begin);
+            Iter2 it2 = std::next(first2, begin);
+
+            if constexpr (is_dot_product_v<Iter1, Iter2, T, Op1, Op2>)
+            {
+                return dot_product_n<std::decay_t<ExPolicy>>(
+                    std::addressof(*it1), std::addressof(*it2), size);
+            }
+            else
+            {
+                T val = PIKA_INVOKE(op2, *it1, *it2);
+                while (--size != 0)
+                {
+                    val = PIKA_INVOKE(op1, PIKA_MOVE(val),
+                        PIKA_INVOKE(op2, *++it1, *++it2));
+                }
+                return val;
+            }
+        };
+
+        return partition_sender<T>(PIKA_FORWARD(ExPolicy, policy),
+            detail::distance(first1, last1), PIKA_MOVE(f1),
+            [init = PIKA_MOVE(init), op1 = PIKA_MOVE(op1)](
+                std::vector<T>&& results) mutable -> T {
+                T ret = PIKA_MOVE(init);
+                for (auto&& result : results)
+                {
+                    ret = PIKA_INVOKE(op1, PIKA_MOVE(ret), PIKA_MOVE(result));
+                }
+                return ret;
+            });
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::detail {
+    /// \cond NOINTERNAL
+    template <>
+    struct algorithm_sender<pika::transform_reduce_t>
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available =
+            pika::parallel::detail::is_transform_reduce_sender_available<
+                ExPolicy, Ts...>::value;
+
+        template <typename ExPolicy, typename Iter1, typename Iter2, typename T,
+            typename Op1, typename Op2>
+        static auto call(ExPolicy&& policy, Iter1 first1, Iter1 last1,
+            Iter2 first2, T init, Op1 op1, Op2 op2)
+        {
+            return pika::parallel::detail::transform_reduce_binary_sender<T>(
+                PIKA_FORWARD(ExPolicy, policy), first1, last1, first2,
+                PIKA_MOVE(init), PIKA_MOVE(op1), PIKA_MOVE(op2));
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Iter2, typename T>
+        static auto call(ExPolicy&& policy, Iter1 first1, Iter1 last1,
+            Iter2 first2, T init)
+        {
+            return pika::parallel::detail::transform_reduce_binary_sender<T>(
+                PIKA_FORWARD(ExPolicy, policy), first1, last1, first2,
+                PIKA_MOVE(init), pika::parallel::detail::plus(),
+                pika::parallel::detail::multiplies());
+        }
+    };
+    /// \endcond
+}    // namespace pika::detail
+
 #endif    // DOXYGEN
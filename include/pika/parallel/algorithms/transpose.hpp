@@ -0,0 +1,319 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/transpose.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/transpose_block.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The cache a tile of the input and of the output fit into, a typical
+    // size of the first level data cache.
+    inline constexpr std::size_t transpose_cache_size = 32 * 1024;
+
+    // The edge of the square tiles the recursion stops at, the largest
+    // power of two for which both tiles fit into the cache.
+    template <typename T>
+    constexpr std::size_t transpose_tile_size() noexcept
+    {
+        std::size_t tile = 8;
+        while (2 * (2 * tile) * (2 * tile) * sizeof(T) <= transpose_cache_size)
+        {
+            tile *= 2;
+        }
+        return tile;
+    }
+
+    // Transposes the block [r0, r1) x [c0, c1) of the rows x cols matrix
+    // in to the cols x rows matrix out. The longer side of the block is
+    // halved until it fits into a tile, which keeps the accesses to both
+    // matrices local on all levels of the cache hierarchy. The halves are
+    // multiples of the tile size, the tiles are aligned to the block.
+    template <typename InIter, typename OutIter>
+    void transpose_recursive(InIter in, OutIter out, std::size_t rows,
+        std::size_t cols, std::size_t r0, std::size_t r1, std::size_t c0,
+        std::size_t c1, std::size_t tile)
+    {
+        while (r1 - r0 > tile || c1 - c0 > tile)
+        {
+            if (r1 - r0 >= c1 - c0)
+            {
+                std::size_t const half =
+                    ((r1 - r0) / 2 + tile - 1) / tile * tile;
+                transpose_recursive(
+                    in, out, rows, cols, r0, r0 + half, c0, c1, tile);
+                r0 += half;
+            }
+            else
+            {
+                std::size_t const half =
+                    ((c1 - c0) / 2 + tile - 1) / tile * tile;
+                transpose_recursive(
+                    in, out, rows, cols, r0, r1, c0, c0 + half, tile);
+                c0 += half;
+            }
+        }
+
+        if (r0 != r1 && c0 != c1)
+        {
+            transpose_block(in + r0 * cols + c0, cols, out + c0 * rows + r0,
+                rows, r1 - r0, c1 - c0);
+        }
+    }
+
+    // Contiguous iterators are transposed through pointers, which enables
+    // the kernels in registers.
+    template <typename Iter>
+    auto transpose_pointer(Iter it)
+    {
+        if constexpr (pika::detail::is_contiguous_iterator_v<Iter>)
+        {
+            return pika::detail::to_address(it);
+        }
+        else
+        {
+            return it;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutIter>
+    struct transpose_algo : public algorithm<transpose_algo<OutIter>, OutIter>
+    {
+        constexpr transpose_algo() noexcept
+          : transpose_algo::algorithm("transpose")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter>
+        static OutIter sequential(ExPolicy&&, InIter first, InIter last,
+            OutIter dest, std::size_t rows, std::size_t cols)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+
+            if (first != last)
+            {
+                transpose_recursive(transpose_pointer(first),
+                    transpose_pointer(dest), rows, cols, 0, rows, 0, cols,
+                    transpose_tile_size<value_type>());
+            }
+            return std::next(dest, rows * cols);
+        }
+
+        template <typename ExPolicy, typename InIter>
+        static typename algorithm_result<ExPolicy, OutIter>::type parallel(
+            ExPolicy&& policy, InIter first, InIter last, OutIter dest,
+            std::size_t rows, std::size_t cols)
+        {
+            using result = algorithm_result<ExPolicy, OutIter>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, last, dest, rows, cols]() mutable {
+                        auto p = policy(pika::execution::non_task);
+                        return run(p, first, last, dest, rows, cols,
+                            execution::processing_units_count(
+                                p.parameters(), p.executor()));
+                    }));
+            }
+            else
+            {
+                return result::get(run(policy, first, last, dest, rows, cols,
+                    execution::processing_units_count(
+                        policy.parameters(), policy.executor())));
+            }
+        }
+
+    private:
+        // Every core transposes a band of whole tiles along the longer
+        // side of the matrix. The bands are assigned statically, the same
+        // core writes the same part of the output whenever matrices of the
+        // same shape are transposed, which keeps the pages of the output
+        // on the memory of the core that first touched them.
+        template <typename ExPolicy, typename InIter>
+        static OutIter run(ExPolicy& policy, InIter first, InIter last,
+            OutIter dest, std::size_t rows, std::size_t cols,
+            std::size_t cores)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+            using handle_exceptions = handle_local_exceptions<ExPolicy>;
+
+            OutIter const result = std::next(dest, rows * cols);
+            if (first == last)
+            {
+                return result;
+            }
+
+            std::size_t const tile = transpose_tile_size<value_type>();
+            bool const by_cols = cols >= rows;
+            std::size_t const length = by_cols ? cols : rows;
+            std::size_t const num_tiles = (length + tile - 1) / tile;
+            std::size_t const num_workers = (std::min)(cores, num_tiles);
+
+            auto in = transpose_pointer(first);
+            auto out = transpose_pointer(dest);
+
+            auto worker = [&](std::size_t w) {
+                std::size_t const lo =
+                    (std::min)(w * num_tiles / num_workers * tile, length);
+                std::size_t const hi = (std::min)(
+                    (w + 1) * num_tiles / num_workers * tile, length);
+                if (by_cols)
+                {
+                    transpose_recursive(
+                        in, out, rows, cols, 0, rows, lo, hi, tile);
+                }
+                else
+                {
+                    transpose_recursive(
+                        in, out, rows, cols, lo, hi, 0, cols, tile);
+                }
+            };
+
+            if (num_workers <= 1)
+            {
+                try
+                {
+                    worker(0);
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return result;
+            }
+
+            std::vector<pika::future<void>> workers;
+            std::list<std::exception_ptr> errors;
+            try
+            {
+                workers = execution::bulk_async_execute(policy.executor(),
+                    worker, pika::detail::irange(std::size_t(0), num_workers));
+                pika::wait_all_nothrow(workers);
+            }
+            catch (...)
+            {
+                handle_exceptions::call(std::current_exception(), errors);
+            }
+            handle_exceptions::call(workers, errors);
+
+            return result;
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Writes the transpose of the matrix of \a rows x \a cols elements
+    /// starting at \a first, stored row by row, to the matrix of \a cols x
+    /// \a rows elements starting at \a dest. The element in row i and
+    /// column j of the input is written to row j and column i of the
+    /// output.
+    ///
+    /// The matrices are split recursively along their longer side until
+    /// the parts of both fit into the first level cache, the parallel
+    /// overloads assign a band of the parts to every core. Matrices of
+    /// float and double in contiguous memory are transposed in registers
+    /// by blocks of 8 x 8 or 4 x 4 elements if the target supports AVX, 4 x
+    /// 4 or 2 x 2 elements with SSE2.
+    ///
+    /// The execution of transpose without specifying an execution policy is
+    /// equivalent to specifying \a pika::execution::seq as the execution
+    /// policy.
+    ///
+    /// Complexity: Exactly \a rows times \a cols assignments.
+    ///
+    /// \returns  The iterator past the last element written, \a dest plus
+    ///           \a rows times \a cols. The parallel task overloads return
+    ///           a future of it.
+    ///
+    /// \note The input and the output must not overlap.
+    ///
+    inline constexpr struct transpose_t final
+      : pika::detail::tag_parallel_algorithm<transpose_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<InIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy,
+            OutIter>::type
+        tag_fallback_invoke(pika::transpose_t, ExPolicy&& policy,
+            InIter first, OutIter dest, std::size_t rows, std::size_t cols)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<InIter>::value,
+                "Requires a random access iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<OutIter>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::transpose_algo<OutIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                std::next(first, rows * cols), dest, rows, cols);
+        }
+
+        // clang-format off
+        template <typename InIter, typename OutIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(pika::transpose_t, InIter first,
+            OutIter dest, std::size_t rows, std::size_t cols)
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<InIter>::value,
+                "Requires a random access iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<OutIter>::value,
+                "Requires a random access iterator.");
+
+            return parallel::detail::transpose_algo<OutIter>().call(
+                pika::execution::seq, first, std::next(first, rows * cols),
+                dest, rows, cols);
+        }
+    } transpose{};
+}    // namespace pika
@@ -204,6 +204,7 @@ namespace pika {
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -252,13 +253,24 @@ namespace pika::parallel::detail {
     {
         using value_type = typename std::iterator_traits<InIter2>::value_type;
 
-        return {std::next(first, count),
-            loop_with_cleanup_n_with_token(
-                first, count, dest, tok,
-                [](InIter1 it, InIter2 dest) -> void {
-                    ::new (std::addressof(*dest)) value_type(*it);
-                },
-                [](InIter2 dest) -> void { (*dest).~value_type(); })};
+        // trivially copyable elements are copied one block at a time
+        if constexpr (is_segmented_memmove_v<InIter1, InIter2>)
+        {
+            PIKA_UNUSED(tok);
+            return copy_segmented(first, count, dest);
+        }
+        else
+        {
+            return {std::next(first, count),
+                loop_with_cleanup_n_with_token(
+                    first, count, dest, tok,
+                    [](InIter1 it, InIter2 dest) noexcept(noexcept(
+                        ::new (std::addressof(*dest)) value_type(*it)))
+                        -> void {
+                        ::new (std::addressof(*dest)) value_type(*it);
+                    },
+                    [](InIter2 dest) -> void { (*dest).~value_type(); })};
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -409,6 +421,11 @@ namespace pika::parallel::detail {
             using value_type =
                 typename std::iterator_traits<FwdIter2>::value_type;
 
+            if constexpr (is_segmented_memmove_v<InIter, FwdIter2>)
+            {
+                return copy_segmented(first, count, dest);
+            }
+
             FwdIter2 current = dest;
             try
             {
@@ -167,6 +167,7 @@ namespace pika {
 #else    // DOXYGEN
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/type_support/void_guard.hpp>
 
@@ -175,13 +176,17 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -228,10 +233,70 @@ namespace pika::parallel::detail {
 
         return loop_with_cleanup_n_with_token(
             first, count, tok,
-            [](InIter it) -> void { ::new (std::addressof(*it)) value_type; },
+            [](InIter it) noexcept(
+                noexcept(::new (std::addressof(*it)) value_type))
+                -> void { ::new (std::addressof(*it)) value_type; },
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // Default initialization of trivially default constructible values does
+    // not write to their memory, the values are not touched at all. If the
+    // executor parameters place the chunks on particular worker threads
+    // (numa_chunk_placement, affinity_partitioner), the pages of each chunk
+    // are touched by its worker thread instead, which maps them to the NUMA
+    // domain of that thread.
+    inline constexpr std::size_t first_touch_page_bytes = 4096;
+
+    // Read and write back one byte of every page overlapping the given
+    // bytes, this keeps the values of the bytes
+    inline void touch_pages(void* p, std::size_t size) noexcept
+    {
+        auto* bytes = static_cast<unsigned char volatile*>(p);
+        std::size_t const misalignment =
+            reinterpret_cast<std::uintptr_t>(p) % first_touch_page_bytes;
+
+        if (size != 0)
+        {
+            bytes[0] = bytes[0];
+        }
+        for (std::size_t i = first_touch_page_bytes - misalignment; i < size;
+             i += first_touch_page_bytes)
+        {
+            bytes[i] = bytes[i];
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter>
+    typename algorithm_result<ExPolicy, FwdIter>::type
+    parallel_first_touch_n(ExPolicy&& policy, FwdIter first, std::size_t count)
+    {
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        if constexpr (use_chunk_placement_v<ExPolicy> &&
+            pika::detail::is_contiguous_iterator_v<FwdIter>)
+        {
+            if (count != 0)
+            {
+                return foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy), first, count,
+                    [](FwdIter part_begin, std::size_t part_size,
+                        std::size_t) -> void {
+                        touch_pages(pika::detail::to_address(part_begin),
+                            part_size * sizeof(value_type));
+                    },
+                    projection_identity());
+            }
+        }
+        else
+        {
+            PIKA_UNUSED(policy);
+        }
+
+        return algorithm_result<ExPolicy, FwdIter>::get(
+            std::next(first, count));
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename FwdIter>
     typename algorithm_result<ExPolicy, FwdIter>::type
@@ -299,9 +364,21 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, FwdIter>::type
         parallel(ExPolicy&& policy, FwdIter first, Sent last)
         {
-            return parallel_sequential_uninitialized_default_construct_n(
-                PIKA_FORWARD(ExPolicy, policy), first,
-                detail::distance(first, last));
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            if constexpr (std::is_trivially_default_constructible_v<
+                              value_type>)
+            {
+                return parallel_first_touch_n(PIKA_FORWARD(ExPolicy, policy),
+                    first, detail::distance(first, last));
+            }
+            else
+            {
+                return parallel_sequential_uninitialized_default_construct_n(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last));
+            }
         }
     };
     /// \endcond
@@ -357,8 +434,20 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, FwdIter>::type
         parallel(ExPolicy&& policy, FwdIter first, std::size_t count)
         {
-            return parallel_sequential_uninitialized_default_construct_n(
-                PIKA_FORWARD(ExPolicy, policy), first, count);
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            if constexpr (std::is_trivially_default_constructible_v<
+                              value_type>)
+            {
+                return parallel_first_touch_n(
+                    PIKA_FORWARD(ExPolicy, policy), first, count);
+            }
+            else
+            {
+                return parallel_sequential_uninitialized_default_construct_n(
+                    PIKA_FORWARD(ExPolicy, policy), first, count);
+            }
         }
     };
     /// \endcond
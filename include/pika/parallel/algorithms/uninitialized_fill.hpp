@@ -180,6 +180,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
@@ -231,9 +232,9 @@ namespace pika::parallel::detail {
 
         return loop_with_cleanup_n_with_token(
             first, count, tok,
-            [&value](InIter it) -> void {
-                ::new (std::addressof(*it)) value_type(value);
-            },
+            [&value](InIter it) noexcept(
+                noexcept(::new (std::addressof(*it)) value_type(value)))
+                -> void { ::new (std::addressof(*it)) value_type(value); },
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
@@ -255,9 +256,19 @@ namespace pika::parallel::detail {
                 PIKA_FORWARD(ExPolicy, policy), first, count,
                 [value, tok](Iter it,
                     std::size_t part_size) mutable -> partition_result_type {
-                    return std::make_pair(it,
-                        sequential_uninitialized_fill_n(
-                            it, part_size, value, tok));
+                    // arithmetic values are constructed by plain stores
+                    if constexpr (use_non_temporal_stores_for_v<ExPolicy,
+                                      Iter>)
+                    {
+                        return std::make_pair(
+                            it, non_temporal_fill(it, part_size, value));
+                    }
+                    else
+                    {
+                        return std::make_pair(it,
+                            sequential_uninitialized_fill_n(
+                                it, part_size, value, tok));
+                    }
                 },
                 // finalize, called once if no error occurred
                 [first, count](
@@ -293,7 +304,15 @@ namespace pika::parallel::detail {
         template <typename ExPolicy, typename Sent, typename T>
         static Iter sequential(ExPolicy, Iter first, Sent last, T const& value)
         {
-            return std_uninitialized_fill(first, last, value);
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(
+                    first, detail::distance(first, last), value);
+            }
+            else
+            {
+                return std_uninitialized_fill(first, last, value);
+            }
         }
 
         template <typename ExPolicy, typename Sent, typename T>
@@ -354,7 +373,14 @@ namespace pika::parallel::detail {
         static Iter
         sequential(ExPolicy, Iter first, std::size_t count, T const& value)
         {
-            return std_uninitialized_fill_n(first, count, value);
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(first, count, value);
+            }
+            else
+            {
+                return std_uninitialized_fill_n(first, count, value);
+            }
         }
 
         template <typename ExPolicy, typename T>
@@ -260,7 +260,9 @@ namespace pika::parallel::detail {
         return in_out_result<InIter1, InIter2>{std::next(first, count),
             loop_with_cleanup_n_with_token(
                 first, count, dest, tok,
-                [](InIter1 it, InIter2 dest) -> void {
+                [](InIter1 it, InIter2 dest) noexcept(noexcept(
+                    ::new (std::addressof(*dest)) value_type(PIKA_MOVE(*it))))
+                    -> void {
                     ::new (std::addressof(*dest)) value_type(PIKA_MOVE(*it));
                 },
                 [](InIter2 dest) -> void { (*dest).~value_type(); })};
@@ -0,0 +1,531 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/uninitialized_relocate.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    /// Relocates the elements in the range, defined by [first, last), to an
+    /// uninitialized memory area beginning at \a dest: each element is move
+    /// constructed in the destination range and the source element is
+    /// destroyed. After the algorithm returns, [first, last) is
+    /// uninitialized memory. The ranges must not overlap.
+    ///
+    /// Elements of types for which \a pika::traits::is_trivially_relocatable
+    /// holds are relocated by copying their bytes if both ranges are
+    /// contiguous. Elements of types which are nothrow move constructible
+    /// are moved and destroyed in a single pass. Otherwise all elements are
+    /// moved first and the source elements are destroyed afterwards. If an
+    /// exception is thrown in that case, no object is destroyed in
+    /// [first, last), some objects are left in a valid but unspecified
+    /// state.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first move
+    ///         constructions and destructions.
+    ///
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate algorithm
+    /// invoked without an execution policy object will execute in
+    /// sequential order in the calling thread.
+    ///
+    /// \returns  The \a uninitialized_relocate algorithm returns \a FwdIter2.
+    ///           The \a uninitialized_relocate algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element relocated.
+    ///
+    template <typename FwdIter1, typename FwdIter2>
+    FwdIter2 uninitialized_relocate(
+        FwdIter1 first, FwdIter1 last, FwdIter2 dest);
+
+    /// Relocates the elements in the range, defined by [first, last), to an
+    /// uninitialized memory area beginning at \a dest, see above.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first move
+    ///         constructions and destructions.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread. Each chunk of elements is moved and destroyed by the
+    /// same thread.
+    ///
+    /// \returns  The \a uninitialized_relocate algorithm returns a
+    ///           \a pika::future<FwdIter2>, if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise.
+    ///           The \a uninitialized_relocate algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element relocated.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    uninitialized_relocate(
+        ExPolicy&& policy, FwdIter1 first, FwdIter1 last, FwdIter2 dest);
+
+    /// Relocates the elements in the range [first, first + count) to an
+    /// uninitialized memory area beginning at \a dest, see above.
+    ///
+    /// \note   Complexity: Performs exactly \a count move constructions and
+    ///         destructions, if count > 0, no operations otherwise.
+    ///
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Size        The type of the argument specifying the number of
+    ///                     elements to relocate.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param count        Refers to the number of elements starting at
+    ///                     \a first the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate_n algorithm
+    /// invoked without an execution policy object will execute in
+    /// sequential order in the calling thread.
+    ///
+    /// \returns  The \a uninitialized_relocate_n algorithm returns a
+    ///           \a std::pair<FwdIter1, FwdIter2> holding the input iterator
+    ///           one past the last element relocated and the output iterator
+    ///           one past the last element constructed.
+    ///
+    template <typename FwdIter1, typename Size, typename FwdIter2>
+    std::pair<FwdIter1, FwdIter2> uninitialized_relocate_n(
+        FwdIter1 first, Size count, FwdIter2 dest);
+
+    /// Relocates the elements in the range [first, first + count) to an
+    /// uninitialized memory area beginning at \a dest, see above.
+    ///
+    /// \note   Complexity: Performs exactly \a count move constructions and
+    ///         destructions, if count > 0, no operations otherwise.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Size        The type of the argument specifying the number of
+    ///                     elements to relocate.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param count        Refers to the number of elements starting at
+    ///                     \a first the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate_n algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The operations in the parallel \a uninitialized_relocate_n algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a uninitialized_relocate_n algorithm returns a
+    ///           \a pika::future<std::pair<FwdIter1, FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a std::pair<FwdIter1, FwdIter2> otherwise.
+    ///           The pair holds the input iterator one past the last element
+    ///           relocated and the output iterator one past the last element
+    ///           constructed.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename Size,
+        typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        std::pair<FwdIter1, FwdIter2>>::type
+    uninitialized_relocate_n(
+        ExPolicy&& policy, FwdIter1 first, Size count, FwdIter2 dest);
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_trivially_relocatable.hpp>
+#include <pika/algorithms/traits/pointer_category.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/destroy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/algorithms/uninitialized_move.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/parallel_memmove.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/transfer.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // uninitialized_relocate
+    /// \cond NOINTERNAL
+
+    // Holds if the elements referred to by FwdIter1 are relocated to
+    // FwdIter2 by copying their bytes
+    template <typename FwdIter1, typename FwdIter2>
+    inline constexpr bool is_relocate_memcpy_v =
+        pika::detail::iterators_are_contiguous_v<FwdIter1, FwdIter2> &&
+        std::is_same_v<pika::traits::iter_value_t<FwdIter1>,
+            pika::traits::iter_value_t<FwdIter2>> &&
+        pika::traits::is_trivially_relocatable_v<
+            pika::traits::iter_value_t<FwdIter2>>;
+
+    // Holds if the elements referred to by FwdIter1 are relocated to
+    // FwdIter2 one by one, i.e. if moving and destroying them can't throw
+    template <typename FwdIter1, typename FwdIter2>
+    inline constexpr bool is_nothrow_relocate_v =
+        std::is_nothrow_constructible_v<pika::traits::iter_value_t<FwdIter2>,
+            decltype(PIKA_MOVE(*std::declval<FwdIter1&>()))> &&
+        std::is_nothrow_destructible_v<pika::traits::iter_value_t<FwdIter1>>;
+
+    template <typename FwdIter1, typename FwdIter2>
+    in_out_result<FwdIter1, FwdIter2> sequential_uninitialized_relocate_n(
+        FwdIter1 first, std::size_t count, FwdIter2 dest)
+    {
+        using value_type = typename std::iterator_traits<FwdIter2>::value_type;
+        using source_type = typename std::iterator_traits<FwdIter1>::value_type;
+
+        if constexpr (is_relocate_memcpy_v<FwdIter1, FwdIter2>)
+        {
+            if (count != 0)
+            {
+                std::memcpy(to_ptr(dest), to_const_ptr(first),
+                    count * sizeof(value_type));
+                std::advance(first, count);
+                std::advance(dest, count);
+            }
+            return in_out_result<FwdIter1, FwdIter2>{first, dest};
+        }
+        else if constexpr (is_nothrow_relocate_v<FwdIter1, FwdIter2>)
+        {
+            // move each element and destroy it while it is in the cache
+            for (/* */; count != 0; (void) ++first, ++dest, --count)
+            {
+                ::new (std::addressof(*dest)) value_type(PIKA_MOVE(*first));
+                std::addressof(*first)->~source_type();
+            }
+            return in_out_result<FwdIter1, FwdIter2>{first, dest};
+        }
+        else
+        {
+            // the source elements are kept alive until all elements were
+            // moved successfully
+            in_out_result<FwdIter1, FwdIter2> result =
+                std_uninitialized_move_n(first, count, dest);
+            sequential_destroy_n(first, count);
+            return result;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2>
+    typename algorithm_result<ExPolicy,
+        in_out_result<FwdIter1, FwdIter2>>::type
+    parallel_uninitialized_relocate_n(
+        ExPolicy&& policy, FwdIter1 first, std::size_t count, FwdIter2 dest)
+    {
+        using result_type = in_out_result<FwdIter1, FwdIter2>;
+
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, result_type>::get(
+                result_type{first, dest});
+        }
+
+        if constexpr (is_relocate_memcpy_v<FwdIter1, FwdIter2> ||
+            is_nothrow_relocate_v<FwdIter1, FwdIter2>)
+        {
+            // every chunk is relocated in a single pass
+            using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
+
+            return get_in_out_result(foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(first, dest), count,
+                [](zip_iterator part_begin, std::size_t part_size,
+                    std::size_t) {
+                    using std::get;
+
+                    auto iters = part_begin.get_iterator_tuple();
+                    sequential_uninitialized_relocate_n(
+                        get<0>(iters), part_size, get<1>(iters));
+                },
+                [](zip_iterator&& last) -> zip_iterator {
+                    return PIKA_MOVE(last);
+                }));
+        }
+        else
+        {
+            // the source elements are destroyed only after all elements were
+            // moved successfully
+            return run_parallel_memmove<ExPolicy, result_type>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [=](auto& p) -> result_type {
+                    result_type result =
+                        parallel_sequential_uninitialized_move_n(
+                            p, first, count, dest);
+                    parallel_sequential_destroy_n(p, first, count);
+                    return result;
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename IterPair>
+    struct uninitialized_relocate
+      : public algorithm<uninitialized_relocate<IterPair>, IterPair>
+    {
+        uninitialized_relocate()
+          : uninitialized_relocate::algorithm("uninitialized_relocate")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2>
+        static in_out_result<FwdIter1, FwdIter2>
+        sequential(ExPolicy, FwdIter1 first, Sent last, FwdIter2 dest)
+        {
+            return sequential_uninitialized_relocate_n(
+                first, detail::distance(first, last), dest);
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2>
+        static typename algorithm_result<ExPolicy,
+            in_out_result<FwdIter1, FwdIter2>>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, Sent last, FwdIter2 dest)
+        {
+            return parallel_uninitialized_relocate_n(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), dest);
+        }
+    };
+    /// \endcond
+
+    /////////////////////////////////////////////////////////////////////////////
+    // uninitialized_relocate_n
+    /// \cond NOINTERNAL
+    template <typename IterPair>
+    struct uninitialized_relocate_n
+      : public algorithm<uninitialized_relocate_n<IterPair>, IterPair>
+    {
+        uninitialized_relocate_n()
+          : uninitialized_relocate_n::algorithm("uninitialized_relocate_n")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2>
+        static in_out_result<FwdIter1, FwdIter2> sequential(
+            ExPolicy, FwdIter1 first, std::size_t count, FwdIter2 dest)
+        {
+            return sequential_uninitialized_relocate_n(first, count, dest);
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2>
+        static typename algorithm_result<ExPolicy, IterPair>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, std::size_t count,
+            FwdIter2 dest)
+        {
+            return parallel_uninitialized_relocate_n(
+                PIKA_FORWARD(ExPolicy, policy), first, count, dest);
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::uninitialized_relocate
+    inline constexpr struct uninitialized_relocate_t final
+      : pika::detail::tag_parallel_algorithm<uninitialized_relocate_t>
+    {
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(pika::uninitialized_relocate_t,
+            FwdIter1 first, FwdIter1 last, FwdIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::get_second_element(
+                pika::parallel::detail::uninitialized_relocate<
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>()
+                    .call(pika::execution::seq, first, last, dest));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::uninitialized_relocate_t, ExPolicy&& policy,
+            FwdIter1 first, FwdIter1 last, FwdIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::get_second_element(
+                pika::parallel::detail::uninitialized_relocate<
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>()
+                    .call(PIKA_FORWARD(ExPolicy, policy), first, last, dest));
+        }
+
+    } uninitialized_relocate{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::uninitialized_relocate_n
+    inline constexpr struct uninitialized_relocate_n_t final
+      : pika::detail::tag_parallel_algorithm<uninitialized_relocate_n_t>
+    {
+        // clang-format off
+        template <typename FwdIter1, typename Size, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend std::pair<FwdIter1, FwdIter2>
+        tag_fallback_invoke(pika::uninitialized_relocate_n_t, FwdIter1 first,
+            Size count, FwdIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            // if count is representing a negative value, we do nothing
+            if (pika::parallel::detail::is_negative(count))
+            {
+                return std::pair<FwdIter1, FwdIter2>(first, dest);
+            }
+
+            return parallel::detail::get_pair(
+                pika::parallel::detail::uninitialized_relocate_n<
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>()
+                    .call(
+                        pika::execution::seq, first, std::size_t(count), dest));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename Size,
+            typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            std::pair<FwdIter1, FwdIter2>>::type
+        tag_fallback_invoke(pika::uninitialized_relocate_n_t, ExPolicy&& policy,
+            FwdIter1 first, Size count, FwdIter2 dest)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            // if count is representing a negative value, we do nothing
+            if (pika::parallel::detail::is_negative(count))
+            {
+                return pika::parallel::detail::algorithm_result<ExPolicy,
+                    std::pair<FwdIter1, FwdIter2>>::get(std::pair<FwdIter1,
+                    FwdIter2>(first, dest));
+            }
+
+            return parallel::detail::get_pair(
+                pika::parallel::detail::uninitialized_relocate_n<
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>()
+                    .call(PIKA_FORWARD(ExPolicy, policy), first,
+                        std::size_t(count), dest));
+        }
+
+    } uninitialized_relocate_n{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -0,0 +1,568 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/uninitialized_transform.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Constructs the results of applying \a f to the elements in the range
+    /// [first, last) in an uninitialized memory area beginning at \a dest.
+    /// If an exception is thrown, the elements constructed so far are
+    /// destroyed and the function has no effects.
+    ///
+    /// Unlike \a transform into a std::vector of the same size, the
+    /// destination is not value initialized first: every element is written
+    /// once, by the worker thread computing it, which also places the pages
+    /// of fresh memory close to that thread. See
+    /// \a pika::default_init_allocator for containers whose memory can be
+    /// initialized this way.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first applications
+    ///         of \a f and constructions.
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     input iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). Its result
+    ///                     is used to construct the destination element.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform algorithm
+    /// invoked without an execution policy object will execute in sequential
+    /// order in the calling thread.
+    ///
+    /// \returns  The \a uninitialized_transform algorithm returns \a FwdIter.
+    ///           The \a uninitialized_transform algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element constructed.
+    ///
+    template <typename InIter, typename FwdIter, typename F>
+    FwdIter uninitialized_transform(InIter first, InIter last, FwdIter dest,
+        F&& f);
+
+    /// Constructs the results of applying \a f to the elements in the range
+    /// [first, last) in an uninitialized memory area beginning at \a dest.
+    /// If an exception is thrown, the elements constructed so far are
+    /// destroyed and the function has no effects.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first applications
+    ///         of \a f and constructions.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a uninitialized_transform requires
+    ///                     \a F to meet the requirements of
+    ///                     \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). Its result
+    ///                     is used to construct the destination element.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a uninitialized_transform algorithm returns a
+    ///           \a pika::future<FwdIter2>, if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise.
+    ///           The \a uninitialized_transform algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element constructed.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    uninitialized_transform(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        FwdIter2 dest, F&& f);
+
+    /// Constructs the results of applying \a f to the elements in the range
+    /// [first, first + count) in an uninitialized memory area beginning at
+    /// \a dest. If an exception is thrown, the elements constructed so far
+    /// are destroyed and the function has no effects.
+    ///
+    /// \note   Complexity: Performs exactly \a count applications of \a f and
+    ///         constructions, if count > 0, no constructions otherwise.
+    ///
+    /// \tparam InIter      The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     input iterator.
+    /// \tparam Size        The type of the argument specifying the number of
+    ///                     elements to apply \a f to.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param count        Refers to the number of elements starting at
+    ///                     \a first the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements. Its
+    ///                     result is used to construct the destination
+    ///                     element.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform_n algorithm
+    /// invoked without an execution policy object will execute in sequential
+    /// order in the calling thread.
+    ///
+    /// \returns  The \a uninitialized_transform_n algorithm returns
+    ///           \a FwdIter. The \a uninitialized_transform_n algorithm
+    ///           returns the output iterator to the element in the
+    ///           destination range, one past the last element constructed.
+    ///
+    template <typename InIter, typename Size, typename FwdIter, typename F>
+    FwdIter uninitialized_transform_n(InIter first, Size count, FwdIter dest,
+        F&& f);
+
+    /// Constructs the results of applying \a f to the elements in the range
+    /// [first, first + count) in an uninitialized memory area beginning at
+    /// \a dest. If an exception is thrown, the elements constructed so far
+    /// are destroyed and the function has no effects.
+    ///
+    /// \note   Complexity: Performs exactly \a count applications of \a f and
+    ///         constructions, if count > 0, no constructions otherwise.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Size        The type of the argument specifying the number of
+    ///                     elements to apply \a f to.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a uninitialized_transform_n requires
+    ///                     \a F to meet the requirements of
+    ///                     \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param count        Refers to the number of elements starting at
+    ///                     \a first the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements. Its
+    ///                     result is used to construct the destination
+    ///                     element.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform_n algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a uninitialized_transform_n algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a uninitialized_transform_n algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise.
+    ///           The \a uninitialized_transform_n algorithm returns the
+    ///           output iterator to the element in the destination range,
+    ///           one past the last element constructed.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename Size,
+        typename FwdIter2, typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter2>::type
+    uninitialized_transform_n(ExPolicy&& policy, FwdIter1 first, Size count,
+        FwdIter2 dest, F&& f);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/util/cancellation_token.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/partitioner_with_cleanup.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // uninitialized_transform
+    /// \cond NOINTERNAL
+
+    // whether constructing the result of f for an element of Iter in an
+    // element of FwdIter can't throw
+    template <typename Iter, typename FwdIter, typename F>
+    inline constexpr bool is_nothrow_uninitialized_transform_v =
+        std::is_nothrow_invocable_v<F&,
+            typename std::iterator_traits<Iter>::reference> &&
+        std::is_nothrow_constructible_v<
+            typename std::iterator_traits<FwdIter>::value_type,
+            std::invoke_result_t<F&,
+                typename std::iterator_traits<Iter>::reference>>;
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename InIter, typename FwdIter2, typename F>
+    in_out_result<InIter, FwdIter2> sequential_uninitialized_transform_n(
+        InIter first, std::size_t count, FwdIter2 dest, F& f)
+    {
+        using value_type = typename std::iterator_traits<FwdIter2>::value_type;
+
+        FwdIter2 current = dest;
+        try
+        {
+            for (/* */; count > 0; ++first, (void) ++current, --count)
+            {
+                ::new (std::addressof(*current))
+                    value_type(PIKA_INVOKE(f, *first));
+            }
+            return in_out_result<InIter, FwdIter2>{first, current};
+        }
+        catch (...)
+        {
+            for (/* */; dest != current; ++dest)
+            {
+                (*dest).~value_type();
+            }
+            throw;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename FwdIter2, typename F>
+    typename algorithm_result<ExPolicy, FwdIter2>::type
+    parallel_uninitialized_transform_n(
+        ExPolicy&& policy, Iter first, std::size_t count, FwdIter2 dest, F&& f)
+    {
+        if (count == 0)
+        {
+            return algorithm_result<ExPolicy, FwdIter2>::get(PIKA_MOVE(dest));
+        }
+
+        using zip_iterator = pika::util::zip_iterator<Iter, FwdIter2>;
+        using partition_result_type = std::pair<FwdIter2, FwdIter2>;
+        using value_type = typename std::iterator_traits<FwdIter2>::value_type;
+
+        util::cancellation_token<util::detail::no_data> tok;
+
+        return partitioner_with_cleanup<ExPolicy, FwdIter2,
+            partition_result_type>::
+            call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(first, dest), count,
+                [tok, f = PIKA_FORWARD(F, f)](zip_iterator t,
+                    std::size_t part_size) mutable -> partition_result_type {
+                    using std::get;
+                    auto iters = t.get_iterator_tuple();
+                    FwdIter2 part_dest = get<1>(iters);
+                    return std::make_pair(part_dest,
+                        loop_with_cleanup_n_with_token(
+                            get<0>(iters), part_size, part_dest, tok,
+                            [&f](Iter it, FwdIter2 d) noexcept(
+                                is_nothrow_uninitialized_transform_v<Iter,
+                                    FwdIter2, F>) -> void {
+                                ::new (std::addressof(*d))
+                                    value_type(PIKA_INVOKE(f, *it));
+                            },
+                            [](FwdIter2 d) -> void { (*d).~value_type(); }));
+                },
+                // finalize, called once if no error occurred
+                [dest, count](
+                    std::vector<pika::future<partition_result_type>>&&
+                        data) mutable -> FwdIter2 {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+
+                    std::advance(dest, count);
+                    return dest;
+                },
+                // cleanup function, called for each partition which
+                // didn't fail, but only if at least one failed
+                [](partition_result_type&& r) -> void {
+                    while (r.first != r.second)
+                    {
+                        (*r.first).~value_type();
+                        ++r.first;
+                    }
+                });
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename FwdIter2>
+    struct uninitialized_transform
+      : public algorithm<uninitialized_transform<FwdIter2>, FwdIter2>
+    {
+        uninitialized_transform()
+          : uninitialized_transform::algorithm("uninitialized_transform")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename F>
+        static FwdIter2 sequential(
+            ExPolicy, InIter first, Sent last, FwdIter2 dest, F&& f)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter2>::value_type;
+
+            FwdIter2 current = dest;
+            try
+            {
+                for (/* */; first != last; ++first, (void) ++current)
+                {
+                    ::new (std::addressof(*current))
+                        value_type(PIKA_INVOKE(f, *first));
+                }
+                return current;
+            }
+            catch (...)
+            {
+                for (/* */; dest != current; ++dest)
+                {
+                    (*dest).~value_type();
+                }
+                throw;
+            }
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent, typename F>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, Iter first, Sent last, FwdIter2 dest, F&& f)
+        {
+            return parallel_uninitialized_transform_n(
+                PIKA_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), dest, PIKA_FORWARD(F, f));
+        }
+    };
+    /// \endcond
+
+    /////////////////////////////////////////////////////////////////////////////
+    // uninitialized_transform_n
+    /// \cond NOINTERNAL
+    template <typename FwdIter2>
+    struct uninitialized_transform_n
+      : public algorithm<uninitialized_transform_n<FwdIter2>, FwdIter2>
+    {
+        uninitialized_transform_n()
+          : uninitialized_transform_n::algorithm("uninitialized_transform_n")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename F>
+        static FwdIter2 sequential(
+            ExPolicy, InIter first, std::size_t count, FwdIter2 dest, F&& f)
+        {
+            return get_second_element(
+                sequential_uninitialized_transform_n(first, count, dest, f));
+        }
+
+        template <typename ExPolicy, typename Iter, typename F>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, Iter first, std::size_t count, FwdIter2 dest,
+            F&& f)
+        {
+            return parallel_uninitialized_transform_n(
+                PIKA_FORWARD(ExPolicy, policy), first, count, dest,
+                PIKA_FORWARD(F, f));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::uninitialized_transform
+    inline constexpr struct uninitialized_transform_t final
+      : pika::detail::tag_parallel_algorithm<uninitialized_transform_t>
+    {
+        // clang-format off
+        template <typename InIter, typename FwdIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                pika::traits::is_forward_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(pika::uninitialized_transform_t,
+            InIter first, InIter last, FwdIter dest, F&& f)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter>::value,
+                "Required at least input iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::uninitialized_transform<FwdIter>()
+                .call(pika::execution::seq, first, last, dest,
+                    PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::uninitialized_transform_t,
+            ExPolicy&& policy, FwdIter1 first, FwdIter1 last, FwdIter2 dest,
+            F&& f)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::uninitialized_transform<FwdIter2>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last, dest,
+                    PIKA_FORWARD(F, f));
+        }
+    } uninitialized_transform{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::uninitialized_transform_n
+    inline constexpr struct uninitialized_transform_n_t final
+      : pika::detail::tag_parallel_algorithm<uninitialized_transform_n_t>
+    {
+        // clang-format off
+        template <typename InIter, typename Size, typename FwdIter,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<InIter>::value &&
+                pika::traits::is_forward_iterator<FwdIter>::value
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(pika::uninitialized_transform_n_t,
+            InIter first, Size count, FwdIter dest, F&& f)
+        {
+            static_assert(pika::traits::is_input_iterator<InIter>::value,
+                "Required at least input iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+
+            // if count is representing a negative value, we do nothing
+            if (pika::parallel::detail::is_negative(count))
+            {
+                return dest;
+            }
+
+            return pika::parallel::detail::uninitialized_transform_n<FwdIter>()
+                .call(pika::execution::seq, first, std::size_t(count), dest,
+                    PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename Size,
+            typename FwdIter2, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_forward_iterator<FwdIter1>::value &&
+                pika::traits::is_forward_iterator<FwdIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(pika::uninitialized_transform_n_t,
+            ExPolicy&& policy, FwdIter1 first, Size count, FwdIter2 dest,
+            F&& f)
+        {
+            static_assert(pika::traits::is_forward_iterator<FwdIter1>::value,
+                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_forward_iterator<FwdIter2>::value,
+                "Requires at least forward iterator.");
+
+            // if count is representing a negative value, we do nothing
+            if (pika::parallel::detail::is_negative(count))
+            {
+                return pika::parallel::detail::algorithm_result<ExPolicy,
+                    FwdIter2>::get(PIKA_MOVE(dest));
+            }
+
+            return pika::parallel::detail::uninitialized_transform_n<
+                FwdIter2>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first,
+                    std::size_t(count), dest, PIKA_FORWARD(F, f));
+        }
+    } uninitialized_transform_n{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -229,7 +229,9 @@ namespace pika::parallel::detail {
 
         return loop_with_cleanup_n_with_token(
             first, count, tok,
-            [](InIter it) -> void { ::new (std::addressof(*it)) value_type(); },
+            [](InIter it) noexcept(
+                noexcept(::new (std::addressof(*it)) value_type()))
+                -> void { ::new (std::addressof(*it)) value_type(); },
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
@@ -461,6 +461,7 @@ namespace pika {
 #include <pika/config.hpp>
 #include <pika/concepts/concepts.hpp>
 #include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/type_support/unused.hpp>
 
@@ -473,17 +474,21 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/detail/transfer.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/compaction_staging.hpp>
+#include <pika/parallel/util/detail/flag_buffer.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -529,6 +534,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename Pred, typename Proj>
         static InIter
@@ -544,7 +551,8 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, Pred&& pred,
             Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<FwdIter, bool*>;
+            using zip_iterator = pika::util::zip_iterator<FwdIter,
+                pika::util::counting_iterator<std::size_t>>;
             using algorithm_result = algorithm_result<ExPolicy, FwdIter>;
             using difference_type =
                 typename std::iterator_traits<FwdIter>::difference_type;
@@ -557,35 +565,73 @@ namespace pika::parallel::detail {
                 return algorithm_result::get(PIKA_MOVE(first));
             }
 
-            std::shared_ptr<bool[]> flags(new bool[count]);
-            std::size_t init = 0u;
+            // small inputs are not worth allocating the flags for
+            if (std::size_t(count) < flag_buffer_sequential_limit)
+            {
+                return unique()(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            }
+
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
 
-            flags[0] = false;
+            switch (select_stream_compaction(policy.parameters()))
+            {
+            case pika::execution::stream_compaction_mode::recompute:
+                // the chunks have to be compacted one after the other
+                return unique()(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+
+            case pika::execution::stream_compaction_mode::staging:
+                if constexpr (std::is_copy_constructible_v<value_type>)
+                {
+                    return parallel_staging(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, PIKA_FORWARD(Pred, pred),
+                        PIKA_FORWARD(Proj, proj));
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            // the flags which would exceed the scratch memory budget are
+            // not allocated, the elements are compacted sequentially then
+            util::detail::scratch_memory_reservation reservation(
+                policy.parameters(), flag_buffer::size_in_bytes(count));
+            if (!reservation)
+            {
+                return unique()(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+            }
+
+            // the first element is never removed, its flag stays unset
+            flag_buffer flags(count, PIKA_MOVE(reservation));
+            std::size_t init = 0u;
 
             using pika::util::make_zip_iterator;
             using std::get;
             using scan_partitioner_type = scan_partitioner<ExPolicy, FwdIter,
                 std::size_t, void, scan_partitioner_sequential_f3_tag>;
 
+            // Note: replacing the invoke() with PIKA_INVOKE()
+            // below makes gcc generate errors
             auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                          proj = PIKA_FORWARD(Proj, proj)](
+                          proj = PIKA_FORWARD(Proj, proj), flags](
                           zip_iterator part_begin,
-                          std::size_t part_size) -> std::size_t {
-                FwdIter base = get<0>(part_begin.get_iterator_tuple());
-
-                // Note: replacing the invoke() with PIKA_INVOKE()
-                // below makes gcc generate errors
-
-                // MSVC complains if pred or proj is captured by ref below
-                loop_n<std::decay_t<ExPolicy>>(++part_begin, part_size,
-                    [base, pred, proj](zip_iterator it) mutable -> void {
-                        bool f = pika::util::detail::invoke(pred,
-                            pika::util::detail::invoke(proj, *base),
-                            pika::util::detail::invoke(proj, get<0>(*it)));
-
-                        if (!(get<1>(*it) = f))
-                            base = get<0>(it.get_iterator_tuple());
-                    });
+                          std::size_t part_size) mutable -> std::size_t {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter base = get<0>(iters);
+                FwdIter it = base;
+                flags.set(*get<1>(iters) + 1, part_size, [&]() {
+                    ++it;
+                    bool f = pika::util::detail::invoke(pred,
+                        pika::util::detail::invoke(proj, *base),
+                        pika::util::detail::invoke(proj, *it));
+                    if (!f)
+                        base = it;
+                    return f;
+                });
 
                 // There is no need to return the partition result.
                 // But, the scan_partitioner doesn't support 'void' as
@@ -600,36 +646,35 @@ namespace pika::parallel::detail {
                     std::size_t part_size,
                     pika::shared_future<std::size_t> curr,
                     pika::shared_future<std::size_t> next) mutable -> void {
-                PIKA_UNUSED(flags);
-
                 curr.get();    // rethrow exceptions
                 next.get();    // rethrow exceptions
 
                 FwdIter& dest = *dest_ptr;
 
-                using execution_policy_type = std::decay_t<ExPolicy>;
-                if (dest == get<0>(part_begin.get_iterator_tuple()))
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter it = get<0>(iters);
+                if (dest == it)
                 {
                     // Self-assignment must be detected.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                            {
-                                if (dest != get<0>(it.get_iterator_tuple()))
-                                    *dest++ = PIKA_MOVE(get<0>(*it));
-                                else
-                                    ++dest;
-                            }
-                        });
+                    flags.get(*get<1>(iters), part_size, [&](bool f) {
+                        if (!f)
+                        {
+                            if (dest != it)
+                                *dest++ = PIKA_MOVE(*it);
+                            else
+                                ++dest;
+                        }
+                        ++it;
+                    });
                 }
                 else
                 {
                     // Self-assignment can't be performed.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                                *dest++ = PIKA_MOVE(get<0>(*it));
-                        });
+                    flags.get(*get<1>(iters), part_size, [&](bool f) {
+                        if (!f)
+                            *dest++ = PIKA_MOVE(*it);
+                        ++it;
+                    });
                 }
             };
 
@@ -642,7 +687,7 @@ namespace pika::parallel::detail {
                 items.clear();
                 data.clear();
 
-                if (!flags[count - 1])
+                if (!flags.test(count - 1))
                 {
                     std::advance(first, count - 1);
                     if (first != (*dest_ptr))
@@ -655,7 +700,9 @@ namespace pika::parallel::detail {
 
             return scan_partitioner_type::call(
                 PIKA_FORWARD(ExPolicy, policy),
-                make_zip_iterator(first, flags.get()), count - 1, init,
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count - 1, init,
                 // step 1 performs first part of scan algorithm
                 PIKA_MOVE(f1),
                 // step 2 propagates the partition results from left
@@ -675,6 +722,98 @@ namespace pika::parallel::detail {
                 // step 4 use this return value
                 PIKA_MOVE(f4));
         }
+
+    private:
+        // Step 1 copies the elements to keep to a buffer owned by the chunk.
+        // As for the flags, a chunk decides on the elements following each
+        // of its elements, the first element is always kept in place. All
+        // elements a chunk copies to are to the left of the elements read by
+        // the chunks to its right, so step 3 moves them to their final
+        // position without waiting for the chunks to its left. The elements
+        // are copied rather than moved as the chunk to the right compares
+        // with the last one of them.
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, FwdIter>::type
+        parallel_staging(ExPolicy&& policy, FwdIter first, std::size_t count,
+            Pred&& pred, Proj&& proj)
+        {
+            using zip_iterator = pika::util::zip_iterator<FwdIter,
+                pika::util::counting_iterator<std::size_t>>;
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+            using scan_partitioner_type =
+                scan_partitioner<ExPolicy, FwdIter, std::size_t>;
+
+            using pika::util::make_zip_iterator;
+            using std::get;
+
+            compaction_staging<value_type> staging;
+
+            // Note: replacing the invoke() with PIKA_INVOKE()
+            // below makes gcc generate errors
+            auto f1 = [pred = PIKA_FORWARD(Pred, pred),
+                          proj = PIKA_FORWARD(Proj, proj), staging](
+                          zip_iterator part_begin,
+                          std::size_t part_size) mutable -> std::size_t {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter base = get<0>(iters);
+                FwdIter it = base;
+
+                std::vector<value_type> kept;
+                for (/**/; part_size != 0; --part_size)
+                {
+                    ++it;
+                    if (!pika::util::detail::invoke(pred,
+                            pika::util::detail::invoke(proj, *base),
+                            pika::util::detail::invoke(proj, *it)))
+                    {
+                        kept.push_back(*it);
+                        base = it;
+                    }
+                }
+
+                std::size_t const curr = kept.size();
+                staging.put(*get<1>(iters), PIKA_MOVE(kept));
+                return curr;
+            };
+            auto f3 = [first, staging](zip_iterator part_begin,
+                          std::size_t part_size, std::size_t val) mutable {
+                std::size_t const pos =
+                    *get<1>(part_begin.get_iterator_tuple());
+                std::vector<value_type> kept = staging.take(pos);
+
+                // a chunk keeping all of its elements which are preceded
+                // only by unique elements is left alone, the chunk to its
+                // right may still be reading its last element
+                if (val == pos && kept.size() == part_size)
+                    return;
+
+                std::advance(first, val + 1);
+                for (auto& element : kept)
+                {
+                    *first++ = PIKA_MOVE(element);
+                }
+            };
+
+            auto f4 = [first](std::vector<std::size_t>&& items,
+                          std::vector<pika::future<void>>&& data) mutable
+                -> FwdIter {
+                std::advance(first, items.back() + 1);
+
+                // make sure iterators embedded in function object that is
+                // attached to futures are invalidated
+                data.clear();
+
+                return first;
+            };
+
+            return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count - 1, std::size_t(0), PIKA_MOVE(f1),
+                std::plus<std::size_t>(), PIKA_MOVE(f3), PIKA_MOVE(f4));
+        }
     };
     /// \endcond
 
@@ -751,6 +890,8 @@ namespace pika::parallel::detail {
         {
         }
 
+        static constexpr bool allocation_free = true;
+
         template <typename ExPolicy, typename InIter, typename Sent,
             typename OutIter, typename Pred, typename Proj>
         static unique_copy_result<InIter, OutIter> sequential(ExPolicy,
@@ -768,7 +909,8 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter1 first, Sent last, FwdIter2 dest,
             Pred&& pred, Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<FwdIter1, bool*>;
+            using zip_iterator = pika::util::zip_iterator<FwdIter1,
+                pika::util::counting_iterator<std::size_t>>;
             using algorithm_result = algorithm_result<ExPolicy,
                 unique_copy_result<FwdIter1, FwdIter2>>;
             using difference_type =
@@ -778,22 +920,29 @@ namespace pika::parallel::detail {
             difference_type count =
                 detail::advance_and_get_distance(last_iter, last);
 
-            if (count == 0)
-                return algorithm_result::get(
-                    unique_copy_result<FwdIter1, FwdIter2>{
-                        PIKA_MOVE(first), PIKA_MOVE(dest)});
-
-            *dest++ = *first;
+            // small inputs are not worth allocating the flags for
+            if (std::size_t(count) < flag_buffer_sequential_limit)
+            {
+                return unique_copy()(PIKA_FORWARD(ExPolicy, policy), first,
+                    last_iter, dest, PIKA_FORWARD(Pred, pred),
+                    PIKA_FORWARD(Proj, proj));
+            }
 
-            if (count == 1)
+            // the flags which would exceed the scratch memory budget are
+            // not allocated, the elements are copied sequentially then
+            util::detail::scratch_memory_reservation reservation(
+                policy.parameters(), flag_buffer::size_in_bytes(count));
+            if (!reservation)
             {
-                return algorithm_result::get(
-                    unique_copy_result<FwdIter1, FwdIter2>{
-                        // NOLINTNEXTLINE(bugprone-macro-repeated-side-effects)
-                        PIKA_MOVE(++first), PIKA_MOVE(dest)});
+                return unique_copy()(PIKA_FORWARD(ExPolicy, policy), first,
+                    last_iter, dest, PIKA_FORWARD(Pred, pred),
+                    PIKA_FORWARD(Proj, proj));
             }
 
-            std::shared_ptr<bool[]> flags(new bool[count - 1]);
+            *dest++ = *first;
+
+            // the first element is always copied, its flag is not used
+            flag_buffer flags(count, PIKA_MOVE(reservation));
             std::size_t init = 0;
 
             using pika::util::make_zip_iterator;
@@ -802,37 +951,35 @@ namespace pika::parallel::detail {
                 unique_copy_result<FwdIter1, FwdIter2>, std::size_t>;
 
             auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                          proj = PIKA_FORWARD(Proj, proj)](
+                          proj = PIKA_FORWARD(Proj, proj), flags](
                           zip_iterator part_begin,
-                          std::size_t part_size) -> std::size_t {
-                FwdIter1 base = get<0>(part_begin.get_iterator_tuple());
-                std::size_t curr = 0;
-
-                // MSVC complains if pred or proj is captured by ref below
-                loop_n<std::decay_t<ExPolicy>>(
-                    ++part_begin, part_size, [&](zip_iterator it) mutable {
+                          std::size_t part_size) mutable -> std::size_t {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 base = get<0>(iters);
+                FwdIter1 it = base;
+                std::size_t const num_removed =
+                    flags.set(*get<1>(iters) + 1, part_size, [&]() {
+                        ++it;
                         bool f = PIKA_INVOKE(pred, PIKA_INVOKE(proj, *base),
-                            PIKA_INVOKE(proj, get<0>(*it)));
-
-                        if (!(get<1>(*it) = f))
-                        {
-                            base = get<0>(it.get_iterator_tuple());
-                            ++curr;
-                        }
+                            PIKA_INVOKE(proj, *it));
+                        if (!f)
+                            base = it;
+                        return f;
                     });
 
-                return curr;
+                return part_size - num_removed;
             };
             auto f3 = [dest, flags](zip_iterator part_begin,
                           std::size_t part_size,
                           std::size_t val) mutable -> void {
-                PIKA_UNUSED(flags);
                 std::advance(dest, val);
-                loop_n<std::decay_t<ExPolicy>>(
-                    ++part_begin, part_size, [&dest](zip_iterator it) mutable {
-                        if (!get<1>(*it))
-                            *dest++ = get<0>(*it);
-                    });
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 it = get<0>(iters);
+                flags.get(*get<1>(iters) + 1, part_size, [&](bool f) {
+                    ++it;
+                    if (!f)
+                        *dest++ = *it;
+                });
             };
 
             auto f4 = [last_iter, dest, flags](std::vector<std::size_t>&& items,
@@ -851,8 +998,9 @@ namespace pika::parallel::detail {
             };
 
             return scan_partitioner_type::call(PIKA_FORWARD(ExPolicy, policy),
-                //make_zip_iterator(first, flags.get() - 1),
-                make_zip_iterator(first, flags.get() - 1), count - 1, init,
+                make_zip_iterator(first,
+                    pika::util::make_counting_iterator(std::size_t(0))),
+                count - 1, init,
                 // step 1 performs first part of scan algorithm
                 PIKA_MOVE(f1),
                 // step 2 propagates the partition results from left
@@ -0,0 +1,668 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/unordered_compaction.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace pika {
+
+    // clang-format off
+
+    /// Copies the elements in the range [first, last) for which the
+    /// predicate \a pred returns true to the range beginning at \a dest.
+    /// Unlike \a copy_if, the order of the copied elements in the
+    /// destination range is unspecified, which allows the algorithm to take
+    /// a single pass over the input.
+    ///
+    /// Every task evaluates the predicate for a block of elements at a time
+    /// and remembers the positions of the elements to copy. It then reserves
+    /// space for them in the destination range by a single atomic increment
+    /// of a shared cursor and copies them. No scan over the chunks and no
+    /// flags for the elements are needed.
+    ///
+    /// \note   Complexity: Performs not more than \a last - \a first
+    ///         assignments, exactly \a last - \a first applications of the
+    ///         predicate \a pred.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a unordered_copy_if requires \a Pred
+    ///                     to meet the requirements of \a CopyConstructible.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the (projected)
+    ///                     elements in the sequence specified by
+    ///                     [first, last). It returns true for the elements
+    ///                     to copy.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a pred is invoked.
+    ///
+    /// The assignments in the parallel \a unordered_copy_if algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread, the elements keep
+    /// their order then.
+    ///
+    /// The assignments in the parallel \a unordered_copy_if algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a unordered_copy_if algorithm returns a
+    ///           \a pika::future<RandIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter2 otherwise. It returns the end of the
+    ///           destination range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename Pred, typename Proj = detail::projection_identity>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter2>::type
+    unordered_copy_if(ExPolicy&& policy, RandIter1 first, RandIter1 last,
+        RandIter2 dest, Pred&& pred, Proj&& proj = Proj());
+
+    /// Removes all elements for which the predicate \a pred returns true
+    /// from the range [first, last) and returns the new end of the range.
+    /// Unlike \a remove_if, the order of the remaining elements is
+    /// unspecified.
+    ///
+    /// Every task first compacts the remaining elements of its chunk
+    /// towards the beginning of the chunk. The remaining elements which lie
+    /// beyond the new end of the range are then moved into the gaps left
+    /// before it, in parallel. Elements already in place are not moved
+    /// again, so that no scan over the chunks and no flags for the elements
+    /// are needed.
+    ///
+    /// \note   Complexity: Performs not more than 2 * (\a last - \a first)
+    ///         move assignments, exactly \a last - \a first applications of
+    ///         the predicate \a pred.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a unordered_remove_if requires
+    ///                     \a Pred to meet the requirements of
+    ///                     \a CopyConstructible.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each of the (projected)
+    ///                     elements in the sequence specified by
+    ///                     [first, last). It returns true for the elements
+    ///                     to remove.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a pred is invoked.
+    ///
+    /// The assignments in the parallel \a unordered_remove_if algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread, the remaining
+    /// elements keep their order then.
+    ///
+    /// The assignments in the parallel \a unordered_remove_if algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced within
+    /// each thread.
+    ///
+    /// \returns  The \a unordered_remove_if algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter otherwise. It returns the new end of
+    ///           the range.
+    ///
+    template <typename ExPolicy, typename RandIter, typename Pred,
+        typename Proj = detail::projection_identity>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    unordered_remove_if(ExPolicy&& policy, RandIter first, RandIter last,
+        Pred&& pred, Proj&& proj = Proj());
+
+    /// Removes all elements equal to \a value from the range [first, last),
+    /// see \a unordered_remove_if.
+    ///
+    template <typename ExPolicy, typename RandIter,
+        typename T = typename std::iterator_traits<RandIter>::value_type>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter>::type
+    unordered_remove(ExPolicy&& policy, RandIter first, RandIter last,
+        T const& value);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/run_chunks.hpp>
+#include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // the number of elements whose predicate is evaluated before output
+    // space is reserved for the ones to copy
+    inline constexpr std::size_t unordered_compaction_block_size = 1024;
+
+    // the minimal number of elements handled by one task
+    static const std::size_t unordered_compaction_min_chunk_size = 16384ul;
+
+    template <typename ExPolicy>
+    std::size_t unordered_compaction_num_chunks(
+        ExPolicy& policy, std::size_t count)
+    {
+        if constexpr (pika::is_sequenced_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            PIKA_UNUSED(policy);
+            PIKA_UNUSED(count);
+            return 1;
+        }
+        else
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_chunks = (std::min)(cores,
+                (count + unordered_compaction_min_chunk_size - 1) /
+                    unordered_compaction_min_chunk_size);
+            return (std::max)(num_chunks, std::size_t(1));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // unordered_copy_if
+    template <typename InIter, typename OutIter, typename Pred,
+        typename Proj>
+    OutIter sequential_unordered_copy_if(
+        InIter first, InIter last, OutIter dest, Pred& pred, Proj& proj)
+    {
+        for (/**/; first != last; ++first)
+        {
+            if (PIKA_INVOKE(pred, PIKA_INVOKE(proj, *first)))
+            {
+                *dest = *first;
+                ++dest;
+            }
+        }
+        return dest;
+    }
+
+    // Every chunk evaluates the predicate for a block of elements, storing
+    // the offsets of the elements to copy without branching on the result,
+    // reserves the space for them at the shared cursor and copies them
+    // while the block is still in the cache.
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename Pred, typename Proj>
+    RandIter2 unordered_copy_if_impl(ExPolicy& policy, RandIter1 first,
+        std::size_t count, RandIter2 dest, Pred& pred, Proj& proj)
+    {
+        std::size_t const num_chunks =
+            unordered_compaction_num_chunks(policy, count);
+
+        std::atomic<std::size_t> cursor(0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const end = (chunk + 1) * count / num_chunks;
+
+            std::uint16_t kept[unordered_compaction_block_size];
+            for (std::size_t block = chunk * count / num_chunks; block < end;
+                 block += unordered_compaction_block_size)
+            {
+                std::size_t const n =
+                    (std::min)(unordered_compaction_block_size, end - block);
+                RandIter1 const it = first + block;
+
+                std::size_t num_kept = 0;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    kept[num_kept] = std::uint16_t(i);
+                    num_kept += std::size_t(
+                        bool(PIKA_INVOKE(pred, PIKA_INVOKE(proj, it[i]))));
+                }
+
+                if (num_kept != 0)
+                {
+                    RandIter2 const out = dest +
+                        cursor.fetch_add(num_kept, std::memory_order_relaxed);
+                    for (std::size_t i = 0; i != num_kept; ++i)
+                    {
+                        out[i] = it[kept[i]];
+                    }
+                }
+            }
+        });
+        return dest + cursor.load(std::memory_order_relaxed);
+    }
+
+    template <typename RandIter2>
+    struct unordered_copy_if
+      : public algorithm<unordered_copy_if<RandIter2>, RandIter2>
+    {
+        unordered_copy_if()
+          : unordered_copy_if::algorithm("unordered_copy_if")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename OutIter,
+            typename Pred, typename Proj>
+        static OutIter sequential(ExPolicy, InIter first, InIter last,
+            OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            return sequential_unordered_copy_if(first, last, dest, pred, proj);
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename Pred,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, RandIter2>::type parallel(
+            ExPolicy&& policy, RandIter1 first, RandIter1 last,
+            RandIter2 dest, Pred&& pred, Proj&& proj)
+        {
+            std::size_t const count = last - first;
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, RandIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            return run_length_parallel<ExPolicy, RandIter2>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, count, dest, pred = PIKA_FORWARD(Pred, pred),
+                    proj = PIKA_FORWARD(Proj, proj)](
+                    auto& p) mutable -> RandIter2 {
+                    return unordered_copy_if_impl(
+                        p, first, count, dest, pred, proj);
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // unordered_remove_if
+
+    // a range [begin, begin + size) of positions, with the number of
+    // positions in all ranges before it
+    struct unordered_remove_range
+    {
+        std::size_t begin;
+        std::size_t size;
+        std::size_t offset;
+    };
+
+    // -----------------------------------------------------------------------
+    // The range is split into chunks which are compacted in two passes:
+    //  1. every chunk moves its remaining elements to its beginning, keeping
+    //     their order, and counts them. The sum of the counts is the new
+    //     size of the range.
+    //  2. the gaps behind the remaining elements of the chunks before the
+    //     new end are exactly as many as the remaining elements behind the
+    //     new end. The latter are moved into the gaps, split into equal
+    //     parts which are moved in parallel.
+    // -----------------------------------------------------------------------
+    template <typename ExPolicy, typename RandIter, typename Pred,
+        typename Proj>
+    RandIter unordered_remove_if_impl(ExPolicy& policy, RandIter first,
+        std::size_t count, Pred& pred, Proj& proj)
+    {
+        std::size_t const num_chunks =
+            unordered_compaction_num_chunks(policy, count);
+
+        auto chunk_begin = [&](std::size_t chunk) {
+            return chunk * count / num_chunks;
+        };
+
+        // step 1
+        std::vector<std::size_t> kept(num_chunks, 0);
+        run_chunks(policy, num_chunks, [&](std::size_t chunk) {
+            std::size_t const begin = chunk_begin(chunk);
+            std::size_t const end = chunk_begin(chunk + 1);
+
+            std::size_t dest = begin;
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                if (!PIKA_INVOKE(pred, PIKA_INVOKE(proj, first[i])))
+                {
+                    if (dest != i)
+                    {
+                        first[dest] = PIKA_MOVE(first[i]);
+                    }
+                    ++dest;
+                }
+            }
+            kept[chunk] = dest - begin;
+        });
+
+        std::size_t new_count = 0;
+        for (std::size_t k : kept)
+        {
+            new_count += k;
+        }
+
+        // step 2, collect the gaps before and the elements behind the new
+        // end, both in ascending order
+        std::vector<unordered_remove_range> gaps;
+        std::vector<unordered_remove_range> elements;
+        std::size_t num_gaps = 0;
+        std::size_t num_elements = 0;
+        for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+        {
+            std::size_t const kept_end = chunk_begin(chunk) + kept[chunk];
+            std::size_t const gaps_end =
+                (std::min)(chunk_begin(chunk + 1), new_count);
+            if (kept_end < gaps_end)
+            {
+                gaps.push_back({kept_end, gaps_end - kept_end, num_gaps});
+                num_gaps += gaps_end - kept_end;
+            }
+
+            std::size_t const elements_begin =
+                (std::max)(chunk_begin(chunk), new_count);
+            if (elements_begin < kept_end)
+            {
+                elements.push_back({elements_begin, kept_end - elements_begin,
+                    num_elements});
+                num_elements += kept_end - elements_begin;
+            }
+        }
+        PIKA_ASSERT(num_gaps == num_elements);
+
+        if (num_elements != 0)
+        {
+            // returns the range holding the position with the given offset
+            auto find = [](std::vector<unordered_remove_range> const& ranges,
+                            std::size_t offset) {
+                return std::prev(std::upper_bound(ranges.begin(),
+                    ranges.end(), offset,
+                    [](std::size_t lhs, unordered_remove_range const& rhs) {
+                        return lhs < rhs.offset;
+                    }));
+            };
+
+            std::size_t const num_parts = (std::min)(num_chunks,
+                (num_elements + unordered_compaction_min_chunk_size - 1) /
+                    unordered_compaction_min_chunk_size);
+            run_chunks(policy, num_parts, [&](std::size_t part) {
+                std::size_t offset = part * num_elements / num_parts;
+                std::size_t const end = (part + 1) * num_elements / num_parts;
+
+                auto gap = find(gaps, offset);
+                auto element = find(elements, offset);
+                while (offset != end)
+                {
+                    std::size_t const gap_pos = offset - gap->offset;
+                    std::size_t const element_pos = offset - element->offset;
+                    std::size_t const n = (std::min)({end - offset,
+                        gap->size - gap_pos, element->size - element_pos});
+
+                    std::move(first + (element->begin + element_pos),
+                        first + (element->begin + element_pos + n),
+                        first + (gap->begin + gap_pos));
+
+                    offset += n;
+                    if (gap_pos + n == gap->size)
+                    {
+                        ++gap;
+                    }
+                    if (element_pos + n == element->size)
+                    {
+                        ++element;
+                    }
+                }
+            });
+        }
+
+        return first + new_count;
+    }
+
+    template <typename RandIter>
+    struct unordered_remove_if
+      : public algorithm<unordered_remove_if<RandIter>, RandIter>
+    {
+        unordered_remove_if()
+          : unordered_remove_if::algorithm("unordered_remove_if")
+        {
+        }
+
+        template <typename ExPolicy, typename Pred, typename Proj>
+        static RandIter sequential(ExPolicy policy, RandIter first,
+            RandIter last, Pred&& pred, Proj&& proj)
+        {
+            return unordered_remove_if_impl(
+                policy, first, std::size_t(last - first), pred, proj);
+        }
+
+        template <typename ExPolicy, typename Pred, typename Proj>
+        static typename algorithm_result<ExPolicy, RandIter>::type parallel(
+            ExPolicy&& policy, RandIter first, RandIter last, Pred&& pred,
+            Proj&& proj)
+        {
+            std::size_t const count = last - first;
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, RandIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            return run_length_parallel<ExPolicy, RandIter>(
+                PIKA_FORWARD(ExPolicy, policy),
+                [first, count, pred = PIKA_FORWARD(Pred, pred),
+                    proj = PIKA_FORWARD(Proj, proj)](
+                    auto& p) mutable -> RandIter {
+                    return unordered_remove_if_impl(
+                        p, first, count, pred, proj);
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::unordered_copy_if
+    inline constexpr struct unordered_copy_if_t final
+      : pika::detail::tag_parallel_algorithm<unordered_copy_if_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Pred,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter1>::value &&
+                pika::traits::is_iterator<RandIter2>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter2>::type
+        tag_fallback_invoke(unordered_copy_if_t, ExPolicy&& policy,
+            RandIter1 first, RandIter1 last, RandIter2 dest, Pred&& pred,
+            Proj&& proj = Proj())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter1>::value,
+                "Requires a random access iterator.");
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter2>::value ||
+                    (pika::is_sequenced_execution_policy_v<ExPolicy> &&
+                        pika::traits::is_output_iterator<RandIter2>::value),
+                "Requires a random access iterator or sequential "
+                "execution.");
+
+            return pika::parallel::detail::unordered_copy_if<RandIter2>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last, dest,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename OutIter, typename Pred,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::traits::is_iterator<OutIter>::value
+            )>
+        // clang-format on
+        friend OutIter tag_fallback_invoke(unordered_copy_if_t,
+            RandIter first, RandIter last, OutIter dest, Pred&& pred,
+            Proj&& proj = Proj())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+            static_assert(pika::traits::is_output_iterator<OutIter>::value,
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::unordered_copy_if<OutIter>().call(
+                pika::execution::seq, first, last, dest,
+                PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+        }
+    } unordered_copy_if{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::unordered_remove_if
+    inline constexpr struct unordered_remove_if_t final
+      : pika::detail::tag_parallel_algorithm<unordered_remove_if_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename Pred,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(unordered_remove_if_t, ExPolicy&& policy,
+            RandIter first, RandIter last, Pred&& pred, Proj&& proj = Proj())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::unordered_remove_if<RandIter>()
+                .call(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename Pred,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(unordered_remove_if_t,
+            RandIter first, RandIter last, Pred&& pred, Proj&& proj = Proj())
+        {
+            static_assert(
+                pika::traits::is_random_access_iterator<RandIter>::value,
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::unordered_remove_if<RandIter>()
+                .call(pika::execution::seq, first, last,
+                    PIKA_FORWARD(Pred, pred), PIKA_FORWARD(Proj, proj));
+        }
+    } unordered_remove_if{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::unordered_remove
+    inline constexpr struct unordered_remove_t final
+      : pika::detail::tag_parallel_algorithm<unordered_remove_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter,
+            typename T = typename std::iterator_traits<RandIter>::value_type,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(unordered_remove_t, ExPolicy&& policy,
+            RandIter first, RandIter last, T const& value)
+        {
+            return pika::unordered_remove_if(PIKA_FORWARD(ExPolicy, policy),
+                first, last, pika::parallel::detail::compare_to<T>(value));
+        }
+
+        // clang-format off
+        template <typename RandIter,
+            typename T = typename std::iterator_traits<RandIter>::value_type,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RandIter>::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(unordered_remove_t,
+            RandIter first, RandIter last, T const& value)
+        {
+            return pika::unordered_remove_if(pika::execution::seq, first,
+                last, pika::parallel::detail::compare_to<T>(value));
+        }
+    } unordered_remove{};
+}    // namespace pika
+
+#endif    // DOXYGEN
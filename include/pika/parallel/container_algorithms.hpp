@@ -54,3 +54,4 @@
 #include <pika/parallel/container_algorithms/swap_ranges.hpp>
 #include <pika/parallel/container_algorithms/transform.hpp>
 #include <pika/parallel/container_algorithms/unique.hpp>
+#include <pika/parallel/container_algorithms/views.hpp>
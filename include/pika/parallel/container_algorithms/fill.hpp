@@ -144,9 +144,9 @@ namespace pika::ranges {
                 pika::traits::is_forward_iterator<iterator_type>::value,
                 "Requires at least forward iterator.");
 
-            return pika::parallel::detail::fill<iterator_type>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), value);
+            return pika::parallel::detail::fill<iterator_type>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng), value);
         }
 
         // clang-format off
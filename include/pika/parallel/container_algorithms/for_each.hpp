@@ -84,7 +84,7 @@ namespace pika { namespace ranges {
     ///                     in which it applies user-provided function objects.
     /// \tparam FwdIter     The type of the source begin iterator used
     ///                     (deduced). This iterator type must meet the
-    ///                     requirements of an forward iterator.
+    ///                     requirements of an input iterator.
     /// \tparam Sent        The type of the source sentinel (deduced). This
     ///                     sentinel type must be a sentinel for InIter.
     /// \tparam F           The type of the function/function object to use
@@ -458,7 +458,7 @@ namespace pika::ranges {
             typename Proj = pika::parallel::detail::projection_identity,
             PIKA_CONCEPT_REQUIRES_(
                 pika::is_execution_policy<ExPolicy>::value &&
-                pika::traits::is_forward_iterator<FwdIter>::value &&
+                pika::traits::is_input_iterator<FwdIter>::value &&
                 pika::traits::is_sentinel_for<Sent, FwdIter>::value &&
                 pika::parallel::detail::is_projected<Proj, FwdIter>::value &&
                 pika::parallel::detail::is_indirect_callable<ExPolicy, F,
@@ -469,8 +469,8 @@ namespace pika::ranges {
         tag_fallback_invoke(pika::ranges::for_each_t, ExPolicy&& policy,
             FwdIter first, Sent last, F&& f, Proj&& proj = Proj())
         {
-            static_assert((pika::traits::is_forward_iterator<FwdIter>::value),
-                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_input_iterator<FwdIter>::value),
+                "Requires at least input iterator.");
 
             return parallel::detail::for_each<FwdIter>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_FORWARD(F, f),
@@ -496,13 +496,13 @@ namespace pika::ranges {
                 typename pika::traits::range_traits<Rng>::iterator_type;
 
             static_assert(
-                (pika::traits::is_forward_iterator<iterator_type>::value),
-                "Requires at least forward iterator.");
+                (pika::traits::is_input_iterator<iterator_type>::value),
+                "Requires at least input iterator.");
 
-            return parallel::detail::for_each<iterator_type>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), PIKA_FORWARD(F, f),
-                PIKA_FORWARD(Proj, proj));
+            return parallel::detail::for_each<iterator_type>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng),
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
     } for_each{};
 
@@ -25,7 +25,7 @@ namespace pika { namespace ranges {
     ///                     in which it executes the assignments.
     /// \tparam FwdIter     The type of the source begin iterator used (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     /// \tparam Sent        The type of the source sentinel used (deduced).
     ///                     This iterator type must meet the requirements of an
     ///                     forward iterator.
@@ -103,7 +103,7 @@ namespace pika { namespace ranges {
     ///                     in which it executes the assignments.
     /// \tparam FwdIter     The type of the source begin iterator used (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     /// \tparam Sent        The type of the source sentinel used (deduced).
     ///                     This iterator type must meet the requirements of an
     ///                     forward iterator.
@@ -163,7 +163,7 @@ namespace pika { namespace ranges {
     ///                     in which it executes the assignments.
     /// \tparam FwdIter     The type of the source begin iterator used (deduced).
     ///                     This iterator type must meet the requirements of an
-    ///                     forward iterator.
+    ///                     input iterator.
     /// \tparam Sent        The type of the source sentinel used (deduced).
     ///                     This iterator type must meet the requirements of an
     ///                     forward iterator.
@@ -444,8 +444,8 @@ namespace pika::ranges {
             tag_fallback_invoke(pika::ranges::reduce_t, ExPolicy&& policy,
                 FwdIter first, Sent last, T init, F&& f)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             return pika::parallel::detail::reduce<T>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
@@ -467,13 +467,14 @@ namespace pika::ranges {
                 Rng&& rng, T init, F&& f)
         {
             static_assert(
-                pika::traits::is_forward_iterator<typename pika::traits::
+                pika::traits::is_input_iterator<typename pika::traits::
                         range_traits<Rng>::iterator_type>::value,
-                "Requires at least forward iterator.");
+                "Requires at least input iterator.");
 
-            return pika::parallel::detail::reduce<T>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), PIKA_MOVE(init), PIKA_FORWARD(F, f));
+            return pika::parallel::detail::reduce<T>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng),
+                    PIKA_MOVE(init), PIKA_FORWARD(F, f));
         }
 
         // clang-format off
@@ -489,8 +490,8 @@ namespace pika::ranges {
             tag_fallback_invoke(pika::ranges::reduce_t, ExPolicy&& policy,
                 FwdIter first, Sent last, T init)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             return pika::parallel::detail::reduce<T>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(init),
@@ -512,13 +513,14 @@ namespace pika::ranges {
                 pika::ranges::reduce_t, ExPolicy&& policy, Rng&& rng, T init)
         {
             static_assert(
-                pika::traits::is_forward_iterator<typename pika::traits::
+                pika::traits::is_input_iterator<typename pika::traits::
                         range_traits<Rng>::iterator_type>::value,
-                "Requires at least forward iterator.");
+                "Requires at least input iterator.");
 
-            return pika::parallel::detail::reduce<T>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), PIKA_MOVE(init), std::plus<T>{});
+            return pika::parallel::detail::reduce<T>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng),
+                    PIKA_MOVE(init), std::plus<T>{});
         }
 
         // clang-format off
@@ -533,8 +535,8 @@ namespace pika::ranges {
         tag_fallback_invoke(
             pika::ranges::reduce_t, ExPolicy&& policy, FwdIter first, Sent last)
         {
-            static_assert(pika::traits::is_forward_iterator<FwdIter>::value,
-                "Requires at least forward iterator.");
+            static_assert(pika::traits::is_input_iterator<FwdIter>::value,
+                "Requires at least input iterator.");
 
             using value_type =
                 typename std::iterator_traits<FwdIter>::value_type;
@@ -563,12 +565,13 @@ namespace pika::ranges {
                 typename std::iterator_traits<iterator_type>::value_type;
 
             static_assert(
-                pika::traits::is_forward_iterator<iterator_type>::value,
-                "Requires at least forward iterator.");
+                pika::traits::is_input_iterator<iterator_type>::value,
+                "Requires at least input iterator.");
 
-            return pika::parallel::detail::reduce<value_type>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), value_type{}, std::plus<value_type>{});
+            return pika::parallel::detail::reduce<value_type>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng),
+                    value_type{}, std::plus<value_type>{});
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -472,9 +472,9 @@ namespace pika::ranges {
 
             return parallel::detail::transform<
                 unary_transform_result<iterator_type, FwdIter>>()
-                .call(PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                    pika::util::end(rng), dest, PIKA_FORWARD(F, f),
-                    PIKA_FORWARD(Proj, proj));
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng), dest,
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
         }
 
         // clang-format off
@@ -494,10 +494,11 @@ namespace pika::ranges {
                 pika::traits::is_forward_iterator<iterator_type>::value,
                 "Requires at least forward iterator.");
 
-            return pika::parallel::detail::transform_reduce<T>().call(
-                PIKA_FORWARD(ExPolicy, policy), pika::util::begin(rng),
-                pika::util::end(rng), PIKA_FORWARD(T, init),
-                PIKA_FORWARD(Reduce, red_op), PIKA_FORWARD(Convert, conv_op));
+            return pika::parallel::detail::transform_reduce<T>()
+                .template call_range<Rng>(PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::begin(rng), pika::util::end(rng),
+                    PIKA_FORWARD(T, init), PIKA_FORWARD(Reduce, red_op),
+                    PIKA_FORWARD(Convert, conv_op));
         }
 
         // clang-format off
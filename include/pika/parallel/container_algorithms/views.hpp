@@ -0,0 +1,557 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/views.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/iterator_support/iterator_facade.hpp>
+#include <pika/iterator_support/iterator_range.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/traits/is_range.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+
+#include <pika/parallel/container_algorithms/for_each.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace pika::util {
+    namespace detail {
+        // Holds the function object of an iterator. Lambdas can not be
+        // assigned, the iterators have to be.
+        template <typename F>
+        class view_function
+        {
+        public:
+            view_function() = default;
+
+            explicit view_function(F f)
+              : f_(PIKA_MOVE(f))
+            {
+            }
+
+            view_function(view_function const&) = default;
+            view_function(view_function&&) = default;
+
+            view_function& operator=(view_function const& rhs)
+            {
+                if (this != &rhs)
+                {
+                    f_.reset();
+                    if (rhs.f_)
+                    {
+                        f_.emplace(*rhs.f_);
+                    }
+                }
+                return *this;
+            }
+
+            view_function& operator=(view_function&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    f_.reset();
+                    if (rhs.f_)
+                    {
+                        f_.emplace(PIKA_MOVE(*rhs.f_));
+                    }
+                }
+                return *this;
+            }
+
+            F const& get() const noexcept
+            {
+                return *f_;
+            }
+
+        private:
+            std::optional<F> f_;
+        };
+
+        template <typename Iter, typename F>
+        using transformed_reference_t = std::invoke_result_t<F const&,
+            typename std::iterator_traits<Iter>::reference>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Refers to f(*base), the elements are computed whenever the iterator is
+    // dereferenced. The datapar policies compute whole packs at once from
+    // the packs of the base elements if f is callable with packs.
+    template <typename Iter, typename F>
+    class transformed_iterator
+      : public pika::util::iterator_facade<transformed_iterator<Iter, F>,
+            std::decay_t<detail::transformed_reference_t<Iter, F>>,
+            typename std::iterator_traits<Iter>::iterator_category,
+            detail::transformed_reference_t<Iter, F>,
+            typename std::iterator_traits<Iter>::difference_type>
+    {
+        using base_type =
+            pika::util::iterator_facade<transformed_iterator<Iter, F>,
+                std::decay_t<detail::transformed_reference_t<Iter, F>>,
+                typename std::iterator_traits<Iter>::iterator_category,
+                detail::transformed_reference_t<Iter, F>,
+                typename std::iterator_traits<Iter>::difference_type>;
+
+    public:
+        using base_iterator = Iter;
+        using function_type = F;
+
+        transformed_iterator() = default;
+
+        transformed_iterator(Iter it, F f)
+          : it_(it)
+          , f_(PIKA_MOVE(f))
+        {
+        }
+
+        Iter base() const
+        {
+            return it_;
+        }
+
+        F const& function() const noexcept
+        {
+            return f_.get();
+        }
+
+    protected:
+        friend class pika::util::iterator_core_access;
+
+        bool equal(transformed_iterator const& other) const
+        {
+            return it_ == other.it_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            return PIKA_INVOKE(f_.get(), *it_);
+        }
+
+        void increment()
+        {
+            ++it_;
+        }
+
+        template <typename Iter_ = Iter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_bidirectional_iterator_v<Iter_>>>
+        void decrement()
+        {
+            --it_;
+        }
+
+        template <typename Iter_ = Iter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_random_access_iterator_v<Iter_>>>
+        void advance(typename base_type::difference_type n)
+        {
+            std::advance(it_, n);
+        }
+
+        template <typename Iter_ = Iter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_random_access_iterator_v<Iter_>>>
+        typename base_type::difference_type distance_to(
+            transformed_iterator const& other) const
+        {
+            return other.it_ - it_;
+        }
+
+    private:
+        Iter it_;
+        detail::view_function<F> f_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Skips the elements for which pred does not hold. The iterator is a
+    // forward iterator whatever the category of Iter, for_each over a
+    // filtered range runs over the base range with a predicated function
+    // instead.
+    template <typename Iter, typename Pred>
+    class filtered_iterator
+      : public pika::util::iterator_facade<filtered_iterator<Iter, Pred>,
+            typename std::iterator_traits<Iter>::value_type,
+            std::forward_iterator_tag,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::difference_type>
+    {
+        using base_type =
+            pika::util::iterator_facade<filtered_iterator<Iter, Pred>,
+                typename std::iterator_traits<Iter>::value_type,
+                std::forward_iterator_tag,
+                typename std::iterator_traits<Iter>::reference,
+                typename std::iterator_traits<Iter>::difference_type>;
+
+    public:
+        using base_iterator = Iter;
+        using predicate_type = Pred;
+
+        filtered_iterator() = default;
+
+        filtered_iterator(Iter it, Iter last, Pred pred)
+          : it_(it)
+          , last_(last)
+          , pred_(PIKA_MOVE(pred))
+        {
+            satisfy();
+        }
+
+        Iter base() const
+        {
+            return it_;
+        }
+
+        Iter base_end() const
+        {
+            return last_;
+        }
+
+        Pred const& predicate() const noexcept
+        {
+            return pred_.get();
+        }
+
+    protected:
+        friend class pika::util::iterator_core_access;
+
+        bool equal(filtered_iterator const& other) const
+        {
+            return it_ == other.it_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            return *it_;
+        }
+
+        void increment()
+        {
+            ++it_;
+            satisfy();
+        }
+
+    private:
+        void satisfy()
+        {
+            while (it_ != last_ && !PIKA_INVOKE(pred_.get(), *it_))
+            {
+                ++it_;
+            }
+        }
+
+        Iter it_;
+        Iter last_;
+        detail::view_function<Pred> pred_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Refers to every stride-th element of the elements starting at first.
+    template <typename Iter>
+    class strided_iterator
+      : public pika::util::iterator_facade<strided_iterator<Iter>,
+            typename std::iterator_traits<Iter>::value_type,
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::difference_type>
+    {
+        static_assert(pika::traits::is_random_access_iterator_v<Iter>,
+            "the elements of a strided_iterator must be accessible in "
+            "random order");
+
+        using base_type = pika::util::iterator_facade<strided_iterator<Iter>,
+            typename std::iterator_traits<Iter>::value_type,
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::difference_type>;
+
+    public:
+        using base_iterator = Iter;
+        using difference_type = typename base_type::difference_type;
+
+        strided_iterator() = default;
+
+        PIKA_HOST_DEVICE strided_iterator(
+            Iter first, difference_type index, difference_type stride)
+          : first_(first)
+          , index_(index)
+          , stride_(stride)
+        {
+        }
+
+        PIKA_HOST_DEVICE Iter base() const
+        {
+            return first_ + index_ * stride_;
+        }
+
+        PIKA_HOST_DEVICE difference_type stride() const noexcept
+        {
+            return stride_;
+        }
+
+    protected:
+        friend class pika::util::iterator_core_access;
+
+        PIKA_HOST_DEVICE bool equal(strided_iterator const& other) const
+        {
+            return index_ == other.index_;
+        }
+
+        PIKA_HOST_DEVICE typename base_type::reference dereference() const
+        {
+            return first_[index_ * stride_];
+        }
+
+        PIKA_HOST_DEVICE void increment()
+        {
+            ++index_;
+        }
+
+        PIKA_HOST_DEVICE void decrement()
+        {
+            --index_;
+        }
+
+        PIKA_HOST_DEVICE void advance(difference_type n)
+        {
+            index_ += n;
+        }
+
+        PIKA_HOST_DEVICE difference_type distance_to(
+            strided_iterator const& other) const
+        {
+            return other.index_ - index_;
+        }
+
+    private:
+        Iter first_;
+        difference_type index_ = 0;
+        difference_type stride_ = 1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Refers to the consecutive values value, value + 1, ...
+    template <typename T>
+    class iota_iterator
+      : public pika::util::iterator_facade<iota_iterator<T>, T,
+            std::random_access_iterator_tag, T, std::ptrdiff_t>
+    {
+        static_assert(std::is_arithmetic_v<T>,
+            "the values of an iota_iterator must be arithmetic");
+
+        using base_type = pika::util::iterator_facade<iota_iterator<T>, T,
+            std::random_access_iterator_tag, T, std::ptrdiff_t>;
+
+    public:
+        iota_iterator() = default;
+
+        PIKA_HOST_DEVICE explicit constexpr iota_iterator(T value) noexcept
+          : value_(value)
+        {
+        }
+
+    protected:
+        friend class pika::util::iterator_core_access;
+
+        PIKA_HOST_DEVICE constexpr bool equal(
+            iota_iterator const& other) const noexcept
+        {
+            return value_ == other.value_;
+        }
+
+        PIKA_HOST_DEVICE constexpr T dereference() const noexcept
+        {
+            return value_;
+        }
+
+        PIKA_HOST_DEVICE constexpr void increment() noexcept
+        {
+            ++value_;
+        }
+
+        PIKA_HOST_DEVICE constexpr void decrement() noexcept
+        {
+            --value_;
+        }
+
+        PIKA_HOST_DEVICE constexpr void advance(std::ptrdiff_t n) noexcept
+        {
+            value_ = T(value_ + n);
+        }
+
+        PIKA_HOST_DEVICE constexpr std::ptrdiff_t distance_to(
+            iota_iterator const& other) const noexcept
+        {
+            return std::ptrdiff_t(other.value_ - value_);
+        }
+
+    private:
+        T value_ = T();
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // Invokes f with the elements for which pred holds. The datapar
+        // policies invoke the function with packs, their lanes are filtered
+        // one by one.
+        template <typename Pred, typename F, typename Proj>
+        struct filtered_invoke
+        {
+            Pred pred_;
+            F f_;
+            Proj proj_;
+
+            template <typename T>
+            void operator()(T&& value)
+            {
+                if constexpr (std::is_invocable_r_v<bool, Pred&, T&>)
+                {
+                    if (PIKA_INVOKE(pred_, value))
+                    {
+                        PIKA_INVOKE(
+                            f_, PIKA_INVOKE(proj_, PIKA_FORWARD(T, value)));
+                    }
+                }
+                else
+                {
+                    using lane_type = typename std::decay_t<T>::value_type;
+                    for (std::size_t i = 0; i != value.size(); ++i)
+                    {
+                        lane_type lane = value[i];
+                        if (PIKA_INVOKE(pred_, lane))
+                        {
+                            PIKA_INVOKE(f_, PIKA_INVOKE(proj_, lane));
+                            value[i] = lane;
+                        }
+                    }
+                }
+            }
+        };
+    }    // namespace detail
+
+    // for_each over a filtered range partitions the base range, the filter
+    // is applied by the function invoked with the elements.
+    // clang-format off
+    template <typename ExPolicy, typename Iter, typename Pred, typename F,
+        typename Proj = pika::parallel::detail::projection_identity,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy<ExPolicy>::value &&
+            pika::traits::is_forward_iterator<Iter>::value
+        )>
+    // clang-format on
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        filtered_iterator<Iter, Pred>>::type
+    tag_invoke(pika::ranges::for_each_t, ExPolicy&& policy,
+        iterator_range<filtered_iterator<Iter, Pred>> const& rng, F&& f,
+        Proj&& proj = Proj())
+    {
+        filtered_iterator<Iter, Pred> last = rng.end();
+        return pika::parallel::detail::convert_to_result(
+            pika::ranges::for_each(PIKA_FORWARD(ExPolicy, policy),
+                rng.begin().base(), last.base(),
+                detail::filtered_invoke<Pred, std::decay_t<F>,
+                    std::decay_t<Proj>>{rng.begin().predicate(),
+                    PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj)}),
+            [last](Iter) { return last; });
+    }
+}    // namespace pika::util
+
+namespace pika::ranges {
+    ///////////////////////////////////////////////////////////////////////////
+    // Lazy views of ranges. The views refer to the elements of the ranges
+    // they are created from, which have to outlive them. Unlike the views of
+    // std::ranges, the iterators of these views are known to the partitioners
+    // and the datapar policies: the random access views are partitioned by
+    // index and their packs are computed or gathered without materializing
+    // the elements, for_each over a filtered view runs over the base range.
+
+    /// Returns a view of the elements f(x) for every element x of \a rng.
+    template <typename Rng, typename F,
+        typename Enable = std::enable_if_t<pika::traits::is_range_v<Rng>>>
+    auto transformed(Rng&& rng, F f)
+    {
+        using iterator = pika::util::transformed_iterator<
+            typename pika::traits::range_iterator<Rng>::type, F>;
+
+        return pika::util::make_iterator_range(
+            iterator(pika::util::begin(rng), f),
+            iterator(pika::util::end(rng), f));
+    }
+
+    /// Returns a view of the elements of \a rng for which \a pred holds.
+    template <typename Rng, typename Pred,
+        typename Enable = std::enable_if_t<pika::traits::is_range_v<Rng>>>
+    auto filtered(Rng&& rng, Pred pred)
+    {
+        using iterator = pika::util::filtered_iterator<
+            typename pika::traits::range_iterator<Rng>::type, Pred>;
+
+        auto first = pika::util::begin(rng);
+        auto last = pika::util::end(rng);
+        return pika::util::make_iterator_range(
+            iterator(first, last, pred), iterator(last, last, pred));
+    }
+
+    /// Returns a view of the tuples of the elements at the same positions of
+    /// \a rngs, the view is as long as the shortest of the ranges.
+    template <typename... Rng,
+        typename Enable =
+            std::enable_if_t<(pika::traits::is_range_v<Rng> && ...)>>
+    auto zipped(Rng&&... rngs)
+    {
+        std::size_t const size = (std::min)({static_cast<std::size_t>(
+            std::distance(pika::util::begin(rngs), pika::util::end(rngs)))...});
+
+        return pika::util::make_iterator_range(
+            pika::util::make_zip_iterator(pika::util::begin(rngs)...),
+            pika::util::make_zip_iterator(
+                std::next(pika::util::begin(rngs), size)...));
+    }
+
+    /// Returns a view of every \a stride-th element of \a rng, starting with
+    /// the first one.
+    template <typename Rng,
+        typename Enable = std::enable_if_t<pika::traits::is_range_v<Rng>>>
+    auto strided(Rng&& rng, std::ptrdiff_t stride)
+    {
+        using base_iterator = typename pika::traits::range_iterator<Rng>::type;
+        using iterator = pika::util::strided_iterator<base_iterator>;
+        using difference_type = typename iterator::difference_type;
+
+        PIKA_ASSERT(stride > 0);
+        auto const size = std::distance(
+            pika::util::begin(rng), pika::util::end(rng));
+        return pika::util::make_iterator_range(
+            iterator(pika::util::begin(rng), 0, stride),
+            iterator(pika::util::begin(rng),
+                difference_type((size + stride - 1) / stride), stride));
+    }
+
+    /// Returns a view of the values \a first, \a first + 1, ..., \a last - 1.
+    template <typename T>
+    auto iota(T first, T last)
+    {
+        using iterator = pika::util::iota_iterator<T>;
+        return pika::util::make_iterator_range(
+            iterator(first), iterator((std::max)(first, last)));
+    }
+}    // namespace pika::ranges
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/parallel/datapar/views.hpp>
+#endif
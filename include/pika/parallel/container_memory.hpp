@@ -14,3 +14,5 @@
 #include <pika/parallel/container_algorithms/uninitialized_fill.hpp>
 #include <pika/parallel/container_algorithms/uninitialized_move.hpp>
 #include <pika/parallel/container_algorithms/uninitialized_value_construct.hpp>
+#include <pika/parallel/util/default_init_allocator.hpp>
+#include <pika/parallel/util/numa_allocator.hpp>
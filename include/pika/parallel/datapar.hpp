@@ -13,13 +13,28 @@
 
 #include <pika/executors/datapar/execution_policy.hpp>
 #include <pika/parallel/datapar/adjacent_difference.hpp>
+#include <pika/parallel/datapar/adjacent_find.hpp>
+#include <pika/parallel/datapar/adjacent_transform.hpp>
+#include <pika/parallel/datapar/counting_iterator.hpp>
 #include <pika/parallel/datapar/fill.hpp>
 #include <pika/parallel/datapar/find.hpp>
+#include <pika/parallel/datapar/for_loop.hpp>
 #include <pika/parallel/datapar/generate.hpp>
+#include <pika/parallel/datapar/isa_dispatch.hpp>
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/datapar/minmax.hpp>
+#include <pika/parallel/datapar/mismatch.hpp>
+#include <pika/parallel/datapar/permutation_iterator.hpp>
+#include <pika/parallel/datapar/remove.hpp>
+#include <pika/parallel/datapar/replace.hpp>
+#include <pika/parallel/datapar/reverse.hpp>
+#include <pika/parallel/datapar/scan.hpp>
+#include <pika/parallel/datapar/search.hpp>
 #include <pika/parallel/datapar/transfer.hpp>
 #include <pika/parallel/datapar/transform_loop.hpp>
+#include <pika/parallel/datapar/transform_reduce.hpp>
+#include <pika/parallel/datapar/views.hpp>
 #include <pika/parallel/datapar/zip_iterator.hpp>
 
 #endif
@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_find.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/compare_projected.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/vector_pack_find.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The comparisons which are evaluated on whole packs, apply returns the
+    // mask of the comparison of the corresponding elements. The packs hold
+    // the same values the scalar comparison would see, so the result is the
+    // same for floating point values as well.
+    template <typename F, typename T, typename Enable = void>
+    struct datapar_adjacent_pred : std::false_type
+    {
+    };
+
+    struct datapar_adjacent_equal : std::true_type
+    {
+        template <typename V>
+        static auto apply(V const& lhs, V const& rhs)
+        {
+            return lhs == rhs;
+        }
+    };
+
+    struct datapar_adjacent_less : std::true_type
+    {
+        template <typename V>
+        static auto apply(V const& lhs, V const& rhs)
+        {
+            return lhs < rhs;
+        }
+    };
+
+    struct datapar_adjacent_greater : std::true_type
+    {
+        template <typename V>
+        static auto apply(V const& lhs, V const& rhs)
+        {
+            return lhs > rhs;
+        }
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<equal_to, T> : datapar_adjacent_equal
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::equal_to<>, T> : datapar_adjacent_equal
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::equal_to<T>, T> : datapar_adjacent_equal
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<less, T> : datapar_adjacent_less
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::less<>, T> : datapar_adjacent_less
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::less<T>, T> : datapar_adjacent_less
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<greater, T> : datapar_adjacent_greater
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::greater<>, T> : datapar_adjacent_greater
+    {
+    };
+
+    template <typename T>
+    struct datapar_adjacent_pred<std::greater<T>, T> : datapar_adjacent_greater
+    {
+    };
+
+    // sort wraps its comparison, the projection is applied by the kernel
+    template <typename Compare, typename Proj, typename T>
+    struct datapar_adjacent_pred<compare_projected<Compare, Proj>, T,
+        std::enable_if_t<
+            std::is_same_v<std::decay_t<Proj>, projection_identity>>>
+      : datapar_adjacent_pred<std::decay_t<Compare>, T>
+    {
+    };
+
+    // is_sorted searches for the first element ordered before its
+    // predecessor
+    template <typename Compare, typename T>
+    struct datapar_adjacent_pred<reversed_comparison<Compare>, T,
+        std::enable_if_t<
+            datapar_adjacent_pred<std::decay_t<Compare>, T>::value>>
+      : std::true_type
+    {
+        template <typename V>
+        static auto apply(V const& lhs, V const& rhs)
+        {
+            return datapar_adjacent_pred<std::decay_t<Compare>, T>::apply(
+                rhs, lhs);
+        }
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    inline constexpr bool datapar_adjacent_find_compatible_v =
+        iterator_datapar_compatible<Iter>::value &&
+        std::is_same_v<std::decay_t<Proj>, projection_identity> &&
+        datapar_adjacent_pred<std::decay_t<F>,
+            typename std::iterator_traits<Iter>::value_type>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every pack is compared with the pack loaded one element further, which
+    // holds the right hand neighbour of each of its elements.
+    template <typename Iter, typename F>
+    std::size_t datapar_adjacent_find_n(Iter first, std::size_t count, F&& f)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+        using pred = datapar_adjacent_pred<std::decay_t<F>, value_type>;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        std::size_t i = 0;
+        for (/**/; count - i >= size; i += size)
+        {
+            V const lhs =
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    first);
+            V const rhs =
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    std::next(first));
+
+            int const offset =
+                traits::detail::find_first_of(pred::apply(lhs, rhs));
+            if (offset != -1)
+            {
+                return i + offset;
+            }
+
+            std::advance(first, size);
+        }
+
+        for (/**/; i != count; (void) ++i, ++first)
+        {
+            if (PIKA_INVOKE(f, *first, *std::next(first)))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_adjacent_find_compatible_v<Iter, F, Proj>)>
+    std::size_t tag_invoke(sequential_adjacent_find_n_t<ExPolicy>, Iter first,
+        std::size_t count, F&& f, Proj&&)
+    {
+        return datapar_adjacent_find_n(first, count, PIKA_FORWARD(F, f));
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/adjacent_transform.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The neighbourhoods of V::size() consecutive elements: w[k] is the pack
+    // of the elements k positions after the centers, loaded from the input
+    // at an offset of k. A window of radius r thus loads 2r + 1 overlapping
+    // packs instead of gathering the neighbours of every lane.
+    template <typename V>
+    class adjacent_window_pack
+    {
+    public:
+        using value_type = typename V::value_type;
+
+        adjacent_window_pack(
+            value_type const* center, std::size_t radius) noexcept
+          : center_(center)
+          , radius_(radius)
+        {
+        }
+
+        V operator[](std::ptrdiff_t offset) const
+        {
+            return traits::detail::vector_pack_load<V, value_type>::unaligned(
+                center_ + offset);
+        }
+
+        std::size_t radius() const noexcept
+        {
+            return radius_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return 2 * radius_ + 1;
+        }
+
+    private:
+        value_type const* center_;
+        std::size_t radius_;
+    };
+
+    // Whether the windows of Iter can be transformed in whole packs, that
+    // is if the ranges are contiguous, the elements are written as they are
+    // read and f returns a pack when invoked with a window of packs. The
+    // functions which take the windows by their type are invoked one element
+    // at a time.
+    template <typename Iter, typename OutIter, typename F,
+        typename Enable = void>
+    struct datapar_adjacent_transform_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename OutIter, typename F>
+    struct datapar_adjacent_transform_compatible<Iter, OutIter, F,
+        std::enable_if_t<pika::detail::is_contiguous_iterator_v<Iter> &&
+            pika::detail::is_contiguous_iterator_v<OutIter> &&
+            std::is_arithmetic_v<
+                typename std::iterator_traits<Iter>::value_type> &&
+            std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                typename std::iterator_traits<OutIter>::value_type>>>
+    {
+        using V = typename traits::detail::vector_pack_type<
+            typename std::iterator_traits<Iter>::value_type>::type;
+
+        static constexpr bool value = std::is_invocable_r_v<V,
+            std::decay_t<F>&, adjacent_window_pack<V> const&>;
+    };
+
+    template <typename ExPolicy>
+    struct datapar_adjacent_transform
+    {
+        template <typename Iter, typename OutIter, typename F>
+        static OutIter call(Iter center, std::size_t count, OutIter dest,
+            std::size_t radius, F& f)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+            value_type const* in = pika::detail::to_address(center);
+            value_type* out = pika::detail::to_address(dest);
+
+            std::size_t i = 0;
+            for (/**/; i + V::size() <= count; i += V::size())
+            {
+                V value = PIKA_INVOKE(
+                    f, adjacent_window_pack<V>(in + i, radius));
+                traits::detail::vector_pack_store<V, value_type>::unaligned(
+                    value, out + i);
+            }
+
+            // the remaining windows would load past the end of the input
+            for (/**/; i != count; ++i)
+            {
+                out[i] = PIKA_INVOKE(
+                    f, adjacent_window<value_type const*>(in + i, radius));
+            }
+
+            std::advance(dest, count);
+            return dest;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_adjacent_transform_compatible<Iter, OutIter, F>::value)>
+    inline OutIter tag_invoke(sequential_adjacent_transform_t<ExPolicy>,
+        Iter center, std::size_t count, OutIter dest, std::size_t radius,
+        F&& f)
+    {
+        return datapar_adjacent_transform<ExPolicy>::call(
+            center, count, dest, radius, f);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    // The packs are computed, they need not be aligned. This also leaves the
+    // peeling of a zip_iterator to its contiguous components.
+    template <typename T, typename Traversal, typename Difference>
+    struct is_data_aligned_impl<
+        pika::util::counting_iterator<T, Traversal, Difference>>
+    {
+        static PIKA_FORCEINLINE bool call(
+            pika::util::counting_iterator<T, Traversal, Difference> const&)
+        {
+            return true;
+        }
+    };
+}    // namespace pika::parallel::detail
+
+namespace pika::parallel::traits::detail {
+    template <typename T, typename Traversal, typename Difference>
+    struct vector_pack_gather_access<
+        pika::util::counting_iterator<T, Traversal, Difference>,
+        std::enable_if_t<std::is_integral_v<T>>> : std::true_type
+    {
+    };
+
+    // The pack of the values following the current one, computed from the
+    // current value instead of going through the iterator lane by lane.
+    template <typename T, typename Traversal, typename Difference>
+    struct vector_pack_gather_impl<
+        pika::util::counting_iterator<T, Traversal, Difference>,
+        std::enable_if_t<std::is_integral_v<T>>>
+    {
+        template <typename V>
+        static V call(
+            pika::util::counting_iterator<T, Traversal, Difference> const& iter,
+            std::size_t)
+        {
+            using value_type = typename V::value_type;
+            value_type const first = static_cast<value_type>(*iter);
+            return V([&](auto i) -> value_type {
+                return static_cast<value_type>(
+                    first + static_cast<value_type>(decltype(i)::value));
+            });
+        }
+    };
+}    // namespace pika::parallel::traits::detail
+#endif
@@ -11,8 +11,10 @@
 #if defined(PIKA_HAVE_DATAPAR)
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/fill.hpp>
 #include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
 #include <pika/parallel/util/result_types.hpp>
 
 #include <cstddef>
@@ -28,9 +30,17 @@ namespace pika::parallel::detail {
                 Iter>::type
             call(ExPolicy&& policy, Iter first, Sent last, T const& val)
         {
-            loop_ind(PIKA_FORWARD(ExPolicy, policy), first, last,
-                [&val](auto& v) { v = val; });
-            return first;
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(
+                    first, detail::distance(first, last), val);
+            }
+            else
+            {
+                loop_ind(PIKA_FORWARD(ExPolicy, policy), first, last,
+                    [&val](auto& v) { v = val; });
+                return first;
+            }
         }
     };
 
@@ -53,9 +63,16 @@ namespace pika::parallel::detail {
                 Iter>::type
             call(ExPolicy&&, Iter first, std::size_t count, T const& val)
         {
-            loop_n_ind<std::decay_t<ExPolicy>>(
-                first, count, [&val](auto& v) { v = val; });
-            return first;
+            if constexpr (use_non_temporal_stores_for_v<ExPolicy, Iter>)
+            {
+                return non_temporal_fill(first, count, val);
+            }
+            else
+            {
+                loop_n_ind<std::decay_t<ExPolicy>>(
+                    first, count, [&val](auto& v) { v = val; });
+                return first;
+            }
         }
     };
 
@@ -9,17 +9,22 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/tag_invoke.hpp>
 #include <pika/parallel/algorithms/detail/find.hpp>
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/datapar/mismatch.hpp>
 #include <pika/parallel/datapar/zip_iterator.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/vector_pack_all_any_none.hpp>
 #include <pika/parallel/util/vector_pack_find.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
 
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -74,7 +79,20 @@ namespace pika::parallel::detail {
     tag_invoke(sequential_find_t<ExPolicy>, Iterator first, Sentinel last,
         T const& val, Proj proj = Proj())
     {
-        return datapar_find<ExPolicy>::call(first, last, val, proj);
+        if constexpr (pika::traits::has_contiguous_segments_v<Iterator> &&
+            std::is_same_v<Iterator, Sentinel>)
+        {
+            return pika::detail::for_each_contiguous_segment(first,
+                static_cast<std::size_t>(std::distance(first, last)),
+                [&](auto* segment, std::size_t size) {
+                    return sequential_find_t<ExPolicy>{}(
+                        segment, segment + size, val, proj);
+                });
+        }
+        else
+        {
+            return datapar_find<ExPolicy>::call(first, last, val, proj);
+        }
     }
 
     template <typename ExPolicy, typename FwdIter, typename Token, typename T,
@@ -268,5 +286,82 @@ namespace pika::parallel::detail {
         return datapar_find_if_not<ExPolicy>::call(base_idx, part_begin,
             part_count, tok, PIKA_FORWARD(F, op), PIKA_FORWARD(Proj, proj));
     }
+    ///////////////////////////////////////////////////////////////////////////
+    // Every pack is tested for membership in the set of elements searched for
+    // by comparing it to each of them, which leaves one comparison per
+    // element of the set and pack instead of one per pair of elements.
+    template <typename Iter1, typename Iter2>
+    std::size_t datapar_find_first_of(
+        Iter1 first, std::size_t count, Iter2 s_first, Iter2 s_last)
+    {
+        using value_type = typename std::iterator_traits<Iter1>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        if (s_first == s_last)
+        {
+            return count;
+        }
+
+        std::size_t i = 0;
+        for (/**/; count - i >= size; i += size)
+        {
+            V const v =
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    first);
+
+            auto msk = v == V(*s_first);
+            for (Iter2 it = std::next(s_first); it != s_last; ++it)
+            {
+                msk = msk || v == V(*it);
+            }
+
+            int const offset = traits::detail::find_first_of(msk);
+            if (offset != -1)
+            {
+                return i + offset;
+            }
+
+            std::advance(first, size);
+        }
+
+        for (/**/; i != count; (void) ++i, ++first)
+        {
+            for (Iter2 it = s_first; it != s_last; ++it)
+            {
+                if (*first == *it)
+                {
+                    return i;
+                }
+            }
+        }
+        return count;
+    }
+
+    // The elements searched for are only broadcast, they need not be stored
+    // contiguously.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    inline constexpr bool datapar_find_first_of_compatible_v =
+        iterator_datapar_compatible<Iter1>::value &&
+        std::is_same_v<typename std::iterator_traits<Iter1>::value_type,
+            typename std::iterator_traits<Iter2>::value_type> &&
+        std::is_same_v<std::decay_t<Proj1>, projection_identity> &&
+        std::is_same_v<std::decay_t<Proj2>, projection_identity> &&
+        datapar_mismatch_pred<std::decay_t<F>,
+            typename std::iterator_traits<Iter1>::value_type>::value;
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_find_first_of_compatible_v<Iter1, Iter2, F, Proj1, Proj2>)>
+    std::size_t tag_invoke(sequential_find_first_of_t<ExPolicy>, Iter1 first,
+        std::size_t count, Iter2 s_first, Iter2 s_last, F&&, Proj1&&, Proj2&&)
+    {
+        return datapar_find_first_of(first, count, s_first, s_last);
+    }
 }    // namespace pika::parallel::detail
 #endif
@@ -0,0 +1,284 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/for_loop.hpp>
+#include <pika/parallel/algorithms/for_loop_induction.hpp>
+#include <pika/parallel/algorithms/for_loop_reduction.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+#include <pika/type_support/pack.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether an induction or reduction object can pass a pack of values to
+    // the function of a vectorized for_loop. This is the case for arithmetic
+    // value types.
+    template <typename Helper>
+    struct is_datapar_for_loop_arg : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_datapar_for_loop_arg<induction_helper<T>>
+      : std::is_arithmetic<std::decay_t<T>>
+    {
+    };
+
+    template <typename T>
+    struct is_datapar_for_loop_arg<induction_stride_helper<T>>
+      : std::is_arithmetic<std::decay_t<T>>
+    {
+    };
+
+    template <typename T, typename Op>
+    struct is_datapar_for_loop_arg<reduction_helper<T, Op>>
+      : std::is_arithmetic<T>
+    {
+    };
+
+    template <typename T>
+    constexpr std::size_t induction_stride(induction_helper<T> const&) noexcept
+    {
+        return 1;
+    }
+
+    template <typename T>
+    constexpr std::size_t induction_stride(
+        induction_stride_helper<T> const& helper) noexcept
+    {
+        return helper.stride();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All values passed to the function for a pack of N iterations are packs
+    // of N elements. Those are the native packs where these have the right
+    // size, such that the packs of the loop variable and of the induction and
+    // reduction values of the same type can be combined.
+    template <typename T, std::size_t N>
+    using datapar_for_loop_pack_t = std::conditional_t<N != 1 &&
+            traits::detail::vector_pack_size<T>::value == N,
+        typename traits::detail::vector_pack_type<T>::type,
+        typename traits::detail::vector_pack_type<T, N>::type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The values of an induction object for the N iterations of a pack are
+    // computed from its current value.
+    template <std::size_t N, typename Helper>
+    struct datapar_for_loop_lanes
+    {
+        using value_type = std::decay_t<decltype(
+            std::declval<Helper const&>().iteration_value())>;
+        using V = datapar_for_loop_pack_t<value_type, N>;
+
+        explicit datapar_for_loop_lanes(Helper& helper) noexcept
+          : helper_(helper)
+        {
+        }
+
+        V value() const
+        {
+            value_type const curr = helper_.iteration_value();
+            value_type const stride = value_type(induction_stride(helper_));
+            return V([&](auto i) {
+                return value_type(curr + value_type(std::size_t(i)) * stride);
+            });
+        }
+
+        void next() noexcept
+        {
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                helper_.next_iteration();
+            }
+        }
+
+        constexpr void finish() noexcept {}
+
+    private:
+        Helper& helper_;
+    };
+
+    // A reduction accumulates into one view per lane, the lanes are combined
+    // into the view of the chunk at the end.
+    template <std::size_t N, typename T, typename Op>
+    struct datapar_for_loop_lanes<N, reduction_helper<T, Op>>
+    {
+        using V = datapar_for_loop_pack_t<T, N>;
+
+        explicit datapar_for_loop_lanes(reduction_helper<T, Op>& helper)
+          : helper_(helper)
+          , lanes_(helper.identity())
+        {
+            lanes_[0] = helper_.iteration_value();
+        }
+
+        V& value() noexcept
+        {
+            return lanes_;
+        }
+
+        constexpr void next() noexcept {}
+
+        void finish()
+        {
+            T result = lanes_[0];
+            for (std::size_t i = 1; i != N; ++i)
+            {
+                result = helper_.combiner()(result, T(lanes_[i]));
+            }
+            helper_.iteration_value() = result;
+        }
+
+    private:
+        reduction_helper<T, Op>& helper_;
+        V lanes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Integral loop variables are passed as a pack of consecutive indices,
+    // iterators as a pointer to a pack holding the elements (as for the
+    // other datapar loops), which is stored back after f returns.
+    template <typename Begin, typename Enable = void>
+    struct datapar_for_loop_begin
+    {
+        using value_type = typename std::iterator_traits<Begin>::value_type;
+
+        static bool is_aligned(Begin const& it)
+        {
+            return is_data_aligned(it);
+        }
+
+        template <std::size_t N, typename F, typename... Ts>
+        PIKA_FORCEINLINE static void call(F& f, Begin& it, Ts&&... values)
+        {
+            using V = datapar_for_loop_pack_t<value_type, N>;
+
+            V tmp(traits::detail::vector_pack_load<V, value_type>::aligned(it));
+            PIKA_INVOKE(f, &tmp, PIKA_FORWARD(Ts, values)...);
+            traits::detail::vector_pack_store<V, value_type>::aligned(tmp, it);
+            std::advance(it, N);
+        }
+    };
+
+    template <typename Begin>
+    struct datapar_for_loop_begin<Begin,
+        std::enable_if_t<std::is_integral_v<Begin>>>
+    {
+        using value_type = Begin;
+
+        static constexpr bool is_aligned(Begin const&) noexcept
+        {
+            return true;
+        }
+
+        template <std::size_t N, typename F, typename... Ts>
+        PIKA_FORCEINLINE static void call(F& f, Begin& it, Ts&&... values)
+        {
+            using V = datapar_for_loop_pack_t<value_type, N>;
+
+            Begin const first = it;
+            PIKA_INVOKE(f,
+                V([first](auto i) { return Begin(first + Begin(i)); }),
+                PIKA_FORWARD(Ts, values)...);
+            it += Begin(N);
+        }
+    };
+
+    template <typename Begin, typename... Ts>
+    inline constexpr bool is_datapar_for_loop_compatible_v =
+        (std::is_integral_v<Begin> ||
+            iterator_datapar_compatible<Begin>::value) &&
+        (is_datapar_for_loop_arg<std::decay_t<Ts>>::value && ...);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run count iterations, count being a multiple of N, in packs of N.
+    template <std::size_t N, typename Begin, typename F, typename... Ts,
+        std::size_t... Is>
+    PIKA_FORCEINLINE void datapar_for_loop_packs(Begin& first,
+        std::size_t count, F& f, std::tuple<Ts...>& args,
+        pika::util::detail::index_pack<Is...>)
+    {
+        if (count == 0)
+            return;
+
+        std::tuple<datapar_for_loop_lanes<N, std::decay_t<Ts>>...> lanes(
+            std::get<Is>(args)...);
+
+        for (/* */; count != 0; count -= N)
+        {
+            datapar_for_loop_begin<Begin>::template call<N>(
+                f, first, std::get<Is>(lanes).value()...);
+
+            int const next_sequencer[] = {
+                0, (std::get<Is>(lanes).next(), 0)...};
+            (void) next_sequencer;
+        }
+
+        int const finish_sequencer[] = {
+            0, (std::get<Is>(lanes).finish(), 0)...};
+        (void) finish_sequencer;
+    }
+
+    template <typename Begin, typename F, typename... Ts, std::size_t... Is>
+    void datapar_for_loop_iterations(Begin first, std::size_t count, F&& f,
+        std::tuple<Ts...>& args, pika::util::detail::index_pack<Is...> pack)
+    {
+        using value_type =
+            typename datapar_for_loop_begin<Begin>::value_type;
+        static constexpr std::size_t size = traits::detail::vector_pack_size<
+            typename traits::detail::vector_pack_type<value_type>::type>::value;
+
+        // run single iterations until the data is aligned
+        while (count != 0 && !datapar_for_loop_begin<Begin>::is_aligned(first))
+        {
+            datapar_for_loop_packs<1>(first, 1, f, args, pack);
+            --count;
+        }
+
+        std::size_t const packed = count - count % size;
+        datapar_for_loop_packs<size>(first, packed, f, args, pack);
+
+        datapar_for_loop_packs<1>(first, count - packed, f, args, pack);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Begin, typename F, typename... Ts,
+        std::size_t... Is>
+    PIKA_FORCEINLINE typename std::enable_if<
+        pika::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    tag_invoke(for_loop_iterations_t<ExPolicy>, Begin first, std::size_t count,
+        F&& f, std::tuple<Ts...>& args,
+        pika::util::detail::index_pack<Is...> pack)
+    {
+        if constexpr (is_datapar_for_loop_compatible_v<Begin, Ts...>)
+        {
+            datapar_for_loop_iterations(
+                first, count, PIKA_FORWARD(F, f), args, pack);
+        }
+        else
+        {
+            sequential_for_loop_iterations(
+                first, count, PIKA_FORWARD(F, f), args, pack);
+        }
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+
+// The kernels are compiled for every instruction set by giving the
+// functions which instantiate them the target attribute, which is only
+// supported by GCC compatible compilers on x86-64.
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_ISA_DISPATCH) &&                      \
+    defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PIKA_ALGORITHMS_DATAPAR_ISA_DISPATCH
+#define PIKA_ALGORITHMS_TARGET_AVX2                                            \
+    __attribute__((target("avx2,fma,bmi,bmi2,popcnt"), flatten))
+#define PIKA_ALGORITHMS_TARGET_AVX512                                          \
+    __attribute__((target("avx2,fma,bmi,bmi2,popcnt,avx512f,avx512bw,"        \
+                          "avx512dq,avx512vl"),                                \
+        flatten))
+#endif
+
+namespace pika::parallel::detail {
+    // The instruction sets the datapar kernels are compiled for, baseline is
+    // the one the translation unit is compiled for.
+    enum class datapar_isa
+    {
+        baseline,
+        avx2,
+        avx512
+    };
+
+    // The widest instruction set which is supported by the processor (and
+    // the operating system), detected once.
+    inline datapar_isa detected_datapar_isa() noexcept
+    {
+#if defined(PIKA_ALGORITHMS_DATAPAR_ISA_DISPATCH)
+        static datapar_isa const isa = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") &&
+                __builtin_cpu_supports("avx512bw") &&
+                __builtin_cpu_supports("avx512dq") &&
+                __builtin_cpu_supports("avx512vl"))
+            {
+                return datapar_isa::avx512;
+            }
+            if (__builtin_cpu_supports("avx2") &&
+                __builtin_cpu_supports("fma"))
+            {
+                return datapar_isa::avx2;
+            }
+            return datapar_isa::baseline;
+        }();
+        return isa;
+#else
+        return datapar_isa::baseline;
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The pack of T which the kernels compiled for Isa use, the native one of
+    // the baseline and one filling the vector registers of Isa otherwise.
+    template <typename T, datapar_isa Isa>
+    struct datapar_isa_pack
+    {
+        static constexpr std::size_t bytes =
+            Isa == datapar_isa::avx512 ? 64 : 32;
+        static constexpr std::size_t size =
+            sizeof(T) < bytes ? bytes / sizeof(T) : 1;
+
+        using type = typename traits::detail::vector_pack_type<T, size>::type;
+    };
+
+    template <typename T>
+    struct datapar_isa_pack<T, datapar_isa::baseline>
+    {
+        using type = typename traits::detail::vector_pack_type<T>::type;
+    };
+
+    template <typename T, datapar_isa Isa>
+    using datapar_isa_pack_t = typename datapar_isa_pack<T, Isa>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invokes Kernel::call<Isa>(ts...) for the detected instruction set. The
+    // variant is selected at the first call and cached in a function
+    // pointer which is separate for every Kernel and signature. Without
+    // PIKA_ALGORITHMS_WITH_DATAPAR_ISA_DISPATCH only the baseline variant is
+    // compiled and invoked directly.
+    template <typename Kernel, typename R, typename... Ts>
+    struct datapar_isa_dispatch
+    {
+#if defined(PIKA_ALGORITHMS_DATAPAR_ISA_DISPATCH)
+    private:
+        using function_type = R (*)(Ts...);
+
+        static R call_baseline(Ts... ts)
+        {
+            return Kernel::template call<datapar_isa::baseline>(ts...);
+        }
+
+        PIKA_ALGORITHMS_TARGET_AVX2 static R call_avx2(Ts... ts)
+        {
+            return Kernel::template call<datapar_isa::avx2>(ts...);
+        }
+
+        PIKA_ALGORITHMS_TARGET_AVX512 static R call_avx512(Ts... ts)
+        {
+            return Kernel::template call<datapar_isa::avx512>(ts...);
+        }
+
+        static function_type resolve() noexcept
+        {
+            switch (detected_datapar_isa())
+            {
+            case datapar_isa::avx512:
+                return &call_avx512;
+            case datapar_isa::avx2:
+                return &call_avx2;
+            default:
+                return &call_baseline;
+            }
+        }
+
+    public:
+        static R call(Ts... ts)
+        {
+            static function_type const f = resolve();
+            return f(ts...);
+        }
+#else
+        static R call(Ts... ts)
+        {
+            return Kernel::template call<datapar_isa::baseline>(ts...);
+        }
+#endif
+    };
+}    // namespace pika::parallel::detail
+#endif
@@ -9,10 +9,13 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_HAVE_DATAPAR)
+#include <pika/algorithms/traits/datapar_tail_strategy.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/assert.hpp>
 #include <pika/functional/detail/invoke.hpp>
 #include <pika/functional/invoke_result.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/vector_pack_alignment_size.hpp>
 #include <pika/parallel/util/vector_pack_load_store.hpp>
 #include <pika/parallel/util/vector_pack_type.hpp>
@@ -30,7 +33,8 @@ namespace pika::parallel::detail {
         static PIKA_FORCEINLINE bool call(Iter const& it)
         {
             using value_type = typename std::iterator_traits<Iter>::value_type;
-            return (reinterpret_cast<std::uintptr_t>(std::addressof(*it)) &
+            return (reinterpret_cast<std::uintptr_t>(
+                        pika::detail::to_address(it)) &
                        (traits::detail::vector_pack_alignment<
                             value_type>::value -
                            1)) == 0;
@@ -88,6 +92,48 @@ namespace pika::parallel::detail {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the elements of Iter can be tested in whole packs, that is if
+    // the predicate f returns a mask when invoked with a pack. This is the
+    // case for generic predicates but not for the ones which take the
+    // elements by their type, those are invoked one element at a time.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct datapar_predicate_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F, typename Proj>
+    struct datapar_predicate_compatible<Iter, F, Proj,
+        std::enable_if_t<iterator_datapar_compatible<Iter>::value &&
+            std::is_same_v<std::decay_t<Proj>, projection_identity>>>
+    {
+        using V = typename traits::detail::vector_pack_type<
+            typename std::iterator_traits<Iter>::value_type>::type;
+
+        static constexpr bool value = std::is_invocable_r_v<
+            typename V::mask_type, std::decay_t<F>&, V const&>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the datapar loops of ExPolicy process the elements of Iter
+    // which do not fill a whole pack with masked loads and stores.
+    template <typename ExPolicy, typename Iter, typename Enable = void>
+    struct datapar_masked_tail : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename Iter>
+    struct datapar_masked_tail<ExPolicy, Iter,
+        std::enable_if_t<iterator_datapar_compatible<Iter>::value>>
+      : std::integral_constant<bool,
+            pika::traits::datapar_tail_strategy_v<ExPolicy> ==
+                    pika::traits::datapar_tail::masked &&
+                traits::detail::vector_pack_has_masked_access<
+                    typename traits::detail::vector_pack_type<typename std::
+                            iterator_traits<Iter>::value_type>::type>::value>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Iter, typename V, typename Enable = void>
     struct store_on_exit
@@ -456,6 +502,25 @@ namespace pika::parallel::detail {
             std::advance(it, traits::detail::vector_pack_size<V>::value);
             std::advance(dest, ret.size());
         }
+
+        // Transforms the first count < size elements only.
+        template <typename F, typename InIter, typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void
+        call_masked(F&& f, InIter& it, OutIter& dest, std::size_t count)
+        {
+            typedef
+                typename std::iterator_traits<InIter>::value_type value_type;
+
+            V tmp(traits::detail::vector_pack_load<V, value_type>::masked(
+                it, count));
+
+            auto ret = PIKA_INVOKE(f, &tmp);
+            traits::detail::vector_pack_store<decltype(ret),
+                value_type>::masked(ret, dest, count);
+
+            std::advance(it, count);
+            std::advance(dest, count);
+        }
     };
 
     template <typename V>
@@ -495,6 +560,24 @@ namespace pika::parallel::detail {
             std::advance(it, traits::detail::vector_pack_size<V>::value);
             std::advance(dest, ret.size());
         }
+
+        template <typename F, typename InIter, typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void
+        call_masked(F&& f, InIter& it, OutIter& dest, std::size_t count)
+        {
+            typedef
+                typename std::iterator_traits<InIter>::value_type value_type;
+
+            V tmp(traits::detail::vector_pack_load<V, value_type>::masked(
+                it, count));
+
+            auto ret = PIKA_INVOKE(f, tmp);
+            traits::detail::vector_pack_store<decltype(ret),
+                value_type>::masked(ret, dest, count);
+
+            std::advance(it, count);
+            std::advance(dest, count);
+        }
     };
 
     template <typename V1, typename V2>
@@ -557,6 +640,31 @@ namespace pika::parallel::detail {
             std::advance(it2, traits::detail::vector_pack_size<V2>::value);
             std::advance(dest, ret.size());
         }
+
+        // Transforms the first count < size elements only.
+        template <typename F, typename InIter1, typename InIter2,
+            typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void call_masked(F&& f,
+            InIter1& it1, InIter2& it2, OutIter& dest, std::size_t count)
+        {
+            typedef
+                typename std::iterator_traits<InIter1>::value_type value_type1;
+            typedef
+                typename std::iterator_traits<InIter2>::value_type value_type2;
+
+            V1 tmp1(traits::detail::vector_pack_load<V1, value_type1>::masked(
+                it1, count));
+            V2 tmp2(traits::detail::vector_pack_load<V2, value_type2>::masked(
+                it2, count));
+
+            auto ret = PIKA_INVOKE(f, &tmp1, &tmp2);
+            traits::detail::vector_pack_store<decltype(ret),
+                value_type1>::masked(ret, dest, count);
+
+            std::advance(it1, count);
+            std::advance(it2, count);
+            std::advance(dest, count);
+        }
     };
 
     template <typename V1, typename V2>
@@ -619,6 +727,30 @@ namespace pika::parallel::detail {
             std::advance(it2, traits::detail::vector_pack_size<V2>::value);
             std::advance(dest, ret.size());
         }
+
+        template <typename F, typename InIter1, typename InIter2,
+            typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void call_masked(F&& f,
+            InIter1& it1, InIter2& it2, OutIter& dest, std::size_t count)
+        {
+            typedef
+                typename std::iterator_traits<InIter1>::value_type value_type1;
+            typedef
+                typename std::iterator_traits<InIter2>::value_type value_type2;
+
+            V1 tmp1(traits::detail::vector_pack_load<V1, value_type1>::masked(
+                it1, count));
+            V2 tmp2(traits::detail::vector_pack_load<V2, value_type2>::masked(
+                it2, count));
+
+            auto ret = PIKA_INVOKE(f, tmp1, tmp2);
+            traits::detail::vector_pack_store<decltype(ret),
+                value_type1>::masked(ret, dest, count);
+
+            std::advance(it1, count);
+            std::advance(it2, count);
+            std::advance(dest, count);
+        }
     };
 
     struct datapar_transform_loop_step
@@ -9,15 +9,19 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_HAVE_DATAPAR)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/executors/datapar/execution_policy.hpp>
 #include <pika/executors/execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
 #include <pika/functional/tag_invoke.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_complex.hpp>
 #include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_reduce.hpp>
 #include <pika/parallel/util/vector_pack_type.hpp>
 
 #include <algorithm>
@@ -49,15 +53,27 @@ namespace pika::parallel::detail {
     {
         using vector_type = std::decay_t<Vector>;
         using entry_type = typename vector_type::value_type;
+        using reduce_op =
+            traits::detail::vector_pack_reduce_op<std::decay_t<F>, entry_type>;
 
-        entry_type accum = value[0];
-        for (size_t i = 1; i != value.size(); ++i)
+        // known operations are reduced in a tree using the simd backend
+        if constexpr (reduce_op::value)
         {
-            accum = f(accum, entry_type(value[i]));
+            return typename traits::detail::vector_pack_type<entry_type,
+                1>::type(traits::detail::reduce(
+                value, typename reduce_op::type{}));
         }
+        else
+        {
+            entry_type accum = value[0];
+            for (size_t i = 1; i != value.size(); ++i)
+            {
+                accum = f(accum, entry_type(value[i]));
+            }
 
-        return typename traits::detail::vector_pack_type<entry_type, 1>::type(
-            accum);
+            return typename traits::detail::vector_pack_type<entry_type,
+                1>::type(accum);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -68,9 +84,21 @@ namespace pika::parallel::detail {
     tag_invoke(
         accumulate_values_t<ExPolicy>, F&& f, Vector const& value, T accum)
     {
-        for (size_t i = 0; i != value.size(); ++i)
+        using entry_type = typename std::decay_t<Vector>::value_type;
+        using reduce_op =
+            traits::detail::vector_pack_reduce_op<std::decay_t<F>, entry_type>;
+
+        if constexpr (std::is_same_v<T, entry_type> && reduce_op::value)
         {
-            accum = f(accum, T(value[i]));
+            accum = f(accum,
+                traits::detail::reduce(value, typename reduce_op::type{}));
+        }
+        else
+        {
+            for (size_t i = 0; i != value.size(); ++i)
+            {
+                accum = f(accum, T(value[i]));
+            }
         }
 
         return typename traits::detail::vector_pack_type<T, 1>::type(accum);
@@ -678,12 +706,64 @@ namespace pika::parallel::detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // Contiguous ranges of std::complex<float> or std::complex<double> are
+    // loaded into complex packs of their real and imaginary parts, f is
+    // invoked with pointers to them and the parts are interleaved again
+    // unless the elements are const, see vector_pack_complex.hpp.
+    template <typename Iter>
+    inline constexpr bool is_datapar_complex_loop_v =
+        pika::detail::is_contiguous_iterator_v<Iter> &&
+        traits::detail::is_vector_pack_complex_v<
+            typename std::iterator_traits<Iter>::value_type>;
+
+    template <typename CP, typename Iter, typename F>
+    PIKA_FORCEINLINE void datapar_complex_loop_step(
+        F& f, Iter it, std::size_t i)
+    {
+        auto* p = pika::detail::to_address(it) + i;
+        CP tmp = traits::detail::complex_pack_load<CP>(p);
+        PIKA_INVOKE(f, &tmp);
+        if constexpr (!std::is_const_v<std::remove_pointer_t<decltype(p)>>)
+        {
+            traits::detail::complex_pack_store(tmp, p);
+        }
+    }
+
+    template <typename Iter, typename F>
+    Iter datapar_complex_loop_n(Iter it, std::size_t count, F& f)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using CP = traits::detail::complex_pack_type_t<value_type>;
+        using CP1 = traits::detail::complex_pack_type_t<value_type, 1>;
+
+        std::size_t i = 0;
+        for (/**/; count - i >= CP::size(); i += CP::size())
+        {
+            datapar_complex_loop_step<CP>(f, it, i);
+        }
+        for (/**/; i != count; ++i)
+        {
+            datapar_complex_loop_step<CP1>(f, it, i);
+        }
+
+        std::advance(it, count);
+        return it;
+    }
+
     template <typename ExPolicy, typename Iter, typename F>
     PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr typename std::enable_if<
         pika::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
     tag_invoke(loop_n_t<ExPolicy>, Iter it, std::size_t count, F&& f)
     {
-        return datapar_loop_n_impl<Iter>::call(it, count, PIKA_FORWARD(F, f));
+        if constexpr (is_datapar_complex_loop_v<Iter>)
+        {
+            return datapar_complex_loop_n(it, count, f);
+        }
+        else
+        {
+            return datapar_loop_n_impl<Iter>::call(
+                it, count, PIKA_FORWARD(F, f));
+        }
     }
 
     template <typename ExPolicy, typename Iter, typename CancelToken,
@@ -703,8 +783,19 @@ namespace pika::parallel::detail {
         pika::is_vectorpack_execution_policy<ExPolicy>::value, Iter>::type
     tag_invoke(loop_n_ind_t<ExPolicy>, Iter it, std::size_t count, F&& f)
     {
-        return datapar_loop_n_ind_impl<Iter>::call(
-            it, count, PIKA_FORWARD(F, f));
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            // vectorize the blocks of segmented iterators one by one
+            return pika::detail::for_each_contiguous_segment(it, count,
+                [&](auto* segment, std::size_t size) {
+                    return loop_n_ind_t<ExPolicy>{}(segment, size, f);
+                });
+        }
+        else
+        {
+            return datapar_loop_n_ind_impl<Iter>::call(
+                it, count, PIKA_FORWARD(F, f));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -714,8 +805,21 @@ namespace pika::parallel::detail {
     tag_invoke(loop_idx_n_t<ExPolicy>, std::size_t base_idx, Iter it,
         std::size_t count, F&& f)
     {
-        return datapar_loop_idx_n_impl<Iter>::call(
-            base_idx, it, count, PIKA_FORWARD(F, f));
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            return pika::detail::for_each_contiguous_segment(it, count,
+                [&](auto* segment, std::size_t size) {
+                    auto* last = loop_idx_n_t<ExPolicy>{}(
+                        base_idx, segment, size, f);
+                    base_idx += size;
+                    return last;
+                });
+        }
+        else
+        {
+            return datapar_loop_idx_n_impl<Iter>::call(
+                base_idx, it, count, PIKA_FORWARD(F, f));
+        }
     }
 
     template <typename ExPolicy, typename Iter, typename CancelToken,
@@ -725,8 +829,21 @@ namespace pika::parallel::detail {
     tag_invoke(loop_idx_n_t<ExPolicy>, std::size_t base_idx, Iter it,
         std::size_t count, CancelToken& tok, F&& f)
     {
-        return datapar_loop_idx_n_impl<Iter>::call(
-            base_idx, it, count, tok, PIKA_FORWARD(F, f));
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            return pika::detail::for_each_contiguous_segment(it, count,
+                [&](auto* segment, std::size_t size) {
+                    auto* last = loop_idx_n_t<ExPolicy>{}(
+                        base_idx, segment, size, tok, f);
+                    base_idx += size;
+                    return last;
+                });
+        }
+        else
+        {
+            return datapar_loop_idx_n_impl<Iter>::call(
+                base_idx, it, count, tok, PIKA_FORWARD(F, f));
+        }
     }
 }    // namespace pika::parallel::detail
 
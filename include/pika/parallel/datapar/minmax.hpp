@@ -0,0 +1,354 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/minmax.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/datapar/isa_dispatch.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/vector_pack_find.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_reduce.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename F, typename T, typename Enable = void>
+    struct datapar_minmax_pred : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_minmax_pred<less, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_minmax_pred<std::less<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_minmax_pred<std::less<T>, T> : std::true_type
+    {
+    };
+
+    // Values which are not ordered by less (NaN) violate the requirements of
+    // the algorithms anyway, so floating point types are vectorized as well.
+    template <typename Iter, typename F, typename Proj>
+    inline constexpr bool datapar_minmax_compatible_v =
+        iterator_datapar_compatible<Iter>::value &&
+        std::is_same_v<std::decay_t<Proj>, projection_identity> &&
+        datapar_minmax_pred<std::decay_t<F>,
+            typename std::iterator_traits<Iter>::value_type>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are processed in blocks. The extreme values of each block
+    // are reduced across the lanes and compared to the ones found so far,
+    // only the block which contains the result is searched for its position
+    // at the end.
+    template <typename T,
+        typename V = typename traits::detail::vector_pack_type<T>::type>
+    struct datapar_minmax_helper
+    {
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+        static constexpr std::size_t block_size = 64 * size;
+
+        template <typename Iter>
+        static V load(Iter it)
+        {
+            return traits::detail::vector_pack_load<V, T>::unaligned(it);
+        }
+
+        // the size of the next block at offset i, a multiple of size
+        static constexpr std::size_t next_block(std::size_t i, std::size_t n)
+        {
+            return (std::min)(block_size, (n - i) / size * size);
+        }
+
+        template <typename Iter>
+        static T block_min(Iter it, std::size_t count)
+        {
+            V value = load(it);
+            for (std::size_t i = size; i != count; i += size)
+            {
+                value = traits::detail::min(value, load(it + i));
+            }
+            return traits::detail::reduce_min(value);
+        }
+
+        template <typename Iter>
+        static T block_max(Iter it, std::size_t count)
+        {
+            V value = load(it);
+            for (std::size_t i = size; i != count; i += size)
+            {
+                value = traits::detail::max(value, load(it + i));
+            }
+            return traits::detail::reduce_max(value);
+        }
+
+        // the offset of the first element equal to value
+        template <typename Iter>
+        static std::size_t find_first(Iter it, std::size_t count, T value)
+        {
+            std::size_t i = 0;
+            for (/**/; count - i >= size; i += size)
+            {
+                int const offset =
+                    traits::detail::find_first_of(load(it + i) == V(value));
+                if (offset != -1)
+                {
+                    return i + offset;
+                }
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (it[i] == value)
+                {
+                    break;
+                }
+            }
+            return i;
+        }
+
+        // the offset of the last element equal to value
+        template <typename Iter>
+        static std::size_t find_last(Iter it, std::size_t count, T value)
+        {
+            std::size_t i = count;
+            for (/**/; i % size != 0; --i)
+            {
+                if (it[i - 1] == value)
+                {
+                    return i - 1;
+                }
+            }
+            for (/**/; i != 0; i -= size)
+            {
+                int const offset = traits::detail::find_last_of(
+                    load(it + (i - size)) == V(value));
+                if (offset != -1)
+                {
+                    return i - size + offset;
+                }
+            }
+            return 0;
+        }
+
+        template <typename Iter>
+        static Iter min_element(Iter it, std::size_t count)
+        {
+            T value = *it;
+            std::size_t pos = 0;
+            std::size_t len = 1;
+
+            std::size_t i = 0;
+            for (std::size_t n = 0; (n = next_block(i, count)) != 0; i += n)
+            {
+                T const block_value = block_min(it + i, n);
+                if (block_value < value)
+                {
+                    value = block_value;
+                    pos = i;
+                    len = n;
+                }
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (it[i] < value)
+                {
+                    value = it[i];
+                    pos = i;
+                    len = 1;
+                }
+            }
+
+            return it + (pos + find_first(it + pos, len, value));
+        }
+
+        template <typename Iter>
+        static Iter max_element(Iter it, std::size_t count)
+        {
+            T value = *it;
+            std::size_t pos = 0;
+            std::size_t len = 1;
+
+            std::size_t i = 0;
+            for (std::size_t n = 0; (n = next_block(i, count)) != 0; i += n)
+            {
+                T const block_value = block_max(it + i, n);
+                if (!(block_value < value))
+                {
+                    value = block_value;
+                    pos = i;
+                    len = n;
+                }
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (!(it[i] < value))
+                {
+                    value = it[i];
+                    pos = i;
+                    len = 1;
+                }
+            }
+
+            return it + (pos + find_last(it + pos, len, value));
+        }
+
+        template <typename Iter>
+        static min_max_result<Iter> minmax_element(Iter it, std::size_t count)
+        {
+            T min_value = *it;
+            std::size_t min_pos = 0;
+            std::size_t min_len = 1;
+
+            T max_value = *it;
+            std::size_t max_pos = 0;
+            std::size_t max_len = 1;
+
+            std::size_t i = 0;
+            for (std::size_t n = 0; (n = next_block(i, count)) != 0; i += n)
+            {
+                T const block_min_value = block_min(it + i, n);
+                if (block_min_value < min_value)
+                {
+                    min_value = block_min_value;
+                    min_pos = i;
+                    min_len = n;
+                }
+
+                T const block_max_value = block_max(it + i, n);
+                if (!(block_max_value < max_value))
+                {
+                    max_value = block_max_value;
+                    max_pos = i;
+                    max_len = n;
+                }
+            }
+            for (/**/; i != count; ++i)
+            {
+                if (it[i] < min_value)
+                {
+                    min_value = it[i];
+                    min_pos = i;
+                    min_len = 1;
+                }
+                if (!(it[i] < max_value))
+                {
+                    max_value = it[i];
+                    max_pos = i;
+                    max_len = 1;
+                }
+            }
+
+            min_pos += find_first(it + min_pos, min_len, min_value);
+            max_pos += find_last(it + max_pos, max_len, max_value);
+            return {it + min_pos, it + max_pos};
+        }
+    };
+
+    // The kernels which are compiled for every instruction set, see
+    // datapar_isa_dispatch.
+    template <typename T>
+    struct datapar_min_element_kernel
+    {
+        template <datapar_isa Isa, typename Iter>
+        static Iter call(Iter it, std::size_t count)
+        {
+            return datapar_minmax_helper<T,
+                datapar_isa_pack_t<T, Isa>>::min_element(it, count);
+        }
+    };
+
+    template <typename T>
+    struct datapar_max_element_kernel
+    {
+        template <datapar_isa Isa, typename Iter>
+        static Iter call(Iter it, std::size_t count)
+        {
+            return datapar_minmax_helper<T,
+                datapar_isa_pack_t<T, Isa>>::max_element(it, count);
+        }
+    };
+
+    template <typename T>
+    struct datapar_minmax_element_kernel
+    {
+        template <datapar_isa Isa, typename Iter>
+        static min_max_result<Iter> call(Iter it, std::size_t count)
+        {
+            return datapar_minmax_helper<T,
+                datapar_isa_pack_t<T, Isa>>::minmax_element(it, count);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible_v<Iter, F, Proj>)>
+    Iter tag_invoke(sequential_min_element_t<ExPolicy>, Iter it,
+        std::size_t count, F const&, Proj const&)
+    {
+        if (count == 0)
+            return it;
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_isa_dispatch<datapar_min_element_kernel<value_type>,
+            Iter, Iter, std::size_t>::call(it, count);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible_v<Iter, F, Proj>)>
+    Iter tag_invoke(sequential_max_element_t<ExPolicy>, Iter it,
+        std::size_t count, F const&, Proj const&)
+    {
+        if (count == 0)
+            return it;
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_isa_dispatch<datapar_max_element_kernel<value_type>,
+            Iter, Iter, std::size_t>::call(it, count);
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_minmax_compatible_v<Iter, F, Proj>)>
+    min_max_result<Iter> tag_invoke(sequential_minmax_element_t<ExPolicy>,
+        Iter it, std::size_t count, F const&, Proj const&)
+    {
+        if (count == 0)
+            return {it, it};
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_isa_dispatch<datapar_minmax_element_kernel<value_type>,
+            min_max_result<Iter>, Iter, std::size_t>::call(it, count);
+    }
+}    // namespace pika::parallel::detail
+#endif
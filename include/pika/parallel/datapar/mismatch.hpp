@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/vector_pack_find.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The predicates which are evaluated on whole packs by comparing them for
+    // equality.
+    template <typename F, typename T, typename Enable = void>
+    struct datapar_mismatch_pred : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_mismatch_pred<equal_to, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_mismatch_pred<std::equal_to<>, T> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_mismatch_pred<std::equal_to<T>, T> : std::true_type
+    {
+    };
+
+    // Elements of integral type are equivalent with respect to less only if
+    // they are equal. This does not hold for floating point values (NaN).
+    template <typename T>
+    struct datapar_mismatch_pred<equivalent_to<less>, T,
+        std::enable_if_t<std::is_integral_v<T>>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_mismatch_pred<equivalent_to<std::less<>>, T,
+        std::enable_if_t<std::is_integral_v<T>>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_mismatch_pred<equivalent_to<std::less<T>>, T,
+        std::enable_if_t<std::is_integral_v<T>>> : std::true_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    inline constexpr bool datapar_mismatch_compatible_v =
+        iterator_datapar_compatible<Iter1>::value &&
+        iterator_datapar_compatible<Iter2>::value &&
+        std::is_same_v<typename std::iterator_traits<Iter1>::value_type,
+            typename std::iterator_traits<Iter2>::value_type> &&
+        std::is_same_v<std::decay_t<Proj1>, projection_identity> &&
+        std::is_same_v<std::decay_t<Proj2>, projection_identity> &&
+        datapar_mismatch_pred<std::decay_t<F>,
+            typename std::iterator_traits<Iter1>::value_type>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter1, typename Iter2>
+    std::size_t datapar_mismatch_n(
+        Iter1 first1, Iter2 first2, std::size_t count)
+    {
+        using value_type = typename std::iterator_traits<Iter1>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        std::size_t i = 0;
+        for (/**/; count - i >= size; i += size)
+        {
+            V const v1 =
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    first1);
+            V const v2 =
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    first2);
+
+            int const offset = traits::detail::find_first_of(!(v1 == v2));
+            if (offset != -1)
+            {
+                return i + offset;
+            }
+
+            std::advance(first1, size);
+            std::advance(first2, size);
+        }
+
+        for (/**/; i != count; (void) ++i, ++first1, ++first2)
+        {
+            if (!(*first1 == *first2))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible_v<Iter1, Iter2, F, Proj1, Proj2>)>
+    std::size_t tag_invoke(sequential_mismatch_n_t<ExPolicy>, Iter1 first1,
+        Iter2 first2, std::size_t count, F&&, Proj1&&, Proj2&&)
+    {
+        return datapar_mismatch_n(first1, first2, count);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,44 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/permutation_iterator.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    // The packs are gathered lane by lane, they need not be aligned. This
+    // also leaves the peeling of a zip_iterator to its contiguous components.
+    template <typename ElementIter, typename IndexIter>
+    struct is_data_aligned_impl<
+        pika::util::permutation_iterator<ElementIter, IndexIter>>
+    {
+        static PIKA_FORCEINLINE bool call(
+            pika::util::permutation_iterator<ElementIter, IndexIter> const&)
+        {
+            return true;
+        }
+    };
+}    // namespace pika::parallel::detail
+
+namespace pika::parallel::traits::detail {
+    template <typename ElementIter, typename IndexIter>
+    struct vector_pack_gather_access<
+        pika::util::permutation_iterator<ElementIter, IndexIter>,
+        std::enable_if_t<pika::traits::is_random_access_iterator_v<IndexIter>>>
+      : std::true_type
+    {
+    };
+}    // namespace pika::parallel::traits::detail
+#endif
@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/remove.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/vector_pack_all_any_none.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The portable simd backend has no compress-store, so the packs in which
+    // some elements are removed are compacted one lane at a time. The packs
+    // which are kept or removed as a whole, the common case when sanitizing
+    // data, are stored with a single unaligned store or skipped.
+    template <typename InIter, typename OutIter, typename Pred>
+    OutIter datapar_remove_copy_if(
+        InIter first, std::size_t count, OutIter dest, Pred& pred)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        // dest never runs ahead of first, so a pack is always loaded before
+        // the elements it is stored to, even if the ranges are the same
+        for (/* */; count >= size; count -= size)
+        {
+            V v = traits::detail::vector_pack_load<V, value_type>::unaligned(
+                first);
+            typename V::mask_type const removed = PIKA_INVOKE(pred, v);
+            if (traits::detail::none_of(removed))
+            {
+                traits::detail::vector_pack_store<V, value_type>::unaligned(
+                    v, dest);
+                std::advance(dest, size);
+            }
+            else if (!traits::detail::all_of(removed))
+            {
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if (!removed[i])
+                    {
+                        *dest = v[i];
+                        ++dest;
+                    }
+                }
+            }
+            std::advance(first, size);
+        }
+
+        for (/* */; count != 0; (void) --count, ++first)
+        {
+            if (!PIKA_INVOKE(pred, *first))
+            {
+                *dest = *first;
+                ++dest;
+            }
+        }
+        return dest;
+    }
+
+    template <typename InIter, typename OutIter>
+    inline constexpr bool datapar_remove_copy_compatible_v =
+        iterator_datapar_compatible<OutIter>::value &&
+        std::is_same_v<typename std::iterator_traits<InIter>::value_type,
+            typename std::iterator_traits<OutIter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Pred,
+        typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_sized_range_v<Iter, Sent> &&
+            datapar_predicate_compatible<Iter, Pred, Proj>::value)>
+    Iter tag_invoke(sequential_remove_if_t<ExPolicy>, Iter first, Sent last,
+        Pred&& pred, Proj&&)
+    {
+        return datapar_remove_copy_if(
+            first, detail::distance(first, last), first, pred);
+    }
+
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename Pred, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            is_sized_range_v<InIter, Sent> &&
+            datapar_predicate_compatible<InIter, Pred, Proj>::value &&
+            datapar_remove_copy_compatible_v<InIter, OutIter>)>
+    in_out_result<InIter, OutIter> tag_invoke(
+        sequential_remove_copy_if_t<ExPolicy>, InIter first, Sent last,
+        OutIter dest, Pred&& pred, Proj&&)
+    {
+        std::size_t const count = detail::distance(first, last);
+        dest = datapar_remove_copy_if(first, count, dest, pred);
+        return in_out_result<InIter, OutIter>{
+            std::next(first, count), PIKA_MOVE(dest)};
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,70 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/replace.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_all_any_none.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+#include <pika/parallel/util/vector_pack_where.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The packs are only written back if one of their elements was replaced.
+    template <typename ExPolicy, typename Iter, typename F, typename T,
+        typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_predicate_compatible<Iter, F, Proj>::value)>
+    Iter tag_invoke(sequential_replace_if_n_t<ExPolicy>, Iter first,
+        std::size_t count, F&& f, T const& new_value, Proj&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        value_type const value(new_value);
+        for (/* */; count >= size; count -= size)
+        {
+            V v = traits::detail::vector_pack_load<V, value_type>::unaligned(
+                first);
+            typename V::mask_type const msk = PIKA_INVOKE(f, v);
+            if (traits::detail::any_of(msk))
+            {
+                traits::detail::where_assign(msk, v, value);
+                traits::detail::vector_pack_store<V, value_type>::unaligned(
+                    v, first);
+            }
+            std::advance(first, size);
+        }
+
+        for (/* */; count != 0; (void) --count, ++first)
+        {
+            if (PIKA_INVOKE(f, *first))
+            {
+                *first = value;
+            }
+        }
+        return first;
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/reverse.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    // The lanes of v in reverse order, the compiler turns this into a
+    // permutation of the register.
+    template <typename V>
+    PIKA_FORCEINLINE V vector_pack_reverse(V const& v)
+    {
+        using value_type = typename V::value_type;
+        return V([&](auto i) -> value_type {
+            return v[V::size() - 1 - decltype(i)::value];
+        });
+    }
+
+    struct datapar_reverse
+    {
+        template <typename T>
+        static void swap_n(T* first, T* last, std::size_t count)
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+            using load = traits::detail::vector_pack_load<V, T>;
+            using store = traits::detail::vector_pack_store<V, T>;
+            constexpr std::size_t size = V::size();
+
+            for (/**/; count >= size; count -= size)
+            {
+                last -= size;
+                V front = load::unaligned(first);
+                V back = load::unaligned(last);
+                back = vector_pack_reverse(back);
+                front = vector_pack_reverse(front);
+                store::unaligned(back, first);
+                store::unaligned(front, last);
+                first += size;
+            }
+
+            reverse_swap_n_t<pika::execution::sequenced_policy>{}(
+                first, last, count);
+        }
+
+        template <typename T>
+        static void copy_n(T const* last, std::size_t count, T* dest)
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+            using load = traits::detail::vector_pack_load<V, T>;
+            using store = traits::detail::vector_pack_store<V, T>;
+            constexpr std::size_t size = V::size();
+
+            for (/**/; count >= size; count -= size)
+            {
+                last -= size;
+                V value = vector_pack_reverse(load::unaligned(last));
+                store::unaligned(value, dest);
+                dest += size;
+            }
+
+            reverse_copy_n_t<pika::execution::sequenced_policy>{}(
+                last, count, dest);
+        }
+    };
+
+    template <typename ExPolicy, typename T,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                std::is_arithmetic_v<T>)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void tag_invoke(
+        reverse_swap_n_t<ExPolicy>, T* first, T* last, std::size_t count)
+    {
+        datapar_reverse::swap_n(first, last, count);
+    }
+
+    template <typename ExPolicy, typename T,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                std::is_arithmetic_v<T>)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void tag_invoke(
+        reverse_copy_n_t<ExPolicy>, T const* last, std::size_t count, T* dest)
+    {
+        datapar_reverse::copy_n(last, count, dest);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,211 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/scan.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The operations which are scanned in registers, together with their
+    // identity element. Other operations use the scalar kernels.
+    template <typename Op, typename T, typename Enable = void>
+    struct datapar_scan_op : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct datapar_scan_plus : std::true_type
+    {
+        using op_type = std::plus<>;
+
+        static constexpr T identity() noexcept
+        {
+            return T(0);
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_multiplies : std::true_type
+    {
+        using op_type = std::multiplies<>;
+
+        static constexpr T identity() noexcept
+        {
+            return T(1);
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::plus<>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>> : datapar_scan_plus<T>
+    {
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::plus<T>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>> : datapar_scan_plus<T>
+    {
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::multiplies<>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>> : datapar_scan_multiplies<T>
+    {
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::multiplies<T>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>> : datapar_scan_multiplies<T>
+    {
+    };
+
+    // The vectorized kernels need contiguous ranges of the same arithmetic
+    // type, an initial value of that type and one of the operations above.
+    template <typename InIter, typename OutIter, typename T, typename Op>
+    inline constexpr bool datapar_scan_compatible_v =
+        iterator_datapar_compatible<InIter>::value &&
+        iterator_datapar_compatible<OutIter>::value &&
+        std::is_same_v<typename std::iterator_traits<InIter>::value_type,
+            typename std::iterator_traits<OutIter>::value_type> &&
+        std::is_same_v<T, typename std::iterator_traits<InIter>::value_type> &&
+        datapar_scan_op<std::decay_t<Op>, T>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Op>
+    struct datapar_scan_helper
+    {
+        using V = typename traits::detail::vector_pack_type<T>::type;
+        using scan_op = datapar_scan_op<Op, T>;
+        using op_type = typename scan_op::op_type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        // Moves the lanes of v up by Shift, the lowest Shift lanes are set to
+        // the identity.
+        template <std::size_t Shift>
+        static V shift_lanes(V const& v)
+        {
+            return V([&](auto i) -> T {
+                if constexpr (decltype(i)::value >= Shift)
+                {
+                    return v[decltype(i)::value - Shift];
+                }
+                else
+                {
+                    return scan_op::identity();
+                }
+            });
+        }
+
+        // Replaces v by its inclusive scan in log2(size) shift and combine
+        // steps.
+        template <std::size_t Shift = 1>
+        static void scan_lanes(V& v)
+        {
+            if constexpr (Shift < size)
+            {
+                v = op_type{}(v, shift_lanes<Shift>(v));
+                scan_lanes<2 * Shift>(v);
+            }
+        }
+
+        template <typename InIter, typename OutIter>
+        static T inclusive(
+            InIter first, std::size_t count, OutIter dest, T init)
+        {
+            op_type op;
+            for (/**/; count >= size; count -= size)
+            {
+                V v = traits::detail::vector_pack_load<V, T>::unaligned(first);
+                scan_lanes(v);
+                v = op(V(init), v);
+                traits::detail::vector_pack_store<V, T>::unaligned(v, dest);
+                init = v[size - 1];
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first, ++dest)
+            {
+                init = op(init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+
+        template <typename InIter, typename OutIter>
+        static T exclusive(
+            InIter first, std::size_t count, OutIter dest, T init)
+        {
+            op_type op;
+            for (/**/; count >= size; count -= size)
+            {
+                V v = traits::detail::vector_pack_load<V, T>::unaligned(first);
+                scan_lanes(v);
+                T const last = v[size - 1];
+                v = op(V(init), shift_lanes<1>(v));
+                traits::detail::vector_pack_store<V, T>::unaligned(v, dest);
+                init = op(init, last);
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first, ++dest)
+            {
+                T temp = init;
+                init = op(init, *first);
+                *dest = temp;
+            }
+            return init;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_scan_compatible_v<InIter, OutIter, T, Op>)>
+    T tag_invoke(sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&&)
+    {
+        return datapar_scan_helper<T, std::decay_t<Op>>::inclusive(
+            first, count, dest, init);
+    }
+
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_scan_compatible_v<InIter, OutIter, T, Op>)>
+    T tag_invoke(sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&&)
+    {
+        return datapar_scan_helper<T, std::decay_t<Op>>::exclusive(
+            first, count, dest, init);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/search.hpp>
+#include <pika/parallel/datapar/mismatch.hpp>
+#include <pika/parallel/util/vector_pack_all_any_none.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The candidate positions are filtered a pack at a time by comparing the
+    // elements at them to the first element of the sequence searched for and
+    // the elements s_count - 1 positions further to its last one. Only the
+    // candidates passing both are compared in full, which for byte strings
+    // leaves very few of them.
+    template <typename Iter1, typename Iter2>
+    std::size_t datapar_search_n(Iter1 first, std::size_t count, Iter2 s_first,
+        std::size_t s_count)
+    {
+        using value_type = typename std::iterator_traits<Iter1>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        value_type const s_front = *s_first;
+        value_type const s_back = *std::next(s_first, s_count - 1);
+
+        // the elements in between the first and the last one
+        std::size_t const s_middle = s_count > 2 ? s_count - 2 : 0;
+        Iter2 const s_second = std::next(s_first, s_count > 1 ? 1 : 0);
+
+        Iter1 back = std::next(first, s_count - 1);
+
+        std::size_t i = 0;
+        if (count >= size)
+        {
+            V const front_pack(s_front);
+            V const back_pack(s_back);
+
+            for (/**/; count - i >= size; i += size)
+            {
+                V const v1 =
+                    traits::detail::vector_pack_load<V, value_type>::unaligned(
+                        first);
+                V const v2 =
+                    traits::detail::vector_pack_load<V, value_type>::unaligned(
+                        back);
+
+                auto const msk = (v1 == front_pack) && (v2 == back_pack);
+                if (traits::detail::any_of(msk))
+                {
+                    for (std::size_t j = 0; j != size; ++j)
+                    {
+                        if (msk[j] &&
+                            datapar_mismatch_n(std::next(first, j + 1),
+                                s_second, s_middle) == s_middle)
+                        {
+                            return i + j;
+                        }
+                    }
+                }
+
+                std::advance(first, size);
+                std::advance(back, size);
+            }
+        }
+
+        for (/**/; i != count; (void) ++i, ++first, ++back)
+        {
+            if (*first == s_front && *back == s_back &&
+                datapar_mismatch_n(std::next(first), s_second, s_middle) ==
+                    s_middle)
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F,
+        typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value &&
+            datapar_mismatch_compatible_v<Iter1, Iter2, F, Proj1, Proj2>)>
+    std::size_t tag_invoke(sequential_search_n_t<ExPolicy>, Iter1 first,
+        std::size_t count, Iter2 s_first, std::size_t s_count, F&&, Proj1&&,
+        Proj2&&)
+    {
+        return datapar_search_n(first, count, s_first, s_count);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -9,6 +9,7 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_HAVE_DATAPAR)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/executors/datapar/execution_policy.hpp>
 #include <pika/executors/execution_policy.hpp>
@@ -18,6 +19,7 @@
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/transform_loop.hpp>
+#include <pika/parallel/util/vector_pack_complex.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -83,6 +85,136 @@ namespace pika::parallel::detail {
         }
     };
 
+    // Processes whole packs without aligning the iterators first and the
+    // remaining elements with one masked pack, see
+    // pika::traits::datapar_tail_strategy.
+    template <typename Iterator, bool Ind = false>
+    struct datapar_transform_loop_n_masked
+    {
+        using iterator_type = std::decay_t<Iterator>;
+
+        typedef typename traits::detail::vector_pack_type<
+            typename std::iterator_traits<iterator_type>::value_type>::type V;
+
+        using invoke_type = std::conditional_t<Ind,
+            invoke_vectorized_inout1_ind<V>, invoke_vectorized_inout1<V>>;
+
+        template <typename InIter, typename OutIter, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static std::pair<InIter, OutIter>
+        call(InIter first, std::size_t count, OutIter dest, F&& f)
+        {
+            static constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            for (/* */; count >= size; count -= size)
+            {
+                invoke_type::call_unaligned(f, first, dest);
+            }
+
+            if (count != 0)
+            {
+                invoke_type::call_masked(f, first, dest, count);
+            }
+
+            return std::make_pair(PIKA_MOVE(first), PIKA_MOVE(dest));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Contiguous ranges of std::complex<float> or std::complex<double> are
+    // transformed in complex packs if f accepts them: the elements are
+    // deinterleaved into packs of their real and imaginary parts, and the
+    // results are interleaved again or, for real results like norm(z),
+    // stored lane by lane. The remaining elements are transformed in packs
+    // of one element. As in the other loops, f is invoked with pointers to
+    // the packs unless Ind is set.
+    template <bool Ind, typename Iter, typename CP>
+    using datapar_complex_argument_t = std::conditional_t<Ind, CP&, CP*>;
+
+    template <bool Ind, typename OutIter, typename F, typename... Iters>
+    constexpr bool is_datapar_complex_transform() noexcept
+    {
+        using value_type = typename std::iterator_traits<
+            std::tuple_element_t<0, std::tuple<Iters...>>>::value_type;
+        using out_type = typename std::iterator_traits<OutIter>::value_type;
+
+        if constexpr ((pika::detail::is_contiguous_iterator_v<Iters> && ...) &&
+            pika::detail::is_contiguous_iterator_v<OutIter> &&
+            traits::detail::is_vector_pack_complex_v<value_type> &&
+            (std::is_same_v<typename std::iterator_traits<Iters>::value_type,
+                 value_type> &&
+                ...) &&
+            (std::is_same_v<out_type, value_type> ||
+                std::is_arithmetic_v<out_type>))
+        {
+            using CP = traits::detail::complex_pack_type_t<value_type>;
+            using CP1 = traits::detail::complex_pack_type_t<value_type, 1>;
+            if constexpr (std::is_invocable_v<F&,
+                              datapar_complex_argument_t<Ind, Iters, CP>...> &&
+                std::is_invocable_v<F&,
+                    datapar_complex_argument_t<Ind, Iters, CP1>...>)
+            {
+                using result_type = std::invoke_result_t<F&,
+                    datapar_complex_argument_t<Ind, Iters, CP>...>;
+                return !traits::detail::is_complex_pack_v<
+                           std::decay_t<result_type>> ||
+                    std::is_same_v<out_type, value_type>;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template <bool Ind, typename CP, typename F, typename OutIter,
+        typename... Iters>
+    PIKA_FORCEINLINE void datapar_complex_transform_step(
+        F& f, std::size_t i, OutIter dest, Iters... its)
+    {
+        auto packs = std::make_tuple(traits::detail::complex_pack_load<CP>(
+            pika::detail::to_address(its) + i)...);
+        std::apply(
+            [&](auto&... pack) {
+                if constexpr (Ind)
+                {
+                    traits::detail::complex_pack_store(PIKA_INVOKE(f, pack...),
+                        pika::detail::to_address(dest) + i);
+                }
+                else
+                {
+                    traits::detail::complex_pack_store(
+                        PIKA_INVOKE(f, &pack...),
+                        pika::detail::to_address(dest) + i);
+                }
+            },
+            packs);
+    }
+
+    template <bool Ind, typename OutIter, typename F, typename... Iters>
+    PIKA_FORCEINLINE void datapar_complex_transform_loop_n(
+        std::size_t count, OutIter dest, F& f, Iters... its)
+    {
+        using value_type = typename std::iterator_traits<
+            std::tuple_element_t<0, std::tuple<Iters...>>>::value_type;
+        using CP = traits::detail::complex_pack_type_t<value_type>;
+        using CP1 = traits::detail::complex_pack_type_t<value_type, 1>;
+
+        std::size_t i = 0;
+        for (/**/; count - i >= CP::size(); i += CP::size())
+        {
+            datapar_complex_transform_step<Ind, CP>(f, i, dest, its...);
+        }
+        for (/**/; i != count; ++i)
+        {
+            datapar_complex_transform_step<Ind, CP1>(f, i, dest, its...);
+        }
+    }
+
     template <typename ExPolicy, typename Iter, typename OutIter, typename F>
     PIKA_HOST_DEVICE PIKA_FORCEINLINE typename std::enable_if<
         pika::is_vectorpack_execution_policy<ExPolicy>::value,
@@ -90,8 +222,35 @@ namespace pika::parallel::detail {
     tag_invoke(transform_loop_n_t<ExPolicy>, Iter it, std::size_t count,
         OutIter dest, F&& f)
     {
-        return datapar_transform_loop_n<Iter>::call(
-            it, count, dest, PIKA_FORWARD(F, f));
+        if constexpr (is_datapar_complex_transform<false, OutIter, F, Iter>())
+        {
+            datapar_complex_transform_loop_n<false>(count, dest, f, it);
+            std::advance(it, count);
+            std::advance(dest, count);
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+        }
+        else if constexpr (pika::detail::iterators_are_segmented_v<Iter,
+                               OutIter>)
+        {
+            // vectorize the blocks of segmented iterators one by one
+            return pika::detail::for_each_contiguous_segment(it, count, dest,
+                [&](auto* segment, std::size_t size, auto* dest_segment) {
+                    transform_loop_n_t<ExPolicy>{}(
+                        segment, size, dest_segment, f);
+                });
+        }
+        else if constexpr (iterators_datapar_compatible<Iter, OutIter>::value &&
+            iterator_datapar_compatible<OutIter>::value &&
+            datapar_masked_tail<ExPolicy, Iter>::value)
+        {
+            return datapar_transform_loop_n_masked<Iter>::call(
+                it, count, dest, PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            return datapar_transform_loop_n<Iter>::call(
+                it, count, dest, PIKA_FORWARD(F, f));
+        }
     }
 
     template <typename Iterator>
@@ -156,8 +315,34 @@ namespace pika::parallel::detail {
     tag_invoke(transform_loop_n_ind_t<ExPolicy>, Iter it, std::size_t count,
         OutIter dest, F&& f)
     {
-        return datapar_transform_loop_n_ind<Iter>::call(
-            it, count, dest, PIKA_FORWARD(F, f));
+        if constexpr (is_datapar_complex_transform<true, OutIter, F, Iter>())
+        {
+            datapar_complex_transform_loop_n<true>(count, dest, f, it);
+            std::advance(it, count);
+            std::advance(dest, count);
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+        }
+        else if constexpr (pika::detail::iterators_are_segmented_v<Iter,
+                               OutIter>)
+        {
+            return pika::detail::for_each_contiguous_segment(it, count, dest,
+                [&](auto* segment, std::size_t size, auto* dest_segment) {
+                    transform_loop_n_ind_t<ExPolicy>{}(
+                        segment, size, dest_segment, f);
+                });
+        }
+        else if constexpr (iterators_datapar_compatible<Iter, OutIter>::value &&
+            iterator_datapar_compatible<OutIter>::value &&
+            datapar_masked_tail<ExPolicy, Iter>::value)
+        {
+            return datapar_transform_loop_n_masked<Iter, true>::call(
+                it, count, dest, PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            return datapar_transform_loop_n_ind<Iter>::call(
+                it, count, dest, PIKA_FORWARD(F, f));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -174,9 +359,10 @@ namespace pika::parallel::detail {
 
         template <typename InIter, typename OutIter, typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter, OutIter>::value &&
+            (iterators_datapar_compatible<InIter, OutIter>::value &&
                 iterator_datapar_compatible<InIter>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<false, OutIter, F, InIter>(),
             std::pair<InIter, OutIter>>::type
         call(InIter first, InIter last, OutIter dest, F&& f)
         {
@@ -186,9 +372,10 @@ namespace pika::parallel::detail {
 
         template <typename InIter, typename OutIter, typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter, OutIter>::value ||
                 !iterator_datapar_compatible<InIter>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<false, OutIter, F, InIter>(),
             std::pair<InIter, OutIter>>::type
         call(InIter first, InIter last, OutIter dest, F&& f)
         {
@@ -235,9 +422,10 @@ namespace pika::parallel::detail {
 
         template <typename InIter, typename OutIter, typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter, OutIter>::value &&
+            (iterators_datapar_compatible<InIter, OutIter>::value &&
                 iterator_datapar_compatible<InIter>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<true, OutIter, F, InIter>(),
             std::pair<InIter, OutIter>>::type
         call(InIter first, InIter last, OutIter dest, F&& f)
         {
@@ -247,9 +435,10 @@ namespace pika::parallel::detail {
 
         template <typename InIter, typename OutIter, typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter, OutIter>::value ||
                 !iterator_datapar_compatible<InIter>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<true, OutIter, F, InIter>(),
             std::pair<InIter, OutIter>>::type
         call(InIter first, InIter last, OutIter dest, F&& f)
         {
@@ -351,6 +540,49 @@ namespace pika::parallel::detail {
         }
     };
 
+    template <typename Iter1, typename Iter2, bool Ind = false>
+    struct datapar_transform_binary_loop_n_masked
+    {
+        using iterator1_type = std::decay_t<Iter1>;
+        using iterator2_type = std::decay_t<Iter2>;
+
+        typedef typename std::iterator_traits<iterator1_type>::value_type
+            value1_type;
+        typedef typename std::iterator_traits<iterator2_type>::value_type
+            value2_type;
+
+        using V1 = typename traits::detail::vector_pack_type<value1_type>::type;
+        using V2 = typename traits::detail::vector_pack_type<value2_type>::type;
+
+        using invoke_type = std::conditional_t<Ind,
+            invoke_vectorized_inout2_ind<V1, V2>,
+            invoke_vectorized_inout2<V1, V2>>;
+
+        template <typename InIter1, typename InIter2, typename OutIter,
+            typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static std::tuple<InIter1, InIter2,
+            OutIter>
+        call(InIter1 first1, std::size_t count, InIter2 first2, OutIter dest,
+            F&& f)
+        {
+            static constexpr std::size_t size =
+                traits::detail::vector_pack_size<V1>::value;
+
+            for (/* */; count >= size; count -= size)
+            {
+                invoke_type::call_unaligned(f, first1, first2, dest);
+            }
+
+            if (count != 0)
+            {
+                invoke_type::call_masked(f, first1, first2, dest, count);
+            }
+
+            return std::make_tuple(
+                PIKA_MOVE(first1), PIKA_MOVE(first2), PIKA_MOVE(dest));
+        }
+    };
+
     template <typename ExPolicy, typename InIter1, typename InIter2,
         typename OutIter, typename F>
     PIKA_HOST_DEVICE PIKA_FORCEINLINE typename std::enable_if<
@@ -359,8 +591,32 @@ namespace pika::parallel::detail {
     tag_invoke(transform_binary_loop_n_t<ExPolicy>, InIter1 first1,
         std::size_t count, InIter2 first2, OutIter dest, F&& f)
     {
-        return datapar_transform_binary_loop_n<InIter1, InIter2>::call(
-            first1, count, first2, dest, PIKA_FORWARD(F, f));
+        if constexpr (is_datapar_complex_transform<false, OutIter, F, InIter1,
+                          InIter2>())
+        {
+            datapar_complex_transform_loop_n<false>(
+                count, dest, f, first1, first2);
+            std::advance(first1, count);
+            std::advance(first2, count);
+            std::advance(dest, count);
+            return std::make_tuple(
+                PIKA_MOVE(first1), PIKA_MOVE(first2), PIKA_MOVE(dest));
+        }
+        else if constexpr (iterators_datapar_compatible<InIter1,
+                               OutIter>::value &&
+            iterators_datapar_compatible<InIter2, OutIter>::value &&
+            iterator_datapar_compatible<InIter2>::value &&
+            iterator_datapar_compatible<OutIter>::value &&
+            datapar_masked_tail<ExPolicy, InIter1>::value)
+        {
+            return datapar_transform_binary_loop_n_masked<InIter1,
+                InIter2>::call(first1, count, first2, dest, PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            return datapar_transform_binary_loop_n<InIter1, InIter2>::call(
+                first1, count, first2, dest, PIKA_FORWARD(F, f));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -386,11 +642,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter1, OutIter>::value &&
+            (iterators_datapar_compatible<InIter1, OutIter>::value &&
                 iterators_datapar_compatible<InIter2, OutIter>::value &&
                 iterator_datapar_compatible<InIter1>::value &&
                 iterator_datapar_compatible<InIter2>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<false, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest, F&& f)
         {
@@ -406,11 +664,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter1, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter1, OutIter>::value ||
                 !iterators_datapar_compatible<InIter2, OutIter>::value ||
                 !iterator_datapar_compatible<InIter1>::value ||
                 !iterator_datapar_compatible<InIter2>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<false, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest, F&& f)
         {
@@ -421,11 +681,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter1, OutIter>::value &&
+            (iterators_datapar_compatible<InIter1, OutIter>::value &&
                 iterators_datapar_compatible<InIter2, OutIter>::value &&
                 iterator_datapar_compatible<InIter1>::value &&
                 iterator_datapar_compatible<InIter2>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<false, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
             OutIter dest, F&& f)
@@ -447,11 +709,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter1, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter1, OutIter>::value ||
                 !iterators_datapar_compatible<InIter2, OutIter>::value ||
                 !iterator_datapar_compatible<InIter1>::value ||
                 !iterator_datapar_compatible<InIter2>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<false, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
             OutIter dest, F&& f)
@@ -561,8 +825,32 @@ namespace pika::parallel::detail {
     tag_invoke(transform_binary_loop_ind_n_t<ExPolicy>, InIter1 first1,
         std::size_t count, InIter2 first2, OutIter dest, F&& f)
     {
-        return datapar_transform_binary_loop_ind_n<InIter1, InIter2>::call(
-            first1, count, first2, dest, PIKA_FORWARD(F, f));
+        if constexpr (is_datapar_complex_transform<true, OutIter, F, InIter1,
+                          InIter2>())
+        {
+            datapar_complex_transform_loop_n<true>(
+                count, dest, f, first1, first2);
+            std::advance(first1, count);
+            std::advance(first2, count);
+            std::advance(dest, count);
+            return std::make_tuple(
+                PIKA_MOVE(first1), PIKA_MOVE(first2), PIKA_MOVE(dest));
+        }
+        else if constexpr (iterators_datapar_compatible<InIter1,
+                               OutIter>::value &&
+            iterators_datapar_compatible<InIter2, OutIter>::value &&
+            iterator_datapar_compatible<InIter2>::value &&
+            iterator_datapar_compatible<OutIter>::value &&
+            datapar_masked_tail<ExPolicy, InIter1>::value)
+        {
+            return datapar_transform_binary_loop_n_masked<InIter1, InIter2,
+                true>::call(first1, count, first2, dest, PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            return datapar_transform_binary_loop_ind_n<InIter1, InIter2>::call(
+                first1, count, first2, dest, PIKA_FORWARD(F, f));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -588,11 +876,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter1, OutIter>::value &&
+            (iterators_datapar_compatible<InIter1, OutIter>::value &&
                 iterators_datapar_compatible<InIter2, OutIter>::value &&
                 iterator_datapar_compatible<InIter1>::value &&
                 iterator_datapar_compatible<InIter2>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<true, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest, F&& f)
         {
@@ -608,11 +898,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter1, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter1, OutIter>::value ||
                 !iterators_datapar_compatible<InIter2, OutIter>::value ||
                 !iterator_datapar_compatible<InIter1>::value ||
                 !iterator_datapar_compatible<InIter2>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<true, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest, F&& f)
         {
@@ -623,11 +915,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            iterators_datapar_compatible<InIter1, OutIter>::value &&
+            (iterators_datapar_compatible<InIter1, OutIter>::value &&
                 iterators_datapar_compatible<InIter2, OutIter>::value &&
                 iterator_datapar_compatible<InIter1>::value &&
                 iterator_datapar_compatible<InIter2>::value &&
-                iterator_datapar_compatible<OutIter>::value,
+                iterator_datapar_compatible<OutIter>::value) ||
+                is_datapar_complex_transform<true, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
             OutIter dest, F&& f)
@@ -646,11 +940,13 @@ namespace pika::parallel::detail {
         template <typename InIter1, typename InIter2, typename OutIter,
             typename F>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE static typename std::enable_if<
-            !iterators_datapar_compatible<InIter1, OutIter>::value ||
+            (!iterators_datapar_compatible<InIter1, OutIter>::value ||
                 !iterators_datapar_compatible<InIter2, OutIter>::value ||
                 !iterator_datapar_compatible<InIter1>::value ||
                 !iterator_datapar_compatible<InIter2>::value ||
-                !iterator_datapar_compatible<OutIter>::value,
+                !iterator_datapar_compatible<OutIter>::value) &&
+                !is_datapar_complex_transform<true, OutIter, F, InIter1,
+                    InIter2>(),
             in_in_out_result<InIter1, InIter2, OutIter>>::type
         call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
             OutIter dest, F&& f)
@@ -0,0 +1,406 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/dot_product.hpp>
+#include <pika/parallel/algorithms/detail/widening_reduce.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_complex.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_reduce.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The reductions are vectorized if all of them produce values of the
+    // value type of the sequence, such that the elements, the converted
+    // values and the accumulators are packs of the same type.
+    template <typename Iter, typename... Rs>
+    inline constexpr bool is_datapar_transform_reduce_multi_compatible_v =
+        iterator_datapar_compatible<Iter>::value &&
+        (std::is_same_v<typename Rs::result_type,
+             typename std::iterator_traits<Iter>::value_type> &&
+            ...);
+
+    // Fold a single element into the partial results, the functions are
+    // invoked with packs of one element as in the other datapar loops.
+    template <typename Iter, typename... Rs, typename... Ts,
+        std::size_t... Is>
+    PIKA_FORCEINLINE void datapar_transform_reduce_multi_step(Iter& it,
+        std::tuple<Rs...>& reductions, std::tuple<Ts...>& acc,
+        std::index_sequence<Is...>)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V1 = typename traits::detail::vector_pack_type<value_type, 1>::type;
+
+        V1 tmp(traits::detail::vector_pack_load<V1, value_type>::aligned(it));
+        ((std::get<Is>(acc) =
+                 value_type(V1(PIKA_INVOKE(std::get<Is>(reductions).reduce_,
+                     V1(std::get<Is>(acc)),
+                     PIKA_INVOKE(std::get<Is>(reductions).convert_, tmp)))[0])),
+            ...);
+        ++it;
+    }
+
+    // Each reduction accumulates a pack of partial results (one per lane),
+    // seeded from the first pack of elements. The lanes are folded into
+    // the partial results at the end.
+    template <typename ExPolicy, typename Iter, typename... Rs, typename... Ts,
+        std::size_t... Is>
+    void datapar_transform_reduce_multi(Iter first, std::size_t count,
+        std::tuple<Rs...>& reductions, std::tuple<Ts...>& acc,
+        std::index_sequence<Is...> is)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        // run single elements until the data is aligned
+        while (count != 0 && !is_data_aligned(first))
+        {
+            datapar_transform_reduce_multi_step(first, reductions, acc, is);
+            --count;
+        }
+
+        if (count >= size)
+        {
+            V tmp(traits::detail::vector_pack_load<V, value_type>::aligned(
+                first));
+            std::array<V, sizeof...(Rs)> lanes = {
+                V(PIKA_INVOKE(std::get<Is>(reductions).convert_, tmp))...};
+            std::advance(first, size);
+            count -= size;
+
+            for (/* */; count >= size; count -= size)
+            {
+                tmp = traits::detail::vector_pack_load<V, value_type>::aligned(
+                    first);
+                ((lanes[Is] = V(PIKA_INVOKE(std::get<Is>(reductions).reduce_,
+                      lanes[Is],
+                      PIKA_INVOKE(std::get<Is>(reductions).convert_, tmp)))),
+                    ...);
+                std::advance(first, size);
+            }
+
+            ((std::get<Is>(acc) = extract_value<ExPolicy>(
+                  accumulate_values<ExPolicy>(std::get<Is>(reductions).reduce_,
+                      lanes[Is], std::get<Is>(acc)))),
+                ...);
+        }
+
+        for (/* */; count != 0; --count)
+        {
+            datapar_transform_reduce_multi_step(first, reductions, acc, is);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename... Rs,
+        typename... Ts>
+    PIKA_FORCEINLINE typename std::enable_if<
+        pika::is_vectorpack_execution_policy<ExPolicy>::value>::type
+    tag_invoke(transform_reduce_multi_chunk_t<ExPolicy>, Iter first,
+        std::size_t count, std::tuple<Rs...>& reductions,
+        std::tuple<Ts...>& acc)
+    {
+        if constexpr (is_datapar_transform_reduce_multi_compatible_v<Iter,
+                          Rs...>)
+        {
+            datapar_transform_reduce_multi<ExPolicy>(first, count, reductions,
+                acc, std::index_sequence_for<Rs...>());
+        }
+        else
+        {
+            sequential_transform_reduce_multi(first, count, reductions, acc,
+                std::index_sequence_for<Rs...>());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The products are accumulated into independent packs to hide the
+    // latency of the multiply-adds, which the compiler fuses if the target
+    // supports it. The sequences are not aligned relative to each other in
+    // general, the elements are loaded unaligned.
+    template <typename T>
+    T datapar_dot_product_n(
+        T const* first1, T const* first2, std::size_t count) noexcept
+    {
+        using V = typename traits::detail::vector_pack_type<T>::type;
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+        static constexpr std::size_t n = dot_product_num_accumulators;
+
+        std::array<V, n> acc;
+        acc.fill(V(T(0)));
+
+        std::size_t i = 0;
+        for (/**/; count - i >= n * size; i += n * size)
+        {
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                V const v1 = traits::detail::vector_pack_load<V, T>::unaligned(
+                    first1 + i + j * size);
+                V const v2 = traits::detail::vector_pack_load<V, T>::unaligned(
+                    first2 + i + j * size);
+                acc[j] = v1 * v2 + acc[j];
+            }
+        }
+
+        for (/**/; count - i >= size; i += size)
+        {
+            V const v1 =
+                traits::detail::vector_pack_load<V, T>::unaligned(first1 + i);
+            V const v2 =
+                traits::detail::vector_pack_load<V, T>::unaligned(first2 + i);
+            acc[0] = v1 * v2 + acc[0];
+        }
+
+        for (std::size_t k = n / 2; k != 0; k /= 2)
+        {
+            for (std::size_t j = 0; j != k; ++j)
+            {
+                acc[j] = acc[j] + acc[j + k];
+            }
+        }
+
+        T result = traits::detail::reduce(acc[0], std::plus<>());
+        for (/**/; i != count; ++i)
+        {
+            result = fused_multiply_add(first1[i], first2[i], result);
+        }
+        return result;
+    }
+
+    // The complex elements are deinterleaved into packs of their real and
+    // imaginary parts, such that the products are computed with whole packs
+    // of the real type.
+    template <typename T>
+    T datapar_complex_dot_product_n(
+        T const* first1, T const* first2, std::size_t count) noexcept
+    {
+        using CP = traits::detail::complex_pack_type_t<T>;
+        static constexpr std::size_t size = CP::size();
+        static constexpr std::size_t n = dot_product_num_accumulators / 2;
+
+        std::array<CP, n> acc;
+        acc.fill(CP(T()));
+
+        std::size_t i = 0;
+        for (/**/; count - i >= n * size; i += n * size)
+        {
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                acc[j] += traits::detail::complex_pack_load<CP>(
+                              first1 + i + j * size) *
+                    traits::detail::complex_pack_load<CP>(
+                        first2 + i + j * size);
+            }
+        }
+
+        for (/**/; count - i >= size; i += size)
+        {
+            acc[0] += traits::detail::complex_pack_load<CP>(first1 + i) *
+                traits::detail::complex_pack_load<CP>(first2 + i);
+        }
+
+        for (std::size_t k = n / 2; k != 0; k /= 2)
+        {
+            for (std::size_t j = 0; j != k; ++j)
+            {
+                acc[j] += acc[j + k];
+            }
+        }
+
+        T result = traits::detail::reduce_sum(acc[0]);
+        for (/**/; i != count; ++i)
+        {
+            result += first1[i] * first2[i];
+        }
+        return result;
+    }
+
+    template <typename ExPolicy, typename T>
+    PIKA_FORCEINLINE typename std::enable_if<
+        pika::is_vectorpack_execution_policy<ExPolicy>::value, T>::type
+    tag_invoke(dot_product_n_t<ExPolicy>, T const* first1, T const* first2,
+        std::size_t count) noexcept
+    {
+        if constexpr (traits::detail::is_vector_pack_complex_v<T>)
+        {
+            return datapar_complex_dot_product_n(first1, first2, count);
+        }
+        else
+        {
+            return datapar_dot_product_n(first1, first2, count);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are converted to packs of the accumulator type while they
+    // are loaded, such that conv is applied to and the results are
+    // accumulated at the precision of T. Independent packs of partial
+    // results hide the latency of the operation, they are seeded from the
+    // first elements as the operations have no common identity.
+    inline constexpr std::size_t widening_reduce_num_accumulators = 4;
+
+    template <typename Iter, typename T, typename Reduce, typename Convert>
+    T datapar_widening_reduce_n(
+        Iter first, std::size_t count, T init, Reduce& r, Convert& conv)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::detail::vector_pack_type<T>::type;
+        using op = typename widening_reduce_op<std::decay_t<Reduce>, T>::type;
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+        static constexpr std::size_t n = widening_reduce_num_accumulators;
+
+        auto const* p = pika::detail::to_address(first);
+        auto load = [&](std::size_t i) {
+            return V(PIKA_INVOKE(conv,
+                traits::detail::vector_pack_load<V, value_type>::unaligned(
+                    p + i)));
+        };
+
+        std::size_t i = 0;
+        if (count >= n * size)
+        {
+            std::array<V, n> acc;
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                acc[j] = load(j * size);
+            }
+
+            for (i = n * size; count - i >= n * size; i += n * size)
+            {
+                for (std::size_t j = 0; j != n; ++j)
+                {
+                    acc[j] = V(op{}(acc[j], load(i + j * size)));
+                }
+            }
+
+            for (std::size_t k = n / 2; k != 0; k /= 2)
+            {
+                for (std::size_t j = 0; j != k; ++j)
+                {
+                    acc[j] = V(op{}(acc[j], acc[j + k]));
+                }
+            }
+            init = PIKA_INVOKE(r, init, traits::detail::reduce(acc[0], op{}));
+        }
+
+        for (/**/; i != count; ++i)
+        {
+            init = PIKA_INVOKE(r, init, T(PIKA_INVOKE(conv, T(p[i]))));
+        }
+        return init;
+    }
+
+    // The sums of complex elements are accumulated in complex packs, conv is
+    // invoked with the deinterleaved elements and has to return complex
+    // packs as well.
+    template <typename Iter, typename T, typename Reduce, typename Convert>
+    T datapar_complex_reduce_n(
+        Iter first, std::size_t count, T init, Reduce& r, Convert& conv)
+    {
+        using CP = traits::detail::complex_pack_type_t<T>;
+        static constexpr std::size_t size = CP::size();
+        static constexpr std::size_t n = widening_reduce_num_accumulators;
+
+        T const* p = pika::detail::to_address(first);
+        auto load = [&](std::size_t i) {
+            return CP(PIKA_INVOKE(
+                conv, traits::detail::complex_pack_load<CP>(p + i)));
+        };
+
+        std::size_t i = 0;
+        if (count >= n * size)
+        {
+            std::array<CP, n> acc;
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                acc[j] = load(j * size);
+            }
+
+            for (i = n * size; count - i >= n * size; i += n * size)
+            {
+                for (std::size_t j = 0; j != n; ++j)
+                {
+                    acc[j] += load(i + j * size);
+                }
+            }
+
+            for (std::size_t k = n / 2; k != 0; k /= 2)
+            {
+                for (std::size_t j = 0; j != k; ++j)
+                {
+                    acc[j] += acc[j + k];
+                }
+            }
+            init = PIKA_INVOKE(r, init, traits::detail::reduce_sum(acc[0]));
+        }
+
+        for (/**/; i != count; ++i)
+        {
+            init = PIKA_INVOKE(r, init, T(PIKA_INVOKE(conv, p[i])));
+        }
+        return init;
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Convert>
+    PIKA_FORCEINLINE typename std::enable_if<
+        pika::is_vectorpack_execution_policy<ExPolicy>::value, T>::type
+    tag_invoke(widening_reduce_n_t<ExPolicy> tag, Iter first,
+        std::size_t count, T init, Reduce& r, Convert& conv)
+    {
+        // conversions which do not accept packs are applied element-wise
+        if constexpr (traits::detail::is_vector_pack_complex_v<T>)
+        {
+            using CP = traits::detail::complex_pack_type_t<T>;
+            if constexpr (std::is_invocable_r_v<CP, Convert&, CP>)
+            {
+                return datapar_complex_reduce_n(first, count, init, r, conv);
+            }
+            else
+            {
+                return tag_fallback_invoke(tag, first, count, init, r, conv);
+            }
+        }
+        else
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+            if constexpr (std::is_invocable_v<Convert&, V>)
+            {
+                return datapar_widening_reduce_n(
+                    first, count, init, r, conv);
+            }
+            else
+            {
+                return tag_fallback_invoke(tag, first, count, init, r, conv);
+            }
+        }
+    }
+}    // namespace pika::parallel::detail
+#endif
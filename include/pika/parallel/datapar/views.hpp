@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/container_algorithms/views.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    // The packs of the views are computed or gathered, they need not be
+    // aligned. This leaves the peeling of a zip_iterator to its contiguous
+    // components.
+    template <typename Iter, typename F>
+    struct is_data_aligned_impl<pika::util::transformed_iterator<Iter, F>>
+    {
+        static PIKA_FORCEINLINE bool call(
+            pika::util::transformed_iterator<Iter, F> const&)
+        {
+            return true;
+        }
+    };
+
+    template <typename Iter>
+    struct is_data_aligned_impl<pika::util::strided_iterator<Iter>>
+    {
+        static PIKA_FORCEINLINE bool call(
+            pika::util::strided_iterator<Iter> const&)
+        {
+            return true;
+        }
+    };
+
+    template <typename T>
+    struct is_data_aligned_impl<pika::util::iota_iterator<T>>
+    {
+        static PIKA_FORCEINLINE bool call(pika::util::iota_iterator<T> const&)
+        {
+            return true;
+        }
+    };
+}    // namespace pika::parallel::detail
+
+namespace pika::parallel::traits::detail {
+    template <typename Iter, typename F>
+    struct vector_pack_gather_access<pika::util::transformed_iterator<Iter, F>,
+        std::enable_if_t<pika::traits::is_random_access_iterator_v<Iter>>>
+      : std::true_type
+    {
+    };
+
+    template <typename Iter>
+    struct vector_pack_gather_access<pika::util::strided_iterator<Iter>>
+      : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_gather_access<pika::util::iota_iterator<T>>
+      : std::true_type
+    {
+    };
+
+    // A pack of a transformed view is computed by invoking the function with
+    // the pack of the base elements if those are contiguous (or gathered)
+    // elements of the same type and the function maps such packs to packs.
+    // Otherwise, the function is invoked lane by lane.
+    template <typename Iter, typename F>
+    struct vector_pack_gather_impl<pika::util::transformed_iterator<Iter, F>>
+    {
+        template <typename V>
+        static V call(pika::util::transformed_iterator<Iter, F> const& iter,
+            std::size_t count)
+        {
+            using base_value_type =
+                typename std::iterator_traits<Iter>::value_type;
+
+            if constexpr (std::is_same_v<base_value_type,
+                              typename V::value_type> &&
+                parallel::detail::iterator_datapar_compatible<Iter>::value &&
+                (pika::detail::is_contiguous_iterator_v<Iter> ||
+                    vector_pack_gather_access<Iter>::value) &&
+                std::is_invocable_r_v<V, F const&, V const&>)
+            {
+                using load = vector_pack_load<V, base_value_type>;
+                V const base = count == V::size() ?
+                    load::unaligned(iter.base()) :
+                    load::masked(iter.base(), count);
+                return PIKA_INVOKE(iter.function(), base);
+            }
+            else
+            {
+                using value_type = typename V::value_type;
+                return V([&](auto i) -> value_type {
+                    return decltype(i)::value < count ?
+                        iter[decltype(i)::value] :
+                        *iter;
+                });
+            }
+        }
+    };
+}    // namespace pika::parallel::traits::detail
+#endif
@@ -83,6 +83,17 @@ namespace pika::parallel::traits::detail {
                 unaligned(std::get<Is>(t))...);
     }
 
+    template <typename Tuple, typename... Iter, std::size_t... Is>
+    Tuple masked_pack(pika::util::zip_iterator<Iter...> const& iter,
+        std::size_t count, pika::util::detail::index_pack<Is...>)
+    {
+        auto const& t = iter.get_iterator_tuple();
+        return std::make_tuple(
+            vector_pack_load<typename std::tuple_element<Is, Tuple>::type,
+                typename std::iterator_traits<Iter>::value_type>::
+                masked(std::get<Is>(t), count)...);
+    }
+
     template <typename... Vector, typename ValueType>
     struct vector_pack_load<std::tuple<Vector...>, ValueType>
     {
@@ -102,6 +113,14 @@ namespace pika::parallel::traits::detail {
             return traits::detail::unaligned_pack<value_type>(
                 iter, pika::util::detail::make_index_pack<sizeof...(Iter)>());
         }
+
+        template <typename... Iter>
+        static value_type masked(
+            pika::util::zip_iterator<Iter...> const& iter, std::size_t count)
+        {
+            return traits::detail::masked_pack<value_type>(iter, count,
+                pika::util::detail::make_index_pack_t<sizeof...(Iter)>());
+        }
     };
 
     template <typename Tuple, typename... Iter, std::size_t... Is>
@@ -132,6 +151,18 @@ namespace pika::parallel::traits::detail {
         (void) sequencer;
     }
 
+    template <typename Tuple, typename... Iter, std::size_t... Is>
+    void masked_pack(Tuple& value,
+        pika::util::zip_iterator<Iter...> const& iter, std::size_t count,
+        pika::util::detail::index_pack<Is...>)
+    {
+        auto const& t = iter.get_iterator_tuple();
+        (vector_pack_store<typename std::tuple_element<Is, Tuple>::type,
+             typename std::iterator_traits<Iter>::value_type>::
+                masked(std::get<Is>(value), std::get<Is>(t), count),
+            ...);
+    }
+
     template <typename... Vector, typename ValueType>
     struct vector_pack_store<std::tuple<Vector...>, ValueType>
     {
@@ -150,6 +181,22 @@ namespace pika::parallel::traits::detail {
             traits::detail::unaligned_pack(value, iter,
                 pika::util::detail::make_index_pack<sizeof...(Iter)>());
         }
+
+        template <typename V, typename... Iter>
+        static void masked(V& value,
+            pika::util::zip_iterator<Iter...> const& iter, std::size_t count)
+        {
+            traits::detail::masked_pack(value, iter, count,
+                pika::util::detail::make_index_pack_t<sizeof...(Iter)>());
+        }
+    };
+
+    // The tuples of packs of a zip_iterator are accessed with masks if all
+    // of their packs are.
+    template <typename... Vector>
+    struct vector_pack_has_masked_access<std::tuple<Vector...>>
+      : pika::util::detail::all_of<vector_pack_has_masked_access<Vector>...>
+    {
     };
 }    // namespace pika::parallel::traits::detail
 
@@ -0,0 +1,270 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/device_policy.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+// The policy is only available when compiling with the CUDA or HIP compiler
+#if defined(PIKA_HAVE_GPU_SUPPORT) && defined(PIKA_COMPUTE_CODE)
+#include <pika/cuda.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/algorithms/exclusive_scan.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/inclusive_scan.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/util/detail/device_partitioner.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Execution policy for running an algorithm as kernels on a CUDA or
+    /// HIP device. The ranges are given as device pointers, the function
+    /// objects have to be callable on the device. The algorithms return a
+    /// sender which completes once the kernels have completed on the
+    /// stream of the \a cuda_scheduler of the policy, the scratch memory of
+    /// the kernels is released then. The completion is detected by polling,
+    /// which has to be enabled through
+    /// pika::cuda::experimental::enable_user_polling.
+    ///
+    /// \a for_each and \a transform launch one thread per element, \a reduce
+    /// and \a transform_reduce reduce in two passes, \a inclusive_scan and
+    /// \a exclusive_scan run a single pass scan with decoupled look-back and
+    /// \a sort a stable radix sort of arithmetic keys. The values reduced
+    /// and scanned have to be trivially copyable.
+    ///
+    /// Every policy runs on the device of its scheduler. The devices of a
+    /// node are used together through one policy per device, e.g. with
+    /// device_policy(cuda_scheduler(cuda_pool(device))).
+    ///
+    /// \note The policy is experimental.
+    ///
+    class device_policy
+    {
+    public:
+        explicit device_policy(
+            pika::cuda::experimental::cuda_scheduler scheduler)
+          : scheduler_(PIKA_MOVE(scheduler))
+        {
+        }
+
+        pika::cuda::experimental::cuda_scheduler const& scheduler()
+            const noexcept
+        {
+            return scheduler_;
+        }
+
+    private:
+        pika::cuda::experimental::cuda_scheduler scheduler_;
+    };
+}    // namespace pika::execution
+
+namespace pika::detail {
+    // Runs f(args..., stream) on the stream of the scheduler of policy. f
+    // returns the scratch memory (and result) of the kernels it launches,
+    // which is passed on to the continuation once they have completed.
+    template <typename F, typename Then, typename... Ts>
+    auto device_launch(pika::execution::device_policy const& policy, F&& f,
+        Then&& then, Ts... ts)
+    {
+        namespace ex = pika::execution::experimental;
+        namespace cu = pika::cuda::experimental;
+
+        auto sender = cu::then_with_stream(
+            ex::transfer_just(policy.scheduler(), PIKA_MOVE(ts)...),
+            PIKA_FORWARD(F, f));
+        return ex::then(PIKA_MOVE(sender), PIKA_FORWARD(Then, then));
+    }
+}    // namespace pika::detail
+
+namespace pika {
+    // The algorithms called with a device_policy. These overloads take
+    // precedence over the generic implementations, which rely on
+    // tag_fallback_invoke.
+
+    template <typename T, typename F>
+    auto tag_invoke(pika::for_each_t,
+        pika::execution::device_policy const& policy, T* first, T* last, F f)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, F f, cudaStream_t stream) {
+                parallel::detail::device_bulk(stream, last - first,
+                    parallel::detail::device_for_each_body<T, F>{
+                        first, PIKA_MOVE(f)});
+                return parallel::detail::device_buffer();
+            },
+            [](parallel::detail::device_buffer) {}, first, last, PIKA_MOVE(f));
+    }
+
+    template <typename T, typename U, typename F>
+    auto tag_invoke(pika::transform_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest, F f)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U* dest, F f, cudaStream_t stream) {
+                parallel::detail::device_bulk(stream, last - first,
+                    parallel::detail::device_transform_body<T, U, F>{
+                        first, dest, PIKA_MOVE(f)});
+                return parallel::detail::device_buffer();
+            },
+            [dest_last = dest + (last - first)](
+                parallel::detail::device_buffer) { return dest_last; },
+            first, last, dest, PIKA_MOVE(f));
+    }
+
+    template <typename T, typename U, typename Op>
+    auto tag_invoke(pika::reduce_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U init, Op op)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U init, Op op, cudaStream_t stream) {
+                return parallel::detail::device_reduce(stream, last - first,
+                    parallel::detail::device_load<T>{first}, PIKA_MOVE(init),
+                    PIKA_MOVE(op));
+            },
+            [](parallel::detail::device_value<U> result) {
+                return *result.value;
+            },
+            first, last, PIKA_MOVE(init), PIKA_MOVE(op));
+    }
+
+    template <typename T, typename U>
+    auto tag_invoke(pika::reduce_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U init)
+    {
+        return pika::reduce(policy, first, last, PIKA_MOVE(init),
+            parallel::detail::device_plus{});
+    }
+
+    template <typename T>
+    auto tag_invoke(pika::reduce_t,
+        pika::execution::device_policy const& policy, T* first, T* last)
+    {
+        return pika::reduce(policy, first, last, std::remove_cv_t<T>(),
+            parallel::detail::device_plus{});
+    }
+
+    template <typename T, typename U, typename Reduce, typename Convert>
+    auto tag_invoke(pika::transform_reduce_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U init, Reduce red_op, Convert conv_op)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U init, Reduce red_op, Convert conv_op,
+                cudaStream_t stream) {
+                return parallel::detail::device_reduce(stream, last - first,
+                    parallel::detail::device_transform_load<T, Convert>{
+                        first, PIKA_MOVE(conv_op)},
+                    PIKA_MOVE(init), PIKA_MOVE(red_op));
+            },
+            [](parallel::detail::device_value<U> result) {
+                return *result.value;
+            },
+            first, last, PIKA_MOVE(init), PIKA_MOVE(red_op),
+            PIKA_MOVE(conv_op));
+    }
+
+    template <typename T, typename U, typename Op>
+    auto tag_invoke(pika::inclusive_scan_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest, Op op)
+    {
+        using value_type = std::remove_cv_t<T>;
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U* dest, Op op, cudaStream_t stream) {
+                return parallel::detail::device_scan<false, false>(stream,
+                    last - first, parallel::detail::device_load<T>{first},
+                    dest, value_type(), PIKA_MOVE(op));
+            },
+            [dest_last = dest + (last - first)](
+                parallel::detail::device_buffer) { return dest_last; },
+            first, last, dest, PIKA_MOVE(op));
+    }
+
+    template <typename T, typename U, typename Op, typename V>
+    auto tag_invoke(pika::inclusive_scan_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest, Op op, V init)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U* dest, Op op, V init,
+                cudaStream_t stream) {
+                return parallel::detail::device_scan<false, true>(stream,
+                    last - first, parallel::detail::device_load<T>{first},
+                    dest, PIKA_MOVE(init), PIKA_MOVE(op));
+            },
+            [dest_last = dest + (last - first)](
+                parallel::detail::device_buffer) { return dest_last; },
+            first, last, dest, PIKA_MOVE(op), PIKA_MOVE(init));
+    }
+
+    template <typename T, typename U>
+    auto tag_invoke(pika::inclusive_scan_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest)
+    {
+        return pika::inclusive_scan(
+            policy, first, last, dest, parallel::detail::device_plus{});
+    }
+
+    template <typename T, typename U, typename V, typename Op>
+    auto tag_invoke(pika::exclusive_scan_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest, V init, Op op)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, U* dest, V init, Op op,
+                cudaStream_t stream) {
+                return parallel::detail::device_scan<true, true>(stream,
+                    last - first, parallel::detail::device_load<T>{first},
+                    dest, PIKA_MOVE(init), PIKA_MOVE(op));
+            },
+            [dest_last = dest + (last - first)](
+                parallel::detail::device_buffer) { return dest_last; },
+            first, last, dest, PIKA_MOVE(init), PIKA_MOVE(op));
+    }
+
+    template <typename T, typename U, typename V>
+    auto tag_invoke(pika::exclusive_scan_t,
+        pika::execution::device_policy const& policy, T* first, T* last,
+        U* dest, V init)
+    {
+        return pika::exclusive_scan(policy, first, last, dest,
+            PIKA_MOVE(init), parallel::detail::device_plus{});
+    }
+
+    template <typename T>
+    auto tag_invoke(pika::sort_t, pika::execution::device_policy const& policy,
+        T* first, T* last)
+    {
+        return detail::device_launch(
+            policy,
+            [](T* first, T* last, cudaStream_t stream) {
+                return parallel::detail::device_radix_sort(
+                    stream, first, last - first);
+            },
+            [](parallel::detail::device_buffer) {}, first, last);
+    }
+}    // namespace pika
+#endif
@@ -0,0 +1,266 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/device_streaming_policy.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+// The policy is only available when compiling with the CUDA or HIP compiler
+#if defined(PIKA_HAVE_GPU_SUPPORT) && defined(PIKA_COMPUTE_CODE)
+#include <pika/cuda.hpp>
+#include <pika/execution.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/device_policy.hpp>
+#include <pika/parallel/util/detail/device_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Execution policy for running an algorithm on a device over a range in
+    /// (pageable) host memory which does not have to fit into the memory of
+    /// the device. The range is streamed through the device in chunks: every
+    /// one of \a num_buffers staging buffers copies a chunk into page-locked
+    /// memory, to the device, runs the kernel and copies the results back,
+    /// using its own stream of the \a cuda_scheduler. The buffers work on
+    /// different chunks at the same time, the copy of one chunk to the
+    /// device overlaps with the kernel of the previous one and the copy back
+    /// of the one before.
+    ///
+    /// \a for_each and \a transform support the policy, they return a sender
+    /// which completes once all chunks have been copied back. The elements
+    /// have to be trivially copyable, the function objects callable on the
+    /// device. The device memory used is about num_buffers times the chunk
+    /// size times the size of the input and output elements.
+    ///
+    /// \note The policy is experimental.
+    ///
+    class device_streaming_policy
+    {
+    public:
+        /// The chunks have 16 MiB by default.
+        static constexpr std::size_t default_chunk_bytes = std::size_t(1)
+            << 24;
+
+        /// Construct the policy running its chunks on \a device. The chunks
+        /// have \a chunk_size elements, a chunk size of 0 selects chunks of
+        /// about default_chunk_bytes.
+        explicit device_streaming_policy(device_policy device,
+            std::size_t chunk_size = 0, std::size_t num_buffers = 3)
+          : device_(PIKA_MOVE(device))
+          , chunk_size_(chunk_size)
+          , num_buffers_((std::max)(num_buffers, std::size_t(1)))
+        {
+        }
+
+        device_policy const& device() const noexcept
+        {
+            return device_;
+        }
+
+        /// The number of elements of the chunks of elements of type T.
+        template <typename T>
+        std::size_t chunk_size() const noexcept
+        {
+            return chunk_size_ != 0 ?
+                chunk_size_ :
+                (std::max)(default_chunk_bytes / sizeof(T), std::size_t(1));
+        }
+
+        std::size_t num_buffers() const noexcept
+        {
+            return num_buffers_;
+        }
+
+    private:
+        device_policy device_;
+        std::size_t chunk_size_;
+        std::size_t num_buffers_;
+    };
+}    // namespace pika::execution
+
+namespace pika::detail {
+    // The staging memory of one of the buffers of a streamed algorithm.
+    template <typename T, typename U>
+    struct device_streaming_buffer
+    {
+        explicit device_streaming_buffer(std::size_t chunk_size)
+          : host_in(chunk_size * sizeof(T))
+          , host_out(std::is_same_v<T, U> ? 0 : chunk_size * sizeof(U))
+          , device_in(chunk_size * sizeof(T))
+          , device_out(std::is_same_v<T, U> ? 0 : chunk_size * sizeof(U))
+        {
+        }
+
+        parallel::detail::pinned_buffer host_in;
+        parallel::detail::pinned_buffer host_out;
+        parallel::detail::device_buffer device_in;
+        parallel::detail::device_buffer device_out;
+    };
+
+    // Streams the count elements starting at first through the device:
+    // buffer k runs the chunks k, k + num_buffers, ... one after the other,
+    // the buffers run concurrently. For every chunk, launch(stream, in, out,
+    // size) is called with the device copy of the chunk in in, out receives
+    // the results which are written to dest (out == in if T and U are the
+    // same).
+    template <typename T, typename U, typename Launch>
+    auto device_stream_chunks(
+        pika::execution::device_streaming_policy const& policy, T* first,
+        std::size_t count, U* dest, Launch launch)
+    {
+        namespace ex = pika::execution::experimental;
+        namespace cu = pika::cuda::experimental;
+        namespace tt = pika::this_thread::experimental;
+
+        static_assert(std::is_trivially_copyable_v<std::remove_cv_t<T>> &&
+                std::is_trivially_copyable_v<U>,
+            "the elements are copied to and from the device as bytes");
+
+        std::size_t const chunk_size =
+            policy.template chunk_size<std::remove_cv_t<T>>();
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+        std::size_t const num_buffers =
+            (std::min)(policy.num_buffers(), num_chunks);
+
+        struct state_type
+        {
+            cu::cuda_scheduler scheduler;
+            T* first;
+            std::size_t count;
+            U* dest;
+            std::size_t chunk_size;
+            std::size_t num_buffers;
+            Launch launch;
+            std::vector<std::exception_ptr> errors;
+
+            void run(std::size_t k)
+            {
+                using value_type = std::remove_cv_t<T>;
+                try
+                {
+                    device_streaming_buffer<value_type, U> buffer(chunk_size);
+                    for (std::size_t begin = k * chunk_size; begin < count;
+                         begin += num_buffers * chunk_size)
+                    {
+                        std::size_t const size =
+                            (std::min)(chunk_size, count - begin);
+                        value_type* host_in =
+                            buffer.host_in.template get<value_type>();
+                        U* host_out = std::is_same_v<value_type, U> ?
+                            reinterpret_cast<U*>(host_in) :
+                            buffer.host_out.template get<U>();
+                        value_type* device_in =
+                            buffer.device_in.template get<value_type>();
+                        U* device_out = std::is_same_v<value_type, U> ?
+                            reinterpret_cast<U*>(device_in) :
+                            buffer.device_out.template get<U>();
+
+                        std::memcpy(
+                            host_in, first + begin, size * sizeof(value_type));
+
+                        // every schedule picks the next stream of the pool
+                        tt::sync_wait(ex::schedule(scheduler) |
+                            cu::then_with_stream([&](cudaStream_t stream) {
+                                cu::check_cuda_error(cudaMemcpyAsync(device_in,
+                                    host_in, size * sizeof(value_type),
+                                    cudaMemcpyHostToDevice, stream));
+                                launch(stream, device_in, device_out, size);
+                                cu::check_cuda_error(cudaMemcpyAsync(host_out,
+                                    device_out, size * sizeof(U),
+                                    cudaMemcpyDeviceToHost, stream));
+                            }));
+
+                        std::memcpy(dest + begin, host_out, size * sizeof(U));
+                    }
+                }
+                catch (...)
+                {
+                    errors[k] = std::current_exception();
+                }
+            }
+
+            U* finish()
+            {
+                std::list<std::exception_ptr> exceptions;
+                for (auto& e : errors)
+                {
+                    if (e)
+                    {
+                        exceptions.push_back(PIKA_MOVE(e));
+                    }
+                }
+                if (!exceptions.empty())
+                {
+                    throw pika::exception_list(PIKA_MOVE(exceptions));
+                }
+                return dest + count;
+            }
+        };
+
+        return ex::bulk(ex::transfer_just(ex::thread_pool_scheduler{},
+                            state_type{policy.device().scheduler(), first,
+                                count, dest, chunk_size, num_buffers,
+                                PIKA_MOVE(launch),
+                                std::vector<std::exception_ptr>(num_buffers)}),
+                   num_buffers,
+                   [](std::size_t k, state_type& state) { state.run(k); }) |
+            ex::then([](state_type&& state) { return state.finish(); });
+    }
+}    // namespace pika::detail
+
+namespace pika {
+    // The algorithms called with a device_streaming_policy. These overloads
+    // take precedence over the generic implementations, which rely on
+    // tag_fallback_invoke.
+
+    template <typename T, typename F>
+    auto tag_invoke(pika::for_each_t,
+        pika::execution::device_streaming_policy const& policy, T* first,
+        T* last, F f)
+    {
+        using value_type = std::remove_cv_t<T>;
+        namespace ex = pika::execution::experimental;
+
+        return detail::device_stream_chunks(policy, first, last - first,
+                   first,
+                   [f = PIKA_MOVE(f)](cudaStream_t stream, value_type* in,
+                       value_type*, std::size_t size) {
+                       parallel::detail::device_bulk(stream, size,
+                           parallel::detail::device_for_each_body<value_type,
+                               F>{in, f});
+                   }) |
+            ex::then([](T*) {});
+    }
+
+    template <typename T, typename U, typename F>
+    auto tag_invoke(pika::transform_t,
+        pika::execution::device_streaming_policy const& policy, T* first,
+        T* last, U* dest, F f)
+    {
+        using value_type = std::remove_cv_t<T>;
+
+        return detail::device_stream_chunks(policy, first, last - first, dest,
+            [f = PIKA_MOVE(f)](cudaStream_t stream, value_type* in, U* out,
+                std::size_t size) {
+                parallel::detail::device_bulk(stream, size,
+                    parallel::detail::device_transform_body<value_type, U, F>{
+                        in, out, f});
+            });
+    }
+}    // namespace pika
+#endif
@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/hybrid_policy.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+// The policy is only available when compiling with the CUDA or HIP compiler
+#if defined(PIKA_HAVE_GPU_SUPPORT) && defined(PIKA_COMPUTE_CODE)
+#include <pika/execution.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/device_policy.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace pika::detail {
+    // The share of the elements of a hybrid call run on the device. It is
+    // updated after every call from the throughput of both parts, such that
+    // both finish at the same time.
+    class hybrid_balance
+    {
+    public:
+        // Every part gets at least this share, which keeps its throughput
+        // measured.
+        static constexpr double min_fraction = 0.01;
+
+        explicit hybrid_balance(double device_fraction) noexcept
+          : device_fraction_(
+                (std::clamp)(device_fraction, min_fraction, 1 - min_fraction))
+        {
+        }
+
+        double device_fraction() const noexcept
+        {
+            return device_fraction_.load(std::memory_order_relaxed);
+        }
+
+        void update(std::size_t host_count, double host_seconds,
+            std::size_t device_count, double device_seconds) noexcept
+        {
+            if (host_count == 0 || device_count == 0 || host_seconds <= 0 ||
+                device_seconds <= 0)
+            {
+                return;
+            }
+
+            double const host_rate = host_count / host_seconds;
+            double const device_rate = device_count / device_seconds;
+            double const measured = device_rate / (host_rate + device_rate);
+
+            // concurrent calls may lose an update, the next one makes up for
+            // it
+            double const fraction = (std::clamp)(
+                (device_fraction() + measured) / 2, min_fraction,
+                1 - min_fraction);
+            device_fraction_.store(fraction, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<double> device_fraction_;
+    };
+}    // namespace pika::detail
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Execution policy splitting a range between the host and a device.
+    /// The first part of the range is processed on the device through
+    /// \a device_policy, the rest concurrently on the host through the host
+    /// policy, the results of both parts are combined afterwards. The split
+    /// follows the throughput measured on previous calls, copies of the
+    /// policy share the measurements. Ranges which are too small for both
+    /// parts to pay off run on the host only.
+    ///
+    /// \a transform_reduce supports the policy. The range has to be
+    /// accessible from the host and the device (e.g. managed memory), the
+    /// function objects have to be callable on both. The call returns once
+    /// both parts have completed.
+    ///
+    /// \note The policy is experimental.
+    ///
+    template <typename HostPolicy = parallel_policy>
+    class hybrid_policy
+    {
+        static_assert(pika::is_execution_policy<HostPolicy>::value &&
+                !pika::is_async_execution_policy<HostPolicy>::value,
+            "the host part of a hybrid_policy runs with a synchronous "
+            "execution policy");
+
+    public:
+        /// The smallest number of elements a call splits between the host
+        /// and the device.
+        static constexpr std::size_t min_split_size = std::size_t(1) << 16;
+
+        /// Construct the policy running its device parts through \a device
+        /// and its host parts through \a host. \a device_fraction is the
+        /// share of the elements of the first call run on the device.
+        explicit hybrid_policy(device_policy device,
+            HostPolicy host = HostPolicy(), double device_fraction = 0.5)
+          : device_(PIKA_MOVE(device))
+          , host_(PIKA_MOVE(host))
+          , balance_(
+                std::make_shared<pika::detail::hybrid_balance>(device_fraction))
+        {
+        }
+
+        device_policy const& device() const noexcept
+        {
+            return device_;
+        }
+
+        HostPolicy const& host() const noexcept
+        {
+            return host_;
+        }
+
+        /// The share of the elements the next call runs on the device.
+        double device_fraction() const noexcept
+        {
+            return balance_->device_fraction();
+        }
+
+        /// \cond NOINTERNAL
+        pika::detail::hybrid_balance& balance() const noexcept
+        {
+            return *balance_;
+        }
+        /// \endcond
+
+    private:
+        device_policy device_;
+        HostPolicy host_;
+        std::shared_ptr<pika::detail::hybrid_balance> balance_;
+    };
+}    // namespace pika::execution
+
+namespace pika {
+    // The algorithms called with a hybrid_policy. These overloads take
+    // precedence over the generic implementations, which rely on
+    // tag_fallback_invoke.
+
+    template <typename HostPolicy, typename T, typename U, typename Reduce,
+        typename Convert>
+    U tag_invoke(pika::transform_reduce_t,
+        pika::execution::hybrid_policy<HostPolicy> const& policy, T* first,
+        T* last, U init, Reduce red_op, Convert conv_op)
+    {
+        namespace ex = pika::execution::experimental;
+        namespace tt = pika::this_thread::experimental;
+        using clock = std::chrono::steady_clock;
+        using policy_type = pika::execution::hybrid_policy<HostPolicy>;
+
+        std::size_t const count = last - first;
+        if (count < policy_type::min_split_size)
+        {
+            return pika::transform_reduce(
+                policy.host(), first, last, PIKA_MOVE(init), red_op, conv_op);
+        }
+
+        std::size_t const device_count = (std::max)(std::size_t(1),
+            static_cast<std::size_t>(policy.device_fraction() * count));
+        std::size_t const host_count = count - device_count;
+
+        // The device part starts with the first of its elements, which
+        // leaves init to the host part.
+        auto const device_start = clock::now();
+        auto device_part =
+            ex::ensure_started(pika::transform_reduce(policy.device(),
+                                   first + 1, first + device_count,
+                                   U(conv_op(*first)), red_op, conv_op) |
+                ex::then([device_start](U value) {
+                    return std::make_pair(PIKA_MOVE(value),
+                        std::chrono::duration<double>(
+                            clock::now() - device_start)
+                            .count());
+                }));
+
+        auto const host_start = clock::now();
+        U host_value = pika::transform_reduce(policy.host(),
+            first + device_count, last, PIKA_MOVE(init), red_op, conv_op);
+        double const host_seconds =
+            std::chrono::duration<double>(clock::now() - host_start).count();
+
+        auto [device_value, device_seconds] =
+            tt::sync_wait(PIKA_MOVE(device_part));
+        policy.balance().update(
+            host_count, host_seconds, device_count, device_seconds);
+
+        return red_op(PIKA_MOVE(host_value), PIKA_MOVE(device_value));
+    }
+}    // namespace pika
+#endif
@@ -16,4 +16,6 @@
 #include <pika/parallel/algorithms/uninitialized_default_construct.hpp>
 #include <pika/parallel/algorithms/uninitialized_fill.hpp>
 #include <pika/parallel/algorithms/uninitialized_move.hpp>
+#include <pika/parallel/algorithms/uninitialized_relocate.hpp>
+#include <pika/parallel/algorithms/uninitialized_transform.hpp>
 #include <pika/parallel/algorithms/uninitialized_value_construct.hpp>
@@ -14,8 +14,13 @@
 
 #include <pika/parallel/algorithms/adjacent_difference.hpp>
 #include <pika/parallel/algorithms/exclusive_scan.hpp>
+#include <pika/parallel/algorithms/fused_transform_reduce.hpp>
+#include <pika/parallel/algorithms/histogram.hpp>
 #include <pika/parallel/algorithms/inclusive_scan.hpp>
 #include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/segmented_reduce.hpp>
+#include <pika/parallel/algorithms/sketch.hpp>
+#include <pika/parallel/algorithms/stencil.hpp>
 #include <pika/parallel/algorithms/transform_exclusive_scan.hpp>
 #include <pika/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <pika/parallel/algorithms/transform_reduce.hpp>
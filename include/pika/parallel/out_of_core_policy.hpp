@@ -0,0 +1,377 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/out_of_core_policy.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/loser_tree.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP
+#endif
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Execution policy for calling an algorithm on a range which exceeds
+    /// the main memory, typically a memory-mapped file. The range is
+    /// processed in consecutive windows of \a window_bytes, one after the
+    /// other, using the given policy within every window. While a window is
+    /// processed the kernel is advised to read ahead the next one, the pages
+    /// of processed windows are marked for reclaim (without discarding
+    /// their contents). The pages are thus faulted in sequentially instead
+    /// of at random.
+    ///
+    /// \a for_each, \a reduce and \a transform_reduce support the policy, as
+    /// well as \a sort, which sorts the windows into runs and merges the
+    /// runs with a k-way merge into a temporary file before moving them
+    /// back. The ranges are given as pointers.
+    ///
+    template <typename Policy = parallel_policy>
+    class out_of_core_policy
+    {
+        static_assert(pika::is_execution_policy<Policy>::value &&
+                !pika::is_async_execution_policy<Policy>::value,
+            "the windows of an out_of_core_policy are processed using a "
+            "synchronous execution policy");
+
+    public:
+        /// The windows have 256 MiB by default.
+        static constexpr std::size_t default_window_bytes = std::size_t(1)
+            << 28;
+
+        /// Construct the policy processing windows of \a window_bytes using
+        /// \a policy.
+        explicit out_of_core_policy(Policy policy = Policy(),
+            std::size_t window_bytes = default_window_bytes)
+          : policy_(PIKA_MOVE(policy))
+          , window_bytes_(window_bytes)
+        {
+        }
+
+        Policy const& policy() const noexcept
+        {
+            return policy_;
+        }
+
+        /// The number of elements of type T of the windows.
+        template <typename T>
+        std::size_t window_size() const noexcept
+        {
+            return (std::max)(window_bytes_ / sizeof(T), std::size_t(1));
+        }
+
+    private:
+        Policy policy_;
+        std::size_t window_bytes_;
+    };
+}    // namespace pika::execution
+
+namespace pika::detail {
+    enum class out_of_core_advice
+    {
+        // the pages are needed soon, read them ahead
+        willneed,
+        // the pages are not needed anymore, reclaim them first
+        release
+    };
+
+    // Pass the advice for the pages of [first, last) to the kernel. This is
+    // only a hint, errors are ignored. The contents of the pages are never
+    // discarded, which MADV_DONTNEED would do for private mappings.
+    template <typename T>
+    void out_of_core_advise(T const* first, T const* last,
+        out_of_core_advice advice) noexcept
+    {
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+        if (first == last)
+        {
+            return;
+        }
+
+        static std::uintptr_t const page_size = ::sysconf(_SC_PAGESIZE);
+        std::uintptr_t const begin =
+            reinterpret_cast<std::uintptr_t>(first) & ~(page_size - 1);
+        std::uintptr_t const end = reinterpret_cast<std::uintptr_t>(last);
+        void* const p = reinterpret_cast<void*>(begin);
+
+        if (advice == out_of_core_advice::willneed)
+        {
+            ::posix_madvise(p, end - begin, POSIX_MADV_WILLNEED);
+        }
+        else
+        {
+#if defined(MADV_COLD)
+            ::madvise(p, end - begin, MADV_COLD);
+#else
+            ::posix_madvise(p, end - begin, POSIX_MADV_DONTNEED);
+#endif
+        }
+#else
+        (void) first;
+        (void) last;
+        (void) advice;
+#endif
+    }
+
+    // Calls f(window_first, window_last, index) for the consecutive windows
+    // of [first, last), advising the kernel to read ahead the next window
+    // and to reclaim the processed one.
+    template <typename T, typename F>
+    void out_of_core_windows(
+        std::size_t window_size, T* first, T* last, F&& f)
+    {
+        std::size_t const count = last - first;
+        std::size_t index = 0;
+        out_of_core_advise(
+            first, first + (std::min)(window_size, count),
+            out_of_core_advice::willneed);
+        for (std::size_t begin = 0; begin < count; begin += window_size)
+        {
+            std::size_t const end = (std::min)(begin + window_size, count);
+            out_of_core_advise(first + end,
+                first + (std::min)(end + window_size, count),
+                out_of_core_advice::willneed);
+
+            f(first + begin, first + end, index++);
+
+            out_of_core_advise(
+                first + begin, first + end, out_of_core_advice::release);
+        }
+    }
+
+    // Scratch memory for count elements of type T backed by an unlinked
+    // temporary file, the kernel writes its pages back to the file instead
+    // of keeping them in memory. Falls back to regular memory if no
+    // temporary file could be mapped.
+    template <typename T>
+    class out_of_core_scratch
+    {
+    public:
+        explicit out_of_core_scratch(std::size_t count)
+          : bytes_((std::max)(count * sizeof(T), std::size_t(1)))
+        {
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+            if (std::FILE* file = std::tmpfile())
+            {
+                int const fd = ::fileno(file);
+                if (::ftruncate(fd, static_cast<off_t>(bytes_)) == 0)
+                {
+                    void* p = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+                    if (p != MAP_FAILED)
+                    {
+                        data_ = static_cast<T*>(p);
+                        mapped_ = true;
+                    }
+                }
+                // the mapping keeps the (unlinked) file alive
+                std::fclose(file);
+            }
+#endif
+            if (data_ == nullptr)
+            {
+                data_ = static_cast<T*>(::operator new(bytes_));
+            }
+        }
+
+        out_of_core_scratch(out_of_core_scratch const&) = delete;
+        out_of_core_scratch& operator=(out_of_core_scratch const&) = delete;
+
+        ~out_of_core_scratch()
+        {
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+            if (mapped_)
+            {
+                ::munmap(data_, bytes_);
+                return;
+            }
+#endif
+            ::operator delete(data_);
+        }
+
+        T* data() const noexcept
+        {
+            return data_;
+        }
+
+    private:
+        std::size_t bytes_;
+        T* data_ = nullptr;
+        bool mapped_ = false;
+    };
+}    // namespace pika::detail
+
+namespace pika {
+    // The algorithms called with an out_of_core_policy. These overloads take
+    // precedence over the generic implementations, which rely on
+    // tag_fallback_invoke.
+
+    template <typename Policy, typename T, typename F>
+    void tag_invoke(pika::for_each_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last, F&& f)
+    {
+        detail::out_of_core_windows(policy.template window_size<T>(), first,
+            last, [&](T* window_first, T* window_last, std::size_t) {
+                pika::for_each(policy.policy(), window_first, window_last, f);
+            });
+    }
+
+    template <typename Policy, typename T, typename U, typename F>
+    U tag_invoke(pika::reduce_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last, U init, F&& f)
+    {
+        // the windows after the first one start from their first element,
+        // init is reduced only once
+        detail::out_of_core_windows(policy.template window_size<T>(), first,
+            last,
+            [&](T* window_first, T* window_last, std::size_t index) {
+                if (index == 0)
+                {
+                    init = pika::reduce(policy.policy(), window_first,
+                        window_last, PIKA_MOVE(init), f);
+                }
+                else
+                {
+                    U value = *window_first;
+                    init = PIKA_INVOKE(f, PIKA_MOVE(init),
+                        pika::reduce(policy.policy(), window_first + 1,
+                            window_last, PIKA_MOVE(value), f));
+                }
+            });
+        return init;
+    }
+
+    template <typename Policy, typename T, typename U>
+    U tag_invoke(pika::reduce_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last, U init)
+    {
+        return pika::reduce(
+            policy, first, last, PIKA_MOVE(init), std::plus<>());
+    }
+
+    template <typename Policy, typename T>
+    std::remove_cv_t<T> tag_invoke(pika::reduce_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last)
+    {
+        return pika::reduce(
+            policy, first, last, std::remove_cv_t<T>(), std::plus<>());
+    }
+
+    template <typename Policy, typename T, typename U, typename Reduce,
+        typename Convert>
+    U tag_invoke(pika::transform_reduce_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last, U init, Reduce&& red_op, Convert&& conv_op)
+    {
+        detail::out_of_core_windows(policy.template window_size<T>(), first,
+            last,
+            [&](T* window_first, T* window_last, std::size_t index) {
+                if (index == 0)
+                {
+                    init = pika::transform_reduce(policy.policy(),
+                        window_first, window_last, PIKA_MOVE(init), red_op,
+                        conv_op);
+                }
+                else
+                {
+                    U value = PIKA_INVOKE(conv_op, *window_first);
+                    init = PIKA_INVOKE(red_op, PIKA_MOVE(init),
+                        pika::transform_reduce(policy.policy(),
+                            window_first + 1, window_last, PIKA_MOVE(value),
+                            red_op, conv_op));
+                }
+            });
+        return init;
+    }
+
+    // clang-format off
+    template <typename Policy, typename T,
+        typename Comp = pika::parallel::detail::less,
+        typename Proj = pika::parallel::detail::projection_identity>
+    // clang-format on
+    void tag_invoke(pika::sort_t,
+        pika::execution::out_of_core_policy<Policy> const& policy, T* first,
+        T* last, Comp&& comp = Comp(), Proj&& proj = Proj())
+    {
+        std::size_t const window_size = policy.template window_size<T>();
+        std::size_t const count = last - first;
+
+        // sort the windows into runs
+        std::vector<T*> runs_first;
+        std::vector<T*> runs_last;
+        detail::out_of_core_windows(window_size, first, last,
+            [&](T* window_first, T* window_last, std::size_t) {
+                pika::sort(
+                    policy.policy(), window_first, window_last, comp, proj);
+                runs_first.push_back(window_first);
+                runs_last.push_back(window_last);
+            });
+        if (runs_first.size() < 2)
+        {
+            return;
+        }
+
+        // merge the runs into the scratch file, releasing the merged pages
+        // window by window
+        detail::out_of_core_scratch<T> scratch(count);
+        T* const dest = scratch.data();
+        {
+            using comp_type = std::remove_reference_t<Comp>;
+            using proj_type = std::remove_reference_t<Proj>;
+            parallel::detail::loser_tree<T*, comp_type, proj_type> tree(
+                PIKA_MOVE(runs_first), PIKA_MOVE(runs_last), comp, proj);
+            for (std::size_t begin = 0; begin < count; begin += window_size)
+            {
+                std::size_t const end = (std::min)(begin + window_size, count);
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    ::new (static_cast<void*>(dest + i))
+                        T(PIKA_MOVE(*tree.front()));
+                    tree.skip();
+                }
+                detail::out_of_core_advise(dest + begin, dest + end,
+                    detail::out_of_core_advice::release);
+            }
+        }
+
+        // move the merged elements back
+        detail::out_of_core_windows(window_size, dest, dest + count,
+            [&](T* window_first, T* window_last, std::size_t) {
+                T* window_dest = first + (window_first - dest);
+                pika::for_each(policy.policy(), window_first, window_last,
+                    [=](T& value) {
+                        window_dest[&value - window_first] = PIKA_MOVE(value);
+                        value.~T();
+                    });
+            });
+    }
+}    // namespace pika
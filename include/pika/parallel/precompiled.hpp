@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/precompiled.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/executors/execution_policy.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pika::precompiled {
+    namespace detail {
+        template <typename T>
+        inline constexpr bool is_precompiled_type_v =
+            std::is_same_v<T, std::int32_t> ||
+            std::is_same_v<T, std::int64_t> || std::is_same_v<T, float> ||
+            std::is_same_v<T, double> || std::is_same_v<T, std::uint8_t>;
+
+        template <typename ExPolicy>
+        inline constexpr bool is_precompiled_policy_v =
+            std::is_same_v<ExPolicy, pika::execution::sequenced_policy> ||
+            std::is_same_v<ExPolicy, pika::execution::parallel_policy>;
+
+        template <typename ExPolicy, typename T>
+        using enable_precompiled_t = std::enable_if_t<
+            is_precompiled_policy_v<ExPolicy> && is_precompiled_type_v<T>>;
+
+        // the predicate does not take part in the deduction of T, lambdas
+        // without captures are converted to it
+        template <typename T>
+        using predicate_t = std::common_type_t<bool (*)(T)>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The algorithms below are compiled into the pika_algorithms library for
+    // the pointers to std::int32_t, std::int64_t, float, double and
+    // std::uint8_t and for the policies seq and par. Calling them does not
+    // instantiate the algorithms in the calling translation unit, they run
+    // with the optimization options the library was built with. With
+    // PIKA_ALGORITHMS_WITH_DATAPAR_ISA_DISPATCH the sequential variants are
+    // additionally compiled for AVX2 and AVX-512 and the widest instruction
+    // set supported by the processor is selected at runtime.
+    ///////////////////////////////////////////////////////////////////////////
+
+    /// Sorts the elements in [first, last) in ascending order, see
+    /// pika::sort.
+    template <typename ExPolicy, typename T,
+        typename = detail::enable_precompiled_t<ExPolicy, T>>
+    void sort(ExPolicy const& policy, T* first, T* last);
+
+    /// Sorts the elements in [first, last) in ascending order, keeping the
+    /// order of equal elements, see pika::stable_sort.
+    template <typename ExPolicy, typename T,
+        typename = detail::enable_precompiled_t<ExPolicy, T>>
+    void stable_sort(ExPolicy const& policy, T* first, T* last);
+
+    /// Returns the sum of init and the elements in [first, last), see
+    /// pika::reduce.
+    template <typename ExPolicy, typename T,
+        typename = detail::enable_precompiled_t<ExPolicy, T>>
+    T reduce(ExPolicy const& policy, T const* first, T const* last, T init);
+
+    /// Writes the inclusive prefix sums of the elements in [first, last) to
+    /// the sequence starting at dest and returns its end, see
+    /// pika::inclusive_scan.
+    template <typename ExPolicy, typename T,
+        typename = detail::enable_precompiled_t<ExPolicy, T>>
+    T* inclusive_scan(
+        ExPolicy const& policy, T const* first, T const* last, T* dest);
+
+    /// Copies the elements in [first, last) for which pred returns true to
+    /// the sequence starting at dest and returns its end, see
+    /// pika::copy_if.
+    template <typename ExPolicy, typename T,
+        typename = detail::enable_precompiled_t<ExPolicy, T>>
+    T* copy_if(ExPolicy const& policy, T const* first, T const* last,
+        T* dest, detail::predicate_t<T> pred);
+}    // namespace pika::precompiled
@@ -0,0 +1,285 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/spmd_array.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concurrency/cache_line_data.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/uninitialized_fill.hpp>
+#include <pika/parallel/algorithms/uninitialized_value_construct.hpp>
+#include <pika/parallel/spmd_block.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// An array of \a size elements which is split into contiguous slices,
+    /// one for each image of an \a spmd_block. Image k owns the elements
+    /// with the global indices local_offset(k) to local_offset(k) +
+    /// local_size(k), the sizes of the slices differ by at most one.
+    ///
+    /// The slice of every image is stored in a segment of its own, which
+    /// starts at a cache line boundary and is padded to a multiple of the
+    /// cache line size, so images writing to the ends of their slices do not
+    /// share cache lines. The segment holds \a ghost_width ghost elements
+    /// on either side of the slice, which \a exchange_ghosts fills with the
+    /// adjacent elements of the neighbouring images.
+    ///
+    /// The memory of the array is left untouched until the images
+    /// initialize their slices by \a initialize, which maps the pages of a
+    /// slice to the NUMA domain of the worker thread running its image. A
+    /// page holding the end of one slice and the start of the next one is
+    /// placed with either image.
+    ///
+    /// The array is created before the images are launched and is shared
+    /// by all images of the block, e.g. by passing a pointer to it to
+    /// \a define_spmd_block.
+    ///
+    template <typename T>
+    class spmd_array
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = T const&;
+        using pointer = T*;
+        using const_pointer = T const*;
+
+        /// Construct an array of \a size elements split between
+        /// \a num_images images, each holding \a ghost_width ghost elements
+        /// on both sides of its slice. No element is constructed.
+        spmd_array(std::size_t num_images, std::size_t size,
+            std::size_t ghost_width = 0)
+          : num_images_(num_images)
+          , size_(size)
+          , ghost_width_(ghost_width)
+          , alignment_((std::max)(
+                pika::concurrency::detail::get_cache_line_size(), alignof(T)))
+          , initialized_(num_images, 0)
+        {
+            PIKA_ASSERT(num_images != 0);
+
+            std::size_t const max_local_size =
+                (size + num_images - 1) / num_images;
+            std::size_t const segment_size =
+                (max_local_size + 2 * ghost_width) * sizeof(T);
+            stride_ = (segment_size + alignment_ - 1) / alignment_ * alignment_;
+
+            data_ = static_cast<unsigned char*>(::operator new(
+                num_images * stride_, std::align_val_t(alignment_)));
+        }
+
+        spmd_array(spmd_array const&) = delete;
+        spmd_array& operator=(spmd_array const&) = delete;
+
+        ~spmd_array()
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (std::size_t image = 0; image != num_images_; ++image)
+                {
+                    if (initialized_[image])
+                    {
+                        std::destroy(
+                            left_ghost(image), right_ghost_end(image));
+                    }
+                }
+            }
+            ::operator delete(data_, std::align_val_t(alignment_));
+        }
+
+        /// Returns the number of elements of the array, not counting the
+        /// ghost elements.
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::size_t num_images() const noexcept
+        {
+            return num_images_;
+        }
+
+        std::size_t ghost_width() const noexcept
+        {
+            return ghost_width_;
+        }
+
+        /// Returns the global index of the first element of the slice of
+        /// the given image.
+        std::size_t local_offset(std::size_t image) const noexcept
+        {
+            std::size_t const q = size_ / num_images_;
+            std::size_t const r = size_ % num_images_;
+            return image * q + (std::min)(image, r);
+        }
+
+        /// Returns the number of elements in the slice of the given image.
+        std::size_t local_size(std::size_t image) const noexcept
+        {
+            return size_ / num_images_ + (image < size_ % num_images_);
+        }
+
+        /// Returns the image owning the element with the given global
+        /// index.
+        std::size_t owner(std::size_t index) const noexcept
+        {
+            std::size_t const q = size_ / num_images_;
+            std::size_t const r = size_ % num_images_;
+            if (index < r * (q + 1))
+            {
+                return index / (q + 1);
+            }
+            return r + (index - r * (q + 1)) / q;
+        }
+
+        /// Returns the elements of the slice of the given image.
+        T* local_begin(std::size_t image) noexcept
+        {
+            return left_ghost(image) + ghost_width_;
+        }
+
+        T const* local_begin(std::size_t image) const noexcept
+        {
+            return left_ghost(image) + ghost_width_;
+        }
+
+        T* local_end(std::size_t image) noexcept
+        {
+            return local_begin(image) + local_size(image);
+        }
+
+        T const* local_end(std::size_t image) const noexcept
+        {
+            return local_begin(image) + local_size(image);
+        }
+
+        /// Returns the \a ghost_width ghost elements preceding the slice of
+        /// the given image, which mirror the last elements of the slice of
+        /// the image before it.
+        T* left_ghost(std::size_t image) noexcept
+        {
+            return reinterpret_cast<T*>(data_ + image * stride_);
+        }
+
+        T const* left_ghost(std::size_t image) const noexcept
+        {
+            return reinterpret_cast<T const*>(data_ + image * stride_);
+        }
+
+        /// Returns the \a ghost_width ghost elements following the slice of
+        /// the given image, which mirror the first elements of the slice of
+        /// the image after it.
+        T* right_ghost(std::size_t image) noexcept
+        {
+            return local_end(image);
+        }
+
+        T const* right_ghost(std::size_t image) const noexcept
+        {
+            return local_end(image);
+        }
+
+        /// Returns the element with the given global index.
+        T& operator[](std::size_t index) noexcept
+        {
+            std::size_t const image = owner(index);
+            return local_begin(image)[index - local_offset(image)];
+        }
+
+        T const& operator[](std::size_t index) const noexcept
+        {
+            std::size_t const image = owner(index);
+            return local_begin(image)[index - local_offset(image)];
+        }
+
+        /// Value initializes the slice and the ghost elements of the image
+        /// of \a block by \a pika::uninitialized_value_construct, then
+        /// waits for all images to do so. This has to be called once by
+        /// every image before the elements are accessed.
+        void initialize(spmd_block const& block)
+        {
+            std::size_t const image = block.this_image();
+            pika::uninitialized_value_construct(pika::execution::seq,
+                left_ghost(image), right_ghost_end(image));
+            initialized_[image] = 1;
+            block.sync_all();
+        }
+
+        /// Initializes the slice and the ghost elements of the image of
+        /// \a block with copies of \a value by \a pika::uninitialized_fill,
+        /// then waits for all images to do so, see above.
+        void initialize(spmd_block const& block, T const& value)
+        {
+            std::size_t const image = block.this_image();
+            pika::uninitialized_fill(pika::execution::seq, left_ghost(image),
+                right_ghost_end(image), value);
+            initialized_[image] = 1;
+            block.sync_all();
+        }
+
+        /// Copies the first and last elements of the slices of the
+        /// neighbouring images of \a block into the ghost elements of its
+        /// image. This synchronizes with the neighbours only, through
+        /// \a spmd_block::sync_neighbors, before and after the copy. Ghost
+        /// elements beyond the slice of a neighbour holding less than
+        /// \a ghost_width elements and the outer ghost elements of the
+        /// first and the last image are left unchanged.
+        void exchange_ghosts(spmd_block const& block)
+        {
+            if (ghost_width_ == 0)
+            {
+                return;
+            }
+
+            // wait for the neighbours to finish writing to their slices
+            block.sync_neighbors();
+
+            std::size_t const image = block.this_image();
+            if (image != 0)
+            {
+                std::size_t const count =
+                    (std::min)(ghost_width_, local_size(image - 1));
+                std::copy(local_end(image - 1) - count, local_end(image - 1),
+                    local_begin(image) - count);
+            }
+            if (image + 1 != num_images_)
+            {
+                std::size_t const count =
+                    (std::min)(ghost_width_, local_size(image + 1));
+                std::copy(local_begin(image + 1),
+                    local_begin(image + 1) + count, right_ghost(image));
+            }
+
+            // the neighbours may modify their slices once both copied them
+            block.sync_neighbors();
+        }
+
+    private:
+        T* right_ghost_end(std::size_t image) noexcept
+        {
+            return right_ghost(image) + ghost_width_;
+        }
+
+        std::size_t num_images_;
+        std::size_t size_;
+        std::size_t ghost_width_;
+        std::size_t alignment_;
+        std::size_t stride_ = 0;
+        unsigned char* data_ = nullptr;
+        std::vector<char> initialized_;
+    };
+}    // namespace pika
@@ -6,18 +6,26 @@
 
 #pragma once
 
+#include <pika/config.hpp>
+#include <pika/concurrency/cache_line_data.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/execution_base/this_thread.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/functional/first_argument.hpp>
 #include <pika/functional/invoke.hpp>
 #include <pika/futures/future.hpp>
 #include <pika/iterator_support/irange.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/spmd_spin_barrier.hpp>
 #include <pika/synchronization/barrier.hpp>
 #include <pika/synchronization/mutex.hpp>
 #include <pika/type_support/pack.hpp>
+#include <pika/type_support/unused.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <memory>
@@ -28,7 +36,156 @@
 #include <utility>
 #include <vector>
 
+// the images waiting in a spinning barrier pause between two checks
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||             \
+    defined(_M_IX86)
+#define PIKA_ALGORITHMS_SPIN_PAUSE_MM
+#if defined(PIKA_MSVC)
+#include <intrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
 namespace pika {
+    namespace detail {
+        PIKA_FORCEINLINE void spin_pause() noexcept
+        {
+#if defined(PIKA_ALGORITHMS_SPIN_PAUSE_MM)
+            _mm_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+            __asm__ __volatile__("yield");
+#endif
+        }
+
+        // The barrier of sync_all selected by the spmd_spin_barrier executor
+        // parameters. The images spin with exponential backoff until they
+        // executed spin_count pauses, then they yield until the last image
+        // arrives, which starts the next generation of the barrier.
+        class spin_barrier
+        {
+        public:
+            spin_barrier(std::size_t num_images, std::size_t spin_count)
+              : num_images_(num_images)
+              , spin_count_(spin_count != 0 ? spin_count : default_spin_count)
+            {
+                arrived_.data_.store(0, std::memory_order_relaxed);
+                generation_.data_.store(0, std::memory_order_relaxed);
+            }
+
+            void arrive_and_wait()
+            {
+                // the generation changes only after this image arrived
+                std::size_t const generation =
+                    generation_.data_.load(std::memory_order_acquire);
+                std::size_t const arrived =
+                    arrived_.data_.fetch_add(1, std::memory_order_acq_rel) + 1;
+                if (arrived == num_images_)
+                {
+                    arrived_.data_.store(0, std::memory_order_relaxed);
+                    generation_.data_.store(
+                        generation + 1, std::memory_order_release);
+                    return;
+                }
+
+                auto waiting = [&]() {
+                    return generation_.data_.load(std::memory_order_acquire) ==
+                        generation;
+                };
+
+                std::size_t backoff = 1;
+                for (std::size_t spins = 0; spins < spin_count_; /**/)
+                {
+                    if (!waiting())
+                    {
+                        return;
+                    }
+                    for (std::size_t i = 0; i != backoff; ++i)
+                    {
+                        spin_pause();
+                    }
+                    spins += backoff;
+                    backoff = (std::min)(2 * backoff, max_backoff);
+                }
+
+                if (waiting())
+                {
+                    pika::util::yield_while(waiting, "spmd_block::sync_all");
+                }
+            }
+
+        private:
+            // the number of pauses if spmd_spin_barrier does not give one,
+            // a few microseconds on current processors
+            static constexpr std::size_t default_spin_count = 4096;
+
+            // the most pauses between two checks of the barrier
+            static constexpr std::size_t max_backoff = 64;
+
+            std::size_t num_images_;
+            std::size_t spin_count_;
+            pika::concurrency::detail::cache_line_data<std::atomic<std::size_t>>
+                arrived_;
+            pika::concurrency::detail::cache_line_data<std::atomic<std::size_t>>
+                generation_;
+        };
+
+        // Returns the spinning barrier for the images if the parameters
+        // of the policy select it, and nullptr otherwise.
+        template <typename Parameters>
+        std::shared_ptr<spin_barrier> make_spin_barrier(
+            Parameters const& params, std::size_t num_images)
+        {
+            if constexpr (std::is_same_v<Parameters,
+                              pika::execution::spmd_spin_barrier>)
+            {
+                return std::make_shared<spin_barrier>(
+                    num_images, params.get_spin_count());
+            }
+            else
+            {
+                PIKA_UNUSED(params);
+                PIKA_UNUSED(num_images);
+                return nullptr;
+            }
+        }
+
+        // The state of the collective operations of the images of an
+        // spmd_block. Every image owns two slots of one cache line each,
+        // which it uses in alternate steps. The state of a slot tells
+        // whether it holds the value of a step, which is read by exactly one
+        // other image, or whether it may be overwritten.
+        struct spmd_collectives
+        {
+            static constexpr std::size_t slot_size = 64;
+
+            using state_type = std::atomic<std::size_t>;
+
+            struct alignas(slot_size) slot
+            {
+                state_type state;
+                unsigned char data[slot_size - sizeof(state_type)];
+            };
+
+            explicit spmd_collectives(std::size_t num_images)
+              : slots_(2 * num_images)
+            {
+                while ((std::size_t(1) << num_rounds_) < num_images)
+                {
+                    ++num_rounds_;
+                }
+                for (slot& s : slots_)
+                {
+                    s.state.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            // The number of steps in which a value reaches every image.
+            std::size_t num_rounds_ = 0;
+            std::vector<slot> slots_;
+        };
+    }    // namespace detail
+
     /// The class spmd_block defines an interface for launching
     /// multiple images while giving handles to each image to interact with
     /// the remaining images. The \a define_spmd_block function templates create
@@ -44,15 +201,25 @@ namespace pika {
         using table_type =
             std::map<std::set<std::size_t>, std::shared_ptr<barrier_type>>;
         using mutex_type = pika::mutex;
+        using event_type = pika::concurrency::detail::cache_line_data<
+            std::atomic<std::size_t>>;
+        using events_type = std::vector<event_type>;
+        using collectives_type = detail::spmd_collectives;
+        using spin_barrier_type = detail::spin_barrier;
 
     public:
         explicit spmd_block(std::size_t num_images, std::size_t image_id,
-            barrier_type& barrier, table_type& barriers, mutex_type& mtx)
+            barrier_type& barrier, table_type& barriers, mutex_type& mtx,
+            events_type& events, collectives_type& collectives,
+            spin_barrier_type* spin_barrier = nullptr)
           : num_images_(num_images)
           , image_id_(image_id)
           , barrier_(barrier)
+          , spin_barrier_(spin_barrier)
           , barriers_(barriers)
           , mtx_(mtx)
+          , events_(events)
+          , collectives_(collectives)
         {
         }
 
@@ -75,12 +242,62 @@ namespace pika {
             return image_id_;
         }
 
+        /// Waits for all images. The images spin before they yield if
+        /// \a define_spmd_block was given the \a spmd_spin_barrier
+        /// executor parameters, they are suspended otherwise.
         void sync_all() const
         {
-            barrier_.get().arrive_and_wait();
+            if (spin_barrier_ != nullptr)
+            {
+                spin_barrier_->arrive_and_wait();
+            }
+            else
+            {
+                barrier_.get().arrive_and_wait();
+            }
         }
 
-        void sync_images(std::set<std::size_t> const& images) const
+        /// A handle to the barrier shared by a subset of the images. It is
+        /// created once by \a make_team and synchronizes the subset through
+        /// \a sync_images without allocating memory or taking a lock.
+        class team
+        {
+        public:
+            team() = default;
+
+            /// Returns the number of images in the team.
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            /// Returns whether the image which created the handle is a
+            /// member of the team.
+            bool contains_this_image() const
+            {
+                return is_member_;
+            }
+
+        private:
+            friend struct spmd_block;
+
+            team(std::shared_ptr<barrier_type> barrier, std::size_t size,
+                bool is_member)
+              : barrier_(PIKA_MOVE(barrier))
+              , size_(size)
+              , is_member_(is_member)
+            {
+            }
+
+            std::shared_ptr<barrier_type> barrier_;
+            std::size_t size_ = 0;
+            bool is_member_ = false;
+        };
+
+        /// Returns the handle to the barrier of the given images. All images
+        /// creating a team of the same images share the barrier, which is
+        /// the one \a sync_images uses for them.
+        team make_team(std::set<std::size_t> const& images) const
         {
             using lock_type = std::lock_guard<mutex_type>;
 
@@ -101,12 +318,32 @@ namespace pika {
                 }
             }
 
-            if (images.find(image_id_) != images.end())
+            return team(it->second, images.size(),
+                images.find(image_id_) != images.end());
+        }
+
+        team make_team(std::vector<std::size_t> const& input_images) const
+        {
+            std::set<std::size_t> images(
+                input_images.begin(), input_images.end());
+            return make_team(images);
+        }
+
+        /// Waits for all images of the team if this image is a member of
+        /// it, returns immediately otherwise.
+        void sync_images(team const& t) const
+        {
+            if (t.is_member_)
             {
-                it->second->arrive_and_wait();
+                t.barrier_->arrive_and_wait();
             }
         }
 
+        void sync_images(std::set<std::size_t> const& images) const
+        {
+            sync_images(make_team(images));
+        }
+
         void sync_images(std::vector<std::size_t> const& input_images) const
         {
             std::set<std::size_t> images(
@@ -132,12 +369,190 @@ namespace pika {
             sync_images(images);
         }
 
+        /// Publishes that this image reached its next epoch. Every image
+        /// counts the epochs it published, starting at zero. Data written
+        /// by this image before the call is visible to the images which
+        /// waited for the returned epoch.
+        ///
+        /// \returns The epoch this image reached.
+        std::size_t notify() const
+        {
+            return events_.get()[image_id_].data_.fetch_add(
+                       1, std::memory_order_release) +
+                1;
+        }
+
+        /// Waits until the given image published at least \a epoch epochs.
+        /// Unlike the barriers, this does not wait for any other image.
+        void wait_for(std::size_t image, std::size_t epoch) const
+        {
+            std::atomic<std::size_t> const& event =
+                events_.get()[image].data_;
+            if (event.load(std::memory_order_acquire) < epoch)
+            {
+                pika::util::yield_while(
+                    [&]() {
+                        return event.load(std::memory_order_acquire) < epoch;
+                    },
+                    "spmd_block::wait_for");
+            }
+        }
+
+        /// Publishes the next epoch of this image and waits for its left
+        /// and right neighbours, the images this_image() - 1 and
+        /// this_image() + 1, to reach it as well. The first and the last
+        /// image have a single neighbour only.
+        void sync_neighbors() const
+        {
+            std::size_t const epoch = notify();
+            if (image_id_ != 0)
+            {
+                wait_for(image_id_ - 1, epoch);
+            }
+            if (image_id_ + 1 < num_images_)
+            {
+                wait_for(image_id_ + 1, epoch);
+            }
+        }
+
+        // The collective operations below have to be called by all images in
+        // the same order. The values are exchanged in log2(N) steps between
+        // pairs of images, where N is the number of images. T has to be
+        // trivially copyable and fit into a cache line along with a flag.
+
+        /// Returns \a value of the image \a root on all images.
+        template <typename T>
+        T broadcast(T const& value, std::size_t root) const
+        {
+            struct message
+            {
+                bool valid;
+                T value;
+            };
+
+            // the images which received the value pass it on to the image at
+            // twice the distance from the root in every step
+            message m{image_id_ == root, value};
+            for (std::size_t i = 0; i != collectives_.get().num_rounds_; ++i)
+            {
+                message const received = exchange(m, std::size_t(1) << i);
+                if (!m.valid && received.valid)
+                {
+                    m = received;
+                }
+            }
+            return m.value;
+        }
+
+        /// Returns op(v_0, op(v_1, ... op(v_k-1, v_k))) on image k, where v_i
+        /// is the \a value of image i. \a op has to be associative.
+        template <typename T, typename Op>
+        T inclusive_scan(T const& value, Op&& op) const
+        {
+            // the partial result of image k covers the images k - 2^i + 1
+            // to k after step i
+            T result = value;
+            for (std::size_t i = 0; i != collectives_.get().num_rounds_; ++i)
+            {
+                std::size_t const distance = std::size_t(1) << i;
+                T const received = exchange(result, distance);
+                if (image_id_ >= distance)
+                {
+                    result = PIKA_INVOKE(op, received, result);
+                }
+            }
+            return result;
+        }
+
+        /// Returns op(init, op(v_0, ... op(v_k-2, v_k-1))) on image k, where
+        /// v_i is the \a value of image i, and \a init on image 0. \a op
+        /// has to be associative.
+        template <typename T, typename Op>
+        T exclusive_scan(T const& value, T const& init, Op&& op) const
+        {
+            T const result = inclusive_scan(value, op);
+            if (num_images_ == 1)
+            {
+                return init;
+            }
+
+            T const received = exchange(result, 1);
+            return image_id_ == 0 ? init : PIKA_INVOKE(op, init, received);
+        }
+
+        /// Returns op(v_0, op(v_1, ... op(v_N-2, v_N-1))) on all images,
+        /// where v_i is the \a value of image i. \a op has to be
+        /// associative.
+        template <typename T, typename Op>
+        T all_reduce(T const& value, Op&& op) const
+        {
+            return broadcast(
+                inclusive_scan(value, PIKA_FORWARD(Op, op)), num_images_ - 1);
+        }
+
     private:
+        // Passes value to the image at the given distance above this one and
+        // returns the value of the image at the same distance below it.
+        template <typename T>
+        T exchange(T const& value, std::size_t distance) const
+        {
+            static_assert(std::is_trivially_copyable_v<T>,
+                "the values of the collective operations have to be "
+                "trivially copyable");
+            static_assert(sizeof(T) <= sizeof(collectives_type::slot::data),
+                "the values of the collective operations have to fit into "
+                "a cache line");
+
+            // the states of the slot used in this step: free, holding the
+            // value of this step, free for the next step using it
+            std::size_t const step = collective_step_++;
+            std::size_t const state = 2 * (step / 2);
+
+            std::vector<collectives_type::slot>& slots =
+                collectives_.get().slots_;
+
+            collectives_type::slot& out = slots[2 * image_id_ + step % 2];
+            if (out.state.load(std::memory_order_acquire) != state)
+            {
+                pika::util::yield_while(
+                    [&]() {
+                        return out.state.load(std::memory_order_acquire) !=
+                            state;
+                    },
+                    "spmd_block::exchange");
+            }
+            std::memcpy(out.data, &value, sizeof(T));
+            out.state.store(state + 1, std::memory_order_release);
+
+            std::size_t const source =
+                (image_id_ + num_images_ - distance % num_images_) %
+                num_images_;
+            collectives_type::slot& in = slots[2 * source + step % 2];
+            if (in.state.load(std::memory_order_acquire) != state + 1)
+            {
+                pika::util::yield_while(
+                    [&]() {
+                        return in.state.load(std::memory_order_acquire) !=
+                            state + 1;
+                    },
+                    "spmd_block::exchange");
+            }
+            T result = value;
+            std::memcpy(&result, in.data, sizeof(T));
+            in.state.store(state + 2, std::memory_order_release);
+
+            return result;
+        }
+
         std::size_t num_images_;
         std::size_t image_id_;
         mutable std::reference_wrapper<barrier_type> barrier_;
+        spin_barrier_type* spin_barrier_;
         mutable std::reference_wrapper<table_type> barriers_;
         mutable std::reference_wrapper<mutex_type> mtx_;
+        mutable std::reference_wrapper<events_type> events_;
+        mutable std::reference_wrapper<collectives_type> collectives_;
+        mutable std::size_t collective_step_ = 0;
     };
 
     namespace detail {
@@ -149,19 +564,25 @@ namespace pika {
             using table_type =
                 std::map<std::set<std::size_t>, std::shared_ptr<barrier_type>>;
             using mutex_type = pika::mutex;
+            using event_type = pika::concurrency::detail::cache_line_data<
+                std::atomic<std::size_t>>;
+            using events_type = std::vector<event_type>;
 
         public:
             std::shared_ptr<barrier_type> barrier_;
             std::shared_ptr<table_type> barriers_;
             std::shared_ptr<mutex_type> mtx_;
+            std::shared_ptr<events_type> events_;
+            std::shared_ptr<spmd_collectives> collectives_;
+            std::shared_ptr<spin_barrier> spin_barrier_;
             std::decay_t<F> f_;
             std::size_t num_images_;
 
             template <typename... Ts>
             void operator()(std::size_t image_id, Ts&&... ts) const
             {
-                spmd_block block(
-                    num_images_, image_id, *barrier_, *barriers_, *mtx_);
+                spmd_block block(num_images_, image_id, *barrier_, *barriers_,
+                    *mtx_, *events_, *collectives_, spin_barrier_.get());
                 PIKA_INVOKE(f_, PIKA_MOVE(block), PIKA_FORWARD(Ts, ts)...);
             }
         };
@@ -184,6 +605,9 @@ namespace pika {
             using table_type =
                 std::map<std::set<std::size_t>, std::shared_ptr<barrier_type>>;
             using mutex_type = pika::mutex;
+            using event_type = pika::concurrency::detail::cache_line_data<
+                std::atomic<std::size_t>>;
+            using events_type = std::vector<event_type>;
 
             static_assert(std::is_same<spmd_block, first_type>::value,
                 "define_spmd_block() needs a function or lambda that "
@@ -194,11 +618,22 @@ namespace pika {
             std::shared_ptr<table_type> barriers =
                 std::make_shared<table_type>();
             std::shared_ptr<mutex_type> mtx = std::make_shared<mutex_type>();
+            std::shared_ptr<events_type> events =
+                std::make_shared<events_type>(num_images);
+            for (auto& event : *events)
+            {
+                event.data_.store(0, std::memory_order_relaxed);
+            }
+            std::shared_ptr<spmd_collectives> collectives =
+                std::make_shared<spmd_collectives>(num_images);
+            std::shared_ptr<spin_barrier> spin =
+                make_spin_barrier(policy.parameters(), num_images);
 
             return pika::parallel::execution::bulk_async_execute(
                 policy.executor(),
                 detail::spmd_block_helper<F>{
-                    barrier, barriers, mtx, PIKA_FORWARD(F, f), num_images},
+                    barrier, barriers, mtx, events, collectives, spin,
+                    PIKA_FORWARD(F, f), num_images},
                 pika::detail::irange(std::size_t(0), num_images),
                 PIKA_FORWARD(Args, args)...);
         }
@@ -221,6 +656,9 @@ namespace pika {
             using table_type =
                 std::map<std::set<std::size_t>, std::shared_ptr<barrier_type>>;
             using mutex_type = pika::mutex;
+            using event_type = pika::concurrency::detail::cache_line_data<
+                std::atomic<std::size_t>>;
+            using events_type = std::vector<event_type>;
 
             static_assert(std::is_same<spmd_block, first_type>::value,
                 "define_spmd_block() needs a lambda that "
@@ -231,10 +669,21 @@ namespace pika {
             std::shared_ptr<table_type> barriers =
                 std::make_shared<table_type>();
             std::shared_ptr<mutex_type> mtx = std::make_shared<mutex_type>();
+            std::shared_ptr<events_type> events =
+                std::make_shared<events_type>(num_images);
+            for (auto& event : *events)
+            {
+                event.data_.store(0, std::memory_order_relaxed);
+            }
+            std::shared_ptr<spmd_collectives> collectives =
+                std::make_shared<spmd_collectives>(num_images);
+            std::shared_ptr<spin_barrier> spin =
+                make_spin_barrier(policy.parameters(), num_images);
 
             pika::parallel::execution::bulk_sync_execute(policy.executor(),
                 detail::spmd_block_helper<F>{
-                    barrier, barriers, mtx, PIKA_FORWARD(F, f), num_images},
+                    barrier, barriers, mtx, events, collectives, spin,
+                    PIKA_FORWARD(F, f), num_images},
                 pika::detail::irange(std::size_t(0), num_images),
                 PIKA_FORWARD(Args, args)...);
         }
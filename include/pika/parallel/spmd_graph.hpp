@@ -0,0 +1,267 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/spmd_graph.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/concurrency/cache_line_data.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/parallel/spmd_team_policy.hpp>
+#include <pika/synchronization/barrier.hpp>
+#include <pika/synchronization/mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A sequence of steps executed by the images of an \a spmd_block, which
+    /// is recorded once and replayed many times, e.g. once per time step of
+    /// a simulation. Every step is a function called by all images with the
+    /// \a spmd_block of the image.
+    ///
+    /// Recording an algorithm splits its range between the images and
+    /// stores the part of every image, the images synchronize after each
+    /// algorithm. A replay launches one task per image, which runs all
+    /// steps of all repetitions, instead of the tasks of every algorithm
+    /// call. The state of the images, their barriers, events and the slots
+    /// of their collective operations, is allocated when the graph is
+    /// created and is kept between replays. The \a spmd_block of an image
+    /// is the same object in every replay, the images continue where they
+    /// stopped in the previous one.
+    ///
+    /// \note The steps must not throw, the other images would wait for the
+    ///       failed image forever. The recorded ranges and the objects the
+    ///       steps refer to have to stay valid while the graph is replayed.
+    ///
+    template <typename ExPolicy = pika::execution::parallel_policy>
+    class spmd_graph
+    {
+        static_assert(pika::is_execution_policy<ExPolicy>::value &&
+                !pika::is_async_execution_policy<ExPolicy>::value,
+            "spmd_graph is replayed using a synchronous execution policy");
+
+        using barrier_type = pika::barrier<>;
+        using table_type =
+            std::map<std::set<std::size_t>, std::shared_ptr<barrier_type>>;
+        using mutex_type = pika::mutex;
+        using event_type = pika::concurrency::detail::cache_line_data<
+            std::atomic<std::size_t>>;
+        using events_type = std::vector<event_type>;
+        using step_type = std::function<void(spmd_block const&)>;
+
+    public:
+        /// Create an empty graph replayed by \a num_images images, which
+        /// are executed using \a policy. The executor parameters of the
+        /// policy select the barrier of the images as for
+        /// \a define_spmd_block.
+        explicit spmd_graph(std::size_t num_images, ExPolicy policy = {})
+          : policy_(PIKA_MOVE(policy))
+          , num_images_(num_images)
+          , barrier_(num_images)
+          , events_(num_images)
+          , collectives_(num_images)
+          , spin_barrier_(
+                detail::make_spin_barrier(policy_.parameters(), num_images))
+        {
+            PIKA_ASSERT(num_images != 0);
+
+            for (auto& event : events_)
+            {
+                event.data_.store(0, std::memory_order_relaxed);
+            }
+
+            blocks_.reserve(num_images);
+            for (std::size_t image = 0; image != num_images; ++image)
+            {
+                blocks_.emplace_back(num_images, image, barrier_, barriers_,
+                    mtx_, events_, collectives_, spin_barrier_.get());
+            }
+        }
+
+        spmd_graph(spmd_graph const&) = delete;
+        spmd_graph& operator=(spmd_graph const&) = delete;
+
+        std::size_t num_images() const noexcept
+        {
+            return num_images_;
+        }
+
+        std::size_t num_steps() const noexcept
+        {
+            return steps_.size();
+        }
+
+        /// Append a step calling f(block) on every image. The images do not
+        /// synchronize after the step unless \a f does.
+        template <typename F>
+        void add(F&& f)
+        {
+            steps_.emplace_back(PIKA_FORWARD(F, f));
+        }
+
+        /// Append a step waiting for all images.
+        void sync_all()
+        {
+            steps_.emplace_back(
+                [](spmd_block const& block) { block.sync_all(); });
+        }
+
+        /// Append a step applying \a f to the elements of [first, last),
+        /// see \a pika::for_each.
+        template <typename FwdIter, typename F>
+        void for_each(FwdIter first, FwdIter last, F&& f)
+        {
+            steps_.emplace_back(
+                [parts = split(first, std::distance(first, last)),
+                    f = PIKA_FORWARD(F, f)](spmd_block const& block) {
+                    auto const& [part_first, part_last] =
+                        parts[block.this_image()];
+                    if (part_first != part_last)
+                    {
+                        pika::for_each(
+                            pika::execution::seq, part_first, part_last, f);
+                    }
+                    block.sync_all();
+                });
+        }
+
+        /// Append a step writing the results of \a f for the elements of
+        /// [first, last) to the range starting at \a dest, see
+        /// \a pika::transform.
+        template <typename FwdIter1, typename FwdIter2, typename F>
+        void transform(FwdIter1 first, FwdIter1 last, FwdIter2 dest, F&& f)
+        {
+            std::size_t const count = std::distance(first, last);
+            std::vector<std::pair<FwdIter1, FwdIter1>> parts =
+                split(first, count);
+            std::vector<std::pair<FwdIter2, FwdIter2>> dests =
+                split(dest, count);
+
+            steps_.emplace_back([parts = PIKA_MOVE(parts),
+                                    dests = PIKA_MOVE(dests),
+                                    f = PIKA_FORWARD(F, f)](
+                                    spmd_block const& block) {
+                std::size_t const image = block.this_image();
+                auto const& [part_first, part_last] = parts[image];
+                if (part_first != part_last)
+                {
+                    pika::transform(pika::execution::seq, part_first,
+                        part_last, dests[image].first, f);
+                }
+                block.sync_all();
+            });
+        }
+
+        /// Append a step storing the reduction of \a init and the results
+        /// of \a conv_op for the elements of [first, last) in \a result,
+        /// see \a pika::transform_reduce. The result is written by the
+        /// first image and is visible to all images after the step. It is
+        /// exchanged through the collective operations of \a spmd_block, it
+        /// has to be trivially copyable and fit into a cache line.
+        template <typename FwdIter, typename T, typename Reduce,
+            typename Convert>
+        void transform_reduce(FwdIter first, FwdIter last, T& result, T init,
+            Reduce&& red_op, Convert&& conv_op)
+        {
+            steps_.emplace_back(
+                [parts = split(first, std::distance(first, last)), &result,
+                    init = PIKA_MOVE(init),
+                    red_op = PIKA_FORWARD(Reduce, red_op),
+                    conv_op = PIKA_FORWARD(Convert, conv_op)](
+                    spmd_block const& block) {
+                    auto const& [part_first, part_last] =
+                        parts[block.this_image()];
+
+                    detail::spmd_team_partial<T> partial{false, init};
+                    if (part_first != part_last)
+                    {
+                        T value = PIKA_INVOKE(conv_op, *part_first);
+                        partial = {true,
+                            pika::transform_reduce(pika::execution::seq,
+                                std::next(part_first), part_last,
+                                PIKA_MOVE(value), red_op, conv_op)};
+                    }
+
+                    T total =
+                        detail::spmd_team_reduce(block, partial, init, red_op);
+                    if (block.this_image() == 0)
+                    {
+                        result = PIKA_MOVE(total);
+                    }
+                    block.sync_all();
+                });
+        }
+
+        /// Run all steps \a count times on the images of the graph, returns
+        /// once all images are done.
+        void replay(std::size_t count = 1)
+        {
+            if (count == 0 || steps_.empty())
+            {
+                return;
+            }
+
+            pika::parallel::execution::bulk_sync_execute(policy_.executor(),
+                [this, count](std::size_t image) {
+                    spmd_block const& block = blocks_[image];
+                    for (std::size_t i = 0; i != count; ++i)
+                    {
+                        for (step_type const& step : steps_)
+                        {
+                            step(block);
+                        }
+                    }
+                },
+                pika::detail::irange(std::size_t(0), num_images_));
+        }
+
+    private:
+        // the parts of count elements processed by the images, as for
+        // spmd_team_policy
+        template <typename Iter>
+        std::vector<std::pair<Iter, Iter>> split(
+            Iter first, std::size_t count) const
+        {
+            std::vector<std::pair<Iter, Iter>> parts;
+            parts.reserve(num_images_);
+            for (spmd_block const& block : blocks_)
+            {
+                parts.push_back(detail::spmd_team_range(block, first, count));
+            }
+            return parts;
+        }
+
+        ExPolicy policy_;
+        std::size_t num_images_;
+        barrier_type barrier_;
+        table_type barriers_;
+        mutex_type mtx_;
+        events_type events_;
+        detail::spmd_collectives collectives_;
+        std::shared_ptr<detail::spin_barrier> spin_barrier_;
+        std::vector<spmd_block> blocks_;
+        std::vector<step_type> steps_;
+    };
+}    // namespace pika
@@ -0,0 +1,324 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/spmd_team_policy.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/spmd_block.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Execution policy for calling an algorithm from all images of an
+    /// \a spmd_block at once. The images split the range into contiguous
+    /// parts, the same ones \a spmd_array assigns to them for an array of
+    /// the same size, and every image processes its part using the given
+    /// sequential or unsequenced policy without spawning any task. The
+    /// algorithm returns once all images processed their parts, its result
+    /// is the same on all images.
+    ///
+    /// \a for_each, \a for_each_n, \a fill, \a copy, \a transform,
+    /// \a reduce and \a transform_reduce support the policy. The values
+    /// reduced by the images are exchanged through the collective
+    /// operations of \a spmd_block, they have to be trivially copyable and
+    /// fit into a cache line.
+    ///
+    /// \note All images of the block have to call the algorithm with the
+    ///       same range.
+    ///
+    template <typename Policy = sequenced_policy>
+    class spmd_team_policy
+    {
+        static_assert(pika::is_execution_policy<Policy>::value &&
+                !pika::is_parallel_execution_policy<Policy>::value &&
+                !pika::is_async_execution_policy<Policy>::value,
+            "the images of an spmd_team_policy run their parts using a "
+            "synchronous, non-parallel execution policy");
+
+    public:
+        /// Construct the policy of the image of \a block, which processes
+        /// its part using \a policy.
+        explicit spmd_team_policy(
+            spmd_block const& block, Policy policy = Policy())
+          : block_(block)
+          , policy_(PIKA_MOVE(policy))
+        {
+        }
+
+        spmd_block const& block() const noexcept
+        {
+            return block_;
+        }
+
+        Policy const& policy() const noexcept
+        {
+            return policy_;
+        }
+
+    private:
+        std::reference_wrapper<spmd_block const> block_;
+        Policy policy_;
+    };
+}    // namespace pika::execution
+
+namespace pika::detail {
+    // The first element and the number of elements of the part of count
+    // elements processed by the image of block.
+    inline std::pair<std::size_t, std::size_t> spmd_team_share(
+        spmd_block const& block, std::size_t count) noexcept
+    {
+        std::size_t const num_images = block.get_num_images();
+        std::size_t const image = block.this_image();
+        std::size_t const q = count / num_images;
+        std::size_t const r = count % num_images;
+        return {image * q + (std::min)(image, r), q + (image < r)};
+    }
+
+    template <typename Iter>
+    std::pair<Iter, Iter> spmd_team_range(
+        spmd_block const& block, Iter first, std::size_t count)
+    {
+        auto const [offset, size] = spmd_team_share(block, count);
+        std::advance(first, offset);
+        Iter last = first;
+        std::advance(last, size);
+        return {first, last};
+    }
+
+    // The partial result of an image, which is empty if its part is.
+    template <typename T>
+    struct spmd_team_partial
+    {
+        bool valid;
+        T value;
+    };
+
+    template <typename T, typename Reduce>
+    T spmd_team_reduce(spmd_block const& block, spmd_team_partial<T> partial,
+        T init, Reduce&& red_op)
+    {
+        spmd_team_partial<T> const total = block.all_reduce(partial,
+            [&](spmd_team_partial<T> const& lhs,
+                spmd_team_partial<T> const& rhs) {
+                if (!lhs.valid)
+                {
+                    return rhs;
+                }
+                if (!rhs.valid)
+                {
+                    return lhs;
+                }
+                return spmd_team_partial<T>{
+                    true, PIKA_INVOKE(red_op, lhs.value, rhs.value)};
+            });
+
+        if (!total.valid)
+        {
+            return init;
+        }
+        return PIKA_INVOKE(red_op, PIKA_MOVE(init), total.value);
+    }
+}    // namespace pika::detail
+
+namespace pika {
+    // The algorithms called with an spmd_team_policy. These overloads take
+    // precedence over the generic implementations, which rely on
+    // tag_fallback_invoke.
+
+    // clang-format off
+    template <typename Policy, typename FwdIter, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(pika::for_each_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter first, FwdIter last, F&& f)
+    {
+        auto const [part_first, part_last] = detail::spmd_team_range(
+            policy.block(), first, std::distance(first, last));
+        if (part_first != part_last)
+        {
+            pika::for_each(policy.policy(), part_first, part_last, f);
+        }
+        policy.block().sync_all();
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter, typename Size, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter>::value &&
+            std::is_integral_v<Size>
+        )>
+    // clang-format on
+    FwdIter tag_invoke(pika::for_each_n_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter first, Size count, F&& f)
+    {
+        if (count <= 0)
+        {
+            policy.block().sync_all();
+            return first;
+        }
+
+        auto const [part_first, part_last] = detail::spmd_team_range(
+            policy.block(), first, static_cast<std::size_t>(count));
+        if (part_first != part_last)
+        {
+            pika::for_each(policy.policy(), part_first, part_last, f);
+        }
+        policy.block().sync_all();
+
+        std::advance(first, count);
+        return first;
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter,
+        typename T = typename std::iterator_traits<FwdIter>::value_type,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(pika::fill_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter first, FwdIter last, T const& value)
+    {
+        auto const [part_first, part_last] = detail::spmd_team_range(
+            policy.block(), first, std::distance(first, last));
+        if (part_first != part_last)
+        {
+            pika::fill(policy.policy(), part_first, part_last, value);
+        }
+        policy.block().sync_all();
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter1, typename FwdIter2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter1>::value &&
+            pika::traits::is_iterator<FwdIter2>::value
+        )>
+    // clang-format on
+    FwdIter2 tag_invoke(pika::copy_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter1 first, FwdIter1 last, FwdIter2 dest)
+    {
+        std::size_t const count = std::distance(first, last);
+        auto const [offset, size] =
+            detail::spmd_team_share(policy.block(), count);
+        if (size != 0)
+        {
+            FwdIter1 part_first = std::next(first, offset);
+            pika::copy(policy.policy(), part_first,
+                std::next(part_first, size), std::next(dest, offset));
+        }
+        policy.block().sync_all();
+
+        return std::next(dest, count);
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter1, typename FwdIter2,
+        typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter1>::value &&
+            pika::traits::is_iterator<FwdIter2>::value
+        )>
+    // clang-format on
+    FwdIter2 tag_invoke(pika::transform_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter1 first, FwdIter1 last, FwdIter2 dest, F&& f)
+    {
+        std::size_t const count = std::distance(first, last);
+        auto const [offset, size] =
+            detail::spmd_team_share(policy.block(), count);
+        if (size != 0)
+        {
+            FwdIter1 part_first = std::next(first, offset);
+            pika::transform(policy.policy(), part_first,
+                std::next(part_first, size), std::next(dest, offset), f);
+        }
+        policy.block().sync_all();
+
+        return std::next(dest, count);
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter, typename T, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter>::value
+        )>
+    // clang-format on
+    T tag_invoke(pika::reduce_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter first, FwdIter last, T init, F&& f)
+    {
+        auto const [part_first, part_last] = detail::spmd_team_range(
+            policy.block(), first, std::distance(first, last));
+
+        // the partial results do not include init, which is added once
+        detail::spmd_team_partial<T> partial{false, init};
+        if (part_first != part_last)
+        {
+            T value = *part_first;
+            partial = {true,
+                pika::reduce(policy.policy(), std::next(part_first),
+                    part_last, PIKA_MOVE(value), f)};
+        }
+
+        // all images reduced their parts once the collective returns
+        return detail::spmd_team_reduce(
+            policy.block(), partial, PIKA_MOVE(init), f);
+    }
+
+    // clang-format off
+    template <typename Policy, typename FwdIter, typename T, typename Reduce,
+        typename Convert,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::traits::is_iterator<FwdIter>::value
+        )>
+    // clang-format on
+    T tag_invoke(pika::transform_reduce_t,
+        pika::execution::spmd_team_policy<Policy> const& policy,
+        FwdIter first, FwdIter last, T init, Reduce&& red_op,
+        Convert&& conv_op)
+    {
+        auto const [part_first, part_last] = detail::spmd_team_range(
+            policy.block(), first, std::distance(first, last));
+
+        detail::spmd_team_partial<T> partial{false, init};
+        if (part_first != part_last)
+        {
+            T value = PIKA_INVOKE(conv_op, *part_first);
+            partial = {true,
+                pika::transform_reduce(policy.policy(), std::next(part_first),
+                    part_last, PIKA_MOVE(value), red_op, conv_op)};
+        }
+
+        return detail::spmd_team_reduce(
+            policy.block(), partial, PIKA_MOVE(init), red_op);
+    }
+}    // namespace pika
@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/auto_chunk_size.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+    // Derive a chunk size from the measured cost of one iteration such that
+    // every chunk runs for roughly target_ns nanoseconds. Cheap iterations
+    // result in fewer (possibly less than cores) and larger chunks, expensive
+    // iterations result in more and smaller chunks.
+    inline constexpr std::size_t adaptive_chunk_size_from_cost(
+        double ns_per_iteration, std::uint64_t target_ns,
+        std::size_t count) noexcept
+    {
+        if (count == 0)
+            return 1;
+
+        if (ns_per_iteration <= 0.0)
+            return count;
+
+        double const iterations = double(target_ns) / ns_per_iteration;
+        if (iterations >= double(count))
+            return count;
+
+        return (std::max)(std::size_t(iterations), std::size_t(1));
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces whose size is derived from the
+    /// measured cost per element, like \a auto_chunk_size does: a short probe
+    /// chunk is executed inline and timed, and the chunk size used for the
+    /// remaining iterations is chosen such that each chunk runs for roughly
+    /// the given target duration. The maximum number of chunks follows from
+    /// the chosen chunk size.
+    ///
+    /// Unlike \a auto_chunk_size, the chunk size is always derived from the
+    /// measured cost. Iterations cheaper than one nanosecond result in large
+    /// chunks, iterations more expensive than the target duration result in
+    /// chunks of a single iteration, instead of an even distribution of the
+    /// iterations over the cores in both cases.
+    ///
+    /// \note This executor parameters type can be used with all algorithms
+    ///       based on the partitioners (including the scan partitioner).
+    ///
+    struct adaptive_chunk_size : auto_chunk_size
+    {
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor parameter
+        ///       types will use 200 microseconds as the target duration of
+        ///       each chunk and will use 1% of the iterations for the timing
+        ///       probe.
+        ///
+        adaptive_chunk_size()
+          : adaptive_chunk_size(std::chrono::microseconds(200))
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param target_time          [in] The targeted execution time for
+        ///                             each chunk.
+        /// \param num_iters_for_timing [in] The number of iterations to use
+        ///                             for the timing probe. 0 means 1% of
+        ///                             the iterations.
+        ///
+        template <typename Rep, typename Period>
+        explicit adaptive_chunk_size(
+            std::chrono::duration<Rep, Period> const& target_time,
+            std::uint64_t num_iters_for_timing = 0)
+          : auto_chunk_size(target_time, num_iters_for_timing)
+          , target_time_(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    target_time)
+                    .count()))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // the number of chunks follows from the chunk size
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t, std::size_t) const noexcept
+        {
+            return 0;
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&& exec, F&& f, std::size_t cores, std::size_t count)
+        {
+            // auto_chunk_size runs the probe, its duration is recorded here
+            // to derive the chunk size from the per-iteration cost
+            std::size_t tested = 0;
+            std::int64_t elapsed = 0;
+            auto probe = [&](std::size_t probe_size) {
+                auto const start = std::chrono::steady_clock::now();
+                tested = f(probe_size);
+                elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                              .count();
+                return tested;
+            };
+
+            auto_chunk_size::get_chunk_size(
+                PIKA_FORWARD(Executor, exec), probe, cores, count);
+
+            // auto_chunk_size skips the probe for small inputs
+            if (tested == 0 && count != 0)
+            {
+                probe(1);
+            }
+            if (tested == 0)
+            {
+                return 1;
+            }
+
+            // guard against timer resolution issues for very cheap iterations
+            double const ns_per_iteration =
+                double((std::max)(elapsed, std::int64_t(1))) / double(tested);
+
+            return parallel::detail::adaptive_chunk_size_from_cost(
+                ns_per_iteration, target_time_,
+                count > tested ? count - tested : 0);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::uint64_t target_time_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
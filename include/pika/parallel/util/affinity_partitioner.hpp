@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/affinity_partitioner.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into a fixed number of contiguous chunks
+    /// per worker thread. The worker thread which has executed a chunk is
+    /// recorded and subsequent invocations of algorithms over the same number
+    /// of iterations using the same \a affinity_partitioner schedule the
+    /// chunk on the recorded worker thread again. This improves cache reuse
+    /// for algorithms repeatedly sweeping over the same data, e.g. in the
+    /// time stepping loop of an iterative solver.
+    ///
+    /// \note Copies of an \a affinity_partitioner share the recorded
+    ///       placement. The same \a affinity_partitioner should not be used by
+    ///       concurrently running algorithms.
+    ///
+    /// \note The recorded worker thread is a scheduling hint passed to the
+    ///       executor. Executors which do not support scheduling hints will
+    ///       still create the same chunks, but may run them anywhere.
+    ///
+    struct affinity_partitioner
+    {
+        /// Construct an \a affinity_partitioner executor parameters object
+        ///
+        /// \note Default constructed \a affinity_partitioner executor
+        ///       parameter types will create four chunks per worker thread.
+        ///
+        affinity_partitioner()
+          : affinity_partitioner(4)
+        {
+        }
+
+        /// Construct an \a affinity_partitioner executor parameters object
+        ///
+        /// \param chunks_per_worker [in] The number of chunks created for
+        ///                     each worker thread.
+        ///
+        explicit affinity_partitioner(std::size_t chunks_per_worker)
+          : chunks_per_worker_(chunks_per_worker == 0 ? 1 : chunks_per_worker)
+          , data_(std::make_shared<affinity_data>())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        static constexpr std::size_t no_worker = std::size_t(-1);
+
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return cores * chunks_per_worker_;
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&&, F&&, std::size_t cores, std::size_t count) const
+        {
+            std::size_t const max_chunks = cores * chunks_per_worker_;
+            std::size_t chunk_size = (count + max_chunks - 1) / max_chunks;
+            if (chunk_size == 0)
+                chunk_size = 1;
+
+            // forget the recorded placement if the iterations are not
+            // divided in the same way as before
+            if (data_->cores_ != cores || data_->count_ != count)
+            {
+                data_->cores_ = cores;
+                data_->count_ = count;
+                data_->workers_.assign(
+                    (count + chunk_size - 1) / chunk_size, no_worker);
+            }
+            return chunk_size;
+        }
+
+        std::size_t get_chunk_worker(
+            std::size_t chunk, std::size_t) const noexcept
+        {
+            auto const& workers = data_->workers_;
+            return chunk < workers.size() ? workers[chunk] : no_worker;
+        }
+
+        // all chunks write to different elements, subsequent invocations
+        // read the recorded workers only after all chunks have finished
+        void record_chunk_worker(
+            std::size_t chunk, std::size_t worker) const noexcept
+        {
+            auto& workers = data_->workers_;
+            if (chunk < workers.size())
+                workers[chunk] = worker;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        struct affinity_data
+        {
+            std::size_t cores_ = 0;
+            std::size_t count_ = 0;
+            std::vector<std::size_t> workers_;
+        };
+
+        std::size_t chunks_per_worker_;
+        std::shared_ptr<affinity_data> data_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::affinity_partitioner>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
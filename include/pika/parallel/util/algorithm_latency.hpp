@@ -0,0 +1,334 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/algorithm_latency.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/parallel/util/detail/algorithm_latency_hook.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The latencies of the calls of one algorithm with inputs of similar
+    /// size, merged across all threads.
+    struct algorithm_latency
+    {
+        /// The number of buckets of \a counts.
+        static constexpr std::size_t num_buckets = 496;
+
+        /// The name of the algorithm, e.g. "sort"
+        std::string name;
+
+        /// The smallest and largest input size of the calls, the sizes are
+        /// grouped by powers of two. Both are std::size_t(-1) if the size
+        /// is not known, see inline_threshold for how it is determined.
+        std::size_t min_size = 0;
+        std::size_t max_size = 0;
+
+        /// The number of calls and their total latency in nanoseconds
+        std::uint64_t calls = 0;
+        std::uint64_t total_ns = 0;
+
+        /// The number of calls per latency bucket. Latencies below 16 ns
+        /// have a bucket each, larger latencies are grouped with eight
+        /// buckets per power of two, bounding the relative error by 1/8.
+        std::array<std::uint64_t, num_buckets> counts{};
+
+        /// Returns the smallest latency in nanoseconds of the given bucket.
+        static constexpr std::uint64_t bucket_min_ns(std::size_t i) noexcept
+        {
+            if (i < 16)
+                return i;
+            return std::uint64_t(i % 8 + 8) << (i / 8 - 1);
+        }
+
+        /// Returns the bucket of the given latency in nanoseconds.
+        static constexpr std::size_t bucket(std::uint64_t ns) noexcept
+        {
+            if (ns < 16)
+                return static_cast<std::size_t>(ns);
+
+            std::size_t msb = 4;
+            while (msb != 63 && (ns >> (msb + 1)) != 0)
+                ++msb;
+            std::size_t const shift = msb - 3;
+            return (shift + 1) * 8 + static_cast<std::size_t>(ns >> shift) - 8;
+        }
+
+        /// Returns the smallest latency in nanoseconds above the given
+        /// fraction of the calls, e.g. percentile(0.99) for the 99th
+        /// percentile. The result is the lower bound of its bucket.
+        std::uint64_t percentile(double fraction) const noexcept
+        {
+            if (calls == 0)
+                return 0;
+
+            double const rank = fraction * static_cast<double>(calls);
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                seen += counts[i];
+                if (counts[i] != 0 && static_cast<double>(seen) >= rank)
+                    return bucket_min_ns(i);
+            }
+            return bucket_min_ns(num_buckets - 1);
+        }
+
+        /// Returns the mean latency in nanoseconds.
+        double mean() const noexcept
+        {
+            return calls ? static_cast<double>(total_ns) /
+                    static_cast<double>(calls) :
+                           0.0;
+        }
+    };
+
+    namespace detail {
+        // The groups of input sizes, the size bucket b holds the sizes
+        // with b significant bits, unknown sizes have their own bucket.
+        inline constexpr std::size_t unknown_size_bucket = 65;
+
+        constexpr std::size_t size_bucket(std::size_t size) noexcept
+        {
+            if (size == (std::numeric_limits<std::size_t>::max)())
+                return unknown_size_bucket;
+
+            std::size_t b = 0;
+            while (b != 64 && (size >> b) != 0)
+                ++b;
+            return b;
+        }
+
+        // Every OS thread records into its own buffer, only its owner and
+        // the queries lock the mutex.
+        struct algorithm_latency_buffer
+        {
+            struct key_hash
+            {
+                std::size_t operator()(
+                    std::pair<char const*, std::size_t> const& key)
+                    const noexcept
+                {
+                    return std::hash<char const*>()(key.first) ^
+                        (key.second * 0x9e3779b97f4a7c15ull);
+                }
+            };
+
+            std::mutex mtx;
+            std::unordered_map<std::pair<char const*, std::size_t>,
+                algorithm_latency, key_hash>
+                latencies;
+        };
+
+        struct algorithm_latency_registry
+        {
+            algorithm_latency_registry()
+            {
+                // recording can be enabled without recompiling the
+                // application by naming the file the latencies are written
+                // to on exit
+                if (char const* file = std::getenv("PIKA_ALGORITHM_LATENCY"))
+                {
+                    file_ = file;
+                    if (!file_.empty())
+                        set_enabled(true);
+                }
+            }
+
+            ~algorithm_latency_registry();
+
+            std::shared_ptr<algorithm_latency_buffer> make_buffer()
+            {
+                auto buffer = std::make_shared<algorithm_latency_buffer>();
+                std::lock_guard<std::mutex> l(mtx_);
+                buffers_.push_back(buffer);
+                return buffer;
+            }
+
+            void set_enabled(bool enable) noexcept;
+
+            std::string file_;
+            std::mutex mtx_;
+            std::vector<std::shared_ptr<algorithm_latency_buffer>> buffers_;
+        };
+
+        inline algorithm_latency_registry& get_algorithm_latency_registry()
+        {
+            static algorithm_latency_registry registry;
+            return registry;
+        }
+
+        inline algorithm_latency_buffer& get_algorithm_latency_buffer()
+        {
+            thread_local std::shared_ptr<algorithm_latency_buffer> buffer =
+                get_algorithm_latency_registry().make_buffer();
+            return *buffer;
+        }
+
+        inline void record_algorithm_latency(
+            char const* name, std::size_t size, std::uint64_t ns)
+        {
+            auto& buffer = get_algorithm_latency_buffer();
+            std::lock_guard<std::mutex> l(buffer.mtx);
+
+            algorithm_latency& latency =
+                buffer.latencies[std::make_pair(name, size_bucket(size))];
+            ++latency.calls;
+            latency.total_ns += ns;
+            ++latency.counts[algorithm_latency::bucket(ns)];
+        }
+    }    // namespace detail
+
+    namespace detail {
+        inline void algorithm_latency_registry::set_enabled(
+            bool enable) noexcept
+        {
+            algorithm_latency_recording.store(
+                enable ? &record_algorithm_latency : nullptr,
+                std::memory_order_relaxed);
+        }
+
+        // the environment variable is read on startup by the applications
+        // including this header
+        inline bool const algorithm_latency_environment_read =
+            (get_algorithm_latency_registry(), true);
+    }    // namespace detail
+
+    /// Enable or disable recording of the latencies of the algorithm calls.
+    /// Recording is disabled by default, unless the environment variable
+    /// PIKA_ALGORITHM_LATENCY names a file the latencies are written to on
+    /// exit. The variable is read on startup if this header is included by
+    /// the application, the algorithms themselves only see whether the
+    /// recording is enabled. Only the synchronous calls are recorded, from
+    /// the call of the algorithm to its return.
+    inline void enable_algorithm_latency(bool enable = true) noexcept
+    {
+        detail::get_algorithm_latency_registry().set_enabled(enable);
+    }
+
+    /// Returns whether the latencies of the algorithm calls are recorded.
+    inline bool algorithm_latency_enabled() noexcept
+    {
+        return detail::get_algorithm_latency_hook() != nullptr;
+    }
+
+    /// Returns the latencies recorded so far, merged across all threads and
+    /// ordered by algorithm name and input size. This may be called while
+    /// algorithms are running.
+    inline std::vector<algorithm_latency> get_algorithm_latencies()
+    {
+        auto& registry = detail::get_algorithm_latency_registry();
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        // the same name may be stored at different addresses
+        std::map<std::pair<std::string, std::size_t>, algorithm_latency>
+            merged;
+        for (auto const& buffer : registry.buffers_)
+        {
+            std::lock_guard<std::mutex> lb(buffer->mtx);
+            for (auto const& [key, latency] : buffer->latencies)
+            {
+                algorithm_latency& m =
+                    merged[std::make_pair(std::string(key.first), key.second)];
+                m.calls += latency.calls;
+                m.total_ns += latency.total_ns;
+                for (std::size_t i = 0; i != algorithm_latency::num_buckets;
+                     ++i)
+                {
+                    m.counts[i] += latency.counts[i];
+                }
+            }
+        }
+
+        std::vector<algorithm_latency> latencies;
+        latencies.reserve(merged.size());
+        for (auto& [key, latency] : merged)
+        {
+            latency.name = key.first;
+            if (key.second == detail::unknown_size_bucket)
+            {
+                latency.min_size = latency.max_size =
+                    (std::numeric_limits<std::size_t>::max)();
+            }
+            else if (key.second != 0)
+            {
+                latency.min_size = std::size_t(1) << (key.second - 1);
+                latency.max_size = (latency.min_size - 1) * 2 + 1;
+            }
+            latencies.push_back(PIKA_MOVE(latency));
+        }
+        return latencies;
+    }
+
+    /// Discards the latencies recorded so far.
+    inline void clear_algorithm_latencies()
+    {
+        auto& registry = detail::get_algorithm_latency_registry();
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        for (auto const& buffer : registry.buffers_)
+        {
+            std::lock_guard<std::mutex> lb(buffer->mtx);
+            buffer->latencies.clear();
+        }
+    }
+
+    /// Writes a summary of the latencies recorded so far as json, with the
+    /// number of calls, the mean and the 50th, 90th, 99th and 99.9th
+    /// percentiles in nanoseconds of every algorithm and input size.
+    inline void write_algorithm_latencies(std::ostream& os)
+    {
+        std::vector<algorithm_latency> const latencies =
+            get_algorithm_latencies();
+
+        os << "[";
+        bool first = true;
+        for (auto const& l : latencies)
+        {
+            os << (first ? "\n" : ",\n") << "  {\"name\":\"" << l.name
+               << "\",\"min_size\":";
+            if (l.min_size == (std::numeric_limits<std::size_t>::max)())
+                os << "null,\"max_size\":null";
+            else
+                os << l.min_size << ",\"max_size\":" << l.max_size;
+            os << ",\"calls\":" << l.calls << ",\"mean\":" << l.mean()
+               << ",\"p50\":" << l.percentile(0.5)
+               << ",\"p90\":" << l.percentile(0.9)
+               << ",\"p99\":" << l.percentile(0.99)
+               << ",\"p999\":" << l.percentile(0.999) << "}";
+            first = false;
+        }
+        os << "\n]\n";
+    }
+
+    namespace detail {
+        inline algorithm_latency_registry::~algorithm_latency_registry()
+        {
+            if (!file_.empty())
+            {
+                std::ofstream out(file_);
+                write_algorithm_latencies(out);
+            }
+        }
+    }    // namespace detail
+}    // namespace pika::parallel::util
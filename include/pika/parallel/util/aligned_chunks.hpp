@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/aligned_chunks.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/concurrency/cache_line_data.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type placing the boundaries between the chunks of
+    /// the partitioned algorithms at multiples of an alignment, relative to
+    /// the address of the destination. Neighbouring chunks then never write
+    /// to the same cache line, which avoids false sharing for small elements
+    /// (bytes, floats, ...), and every chunk but the first starts at an
+    /// aligned element, such that the vectorized loops of \a simd and
+    /// \a par_simd do not peel a head per chunk.
+    ///
+    /// The elements before the first aligned element form a chunk of their
+    /// own, which is run by the calling thread. The chunk sizes are rounded
+    /// up to a multiple of the elements per alignment, the last chunk holds
+    /// the remaining elements. The destination is the range written to:
+    /// the last range of algorithms partitioning several ranges at once
+    /// (e.g. the output of \a transform), the only range otherwise (e.g. for
+    /// \a for_each and \a fill). Ranges which are not contiguous, or whose
+    /// elements are larger than the alignment or not aligned to their size,
+    /// are partitioned as usual.
+    ///
+    /// \note The option applies to the algorithms using the default chunk
+    ///       sizes of the partitioner (the static partitioner, which most
+    ///       algorithms are built on). Executor parameters determining the
+    ///       chunk sizes themselves, and the work stealing partitioner, are
+    ///       not affected.
+    ///
+    struct aligned_chunks
+    {
+        /// Construct an \a aligned_chunks executor parameters object
+        ///
+        /// \param alignment [in] The alignment of the chunk boundaries in
+        ///                     bytes, a power of two. The default (zero)
+        ///                     aligns them to the cache lines.
+        ///
+        constexpr explicit aligned_chunks(std::size_t alignment = 0) noexcept
+          : alignment_(alignment)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        std::size_t get_alignment() const noexcept
+        {
+            return alignment_ != 0 ?
+                alignment_ :
+                pika::concurrency::detail::get_cache_line_size();
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t alignment_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::aligned_chunks>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parameters>
+    inline constexpr bool has_aligned_chunks_v = std::is_same_v<
+        std::decay_t<Parameters>, pika::execution::aligned_chunks>;
+
+    // The iterator of the range the chunks of the partitioned algorithms
+    // write to: the last iterator of a zip_iterator, the iterator itself
+    // otherwise.
+    template <typename Iter>
+    struct chunk_destination
+    {
+        using type = Iter;
+
+        static constexpr Iter const& call(Iter const& it) noexcept
+        {
+            return it;
+        }
+    };
+
+    template <typename... Iters>
+    struct chunk_destination<pika::util::zip_iterator<Iters...>>
+    {
+        using iterator_tuple_type = std::tuple<Iters...>;
+        using type = std::tuple_element_t<sizeof...(Iters) - 1,
+            iterator_tuple_type>;
+
+        static constexpr type call(
+            pika::util::zip_iterator<Iters...> const& it) noexcept
+        {
+            return std::get<sizeof...(Iters) - 1>(it.get_iterator_tuple());
+        }
+    };
+
+    // Returns the number of elements before the first element of the
+    // destination of first aligned to alignment bytes, and the number of
+    // elements per alignment through elements. The elements are zero if the
+    // chunks can't be aligned.
+    template <typename FwdIter>
+    std::size_t get_aligned_chunks_head(FwdIter const& first,
+        std::size_t alignment, std::size_t& elements) noexcept
+    {
+        using destination = chunk_destination<FwdIter>;
+        using iterator = typename destination::type;
+
+        elements = 0;
+        if constexpr (pika::traits::is_iterator_v<iterator> &&
+            pika::detail::is_contiguous_iterator_v<iterator>)
+        {
+            using value_type =
+                typename std::iterator_traits<iterator>::value_type;
+
+            if (alignment <= sizeof(value_type) ||
+                alignment % sizeof(value_type) != 0)
+            {
+                return 0;
+            }
+
+            auto const address = reinterpret_cast<std::uintptr_t>(
+                pika::detail::to_address(destination::call(first)));
+            std::size_t const misalignment = address % alignment;
+            if (misalignment % sizeof(value_type) != 0)
+            {
+                return 0;
+            }
+
+            elements = alignment / sizeof(value_type);
+            return ((alignment - misalignment) % alignment) /
+                sizeof(value_type);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+}    // namespace pika::parallel::util::detail
@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/bandwidth_limit.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/bandwidth_bound_algorithm.hpp>
+#include <pika/parallel/util/tunables.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type capping the number of cores used by the
+    /// algorithms whose throughput is bound by the memory bandwidth: \a copy,
+    /// \a copy_n, \a fill, \a fill_n, \a move and \a transform. A few cores
+    /// of a socket usually saturate its memory bandwidth, running these
+    /// algorithms on more cores only adds contention and takes the cores
+    /// from the compute bound tasks running concurrently.
+    ///
+    /// The algorithms report the capped number of cores as their
+    /// processing units count and create one chunk per core, such that at
+    /// most that many cores work on them at the same time. All other
+    /// algorithms invoked with these parameters use the default executor
+    /// parameters of the policy.
+    ///
+    struct bandwidth_limit
+    {
+        /// Construct a \a bandwidth_limit executor parameters object using
+        /// the number of cores calibrated for this machine, the tunable
+        /// \a bandwidth_bound_cores (see calibrate_bandwidth_limit). All
+        /// cores are used as long as it is not calibrated.
+        constexpr bandwidth_limit() noexcept
+          : cores_(0)
+        {
+        }
+
+        /// Construct a \a bandwidth_limit executor parameters object
+        ///
+        /// \param cores [in] The largest number of cores used by the
+        ///                     algorithms, 0 uses the calibrated number.
+        ///
+        constexpr explicit bandwidth_limit(std::size_t cores) noexcept
+          : cores_(cores)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // the number of cores used out of the available ones
+        std::size_t get_cores(std::size_t available) const noexcept
+        {
+            std::size_t const cores = cores_ != 0 ?
+                cores_ :
+                parallel::util::get_tunable(
+                    parallel::util::tunable::bandwidth_bound_cores);
+            return cores == 0 ? available : (std::min)(cores, available);
+        }
+
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&& exec) const
+        {
+            // the cores of the executor as seen without these parameters
+            std::size_t const available =
+                parallel::execution::processing_units_count(
+                    parallel_policy::executor_parameters_type(), exec);
+            return get_cores(available == 0 ? 1 : available);
+        }
+
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return cores;
+        }
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(Executor&&, F&&,
+            std::size_t cores, std::size_t count) const noexcept
+        {
+            std::size_t const chunk_size = (count + cores - 1) / cores;
+            return chunk_size == 0 ? 1 : chunk_size;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t cores_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::bandwidth_limit>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
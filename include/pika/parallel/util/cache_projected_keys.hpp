@@ -0,0 +1,44 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/cache_projected_keys.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type making \a sort and \a stable_sort invoke
+    /// their projection once per element instead of twice per comparison.
+    /// The projected keys are computed in parallel and sorted together with
+    /// iterators to their elements, which are then moved to their place
+    /// once, along the cycles of the resulting permutation. Arithmetic keys
+    /// compared using std::less or std::greater are sorted by the radix sort
+    /// engine.
+    ///
+    /// This pays off for expensive projections, e.g. ones parsing or hashing
+    /// a field of the elements. The keys must be default constructible, the
+    /// elements must be movable without throwing. Otherwise, or without a
+    /// projection, the parameters are ignored.
+    ///
+    struct cache_projected_keys
+    {
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::cache_projected_keys>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
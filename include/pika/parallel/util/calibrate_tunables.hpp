@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/calibrate_tunables.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/executors/parallel_executor.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/detail/sample_sort.hpp>
+#include <pika/parallel/algorithms/merge.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/util/bandwidth_limit.hpp>
+#include <pika/parallel/util/tunables.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Controls the measurements of \a calibrate_tunables.
+    struct tunables_calibration_options
+    {
+        /// The number of elements the algorithms are measured with, the
+        /// thresholds are only meaningful well below it.
+        std::size_t size = std::size_t(1) << 22;
+
+        /// The values every tunable is measured with.
+        std::vector<std::size_t> candidates = {
+            4096, 16384, 65536, 262144, 1048576};
+
+        /// The number of measurements of every candidate, the fastest one
+        /// is used.
+        std::size_t repetitions = 3;
+
+        /// The seed of the random input values.
+        unsigned int seed = 0;
+    };
+
+    /// Measures the algorithms depending on the tunables for all candidate
+    /// values and sets every tunable to the value with the smallest time.
+    /// The tunables are calibrated one after another in the order of
+    /// \a tunable, each with the values chosen for the previous ones. The
+    /// calibration takes a few seconds with the default options, its
+    /// result can be stored with \a write_tunables and loaded with
+    /// \a read_tunables or the environment variable PIKA_TUNABLES to avoid
+    /// calibrating at every startup.
+    ///
+    /// \note This must be called on a pika thread and must not be called
+    ///       concurrently with other algorithms, they run with the values
+    ///       being measured.
+    inline void calibrate_tunables(
+        tunables_calibration_options const& options = {})
+    {
+        using pika::execution::par;
+
+        std::vector<int> input(options.size);
+        std::mt19937 gen(options.seed);
+        std::uniform_int_distribution<int> dis;
+        std::generate(input.begin(), input.end(), [&]() { return dis(gen); });
+
+        // the inputs of inplace_merge
+        std::vector<int> halves(input);
+        auto const middle = halves.begin() + halves.size() / 2;
+        std::sort(halves.begin(), middle);
+        std::sort(middle, halves.end());
+
+        std::vector<int> work(options.size);
+
+        // the values are restored before every run, which takes the same
+        // time for all candidates
+        auto calibrate = [&](tunable t, std::vector<int> const& values,
+                             auto&& run) {
+            std::size_t best = get_tunable(t);
+            double best_time = (std::numeric_limits<double>::max)();
+            for (std::size_t candidate : options.candidates)
+            {
+                set_tunable(t, candidate);
+                for (std::size_t i = 0; i != options.repetitions; ++i)
+                {
+                    pika::copy(par, values.begin(), values.end(), work.begin());
+
+                    auto const start = std::chrono::steady_clock::now();
+                    run();
+                    std::chrono::duration<double> const elapsed =
+                        std::chrono::steady_clock::now() - start;
+
+                    if (elapsed.count() < best_time)
+                    {
+                        best = candidate;
+                        best_time = elapsed.count();
+                    }
+                }
+            }
+            set_tunable(t, best);
+        };
+
+        calibrate(tunable::sort_limit_per_task, input,
+            [&]() { pika::sort(par, work.begin(), work.end()); });
+        calibrate(tunable::stable_sort_limit_per_task, input,
+            [&]() { pika::stable_sort(par, work.begin(), work.end()); });
+        calibrate(tunable::sample_sort_limit_per_task, input, [&]() {
+            detail::sample_sort(pika::execution::parallel_executor(),
+                work.begin(), work.end());
+        });
+        calibrate(tunable::inplace_merge_threshold, halves, [&]() {
+            pika::inplace_merge(par, work.begin(),
+                work.begin() + work.size() / 2, work.end());
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Controls the measurements of \a calibrate_bandwidth_limit.
+    struct bandwidth_calibration_options
+    {
+        /// The number of doubles copied, the arrays must be much larger than
+        /// the caches.
+        std::size_t size = std::size_t(1) << 24;
+
+        /// The number of measurements for every number of cores, the
+        /// fastest one is used.
+        std::size_t repetitions = 3;
+
+        /// The fraction of the highest bandwidth at which the memory
+        /// bandwidth is considered to be saturated.
+        double saturation = 0.9;
+    };
+
+    /// Measures the bandwidth of the copy kernel of the stream benchmark
+    /// on 1, 2, 4, ... and all cores of the default executor, and sets the
+    /// tunable \a bandwidth_bound_cores to the smallest number of cores
+    /// reaching the given fraction of the highest bandwidth measured. The
+    /// default constructed \a bandwidth_limit executor parameters cap the
+    /// algorithms bound by the memory bandwidth to this number of cores.
+    /// Returns the number of cores.
+    ///
+    /// \note This must be called on a pika thread and must not be called
+    ///       concurrently with other algorithms, which compete for the
+    ///       memory bandwidth.
+    inline std::size_t calibrate_bandwidth_limit(
+        bandwidth_calibration_options const& options = {})
+    {
+        using pika::execution::par;
+
+        std::vector<double> const a(options.size, 1.0);
+        std::vector<double> b(options.size);
+
+        std::size_t const available =
+            pika::parallel::execution::processing_units_count(
+                par.parameters(), par.executor());
+
+        std::vector<std::size_t> cores;
+        for (std::size_t n = 1; n < available; n *= 2)
+        {
+            cores.push_back(n);
+        }
+        cores.push_back(available == 0 ? 1 : available);
+
+        std::vector<double> bandwidths;
+        for (std::size_t n : cores)
+        {
+            auto const policy = par.with(pika::execution::bandwidth_limit(n));
+
+            double best_time = (std::numeric_limits<double>::max)();
+            for (std::size_t i = 0; i != options.repetitions; ++i)
+            {
+                auto const start = std::chrono::steady_clock::now();
+                pika::copy(policy, a.begin(), a.end(), b.begin());
+                std::chrono::duration<double> const elapsed =
+                    std::chrono::steady_clock::now() - start;
+                best_time = (std::min)(best_time, elapsed.count());
+            }
+            bandwidths.push_back(
+                2.0 * sizeof(double) * double(options.size) / best_time);
+        }
+
+        double const highest =
+            *std::max_element(bandwidths.begin(), bandwidths.end());
+        std::size_t i = 0;
+        while (bandwidths[i] < options.saturation * highest)
+        {
+            ++i;
+        }
+
+        set_tunable(tunable::bandwidth_bound_cores, cores[i]);
+        return cores[i];
+    }
+}    // namespace pika::parallel::util
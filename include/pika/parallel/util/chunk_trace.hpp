@@ -0,0 +1,295 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/chunk_trace.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/threading_base/thread_num_tss.hpp>
+
+#include <pika/parallel/util/nesting_aware.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A chunk of iterations run by one of the partitioners.
+    struct chunk_trace_event
+    {
+        /// The kind of chunk, e.g. "partition" or "scan_f1"
+        char const* name;
+        /// The worker thread which has run the chunk (std::size_t(-1) when
+        /// run outside of the pika runtime)
+        std::size_t worker;
+        /// The number of iterations in the chunk
+        std::size_t count;
+        /// The time at which the chunk has been started and finished
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    namespace detail {
+        // Every OS thread appends the chunks it has run to its own buffer,
+        // no synchronization is required between the threads for that. The
+        // buffers are only read or cleared while no traced algorithm is
+        // running.
+        struct chunk_trace_buffer
+        {
+            std::vector<chunk_trace_event> events;
+        };
+
+        struct chunk_trace_registry
+        {
+            chunk_trace_registry()
+            {
+                // tracing can be enabled without recompiling the application
+                // by naming the file the trace is written to on exit
+                if (char const* file = std::getenv("PIKA_CHUNK_TRACE"))
+                {
+                    file_ = file;
+                    enabled_.store(!file_.empty(), std::memory_order_relaxed);
+                }
+            }
+
+            ~chunk_trace_registry();
+
+            std::shared_ptr<chunk_trace_buffer> make_buffer()
+            {
+                auto buffer = std::make_shared<chunk_trace_buffer>();
+                std::lock_guard<std::mutex> l(mtx_);
+                buffers_.push_back(buffer);
+                return buffer;
+            }
+
+            std::atomic<bool> enabled_{false};
+            std::string file_;
+            std::mutex mtx_;
+            std::vector<std::shared_ptr<chunk_trace_buffer>> buffers_;
+        };
+
+        inline chunk_trace_registry& get_chunk_trace_registry()
+        {
+            static chunk_trace_registry registry;
+            return registry;
+        }
+
+        inline chunk_trace_buffer& get_chunk_trace_buffer()
+        {
+            thread_local std::shared_ptr<chunk_trace_buffer> buffer =
+                get_chunk_trace_registry().make_buffer();
+            return *buffer;
+        }
+    }    // namespace detail
+
+    /// Enable or disable recording of the chunks run by the partitioners.
+    /// Tracing is disabled by default, unless the environment variable
+    /// PIKA_CHUNK_TRACE names a file the trace is written to on exit.
+    inline void enable_chunk_tracing(bool enable = true) noexcept
+    {
+        detail::get_chunk_trace_registry().enabled_.store(
+            enable, std::memory_order_relaxed);
+    }
+
+    /// Returns whether chunks run by the partitioners are being recorded.
+    inline bool chunk_tracing_enabled() noexcept
+    {
+        return detail::get_chunk_trace_registry().enabled_.load(
+            std::memory_order_relaxed);
+    }
+
+    /// Returns all chunks recorded so far, grouped by OS thread.
+    ///
+    /// \note This must not be called concurrently with traced algorithms.
+    inline std::vector<chunk_trace_event> get_chunk_trace()
+    {
+        auto& registry = detail::get_chunk_trace_registry();
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        std::vector<chunk_trace_event> events;
+        for (auto const& buffer : registry.buffers_)
+        {
+            events.insert(
+                events.end(), buffer->events.begin(), buffer->events.end());
+        }
+        return events;
+    }
+
+    /// Discards all chunks recorded so far.
+    ///
+    /// \note This must not be called concurrently with traced algorithms.
+    inline void clear_chunk_trace()
+    {
+        auto& registry = detail::get_chunk_trace_registry();
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        for (auto const& buffer : registry.buffers_)
+        {
+            buffer->events.clear();
+        }
+    }
+
+    /// Writes all chunks recorded so far in the Chrome trace event format
+    /// (as understood by chrome://tracing or https://ui.perfetto.dev). Every
+    /// worker thread is shown as a separate thread, the number of iterations
+    /// of a chunk is attached as an argument.
+    ///
+    /// \note This must not be called concurrently with traced algorithms.
+    inline void write_chunk_trace(std::ostream& os)
+    {
+        std::vector<chunk_trace_event> const events = get_chunk_trace();
+
+        auto const epoch = events.empty() ?
+            std::chrono::steady_clock::time_point() :
+            events.front().start;
+        auto to_us = [](std::chrono::steady_clock::duration d) {
+            return std::chrono::duration<double, std::micro>(d).count();
+        };
+
+        os << "{\"traceEvents\":[";
+        bool first = true;
+        for (auto const& e : events)
+        {
+            os << (first ? "\n" : ",\n") << "{\"name\":\"" << e.name
+               << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+               << static_cast<std::int64_t>(e.worker)
+               << ",\"ts\":" << to_us(e.start - epoch)
+               << ",\"dur\":" << to_us(e.end - e.start)
+               << ",\"args\":{\"count\":" << e.count << "}}";
+            first = false;
+        }
+        os << "\n]}\n";
+    }
+
+    namespace detail {
+        inline chunk_trace_registry::~chunk_trace_registry()
+        {
+            if (!file_.empty())
+            {
+                std::ofstream out(file_);
+                write_chunk_trace(out);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Run f() as a chunk of count iterations, recording it if tracing is
+        // enabled.
+        template <typename F>
+        decltype(auto) trace_chunk(char const* name, std::size_t count, F&& f)
+        {
+            if (!chunk_tracing_enabled())
+            {
+                return PIKA_FORWARD(F, f)();
+            }
+
+            struct recorder
+            {
+                ~recorder()
+                {
+                    get_chunk_trace_buffer().events.push_back(
+                        chunk_trace_event{name, pika::get_worker_thread_num(),
+                            count, start, std::chrono::steady_clock::now()});
+                }
+
+                char const* name;
+                std::size_t count;
+                std::chrono::steady_clock::time_point start;
+            };
+
+            recorder r{name, count, std::chrono::steady_clock::now()};
+            return PIKA_FORWARD(F, f)();
+        }
+
+        // Wraps a function object invoked as f(first, count, ...) for a chunk
+        // of count iterations. The algorithms invoked by the chunk see a
+        // nesting depth one larger than the one of the algorithm which has
+        // created it (see nesting_aware).
+        template <typename F>
+        struct traced_chunk_function
+        {
+            char const* name_;
+            F f_;
+            std::size_t depth_;
+
+            template <typename Iter, typename... Ts>
+            PIKA_HOST_DEVICE decltype(auto) operator()(
+                Iter first, std::size_t count, Ts&&... ts)
+            {
+#if defined(PIKA_COMPUTE_DEVICE_CODE)
+                return f_(first, count, PIKA_FORWARD(Ts, ts)...);
+#else
+                nesting_depth_scope scope(depth_ + 1);
+                return trace_chunk(name_, count, [&]() -> decltype(auto) {
+                    return f_(first, count, PIKA_FORWARD(Ts, ts)...);
+                });
+#endif
+            }
+        };
+
+        template <typename F>
+        traced_chunk_function<std::decay_t<F>> make_traced_chunk_function(
+            char const* name, F&& f)
+        {
+            return traced_chunk_function<std::decay_t<F>>{
+                name, PIKA_FORWARD(F, f), nesting_depth()};
+        }
+    }    // namespace detail
+}    // namespace pika::parallel::util
+
+#if defined(PIKA_HAVE_THREAD_DESCRIPTION)
+#include <pika/functional/traits/get_function_address.hpp>
+#include <pika/functional/traits/get_function_annotation.hpp>
+
+namespace pika::detail {
+    template <typename F>
+    struct get_function_address<
+        parallel::util::detail::traced_chunk_function<F>>
+    {
+        static constexpr std::size_t call(
+            parallel::util::detail::traced_chunk_function<F> const&
+                f) noexcept
+        {
+            return get_function_address<F>::call(f.f_);
+        }
+    };
+
+    template <typename F>
+    struct get_function_annotation<
+        parallel::util::detail::traced_chunk_function<F>>
+    {
+        static constexpr char const* call(
+            parallel::util::detail::traced_chunk_function<F> const&
+                f) noexcept
+        {
+            return get_function_annotation<F>::call(f.f_);
+        }
+    };
+
+#if PIKA_HAVE_ITTNOTIFY != 0 && !defined(PIKA_HAVE_APEX)
+    template <typename F>
+    struct get_function_annotation_itt<
+        parallel::util::detail::traced_chunk_function<F>>
+    {
+        static util::itt::string_handle call(
+            parallel::util::detail::traced_chunk_function<F> const&
+                f) noexcept
+        {
+            return get_function_annotation_itt<F>::call(f.f_);
+        }
+    };
+#endif
+}    // namespace pika::detail
+#endif
@@ -0,0 +1,77 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/default_init_allocator.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Allocator adaptor which default initializes instead of value
+    /// initializing default inserted elements. Resizing a container using it
+    /// does not write elements of trivially default constructible types,
+    /// which leaves them to be initialized once by a parallel algorithm
+    /// writing the results, e.g. \a pika::uninitialized_transform or
+    /// \a pika::transform, instead of zero filling them by the calling
+    /// thread first.
+    ///
+    /// All other constructions and the memory management are forwarded to
+    /// the adapted allocator.
+    ///
+    template <typename T, typename Alloc = std::allocator<T>>
+    class default_init_allocator : public Alloc
+    {
+        using traits = std::allocator_traits<Alloc>;
+
+    public:
+        /// \cond NOINTERNAL
+        template <typename U>
+        struct rebind
+        {
+            using other = default_init_allocator<U,
+                typename traits::template rebind_alloc<U>>;
+        };
+
+        using Alloc::Alloc;
+
+        default_init_allocator() = default;
+
+        template <typename U, typename OtherAlloc>
+        constexpr default_init_allocator(
+            default_init_allocator<U, OtherAlloc> const& rhs) noexcept
+          : Alloc(static_cast<OtherAlloc const&>(rhs))
+        {
+        }
+
+        template <typename U>
+        void construct(U* p) noexcept(
+            std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... ts)
+        {
+            traits::construct(
+                static_cast<Alloc&>(*this), p, PIKA_FORWARD(Ts, ts)...);
+        }
+        /// \endcond
+    };
+
+    /// A vector whose default inserted elements are default initialized,
+    /// see \a default_init_allocator
+    template <typename T>
+    using default_init_vector = std::vector<T, default_init_allocator<T>>;
+}    // namespace pika
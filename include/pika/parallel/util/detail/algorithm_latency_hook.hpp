@@ -0,0 +1,75 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Records a call of the algorithm name with an input of the given size
+    // which took ns nanoseconds.
+    using algorithm_latency_hook = void (*)(
+        char const* name, std::size_t size, std::uint64_t ns);
+
+    // The algorithms only see this hook, it is set while the recording of
+    // pika/parallel/util/algorithm_latency.hpp is enabled. The registry of
+    // the latencies is not part of the headers of the algorithms.
+    inline std::atomic<algorithm_latency_hook> algorithm_latency_recording{
+        nullptr};
+
+    inline algorithm_latency_hook get_algorithm_latency_hook() noexcept
+    {
+        return algorithm_latency_recording.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Records the time from its construction to its destruction as a call
+    // of the given algorithm.
+    class algorithm_latency_recorder
+    {
+    public:
+        algorithm_latency_recorder(algorithm_latency_hook hook,
+            char const* name, std::size_t size) noexcept
+          : hook_(hook)
+          , name_(name)
+          , size_(size)
+          , start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        algorithm_latency_recorder(algorithm_latency_recorder const&) = delete;
+        algorithm_latency_recorder& operator=(
+            algorithm_latency_recorder const&) = delete;
+
+        ~algorithm_latency_recorder()
+        {
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_)
+                    .count();
+            try
+            {
+                hook_(name_, size_, static_cast<std::uint64_t>(ns));
+            }
+            catch (...)
+            {
+                // the call is not recorded if the buffer can not grow
+            }
+        }
+
+    private:
+        algorithm_latency_hook hook_;
+        char const* name_;
+        std::size_t size_;
+        std::chrono::steady_clock::time_point start_;
+    };
+}    // namespace pika::parallel::util::detail
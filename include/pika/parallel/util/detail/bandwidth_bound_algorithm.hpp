@@ -0,0 +1,39 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    // defined in pika/parallel/util/bandwidth_limit.hpp, which reads the
+    // tunables
+    struct bandwidth_limit;
+}    // namespace pika::execution
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The algorithms whose throughput is bound by the memory bandwidth
+    // declare a static member bandwidth_bound set to true.
+    template <typename Algorithm, typename Enable = void>
+    struct is_bandwidth_bound_algorithm : std::false_type
+    {
+    };
+
+    template <typename Algorithm>
+    struct is_bandwidth_bound_algorithm<Algorithm,
+        std::enable_if_t<Algorithm::bandwidth_bound>> : std::true_type
+    {
+    };
+
+    template <typename Algorithm>
+    inline constexpr bool is_bandwidth_bound_algorithm_v =
+        is_bandwidth_bound_algorithm<Algorithm>::value;
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,216 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/modules/errors.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The number of elements copied into a buffer before it is handed to a
+    // worker if the executor parameters do not specify a chunk size.
+    inline constexpr std::size_t default_input_batch_size = 4096;
+
+    // The number of elements of a single pass range is not known up front,
+    // a chunk size requested by the executor parameters is used as the
+    // batch size if there is one.
+    template <typename ExPolicy>
+    std::size_t get_input_batch_size(ExPolicy& policy, std::size_t cores)
+    {
+        std::size_t const batch_size = execution::get_chunk_size(
+            policy.parameters(), policy.executor(),
+            [](std::size_t) -> std::size_t { return 0; }, cores,
+            cores * default_input_batch_size);
+        return batch_size != 0 ? batch_size : default_input_batch_size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Partitioner for single pass ranges, i.e. input iterators: the elements
+    // are pulled from [first, last) by the calling thread into a ring of
+    // buffers and every full buffer is handed to a worker which invokes
+    // f1(buffer_begin, size). There are at most two buffers per core in
+    // flight, a buffer is refilled once its worker has finished, such that
+    // the range is never materialized as a whole. The results of f1 are
+    // passed in the order of the elements as f2(last, results), where last
+    // is the iterator at the end of the range (f2(last) if f1 returns void).
+    //
+    // ExPolicy: execution policy
+    // R:        overall result type
+    // Result:   intermediate result type of first step
+    template <typename ExPolicy, typename R = void, typename Result = R>
+    struct batch_partitioner
+    {
+        using parameters_type = typename ExPolicy::executor_parameters_type;
+        using executor_type = typename ExPolicy::executor_type;
+
+        using scoped_parameters =
+            scoped_executor_parameters_ref<parameters_type, executor_type>;
+
+        using handle_exceptions = handle_local_exceptions<ExPolicy>;
+
+        template <typename ExPolicy_, typename InIter, typename Sent,
+            typename F1, typename F2>
+        static typename algorithm_result<ExPolicy, R>::type call(
+            ExPolicy_&& policy, InIter first, Sent last, F1&& f1, F2&& f2)
+        {
+            if constexpr (pika::is_async_execution_policy_v<ExPolicy>)
+            {
+                // the elements are read by a task which waits for the
+                // workers as needed
+                auto exec = policy.executor();
+                return algorithm_result<ExPolicy, R>::get(
+                    execution::async_execute(PIKA_MOVE(exec),
+                        [policy = PIKA_FORWARD(ExPolicy_, policy), first,
+                            last, f1 = PIKA_FORWARD(F1, f1),
+                            f2 = PIKA_FORWARD(F2, f2)]() mutable -> R {
+                            return run(policy, PIKA_MOVE(first),
+                                PIKA_MOVE(last), f1, f2);
+                        }));
+            }
+            else if constexpr (std::is_void_v<R>)
+            {
+                run(policy, PIKA_MOVE(first), PIKA_MOVE(last), f1, f2);
+                return algorithm_result<ExPolicy, R>::get();
+            }
+            else
+            {
+                return algorithm_result<ExPolicy, R>::get(
+                    run(policy, PIKA_MOVE(first), PIKA_MOVE(last), f1, f2));
+            }
+        }
+
+    private:
+        template <typename Policy, typename InIter, typename Sent, typename F1,
+            typename F2>
+        static R run(Policy& policy, InIter first, Sent last, F1& f1, F2& f2)
+        {
+            using value_type =
+                typename std::iterator_traits<InIter>::value_type;
+            using buffer_type = std::vector<value_type>;
+
+            // inform parameter traits
+            scoped_parameters scoped_params(
+                policy.parameters(), policy.executor());
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const batch_size = get_input_batch_size(policy, cores);
+            std::size_t const num_buffers = 2 * cores;
+
+            std::vector<buffer_type> buffers(num_buffers);
+            std::vector<pika::future<Result>> workitems(num_buffers);
+
+            using result_type =
+                std::conditional_t<std::is_void_v<Result>, char, Result>;
+            std::vector<result_type> results;
+            std::vector<std::exception_ptr> errors;
+
+            // wait for the worker of the given buffer and collect its result,
+            // the buffers are used in turn such that the results stay in the
+            // order of the elements
+            auto collect = [&](std::size_t buffer) {
+                pika::future<Result>& f = workitems[buffer];
+                if (!f.valid())
+                {
+                    return;
+                }
+
+                f.wait();
+                if (f.has_exception())
+                {
+                    errors.push_back(f.get_exception_ptr());
+                }
+                else if constexpr (!std::is_void_v<Result>)
+                {
+                    results.push_back(f.get());
+                }
+                f = pika::future<Result>();
+            };
+
+            std::size_t buffer = 0;
+            try
+            {
+                while (first != last && errors.empty())
+                {
+                    collect(buffer);
+
+                    buffer_type& b = buffers[buffer];
+                    b.clear();
+                    b.reserve(batch_size);
+                    for (/**/; b.size() != batch_size && first != last; ++first)
+                    {
+                        b.push_back(*first);
+                    }
+
+                    workitems[buffer] = execution::async_execute(
+                        policy.executor(), [&b, f1]() mutable -> Result {
+                            return f1(b.begin(), b.size());
+                        });
+
+                    if (++buffer == num_buffers)
+                    {
+                        buffer = 0;
+                    }
+                }
+            }
+            catch (...)
+            {
+                errors.push_back(std::current_exception());
+            }
+            scoped_params.mark_end_of_scheduling();
+
+            // the workers refer to the buffers, wait for all of them before
+            // reporting errors
+            for (std::size_t i = 0; i != num_buffers; ++i)
+            {
+                collect(buffer);
+                if (++buffer == num_buffers)
+                {
+                    buffer = 0;
+                }
+            }
+
+            if (!errors.empty())
+            {
+                std::list<std::exception_ptr> exceptions;
+                for (std::exception_ptr const& e : errors)
+                {
+                    handle_exceptions::call(e, exceptions);
+                }
+                throw exception_list(PIKA_MOVE(exceptions));
+            }
+
+            if constexpr (std::is_void_v<Result>)
+            {
+                return f2(PIKA_MOVE(first));
+            }
+            else
+            {
+                return f2(PIKA_MOVE(first), PIKA_MOVE(results));
+            }
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
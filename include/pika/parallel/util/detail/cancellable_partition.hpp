@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    // Chunks are scheduled lazily only for synchronous policies (the
+    // asynchronous partitioners need one future per chunk up front).
+    // Partitioning schemes which determine the worker of a chunk by
+    // themselves take precedence.
+    template <typename ExPolicy, typename FwdIter>
+    inline constexpr bool use_cancellable_partitioner_v =
+        !pika::is_async_execution_policy_v<std::decay_t<ExPolicy>> &&
+        !use_work_stealing_partitioner_v<ExPolicy, FwdIter> &&
+        !use_chunk_placement_v<ExPolicy>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run f on all chunks of [first, first + count) which have not been
+    // cancelled when they are about to be started. Instead of creating one
+    // task per chunk up front, one task per worker repeatedly claims the next
+    // chunk through a shared counter. is_cancelled(base_idx) is invoked with
+    // the index of the first element of a chunk and the chunk is skipped if
+    // it returns true, no tasks are created for the remaining chunks after
+    // the algorithm has been cancelled. The returned futures refer to the
+    // chunks which have actually been run, in the order of the sequence.
+    template <typename Result, bool WithIndex, typename ExPolicy,
+        typename FwdIter, typename Stride, typename F, typename Cancelled>
+    std::vector<pika::future<Result>> partition_cancellable(ExPolicy&& policy,
+        FwdIter first, std::size_t count, Stride stride, F&& f,
+        Cancelled&& is_cancelled)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+        using has_variable_chunk_size =
+            typename execution::extract_has_variable_chunk_size<
+                parameters_type>::type;
+
+        auto traced_f =
+            util::detail::make_traced_chunk_function("partition", f);
+
+        // the chunk which may be run inline by the executor parameters to
+        // determine the chunk size is reported first
+        std::size_t const initial_count = count;
+        std::vector<pika::future<Result>> inititems;
+
+        // all chunks are recorded as (iterator, size, base index)
+        std::vector<std::tuple<FwdIter, std::size_t, std::size_t>> chunks;
+        if constexpr (WithIndex)
+        {
+            auto shape = get_bulk_iteration_shape_idx(
+                has_variable_chunk_size{}, policy, inititems, traced_f, first,
+                count, stride);
+            for (auto&& chunk : shape)
+            {
+                chunks.emplace_back(std::get<0>(chunk), std::get<1>(chunk),
+                    std::get<2>(chunk));
+            }
+        }
+        else
+        {
+            auto shape = get_bulk_iteration_shape(has_variable_chunk_size{},
+                policy, inititems, traced_f, first, count, stride);
+
+            std::size_t base_idx = initial_count - count;
+            for (auto&& chunk : shape)
+            {
+                chunks.emplace_back(
+                    std::get<0>(chunk), std::get<1>(chunk), base_idx);
+                base_idx += std::get<1>(chunk);
+            }
+        }
+
+        std::size_t const num_chunks = chunks.size();
+        std::vector<pika::future<Result>> results(num_chunks);
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_workers =
+            (std::max)((std::min)(cores, num_chunks), std::size_t(1));
+
+        auto run_chunk = [&](std::size_t k) {
+            auto& [it, size, base_idx] = chunks[k];
+            if constexpr (std::is_void_v<Result>)
+            {
+                if constexpr (WithIndex)
+                    traced_f(it, size, base_idx);
+                else
+                    traced_f(it, size);
+                results[k] = pika::make_ready_future();
+            }
+            else if constexpr (WithIndex)
+            {
+                results[k] = pika::make_ready_future(
+                    traced_f(it, size, base_idx));
+            }
+            else
+            {
+                results[k] = pika::make_ready_future(traced_f(it, size));
+            }
+        };
+
+        std::atomic<std::size_t> next_chunk(0);
+        auto worker = [&](std::size_t) {
+            std::size_t k;
+            while ((k = next_chunk.fetch_add(1, std::memory_order_relaxed)) <
+                num_chunks)
+            {
+                if (is_cancelled(std::get<2>(chunks[k])))
+                    continue;
+
+                try
+                {
+                    run_chunk(k);
+                }
+                catch (...)
+                {
+                    results[k] = pika::make_exceptional_future<Result>(
+                        std::current_exception());
+                }
+            }
+        };
+
+        std::vector<pika::future<void>> workers =
+            execution::bulk_async_execute(policy.executor(), worker,
+                pika::detail::irange(std::size_t(0), num_workers));
+        pika::wait_all_nothrow(workers);
+
+        std::vector<pika::future<Result>> workitems = PIKA_MOVE(inititems);
+        for (auto& r : results)
+        {
+            if (r.valid())
+                workitems.push_back(PIKA_MOVE(r));
+        }
+
+        // propagate errors which escaped the workers themselves
+        for (auto& w : workers)
+        {
+            if (w.has_exception())
+            {
+                workitems.push_back(pika::make_exceptional_future<Result>(
+                    w.get_exception_ptr()));
+            }
+        }
+
+        return workitems;
+    }
+}    // namespace pika::parallel::detail
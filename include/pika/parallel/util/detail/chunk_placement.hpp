@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/coroutines/thread_enums.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/properties/property.hpp>
+#include <pika/threading_base/thread_num_tss.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/affinity_partitioner.hpp>
+#include <pika/parallel/util/numa_chunk_placement.hpp>
+#include <pika/parallel/util/worker_subset.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    // Executor parameters which determine the worker thread each chunk is
+    // scheduled on expose get_chunk_worker(chunk, cores).
+    template <typename Parameters>
+    struct is_chunk_placement_parameters : std::false_type
+    {
+    };
+
+    template <>
+    struct is_chunk_placement_parameters<
+        pika::execution::numa_chunk_placement> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_chunk_placement_parameters<
+        pika::execution::affinity_partitioner> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_chunk_placement_parameters<pika::execution::worker_subset>
+      : std::true_type
+    {
+    };
+
+    // Executor parameters which want to be told which worker thread has
+    // executed each chunk expose record_chunk_worker(chunk, worker).
+    template <typename Parameters>
+    struct is_chunk_recording_parameters : std::false_type
+    {
+    };
+
+    template <>
+    struct is_chunk_recording_parameters<
+        pika::execution::affinity_partitioner> : std::true_type
+    {
+    };
+
+    template <typename ExPolicy>
+    inline constexpr bool use_chunk_placement_v =
+        is_chunk_placement_parameters<typename std::decay_t<
+            ExPolicy>::executor_parameters_type>::value;
+
+    template <typename ExPolicy>
+    inline constexpr bool use_chunk_recording_v =
+        is_chunk_recording_parameters<typename std::decay_t<
+            ExPolicy>::executor_parameters_type>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the executor to be used for running the given chunk. This is the
+    // executor of the policy, unless the executor parameters request the
+    // chunk to be placed on a particular worker thread.
+    template <typename ExPolicy>
+    decltype(auto) get_chunk_executor(
+        ExPolicy&& policy, std::size_t chunk, std::size_t cores)
+    {
+        if constexpr (use_chunk_placement_v<ExPolicy>)
+        {
+            std::size_t const worker =
+                policy.parameters().get_chunk_worker(chunk, cores);
+
+            pika::execution::thread_schedule_hint hint;
+            if (worker != std::size_t(-1))
+            {
+                hint = pika::execution::thread_schedule_hint(
+                    static_cast<std::int16_t>(worker));
+            }
+            return pika::experimental::prefer(
+                pika::execution::experimental::with_hint, policy.executor(),
+                hint);
+        }
+        else
+        {
+            PIKA_UNUSED(chunk);
+            PIKA_UNUSED(cores);
+            return policy.executor();
+        }
+    }
+
+    // Inform the executor parameters about the worker thread executing the
+    // given chunk, must be called from the chunk itself.
+    template <typename Parameters>
+    void record_chunk_worker(Parameters const& params, std::size_t chunk)
+    {
+        if constexpr (is_chunk_recording_parameters<Parameters>::value)
+        {
+            params.record_chunk_worker(chunk, pika::get_worker_thread_num());
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+            PIKA_UNUSED(chunk);
+        }
+    }
+
+    template <typename Parameters, typename F>
+    struct recording_chunk_iteration
+    {
+        Parameters params_;
+        F f_;
+        std::size_t chunk_;
+
+        template <typename T>
+        decltype(auto) operator()(T&& t)
+        {
+            record_chunk_worker(params_, chunk_);
+            return f_(PIKA_FORWARD(T, t));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Schedule one task per element of the shape. This is equivalent to
+    // bulk_async_execute on the executor of the policy, except for the
+    // executor parameters requesting explicit placement of the chunks, in
+    // which case every chunk is scheduled separately on its worker thread.
+    template <typename Result, typename ExPolicy, typename F, typename Shape>
+    std::vector<pika::future<Result>> bulk_async_execute_chunks(
+        ExPolicy&& policy, F&& f, Shape&& shape)
+    {
+        if constexpr (use_chunk_placement_v<ExPolicy>)
+        {
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+
+            std::vector<pika::future<Result>> workitems;
+            workitems.reserve(pika::util::size(shape));
+
+            std::size_t chunk = 0;
+            for (auto&& elem : shape)
+            {
+                if constexpr (use_chunk_recording_v<ExPolicy>)
+                {
+                    workitems.push_back(execution::async_execute(
+                        get_chunk_executor(policy, chunk, cores),
+                        recording_chunk_iteration<parameters_type,
+                            std::decay_t<F>>{policy.parameters(), f, chunk},
+                        elem));
+                }
+                else
+                {
+                    workitems.push_back(execution::async_execute(
+                        get_chunk_executor(policy, chunk, cores), f, elem));
+                }
+                ++chunk;
+            }
+            return workitems;
+        }
+        else
+        {
+            return execution::bulk_async_execute(policy.executor(),
+                PIKA_FORWARD(F, f), PIKA_FORWARD(Shape, shape));
+        }
+    }
+}    // namespace pika::parallel::detail
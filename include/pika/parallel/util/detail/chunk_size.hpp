@@ -15,6 +15,7 @@
 #include <pika/execution/executors/execution_parameters.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/aligned_chunks.hpp>
 #include <pika/parallel/util/detail/chunk_size_iterator.hpp>
 
 #include <algorithm>
@@ -167,6 +168,30 @@ namespace pika::parallel::detail {
             // clang-format on
         }
 
+        if constexpr (util::detail::has_aligned_chunks_v<
+                          decltype(policy.parameters())>)
+        {
+            // the elements up to the first aligned element of the
+            // destination are run right away, the boundaries of all other
+            // chunks are aligned
+            std::size_t elements = 0;
+            std::size_t head = util::detail::get_aligned_chunks_head(
+                begin, policy.parameters().get_alignment(), elements);
+            if (stride == 1 && elements != 0)
+            {
+                if (head != 0 && head < count)
+                {
+                    add_ready_future(workitems, f1, begin, head);
+
+                    // modifies 'head'
+                    begin = parallel::detail::next(begin, count, head);
+                    count -= head;
+                }
+                chunk_size =
+                    ((chunk_size + elements - 1) / elements) * elements;
+            }
+        }
+
         using iterator = chunk_size_iterator<FwdIter>;
 
         iterator shape_begin(begin, chunk_size, count);
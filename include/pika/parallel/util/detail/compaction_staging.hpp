@@ -0,0 +1,85 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/synchronization/spinlock.hpp>
+#include <pika/parallel/util/stream_compaction.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    template <typename Parameters>
+    constexpr pika::execution::stream_compaction_mode
+    select_stream_compaction(Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::stream_compaction>)
+        {
+            return params.get_stream_compaction_mode();
+        }
+        else
+        {
+            return pika::execution::stream_compaction_mode::flags;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements kept by the chunks of a stream compaction, keyed by the
+    // position of the first element of the chunk. Step 1 of a chunk stores
+    // its elements, step 3 of the same chunk takes them out again. Copies of
+    // a compaction_staging refer to the same buffers.
+    template <typename T>
+    class compaction_staging
+    {
+        struct shared_state
+        {
+            pika::spinlock mtx;
+            std::unordered_map<std::size_t, std::vector<T>> chunks;
+        };
+
+    public:
+        compaction_staging()
+          : state_(std::make_shared<shared_state>())
+        {
+        }
+
+        void put(std::size_t pos, std::vector<T>&& elements) const
+        {
+            std::lock_guard<pika::spinlock> l(state_->mtx);
+            state_->chunks.emplace(pos, PIKA_MOVE(elements));
+        }
+
+        std::vector<T> take(std::size_t pos) const
+        {
+            std::lock_guard<pika::spinlock> l(state_->mtx);
+            auto it = state_->chunks.find(pos);
+            PIKA_ASSERT(it != state_->chunks.end());
+            if (it == state_->chunks.end())
+            {
+                return std::vector<T>();
+            }
+
+            std::vector<T> elements = PIKA_MOVE(it->second);
+            state_->chunks.erase(it);
+            return elements;
+        }
+
+    private:
+        std::shared_ptr<shared_state> state_;
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,741 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+// The kernels are only available when compiling with the CUDA or HIP compiler
+#if defined(PIKA_HAVE_GPU_SUPPORT) && defined(PIKA_COMPUTE_CODE)
+#include <pika/async_cuda/cuda_exception.hpp>
+#include <pika/async_cuda/custom_gpu_api.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of threads per block of all device kernels and the number
+    // of consecutive elements a thread of the scan kernel processes.
+    inline constexpr unsigned device_block_size = 256;
+    inline constexpr unsigned device_scan_items = 4;
+    inline constexpr std::size_t device_scan_tile_size =
+        std::size_t(device_block_size) * device_scan_items;
+
+    // The grid-stride kernels use at most this many blocks.
+    inline constexpr std::size_t device_max_blocks = 65535;
+
+    // The partial results of the first reduction pass.
+    inline constexpr std::size_t device_max_reduce_blocks = 1024;
+
+    inline unsigned device_num_blocks(
+        std::size_t count, std::size_t max_blocks = device_max_blocks)
+    {
+        return static_cast<unsigned>((std::min)(
+            (count + device_block_size - 1) / device_block_size, max_blocks));
+    }
+
+    // Scratch memory is handed out in pieces of this alignment.
+    inline constexpr std::size_t device_aligned(std::size_t size) noexcept
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Device memory holding the scratch data of an algorithm. The algorithms
+    // pass it on until their kernels have completed.
+    class device_buffer
+    {
+    public:
+        device_buffer() = default;
+
+        explicit device_buffer(std::size_t size)
+        {
+            if (size != 0)
+            {
+                pika::cuda::experimental::check_cuda_error(
+                    cudaMalloc(&data_, size));
+            }
+        }
+
+        device_buffer(device_buffer&& other) noexcept
+          : data_(std::exchange(other.data_, nullptr))
+        {
+        }
+
+        device_buffer& operator=(device_buffer&& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            return *this;
+        }
+
+        ~device_buffer()
+        {
+            if (data_ != nullptr)
+            {
+                cudaFree(data_);
+            }
+        }
+
+        template <typename T>
+        T* get(std::size_t offset = 0) const noexcept
+        {
+            return reinterpret_cast<T*>(static_cast<char*>(data_) + offset);
+        }
+
+    private:
+        void* data_ = nullptr;
+    };
+
+    // Page-locked host memory, which the device copies from and to
+    // asynchronously.
+    class pinned_buffer
+    {
+    public:
+        pinned_buffer() = default;
+
+        explicit pinned_buffer(std::size_t size)
+        {
+            if (size != 0)
+            {
+                pika::cuda::experimental::check_cuda_error(
+                    cudaMallocHost(&data_, size));
+            }
+        }
+
+        pinned_buffer(pinned_buffer&& other) noexcept
+          : data_(std::exchange(other.data_, nullptr))
+        {
+        }
+
+        pinned_buffer& operator=(pinned_buffer&& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            return *this;
+        }
+
+        ~pinned_buffer()
+        {
+            if (data_ != nullptr)
+            {
+                cudaFreeHost(data_);
+            }
+        }
+
+        template <typename T>
+        T* get() const noexcept
+        {
+            return static_cast<T*>(data_);
+        }
+
+    private:
+        void* data_ = nullptr;
+    };
+
+    // The result of an algorithm copied back to the host, together with the
+    // scratch memory of the kernels which computed it.
+    template <typename T>
+    struct device_value
+    {
+        device_buffer buffer;
+        std::unique_ptr<T> value;
+    };
+
+    struct device_plus
+    {
+        template <typename T, typename U>
+        PIKA_HOST_DEVICE auto operator()(T const& lhs, U const& rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+
+    template <typename T>
+    struct device_load
+    {
+        T const* first;
+
+        __device__ T operator()(std::size_t i) const
+        {
+            return first[i];
+        }
+    };
+
+    template <typename T, typename Convert>
+    struct device_transform_load
+    {
+        T const* first;
+        Convert conv;
+
+        __device__ auto operator()(std::size_t i) const
+        {
+            return conv(first[i]);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs f(i) for all i in [0, count), every thread handles the indices
+    // which are a multiple of the grid size apart.
+    template <typename F>
+    __global__ void __launch_bounds__(device_block_size)
+        device_bulk_kernel(std::size_t count, F f)
+    {
+        std::size_t const stride = std::size_t(gridDim.x) * blockDim.x;
+        for (std::size_t i = std::size_t(blockIdx.x) * blockDim.x + threadIdx.x;
+             i < count; i += stride)
+        {
+            f(i);
+        }
+    }
+
+    template <typename F>
+    void device_bulk(cudaStream_t stream, std::size_t count, F f)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        device_bulk_kernel<<<device_num_blocks(count), device_block_size, 0,
+            stream>>>(count, PIKA_MOVE(f));
+        pika::cuda::experimental::check_cuda_error(cudaGetLastError());
+    }
+
+    template <typename T, typename F>
+    struct device_for_each_body
+    {
+        T* first;
+        F f;
+
+        __device__ void operator()(std::size_t i)
+        {
+            f(first[i]);
+        }
+    };
+
+    template <typename T, typename U, typename F>
+    struct device_transform_body
+    {
+        T* first;
+        U* dest;
+        F f;
+
+        __device__ void operator()(std::size_t i)
+        {
+            dest[i] = f(first[i]);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every block reduces its part of the range to a single partial result.
+    // The number of blocks never exceeds the number of elements divided by
+    // the block size, the threads holding a value thus form a prefix of
+    // each block.
+    template <typename T, typename Load, typename Op>
+    __global__ void __launch_bounds__(device_block_size)
+        device_reduce_kernel(std::size_t count, Load load, Op op, T* partials)
+    {
+        __shared__ T values[device_block_size];
+
+        std::size_t const stride = std::size_t(gridDim.x) * blockDim.x;
+        std::size_t const block_first = std::size_t(blockIdx.x) * blockDim.x;
+        std::size_t i = block_first + threadIdx.x;
+        if (i < count)
+        {
+            T value = load(i);
+            for (i += stride; i < count; i += stride)
+            {
+                value = op(value, load(i));
+            }
+            values[threadIdx.x] = value;
+        }
+        __syncthreads();
+
+        unsigned const num_valid = count - block_first < blockDim.x ?
+            static_cast<unsigned>(count - block_first) :
+            blockDim.x;
+        for (unsigned s = 1; s < num_valid; s *= 2)
+        {
+            if (threadIdx.x % (2 * s) == 0 && threadIdx.x + s < num_valid)
+            {
+                values[threadIdx.x] =
+                    op(values[threadIdx.x], values[threadIdx.x + s]);
+            }
+            __syncthreads();
+        }
+
+        if (threadIdx.x == 0)
+        {
+            partials[blockIdx.x] = values[0];
+        }
+    }
+
+    template <typename T, typename Op>
+    struct device_reduce_init
+    {
+        T* result;
+        T init;
+        Op op;
+
+        __device__ void operator()(std::size_t)
+        {
+            *result = op(init, *result);
+        }
+    };
+
+    // Reduces the count values returned by load, together with init, in two
+    // passes: the blocks of the first one compute partial results, a single
+    // block reduces those. The result is copied back to the host.
+    template <typename T, typename Load, typename Op>
+    device_value<T> device_reduce(
+        cudaStream_t stream, std::size_t count, Load load, T init, Op op)
+    {
+        static_assert(std::is_trivially_copyable_v<T> &&
+                std::is_trivially_default_constructible_v<T>,
+            "the device algorithms reduce trivial types only");
+
+        device_value<T> result{device_buffer(), std::make_unique<T>(init)};
+        if (count == 0)
+        {
+            return result;
+        }
+
+        unsigned const num_blocks =
+            device_num_blocks(count, device_max_reduce_blocks);
+        result.buffer = device_buffer((num_blocks + 1) * sizeof(T));
+        T* partials = result.buffer.template get<T>();
+        T* total = partials + num_blocks;
+
+        device_reduce_kernel<<<num_blocks, device_block_size, 0, stream>>>(
+            count, load, op, partials);
+        device_reduce_kernel<<<1, device_block_size, 0, stream>>>(
+            std::size_t(num_blocks), device_load<T>{partials}, op, total);
+        device_bulk(
+            stream, 1, device_reduce_init<T, Op>{total, PIKA_MOVE(init), op});
+
+        pika::cuda::experimental::check_cuda_error(
+            cudaMemcpyAsync(result.value.get(), total, sizeof(T),
+                cudaMemcpyDeviceToHost, stream));
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The single pass scan with decoupled look-back: every block scans one
+    // tile of device_scan_tile_size elements and publishes the aggregate of
+    // its tile right away. It then looks back at the preceding tiles, adding
+    // up their aggregates until it finds one which already published its
+    // inclusive prefix. The tiles are handed out in order through a counter,
+    // all tiles a block waits for belong to blocks which are running.
+    template <typename T>
+    struct device_scan_state
+    {
+        enum : unsigned
+        {
+            invalid = 0,
+            aggregate = 1,
+            inclusive = 2
+        };
+
+        unsigned* flags;
+        unsigned* tile_counter;
+        T* aggregates;
+        T* inclusives;
+    };
+
+    template <typename T>
+    std::size_t device_scan_state_size(std::size_t count) noexcept
+    {
+        std::size_t const num_tiles =
+            (count + device_scan_tile_size - 1) / device_scan_tile_size;
+        return device_aligned((num_tiles + 1) * sizeof(unsigned)) +
+            2 * device_aligned(num_tiles * sizeof(T));
+    }
+
+    template <typename T>
+    device_scan_state<T> make_device_scan_state(
+        device_buffer const& buffer, std::size_t offset, std::size_t count)
+    {
+        std::size_t const num_tiles =
+            (count + device_scan_tile_size - 1) / device_scan_tile_size;
+        std::size_t const flags_size =
+            device_aligned((num_tiles + 1) * sizeof(unsigned));
+        std::size_t const values_size = device_aligned(num_tiles * sizeof(T));
+
+        unsigned* flags = buffer.template get<unsigned>(offset);
+        return {flags, flags + num_tiles,
+            buffer.template get<T>(offset + flags_size),
+            buffer.template get<T>(offset + flags_size + values_size)};
+    }
+
+    // The values exchanged between blocks bypass the (incoherent) L1 cache.
+    template <typename T>
+    __device__ T device_volatile_load(T const* p)
+    {
+        T result;
+        auto src = reinterpret_cast<unsigned char const volatile*>(p);
+        auto* dst = reinterpret_cast<unsigned char*>(&result);
+        for (std::size_t i = 0; i != sizeof(T); ++i)
+        {
+            dst[i] = src[i];
+        }
+        return result;
+    }
+
+    template <typename T>
+    __device__ void device_volatile_store(T* p, T const& value)
+    {
+        auto const* src = reinterpret_cast<unsigned char const*>(&value);
+        auto dst = reinterpret_cast<unsigned char volatile*>(p);
+        for (std::size_t i = 0; i != sizeof(T); ++i)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    template <typename T>
+    __device__ void device_scan_publish(device_scan_state<T> const& state,
+        unsigned tile, T const& value, unsigned flag)
+    {
+        device_volatile_store(
+            (flag == device_scan_state<T>::inclusive ? state.inclusives :
+                                                       state.aggregates) +
+                tile,
+            value);
+        __threadfence();
+        *reinterpret_cast<unsigned volatile*>(state.flags + tile) = flag;
+    }
+
+    template <typename T, typename Op>
+    __device__ T device_scan_look_back(
+        device_scan_state<T> const& state, unsigned tile, Op& op)
+    {
+        auto const wait = [&](unsigned predecessor) {
+            unsigned flag;
+            do
+            {
+                flag = *reinterpret_cast<unsigned const volatile*>(
+                    state.flags + predecessor);
+            } while (flag == device_scan_state<T>::invalid);
+            __threadfence();
+            return flag;
+        };
+        auto const value = [&](unsigned predecessor, unsigned flag) {
+            return device_volatile_load(
+                (flag == device_scan_state<T>::inclusive ? state.inclusives :
+                                                           state.aggregates) +
+                predecessor);
+        };
+
+        // the first tile always publishes its inclusive prefix
+        unsigned predecessor = tile - 1;
+        unsigned flag = wait(predecessor);
+        T prefix = value(predecessor, flag);
+        while (flag != device_scan_state<T>::inclusive)
+        {
+            --predecessor;
+            flag = wait(predecessor);
+            prefix = op(value(predecessor, flag), prefix);
+        }
+        return prefix;
+    }
+
+    template <bool Exclusive, bool HasInit, typename T, typename Load,
+        typename Out, typename Op>
+    __global__ void __launch_bounds__(device_block_size)
+        device_scan_kernel(std::size_t count, Load load, Out* dest, T init,
+            Op op, device_scan_state<T> state)
+    {
+        static_assert(!Exclusive || HasInit);
+
+        __shared__ T totals[device_block_size];
+        __shared__ T tile_prefix;
+        __shared__ unsigned tile_index;
+
+        if (threadIdx.x == 0)
+        {
+            tile_index = atomicAdd(state.tile_counter, 1u);
+        }
+        __syncthreads();
+
+        unsigned const tile = tile_index;
+        std::size_t const tile_first =
+            std::size_t(tile) * device_scan_tile_size;
+        std::size_t const tile_count =
+            count - tile_first < device_scan_tile_size ?
+            count - tile_first :
+            device_scan_tile_size;
+        unsigned const num_valid = static_cast<unsigned>(
+            (tile_count + device_scan_items - 1) / device_scan_items);
+        std::size_t const first =
+            tile_first + std::size_t(threadIdx.x) * device_scan_items;
+
+        // every thread scans its consecutive elements
+        T partial[device_scan_items];
+        unsigned n = 0;
+        if (threadIdx.x < num_valid)
+        {
+            std::size_t const rest =
+                tile_count - std::size_t(threadIdx.x) * device_scan_items;
+            n = rest < device_scan_items ? static_cast<unsigned>(rest) :
+                                           device_scan_items;
+            partial[0] = load(first);
+#pragma unroll
+            for (unsigned k = 1; k < device_scan_items; ++k)
+            {
+                if (k < n)
+                {
+                    partial[k] = op(partial[k - 1], load(first + k));
+                }
+            }
+            totals[threadIdx.x] = partial[n - 1];
+        }
+        __syncthreads();
+
+        // the block scans the totals of its threads
+        for (unsigned offset = 1; offset < num_valid; offset *= 2)
+        {
+            bool const update =
+                threadIdx.x >= offset && threadIdx.x < num_valid;
+            T value;
+            if (update)
+            {
+                value = op(totals[threadIdx.x - offset], totals[threadIdx.x]);
+            }
+            __syncthreads();
+            if (update)
+            {
+                totals[threadIdx.x] = value;
+            }
+            __syncthreads();
+        }
+
+        if (threadIdx.x == 0)
+        {
+            T const tile_aggregate = totals[num_valid - 1];
+            if (tile == 0)
+            {
+                if constexpr (HasInit)
+                {
+                    tile_prefix = init;
+                    device_scan_publish(state, tile, op(init, tile_aggregate),
+                        device_scan_state<T>::inclusive);
+                }
+                else
+                {
+                    device_scan_publish(state, tile, tile_aggregate,
+                        device_scan_state<T>::inclusive);
+                }
+            }
+            else
+            {
+                device_scan_publish(state, tile, tile_aggregate,
+                    device_scan_state<T>::aggregate);
+                T const prefix = device_scan_look_back(state, tile, op);
+                device_scan_publish(state, tile, op(prefix, tile_aggregate),
+                    device_scan_state<T>::inclusive);
+                tile_prefix = prefix;
+            }
+        }
+        __syncthreads();
+
+        if (threadIdx.x >= num_valid)
+        {
+            return;
+        }
+
+        // the combined value of all elements preceding those of this thread
+        bool has_prefix = HasInit || tile != 0;
+        T prefix;
+        if (has_prefix)
+        {
+            prefix = tile_prefix;
+        }
+        if (threadIdx.x != 0)
+        {
+            prefix = has_prefix ? op(prefix, totals[threadIdx.x - 1]) :
+                                  totals[threadIdx.x - 1];
+            has_prefix = true;
+        }
+
+#pragma unroll
+        for (unsigned k = 0; k < device_scan_items; ++k)
+        {
+            if (k < n)
+            {
+                if constexpr (Exclusive)
+                {
+                    dest[first + k] =
+                        k == 0 ? prefix : op(prefix, partial[k - 1]);
+                }
+                else
+                {
+                    dest[first + k] =
+                        has_prefix ? op(prefix, partial[k]) : partial[k];
+                }
+            }
+        }
+    }
+
+    // Launches the scan of the count values returned by load into dest
+    // using the given (unused) scratch state. The elements may be scanned
+    // in place.
+    template <bool Exclusive, bool HasInit, typename T, typename Load,
+        typename Out, typename Op>
+    void device_scan_launch(cudaStream_t stream, std::size_t count, Load load,
+        Out* dest, T init, Op op, device_scan_state<T> const& state)
+    {
+        static_assert(std::is_trivially_copyable_v<T> &&
+                std::is_trivially_default_constructible_v<T>,
+            "the device algorithms scan trivial types only");
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::size_t const num_tiles =
+            (count + device_scan_tile_size - 1) / device_scan_tile_size;
+        pika::cuda::experimental::check_cuda_error(cudaMemsetAsync(
+            state.flags, 0, (num_tiles + 1) * sizeof(unsigned), stream));
+
+        device_scan_kernel<Exclusive, HasInit>
+            <<<static_cast<unsigned>(num_tiles), device_block_size, 0,
+                stream>>>(count, PIKA_MOVE(load), dest, PIKA_MOVE(init),
+                PIKA_MOVE(op), state);
+        pika::cuda::experimental::check_cuda_error(cudaGetLastError());
+    }
+
+    template <bool Exclusive, bool HasInit, typename T, typename Load,
+        typename Out, typename Op>
+    device_buffer device_scan(cudaStream_t stream, std::size_t count,
+        Load load, Out* dest, T init, Op op)
+    {
+        device_buffer buffer(
+            count == 0 ? 0 : device_scan_state_size<T>(count));
+        device_scan_launch<Exclusive, HasInit>(stream, count,
+            PIKA_MOVE(load), dest, PIKA_MOVE(init), PIKA_MOVE(op),
+            make_device_scan_state<T>(buffer, 0, count));
+        return buffer;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The bits of an arithmetic value, arranged such that their unsigned
+    // order is the order of the values.
+    template <typename T>
+    struct device_radix_key
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+            "the device sort supports arithmetic types only");
+
+        using bits_type = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+            std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                    std::uint64_t>>>;
+
+        static constexpr unsigned num_bits = 8 * sizeof(T);
+
+        __device__ static bits_type get(T value)
+        {
+            bits_type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            constexpr bits_type sign =
+                bits_type(bits_type(1) << (num_bits - 1));
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                return (bits & sign) ? bits_type(~bits) :
+                                       bits_type(bits | sign);
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                return bits_type(bits ^ sign);
+            }
+            else
+            {
+                return bits;
+            }
+        }
+    };
+
+    template <typename T>
+    struct device_radix_bit
+    {
+        T const* keys;
+        unsigned bit;
+
+        __device__ std::size_t operator()(std::size_t i) const
+        {
+            return (device_radix_key<T>::get(keys[i]) >> bit) & 1u;
+        }
+    };
+
+    // Moves the elements whose bit is not set in front of the others, both
+    // keep their order. ones_before holds the number of set bits preceding
+    // every element.
+    template <typename T>
+    struct device_radix_scatter
+    {
+        T const* keys;
+        T* dest;
+        std::size_t const* ones_before;
+        std::size_t count;
+        unsigned bit;
+
+        __device__ void operator()(std::size_t i) const
+        {
+            device_radix_bit<T> const bit_of{keys, bit};
+            std::size_t const num_zeros =
+                count - (ones_before[count - 1] + bit_of(count - 1));
+            std::size_t const pos =
+                bit_of(i) ? num_zeros + ones_before[i] : i - ones_before[i];
+            dest[pos] = keys[i];
+        }
+    };
+
+    // Sorts [first, first + count) with a stable binary LSD radix sort: for
+    // every bit of the keys an exclusive scan counts the set bits, followed
+    // by a stable partition into a second array. The number of bits is
+    // even, the sorted keys end up in the original array.
+    template <typename T>
+    device_buffer device_radix_sort(
+        cudaStream_t stream, T* first, std::size_t count)
+    {
+        if (count < 2)
+        {
+            return {};
+        }
+
+        std::size_t const keys_size = device_aligned(count * sizeof(T));
+        std::size_t const counts_size =
+            device_aligned(count * sizeof(std::size_t));
+        device_buffer buffer(keys_size + counts_size +
+            device_scan_state_size<std::size_t>(count));
+
+        T* keys[2] = {first, buffer.template get<T>()};
+        std::size_t* ones_before =
+            buffer.template get<std::size_t>(keys_size);
+        auto const state = make_device_scan_state<std::size_t>(
+            buffer, keys_size + counts_size, count);
+
+        for (unsigned bit = 0; bit != device_radix_key<T>::num_bits; ++bit)
+        {
+            T* src = keys[bit % 2];
+            T* dest = keys[(bit + 1) % 2];
+            device_scan_launch<true, true>(stream, count,
+                device_radix_bit<T>{src, bit}, ones_before, std::size_t(0),
+                device_plus{}, state);
+            device_bulk(stream, count,
+                device_radix_scatter<T>{src, dest, ones_before, count, bit});
+        }
+        return buffer;
+    }
+}    // namespace pika::parallel::detail
+#endif
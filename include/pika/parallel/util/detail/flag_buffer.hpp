@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The stream compaction algorithms (copy_if, remove_if, unique,
+    // partition_copy, ...) handle inputs with fewer elements than this
+    // sequentially, without allocating any flags.
+    inline constexpr std::size_t flag_buffer_sequential_limit = 4096;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // One flag per element, packed into words of 64 bits. Copies of a
+    // flag_buffer refer to the same flags. The flags of a chunk are set by a
+    // single task, the words it shares with the neighbouring chunks are
+    // combined atomically once per word, not once per flag.
+    class flag_buffer
+    {
+    public:
+        using word_type = std::uint64_t;
+        static constexpr std::size_t bits_per_word = 64;
+
+        flag_buffer() = default;
+
+        // the flags of large inputs are placed on huge pages, see
+        // allocate_scratch
+        explicit flag_buffer(std::size_t count)
+          : flag_buffer(count, util::detail::scratch_memory_reservation())
+        {
+        }
+
+        // the flags are released from the usage object of the reservation
+        // (if any) once the last copy is gone, the reservation has to hold
+        // size_in_bytes(count) bytes
+        flag_buffer(std::size_t count,
+            util::detail::scratch_memory_reservation&& reservation)
+        {
+            std::size_t const words = num_words(count);
+            auto* p = static_cast<std::atomic<word_type>*>(
+                util::detail::allocate_scratch(
+                    words * sizeof(std::atomic<word_type>)));
+            if (p == nullptr && words != 0)
+            {
+                throw std::bad_alloc();
+            }
+
+            std::size_t const bytes = reservation.bytes();
+            words_.reset(p,
+                [usage = reservation.detach(), bytes](
+                    std::atomic<word_type>* p) {
+                    util::detail::deallocate_scratch(p);
+                    if (usage != nullptr)
+                    {
+                        usage->release(bytes);
+                    }
+                });
+            for (std::size_t i = 0; i != words; ++i)
+            {
+                ::new (p + i) std::atomic<word_type>(0);
+            }
+        }
+
+        // Sets the flags [pos, pos + count) to the results of count
+        // consecutive calls to next(), returns the number of flags which were
+        // set to true.
+        template <typename F>
+        std::size_t set(std::size_t pos, std::size_t count, F&& next) const
+        {
+            std::size_t num_set = 0;
+            while (count != 0)
+            {
+                std::size_t const bit = pos % bits_per_word;
+                std::size_t const n = (std::min)(bits_per_word - bit, count);
+
+                word_type bits = 0;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    word_type const flag = next() ? 1 : 0;
+                    bits |= flag << (bit + i);
+                    num_set += flag;
+                }
+
+                // a word is shared with a neighbouring chunk only if it is
+                // not covered entirely
+                std::atomic<word_type>& word = words_[pos / bits_per_word];
+                if (n == bits_per_word)
+                {
+                    word.store(bits, std::memory_order_relaxed);
+                }
+                else
+                {
+                    word.fetch_or(bits, std::memory_order_relaxed);
+                }
+
+                pos += n;
+                count -= n;
+            }
+            return num_set;
+        }
+
+        // Calls f(flag) for each of the flags [pos, pos + count) in order
+        template <typename F>
+        void get(std::size_t pos, std::size_t count, F&& f) const
+        {
+            while (count != 0)
+            {
+                std::size_t const bit = pos % bits_per_word;
+                std::size_t const n = (std::min)(bits_per_word - bit, count);
+
+                word_type const bits =
+                    words_[pos / bits_per_word].load(
+                        std::memory_order_relaxed) >>
+                    bit;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    f(((bits >> i) & 1) != 0);
+                }
+
+                pos += n;
+                count -= n;
+            }
+        }
+
+        bool test(std::size_t pos) const
+        {
+            PIKA_ASSERT(words_);
+            word_type const bits = words_[pos / bits_per_word].load(
+                std::memory_order_relaxed);
+            return ((bits >> (pos % bits_per_word)) & 1) != 0;
+        }
+
+        // the memory of the flags of count elements
+        static constexpr std::size_t size_in_bytes(std::size_t count) noexcept
+        {
+            return num_words(count) * sizeof(std::atomic<word_type>);
+        }
+
+    private:
+        static constexpr std::size_t num_words(std::size_t count) noexcept
+        {
+            return (count + bits_per_word - 1) / bits_per_word;
+        }
+
+        std::shared_ptr<std::atomic<word_type>[]> words_;
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
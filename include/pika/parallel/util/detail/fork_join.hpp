@@ -0,0 +1,131 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution_base/this_thread.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/executors/exception_list.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <atomic>
+#include <exception>
+#include <list>
+#include <memory>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The state of the branch spawned by fork_join, shared by the spawned
+    // task and the worker which forked it. Whoever changes it from pending
+    // first runs the branch.
+    struct fork_join_branch
+    {
+        enum state_type : int
+        {
+            pending,
+            claimed,
+            running,
+            done
+        };
+
+        std::atomic<int> state{pending};
+        std::exception_ptr exception;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs spawned() and inline_f() in parallel and returns once both have
+    // finished. Only spawned() is posted to the executor of the policy,
+    // inline_f() runs right away on the current worker. Afterwards the
+    // worker runs spawned() as well unless another worker has started it
+    // in the meantime, in which case it waits for that worker (yielding to
+    // other tasks). A fork creates a single task and neither a future nor a
+    // continuation, the task returns immediately if it wasn't stolen.
+    //
+    // The branches may refer to the stack of the caller, the spawned task
+    // only invokes spawned() while fork_join waits for it. Exceptions of
+    // both branches are reported as an exception_list, std::bad_alloc is
+    // rethrown as is.
+    template <typename ExPolicy, typename F1, typename F2>
+    void fork_join(ExPolicy& policy, F1&& spawned, F2&& inline_f)
+    {
+        auto branch = std::make_shared<fork_join_branch>();
+
+        execution::post(policy.executor(), [branch, &spawned]() {
+            int expected = fork_join_branch::pending;
+            if (!branch->state.compare_exchange_strong(
+                    expected, fork_join_branch::running))
+            {
+                // the forking worker has run the branch already
+                return;
+            }
+
+            try
+            {
+                spawned();
+            }
+            catch (...)
+            {
+                branch->exception = std::current_exception();
+            }
+            branch->state.store(
+                fork_join_branch::done, std::memory_order_release);
+        });
+
+        std::exception_ptr inline_exception;
+        try
+        {
+            inline_f();
+        }
+        catch (...)
+        {
+            inline_exception = std::current_exception();
+        }
+
+        std::exception_ptr spawned_exception;
+        int expected = fork_join_branch::pending;
+        if (branch->state.compare_exchange_strong(
+                expected, fork_join_branch::claimed))
+        {
+            try
+            {
+                spawned();
+            }
+            catch (...)
+            {
+                spawned_exception = std::current_exception();
+            }
+        }
+        else
+        {
+            pika::util::yield_while(
+                [&]() {
+                    return branch->state.load(std::memory_order_acquire) !=
+                        fork_join_branch::done;
+                },
+                "fork_join");
+            spawned_exception = PIKA_MOVE(branch->exception);
+        }
+
+        if (spawned_exception || inline_exception)
+        {
+            std::list<std::exception_ptr> errors;
+            if (spawned_exception)
+            {
+                handle_local_exceptions<ExPolicy>::call(
+                    spawned_exception, errors);
+            }
+            if (inline_exception)
+            {
+                handle_local_exceptions<ExPolicy>::call(
+                    inline_exception, errors);
+            }
+            throw exception_list(PIKA_MOVE(errors));
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,317 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// The number of bytes of the native vector packs of the generic backend,
+// this should match the widest vector registers of the target.
+#if !defined(PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES)
+#if defined(__AVX512F__)
+#define PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES 64
+#elif defined(__AVX__)
+#define PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES 32
+#else
+#define PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES 16
+#endif
+#endif
+
+namespace pika::parallel::traits::detail {
+    // The generic backend provides the subset of the interface of
+    // std::experimental::simd and simd_mask which the datapar algorithms
+    // and the function objects passed to them rely on. The lanes are held in
+    // arrays and all operations are loops over them, which the compilers
+    // vectorize. It needs nothing but C++17 and is used on toolchains which
+    // do not provide std::experimental::simd.
+    template <typename T, std::size_t N>
+    class generic_pack;
+
+    template <typename T, std::size_t N>
+    class generic_mask
+    {
+    public:
+        using value_type = bool;
+        using simd_type = generic_pack<T, N>;
+
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        generic_mask() = default;
+
+        PIKA_HOST_DEVICE constexpr generic_mask(bool value) noexcept
+          : generic_mask(value, std::make_index_sequence<N>())
+        {
+        }
+
+        PIKA_HOST_DEVICE constexpr bool operator[](std::size_t i) const
+        {
+            return data_[i];
+        }
+
+        PIKA_HOST_DEVICE constexpr bool& operator[](std::size_t i)
+        {
+            return data_[i];
+        }
+
+        PIKA_HOST_DEVICE friend generic_mask operator!(
+            generic_mask const& value) noexcept
+        {
+            generic_mask result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result.data_[i] = !value.data_[i];
+            }
+            return result;
+        }
+
+#define PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(op)                              \
+    PIKA_HOST_DEVICE friend generic_mask operator op(                          \
+        generic_mask const& lhs, generic_mask const& rhs) noexcept             \
+    {                                                                          \
+        generic_mask result;                                                   \
+        for (std::size_t i = 0; i != N; ++i)                                   \
+        {                                                                      \
+            result.data_[i] = lhs.data_[i] op rhs.data_[i];                    \
+        }                                                                      \
+        return result;                                                         \
+    }                                                                          \
+    /**/
+
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(&&)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(||)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(&)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(|)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(^)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(==)
+        PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR(!=)
+
+#undef PIKA_ALGORITHMS_GENERIC_MASK_OPERATOR
+
+    private:
+        template <std::size_t... Is>
+        PIKA_HOST_DEVICE constexpr generic_mask(
+            bool value, std::index_sequence<Is...>) noexcept
+          : data_{(void(Is), value)...}
+        {
+        }
+
+        bool data_[N];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    class generic_pack
+    {
+        static_assert(std::is_arithmetic_v<T>,
+            "the generic vector packs hold arithmetic types only");
+        static_assert(N != 0, "a vector pack holds at least one element");
+
+    public:
+        using value_type = T;
+        using mask_type = generic_mask<T, N>;
+
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        generic_pack() = default;
+
+        // broadcast, like std::experimental::simd this is implicit such that
+        // packs can be combined with scalars
+        template <typename U,
+            typename Enable =
+                std::enable_if_t<std::is_arithmetic_v<std::decay_t<U>>>>
+        PIKA_HOST_DEVICE constexpr generic_pack(U value) noexcept
+          : generic_pack(T(value), std::make_index_sequence<N>())
+        {
+        }
+
+        // the lanes are initialized with gen(std::integral_constant<
+        // std::size_t, i>())
+        template <typename G,
+            typename Enable = std::enable_if_t<std::is_invocable_v<G&,
+                std::integral_constant<std::size_t, 0>>>>
+        PIKA_HOST_DEVICE explicit constexpr generic_pack(G&& gen)
+          : generic_pack(gen, std::make_index_sequence<N>())
+        {
+        }
+
+        PIKA_HOST_DEVICE constexpr T operator[](std::size_t i) const
+        {
+            return data_[i];
+        }
+
+        PIKA_HOST_DEVICE constexpr T& operator[](std::size_t i)
+        {
+            return data_[i];
+        }
+
+        // the elements are converted to T, like the loads of
+        // std::experimental::simd from other vectorizable types
+        template <typename U>
+        PIKA_HOST_DEVICE void copy_from(U const* p) noexcept
+        {
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                data_[i] = T(p[i]);
+            }
+        }
+
+        PIKA_HOST_DEVICE void copy_to(T* p) const noexcept
+        {
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                p[i] = data_[i];
+            }
+        }
+
+        PIKA_HOST_DEVICE friend constexpr generic_pack operator+(
+            generic_pack const& value) noexcept
+        {
+            return value;
+        }
+
+        PIKA_HOST_DEVICE friend generic_pack operator-(
+            generic_pack const& value) noexcept
+        {
+            generic_pack result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result.data_[i] = -value.data_[i];
+            }
+            return result;
+        }
+
+        template <typename U = T,
+            typename Enable = std::enable_if_t<std::is_integral_v<U>>>
+        PIKA_HOST_DEVICE friend generic_pack operator~(
+            generic_pack const& value) noexcept
+        {
+            generic_pack result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result.data_[i] = ~value.data_[i];
+            }
+            return result;
+        }
+
+        PIKA_HOST_DEVICE friend mask_type operator!(
+            generic_pack const& value) noexcept
+        {
+            mask_type result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result[i] = !value.data_[i];
+            }
+            return result;
+        }
+
+#define PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR(op)                              \
+    PIKA_HOST_DEVICE friend generic_pack operator op(                          \
+        generic_pack const& lhs, generic_pack const& rhs) noexcept             \
+    {                                                                          \
+        generic_pack result;                                                   \
+        for (std::size_t i = 0; i != N; ++i)                                   \
+        {                                                                      \
+            result.data_[i] = lhs.data_[i] op rhs.data_[i];                    \
+        }                                                                      \
+        return result;                                                         \
+    }                                                                          \
+                                                                               \
+    PIKA_HOST_DEVICE friend generic_pack& operator op##=(                      \
+        generic_pack& lhs, generic_pack const& rhs) noexcept                   \
+    {                                                                          \
+        for (std::size_t i = 0; i != N; ++i)                                   \
+        {                                                                      \
+            lhs.data_[i] op##= rhs.data_[i];                                   \
+        }                                                                      \
+        return lhs;                                                            \
+    }                                                                          \
+    /**/
+
+        PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR(+)
+        PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR(-)
+        PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR(*)
+        PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR(/)
+
+#undef PIKA_ALGORITHMS_GENERIC_PACK_OPERATOR
+
+#define PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(op)                     \
+    template <typename U = T,                                                  \
+        typename Enable = std::enable_if_t<std::is_integral_v<U>>>             \
+    PIKA_HOST_DEVICE friend generic_pack operator op(                          \
+        generic_pack const& lhs, generic_pack const& rhs) noexcept             \
+    {                                                                          \
+        generic_pack result;                                                   \
+        for (std::size_t i = 0; i != N; ++i)                                   \
+        {                                                                      \
+            result.data_[i] = lhs.data_[i] op rhs.data_[i];                    \
+        }                                                                      \
+        return result;                                                         \
+    }                                                                          \
+    /**/
+
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(%)
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(&)
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(|)
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(^)
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(<<)
+        PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR(>>)
+
+#undef PIKA_ALGORITHMS_GENERIC_PACK_INTEGRAL_OPERATOR
+
+#define PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(op)                            \
+    PIKA_HOST_DEVICE friend mask_type operator op(                             \
+        generic_pack const& lhs, generic_pack const& rhs) noexcept             \
+    {                                                                          \
+        mask_type result;                                                      \
+        for (std::size_t i = 0; i != N; ++i)                                   \
+        {                                                                      \
+            result[i] = lhs.data_[i] op rhs.data_[i];                          \
+        }                                                                      \
+        return result;                                                         \
+    }                                                                          \
+    /**/
+
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(==)
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(!=)
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(<)
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(<=)
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(>)
+        PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON(>=)
+
+#undef PIKA_ALGORITHMS_GENERIC_PACK_COMPARISON
+
+    private:
+        template <std::size_t... Is>
+        PIKA_HOST_DEVICE constexpr generic_pack(
+            T value, std::index_sequence<Is...>) noexcept
+          : data_{(void(Is), value)...}
+        {
+        }
+
+        template <typename G, std::size_t... Is>
+        PIKA_HOST_DEVICE constexpr generic_pack(
+            G& gen, std::index_sequence<Is...>)
+          : data_{
+                T(gen(std::integral_constant<std::size_t, Is>()))...}
+        {
+        }
+
+        T data_[N];
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,61 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+#include <pika/parallel/util/detail/generic/vector_pack_type.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::traits::detail {
+    template <typename T, std::size_t N>
+    struct is_vector_pack<generic_pack<T, N>>
+      : std::integral_constant<bool, (N > 1)>
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct is_scalar_vector_pack<generic_pack<T, N>>
+      : std::integral_constant<bool, N == 1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The lanes are loaded and stored one at a time, the alignment of the
+    // native packs only decides where the vectorized loops start.
+    template <typename T, typename Enable>
+    struct vector_pack_alignment
+    {
+        static std::size_t const value = generic_native_size<T> * sizeof(T);
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_alignment<generic_pack<T, N>>
+    {
+        static std::size_t const value = vector_pack_alignment<T>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_size
+    {
+        static std::size_t const value = generic_native_size<T>;
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_size<generic_pack<T, N>>
+    {
+        static std::size_t const value = N;
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,51 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t
+    all_of(generic_mask<T, N> const& msk)
+    {
+        bool result = true;
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            result = result && msk[i];
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t
+    any_of(generic_mask<T, N> const& msk)
+    {
+        bool result = false;
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            result = result || msk[i];
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t
+    none_of(generic_mask<T, N> const& msk)
+    {
+        return !any_of(msk);
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
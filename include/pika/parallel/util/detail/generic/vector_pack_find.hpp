@@ -0,0 +1,46 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE int
+    find_first_of(generic_mask<T, N> const& msk)
+    {
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            if (msk[i])
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE int
+    find_last_of(generic_mask<T, N> const& msk)
+    {
+        for (std::size_t i = N; i != 0; --i)
+        {
+            if (msk[i - 1])
+            {
+                return static_cast<int>(i - 1);
+            }
+        }
+        return -1;
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace pika::parallel::traits::detail {
+    // The masked loads and stores are emulated lane by lane.
+    template <typename V>
+    struct vector_pack_has_masked_access : std::false_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Contiguous packs are copied from and to the elements, alignment makes
+    // no difference to the generic packs.
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_load
+    {
+        template <typename Iter>
+        static V aligned(Iter const& iter)
+        {
+            return unaligned(iter);
+        }
+
+        template <typename Iter>
+        static V unaligned(Iter const& iter)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                return vector_pack_gather<V>(iter, V::size());
+            }
+            else
+            {
+                V value;
+                value.copy_from(pika::detail::to_address(iter));
+                return value;
+            }
+        }
+
+        // Loads the first count elements, the other lanes are set to the
+        // first element.
+        template <typename Iter>
+        static V masked(Iter const& iter, std::size_t count)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                return vector_pack_gather<V>(iter, count);
+            }
+            else
+            {
+                auto const* p = pika::detail::to_address(iter);
+                V value(*p);
+                for (std::size_t i = 1; i < count; ++i)
+                {
+                    value[i] = p[i];
+                }
+                return value;
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_store
+    {
+        template <typename Iter>
+        static void aligned(V& value, Iter const& iter)
+        {
+            unaligned(value, iter);
+        }
+
+        template <typename Iter>
+        static void unaligned(V& value, Iter const& iter)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                vector_pack_scatter(value, iter, V::size());
+            }
+            else
+            {
+                value.copy_to(pika::detail::to_address(iter));
+            }
+        }
+
+        // Stores the first count lanes only.
+        template <typename Iter>
+        static void masked(V& value, Iter const& iter, std::size_t count)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                vector_pack_scatter(value, iter, count);
+            }
+            else
+            {
+                auto* p = pika::detail::to_address(iter);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    p[i] = value[i];
+                }
+            }
+        }
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
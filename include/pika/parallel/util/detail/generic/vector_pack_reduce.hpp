@@ -0,0 +1,87 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    // Op has to be applicable to whole packs, see vector_pack_reduce_op. The
+    // lanes are combined pairwise, like the backends which reduce in
+    // registers.
+    template <typename T, std::size_t N, typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce(
+        generic_pack<T, N> const& value, Op op)
+    {
+        generic_pack<T, N> result = value;
+        for (std::size_t width = N; width > 1; /**/)
+        {
+            std::size_t const half = width / 2;
+            for (std::size_t i = 0; i != half; ++i)
+            {
+                result[i] = op(result[i], result[i + (width - half)]);
+            }
+            width -= half;
+        }
+        return result[0];
+    }
+
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce_min(
+        generic_pack<T, N> const& value)
+    {
+        T result = value[0];
+        for (std::size_t i = 1; i != N; ++i)
+        {
+            result = value[i] < result ? value[i] : result;
+        }
+        return result;
+    }
+
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce_max(
+        generic_pack<T, N> const& value)
+    {
+        T result = value[0];
+        for (std::size_t i = 1; i != N; ++i)
+        {
+            result = result < value[i] ? value[i] : result;
+        }
+        return result;
+    }
+
+    // element-wise minimum and maximum of two packs
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE generic_pack<T, N> min(
+        generic_pack<T, N> const& lhs, generic_pack<T, N> const& rhs)
+    {
+        generic_pack<T, N> result;
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            result[i] = rhs[i] < lhs[i] ? rhs[i] : lhs[i];
+        }
+        return result;
+    }
+
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE generic_pack<T, N> max(
+        generic_pack<T, N> const& lhs, generic_pack<T, N> const& rhs)
+    {
+        generic_pack<T, N> result;
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            result[i] = lhs[i] < rhs[i] ? rhs[i] : lhs[i];
+        }
+        return result;
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
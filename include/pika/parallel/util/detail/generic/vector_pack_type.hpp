@@ -0,0 +1,44 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    // the number of elements of T which fill the native packs
+    template <typename T>
+    inline constexpr std::size_t generic_native_size =
+        sizeof(T) < PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES ?
+        PIKA_ALGORITHMS_DATAPAR_GENERIC_BYTES / sizeof(T) :
+        1;
+
+    // The generic backend has no ABI tags, Abi is ignored.
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type_impl
+    {
+        using type = generic_pack<T, N>;
+    };
+
+    template <typename T, typename Abi>
+    struct vector_pack_type_impl<T, 0, Abi>
+    {
+        using type = generic_pack<T, generic_native_size<T>>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type : vector_pack_type_impl<T, N, Abi>
+    {
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    // Sets the lanes of value which are selected by msk to new_value.
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void where_assign(
+        generic_mask<T, N> const& msk, generic_pack<T, N>& value,
+        T const& new_value)
+    {
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            value[i] = msk[i] ? new_value : value[i];
+        }
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,229 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/non_temporal_stores.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The number of bytes written by a single non-temporal store, zero if
+    // the target has no such stores.
+    inline constexpr std::size_t non_temporal_store_bytes =
+#if defined(__AVX512F__)
+        64;
+#elif defined(__AVX__)
+        32;
+#elif defined(__SSE2__) || defined(_M_X64)
+        16;
+#else
+        0;
+#endif
+
+    // Holds if the policy asks for non-temporal stores and the target
+    // supports them
+    template <typename ExPolicy>
+    inline constexpr bool use_non_temporal_stores_v =
+        non_temporal_store_bytes != 0 &&
+        std::is_same_v<std::decay_t<typename std::decay_t<
+                           ExPolicy>::executor_parameters_type>,
+            pika::execution::non_temporal_stores>;
+
+    // The values written by the fill and transform kernels, a whole number
+    // of them fits into a single store
+    template <typename T>
+    inline constexpr bool is_non_temporal_value_v = std::is_arithmetic_v<T> &&
+        non_temporal_store_bytes % sizeof(T) == 0;
+
+    // Holds if the values written through OutIter by fill and transform are
+    // written with non-temporal stores for the given policy
+    template <typename ExPolicy, typename OutIter>
+    inline constexpr bool use_non_temporal_stores_for_v =
+        use_non_temporal_stores_v<ExPolicy> &&
+        pika::detail::is_contiguous_iterator_v<OutIter> &&
+        is_non_temporal_value_v<
+            typename std::iterator_traits<OutIter>::value_type>;
+
+#if defined(__SSE2__) || defined(_M_X64)
+    // Write the non_temporal_store_bytes bytes at src to dest, which is
+    // aligned to non_temporal_store_bytes, bypassing the caches
+    PIKA_FORCEINLINE void non_temporal_store(
+        char* dest, char const* src) noexcept
+    {
+#if defined(__AVX512F__)
+        _mm512_stream_si512(
+            reinterpret_cast<__m512i*>(dest), _mm512_loadu_si512(src));
+#elif defined(__AVX__)
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dest),
+            _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src)));
+#else
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dest),
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(src)));
+#endif
+    }
+
+    // Non-temporal stores are weakly ordered, the fence makes them visible
+    // to other threads before any later store (e.g. the one signalling the
+    // completion of a chunk)
+    struct non_temporal_store_fence
+    {
+        ~non_temporal_store_fence()
+        {
+            _mm_sfence();
+        }
+    };
+
+    // The number of elements of size bytes to write with regular stores
+    // before dest is aligned for the non-temporal stores
+    inline std::size_t non_temporal_head(
+        void const* dest, std::size_t size) noexcept
+    {
+        constexpr std::size_t bytes = non_temporal_store_bytes;
+        std::size_t const misalignment =
+            reinterpret_cast<std::uintptr_t>(dest) % bytes;
+        return ((bytes - misalignment) % bytes) / size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy size bytes from src to dest. The bytes up to the first aligned
+    // address in dest and the bytes following the last full store are
+    // copied with regular stores. Overlapping ranges are left to memmove.
+    inline void non_temporal_copy_bytes(
+        char* dest, char const* src, std::size_t size) noexcept
+    {
+        constexpr std::size_t bytes = non_temporal_store_bytes;
+
+        std::size_t const head = non_temporal_head(dest, 1);
+        std::uintptr_t const d = reinterpret_cast<std::uintptr_t>(dest);
+        std::uintptr_t const s = reinterpret_cast<std::uintptr_t>(src);
+        bool const overlapping = d < s + size && s < d + size;
+        if (overlapping || size < head + 2 * bytes)
+        {
+            std::memmove(dest, src, size);
+            return;
+        }
+
+        non_temporal_store_fence fence;
+
+        std::memcpy(dest, src, head);
+
+        std::size_t i = head;
+        for (/**/; size - i >= bytes; i += bytes)
+        {
+            non_temporal_store(dest + i, src + i);
+        }
+
+        std::memcpy(dest + i, src + i, size - i);
+    }
+
+    // Write the count values g(i), i in [0, count), to dest. The values of
+    // each store are generated into a local block first.
+    template <typename T, typename G>
+    void non_temporal_generate_n(T* dest, std::size_t count, G&& g)
+    {
+        constexpr std::size_t bytes = non_temporal_store_bytes;
+        constexpr std::size_t n = bytes / sizeof(T);
+
+        std::size_t const head = non_temporal_head(dest, sizeof(T));
+        if (count < head + 2 * n)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                dest[i] = static_cast<T>(g(i));
+            }
+            return;
+        }
+
+        non_temporal_store_fence fence;
+
+        for (std::size_t i = 0; i != head; ++i)
+        {
+            dest[i] = static_cast<T>(g(i));
+        }
+
+        std::size_t i = head;
+        for (/**/; count - i >= n; i += n)
+        {
+            T block[n];
+            for (std::size_t j = 0; j != n; ++j)
+            {
+                block[j] = static_cast<T>(g(i + j));
+            }
+            non_temporal_store(reinterpret_cast<char*>(dest + i),
+                reinterpret_cast<char const*>(block));
+        }
+
+        for (/**/; i != count; ++i)
+        {
+            dest[i] = static_cast<T>(g(i));
+        }
+    }
+#else
+    inline void non_temporal_copy_bytes(
+        char* dest, char const* src, std::size_t size) noexcept
+    {
+        std::memmove(dest, src, size);
+    }
+
+    template <typename T, typename G>
+    void non_temporal_generate_n(T* dest, std::size_t count, G&& g)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            dest[i] = static_cast<T>(g(i));
+        }
+    }
+#endif
+
+    // Write count copies of value to dest
+    template <typename T, typename U>
+    void non_temporal_fill_n(T* dest, std::size_t count, U const& value)
+    {
+        T const v = static_cast<T>(value);
+        non_temporal_generate_n(dest, count, [v](std::size_t) { return v; });
+    }
+
+    // Apply one of the kernels above to the count elements starting at the
+    // contiguous iterator dest, return the iterator past the last element
+    template <typename OutIter, typename G>
+    OutIter non_temporal_generate(OutIter dest, std::size_t count, G&& g)
+    {
+        if (count != 0)
+        {
+            non_temporal_generate_n(
+                pika::detail::to_address(dest), count, g);
+        }
+        return std::next(dest, count);
+    }
+
+    template <typename OutIter, typename T>
+    OutIter non_temporal_fill(OutIter dest, std::size_t count, T const& value)
+    {
+        if (count != 0)
+        {
+            non_temporal_fill_n(
+                pika::detail::to_address(dest), count, value);
+        }
+        return std::next(dest, count);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
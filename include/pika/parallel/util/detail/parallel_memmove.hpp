@@ -0,0 +1,433 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/pointer_category.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/transfer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // Holds if the elements referred to by Iter are moved by copying their
+    // bytes
+    template <typename Iter>
+    inline constexpr bool is_memmove_iterator_v =
+        std::is_same_v<pika::detail::pointer_move_category_t<Iter, Iter>,
+            pika::detail::trivially_copyable_pointer_tag>;
+
+    // The smallest number of bytes copied by a single task
+    inline constexpr std::size_t memmove_min_task_bytes = 64 * 1024;
+
+    // Overlapping ranges whose distance is at least 1/16th of their size are
+    // moved in waves, see parallel_memmove
+    inline constexpr std::size_t memmove_max_waves = 16;
+
+    // Copy size bytes from src to dest, the ranges must not overlap. The
+    // bytes are split into one block per core, the blocks are copied
+    // concurrently.
+    template <typename ExPolicy>
+    void parallel_memcpy(
+        ExPolicy& policy, char* dest, char const* src, std::size_t size)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const tasks = (std::min)(cores,
+            (size + memmove_min_task_bytes - 1) / memmove_min_task_bytes);
+        if (tasks <= 1)
+        {
+            std::memcpy(dest, src, size);
+            return;
+        }
+
+        std::size_t const block = (size + tasks - 1) / tasks;
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t i) {
+                std::size_t const begin = i * block;
+                if (begin < size)
+                {
+                    std::memcpy(dest + begin, src + begin,
+                        (std::min)(block, size - begin));
+                }
+            },
+            pika::detail::irange(std::size_t(0), tasks));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy size bytes from src to dest, the ranges may overlap (like
+    // std::memmove). With d = |dest - src| the ranges are
+    //  - disjoint if d >= size: the bytes are copied by parallel_memcpy.
+    //  - moved in waves if d is large: the i-th block of d bytes overwrites
+    //    the source of block i - 1 (or i + 1 if dest > src) only. The blocks
+    //    are copied one after the other, each by parallel_memcpy.
+    //  - split into segments if d is small: the segments are moved
+    //    concurrently by memmove, except for the d bytes at the border to
+    //    the neighbouring segment which is overwritten by it. These are
+    //    saved to a buffer up front and written last.
+    template <typename ExPolicy>
+    void parallel_memmove(
+        ExPolicy& policy, char* dest, char const* src, std::size_t size)
+    {
+        std::uintptr_t const d = reinterpret_cast<std::uintptr_t>(dest);
+        std::uintptr_t const s = reinterpret_cast<std::uintptr_t>(src);
+        std::size_t const distance = d < s ? s - d : d - s;
+        if (distance == 0 || size == 0)
+        {
+            return;
+        }
+
+        if (distance >= size)
+        {
+            parallel_memcpy(policy, dest, src, size);
+            return;
+        }
+
+        if (size < memmove_max_waves * distance)
+        {
+            if (d < s)
+            {
+                for (std::size_t begin = 0; begin < size; begin += distance)
+                {
+                    parallel_memcpy(policy, dest + begin, src + begin,
+                        (std::min)(distance, size - begin));
+                }
+            }
+            else
+            {
+                for (std::size_t end = size; end != 0; /**/)
+                {
+                    std::size_t const begin =
+                        end > distance ? end - distance : 0;
+                    parallel_memcpy(
+                        policy, dest + begin, src + begin, end - begin);
+                    end = begin;
+                }
+            }
+            return;
+        }
+
+        // the saved bytes are at most 1/8th of the moved ones
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const segments = (std::min)({cores,
+            size / (memmove_max_waves / 2 * distance),
+            size / memmove_min_task_bytes});
+        if (segments <= 1)
+        {
+            std::memmove(dest, src, size);
+            return;
+        }
+
+        std::size_t const segment = (size + segments - 1) / segments;
+        std::unique_ptr<char[]> saved(new char[(segments - 1) * distance]);
+
+        // the bytes of segment i which are overwritten by its neighbour, the
+        // segments are larger than distance
+        auto border = [&](std::size_t i) -> std::size_t {
+            return d < s ? (i + 1) * segment - distance : (i + 1) * segment;
+        };
+
+        for (std::size_t i = 0; i != segments - 1; ++i)
+        {
+            std::memcpy(
+                saved.get() + i * distance, src + border(i), distance);
+        }
+
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t i) {
+                std::size_t begin = i * segment;
+                std::size_t end = (std::min)(begin + segment, size);
+                if (d < s && i != segments - 1)
+                {
+                    end -= distance;
+                }
+                else if (d > s && i != 0)
+                {
+                    begin += distance;
+                }
+                std::memmove(dest + begin, src + begin, end - begin);
+
+                // the saved bytes of the segment next to the written ones
+                if (d < s && i != segments - 1)
+                {
+                    std::memcpy(dest + border(i),
+                        saved.get() + i * distance, distance);
+                }
+                else if (d > s && i != 0)
+                {
+                    std::memcpy(dest + border(i - 1),
+                        saved.get() + (i - 1) * distance, distance);
+                }
+            },
+            pika::detail::irange(std::size_t(0), segments));
+    }
+
+    // Move the count elements starting at first to dest, the ranges may
+    // overlap
+    template <typename ExPolicy, typename Iter>
+    void parallel_memmove_n(
+        ExPolicy& policy, Iter first, std::size_t count, Iter dest)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        if (count != 0)
+        {
+            parallel_memmove(policy, to_ptr(dest), to_const_ptr(first),
+                count * sizeof(value_type));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Holds if the elements referred to by Iter can be moved by
+    // parallel_move_n
+    template <typename Iter,
+        typename T = typename std::iterator_traits<Iter>::value_type>
+    inline constexpr bool is_nothrow_move_iterator_v =
+        pika::traits::is_random_access_iterator_v<Iter> &&
+        std::is_nothrow_move_constructible_v<T> &&
+        std::is_nothrow_move_assignable_v<T> &&
+        std::is_nothrow_destructible_v<T>;
+
+    // Uninitialized storage for count elements, which is empty if the
+    // allocation fails
+    template <typename T>
+    class uninitialized_buffer
+    {
+    public:
+        explicit uninitialized_buffer(std::size_t count) noexcept
+          : data_(static_cast<T*>(::operator new(count * sizeof(T),
+                std::align_val_t(alignof(T)), std::nothrow)))
+        {
+        }
+
+        uninitialized_buffer(uninitialized_buffer const&) = delete;
+        uninitialized_buffer& operator=(uninitialized_buffer const&) = delete;
+
+        ~uninitialized_buffer()
+        {
+            ::operator delete(data_, std::align_val_t(alignof(T)));
+        }
+
+        T* data() const noexcept
+        {
+            return data_;
+        }
+
+    private:
+        T* data_;
+    };
+
+    // Call f(begin, end) for the blocks of [0, count), one block per core.
+    // The blocks are processed concurrently if each of them holds at least
+    // memmove_min_task_bytes.
+    template <typename T, typename ExPolicy, typename F>
+    void parallel_move_blocks(ExPolicy& policy, std::size_t count, F&& f)
+    {
+        std::size_t const min_task =
+            (std::max)(memmove_min_task_bytes / sizeof(T), std::size_t(1));
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const tasks =
+            (std::min)(cores, (count + min_task - 1) / min_task);
+        if (tasks <= 1)
+        {
+            f(std::size_t(0), count);
+            return;
+        }
+
+        std::size_t const block = (count + tasks - 1) / tasks;
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t i) {
+                std::size_t const begin = i * block;
+                if (begin < count)
+                {
+                    f(begin, (std::min)(begin + block, count));
+                }
+            },
+            pika::detail::irange(std::size_t(0), tasks));
+    }
+
+    // Move the count elements starting at first to dest, the ranges may
+    // overlap. This is the element-wise version of parallel_memmove for
+    // elements which are moved without throwing, see
+    // is_nothrow_move_iterator_v. The elements at the border of two
+    // segments are saved to a temporary buffer, if it can not be allocated
+    // the elements are moved sequentially.
+    template <typename ExPolicy, typename Iter>
+    void parallel_move_n(
+        ExPolicy& policy, Iter first, std::size_t count, Iter dest)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        bool const left = dest < first;
+        std::size_t const distance =
+            static_cast<std::size_t>(left ? first - dest : dest - first);
+        if (distance == 0 || count == 0)
+        {
+            return;
+        }
+
+        auto move_range = [&](std::size_t begin, std::size_t end) {
+            if (left)
+            {
+                std::move(std::next(first, begin), std::next(first, end),
+                    std::next(dest, begin));
+            }
+            else
+            {
+                std::move_backward(std::next(first, begin),
+                    std::next(first, end), std::next(dest, end));
+            }
+        };
+
+        if (distance >= count)
+        {
+            parallel_move_blocks<value_type>(policy, count,
+                [&](std::size_t begin, std::size_t end) {
+                    std::move(std::next(first, begin), std::next(first, end),
+                        std::next(dest, begin));
+                });
+            return;
+        }
+
+        if (count < memmove_max_waves * distance)
+        {
+            // each wave overwrites the elements moved by the previous one
+            auto wave = [&](std::size_t begin, std::size_t end) {
+                parallel_move_blocks<value_type>(policy, end - begin,
+                    [&](std::size_t b, std::size_t e) {
+                        std::move(std::next(first, begin + b),
+                            std::next(first, begin + e),
+                            std::next(dest, begin + b));
+                    });
+            };
+
+            if (left)
+            {
+                for (std::size_t begin = 0; begin < count; begin += distance)
+                {
+                    wave(begin, (std::min)(begin + distance, count));
+                }
+            }
+            else
+            {
+                for (std::size_t end = count; end != 0; /**/)
+                {
+                    std::size_t const begin =
+                        end > distance ? end - distance : 0;
+                    wave(begin, end);
+                    end = begin;
+                }
+            }
+            return;
+        }
+
+        std::size_t const min_task =
+            (std::max)(memmove_min_task_bytes / sizeof(value_type),
+                std::size_t(1));
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const segments = (std::min)({cores,
+            count / (memmove_max_waves / 2 * distance), count / min_task});
+
+        uninitialized_buffer<value_type> saved(
+            segments > 1 ? (segments - 1) * distance : 0);
+        if (segments <= 1 || saved.data() == nullptr)
+        {
+            move_range(0, count);
+            return;
+        }
+
+        std::size_t const segment = (count + segments - 1) / segments;
+
+        // the elements of segment i which are overwritten by its neighbour
+        auto border = [&](std::size_t i) -> std::size_t {
+            return left ? (i + 1) * segment - distance : (i + 1) * segment;
+        };
+
+        for (std::size_t i = 0; i != segments - 1; ++i)
+        {
+            auto it = std::next(first, border(i));
+            std::uninitialized_move(
+                it, std::next(it, distance), saved.data() + i * distance);
+        }
+
+        execution::bulk_sync_execute(
+            policy.executor(),
+            [&](std::size_t i) {
+                std::size_t begin = i * segment;
+                std::size_t end = (std::min)(begin + segment, count);
+                if (left && i != segments - 1)
+                {
+                    end -= distance;
+                }
+                else if (!left && i != 0)
+                {
+                    begin += distance;
+                }
+                move_range(begin, end);
+
+                // the saved elements of the segment next to the moved ones
+                if (left && i != segments - 1)
+                {
+                    value_type* p = saved.data() + i * distance;
+                    std::move(p, p + distance, std::next(dest, border(i)));
+                    std::destroy(p, p + distance);
+                }
+                else if (!left && i != 0)
+                {
+                    value_type* p = saved.data() + (i - 1) * distance;
+                    std::move(p, p + distance, std::next(dest, border(i - 1)));
+                    std::destroy(p, p + distance);
+                }
+            },
+            pika::detail::irange(std::size_t(0), segments));
+    }
+
+    // Run f, which moves elements using parallel_memmove, on the executor of
+    // the policy if the policy is asynchronous, and return its result
+    template <typename ExPolicy, typename R, typename F>
+    typename algorithm_result<ExPolicy, R>::type run_parallel_memmove(
+        ExPolicy&& policy, F&& f)
+    {
+        auto p = pika::execution::par.on(policy.executor())
+                     .with(policy.parameters());
+
+        if constexpr (pika::is_async_execution_policy_v<
+                          std::decay_t<ExPolicy>>)
+        {
+            return algorithm_result<ExPolicy, R>::get(
+                execution::async_execute(policy.executor(),
+                    [p = PIKA_MOVE(p), f = PIKA_FORWARD(F, f)]() mutable
+                    -> R { return f(p); }));
+        }
+        else
+        {
+            return algorithm_result<ExPolicy, R>::get(f(p));
+        }
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
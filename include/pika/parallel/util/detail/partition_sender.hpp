@@ -0,0 +1,234 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/algorithms/bulk.hpp>
+#include <pika/execution/algorithms/then.hpp>
+#include <pika/execution/algorithms/transfer_just.hpp>
+#include <pika/execution/scheduling_properties.hpp>
+#include <pika/executors/parallel_executor.hpp>
+#include <pika/executors/thread_pool_scheduler.hpp>
+#include <pika/executors/thread_pool_scheduler_bulk.hpp>
+#include <pika/modules/errors.hpp>
+
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    // The chunks of the sender based algorithms are run by the default
+    // thread pool, they are used for the parallel policies which run there
+    // as well. Partitioning schemes which determine the worker of a chunk by
+    // themselves are not supported.
+    template <typename ExPolicy>
+    inline constexpr bool use_partition_sender_v =
+        std::is_same_v<typename std::decay_t<ExPolicy>::executor_type,
+            pika::execution::parallel_executor> &&
+        !is_work_stealing_parameters<typename std::decay_t<
+            ExPolicy>::executor_parameters_type>::value &&
+        !use_chunk_placement_v<ExPolicy>;
+
+    // The scheduler running the chunks of the sender based algorithms, it
+    // takes over the priority, stack size and scheduling hint of the
+    // executor of the policy.
+    template <typename ExPolicy>
+    auto get_partition_sender_scheduler(ExPolicy const& policy)
+    {
+        namespace ex = pika::execution::experimental;
+        auto const& exec = policy.executor();
+        return ex::with_hint(
+            ex::with_stacksize(ex::with_priority(ex::thread_pool_scheduler{},
+                                   ex::get_priority(exec)),
+                ex::get_stacksize(exec)),
+            ex::get_hint(exec));
+    }
+
+    // The number of elements per chunk as determined by the executor
+    // parameters of the policy. No chunk is run up front to measure the
+    // time per element, count has to be non-zero.
+    template <typename ExPolicy>
+    std::size_t get_partition_sender_chunk_size(
+        ExPolicy& policy, std::size_t count)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t max_chunks = execution::maximal_number_of_chunks(
+            policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = execution::get_chunk_size(
+            policy.parameters(), policy.executor(),
+            [](std::size_t) -> std::size_t { return 0; }, cores, count);
+
+        adjust_chunk_size_and_max_chunks(cores, count, max_chunks, chunk_size);
+        return (std::max)(chunk_size, std::size_t(1));
+    }
+
+    template <typename ExPolicy, typename Result, typename F, typename Reduce>
+    struct partition_sender_state
+    {
+        std::size_t count;
+        std::size_t chunk_size;
+        F f;
+        Reduce reduce;
+        std::vector<Result> results;
+        std::vector<std::exception_ptr> exceptions;
+
+        void run(std::size_t i)
+        {
+            std::size_t const begin = i * chunk_size;
+            try
+            {
+                results[i] = f(begin, (std::min)(chunk_size, count - begin));
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        }
+
+        auto finish()
+        {
+            std::list<std::exception_ptr> errors;
+            for (auto& e : exceptions)
+            {
+                if (e)
+                {
+                    handle_local_exceptions<ExPolicy>::call(e, errors);
+                }
+            }
+
+            if (!errors.empty())
+            {
+                throw exception_list(PIKA_MOVE(errors));
+            }
+
+            return reduce(PIKA_MOVE(results));
+        }
+    };
+
+    // The chunks of algorithms without a result per chunk, reduce is invoked
+    // without arguments.
+    template <typename ExPolicy, typename F, typename Reduce>
+    struct partition_sender_state<ExPolicy, void, F, Reduce>
+    {
+        std::size_t count;
+        std::size_t chunk_size;
+        F f;
+        Reduce reduce;
+        std::vector<std::exception_ptr> exceptions;
+
+        void run(std::size_t i)
+        {
+            std::size_t const begin = i * chunk_size;
+            try
+            {
+                f(begin, (std::min)(chunk_size, count - begin));
+            }
+            catch (...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        }
+
+        auto finish()
+        {
+            std::list<std::exception_ptr> errors;
+            for (auto& e : exceptions)
+            {
+                if (e)
+                {
+                    handle_local_exceptions<ExPolicy>::call(e, errors);
+                }
+            }
+
+            if (!errors.empty())
+            {
+                throw exception_list(PIKA_MOVE(errors));
+            }
+
+            return reduce();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return a sender which runs f(begin, size) on the default thread pool,
+    // with the scheduling properties of the executor of the policy,
+    // for all chunks [begin, begin + size) of the indices [0, count) and
+    // sends reduce(results), where results holds the chunk results in order.
+    // The chunks are run as a bulk operation: there is no future per chunk
+    // and the sender completes on the worker which finishes the last chunk,
+    // such that the next stage of a sender pipeline continues right there.
+    // Exceptions thrown by the chunks are reported as an exception_list. If
+    // Result is void the chunks have no results and reduce() is sent.
+    template <typename Result, typename ExPolicy, typename F, typename Reduce>
+    auto partition_sender(
+        ExPolicy&& policy, std::size_t count, F&& f, Reduce&& reduce)
+    {
+        namespace ex = pika::execution::experimental;
+        using state_type = partition_sender_state<std::decay_t<ExPolicy>,
+            Result, std::decay_t<F>, std::decay_t<Reduce>>;
+
+        std::size_t const chunk_size =
+            count == 0 ? 1 : get_partition_sender_chunk_size(policy, count);
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+
+        auto make_state = [&]() {
+            if constexpr (std::is_void_v<Result>)
+            {
+                return state_type{count, chunk_size, PIKA_FORWARD(F, f),
+                    PIKA_FORWARD(Reduce, reduce),
+                    std::vector<std::exception_ptr>(num_chunks)};
+            }
+            else
+            {
+                return state_type{count, chunk_size, PIKA_FORWARD(F, f),
+                    PIKA_FORWARD(Reduce, reduce),
+                    std::vector<Result>(num_chunks),
+                    std::vector<std::exception_ptr>(num_chunks)};
+            }
+        };
+
+        return ex::bulk(
+                   ex::transfer_just(
+                       get_partition_sender_scheduler(policy), make_state()),
+                   num_chunks,
+                   [](std::size_t i, auto& state) { state.run(i); }) |
+            ex::then([](auto&& state) { return state.finish(); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sender counterpart of foreach_partitioner: return a sender which
+    // runs f1(part_begin, part_size, base_idx) for the chunks of the count
+    // elements starting at first and sends f2(first + count). No future is
+    // created, neither for the chunks nor for the result.
+    template <typename ExPolicy, typename FwdIter, typename F1, typename F2>
+    auto foreach_partition_sender(
+        ExPolicy&& policy, FwdIter first, std::size_t count, F1&& f1, F2&& f2)
+    {
+        return partition_sender<void>(PIKA_FORWARD(ExPolicy, policy), count,
+            [first, f1 = PIKA_FORWARD(F1, f1)](
+                std::size_t begin, std::size_t size) mutable {
+                f1(std::next(first, begin), size, begin);
+            },
+            [last = std::next(first, count),
+                f2 = PIKA_FORWARD(F2, f2)]() mutable { return f2(last); });
+    }
+}    // namespace pika::parallel::detail
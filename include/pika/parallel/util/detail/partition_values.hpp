@@ -0,0 +1,233 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/use_tree_reduction.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/synchronization/latch.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/partitioner_iteration.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Wraps the final reduction step of a partitioner, which operates on the
+    // values produced by the chunks (as opposed to the futures referring to
+    // those). This is equivalent to pika::unwrapping(f), but allows for the
+    // synchronous partitioners to skip creating one future per chunk.
+    template <typename F>
+    struct chunk_values_reducer
+    {
+        F f_;
+
+        template <typename Result>
+        decltype(auto) operator()(std::vector<pika::future<Result>>&& workitems)
+        {
+            std::vector<Result> values;
+            values.reserve(workitems.size());
+            for (auto& f : workitems)
+            {
+                values.push_back(f.get());
+            }
+            return PIKA_INVOKE(f_, PIKA_MOVE(values));
+        }
+
+        template <typename Result>
+        decltype(auto) operator()(std::vector<Result>&& values)
+        {
+            return PIKA_INVOKE(f_, PIKA_MOVE(values));
+        }
+    };
+
+    // Additionally carries the associative operation used by f to combine
+    // the chunk results, which allows for the synchronous partitioners to
+    // combine those in parallel before invoking f.
+    template <typename F, typename Op>
+    struct tree_chunk_values_reducer : chunk_values_reducer<F>
+    {
+        Op op_;
+    };
+
+    template <typename F>
+    chunk_values_reducer<std::decay_t<F>> make_chunk_values_reducer(F&& f)
+    {
+        return chunk_values_reducer<std::decay_t<F>>{PIKA_FORWARD(F, f)};
+    }
+
+    // Op is the reduction operation applied by f to the chunk results, the
+    // chunk results are combined along a tree if Op opts into it
+    template <typename F, typename Op>
+    auto make_chunk_values_reducer(F&& f, Op&& op)
+    {
+        if constexpr (pika::traits::use_tree_reduction_v<Op>)
+        {
+            return tree_chunk_values_reducer<std::decay_t<F>, std::decay_t<Op>>{
+                {PIKA_FORWARD(F, f)}, PIKA_FORWARD(Op, op)};
+        }
+        else
+        {
+            return chunk_values_reducer<std::decay_t<F>>{PIKA_FORWARD(F, f)};
+        }
+    }
+
+    template <typename F>
+    struct is_chunk_values_reducer : std::false_type
+    {
+    };
+
+    template <typename F>
+    struct is_chunk_values_reducer<chunk_values_reducer<F>> : std::true_type
+    {
+    };
+
+    template <typename F, typename Op>
+    struct is_chunk_values_reducer<tree_chunk_values_reducer<F, Op>>
+      : std::true_type
+    {
+    };
+
+    template <typename F>
+    struct is_tree_chunk_values_reducer : std::false_type
+    {
+    };
+
+    template <typename F, typename Op>
+    struct is_tree_chunk_values_reducer<tree_chunk_values_reducer<F, Op>>
+      : std::true_type
+    {
+    };
+
+    // The chunk results are stored in a preallocated array, which requires
+    // them to be default constructible. The chunks write their slots
+    // concurrently, which rules out the bit-packed std::vector<bool>.
+    template <typename ExPolicy, typename FwdIter, typename Result,
+        typename F2>
+    inline constexpr bool use_partition_values_v =
+        is_chunk_values_reducer<std::decay_t<F2>>::value &&
+        !std::is_void_v<Result> && !std::is_same_v<Result, bool> &&
+        std::is_default_constructible_v<Result> &&
+        !use_work_stealing_partitioner_v<ExPolicy, FwdIter>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run f on all chunks of [first, first + count) and store the chunk
+    // results directly into a contiguous array. Instead of creating one
+    // future per chunk, the completion of all chunks is signalled by a single
+    // latch. Exceptions thrown by the chunks are collected into errors.
+    template <typename Result, bool WithIndex, typename ExPolicy,
+        typename FwdIter, typename Stride, typename F,
+        typename ScopedParameters>
+    std::vector<Result> partition_values(ExPolicy&& policy, FwdIter first,
+        std::size_t count, Stride stride, F&& f,
+        ScopedParameters& scoped_params, std::list<std::exception_ptr>& errors)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+        using has_variable_chunk_size =
+            typename execution::extract_has_variable_chunk_size<
+                parameters_type>::type;
+
+        auto traced_f =
+            util::detail::make_traced_chunk_function("partition", f);
+
+        // the chunk which may be run inline by the executor parameters to
+        // determine the chunk size is still reported as a (ready) future
+        std::vector<pika::future<Result>> inititems;
+        auto shape = [&]() {
+            if constexpr (WithIndex)
+            {
+                return get_bulk_iteration_shape_idx(has_variable_chunk_size{},
+                    policy, inititems, traced_f, first, count, stride);
+            }
+            else
+            {
+                return get_bulk_iteration_shape(has_variable_chunk_size{},
+                    policy, inititems, traced_f, first, count, stride);
+            }
+        }();
+
+        std::size_t const num_init = inititems.size();
+        std::size_t const num_chunks = pika::util::size(shape);
+
+        std::vector<Result> results(num_init + num_chunks);
+        for (std::size_t i = 0; i != num_init; ++i)
+        {
+            results[i] = inititems[i].get();
+        }
+
+        std::vector<std::exception_ptr> exceptions(num_chunks);
+        partitioner_iteration<Result, decltype(traced_f)> iteration{
+            PIKA_MOVE(traced_f)};
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        pika::latch l(static_cast<std::ptrdiff_t>(num_chunks + 1));
+
+        std::size_t i = 0;
+        try
+        {
+            for (auto&& elem : shape)
+            {
+                execution::post(get_chunk_executor(policy, i, cores),
+                    [&, i, elem]() mutable {
+                        try
+                        {
+                            record_chunk_worker(policy.parameters(), i);
+                            results[num_init + i] = iteration(PIKA_MOVE(elem));
+                        }
+                        catch (...)
+                        {
+                            exceptions[i] = std::current_exception();
+                        }
+                        l.count_down(1);
+                    });
+                ++i;
+            }
+        }
+        catch (...)
+        {
+            // the chunks scheduled so far refer to local data, wait for them
+            // to finish before propagating the error
+            l.count_down(static_cast<std::ptrdiff_t>(num_chunks - i));
+            l.arrive_and_wait();
+            throw;
+        }
+
+        scoped_params.mark_end_of_scheduling();
+
+        // wait for all tasks to finish
+        l.arrive_and_wait();
+
+        for (auto& e : exceptions)
+        {
+            if (e)
+            {
+                // rethrows std::bad_alloc
+                handle_local_exceptions<std::decay_t<ExPolicy>>::call(
+                    e, errors);
+            }
+        }
+
+        return results;
+    }
+}    // namespace pika::parallel::detail
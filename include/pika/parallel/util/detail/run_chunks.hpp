@@ -0,0 +1,49 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs f(chunk) for all chunks in [0, num_chunks) on the executor of the
+    // given policy, on the calling thread if there is only one of them.
+    // Exceptions are reported as an exception_list (or std::bad_alloc).
+    template <typename ExPolicy, typename F>
+    void run_chunks(ExPolicy& policy, std::size_t num_chunks, F&& f)
+    {
+        if (num_chunks == 1)
+        {
+            f(std::size_t(0));
+            return;
+        }
+
+        std::vector<pika::future<void>> workers =
+            execution::bulk_async_execute(policy.executor(), f,
+                pika::detail::irange(std::size_t(0), num_chunks));
+        pika::wait_all_nothrow(workers);
+
+        // rethrow either bad_alloc or exception_list
+        std::list<std::exception_ptr> errors;
+        handle_local_exceptions<std::decay_t<ExPolicy>>::call(workers, errors);
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -12,7 +12,11 @@
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/execution_base/sender.hpp>
 #include <pika/executors/execution_policy.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
 
+#include <cstddef>
+#include <iterator>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -46,6 +50,99 @@ namespace pika::detail {
     {
     };
 
+    // Parallel algorithms which can be run as a graph of senders specialize
+    // this for their tag. is_available<ExPolicy, Ts...> holds if the
+    // algorithm can be invoked with the policy and the values Ts... sent by a
+    // predecessor as call(policy, ts...), which returns a sender of the
+    // result. Otherwise the algorithm is invoked with the task policy and the
+    // returned future is used as the sender.
+    template <typename Tag, typename Enable = void>
+    struct algorithm_sender
+    {
+        template <typename ExPolicy, typename... Ts>
+        static constexpr bool is_available = false;
+    };
+
+    template <typename Tag, typename ExPolicy>
+    struct bound_algorithm_sender
+    {
+        std::decay_t<ExPolicy> policy;
+
+        template <typename... Ts>
+        auto operator()(Ts&... ts)
+        {
+            if constexpr (algorithm_sender<Tag>::template is_available<
+                              std::decay_t<ExPolicy>, Ts...>)
+            {
+                return algorithm_sender<Tag>::call(PIKA_MOVE(policy), ts...);
+            }
+            else
+            {
+                return Tag{}(PIKA_MOVE(policy)(pika::execution::task), ts...);
+            }
+        }
+    };
+
+    // Element-wise algorithms, whose result for the elements at a position
+    // of their ranges depends only on the elements at that position,
+    // specialize this for their tag. They can be run on the chunks of their
+    // ranges independently, which allows to run several of them chunk by
+    // chunk, see chunked_stage and pika::chunk_pipeline.
+    template <typename Tag>
+    struct is_shape_preserving_algorithm : std::false_type
+    {
+    };
+
+    // A shape preserving algorithm bound to its arguments except for the end
+    // of the first range. Invoked with (begin, size) it runs the algorithm
+    // sequentially on the elements [begin, begin + size) of its ranges:
+    // first is advanced to the bounds of the chunk, all other random access
+    // iterators among the arguments are advanced by begin.
+    template <typename Tag, typename Iter, typename... Ts>
+    struct chunked_stage
+    {
+        static_assert(is_shape_preserving_algorithm<Tag>::value,
+            "The algorithm has to be element-wise.");
+        static_assert(pika::traits::is_random_access_iterator_v<Iter>,
+            "Requires a random access iterator.");
+
+        Iter first;
+        std::tuple<Ts...> args;
+
+        template <typename T>
+        static decltype(auto) advance(T& t, std::size_t begin)
+        {
+            if constexpr (pika::traits::is_random_access_iterator_v<T>)
+            {
+                return std::next(t, begin);
+            }
+            else
+            {
+                return (t);
+            }
+        }
+
+        void operator()(std::size_t begin, std::size_t size)
+        {
+            std::apply(
+                [&](Ts&... ts) {
+                    Tag{}(pika::execution::seq, std::next(first, begin),
+                        std::next(first, begin + size), advance(ts, begin)...);
+                },
+                args);
+        }
+    };
+
+    template <typename Stage>
+    struct is_chunked_stage : std::false_type
+    {
+    };
+
+    template <typename Tag, typename Iter, typename... Ts>
+    struct is_chunked_stage<chunked_stage<Tag, Iter, Ts...>> : std::true_type
+    {
+    };
+
     // Helper function for use in creating overloads of parallel algorithms that
     // take senders. Takes an execution policy, a predecessor sender, and an
     // "algorithm" (i.e. a tag) and applies then with the predecessor
@@ -56,16 +153,16 @@ namespace pika::detail {
         // If the given execution policy can has a task policy, i.e. the
         // algorithm can return a future, we use the task policy since we can
         // then directly return the future as a sender and avoid potential
-        // blocking that may happen internally.
+        // blocking that may happen internally. Algorithms which provide a
+        // sender implementation for the arguments avoid the future
+        // altogether, see algorithm_sender.
         if constexpr (pika::execution::detail::has_async_execution_policy_v<
                           ExPolicy>)
         {
-            auto task_policy =
-                PIKA_FORWARD(ExPolicy, policy)(pika::execution::task);
             return pika::execution::experimental::let_value(
                 PIKA_FORWARD(Predecessor, predecessor),
-                bound_algorithm<Tag, decltype(task_policy)>{
-                    PIKA_MOVE(task_policy)});
+                bound_algorithm_sender<Tag, ExPolicy>{
+                    PIKA_FORWARD(ExPolicy, policy)});
         }
         // If the policy does not have a task policy, the algorithm can only be
         // called synchronously. In this case we only use then to chain the
@@ -21,6 +21,15 @@ namespace pika::parallel::traits::detail {
     {
     };
 
+    // Fixed size packs are used for the elements of tuples whose native packs
+    // differ in size, see vector_pack_type.
+    template <typename T, int N>
+    struct is_vector_pack<
+        std::experimental::simd<T, std::experimental::simd_abi::fixed_size<N>>>
+      : std::integral_constant<bool, (N > 1)>
+    {
+    };
+
     template <typename T>
     struct is_vector_pack<
         std::experimental::simd<T, std::experimental::simd_abi::fixed_size<1>>>
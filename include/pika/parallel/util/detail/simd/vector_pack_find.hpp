@@ -24,6 +24,17 @@ namespace pika::parallel::traits::detail {
         }
         return -1;
     }
+
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE int
+    find_last_of(std::experimental::simd_mask<T, Abi> const& msk)
+    {
+        if (std::experimental::any_of(msk))
+        {
+            return std::experimental::find_last_set(msk);
+        }
+        return -1;
+    }
 }    // namespace pika::parallel::traits::detail
 
 #endif
@@ -10,26 +10,79 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD)
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 #include <experimental/simd>
 
 namespace pika::parallel::traits::detail {
+    // Whether masked loads and stores of V are done in hardware, otherwise
+    // they are emulated lane by lane.
+    template <typename V>
+    struct vector_pack_has_masked_access
+#if defined(__AVX512F__)
+      : std::integral_constant<bool, (V::size() > 1)>
+#else
+      : std::false_type
+#endif
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
     template <typename V, typename ValueType, typename Enable>
     struct vector_pack_load
     {
         template <typename Iter>
         static V aligned(Iter const& iter)
         {
-            return V(std::addressof(*iter), std::experimental::vector_aligned);
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                return vector_pack_gather<V>(iter, V::size());
+            }
+            else
+            {
+                return V(pika::detail::to_address(iter),
+                    std::experimental::vector_aligned);
+            }
         }
 
         template <typename Iter>
         static V unaligned(Iter const& iter)
         {
-            return V(std::addressof(*iter), std::experimental::element_aligned);
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                return vector_pack_gather<V>(iter, V::size());
+            }
+            else
+            {
+                return V(pika::detail::to_address(iter),
+                    std::experimental::element_aligned);
+            }
+        }
+
+        // Loads the first count elements, the other lanes are set to the
+        // first element.
+        template <typename Iter>
+        static V masked(Iter const& iter, std::size_t count)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                return vector_pack_gather<V>(iter, count);
+            }
+            else
+            {
+                V value(*iter);
+                std::experimental::where(
+                    vector_pack_first_n_mask<V>(count), value)
+                    .copy_from(pika::detail::to_address(iter),
+                        std::experimental::element_aligned);
+                return value;
+            }
         }
     };
 
@@ -40,15 +93,46 @@ namespace pika::parallel::traits::detail {
         template <typename Iter>
         static void aligned(V& value, Iter const& iter)
         {
-            value.copy_to(
-                std::addressof(*iter), std::experimental::vector_aligned);
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                vector_pack_scatter(value, iter, V::size());
+            }
+            else
+            {
+                value.copy_to(pika::detail::to_address(iter),
+                    std::experimental::vector_aligned);
+            }
         }
 
         template <typename Iter>
         static void unaligned(V& value, Iter const& iter)
         {
-            value.copy_to(
-                std::addressof(*iter), std::experimental::element_aligned);
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                vector_pack_scatter(value, iter, V::size());
+            }
+            else
+            {
+                value.copy_to(pika::detail::to_address(iter),
+                    std::experimental::element_aligned);
+            }
+        }
+
+        // Stores the first count lanes only.
+        template <typename Iter>
+        static void masked(V& value, Iter const& iter, std::size_t count)
+        {
+            if constexpr (vector_pack_gather_access<Iter>::value)
+            {
+                vector_pack_scatter(value, iter, count);
+            }
+            else
+            {
+                std::experimental::where(
+                    vector_pack_first_n_mask<V>(count), value)
+                    .copy_to(pika::detail::to_address(iter),
+                        std::experimental::element_aligned);
+            }
         }
     };
 }    // namespace pika::parallel::traits::detail
@@ -0,0 +1,55 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace pika::parallel::traits::detail {
+    // Op has to be applicable to whole packs, see vector_pack_reduce_op.
+    template <typename T, typename Abi, typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce(
+        std::experimental::simd<T, Abi> const& value, Op op)
+    {
+        return std::experimental::reduce(value, op);
+    }
+
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce_min(
+        std::experimental::simd<T, Abi> const& value)
+    {
+        return std::experimental::hmin(value);
+    }
+
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T reduce_max(
+        std::experimental::simd<T, Abi> const& value)
+    {
+        return std::experimental::hmax(value);
+    }
+
+    // element-wise minimum and maximum of two packs
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::experimental::simd<T, Abi> min(
+        std::experimental::simd<T, Abi> const& lhs,
+        std::experimental::simd<T, Abi> const& rhs)
+    {
+        return std::experimental::min(lhs, rhs);
+    }
+
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::experimental::simd<T, Abi> max(
+        std::experimental::simd<T, Abi> const& lhs,
+        std::experimental::simd<T, Abi> const& rhs)
+    {
+        return std::experimental::max(lhs, rhs);
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,25 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace pika::parallel::traits::detail {
+    // Sets the lanes of value which are selected by msk to new_value.
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void where_assign(
+        std::experimental::simd_mask<T, Abi> const& msk,
+        std::experimental::simd<T, Abi>& value, T const& new_value)
+    {
+        std::experimental::where(msk, value) = new_value;
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/cancellable_partition.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    // The size of the first windows scanned by a search
+    inline constexpr std::size_t speculative_window_min_size = 2048;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Executor parameters for searches which stop at the first match. The
+    // chunks are claimed by the workers in the order of the sequence (see
+    // partition_cancellable), so the first chunks form a window at the front
+    // of the sequence which is scanned by all workers together. Each chunk
+    // is given the number of elements scanned so far divided by the number
+    // of cores, i.e. the window doubles in size with every round of chunks.
+    // A match close to the front of the sequence is found after scanning
+    // about twice as many elements as precede it, while sequences without a
+    // match are scanned in a few large chunks. The chunks are never larger
+    // than the remaining elements divided by the number of cores.
+    struct speculative_windows
+    {
+        constexpr explicit speculative_windows(std::size_t count,
+            std::size_t min_window = speculative_window_min_size) noexcept
+          : count_(count)
+          , min_window_(min_window == 0 ? 1 : min_window)
+        {
+        }
+
+        // This executor parameters type provides variable chunk sizes and
+        // needs to be invoked for each of the chunks to be combined.
+        using has_variable_chunk_size = std::true_type;
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(Executor&&, F&&,
+            std::size_t cores, std::size_t num_tasks) const noexcept
+        {
+            std::size_t const scanned =
+                count_ > num_tasks ? count_ - num_tasks : 0;
+            std::size_t const balanced = (num_tasks + cores - 1) / cores;
+            return (std::max)(
+                min_window_, (std::min)(scanned / cores, balanced));
+        }
+
+    private:
+        std::size_t count_;
+        std::size_t min_window_;
+    };
+
+    // Synchronous searches run without executor parameters scan the count
+    // elements in speculative windows. Asynchronous policies create all
+    // chunks up front and don't run them in order.
+    template <typename ExPolicy, typename FwdIter>
+    inline constexpr bool use_speculative_windows_v =
+        std::is_same_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type,
+            pika::execution::parallel_policy::executor_parameters_type> &&
+        use_cancellable_partitioner_v<ExPolicy, FwdIter>;
+
+    template <typename FwdIter, typename ExPolicy>
+    decltype(auto) with_speculative_windows(
+        ExPolicy&& policy, std::size_t count)
+    {
+        if constexpr (use_speculative_windows_v<ExPolicy, FwdIter>)
+        {
+            return policy.with(speculative_windows(count));
+        }
+        else
+        {
+            return PIKA_FORWARD(ExPolicy, policy);
+        }
+    }
+}    // namespace pika::parallel::detail
+
+namespace pika::parallel::execution {
+    template <>
+    struct is_executor_parameters<pika::parallel::detail::speculative_windows>
+      : std::true_type
+    {
+    };
+}    // namespace pika::parallel::execution
@@ -0,0 +1,327 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
+#include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/summation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    template <typename Parameters>
+    constexpr pika::execution::summation_mode select_summation(
+        Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters, pika::execution::summation>)
+        {
+            return params.get_summation_mode();
+        }
+        else
+        {
+            return pika::execution::summation_mode::standard;
+        }
+    }
+
+    // The reductions which are affected by the summation executor parameters
+    template <typename T, typename Op>
+    inline constexpr bool is_floating_point_sum_v =
+        std::is_floating_point_v<T> &&
+        (std::is_same_v<std::decay_t<Op>, std::plus<T>> ||
+            std::is_same_v<std::decay_t<Op>, std::plus<>>);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Kahan-Babuska (Neumaier) summation: compensation accumulates the
+    // rounding errors of the additions to sum.
+    template <typename T>
+    struct compensated_sum
+    {
+        T sum = T(0);
+        T compensation = T(0);
+
+        void add(T value) noexcept
+        {
+            T const t = sum + value;
+            if (std::abs(sum) >= std::abs(value))
+            {
+                compensation += (sum - t) + value;
+            }
+            else
+            {
+                compensation += (value - t) + sum;
+            }
+            sum = t;
+        }
+
+        void add(compensated_sum const& rhs) noexcept
+        {
+            add(rhs.sum);
+            compensation += rhs.compensation;
+        }
+
+        T value() const noexcept
+        {
+            // the compensation of infinite sums is not a number
+            return std::isfinite(sum) ? sum + compensation : sum;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pairwise summation of a sequence of values of unknown length: the
+    // values are added in blocks of BlockSize, the block sums are combined
+    // along a binary tree. levels_[k] holds the sum of 2^k blocks if bit k of
+    // blocks_ is set.
+    template <typename T, std::size_t BlockSize = 128>
+    class pairwise_sum
+    {
+    public:
+        void add(T value) noexcept
+        {
+            block_ += value;
+            if (++block_size_ == BlockSize)
+            {
+                push(block_);
+                block_ = T(0);
+                block_size_ = 0;
+            }
+        }
+
+        T value() const noexcept
+        {
+            T result = block_;
+            for (std::size_t k = 0; k != num_levels; ++k)
+            {
+                if (blocks_ & (std::uint64_t(1) << k))
+                {
+                    result = levels_[k] + result;
+                }
+            }
+            return result;
+        }
+
+    private:
+        void push(T value) noexcept
+        {
+            std::size_t k = 0;
+            for (/* */; blocks_ & (std::uint64_t(1) << k); ++k)
+            {
+                value = levels_[k] + value;
+            }
+            levels_[k] = value;
+            ++blocks_;
+        }
+
+        static constexpr std::size_t num_levels = 64;
+
+        std::array<T, num_levels> levels_{};
+        std::uint64_t blocks_ = 0;
+        T block_ = T(0);
+        std::size_t block_size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The reproducible summation sums blocks of this many values, the
+    // results do not depend on anything else but the number of values.
+    inline constexpr std::size_t reproducible_summation_block_size = 4096;
+
+    // Sum the values of one block, moves first to the beginning of the next
+    // block.
+    template <typename T, typename Iter, typename Sent, typename Convert>
+    T reproducible_block_sum(Iter& first, Sent last, Convert& conv)
+    {
+        pairwise_sum<T> sum;
+        for (std::size_t i = 0;
+             i != reproducible_summation_block_size && first != last;
+             (void) ++i, ++first)
+        {
+            sum.add(T(PIKA_INVOKE(conv, first)));
+        }
+        return sum.value();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sum init and conv(it) for all iterators it in [first, last) as selected
+    // by mode, which is not summation_mode::standard.
+    template <typename T, typename Iter, typename Sent, typename Convert>
+    T sequential_summation(pika::execution::summation_mode mode, Iter first,
+        Sent last, T init, Convert&& conv)
+    {
+        if (mode == pika::execution::summation_mode::reproducible)
+        {
+            pairwise_sum<T, 1> sum;
+            sum.add(init);
+            while (first != last)
+            {
+                sum.add(reproducible_block_sum<T>(first, last, conv));
+            }
+            return sum.value();
+        }
+
+        if (mode == pika::execution::summation_mode::pairwise)
+        {
+            pairwise_sum<T> sum;
+            sum.add(init);
+            for (/* */; first != last; ++first)
+            {
+                sum.add(T(PIKA_INVOKE(conv, first)));
+            }
+            return sum.value();
+        }
+
+        compensated_sum<T> sum;
+        sum.add(init);
+        for (/* */; first != last; ++first)
+        {
+            sum.add(T(PIKA_INVOKE(conv, first)));
+        }
+        return sum.value();
+    }
+
+    // The chunks of the reproducible summation are runs of whole blocks,
+    // each chunk returns the sums of its blocks. The block sums of all
+    // chunks are combined in order along a tree.
+    template <typename T, typename ExPolicy, typename FwdIter,
+        typename Convert>
+    typename algorithm_result<ExPolicy, T>::type reproducible_summation(
+        ExPolicy&& policy, FwdIter first, std::size_t count, T init,
+        Convert&& conv)
+    {
+        if constexpr (!pika::traits::is_random_access_iterator_v<FwdIter>)
+        {
+            PIKA_UNUSED(policy);
+            return algorithm_result<ExPolicy, T>::get(sequential_summation(
+                pika::execution::summation_mode::reproducible, first,
+                std::next(first, static_cast<std::ptrdiff_t>(count)),
+                PIKA_MOVE(init), PIKA_FORWARD(Convert, conv)));
+        }
+        else
+        {
+            constexpr std::size_t block_size =
+                reproducible_summation_block_size;
+            std::size_t const num_blocks =
+                (count + block_size - 1) / block_size;
+
+            auto f1 = [first, count, conv = PIKA_FORWARD(Convert, conv)](
+                          auto part_begin,
+                          std::size_t part_size) mutable -> std::vector<T> {
+                std::size_t const begin = *part_begin * block_size;
+                FwdIter it = first + begin;
+                FwdIter const last =
+                    first + (std::min)(count, begin + part_size * block_size);
+
+                std::vector<T> sums;
+                sums.reserve(part_size);
+                while (it != last)
+                {
+                    sums.push_back(reproducible_block_sum<T>(it, last, conv));
+                }
+                return sums;
+            };
+
+            return partitioner<ExPolicy, T, std::vector<T>>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_counting_iterator(std::size_t(0)),
+                num_blocks, PIKA_MOVE(f1),
+                make_chunk_values_reducer(
+                    [init](std::vector<std::vector<T>>&& results) -> T {
+                        pairwise_sum<T, 1> sum;
+                        sum.add(init);
+                        for (std::vector<T> const& sums : results)
+                        {
+                            for (T const& block : sums)
+                            {
+                                sum.add(block);
+                            }
+                        }
+                        return sum.value();
+                    }));
+        }
+    }
+
+    // The chunks are summed in parallel, each into its own accumulator. The
+    // compensated accumulators of the chunks are combined including their
+    // compensation, the results of pairwise summed chunks along a tree.
+    template <typename T, typename ExPolicy, typename FwdIter,
+        typename Convert>
+    typename algorithm_result<ExPolicy, T>::type parallel_summation(
+        ExPolicy&& policy, FwdIter first, std::size_t count, T init,
+        Convert&& conv)
+    {
+        auto const mode = select_summation(policy.parameters());
+        if (mode == pika::execution::summation_mode::reproducible)
+        {
+            return reproducible_summation(PIKA_FORWARD(ExPolicy, policy),
+                first, count, PIKA_MOVE(init), PIKA_FORWARD(Convert, conv));
+        }
+
+        if (mode == pika::execution::summation_mode::pairwise)
+        {
+            auto f1 = [conv](FwdIter part_begin,
+                          std::size_t part_size) mutable -> T {
+                pairwise_sum<T> sum;
+                for (/* */; part_size != 0; (void) ++part_begin, --part_size)
+                {
+                    sum.add(T(PIKA_INVOKE(conv, part_begin)));
+                }
+                return sum.value();
+            };
+
+            return partitioner<ExPolicy, T>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
+                make_chunk_values_reducer(
+                    [init](std::vector<T>&& results) -> T {
+                        pairwise_sum<T, 1> sum;
+                        sum.add(init);
+                        for (T const& result : results)
+                        {
+                            sum.add(result);
+                        }
+                        return sum.value();
+                    }));
+        }
+
+        auto f1 = [conv = PIKA_FORWARD(Convert, conv)](FwdIter part_begin,
+                      std::size_t part_size) mutable -> compensated_sum<T> {
+            compensated_sum<T> sum;
+            for (/* */; part_size != 0; (void) ++part_begin, --part_size)
+            {
+                sum.add(T(PIKA_INVOKE(conv, part_begin)));
+            }
+            return sum;
+        };
+
+        return partitioner<ExPolicy, T, compensated_sum<T>>::call(
+            PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
+            make_chunk_values_reducer(
+                [init](std::vector<compensated_sum<T>>&& results) -> T {
+                    compensated_sum<T> sum;
+                    sum.add(init);
+                    for (compensated_sum<T> const& result : results)
+                    {
+                        sum.add(result);
+                    }
+                    return sum.value();
+                }));
+    }
+    /// \endcond
+}    // namespace pika::parallel::detail
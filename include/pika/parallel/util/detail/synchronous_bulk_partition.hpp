@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/executors/fork_join_executor.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/range.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/partitioner_iteration.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Executors whose bulk_sync_execute runs all elements of the shape and
+    // returns once they are done, without creating a future per element
+    // (and without falling back to bulk_async_execute). The synchronous
+    // partitioners run their chunks through it directly. Specialize this
+    // for other executors of that kind.
+    template <typename Executor>
+    struct is_synchronous_bulk_executor : std::false_type
+    {
+    };
+
+    template <>
+    struct is_synchronous_bulk_executor<
+        pika::execution::experimental::fork_join_executor> : std::true_type
+    {
+    };
+
+    // Executor parameters which place the chunks on particular workers, or
+    // which steal chunks, are handled by their own partitioning schemes.
+    template <typename ExPolicy, typename FwdIter>
+    inline constexpr bool use_synchronous_bulk_partition_v =
+        is_synchronous_bulk_executor<
+            typename std::decay_t<ExPolicy>::executor_type>::value &&
+        !use_work_stealing_partitioner_v<ExPolicy, FwdIter> &&
+        !use_chunk_placement_v<ExPolicy>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run f on all chunks of [first, first + count) as a single synchronous
+    // bulk operation of the executor of the policy. Chunks which throw are
+    // recorded in errors (std::bad_alloc is rethrown). If Result is not void
+    // the chunk results are returned in order, they are written directly
+    // into their slot of the returned array, so Result can not be bool. The
+    // chunks are traced as name.
+    template <typename Result, bool WithIndex, typename ExPolicy,
+        typename FwdIter, typename Stride, typename F>
+    auto partition_synchronous_bulk(char const* name, ExPolicy&& policy,
+        FwdIter first, std::size_t count, Stride stride, F&& f,
+        std::list<std::exception_ptr>& errors)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+        using has_variable_chunk_size =
+            typename execution::extract_has_variable_chunk_size<
+                parameters_type>::type;
+
+        auto traced_f =
+            util::detail::make_traced_chunk_function(name, PIKA_FORWARD(F, f));
+
+        // the chunk which may be run inline by the executor parameters to
+        // determine the chunk size is reported as a (ready) future
+        std::vector<pika::future<Result>> inititems;
+        auto shape = [&]() {
+            if constexpr (WithIndex)
+            {
+                return get_bulk_iteration_shape_idx(has_variable_chunk_size{},
+                    policy, inititems, traced_f, first, count, stride);
+            }
+            else
+            {
+                return get_bulk_iteration_shape(has_variable_chunk_size{},
+                    policy, inititems, traced_f, first, count, stride);
+            }
+        }();
+
+        partitioner_iteration<Result, decltype(traced_f)> iteration{
+            PIKA_MOVE(traced_f)};
+
+        // exceptions are rare, a lock keeps them from costing anything else
+        std::mutex mtx;
+        std::list<std::exception_ptr> exceptions;
+        auto record_exception = [&]() {
+            std::lock_guard<std::mutex> l(mtx);
+            exceptions.push_back(std::current_exception());
+        };
+
+        auto handle_exceptions = [&]() {
+            for (auto& e : inititems)
+            {
+                if (e.has_exception())
+                {
+                    exceptions.push_back(e.get_exception_ptr());
+                }
+            }
+            for (auto& e : exceptions)
+            {
+                // rethrows std::bad_alloc
+                handle_local_exceptions<std::decay_t<ExPolicy>>::call(
+                    e, errors);
+            }
+        };
+
+        if constexpr (std::is_void_v<Result>)
+        {
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](auto&& elem) {
+                    try
+                    {
+                        iteration(PIKA_FORWARD(decltype(elem), elem));
+                    }
+                    catch (...)
+                    {
+                        record_exception();
+                    }
+                },
+                shape);
+
+            handle_exceptions();
+        }
+        else
+        {
+            // the chunks write their slots concurrently, the words of the
+            // bit-packed std::vector<bool> would be shared between chunks
+            static_assert(!std::is_same_v<Result, bool>,
+                "bool chunk results have to be returned through futures");
+
+            std::size_t const num_init = inititems.size();
+            std::vector<Result> results(num_init + pika::util::size(shape));
+            for (std::size_t i = 0; i != num_init; ++i)
+            {
+                if (!inititems[i].has_exception())
+                {
+                    results[i] = inititems[i].get();
+                }
+            }
+
+            // the chunk index determines the slot of its result
+            using chunk_type = typename std::iterator_traits<
+                decltype(pika::util::begin(shape))>::value_type;
+            std::vector<chunk_type> chunks(
+                pika::util::begin(shape), pika::util::end(shape));
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t i) {
+                    try
+                    {
+                        results[num_init + i] = iteration(chunks[i]);
+                    }
+                    catch (...)
+                    {
+                        record_exception();
+                    }
+                },
+                pika::detail::irange(std::size_t(0), chunks.size()));
+
+            handle_exceptions();
+            return results;
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,50 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/irange.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Combine count partial results along a binary tree, leaving the overall
+    // result in the first one. combine(i, j) has to merge the partial result
+    // j into the partial result i (i < j). All combinations of a level of the
+    // tree run concurrently on the given executor, the order of the partial
+    // results is preserved.
+    template <typename Executor, typename Combine>
+    void tree_reduce(Executor&& exec, std::size_t count, Combine&& combine)
+    {
+        for (std::size_t distance = 1; distance < count; distance *= 2)
+        {
+            // the pairs of this level are (k * 2 * distance, k * 2 *
+            // distance + distance), for all k for which the second element
+            // exists
+            std::size_t const num_pairs =
+                (count - distance + 2 * distance - 1) / (2 * distance);
+
+            auto combine_pair = [&, distance](std::size_t k) {
+                std::size_t const i = 2 * distance * k;
+                combine(i, i + distance);
+            };
+
+            if (num_pairs == 1)
+            {
+                combine_pair(0);
+            }
+            else
+            {
+                execution::bulk_sync_execute(exec, combine_pair,
+                    pika::detail::irange(std::size_t(0), num_pairs));
+            }
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,265 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/is_negative.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/parallel/util/work_stealing_chunk_size.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    template <typename Parameters>
+    struct is_work_stealing_parameters : std::false_type
+    {
+    };
+
+    template <>
+    struct is_work_stealing_parameters<
+        pika::execution::work_stealing_chunk_size> : std::true_type
+    {
+    };
+
+    // The work stealing scheme is only used for synchronous policies (the
+    // asynchronous partitioners need one future per chunk up front) and for
+    // random access iterators (a thief needs to jump into the middle of the
+    // range of its victim).
+    template <typename ExPolicy, typename FwdIter>
+    inline constexpr bool use_work_stealing_partitioner_v =
+        is_work_stealing_parameters<typename std::decay_t<
+            ExPolicy>::executor_parameters_type>::value &&
+        !pika::is_async_execution_policy_v<std::decay_t<ExPolicy>> &&
+        pika::traits::is_random_access_iterator_v<FwdIter>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A contiguous range of blocks [begin, end) owned by one worker. The owner
+    // takes chunks from the front, thieves split off the back half. All
+    // critical sections are a few instructions long, so a spinlock is used.
+    struct alignas(64) work_stealing_range
+    {
+        void lock() noexcept
+        {
+            while (locked_.exchange(true, std::memory_order_acquire))
+            {
+                while (locked_.load(std::memory_order_relaxed))
+                {
+                }
+            }
+        }
+
+        void unlock() noexcept
+        {
+            locked_.store(false, std::memory_order_release);
+        }
+
+        void assign(std::size_t begin, std::size_t end) noexcept
+        {
+            std::lock_guard<work_stealing_range> l(*this);
+            begin_ = begin;
+            end_ = end;
+        }
+
+        // take up to chunk_size blocks from the front of the range
+        bool pop_front(std::size_t chunk_size, std::size_t& first,
+            std::size_t& count) noexcept
+        {
+            std::lock_guard<work_stealing_range> l(*this);
+            if (begin_ == end_)
+                return false;
+
+            first = begin_;
+            count = (std::min)(chunk_size, end_ - begin_);
+            begin_ += count;
+            return true;
+        }
+
+        // hand the back half of the remaining blocks to a thief, the owner
+        // keeps at least min_size blocks
+        bool steal_back(std::size_t min_size, std::size_t& first,
+            std::size_t& last) noexcept
+        {
+            std::lock_guard<work_stealing_range> l(*this);
+            std::size_t const remaining = end_ - begin_;
+            if (remaining < 2 || remaining < 2 * min_size)
+                return false;
+
+            first = begin_ + remaining / 2;
+            last = end_;
+            end_ = first;
+            return true;
+        }
+
+    private:
+        std::atomic<bool> locked_{false};
+        std::size_t begin_ = 0;
+        std::size_t end_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run f on all chunks of [first, first + count) using one task per
+    // worker, where idle workers steal half of the remaining work of busy
+    // workers. The returned (ready) futures are ordered by the position of
+    // their chunk in the input sequence, which allows for the result to be
+    // reduced exactly as for the static partitioning.
+    template <typename Result, bool WithIndex, typename ExPolicy,
+        typename FwdIter, typename Stride, typename F>
+    std::vector<pika::future<Result>> partition_work_stealing(ExPolicy&& policy,
+        FwdIter first, std::size_t count, Stride s, F&& f)
+    {
+        std::size_t const stride = std::size_t(parallel::detail::abs(s));
+        PIKA_ASSERT(stride != 0);
+
+        // all splitting happens in units of blocks of 'stride' elements
+        std::size_t const num_blocks = (count + stride - 1) / stride;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_workers =
+            (std::max)((std::min)(cores, num_blocks), std::size_t(1));
+
+        std::size_t const chunk_size =
+            policy.parameters().get_stealing_chunk_size(
+                num_workers, num_blocks);
+
+        auto traced_f =
+            util::detail::make_traced_chunk_function("partition", f);
+
+        std::vector<work_stealing_range> ranges(num_workers);
+        for (std::size_t i = 0; i != num_workers; ++i)
+        {
+            ranges[i].assign(i * num_blocks / num_workers,
+                (i + 1) * num_blocks / num_workers);
+        }
+
+        using chunk_results_type = std::pair<std::vector<std::size_t>,
+            std::vector<pika::future<Result>>>;
+        std::vector<chunk_results_type> results(num_workers);
+
+        auto run_chunk = [&](auto& chunk_f, chunk_results_type& r,
+                             std::size_t block, std::size_t num_chunk_blocks) {
+            std::size_t const base_idx = block * stride;
+            std::size_t const size =
+                (std::min)((block + num_chunk_blocks) * stride, count) -
+                base_idx;
+
+            r.first.push_back(base_idx);
+            try
+            {
+                FwdIter it = std::next(first, base_idx);
+                if constexpr (WithIndex)
+                {
+                    add_ready_future_idx(
+                        r.second, chunk_f, it, base_idx, size);
+                }
+                else
+                {
+                    add_ready_future(r.second, chunk_f, it, size);
+                }
+            }
+            catch (...)
+            {
+                r.second.push_back(pika::make_exceptional_future<Result>(
+                    std::current_exception()));
+            }
+        };
+
+        auto worker = [&](std::size_t i) {
+            chunk_results_type& r = results[i];
+            work_stealing_range& own = ranges[i];
+
+            // every worker runs its chunks on its own copy of the function,
+            // as with the static partitioning the function may keep state
+            // for the chunk it runs (e.g. the for_loop inductions)
+            auto chunk_f = traced_f;
+
+            std::size_t block = 0;
+            std::size_t num_chunk_blocks = 0;
+            while (true)
+            {
+                while (own.pop_front(chunk_size, block, num_chunk_blocks))
+                {
+                    run_chunk(chunk_f, r, block, num_chunk_blocks);
+                }
+
+                // our own range is exhausted, try to steal from the others
+                bool stolen = false;
+                for (std::size_t k = 1; k != num_workers; ++k)
+                {
+                    std::size_t begin = 0;
+                    std::size_t end = 0;
+                    if (ranges[(i + k) % num_workers].steal_back(
+                            chunk_size, begin, end))
+                    {
+                        own.assign(begin, end);
+                        stolen = true;
+                        break;
+                    }
+                }
+
+                if (!stolen)
+                    break;
+            }
+        };
+
+        std::vector<pika::future<void>> workers =
+            execution::bulk_async_execute(policy.executor(), worker,
+                pika::detail::irange(std::size_t(0), num_workers));
+        pika::wait_all_nothrow(workers);
+
+        // order the chunk results by their position in the sequence
+        std::vector<std::pair<std::size_t, pika::future<Result>>> chunks;
+        for (auto& r : results)
+        {
+            for (std::size_t j = 0; j != r.first.size(); ++j)
+            {
+                chunks.emplace_back(r.first[j], PIKA_MOVE(r.second[j]));
+            }
+        }
+        std::sort(chunks.begin(), chunks.end(),
+            [](auto const& lhs, auto const& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        std::vector<pika::future<Result>> workitems;
+        workitems.reserve(chunks.size() + workers.size());
+        for (auto& chunk : chunks)
+        {
+            workitems.push_back(PIKA_MOVE(chunk.second));
+        }
+
+        // propagate errors which escaped the workers themselves
+        for (auto& w : workers)
+        {
+            if (w.has_exception())
+            {
+                workitems.push_back(pika::make_exceptional_future<Result>(
+                    w.get_exception_ptr()));
+            }
+        }
+
+        return workitems;
+    }
+}    // namespace pika::parallel::detail
@@ -19,11 +19,16 @@
 #include <pika/execution/executors/execution_parameters.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
 #include <pika/parallel/util/detail/partitioner_iteration.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <pika/parallel/util/detail/select_partitioner.hpp>
+#include <pika/parallel/util/detail/synchronous_bulk_partition.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/parallel/util/nothrow_chunks.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -42,22 +47,37 @@ namespace pika::parallel::detail {
     foreach_partition(
         ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
     {
-        // estimate a chunk size based on number of cores used
-        using parameters_type =
-            typename std::decay_t<ExPolicy>::executor_parameters_type;
-        using has_variable_chunk_size =
-            typename execution::extract_has_variable_chunk_size<
-                parameters_type>::type;
-
-        std::vector<pika::future<Result>> inititems;
-        auto shape = get_bulk_iteration_shape_idx(has_variable_chunk_size{},
-            PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, 1);
-
-        std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
-        return std::make_pair(PIKA_MOVE(inititems), PIKA_MOVE(workitems));
+        if constexpr (use_work_stealing_partitioner_v<ExPolicy, FwdIter>)
+        {
+            return std::make_pair(std::vector<pika::future<Result>>{},
+                partition_work_stealing<Result, true>(
+                    PIKA_FORWARD(ExPolicy, policy), first, count, 1,
+                    PIKA_FORWARD(F, f)));
+        }
+        else
+        {
+            // estimate a chunk size based on number of cores used
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+            using has_variable_chunk_size =
+                typename execution::extract_has_variable_chunk_size<
+                    parameters_type>::type;
+
+            auto traced_f = util::detail::make_traced_chunk_function(
+                "foreach", PIKA_FORWARD(F, f));
+
+            std::vector<pika::future<Result>> inititems;
+            auto shape = get_bulk_iteration_shape_idx(has_variable_chunk_size{},
+                PIKA_FORWARD(ExPolicy, policy), inititems, traced_f, first,
+                count, 1);
+
+            std::vector<pika::future<Result>> workitems =
+                bulk_async_execute_chunks<Result>(policy,
+                    partitioner_iteration<Result, decltype(traced_f)>{
+                        PIKA_MOVE(traced_f)},
+                    PIKA_MOVE(shape));
+            return std::make_pair(PIKA_MOVE(inititems), PIKA_MOVE(workitems));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -85,13 +105,53 @@ namespace pika::parallel::detail {
 
             FwdIter last = parallel::detail::next(first, count);
 
+            if constexpr (!(std::is_void_v<Result> &&
+                              use_synchronous_bulk_partition_v<ExPolicy_,
+                                  FwdIter>) &&
+                util::detail::use_nothrow_chunks_v<ExPolicy_, F1, FwdIter,
+                    std::size_t, std::size_t>)
+            {
+                // the chunks don't throw, their exceptions are not collected
+                std::vector<pika::future<Result>> inititems, workitems;
+                try
+                {
+                    std::tie(inititems, workitems) =
+                        foreach_partition<Result>(
+                            PIKA_FORWARD(ExPolicy_, policy), first, count,
+                            util::detail::make_nothrow_chunk_function<F1,
+                                FwdIter, std::size_t, std::size_t>(
+                                PIKA_FORWARD(F1, f1)));
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return reduce_nothrow(PIKA_MOVE(workitems),
+                    PIKA_FORWARD(F2, f2), PIKA_MOVE(last));
+            }
+
             std::vector<pika::future<Result>> inititems, workitems;
             std::list<std::exception_ptr> errors;
             try
             {
-                std::tie(inititems, workitems) =
-                    foreach_partition<Result>(PIKA_FORWARD(ExPolicy_, policy),
-                        first, count, PIKA_FORWARD(F1, f1));
+                if constexpr (std::is_void_v<Result> &&
+                    use_synchronous_bulk_partition_v<ExPolicy_, FwdIter>)
+                {
+                    // the chunks have finished once this returns
+                    partition_synchronous_bulk<Result, true>("foreach",
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, 1,
+                        PIKA_FORWARD(F1, f1), errors);
+                }
+                else
+                {
+                    std::tie(inititems, workitems) =
+                        foreach_partition<Result>(
+                            PIKA_FORWARD(ExPolicy_, policy), first, count,
+                            PIKA_FORWARD(F1, f1));
+                }
 
                 scoped_params.mark_end_of_scheduling();
             }
@@ -130,6 +190,27 @@ namespace pika::parallel::detail {
             PIKA_ASSERT(false);
             return last;
         }
+
+        template <typename F, typename FwdIter>
+        static FwdIter reduce_nothrow(
+            std::vector<pika::future<Result>>&& workitems, F&& f, FwdIter last)
+        {
+            // wait for all tasks to finish, none of them holds an exception
+            pika::wait_all_nothrow(workitems);
+
+            try
+            {
+                return f(PIKA_MOVE(last));
+            }
+            catch (...)
+            {
+                // rethrow either bad_alloc or exception_list
+                handle_exceptions::call(std::current_exception());
+            }
+
+            PIKA_ASSERT(false);
+            return last;
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////
@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/guided_chunk_size.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Iterations are divided into chunks of decreasing size. Each chunk is
+    /// given the number of iterations which have not been assigned to a chunk
+    /// yet divided by the number of cores, but no less than a given minimum.
+    /// This is equivalent to OpenMP's 'schedule(guided)'. The large initial
+    /// chunks keep the scheduling overhead low, while the small final chunks
+    /// reduce the load imbalance at the end of irregular workloads.
+    ///
+    struct guided_chunk_size
+    {
+        /// Construct a \a guided_chunk_size executor parameters object
+        ///
+        /// \param min_chunk_size [in] The minimal number of iterations in a
+        ///                     chunk, only the very last chunk may be smaller.
+        ///
+        constexpr explicit guided_chunk_size(
+            std::size_t min_chunk_size = 1) noexcept
+          : min_chunk_size_(min_chunk_size == 0 ? 1 : min_chunk_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type provides variable chunk sizes and
+        // needs to be invoked for each of the chunks to be combined.
+        using has_variable_chunk_size = std::true_type;
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(Executor&&, F&&,
+            std::size_t cores, std::size_t num_tasks) const noexcept
+        {
+            std::size_t const chunk_size = (num_tasks + cores - 1) / cores;
+            return (std::max)(min_chunk_size_, chunk_size);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t min_chunk_size_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::guided_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
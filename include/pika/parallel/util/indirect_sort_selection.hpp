@@ -0,0 +1,75 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/indirect_sort_selection.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects whether \a sort and \a stable_sort sort the elements
+    /// indirectly.
+    enum class indirect_sort_mode
+    {
+        /// Sort sufficiently large sequences of large elements indirectly
+        automatic,
+        /// Sort indirectly regardless of the size of the sequence and of its
+        /// elements
+        always,
+        /// Always move the elements themselves while sorting
+        never
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \a sort and \a stable_sort sort sequences of large elements (of at
+    /// least 128 bytes) indirectly: the iterators referring to the elements
+    /// are sorted instead of the elements, which are then moved to their
+    /// place once, along the cycles of the resulting permutation. This
+    /// executor parameters type allows for forcing or disabling that
+    /// dispatch. Elements which can't be moved without throwing are always
+    /// sorted directly, as is a \a stable_sort bounded by
+    /// \a stable_sort_memory_limit.
+    ///
+    struct indirect_sort_selection
+    {
+        /// Construct an \a indirect_sort_selection executor parameters object
+        ///
+        /// \param mode [in] Whether the elements are sorted indirectly.
+        ///
+        constexpr explicit indirect_sort_selection(
+            indirect_sort_mode mode = indirect_sort_mode::always) noexcept
+          : mode_(mode)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr indirect_sort_mode get_indirect_sort_mode() const noexcept
+        {
+            return mode_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        indirect_sort_mode mode_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::indirect_sort_selection>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
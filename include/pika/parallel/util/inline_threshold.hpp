@@ -0,0 +1,67 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/inline_threshold.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type running algorithms on small inputs inline.
+    /// An algorithm invoked with a parallel policy whose input has at most
+    /// the given number of elements runs its sequential implementation on
+    /// the calling thread. It does not launch any tasks, allocate shared
+    /// state or set up the executor parameters, a task policy returns a
+    /// ready future. Exceptions are reported as for the parallel execution.
+    ///
+    /// The number of elements is the size of the whole input if its
+    /// ranges are given by random access iterators and sized sentinels, all
+    /// other algorithms run in parallel. Both input ranges count for merge,
+    /// includes and the set operations, the outer iterators count for
+    /// rotate, nth_element, partial_sort and inplace_merge. Algorithms over
+    /// ranges of ranges, e.g. the batched and multiway algorithms, never run
+    /// inline.
+    ///
+    struct inline_threshold
+    {
+        /// Construct an \a inline_threshold executor parameters object
+        ///
+        /// \param count [in] The largest number of elements run inline.
+        ///
+        constexpr explicit inline_threshold(std::size_t count) noexcept
+          : count_(count)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_count() const noexcept
+        {
+            return count_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t count_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::inline_threshold>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
+#include <pika/algorithms/traits/is_counting_iterator.hpp>
 #include <pika/assert.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/detail/invoke.hpp>
@@ -15,6 +17,7 @@
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/type_support/unused.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -660,6 +663,54 @@ namespace pika::parallel::detail {
 
             return it + num;
         }
+
+        ///////////////////////////////////////////////////////////////////
+        // handle index spaces, the values are computed from the first one
+        // instead of advancing and dereferencing a counting_iterator
+        template <typename Iter, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static constexpr Iter call_integral(
+            Iter it, std::size_t num, F&& f)
+        {
+            using value_type = std::decay_t<decltype(*it)>;
+            value_type const first = *it;
+            for (std::size_t i = 0; i != num; ++i)
+            {
+                PIKA_INVOKE(f,
+                    static_cast<value_type>(
+                        first + static_cast<value_type>(i)));
+            }
+            return it + num;
+        }
+
+        template <typename Iter, typename CancelToken, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static constexpr Iter call_integral(
+            Iter it, std::size_t num, CancelToken& tok, F&& f)
+        {
+            using value_type = std::decay_t<decltype(*it)>;
+            value_type const first = *it;
+            std::size_t const count(num & std::size_t(-4));            // -V112
+            std::size_t i = 0;
+            for (/**/; i != count; i += 4)                             // -V112
+            {
+                if (tok.was_cancelled())
+                    return it + i;
+                for (std::size_t j = i; j != i + 4; ++j)
+                {
+                    PIKA_INVOKE(f,
+                        static_cast<value_type>(
+                            first + static_cast<value_type>(j)));
+                }
+            }
+            for (/**/; i != num; ++i)
+            {
+                if (tok.was_cancelled())
+                    break;
+                PIKA_INVOKE(f,
+                    static_cast<value_type>(
+                        first + static_cast<value_type>(i)));
+            }
+            return it + i;
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////
@@ -673,11 +724,29 @@ namespace pika::parallel::detail {
         tag_fallback_invoke(
             loop_n_ind_t<ExPolicy>, Iter it, std::size_t count, F&& f)
         {
-            using pred = std::integral_constant<bool,
-                pika::traits::is_random_access_iterator<Iter>::value ||
-                    std::is_integral<Iter>::value>;
+            if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+            {
+                // run over the blocks of segmented iterators one by one
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    [&](auto* segment, std::size_t size) {
+                        return loop_n_ind_t<ExPolicy>{}(segment, size, f);
+                    });
+            }
+            else if constexpr (pika::detail::is_integral_counting_iterator_v<
+                                   Iter>)
+            {
+                return loop_n_ind_impl::call_integral(
+                    it, count, PIKA_FORWARD(F, f));
+            }
+            else
+            {
+                using pred = std::integral_constant<bool,
+                    pika::traits::is_random_access_iterator<Iter>::value ||
+                        std::is_integral<Iter>::value>;
 
-            return loop_n_ind_impl::call(it, count, PIKA_FORWARD(F, f), pred());
+                return loop_n_ind_impl::call(
+                    it, count, PIKA_FORWARD(F, f), pred());
+            }
         }
 
         template <typename Iter, typename CancelToken, typename F>
@@ -685,12 +754,29 @@ namespace pika::parallel::detail {
         tag_fallback_invoke(loop_n_ind_t<ExPolicy>, Iter it, std::size_t count,
             CancelToken& tok, F&& f)
         {
-            using pred = std::integral_constant<bool,
-                pika::traits::is_random_access_iterator<Iter>::value ||
-                    std::is_integral<Iter>::value>;
+            if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+            {
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    [&](auto* segment, std::size_t size) {
+                        return loop_n_ind_t<ExPolicy>{}(
+                            segment, size, tok, f);
+                    });
+            }
+            else if constexpr (pika::detail::is_integral_counting_iterator_v<
+                                   Iter>)
+            {
+                return loop_n_ind_impl::call_integral(
+                    it, count, tok, PIKA_FORWARD(F, f));
+            }
+            else
+            {
+                using pred = std::integral_constant<bool,
+                    pika::traits::is_random_access_iterator<Iter>::value ||
+                        std::is_integral<Iter>::value>;
 
-            return loop_n_ind_impl::call(
-                it, count, tok, PIKA_FORWARD(F, f), pred());
+                return loop_n_ind_impl::call(
+                    it, count, tok, PIKA_FORWARD(F, f), pred());
+            }
         }
     };
 
@@ -955,13 +1041,34 @@ namespace pika::parallel::detail {
             PIKA_FORWARD(F, f), PIKA_FORWARD(Cleanup, cleanup));
     }
 
+    // If neither f nor advancing the iterators can throw, the token is never
+    // cancelled and there is nothing to clean up, the iterations are run
+    // without checking the token.
+    template <typename F, typename... Iters>
+    inline constexpr bool is_nothrow_loop_v =
+        std::is_nothrow_invocable_v<F&, Iters...> &&
+        (noexcept(++std::declval<Iters&>()) && ...);
+
     template <typename Iter, typename CancelToken, typename F, typename Cleanup>
     PIKA_FORCEINLINE constexpr Iter loop_with_cleanup_n_with_token(
         Iter it, std::size_t count, CancelToken& tok, F&& f, Cleanup&& cleanup)
     {
-        using cat = typename std::iterator_traits<Iter>::iterator_category;
-        return loop_with_cleanup_n_impl<cat>::call_with_token(
-            it, count, tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Cleanup, cleanup));
+        if constexpr (is_nothrow_loop_v<F, Iter>)
+        {
+            PIKA_UNUSED(tok);
+            PIKA_UNUSED(cleanup);
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                PIKA_INVOKE(f, it);
+            }
+            return it;
+        }
+        else
+        {
+            using cat = typename std::iterator_traits<Iter>::iterator_category;
+            return loop_with_cleanup_n_impl<cat>::call_with_token(it, count,
+                tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Cleanup, cleanup));
+        }
     }
 
     template <typename Iter, typename FwdIter, typename CancelToken, typename F,
@@ -970,9 +1077,22 @@ namespace pika::parallel::detail {
     loop_with_cleanup_n_with_token(Iter it, std::size_t count, FwdIter dest,
         CancelToken& tok, F&& f, Cleanup&& cleanup)
     {
-        using cat = typename std::iterator_traits<Iter>::iterator_category;
-        return loop_with_cleanup_n_impl<cat>::call_with_token(it, count, dest,
-            tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Cleanup, cleanup));
+        if constexpr (is_nothrow_loop_v<F, Iter, FwdIter>)
+        {
+            PIKA_UNUSED(tok);
+            PIKA_UNUSED(cleanup);
+            for (/**/; count != 0; (void) --count, ++it, ++dest)
+            {
+                PIKA_INVOKE(f, it, dest);
+            }
+            return dest;
+        }
+        else
+        {
+            using cat = typename std::iterator_traits<Iter>::iterator_category;
+            return loop_with_cleanup_n_impl<cat>::call_with_token(it, count,
+                dest, tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Cleanup, cleanup));
+        }
     }
 
     // Helper class to repeatedly call a function a given number of times
@@ -1118,9 +1238,23 @@ namespace pika::parallel::detail {
         tag_fallback_invoke(loop_idx_n_t<ExPolicy>, std::size_t base_idx,
             Iter it, std::size_t count, F&& f)
         {
-            using cat = typename std::iterator_traits<Iter>::iterator_category;
-            return loop_idx_n_impl<cat>::call(
-                base_idx, it, count, PIKA_FORWARD(F, f));
+            if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+            {
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    [&](auto* segment, std::size_t size) {
+                        auto* last = loop_idx_n_t<ExPolicy>{}(
+                            base_idx, segment, size, f);
+                        base_idx += size;
+                        return last;
+                    });
+            }
+            else
+            {
+                using cat =
+                    typename std::iterator_traits<Iter>::iterator_category;
+                return loop_idx_n_impl<cat>::call(
+                    base_idx, it, count, PIKA_FORWARD(F, f));
+            }
         }
 
         template <typename Iter, typename CancelToken, typename F>
@@ -1128,9 +1262,23 @@ namespace pika::parallel::detail {
         tag_fallback_invoke(loop_idx_n_t<ExPolicy>, std::size_t base_idx,
             Iter it, std::size_t count, CancelToken& tok, F&& f)
         {
-            using cat = typename std::iterator_traits<Iter>::iterator_category;
-            return loop_idx_n_impl<cat>::call(
-                base_idx, it, count, tok, PIKA_FORWARD(F, f));
+            if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+            {
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    [&](auto* segment, std::size_t size) {
+                        auto* last = loop_idx_n_t<ExPolicy>{}(
+                            base_idx, segment, size, tok, f);
+                        base_idx += size;
+                        return last;
+                    });
+            }
+            else
+            {
+                using cat =
+                    typename std::iterator_traits<Iter>::iterator_category;
+                return loop_idx_n_impl<cat>::call(
+                    base_idx, it, count, tok, PIKA_FORWARD(F, f));
+            }
         }
     };
 
@@ -1179,9 +1327,21 @@ namespace pika::parallel::detail {
     PIKA_FORCEINLINE T accumulate_n(
         Iter it, std::size_t count, T init, Pred&& f)
     {
-        using cat = typename std::iterator_traits<Iter>::iterator_category;
-        return accumulate_n_impl<cat>::call(
-            it, count, PIKA_MOVE(init), PIKA_FORWARD(Pred, f));
+        if constexpr (pika::traits::has_contiguous_segments_v<Iter>)
+        {
+            pika::detail::for_each_contiguous_segment(
+                it, count, [&](auto* segment, std::size_t size) {
+                    init = accumulate_n(segment, size, PIKA_MOVE(init), f);
+                    return segment + size;
+                });
+            return init;
+        }
+        else
+        {
+            using cat = typename std::iterator_traits<Iter>::iterator_category;
+            return accumulate_n_impl<cat>::call(
+                it, count, PIKA_MOVE(init), PIKA_FORWARD(Pred, f));
+        }
     }
 
     template <typename T, typename Iter, typename Reduce,
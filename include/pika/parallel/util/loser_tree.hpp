@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tournament tree of losers over k sorted runs [first[i], last[i]). The
+    // root holds the run with the smallest head element, every inner node
+    // the run that lost the match played there. Taking the smallest element
+    // replays the matches along the path from the winner's leaf to the root
+    // only, log2(k) comparisons instead of k - 1 for a linear scan.
+    //
+    // Equivalent elements are taken from the run with the lower index first,
+    // exhausted runs lose against every other run.
+    template <typename Iter, typename Comp, typename Proj>
+    class loser_tree
+    {
+    public:
+        loser_tree(std::vector<Iter> first, std::vector<Iter> last,
+            Comp& comp, Proj& proj)
+          : first_(PIKA_MOVE(first))
+          , last_(PIKA_MOVE(last))
+          , comp_(comp)
+          , proj_(proj)
+        {
+            PIKA_ASSERT(first_.size() == last_.size());
+
+            leaves_ = 1;
+            while (leaves_ < first_.size())
+            {
+                leaves_ *= 2;
+            }
+            tree_.resize(leaves_);
+            tree_[0] = init(1);
+        }
+
+        // the run holding the smallest element
+        std::size_t winner() const noexcept
+        {
+            return tree_[0];
+        }
+
+        bool empty() const noexcept
+        {
+            return exhausted(tree_[0]);
+        }
+
+        // the position of the smallest element
+        Iter const& front() const noexcept
+        {
+            PIKA_ASSERT(!empty());
+            return first_[tree_[0]];
+        }
+
+        // Advance the run holding the smallest element.
+        void skip()
+        {
+            std::size_t w = tree_[0];
+            PIKA_ASSERT(!exhausted(w));
+
+            ++first_[w];
+
+            for (std::size_t node = (w + leaves_) / 2; node != 0; node /= 2)
+            {
+                if (before(tree_[node], w))
+                {
+                    std::swap(tree_[node], w);
+                }
+            }
+            tree_[0] = w;
+        }
+
+        // Copy the smallest element to dest and advance its run.
+        template <typename OutIter>
+        OutIter pop(OutIter dest)
+        {
+            *dest = *front();
+            ++dest;
+            skip();
+            return dest;
+        }
+
+        // Copy the smallest count elements to dest.
+        template <typename OutIter>
+        OutIter merge_n(OutIter dest, std::size_t count)
+        {
+            for (/**/; count != 0; --count)
+            {
+                dest = pop(PIKA_MOVE(dest));
+            }
+            return dest;
+        }
+
+    private:
+        bool exhausted(std::size_t run) const noexcept
+        {
+            return run >= first_.size() || first_[run] == last_[run];
+        }
+
+        // run i supplies the next element before run j
+        bool before(std::size_t i, std::size_t j) const
+        {
+            if (exhausted(i))
+            {
+                return false;
+            }
+            if (exhausted(j))
+            {
+                return true;
+            }
+
+            auto&& lhs = PIKA_INVOKE(proj_, *first_[i]);
+            auto&& rhs = PIKA_INVOKE(proj_, *first_[j]);
+            if (PIKA_INVOKE(comp_, rhs, lhs))
+            {
+                return false;
+            }
+            return i < j || PIKA_INVOKE(comp_, lhs, rhs);
+        }
+
+        // play the matches of the subtree rooted at node, return its winner
+        std::size_t init(std::size_t node)
+        {
+            if (node >= leaves_)
+            {
+                return node - leaves_;
+            }
+
+            std::size_t const left = init(2 * node);
+            std::size_t const right = init(2 * node + 1);
+            if (before(right, left))
+            {
+                tree_[node] = left;
+                return right;
+            }
+            tree_[node] = right;
+            return left;
+        }
+
+        std::vector<Iter> first_;
+        std::vector<Iter> last_;
+        std::vector<std::size_t> tree_;
+        std::size_t leaves_;
+        Comp& comp_;
+        Proj& proj_;
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
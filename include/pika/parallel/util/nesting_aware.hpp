@@ -0,0 +1,176 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/nesting_aware.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/threading/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::util {
+    namespace detail {
+        // The number of chunks of parallel algorithms enclosing the pika
+        // thread running on this OS thread. A pika thread may be suspended
+        // while running a chunk and other pika threads may run on the same
+        // OS thread in the meantime, the depth is only valid for the pika
+        // thread which has set it. Other pika threads see a depth of 0.
+        struct nesting_depth_state
+        {
+            pika::thread::id owner;
+            std::size_t depth = 0;
+        };
+
+        inline nesting_depth_state& get_nesting_depth_state() noexcept
+        {
+            thread_local nesting_depth_state state;
+            return state;
+        }
+
+        // Sets the nesting depth of the calling pika thread for the lifetime
+        // of the scope. The default constructed scope keeps the depth, it
+        // restores it once the calling pika thread has waited for other
+        // tasks, which may have been run on the same OS thread.
+        class nesting_depth_scope
+        {
+        public:
+            nesting_depth_scope() noexcept
+              : saved_(get_nesting_depth_state())
+            {
+            }
+
+            explicit nesting_depth_scope(std::size_t depth) noexcept
+              : saved_(get_nesting_depth_state())
+            {
+                get_nesting_depth_state() =
+                    nesting_depth_state{pika::this_thread::get_id(), depth};
+            }
+
+            nesting_depth_scope(nesting_depth_scope const&) = delete;
+            nesting_depth_scope& operator=(
+                nesting_depth_scope const&) = delete;
+
+            ~nesting_depth_scope()
+            {
+                get_nesting_depth_state() = saved_;
+            }
+
+        private:
+            nesting_depth_state saved_;
+        };
+    }    // namespace detail
+
+    /// Returns the number of parallel algorithms whose chunks enclose the
+    /// calling pika thread, 0 if it is not run as part of a chunk of a
+    /// parallel algorithm.
+    inline std::size_t nesting_depth() noexcept
+    {
+        auto const& state = detail::get_nesting_depth_state();
+        if (state.depth == 0 || state.owner != pika::this_thread::get_id())
+        {
+            return 0;
+        }
+        return state.depth;
+    }
+}    // namespace pika::parallel::util
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type shrinking the partitioning of algorithms
+    /// invoked from within a chunk of another parallel algorithm, e.g. from
+    /// the body of a \a pika::for_loop. Every chunk of the inner algorithms
+    /// would otherwise be partitioned for all cores, creating a number of
+    /// tasks quadratic in the number of cores while the cores are already
+    /// busy running the chunks of the outer algorithm.
+    ///
+    /// Algorithms invoked outside of any parallel algorithm are partitioned
+    /// as with the default executor parameters of the policy. Nested
+    /// algorithms are partitioned for the given number of cores, or run
+    /// inline on the calling thread (see \a inline_threshold) if it is 1.
+    ///
+    /// \note The nesting is tracked by the partitioners of this library.
+    ///       Algorithms invoked from tasks launched by other means, e.g. by
+    ///       \a pika::async within a chunk, are not considered nested.
+    ///
+    struct nesting_aware
+    {
+        /// Construct a \a nesting_aware executor parameters object running
+        /// the nested algorithms inline.
+        constexpr nesting_aware() noexcept
+          : nested_cores_(1)
+        {
+        }
+
+        /// Construct a \a nesting_aware executor parameters object
+        ///
+        /// \param nested_cores [in] The number of cores the nested
+        ///                     algorithms are partitioned for, 0 and 1 run
+        ///                     them inline.
+        ///
+        constexpr explicit nesting_aware(std::size_t nested_cores) noexcept
+          : nested_cores_(nested_cores == 0 ? 1 : nested_cores)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // nested algorithms partitioned for a single core run inline
+        bool run_inline() const noexcept
+        {
+            return nested_cores_ == 1 && parallel::util::nesting_depth() != 0;
+        }
+
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&& exec) const
+        {
+            // the cores of the executor as seen without these parameters
+            std::size_t const available =
+                parallel::execution::processing_units_count(
+                    parallel_policy::executor_parameters_type(), exec);
+            if (parallel::util::nesting_depth() == 0)
+            {
+                return available;
+            }
+            return (std::min)(nested_cores_, available == 0 ? 1 : available);
+        }
+
+        // the chunks are determined as for the default executor parameters
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t, std::size_t) const noexcept
+        {
+            return 0;
+        }
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(
+            Executor&&, F&&, std::size_t, std::size_t) const noexcept
+        {
+            return 0;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t nested_cores_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::nesting_aware>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/no_allocation.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type guaranteeing that an algorithm does not
+    /// allocate any memory on the heap, e.g. for use in real-time sections
+    /// of a program. The algorithm runs its sequential implementation on the
+    /// calling thread, whatever the size of its input. It does not launch
+    /// any tasks, allocate shared state or set up the executor parameters.
+    /// Exceptions are reported as for the parallel execution, which
+    /// allocates the exception_list.
+    ///
+    /// Only the algorithms whose sequential implementation needs no
+    /// temporary storage can be invoked with these parameters: \a copy_if,
+    /// \a partition, \a partition_copy, \a reduce_by_key, \a remove_copy,
+    /// \a remove_copy_if, \a remove_if, \a set_difference,
+    /// \a set_intersection, \a set_symmetric_difference, \a set_union,
+    /// \a unique and \a unique_copy. Invoking any other algorithm, or using
+    /// an asynchronous (task) execution policy, is a compile time error.
+    ///
+    struct no_allocation
+    {
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::no_allocation>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The algorithms whose sequential implementation allocates no memory
+    // declare a static member allocation_free set to true.
+    template <typename Algorithm, typename Enable = void>
+    struct is_allocation_free_algorithm : std::false_type
+    {
+    };
+
+    template <typename Algorithm>
+    struct is_allocation_free_algorithm<Algorithm,
+        std::enable_if_t<Algorithm::allocation_free>> : std::true_type
+    {
+    };
+
+    template <typename Algorithm>
+    inline constexpr bool is_allocation_free_algorithm_v =
+        is_allocation_free_algorithm<Algorithm>::value;
+    /// \endcond
+}    // namespace pika::parallel::detail
@@ -0,0 +1,53 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/non_temporal_stores.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting non-temporal (streaming) stores
+    /// for the output of \a copy, \a copy_n, \a fill, \a fill_n,
+    /// \a transform, \a uninitialized_fill and \a uninitialized_fill_n.
+    /// Non-temporal stores write around the caches: the destination is not
+    /// read before it is overwritten and the written values do not evict
+    /// other data from the caches. This increases the bandwidth available
+    /// to algorithms writing sequences which are much larger than the last
+    /// level cache and which are not read again soon.
+    ///
+    /// The stores are used if the destination is a contiguous sequence of
+    /// trivially copyable values (arithmetic values for \a fill and
+    /// \a transform) and the target supports them (x86 with SSE2 or
+    /// later), the algorithms are not affected otherwise. The stores of
+    /// each chunk are completed by a store fence before the chunk is
+    /// reported as done, such that the results are visible to any thread
+    /// which waits for the algorithm.
+    ///
+    /// \note The input is still split into chunks by the default rules,
+    ///       these parameters can not be combined with other executor
+    ///       parameters. Sequences which fit into the caches are usually
+    ///       written faster by regular stores.
+    ///
+    struct non_temporal_stores
+    {
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::non_temporal_stores>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,91 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/nothrow_chunks.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type promising that the functions passed to the
+    /// algorithms do not throw. The partitioners then neither catch the
+    /// exceptions of the chunks nor check the futures of the chunks for
+    /// exceptions, which shortens the critical path of the chunks, notably
+    /// for small inputs. Exceptions thrown by the chunks despite of the
+    /// promise call std::terminate.
+    ///
+    /// The partitioners detect chunks which do not throw without this
+    /// option where the algorithm can tell, e.g. \a for_each invoked with a
+    /// noexcept function.
+    ///
+    /// \note Exceptions thrown while scheduling the chunks (e.g.
+    ///       std::bad_alloc) are still reported as usual.
+    ///
+    struct nothrow_chunks
+    {
+        /// Construct a \a nothrow_chunks executor parameters object
+        constexpr nothrow_chunks() noexcept = default;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::nothrow_chunks>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parameters>
+    inline constexpr bool has_nothrow_chunks_v = std::is_same_v<
+        std::decay_t<Parameters>, pika::execution::nothrow_chunks>;
+
+    // Whether the chunks of a partitioner invoking f with Args can't throw,
+    // such that the exceptions of the chunks don't need to be collected.
+    template <typename ExPolicy, typename F, typename... Args>
+    inline constexpr bool use_nothrow_chunks_v =
+        std::is_nothrow_invocable_v<std::decay_t<F>&, Args...> ||
+        has_nothrow_chunks_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type>;
+
+    // Terminates on exceptions of functions which were promised not to throw
+    // by the executor parameters
+    template <typename F>
+    struct nothrow_chunk_function
+    {
+        F f;
+
+        template <typename... Ts>
+        decltype(auto) operator()(Ts&&... ts) noexcept
+        {
+            return PIKA_INVOKE(f, PIKA_FORWARD(Ts, ts)...);
+        }
+    };
+
+    template <typename F, typename... Args>
+    decltype(auto) make_nothrow_chunk_function(F&& f)
+    {
+        if constexpr (std::is_nothrow_invocable_v<std::decay_t<F>&, Args...>)
+        {
+            return PIKA_FORWARD(F, f);
+        }
+        else
+        {
+            return nothrow_chunk_function<std::decay_t<F>>{PIKA_FORWARD(F, f)};
+        }
+    }
+}    // namespace pika::parallel::util::detail
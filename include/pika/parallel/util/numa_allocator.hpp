@@ -0,0 +1,180 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/numa_allocator.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/uninitialized_fill.hpp>
+#include <pika/parallel/algorithms/uninitialized_value_construct.hpp>
+#include <pika/parallel/util/numa_chunk_placement.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Allocator which leaves the memory it allocates untouched until the
+    /// elements are initialized by a parallel algorithm. Default inserted
+    /// elements are default initialized, i.e. elements of trivially default
+    /// constructible types are not written. The pages of the memory are
+    /// then mapped to the NUMA domain of the worker thread first writing to
+    /// them, see \a make_numa_vector.
+    ///
+    /// The allocator carries the \a numa_chunk_placement executor parameters
+    /// used for the initialization. Algorithms running with the same
+    /// parameters on the same number of elements and worker threads access
+    /// every element from the worker thread which has first touched it.
+    ///
+    template <typename T>
+    class numa_allocator
+    {
+    public:
+        using value_type = T;
+
+        /// Construct an allocator placing one chunk per worker thread
+        constexpr numa_allocator() noexcept = default;
+
+        /// Construct an allocator using the given chunk placement
+        explicit constexpr numa_allocator(
+            pika::execution::numa_chunk_placement placement) noexcept
+          : placement_(placement)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename U>
+        constexpr numa_allocator(numa_allocator<U> const& rhs) noexcept
+          : placement_(rhs.placement())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... ts)
+        {
+            if constexpr (sizeof...(Ts) == 0)
+            {
+                ::new (static_cast<void*>(p)) U;
+            }
+            else
+            {
+                ::new (static_cast<void*>(p)) U(PIKA_FORWARD(Ts, ts)...);
+            }
+        }
+        /// \endcond
+
+        /// Return the executor parameters describing the mapping of the
+        /// elements to worker threads, pass them to the algorithms operating
+        /// on the elements (e.g. par.with(alloc.placement())).
+        constexpr pika::execution::numa_chunk_placement
+        placement() const noexcept
+        {
+            return placement_;
+        }
+
+        /// \cond NOINTERNAL
+        // all instances can free each others memory
+        template <typename U>
+        friend constexpr bool operator==(
+            numa_allocator const&, numa_allocator<U> const&) noexcept
+        {
+            return true;
+        }
+
+        template <typename U>
+        friend constexpr bool operator!=(
+            numa_allocator const&, numa_allocator<U> const&) noexcept
+        {
+            return false;
+        }
+        /// \endcond
+
+    private:
+        pika::execution::numa_chunk_placement placement_;
+    };
+
+    /// A vector whose elements are placed by \a numa_allocator
+    template <typename T>
+    using numa_vector = std::vector<T, numa_allocator<T>>;
+
+    namespace detail {
+        // default inserted elements of these types are not written by
+        // numa_allocator, they can be initialized in place
+        template <typename T>
+        inline constexpr bool is_first_touch_value_v =
+            std::is_trivially_default_constructible_v<T> &&
+            std::is_trivially_destructible_v<T>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Create a vector of \a count value initialized elements. The elements
+    /// are initialized by \a pika::uninitialized_value_construct using
+    /// the parallel policy with the given chunk placement, which first
+    /// touches the memory of each chunk from the worker thread it is placed
+    /// on.
+    ///
+    /// \note Elements of types which are not trivially default
+    ///       constructible or not trivially destructible are default
+    ///       constructed by the calling thread first and are then assigned
+    ///       in parallel, their memory is placed in the NUMA domain of the
+    ///       calling thread.
+    ///
+    template <typename T>
+    numa_vector<T> make_numa_vector(std::size_t count,
+        pika::execution::numa_chunk_placement placement = {})
+    {
+        numa_vector<T> v(count, numa_allocator<T>(placement));
+
+        auto policy = pika::execution::par.with(placement);
+        if constexpr (detail::is_first_touch_value_v<T>)
+        {
+            pika::uninitialized_value_construct(policy, v.begin(), v.end());
+        }
+        else
+        {
+            pika::fill(policy, v.begin(), v.end(), T());
+        }
+        return v;
+    }
+
+    /// Create a vector of \a count copies of \a value. The elements are
+    /// initialized by \a pika::uninitialized_fill using the parallel policy
+    /// with the given chunk placement, see above.
+    template <typename T>
+    numa_vector<T> make_numa_vector(std::size_t count, T const& value,
+        pika::execution::numa_chunk_placement placement = {})
+    {
+        numa_vector<T> v(count, numa_allocator<T>(placement));
+
+        auto policy = pika::execution::par.with(placement);
+        if constexpr (detail::is_first_touch_value_v<T>)
+        {
+            pika::uninitialized_fill(policy, v.begin(), v.end(), value);
+        }
+        else
+        {
+            pika::fill(policy, v.begin(), v.end(), value);
+        }
+        return v;
+    }
+}    // namespace pika
@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/numa_chunk_placement.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into a fixed number of contiguous chunks
+    /// per worker thread and chunk k is always scheduled on the same worker
+    /// thread. For the same number of iterations and worker threads the
+    /// mapping of iterations to worker threads is identical for all
+    /// algorithms in a sequence of calls. This allows for memory which was
+    /// first touched by one algorithm (e.g. \a pika::uninitialized_fill or
+    /// \a pika::fill) to be accessed from the same NUMA domain by subsequent
+    /// algorithms.
+    ///
+    /// \note The placement of a chunk is a scheduling hint passed to the
+    ///       executor. Executors which do not support scheduling hints will
+    ///       still create the same chunks, but may run them anywhere. The
+    ///       runtime should be configured to not steal work across NUMA
+    ///       domains (e.g. --pika:numa-sensitive=2) for chunks to stay on
+    ///       their worker thread.
+    ///
+    struct numa_chunk_placement
+    {
+        /// Construct a \a numa_chunk_placement executor parameters object
+        ///
+        /// \note Default constructed \a numa_chunk_placement executor
+        ///       parameter types will create one chunk per worker thread.
+        ///
+        constexpr numa_chunk_placement() noexcept
+          : chunks_per_worker_(1)
+        {
+        }
+
+        /// Construct a \a numa_chunk_placement executor parameters object
+        ///
+        /// \param chunks_per_worker [in] The number of contiguous chunks
+        ///                     each worker thread is assigned.
+        ///
+        explicit constexpr numa_chunk_placement(
+            std::size_t chunks_per_worker) noexcept
+          : chunks_per_worker_(chunks_per_worker == 0 ? 1 : chunks_per_worker)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return cores * chunks_per_worker_;
+        }
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(Executor&&, F&&,
+            std::size_t cores, std::size_t count) const noexcept
+        {
+            std::size_t const num_chunks = cores * chunks_per_worker_;
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+            return chunk_size == 0 ? 1 : chunk_size;
+        }
+
+        // chunk k is placed on worker thread k / chunks_per_worker, which
+        // keeps neighboring chunks within the same NUMA domain
+        constexpr std::size_t get_chunk_worker(
+            std::size_t chunk, std::size_t cores) const noexcept
+        {
+            return (chunk / chunks_per_worker_) % cores;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunks_per_worker_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::numa_chunk_placement>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
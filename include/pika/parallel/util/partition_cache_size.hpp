@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/partition_cache_size.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type setting the size of the cache the blocks of
+    /// the parallel in-place \a partition fit into. This also applies to the
+    /// parallel partitioning steps of \a sort and \a nth_element. Each
+    /// thread works on a block from either end of the sequence at a time,
+    /// so the blocks hold half of the given number of bytes each. Sequences
+    /// which are small compared to the number of cores are split into
+    /// smaller blocks to keep all cores busy.
+    ///
+    struct partition_cache_size
+    {
+        /// Construct a \a partition_cache_size executor parameters object
+        ///
+        /// \param cache_size [in] The size of the cache in bytes. The
+        ///               default (zero) assumes a cache of 256 KiB, a
+        ///               typical size of the cache private to a core.
+        ///
+        constexpr explicit partition_cache_size(
+            std::size_t cache_size = 0) noexcept
+          : cache_size_(cache_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_cache_size() const noexcept
+        {
+            return cache_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t cache_size_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::partition_cache_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,299 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/partition_plan.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+
+#include <pika/parallel/util/detail/chunk_placement.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/inline_threshold.hpp>
+#include <pika/parallel/util/nesting_aware.hpp>
+#include <pika/parallel/util/no_allocation.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A chunk of iterations of a \a partition_plan.
+    struct planned_chunk
+    {
+        /// The index of the first iteration of the chunk
+        std::size_t first;
+        /// The number of iterations in the chunk
+        std::size_t count;
+        /// The worker thread the chunk is placed on, std::size_t(-1) if the
+        /// executor is free to run it anywhere
+        std::size_t worker;
+    };
+
+    /// The shape the partitioners give to an algorithm over a number of
+    /// iterations with a given execution policy, see \a plan_partition.
+    struct partition_plan
+    {
+        /// The number of cores the iterations are partitioned for
+        std::size_t cores = 1;
+        /// The maximal number of chunks allowed by the executor parameters
+        std::size_t max_chunks = 0;
+        /// The number of iterations per chunk, the last chunk may be smaller
+        std::size_t chunk_size = 0;
+        /// The number of iterations run on the calling thread while the
+        /// executor parameters determine the chunk size (e.g. by timing
+        /// them, see \a auto_chunk_size), before the chunks are scheduled
+        std::size_t probe_count = 0;
+        /// Whether all iterations run on the calling thread without being
+        /// partitioned, e.g. for sequenced policies or ranges below an
+        /// \a inline_threshold
+        bool runs_inline = false;
+        /// Whether the chunks are taken dynamically by the worker threads,
+        /// the chunks of the plan are the initial ranges of the workers
+        /// then, which are split into chunks of chunk_size iterations
+        bool work_stealing = false;
+        /// The chunks scheduled after the probe, in the order of the
+        /// iterations
+        std::vector<planned_chunk> chunks;
+    };
+
+    namespace detail {
+        template <typename ExPolicy>
+        bool plan_runs_inline(ExPolicy const& policy, std::size_t count)
+        {
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+            if constexpr (pika::is_sequenced_execution_policy_v<ExPolicy> ||
+                std::is_same_v<parameters_type,
+                    pika::execution::no_allocation>)
+            {
+                return true;
+            }
+            else if constexpr (std::is_same_v<parameters_type,
+                                   pika::execution::inline_threshold>)
+            {
+                return count <= policy.parameters().get_count();
+            }
+            else if constexpr (std::is_same_v<parameters_type,
+                                   pika::execution::nesting_aware>)
+            {
+                return policy.parameters().run_inline();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template <typename ExPolicy>
+        std::size_t plan_chunk_worker(
+            ExPolicy const& policy, std::size_t chunk, std::size_t cores)
+        {
+            if constexpr (parallel::detail::use_chunk_placement_v<ExPolicy>)
+            {
+                return policy.parameters().get_chunk_worker(chunk, cores);
+            }
+            else
+            {
+                return std::size_t(-1);
+            }
+        }
+
+        inline std::size_t plan_round_to_stride(
+            std::size_t size, std::size_t stride) noexcept
+        {
+            if (stride == 1)
+            {
+                return size;
+            }
+            return (std::max)(stride, ((size + stride - 1) / stride) * stride);
+        }
+
+        template <typename ExPolicy>
+        void plan_work_stealing(ExPolicy const& policy, std::size_t count,
+            std::size_t stride, partition_plan& plan)
+        {
+            // mirrors partition_work_stealing: the range is split into one
+            // contiguous range of blocks of 'stride' iterations per worker
+            std::size_t const num_blocks = (count + stride - 1) / stride;
+            std::size_t const num_workers =
+                (std::max)((std::min)(plan.cores, num_blocks), std::size_t(1));
+
+            plan.work_stealing = true;
+            plan.max_chunks = num_workers;
+            plan.chunk_size = stride *
+                policy.parameters().get_stealing_chunk_size(
+                    num_workers, num_blocks);
+
+            for (std::size_t i = 0; i != num_workers; ++i)
+            {
+                std::size_t const begin =
+                    (std::min)(i * num_blocks / num_workers * stride, count);
+                std::size_t const end = (std::min)(
+                    (i + 1) * num_blocks / num_workers * stride, count);
+                if (begin != end)
+                {
+                    plan.chunks.push_back(
+                        planned_chunk{begin, end - begin, std::size_t(-1)});
+                }
+            }
+        }
+
+        template <typename ExPolicy>
+        void plan_chunks(ExPolicy const& policy, std::size_t count,
+            std::size_t stride, partition_plan& plan)
+        {
+            // mirrors get_bulk_iteration_shape
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+            using has_variable_chunk_size =
+                typename execution::extract_has_variable_chunk_size<
+                    parameters_type>::type;
+
+            plan.max_chunks = execution::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), plan.cores, count);
+
+            std::size_t first = 0;
+            if constexpr (has_variable_chunk_size::value)
+            {
+                std::size_t max_chunks = plan.max_chunks;
+                if (max_chunks != 0)
+                {
+                    max_chunks = (std::min)(max_chunks, count);
+                }
+
+                std::size_t chunk = 0;
+                while (first != count)
+                {
+                    std::size_t chunk_size = execution::get_chunk_size(
+                        policy.parameters(), policy.executor(),
+                        [](std::size_t) { return 0; }, plan.cores,
+                        count - first);
+                    parallel::detail::adjust_chunk_size_and_max_chunks(
+                        plan.cores, count - first, max_chunks, chunk_size,
+                        true);
+                    chunk_size = plan_round_to_stride(chunk_size, stride);
+
+                    std::size_t const size =
+                        (std::min)(chunk_size, count - first);
+                    if (chunk == 0)
+                    {
+                        plan.chunk_size = size;
+                    }
+                    plan.chunks.push_back(planned_chunk{first, size,
+                        plan_chunk_worker(policy, chunk++, plan.cores)});
+                    first += size;
+                }
+            }
+            else
+            {
+                // the probe is recorded instead of being run
+                auto probe = [&](std::size_t test_chunk_size) -> std::size_t {
+                    if (test_chunk_size == 0)
+                    {
+                        return 0;
+                    }
+                    test_chunk_size = (std::min)(
+                        plan_round_to_stride(test_chunk_size, stride),
+                        count - first);
+                    plan.probe_count += test_chunk_size;
+                    first += test_chunk_size;
+                    return test_chunk_size;
+                };
+
+                std::size_t chunk_size =
+                    execution::get_chunk_size(policy.parameters(),
+                        policy.executor(), probe, plan.cores, count);
+
+                std::size_t const remaining = count - first;
+                std::size_t max_chunks = plan.max_chunks;
+                parallel::detail::adjust_chunk_size_and_max_chunks(
+                    plan.cores, remaining, max_chunks, chunk_size);
+                plan.max_chunks = max_chunks;
+                plan.chunk_size = plan_round_to_stride(chunk_size, stride);
+
+                for (std::size_t chunk = 0; first != count; ++chunk)
+                {
+                    std::size_t const size =
+                        (std::min)(plan.chunk_size, count - first);
+                    plan.chunks.push_back(planned_chunk{first, size,
+                        plan_chunk_worker(policy, chunk, plan.cores)});
+                    first += size;
+                }
+            }
+        }
+    }    // namespace detail
+
+    /// Returns the partitioning the algorithms use for \a count iterations
+    /// with the given execution policy, without running anything: whether
+    /// the iterations run inline, the number of cores and the chunk size
+    /// the executor parameters determine, and the chunks with the worker
+    /// threads they are placed on. The plan allows to tune the executor
+    /// parameters offline and to check the partitioning in tests.
+    ///
+    /// \param policy [in] The execution policy of the algorithm.
+    /// \param count [in] The number of iterations of the algorithm.
+    /// \param stride [in] The granularity of the chunks, e.g. the stride of
+    ///                     for_loop_strided, the chunk sizes are multiples
+    ///                     of it.
+    ///
+    /// \note The plan is the one of the default partitioner used by most
+    ///       algorithms (e.g. for_each, transform or reduce). Executor
+    ///       parameters which time the probe chunk determine the chunk size
+    ///       from a probe taking no time. Executor parameters capping
+    ///       the algorithms bound by memory bandwidth, see
+    ///       \a bandwidth_limit, are applied as for those algorithms.
+    ///
+    // clang-format off
+    template <typename ExPolicy,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy_v<ExPolicy>
+        )>
+    // clang-format on
+    partition_plan plan_partition(
+        ExPolicy const& policy, std::size_t count, std::size_t stride = 1)
+    {
+        partition_plan plan;
+        stride = (std::max)(stride, std::size_t(1));
+
+        if (count == 0)
+        {
+            return plan;
+        }
+
+        if (detail::plan_runs_inline(policy, count))
+        {
+            plan.runs_inline = true;
+            plan.chunk_size = count;
+            plan.max_chunks = 1;
+            plan.chunks.push_back(planned_chunk{0, count, std::size_t(-1)});
+            return plan;
+        }
+
+        plan.cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        if constexpr (parallel::detail::use_work_stealing_partitioner_v<
+                          ExPolicy, std::size_t*>)
+        {
+            detail::plan_work_stealing(policy, count, stride, plan);
+        }
+        else
+        {
+            detail::plan_chunks(policy, count, stride, plan);
+        }
+        return plan;
+    }
+}    // namespace pika::parallel::util
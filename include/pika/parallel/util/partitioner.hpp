@@ -12,6 +12,7 @@
 #include <pika/async/dataflow.hpp>
 #endif
 #include <pika/async_combinators/wait_all.hpp>
+#include <pika/functional/invoke.hpp>
 #include <pika/iterator_support/range.hpp>
 #include <pika/modules/errors.hpp>
 #include <pika/type_support/empty_function.hpp>
@@ -20,11 +21,19 @@
 #include <pika/execution/executors/execution.hpp>
 #include <pika/execution/executors/execution_parameters.hpp>
 #include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/detail/cancellable_partition.hpp>
+#include <pika/parallel/util/detail/chunk_placement.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/partition_values.hpp>
 #include <pika/parallel/util/detail/partitioner_iteration.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <pika/parallel/util/detail/select_partitioner.hpp>
+#include <pika/parallel/util/detail/synchronous_bulk_partition.hpp>
+#include <pika/parallel/util/detail/tree_reduce.hpp>
+#include <pika/parallel/util/detail/work_stealing_partition.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/parallel/util/nothrow_chunks.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -41,30 +50,44 @@ namespace pika::parallel::detail {
     std::vector<pika::future<Result>>
     partition(ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
     {
-        // estimate a chunk size based on number of cores used
-        using parameters_type =
-            typename std::decay_t<ExPolicy>::executor_parameters_type;
-        using has_variable_chunk_size =
-            typename execution::extract_has_variable_chunk_size<
-                parameters_type>::type;
-
-        std::vector<pika::future<Result>> inititems;
-        auto shape = get_bulk_iteration_shape(has_variable_chunk_size{},
-            PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, 1);
-
-        std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
-
-        if (inititems.empty())
-            return workitems;
-
-        // add the newly created workitems to the list
-        inititems.insert(inititems.end(),
-            std::make_move_iterator(workitems.begin()),
-            std::make_move_iterator(workitems.end()));
-        return inititems;
+        if constexpr (use_work_stealing_partitioner_v<ExPolicy, FwdIter>)
+        {
+            return partition_work_stealing<Result, false>(
+                PIKA_FORWARD(ExPolicy, policy), first, count, 1,
+                PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            // estimate a chunk size based on number of cores used
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+            using has_variable_chunk_size =
+                typename execution::extract_has_variable_chunk_size<
+                    parameters_type>::type;
+
+            auto traced_f = util::detail::make_traced_chunk_function(
+                "partition", PIKA_FORWARD(F, f));
+
+            std::vector<pika::future<Result>> inititems;
+            auto shape = get_bulk_iteration_shape(has_variable_chunk_size{},
+                PIKA_FORWARD(ExPolicy, policy), inititems, traced_f, first,
+                count, 1);
+
+            std::vector<pika::future<Result>> workitems =
+                bulk_async_execute_chunks<Result>(policy,
+                    partitioner_iteration<Result, decltype(traced_f)>{
+                        PIKA_MOVE(traced_f)},
+                    PIKA_MOVE(shape));
+
+            if (inititems.empty())
+                return workitems;
+
+            // add the newly created workitems to the list
+            inititems.insert(inititems.end(),
+                std::make_move_iterator(workitems.begin()),
+                std::make_move_iterator(workitems.end()));
+            return inititems;
+        }
     }
 
     template <typename Result, typename ExPolicy, typename FwdIter,
@@ -72,30 +95,45 @@ namespace pika::parallel::detail {
     std::vector<pika::future<Result>> partition_with_index(ExPolicy&& policy,
         FwdIter first, std::size_t count, Stride stride, F&& f)
     {
-        // estimate a chunk size based on number of cores used
-        using parameters_type =
-            typename std::decay_t<ExPolicy>::executor_parameters_type;
-        using has_variable_chunk_size =
-            typename execution::extract_has_variable_chunk_size<
-                parameters_type>::type;
-
-        std::vector<pika::future<Result>> inititems;
-        auto shape = get_bulk_iteration_shape_idx(has_variable_chunk_size{},
-            PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, stride);
-
-        std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
-
-        if (inititems.empty())
-            return workitems;
-
-        // add the newly created workitems to the list
-        inititems.insert(inititems.end(),
-            std::make_move_iterator(workitems.begin()),
-            std::make_move_iterator(workitems.end()));
-        return inititems;
+        if constexpr (use_work_stealing_partitioner_v<ExPolicy, FwdIter>)
+        {
+            return partition_work_stealing<Result, true>(
+                PIKA_FORWARD(ExPolicy, policy), first, count, stride,
+                PIKA_FORWARD(F, f));
+        }
+        else
+        {
+            // estimate a chunk size based on number of cores used
+            using parameters_type =
+                typename std::decay_t<ExPolicy>::executor_parameters_type;
+            using has_variable_chunk_size =
+                typename execution::extract_has_variable_chunk_size<
+                    parameters_type>::type;
+
+            auto traced_f = util::detail::make_traced_chunk_function(
+                "partition", PIKA_FORWARD(F, f));
+
+            std::vector<pika::future<Result>> inititems;
+            auto shape =
+                get_bulk_iteration_shape_idx(has_variable_chunk_size{},
+                    PIKA_FORWARD(ExPolicy, policy), inititems, traced_f, first,
+                    count, stride);
+
+            std::vector<pika::future<Result>> workitems =
+                bulk_async_execute_chunks<Result>(policy,
+                    partitioner_iteration<Result, decltype(traced_f)>{
+                        PIKA_MOVE(traced_f)},
+                    PIKA_MOVE(shape));
+
+            if (inititems.empty())
+                return workitems;
+
+            // add the newly created workitems to the list
+            inititems.insert(inititems.end(),
+                std::make_move_iterator(workitems.begin()),
+                std::make_move_iterator(workitems.end()));
+            return inititems;
+        }
     }
 
     template <typename Result, typename ExPolicy, typename FwdIter,
@@ -163,6 +201,67 @@ namespace pika::parallel::detail {
             scoped_parameters scoped_params(
                 policy.parameters(), policy.executor());
 
+            if constexpr (use_partition_values_v<ExPolicy_, FwdIter, Result,
+                              F2> &&
+                use_synchronous_bulk_partition_v<ExPolicy_, FwdIter>)
+            {
+                std::vector<Result> results;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    results = partition_synchronous_bulk<Result, false>(
+                        "partition", PIKA_FORWARD(ExPolicy_, policy), first,
+                        count, 1, PIKA_FORWARD(F1, f1), errors);
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(policy.executor(), PIKA_MOVE(results),
+                    PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
+            }
+            else if constexpr (use_partition_values_v<ExPolicy_, FwdIter,
+                                   Result, F2>)
+            {
+                std::vector<Result> results;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    results = partition_values<Result, false>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, 1,
+                        PIKA_FORWARD(F1, f1), scoped_params, errors);
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(policy.executor(), PIKA_MOVE(results),
+                    PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
+            }
+            else if constexpr (util::detail::use_nothrow_chunks_v<ExPolicy_,
+                                   F1, FwdIter, std::size_t>)
+            {
+                // the chunks don't throw, their exceptions are not collected
+                std::vector<pika::future<Result>> workitems;
+                try
+                {
+                    workitems = partition<Result>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count,
+                        util::detail::make_nothrow_chunk_function<F1, FwdIter,
+                            std::size_t>(PIKA_FORWARD(F1, f1)));
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return reduce_nothrow(
+                    PIKA_MOVE(workitems), PIKA_FORWARD(F2, f2));
+            }
+
             std::vector<pika::future<Result>> workitems;
             std::list<std::exception_ptr> errors;
             try
@@ -189,6 +288,67 @@ namespace pika::parallel::detail {
             scoped_parameters scoped_params(
                 policy.parameters(), policy.executor());
 
+            if constexpr (use_partition_values_v<ExPolicy_, FwdIter, Result,
+                              F2> &&
+                use_synchronous_bulk_partition_v<ExPolicy_, FwdIter>)
+            {
+                std::vector<Result> results;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    results = partition_synchronous_bulk<Result, true>(
+                        "partition", PIKA_FORWARD(ExPolicy_, policy), first,
+                        count, stride, PIKA_FORWARD(F1, f1), errors);
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(policy.executor(), PIKA_MOVE(results),
+                    PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
+            }
+            else if constexpr (use_partition_values_v<ExPolicy_, FwdIter,
+                                   Result, F2>)
+            {
+                std::vector<Result> results;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    results = partition_values<Result, true>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, stride,
+                        PIKA_FORWARD(F1, f1), scoped_params, errors);
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(policy.executor(), PIKA_MOVE(results),
+                    PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
+            }
+            else if constexpr (util::detail::use_nothrow_chunks_v<ExPolicy_,
+                                   F1, FwdIter, std::size_t, std::size_t>)
+            {
+                // the chunks don't throw, their exceptions are not collected
+                std::vector<pika::future<Result>> workitems;
+                try
+                {
+                    workitems = partition_with_index<Result>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, stride,
+                        util::detail::make_nothrow_chunk_function<F1, FwdIter,
+                            std::size_t, std::size_t>(PIKA_FORWARD(F1, f1)));
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return reduce_nothrow(
+                    PIKA_MOVE(workitems), PIKA_FORWARD(F2, f2));
+            }
+
             std::vector<pika::future<Result>> workitems;
             std::list<std::exception_ptr> errors;
             try
@@ -207,6 +367,83 @@ namespace pika::parallel::detail {
                 PIKA_MOVE(workitems), PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
         }
 
+        // Same as call, except that chunks for which is_cancelled(base_idx)
+        // returns true by the time they are about to be started are not run
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2, typename Cancelled>
+        static R call_cancellable(ExPolicy_&& policy, FwdIter first,
+            std::size_t count, F1&& f1, F2&& f2, Cancelled&& is_cancelled)
+        {
+            if constexpr (!use_cancellable_partitioner_v<ExPolicy_, FwdIter>)
+            {
+                PIKA_UNUSED(is_cancelled);
+                return call(PIKA_FORWARD(ExPolicy_, policy), first, count,
+                    PIKA_FORWARD(F1, f1), PIKA_FORWARD(F2, f2));
+            }
+            else
+            {
+                // inform parameter traits
+                scoped_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<pika::future<Result>> workitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    workitems = partition_cancellable<Result, false>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, 1,
+                        PIKA_FORWARD(F1, f1),
+                        PIKA_FORWARD(Cancelled, is_cancelled));
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(PIKA_MOVE(workitems), PIKA_MOVE(errors),
+                    PIKA_FORWARD(F2, f2));
+            }
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename Stride,
+            typename F1, typename F2, typename Cancelled>
+        static R call_with_index_cancellable(ExPolicy_&& policy,
+            FwdIter first, std::size_t count, Stride stride, F1&& f1, F2&& f2,
+            Cancelled&& is_cancelled)
+        {
+            if constexpr (!use_cancellable_partitioner_v<ExPolicy_, FwdIter>)
+            {
+                PIKA_UNUSED(is_cancelled);
+                return call_with_index(PIKA_FORWARD(ExPolicy_, policy), first,
+                    count, stride, PIKA_FORWARD(F1, f1), PIKA_FORWARD(F2, f2));
+            }
+            else
+            {
+                // inform parameter traits
+                scoped_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                std::vector<pika::future<Result>> workitems;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    workitems = partition_cancellable<Result, true>(
+                        PIKA_FORWARD(ExPolicy_, policy), first, count, stride,
+                        PIKA_FORWARD(F1, f1),
+                        PIKA_FORWARD(Cancelled, is_cancelled));
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_exceptions::call(std::current_exception(), errors);
+                }
+                return reduce(PIKA_MOVE(workitems), PIKA_MOVE(errors),
+                    PIKA_FORWARD(F2, f2));
+            }
+        }
+
         template <typename ExPolicy_, typename FwdIter, typename F1,
             typename F2, typename Data>
         // requires is_container<Data>
@@ -237,6 +474,53 @@ namespace pika::parallel::detail {
         }
 
     private:
+        template <typename Executor, typename F>
+        static R reduce(Executor&& exec, std::vector<Result>&& results,
+            std::list<std::exception_ptr>&& errors, F&& f)
+        {
+            // all tasks have finished already, always rethrow if 'errors' is
+            // not empty
+            if (!errors.empty())
+            {
+                throw exception_list(PIKA_MOVE(errors));
+            }
+
+            try
+            {
+                // neighbouring bool results share the words of the
+                // bit-packed std::vector<bool>, they are combined by f
+                if constexpr (is_tree_chunk_values_reducer<
+                                  std::decay_t<F>>::value &&
+                    !std::is_same_v<Result, bool>)
+                {
+                    // combine the chunk results in parallel, f will see the
+                    // overall result only
+                    if (results.size() > 2)
+                    {
+                        tree_reduce(exec, results.size(),
+                            [&](std::size_t i, std::size_t j) {
+                                results[i] = PIKA_INVOKE(
+                                    f.op_, results[i], results[j]);
+                            });
+                        results.erase(results.begin() + 1, results.end());
+                    }
+                }
+                else
+                {
+                    PIKA_UNUSED(exec);
+                }
+
+                return f(PIKA_MOVE(results));
+            }
+            catch (...)
+            {
+                // rethrow either bad_alloc or exception_list
+                handle_exceptions::call(std::current_exception());
+                PIKA_ASSERT(false);
+                return f(PIKA_MOVE(results));
+            }
+        }
+
         template <typename F>
         static R reduce(std::vector<pika::future<Result>>&& workitems,
             std::list<std::exception_ptr>&& errors, F&& f)
@@ -272,6 +556,33 @@ namespace pika::parallel::detail {
             // exceptional future
             handle_exceptions::call(workitems, errors);
         }
+
+        template <typename F>
+        static R reduce_nothrow(
+            std::vector<pika::future<Result>>&& workitems, F&& f)
+        {
+            // wait for all tasks to finish, none of them holds an exception
+            pika::wait_all_nothrow(workitems);
+
+            try
+            {
+                return f(PIKA_MOVE(workitems));
+            }
+            catch (...)
+            {
+                // rethrow either bad_alloc or exception_list
+                handle_exceptions::call(std::current_exception());
+                PIKA_ASSERT(false);
+                return f(PIKA_MOVE(workitems));
+            }
+        }
+
+        static R reduce_nothrow(std::vector<pika::future<Result>>&& workitems,
+            ::pika::detail::empty_function)
+        {
+            // wait for all tasks to finish, none of them holds an exception
+            pika::wait_all_nothrow(workitems);
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////
@@ -351,6 +662,27 @@ namespace pika::parallel::detail {
                 PIKA_MOVE(errors), PIKA_FORWARD(F2, f2));
         }
 
+        // all chunks have to be scheduled up front for asynchronous
+        // execution, cancelled chunks still return early
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2, typename Cancelled>
+        static pika::future<R> call_cancellable(ExPolicy_&& policy,
+            FwdIter first, std::size_t count, F1&& f1, F2&& f2, Cancelled&&)
+        {
+            return call(PIKA_FORWARD(ExPolicy_, policy), first, count,
+                PIKA_FORWARD(F1, f1), PIKA_FORWARD(F2, f2));
+        }
+
+        template <typename ExPolicy_, typename FwdIter, typename Stride,
+            typename F1, typename F2, typename Cancelled>
+        static pika::future<R> call_with_index_cancellable(ExPolicy_&& policy,
+            FwdIter first, std::size_t count, Stride stride, F1&& f1, F2&& f2,
+            Cancelled&&)
+        {
+            return call_with_index(PIKA_FORWARD(ExPolicy_, policy), first,
+                count, stride, PIKA_FORWARD(F1, f1), PIKA_FORWARD(F2, f2));
+        }
+
         template <typename ExPolicy_, typename FwdIter, typename F1,
             typename F2, typename Data>
         // requires is_container<Data>
@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/iterator_facade.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::util {
+    ///////////////////////////////////////////////////////////////////////////
+    // Iterates over a sequence of indices and refers to the elements at those
+    // indices, that is *it is elements[*indices]. The iterator is random
+    // access if IndexIter is. The datapar policies gather (and scatter) whole
+    // vector packs through it if its elements are arithmetic.
+    template <typename ElementIter, typename IndexIter>
+    class permutation_iterator
+      : public pika::util::iterator_facade<
+            permutation_iterator<ElementIter, IndexIter>,
+            typename std::iterator_traits<ElementIter>::value_type,
+            typename std::iterator_traits<IndexIter>::iterator_category,
+            typename std::iterator_traits<ElementIter>::reference,
+            typename std::iterator_traits<IndexIter>::difference_type>
+    {
+        static_assert(pika::traits::is_random_access_iterator_v<ElementIter>,
+            "the elements of a permutation_iterator must be accessible in "
+            "random order");
+
+        using base_type = pika::util::iterator_facade<
+            permutation_iterator<ElementIter, IndexIter>,
+            typename std::iterator_traits<ElementIter>::value_type,
+            typename std::iterator_traits<IndexIter>::iterator_category,
+            typename std::iterator_traits<ElementIter>::reference,
+            typename std::iterator_traits<IndexIter>::difference_type>;
+
+    public:
+        using element_iterator = ElementIter;
+        using index_iterator = IndexIter;
+
+        permutation_iterator() = default;
+
+        PIKA_HOST_DEVICE permutation_iterator(
+            ElementIter elements, IndexIter indices)
+          : elements_(elements)
+          , indices_(indices)
+        {
+        }
+
+        PIKA_HOST_DEVICE ElementIter elements() const
+        {
+            return elements_;
+        }
+
+        PIKA_HOST_DEVICE IndexIter indices() const
+        {
+            return indices_;
+        }
+
+    protected:
+        friend class pika::util::iterator_core_access;
+
+        PIKA_HOST_DEVICE bool equal(permutation_iterator const& other) const
+        {
+            return indices_ == other.indices_;
+        }
+
+        PIKA_HOST_DEVICE typename base_type::reference dereference() const
+        {
+            return elements_[*indices_];
+        }
+
+        PIKA_HOST_DEVICE void increment()
+        {
+            ++indices_;
+        }
+
+        template <typename Iter = IndexIter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_bidirectional_iterator_v<Iter>>>
+        PIKA_HOST_DEVICE void decrement()
+        {
+            --indices_;
+        }
+
+        template <typename Iter = IndexIter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_random_access_iterator_v<Iter>>>
+        PIKA_HOST_DEVICE void advance(typename base_type::difference_type n)
+        {
+            std::advance(indices_, n);
+        }
+
+        template <typename Iter = IndexIter,
+            typename Enable = std::enable_if_t<
+                pika::traits::is_random_access_iterator_v<Iter>>>
+        PIKA_HOST_DEVICE typename base_type::difference_type
+        distance_to(permutation_iterator const& other) const
+        {
+            return other.indices_ - indices_;
+        }
+
+    private:
+        ElementIter elements_;
+        IndexIter indices_;
+    };
+
+    template <typename ElementIter, typename IndexIter>
+    PIKA_HOST_DEVICE permutation_iterator<ElementIter, IndexIter>
+    make_permutation_iterator(ElementIter elements, IndexIter indices)
+    {
+        return permutation_iterator<ElementIter, IndexIter>(elements, indices);
+    }
+}    // namespace pika::util
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/philox.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counter-based random number engine Philox4x32-10 (Salmon et al.,
+    /// "Parallel random numbers: as easy as 1, 2, 3", SC'11). The n-th block
+    /// of four 32-bit outputs is a bijection of the 128-bit counter
+    /// (n, stream) keyed by the 64-bit seed, so that the engine has no
+    /// state besides its position: \a discard skips any number of outputs
+    /// in constant time, and engines constructed with different streams
+    /// produce independent sequences of 2^66 outputs each.
+    ///
+    /// The engine meets the requirements of a UniformRandomBitGenerator and
+    /// can be used with the distributions of the standard library. Its
+    /// output is the same on all platforms.
+    ///
+    class philox4x32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr std::uint64_t default_seed = 20111115u;
+
+        /// Construct an engine at the beginning of the given stream
+        ///
+        /// \param seed [in] The key of the engine.
+        /// \param stream [in] The number of the sequence of the engine.
+        ///
+        explicit philox4x32(std::uint64_t seed = default_seed,
+            std::uint64_t stream = 0) noexcept
+        {
+            this->seed(seed, stream);
+        }
+
+        /// Reset the engine to the beginning of the given stream
+        void seed(std::uint64_t seed = default_seed,
+            std::uint64_t stream = 0) noexcept
+        {
+            key_ = {std::uint32_t(seed), std::uint32_t(seed >> 32)};
+            stream_ = stream;
+            block_ = 0;
+            word_ = 0;
+            refill();
+        }
+
+        static constexpr result_type min() noexcept
+        {
+            return 0;
+        }
+
+        static constexpr result_type max() noexcept
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        result_type operator()() noexcept
+        {
+            result_type const result = output_[word_];
+            if (++word_ == 4)
+            {
+                word_ = 0;
+                ++block_;
+                refill();
+            }
+            return result;
+        }
+
+        /// Advance the engine by \a z outputs in constant time
+        void discard(unsigned long long z) noexcept
+        {
+            block_ += std::uint64_t(z / 4);
+            word_ += unsigned(z % 4);
+            if (word_ >= 4)
+            {
+                word_ -= 4;
+                ++block_;
+            }
+            refill();
+        }
+
+        friend bool operator==(
+            philox4x32 const& lhs, philox4x32 const& rhs) noexcept
+        {
+            return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_ &&
+                lhs.block_ == rhs.block_ && lhs.word_ == rhs.word_;
+        }
+
+        friend bool operator!=(
+            philox4x32 const& lhs, philox4x32 const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        static constexpr std::uint32_t multiplier0 = 0xD2511F53u;
+        static constexpr std::uint32_t multiplier1 = 0xCD9E8D57u;
+        static constexpr std::uint32_t weyl0 = 0x9E3779B9u;
+        static constexpr std::uint32_t weyl1 = 0xBB67AE85u;
+
+        // computes the block of outputs for the current counter
+        void refill() noexcept
+        {
+            std::array<std::uint32_t, 4> ctr = {std::uint32_t(block_),
+                std::uint32_t(block_ >> 32), std::uint32_t(stream_),
+                std::uint32_t(stream_ >> 32)};
+            std::array<std::uint32_t, 2> key = key_;
+            for (int round = 0; round != 10; ++round)
+            {
+                if (round != 0)
+                {
+                    key[0] += weyl0;
+                    key[1] += weyl1;
+                }
+                std::uint64_t const p0 = std::uint64_t(multiplier0) * ctr[0];
+                std::uint64_t const p1 = std::uint64_t(multiplier1) * ctr[2];
+                ctr = {std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0],
+                    std::uint32_t(p1),
+                    std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1],
+                    std::uint32_t(p0)};
+            }
+            output_ = ctr;
+        }
+
+        std::array<std::uint32_t, 2> key_;
+        std::uint64_t stream_;
+        std::uint64_t block_;      // the counter of the current block
+        unsigned word_;            // the next output of the current block
+        std::array<std::uint32_t, 4> output_;
+        /// \endcond
+    };
+}    // namespace pika
@@ -11,24 +11,32 @@
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/iterator_support/traits/is_range.hpp>
 #include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/software_prefetching.hpp>
 #include <pika/type_support/pack.hpp>
+#include <pika/type_support/unused.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
-#if defined(PIKA_HAVE_MM_PREFETCH)
+// x86 prefetches are issued by _mm_prefetch, GCC compatible compilers provide
+// __builtin_prefetch for the other architectures (ARM, POWER, ...)
+#if defined(PIKA_ALGORITHMS_HAVE_MM_PREFETCH) || defined(PIKA_HAVE_MM_PREFETCH)
+#define PIKA_ALGORITHMS_PREFETCH_MM
 #if defined(PIKA_MSVC)
 #include <intrin.h>
 #endif
-#if defined(PIKA_GCC_VERSION)
+#if defined(__GNUC__)
 #include <emmintrin.h>
 #endif
+#elif defined(__GNUC__)
+#define PIKA_ALGORITHMS_PREFETCH_BUILTIN
 #endif
 
 namespace pika::parallel::detail {
@@ -53,18 +61,24 @@ namespace pika::parallel::detail {
             std::size_t chunk_size_;
             std::size_t range_size_;
             std::size_t idx_;
+            std::size_t prefetch_offset_;
+            pika::execution::prefetch_locality locality_;
 
         public:
             // different versions of clang-format do different things
             // clang-format off
             explicit prefetching_iterator(std::size_t idx, base_iterator base,
                 std::size_t chunk_size, std::size_t range_size,
-                ranges_type const& rngs)
+                ranges_type const& rngs, std::size_t prefetch_offset = 0,
+                pika::execution::prefetch_locality locality =
+                    pika::execution::prefetch_locality::high)
               : rngs_(rngs)
               , base_(base)
               , chunk_size_(chunk_size)
               , range_size_(range_size)
               , idx_((std::min) (idx, range_size))
+              , prefetch_offset_(prefetch_offset)
+              , locality_(locality)
             {
             }
             // clang-format on
@@ -90,6 +104,16 @@ namespace pika::parallel::detail {
             {
                 return idx_;
             }
+            // the number of elements between the end of a chunk and the
+            // elements prefetched after it
+            std::size_t prefetch_offset() const
+            {
+                return prefetch_offset_;
+            }
+            pika::execution::prefetch_locality locality() const
+            {
+                return locality_;
+            }
 
             inline prefetching_iterator& operator+=(difference_type rhs)
             {
@@ -214,66 +238,164 @@ namespace pika::parallel::detail {
             ranges_type rngs_;
             std::size_t chunk_size_;
             std::size_t range_size_;
+            std::size_t prefetch_offset_ = 0;
+            pika::execution::prefetch_locality locality_ =
+                pika::execution::prefetch_locality::high;
 
             static constexpr std::size_t sizeof_first_value_type =
                 sizeof(typename std::tuple_element<0, ranges_type>::type::type);
 
+            // the number of elements of the first range in p_factor cache
+            // lines, at least one
+            static std::size_t elements_per_cache_lines(std::size_t p_factor)
+            {
+                return (std::max) (std::size_t(1),
+                    (p_factor *
+                        pika::concurrency::detail::get_cache_line_size()) /
+                        sizeof_first_value_type);
+            }
+
         public:
             prefetcher_context(Itr begin, Itr end, ranges_type const& rngs,
                 std::size_t p_factor = 1)
               : it_begin_(begin)
               , it_end_(end)
               , rngs_(rngs)
-              , chunk_size_(
-                    (p_factor *
-                        pika::concurrency::detail::get_cache_line_size()) /
-                    sizeof_first_value_type)
+              , chunk_size_(elements_per_cache_lines(p_factor))
+              , range_size_(std::distance(begin, end))
+            {
+            }
+
+            // the chunks span one cache line, the elements distance cache
+            // lines ahead are prefetched
+            prefetcher_context(Itr begin, Itr end, ranges_type const& rngs,
+                pika::execution::software_prefetching const& params)
+              : it_begin_(begin)
+              , it_end_(end)
+              , rngs_(rngs)
+              , chunk_size_(elements_per_cache_lines(1))
               , range_size_(std::distance(begin, end))
+              , prefetch_offset_(params.distance() == 0 ?
+                        0 :
+                        (params.distance() - 1) * chunk_size_)
+              , locality_(params.locality())
             {
             }
 
             prefetching_iterator<Itr, Ts...> begin()
             {
-                return prefetching_iterator<Itr, Ts...>(
-                    0ull, it_begin_, chunk_size_, range_size_, rngs_);
+                return prefetching_iterator<Itr, Ts...>(0ull, it_begin_,
+                    chunk_size_, range_size_, rngs_, prefetch_offset_,
+                    locality_);
             }
 
             prefetching_iterator<Itr, Ts...> end()
             {
-                return prefetching_iterator<Itr, Ts...>(
-                    range_size_, it_end_, chunk_size_, range_size_, rngs_);
+                return prefetching_iterator<Itr, Ts...>(range_size_, it_end_,
+                    chunk_size_, range_size_, rngs_, prefetch_offset_,
+                    locality_);
             }
         };
 
         ///////////////////////////////////////////////////////////////////////
-#if defined(PIKA_HAVE_MM_PREFETCH)
-        template <typename... T>
-        PIKA_FORCEINLINE void prefetch_addresses(T const&... ts)
+        // Prefetch the cache line holding the byte at p into the cache levels
+        // selected by locality, the hints have to be compile time constants
+        PIKA_FORCEINLINE void prefetch_pointer(void const* p,
+            pika::execution::prefetch_locality locality =
+                pika::execution::prefetch_locality::high)
         {
-            int const sequencer[] = {
-                (_mm_prefetch(
-                     const_cast<char*>((char const*) &ts), _MM_HINT_T0),
-                    0)...,
-                0};
-            (void) sequencer;
+#if defined(PIKA_ALGORITHMS_PREFETCH_MM)
+            char* c = const_cast<char*>(static_cast<char const*>(p));
+            switch (locality)
+            {
+            case pika::execution::prefetch_locality::none:
+                _mm_prefetch(c, _MM_HINT_NTA);
+                break;
+            case pika::execution::prefetch_locality::low:
+                _mm_prefetch(c, _MM_HINT_T2);
+                break;
+            case pika::execution::prefetch_locality::moderate:
+                _mm_prefetch(c, _MM_HINT_T1);
+                break;
+            default:
+                _mm_prefetch(c, _MM_HINT_T0);
+                break;
+            }
+#elif defined(PIKA_ALGORITHMS_PREFETCH_BUILTIN)
+            switch (locality)
+            {
+            case pika::execution::prefetch_locality::none:
+                __builtin_prefetch(p, 0, 0);
+                break;
+            case pika::execution::prefetch_locality::low:
+                __builtin_prefetch(p, 0, 1);
+                break;
+            case pika::execution::prefetch_locality::moderate:
+                __builtin_prefetch(p, 0, 2);
+                break;
+            default:
+                __builtin_prefetch(p, 0, 3);
+                break;
+            }
+#else
+            PIKA_UNUSED(p);
+            PIKA_UNUSED(locality);
+#endif
         }
 
+#if defined(PIKA_ALGORITHMS_PREFETCH_MM) ||                                    \
+    defined(PIKA_ALGORITHMS_PREFETCH_BUILTIN)
         template <typename... Ts, std::size_t... Is>
         PIKA_FORCEINLINE void prefetch_containers(std::tuple<Ts...> const& t,
-            pika::util::detail::index_pack<Is...>, std::size_t idx)
+            pika::util::detail::index_pack<Is...>, std::size_t idx,
+            pika::execution::prefetch_locality locality =
+                pika::execution::prefetch_locality::high)
         {
-            prefetch_addresses((std::get<Is>(t).get())[idx]...);
+            (prefetch_pointer(
+                 std::addressof((std::get<Is>(t).get())[idx]), locality),
+                ...);
         }
 #else
+        // touch the elements instead
         template <typename... Ts, std::size_t... Is>
         PIKA_FORCEINLINE void prefetch_containers(std::tuple<Ts...> const& t,
-            pika::util::detail::index_pack<Is...>, std::size_t idx)
+            pika::util::detail::index_pack<Is...>, std::size_t idx,
+            pika::execution::prefetch_locality =
+                pika::execution::prefetch_locality::high)
         {
             int const sequencer[] = {(std::get<Is>(t).get()[idx], 0)..., 0};
             (void) sequencer;
         }
 #endif
 
+        // Hints that the given object will be accessed soon, this does nothing
+        // if no prefetch instruction is available.
+        template <typename T>
+        PIKA_FORCEINLINE void prefetch_address(T const& t,
+            pika::execution::prefetch_locality locality =
+                pika::execution::prefetch_locality::high)
+        {
+            prefetch_pointer(std::addressof(t), locality);
+        }
+
+        // Prefetch the elements of all ranges following the chunk of the
+        // given iterator which ends at index j
+        template <typename Itr, typename... Ts>
+        PIKA_FORCEINLINE void prefetch_ahead(
+            prefetching_iterator<Itr, Ts...> const& it, std::size_t j)
+        {
+            using index_pack_type =
+                typename pika::util::detail::make_index_pack<sizeof...(
+                    Ts)>::type;
+
+            std::size_t const idx = j + it.prefetch_offset();
+            if (idx < it.range_size())
+            {
+                prefetch_containers(
+                    it.ranges(), index_pack_type(), idx, it.locality());
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct loop_n_helper
         {
@@ -282,10 +404,6 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
                 Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
                 for (/**/; count != 0; (void) --count, ++it)
                 {
                     Itr base = it.base();
@@ -302,10 +420,7 @@ namespace pika::parallel::detail {
                         f(base);
                     }
 
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
+                    prefetch_ahead(it, j);
                 }
                 return it;
             }
@@ -316,10 +431,6 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count,
                 CancelToken& tok, F&& f, Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
                 for (/**/; count != 0; (void) --count, ++it)
                 {
                     if (tok.was_cancelled())
@@ -339,10 +450,7 @@ namespace pika::parallel::detail {
                         f(base);
                     }
 
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
+                    prefetch_ahead(it, j);
                 }
                 return it;
             }
@@ -367,10 +475,6 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
                 Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
                 for (/**/; count != 0; (void) --count, ++it)
                 {
                     Itr base = it.base();
@@ -387,10 +491,7 @@ namespace pika::parallel::detail {
                         f(*base);
                     }
 
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
+                    prefetch_ahead(it, j);
                 }
                 return it;
             }
@@ -401,10 +502,6 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count,
                 CancelToken& tok, F&& f, Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
                 for (/**/; count != 0; (void) --count, ++it)
                 {
                     if (tok.was_cancelled())
@@ -424,10 +521,7 @@ namespace pika::parallel::detail {
                         f(*base);
                     }
 
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
+                    prefetch_ahead(it, j);
                 }
                 return it;
             }
@@ -464,14 +558,58 @@ namespace pika::parallel::detail {
             base_begin, base_end, PIKA_MOVE(ranges), p_factor);
     }
 
+    // function to create a prefetcher_context which prefetches the elements
+    // of all ranges params.distance() cache lines ahead
+    template <typename Itr, typename... Ts>
+    prefetching::prefetcher_context<Itr, Ts const...> make_prefetcher_context(
+        Itr base_begin, Itr base_end,
+        pika::execution::software_prefetching const& params,
+        Ts const&... rngs)
+    {
+        static_assert(pika::traits::is_random_access_iterator<Itr>::value,
+            "Iterators have to be of random access iterator category");
+        static_assert(
+            pika::util::detail::all_of_v<pika::traits::is_range<Ts>...>,
+            "All variadic parameters have to represent ranges");
+
+        using ranges_type = std::tuple<std::reference_wrapper<Ts const>...>;
+
+        auto&& ranges = ranges_type(std::cref(rngs)...);
+        return prefetching::prefetcher_context<Itr, Ts const...>(
+            base_begin, base_end, PIKA_MOVE(ranges), params);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the software prefetching parameters of the given policy, the
+    // distance defaults to default_distance
+    template <typename ExPolicy>
+    pika::execution::software_prefetching get_software_prefetching(
+        ExPolicy const& policy, std::size_t default_distance)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+        if constexpr (std::is_same_v<parameters_type,
+                          pika::execution::software_prefetching>)
+        {
+            pika::execution::software_prefetching const& params =
+                policy.parameters();
+            return pika::execution::software_prefetching(
+                params.distance() == 0 ? default_distance : params.distance(),
+                params.locality());
+        }
+        else
+        {
+            PIKA_UNUSED(policy);
+            return pika::execution::software_prefetching(default_distance);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Itr, typename... Ts>
     struct loop_impl<prefetching::prefetching_iterator<Itr, Ts...>>
     {
         using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
         using type = typename iterator_type::base_iterator;
-        using index_pack_type =
-            typename pika::util::detail::make_index_pack<sizeof...(Ts)>::type;
 
         template <typename End, typename F>
         static iterator_type call(iterator_type it, End end, F&& f)
@@ -490,8 +628,7 @@ namespace pika::parallel::detail {
                 for (/**/; j != last; (void) ++j, ++base)
                     f(base);
 
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
+                prefetching::prefetch_ahead(it, j);
             }
             return it;
         }
@@ -517,8 +654,7 @@ namespace pika::parallel::detail {
                 for (/**/; j != last; (void) ++j, ++base)
                     f(base);
 
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
+                prefetching::prefetch_ahead(it, j);
             }
             return it;
         }
@@ -530,8 +666,6 @@ namespace pika::parallel::detail {
     {
         using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
         using type = typename iterator_type::base_iterator;
-        using index_pack_type =
-            typename pika::util::detail::make_index_pack<sizeof...(Ts)>::type;
 
         template <typename End, typename F>
         static iterator_type call(iterator_type it, End end, F&& f)
@@ -550,8 +684,7 @@ namespace pika::parallel::detail {
                 for (/**/; j != last; (void) ++j, ++base)
                     f(*base);
 
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
+                prefetching::prefetch_ahead(it, j);
             }
             return it;
         }
@@ -577,8 +710,7 @@ namespace pika::parallel::detail {
                 for (/**/; j != last; (void) ++j, ++base)
                     f(*base);
 
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
+                prefetching::prefetch_ahead(it, j);
             }
             return it;
         }
@@ -0,0 +1,78 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/radix_sort_selection.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects whether \a sort and \a sort_by_key use the radix sort engine.
+    enum class radix_sort_mode
+    {
+        /// Use the radix sort engine for sufficiently large sequences
+        automatic,
+        /// Use the radix sort engine regardless of the size of the sequence
+        always,
+        /// Always use the comparison based sort
+        never
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parallel \a sort and \a sort_by_key dispatch to a radix sort engine if
+    /// the (projected) keys are of an integral or floating point type and the
+    /// comparator is std::less or std::greater. This executor parameters
+    /// type allows for forcing or disabling that dispatch. Keys which cannot
+    /// be radix sorted are always sorted using the comparison based sort.
+    ///
+    /// The radix sort engine orders floating point keys by their bit
+    /// patterns: in ascending order -0.0 is placed before +0.0, NaNs with the
+    /// sign bit set are placed in front of all other keys and the remaining
+    /// NaNs behind them, descending order reverses this. The comparison
+    /// based sort leaves the order of -0.0 and +0.0 unspecified and does not
+    /// support NaNs. Use \a radix_sort_mode::never if the radix sort engine
+    /// must not be used for such keys.
+    ///
+    struct radix_sort_selection
+    {
+        /// Construct a \a radix_sort_selection executor parameters object
+        ///
+        /// \param mode [in] Whether the radix sort engine is used.
+        ///
+        constexpr explicit radix_sort_selection(
+            radix_sort_mode mode = radix_sort_mode::automatic) noexcept
+          : mode_(mode)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr radix_sort_mode get_radix_sort_mode() const noexcept
+        {
+            return mode_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        radix_sort_mode mode_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::radix_sort_selection>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,319 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The single pass scan with decoupled look-back follows D. Merrill and
+// M. Garland, "Single-pass Parallel Prefix Scan with Decoupled Look-back",
+// NVIDIA Technical Report NVR-2016-002, 2016.
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/execution_base/this_thread.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+#include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    /// \cond NOINTERNAL
+
+    // The results of a chunk are fixed up right after it was scanned, the
+    // values of a chunk should therefore fit into the cache of a core.
+    inline constexpr std::size_t scan_look_back_chunk_bytes = 65536;
+    inline constexpr std::size_t scan_look_back_min_chunk_size = 1024;
+
+    template <typename T>
+    constexpr std::size_t scan_look_back_chunk_size() noexcept
+    {
+        return (std::max)(scan_look_back_min_chunk_size,
+            scan_look_back_chunk_bytes / sizeof(T));
+    }
+
+    // The single pass scan chooses its own chunk sizes, it is used only if
+    // no executor parameters were given to the policy (explicitly requested
+    // chunk sizes are honored by the scan_partitioner). Chunks are located
+    // by their index, which requires random access iterators.
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename T>
+    inline constexpr bool use_scan_look_back_v =
+        std::is_same_v<
+            typename std::decay_t<ExPolicy>::executor_parameters_type,
+            pika::execution::parallel_policy::executor_parameters_type> &&
+        pika::traits::is_random_access_iterator_v<FwdIter1> &&
+        pika::traits::is_random_access_iterator_v<FwdIter2> &&
+        std::is_default_constructible_v<T> && std::is_copy_assignable_v<T>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class scan_look_back_state
+    {
+        invalid,      // the chunk is still being scanned
+        aggregate,    // the sum of the chunk itself is known
+        prefix,       // the sum of all chunks up to this one is known
+        failed        // the chunk or one of its predecessors has failed
+    };
+
+    template <typename T>
+    struct scan_look_back_status
+    {
+        std::atomic<scan_look_back_state> state{scan_look_back_state::invalid};
+        T aggregate;
+        T prefix;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scans the sequence in a single pass. The chunks are handed out in order
+    // of their position to one task per core. Every chunk publishes the sum of
+    // its own elements as soon as it is known and determines the sum of all
+    // elements before it by looking back at the published results of its
+    // predecessors. Each element is read and written once, the results of a
+    // chunk are fixed up while they are still in the cache.
+    //
+    // f1(first, count, prefix) scans a chunk given the sum of the elements
+    //      before it and returns the sum including the chunk
+    // f2(first, count) scans a chunk on its own, returns the sum of the chunk
+    // op(lhs, rhs) combines two sums
+    // f3(first, count, prefix) combines the results of f2 with the sum of the
+    //      elements before the chunk
+    // f4() returns the overall result
+    template <typename ExPolicy, typename R, typename T>
+    struct scan_look_back_partitioner
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+        using executor_type = typename std::decay_t<ExPolicy>::executor_type;
+
+        using scoped_parameters =
+            scoped_executor_parameters_ref<parameters_type, executor_type>;
+
+        using handle_exceptions = handle_local_exceptions<ExPolicy>;
+
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2, typename Op, typename F3, typename F4>
+        static typename algorithm_result<ExPolicy, R>::type call(
+            ExPolicy_&& policy, FwdIter first, std::size_t count, T init,
+            F1&& f1, F2&& f2, Op&& op, F3&& f3, F4&& f4)
+        {
+            using result = algorithm_result<ExPolicy, R>;
+
+            if constexpr (pika::is_async_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, count, init = PIKA_MOVE(init),
+                        f1 = PIKA_FORWARD(F1, f1), f2 = PIKA_FORWARD(F2, f2),
+                        op = PIKA_FORWARD(Op, op), f3 = PIKA_FORWARD(F3, f3),
+                        f4 = PIKA_FORWARD(F4, f4)]() mutable -> R {
+                        scan(policy, first, count, init, f1, f2, op, f3);
+                        return f4();
+                    }));
+            }
+            else
+            {
+                scan(policy, first, count, init, f1, f2, op, f3);
+                return result::get(f4());
+            }
+        }
+
+    private:
+        template <typename ExPolicy_, typename FwdIter, typename F1,
+            typename F2, typename Op, typename F3>
+        static void scan(ExPolicy_& policy, FwdIter first, std::size_t count,
+            T const& init, F1& f1, F2& f2, Op& op, F3& f3)
+        {
+            // inform parameter traits
+            scoped_parameters scoped_params(
+                policy.parameters(), policy.executor());
+
+            auto traced_f1 = util::detail::make_traced_chunk_function(
+                "scan_single_pass", f1);
+            auto traced_f2 =
+                util::detail::make_traced_chunk_function("scan_local", f2);
+            auto traced_f3 =
+                util::detail::make_traced_chunk_function("scan_fixup", f3);
+
+            std::size_t const chunk_size = scan_look_back_chunk_size<T>();
+            std::size_t const num_chunks =
+                (count + chunk_size - 1) / chunk_size;
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_workers = (std::min)(cores, num_chunks);
+
+            if (num_workers <= 1)
+            {
+                try
+                {
+                    traced_f1(first, count, init);
+                }
+                catch (...)
+                {
+                    // rethrow either bad_alloc or exception_list
+                    handle_exceptions::call(std::current_exception());
+                }
+                return;
+            }
+
+            std::vector<scan_look_back_status<T>> status(num_chunks);
+            std::atomic<std::size_t> next_chunk(0);
+            std::atomic<bool> failed(false);
+
+            auto publish = [&](std::size_t chunk, scan_look_back_state state) {
+                status[chunk].state.store(state, std::memory_order_release);
+            };
+
+            // waits for the given chunk to publish any of its results
+            auto wait_for = [&](std::size_t chunk) {
+                auto state =
+                    status[chunk].state.load(std::memory_order_acquire);
+                if (state == scan_look_back_state::invalid)
+                {
+                    pika::util::yield_while(
+                        [&]() {
+                            state = status[chunk].state.load(
+                                std::memory_order_acquire);
+                            return state == scan_look_back_state::invalid;
+                        },
+                        "scan_look_back");
+                }
+                return state;
+            };
+
+            // Determines the sum of all elements before the given chunk from
+            // the results of its predecessors, returns false if one of them
+            // failed. The first chunk always publishes its prefix.
+            auto look_back = [&](std::size_t chunk, T& prefix) -> bool {
+                PIKA_ASSERT(chunk != 0);
+
+                std::size_t i = chunk - 1;
+                auto state = wait_for(i);
+                if (state == scan_look_back_state::prefix)
+                {
+                    prefix = status[i].prefix;
+                    return true;
+                }
+
+                T sum = status[i].aggregate;
+                while (state == scan_look_back_state::aggregate)
+                {
+                    state = wait_for(--i);
+                    if (state == scan_look_back_state::prefix)
+                    {
+                        prefix = PIKA_INVOKE(op, status[i].prefix, sum);
+                        return true;
+                    }
+                    if (state == scan_look_back_state::aggregate)
+                    {
+                        sum = PIKA_INVOKE(op, status[i].aggregate, sum);
+                    }
+                }
+                return false;
+            };
+
+            auto run_chunk = [&](std::size_t chunk) {
+                std::size_t const base = chunk * chunk_size;
+                std::size_t const size = (std::min)(chunk_size, count - base);
+                FwdIter it = std::next(first, base);
+                scan_look_back_status<T>& s = status[chunk];
+
+                // the predecessor has usually finished already, which allows
+                // for scanning the chunk in one go
+                if (chunk == 0)
+                {
+                    s.prefix = traced_f1(it, size, init);
+                    publish(chunk, scan_look_back_state::prefix);
+                    return;
+                }
+                if (status[chunk - 1].state.load(std::memory_order_acquire) ==
+                    scan_look_back_state::prefix)
+                {
+                    s.prefix = traced_f1(it, size, status[chunk - 1].prefix);
+                    publish(chunk, scan_look_back_state::prefix);
+                    return;
+                }
+
+                s.aggregate = traced_f2(it, size);
+                publish(chunk, scan_look_back_state::aggregate);
+
+                T prefix;
+                if (!look_back(chunk, prefix))
+                {
+                    publish(chunk, scan_look_back_state::failed);
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+
+                // the successors don't need to wait for the fix up
+                s.prefix = PIKA_INVOKE(op, prefix, s.aggregate);
+                publish(chunk, scan_look_back_state::prefix);
+
+                traced_f3(it, size, prefix);
+            };
+
+            // chunks are handed out in order, every chunk which is being
+            // looked at has been taken by a running task
+            auto worker = [&](std::size_t) {
+                while (!failed.load(std::memory_order_relaxed))
+                {
+                    std::size_t const chunk =
+                        next_chunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk >= num_chunks)
+                    {
+                        break;
+                    }
+
+                    try
+                    {
+                        run_chunk(chunk);
+                    }
+                    catch (...)
+                    {
+                        // the prefix may have been published already
+                        if (status[chunk].state.load(
+                                std::memory_order_relaxed) !=
+                            scan_look_back_state::prefix)
+                        {
+                            publish(chunk, scan_look_back_state::failed);
+                        }
+                        failed.store(true, std::memory_order_relaxed);
+                        throw;
+                    }
+                }
+            };
+
+            std::vector<pika::future<void>> workers =
+                execution::bulk_async_execute(policy.executor(), worker,
+                    pika::detail::irange(std::size_t(0), num_workers));
+
+            scoped_params.mark_end_of_scheduling();
+
+            pika::wait_all_nothrow(workers);
+
+            // rethrow the exceptions of all failed chunks
+            std::list<std::exception_ptr> errors;
+            handle_exceptions::call(workers, errors);
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
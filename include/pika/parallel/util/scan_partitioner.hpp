@@ -16,8 +16,10 @@
 #if !defined(PIKA_COMPUTE_DEVICE_CODE)
 #include <pika/async/dataflow.hpp>
 #endif
+#include <pika/iterator_support/irange.hpp>
 
 #include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
 #include <pika/execution/executors/execution_parameters.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
@@ -25,6 +27,7 @@
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <pika/parallel/util/detail/select_partitioner.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -43,6 +46,11 @@ namespace pika::parallel::detail {
     {
     };
 
+    // the number of partitions from which on the intermediate results are
+    // combined by a parallel up-sweep and down-sweep instead of one after
+    // the other
+    inline constexpr std::size_t scan_partitioner_sweep_limit = 256;
+
     ///////////////////////////////////////////////////////////////////////
     // The static partitioner simply spawns one chunk of iterations for
     // each available core.
@@ -80,17 +88,25 @@ namespace pika::parallel::detail {
             scoped_parameters scoped_params(
                 policy.parameters(), policy.executor());
 
+            // results of the first step for each partition
             std::vector<pika::shared_future<Result1>> workitems;
+            // results of the second step, prefixes[i] combines everything
+            // to the left of partition i
+            std::vector<pika::shared_future<Result1>> prefixes;
+            // exceptions thrown by f2 itself, as opposed to those which are
+            // propagated from the partitions to the left
+            std::vector<std::exception_ptr> f2errors;
             std::vector<pika::future<Result2>> finalitems;
-            std::vector<Result1> f2results;
             std::list<std::exception_ptr> errors;
             try
             {
-                // pre-initialize first intermediate result
-                workitems.push_back(make_ready_future(PIKA_FORWARD(T, init)));
-
                 PIKA_ASSERT(count > 0);
                 FwdIter first_ = first;
+
+                auto traced_f1 =
+                    util::detail::make_traced_chunk_function("scan_f1", f1);
+                auto traced_f3 =
+                    util::detail::make_traced_chunk_function("scan_f3", f3);
                 std::size_t count_ = count;
 
                 // estimate a chunk size based on number of cores used
@@ -98,70 +114,67 @@ namespace pika::parallel::detail {
                     typename execution::extract_has_variable_chunk_size<
                         parameters_type>::type;
 
+                std::vector<pika::shared_future<Result1>> inititems;
                 auto shape = get_bulk_iteration_shape(has_variable_chunk_size(),
-                    policy, workitems, f1, first, count, 1);
+                    policy, inititems, traced_f1, first, count, 1);
 
-                // schedule every chunk on a separate thread
-                std::size_t size = pika::util::size(shape);
+                std::vector<std::pair<FwdIter, std::size_t>> chunks;
+                chunks.reserve(pika::util::size(shape));
+                for (auto const& elem : shape)
+                {
+                    chunks.emplace_back(std::get<0>(elem), std::get<1>(elem));
+                }
+
+                // pre-initialize first intermediate result
+                prefixes.reserve(chunks.size() + 2);
+                prefixes.push_back(make_ready_future(PIKA_FORWARD(T, init)));
 
                 // If the size of count was enough to warrant testing for a
                 // chunk, pre-initialize second intermediate result and
                 // start f3.
-                if (workitems.size() == 2)
+                finalitems.reserve(chunks.size() + 1);
+                if (!inititems.empty())
                 {
                     PIKA_ASSERT(count_ > count);
 
-                    workitems.reserve(size + 2);
-                    finalitems.reserve(size + 1);
-
                     finalitems.push_back(
-                        execution::async_execute(policy.executor(), f3, first_,
-                            count_ - count, workitems[0].get()));
+                        execution::async_execute(policy.executor(), traced_f3,
+                            first_, count_ - count, prefixes[0].get()));
 
-                    workitems[1] = make_ready_future(PIKA_INVOKE(
-                        f2, workitems[0].get(), workitems[1].get()));
-                }
-                else
-                {
-                    workitems.reserve(size + 1);
-                    finalitems.reserve(size);
+                    prefixes.push_back(make_ready_future(PIKA_INVOKE(
+                        f2, prefixes[0].get(), inititems[0].get())));
                 }
 
-                // Schedule first step of scan algorithm, step 2 is
-                // performed when all f1 tasks are done
-                for (auto const& elem : shape)
+                // Schedule first step of scan algorithm
+                workitems.reserve(chunks.size());
+                for (auto const& chunk : chunks)
                 {
-                    FwdIter it = std::get<0>(elem);
-                    std::size_t size = std::get<1>(elem);
-
-                    auto curr = execution::async_execute(
-                        policy.executor(), f1, it, size)
-                                    .share();
-
-                    workitems.push_back(curr);
+                    workitems.push_back(execution::async_execute(
+                        policy.executor(), traced_f1, chunk.first, chunk.second)
+                                            .share());
                 }
 
-                // Wait for all f1 tasks to finish
-                pika::wait_all_nothrow(workitems);
-
-                // perform f2 sequentially in one go
-                f2results.resize(workitems.size());
-                auto result = workitems[0].get();
-                f2results[0] = result;
-                for (std::size_t i = 1; i < workitems.size(); i++)
+                // the sweep keeps the intermediate results of the blocks
+                // of partitions in vectors
+                f2errors.resize(chunks.size());
+                if constexpr (std::is_default_constructible_v<Result1> &&
+                    std::is_copy_assignable_v<Result1>)
                 {
-                    result = PIKA_INVOKE(f2, result, workitems[i].get());
-                    f2results[i] = result;
+                    if (chunks.size() >= scan_partitioner_sweep_limit)
+                    {
+                        sweep(policy, chunks, workitems, prefixes, f2errors,
+                            finalitems, f2, traced_f3);
+                    }
+                    else
+                    {
+                        chain(policy, chunks, workitems, prefixes, f2errors,
+                            finalitems, f2, traced_f3);
+                    }
                 }
-
-                // start all f3 tasks
-                std::size_t i = 0;
-                for (auto const& elem : shape)
+                else
                 {
-                    finalitems.push_back(execution::async_execute(
-                        policy.executor(), f3, std::get<0>(elem),
-                        std::get<1>(elem), f2results[i]));
-                    i++;
+                    chain(policy, chunks, workitems, prefixes, f2errors,
+                        finalitems, f2, traced_f3);
                 }
 
                 scoped_params.mark_end_of_scheduling();
@@ -170,8 +183,9 @@ namespace pika::parallel::detail {
             {
                 handle_exceptions::call(std::current_exception(), errors);
             }
-            return reduce(PIKA_MOVE(f2results), PIKA_MOVE(finalitems),
-                PIKA_MOVE(errors), PIKA_FORWARD(F4, f4));
+            return reduce(PIKA_MOVE(workitems), PIKA_MOVE(prefixes),
+                PIKA_MOVE(f2errors), PIKA_MOVE(finalitems), PIKA_MOVE(errors),
+                PIKA_FORWARD(F4, f4));
 #endif
         }
 
@@ -207,6 +221,11 @@ namespace pika::parallel::detail {
 
                 PIKA_ASSERT(count > 0);
                 FwdIter first_ = first;
+
+                auto traced_f1 =
+                    util::detail::make_traced_chunk_function("scan_f1", f1);
+                auto traced_f3 =
+                    util::detail::make_traced_chunk_function("scan_f3", f3);
                 std::size_t count_ = count;
                 bool tested = false;
 
@@ -216,7 +235,7 @@ namespace pika::parallel::detail {
                         parameters_type>::type;
 
                 auto shape = get_bulk_iteration_shape(has_variable_chunk_size(),
-                    policy, workitems, f1, first, count, 1);
+                    policy, workitems, traced_f1, first, count, 1);
 
                 // schedule every chunk on a separate thread
                 std::size_t size = pika::util::size(shape);
@@ -249,7 +268,7 @@ namespace pika::parallel::detail {
 
                     pika::shared_future<Result1> prev = workitems.back();
                     auto curr = execution::async_execute(
-                        policy.executor(), f1, it, size)
+                        policy.executor(), traced_f1, it, size)
                                     .share();
 
                     workitems.push_back(
@@ -264,8 +283,9 @@ namespace pika::parallel::detail {
                 {
                     PIKA_ASSERT(count_ > count);
 
-                    finalitems.push_back(dataflow(pika::launch::sync, f3,
-                        first_, count_ - count, workitems[0], workitems[1]));
+                    finalitems.push_back(dataflow(pika::launch::sync,
+                        traced_f3, first_, count_ - count, workitems[0],
+                        workitems[1]));
                 }
                 else
                 {
@@ -273,8 +293,8 @@ namespace pika::parallel::detail {
                     FwdIter it = std::get<0>(elem);
                     std::size_t size = std::get<1>(elem);
 
-                    finalitems.push_back(dataflow(pika::launch::sync, f3, it,
-                        size, workitems[0], workitems[1]));
+                    finalitems.push_back(dataflow(pika::launch::sync,
+                        traced_f3, it, size, workitems[0], workitems[1]));
                 }
 
                 PIKA_ASSERT(finalitems.size() >= 1);
@@ -291,8 +311,9 @@ namespace pika::parallel::detail {
                     // Wait the completion of f3 on previous partition.
                     finalitems.back().wait();
 
-                    finalitems.push_back(dataflow(pika::launch::sync, f3, it,
-                        size, workitems[widx], workitems[widx + 1]));
+                    finalitems.push_back(dataflow(pika::launch::sync,
+                        traced_f3, it, size, workitems[widx],
+                        workitems[widx + 1]));
                 }
 
                 scoped_params.mark_end_of_scheduling();
@@ -351,13 +372,210 @@ namespace pika::parallel::detail {
 #endif
         }
 
+        // Step 2 is performed as soon as the current partition and the
+        // partition to the left are ready, step 3 is started as soon as the
+        // prefix of its partition and its own step 1 are done.
+        template <typename ExPolicy_, typename FwdIter, typename F2,
+            typename F3>
+        static void chain(ExPolicy_& policy,
+            std::vector<std::pair<FwdIter, std::size_t>> const& chunks,
+            std::vector<pika::shared_future<Result1>> const& workitems,
+            std::vector<pika::shared_future<Result1>>& prefixes,
+            std::vector<std::exception_ptr>& f2errors,
+            std::vector<pika::future<Result2>>& finalitems, F2& f2, F3& f3)
+        {
+#if defined(PIKA_COMPUTE_DEVICE_CODE)
+            PIKA_UNUSED(policy);
+            PIKA_UNUSED(chunks);
+            PIKA_UNUSED(workitems);
+            PIKA_UNUSED(prefixes);
+            PIKA_UNUSED(f2errors);
+            PIKA_UNUSED(finalitems);
+            PIKA_UNUSED(f2);
+            PIKA_UNUSED(f3);
+            PIKA_ASSERT(false);
+#else
+            auto combine = [&f2, &f2errors](std::size_t i,
+                               pika::shared_future<Result1> prev,
+                               pika::shared_future<Result1> curr) -> Result1 {
+                Result1 lhs = prev.get();
+                Result1 rhs = curr.get();
+                try
+                {
+                    return PIKA_INVOKE(f2, lhs, rhs);
+                }
+                catch (...)
+                {
+                    f2errors[i] = std::current_exception();
+                    throw;
+                }
+            };
+
+            // Step 3 operates on the results of step 1 of its partition.
+            // The failures of step 1 and of the partitions to the left are
+            // reported there.
+            auto final_step = [f3](FwdIter it, std::size_t size,
+                                  pika::shared_future<Result1> prev,
+                                  pika::shared_future<Result1> curr) mutable
+                -> Result2 {
+                if (prev.has_exception() || curr.has_exception())
+                {
+                    return Result2();
+                }
+                return f3(it, size, prev.get());
+            };
+
+            for (std::size_t i = 0; i != chunks.size(); ++i)
+            {
+                pika::shared_future<Result1> prev = prefixes.back();
+                prefixes.push_back(dataflow(
+                    pika::launch::sync, combine, i, prev, workitems[i]));
+                finalitems.push_back(dataflow(policy.executor(), final_step,
+                    chunks[i].first, chunks[i].second, prev, workitems[i]));
+            }
+#endif
+        }
+
+        // For many partitions the prefixes are computed by a parallel
+        // up-sweep (each core combines the results of a block of
+        // partitions) and down-sweep (each core computes the prefixes of
+        // its block and starts step 3 for it) once step 1 has finished.
+        template <typename ExPolicy_, typename FwdIter, typename F2,
+            typename F3>
+        static void sweep(ExPolicy_& policy,
+            std::vector<std::pair<FwdIter, std::size_t>> const& chunks,
+            std::vector<pika::shared_future<Result1>> const& workitems,
+            std::vector<pika::shared_future<Result1>>& prefixes,
+            std::vector<std::exception_ptr>& f2errors,
+            std::vector<pika::future<Result2>>& finalitems, F2& f2, F3& f3)
+        {
+#if defined(PIKA_COMPUTE_DEVICE_CODE)
+            PIKA_UNUSED(policy);
+            PIKA_UNUSED(chunks);
+            PIKA_UNUSED(workitems);
+            PIKA_UNUSED(prefixes);
+            PIKA_UNUSED(f2errors);
+            PIKA_UNUSED(finalitems);
+            PIKA_UNUSED(f2);
+            PIKA_UNUSED(f3);
+            PIKA_ASSERT(false);
+#else
+            pika::wait_all_nothrow(workitems);
+            for (auto const& w : workitems)
+            {
+                // the failed partitions are reported by reduce
+                if (w.has_exception())
+                {
+                    return;
+                }
+            }
+
+            std::size_t const num_chunks = chunks.size();
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const num_blocks = (std::min)(cores, num_chunks);
+            auto block_begin = [&](std::size_t block) {
+                return block * num_chunks / num_blocks;
+            };
+
+            // up-sweep
+            std::vector<Result1> block_results(num_blocks);
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t block) {
+                    std::size_t const end = block_begin(block + 1);
+                    std::size_t i = block_begin(block);
+                    try
+                    {
+                        Result1 result = workitems[i].get();
+                        while (++i != end)
+                        {
+                            result =
+                                PIKA_INVOKE(f2, result, workitems[i].get());
+                        }
+                        block_results[block] = PIKA_MOVE(result);
+                    }
+                    catch (...)
+                    {
+                        f2errors[i] = std::current_exception();
+                    }
+                },
+                pika::detail::irange(std::size_t(0), num_blocks));
+
+            for (auto const& e : f2errors)
+            {
+                if (e)
+                {
+                    return;
+                }
+            }
+
+            std::vector<Result1> block_prefixes(num_blocks);
+            block_prefixes[0] = prefixes.back().get();
+            for (std::size_t block = 1; block != num_blocks; ++block)
+            {
+                block_prefixes[block] = PIKA_INVOKE(f2,
+                    block_prefixes[block - 1], block_results[block - 1]);
+            }
+
+            // down-sweep, the partitions which are not started are marked
+            // by an invalid future
+            std::size_t const base = prefixes.size();
+            std::size_t const final_base = finalitems.size();
+            prefixes.resize(base + num_chunks);
+            finalitems.resize(final_base + num_chunks);
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t block) {
+                    std::size_t const end = block_begin(block + 1);
+                    std::size_t i = block_begin(block);
+                    try
+                    {
+                        Result1 prefix = block_prefixes[block];
+                        for (/**/; i != end; ++i)
+                        {
+                            finalitems[final_base + i] =
+                                execution::async_execute(policy.executor(), f3,
+                                    chunks[i].first, chunks[i].second, prefix);
+
+                            prefix =
+                                PIKA_INVOKE(f2, prefix, workitems[i].get());
+                            prefixes[base + i] = make_ready_future(prefix);
+                        }
+                    }
+                    catch (...)
+                    {
+                        f2errors[i] = std::current_exception();
+                        for (std::size_t j = i; j != end; ++j)
+                        {
+                            prefixes[base + j] =
+                                pika::make_exceptional_future<Result1>(
+                                    f2errors[i]);
+                        }
+                    }
+                },
+                pika::detail::irange(std::size_t(0), num_blocks));
+
+            finalitems.erase(std::remove_if(finalitems.begin() + final_base,
+                                 finalitems.end(),
+                                 [](pika::future<Result2> const& f) {
+                                     return !f.valid();
+                                 }),
+                finalitems.end());
+#endif
+        }
+
         template <typename F>
-        static R reduce(std::vector<Result1>&& workitems,
+        static R reduce(std::vector<pika::shared_future<Result1>>&& workitems,
+            std::vector<pika::shared_future<Result1>>&& prefixes,
+            std::vector<std::exception_ptr>&& f2errors,
             std::vector<pika::future<Result2>>&& finalitems,
             std::list<std::exception_ptr>&& errors, F&& f)
         {
 #if defined(PIKA_COMPUTE_DEVICE_CODE)
             PIKA_UNUSED(workitems);
+            PIKA_UNUSED(prefixes);
+            PIKA_UNUSED(f2errors);
             PIKA_UNUSED(finalitems);
             PIKA_UNUSED(errors);
             PIKA_UNUSED(f);
@@ -365,15 +583,31 @@ namespace pika::parallel::detail {
             return R();
 #else
             // wait for all tasks to finish
-            pika::wait_all_nothrow(finalitems);
+            pika::wait_all_nothrow(workitems, prefixes, finalitems);
 
-            // always rethrow if 'errors' is not empty or
-            // 'finalitems' have an exceptional future
+            // Always rethrow if 'errors' is not empty or 'workitems' or
+            // 'finalitems' have an exceptional future. The prefixes are
+            // exceptional if any partition to the left failed, only the
+            // exceptions thrown by f2 itself are reported.
+            for (auto& e : f2errors)
+            {
+                if (e)
+                {
+                    handle_exceptions::call(e, errors);
+                }
+            }
+            handle_exceptions::call(workitems, errors);
             handle_exceptions::call(finalitems, errors);
 
             try
             {
-                return f(PIKA_MOVE(workitems), PIKA_MOVE(finalitems));
+                std::vector<Result1> results;
+                results.reserve(prefixes.size());
+                for (auto const& p : prefixes)
+                {
+                    results.push_back(p.get());
+                }
+                return f(PIKA_MOVE(results), PIKA_MOVE(finalitems));
             }
             catch (...)
             {
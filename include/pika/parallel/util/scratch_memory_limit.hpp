@@ -0,0 +1,350 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/scratch_memory_limit.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Counts the scratch memory, i.e. the temporary buffers, of the
+    /// algorithms invoked with a \a scratch_memory_limit referring to it.
+    /// The algorithms reserve the memory of their temporary buffers before
+    /// allocating them and release it once the buffers are gone. A usage
+    /// object may be shared by concurrent algorithm calls, the budget of the
+    /// \a scratch_memory_limit then bounds the memory of all of them
+    /// together.
+    class scratch_memory_usage
+    {
+    public:
+        scratch_memory_usage() = default;
+
+        scratch_memory_usage(scratch_memory_usage const&) = delete;
+        scratch_memory_usage& operator=(scratch_memory_usage const&) = delete;
+
+        /// Returns the number of bytes reserved right now
+        std::size_t current_bytes() const noexcept
+        {
+            return current_.load(std::memory_order_relaxed);
+        }
+
+        /// Returns the largest number of bytes reserved at any time since
+        /// construction or the last call to \a reset
+        std::size_t peak_bytes() const noexcept
+        {
+            return peak_.load(std::memory_order_relaxed);
+        }
+
+        /// Returns the sum of the bytes of all reservations since
+        /// construction or the last call to \a reset
+        std::size_t total_bytes() const noexcept
+        {
+            return total_.load(std::memory_order_relaxed);
+        }
+
+        /// Returns the number of times an algorithm used a strategy needing
+        /// less memory because its temporary buffers would have exceeded
+        /// the budget
+        std::size_t fallbacks() const noexcept
+        {
+            return fallbacks_.load(std::memory_order_relaxed);
+        }
+
+        /// Restarts the peak at the bytes reserved right now, resets the
+        /// total and the number of fallbacks
+        void reset() noexcept
+        {
+            peak_.store(current_bytes(), std::memory_order_relaxed);
+            total_.store(0, std::memory_order_relaxed);
+            fallbacks_.store(0, std::memory_order_relaxed);
+        }
+
+        /// \cond NOINTERNAL
+        // Reserves bytes if no more than max_bytes are reserved afterwards
+        bool try_acquire(std::size_t bytes, std::size_t max_bytes) noexcept
+        {
+            std::size_t current = current_bytes();
+            do
+            {
+                if (bytes > max_bytes || current > max_bytes - bytes)
+                {
+                    fallbacks_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            } while (!current_.compare_exchange_weak(
+                current, current + bytes, std::memory_order_relaxed));
+
+            update(current + bytes, bytes);
+            return true;
+        }
+
+        // Reserves bytes regardless of the budget
+        void acquire(std::size_t bytes) noexcept
+        {
+            update(current_.fetch_add(bytes, std::memory_order_relaxed) + bytes,
+                bytes);
+        }
+
+        void release(std::size_t bytes) noexcept
+        {
+            current_.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        void update(std::size_t current, std::size_t bytes) noexcept
+        {
+            total_.fetch_add(bytes, std::memory_order_relaxed);
+
+            std::size_t peak = peak_.load(std::memory_order_relaxed);
+            while (peak < current &&
+                !peak_.compare_exchange_weak(
+                    peak, current, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::atomic<std::size_t> current_{0};
+        std::atomic<std::size_t> peak_{0};
+        std::atomic<std::size_t> total_{0};
+        std::atomic<std::size_t> fallbacks_{0};
+        /// \endcond
+    };
+}    // namespace pika::parallel::util
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type bounding the scratch memory of the algorithms
+    /// allocating large temporary buffers, and reporting it to a
+    /// \a scratch_memory_usage. Where the buffers would exceed the budget,
+    /// the algorithms use a strategy needing less memory instead:
+    ///
+    /// - \a stable_sort merges the sorted runs through a buffer fitting into
+    ///   the remaining budget (at least one element), as with
+    ///   \a stable_sort_memory_limit, instead of sorting through a buffer
+    ///   of half of the sequence
+    /// - \a unique and \a unique_copy compact the elements sequentially,
+    ///   without the flags of the elements
+    /// - \a reduce_by_key reduces the keys in a single chunk
+    /// - the set operations (\a set_union, \a set_intersection, ...) split
+    ///   the sequences into a single chunk
+    ///
+    /// Other algorithms are not affected. Without a usage object the budget
+    /// bounds the temporary buffers of each call, with a usage object it
+    /// bounds the temporary buffers of all calls sharing it.
+    ///
+    struct scratch_memory_limit
+    {
+        /// Construct a \a scratch_memory_limit executor parameters object
+        ///
+        /// \param max_bytes [in] The budget of the temporary buffers in
+        ///                     bytes.
+        ///
+        constexpr explicit scratch_memory_limit(std::size_t max_bytes) noexcept
+          : max_bytes_(max_bytes)
+          , usage_(nullptr)
+        {
+        }
+
+        /// Construct a \a scratch_memory_limit executor parameters object
+        ///
+        /// \param max_bytes [in] The budget of the temporary buffers in
+        ///                     bytes.
+        /// \param usage [in] The object the temporary buffers are reported
+        ///                     to, it has to outlive all algorithms using it.
+        ///
+        constexpr scratch_memory_limit(std::size_t max_bytes,
+            pika::parallel::util::scratch_memory_usage& usage) noexcept
+          : max_bytes_(max_bytes)
+          , usage_(&usage)
+        {
+        }
+
+        /// Construct a \a scratch_memory_limit executor parameters object
+        /// reporting the temporary buffers without bounding them
+        ///
+        /// \param usage [in] The object the temporary buffers are reported
+        ///                     to, it has to outlive all algorithms using it.
+        ///
+        constexpr explicit scratch_memory_limit(
+            pika::parallel::util::scratch_memory_usage& usage) noexcept
+          : max_bytes_(std::size_t(-1))
+          , usage_(&usage)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_max_bytes() const noexcept
+        {
+            return max_bytes_;
+        }
+
+        constexpr pika::parallel::util::scratch_memory_usage*
+        get_scratch_memory_usage() const noexcept
+        {
+            return usage_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t max_bytes_;
+        pika::parallel::util::scratch_memory_usage* usage_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::scratch_memory_limit>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parameters>
+    inline constexpr bool has_scratch_memory_limit_v = std::is_same_v<
+        std::decay_t<Parameters>, pika::execution::scratch_memory_limit>;
+
+    // Returns the bytes of scratch memory left to the algorithms invoked
+    // with the given parameters
+    template <typename Parameters>
+    std::size_t available_scratch_memory(Parameters const& params) noexcept
+    {
+        if constexpr (has_scratch_memory_limit_v<Parameters>)
+        {
+            std::size_t const max_bytes = params.get_max_bytes();
+            if (auto* usage = params.get_scratch_memory_usage())
+            {
+                std::size_t const current = usage->current_bytes();
+                return current < max_bytes ? max_bytes - current : 0;
+            }
+            return max_bytes;
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+            return std::size_t(-1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reserves the scratch memory of a temporary buffer for its lifetime.
+    // A reservation which would exceed the budget fails, the algorithm has
+    // to use a strategy needing less memory then. Reservations always
+    // succeed for parameters other than scratch_memory_limit.
+    class scratch_memory_reservation
+    {
+    public:
+        scratch_memory_reservation() = default;
+
+        template <typename Parameters>
+        scratch_memory_reservation(Parameters const& params,
+            std::size_t bytes, bool bounded = true) noexcept
+        {
+            if constexpr (has_scratch_memory_limit_v<Parameters>)
+            {
+                usage_ = params.get_scratch_memory_usage();
+                if (usage_ == nullptr)
+                {
+                    acquired_ = !bounded || bytes <= params.get_max_bytes();
+                    return;
+                }
+
+                if (!bounded)
+                {
+                    usage_->acquire(bytes);
+                }
+                else if (!usage_->try_acquire(bytes, params.get_max_bytes()))
+                {
+                    acquired_ = false;
+                    usage_ = nullptr;
+                    return;
+                }
+                bytes_ = bytes;
+            }
+            else
+            {
+                PIKA_UNUSED(params);
+                PIKA_UNUSED(bytes);
+                PIKA_UNUSED(bounded);
+            }
+        }
+
+        scratch_memory_reservation(scratch_memory_reservation&& rhs) noexcept
+          : usage_(rhs.usage_)
+          , bytes_(rhs.bytes_)
+          , acquired_(rhs.acquired_)
+        {
+            rhs.usage_ = nullptr;
+        }
+
+        scratch_memory_reservation& operator=(
+            scratch_memory_reservation&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                reset();
+                usage_ = rhs.usage_;
+                bytes_ = rhs.bytes_;
+                acquired_ = rhs.acquired_;
+                rhs.usage_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~scratch_memory_reservation()
+        {
+            reset();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return acquired_;
+        }
+
+        // Hands the reserved bytes over to the caller, which has to release
+        // them from the returned usage object (if any)
+        scratch_memory_usage* detach() noexcept
+        {
+            scratch_memory_usage* usage = usage_;
+            usage_ = nullptr;
+            return usage;
+        }
+
+        std::size_t bytes() const noexcept
+        {
+            return bytes_;
+        }
+
+    private:
+        void reset() noexcept
+        {
+            if (usage_ != nullptr)
+            {
+                usage_->release(bytes_);
+                usage_ = nullptr;
+            }
+        }
+
+        scratch_memory_usage* usage_ = nullptr;
+        std::size_t bytes_ = 0;
+        bool acquired_ = true;
+    };
+}    // namespace pika::parallel::util::detail
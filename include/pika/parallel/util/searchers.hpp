@@ -0,0 +1,208 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/searchers.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace pika {
+    /// \cond NOINTERNAL
+    namespace detail {
+        // Byte sized values compared by their value are looked up in an
+        // array, all other values in a hash map.
+        template <typename T, typename Hash, typename BinaryPredicate>
+        inline constexpr bool use_byte_skip_table_v =
+            std::is_integral_v<T> && sizeof(T) == 1 &&
+            !std::is_same_v<T, bool> && std::is_same_v<Hash, std::hash<T>> &&
+            (std::is_same_v<BinaryPredicate, std::equal_to<>> ||
+                std::is_same_v<BinaryPredicate, std::equal_to<T>>);
+
+        // The distance the pattern is shifted by if the text element aligned
+        // with the last element of the pattern is the given one
+        template <typename T, typename Hash, typename BinaryPredicate,
+            typename Enable = void>
+        class horspool_skip_table
+        {
+        public:
+            horspool_skip_table(
+                std::size_t size, Hash const& hf, BinaryPredicate const& pred)
+              : skip_(size, hf, pred)
+              , size_(size)
+            {
+            }
+
+            void insert(T const& value, std::size_t skip)
+            {
+                skip_[value] = skip;
+            }
+
+            template <typename U>
+            std::size_t operator[](U const& value) const
+            {
+                auto it = skip_.find(value);
+                return it == skip_.end() ? size_ : it->second;
+            }
+
+        private:
+            std::unordered_map<T, std::size_t, Hash, BinaryPredicate> skip_;
+            std::size_t size_;
+        };
+
+        template <typename T, typename Hash, typename BinaryPredicate>
+        class horspool_skip_table<T, Hash, BinaryPredicate,
+            std::enable_if_t<use_byte_skip_table_v<T, Hash, BinaryPredicate>>>
+        {
+        public:
+            horspool_skip_table(
+                std::size_t size, Hash const&, BinaryPredicate const&)
+            {
+                skip_.fill(size);
+            }
+
+            void insert(T const& value, std::size_t skip)
+            {
+                skip_[static_cast<unsigned char>(value)] = skip;
+            }
+
+            template <typename U>
+            std::size_t operator[](U const& value) const
+            {
+                return skip_[static_cast<unsigned char>(value)];
+            }
+
+        private:
+            std::array<std::size_t, UCHAR_MAX + 1> skip_;
+        };
+
+        // Searchers which expose the length of their pattern can be run on
+        // the chunks of a sequence concurrently, all others are run
+        // sequentially by the parallel algorithms.
+        template <typename Searcher, typename Enable = void>
+        struct is_parallel_searcher : std::false_type
+        {
+        };
+
+        template <typename Searcher>
+        struct is_parallel_searcher<Searcher,
+            std::void_t<decltype(
+                std::declval<Searcher const&>().pattern_size())>>
+          : std::true_type
+        {
+        };
+
+        template <typename Searcher>
+        inline constexpr bool is_parallel_searcher_v =
+            is_parallel_searcher<Searcher>::value;
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A searcher implementing the Boyer-Moore-Horspool algorithm, which can
+    /// be passed to \a pika::search, \a pika::search_n and
+    /// \a pika::find_end. It can be used in the same way as
+    /// std::boyer_moore_horspool_searcher. In addition, the parallel
+    /// algorithms query the length of the pattern to search the chunks of the
+    /// sequence concurrently.
+    ///
+    /// The skip table is computed once on construction and is shared by all
+    /// copies of the searcher. Byte sized integral values compared by
+    /// std::equal_to are looked up in an array, all other values in a hash
+    /// map.
+    ///
+    /// \tparam RandomIt1   The type of the iterators representing the
+    ///                     pattern. This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Hash        The type of the hash function of the values of
+    ///                     the pattern.
+    /// \tparam BinaryPredicate The type of the predicate comparing the
+    ///                     elements of the sequence to the elements of the
+    ///                     pattern.
+    ///
+    template <typename RandomIt1,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RandomIt1>::value_type>,
+        typename BinaryPredicate = std::equal_to<>>
+    class boyer_moore_horspool_searcher
+    {
+        using value_type = typename std::iterator_traits<RandomIt1>::value_type;
+        using table_type =
+            detail::horspool_skip_table<value_type, Hash, BinaryPredicate>;
+
+    public:
+        /// Construct a searcher for the pattern [pat_first, pat_last), the
+        /// pattern has to outlive the searcher and all of its copies.
+        boyer_moore_horspool_searcher(RandomIt1 pat_first, RandomIt1 pat_last,
+            Hash hf = Hash(), BinaryPredicate pred = BinaryPredicate())
+          : pat_first_(pat_first)
+          , size_(static_cast<std::size_t>(std::distance(pat_first, pat_last)))
+          , pred_(PIKA_MOVE(pred))
+        {
+            auto table = std::make_shared<table_type>(size_, hf, pred_);
+            for (std::size_t i = 0; i + 1 < size_; ++i)
+            {
+                table->insert(pat_first_[i], size_ - 1 - i);
+            }
+            skip_ = PIKA_MOVE(table);
+        }
+
+        /// Return the first occurrence of the pattern in [first, last) as
+        /// the pair of iterators to its first and one past its last element,
+        /// or (last, last) if there is none. An empty pattern is found at
+        /// first.
+        template <typename RandomIt2>
+        std::pair<RandomIt2, RandomIt2> operator()(
+            RandomIt2 first, RandomIt2 last) const
+        {
+            if (size_ == 0)
+            {
+                return {first, first};
+            }
+
+            std::size_t const count =
+                static_cast<std::size_t>(std::distance(first, last));
+            // the pattern is never shifted past the end of the sequence
+            for (std::size_t pos = 0; count - pos >= size_; /**/)
+            {
+                RandomIt2 const window = std::next(first, pos);
+                std::size_t i = size_ - 1;
+                while (pred_(window[i], pat_first_[i]))
+                {
+                    if (i == 0)
+                    {
+                        return {window, std::next(window, size_)};
+                    }
+                    --i;
+                }
+                pos += (*skip_)[window[size_ - 1]];
+            }
+            return {last, last};
+        }
+
+        /// Return the number of elements of the pattern
+        std::size_t pattern_size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        RandomIt1 pat_first_;
+        std::size_t size_;
+        BinaryPredicate pred_;
+        std::shared_ptr<table_type const> skip_;
+    };
+}    // namespace pika
@@ -0,0 +1,437 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/sketches.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    namespace detail {
+        // the finalizer of splitmix64, spreads the entropy of all bits of x
+        // over all bits of the result
+        constexpr std::uint64_t sketch_mix(std::uint64_t x) noexcept
+        {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        // the number of leading zero bits of x, 64 for x == 0
+        constexpr unsigned sketch_leading_zeros(std::uint64_t x) noexcept
+        {
+            if (x == 0)
+            {
+                return 64;
+            }
+            unsigned n = 0;
+            for (unsigned shift = 32; shift != 0; shift /= 2)
+            {
+                if ((x >> (64 - shift)) == 0)
+                {
+                    n += shift;
+                    x <<= shift;
+                }
+            }
+            return n;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Mergeable sketch of the distribution of a stream of values, answering
+    /// quantile and rank queries approximately in memory independent of the
+    /// number of values (Karnin, Lang and Liberty, "Optimal quantile
+    /// approximation in streams", FOCS'16). The values are kept in levels,
+    /// a value of level h stands for 2^h values of the stream. A level
+    /// exceeding its capacity is sorted and every other value of it is
+    /// moved to the next level, the capacities shrink geometrically from
+    /// the top level of \a k values downwards.
+    ///
+    /// The rank error of the queries is about 1.7 / k with high
+    /// probability, e.g. below 1% for the default k = 200, and the sketch
+    /// holds O(k log(n / k)) values for n values of the stream. Sketches of
+    /// parts of a stream can be merged into the sketch of the whole stream
+    /// with the same error guarantee (see \a make_quantile_sketch).
+    ///
+    /// \tparam T       The type of the values, it must be copyable.
+    /// \tparam Compare The strict weak ordering of the values.
+    ///
+    template <typename T, typename Compare = std::less<>>
+    class quantile_sketch
+    {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t default_k = 200;
+
+        /// Construct an empty sketch
+        ///
+        /// \param k [in] The capacity of the top level, which determines the
+        ///                     accuracy of the sketch. Values below 8 are
+        ///                     raised to 8.
+        /// \param comp [in] The ordering of the values.
+        ///
+        explicit quantile_sketch(
+            std::size_t k = default_k, Compare comp = Compare())
+          : k_((std::max)(k, std::size_t(8)))
+          , comp_(PIKA_MOVE(comp))
+          , levels_(1)
+        {
+        }
+
+        /// Returns the number of values added to the sketch.
+        std::uint64_t count() const noexcept
+        {
+            return count_;
+        }
+
+        /// Returns whether no values have been added to the sketch.
+        bool empty() const noexcept
+        {
+            return count_ == 0;
+        }
+
+        /// Returns the number of values retained by the sketch.
+        std::size_t retained() const noexcept
+        {
+            std::size_t size = 0;
+            for (auto const& level : levels_)
+            {
+                size += level.size();
+            }
+            return size;
+        }
+
+        /// Returns the capacity of the top level.
+        std::size_t k() const noexcept
+        {
+            return k_;
+        }
+
+        /// Adds a value to the sketch.
+        void update(T const& value)
+        {
+            if (!min_ || comp_(value, *min_))
+            {
+                min_ = value;
+            }
+            if (!max_ || comp_(*max_, value))
+            {
+                max_ = value;
+            }
+
+            levels_[0].push_back(value);
+            ++count_;
+            if (levels_[0].size() >= capacity(0))
+            {
+                compress();
+            }
+        }
+
+        /// Adds the values of another sketch to this sketch. The merged
+        /// sketch uses the smaller k of both.
+        void merge(quantile_sketch const& other)
+        {
+            if (other.empty())
+            {
+                return;
+            }
+
+            if (!min_ || comp_(*other.min_, *min_))
+            {
+                min_ = other.min_;
+            }
+            if (!max_ || comp_(*max_, *other.max_))
+            {
+                max_ = other.max_;
+            }
+
+            k_ = (std::min)(k_, other.k_);
+            if (levels_.size() < other.levels_.size())
+            {
+                levels_.resize(other.levels_.size());
+            }
+            for (std::size_t h = 0; h != other.levels_.size(); ++h)
+            {
+                levels_[h].insert(levels_[h].end(), other.levels_[h].begin(),
+                    other.levels_[h].end());
+            }
+            count_ += other.count_;
+            random_ ^= other.random_;
+
+            compress();
+        }
+
+        /// Returns a value whose rank is approximately q * count(), the
+        /// exact minimum for q <= 0 and the exact maximum for q >= 1.
+        ///
+        /// \note The sketch must not be empty.
+        ///
+        T quantile(double q) const
+        {
+            PIKA_ASSERT(!empty());
+            if (q <= 0.0)
+            {
+                return *min_;
+            }
+            if (q >= 1.0)
+            {
+                return *max_;
+            }
+
+            auto const weighted = sorted_values();
+            double const target = q * double(count_);
+            std::uint64_t weight = 0;
+            for (auto const& [value, w] : weighted)
+            {
+                weight += w;
+                if (double(weight) > target)
+                {
+                    return *value;
+                }
+            }
+            return *max_;
+        }
+
+        /// Returns approximately the fraction of the values added to the
+        /// sketch which are less than \a value, 0 for an empty sketch.
+        double rank(T const& value) const
+        {
+            if (empty())
+            {
+                return 0.0;
+            }
+
+            std::uint64_t weight = 0;
+            std::uint64_t w = 1;
+            for (auto const& level : levels_)
+            {
+                for (T const& v : level)
+                {
+                    if (comp_(v, value))
+                    {
+                        weight += w;
+                    }
+                }
+                w *= 2;
+            }
+            return double(weight) / double(count_);
+        }
+
+    private:
+        // the capacity of level h, k for the top level and shrinking by a
+        // factor of 2/3 per level below it, but at least 2
+        std::size_t capacity(std::size_t h) const noexcept
+        {
+            double const depth = double(levels_.size() - 1 - h);
+            auto const c = static_cast<std::size_t>(
+                std::ceil(double(k_) * std::pow(2.0 / 3.0, depth)));
+            return (std::max)(c, std::size_t(2));
+        }
+
+        // Compacts the levels exceeding their capacity, from the bottom up,
+        // adding a level on top if necessary.
+        void compress()
+        {
+            for (std::size_t h = 0; h != levels_.size(); ++h)
+            {
+                if (levels_[h].size() < capacity(h))
+                {
+                    continue;
+                }
+
+                if (h + 1 == levels_.size())
+                {
+                    levels_.emplace_back();
+                }
+
+                // an odd value stays on its level, every other value of the
+                // others moves up, starting at a random one of the first two
+                auto& level = levels_[h];
+                std::sort(level.begin(), level.end(), comp_);
+
+                std::size_t const pairs = level.size() / 2;
+                std::size_t const offset = random_bit();
+                auto& next = levels_[h + 1];
+                next.reserve(next.size() + pairs);
+                for (std::size_t i = 0; i != pairs; ++i)
+                {
+                    next.push_back(PIKA_MOVE(level[2 * i + offset]));
+                }
+
+                if (level.size() % 2 != 0)
+                {
+                    level[0] = PIKA_MOVE(level.back());
+                    level.resize(1);
+                }
+                else
+                {
+                    level.clear();
+                }
+            }
+        }
+
+        std::size_t random_bit() noexcept
+        {
+            random_ += 0x9e3779b97f4a7c15ull;
+            return detail::sketch_mix(random_) & 1;
+        }
+
+        // the retained values in ascending order with their weights
+        std::vector<std::pair<T const*, std::uint64_t>> sorted_values() const
+        {
+            std::vector<std::pair<T const*, std::uint64_t>> weighted;
+            weighted.reserve(retained());
+            std::uint64_t w = 1;
+            for (auto const& level : levels_)
+            {
+                for (T const& v : level)
+                {
+                    weighted.emplace_back(&v, w);
+                }
+                w *= 2;
+            }
+            std::sort(weighted.begin(), weighted.end(),
+                [this](auto const& lhs, auto const& rhs) {
+                    return comp_(*lhs.first, *rhs.first);
+                });
+            return weighted;
+        }
+
+        std::size_t k_;
+        Compare comp_;
+        std::vector<std::vector<T>> levels_;
+        std::uint64_t count_ = 0;
+        std::uint64_t random_ = 0;
+        std::optional<T> min_;
+        std::optional<T> max_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Mergeable sketch estimating the number of distinct values of a stream
+    /// in constant memory (HyperLogLog, Flajolet et al., AofA'07). The hash
+    /// of every value selects one of 2^precision registers, which keeps the
+    /// largest number of leading zero bits seen in the remaining bits of
+    /// the hashes. The relative standard error of the estimate is about
+    /// 1.04 / sqrt(2^precision), e.g. 0.8% for the default precision 14
+    /// using 16 KiB of registers. Sketches of parts of a stream can be
+    /// merged into the sketch of the whole stream without loss of accuracy
+    /// (see \a make_distinct_count_sketch).
+    ///
+    /// \tparam T       The type of the values.
+    /// \tparam Hash    The hash function of the values. Its results are
+    ///                 mixed before use, hash functions returning the value
+    ///                 itself (like std::hash of integers) are fine.
+    ///
+    template <typename T, typename Hash = std::hash<T>>
+    class distinct_count_sketch
+    {
+    public:
+        using value_type = T;
+
+        static constexpr unsigned default_precision = 14;
+
+        /// Construct an empty sketch
+        ///
+        /// \param precision [in] The base 2 logarithm of the number of
+        ///                     registers, clamped to [4, 18].
+        /// \param hash [in] The hash function of the values.
+        ///
+        explicit distinct_count_sketch(
+            unsigned precision = default_precision, Hash hash = Hash())
+          : precision_((std::min)((std::max)(precision, 4u), 18u))
+          , hash_(PIKA_MOVE(hash))
+          , registers_(std::size_t(1) << precision_, std::uint8_t(0))
+        {
+        }
+
+        /// Returns the base 2 logarithm of the number of registers.
+        unsigned precision() const noexcept
+        {
+            return precision_;
+        }
+
+        /// Adds a value to the sketch.
+        void update(T const& value)
+        {
+            std::uint64_t const h = detail::sketch_mix(
+                static_cast<std::uint64_t>(hash_(value)));
+            std::size_t const index = h >> (64 - precision_);
+            std::uint64_t const rest = h << precision_;
+            auto const rank = static_cast<std::uint8_t>(
+                (std::min)(detail::sketch_leading_zeros(rest),
+                    64 - precision_) +
+                1);
+            if (registers_[index] < rank)
+            {
+                registers_[index] = rank;
+            }
+        }
+
+        /// Adds the values of another sketch to this sketch.
+        ///
+        /// \note Both sketches must have the same precision.
+        ///
+        void merge(distinct_count_sketch const& other)
+        {
+            PIKA_ASSERT(precision_ == other.precision_);
+            for (std::size_t i = 0; i != registers_.size(); ++i)
+            {
+                registers_[i] = (std::max)(registers_[i], other.registers_[i]);
+            }
+        }
+
+        /// Returns the estimated number of distinct values added to the
+        /// sketch.
+        double estimate() const noexcept
+        {
+            double const m = double(registers_.size());
+            double sum = 0.0;
+            std::size_t zeros = 0;
+            for (std::uint8_t r : registers_)
+            {
+                sum += std::ldexp(1.0, -int(r));
+                zeros += r == 0;
+            }
+
+            double const alpha = 0.7213 / (1.0 + 1.079 / m);
+            double const raw = alpha * m * m / sum;
+
+            // linear counting is more accurate for small cardinalities
+            if (raw <= 2.5 * m && zeros != 0)
+            {
+                return m * std::log(m / double(zeros));
+            }
+            return raw;
+        }
+
+        /// Returns the estimated number of distinct values rounded to the
+        /// nearest integer.
+        std::uint64_t count() const noexcept
+        {
+            return static_cast<std::uint64_t>(std::llround(estimate()));
+        }
+
+    private:
+        unsigned precision_;
+        Hash hash_;
+        std::vector<std::uint8_t> registers_;
+    };
+}    // namespace pika
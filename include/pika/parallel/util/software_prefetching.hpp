@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/software_prefetching.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The cache levels a prefetched cache line is loaded into. The values
+    /// correspond to the locality argument of __builtin_prefetch, on x86
+    /// they select the hints _MM_HINT_NTA, _MM_HINT_T2, _MM_HINT_T1 and
+    /// _MM_HINT_T0.
+    enum class prefetch_locality
+    {
+        /// The data is used once, minimize the pollution of the caches
+        none = 0,
+        /// Load into the last level cache only
+        low = 1,
+        /// Load into the second level and last level caches
+        moderate = 2,
+        /// Load into all cache levels
+        high = 3
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting how far ahead and into which cache
+    /// levels the algorithms issue software prefetches:
+    ///  - \a gather, \a scatter and \a scatter_if prefetch the element
+    ///    accessed through the index \a distance positions ahead of the
+    ///    current one.
+    ///  - Loops over a \a prefetching_iterator created from these parameters
+    ///    (see \a make_prefetcher_context) prefetch the elements of all
+    ///    ranges \a distance cache lines ahead of the current one.
+    ///
+    /// A distance of zero selects the default distance of the algorithm. The
+    /// prefetches are issued by _mm_prefetch on x86 and by __builtin_prefetch
+    /// with compilers supporting it on other architectures (e.g. ARM or
+    /// POWER), they are omitted otherwise.
+    ///
+    /// \note The input is still split into chunks by the default rules,
+    ///       these parameters can not be combined with other executor
+    ///       parameters.
+    ///
+    class software_prefetching
+    {
+    public:
+        /// Use the default prefetch distance of each algorithm and load the
+        /// prefetched data into all cache levels
+        constexpr software_prefetching() noexcept = default;
+
+        /// Prefetch \a distance elements (or cache lines) ahead into the
+        /// cache levels selected by \a locality
+        explicit constexpr software_prefetching(std::size_t distance,
+            prefetch_locality locality = prefetch_locality::high) noexcept
+          : distance_(distance)
+          , locality_(locality)
+        {
+        }
+
+        /// Return the prefetch distance, zero selects the default
+        constexpr std::size_t distance() const noexcept
+        {
+            return distance_;
+        }
+
+        /// Return the cache levels the prefetched data is loaded into
+        constexpr prefetch_locality locality() const noexcept
+        {
+            return locality_;
+        }
+
+    private:
+        std::size_t distance_ = 0;
+        prefetch_locality locality_ = prefetch_locality::high;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::software_prefetching>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
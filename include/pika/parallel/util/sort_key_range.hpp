@@ -0,0 +1,73 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/sort_key_range.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type telling \a sort and \a sort_by_key that all
+    /// (projected) keys lie in the closed range [min_key, max_key]. Keys of
+    /// an integral or enumeration type compared using std::less or
+    /// std::greater are then sorted by a stable counting sort, which takes
+    /// a single pass over the elements to count the keys and a second one
+    /// to move every element to its place. Enumeration keys are ordered by
+    /// their underlying values.
+    ///
+    /// The range is used if it holds at most 65536 keys and at most as many
+    /// keys as there are elements. If any key turns out to lie outside of
+    /// it, the sequence is sorted as if no range had been given.
+    ///
+    struct sort_key_range
+    {
+        /// Construct a \a sort_key_range executor parameters object
+        ///
+        /// \param min_key [in] The smallest key of the sequence.
+        /// \param max_key [in] The largest key of the sequence.
+        ///
+        constexpr sort_key_range(
+            std::intmax_t min_key, std::intmax_t max_key) noexcept
+          : min_key_(min_key)
+          , max_key_(max_key)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::intmax_t get_min_key() const noexcept
+        {
+            return min_key_;
+        }
+
+        constexpr std::intmax_t get_max_key() const noexcept
+        {
+            return max_key_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::intmax_t min_key_;
+        std::intmax_t max_key_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::sort_key_range>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
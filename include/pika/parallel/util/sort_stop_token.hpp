@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/sort_stop_token.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/synchronization/stop_token.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The exception reported by \a sort, \a stable_sort, \a partial_sort
+    /// and \a nth_element (as an element of a pika::exception_list) if
+    /// they were cancelled through a \a sort_stop_token. The elements of
+    /// a cancelled algorithm are left in a valid but unspecified order.
+    struct sort_cancelled : std::runtime_error
+    {
+        sort_cancelled()
+          : std::runtime_error("the algorithm was cancelled")
+        {
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type making the parallel sorting algorithms
+    /// stop early once a stop is requested on the given stop token. The
+    /// token is checked whenever a task of the algorithm is spawned or
+    /// started (the recursion steps of \a sort, the phases of
+    /// \a stable_sort, the partitioning steps of \a nth_element and
+    /// \a partial_sort), hence a cancelled sort releases its worker threads
+    /// after at most one sequential chunk of work. The algorithm then
+    /// reports \a sort_cancelled.
+    ///
+    /// \code
+    /// pika::stop_source source;
+    /// auto f = pika::sort(pika::execution::par(pika::execution::task)
+    ///     .with(pika::execution::sort_stop_token(source.get_token())),
+    ///     v.begin(), v.end());
+    /// source.request_stop();
+    /// \endcode
+    ///
+    struct sort_stop_token
+    {
+        /// Construct a \a sort_stop_token executor parameters object
+        ///
+        /// \param token [in] The stop token the algorithm checks.
+        ///
+        explicit sort_stop_token(pika::stop_token token) noexcept
+          : token_(PIKA_MOVE(token))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        pika::stop_token const& get_stop_token() const noexcept
+        {
+            return token_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        pika::stop_token token_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::sort_stop_token>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::util::detail {
+    // Extracts the stop token from the executor parameters, the token of
+    // any other parameters can't be stopped
+    template <typename Parameters>
+    pika::stop_token get_sort_stop_token(Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::sort_stop_token>)
+        {
+            return params.get_stop_token();
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+            return pika::stop_token();
+        }
+    }
+
+    inline void throw_if_sort_stop_requested(pika::stop_token const& token)
+    {
+        if (token.stop_requested())
+        {
+            throw pika::execution::sort_cancelled();
+        }
+    }
+}    // namespace pika::parallel::util::detail
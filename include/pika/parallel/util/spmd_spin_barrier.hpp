@@ -0,0 +1,64 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/spmd_spin_barrier.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting the barrier used by
+    /// \a spmd_block::sync_all of the images launched by
+    /// \a define_spmd_block. The images arriving at the barrier spin,
+    /// doubling the pause between two checks of the barrier up to a fixed
+    /// maximum, before they yield their worker thread until the last image
+    /// arrives. This avoids suspending and resuming the images between
+    /// fine grained steps, which pays off if every image runs on a core of
+    /// its own.
+    ///
+    struct spmd_spin_barrier
+    {
+        /// Construct a \a spmd_spin_barrier executor parameters object
+        ///
+        /// \param spin_count [in] The number of pause instructions an image
+        ///               executes at most before it yields. The default
+        ///               (zero) spins for a few microseconds.
+        ///
+        constexpr explicit spmd_spin_barrier(
+            std::size_t spin_count = 0) noexcept
+          : spin_count_(spin_count)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_spin_count() const noexcept
+        {
+            return spin_count_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t spin_count_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::spmd_spin_barrier>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
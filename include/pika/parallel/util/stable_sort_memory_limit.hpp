@@ -0,0 +1,65 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/stable_sort_memory_limit.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting the bounded memory mode of
+    /// \a stable_sort. Instead of an auxiliary buffer holding half of the
+    /// sequence, the algorithm uses a buffer of at most the given number of
+    /// elements and merges the sorted runs in place (by rotating them) where
+    /// the buffer is too small. The algorithm becomes slower the smaller the
+    /// buffer is, but never requires more memory than that. If the buffer
+    /// can't be allocated, a smaller one (or none at all) is used instead of
+    /// reporting std::bad_alloc.
+    ///
+    struct stable_sort_memory_limit
+    {
+        /// Construct a \a stable_sort_memory_limit executor parameters object
+        ///
+        /// \param max_buffer_elements [in] The maximal number of elements of
+        ///               the buffer used by the algorithm. The default
+        ///               (zero) uses a buffer of sqrt(N) elements when
+        ///               sorting N elements.
+        ///
+        constexpr explicit stable_sort_memory_limit(
+            std::size_t max_buffer_elements = 0) noexcept
+          : max_buffer_elements_(max_buffer_elements)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_max_buffer_elements() const noexcept
+        {
+            return max_buffer_elements_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t max_buffer_elements_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::stable_sort_memory_limit>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
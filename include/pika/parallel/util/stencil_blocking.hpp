@@ -0,0 +1,73 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/stencil_blocking.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type setting the tiles of \a stencil. Every task
+    /// advances a tile of the grid by several time steps at once, which
+    /// requires a halo of radius times the number of time steps on either
+    /// side of the tile. The halos are updated by the tasks of both
+    /// adjacent tiles.
+    ///
+    struct stencil_blocking
+    {
+        /// Construct a \a stencil_blocking executor parameters object
+        ///
+        /// \param tile_size [in] The number of points of a tile. The
+        ///               default (zero) selects tiles whose two buffers fit
+        ///               into a cache of 256 KiB, split into smaller tiles
+        ///               if there are not enough tiles for all cores.
+        /// \param time_steps [in] The number of time steps a tile is
+        ///               advanced by at once. The default (zero) limits the
+        ///               redundant updates of the halos to an eighth of the
+        ///               points of a tile.
+        ///
+        constexpr explicit stencil_blocking(
+            std::size_t tile_size = 0, std::size_t time_steps = 0) noexcept
+          : tile_size_(tile_size)
+          , time_steps_(time_steps)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_tile_size() const noexcept
+        {
+            return tile_size_;
+        }
+
+        constexpr std::size_t get_time_steps() const noexcept
+        {
+            return time_steps_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t tile_size_;
+        std::size_t time_steps_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::stencil_blocking>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/stream_compaction.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects how the parallel stream compaction algorithms (\a copy_if,
+    /// \a remove_copy_if, \a remove_if and \a unique) remember which elements
+    /// are kept between the pass counting the kept elements of each chunk and
+    /// the pass moving them to their final position.
+    enum class stream_compaction_mode
+    {
+        /// Store one bit per element (the default)
+        flags,
+        /// Evaluate the predicate again in the second pass, this needs no
+        /// additional memory and suits cheap predicates. The in-place
+        /// algorithms (\a remove_if and \a unique) can't move the elements
+        /// of a chunk before the elements to its left have been moved, they
+        /// run sequentially in this mode.
+        recompute,
+        /// Move (or, for \a copy_if and \a unique, copy) the kept elements of
+        /// each chunk into a buffer owned by the chunk in the first pass.
+        /// This evaluates the predicate only once and reads the input only
+        /// once, which suits expensive predicates. The in-place algorithms
+        /// move the elements of all chunks to their final position in
+        /// parallel. Elements which can't be copied or moved as required
+        /// fall back to using flags.
+        staging
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting the strategy used by the parallel
+    /// stream compaction algorithms, see \a stream_compaction_mode. Inputs
+    /// which are too small to be processed in parallel are always compacted
+    /// sequentially.
+    ///
+    struct stream_compaction
+    {
+        /// Construct a \a stream_compaction executor parameters object
+        ///
+        /// \param mode [in] The strategy used by the algorithms.
+        ///
+        constexpr explicit stream_compaction(
+            stream_compaction_mode mode =
+                stream_compaction_mode::recompute) noexcept
+          : mode_(mode)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr stream_compaction_mode
+        get_stream_compaction_mode() const noexcept
+        {
+            return mode_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        stream_compaction_mode mode_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::stream_compaction>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/summation.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Selects how \a reduce and \a transform_reduce (including the binary
+    /// overloads) sum floating point values. This applies if the reduction
+    /// operation is \a std::plus<T> or \a std::plus<> and the type \a T of
+    /// the initial value is a floating point type, other reductions are not
+    /// affected.
+    enum class summation_mode
+    {
+        /// Add the values of each chunk in order and the results of the
+        /// chunks in order (the default)
+        standard,
+        /// Sum the values of each chunk with a compensated (Kahan-Babuska,
+        /// also known as Neumaier) accumulator, which carries the rounding
+        /// error of each addition along. The accumulators of the chunks are
+        /// combined including their compensation terms. The error of the
+        /// result is independent of the number of values to first order.
+        compensated,
+        /// Sum the values of each chunk along a binary tree of blocks of
+        /// consecutive values, and the results of the chunks along a binary
+        /// tree. The error of the result grows with the logarithm of the
+        /// number of values. This is cheaper than \a compensated.
+        pairwise,
+        /// Split the values into blocks of 4096 consecutive values, sum
+        /// each block pairwise and the block sums along a binary tree. The
+        /// blocks and the tree depend on the number of values only, the
+        /// result is the same for any number of cores, chunk sizes and
+        /// execution policies (sequential or parallel) used to compute it.
+        /// The error of the result is bounded as for \a pairwise. Inputs
+        /// which are not random access ranges are summed sequentially.
+        reproducible
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting how the parallel reductions sum
+    /// floating point values, see \a summation_mode. The input is still
+    /// split into chunks as specified by the other executor parameters and
+    /// the chunks are summed in parallel.
+    ///
+    /// \note The compensated summation relies on the rounding of each
+    ///       floating point operation being observable. Compiling with
+    ///       options allowing for reassociation of floating point
+    ///       operations (e.g. -ffast-math) defeats it. Results of the
+    ///       reproducible summation are bitwise identical across machines
+    ///       only if the transformation of the values and the additions
+    ///       are compiled to the same floating point operations.
+    ///
+    struct summation
+    {
+        /// Construct a \a summation executor parameters object
+        ///
+        /// \param mode [in] The way floating point values are summed.
+        ///
+        constexpr explicit summation(
+            summation_mode mode = summation_mode::compensated) noexcept
+          : mode_(mode)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr summation_mode get_summation_mode() const noexcept
+        {
+            return mode_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        summation_mode mode_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::summation> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/task_hints.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/coroutines/thread_enums.hpp>
+#include <pika/execution/scheduling_properties.hpp>
+#include <pika/properties/property.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    // The annotations below attach a scheduling property to the executor of
+    // an execution policy. All tasks an algorithm creates are run by that
+    // executor: the chunks of the partitioners, the recursion of sort, the
+    // phases of merge and stable_sort as well as the bulk operation of the
+    // algorithms sent by a predecessor sender. The annotations thus apply to
+    // the whole algorithm call, e.g. the chunks of latency critical calls
+    // are scheduled ahead of the chunks of concurrent batch calls:
+    //
+    // pika::sort(pika::execution::with_task_priority(
+    //     pika::execution::par, pika::execution::thread_priority::high),
+    //     v.begin(), v.end());
+    //
+    // Executors which do not support a property ignore it. The executor
+    // parameters of the policy are kept, chunk placing executor parameters
+    // (numa_chunk_placement, affinity_partitioner) override the scheduling
+    // hint of their chunks.
+
+    /// Returns \a policy with its executor running all tasks with the given
+    /// \a priority.
+    ///
+    // clang-format off
+    template <typename ExPolicy,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    decltype(auto) with_task_priority(
+        ExPolicy&& policy, pika::execution::thread_priority priority)
+    {
+        auto exec = pika::experimental::prefer(
+            pika::execution::experimental::with_priority, policy.executor(),
+            priority);
+        return PIKA_FORWARD(ExPolicy, policy).on(PIKA_MOVE(exec));
+    }
+
+    /// Returns \a policy with its executor running all tasks on stacks of
+    /// the given size, e.g. thread_stacksize::small_ for algorithms whose
+    /// element functions need little stack space.
+    ///
+    // clang-format off
+    template <typename ExPolicy,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    decltype(auto) with_task_stacksize(
+        ExPolicy&& policy, pika::execution::thread_stacksize stacksize)
+    {
+        auto exec = pika::experimental::prefer(
+            pika::execution::experimental::with_stacksize, policy.executor(),
+            stacksize);
+        return PIKA_FORWARD(ExPolicy, policy).on(PIKA_MOVE(exec));
+    }
+
+    /// Returns \a policy with its executor scheduling all tasks according to
+    /// the given \a hint, e.g. on the worker threads of one NUMA domain.
+    ///
+    // clang-format off
+    template <typename ExPolicy,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    decltype(auto) with_task_hint(
+        ExPolicy&& policy, pika::execution::thread_schedule_hint hint)
+    {
+        auto exec = pika::experimental::prefer(
+            pika::execution::experimental::with_hint, policy.executor(), hint);
+        return PIKA_FORWARD(ExPolicy, policy).on(PIKA_MOVE(exec));
+    }
+}    // namespace pika::execution
@@ -0,0 +1,337 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/temporary_buffer.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/synchronization/spinlock.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The size of a transparent huge page
+    inline constexpr std::size_t scratch_huge_page_size =
+        std::size_t(2) << 20;
+
+    // Scratch memory blocks of at least this size are backed by transparent
+    // huge pages where available, which reduces the TLB misses of the
+    // passes over large temporary buffers
+    inline constexpr std::size_t scratch_huge_page_threshold =
+        std::size_t(4) << 20;
+
+    // Returns uninitialized memory for bytes bytes which is released by
+    // deallocate_scratch, or nullptr on failure. Large blocks are aligned to
+    // huge page boundaries and the kernel is advised to back them by
+    // transparent huge pages (Linux only).
+    inline void* allocate_scratch(std::size_t bytes) noexcept
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (bytes >= scratch_huge_page_threshold)
+        {
+            std::size_t const size = (bytes + scratch_huge_page_size - 1) &
+                ~(scratch_huge_page_size - 1);
+            if (void* p = std::aligned_alloc(scratch_huge_page_size, size))
+            {
+                // this is only a hint, regular pages are used if it fails
+                ::madvise(p, size, MADV_HUGEPAGE);
+                return p;
+            }
+        }
+#endif
+        return std::malloc(bytes);
+    }
+
+    inline void deallocate_scratch(void* p) noexcept
+    {
+        std::free(p);
+    }
+}    // namespace pika::parallel::util::detail
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A reusable block of memory for the temporary buffers of \a stable_sort
+    /// (including the sample sort and spin sort it is built on) and
+    /// \a inplace_merge. The block grows to the largest buffer requested and
+    /// is kept until the arena is destroyed, which avoids allocating (and
+    /// faulting in) a new buffer for every call when many sequences are
+    /// sorted or merged.
+    ///
+    /// Only one algorithm can use the arena at any time, buffers requested
+    /// while the block is in use are allocated from the calling thread's
+    /// buffer cache instead.
+    ///
+    /// Blocks of 4 MiB and more are backed by transparent huge pages on
+    /// Linux. Alternatively, the arena can be constructed from a block
+    /// provided by the caller, e.g. memory mapped from a hugetlbfs file.
+    class temporary_buffer_arena
+    {
+    public:
+        /// Construct an empty arena
+        temporary_buffer_arena() = default;
+
+        /// Construct an arena initially holding a block of \a bytes bytes
+        explicit temporary_buffer_arena(std::size_t bytes)
+          : data_(detail::allocate_scratch(bytes))
+          , capacity_(data_ != nullptr ? bytes : 0)
+        {
+            if (data_ == nullptr && bytes != 0)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        /// Construct an arena using the block of \a bytes bytes at \a data,
+        /// which is not released by the arena and has to outlive it. The
+        /// block is never grown, larger buffers are allocated from the
+        /// calling thread's buffer cache instead.
+        temporary_buffer_arena(void* data, std::size_t bytes) noexcept
+          : data_(data)
+          , capacity_(data != nullptr ? bytes : 0)
+          , owns_data_(false)
+        {
+        }
+
+        temporary_buffer_arena(temporary_buffer_arena const&) = delete;
+        temporary_buffer_arena& operator=(
+            temporary_buffer_arena const&) = delete;
+
+        ~temporary_buffer_arena()
+        {
+            if (owns_data_)
+            {
+                detail::deallocate_scratch(data_);
+            }
+        }
+
+        /// Returns the size of the block held by the arena
+        std::size_t capacity() const noexcept
+        {
+            std::lock_guard<pika::spinlock> l(mtx_);
+            return capacity_;
+        }
+
+        /// \cond NOINTERNAL
+        // Returns nullptr if the block is in use or can't be grown
+        void* allocate(std::size_t bytes) noexcept
+        {
+            std::lock_guard<pika::spinlock> l(mtx_);
+            if (in_use_)
+            {
+                return nullptr;
+            }
+
+            if (capacity_ < bytes)
+            {
+                if (!owns_data_)
+                {
+                    return nullptr;
+                }
+
+                detail::deallocate_scratch(data_);
+                data_ = detail::allocate_scratch(bytes);
+                capacity_ = data_ != nullptr ? bytes : 0;
+                if (data_ == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+
+            in_use_ = true;
+            return data_;
+        }
+
+        // Returns false if p has not been allocated from this arena
+        bool deallocate(void* p) noexcept
+        {
+            std::lock_guard<pika::spinlock> l(mtx_);
+            if (p == nullptr || p != data_)
+            {
+                return false;
+            }
+            in_use_ = false;
+            return true;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        mutable pika::spinlock mtx_;
+        void* data_ = nullptr;
+        std::size_t capacity_ = 0;
+        bool in_use_ = false;
+        bool owns_data_ = true;
+        /// \endcond
+    };
+}    // namespace pika::parallel::util
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type making \a stable_sort and \a inplace_merge
+    /// take their temporary buffer from the given \a temporary_buffer_arena.
+    /// Without it, the temporary buffers are recycled through a cache local
+    /// to each OS thread.
+    ///
+    /// \note The arena has to outlive all algorithms using it.
+    ///
+    struct temporary_buffer
+    {
+        /// Construct a \a temporary_buffer executor parameters object
+        ///
+        /// \param arena [in] The arena the temporary buffers are taken from.
+        ///
+        constexpr explicit temporary_buffer(
+            pika::parallel::util::temporary_buffer_arena& arena) noexcept
+          : arena_(&arena)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr pika::parallel::util::temporary_buffer_arena*
+        get_temporary_buffer_arena() const noexcept
+        {
+            return arena_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        pika::parallel::util::temporary_buffer_arena* arena_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::temporary_buffer>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::util::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // buffers larger than this are not kept in the per thread cache
+    inline constexpr std::size_t temporary_buffer_cache_limit =
+        std::size_t(16) << 20;
+
+    // Every buffer which is not taken from an arena is preceded by a header
+    // recording its capacity, which allows a buffer to be released on a
+    // different OS thread than the one it has been allocated on.
+    struct alignas(std::max_align_t) temporary_buffer_header
+    {
+        std::size_t capacity;
+    };
+
+    // Holds the largest buffer released on this OS thread for reuse by the
+    // next allocation which fits into it.
+    struct temporary_buffer_cache
+    {
+        temporary_buffer_cache() = default;
+        temporary_buffer_cache(temporary_buffer_cache const&) = delete;
+        temporary_buffer_cache& operator=(
+            temporary_buffer_cache const&) = delete;
+
+        ~temporary_buffer_cache()
+        {
+            deallocate_scratch(block_);
+        }
+
+        temporary_buffer_header* block_ = nullptr;
+    };
+
+    inline temporary_buffer_cache& get_temporary_buffer_cache() noexcept
+    {
+        thread_local temporary_buffer_cache cache;
+        return cache;
+    }
+
+    // Returns uninitialized memory for at least bytes bytes, throws
+    // std::bad_alloc on failure
+    inline void* allocate_temporary_buffer(
+        std::size_t bytes, temporary_buffer_arena* arena = nullptr)
+    {
+        if (arena != nullptr)
+        {
+            if (void* p = arena->allocate(bytes))
+            {
+                return p;
+            }
+        }
+
+        auto& cache = get_temporary_buffer_cache();
+        temporary_buffer_header* block = cache.block_;
+        if (block != nullptr && block->capacity >= bytes)
+        {
+            cache.block_ = nullptr;
+        }
+        else
+        {
+            block = static_cast<temporary_buffer_header*>(
+                allocate_scratch(sizeof(temporary_buffer_header) + bytes));
+            if (block == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            block->capacity = bytes;
+        }
+        return block + 1;
+    }
+
+    inline void deallocate_temporary_buffer(
+        void* p, temporary_buffer_arena* arena = nullptr) noexcept
+    {
+        if (p == nullptr || (arena != nullptr && arena->deallocate(p)))
+        {
+            return;
+        }
+
+        auto* block = static_cast<temporary_buffer_header*>(p) - 1;
+        auto& cache = get_temporary_buffer_cache();
+        if (block->capacity <= temporary_buffer_cache_limit &&
+            (cache.block_ == nullptr ||
+                cache.block_->capacity < block->capacity))
+        {
+            deallocate_scratch(cache.block_);
+            cache.block_ = block;
+        }
+        else
+        {
+            deallocate_scratch(block);
+        }
+    }
+
+    // Extracts the arena from the executor parameters, if any
+    template <typename Parameters>
+    constexpr temporary_buffer_arena* get_temporary_buffer_arena(
+        Parameters const& params) noexcept
+    {
+        if constexpr (std::is_same_v<Parameters,
+                          pika::execution::temporary_buffer>)
+        {
+            return params.get_temporary_buffer_arena();
+        }
+        else
+        {
+            PIKA_UNUSED(params);
+            return nullptr;
+        }
+    }
+}    // namespace pika::parallel::util::detail
@@ -7,9 +7,12 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
 #include <pika/algorithms/traits/pointer_category.hpp>
 #include <pika/functional/detail/tag_fallback_invoke.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
 #include <pika/parallel/util/result_types.hpp>
 
 #include <algorithm>
@@ -54,11 +57,11 @@ namespace pika::parallel::detail {
     PIKA_FORCEINLINE std::enable_if_t<!std::is_pointer<Iter>::value, char*>
     to_ptr(Iter ptr) noexcept
     {
-        static_assert(pika::traits::is_contiguous_iterator_v<Iter>,
+        static_assert(pika::detail::is_contiguous_iterator_v<Iter>,
             "optimized copy/move is possible for contiguous-iterators "
             "only");
 
-        return const_cast<char*>(reinterpret_cast<char volatile const*>(&*ptr));
+        return to_ptr(pika::detail::to_address(ptr));
     }
 
     template <typename Iter>
@@ -66,12 +69,11 @@ namespace pika::parallel::detail {
         std::enable_if_t<!std::is_pointer<Iter>::value, char const*>
         to_const_ptr(Iter ptr) noexcept
     {
-        static_assert(pika::traits::is_contiguous_iterator_v<Iter>,
+        static_assert(pika::detail::is_contiguous_iterator_v<Iter>,
             "optimized copy/move is possible for contiguous-iterators "
             "only");
 
-        return const_cast<char const*>(
-            reinterpret_cast<char volatile const*>(&*ptr));
+        return to_const_ptr(pika::detail::to_address(ptr));
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -92,6 +94,65 @@ namespace pika::parallel::detail {
             PIKA_MOVE(first), PIKA_MOVE(dest)};
     }
 
+    // Same as copy_memmove, but the destination is written with
+    // non-temporal stores
+    template <typename InIter, typename OutIter>
+    in_out_result<InIter, OutIter>
+    copy_non_temporal(InIter first, std::size_t count, OutIter dest)
+    {
+        using data_type = typename std::iterator_traits<InIter>::value_type;
+
+        if (count != 0)
+        {
+            non_temporal_copy_bytes(
+                to_ptr(dest), to_const_ptr(first), count * sizeof(data_type));
+        }
+
+        std::advance(first, count);
+        std::advance(dest, count);
+        return in_out_result<InIter, OutIter>{
+            PIKA_MOVE(first), PIKA_MOVE(dest)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // Elements are transferred between segmented iterators (e.g. into or out
+    // of a std::deque) one contiguous block at a time if they could be
+    // copied by std::memmove, see pika::traits::contiguous_segments.
+    template <typename InIter, typename OutIter, bool Move = false>
+    inline constexpr bool is_segmented_memmove_v =
+        pika::detail::iterators_are_segmented_v<InIter, OutIter> &&
+        std::is_trivially_assignable_v<pika::traits::iter_ref_t<OutIter>,
+            std::conditional_t<Move,
+                std::remove_reference_t<pika::traits::iter_ref_t<InIter>>,
+                pika::traits::iter_ref_t<InIter>>> &&
+        std::is_same_v<typename pika::detail::pointer_category_helper<
+                           pika::traits::iter_value_t<InIter>,
+                           pika::traits::iter_value_t<OutIter>>::type,
+            pika::detail::trivially_copyable_pointer_tag>;
+
+    template <typename InIter, typename OutIter>
+    in_out_result<InIter, OutIter>
+    copy_segmented(InIter first, std::size_t count, OutIter dest)
+    {
+        using data_type = typename std::iterator_traits<InIter>::value_type;
+
+        while (count != 0)
+        {
+            std::size_t const n = pika::detail::contiguous_segment_size(dest,
+                pika::detail::contiguous_segment_size(first, count));
+
+            std::memmove(to_ptr(pika::detail::to_address(dest)),
+                to_const_ptr(pika::detail::to_address(first)),
+                n * sizeof(data_type));
+
+            std::advance(first, n);
+            std::advance(dest, n);
+            count -= n;
+        }
+        return in_out_result<InIter, OutIter>{
+            PIKA_MOVE(first), PIKA_MOVE(dest)};
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // Customization point for optimizing copy operations
     template <typename Category, typename Enable>
@@ -184,7 +245,36 @@ namespace pika::parallel::detail {
                 std::decay_t<
                     pika::detail::remove_const_iterator_value_type_t<InIter>>,
                 std::decay_t<OutIter>>;
-            return copy_n_helper<category>::call(first, count, dest);
+
+            // the executor parameters may ask for the destination to be
+            // written around the caches
+            if constexpr (use_non_temporal_stores_v<ExPolicy> &&
+                std::is_same_v<category,
+                    pika::detail::trivially_copyable_pointer_tag>)
+            {
+                return copy_non_temporal(first, count, dest);
+            }
+            else if constexpr (is_segmented_memmove_v<InIter, OutIter>)
+            {
+                return copy_segmented(first, count, dest);
+            }
+            else if constexpr (pika::detail::iterators_are_segmented_v<InIter,
+                                   OutIter>)
+            {
+                // other elements are assigned one block at a time through
+                // pointers
+                auto r = pika::detail::for_each_contiguous_segment(first,
+                    count, dest,
+                    [](auto* segment, std::size_t size, auto* dest_segment) {
+                        copy_n_t<ExPolicy>{}(segment, size, dest_segment);
+                    });
+                return in_out_result<InIter, OutIter>{
+                    PIKA_MOVE(r.first), PIKA_MOVE(r.second)};
+            }
+            else
+            {
+                return copy_n_helper<category>::call(first, count, dest);
+            }
         }
     };
 
@@ -306,9 +396,26 @@ namespace pika::parallel::detail {
     PIKA_FORCEINLINE constexpr in_out_result<InIter, OutIter>
     move_n(InIter first, std::size_t count, OutIter dest)
     {
-        using category =
-            pika::detail::pointer_move_category_t<std::decay_t<InIter>,
-                std::decay_t<OutIter>>;
-        return move_n_helper<category>::call(first, count, dest);
+        if constexpr (is_segmented_memmove_v<InIter, OutIter, true>)
+        {
+            return copy_segmented(first, count, dest);
+        }
+        else if constexpr (pika::detail::iterators_are_segmented_v<InIter,
+                               OutIter>)
+        {
+            auto r = pika::detail::for_each_contiguous_segment(first, count,
+                dest, [](auto* segment, std::size_t size, auto* dest_segment) {
+                    move_n(segment, size, dest_segment);
+                });
+            return in_out_result<InIter, OutIter>{
+                PIKA_MOVE(r.first), PIKA_MOVE(r.second)};
+        }
+        else
+        {
+            using category =
+                pika::detail::pointer_move_category_t<std::decay_t<InIter>,
+                    std::decay_t<OutIter>>;
+            return move_n_helper<category>::call(first, count, dest);
+        }
     }
 }    // namespace pika::parallel::detail
@@ -7,9 +7,13 @@
 #pragma once
 
 #include <pika/config.hpp>
+#include <pika/algorithms/traits/contiguous_segments.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/functional/detail/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
+#include <pika/parallel/util/detail/non_temporal_stores.hpp>
 #include <pika/parallel/util/result_types.hpp>
 
 #include <algorithm>
@@ -20,6 +24,13 @@
 #include <utility>
 
 namespace pika::parallel::detail {
+    // The transformations which write their results with non-temporal
+    // stores, the input sequences have to be random access
+    template <typename ExPolicy, typename OutIter, typename... Iters>
+    inline constexpr bool use_non_temporal_transform_v =
+        use_non_temporal_stores_for_v<ExPolicy, OutIter> &&
+        (pika::traits::is_random_access_iterator_v<Iters> && ...);
+
     template <typename Iter>
     struct transform_loop_impl
     {
@@ -47,11 +58,38 @@ namespace pika::parallel::detail {
             typename OutIter, typename F>
         friend PIKA_HOST_DEVICE
             PIKA_FORCEINLINE constexpr in_out_result<IterB, OutIter>
-            tag_fallback_invoke(transform_loop_t, ExPolicy&&, IterB it,
-                IterE end, OutIter dest, F&& f)
+            tag_fallback_invoke(transform_loop_t,
+                [[maybe_unused]] ExPolicy&& policy, IterB it, IterE end,
+                OutIter dest, F&& f)
         {
-            return transform_loop_impl<IterB>::call(
-                it, end, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              IterB>)
+            {
+                std::size_t const count = detail::distance(it, end);
+                dest = non_temporal_generate(dest, count,
+                    [&](std::size_t i) { return PIKA_INVOKE(f, it + i); });
+                return in_out_result<IterB, OutIter>{
+                    it + count, PIKA_MOVE(dest)};
+            }
+            else if constexpr (pika::detail::iterators_are_segmented_v<IterB,
+                                   OutIter> &&
+                std::is_same_v<IterB, IterE>)
+            {
+                // transform the blocks of segmented iterators one by one
+                auto r = pika::detail::for_each_contiguous_segment(it,
+                    detail::distance(it, end), dest,
+                    [&](auto* segment, std::size_t size, auto* dest_segment) {
+                        transform_loop_t{}(
+                            policy, segment, segment + size, dest_segment, f);
+                    });
+                return in_out_result<IterB, OutIter>{
+                    PIKA_MOVE(r.first), PIKA_MOVE(r.second)};
+            }
+            else
+            {
+                return transform_loop_impl<IterB>::call(
+                    it, end, dest, PIKA_FORWARD(F, f));
+            }
         }
     };
 
@@ -95,11 +133,37 @@ namespace pika::parallel::detail {
             typename OutIter, typename F>
         friend PIKA_HOST_DEVICE
             PIKA_FORCEINLINE constexpr in_out_result<IterB, OutIter>
-            tag_fallback_invoke(transform_loop_ind_t, ExPolicy&&, IterB it,
-                IterE end, OutIter dest, F&& f)
+            tag_fallback_invoke(transform_loop_ind_t,
+                [[maybe_unused]] ExPolicy&& policy, IterB it, IterE end,
+                OutIter dest, F&& f)
         {
-            return transform_loop_ind_impl<IterB>::call(
-                it, end, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              IterB>)
+            {
+                std::size_t const count = detail::distance(it, end);
+                dest = non_temporal_generate(dest, count,
+                    [&](std::size_t i) { return PIKA_INVOKE(f, it[i]); });
+                return in_out_result<IterB, OutIter>{
+                    it + count, PIKA_MOVE(dest)};
+            }
+            else if constexpr (pika::detail::iterators_are_segmented_v<IterB,
+                                   OutIter> &&
+                std::is_same_v<IterB, IterE>)
+            {
+                auto r = pika::detail::for_each_contiguous_segment(it,
+                    detail::distance(it, end), dest,
+                    [&](auto* segment, std::size_t size, auto* dest_segment) {
+                        transform_loop_ind_t{}(
+                            policy, segment, segment + size, dest_segment, f);
+                    });
+                return in_out_result<IterB, OutIter>{
+                    PIKA_MOVE(r.first), PIKA_MOVE(r.second)};
+            }
+            else
+            {
+                return transform_loop_ind_impl<IterB>::call(
+                    it, end, dest, PIKA_FORWARD(F, f));
+            }
         }
     };
 
@@ -172,8 +236,22 @@ namespace pika::parallel::detail {
                 InIter1B first1, InIter1E last1, InIter2 first2, OutIter dest,
                 F&& f)
         {
-            return transform_binary_loop_impl<InIter1B, InIter2>::call(
-                first1, last1, first2, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              InIter1B, InIter2>)
+            {
+                std::size_t const count = detail::distance(first1, last1);
+                dest = non_temporal_generate(
+                    dest, count, [&](std::size_t i) {
+                        return PIKA_INVOKE(f, first1 + i, first2 + i);
+                    });
+                return in_in_out_result<InIter1B, InIter2, OutIter>{
+                    first1 + count, first2 + count, PIKA_MOVE(dest)};
+            }
+            else
+            {
+                return transform_binary_loop_impl<InIter1B, InIter2>::call(
+                    first1, last1, first2, dest, PIKA_FORWARD(F, f));
+            }
         }
 
         template <typename InIter1B, typename InIter1E, typename InIter2B,
@@ -272,8 +350,23 @@ namespace pika::parallel::detail {
                 InIter1B first1, InIter1E last1, InIter2 first2, OutIter dest,
                 F&& f)
         {
-            return transform_binary_loop_ind_impl<InIter1B, InIter2>::call(
-                first1, last1, first2, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              InIter1B, InIter2>)
+            {
+                std::size_t const count = detail::distance(first1, last1);
+                dest = non_temporal_generate(
+                    dest, count, [&](std::size_t i) {
+                        return PIKA_INVOKE(f, first1[i], first2[i]);
+                    });
+                return in_in_out_result<InIter1B, InIter2, OutIter>{
+                    first1 + count, first2 + count, PIKA_MOVE(dest)};
+            }
+            else
+            {
+                return transform_binary_loop_ind_impl<InIter1B,
+                    InIter2>::call(first1, last1, first2, dest,
+                    PIKA_FORWARD(F, f));
+            }
         }
 
         template <typename InIter1B, typename InIter1E, typename InIter2B,
@@ -396,10 +489,30 @@ namespace pika::parallel::detail {
             tag_fallback_invoke(transform_loop_n_t<ExPolicy>, Iter it,
                 std::size_t count, OutIter dest, F&& f)
         {
-            using pred = pika::traits::is_random_access_iterator<Iter>;
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              Iter>)
+            {
+                dest = non_temporal_generate(dest, count,
+                    [&](std::size_t i) { return PIKA_INVOKE(f, it + i); });
+                return std::make_pair(it + count, PIKA_MOVE(dest));
+            }
+            else if constexpr (pika::detail::iterators_are_segmented_v<Iter,
+                                   OutIter>)
+            {
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    dest,
+                    [&](auto* segment, std::size_t size, auto* dest_segment) {
+                        transform_loop_n_t<ExPolicy>{}(
+                            segment, size, dest_segment, f);
+                    });
+            }
+            else
+            {
+                using pred = pika::traits::is_random_access_iterator<Iter>;
 
-            return transform_loop_n_impl<Iter>::call(
-                it, count, dest, PIKA_FORWARD(F, f), pred());
+                return transform_loop_n_impl<Iter>::call(
+                    it, count, dest, PIKA_FORWARD(F, f), pred());
+            }
         }
     };
 
@@ -495,10 +608,30 @@ namespace pika::parallel::detail {
             tag_fallback_invoke(transform_loop_n_ind_t<ExPolicy>, Iter it,
                 std::size_t count, OutIter dest, F&& f)
         {
-            using pred = pika::traits::is_random_access_iterator<Iter>;
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              Iter>)
+            {
+                dest = non_temporal_generate(dest, count,
+                    [&](std::size_t i) { return PIKA_INVOKE(f, it[i]); });
+                return std::make_pair(it + count, PIKA_MOVE(dest));
+            }
+            else if constexpr (pika::detail::iterators_are_segmented_v<Iter,
+                                   OutIter>)
+            {
+                return pika::detail::for_each_contiguous_segment(it, count,
+                    dest,
+                    [&](auto* segment, std::size_t size, auto* dest_segment) {
+                        transform_loop_n_ind_t<ExPolicy>{}(
+                            segment, size, dest_segment, f);
+                    });
+            }
+            else
+            {
+                using pred = pika::traits::is_random_access_iterator<Iter>;
 
-            return transform_loop_n_ind_impl<Iter>::call(
-                it, count, dest, PIKA_FORWARD(F, f), pred());
+                return transform_loop_n_ind_impl<Iter>::call(
+                    it, count, dest, PIKA_FORWARD(F, f), pred());
+            }
         }
     };
 
@@ -559,8 +692,21 @@ namespace pika::parallel::detail {
                 InIter1 first1, std::size_t count, InIter2 first2, OutIter dest,
                 F&& f)
         {
-            return transform_binary_loop_n_impl<InIter1, InIter2>::call(
-                first1, count, first2, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              InIter1, InIter2>)
+            {
+                dest = non_temporal_generate(
+                    dest, count, [&](std::size_t i) {
+                        return PIKA_INVOKE(f, first1 + i, first2 + i);
+                    });
+                return std::make_tuple(
+                    first1 + count, first2 + count, PIKA_MOVE(dest));
+            }
+            else
+            {
+                return transform_binary_loop_n_impl<InIter1, InIter2>::call(
+                    first1, count, first2, dest, PIKA_FORWARD(F, f));
+            }
         }
     };
 
@@ -624,8 +770,22 @@ namespace pika::parallel::detail {
                 InIter1 first1, std::size_t count, InIter2 first2, OutIter dest,
                 F&& f)
         {
-            return transform_binary_loop_ind_n_impl<InIter1, InIter2>::call(
-                first1, count, first2, dest, PIKA_FORWARD(F, f));
+            if constexpr (use_non_temporal_transform_v<ExPolicy, OutIter,
+                              InIter1, InIter2>)
+            {
+                dest = non_temporal_generate(
+                    dest, count, [&](std::size_t i) {
+                        return PIKA_INVOKE(f, first1[i], first2[i]);
+                    });
+                return std::make_tuple(
+                    first1 + count, first2 + count, PIKA_MOVE(dest));
+            }
+            else
+            {
+                return transform_binary_loop_ind_n_impl<InIter1,
+                    InIter2>::call(first1, count, first2, dest,
+                    PIKA_FORWARD(F, f));
+            }
         }
     };
 
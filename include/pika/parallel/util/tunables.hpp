@@ -0,0 +1,254 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/tunables.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <atomic>
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The thresholds of the algorithms which can be tuned at runtime.
+    enum class tunable : std::size_t
+    {
+        /// The smallest number of elements sort and partial_sort sort in a
+        /// separate task, smaller ranges are sorted sequentially.
+        sort_limit_per_task,
+        /// The smallest number of elements stable_sort sorts in a separate
+        /// task.
+        stable_sort_limit_per_task,
+        /// The default number of elements sample_sort sorts in a separate
+        /// task.
+        sample_sort_limit_per_task,
+        /// Ranges up to this size are merged sequentially by inplace_merge,
+        /// and blocks up to this size are rotated sequentially.
+        inplace_merge_threshold,
+        /// The number of cores used by the algorithms bound by the memory
+        /// bandwidth when invoked with the default constructed
+        /// bandwidth_limit executor parameters, 0 uses all cores. See
+        /// calibrate_bandwidth_limit.
+        bandwidth_bound_cores,
+    };
+
+    /// The number of values of \a tunable.
+    inline constexpr std::size_t num_tunables = 5;
+
+    namespace detail {
+        struct tunable_info
+        {
+            char const* name;
+            std::size_t default_value;
+            std::size_t minimum;
+        };
+
+        // indexed by tunable, the minimum keeps the algorithms correct
+        inline constexpr tunable_info tunable_infos[num_tunables] = {
+            {"sort_limit_per_task", 65536, 1},
+            {"stable_sort_limit_per_task", 65536, 1},
+            {"sample_sort_limit_per_task", 65536, 1},
+            {"inplace_merge_threshold", 65536, 5},
+            {"bandwidth_bound_cores", 0, 0},
+        };
+
+        // Parses a flat json object of names and non-negative integers,
+        // returns false if the text is malformed.
+        inline bool parse_tunables(std::istream& is,
+            std::vector<std::pair<std::string, std::size_t>>& values)
+        {
+            std::string const text((std::istreambuf_iterator<char>(is)),
+                std::istreambuf_iterator<char>());
+            std::size_t pos = 0;
+
+            auto skip_space = [&]() {
+                while (pos != text.size() &&
+                    std::isspace(static_cast<unsigned char>(text[pos])))
+                {
+                    ++pos;
+                }
+            };
+            auto expect = [&](char c) {
+                skip_space();
+                if (pos == text.size() || text[pos] != c)
+                    return false;
+                ++pos;
+                return true;
+            };
+
+            if (!expect('{'))
+                return false;
+            if (expect('}'))
+                return true;
+
+            do
+            {
+                if (!expect('"'))
+                    return false;
+                std::size_t const end = text.find('"', pos);
+                if (end == std::string::npos)
+                    return false;
+                std::string name = text.substr(pos, end - pos);
+                pos = end + 1;
+
+                if (!expect(':'))
+                    return false;
+                skip_space();
+                std::size_t const digits = pos;
+                while (pos != text.size() &&
+                    std::isdigit(static_cast<unsigned char>(text[pos])))
+                {
+                    ++pos;
+                }
+                // larger values do not fit into std::size_t
+                if (pos == digits || pos - digits > 18)
+                    return false;
+
+                values.emplace_back(PIKA_MOVE(name),
+                    std::strtoull(text.c_str() + digits, nullptr, 10));
+            } while (expect(','));
+
+            return expect('}');
+        }
+
+        struct tunables_registry
+        {
+            tunables_registry()
+            {
+                for (std::size_t i = 0; i != num_tunables; ++i)
+                {
+                    values_[i].store(tunable_infos[i].default_value,
+                        std::memory_order_relaxed);
+                }
+
+                // a profile can be loaded without recompiling the
+                // application by naming the file it is read from, the
+                // defaults are kept if it can not be read
+                if (char const* file = std::getenv("PIKA_TUNABLES"))
+                {
+                    std::ifstream in(file);
+                    std::vector<std::pair<std::string, std::size_t>> values;
+                    if (in && parse_tunables(in, values))
+                        set(values);
+                }
+            }
+
+            void set(std::size_t i, std::size_t value) noexcept
+            {
+                if (value < tunable_infos[i].minimum)
+                    value = tunable_infos[i].minimum;
+                values_[i].store(value, std::memory_order_relaxed);
+            }
+
+            // unknown names are ignored, profiles written by other versions
+            // can be read
+            void set(std::vector<std::pair<std::string, std::size_t>> const&
+                    values) noexcept
+            {
+                for (auto const& [name, value] : values)
+                {
+                    for (std::size_t i = 0; i != num_tunables; ++i)
+                    {
+                        if (name == tunable_infos[i].name)
+                            set(i, value);
+                    }
+                }
+            }
+
+            std::atomic<std::size_t> values_[num_tunables];
+        };
+
+        inline tunables_registry& get_tunables_registry()
+        {
+            static tunables_registry registry;
+            return registry;
+        }
+    }    // namespace detail
+
+    /// Returns the name of the given tunable as used in profiles.
+    constexpr char const* get_tunable_name(tunable t) noexcept
+    {
+        return detail::tunable_infos[static_cast<std::size_t>(t)].name;
+    }
+
+    /// Returns the compile-time default of the given tunable.
+    constexpr std::size_t get_tunable_default(tunable t) noexcept
+    {
+        return detail::tunable_infos[static_cast<std::size_t>(t)]
+            .default_value;
+    }
+
+    /// Returns the current value of the given tunable. The values are the
+    /// compile-time defaults, unless the environment variable PIKA_TUNABLES
+    /// names a profile which is read on first use, or they are changed by
+    /// \a set_tunable, \a read_tunables or \a calibrate_tunables.
+    inline std::size_t get_tunable(tunable t) noexcept
+    {
+        return detail::get_tunables_registry()
+            .values_[static_cast<std::size_t>(t)]
+            .load(std::memory_order_relaxed);
+    }
+
+    /// Sets the value of the given tunable, values below the smallest value
+    /// supported by the algorithm are raised to it. Algorithms running
+    /// concurrently see either the old or the new value.
+    inline void set_tunable(tunable t, std::size_t value) noexcept
+    {
+        detail::get_tunables_registry().set(
+            static_cast<std::size_t>(t), value);
+    }
+
+    /// Resets all tunables to their compile-time defaults.
+    inline void reset_tunables() noexcept
+    {
+        for (std::size_t i = 0; i != num_tunables; ++i)
+        {
+            detail::get_tunables_registry().set(
+                i, detail::tunable_infos[i].default_value);
+        }
+    }
+
+    /// Reads a profile written by \a write_tunables, a json object mapping
+    /// the names of the tunables to their values, e.g.
+    ///
+    ///     { "sort_limit_per_task" : 32768 }
+    ///
+    /// Tunables missing from the profile keep their values, unknown names
+    /// are ignored. Returns false and changes nothing if the profile is
+    /// malformed.
+    inline bool read_tunables(std::istream& is)
+    {
+        std::vector<std::pair<std::string, std::size_t>> values;
+        if (!detail::parse_tunables(is, values))
+            return false;
+        detail::get_tunables_registry().set(values);
+        return true;
+    }
+
+    /// Writes the current values of all tunables as a profile.
+    inline void write_tunables(std::ostream& os)
+    {
+        os << "{";
+        for (std::size_t i = 0; i != num_tunables; ++i)
+        {
+            os << (i ? ",\n" : "\n") << "  \""
+               << detail::tunable_infos[i].name
+               << "\" : " << get_tunable(static_cast<tunable>(i));
+        }
+        os << "\n}\n";
+    }
+}    // namespace pika::parallel::util
@@ -66,7 +66,9 @@ namespace pika::parallel::traits::detail {
     };
 }    // namespace pika::parallel::traits::detail
 
-#if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_alignment_size.hpp>
+#elif !defined(__CUDACC__)
 #include <pika/parallel/util/detail/simd/vector_pack_alignment_size.hpp>
 #endif
 
@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace pika::parallel::traits::detail {
+    // The complex numbers whose ranges the datapar algorithms process in
+    // packs, their parts are laid out as T[2] (see [complex.numbers]).
+    template <typename T>
+    inline constexpr bool is_vector_pack_complex_v = false;
+
+    template <>
+    inline constexpr bool is_vector_pack_complex_v<std::complex<float>> = true;
+
+    template <>
+    inline constexpr bool is_vector_pack_complex_v<std::complex<double>> =
+        true;
+}    // namespace pika::parallel::traits::detail
+
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/parallel/util/vector_pack_reduce.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+namespace pika::parallel::traits::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // A pack of complex numbers stored as a pack of the real parts and a pack
+    // of the imaginary parts, such that the arithmetic is done with whole
+    // packs of V. The datapar algorithms deinterleave ranges of std::complex
+    // into complex packs when loading them and interleave the parts again
+    // when storing them, the functions passed to the algorithms are invoked
+    // with complex packs instead of packs of std::complex.
+    //
+    // Multiplication and division use the textbook formulas, as std::complex
+    // does with -fcx-limited-range: they do not recover infinite results from
+    // operations producing NaN parts.
+    template <typename V>
+    struct complex_pack
+    {
+        using real_pack_type = V;
+        using real_type = typename V::value_type;
+        using value_type = std::complex<real_type>;
+
+        V re;
+        V im;
+
+        complex_pack() = default;
+
+        PIKA_HOST_DEVICE constexpr complex_pack(V r, V i)
+          : re(r)
+          , im(i)
+        {
+        }
+
+        // broadcast, such that complex packs can be combined with scalars
+        PIKA_HOST_DEVICE constexpr complex_pack(value_type const& value)
+          : re(value.real())
+          , im(value.imag())
+        {
+        }
+
+        static constexpr std::size_t size() noexcept
+        {
+            return V::size();
+        }
+
+        PIKA_HOST_DEVICE value_type operator[](std::size_t i) const
+        {
+            return value_type(re[i], im[i]);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        friend PIKA_HOST_DEVICE complex_pack operator+(complex_pack const& z)
+        {
+            return z;
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator-(complex_pack const& z)
+        {
+            return complex_pack(-z.re, -z.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator+(
+            complex_pack const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs.re + rhs.re, lhs.im + rhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator-(
+            complex_pack const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs.re - rhs.re, lhs.im - rhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator*(
+            complex_pack const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs.re * rhs.re - lhs.im * rhs.im,
+                lhs.re * rhs.im + lhs.im * rhs.re);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator/(
+            complex_pack const& lhs, complex_pack const& rhs)
+        {
+            V const denom = rhs.re * rhs.re + rhs.im * rhs.im;
+            return complex_pack((lhs.re * rhs.re + lhs.im * rhs.im) / denom,
+                (lhs.im * rhs.re - lhs.re * rhs.im) / denom);
+        }
+
+        // combinations with packs of real numbers, or with real numbers
+        // which are broadcast to packs
+        friend PIKA_HOST_DEVICE complex_pack operator+(
+            complex_pack const& lhs, V const& rhs)
+        {
+            return complex_pack(lhs.re + rhs, lhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator+(
+            V const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs + rhs.re, rhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator-(
+            complex_pack const& lhs, V const& rhs)
+        {
+            return complex_pack(lhs.re - rhs, lhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator-(
+            V const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs - rhs.re, -rhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator*(
+            complex_pack const& lhs, V const& rhs)
+        {
+            return complex_pack(lhs.re * rhs, lhs.im * rhs);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator*(
+            V const& lhs, complex_pack const& rhs)
+        {
+            return complex_pack(lhs * rhs.re, lhs * rhs.im);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack operator/(
+            complex_pack const& lhs, V const& rhs)
+        {
+            return complex_pack(lhs.re / rhs, lhs.im / rhs);
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack& operator+=(
+            complex_pack& lhs, complex_pack const& rhs)
+        {
+            return lhs = lhs + rhs;
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack& operator-=(
+            complex_pack& lhs, complex_pack const& rhs)
+        {
+            return lhs = lhs - rhs;
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack& operator*=(
+            complex_pack& lhs, complex_pack const& rhs)
+        {
+            return lhs = lhs * rhs;
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack& operator/=(
+            complex_pack& lhs, complex_pack const& rhs)
+        {
+            return lhs = lhs / rhs;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the lane-wise counterparts of the functions of <complex>, found by
+        // argument dependent lookup
+        friend PIKA_HOST_DEVICE V real(complex_pack const& z)
+        {
+            return z.re;
+        }
+
+        friend PIKA_HOST_DEVICE V imag(complex_pack const& z)
+        {
+            return z.im;
+        }
+
+        friend PIKA_HOST_DEVICE complex_pack conj(complex_pack const& z)
+        {
+            return complex_pack(z.re, -z.im);
+        }
+
+        friend PIKA_HOST_DEVICE V norm(complex_pack const& z)
+        {
+            return z.re * z.re + z.im * z.im;
+        }
+    };
+
+    template <typename T>
+    inline constexpr bool is_complex_pack_v = false;
+
+    template <typename V>
+    inline constexpr bool is_complex_pack_v<complex_pack<V>> = true;
+
+    // The complex pack holding N (or the native number of) elements of the
+    // complex type T
+    template <typename T, std::size_t N = 0>
+    struct complex_pack_type
+    {
+        using type = complex_pack<
+            typename vector_pack_type<typename T::value_type, N>::type>;
+    };
+
+    template <typename T, std::size_t N = 0>
+    using complex_pack_type_t = typename complex_pack_type<T, N>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Load the size() elements starting at p, deinterleaving their parts
+    template <typename CP>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE CP complex_pack_load(
+        typename CP::value_type const* p)
+    {
+        using V = typename CP::real_pack_type;
+        using real_type = typename CP::real_type;
+
+        auto const* parts = reinterpret_cast<real_type const*>(p);
+        return CP(V([&](auto i) { return parts[2 * i]; }),
+            V([&](auto i) { return parts[2 * i + 1]; }));
+    }
+
+    // Store the lanes of value to the elements starting at dest. Complex
+    // packs are interleaved again, packs of real numbers (e.g. returned by
+    // norm) are stored lane by lane.
+    template <typename Pack, typename T>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void complex_pack_store(
+        Pack const& value, T* dest)
+    {
+        if constexpr (is_complex_pack_v<Pack> && is_vector_pack_complex_v<T>)
+        {
+            auto* parts = reinterpret_cast<typename T::value_type*>(dest);
+            for (std::size_t i = 0; i != value.size(); ++i)
+            {
+                parts[2 * i] = value.re[i];
+                parts[2 * i + 1] = value.im[i];
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i != value.size(); ++i)
+            {
+                dest[i] = T(value[i]);
+            }
+        }
+    }
+
+    // Sum the lanes of a complex pack
+    template <typename V>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE typename complex_pack<V>::value_type
+    reduce_sum(complex_pack<V> const& value)
+    {
+        return typename complex_pack<V>::value_type(
+            reduce(value.re, std::plus<>()), reduce(value.im, std::plus<>()));
+    }
+}    // namespace pika::parallel::traits::detail
+#endif
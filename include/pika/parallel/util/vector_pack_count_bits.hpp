@@ -20,7 +20,9 @@ namespace pika::parallel::traits::detail {
 
 #if defined(PIKA_HAVE_DATAPAR)
 
-#if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_count_bits.hpp>
+#elif !defined(__CUDACC__)
 #include <pika/parallel/util/detail/simd/vector_pack_count_bits.hpp>
 #endif
 
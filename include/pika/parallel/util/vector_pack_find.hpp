@@ -10,7 +10,9 @@
 
 #if defined(PIKA_HAVE_DATAPAR)
 
-#if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_find.hpp>
+#elif !defined(__CUDACC__)
 #include <pika/parallel/util/detail/simd/vector_pack_find.hpp>
 #endif
 
@@ -9,6 +9,8 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_HAVE_DATAPAR)
+#include <cstddef>
+#include <type_traits>
 
 namespace pika::parallel::traits::detail {
     template <typename V, typename NewT>
@@ -20,9 +22,73 @@ namespace pika::parallel::traits::detail {
 
     template <typename V, typename ValueType, typename Enable = void>
     struct vector_pack_store;
+
+    template <typename V>
+    struct vector_pack_has_masked_access;
+
+    // The mask of the first count lanes of V.
+    template <typename V>
+    typename V::mask_type vector_pack_first_n_mask(std::size_t count)
+    {
+        using value_type = typename V::value_type;
+        V const index([](auto i) { return value_type(decltype(i)::value); });
+        return index < V(value_type(count));
+    }
+
+    // Iterators which do not refer to contiguous elements but can still be
+    // loaded from and stored to lane by lane specialize this, the packs are
+    // then gathered from and scattered to iter[0], ..., iter[V::size() - 1].
+    template <typename Iter, typename Enable = void>
+    struct vector_pack_gather_access : std::false_type
+    {
+    };
+
+    // Gathers the packs lane by lane. Iterators which compute their elements
+    // from the elements of another iterator specialize this to compute whole
+    // packs at once instead.
+    template <typename Iter, typename Enable = void>
+    struct vector_pack_gather_impl
+    {
+        template <typename V>
+        static V call(Iter const& iter, std::size_t count)
+        {
+            using value_type = typename V::value_type;
+            return V([&](auto i) -> value_type {
+                return decltype(i)::value < count ? iter[decltype(i)::value] :
+                                                    *iter;
+            });
+        }
+    };
+
+    // Gathers the first count elements, the other lanes are set to the first
+    // element.
+    template <typename V, typename Iter>
+    V vector_pack_gather(Iter const& iter, std::size_t count)
+    {
+        return vector_pack_gather_impl<Iter>::template call<V>(iter, count);
+    }
+
+    // Scatters the first count lanes, iterating in lane order such that the
+    // last one of several lanes referring to the same element is stored.
+    // Nothing is stored through iterators whose elements are computed.
+    template <typename V, typename Iter>
+    void vector_pack_scatter(
+        V const& value, Iter const& iter, std::size_t count)
+    {
+        using value_type = typename V::value_type;
+        if constexpr (std::is_assignable_v<decltype(iter[0]), value_type>)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                iter[i] = value[i];
+            }
+        }
+    }
 }    // namespace pika::parallel::traits::detail
 
-#if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_load_store.hpp>
+#elif !defined(__CUDACC__)
 #include <pika/parallel/util/detail/simd/vector_pack_load_store.hpp>
 #endif
 
@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <functional>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace pika::parallel::traits::detail {
+    // The binary operations for which the elements of a vector pack of T can
+    // be combined by a horizontal reduction of the simd backend. The nested
+    // type is the transparent function object which is applied to the packs.
+    template <typename F, typename T, typename Enable = void>
+    struct vector_pack_reduce_op : std::false_type
+    {
+    };
+
+    template <typename Op>
+    struct vector_pack_reduce_op_base : std::true_type
+    {
+        using type = Op;
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::plus<>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : vector_pack_reduce_op_base<std::plus<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::plus<T>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : vector_pack_reduce_op_base<std::plus<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::multiplies<>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : vector_pack_reduce_op_base<std::multiplies<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::multiplies<T>, T,
+        std::enable_if_t<std::is_arithmetic_v<T>>>
+      : vector_pack_reduce_op_base<std::multiplies<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_and<>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_and<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_and<T>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_and<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_or<>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_or<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_or<T>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_or<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_xor<>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_xor<>>
+    {
+    };
+
+    template <typename T>
+    struct vector_pack_reduce_op<std::bit_xor<T>, T,
+        std::enable_if_t<std::is_integral_v<T>>>
+      : vector_pack_reduce_op_base<std::bit_xor<>>
+    {
+    };
+}    // namespace pika::parallel::traits::detail
+
+#if defined(PIKA_HAVE_DATAPAR)
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_reduce.hpp>
+#elif !defined(__CUDACC__)
+#include <pika/parallel/util/detail/simd/vector_pack_reduce.hpp>
+#endif
+
+#endif
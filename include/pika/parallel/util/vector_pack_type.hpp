@@ -10,6 +10,7 @@
 
 #if defined(PIKA_HAVE_DATAPAR)
 
+#include <algorithm>
 #include <cstddef>
 #include <tuple>
 
@@ -17,11 +18,29 @@ namespace pika::parallel::traits::detail {
     template <typename T, std::size_t N = 0, typename Abi = void>
     struct vector_pack_type;
 
-    // handle tuple<> transformations
+    // the number of lanes of the narrowest native pack of the types T
+    template <typename... T>
+    constexpr std::size_t vector_pack_tuple_size() noexcept
+    {
+        std::size_t size = std::size_t(-1);
+        ((size = (std::min)(size, vector_pack_type<T>::type::size())), ...);
+        return size;
+    }
+
+    // handle tuple<> transformations, the packs of the elements have the
+    // same number of lanes such that the packs loaded through a zip_iterator
+    // refer to the same elements of all of its sequences. Element types
+    // whose native packs differ in size use fixed size packs of the
+    // narrowest native size.
     template <typename... T, std::size_t N, typename Abi>
     struct vector_pack_type<std::tuple<T...>, N, Abi>
     {
-        using type = std::tuple<typename vector_pack_type<T, N, Abi>::type...>;
+        static constexpr std::size_t lanes = vector_pack_tuple_size<T...>();
+        static constexpr bool native = N != 0 ||
+            ((vector_pack_type<T>::type::size() == lanes) && ...);
+
+        using type = std::tuple<
+            typename vector_pack_type<T, native ? N : lanes, Abi>::type...>;
     };
 
     template <typename T, typename NewT>
@@ -31,7 +50,9 @@ namespace pika::parallel::traits::detail {
     };
 }    // namespace pika::parallel::traits::detail
 
-#if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR_GENERIC)
+#include <pika/parallel/util/detail/generic/vector_pack_type.hpp>
+#elif !defined(__CUDACC__)
 #include <pika/parallel/util/detail/simd/vector_pack_type.hpp>
 #endif
 
@@ -0,0 +1,83 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/work_stealing_chunk_size.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into one contiguous range per worker.
+    /// Each worker processes its own range in chunks of the given size from
+    /// the front. Workers which have run out of work steal the back half of
+    /// the remaining iterations of another worker. This balances irregular
+    /// workloads without pre-cutting the range into many small chunks.
+    ///
+    /// \note The work stealing scheme is used by the partitioners for
+    ///       synchronous execution policies over random access iterators if
+    ///       this is the only executor parameters object attached to the
+    ///       policy. All other cases fall back to the static partitioning.
+    ///
+    struct work_stealing_chunk_size
+    {
+        /// Construct a \a work_stealing_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a work_stealing_chunk_size executor
+        ///       parameter types will let each worker take 1/16th of its
+        ///       initial share of iterations at a time.
+        ///
+        constexpr work_stealing_chunk_size() noexcept
+          : chunk_size_(0)
+        {
+        }
+
+        /// Construct a \a work_stealing_chunk_size executor parameters object
+        ///
+        /// \param chunk_size   [in] The number of iterations a worker takes
+        ///                     from its own range at a time. This is also the
+        ///                     smallest amount of iterations which is left
+        ///                     to a worker by a thief.
+        ///
+        explicit constexpr work_stealing_chunk_size(
+            std::size_t chunk_size) noexcept
+          : chunk_size_(chunk_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        constexpr std::size_t get_stealing_chunk_size(
+            std::size_t num_workers, std::size_t count) const noexcept
+        {
+            if (chunk_size_ != 0)
+                return chunk_size_;
+
+            std::size_t const chunk_size = count / (16 * num_workers);
+            return chunk_size == 0 ? 1 : chunk_size;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunk_size_;
+        /// \endcond
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::work_stealing_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/util/worker_subset.hpp
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type running the algorithms on a subset of the
+    /// worker threads of the thread pool of the executor, e.g. to keep batch
+    /// algorithms off the worker threads reserved for latency critical work.
+    /// The algorithms are partitioned for the number of worker threads in
+    /// the subset: the iterations are divided into a fixed number of
+    /// contiguous chunks per worker thread, and chunk k is scheduled on the
+    /// k / chunks_per_worker-th worker thread of the subset.
+    ///
+    /// The worker threads are numbered in the order of their processing
+    /// units, neighboring worker threads usually share a NUMA domain.
+    /// Neighboring chunks are placed on neighboring worker threads of the
+    /// subset, such that the iterations handled in each NUMA domain are
+    /// contiguous.
+    ///
+    /// \note The placement of a chunk is a scheduling hint passed to the
+    ///       executor. Executors which do not support scheduling hints will
+    ///       still create the same chunks, but may run them anywhere. Worker
+    ///       threads outside of the subset may steal the chunks unless the
+    ///       scheduler is configured otherwise; to keep the algorithms off
+    ///       worker threads reliably, run them on a separate thread pool
+    ///       (see \a with_thread_pool).
+    ///
+    struct worker_subset
+    {
+        /// Construct a \a worker_subset executor parameters object for the
+        /// worker threads [first, first + count) of the thread pool.
+        ///
+        /// \param first [in] The first worker thread of the subset.
+        /// \param count [in] The number of worker threads of the subset,
+        ///                     0 uses a single worker thread.
+        /// \param chunks_per_worker [in] The number of contiguous chunks
+        ///                     each worker thread is assigned.
+        ///
+        worker_subset(std::size_t first, std::size_t count,
+            std::size_t chunks_per_worker = 1)
+          : chunks_per_worker_(chunks_per_worker == 0 ? 1 : chunks_per_worker)
+        {
+            std::vector<std::size_t> workers(count == 0 ? 1 : count);
+            for (std::size_t i = 0; i != workers.size(); ++i)
+            {
+                workers[i] = first + i;
+            }
+            workers_ = std::make_shared<std::vector<std::size_t> const>(
+                PIKA_MOVE(workers));
+        }
+
+        /// Construct a \a worker_subset executor parameters object for an
+        /// arbitrary set of worker threads of the thread pool, e.g. the bits
+        /// set in a core mask.
+        ///
+        /// \param workers [in] The worker threads of the subset, duplicates
+        ///                     are ignored. An empty set uses the worker
+        ///                     thread 0.
+        /// \param chunks_per_worker [in] The number of contiguous chunks
+        ///                     each worker thread is assigned.
+        ///
+        explicit worker_subset(std::vector<std::size_t> workers,
+            std::size_t chunks_per_worker = 1)
+          : chunks_per_worker_(chunks_per_worker == 0 ? 1 : chunks_per_worker)
+        {
+            if (workers.empty())
+            {
+                workers.push_back(0);
+            }
+            std::sort(workers.begin(), workers.end());
+            workers.erase(
+                std::unique(workers.begin(), workers.end()), workers.end());
+            workers_ = std::make_shared<std::vector<std::size_t> const>(
+                PIKA_MOVE(workers));
+        }
+
+        /// Returns the worker threads of the subset in ascending order.
+        std::vector<std::size_t> const& workers() const noexcept
+        {
+            return *workers_;
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&&) const noexcept
+        {
+            return workers_->size();
+        }
+
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return cores * chunks_per_worker_;
+        }
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(Executor&&, F&&,
+            std::size_t cores, std::size_t count) const noexcept
+        {
+            std::size_t const num_chunks = cores * chunks_per_worker_;
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+            return chunk_size == 0 ? 1 : chunk_size;
+        }
+
+        std::size_t get_chunk_worker(
+            std::size_t chunk, std::size_t) const noexcept
+        {
+            auto const& workers = *workers_;
+            return workers[(chunk / chunks_per_worker_) % workers.size()];
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunks_per_worker_;
+        std::shared_ptr<std::vector<std::size_t> const> workers_;
+        /// \endcond
+    };
+
+    /// Returns \a policy with its executor running all tasks on the named
+    /// thread pool, e.g. a batch pool created by the resource partitioner
+    /// next to a pool running latency critical work. The algorithms are
+    /// partitioned for the number of worker threads of that pool.
+    ///
+    /// \note The executor of \a policy is replaced by a \a parallel_executor,
+    ///       the executor parameters are kept and may further restrict the
+    ///       algorithms to a \a worker_subset of the pool.
+    ///
+    // clang-format off
+    template <typename ExPolicy,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy<std::decay_t<ExPolicy>>::value
+        )>
+    // clang-format on
+    decltype(auto) with_thread_pool(
+        ExPolicy&& policy, std::string const& pool_name)
+    {
+        return PIKA_FORWARD(ExPolicy, policy).on(
+            parallel_executor(&pika::resource::get_thread_pool(pool_name)));
+    }
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::worker_subset>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
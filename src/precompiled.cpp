@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/config.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/inclusive_scan.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/datapar/isa_dispatch.hpp>
+#include <pika/parallel/precompiled.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace pika::precompiled {
+    namespace detail {
+        // The sequential algorithms, invoked for the detected instruction
+        // set. Only the code inlined into the kernels is compiled for it,
+        // the tasks of the parallel algorithms use the baseline.
+        struct sort_sequential
+        {
+            template <typename T>
+            void operator()(T* first, T* last) const
+            {
+                pika::sort(pika::execution::seq, first, last);
+            }
+        };
+
+        struct stable_sort_sequential
+        {
+            template <typename T>
+            void operator()(T* first, T* last) const
+            {
+                pika::stable_sort(pika::execution::seq, first, last);
+            }
+        };
+
+        struct reduce_sequential
+        {
+            template <typename T>
+            T operator()(T const* first, T const* last, T init) const
+            {
+                return pika::reduce(pika::execution::seq, first, last, init);
+            }
+        };
+
+        struct inclusive_scan_sequential
+        {
+            template <typename T>
+            T* operator()(T const* first, T const* last, T* dest) const
+            {
+                return pika::inclusive_scan(
+                    pika::execution::seq, first, last, dest);
+            }
+        };
+
+        struct copy_if_sequential
+        {
+            template <typename T>
+            T* operator()(T const* first, T const* last, T* dest,
+                bool (*pred)(T)) const
+            {
+                return pika::copy_if(
+                    pika::execution::seq, first, last, dest, pred);
+            }
+        };
+
+#if defined(PIKA_ALGORITHMS_DATAPAR_ISA_DISPATCH)
+        template <typename Algorithm>
+        struct isa_kernel
+        {
+            template <pika::parallel::detail::datapar_isa Isa,
+                typename... Ts>
+            static decltype(auto) call(Ts... ts)
+            {
+                return Algorithm()(ts...);
+            }
+        };
+#endif
+
+        template <typename Algorithm, typename R, typename... Ts>
+        R invoke_sequential(Ts... ts)
+        {
+#if defined(PIKA_ALGORITHMS_DATAPAR_ISA_DISPATCH)
+            return pika::parallel::detail::datapar_isa_dispatch<
+                isa_kernel<Algorithm>, R, Ts...>::call(ts...);
+#else
+            return Algorithm()(ts...);
+#endif
+        }
+
+        template <typename ExPolicy>
+        inline constexpr bool is_sequenced_v =
+            std::is_same_v<ExPolicy, pika::execution::sequenced_policy>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename T, typename>
+    void sort(ExPolicy const& policy, T* first, T* last)
+    {
+        if constexpr (detail::is_sequenced_v<ExPolicy>)
+        {
+            detail::invoke_sequential<detail::sort_sequential, void>(
+                first, last);
+        }
+        else
+        {
+            pika::sort(policy, first, last);
+        }
+    }
+
+    template <typename ExPolicy, typename T, typename>
+    void stable_sort(ExPolicy const& policy, T* first, T* last)
+    {
+        if constexpr (detail::is_sequenced_v<ExPolicy>)
+        {
+            detail::invoke_sequential<detail::stable_sort_sequential, void>(
+                first, last);
+        }
+        else
+        {
+            pika::stable_sort(policy, first, last);
+        }
+    }
+
+    template <typename ExPolicy, typename T, typename>
+    T reduce(ExPolicy const& policy, T const* first, T const* last, T init)
+    {
+        if constexpr (detail::is_sequenced_v<ExPolicy>)
+        {
+            return detail::invoke_sequential<detail::reduce_sequential, T>(
+                first, last, init);
+        }
+        else
+        {
+            return pika::reduce(policy, first, last, init);
+        }
+    }
+
+    template <typename ExPolicy, typename T, typename>
+    T* inclusive_scan(
+        ExPolicy const& policy, T const* first, T const* last, T* dest)
+    {
+        if constexpr (detail::is_sequenced_v<ExPolicy>)
+        {
+            return detail::invoke_sequential<
+                detail::inclusive_scan_sequential, T*>(first, last, dest);
+        }
+        else
+        {
+            return pika::inclusive_scan(policy, first, last, dest);
+        }
+    }
+
+    template <typename ExPolicy, typename T, typename>
+    T* copy_if(ExPolicy const& policy, T const* first, T const* last,
+        T* dest, detail::predicate_t<T> pred)
+    {
+        if constexpr (detail::is_sequenced_v<ExPolicy>)
+        {
+            return detail::invoke_sequential<detail::copy_if_sequential, T*>(
+                first, last, dest, pred);
+        }
+        else
+        {
+            return pika::copy_if(policy, first, last, dest, pred);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+#define PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED(ExPolicy, T)                   \
+    template void sort<ExPolicy, T>(ExPolicy const&, T*, T*);                  \
+    template void stable_sort<ExPolicy, T>(ExPolicy const&, T*, T*);           \
+    template T reduce<ExPolicy, T>(ExPolicy const&, T const*, T const*, T);    \
+    template T* inclusive_scan<ExPolicy, T>(                                   \
+        ExPolicy const&, T const*, T const*, T*);                              \
+    template T* copy_if<ExPolicy, T>(                                          \
+        ExPolicy const&, T const*, T const*, T*, detail::predicate_t<T>);      \
+    /**/
+
+#define PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(T)                        \
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED(                                   \
+        pika::execution::sequenced_policy, T)                                  \
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED(                                   \
+        pika::execution::parallel_policy, T)                                   \
+    /**/
+
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(std::int32_t)
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(std::int64_t)
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(float)
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(double)
+    PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE(std::uint8_t)
+
+#undef PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED_TYPE
+#undef PIKA_ALGORITHMS_INSTANTIATE_PRECOMPILED
+}    // namespace pika::precompiled
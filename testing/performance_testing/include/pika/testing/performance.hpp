@@ -16,19 +16,138 @@
 #include <ostream>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace pika { namespace util {
 
+    // Controls the measurements of perftests_report and the statistics
+    // printed by perftests_print_times.
+    struct perftests_options
+    {
+        // number of untimed runs of the test before the measurements
+        std::size_t warmup = 1;
+
+        // a measurement is an outlier if its modified z-score, the distance
+        // to the median in units of the median absolute deviation scaled
+        // to the standard deviation of a normal distribution, exceeds this
+        // threshold; zero keeps all measurements
+        double outlier_threshold = 3.5;
+
+        // number of resamples and confidence level of the bootstrapped
+        // confidence interval of the median
+        std::size_t bootstrap_samples = 1000;
+        double confidence = 0.95;
+
+        // capture the hardware counters of every measurement, only has an
+        // effect if the library was built with
+        // PIKA_ALGORITHMS_WITH_PERFTESTS_COUNTERS
+        bool counters = true;
+
+        // the peak memory bandwidth of the machine in GB/s, e.g. the triad
+        // bandwidth measured by stream_report, the achieved bandwidth of
+        // the tests is reported as a fraction of it; zero if unknown
+        double peak_bandwidth = 0.0;
+    };
+
+    // The work done by one run of a test, its throughput is reported for
+    // the median run next to the time.
+    struct perftests_throughput
+    {
+        // bytes read and written from memory
+        double bytes = 0.0;
+
+        // operations, e.g. the number of elements times the operations per
+        // element
+        double ops = 0.0;
+    };
+
+    void perftests_set_options(perftests_options const& options);
+    perftests_options const& perftests_get_options();
+
     namespace detail {
+        // The statistics of a series of measurements, computed after
+        // rejecting the outliers
+        struct perf_statistics
+        {
+            std::size_t outliers = 0;
+            double median = 0.0;
+            double mad = 0.0;
+            double mean = 0.0;
+            double ci_lower = 0.0;
+            double ci_upper = 0.0;
+        };
+
+        perf_statistics compute_statistics(
+            std::vector<double> const& series, perftests_options const& opts);
+
+        // The hardware counters of all threads of the process during one
+        // measurement
+        struct perf_counters
+        {
+            std::uint64_t cycles = 0;
+            std::uint64_t instructions = 0;
+            std::uint64_t llc_misses = 0;
+            std::uint64_t branch_misses = 0;
+        };
+
         // Json output for performance reports
         class json_perf_times
         {
             using key_t = std::tuple<std::string, std::string>;
             using value_t = std::vector<double>;
             using map_t = std::map<key_t, value_t>;
+            using counters_map_t =
+                std::map<key_t, std::vector<perf_counters>>;
 
             map_t m_map;
+            counters_map_t m_counters;
+            std::vector<std::pair<std::string, std::string>> m_sections;
+            std::map<key_t, perftests_throughput> m_throughput;
+
+            static void print_throughput(std::ostream& strm,
+                perftests_throughput const& work, double median,
+                perftests_options const& opts)
+            {
+                double const seconds = median > 0.0 ? median : 1.0;
+                double const bandwidth = work.bytes / seconds / 1e9;
+
+                strm << "      \"throughput\" : {\n";
+                strm << "        \"bytes\" : " << work.bytes << ",\n";
+                strm << "        \"ops\" : " << work.ops << ",\n";
+                strm << "        \"gbytes_per_s\" : " << bandwidth << ",\n";
+                strm << "        \"gops_per_s\" : "
+                     << work.ops / seconds / 1e9;
+                if (work.bytes > 0.0)
+                {
+                    strm << ",\n        \"arithmetic_intensity\" : "
+                         << work.ops / work.bytes;
+                }
+                if (opts.peak_bandwidth > 0.0)
+                {
+                    strm << ",\n        \"peak_gbytes_per_s\" : "
+                         << opts.peak_bandwidth;
+                    strm << ",\n        \"fraction_of_peak\" : "
+                         << bandwidth / opts.peak_bandwidth;
+                }
+                strm << "\n      }";
+            }
+
+            static void print_counter(std::ostream& strm, char const* name,
+                std::vector<perf_counters> const& counters,
+                std::uint64_t perf_counters::*counter)
+            {
+                strm << "        \"" << name << "\" : [";
+                int values = 0;
+                for (auto const& c : counters)
+                {
+                    if (values)
+                        strm << ", ";
+                    strm << c.*counter;
+                    ++values;
+                }
+                strm << "]";
+            }
 
             friend std::ostream& operator<<(
                 std::ostream& strm, json_perf_times const& obj)
@@ -54,13 +173,63 @@ namespace pika { namespace util {
                         strm << val;
                         ++series;
                     }
-                    strm << "]\n";
-                    strm << "    }";
+                    strm << "],\n";
+
+                    perftests_options const& opts = perftests_get_options();
+                    perf_statistics const stats =
+                        compute_statistics(item.second, opts);
+                    strm << "      \"statistics\" : {\n";
+                    strm << "        \"outliers\" : " << stats.outliers
+                         << ",\n";
+                    strm << "        \"median\" : " << stats.median << ",\n";
+                    strm << "        \"mad\" : " << stats.mad << ",\n";
+                    strm << "        \"mean\" : " << stats.mean << ",\n";
+                    strm << "        \"confidence\" : " << opts.confidence
+                         << ",\n";
+                    strm << "        \"ci_lower\" : " << stats.ci_lower
+                         << ",\n";
+                    strm << "        \"ci_upper\" : " << stats.ci_upper
+                         << "\n";
+                    strm << "      }";
+
+                    auto throughput = obj.m_throughput.find(item.first);
+                    if (throughput != obj.m_throughput.end())
+                    {
+                        strm << ",\n";
+                        print_throughput(
+                            strm, throughput->second, stats.median, opts);
+                    }
+
+                    // the counters of every measurement of the series
+                    auto counters = obj.m_counters.find(item.first);
+                    if (counters != obj.m_counters.end())
+                    {
+                        strm << ",\n      \"counters\" : {\n";
+                        print_counter(strm, "cycles", counters->second,
+                            &perf_counters::cycles);
+                        strm << ",\n";
+                        print_counter(strm, "instructions", counters->second,
+                            &perf_counters::instructions);
+                        strm << ",\n";
+                        print_counter(strm, "llc_misses", counters->second,
+                            &perf_counters::llc_misses);
+                        strm << ",\n";
+                        print_counter(strm, "branch_misses", counters->second,
+                            &perf_counters::branch_misses);
+                        strm << "\n      }";
+                    }
+                    strm << "\n    }";
                     ++outputs;
                 }
                 if (outputs)
                     strm << "\n  ";
-                strm << "]\n";
+                strm << "]";
+                for (auto&& section : obj.m_sections)
+                {
+                    strm << ",\n  \"" << section.first
+                         << "\" : " << section.second;
+                }
+                strm << "\n";
                 strm << "}\n";
                 return strm;
             }
@@ -71,6 +240,33 @@ namespace pika { namespace util {
             {
                 m_map[key_t(name, executor)].push_back(time);
             }
+
+            void add_counters(std::string const& name,
+                std::string const& executor, perf_counters const& counters)
+            {
+                m_counters[key_t(name, executor)].push_back(counters);
+            }
+
+            void set_throughput(std::string const& name,
+                std::string const& executor, perftests_throughput const& work)
+            {
+                m_throughput[key_t(name, executor)] = work;
+            }
+
+            // the series of the given test, empty if there is none
+            value_t const& series(std::string const& name,
+                std::string const& executor) const
+            {
+                static value_t const empty;
+                auto it = m_map.find(key_t(name, executor));
+                return it != m_map.end() ? it->second : empty;
+            }
+
+            // adds an entry with the given json value to the report
+            void add_section(std::string const& name, std::string json)
+            {
+                m_sections.emplace_back(name, PIKA_MOVE(json));
+            }
         };
 
         json_perf_times& times();
@@ -83,6 +279,12 @@ namespace pika { namespace util {
     void perftests_report(std::string const& name, std::string const& exec,
         const std::size_t steps, detail::function<void(void)>&& test);
 
+    // Measures test as above, the report includes the throughput achieved
+    // by the median run doing the given work.
+    void perftests_report(std::string const& name, std::string const& exec,
+        const std::size_t steps, perftests_throughput const& work,
+        detail::function<void(void)>&& test);
+
     void perftests_print_times();
 
     void print_cdash_timing(const char* name, double time);
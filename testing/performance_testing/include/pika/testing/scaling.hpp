@@ -0,0 +1,59 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/function.hpp>
+#include <pika/init.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace pika { namespace util {
+
+    // Controls the sweep of perftests_scaling.
+    struct perftests_scaling_options
+    {
+        // the numbers of worker threads, the runtime is started once for
+        // every count; empty selects the powers of two up to the number of
+        // cores and the number of cores itself
+        std::vector<std::size_t> threads;
+
+        // the problem sizes of the strong scaling curves, the size stays
+        // the same for all thread counts
+        std::vector<std::size_t> strong_sizes;
+
+        // the problem sizes per thread of the weak scaling curves, the
+        // size grows with the number of threads
+        std::vector<std::size_t> weak_sizes;
+
+        // number of measurements of every configuration, see
+        // perftests_report
+        std::size_t steps = 10;
+
+        // passed to pika::init, the number of threads is appended to cfg
+        pika::init_params init_args;
+    };
+
+    // The function called by perftests_scaling to set up the test for a
+    // problem size, returns the function which is measured.
+    using perftests_scaling_test = detail::function<detail::function<void()>(
+        pika::program_options::variables_map&, std::size_t)>;
+
+    // Measures the tests created by make_test for every thread count and
+    // problem size of options, restarting the runtime restricted to the
+    // given number of threads for every thread count. Prints the json
+    // report of perftests_print_times to std::cout, the series are named
+    // <name>/strong/<size> or <name>/weak/<size per thread> with the
+    // executor threads=<count>. The report has an additional "scaling"
+    // entry with the median time, the speedup and the parallel efficiency
+    // of every curve relative to its smallest thread count. Returns the
+    // first non-zero result of pika::init, zero otherwise.
+    int perftests_scaling(std::string const& name, int argc, char* argv[],
+        perftests_scaling_options options, perftests_scaling_test make_test);
+}}    // namespace pika::util
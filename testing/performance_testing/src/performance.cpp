@@ -9,16 +9,251 @@
 #include <fmt/ostream.h>
 #include <fmt/printf.h>
 
+#if defined(PIKA_ALGORITHMS_HAVE_PERFTESTS_COUNTERS)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <random>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace pika { namespace util {
 
     namespace detail {
 
+        perftests_options& options()
+        {
+            static perftests_options res;
+            return res;
+        }
+
+        // the median of values, reorders them
+        double median(std::vector<double>& values)
+        {
+            std::size_t const n = values.size();
+            auto const middle = values.begin() + n / 2;
+            std::nth_element(values.begin(), middle, values.end());
+            if (n % 2 != 0)
+                return *middle;
+            return (*middle + *std::max_element(values.begin(), middle)) / 2;
+        }
+
+        perf_statistics compute_statistics(
+            std::vector<double> const& series, perftests_options const& opts)
+        {
+            perf_statistics stats;
+            if (series.empty())
+                return stats;
+
+            std::vector<double> values(series);
+            double const m = median(values);
+
+            std::vector<double> deviations(series.size());
+            std::transform(series.begin(), series.end(), deviations.begin(),
+                [m](double value) { return std::abs(value - m); });
+            double const mad = median(deviations);
+
+            // 0.6745 is the 0.75 quantile of the standard normal
+            // distribution, the modified z-score of Iglewicz and Hoaglin
+            values.clear();
+            for (double value : series)
+            {
+                if (opts.outlier_threshold <= 0.0 || mad == 0.0 ||
+                    0.6745 * std::abs(value - m) / mad <=
+                        opts.outlier_threshold)
+                {
+                    values.push_back(value);
+                }
+            }
+            stats.outliers = series.size() - values.size();
+
+            stats.mean = 0.0;
+            for (double value : values)
+                stats.mean += value;
+            stats.mean /= static_cast<double>(values.size());
+
+            std::vector<double> sample(values);
+            stats.median = median(sample);
+            for (double& deviation : sample)
+                deviation = std::abs(deviation - stats.median);
+            stats.mad = median(sample);
+
+            // percentile bootstrap of the median, seeded for reproducible
+            // reports
+            stats.ci_lower = stats.ci_upper = stats.median;
+            if (opts.bootstrap_samples == 0 || values.size() < 2)
+                return stats;
+
+            std::mt19937 gen(0);
+            std::uniform_int_distribution<std::size_t> dis(
+                0, values.size() - 1);
+            std::vector<double> estimates(opts.bootstrap_samples);
+            for (double& estimate : estimates)
+            {
+                for (double& value : sample)
+                    value = values[dis(gen)];
+                estimate = median(sample);
+            }
+            std::sort(estimates.begin(), estimates.end());
+
+            double const alpha = 1.0 - opts.confidence;
+            auto quantile = [&](double q) {
+                auto const i = static_cast<std::size_t>(
+                    q * static_cast<double>(estimates.size() - 1) + 0.5);
+                return estimates[(std::min)(i, estimates.size() - 1)];
+            };
+            stats.ci_lower = quantile(alpha / 2);
+            stats.ci_upper = quantile(1.0 - alpha / 2);
+            return stats;
+        }
+
+#if defined(PIKA_ALGORITHMS_HAVE_PERFTESTS_COUNTERS)
+        // The counters are opened for every thread of the process which
+        // exists when perftests_report is called, the worker threads of
+        // the runtime. Each thread has a group of counters led by its
+        // cycle counter, the counters of a group are enabled, disabled and
+        // read together.
+        class counter_groups
+        {
+            static constexpr std::size_t num_counters = 4;
+
+            static int open_counter(
+                pid_t tid, std::uint64_t config, int group_fd)
+            {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = config;
+                attr.disabled = group_fd == -1 ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP |
+                    PERF_FORMAT_TOTAL_TIME_ENABLED |
+                    PERF_FORMAT_TOTAL_TIME_RUNNING;
+                return static_cast<int>(syscall(
+                    SYS_perf_event_open, &attr, tid, -1, group_fd, 0));
+            }
+
+        public:
+            counter_groups()
+            {
+                DIR* tasks = opendir("/proc/self/task");
+                if (tasks == nullptr)
+                    return;
+
+                while (dirent* entry = readdir(tasks))
+                {
+                    if (entry->d_name[0] == '.')
+                        continue;
+                    pid_t const tid = std::atoi(entry->d_name);
+
+                    std::array<int, num_counters> fds;
+                    fds[0] = open_counter(tid, PERF_COUNT_HW_CPU_CYCLES, -1);
+                    fds[1] =
+                        open_counter(tid, PERF_COUNT_HW_INSTRUCTIONS, fds[0]);
+                    fds[2] =
+                        open_counter(tid, PERF_COUNT_HW_CACHE_MISSES, fds[0]);
+                    fds[3] =
+                        open_counter(tid, PERF_COUNT_HW_BRANCH_MISSES, fds[0]);
+
+                    if (std::find(fds.begin(), fds.end(), -1) != fds.end())
+                    {
+                        // the thread may have exited, or the counters are
+                        // not available
+                        close_group(fds);
+                        continue;
+                    }
+                    groups_.push_back(fds);
+                }
+                closedir(tasks);
+            }
+
+            ~counter_groups()
+            {
+                for (auto& fds : groups_)
+                    close_group(fds);
+            }
+
+            counter_groups(counter_groups const&) = delete;
+            counter_groups& operator=(counter_groups const&) = delete;
+
+            bool valid() const noexcept
+            {
+                return !groups_.empty();
+            }
+
+            void start()
+            {
+                for (auto const& fds : groups_)
+                {
+                    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                }
+            }
+
+            // the sum of the counters of all threads since start, scaled
+            // up if the counters were multiplexed
+            perf_counters stop()
+            {
+                for (auto const& fds : groups_)
+                    ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+                std::array<double, num_counters> sums{};
+                for (auto const& fds : groups_)
+                {
+                    // nr, time_enabled, time_running, values[nr]
+                    std::array<std::uint64_t, 3 + num_counters> data{};
+                    if (read(fds[0], data.data(), sizeof(data)) !=
+                            static_cast<ssize_t>(sizeof(data)) ||
+                        data[2] == 0)
+                    {
+                        continue;
+                    }
+
+                    double const scale =
+                        static_cast<double>(data[1]) / double(data[2]);
+                    for (std::size_t i = 0; i != num_counters; ++i)
+                        sums[i] += static_cast<double>(data[3 + i]) * scale;
+                }
+
+                perf_counters result;
+                result.cycles = static_cast<std::uint64_t>(sums[0]);
+                result.instructions = static_cast<std::uint64_t>(sums[1]);
+                result.llc_misses = static_cast<std::uint64_t>(sums[2]);
+                result.branch_misses = static_cast<std::uint64_t>(sums[3]);
+                return result;
+            }
+
+        private:
+            static void close_group(std::array<int, num_counters> const& fds)
+            {
+                // close the members before the leader
+                for (std::size_t i = num_counters; i != 0; --i)
+                {
+                    if (fds[i - 1] != -1)
+                        close(fds[i - 1]);
+                }
+            }
+
+            std::vector<std::array<int, num_counters>> groups_;
+        };
+#endif
+
         json_perf_times& times()
         {
             static json_perf_times res;
@@ -33,29 +268,69 @@ namespace pika { namespace util {
 
     }    // namespace detail
 
+    void perftests_set_options(perftests_options const& options)
+    {
+        detail::options() = options;
+    }
+
+    perftests_options const& perftests_get_options()
+    {
+        return detail::options();
+    }
+
     void perftests_report(std::string const& name, std::string const& exec,
         const std::size_t steps, detail::function<void(void)>&& test)
     {
         if (steps == 0)
             return;
-        // First iteration to cache the data
-        test();
+        // Warmup iterations to cache the data
+        for (std::size_t i = 0; i != detail::options().warmup; ++i)
+            test();
+#if defined(PIKA_ALGORITHMS_HAVE_PERFTESTS_COUNTERS)
+        std::unique_ptr<detail::counter_groups> counters;
+        if (detail::options().counters)
+        {
+            counters = std::make_unique<detail::counter_groups>();
+            if (!counters->valid())
+                counters.reset();
+        }
+#endif
         using timer = std::chrono::high_resolution_clock;
         timer::time_point start;
         for (size_t i = 0; i != steps; ++i)
         {
             // For now we don't flush the cache
             //flush_cache();
+#if defined(PIKA_ALGORITHMS_HAVE_PERFTESTS_COUNTERS)
+            if (counters)
+                counters->start();
+#endif
             start = timer::now();
             test();
             // default is in seconds
             auto time =
                 std::chrono::duration_cast<std::chrono::duration<double>>(
                     timer::now() - start);
+#if defined(PIKA_ALGORITHMS_HAVE_PERFTESTS_COUNTERS)
+            if (counters)
+            {
+                detail::times().add_counters(name, exec, counters->stop());
+            }
+#endif
             detail::add_time(name, exec, time.count());
         }
     }
 
+    void perftests_report(std::string const& name, std::string const& exec,
+        const std::size_t steps, perftests_throughput const& work,
+        detail::function<void(void)>&& test)
+    {
+        if (steps == 0)
+            return;
+        detail::times().set_throughput(name, exec, work);
+        perftests_report(name, exec, steps, PIKA_MOVE(test));
+    }
+
     void perftests_print_times()
     {
         std::cout << detail::times();
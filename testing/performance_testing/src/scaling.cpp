@@ -0,0 +1,167 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/testing/performance.hpp>
+#include <pika/testing/scaling.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace pika { namespace util {
+
+    namespace detail {
+
+        // the powers of two up to the number of cores and the number of
+        // cores itself
+        std::vector<std::size_t> default_thread_counts()
+        {
+            std::size_t const cores =
+                (std::max)(std::thread::hardware_concurrency(), 1u);
+            std::vector<std::size_t> threads;
+            for (std::size_t n = 1; n < cores; n *= 2)
+                threads.push_back(n);
+            threads.push_back(cores);
+            return threads;
+        }
+
+        std::string scaling_name(std::string const& name, char const* mode,
+            std::size_t size)
+        {
+            return name + "/" + mode + "/" + std::to_string(size);
+        }
+
+        std::string scaling_executor(std::size_t threads)
+        {
+            return "threads=" + std::to_string(threads);
+        }
+
+        // Writes the curve of the given series as a json object. The
+        // speedup of strong scaling is the time of the smallest thread
+        // count divided by the time of every thread count, the efficiency
+        // divides the speedup by the relative number of threads. Weak
+        // scaling is ideal if the time stays the same, its efficiency is
+        // the ratio of the times.
+        void write_curve(std::ostream& strm, std::string const& name,
+            char const* mode, std::size_t size,
+            std::vector<std::size_t> const& threads)
+        {
+            std::string const series = scaling_name(name, mode, size);
+            bool const strong = std::string(mode) == "strong";
+
+            std::vector<double> medians;
+            for (std::size_t n : threads)
+            {
+                perf_statistics const stats = compute_statistics(
+                    times().series(series, scaling_executor(n)),
+                    perftests_get_options());
+                medians.push_back(stats.median);
+            }
+
+            auto write_array = [&](char const* key, auto value) {
+                strm << "      \"" << key << "\" : [";
+                for (std::size_t i = 0; i != threads.size(); ++i)
+                {
+                    if (i)
+                        strm << ", ";
+                    strm << value(i);
+                }
+                strm << "]";
+            };
+
+            auto speedup = [&](std::size_t i) {
+                return medians[i] > 0.0 ? medians[0] / medians[i] : 0.0;
+            };
+            auto efficiency = [&](std::size_t i) {
+                double const ratio = static_cast<double>(threads[i]) /
+                    static_cast<double>(threads[0]);
+                return strong ? speedup(i) / ratio : speedup(i);
+            };
+
+            strm << "\n    {\n";
+            strm << "      \"name\" : \"" << series << "\",\n";
+            strm << "      \"mode\" : \"" << mode << "\",\n";
+            strm << "      \"size\" : " << size << ",\n";
+            write_array("threads", [&](std::size_t i) { return threads[i]; });
+            strm << ",\n";
+            write_array("median", [&](std::size_t i) { return medians[i]; });
+            strm << ",\n";
+            write_array("speedup", speedup);
+            strm << ",\n";
+            write_array("efficiency", efficiency);
+            strm << "\n    }";
+        }
+    }    // namespace detail
+
+    int perftests_scaling(std::string const& name, int argc, char* argv[],
+        perftests_scaling_options options, perftests_scaling_test make_test)
+    {
+        if (options.threads.empty())
+            options.threads = detail::default_thread_counts();
+        std::sort(options.threads.begin(), options.threads.end());
+        options.threads.erase(
+            std::unique(options.threads.begin(), options.threads.end()),
+            options.threads.end());
+
+        auto measure = [&](pika::program_options::variables_map& vm,
+                           char const* mode, std::size_t size,
+                           std::size_t threads) {
+            std::size_t const total =
+                std::string(mode) == "weak" ? size * threads : size;
+            perftests_report(detail::scaling_name(name, mode, size),
+                detail::scaling_executor(threads), options.steps,
+                make_test(vm, total));
+        };
+
+        // the runtime is restarted for every thread count, the times are
+        // collected across the runs
+        for (std::size_t threads : options.threads)
+        {
+            pika::init_params init_args = options.init_args;
+            init_args.cfg.push_back(
+                "pika.os_threads=" + std::to_string(threads));
+
+            int const result = pika::init(
+                [&](pika::program_options::variables_map& vm) {
+                    for (std::size_t size : options.strong_sizes)
+                        measure(vm, "strong", size, threads);
+                    for (std::size_t size : options.weak_sizes)
+                        measure(vm, "weak", size, threads);
+                    return pika::finalize();
+                },
+                argc, argv, init_args);
+
+            if (result != 0)
+                return result;
+        }
+
+        std::ostringstream curves;
+        curves << "[";
+        int written = 0;
+        auto write = [&](char const* mode, std::size_t size) {
+            if (written++)
+                curves << ",";
+            detail::write_curve(curves, name, mode, size, options.threads);
+        };
+        for (std::size_t size : options.strong_sizes)
+            write("strong", size);
+        for (std::size_t size : options.weak_sizes)
+            write("weak", size);
+        if (written)
+            curves << "\n  ";
+        curves << "]";
+
+        detail::times().add_section("scaling", curves.str());
+        perftests_print_times();
+        return 0;
+    }
+}}    // namespace pika::util
@@ -0,0 +1,306 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The driver shared by the per-family algorithm benchmarks. A family is a
+// function object which reports the algorithms of the family for the
+// values and the policy given to it:
+//
+//     struct family
+//     {
+//         // whether the family is measured using the simd policies
+//         static constexpr bool datapar = false;
+//
+//         template <typename T, typename ExPolicy>
+//         void operator()(
+//             algorithm_report::benchmark<T>& b, ExPolicy const& policy) const;
+//     };
+//
+// The family is run for every combination of the sizes, the element types
+// int and double, the policies seq, simd, par, par_unseq, par_simd and
+// par(task), and the parallel, fork_join and scheduler executors for the
+// parallel policies. Every combination is reported through
+// perftests_report, its name is <algorithm>/<type>/<size>/<policy>.
+
+#pragma once
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/testing/performance.hpp>
+#if defined(PIKA_HAVE_DATAPAR)
+#include <pika/parallel/datapar.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithm_report {
+    template <typename T>
+    char const* type_name();
+
+    template <>
+    inline char const* type_name<int>()
+    {
+        return "int";
+    }
+
+    template <>
+    inline char const* type_name<double>()
+    {
+        return "double";
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The values the algorithms of a family are measured with, and the names
+    // of the combination being measured.
+    template <typename T>
+    class benchmark
+    {
+    public:
+        benchmark(std::size_t size, std::size_t test_count, unsigned int seed)
+          : size_(size)
+          , test_count_(test_count)
+          , input_(size)
+          , sorted_(size)
+          , halves_(size)
+          , work_(size)
+          , dest_(2 * size)
+        {
+            // a few duplicates for the algorithms comparing elements
+            std::mt19937 gen(seed);
+            std::uniform_int_distribution<int> dis(
+                0, static_cast<int>((std::min)(size, std::size_t(1) << 30)));
+            for (T& value : input_)
+            {
+                value = static_cast<T>(dis(gen));
+            }
+
+            std::copy(input_.begin(), input_.end(), sorted_.begin());
+            std::sort(sorted_.begin(), sorted_.end());
+
+            std::copy(input_.begin(), input_.end(), halves_.begin());
+            std::sort(halves_.begin(), halves_.begin() + size / 2);
+            std::sort(halves_.begin() + size / 2, halves_.end());
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        // random values
+        std::vector<T> const& input() const noexcept
+        {
+            return input_;
+        }
+
+        // the input values in ascending order
+        std::vector<T> const& sorted() const noexcept
+        {
+            return sorted_;
+        }
+
+        // the input values with both halves sorted separately, the inputs
+        // of the merges and set operations
+        std::vector<T> const& halves() const noexcept
+        {
+            return halves_;
+        }
+
+        // size elements for the algorithms modifying their input
+        std::vector<T>& work() noexcept
+        {
+            return work_;
+        }
+
+        // Copies values to work in parallel. The algorithms modifying their
+        // input restore it before every measurement.
+        void restore(std::vector<T> const& values)
+        {
+            pika::copy(pika::execution::par, values.begin(), values.end(),
+                work_.begin());
+        }
+
+        // 2 * size elements for the results
+        std::vector<T>& dest() noexcept
+        {
+            return dest_;
+        }
+
+        void set_policy(std::string policy, std::string executor)
+        {
+            policy_ = PIKA_MOVE(policy);
+            executor_ = PIKA_MOVE(executor);
+        }
+
+        // Reports the time of f(policy), waits for the returned future if
+        // the policy is asynchronous. The throughput is reported for the
+        // nominal work of a single pass over the input, reading it and
+        // writing as many elements, and one operation per element.
+        template <typename ExPolicy, typename F>
+        void report(
+            std::string const& algorithm, ExPolicy const& policy, F&& f)
+        {
+            std::string const name = algorithm + "/" + type_name<T>() + "/" +
+                std::to_string(size_) + "/" + policy_;
+            pika::util::perftests_throughput const work{
+                2.0 * double(size_) * sizeof(T), double(size_)};
+
+            pika::util::perftests_report(
+                name, executor_, test_count_, work, [&]() {
+                    if constexpr (pika::is_async_execution_policy_v<ExPolicy>)
+                    {
+                        f(policy).get();
+                    }
+                    else
+                    {
+                        f(policy);
+                    }
+                });
+        }
+
+        // Reports the time of restoring values, which is included in the
+        // times of the algorithms modifying their input.
+        void report_restore(std::vector<T> const& values)
+        {
+            std::string const name = std::string("restore/") +
+                type_name<T>() + "/" + std::to_string(size_) + "/" + policy_;
+
+            pika::util::perftests_report(
+                name, executor_, test_count_, [&]() { restore(values); });
+        }
+
+    private:
+        std::size_t size_;
+        std::size_t test_count_;
+        std::vector<T> input_;
+        std::vector<T> sorted_;
+        std::vector<T> halves_;
+        std::vector<T> work_;
+        std::vector<T> dest_;
+        std::string policy_;
+        std::string executor_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Family, typename ExPolicy>
+    void run_policy(Family const& family, benchmark<T>& b,
+        ExPolicy const& policy, char const* policy_name,
+        char const* executor_name)
+    {
+        b.set_policy(policy_name, executor_name);
+        family(b, policy);
+    }
+
+    template <typename T, typename Family, typename ExPolicy>
+    void run_executors(Family const& family, benchmark<T>& b,
+        ExPolicy const& policy, char const* policy_name)
+    {
+        using namespace pika::execution;
+
+        run_policy(family, b, policy.on(parallel_executor()), policy_name,
+            "parallel_executor");
+        run_policy(family, b, policy.on(experimental::fork_join_executor()),
+            policy_name, "fork_join_executor");
+        run_policy(family, b,
+            policy.on(experimental::scheduler_executor<
+                experimental::thread_pool_scheduler>()),
+            policy_name, "scheduler_executor");
+    }
+
+    template <typename T, typename Family>
+    void run_type(Family const& family, std::size_t size,
+        std::size_t test_count, unsigned int seed)
+    {
+        using namespace pika::execution;
+
+        benchmark<T> b(size, test_count, seed);
+
+        run_policy(family, b, seq, "seq", "none");
+        run_executors(family, b, par, "par");
+        run_executors(family, b, par_unseq, "par_unseq");
+        run_policy(family, b, par(task), "par_task", "parallel_executor");
+
+#if defined(PIKA_HAVE_DATAPAR)
+        if constexpr (Family::datapar)
+        {
+            run_policy(family, b, simd, "simd", "none");
+            run_executors(family, b, par_simd, "par_simd");
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs the family for sizes growing by a factor of 16 from min_bytes to
+    // max_bytes, by default from the L1 cache to the main memory.
+    template <typename Family>
+    int run(Family const& family, pika::program_options::variables_map& vm)
+    {
+        std::size_t const min_bytes = vm["min_bytes"].as<std::size_t>();
+        std::size_t const max_bytes = vm["max_bytes"].as<std::size_t>();
+        std::size_t const test_count = vm["test_count"].as<std::size_t>();
+        unsigned int const seed = vm["seed"].as<unsigned int>();
+
+        pika::util::perftests_options options =
+            pika::util::perftests_get_options();
+        options.peak_bandwidth = vm["peak_bandwidth"].as<double>();
+        pika::util::perftests_set_options(options);
+
+        if (min_bytes == 0 || test_count == 0)
+        {
+            std::cerr << "min_bytes and test_count must be positive\n";
+            return pika::finalize();
+        }
+
+        for (std::size_t bytes = min_bytes; bytes <= max_bytes; bytes *= 16)
+        {
+            run_type<int>(family, bytes / sizeof(int), test_count, seed);
+            run_type<double>(family, bytes / sizeof(double), test_count, seed);
+        }
+
+        pika::util::perftests_print_times();
+
+        return pika::finalize();
+    }
+
+    template <typename Family>
+    int main(Family const& family, int argc, char* argv[])
+    {
+        using namespace pika::program_options;
+
+        options_description cmdline(
+            "usage: " PIKA_APPLICATION_STRING " [options]");
+
+        // clang-format off
+        cmdline.add_options()
+            ("min_bytes", value<std::size_t>()->default_value(16384),
+             "size of the smallest input in bytes (default: 16 KiB)")
+            ("max_bytes", value<std::size_t>()->default_value(67108864),
+             "size of the largest input in bytes (default: 64 MiB)")
+            ("test_count", value<std::size_t>()->default_value(10),
+             "number of repetitions of every measurement (default: 10)")
+            ("seed", value<unsigned int>()->default_value(0),
+             "seed of the random input values (default: 0)")
+            ("peak_bandwidth", value<double>()->default_value(0.0),
+             "peak memory bandwidth in GB/s, e.g. the triad bandwidth of "
+             "stream_report (default: 0, unknown)")
+            ;
+        // clang-format on
+
+        pika::init_params init_args;
+        init_args.desc_cmdline = cmdline;
+
+        return pika::init(
+            [&](variables_map& vm) { return run(family, vm); }, argc, argv,
+            init_args);
+    }
+}    // namespace algorithm_report
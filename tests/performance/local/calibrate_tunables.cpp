@@ -0,0 +1,94 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Calibrates the thresholds of the algorithms on this machine, see
+// calibrate_tunables, and writes the profile to the given file or to
+// std::cout. Applications load the profile by naming it in the environment
+// variable PIKA_TUNABLES, or by passing it to read_tunables. With --bandwidth
+// the number of cores saturating the memory bandwidth is calibrated as well,
+// see calibrate_bandwidth_limit.
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/util/calibrate_tunables.hpp>
+#include <pika/parallel/util/tunables.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    pika::parallel::util::tunables_calibration_options options;
+    options.size = vm["size"].as<std::size_t>();
+    options.repetitions = vm["test_count"].as<std::size_t>();
+    options.seed = vm["seed"].as<unsigned int>();
+    if (vm.count("candidates"))
+    {
+        options.candidates =
+            vm["candidates"].as<std::vector<std::size_t>>();
+    }
+
+    if (options.size == 0 || options.repetitions == 0 ||
+        options.candidates.empty())
+    {
+        std::cerr << "size, test_count and candidates must be positive\n";
+        return pika::finalize();
+    }
+
+    pika::parallel::util::calibrate_tunables(options);
+    if (vm.count("bandwidth"))
+    {
+        pika::parallel::util::calibrate_bandwidth_limit();
+    }
+
+    std::string const profile = vm["profile"].as<std::string>();
+    if (profile.empty())
+    {
+        pika::parallel::util::write_tunables(std::cout);
+    }
+    else
+    {
+        std::ofstream out(profile);
+        pika::parallel::util::write_tunables(out);
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("profile", value<std::string>()->default_value(""),
+         "file the profile is written to (default: std::cout)")
+        ("size", value<std::size_t>()->default_value(4194304),
+         "number of elements of the inputs (default: 4194304)")
+        ("candidates", value<std::vector<std::size_t>>()->multitoken(),
+         "values every tunable is measured with (default: 4096 16384 "
+         "65536 262144 1048576)")
+        ("test_count", value<std::size_t>()->default_value(3),
+         "number of measurements of every candidate (default: 3)")
+        ("seed", value<unsigned int>()->default_value(0),
+         "seed of the random input values (default: 0)")
+        ("bandwidth",
+         "calibrate the number of cores used by the algorithms bound by the "
+         "memory bandwidth")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
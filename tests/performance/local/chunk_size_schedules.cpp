@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the static, dynamic and guided chunk size schedules on a loop
+// with a skewed per-element cost: the last heavy_fraction of the iterations
+// are skew times more expensive than the others, which leaves the worker
+// owning the end of the range with most of the work under a static schedule.
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/util/guided_chunk_size.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+PIKA_FORCEINLINE void spin_for(std::uint64_t delay_ns)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+    while (std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::high_resolution_clock::now() - start)
+               .count() < static_cast<std::int64_t>(delay_ns))
+    {
+    }
+}
+
+struct cost_model
+{
+    std::size_t first_heavy;
+    std::uint64_t delay_ns;
+    std::uint64_t skew;
+
+    std::uint64_t operator()(std::size_t i) const
+    {
+        return i < first_heavy ? delay_ns : skew * delay_ns;
+    }
+};
+
+template <typename ExPolicy>
+double measure_schedule(ExPolicy&& policy, cost_model const& cost,
+    std::vector<std::size_t> const& data, int test_count)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        pika::for_each(policy, data.begin(), data.end(),
+            [&](std::size_t j) { spin_for(cost(j)); });
+    }
+
+    std::chrono::duration<double> const elapsed =
+        std::chrono::high_resolution_clock::now() - start;
+    return elapsed.count() / test_count;
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    double const heavy_fraction = vm["heavy_fraction"].as<double>();
+    std::uint64_t const delay_ns = vm["delay"].as<std::uint64_t>();
+    std::uint64_t const skew = vm["skew"].as<std::uint64_t>();
+    std::size_t const chunk_size = vm["chunk_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return pika::finalize();
+    }
+
+    cost_model const cost{
+        static_cast<std::size_t>(double(size) * (1.0 - heavy_fraction)),
+        delay_ns, skew};
+
+    std::vector<std::size_t> data(size);
+    std::iota(data.begin(), data.end(), std::size_t(0));
+
+    using namespace pika::execution;
+
+    // warm up
+    measure_schedule(par, cost, data, 1);
+
+    double const static_time =
+        measure_schedule(par.with(static_chunk_size()), cost, data, test_count);
+    double const dynamic_time = measure_schedule(
+        par.with(dynamic_chunk_size(chunk_size)), cost, data, test_count);
+    double const guided_time = measure_schedule(
+        par.with(guided_chunk_size(chunk_size)), cost, data, test_count);
+
+    if (csvoutput)
+    {
+        std::cout << "static,dynamic,guided\n"
+                  << static_time << "," << dynamic_time << "," << guided_time
+                  << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "for_each(static_chunk_size): " << std::right
+                  << std::setw(15) << static_time << "\n"
+                  << "for_each(dynamic_chunk_size): " << std::right
+                  << std::setw(15) << dynamic_time << "\n"
+                  << "for_each(guided_chunk_size): " << std::right
+                  << std::setw(15) << guided_time << "\n"
+                  << std::flush;
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    pika::program_options::options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , pika::program_options::value<std::size_t>()->default_value(100000)
+        , "number of loop iterations")
+
+        ("heavy_fraction"
+        , pika::program_options::value<double>()->default_value(0.1)
+        , "fraction of expensive iterations at the end of the range")
+
+        ("delay"
+        , pika::program_options::value<std::uint64_t>()->default_value(100)
+        , "cost of a cheap iteration in nanoseconds")
+
+        ("skew"
+        , pika::program_options::value<std::uint64_t>()->default_value(10)
+        , "cost of an expensive iteration relative to a cheap one")
+
+        ("chunk_size"
+        , pika::program_options::value<std::size_t>()->default_value(16)
+        , "chunk size for dynamic, minimal chunk size for guided")
+
+        ("csv_output"
+        , pika::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , pika::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
@@ -0,0 +1,53 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of copying and removing the elements of the random
+// input below its median, see algorithm_report.hpp. remove_if works on a
+// copy of the input, which is restored before every measurement.
+
+#include "algorithm_report.hpp"
+
+#include <vector>
+
+struct copy_if_family
+{
+    static constexpr bool datapar = true;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& input = b.input();
+        std::vector<T>& work = b.work();
+        std::vector<T>& dest = b.dest();
+        // can be invoked with vector packs by the simd policies
+        auto pred = [median = static_cast<T>(b.size() / 2)](
+                        auto const& value) { return value < median; };
+
+        b.report("copy", policy, [&](auto const& p) {
+            return pika::copy(p, input.begin(), input.end(), dest.begin());
+        });
+        b.report("copy_if", policy, [&](auto const& p) {
+            return pika::copy_if(
+                p, input.begin(), input.end(), dest.begin(), pred);
+        });
+        b.report("remove_copy_if", policy, [&](auto const& p) {
+            return pika::remove_copy_if(
+                p, input.begin(), input.end(), dest.begin(), pred);
+        });
+
+        b.report_restore(input);
+        b.report("remove_if", policy, [&](auto const& p) {
+            b.restore(input);
+            return pika::remove_if(p, work.begin(), work.end(), pred);
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(copy_if_family{}, argc, argv);
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the overhead of dispatching an algorithm on tiny inputs, where the
+// time of a call is dominated by the policy rather than by the work. Every
+// measurement runs the algorithm calls times in a row, its name is
+// <algorithm>/<size>/<policy>. The throughput reports one operation per
+// call, the inverse of the Gop/s is the time of a single call in ns. The
+// policy par_inline is par with an inline_threshold covering all sizes, it
+// shows the cost of the inline path compared to seq. The policy par_sender
+// runs the algorithms with par as a stage of a sender pipeline waited for by
+// sync_wait, it shows the cost of the sender path compared to par.
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/numeric.hpp>
+#include <pika/testing/performance.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t calls = 1000;
+std::size_t test_count = 10;
+
+template <typename ExPolicy, typename F>
+void measure(std::string const& algorithm, std::size_t size,
+    ExPolicy const& policy, char const* policy_name, F&& f)
+{
+    std::string const name =
+        algorithm + "/" + std::to_string(size) + "/" + policy_name;
+    pika::util::perftests_throughput const work{0.0, double(calls)};
+
+    pika::util::perftests_report(
+        name, "default", test_count, work, [&]() {
+            for (std::size_t i = 0; i != calls; ++i)
+            {
+                if constexpr (pika::is_async_execution_policy_v<ExPolicy>)
+                {
+                    f(policy).get();
+                }
+                else
+                {
+                    f(policy);
+                }
+            }
+        });
+}
+
+template <typename ExPolicy>
+void measure_algorithms(std::size_t size, ExPolicy const& policy,
+    char const* policy_name)
+{
+    std::vector<int> input(size, 1);
+    std::vector<int> dest(size);
+
+    measure("for_each", size, policy, policy_name, [&](auto const& p) {
+        return pika::for_each(
+            p, dest.begin(), dest.end(), [](int& value) { ++value; });
+    });
+
+    measure("reduce", size, policy, policy_name, [&](auto const& p) {
+        return pika::reduce(
+            p, input.begin(), input.end(), 0, std::plus<>());
+    });
+
+    measure("transform", size, policy, policy_name, [&](auto const& p) {
+        return pika::transform(p, input.begin(), input.end(), dest.begin(),
+            [](int value) { return value + 1; });
+    });
+
+    measure("copy", size, policy, policy_name, [&](auto const& p) {
+        return pika::copy(p, input.begin(), input.end(), dest.begin());
+    });
+}
+
+void measure_sender_algorithms(std::size_t size)
+{
+    namespace ex = pika::execution::experimental;
+    namespace tt = pika::this_thread::experimental;
+
+    std::vector<int> input(size, 1);
+    std::vector<int> dest(size);
+    auto const policy = pika::execution::par;
+
+    measure("for_each", size, policy, "par_sender", [&](auto const& p) {
+        tt::sync_wait(ex::just(dest.begin(), dest.end(),
+                          [](int& value) { ++value; }) |
+            pika::for_each(p));
+    });
+
+    measure("reduce", size, policy, "par_sender", [&](auto const& p) {
+        tt::sync_wait(ex::just(input.begin(), input.end(), 0, std::plus<>()) |
+            pika::reduce(p));
+    });
+
+    measure("transform", size, policy, "par_sender", [&](auto const& p) {
+        tt::sync_wait(ex::just(input.begin(), input.end(), dest.begin(),
+                          [](int value) { return value + 1; }) |
+            pika::transform(p));
+    });
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    using namespace pika::execution;
+
+    calls = vm["calls"].as<std::size_t>();
+    test_count = vm["test_count"].as<std::size_t>();
+
+    if (calls == 0 || test_count == 0)
+    {
+        std::cerr << "calls and test_count must be positive\n";
+        return pika::finalize();
+    }
+
+    for (std::size_t size : {10, 100, 1000})
+    {
+        measure_algorithms(size, seq, "seq");
+        measure_algorithms(size, par, "par");
+        measure_algorithms(size, par_unseq, "par_unseq");
+        measure_algorithms(size, par(task), "par_task");
+        measure_algorithms(
+            size, par.with(inline_threshold(1000)), "par_inline");
+        measure_sender_algorithms(size);
+    }
+
+    pika::util::perftests_print_times();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("calls", value<std::size_t>()->default_value(1000),
+         "number of calls of the algorithm per measurement (default: 1000)")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of repetitions of every measurement (default: 10)")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
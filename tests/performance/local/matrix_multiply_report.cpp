@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares pika::matrix_multiply to the nested loops of the
+// matrix_multiplication quickstart example, a parallel loop over the rows
+// of the result with sequential loops over its columns and the inner
+// dimension. Both are reported through perftests_report for square float
+// and double matrices, the names are <variant>/<type>/<order>/<policy>.
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/testing/performance.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_count = 10;
+
+template <typename T>
+char const* type_name()
+{
+    return sizeof(T) == sizeof(float) ? "float" : "double";
+}
+
+// the product of the matrix_multiplication quickstart example
+template <typename T>
+void quickstart_multiply(std::vector<T> const& a, std::vector<T> const& b,
+    std::vector<T>& c, std::size_t order)
+{
+    pika::for_loop(pika::execution::par, std::size_t(0), order,
+        [&](std::size_t i) {
+            pika::for_loop(std::size_t(0), order, [&](std::size_t j) {
+                c[i * order + j] = 0;
+                pika::for_loop(std::size_t(0), order, [&](std::size_t k) {
+                    c[i * order + j] += a[i * order + k] * b[k * order + j];
+                });
+            });
+        });
+}
+
+template <typename T>
+void measure(std::size_t order)
+{
+    std::vector<T> a(order * order);
+    std::vector<T> b(order * order);
+    std::vector<T> c(order * order);
+    for (std::size_t i = 0; i != a.size(); ++i)
+    {
+        a[i] = static_cast<T>(i % 7);
+        b[i] = static_cast<T>(i % 5);
+    }
+
+    std::string const suffix =
+        std::string("/") + type_name<T>() + "/" + std::to_string(order);
+    pika::util::perftests_throughput const work{3.0 * double(a.size()) *
+            sizeof(T),
+        2.0 * double(order) * double(order) * double(order)};
+
+    pika::util::perftests_report("quickstart" + suffix + "/par",
+        "parallel_executor", test_count, work,
+        [&]() { quickstart_multiply(a, b, c, order); });
+
+    pika::util::perftests_report("matrix_multiply" + suffix + "/seq", "none",
+        test_count, work, [&]() {
+            pika::matrix_multiply(pika::execution::seq, a.begin(), b.begin(),
+                c.begin(), order, order, order);
+        });
+
+    pika::util::perftests_report("matrix_multiply" + suffix + "/par",
+        "parallel_executor", test_count, work, [&]() {
+            pika::matrix_multiply(pika::execution::par, a.begin(), b.begin(),
+                c.begin(), order, order, order);
+        });
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    test_count = vm["test_count"].as<std::size_t>();
+
+    std::vector<std::size_t> orders = {256, 512, 1024};
+    if (vm.count("orders"))
+    {
+        orders = vm["orders"].as<std::vector<std::size_t>>();
+    }
+
+    if (test_count == 0)
+    {
+        std::cerr << "test_count must be positive\n";
+        return pika::finalize();
+    }
+
+    for (std::size_t order : orders)
+    {
+        measure<float>(order);
+        measure<double>(order);
+    }
+
+    pika::util::perftests_print_times();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("orders", value<std::vector<std::size_t>>()->multitoken(),
+         "orders of the square matrices (default: 256 512 1024)")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of repetitions of every measurement (default: 10)")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
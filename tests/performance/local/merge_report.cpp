@@ -0,0 +1,45 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of the merges of the two separately sorted halves of
+// the random input, see algorithm_report.hpp. inplace_merge merges a copy
+// of the halves, which is restored before every measurement.
+
+#include "algorithm_report.hpp"
+
+#include <vector>
+
+struct merge_family
+{
+    static constexpr bool datapar = false;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& halves = b.halves();
+        std::vector<T>& work = b.work();
+        std::vector<T>& dest = b.dest();
+        auto const middle = halves.begin() + b.size() / 2;
+
+        b.report("merge", policy, [&](auto const& p) {
+            return pika::merge(p, halves.begin(), middle, middle,
+                halves.end(), dest.begin());
+        });
+
+        b.report_restore(halves);
+        b.report("inplace_merge", policy, [&](auto const& p) {
+            b.restore(halves);
+            return pika::inplace_merge(
+                p, work.begin(), work.begin() + b.size() / 2, work.end());
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(merge_family{}, argc, argv);
+}
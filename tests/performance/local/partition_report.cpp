@@ -0,0 +1,50 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of partitioning the random input around its median, see
+// algorithm_report.hpp. partition and stable_partition work on a copy of
+// the input, which is restored before every measurement.
+
+#include "algorithm_report.hpp"
+
+#include <vector>
+
+struct partition_family
+{
+    static constexpr bool datapar = false;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& input = b.input();
+        std::vector<T>& work = b.work();
+        std::vector<T>& dest = b.dest();
+        auto pred = [median = static_cast<T>(b.size() / 2)](T value) {
+            return value < median;
+        };
+
+        b.report("partition_copy", policy, [&](auto const& p) {
+            return pika::partition_copy(p, input.begin(), input.end(),
+                dest.begin(), dest.begin() + b.size(), pred);
+        });
+
+        b.report_restore(input);
+        b.report("partition", policy, [&](auto const& p) {
+            b.restore(input);
+            return pika::partition(p, work.begin(), work.end(), pred);
+        });
+        b.report("stable_partition", policy, [&](auto const& p) {
+            b.restore(input);
+            return pika::stable_partition(p, work.begin(), work.end(), pred);
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(partition_family{}, argc, argv);
+}
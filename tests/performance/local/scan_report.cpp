@@ -0,0 +1,45 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of the scans of the random input, see
+// algorithm_report.hpp.
+
+#include "algorithm_report.hpp"
+
+#include <functional>
+#include <vector>
+
+struct scan_family
+{
+    static constexpr bool datapar = true;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& input = b.input();
+        std::vector<T>& dest = b.dest();
+
+        b.report("inclusive_scan", policy, [&](auto const& p) {
+            return pika::inclusive_scan(
+                p, input.begin(), input.end(), dest.begin());
+        });
+        b.report("exclusive_scan", policy, [&](auto const& p) {
+            return pika::exclusive_scan(
+                p, input.begin(), input.end(), dest.begin(), T(0));
+        });
+        b.report("transform_inclusive_scan", policy, [&](auto const& p) {
+            return pika::transform_inclusive_scan(p, input.begin(),
+                input.end(), dest.begin(), std::plus<>(),
+                [](auto const& value) { return value * value; });
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(scan_family{}, argc, argv);
+}
@@ -0,0 +1,53 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of the set operations on the two separately sorted
+// halves of the random input, see algorithm_report.hpp.
+
+#include "algorithm_report.hpp"
+
+#include <vector>
+
+struct set_operations_family
+{
+    static constexpr bool datapar = false;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& halves = b.halves();
+        std::vector<T>& dest = b.dest();
+        auto const first = halves.begin();
+        auto const middle = halves.begin() + b.size() / 2;
+        auto const last = halves.end();
+
+        b.report("set_union", policy, [&](auto const& p) {
+            return pika::set_union(
+                p, first, middle, middle, last, dest.begin());
+        });
+        b.report("set_intersection", policy, [&](auto const& p) {
+            return pika::set_intersection(
+                p, first, middle, middle, last, dest.begin());
+        });
+        b.report("set_difference", policy, [&](auto const& p) {
+            return pika::set_difference(
+                p, first, middle, middle, last, dest.begin());
+        });
+        b.report("set_symmetric_difference", policy, [&](auto const& p) {
+            return pika::set_symmetric_difference(
+                p, first, middle, middle, last, dest.begin());
+        });
+        b.report("includes", policy, [&](auto const& p) {
+            return pika::includes(p, first, middle, middle, last);
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(set_operations_family{}, argc, argv);
+}
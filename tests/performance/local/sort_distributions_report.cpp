@@ -0,0 +1,422 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of sort, stable_sort, sort_by_key and nth_element for
+// the input distributions the sorting algorithms are tuned for:
+//
+//     random         uniformly distributed values
+//     sorted         the random values in ascending order
+//     reversed       the random values in descending order
+//     organ_pipe     ascending values followed by descending values
+//     few_unique     values drawn from --few_unique distinct values
+//     zipf           values drawn from a Zipf distribution with exponent
+//                    --zipf_exponent over 2^16 distinct values
+//     nearly_sorted  sorted values with --nearly_sorted of them swapped
+//                    with random positions
+//
+// and the element types int, double, pair16 (a 16 byte key and payload),
+// record128 (a 128 byte record with a 8 byte key) and string (17
+// characters, allocated on the heap). The elements of pair16 and record128
+// are compared by their key only, equal keys keep their payload apart for
+// stable_sort. sort_by_key sorts the elements as keys of 32 bit values.
+//
+// The algorithms run with seq, par and par_unseq. With --baselines the
+// times of std::sort, std::stable_sort and std::nth_element are reported
+// as well, using std::execution::par if the standard library supports the
+// C++17 execution policies. Every combination is reported through
+// perftests_report, its name is
+// <algorithm>/<distribution>/<type>/<size>/<policy>.
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort_by_key.hpp>
+#include <pika/testing/performance.hpp>
+
+#if defined(PIKA_HAVE_CXX17_STD_EXECUTION_POLICIES)
+#include <execution>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The element types, constructed from a 31 bit key
+struct pair16
+{
+    std::uint64_t key;
+    std::uint64_t payload;
+
+    friend bool operator<(pair16 const& lhs, pair16 const& rhs) noexcept
+    {
+        return lhs.key < rhs.key;
+    }
+};
+
+struct record128
+{
+    std::uint64_t key;
+    std::uint64_t payload[15];
+
+    friend bool operator<(record128 const& lhs, record128 const& rhs) noexcept
+    {
+        return lhs.key < rhs.key;
+    }
+};
+
+template <typename T>
+struct element;
+
+template <>
+struct element<int>
+{
+    static constexpr char const* name = "int";
+
+    static int make(std::uint32_t key, std::size_t)
+    {
+        return static_cast<int>(key);
+    }
+};
+
+template <>
+struct element<double>
+{
+    static constexpr char const* name = "double";
+
+    static double make(std::uint32_t key, std::size_t)
+    {
+        return static_cast<double>(key) + 0.5;
+    }
+};
+
+template <>
+struct element<pair16>
+{
+    static constexpr char const* name = "pair16";
+
+    static pair16 make(std::uint32_t key, std::size_t index)
+    {
+        return pair16{key, index};
+    }
+};
+
+template <>
+struct element<record128>
+{
+    static constexpr char const* name = "record128";
+
+    static record128 make(std::uint32_t key, std::size_t index)
+    {
+        record128 r{};
+        r.key = key;
+        std::fill(std::begin(r.payload), std::end(r.payload), index);
+        return r;
+    }
+};
+
+template <>
+struct element<std::string>
+{
+    static constexpr char const* name = "string";
+
+    // a common prefix followed by the zero padded key, longer than the
+    // small string buffers of the standard libraries
+    static std::string make(std::uint32_t key, std::size_t)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "item-%012u",
+            static_cast<unsigned int>(key));
+        return buffer;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct distribution_options
+{
+    std::size_t few_unique;
+    double zipf_exponent;
+    double nearly_sorted;
+};
+
+char const* const distributions[] = {"random", "sorted", "reversed",
+    "organ_pipe", "few_unique", "zipf", "nearly_sorted"};
+
+// Returns the keys of the named distribution
+std::vector<std::uint32_t> make_keys(std::string const& distribution,
+    std::size_t size, distribution_options const& options, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint32_t> dis(0, 0x7fffffff);
+
+    std::vector<std::uint32_t> keys(size);
+    if (distribution == "organ_pipe")
+    {
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            keys[i] = static_cast<std::uint32_t>(i < size / 2 ? i : size - i);
+        }
+        return keys;
+    }
+
+    if (distribution == "few_unique")
+    {
+        std::uniform_int_distribution<std::uint32_t> few(0,
+            static_cast<std::uint32_t>(
+                options.few_unique == 0 ? 0 : options.few_unique - 1));
+        for (std::uint32_t& key : keys)
+        {
+            key = few(gen);
+        }
+        return keys;
+    }
+
+    if (distribution == "zipf")
+    {
+        // the ranks are scattered over the keys, the most frequent keys are
+        // not the smallest ones
+        std::size_t const ranks = std::size_t(1) << 16;
+        std::vector<double> weights(ranks);
+        for (std::size_t k = 0; k != ranks; ++k)
+        {
+            weights[k] = 1.0 / std::pow(double(k + 1), options.zipf_exponent);
+        }
+        std::discrete_distribution<std::uint32_t> zipf(
+            weights.begin(), weights.end());
+        for (std::uint32_t& key : keys)
+        {
+            key = (zipf(gen) * 2654435761u) & 0x7fffffff;
+        }
+        return keys;
+    }
+
+    for (std::uint32_t& key : keys)
+    {
+        key = dis(gen);
+    }
+
+    if (distribution == "sorted" || distribution == "nearly_sorted")
+    {
+        std::sort(keys.begin(), keys.end());
+    }
+    else if (distribution == "reversed")
+    {
+        std::sort(keys.begin(), keys.end(), std::greater<>());
+    }
+
+    if (distribution == "nearly_sorted" && size != 0)
+    {
+        std::uniform_int_distribution<std::size_t> pos(0, size - 1);
+        auto const swaps =
+            static_cast<std::size_t>(double(size) * options.nearly_sorted);
+        for (std::size_t i = 0; i != swaps; ++i)
+        {
+            std::swap(keys[pos(gen)], keys[pos(gen)]);
+        }
+    }
+    return keys;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class benchmark
+{
+public:
+    benchmark(std::string const& distribution,
+        std::vector<std::uint32_t> const& keys, std::size_t test_count)
+      : distribution_(distribution)
+      , test_count_(test_count)
+      , input_(keys.size())
+      , work_(keys.size())
+      , values_(keys.size())
+    {
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            input_[i] = element<T>::make(keys[i], i);
+        }
+    }
+
+    // Reports the time of f(), which sorts work after restoring the input.
+    // The throughput is reported for a single pass over the input.
+    template <typename F>
+    void report(std::string const& algorithm, char const* policy,
+        char const* executor, F&& f)
+    {
+        std::string const name = algorithm + "/" + distribution_ + "/" +
+            element<T>::name + "/" + std::to_string(input_.size()) + "/" +
+            policy;
+        pika::util::perftests_throughput const work{
+            2.0 * double(input_.size()) * sizeof(T), double(input_.size())};
+
+        pika::util::perftests_report(name, executor, test_count_, work, [&]() {
+            restore();
+            f(work_);
+        });
+    }
+
+    template <typename ExPolicy>
+    void run_policy(
+        ExPolicy const& policy, char const* policy_name, char const* executor)
+    {
+        auto const size = static_cast<std::ptrdiff_t>(input_.size());
+
+        // the time of restoring the input, which is included in the times
+        // of the algorithms
+        report("restore", policy_name, executor, [](std::vector<T>&) {});
+
+        report("sort", policy_name, executor, [&](std::vector<T>& work) {
+            pika::sort(policy, work.begin(), work.end());
+        });
+        report("stable_sort", policy_name, executor, [&](std::vector<T>& work) {
+            pika::stable_sort(policy, work.begin(), work.end());
+        });
+        report("sort_by_key", policy_name, executor, [&](std::vector<T>& work) {
+            std::iota(values_.begin(), values_.end(), std::uint32_t(0));
+            pika::sort_by_key(policy, work.begin(), work.end(), values_.begin());
+        });
+        report("nth_element", policy_name, executor, [&](std::vector<T>& work) {
+            pika::nth_element(
+                policy, work.begin(), work.begin() + size / 2, work.end());
+        });
+    }
+
+    void run(bool baselines)
+    {
+        using namespace pika::execution;
+
+        run_policy(seq, "seq", "none");
+        run_policy(par, "par", "parallel_executor");
+        run_policy(par_unseq, "par_unseq", "parallel_executor");
+
+        if (!baselines)
+        {
+            return;
+        }
+
+        auto const size = static_cast<std::ptrdiff_t>(input_.size());
+
+        report("std::sort", "seq", "std", [](std::vector<T>& work) {
+            std::sort(work.begin(), work.end());
+        });
+        report("std::stable_sort", "seq", "std", [](std::vector<T>& work) {
+            std::stable_sort(work.begin(), work.end());
+        });
+        report("std::nth_element", "seq", "std", [&](std::vector<T>& work) {
+            std::nth_element(work.begin(), work.begin() + size / 2, work.end());
+        });
+
+#if defined(PIKA_HAVE_CXX17_STD_EXECUTION_POLICIES)
+        report("std::sort", "par", "std", [](std::vector<T>& work) {
+            std::sort(std::execution::par, work.begin(), work.end());
+        });
+        report("std::stable_sort", "par", "std", [](std::vector<T>& work) {
+            std::stable_sort(std::execution::par, work.begin(), work.end());
+        });
+        report("std::nth_element", "par", "std", [&](std::vector<T>& work) {
+            std::nth_element(std::execution::par, work.begin(),
+                work.begin() + size / 2, work.end());
+        });
+#endif
+    }
+
+private:
+    // Copies the input to work in parallel
+    void restore()
+    {
+        pika::copy(
+            pika::execution::par, input_.begin(), input_.end(), work_.begin());
+    }
+
+    std::string distribution_;
+    std::size_t test_count_;
+    std::vector<T> input_;
+    std::vector<T> work_;
+    std::vector<std::uint32_t> values_;
+};
+
+template <typename T>
+void run_type(std::string const& distribution,
+    std::vector<std::uint32_t> const& keys, std::size_t test_count,
+    bool baselines)
+{
+    benchmark<T>(distribution, keys, test_count).run(baselines);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["size"].as<std::size_t>();
+    std::size_t const test_count = vm["test_count"].as<std::size_t>();
+    unsigned int const seed = vm["seed"].as<unsigned int>();
+    bool const baselines = vm.count("baselines") != 0;
+
+    distribution_options const options{vm["few_unique"].as<std::size_t>(),
+        vm["zipf_exponent"].as<double>(), vm["nearly_sorted"].as<double>()};
+
+    if (test_count == 0)
+    {
+        std::cerr << "test_count must be positive\n";
+        return pika::finalize();
+    }
+
+    for (char const* distribution : distributions)
+    {
+        std::vector<std::uint32_t> const keys =
+            make_keys(distribution, size, options, seed);
+
+        run_type<int>(distribution, keys, test_count, baselines);
+        run_type<double>(distribution, keys, test_count, baselines);
+        run_type<pair16>(distribution, keys, test_count, baselines);
+        run_type<record128>(distribution, keys, test_count, baselines);
+        run_type<std::string>(distribution, keys, test_count, baselines);
+    }
+
+    pika::util::perftests_print_times();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline("usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("size", value<std::size_t>()->default_value(262144),
+         "number of elements to sort (default: 262144)")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of repetitions of every measurement (default: 10)")
+        ("seed", value<unsigned int>()->default_value(0),
+         "seed of the random input values (default: 0)")
+        ("few_unique", value<std::size_t>()->default_value(16),
+         "number of distinct values of the few_unique distribution "
+         "(default: 16)")
+        ("zipf_exponent", value<double>()->default_value(1.0),
+         "exponent of the zipf distribution (default: 1.0)")
+        ("nearly_sorted", value<double>()->default_value(0.01),
+         "fraction of the elements swapped in the nearly_sorted "
+         "distribution (default: 0.01)")
+        ("baselines",
+         "also report std::sort, std::stable_sort and std::nth_element")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
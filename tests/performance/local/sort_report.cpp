@@ -0,0 +1,51 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of the sorting algorithms, see algorithm_report.hpp.
+// The algorithms sort a copy of the random input, which is restored before
+// every measurement.
+
+#include "algorithm_report.hpp"
+
+#include <cstddef>
+#include <vector>
+
+struct sort_family
+{
+    static constexpr bool datapar = false;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T>& work = b.work();
+        auto const middle = work.begin() + b.size() / 2;
+        auto const tenth = work.begin() + b.size() / 10;
+
+        b.report_restore(b.input());
+        b.report("sort", policy, [&](auto const& p) {
+            b.restore(b.input());
+            return pika::sort(p, work.begin(), work.end());
+        });
+        b.report("stable_sort", policy, [&](auto const& p) {
+            b.restore(b.input());
+            return pika::stable_sort(p, work.begin(), work.end());
+        });
+        b.report("partial_sort", policy, [&](auto const& p) {
+            b.restore(b.input());
+            return pika::partial_sort(p, work.begin(), tenth, work.end());
+        });
+        b.report("nth_element", policy, [&](auto const& p) {
+            b.restore(b.input());
+            return pika::nth_element(p, work.begin(), middle, work.end());
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(sort_family{}, argc, argv);
+}
@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of the synchronization primitives and the collective
+// operations of spmd_block for 1 to max_images images in the json format
+// of the performance tests. Every measurement launches the images once,
+// which call the primitive the given number of iterations in a loop. The
+// name of a series is the primitive, the executor field holds the variant
+// and the number of images.
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/runtime.hpp>
+#include <pika/testing/performance.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t iterations = 1000;
+int test_count = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+// make_step(block) returns the step every image calls iterations times
+template <typename ExPolicy, typename MakeStep>
+void report(std::string const& name, std::string const& variant,
+    ExPolicy const& policy, std::size_t num_images, MakeStep const& make_step)
+{
+    pika::util::perftests_report(name,
+        variant + "/" + std::to_string(num_images) + " images", test_count,
+        [&]() {
+            pika::define_spmd_block(
+                policy, num_images, [&](pika::spmd_block block) {
+                    auto step = make_step(block);
+                    for (std::size_t i = 0; i != iterations; ++i)
+                    {
+                        step(i);
+                    }
+                });
+        });
+}
+
+template <typename F>
+auto each_step(F f)
+{
+    return [f](pika::spmd_block const& block) {
+        return [&block, f](std::size_t i) { f(block, i); };
+    };
+}
+
+void report_images(std::size_t num_images, bool spin)
+{
+    using namespace pika::execution;
+
+    auto sync_all = each_step(
+        [](pika::spmd_block const& block, std::size_t) { block.sync_all(); });
+    report("spmd_block sync_all", "barrier", par, num_images, sync_all);
+    if (spin)
+    {
+        report("spmd_block sync_all", "spmd_spin_barrier",
+            par.with(spmd_spin_barrier()), num_images, sync_all);
+    }
+
+    // teams of the first 2, half and all of the images, through the team
+    // handle created once and through the set of images on every call
+    std::set<std::size_t> const team_sizes = {2, num_images / 2, num_images};
+    for (std::size_t size : team_sizes)
+    {
+        if (size < 2 || size > num_images)
+        {
+            continue;
+        }
+
+        std::set<std::size_t> images;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            images.insert(i);
+        }
+
+        std::string const team_size = "team of " + std::to_string(size);
+        report("spmd_block sync_images", team_size, par, num_images,
+            [&](pika::spmd_block const& block) {
+                return [&block, team = block.make_team(images)](
+                           std::size_t) { block.sync_images(team); };
+            });
+        report("spmd_block sync_images", team_size + " (set)", par,
+            num_images,
+            each_step([&](pika::spmd_block const& block, std::size_t) {
+                if (images.count(block.this_image()) != 0)
+                {
+                    block.sync_images(images);
+                }
+            }));
+    }
+
+    report("spmd_block sync_neighbors", "epochs", par, num_images,
+        each_step([](pika::spmd_block const& block, std::size_t) {
+            block.sync_neighbors();
+        }));
+
+    report("spmd_block all_reduce", "double", par, num_images,
+        each_step([](pika::spmd_block const& block, std::size_t i) {
+            block.all_reduce(static_cast<double>(i), std::plus<>());
+        }));
+
+    report("spmd_block broadcast", "double", par, num_images,
+        each_step([](pika::spmd_block const& block, std::size_t i) {
+            block.broadcast(
+                static_cast<double>(i), i % block.get_num_images());
+        }));
+
+    report("spmd_block inclusive_scan", "double", par, num_images,
+        each_step([](pika::spmd_block const& block, std::size_t i) {
+            block.inclusive_scan(static_cast<double>(i), std::plus<>());
+        }));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    std::size_t const max_images = vm["max_images"].as<std::size_t>();
+    iterations = vm["iterations"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return pika::finalize();
+    }
+
+    // the spinning barrier is only measured without oversubscription
+    std::size_t const num_threads = pika::get_num_worker_threads();
+    for (std::size_t num_images = 1; num_images <= max_images;
+         num_images *= 2)
+    {
+        report_images(num_images, num_images <= num_threads);
+    }
+
+    pika::util::perftests_print_times();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    pika::program_options::options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("max_images"
+        , pika::program_options::value<std::size_t>()->default_value(256)
+        , "largest number of images, the images are doubled starting at 1")
+
+        ("iterations"
+        , pika::program_options::value<std::size_t>()->default_value(1000)
+        , "number of calls of the primitive by every image per test")
+
+        ("test_count"
+        , pika::program_options::value<int>()->default_value(10)
+        , "number of tests to take the times of")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the time per step of spmd_block images which do a fixed amount
+// of work between two calls of sync_all, using the default barrier, which
+// suspends the waiting images, and the spinning barrier selected by the
+// spmd_spin_barrier executor parameters.
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/runtime.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+PIKA_FORCEINLINE void spin_for(std::uint64_t delay_ns)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+    while (std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::high_resolution_clock::now() - start)
+               .count() < static_cast<std::int64_t>(delay_ns))
+    {
+    }
+}
+
+void steps(pika::spmd_block block, std::size_t num_steps, std::uint64_t delay)
+{
+    for (std::size_t i = 0; i != num_steps; ++i)
+    {
+        spin_for(delay);
+        block.sync_all();
+    }
+}
+
+// returns the average time per step in seconds
+template <typename ExPolicy>
+double measure_steps(ExPolicy&& policy, std::size_t num_images,
+    std::size_t num_steps, std::uint64_t delay, int test_count)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        pika::define_spmd_block(policy, num_images, steps, num_steps, delay);
+    }
+
+    std::chrono::duration<double> const elapsed =
+        std::chrono::high_resolution_clock::now() - start;
+    return elapsed.count() / (test_count * num_steps);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    std::size_t num_images = vm["images"].as<std::size_t>();
+    std::size_t const num_steps = vm["steps"].as<std::size_t>();
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::size_t const spin_count = vm["spin_count"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return pika::finalize();
+    }
+
+    // one image per worker thread by default
+    if (num_images == 0)
+    {
+        num_images = pika::get_num_worker_threads();
+    }
+
+    using namespace pika::execution;
+
+    // warm up
+    measure_steps(par, num_images, num_steps, delay, 1);
+
+    double const suspend_time =
+        measure_steps(par, num_images, num_steps, delay, test_count);
+    double const spin_time =
+        measure_steps(par.with(spmd_spin_barrier(spin_count)), num_images,
+            num_steps, delay, test_count);
+
+    if (csvoutput)
+    {
+        std::cout << "suspend,spin\n"
+                  << suspend_time << "," << spin_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "sync_all(barrier): " << std::right << std::setw(15)
+                  << suspend_time << "\n"
+                  << "sync_all(spmd_spin_barrier): " << std::right
+                  << std::setw(15) << spin_time << "\n"
+                  << std::flush;
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    pika::program_options::options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("images"
+        , pika::program_options::value<std::size_t>()->default_value(0)
+        , "number of images (default: one per worker thread)")
+
+        ("steps"
+        , pika::program_options::value<std::size_t>()->default_value(10000)
+        , "number of steps separated by sync_all")
+
+        ("delay"
+        , pika::program_options::value<std::uint64_t>()->default_value(1000)
+        , "work per image and step in nanoseconds")
+
+        ("spin_count"
+        , pika::program_options::value<std::size_t>()->default_value(0)
+        , "pauses before yielding (default: the spmd_spin_barrier default)")
+
+        ("csv_output"
+        , pika::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , pika::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
@@ -15,6 +15,7 @@
 #include <pika/algorithm.hpp>
 #include <pika/execution.hpp>
 #include <pika/init.hpp>
+#include <pika/memory.hpp>
 #include <pika/thread.hpp>
 #include <pika/type_support/unused.hpp>
 #include <pika/version.hpp>
@@ -25,6 +26,7 @@
 #include <cstddef>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -312,17 +314,17 @@ struct triad_step
 };
 
 ///////////////////////////////////////////////////////////////////////////////
-template <typename Policy>
+template <typename Allocator, typename Policy>
 std::vector<std::vector<std::chrono::duration<double>>>
 run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
-    std::size_t size, Policy&& policy)
+    std::size_t size, Policy&& policy, Allocator const& alloc)
 {
     // Allocate our data
-    using vector_type = std::vector<STREAM_TYPE>;
+    using vector_type = std::vector<STREAM_TYPE, Allocator>;
 
-    vector_type a(size);
-    vector_type b(size);
-    vector_type c(size);
+    vector_type a(size, alloc);
+    vector_type b(size, alloc);
+    vector_type c(size, alloc);
 
     // Initialize arrays
     pika::fill(policy, a.begin(), a.end(), 1.0);
@@ -463,6 +465,8 @@ int pika_main(pika::program_options::variables_map& vm)
     std::size_t warmup_iterations = vm["warmup_iterations"].as<std::size_t>();
     std::size_t chunk_size = vm["chunk_size"].as<std::size_t>();
     std::size_t executor = vm["executor"].as<std::size_t>();
+    bool const non_temporal = vm.count("non_temporal") > 0;
+    bool const numa = vm.count("numa") > 0;
     csv = vm.count("csv") > 0;
     header = vm.count("header") > 0;
 
@@ -482,6 +486,12 @@ int pika_main(pika::program_options::variables_map& vm)
             "Invalid number of iterations given, must be at least 1");
     }
 
+    if (non_temporal && numa)
+    {
+        PIKA_THROW_EXCEPTION(pika::error::commandline_option_error, "pika_main",
+            "--non_temporal and --numa can not be combined");
+    }
+
     // clang-format off
     if (!csv)
     {
@@ -508,6 +518,8 @@ int pika_main(pika::program_options::variables_map& vm)
                 << pika::get_os_thread_count() << "\n"
             << "Chunking policy requested: " << chunker << "\n"
             << "Executor requested: " << executor << "\n"
+            << "Non-temporal stores: " << (non_temporal ? "yes" : "no") << "\n"
+            << "NUMA first touch placement: " << (numa ? "yes" : "no") << "\n"
             << "-------------------------------------------------------------\n"
             ;
     }
@@ -517,11 +529,29 @@ int pika_main(pika::program_options::variables_map& vm)
     auto start_total = high_resolution_clock::now();
     std::vector<std::vector<duration<double>>> timing;
 
+    // write the results of the kernels around the caches if requested, or
+    // first touch the arrays with the chunk placement used by the kernels
+    auto run = [&](auto&& policy) {
+        if (non_temporal)
+        {
+            return run_benchmark(warmup_iterations, iterations, vector_size,
+                policy.with(pika::execution::non_temporal_stores()),
+                std::allocator<STREAM_TYPE>());
+        }
+        if (numa)
+        {
+            pika::numa_allocator<STREAM_TYPE> alloc;
+            return run_benchmark(warmup_iterations, iterations, vector_size,
+                policy.with(alloc.placement()), alloc);
+        }
+        return run_benchmark(warmup_iterations, iterations, vector_size,
+            std::move(policy), std::allocator<STREAM_TYPE>());
+    };
+
     if (executor == 0)
     {
         // Default parallel policy with serial allocator.
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, pika::execution::par);
+        timing = run(pika::execution::par);
     }
     else if (executor == 1)
     {
@@ -529,9 +559,7 @@ int pika_main(pika::program_options::variables_map& vm)
         using executor_type = pika::execution::experimental::fork_join_executor;
 
         executor_type exec;
-        auto policy = pika::execution::par.on(exec);
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, std::move(policy));
+        timing = run(pika::execution::par.on(exec));
     }
     else if (executor == 2)
     {
@@ -540,9 +568,7 @@ int pika_main(pika::program_options::variables_map& vm)
             pika::execution::experimental::thread_pool_scheduler>;
 
         executor_type exec;
-        auto policy = pika::execution::par.on(exec);
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, std::move(policy));
+        timing = run(pika::execution::par.on(exec));
     }
     else
     {
@@ -679,6 +705,11 @@ int main(int argc, char* argv[])
         (   "executor",
             pika::program_options::value<std::size_t>()->default_value(2),
             "executor to use (0-2) (default: 0, parallel_executor)")
+        (   "non_temporal",
+            "write the results of the kernels with non-temporal stores")
+        (   "numa",
+            "place the arrays by first touch and run the kernels with the "
+            "same chunk placement")
         ;
     // clang-format on
 
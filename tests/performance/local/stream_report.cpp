@@ -379,25 +379,32 @@ auto run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
     pika::fill(policy, b.begin(), b.end(), 2.0);
     pika::fill(policy, c.begin(), c.end(), 0.0);
 
+    // The bytes moved and the floating point operations of the kernels,
+    // as counted by STREAM
+    double const bytes = double(size) * sizeof(STREAM_TYPE);
+    double const ops = double(size);
+
     // Copy
     pika::util::perftests_report("stream benchmark - Copy", exec_name,
-        iterations,
+        iterations, {2 * bytes, 0},
         [&]() { pika::copy(policy, a.begin(), a.end(), c.begin()); });
     // Scale
     pika::util::perftests_report(
-        "Stream benchmark - Scale", exec_name, iterations, [&]() {
+        "Stream benchmark - Scale", exec_name, iterations, {2 * bytes, ops},
+        [&]() {
             pika::transform(policy, c.begin(), c.end(), b.begin(),
                 multiply_step<STREAM_TYPE>(scalar));
         });
     // Add
     pika::util::perftests_report(
-        "Stream benchmark - Add", exec_name, iterations, [&]() {
+        "Stream benchmark - Add", exec_name, iterations, {3 * bytes, ops},
+        [&]() {
             pika::ranges::transform(policy, a.begin(), a.end(), b.begin(),
                 b.end(), c.begin(), add_step<STREAM_TYPE>());
         });
     // Triad
-    pika::util::perftests_report(
-        "Stream benchmark - Triad", exec_name, iterations, [&]() {
+    pika::util::perftests_report("Stream benchmark - Triad", exec_name,
+        iterations, {3 * bytes, 2 * ops}, [&]() {
             pika::ranges::transform(policy, b.begin(), b.end(), c.begin(),
                 c.end(), a.begin(), triad_step<STREAM_TYPE>(scalar));
         });
@@ -12,6 +12,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
@@ -20,31 +21,13 @@
 #include <string>
 #include <vector>
 
-struct plus
-{
-    template <typename T1, typename T2>
-    auto operator()(T1&& t1, T2&& t2) const -> decltype(t1 + t2)
-    {
-        return t1 + t2;
-    }
-};
-
-struct multiplies
-{
-    template <typename T1, typename T2>
-    auto operator()(T1&& t1, T2&& t2) const -> decltype(t1 * t2)
-    {
-        return t1 * t2;
-    }
-};
-
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy>
 float measure_inner_product(ExPolicy&& policy, std::vector<float> const& data1,
     std::vector<float> const& data2)
 {
     return pika::transform_reduce(policy, std::begin(data1), std::end(data1),
-        std::begin(data2), 0.0f, ::multiplies(), ::plus());
+        std::begin(data2), 0.0f, std::multiplies<>(), std::plus<>());
 }
 
 template <typename ExPolicy>
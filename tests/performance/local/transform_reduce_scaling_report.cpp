@@ -0,0 +1,78 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the strong and weak scaling of the inner product computed by
+// transform_reduce, see perftests_scaling. The strong scaling curves use
+// the given vector sizes, the weak scaling curves the given sizes per
+// thread.
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/numeric.hpp>
+#include <pika/testing/scaling.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("threads", value<std::vector<std::size_t>>()->multitoken(),
+         "numbers of threads (default: powers of two up to all cores)")
+        ("strong_sizes", value<std::vector<std::size_t>>()->multitoken(),
+         "vector sizes of the strong scaling curves (default: 1048576 "
+         "16777216)")
+        ("weak_sizes", value<std::vector<std::size_t>>()->multitoken(),
+         "vector sizes per thread of the weak scaling curves (default: "
+         "1048576)")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of repetitions of every measurement (default: 10)")
+        ;
+    // clang-format on
+
+    // the sweep is known before the runtime is started, the options of the
+    // runtime are parsed by pika::init
+    variables_map vm;
+    store(command_line_parser(argc, argv)
+              .options(cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+    notify(vm);
+
+    auto sizes = [&](char const* option, std::vector<std::size_t> sizes) {
+        return vm.count(option) ? vm[option].as<std::vector<std::size_t>>() :
+                                  sizes;
+    };
+
+    pika::util::perftests_scaling_options options;
+    if (vm.count("threads"))
+        options.threads = vm["threads"].as<std::vector<std::size_t>>();
+    options.strong_sizes = sizes("strong_sizes", {1048576, 16777216});
+    options.weak_sizes = sizes("weak_sizes", {1048576});
+    options.steps = vm["test_count"].as<std::size_t>();
+    options.init_args.desc_cmdline = cmdline;
+
+    return pika::util::perftests_scaling("transform_reduce", argc, argv,
+        PIKA_MOVE(options), [](variables_map&, std::size_t size) {
+            auto data1 = std::make_shared<std::vector<double>>(size, 1.0);
+            auto data2 = std::make_shared<std::vector<double>>(size, 2.0);
+            return [data1, data2]() {
+                pika::transform_reduce(pika::execution::par, data1->begin(),
+                    data1->end(), data2->begin(), 0.0, std::plus<>(),
+                    std::multiplies<>());
+            };
+        });
+}
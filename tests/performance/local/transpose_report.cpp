@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares pika::transpose to the hand written tiled transpose of the
+// transpose_smp_block example, a parallel loop over the rows of tiles of
+// the output with a scalar loop over the elements of every tile. Both are
+// reported through perftests_report for square float and double matrices,
+// the names are <variant>/<type>/<order>/<policy>.
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/modules/iterator_support.hpp>
+#include <pika/testing/performance.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_count = 10;
+std::size_t tile_size = 32;
+
+template <typename T>
+char const* type_name()
+{
+    return sizeof(T) == sizeof(float) ? "float" : "double";
+}
+
+// the transpose of the transpose_smp_block example for a single block
+template <typename T>
+void transpose_smp_block(
+    std::vector<T> const& a, std::vector<T>& b, std::size_t order)
+{
+    std::size_t const tiles = (order + tile_size - 1) / tile_size;
+    pika::ranges::for_each(pika::execution::par,
+        pika::detail::irange(std::size_t(0), tiles), [&](std::size_t ti) {
+            std::size_t const i = ti * tile_size;
+            std::size_t const i_max = (std::min)(order, i + tile_size);
+            for (std::size_t j = 0; j < order; j += tile_size)
+            {
+                std::size_t const j_max = (std::min)(order, j + tile_size);
+                for (std::size_t it = i; it < i_max; ++it)
+                {
+                    for (std::size_t jt = j; jt < j_max; ++jt)
+                    {
+                        b[it + order * jt] = a[jt + order * it];
+                    }
+                }
+            }
+        });
+}
+
+template <typename T>
+void measure(std::size_t order)
+{
+    std::vector<T> a(order * order);
+    std::vector<T> b(order * order);
+    for (std::size_t i = 0; i != a.size(); ++i)
+    {
+        a[i] = static_cast<T>(i);
+    }
+
+    std::string const suffix =
+        std::string("/") + type_name<T>() + "/" + std::to_string(order);
+    pika::util::perftests_throughput const work{
+        2.0 * double(a.size()) * sizeof(T), 0.0};
+
+    pika::util::perftests_report("transpose_smp_block" + suffix + "/par",
+        "parallel_executor", test_count, work,
+        [&]() { transpose_smp_block(a, b, order); });
+
+    pika::util::perftests_report("transpose" + suffix + "/seq", "none",
+        test_count, work, [&]() {
+            pika::transpose(pika::execution::seq, a.begin(), b.begin(), order,
+                order);
+        });
+
+    pika::util::perftests_report("transpose" + suffix + "/par",
+        "parallel_executor", test_count, work, [&]() {
+            pika::transpose(pika::execution::par, a.begin(), b.begin(), order,
+                order);
+        });
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    test_count = vm["test_count"].as<std::size_t>();
+    tile_size = vm["tile_size"].as<std::size_t>();
+
+    std::vector<std::size_t> orders = {1024, 4096};
+    if (vm.count("orders"))
+    {
+        orders = vm["orders"].as<std::vector<std::size_t>>();
+    }
+
+    if (test_count == 0 || tile_size == 0)
+    {
+        std::cerr << "test_count and tile_size must be positive\n";
+        return pika::finalize();
+    }
+
+    for (std::size_t order : orders)
+    {
+        measure<float>(order);
+        measure<double>(order);
+    }
+
+    pika::util::perftests_print_times();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace pika::program_options;
+
+    options_description cmdline(
+        "usage: " PIKA_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("orders", value<std::vector<std::size_t>>()->multitoken(),
+         "orders of the square matrices (default: 1024 4096)")
+        ("tile_size", value<std::size_t>()->default_value(32),
+         "tile size of the transpose_smp_block variant (default: 32)")
+        ("test_count", value<std::size_t>()->default_value(10),
+         "number of repetitions of every measurement (default: 10)")
+        ;
+    // clang-format on
+
+    pika::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return pika::init(pika_main, argc, argv, init_args);
+}
@@ -0,0 +1,43 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Reports the time of removing the consecutive duplicates of the sorted
+// input, see algorithm_report.hpp. unique works on a copy of the sorted
+// input, which is restored before every measurement.
+
+#include "algorithm_report.hpp"
+
+#include <vector>
+
+struct unique_family
+{
+    static constexpr bool datapar = false;
+
+    template <typename T, typename ExPolicy>
+    void operator()(
+        algorithm_report::benchmark<T>& b, ExPolicy const& policy) const
+    {
+        std::vector<T> const& sorted = b.sorted();
+        std::vector<T>& work = b.work();
+        std::vector<T>& dest = b.dest();
+
+        b.report("unique_copy", policy, [&](auto const& p) {
+            return pika::unique_copy(
+                p, sorted.begin(), sorted.end(), dest.begin());
+        });
+
+        b.report_restore(sorted);
+        b.report("unique", policy, [&](auto const& p) {
+            b.restore(sorted);
+            return pika::unique(p, work.begin(), work.end());
+        });
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    return algorithm_report::main(unique_family{}, argc, argv);
+}
@@ -0,0 +1,73 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "adjacenttransform_tests.hpp"
+
+void adjacent_transform_test()
+{
+    using namespace pika::execution;
+
+    test_adjacent_transform<int>(seq);
+    test_adjacent_transform<int>(par);
+    test_adjacent_transform<int>(par_unseq);
+    test_adjacent_transform<int>(par(task));
+
+    test_adjacent_transform<double>(seq);
+    test_adjacent_transform<double>(par);
+    test_adjacent_transform<double>(par(task));
+
+    // the halos of the chunks are read from the adjacent chunks
+    test_adjacent_transform<int>(par.with(static_chunk_size(3)));
+
+    test_adjacent_transform_exception(seq);
+    test_adjacent_transform_exception(par);
+    test_adjacent_transform_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    adjacent_transform_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/execution.hpp>
+#include <pika/parallel/algorithms/adjacent_transform.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+// an asymmetric filter, which detects any neighbour read from the wrong
+// position
+struct weighted_sum
+{
+    template <typename Window>
+    auto operator()(Window const& w) const
+    {
+        auto value = w[0] * 3;
+        for (long k = 1; k <= static_cast<long>(w.radius()); ++k)
+        {
+            value = value + w[-k] * 2 - w[k];
+        }
+        return value;
+    }
+};
+
+template <typename T>
+std::vector<T> adjacent_transform_reference(
+    std::vector<T> const& c, std::size_t radius)
+{
+    std::vector<T> d(c);
+    for (std::size_t i = radius; i + radius < c.size(); ++i)
+    {
+        T value = c[i] * 3;
+        for (std::size_t k = 1; k <= radius; ++k)
+        {
+            value = value + c[i - k] * 2 - c[i + k];
+        }
+        d[i] = value;
+    }
+    return d;
+}
+
+template <typename T, typename ExPolicy>
+void test_adjacent_transform(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 5, 7, 1007, 100007})
+    {
+        std::vector<T> c(size);
+        for (auto& v : c)
+        {
+            v = T(std::rand() % 1000);
+        }
+
+        for (std::size_t radius : {0, 1, 3, 8})
+        {
+            auto const expected = adjacent_transform_reference(c, radius);
+
+            std::vector<T> d(size);
+            auto it = test::run<ExPolicy>([&] {
+                return pika::adjacent_transform(policy, c.begin(), c.end(),
+                    d.begin(), radius, weighted_sum{});
+            });
+            PIKA_TEST(it == d.end());
+            PIKA_TEST(d == expected);
+        }
+    }
+
+    // functions taking the windows by their type are invoked one element
+    // at a time
+    std::vector<T> c(10007);
+    for (auto& v : c)
+    {
+        v = T(std::rand() % 1000);
+    }
+    using window_type =
+        pika::parallel::detail::adjacent_window<typename std::vector<T>::
+                const_iterator>;
+
+    std::vector<T> d(c.size());
+    test::run<ExPolicy>([&] {
+        return pika::adjacent_transform(policy, c.cbegin(),
+            c.cend(), d.begin(), 2, [](window_type const& w) {
+                PIKA_TEST_EQ(w.size(), std::size_t(5));
+                return weighted_sum{}(w);
+            });
+    });
+    PIKA_TEST(d == adjacent_transform_reference(c, 2));
+}
+
+template <typename ExPolicy>
+void test_adjacent_transform_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 1);
+    std::vector<int> d(c.size());
+
+    bool caught_exception = false;
+    try
+    {
+        auto r = pika::adjacent_transform(policy, c.begin(), c.end(),
+            d.begin(), 1, [](auto const&) -> int {
+                throw std::runtime_error("test");
+            });
+        test::run<ExPolicy>([&] { return PIKA_MOVE(r); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/batch.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// Creates ranges whose lengths follow a power law: most ranges are short or
+// empty, a few hold a large part of the elements. The elements are numbered
+// consecutively over all ranges.
+std::vector<std::vector<std::size_t>> make_ranges(
+    std::size_t num_ranges, double exponent)
+{
+    std::uniform_real_distribution<double> dis(0.0, 1.0);
+
+    std::vector<std::vector<std::size_t>> rngs(num_ranges);
+    std::size_t value = 0;
+    for (auto& rng : rngs)
+    {
+        // the length of the range is 1 / u^exponent - 1 for u uniform in
+        // (0, 1]
+        double const u = 1.0 - dis(gen);
+        double const length = std::min(std::pow(u, -exponent) - 1.0, 1e5);
+        rng.resize(std::size_t(length));
+        for (auto& v : rng)
+        {
+            v = value++;
+        }
+    }
+    return rngs;
+}
+
+template <typename ExPolicy>
+void test_for_each_batch(
+    ExPolicy policy, std::vector<std::vector<std::size_t>> rngs)
+{
+    auto expected = rngs;
+    for (auto& rng : expected)
+    {
+        for (auto& v : rng)
+        {
+            v = 2 * v + 1;
+        }
+    }
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::for_each_batch(policy, rngs.begin(), rngs.end(),
+            [](std::size_t& v) { v = 2 * v + 1; });
+    });
+    PIKA_TEST(result == rngs.end());
+    PIKA_TEST(rngs == expected);
+}
+
+// the elements of every range are combined in order
+template <typename ExPolicy>
+void test_transform_reduce_batch(
+    ExPolicy policy, std::vector<std::vector<std::size_t>> const& rngs)
+{
+    std::vector<std::string> expected(rngs.size());
+    std::vector<std::size_t> expected_sums(rngs.size());
+    for (std::size_t i = 0; i != rngs.size(); ++i)
+    {
+        expected[i] = "<";
+        for (std::size_t v : rngs[i])
+        {
+            expected[i] += char('a' + v % 26);
+            expected_sums[i] += v;
+        }
+    }
+
+    std::vector<std::string> d(rngs.size());
+    auto result = test::run<ExPolicy>([&] {
+        return pika::transform_reduce_batch(policy, rngs.begin(), rngs.end(),
+            d.begin(), std::string("<"), std::plus<>(), [](std::size_t v) {
+                return std::string(1, char('a' + v % 26));
+            });
+    });
+    PIKA_TEST(result == d.end());
+    PIKA_TEST(d == expected);
+
+    std::vector<std::size_t> sums(rngs.size());
+    test::run<ExPolicy>([&] {
+        return pika::transform_reduce_batch(policy, rngs.cbegin(),
+            rngs.cend(), sums.begin(), std::size_t(0), std::plus<>(),
+            [](std::size_t v) { return v; });
+    });
+    PIKA_TEST(sums == expected_sums);
+}
+
+template <typename ExPolicy>
+void test_batch(ExPolicy policy)
+{
+    // no ranges at all, only empty ranges and a single element
+    using ranges_type = std::vector<std::vector<std::size_t>>;
+    for (auto const& rngs : {ranges_type{}, ranges_type(100),
+             ranges_type{std::vector<std::size_t>{42}}})
+    {
+        test_for_each_batch(policy, rngs);
+        test_transform_reduce_batch(policy, rngs);
+    }
+
+    // from almost uniform to very skewed range lengths
+    for (double exponent : {0.5, 1.0, 1.5})
+    {
+        auto const rngs = make_ranges(10000, exponent);
+        test_for_each_batch(policy, rngs);
+        test_transform_reduce_batch(policy, rngs);
+    }
+
+    // a single range holding all elements between many empty ones
+    ranges_type rngs(2000);
+    rngs[1000].resize(1000000, 1);
+    test_for_each_batch(policy, rngs);
+    test_transform_reduce_batch(policy, rngs);
+}
+
+void test_batch()
+{
+    using namespace pika::execution;
+
+    test_batch(seq);
+    test_batch(par);
+    test_batch(par_unseq);
+    test_batch(par(task));
+
+    // sequential overloads
+    auto rngs = make_ranges(1000, 1.0);
+    std::size_t count = 0;
+    PIKA_TEST(pika::for_each_batch(rngs.begin(), rngs.end(),
+                  [&](std::size_t) { ++count; }) == rngs.end());
+
+    std::vector<std::size_t> lengths(rngs.size());
+    PIKA_TEST(pika::transform_reduce_batch(rngs.begin(), rngs.end(),
+                  lengths.begin(), std::size_t(0), std::plus<>(),
+                  [](std::size_t) { return std::size_t(1); }) ==
+        lengths.end());
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != rngs.size(); ++i)
+    {
+        PIKA_TEST_EQ(lengths[i], rngs[i].size());
+        total += lengths[i];
+    }
+    PIKA_TEST_EQ(count, total);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_batch();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/batched_search.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_batched_search(ExPolicy&& policy, std::vector<int> const& haystack,
+    std::vector<int> const& queries)
+{
+    using iterator = std::vector<int>::const_iterator;
+    std::size_t const count = queries.size();
+
+    std::vector<iterator> d(count + 1, haystack.end());
+    auto r = test::run<ExPolicy>([&] {
+        return pika::batched_lower_bound(policy, haystack.begin(),
+            haystack.end(), queries.begin(), queries.end(), d.begin());
+    });
+    PIKA_TEST(r == d.begin() + count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        PIKA_TEST(d[i] ==
+            std::lower_bound(haystack.begin(), haystack.end(), queries[i]));
+    }
+
+    r = test::run<ExPolicy>([&] {
+        return pika::batched_upper_bound(policy, haystack.begin(),
+            haystack.end(), queries.begin(), queries.end(), d.begin());
+    });
+    PIKA_TEST(r == d.begin() + count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        PIKA_TEST(d[i] ==
+            std::upper_bound(haystack.begin(), haystack.end(), queries[i]));
+    }
+
+    std::vector<std::pair<iterator, iterator>> e(count);
+    auto re = test::run<ExPolicy>([&] {
+        return pika::batched_equal_range(policy, haystack.begin(),
+            haystack.end(), queries.begin(), queries.end(), e.begin());
+    });
+    PIKA_TEST(re == e.end());
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        PIKA_TEST(e[i] ==
+            std::equal_range(haystack.begin(), haystack.end(), queries[i]));
+    }
+}
+
+template <typename ExPolicy>
+void test_batched_search_greater(ExPolicy&& policy)
+{
+    std::uniform_int_distribution<int> dis(0, 1000);
+
+    std::vector<int> haystack(100007);
+    std::generate(haystack.begin(), haystack.end(), [&] { return dis(gen); });
+    std::sort(haystack.begin(), haystack.end(), std::greater<>());
+
+    // sorted with respect to the comparison
+    std::vector<int> queries(10007);
+    std::generate(queries.begin(), queries.end(), [&] { return dis(gen); });
+    std::sort(queries.begin(), queries.end(), std::greater<>());
+
+    std::vector<std::vector<int>::iterator> d(queries.size());
+    test::run<ExPolicy>([&] {
+        return pika::batched_lower_bound(policy, haystack.begin(),
+            haystack.end(), queries.begin(), queries.end(), d.begin(),
+            std::greater<>());
+    });
+    for (std::size_t i = 0; i != queries.size(); ++i)
+    {
+        PIKA_TEST(d[i] ==
+            std::lower_bound(haystack.begin(), haystack.end(), queries[i],
+                std::greater<>()));
+    }
+}
+
+template <typename ExPolicy>
+void test_batched_search_exception(ExPolicy&& policy)
+{
+    std::vector<int> haystack(10007);
+    std::vector<int> queries(10007);
+    std::vector<std::vector<int>::iterator> d(queries.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::batched_lower_bound(policy, haystack.begin(),
+                haystack.end(), queries.begin(), queries.end(), d.begin(),
+                [](int, int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_batched_search()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 17, 100007})
+    {
+        // few distinct values produce long ranges of equivalent elements
+        for (int max_value : {3, 1000000})
+        {
+            std::uniform_int_distribution<int> dis(-1, max_value + 1);
+
+            std::vector<int> haystack(size);
+            std::generate(
+                haystack.begin(), haystack.end(), [&] { return dis(gen); });
+            std::sort(haystack.begin(), haystack.end());
+
+            for (std::size_t num_queries : {0, 1, 15, 10007})
+            {
+                std::vector<int> queries(num_queries);
+                std::generate(
+                    queries.begin(), queries.end(), [&] { return dis(gen); });
+
+                test_batched_search(seq, haystack, queries);
+                test_batched_search(par, haystack, queries);
+                test_batched_search(par(task), haystack, queries);
+
+                std::sort(queries.begin(), queries.end());
+
+                test_batched_search(seq, haystack, queries);
+                test_batched_search(par, haystack, queries);
+                test_batched_search(par_unseq, haystack, queries);
+            }
+        }
+    }
+
+    test_batched_search_greater(seq);
+    test_batched_search_greater(par);
+
+    test_batched_search_exception(par);
+    test_batched_search_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_batched_search();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// equal, mismatch, lexicographical_compare and find compare contiguous ranges
+// of bitwise comparable types with std::memcmp and std::memchr
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/equal.hpp>
+#include <pika/parallel/algorithms/find.hpp>
+#include <pika/parallel/algorithms/lexicographical_compare.hpp>
+#include <pika/parallel/algorithms/mismatch.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+enum class color : unsigned char
+{
+    red,
+    green,
+    blue
+};
+
+static_assert(pika::traits::is_bitwise_comparable_v<unsigned char>);
+static_assert(pika::traits::is_bitwise_comparable_v<std::byte const>);
+static_assert(pika::traits::is_bitwise_comparable_v<color>);
+static_assert(pika::traits::is_bitwise_comparable_v<int*>);
+static_assert(!pika::traits::is_bitwise_comparable_v<double>);
+
+template <typename T>
+T make_value(unsigned int i)
+{
+    return static_cast<T>(i % 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_bitwise_comparable(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c1(size);
+    for (T& value : c1)
+    {
+        value = make_value<T>(gen());
+    }
+    std::vector<T> c2 = c1;
+
+    // the ranges are equal, or differ at a random position
+    std::size_t const pos = size == 0 ? 0 : gen() % (size + 1);
+    if (pos != size)
+    {
+        c2[pos] = make_value<T>(unsigned(c2[pos]) + 1);
+    }
+
+    bool const equal = test::run<ExPolicy>([&] {
+        return pika::equal(policy, c1.begin(), c1.end(), c2.begin());
+    });
+    PIKA_TEST_EQ(equal, pos == size);
+
+    auto const mismatch = test::run<ExPolicy>([&] {
+        return pika::mismatch(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end());
+    });
+    PIKA_TEST(mismatch.first == c1.begin() + pos);
+    PIKA_TEST(mismatch.second == c2.begin() + pos);
+
+    bool const less = test::run<ExPolicy>([&] {
+        return pika::lexicographical_compare(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end());
+    });
+    PIKA_TEST_EQ(less,
+        std::lexicographical_compare(
+            c1.begin(), c1.end(), c2.begin(), c2.end()));
+
+    bool const greater = test::run<ExPolicy>([&] {
+        return pika::lexicographical_compare(policy, c1.begin(), c1.end(),
+            c2.begin(), c2.end(), std::greater<>());
+    });
+    PIKA_TEST_EQ(greater,
+        std::lexicographical_compare(c1.begin(), c1.end(), c2.begin(),
+            c2.end(), std::greater<>()));
+
+    // the searched value occurs only at pos
+    if constexpr (sizeof(T) == 1)
+    {
+        T const value = static_cast<T>(7);
+        if (pos != size)
+        {
+            c1[pos] = value;
+        }
+        auto const found = test::run<ExPolicy>([&] {
+            return pika::find(policy, c1.begin(), c1.end(), value);
+        });
+        PIKA_TEST(found == c1.begin() + pos);
+    }
+}
+
+// integral values the elements can't represent are never found
+template <typename ExPolicy>
+void test_find_converted(ExPolicy policy)
+{
+    std::vector<signed char> c(100007, 1);
+    c[5000] = -56;
+    c[6000] = 100;
+
+    PIKA_TEST(pika::find(policy, c.begin(), c.end(), 200) == c.end());
+    PIKA_TEST(pika::find(policy, c.begin(), c.end(), -56) == c.begin() + 5000);
+    PIKA_TEST(pika::find(policy, c.begin(), c.end(), 100L) == c.begin() + 6000);
+}
+
+template <typename ExPolicy>
+void test_bitwise_comparable(ExPolicy policy)
+{
+    for (std::size_t size : {0, 1, 1000, 4097, 100007, 1000003})
+    {
+        test_bitwise_comparable<unsigned char>(policy, size);
+        test_bitwise_comparable<std::byte>(policy, size);
+        test_bitwise_comparable<color>(policy, size);
+        test_bitwise_comparable<int>(policy, size);
+    }
+}
+
+void bitwise_comparable_test()
+{
+    using namespace pika::execution;
+
+    test_bitwise_comparable(seq);
+    test_bitwise_comparable(par);
+    test_bitwise_comparable(par_unseq);
+    test_bitwise_comparable(seq(task));
+    test_bitwise_comparable(par(task));
+
+    test_find_converted(seq);
+    test_find_converted(par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    bitwise_comparable_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+namespace ex = pika::execution::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_chunk_pipeline(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> x(size);
+    std::iota(x.begin(), x.end(), int(gen() % 1000));
+    std::vector<int> y(size);
+    std::vector<int> z(size, -1);
+    std::vector<int> w(size, -1);
+
+    std::vector<int> expected(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[i] = 2 * x[i] + 1 + x[i];
+    }
+
+    auto twice = [](int value) { return 2 * value; };
+    auto increment = [](int& value) { ++value; };
+
+    // y = 2 x, y += 1, z = y + x, w = z
+    test::run<ExPolicy>([&] {
+        return pika::chunk_pipeline(policy, size,
+            pika::chunked(pika::transform, x.begin(), y.begin(), twice),
+            pika::chunked(pika::for_each, y.begin(), increment),
+            pika::chunked(pika::transform, y.begin(), x.begin(), z.begin(),
+                std::plus<>()),
+            pika::chunked(pika::copy, z.begin(), w.begin()));
+    });
+    PIKA_TEST(z == expected);
+    PIKA_TEST(w == expected);
+
+    test::run<ExPolicy>([&] {
+        return pika::chunk_pipeline(policy, size,
+            pika::chunked(pika::fill, z.begin(), 0),
+            pika::chunked(pika::fill, w.begin(), 0));
+    });
+    PIKA_TEST(std::count(z.begin(), z.end(), 0) == std::ptrdiff_t(size));
+
+    // the same pipeline sent by a predecessor sender
+    tt::sync_wait(ex::just(size,
+                      pika::chunked(
+                          pika::transform, x.begin(), y.begin(), twice),
+                      pika::chunked(pika::for_each, y.begin(), increment),
+                      pika::chunked(pika::transform, y.begin(), x.begin(),
+                          z.begin(), std::plus<>()),
+                      pika::chunked(pika::copy, z.begin(), w.begin())) |
+        pika::chunk_pipeline(policy));
+    PIKA_TEST(z == expected);
+    PIKA_TEST(w == expected);
+}
+
+template <typename ExPolicy>
+void test_chunk_pipeline_exception(ExPolicy&& policy)
+{
+    std::vector<int> x(10007, 1);
+    std::vector<int> y(x.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::chunk_pipeline(policy, x.size(),
+                pika::chunked(pika::copy, x.begin(), y.begin()),
+                pika::chunked(pika::for_each, y.begin(),
+                    [](int) { throw std::runtime_error("test"); }));
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void chunk_pipeline_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_chunk_pipeline(seq, size);
+        test_chunk_pipeline(par, size);
+        test_chunk_pipeline(par_unseq, size);
+        test_chunk_pipeline(par(task), size);
+    }
+
+    // the overload without a policy and a negative count
+    std::vector<int> x(3000, 1);
+    pika::chunk_pipeline(x.size(), pika::chunked(pika::fill, x.begin(), 2));
+    PIKA_TEST(std::all_of(
+        x.begin(), x.end(), [](int value) { return value == 2; }));
+    pika::chunk_pipeline(par, -1, pika::chunked(pika::fill, x.begin(), 3));
+    PIKA_TEST(std::all_of(
+        x.begin(), x.end(), [](int value) { return value == 2; }));
+
+    test_chunk_pipeline_exception(seq);
+    test_chunk_pipeline_exception(par);
+    test_chunk_pipeline_exception(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    chunk_pipeline_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/algorithms/traits/is_contiguous_iterator.hpp>
+#include <pika/algorithms/traits/pointer_category.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/move.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<span>)
+#include <span>
+
+#include "test_utils.hpp"
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// An iterator of a user container storing its elements contiguously, it
+// declares so through its iterator_concept only.
+template <typename T>
+struct user_iterator
+{
+    using iterator_category = std::random_access_iterator_tag;
+#if defined(__cpp_lib_concepts)
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    T* p = nullptr;
+
+    T& operator*() const { return *p; }
+    T* operator->() const { return p; }
+    T& operator[](difference_type n) const { return p[n]; }
+
+    user_iterator& operator++()
+    {
+        ++p;
+        return *this;
+    }
+    user_iterator operator++(int) { return user_iterator{p++}; }
+    user_iterator& operator--()
+    {
+        --p;
+        return *this;
+    }
+    user_iterator operator--(int) { return user_iterator{p--}; }
+    user_iterator& operator+=(difference_type n)
+    {
+        p += n;
+        return *this;
+    }
+    user_iterator& operator-=(difference_type n)
+    {
+        p -= n;
+        return *this;
+    }
+
+    friend user_iterator operator+(user_iterator it, difference_type n)
+    {
+        return user_iterator{it.p + n};
+    }
+    friend user_iterator operator+(difference_type n, user_iterator it)
+    {
+        return user_iterator{it.p + n};
+    }
+    friend user_iterator operator-(user_iterator it, difference_type n)
+    {
+        return user_iterator{it.p - n};
+    }
+    friend difference_type operator-(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p - rhs.p;
+    }
+
+    friend bool operator==(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p == rhs.p;
+    }
+    friend bool operator!=(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p != rhs.p;
+    }
+    friend bool operator<(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p < rhs.p;
+    }
+    friend bool operator>(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p > rhs.p;
+    }
+    friend bool operator<=(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p <= rhs.p;
+    }
+    friend bool operator>=(user_iterator lhs, user_iterator rhs)
+    {
+        return lhs.p >= rhs.p;
+    }
+};
+
+static_assert(pika::detail::is_contiguous_iterator_v<int*>);
+static_assert(
+    pika::detail::is_contiguous_iterator_v<std::vector<int>::iterator>);
+
+#if defined(__cpp_lib_concepts)
+static_assert(pika::detail::is_contiguous_iterator_v<user_iterator<int>>);
+static_assert(
+    std::is_same_v<pika::detail::pointer_copy_category_t<
+                       user_iterator<int const>, user_iterator<int>>,
+        pika::detail::trivially_copyable_pointer_tag>);
+#if defined(__cpp_lib_span)
+static_assert(
+    pika::detail::is_contiguous_iterator_v<std::span<int>::iterator>);
+#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_copy_contiguous(ExPolicy policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), static_cast<int>(gen() % 1000));
+
+    // the element following the destination sequence is not written
+    std::vector<int> d(size + 1, -1);
+    user_iterator<int const> first{c.data()};
+    user_iterator<int const> last{c.data() + size};
+    auto result = test::run<ExPolicy>([&] {
+        return pika::copy(policy, first, last, user_iterator<int>{d.data()});
+    });
+    PIKA_TEST(result.p == d.data() + size);
+    PIKA_TEST(std::equal(c.begin(), c.end(), d.begin()));
+    PIKA_TEST_EQ(d[size], -1);
+
+    std::vector<int> e(size + 1, -1);
+    auto result_n = test::run<ExPolicy>([&] {
+        return pika::copy_n(policy, user_iterator<int>{d.data()}, size,
+            user_iterator<int>{e.data()});
+    });
+    PIKA_TEST(result_n.p == e.data() + size);
+    PIKA_TEST(std::equal(c.begin(), c.end(), e.begin()));
+    PIKA_TEST_EQ(e[size], -1);
+
+#if defined(__cpp_lib_span)
+    std::vector<int> f(size + 1, -1);
+    std::span<int> source(e.data(), size);
+    std::span<int> dest(f.data(), size);
+    auto result_move = test::run<ExPolicy>([&] {
+        return pika::move(policy, source.begin(), source.end(), dest.begin());
+    });
+    PIKA_TEST(result_move == dest.end());
+    PIKA_TEST(std::equal(c.begin(), c.end(), f.begin()));
+    PIKA_TEST_EQ(f[size], -1);
+#endif
+}
+
+void copy_contiguous_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 127, 100007})
+    {
+        test_copy_contiguous(seq, size);
+        test_copy_contiguous(par, size);
+        test_copy_contiguous(par_unseq, size);
+        test_copy_contiguous(seq(task), size);
+        test_copy_contiguous(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    copy_contiguous_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/algorithms/traits/contiguous_segments.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/move.hpp>
+#include <pika/parallel/algorithms/uninitialized_copy.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+#if defined(__GLIBCXX__)
+static_assert(
+    pika::traits::has_contiguous_segments_v<std::deque<int>::iterator>);
+static_assert(
+    pika::traits::has_contiguous_segments_v<std::deque<int>::const_iterator>);
+#endif
+static_assert(!pika::traits::has_contiguous_segments_v<int*>);
+
+// A deque holding the values offset, offset + 1, ... whose first element is
+// not at the start of a block.
+std::deque<int> make_deque(std::size_t size, int offset)
+{
+    std::deque<int> d(size);
+    std::iota(d.begin(), d.end(), offset);
+    for (int i = 0; i != 3; ++i)
+    {
+        d.push_front(-1);
+    }
+    d.erase(d.begin(), d.begin() + 3);
+    return d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_copy_segmented(ExPolicy policy, std::size_t size)
+{
+    int const offset = static_cast<int>(gen() % 1000);
+    std::deque<int> d = make_deque(size, offset);
+
+    // out of the deque, the element following the sequence is not written
+    std::vector<int> v(size + 1, -1);
+    auto result = test::run<ExPolicy>(
+        [&] { return pika::copy(policy, d.cbegin(), d.cend(), v.begin()); });
+    PIKA_TEST(result == v.begin() + size);
+    PIKA_TEST(std::equal(d.begin(), d.end(), v.begin()));
+    PIKA_TEST_EQ(v[size], -1);
+
+    // into a deque
+    std::deque<int> d2(size + 1, -1);
+    auto result_n = test::run<ExPolicy>(
+        [&] { return pika::copy_n(policy, v.begin(), size, d2.begin()); });
+    PIKA_TEST(result_n == d2.begin() + size);
+    PIKA_TEST(std::equal(d.begin(), d.end(), d2.begin()));
+    PIKA_TEST_EQ(d2[size], -1);
+
+    // between deques
+    std::deque<int> d3 = make_deque(size, 0);
+    auto result_move = test::run<ExPolicy>([&] {
+        return pika::move(policy, d2.begin(), d2.end() - 1, d3.begin());
+    });
+    PIKA_TEST(result_move == d3.end());
+    PIKA_TEST(std::equal(d.begin(), d.end(), d3.begin()));
+
+    // into uninitialized memory
+    std::allocator<int> alloc;
+    int* p = alloc.allocate(size + 1);
+    p[size] = -1;
+    auto result_uninit = test::run<ExPolicy>([&] {
+        return pika::uninitialized_copy(policy, d.begin(), d.end(), p);
+    });
+    PIKA_TEST(result_uninit == p + size);
+    PIKA_TEST(std::equal(d.begin(), d.end(), p));
+    PIKA_TEST_EQ(p[size], -1);
+    alloc.deallocate(p, size + 1);
+}
+
+void copy_segmented_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 127, 129, 100007})
+    {
+        test_copy_segmented(seq, size);
+        test_copy_segmented(par, size);
+        test_copy_segmented(par_unseq, size);
+        test_copy_segmented(seq(task), size);
+        test_copy_segmented(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    copy_segmented_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -12,6 +12,7 @@
 #include <pika/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -19,6 +20,7 @@
 #include <iostream>
 #include <random>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #if defined(PIKA_ALGORITHMS_DEBUG)
@@ -249,6 +251,140 @@ void test7()
         B[1000 + NELEM] == 999999999 && B[1001 + NELEM] == 999999999);
 }
 
+// the number of merge intervals is bounded by the size of the cache and by
+// the number of samples, the sizes around the points where the bounds take
+// effect are sorted
+struct big_element
+{
+    std::uint64_t key;
+    char payload[4088];
+
+    bool operator<(big_element const& other) const
+    {
+        return key < other.key;
+    }
+};
+
+template <typename T>
+void test_sample_sort_intervals(std::size_t nelem, std::size_t chunk_size)
+{
+    std::mt19937_64 my_rand(std::rand());
+
+    std::vector<T> V(nelem);
+    for (std::size_t i = 0; i < nelem; ++i)
+    {
+        std::uint64_t const key = my_rand() % (nelem / 2 + 1);
+        if constexpr (std::is_same_v<T, big_element>)
+        {
+            V[i].key = key;
+            V[i].payload[0] = char(i % 128);
+        }
+        else
+        {
+            V[i] = key;
+        }
+    }
+    std::vector<T> expected = V;
+    std::stable_sort(expected.begin(), expected.end());
+
+    sample_sort(parallel_executor{}, V.begin(), V.end(), std::less<T>(), 2,
+        (T*) nullptr, std::size_t(0), chunk_size);
+
+    for (std::size_t i = 0; i < nelem; ++i)
+    {
+        if constexpr (std::is_same_v<T, big_element>)
+        {
+            PIKA_TEST(V[i].key == expected[i].key &&
+                V[i].payload[0] == expected[i].payload[0]);
+        }
+        else
+        {
+            PIKA_TEST(V[i] == expected[i]);
+        }
+    }
+}
+
+void test8()
+{
+    // with two threads at least 16 intervals are used, more once they would
+    // not fit into the cache (at 16 * 32769 elements of 8 bytes) ...
+    PIKA_TEST_EQ(sample_sort_num_intervals(524303, 8, 2), 16u);
+    PIKA_TEST_EQ(sample_sort_num_intervals(524304, 8, 2), 17u);
+    for (std::size_t nelem : {524303, 524304, 524305})
+    {
+        test_sample_sort_intervals<std::uint64_t>(
+            nelem, sample_sort_limit_per_task());
+    }
+
+    // ... but never more than one per 128 elements (a 64th of the elements
+    // per thread)
+    PIKA_TEST_EQ(sample_sort_num_intervals(2175, 4096, 2), 16u);
+    PIKA_TEST_EQ(sample_sort_num_intervals(2176, 4096, 2), 17u);
+    for (std::size_t nelem : {2047, 2048, 2049, 2175, 2176, 2177})
+    {
+        test_sample_sort_intervals<big_element>(nelem, 1024);
+    }
+}
+
+// the samples of skewed keys or keys with many duplicates select the same
+// splitters several times, leaving intervals empty
+struct keyed
+{
+    std::uint64_t key;
+    std::uint32_t index;
+};
+
+void test_sample_sort_skewed(std::vector<std::uint64_t> const& keys)
+{
+    std::vector<keyed> V(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        V[i] = keyed{keys[i], std::uint32_t(i)};
+    }
+    std::vector<keyed> expected = V;
+
+    auto comp = [](keyed const& lhs, keyed const& rhs) {
+        return lhs.key < rhs.key;
+    };
+    std::stable_sort(expected.begin(), expected.end(), comp);
+    sample_sort(parallel_executor{}, V.begin(), V.end(), comp,
+        (std::uint32_t) pika::threads::detail::hardware_concurrency());
+
+    for (std::size_t i = 0; i < V.size(); ++i)
+    {
+        PIKA_TEST(V[i].key == expected[i].key &&
+            V[i].index == expected[i].index);
+    }
+}
+
+void test9()
+{
+    constexpr std::uint32_t NElem = NUMELEMS;
+    std::mt19937_64 my_rand(std::rand());
+    std::vector<std::uint64_t> keys(NElem);
+
+    // a few distinct keys
+    for (auto& key : keys)
+        key = my_rand() % 4;
+    test_sample_sort_skewed(keys);
+
+    // almost all keys are equal
+    for (auto& key : keys)
+        key = my_rand() % 100 == 0 ? my_rand() : 42;
+    test_sample_sort_skewed(keys);
+
+    // the keys are exponentially distributed
+    std::exponential_distribution<double> dis(1.0);
+    for (auto& key : keys)
+        key = std::uint64_t(dis(my_rand) * 1000.0);
+    test_sample_sort_skewed(keys);
+
+    // the largest key is duplicated in the upper half
+    for (std::uint32_t i = 0; i < NElem; ++i)
+        keys[i] = i < NElem / 2 ? my_rand() % NElem : NElem;
+    test_sample_sort_skewed(keys);
+}
+
 int pika_main(pika::program_options::variables_map& vm)
 {
     unsigned int seed = (unsigned int) std::time(nullptr);
@@ -263,6 +399,8 @@ int pika_main(pika::program_options::variables_map& vm)
     test5();
     test6();
     test7();
+    test8();
+    test9();
 
     return pika::finalize();
 }
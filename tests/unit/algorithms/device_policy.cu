@@ -0,0 +1,228 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/cuda.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/device_policy.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cu = pika::cuda::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// Device memory holding a copy of a host vector.
+template <typename T>
+struct device_vector
+{
+    explicit device_vector(std::vector<T> const& values)
+      : size(values.size())
+    {
+        cu::check_cuda_error(cudaMalloc(&data, (size + 1) * sizeof(T)));
+        cu::check_cuda_error(cudaMemcpy(data, values.data(),
+            size * sizeof(T), cudaMemcpyHostToDevice));
+    }
+
+    device_vector(device_vector const&) = delete;
+    device_vector& operator=(device_vector const&) = delete;
+
+    ~device_vector()
+    {
+        cudaFree(data);
+    }
+
+    std::vector<T> get() const
+    {
+        std::vector<T> values(size);
+        cu::check_cuda_error(cudaMemcpy(values.data(), data,
+            size * sizeof(T), cudaMemcpyDeviceToHost));
+        return values;
+    }
+
+    T* begin() const
+    {
+        return data;
+    }
+
+    T* end() const
+    {
+        return data + size;
+    }
+
+    T* data = nullptr;
+    std::size_t size;
+};
+
+struct increment
+{
+    __device__ void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+struct twice
+{
+    __device__ long operator()(int value) const
+    {
+        return 2 * long(value);
+    }
+};
+
+struct plus
+{
+    template <typename T, typename U>
+    __device__ auto operator()(T const& lhs, U const& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+struct maximum
+{
+    __device__ int operator()(int lhs, int rhs) const
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_elementwise(pika::execution::device_policy const& policy,
+    std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    device_vector<int> v(values);
+    tt::sync_wait(pika::for_each(policy, v.begin(), v.end(), increment()));
+    std::vector<int> const incremented = v.get();
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(incremented[i], int(i + 1));
+    }
+
+    device_vector<long> w(std::vector<long>(size));
+    long* dest_last = tt::sync_wait(
+        pika::transform(policy, v.begin(), v.end(), w.begin(), twice()));
+    PIKA_TEST(dest_last == w.end());
+    std::vector<long> const doubled = w.get();
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(doubled[i], 2 * long(i + 1));
+    }
+}
+
+void test_reduce(pika::execution::device_policy const& policy,
+    std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 1);
+    device_vector<int> v(values);
+
+    std::int64_t const sum = tt::sync_wait(
+        pika::reduce(policy, v.begin(), v.end(), std::int64_t(7)));
+    PIKA_TEST_EQ(sum, std::int64_t(7) + std::int64_t(size) * (size + 1) / 2);
+
+    int const max =
+        tt::sync_wait(pika::reduce(policy, v.begin(), v.end(), -1, maximum()));
+    PIKA_TEST_EQ(max, size == 0 ? -1 : int(size));
+}
+
+void test_scan(pika::execution::device_policy const& policy,
+    std::size_t size)
+{
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    std::vector<int> values(size);
+    std::generate(values.begin(), values.end(), [&]() { return dist(gen); });
+
+    std::vector<std::int64_t> expected(size);
+    device_vector<int> v(values);
+    device_vector<std::int64_t> w(expected);
+
+    tt::sync_wait(pika::inclusive_scan(policy, v.begin(), v.end(), w.begin(),
+        plus(), std::int64_t(0)));
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(),
+        std::plus<>(), std::int64_t(0));
+    PIKA_TEST(w.get() == expected);
+
+    tt::sync_wait(pika::exclusive_scan(
+        policy, v.begin(), v.end(), w.begin(), std::int64_t(3)));
+    std::exclusive_scan(
+        values.begin(), values.end(), expected.begin(), std::int64_t(3));
+    PIKA_TEST(w.get() == expected);
+
+    // in place
+    tt::sync_wait(pika::inclusive_scan(policy, v.begin(), v.end(), v.begin()));
+    std::inclusive_scan(values.begin(), values.end(), values.begin());
+    PIKA_TEST(v.get() == values);
+}
+
+template <typename T>
+void test_sort(pika::execution::device_policy const& policy,
+    std::size_t size)
+{
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    std::vector<T> values(size);
+    std::generate(
+        values.begin(), values.end(), [&]() { return T(dist(gen)) / T(3); });
+
+    device_vector<T> v(values);
+    tt::sync_wait(pika::sort(policy, v.begin(), v.end()));
+    std::sort(values.begin(), values.end());
+    PIKA_TEST(v.get() == values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    {
+        cu::enable_user_polling poll("default");
+
+        pika::execution::device_policy policy(
+            cu::cuda_scheduler(cu::cuda_pool()));
+
+        for (std::size_t size : {0, 1, 17, 1024, 1025, 100007, 1000003})
+        {
+            test_elementwise(policy, size);
+            test_reduce(policy, size);
+            test_scan(policy, size);
+            test_sort<int>(policy, size);
+            test_sort<unsigned>(policy, size);
+            test_sort<double>(policy, size);
+        }
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/cuda.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/device_streaming_policy.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace cu = pika::cuda::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+struct increment
+{
+    __device__ void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+struct half
+{
+    __device__ double operator()(int value) const
+    {
+        return value / 2.0;
+    }
+};
+
+void test_streaming(pika::execution::device_streaming_policy const& policy,
+    std::size_t size)
+{
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    // in place, the input and output elements share the staging buffers
+    tt::sync_wait(pika::for_each(
+        policy, values.data(), values.data() + size, increment()));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(values[i], int(i + 1));
+    }
+
+    std::vector<double> halves(size);
+    double* dest_last = tt::sync_wait(pika::transform(policy, values.data(),
+        values.data() + size, halves.data(), half()));
+    PIKA_TEST(dest_last == halves.data() + size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(halves[i], (i + 1) / 2.0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    {
+        cu::enable_user_polling poll("default");
+
+        pika::execution::device_policy device(
+            cu::cuda_scheduler(cu::cuda_pool()));
+
+        for (std::size_t size : {0, 1, 1000, 1000003})
+        {
+            // more chunks than buffers, a partial last chunk
+            test_streaming(
+                pika::execution::device_streaming_policy(device, 4096), size);
+            test_streaming(
+                pika::execution::device_streaming_policy(device, 1000, 1),
+                size);
+            test_streaming(
+                pika::execution::device_streaming_policy(device), size);
+        }
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
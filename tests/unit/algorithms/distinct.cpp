@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/distinct.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the first occurrences of all elements, in order
+template <typename T>
+std::vector<T> first_occurrences(std::vector<T> const& c)
+{
+    std::unordered_set<T> seen;
+    std::vector<T> result;
+    for (T const& value : c)
+    {
+        if (seen.insert(value).second)
+        {
+            result.push_back(value);
+        }
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_distinct(ExPolicy policy, std::size_t size, unsigned int num_values)
+{
+    std::vector<std::string> c(size);
+    for (std::string& value : c)
+    {
+        value = std::to_string(gen() % num_values);
+    }
+    std::vector<std::string> const expected = first_occurrences(c);
+
+    std::vector<std::string> dest(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::distinct(policy, c.begin(), c.end(), dest.begin());
+    });
+    PIKA_TEST(result == dest.begin() + expected.size());
+    dest.erase(result, dest.end());
+    PIKA_TEST(dest == expected);
+}
+
+// elements are equal if they are equal modulo 1000
+template <typename ExPolicy>
+void test_distinct_equal(ExPolicy policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    for (int& value : c)
+    {
+        value = int(gen() % 100000);
+    }
+
+    std::vector<int> expected;
+    std::vector<bool> seen(1000, false);
+    for (int value : c)
+    {
+        if (!seen[value % 1000])
+        {
+            seen[value % 1000] = true;
+            expected.push_back(value);
+        }
+    }
+
+    std::vector<int> dest(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::distinct(policy, c.begin(), c.end(), dest.begin(),
+            [](int value) { return std::size_t(value % 1000); },
+            [](int lhs, int rhs) { return lhs % 1000 == rhs % 1000; });
+    });
+    PIKA_TEST(result == dest.begin() + expected.size());
+    dest.erase(result, dest.end());
+    PIKA_TEST(dest == expected);
+}
+
+void distinct_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007, 1000003})
+    {
+        for (unsigned int num_values : {1u, 10u, 1000u, 1000000u})
+        {
+            test_distinct(seq, size, num_values);
+            test_distinct(par, size, num_values);
+            test_distinct(par_unseq, size, num_values);
+            test_distinct(seq(task), size, num_values);
+            test_distinct(par(task), size, num_values);
+        }
+
+        test_distinct_equal(seq, size);
+        test_distinct_equal(par, size);
+        test_distinct_equal(par(task), size);
+    }
+
+    // without an execution policy, to an output iterator
+    std::vector<int> c = {3, 1, 3, 2, 1, 4, 2};
+    std::vector<int> dest;
+    pika::distinct(c.begin(), c.end(), std::back_inserter(dest));
+    PIKA_TEST(dest == std::vector<int>({3, 1, 2, 4}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    distinct_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/eytzinger.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the layout is the breadth-first order of the complete binary search tree,
+// the in-order traversal of the tree yields the sorted sequence
+void in_order(std::vector<int> const& layout, std::size_t node,
+    std::vector<int>& sorted)
+{
+    if (node >= layout.size())
+    {
+        return;
+    }
+    in_order(layout, 2 * node + 1, sorted);
+    sorted.push_back(layout[node]);
+    in_order(layout, 2 * node + 2, sorted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_eytzinger(ExPolicy&& policy, std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&] { return dis(gen); });
+    std::sort(c.begin(), c.end());
+
+    std::vector<int> d(size);
+    auto r = test::run<ExPolicy>([&] {
+        return pika::eytzinger_layout(policy, c.begin(), c.end(), d.begin());
+    });
+    PIKA_TEST(r == d.end());
+
+    std::vector<int> sorted;
+    in_order(d, 0, sorted);
+    PIKA_TEST(sorted == c);
+
+    for (int value = -1; value <= max_value + 1; ++value)
+    {
+        // both searches find an element equal to the one the searches in the
+        // sorted sequence find
+        auto lower = pika::eytzinger_lower_bound(d.begin(), d.end(), value);
+        auto expected_lower = std::lower_bound(c.begin(), c.end(), value);
+        PIKA_TEST_EQ(lower == d.end(), expected_lower == c.end());
+        if (lower != d.end() && expected_lower != c.end())
+        {
+            PIKA_TEST_EQ(*lower, *expected_lower);
+        }
+
+        auto upper = pika::eytzinger_upper_bound(d.begin(), d.end(), value);
+        auto expected_upper = std::upper_bound(c.begin(), c.end(), value);
+        PIKA_TEST_EQ(upper == d.end(), expected_upper == c.end());
+        if (upper != d.end() && expected_upper != c.end())
+        {
+            PIKA_TEST_EQ(*upper, *expected_upper);
+        }
+    }
+}
+
+void test_eytzinger_greater()
+{
+    std::vector<int> c(1000);
+    std::iota(c.begin(), c.end(), 0);
+    std::reverse(c.begin(), c.end());
+
+    std::vector<int> d(c.size());
+    pika::eytzinger_layout(pika::execution::par, c.begin(), c.end(), d.begin());
+
+    for (int value = -1; value <= 1000; ++value)
+    {
+        auto lower = pika::eytzinger_lower_bound(
+            d.begin(), d.end(), value, std::greater<>());
+        if (value < 0)
+        {
+            PIKA_TEST(lower == d.end());
+        }
+        else
+        {
+            PIKA_TEST(lower != d.end() && *lower == (std::min)(value, 999));
+        }
+    }
+}
+
+void test_eytzinger()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 3, 4, 7, 8, 1000, 100007})
+    {
+        // few distinct values produce long ranges of equivalent elements
+        for (int max_value : {3, 100000})
+        {
+            test_eytzinger(seq, size, max_value);
+            test_eytzinger(par, size, max_value);
+            test_eytzinger(par_unseq, size, max_value);
+            test_eytzinger(par(task), size, max_value);
+        }
+    }
+
+    test_eytzinger_greater();
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_eytzinger();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// a value with a size which is not a power of two
+struct triple
+{
+    std::int16_t a, b, c;
+
+    friend bool operator==(triple const& lhs, triple const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c;
+    }
+};
+
+// too large to be replicated into a block
+struct large
+{
+    std::int32_t v[20];
+
+    friend bool operator==(large const& lhs, large const& rhs)
+    {
+        return std::equal(lhs.v, lhs.v + 20, rhs.v);
+    }
+};
+
+template <typename T>
+T make_value(int i)
+{
+    if constexpr (std::is_same_v<T, triple>)
+    {
+        return triple{
+            std::int16_t(i), std::int16_t(i + 1), std::int16_t(i + 2)};
+    }
+    else if constexpr (std::is_same_v<T, large>)
+    {
+        large l;
+        std::fill(l.v, l.v + 20, i);
+        l.v[19] = i + 1;
+        return l;
+    }
+    else
+    {
+        return static_cast<T>(i);
+    }
+}
+
+static_assert(
+    pika::parallel::detail::is_byte_fill_v<std::vector<triple>::iterator,
+        triple>);
+static_assert(
+    pika::parallel::detail::is_byte_fill_v<std::vector<double>::iterator,
+        int>);
+static_assert(
+    !pika::parallel::detail::is_byte_fill_v<std::vector<std::string>::iterator,
+        std::string>);
+
+///////////////////////////////////////////////////////////////////////////////
+// The sequences start at the given offset into their vectors and the element
+// following the sequence must not be written.
+template <typename T, typename ExPolicy>
+void test_fill_bytes(
+    ExPolicy policy, std::size_t size, std::size_t offset, T const& value)
+{
+    T const sentinel = make_value<T>(-1);
+    std::vector<T> v(offset + size + 1, sentinel);
+
+    test::run<ExPolicy>([&] {
+        return pika::fill(
+            policy, v.begin() + offset, v.begin() + offset + size, value);
+    });
+
+    PIKA_TEST(std::all_of(v.begin() + offset, v.begin() + offset + size,
+        [&](T const& t) { return t == value; }));
+    PIKA_TEST(v[offset + size] == sentinel);
+
+    std::fill(v.begin(), v.end(), sentinel);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::fill_n(policy, v.begin() + offset, size, value);
+    });
+
+    PIKA_TEST(result == v.begin() + offset + size);
+    PIKA_TEST(std::all_of(v.begin() + offset, v.begin() + offset + size,
+        [&](T const& t) { return t == value; }));
+    PIKA_TEST(v[offset + size] == sentinel);
+}
+
+template <typename T>
+void test_fill_bytes()
+{
+    using namespace pika::execution;
+
+    std::uniform_int_distribution<int> dis(1, 1000);
+    for (std::size_t size : {0, 1, 7, 100, 100007})
+    {
+        for (std::size_t offset : {0, 1, 3})
+        {
+            // zero (written by memset) and an arbitrary value
+            for (T const& value : {make_value<T>(0), make_value<T>(dis(gen))})
+            {
+                test_fill_bytes(seq, size, offset, value);
+                test_fill_bytes(par, size, offset, value);
+                test_fill_bytes(par_unseq, size, offset, value);
+                test_fill_bytes(seq(task), size, offset, value);
+                test_fill_bytes(par(task), size, offset, value);
+            }
+        }
+    }
+}
+
+// a value of a different arithmetic type is converted first
+void test_fill_bytes_conversion()
+{
+    using namespace pika::execution;
+
+    std::vector<double> v(10007);
+    pika::fill(par, v.begin(), v.end(), 42);
+    PIKA_TEST(std::all_of(
+        v.begin(), v.end(), [](double d) { return d == 42.0; }));
+
+    pika::fill_n(seq, v.begin(), v.size(), 'a');
+    PIKA_TEST(std::all_of(
+        v.begin(), v.end(), [](double d) { return d == double('a'); }));
+}
+
+void fill_bytes_test()
+{
+    test_fill_bytes<char>();
+    test_fill_bytes<std::int16_t>();
+    test_fill_bytes<int>();
+    test_fill_bytes<double>();
+    test_fill_bytes<triple>();
+    test_fill_bytes<large>();
+    test_fill_bytes_conversion();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    fill_bytes_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <pika/execution.hpp>
 #include <pika/init.hpp>
 #include <pika/parallel/algorithms/find.hpp>
 #include <pika/testing.hpp>
@@ -100,10 +101,43 @@ void test_find()
     test_find_async(par(task), IteratorTag());
 }
 
+// The first of several matches is found wherever it is located relative to
+// the windows scanned by the workers
+template <typename ExPolicy>
+void test_find_first_match(ExPolicy&& policy)
+{
+    std::size_t const size = 1000007;
+    std::uniform_int_distribution<std::size_t> dis_pos(0, size - 1);
+
+    for (std::size_t pos :
+        {std::size_t(0), std::size_t(1), std::size_t(2047), std::size_t(2048),
+            std::size_t(100000), size - 1, dis_pos(gen)})
+    {
+        std::vector<std::size_t> c(size, 2);
+        c[pos] = 1;
+        for (std::size_t i = pos + 1; i < size; i += 1 + dis_pos(gen) % 5000)
+        {
+            c[i] = 1;
+        }
+
+        auto index = pika::find(policy, c.begin(), c.end(), std::size_t(1));
+        PIKA_TEST(index == c.begin() + pos);
+    }
+
+    std::vector<std::size_t> c(size, 2);
+    PIKA_TEST(pika::find(policy, c.begin(), c.end(), std::size_t(1)) ==
+        c.end());
+}
+
 void find_test()
 {
     test_find<std::random_access_iterator_tag>();
     test_find<std::forward_iterator_tag>();
+
+    using namespace pika::execution;
+    test_find_first_match(par);
+    test_find_first_match(par_unseq);
+    test_find_first_match(par.with(pika::execution::static_chunk_size(100)));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/find_all.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<int> make_values(std::size_t size, int range)
+{
+    std::vector<int> values(size);
+    for (int& value : values)
+    {
+        value = static_cast<int>(gen() % range);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_find_all(ExPolicy policy, std::vector<int> const& values)
+{
+    auto const pred = [](int value) { return value % 3 == 0; };
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        if (pred(values[i]))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    std::vector<std::size_t> positions(values.size() + 1, std::size_t(-1));
+    auto result = test::run<ExPolicy>([&] {
+        return pika::find_all(
+            policy, values.begin(), values.end(), pred, positions.begin());
+    });
+
+    PIKA_TEST(result == positions.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), positions.begin()));
+    PIKA_TEST_EQ(*result, std::size_t(-1));
+}
+
+template <typename ExPolicy>
+void test_search_all(ExPolicy policy, std::vector<int> const& values,
+    std::vector<int> const& pattern)
+{
+    std::vector<std::size_t> expected;
+    if (!pattern.empty())
+    {
+        for (auto it = values.begin();; ++it)
+        {
+            it = std::search(it, values.end(), pattern.begin(), pattern.end());
+            if (it == values.end())
+                break;
+            expected.push_back(std::distance(values.begin(), it));
+        }
+    }
+
+    std::vector<std::size_t> positions(values.size() + 1, std::size_t(-1));
+    auto result = test::run<ExPolicy>([&] {
+        return pika::search_all(policy, values.begin(), values.end(),
+            pattern.begin(), pattern.end(), positions.begin());
+    });
+
+    PIKA_TEST(result == positions.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), positions.begin()));
+    PIKA_TEST_EQ(*result, std::size_t(-1));
+}
+
+void find_all_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 4096, 100007})
+    {
+        std::vector<int> const values = make_values(size, 100);
+
+        std::vector<std::size_t> positions;
+        pika::find_all(values.begin(), values.end(),
+            [](int value) { return value % 3 == 0; },
+            std::back_inserter(positions));
+        PIKA_TEST_EQ(positions.size(),
+            std::size_t(std::count_if(values.begin(), values.end(),
+                [](int value) { return value % 3 == 0; })));
+
+        test_find_all(seq, values);
+        test_find_all(par, values);
+        test_find_all(par_unseq, values);
+        test_find_all(seq(task), values);
+        test_find_all(par(task), values);
+    }
+}
+
+void search_all_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 4096, 100007})
+    {
+        // a small range of values makes for many overlapping occurrences
+        std::vector<int> const values = make_values(size, 2);
+
+        for (std::size_t pattern_size : {0, 1, 3, 12})
+        {
+            std::vector<int> const pattern = make_values(pattern_size, 2);
+
+            test_search_all(seq, values, pattern);
+            test_search_all(par, values, pattern);
+            test_search_all(par_unseq, values, pattern);
+            test_search_all(seq(task), values, pattern);
+            test_search_all(par(task), values, pattern);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_all_test();
+    search_all_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
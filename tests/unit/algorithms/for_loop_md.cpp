@@ -0,0 +1,208 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/for_loop_md.hpp>
+#include <pika/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_md_2d(ExPolicy&& policy, std::array<std::size_t, 2> tile,
+    pika::md_tile_order order)
+{
+    std::uniform_int_distribution<int> dis(0, 300);
+    std::array<int, 2> const first = {-dis(gen) / 3, dis(gen) / 3};
+    std::array<int, 2> const last = {
+        first[0] + dis(gen), first[1] + dis(gen)};
+    std::size_t const rows = last[0] - first[0];
+    std::size_t const cols = last[1] - first[1];
+
+    // every point is visited once, the induction value is its row-major
+    // position in the range
+    std::vector<int> visits(rows * cols, 0);
+    std::vector<std::size_t> ordinals(rows * cols, 0);
+    long long sum = 0;
+    std::size_t count = 5;
+
+    test::run<ExPolicy>([&] {
+        return pika::for_loop_md(policy,
+            pika::md_range<int, 2>(first, last, tile, order),
+            pika::induction(count), pika::reduction_plus(sum),
+            [&](int i, int j, std::size_t ordinal, long long& s) {
+                std::size_t const pos =
+                    (i - first[0]) * cols + (j - first[1]);
+                ++visits[pos];
+                ordinals[pos] = ordinal;
+                s += static_cast<long long>(i) * j;
+            });
+    });
+
+    long long expected_sum = 0;
+    for (std::size_t pos = 0; pos != rows * cols; ++pos)
+    {
+        PIKA_TEST_EQ(visits[pos], 1);
+        PIKA_TEST_EQ(ordinals[pos], pos + 5);
+
+        long long const i = first[0] + static_cast<long long>(pos / cols);
+        long long const j = first[1] + static_cast<long long>(pos % cols);
+        expected_sum += i * j;
+    }
+    PIKA_TEST_EQ(sum, expected_sum);
+    PIKA_TEST_EQ(count, rows * cols + 5);
+}
+
+template <typename ExPolicy>
+void test_for_loop_md_3d(ExPolicy&& policy, std::array<std::size_t, 3> tile,
+    pika::md_tile_order order)
+{
+    std::array<std::size_t, 3> const extent = {17, 33, 65};
+    std::vector<int> visits(extent[0] * extent[1] * extent[2], 0);
+
+    test::run<ExPolicy>([&] {
+        return pika::for_loop_md(policy,
+            pika::md_range<std::size_t, 3>({0, 0, 0}, extent, tile, order),
+            pika::induction(std::size_t(0), 2),
+            [&](std::size_t i, std::size_t j, std::size_t k,
+                std::size_t ordinal) {
+                std::size_t const pos = (i * extent[1] + j) * extent[2] + k;
+                PIKA_TEST_EQ(ordinal, 2 * pos);
+                ++visits[pos];
+            });
+    });
+
+    for (int v : visits)
+    {
+        PIKA_TEST_EQ(v, 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_md_empty(ExPolicy&& policy)
+{
+    std::size_t count = 0;
+    test::run<ExPolicy>([&] {
+        return pika::for_loop_md(policy,
+            pika::md_range<int, 2>({0, 10}, {100, 10}, {8, 8}),
+            pika::induction(count),
+            [](int, int, std::size_t) { PIKA_TEST(false); });
+    });
+    PIKA_TEST_EQ(count, std::size_t(0));
+}
+
+template <typename ExPolicy>
+void test_for_loop_md_exception(ExPolicy&& policy)
+{
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::for_loop_md(policy,
+                pika::md_range<int, 2>({0, 0}, {1000, 1000}, {32, 32}),
+                [](int, int) { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_for_loop_md()
+{
+    using namespace pika::execution;
+    using pika::md_tile_order;
+
+    for (md_tile_order order : {md_tile_order::row_major,
+             md_tile_order::morton, md_tile_order::hilbert})
+    {
+        // single rows, tiles which do not divide the extents, whole range
+        for (std::array<std::size_t, 2> tile :
+            {std::array<std::size_t, 2>{0, 0}, std::array<std::size_t, 2>{7, 5},
+                std::array<std::size_t, 2>{64, 64},
+                std::array<std::size_t, 2>{1000, 1000}})
+        {
+            test_for_loop_md_2d(seq, tile, order);
+            test_for_loop_md_2d(par, tile, order);
+            test_for_loop_md_2d(par_unseq, tile, order);
+            test_for_loop_md_2d(par(task), tile, order);
+        }
+
+        for (std::array<std::size_t, 3> tile :
+            {std::array<std::size_t, 3>{0, 0, 0},
+                std::array<std::size_t, 3>{4, 8, 16}})
+        {
+            test_for_loop_md_3d(seq, tile, order);
+            test_for_loop_md_3d(par, tile, order);
+            test_for_loop_md_3d(par(task), tile, order);
+        }
+    }
+
+    test_for_loop_md_empty(seq);
+    test_for_loop_md_empty(par);
+    test_for_loop_md_empty(par(task));
+
+    test_for_loop_md_exception(par);
+    test_for_loop_md_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_for_loop_md();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -6,10 +6,13 @@
 
 #include <pika/algorithm.hpp>
 #include <pika/init.hpp>
+#include <pika/parallel/util/work_stealing_chunk_size.hpp>
 #include <pika/testing.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -174,6 +177,108 @@ void for_loop_reduction_test_idx()
     test_for_loop_reduction_bit_or_idx(par_unseq);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// reductions of loops nested in the iterations of another loop run
+// concurrently on the same worker threads
+template <typename ExPolicy>
+void test_for_loop_reduction_nested(ExPolicy&& policy)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::size_t const rows = 64;
+    std::size_t const cols = 1007;
+    std::vector<std::size_t> c(rows * cols);
+    std::iota(std::begin(c), std::end(c), gen());
+
+    std::size_t sum = 0;
+    pika::for_loop(policy, std::size_t(0), rows, pika::reduction_plus(sum),
+        [&](std::size_t i, std::size_t& sum) {
+            std::size_t row_sum = 0;
+            pika::for_loop(policy, i * cols, (i + 1) * cols,
+                pika::reduction_plus(row_sum),
+                [&c](std::size_t j, std::size_t& row_sum) {
+                    row_sum += c[j];
+                });
+
+            PIKA_TEST_EQ(row_sum,
+                std::accumulate(std::begin(c) + i * cols,
+                    std::begin(c) + (i + 1) * cols, std::size_t(0)));
+            sum += row_sum;
+        });
+
+    // verify values
+    std::size_t sum2 =
+        std::accumulate(std::begin(c), std::end(c), std::size_t(0));
+    PIKA_TEST_EQ(sum, sum2);
+}
+
+template <typename ExPolicy>
+void test_for_loop_reduction_array(ExPolicy&& policy, std::size_t bins)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c(100007);
+    std::uniform_int_distribution<std::size_t> dis(0, bins - 1);
+    std::generate(std::begin(c), std::end(c), [&] { return dis(gen); });
+
+    // a histogram of the values, starting from a non-zero count
+    std::vector<std::size_t> hist(bins, 1);
+    pika::for_loop(policy, std::size_t(0), c.size(),
+        pika::reduction_array(
+            hist.data(), bins, std::size_t(0), std::plus<std::size_t>()),
+        [&c](std::size_t i, std::size_t* hist) { ++hist[c[i]]; });
+
+    // verify values
+    std::vector<std::size_t> hist2(bins, 1);
+    for (std::size_t v : c)
+        ++hist2[v];
+    PIKA_TEST(hist == hist2);
+
+    std::array<std::size_t, 16> small_hist;
+    small_hist.fill(~std::size_t(0));
+    pika::for_loop(policy, std::size_t(0), c.size(),
+        pika::reduction_array(small_hist, ~std::size_t(0),
+            [](std::size_t a, std::size_t b) { return (std::min)(a, b); }),
+        [&c](std::size_t i, std::array<std::size_t, 16>& small_hist) {
+            std::size_t& m = small_hist[c[i] % 16];
+            m = (std::min)(m, i);
+        });
+
+    // verify values
+    for (std::size_t b = 0; b != 16; ++b)
+    {
+        auto it = std::find_if(std::begin(c), std::end(c),
+            [b](std::size_t v) { return v % 16 == b; });
+        std::size_t const expected = it == std::end(c) ?
+            ~std::size_t(0) :
+            std::size_t(it - std::begin(c));
+        PIKA_TEST_EQ(small_hist[b], expected);
+    }
+}
+
+void for_loop_reduction_test_views()
+{
+    using namespace pika::execution;
+
+    test_for_loop_reduction_nested(seq);
+    test_for_loop_reduction_nested(par);
+
+    // workers running several chunks one after the other
+    pika::execution::work_stealing_chunk_size wscs(1);
+    test_for_loop_reduction_bit_and_idx(par.with(wscs));
+    test_for_loop_reduction_bit_or_idx(par.with(wscs));
+    test_for_loop_reduction_nested(par.with(wscs));
+
+    for (std::size_t bins : {1, 1000, 100000})
+    {
+        test_for_loop_reduction_array(seq, bins);
+        test_for_loop_reduction_array(par, bins);
+        test_for_loop_reduction_array(par_unseq, bins);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int pika_main(pika::program_options::variables_map& vm)
 {
@@ -186,6 +291,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     for_loop_reduction_test();
     for_loop_reduction_test_idx();
+    for_loop_reduction_test_views();
 
     return pika::finalize();
 }
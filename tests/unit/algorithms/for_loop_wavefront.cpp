@@ -0,0 +1,227 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/for_loop_wavefront.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::string make_string(std::size_t size)
+{
+    std::string s(size, 'a');
+    for (char& c : s)
+    {
+        c = static_cast<char>('a' + gen() % 4);
+    }
+    return s;
+}
+
+// the table of the lengths of the longest common subsequences of all
+// prefixes of a and b, every cell depends on its north, west and
+// north-west neighbours
+std::vector<std::size_t> lcs_reference(std::string const& a,
+    std::string const& b)
+{
+    std::size_t const cols = b.size() + 1;
+    std::vector<std::size_t> table((a.size() + 1) * cols, 0);
+    for (std::size_t i = 1; i <= a.size(); ++i)
+    {
+        for (std::size_t j = 1; j <= b.size(); ++j)
+        {
+            table[i * cols + j] = a[i - 1] == b[j - 1] ?
+                table[(i - 1) * cols + j - 1] + 1 :
+                (std::max)(table[(i - 1) * cols + j], table[i * cols + j - 1]);
+        }
+    }
+    return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_wavefront_lcs(
+    ExPolicy&& policy, std::array<std::size_t, 2> tile)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, 600);
+    std::string const a = make_string(dis(gen));
+    std::string const b = make_string(dis(gen));
+    std::size_t const cols = b.size() + 1;
+
+    std::vector<std::size_t> table((a.size() + 1) * cols, 0);
+    test::run<ExPolicy>([&] {
+        return pika::for_loop_wavefront(policy,
+            pika::md_range<std::size_t, 2>(
+                {1, 1}, {a.size() + 1, b.size() + 1}, tile),
+            [&](std::size_t i, std::size_t j) {
+                table[i * cols + j] = a[i - 1] == b[j - 1] ?
+                    table[(i - 1) * cols + j - 1] + 1 :
+                    (std::max)(
+                        table[(i - 1) * cols + j], table[i * cols + j - 1]);
+            });
+    });
+
+    PIKA_TEST(table == lcs_reference(a, b));
+}
+
+template <typename ExPolicy>
+void test_for_loop_wavefront_3d(
+    ExPolicy&& policy, std::array<std::size_t, 3> tile)
+{
+    std::array<int, 3> const extent = {17, 33, 65};
+    auto pos = [&](int i, int j, int k) {
+        return (std::size_t(i) * extent[1] + j) * extent[2] + k;
+    };
+
+    // every point adds up the values of its predecessors along all
+    // dimensions
+    auto sum = [&](std::vector<long long>& values) {
+        return [&, pos](int i, int j, int k) {
+            long long& v = values[pos(i, j, k)];
+            v += i != 0 ? values[pos(i - 1, j, k)] : 0;
+            v += j != 0 ? values[pos(i, j - 1, k)] : 0;
+            v += k != 0 ? values[pos(i, j, k - 1)] : 0;
+            v %= 1000003;
+        };
+    };
+
+    std::size_t const size = pos(extent[0], 0, 0);
+    std::vector<long long> expected(size, 1);
+    std::vector<long long> values(size, 1);
+    pika::md_range<int, 3> const r({0, 0, 0}, extent, tile);
+
+    pika::for_loop_wavefront(r, sum(expected));
+    test::run<ExPolicy>(
+        [&] { return pika::for_loop_wavefront(policy, r, sum(values)); });
+
+    PIKA_TEST(values == expected);
+}
+
+template <typename ExPolicy>
+void test_for_loop_wavefront_empty(ExPolicy&& policy)
+{
+    test::run<ExPolicy>([&] {
+        return pika::for_loop_wavefront(policy,
+            pika::md_range<int, 2>({0, 10}, {100, 10}, {8, 8}),
+            [](int, int) { PIKA_TEST(false); });
+    });
+}
+
+template <typename ExPolicy>
+void test_for_loop_wavefront_exception(ExPolicy&& policy)
+{
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::for_loop_wavefront(policy,
+                pika::md_range<int, 2>({0, 0}, {1000, 1000}, {32, 32}),
+                [](int i, int j) {
+                    if (i == 500 && j == 300)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_for_loop_wavefront()
+{
+    using namespace pika::execution;
+
+    // default tiles, single points, tiles which do not divide the extents,
+    // single rows and columns, whole range
+    for (std::array<std::size_t, 2> tile :
+        {std::array<std::size_t, 2>{0, 0}, std::array<std::size_t, 2>{1, 1},
+            std::array<std::size_t, 2>{7, 5},
+            std::array<std::size_t, 2>{1, 1000},
+            std::array<std::size_t, 2>{1000, 1},
+            std::array<std::size_t, 2>{1000, 1000}})
+    {
+        test_for_loop_wavefront_lcs(seq, tile);
+        test_for_loop_wavefront_lcs(par, tile);
+        test_for_loop_wavefront_lcs(par_unseq, tile);
+        test_for_loop_wavefront_lcs(par(task), tile);
+    }
+
+    for (std::array<std::size_t, 3> tile :
+        {std::array<std::size_t, 3>{0, 0, 0},
+            std::array<std::size_t, 3>{4, 8, 16}})
+    {
+        test_for_loop_wavefront_3d(par, tile);
+        test_for_loop_wavefront_3d(par(task), tile);
+    }
+
+    test_for_loop_wavefront_empty(seq);
+    test_for_loop_wavefront_empty(par);
+    test_for_loop_wavefront_empty(par(task));
+
+    test_for_loop_wavefront_exception(seq);
+    test_for_loop_wavefront_exception(par);
+    test_for_loop_wavefront_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_for_loop_wavefront();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 
 #include <pika/init.hpp>
 
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -23,6 +24,13 @@ void test_for_each_prefetching()
     test_for_each_prefetching(par, IteratorTag());
     test_for_each_prefetching(par_unseq, IteratorTag());
     test_for_each_prefetching_async(par(task), IteratorTag());
+
+    for (std::size_t distance : {0, 1, 8, 20000})
+    {
+        test_for_each_software_prefetching(par, IteratorTag(), distance);
+        test_for_each_software_prefetching(
+            par_unseq, IteratorTag(), distance);
+    }
 }
 
 void for_each_prefetching_test()
@@ -0,0 +1,218 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+namespace ex = pika::execution::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_each_sender(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), int(gen() % 1000));
+    std::vector<int> expected = c;
+    for (auto& value : expected)
+    {
+        value *= 2;
+    }
+
+    tt::sync_wait(ex::just(c.begin(), c.end(), [](int& value) { value *= 2; }) |
+        pika::for_each(policy));
+    PIKA_TEST(c == expected);
+
+    auto const result = tt::sync_wait(
+        ex::just(c.begin(), size, [](int& value) { value /= 2; }) |
+        pika::for_each_n(policy));
+    PIKA_TEST(result == c.end());
+    for (auto& value : expected)
+    {
+        value /= 2;
+    }
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_transform_sender(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> a(size);
+    std::vector<int> b(size);
+    std::iota(a.begin(), a.end(), int(gen() % 1000));
+    std::iota(b.begin(), b.end(), int(gen() % 1000));
+
+    std::vector<int> c(size);
+    std::vector<int> expected(size);
+    std::transform(a.begin(), a.end(), expected.begin(),
+        [](int value) { return value + 1; });
+
+    PIKA_TEST(tt::sync_wait(ex::just(a.begin(), a.end(), c.begin(),
+                                [](int value) { return value + 1; }) |
+                  pika::transform(policy)) == c.end());
+    PIKA_TEST(c == expected);
+
+    std::transform(
+        a.begin(), a.end(), b.begin(), expected.begin(), std::plus<>());
+    PIKA_TEST(tt::sync_wait(ex::just(a.begin(), a.end(), b.begin(),
+                                c.begin(), std::plus<>()) |
+                  pika::transform(policy)) == c.end());
+    PIKA_TEST(c == expected);
+
+    // the stages of a pipeline pass the ranges on without futures
+    PIKA_TEST(tt::sync_wait(ex::just(a.begin(), a.end(), 42) |
+                  pika::fill(policy) | ex::let_value([&] {
+                      return ex::just(a.begin(), a.end(), c.begin(),
+                          [](int value) { return 2 * value; });
+                  }) |
+                  pika::transform(policy)) == c.end());
+    PIKA_TEST(std::all_of(
+        c.begin(), c.end(), [](int value) { return value == 84; }));
+}
+
+template <typename ExPolicy>
+void test_fill_sender(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> c(size);
+
+    tt::sync_wait(ex::just(c.begin(), c.end(), 3.5) | pika::fill(policy));
+    PIKA_TEST(std::all_of(
+        c.begin(), c.end(), [](double value) { return value == 3.5; }));
+
+    std::vector<char> bytes(size);
+    PIKA_TEST(tt::sync_wait(ex::just(bytes.begin(), size, 'x') |
+                  pika::fill_n(policy)) == bytes.end());
+    PIKA_TEST(std::all_of(
+        bytes.begin(), bytes.end(), [](char value) { return value == 'x'; }));
+
+    // a negative count does nothing
+    PIKA_TEST(tt::sync_wait(ex::just(bytes.begin(), -1, 'y') |
+                  pika::fill_n(policy)) == bytes.begin());
+    PIKA_TEST(std::all_of(
+        bytes.begin(), bytes.end(), [](char value) { return value == 'x'; }));
+}
+
+// sequences which are not random access are processed by the algorithm with
+// a task policy, the results are the same
+template <typename ExPolicy>
+void test_for_each_sender_forward(ExPolicy&& policy)
+{
+    std::list<int> c(10007, 1);
+
+    tt::sync_wait(ex::just(c.begin(), c.end(), [](int& value) { ++value; }) |
+        pika::for_each(policy));
+    PIKA_TEST(std::all_of(
+        c.begin(), c.end(), [](int value) { return value == 2; }));
+}
+
+template <typename ExPolicy>
+void test_for_each_sender_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        tt::sync_wait(ex::just(c.begin(), c.end(),
+                          [](int) { throw std::runtime_error("test"); }) |
+            pika::for_each(policy));
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void foreach_sender_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_for_each_sender(seq, size);
+        test_for_each_sender(par, size);
+        test_for_each_sender(par_unseq, size);
+        test_for_each_sender(par(task), size);
+
+        test_transform_sender(seq, size);
+        test_transform_sender(par, size);
+        test_transform_sender(par(task), size);
+
+        test_fill_sender(seq, size);
+        test_fill_sender(par, size);
+        test_fill_sender(par(task), size);
+    }
+
+    test_for_each_sender_forward(seq);
+    test_for_each_sender_forward(par);
+
+    test_for_each_sender_exception(seq);
+    test_for_each_sender_exception(par);
+    test_for_each_sender_exception(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    foreach_sender_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
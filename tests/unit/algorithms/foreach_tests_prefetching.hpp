@@ -10,6 +10,7 @@
 #include <pika/execution.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/prefetching.hpp>
+#include <pika/parallel/util/software_prefetching.hpp>
 #include <pika/testing.hpp>
 
 #include <cstddef>
@@ -48,6 +49,37 @@ void test_for_each_prefetching(ExPolicy&& policy, IteratorTag)
     PIKA_TEST_EQ(count, c.size());
 }
 
+// prefetch the elements the given number of cache lines ahead
+template <typename ExPolicy, typename IteratorTag>
+void test_for_each_software_prefetching(
+    ExPolicy&& policy, IteratorTag, std::size_t distance)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::vector<double> c(10007, 1.0);
+    std::vector<int> d(10007, 1);
+
+    std::vector<std::size_t> range(10007);
+    std::iota(range.begin(), range.end(), 0);
+
+    pika::execution::software_prefetching const prefetch(
+        distance, pika::execution::prefetch_locality::moderate);
+    auto ctx = pika::parallel::detail::make_prefetcher_context(
+        range.begin(), range.end(), prefetch, c, d);
+
+    pika::for_each(std::forward<ExPolicy>(policy), ctx.begin(), ctx.end(),
+        [&](std::size_t i) { c[i] = 42.1 + d[i]; });
+
+    // verify values
+    std::size_t count = 0;
+    std::for_each(std::begin(c), std::end(c), [&count](double v) -> void {
+        PIKA_TEST_EQ(v, 42.1 + 1);
+        ++count;
+    });
+    PIKA_TEST_EQ(count, c.size());
+}
+
 template <typename ExPolicy, typename IteratorTag>
 void test_for_each_prefetching_async(ExPolicy&& p, IteratorTag)
 {
@@ -0,0 +1,242 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/fused_transform_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+auto make_stages()
+{
+    return pika::fused_stages([](std::size_t v) { return v % 1000; },
+        [](std::size_t v) { return 2 * v + 1; });
+}
+
+auto make_terminals()
+{
+    return std::make_tuple(
+        pika::fused_reduction(std::size_t(42), std::plus<>()),
+        pika::fused_count_if([](std::size_t v) { return v > 1000; }),
+        pika::fused_reduction(std::size_t(0),
+            [](std::size_t lhs, std::size_t rhs) {
+                return (std::max)(lhs, rhs);
+            }));
+}
+
+// computes the expected results by first materializing the intermediate
+// sequence
+std::tuple<std::size_t, std::ptrdiff_t, std::size_t> expected(
+    std::vector<std::size_t> const& c)
+{
+    std::vector<std::size_t> d(c.size());
+    std::transform(c.begin(), c.end(), d.begin(),
+        [](std::size_t v) { return 2 * (v % 1000) + 1; });
+
+    return std::make_tuple(std::accumulate(d.begin(), d.end(), std::size_t(42)),
+        std::ptrdiff_t(std::count_if(
+            d.begin(), d.end(), [](std::size_t v) { return v > 1000; })),
+        d.empty() ? std::size_t(0) : *std::max_element(d.begin(), d.end()));
+}
+
+template <typename IteratorTag>
+void test_fused_transform_reduce(IteratorTag)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    auto [r0, r1, r2] = std::apply(
+        [&](auto&&... terminals) {
+            return pika::fused_transform_reduce(iterator(std::begin(c)),
+                iterator(std::end(c)), make_stages(), terminals...);
+        },
+        make_terminals());
+
+    auto const e = expected(c);
+    PIKA_TEST_EQ(r0, std::get<0>(e));
+    PIKA_TEST_EQ(r1, std::get<1>(e));
+    PIKA_TEST_EQ(r2, std::get<2>(e));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_fused_transform_reduce(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    auto [r0, r1, r2] = std::apply(
+        [&](auto&&... terminals) {
+            return pika::fused_transform_reduce(policy, iterator(std::begin(c)),
+                iterator(std::end(c)), make_stages(), terminals...);
+        },
+        make_terminals());
+
+    auto const e = expected(c);
+    PIKA_TEST_EQ(r0, std::get<0>(e));
+    PIKA_TEST_EQ(r1, std::get<1>(e));
+    PIKA_TEST_EQ(r2, std::get<2>(e));
+
+    // the terminals are initialized from their initial values only for an
+    // empty sequence
+    auto [s0, s1] = pika::fused_transform_reduce(policy,
+        iterator(std::begin(c)), iterator(std::begin(c)), make_stages(),
+        pika::fused_reduction(std::size_t(42), std::plus<>()),
+        pika::fused_count_if([](std::size_t) { return true; }));
+    PIKA_TEST_EQ(s0, std::size_t(42));
+    PIKA_TEST_EQ(s1, std::ptrdiff_t(0));
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_fused_transform_reduce_async(ExPolicy&& p, IteratorTag)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    auto f = std::apply(
+        [&](auto&&... terminals) {
+            return pika::fused_transform_reduce(p, iterator(std::begin(c)),
+                iterator(std::end(c)), make_stages(), terminals...);
+        },
+        make_terminals());
+    f.wait();
+
+    PIKA_TEST(f.get() == expected(c));
+}
+
+template <typename IteratorTag>
+void test_fused_transform_reduce()
+{
+    using namespace pika::execution;
+
+    test_fused_transform_reduce(IteratorTag());
+
+    test_fused_transform_reduce(seq, IteratorTag());
+    test_fused_transform_reduce(par, IteratorTag());
+    test_fused_transform_reduce(par_unseq, IteratorTag());
+
+    test_fused_transform_reduce_async(seq(task), IteratorTag());
+    test_fused_transform_reduce_async(par(task), IteratorTag());
+}
+
+void fused_transform_reduce_test()
+{
+    test_fused_transform_reduce<std::random_access_iterator_tag>();
+    test_fused_transform_reduce<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_fused_transform_reduce_exception(ExPolicy&& policy, IteratorTag)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    bool caught_exception = false;
+    try
+    {
+        pika::fused_transform_reduce(policy, iterator(std::begin(c)),
+            iterator(std::end(c)),
+            pika::fused_stages([](std::size_t v) {
+                return throw std::runtime_error("test"), v;
+            }),
+            pika::fused_reduction(std::size_t(0), std::plus<>()));
+
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(policy, e);
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+template <typename IteratorTag>
+void test_fused_transform_reduce_exception()
+{
+    using namespace pika::execution;
+
+    test_fused_transform_reduce_exception(seq, IteratorTag());
+    test_fused_transform_reduce_exception(par, IteratorTag());
+}
+
+void fused_transform_reduce_exception_test()
+{
+    test_fused_transform_reduce_exception<std::random_access_iterator_tag>();
+    test_fused_transform_reduce_exception<std::forward_iterator_tag>();
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    fused_transform_reduce_test();
+    fused_transform_reduce_exception_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    //By default run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
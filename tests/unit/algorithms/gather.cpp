@@ -0,0 +1,203 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/gather.hpp>
+#include <pika/parallel/util/software_prefetching.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// A permutation of [0, size) which keeps blocks of the given length of
+// consecutive indices together, a block length of one gives a random
+// permutation.
+std::vector<std::size_t> make_map(std::size_t size, std::size_t block)
+{
+    std::vector<std::size_t> blocks((size + block - 1) / block);
+    std::iota(blocks.begin(), blocks.end(), std::size_t(0));
+    std::shuffle(blocks.begin(), blocks.end(), gen);
+
+    std::vector<std::size_t> map;
+    map.reserve(size);
+    for (std::size_t b : blocks)
+    {
+        for (std::size_t i = b * block; i != (std::min)(size, (b + 1) * block);
+             ++i)
+        {
+            map.push_back(i);
+        }
+    }
+    return map;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_gather(ExPolicy&& policy, std::vector<std::size_t> const& map)
+{
+    std::size_t const size = map.size();
+    std::vector<int> input(size);
+    std::iota(input.begin(), input.end(), 1);
+
+    // gather
+    std::vector<int> d(size + 1, 0);
+    auto r = test::run<ExPolicy>([&]() {
+        return pika::gather(
+            policy, map.begin(), map.end(), input.begin(), d.begin());
+    });
+    PIKA_TEST(r == d.begin() + size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], input[map[i]]);
+    }
+    PIKA_TEST_EQ(d.back(), 0);
+
+    // scatter reverts gather
+    std::vector<int> s(size, 0);
+    test::run<ExPolicy>([&]() {
+        return pika::scatter(policy, d.begin(), d.begin() + size, map.begin(),
+            s.begin());
+    });
+    PIKA_TEST(s == input);
+
+    // scatter_if copies the elements with an even stencil value only
+    std::vector<int> t(size, 0);
+    test::run<ExPolicy>([&]() {
+        return pika::scatter_if(policy, d.begin(), d.begin() + size,
+            map.begin(), d.begin(), t.begin(),
+            [](int v) { return v % 2 == 0; });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(t[i], input[i] % 2 == 0 ? input[i] : 0);
+    }
+}
+
+template <typename ExPolicy>
+void test_scatter_if_default(ExPolicy&& policy)
+{
+    std::vector<int> input = {1, 2, 3, 4, 5};
+    std::vector<std::size_t> map = {4, 3, 2, 1, 0};
+    std::vector<int> stencil = {1, 0, 1, 0, 1};
+    std::vector<int> d(5, 0);
+
+    test::run<ExPolicy>([&]() {
+        return pika::scatter_if(policy, input.begin(), input.end(),
+            map.begin(), stencil.begin(), d.begin());
+    });
+    PIKA_TEST(d == (std::vector<int>{5, 0, 3, 0, 1}));
+}
+
+template <typename ExPolicy>
+void test_scatter_if_exception(ExPolicy&& policy)
+{
+    std::vector<std::size_t> map = make_map(100007, 1);
+    std::vector<int> input(map.size(), 1);
+    std::vector<int> d(map.size(), 0);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&]() {
+            return pika::scatter_if(policy, input.begin(), input.end(),
+                map.begin(), input.begin(), d.begin(),
+                [](int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_gather()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        for (std::size_t block : {1, 5, 100, 100007})
+        {
+            std::vector<std::size_t> map = make_map(size, block);
+
+            test_gather(seq, map);
+            test_gather(par, map);
+            test_gather(par_unseq, map);
+            test_gather(par(task), map);
+
+            // prefetch distances of zero (default), one and beyond the end
+            for (std::size_t distance : {0, 1, 4, 200000})
+            {
+                software_prefetching const prefetch(
+                    distance, prefetch_locality::low);
+                test_gather(seq.with(prefetch), map);
+                test_gather(par.with(prefetch), map);
+            }
+        }
+    }
+
+    test_scatter_if_default(seq);
+    test_scatter_if_default(par);
+
+    test_scatter_if_exception(par);
+    test_scatter_if_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_gather();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/generate.hpp>
+#include <pika/parallel/util/philox.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+void test_philox()
+{
+    // known answers of Philox4x32-10 (Random123)
+    {
+        pika::philox4x32 engine(0, 0);
+        PIKA_TEST_EQ(engine(), std::uint32_t(0x6627e8d5));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0xe169c58d));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0xbc57ac4c));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0x9b00dbd8));
+    }
+    {
+        // counter 0x85a308d3243f6a88, skipped to in four steps
+        pika::philox4x32 engine(0x299f31d0a4093822ull, 0x0370734413198a2eull);
+        for (int i = 0; i != 4; ++i)
+        {
+            engine.discard(0x85a308d3243f6a88ull);
+        }
+        PIKA_TEST_EQ(engine(), std::uint32_t(0xd16cfe09));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0x94fdcceb));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0x5001e420));
+        PIKA_TEST_EQ(engine(), std::uint32_t(0x24126ea1));
+    }
+
+    // skipping ahead is the same as drawing
+    for (unsigned long long z : {0ull, 1ull, 3ull, 4ull, 5ull, 1001ull})
+    {
+        pika::philox4x32 lhs(seed, 7);
+        pika::philox4x32 rhs(seed, 7);
+        for (unsigned long long i = 0; i != z; ++i)
+        {
+            lhs();
+        }
+        rhs.discard(z);
+        PIKA_TEST(lhs == rhs);
+        PIKA_TEST_EQ(lhs(), rhs());
+    }
+
+    PIKA_TEST(pika::philox4x32(seed, 0) != pika::philox4x32(seed, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_generate_random(ExPolicy policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 1000000);
+
+    std::vector<int> expected(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        pika::philox4x32 engine(seed, i);
+        auto d = dist;
+        expected[i] = d(engine);
+    }
+
+    std::vector<int> c(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::generate_random(policy, c.begin(), c.end(), dist, seed);
+    });
+    PIKA_TEST(result == c.end());
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_generate_random_normal(ExPolicy policy)
+{
+    std::size_t const size = 100007;
+    std::normal_distribution<double> dist(5.0, 2.0);
+
+    std::vector<double> expected(size);
+    pika::generate_random(expected.begin(), expected.end(), dist, seed);
+
+    // the numbers do not depend on the execution policy
+    std::vector<double> c(size);
+    test::run<ExPolicy>([&] {
+        return pika::generate_random(policy, c.begin(), c.end(), dist, seed);
+    });
+    PIKA_TEST(c == expected);
+
+    double mean = 0.0;
+    for (double value : c)
+    {
+        mean += value;
+    }
+    mean /= double(size);
+    PIKA_TEST(mean > 4.9 && mean < 5.1);
+}
+
+void generate_random_test()
+{
+    using namespace pika::execution;
+
+    test_philox();
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        test_generate_random(seq, size);
+        test_generate_random(par, size);
+        test_generate_random(par_unseq, size);
+        test_generate_random(seq(task), size);
+        test_generate_random(par(task), size);
+    }
+
+    test_generate_random_normal(par);
+    test_generate_random_normal(par(task));
+
+    // forward iterators
+    {
+        std::list<std::uint32_t> c(1000);
+        std::uniform_int_distribution<std::uint32_t> dist;
+        pika::generate_random(par, c.begin(), c.end(), dist, seed);
+
+        std::size_t i = 0;
+        for (std::uint32_t value : c)
+        {
+            pika::philox4x32 engine(seed, i++);
+            auto d = dist;
+            PIKA_TEST_EQ(value, d(engine));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    generate_random_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reduce_by_key.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_hash_reduce_by_key(
+    ExPolicy policy, std::size_t size, unsigned int num_keys)
+{
+    std::vector<std::string> keys(size);
+    std::vector<long> values(size);
+    std::map<std::string, long> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = std::to_string(gen() % num_keys);
+        values[i] = long(gen() % 100);
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<std::string> keys_out(size);
+    std::vector<long> values_out(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::hash_reduce_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), keys_out.begin(), values_out.begin());
+    });
+
+    std::size_t const count = std::size_t(result.in - keys_out.begin());
+    PIKA_TEST_EQ(count, expected.size());
+    PIKA_TEST_EQ(std::size_t(result.out - values_out.begin()), count);
+
+    std::map<std::string, long> reduced;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        PIKA_TEST_EQ(reduced.count(keys_out[i]), std::size_t(0));
+        reduced[keys_out[i]] = values_out[i];
+    }
+    PIKA_TEST(reduced == expected);
+}
+
+// the values of a key are combined in the order they appear in
+template <typename ExPolicy>
+void test_hash_reduce_by_key_order(ExPolicy policy, std::size_t size)
+{
+    std::vector<int> keys(size);
+    std::vector<std::string> values(size);
+    std::map<int, std::string> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = int(gen() % 7);
+        values[i] = std::string(1, char('a' + gen() % 26));
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> keys_out(size);
+    std::vector<std::string> values_out(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::hash_reduce_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), keys_out.begin(), values_out.begin(),
+            std::plus<std::string>());
+    });
+
+    std::size_t const count = std::size_t(result.in - keys_out.begin());
+    PIKA_TEST_EQ(count, expected.size());
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        PIKA_TEST_EQ(values_out[i], expected[keys_out[i]]);
+    }
+}
+
+// the sequential version writes the keys in the order of their first
+// occurrence
+void test_hash_reduce_by_key_seq_order()
+{
+    std::vector<int> keys = {5, 3, 5, 1, 3, 5, 7};
+    std::vector<int> values = {1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> keys_out(keys.size());
+    std::vector<int> values_out(keys.size());
+
+    auto result = pika::hash_reduce_by_key(pika::execution::seq,
+        keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+        values_out.begin());
+
+    PIKA_TEST(result.in == keys_out.begin() + 4);
+    PIKA_TEST(result.out == values_out.begin() + 4);
+    PIKA_TEST(std::vector<int>(keys_out.begin(), result.in) ==
+        std::vector<int>({5, 3, 1, 7}));
+    PIKA_TEST(std::vector<int>(values_out.begin(), result.out) ==
+        std::vector<int>({10, 7, 4, 7}));
+}
+
+void hash_reduce_by_key_test()
+{
+    using namespace pika::execution;
+
+    test_hash_reduce_by_key_seq_order();
+
+    for (std::size_t size : {0, 1, 1000, 100007, 1000003})
+    {
+        for (unsigned int num_keys : {1u, 10u, 1000u, 1000000u})
+        {
+            test_hash_reduce_by_key(seq, size, num_keys);
+            test_hash_reduce_by_key(par, size, num_keys);
+            test_hash_reduce_by_key(par_unseq, size, num_keys);
+            test_hash_reduce_by_key(seq(task), size, num_keys);
+            test_hash_reduce_by_key(par(task), size, num_keys);
+        }
+
+        test_hash_reduce_by_key_order(seq, size);
+        test_hash_reduce_by_key_order(par, size);
+        test_hash_reduce_by_key_order(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    hash_reduce_by_key_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/histogram.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// some of the values fall outside of the bins
+std::vector<int> make_input(std::size_t size, int num_bins)
+{
+    std::uniform_int_distribution<int> dis(-2, num_bins + 1);
+
+    std::vector<int> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    return c;
+}
+
+template <typename Count, typename Container>
+std::vector<Count> make_expected(Container const& c, std::size_t num_bins)
+{
+    std::vector<Count> expected(num_bins, 0);
+    for (int v : c)
+    {
+        if (v >= 0 && std::size_t(v) < num_bins)
+        {
+            ++expected[v];
+        }
+    }
+    return expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Count, typename ExPolicy, typename Container>
+void test_histogram(
+    ExPolicy&& policy, Container const& c, std::size_t num_bins)
+{
+    std::vector<Count> const expected = make_expected<Count>(c, num_bins);
+
+    // the previous contents of the bins are overwritten
+    std::vector<Count> bins(num_bins, 42);
+    auto r = test::run<ExPolicy>([&] {
+        return pika::histogram(policy, c.begin(), c.end(), bins.begin(),
+            bins.end(), [](int v) { return v; });
+    });
+    PIKA_TEST(r == bins.end());
+    PIKA_TEST(bins == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram_exception(ExPolicy&& policy, std::size_t num_bins)
+{
+    std::vector<int> c = make_input(100007, 10);
+    c[c.size() / 2] = -1000;
+    std::vector<std::size_t> bins(num_bins);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::histogram(policy, c.begin(), c.end(), bins.begin(),
+                bins.end(), [](int v) {
+                    if (v == -1000)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                    return v;
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_histogram()
+{
+    using namespace pika::execution;
+
+    // few bins are counted per chunk, many bins atomically
+    for (std::size_t num_bins : {1, 10, 1000, 100000})
+    {
+        for (std::size_t size : {0, 1, 1000, 100007})
+        {
+            std::vector<int> c = make_input(size, int(num_bins));
+
+            test_histogram<std::size_t>(seq, c, num_bins);
+            test_histogram<std::size_t>(par, c, num_bins);
+            test_histogram<std::uint32_t>(par_unseq, c, num_bins);
+            test_histogram<std::size_t>(par(task), c, num_bins);
+            test_histogram<double>(par, c, num_bins);
+
+            std::list<int> l(c.begin(), c.end());
+            test_histogram<std::size_t>(par, l, num_bins);
+        }
+    }
+
+    {
+        std::vector<int> c = make_input(1000, 10);
+        std::vector<std::size_t> const expected =
+            make_expected<std::size_t>(c, 10);
+        std::vector<std::size_t> bins(10);
+        pika::histogram(c.begin(), c.end(), bins.begin(), bins.end(),
+            [](int v) { return v; });
+        PIKA_TEST(bins == expected);
+    }
+
+    test_histogram_exception(par, 10);
+    test_histogram_exception(par(task), 10);
+    test_histogram_exception(par, 100000);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_histogram();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/cuda.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/hybrid_policy.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cu = pika::cuda::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+struct plus
+{
+    PIKA_HOST_DEVICE std::int64_t operator()(
+        std::int64_t lhs, std::int64_t rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+struct square
+{
+    PIKA_HOST_DEVICE std::int64_t operator()(int value) const
+    {
+        return std::int64_t(value) * value;
+    }
+};
+
+void test_transform_reduce(
+    pika::execution::hybrid_policy<> const& policy, std::size_t size)
+{
+    // both parts access the range
+    int* values = nullptr;
+    cu::check_cuda_error(
+        cudaMallocManaged(&values, (size + 1) * sizeof(int)));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = int(i % 1000);
+    }
+
+    std::int64_t expected = 11;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected += std::int64_t(values[i]) * values[i];
+    }
+
+    for (int i = 0; i != 5; ++i)
+    {
+        std::int64_t const result = pika::transform_reduce(policy, values,
+            values + size, std::int64_t(11), plus(), square());
+        PIKA_TEST_EQ(result, expected);
+
+        double const fraction = policy.device_fraction();
+        PIKA_TEST(fraction > 0.0 && fraction < 1.0);
+    }
+
+    cudaFree(values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    {
+        cu::enable_user_polling poll("default");
+
+        pika::execution::hybrid_policy<> policy(
+            pika::execution::device_policy(
+                cu::cuda_scheduler(cu::cuda_pool())));
+
+        for (std::size_t size : {0, 1, 1000, 65536, 1000003, 10000019})
+        {
+            test_transform_reduce(policy, size);
+        }
+
+        // copies share the measured split
+        auto copy = policy;
+        PIKA_TEST_EQ(copy.device_fraction(), policy.device_fraction());
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
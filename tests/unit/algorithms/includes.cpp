@@ -8,6 +8,7 @@
 #include <pika/parallel/algorithms/includes.hpp>
 #include <pika/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
@@ -421,6 +422,50 @@ void includes_test2()
     test_includes2<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The second sequence is much shorter than the first one.
+template <typename ExPolicy>
+void test_includes3(ExPolicy&& policy, std::size_t size1, std::size_t size2)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c1(size1);
+    std::iota(std::begin(c1), std::end(c1), 0);
+
+    // every other element of the first sequence, with duplicates
+    std::uniform_int_distribution<std::size_t> dis(0, size1 / 2 - 1);
+    std::vector<std::size_t> c2(size2);
+    for (auto& v : c2)
+        v = 2 * dis(gen);
+    std::sort(std::begin(c2), std::end(c2));
+    c2.erase(std::unique(std::begin(c2), std::end(c2)), std::end(c2));
+
+    PIKA_TEST(pika::includes(policy, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2)));
+
+    // remove one of the elements from the first sequence
+    std::vector<std::size_t> c3;
+    c3.reserve(size1);
+    std::size_t const missing = c2[c2.size() / 2];
+    std::copy_if(std::begin(c1), std::end(c1), std::back_inserter(c3),
+        [missing](std::size_t v) { return v != missing; });
+
+    PIKA_TEST(!pika::includes(policy, std::begin(c3), std::end(c3),
+        std::begin(c2), std::end(c2)));
+}
+
+void includes_test3()
+{
+    using namespace pika::execution;
+
+    test_includes3(seq, 1000003, 7);
+    test_includes3(seq, 1000003, 1007);
+    test_includes3(par, 1000003, 7);
+    test_includes3(par, 1000003, 1007);
+    test_includes3(par_unseq, 1000003, 10007);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_includes_exception(IteratorTag)
@@ -783,6 +828,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     includes_test1();
     includes_test2();
+    includes_test3();
     includes_exception_test();
     includes_bad_alloc_test();
     return pika::finalize();
@@ -21,6 +21,7 @@ void inplace_merge_test()
 {
     std::cout << "--- inplace_merge_test ---" << std::endl;
     test_inplace_merge<std::random_access_iterator_tag>();
+    test_inplace_merge_stable<std::random_access_iterator_tag>();
     //test_inplace_merge<std::bidirectional_iterator_tag>();
 }
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <pika/parallel/algorithms/merge.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
 #include <pika/testing.hpp>
 #include <pika/type_support/unused.hpp>
 
@@ -552,6 +553,97 @@ void test_inplace_merge_etc(
     }
 }
 
+// An element with few distinct keys which records its original position.
+// The over-aligned variant can't be put into the temporary buffers, which
+// makes inplace_merge fall back to rotating blocks.
+struct keyed_element
+{
+    int key;
+    std::size_t index;
+};
+
+struct alignas(64) aligned_keyed_element
+{
+    int key;
+    std::size_t index;
+};
+
+template <typename ExPolicy, typename IteratorTag, typename Element>
+void test_inplace_merge_stable(ExPolicy&& policy, IteratorTag, Element)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = typename std::vector<Element>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    auto comp = [](Element const& a, Element const& b) {
+        return a.key < b.key;
+    };
+
+    std::uniform_int_distribution<int> dis(0, 9);
+    for (std::size_t left_size : {0, 1, 300007})
+    {
+        for (std::size_t right_size : {0, 7, 123456})
+        {
+            std::vector<Element> res(left_size + right_size);
+            for (auto& e : res)
+            {
+                e.key = dis(rng);
+            }
+
+            base_iterator res_first = std::begin(res);
+            base_iterator res_middle = res_first + left_size;
+            base_iterator res_last = std::end(res);
+
+            std::sort(res_first, res_middle, comp);
+            std::sort(res_middle, res_last, comp);
+            for (std::size_t i = 0; i != res.size(); ++i)
+            {
+                res[i].index = i;
+            }
+
+            pika::inplace_merge(policy, iterator(res_first),
+                iterator(res_middle), iterator(res_last), comp);
+
+            // equal keys have to keep their order, the ones of the left
+            // range preceding the ones of the right range
+            bool const sorted = std::is_sorted(
+                res_first, res_last, [](Element const& a, Element const& b) {
+                    return a.key < b.key ||
+                        (a.key == b.key && a.index < b.index);
+                });
+            PIKA_TEST(sorted);
+
+            std::vector<bool> seen(res.size(), false);
+            for (auto const& e : res)
+            {
+                PIKA_TEST(!seen[e.index]);
+                seen[e.index] = true;
+            }
+        }
+    }
+}
+
+template <typename IteratorTag>
+void test_inplace_merge_stable()
+{
+    using namespace pika::execution;
+
+    test_inplace_merge_stable(seq, IteratorTag(), keyed_element());
+    test_inplace_merge_stable(par, IteratorTag(), keyed_element());
+    test_inplace_merge_stable(par_unseq, IteratorTag(), keyed_element());
+
+    test_inplace_merge_stable(par, IteratorTag(), aligned_keyed_element());
+
+    // the temporary buffer is taken from an arena
+    pika::parallel::util::temporary_buffer_arena arena;
+    test_inplace_merge_stable(
+        par.with(temporary_buffer(arena)), IteratorTag(), keyed_element());
+    PIKA_TEST_LTE((300007 + 123456) * sizeof(keyed_element),
+        arena.capacity());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_inplace_merge()
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -412,6 +413,38 @@ void make_heap_bad_alloc_test()
     test_make_heap_bad_alloc<std::random_access_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////
+// Large inputs build the subtrees below the top levels concurrently
+template <typename ExPolicy>
+void test_make_heap_large(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    for (auto& value : c)
+    {
+        value = gen() % 1000;
+    }
+    std::vector<std::size_t> sorted(c);
+    std::sort(sorted.begin(), sorted.end());
+
+    pika::make_heap(policy, c.begin(), c.end(), std::greater<std::size_t>());
+    PIKA_TEST(std::is_heap(c.begin(), c.end(), std::greater<std::size_t>()));
+
+    std::sort(c.begin(), c.end());
+    PIKA_TEST(c == sorted);
+}
+
+void make_heap_large_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {65536, 100007, 1 << 20})
+    {
+        test_make_heap_large(seq, size);
+        test_make_heap_large(par, size);
+        test_make_heap_large(par_unseq, size);
+    }
+}
+
 int pika_main(pika::program_options::variables_map& vm)
 {
     if (vm.count("seed"))
@@ -422,6 +455,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     make_heap_test1();
     make_heap_test2();
+    make_heap_large_test();
     make_heap_exception_test();
     make_heap_bad_alloc_test();
 
@@ -0,0 +1,200 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/matrix_multiply.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the sizes cover partial register blocks, partial tiles, several tiles and
+// several panels of the inner dimension
+std::size_t const sizes[] = {1, 5, 67, 300};
+
+template <typename Container, typename ExPolicy>
+void test_matrix_multiply(ExPolicy&& policy)
+{
+    using value_type = typename Container::value_type;
+
+    for (std::size_t m : sizes)
+    {
+        for (std::size_t n : sizes)
+        {
+            for (std::size_t k : sizes)
+            {
+                // small integers keep the sums of double values exact
+                Container a(m * k);
+                Container b(k * n);
+                for (auto& value : a)
+                {
+                    value = static_cast<value_type>(int(gen() % 11) - 5);
+                }
+                for (auto& value : b)
+                {
+                    value = static_cast<value_type>(int(gen() % 11) - 5);
+                }
+                Container c(m * n, value_type(-1));
+
+                auto const result = test::run<ExPolicy>([&] {
+                    return pika::matrix_multiply(
+                        policy, a.begin(), b.begin(), c.begin(), m, n, k);
+                });
+                PIKA_TEST(result == c.end());
+
+                bool equal = true;
+                for (std::size_t i = 0; i != m; ++i)
+                {
+                    for (std::size_t j = 0; j != n; ++j)
+                    {
+                        value_type sum = value_type();
+                        for (std::size_t p = 0; p != k; ++p)
+                        {
+                            sum += a[i * k + p] * b[p * n + j];
+                        }
+                        equal = equal && c[i * n + j] == sum;
+                    }
+                }
+                PIKA_TEST(equal);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_matrix_multiply(ExPolicy&& policy)
+{
+    test_matrix_multiply<std::vector<double>>(policy);
+    test_matrix_multiply<std::vector<int>>(policy);
+    test_matrix_multiply<std::deque<float>>(policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct throwing
+{
+    throwing() = default;
+
+    throwing& operator+=(throwing const&)
+    {
+        throw std::runtime_error("test");
+    }
+
+    friend throwing operator*(throwing const&, throwing const&)
+    {
+        return throwing();
+    }
+
+    friend throwing operator+(throwing const&, throwing const&)
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+template <typename ExPolicy>
+void test_matrix_multiply_exception(ExPolicy&& policy)
+{
+    std::vector<throwing> a(300 * 300);
+    std::vector<throwing> b(a.size());
+    std::vector<throwing> c(a.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::matrix_multiply(
+                policy, a.begin(), b.begin(), c.begin(), 300, 300, 300);
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void matrix_multiply_test()
+{
+    using namespace pika::execution;
+
+    test_matrix_multiply(seq);
+    test_matrix_multiply(par);
+    test_matrix_multiply(par_unseq);
+    test_matrix_multiply(par(task));
+
+    // the overload without a policy, empty matrices and an empty inner
+    // dimension, which zeroes C
+    std::vector<int> a = {1, 2, 3, 4, 5, 6};
+    std::vector<int> b = {1, 0, 0, 1, 1, 1};
+    std::vector<int> c(4);
+    PIKA_TEST(pika::matrix_multiply(a.begin(), b.begin(), c.begin(), 2, 2,
+                  3) == c.end());
+    PIKA_TEST(c == (std::vector<int>{4, 5, 10, 11}));
+    PIKA_TEST(pika::matrix_multiply(par, a.begin(), b.begin(), c.begin(), 0,
+                  2, 3) == c.begin());
+    PIKA_TEST(pika::matrix_multiply(par, a.begin(), b.begin(), c.begin(), 2,
+                  2, 0) == c.end());
+    PIKA_TEST(c == (std::vector<int>{0, 0, 0, 0}));
+
+    test_matrix_multiply_exception(seq);
+    test_matrix_multiply_exception(par);
+    test_matrix_multiply_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    matrix_multiply_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
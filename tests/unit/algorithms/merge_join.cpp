@@ -0,0 +1,204 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/merge_join.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+using index_pair = std::pair<std::size_t, std::size_t>;
+
+std::vector<int> make_keys(std::size_t size, int max_key)
+{
+    std::uniform_int_distribution<int> dis(0, max_key);
+
+    std::vector<int> keys(size);
+    std::generate(keys.begin(), keys.end(), [&] { return dis(gen); });
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// the pairs of indices of equivalent keys, ordered by key, then by the
+// index into the first and the second sequence
+std::vector<index_pair> expected_join(
+    std::vector<int> const& keys1, std::vector<int> const& keys2)
+{
+    std::vector<index_pair> expected;
+    auto first2 = keys2.begin();
+    for (std::size_t i = 0; i != keys1.size(); ++i)
+    {
+        auto range = std::equal_range(first2, keys2.end(), keys1[i]);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            expected.emplace_back(i, it - keys2.begin());
+        }
+        first2 = range.first;
+    }
+    return expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_merge_join(ExPolicy&& policy, std::vector<int> const& keys1,
+    std::vector<int> const& keys2)
+{
+    std::vector<index_pair> const expected = expected_join(keys1, keys2);
+
+    std::vector<index_pair> d(expected.size() + 1, index_pair(0, 0));
+    auto r = test::run<ExPolicy>([&] {
+        return pika::merge_join(policy, keys1.begin(), keys1.end(),
+            keys2.begin(), keys2.end(), d.begin());
+    });
+    PIKA_TEST(r == d.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+    PIKA_TEST(d.back() == index_pair(0, 0));
+}
+
+template <typename ExPolicy>
+void test_merge_join_greater(ExPolicy&& policy)
+{
+    std::vector<int> keys1 = make_keys(10007, 1000);
+    std::vector<int> keys2 = make_keys(20011, 1000);
+    std::reverse(keys1.begin(), keys1.end());
+    std::reverse(keys2.begin(), keys2.end());
+
+    std::vector<index_pair> expected;
+    for (std::size_t i = 0; i != keys1.size(); ++i)
+    {
+        auto range = std::equal_range(
+            keys2.begin(), keys2.end(), keys1[i], std::greater<>());
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            expected.emplace_back(i, it - keys2.begin());
+        }
+    }
+
+    std::vector<index_pair> d(expected.size());
+    auto r = test::run<ExPolicy>([&] {
+        return pika::merge_join(policy, keys1.begin(), keys1.end(),
+            keys2.begin(), keys2.end(), d.begin(), std::greater<>());
+    });
+    PIKA_TEST(r == d.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_merge_join_exception(ExPolicy&& policy)
+{
+    std::vector<int> keys1 = make_keys(100007, 1000000);
+    std::vector<int> keys2 = make_keys(100007, 1000000);
+    std::vector<index_pair> d(keys1.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::merge_join(policy, keys1.begin(), keys1.end(),
+                keys2.begin(), keys2.end(), d.begin(),
+                [](int, int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_merge_join()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size1 : {0, 1, 1000, 100007})
+    {
+        for (std::size_t size2 : {0, 1, 100007})
+        {
+            // few distinct keys produce large cross products spanning
+            // several chunks, many distinct keys leave most keys unmatched
+            for (int max_key : {30, 1000000})
+            {
+                // keep the size of the output manageable
+                if (max_key == 30 && size1 * size2 > 100000000)
+                {
+                    continue;
+                }
+
+                std::vector<int> keys1 = make_keys(size1, max_key);
+                std::vector<int> keys2 = make_keys(size2, max_key);
+
+                test_merge_join(seq, keys1, keys2);
+                test_merge_join(par, keys1, keys2);
+                test_merge_join(par_unseq, keys1, keys2);
+                test_merge_join(par(task), keys1, keys2);
+            }
+        }
+    }
+
+    test_merge_join_greater(seq);
+    test_merge_join_greater(par);
+
+    test_merge_join_exception(par);
+    test_merge_join_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_merge_join();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -563,6 +563,63 @@ void test_merge_etc(ExPolicy&& policy, IteratorTag, DataType, int rand_base)
     }
 }
 
+// Merges sequences of few distinct keys, elements with equal keys have to
+// keep their order and the ones of the first sequence have to precede the
+// ones of the second.
+template <typename ExPolicy, typename IteratorTag>
+void test_merge_stable(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using element = std::pair<int, std::size_t>;
+    using base_iterator = typename std::vector<element>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    auto comp = [](element const& a, element const& b) {
+        return a.first < b.first;
+    };
+
+    std::uniform_int_distribution<int> dis(0, 9);
+    for (std::size_t size1 : {0, 1, 1000, 300007})
+    {
+        for (std::size_t size2 : {0, 7, 123456})
+        {
+            std::vector<element> src1(size1), src2(size2),
+                dest_res(size1 + size2), dest_sol(size1 + size2);
+            for (auto& e : src1)
+            {
+                e.first = dis(rng);
+            }
+            for (auto& e : src2)
+            {
+                e.first = dis(rng);
+            }
+            std::sort(std::begin(src1), std::end(src1), comp);
+            std::sort(std::begin(src2), std::end(src2), comp);
+            for (std::size_t i = 0; i != size1; ++i)
+            {
+                src1[i].second = i;
+            }
+            for (std::size_t i = 0; i != size2; ++i)
+            {
+                src2[i].second = size1 + i;
+            }
+
+            auto result = pika::merge(policy, iterator(std::begin(src1)),
+                iterator(std::end(src1)), iterator(std::begin(src2)),
+                iterator(std::end(src2)), iterator(std::begin(dest_res)),
+                comp);
+            auto solution = std::merge(std::begin(src1), std::end(src1),
+                std::begin(src2), std::end(src2), std::begin(dest_sol), comp);
+
+            PIKA_TEST(result.base() == std::end(dest_res));
+            PIKA_TEST(solution == std::end(dest_sol));
+            PIKA_TEST(dest_res == dest_sol);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_merge()
@@ -633,6 +690,11 @@ void test_merge()
         },
         rand_base);
 
+    ////////// Stability of the partitioned merge.
+    test_merge_stable(seq, IteratorTag());
+    test_merge_stable(par, IteratorTag());
+    test_merge_stable(par_unseq, IteratorTag());
+
     ////////// Another test cases for justifying the implementation.
     test_merge_etc(IteratorTag(), user_defined_type(), rand_base);
     test_merge_etc(seq, IteratorTag(), user_defined_type(), rand_base);
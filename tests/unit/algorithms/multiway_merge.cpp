@@ -0,0 +1,219 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/iterator_support/iterator_range.hpp>
+#include <pika/parallel/algorithms/multiway_merge.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// elements are compared by their key only, the second member records the
+// run and position the element was taken from
+using element = std::pair<int, std::size_t>;
+
+struct compare_keys
+{
+    bool operator()(element const& lhs, element const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+// Sorted runs with sizes up to twice the given average size and keys in
+// [0, max_key]
+std::vector<std::vector<element>> make_runs(
+    std::size_t num_runs, std::size_t run_size, int max_key)
+{
+    std::uniform_int_distribution<std::size_t> size(0, 2 * run_size);
+    std::uniform_int_distribution<int> key(0, max_key);
+
+    std::vector<std::vector<element>> runs(num_runs);
+    std::size_t id = 0;
+    for (auto& run : runs)
+    {
+        run.resize(size(gen));
+        for (auto& e : run)
+        {
+            e = element(key(gen), 0);
+        }
+        std::sort(run.begin(), run.end(), compare_keys());
+        for (auto& e : run)
+        {
+            e.second = id++;
+        }
+    }
+    return runs;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_multiway_merge(
+    ExPolicy&& policy, std::vector<std::vector<element>> const& runs)
+{
+    // equivalent elements are taken from the runs in order
+    std::vector<element> expected;
+    for (auto const& run : runs)
+    {
+        expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::stable_sort(expected.begin(), expected.end(), compare_keys());
+
+    std::vector<element> d(expected.size() + 1, element(-1, 0));
+    auto r = test::run<ExPolicy>([&] {
+        return pika::multiway_merge(
+            policy, runs.begin(), runs.end(), d.begin(), compare_keys());
+    });
+
+    PIKA_TEST(r == d.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+    PIKA_TEST_EQ(d.back().first, -1);
+}
+
+template <typename ExPolicy>
+void test_multiway_merge_iterator_range(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    std::iota(c.begin(), c.end(), 0);
+    std::shuffle(c.begin(), c.end(), gen);
+
+    // the runs are parts of one array
+    using iterator = std::vector<int>::iterator;
+    std::vector<pika::util::iterator_range<iterator>> runs;
+    std::size_t const num_runs = 16;
+    for (std::size_t i = 0; i != num_runs; ++i)
+    {
+        iterator first = c.begin() + i * c.size() / num_runs;
+        iterator last = c.begin() + (i + 1) * c.size() / num_runs;
+        std::sort(first, last);
+        runs.emplace_back(first, last);
+    }
+
+    std::vector<int> d(c.size());
+    auto r = test::run<ExPolicy>([&] {
+        return pika::multiway_merge(
+            policy, runs.begin(), runs.end(), d.begin());
+    });
+    PIKA_TEST(r == d.end());
+
+    std::sort(c.begin(), c.end());
+    PIKA_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_multiway_merge_exception(ExPolicy&& policy)
+{
+    auto runs = make_runs(16, 10000, 1000);
+    std::vector<element> d(16 * 20000);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::multiway_merge(policy, runs.begin(), runs.end(),
+                d.begin(), [](element const&, element const&) -> bool {
+                    throw std::runtime_error("test");
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_multiway_merge()
+{
+    using namespace pika::execution;
+
+    for (std::size_t num_runs : {0, 1, 2, 3, 16, 64})
+    {
+        for (std::size_t run_size : {0, 1, 100, 10007})
+        {
+            // few distinct keys produce long ranges of equivalent elements
+            // spanning several runs and chunks
+            for (int max_key : {3, 1000000})
+            {
+                auto runs = make_runs(num_runs, run_size, max_key);
+
+                test_multiway_merge(seq, runs);
+                test_multiway_merge(par, runs);
+                test_multiway_merge(par_unseq, runs);
+                test_multiway_merge(par(task), runs);
+            }
+        }
+    }
+
+    // all runs but one are empty
+    std::vector<std::vector<element>> runs(8);
+    runs[5] = make_runs(1, 100000, 1000)[0];
+    test_multiway_merge(par, runs);
+
+    test_multiway_merge_iterator_range(seq);
+    test_multiway_merge_iterator_range(par);
+
+    test_multiway_merge_exception(par);
+    test_multiway_merge_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_multiway_merge();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/multiway_set_operation.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// elements are compared by their key only, the second member records the
+// run and position the element was taken from
+using element = std::pair<int, std::size_t>;
+
+struct compare_keys
+{
+    bool operator()(element const& lhs, element const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+// Sorted runs with sizes up to twice the given average size and keys in
+// [0, max_key]
+std::vector<std::vector<element>> make_runs(
+    std::size_t num_runs, std::size_t run_size, int max_key)
+{
+    std::uniform_int_distribution<std::size_t> size(0, 2 * run_size);
+    std::uniform_int_distribution<int> key(0, max_key);
+
+    std::vector<std::vector<element>> runs(num_runs);
+    std::size_t id = 0;
+    for (auto& run : runs)
+    {
+        run.resize(size(gen));
+        for (auto& e : run)
+        {
+            e = element(key(gen), 0);
+        }
+        std::sort(run.begin(), run.end(), compare_keys());
+        for (auto& e : run)
+        {
+            e.second = id++;
+        }
+    }
+    return runs;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_multiway_set_operation(
+    ExPolicy&& policy, std::vector<std::vector<element>> const& runs)
+{
+    // the results of folding the pairwise set operations from the left
+    std::vector<element> expected_union;
+    std::vector<element> expected_intersection;
+    if (!runs.empty())
+    {
+        expected_union = runs[0];
+        expected_intersection = runs[0];
+        for (std::size_t i = 1; i != runs.size(); ++i)
+        {
+            std::vector<element> tmp;
+            std::set_union(expected_union.begin(), expected_union.end(),
+                runs[i].begin(), runs[i].end(), std::back_inserter(tmp),
+                compare_keys());
+            expected_union.swap(tmp);
+
+            tmp.clear();
+            std::set_intersection(expected_intersection.begin(),
+                expected_intersection.end(), runs[i].begin(), runs[i].end(),
+                std::back_inserter(tmp), compare_keys());
+            expected_intersection.swap(tmp);
+        }
+    }
+
+    std::vector<element> d(expected_union.size() + 1, element(-1, 0));
+    auto r = test::run<ExPolicy>([&] {
+        return pika::multiway_set_union(
+            policy, runs.begin(), runs.end(), d.begin(), compare_keys());
+    });
+    PIKA_TEST(r == d.begin() + expected_union.size());
+    PIKA_TEST(std::equal(
+        expected_union.begin(), expected_union.end(), d.begin()));
+    PIKA_TEST_EQ(d.back().first, -1);
+
+    std::fill(d.begin(), d.end(), element(-1, 0));
+    r = test::run<ExPolicy>([&] {
+        return pika::multiway_set_intersection(
+            policy, runs.begin(), runs.end(), d.begin(), compare_keys());
+    });
+    PIKA_TEST(r == d.begin() + expected_intersection.size());
+    PIKA_TEST(std::equal(expected_intersection.begin(),
+        expected_intersection.end(), d.begin()));
+    PIKA_TEST_EQ(d[expected_intersection.size()].first, -1);
+}
+
+template <typename ExPolicy>
+void test_multiway_set_operation_exception(ExPolicy&& policy)
+{
+    auto runs = make_runs(16, 10000, 1000);
+    std::vector<element> d(16 * 20000);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::multiway_set_union(policy, runs.begin(), runs.end(),
+                d.begin(), [](element const&, element const&) -> bool {
+                    throw std::runtime_error("test");
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_multiway_set_operation()
+{
+    using namespace pika::execution;
+
+    for (std::size_t num_runs : {0, 1, 2, 3, 16, 64})
+    {
+        for (std::size_t run_size : {0, 1, 100, 10007})
+        {
+            // few distinct keys produce long ranges of equivalent elements
+            // spanning several runs and chunks, many distinct keys produce
+            // mostly empty intersections
+            for (int max_key : {3, 1000, 1000000})
+            {
+                auto runs = make_runs(num_runs, run_size, max_key);
+
+                test_multiway_set_operation(seq, runs);
+                test_multiway_set_operation(par, runs);
+                test_multiway_set_operation(par_unseq, runs);
+                test_multiway_set_operation(par(task), runs);
+            }
+        }
+    }
+
+    // a short run intersected with long ones
+    auto runs = make_runs(8, 100000, 100000);
+    runs[3].resize(10);
+    test_multiway_set_operation(par, runs);
+
+    test_multiway_set_operation_exception(par);
+    test_multiway_set_operation_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_multiway_set_operation();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,265 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/uninitialized_fill.hpp>
+#include <pika/parallel/util/non_temporal_stores.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// not written with non-temporal stores
+struct triple
+{
+    int a, b, c;
+
+    friend bool operator==(triple const& lhs, triple const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c;
+    }
+};
+
+template <typename T>
+T make_value(int i)
+{
+    if constexpr (std::is_same_v<T, triple>)
+    {
+        return triple{i, i + 1, i + 2};
+    }
+    else
+    {
+        return static_cast<T>(i % 100);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The sequences start at the given offset into their vectors, such that the
+// destination is not aligned for the non-temporal stores. The element
+// following the sequence must not be written.
+template <typename T, typename ExPolicy>
+void test_copy(ExPolicy policy, std::size_t size, std::size_t offset)
+{
+    std::uniform_int_distribution<int> dis(0, 1000);
+    std::vector<T> src(offset + size);
+    std::generate(
+        src.begin(), src.end(), [&] { return make_value<T>(dis(gen)); });
+
+    T const sentinel = make_value<T>(-1);
+    std::vector<T> dest(offset + size + 1, sentinel);
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::copy(policy, src.begin() + offset, src.end(),
+            dest.begin() + offset);
+    });
+
+    PIKA_TEST(result == dest.begin() + offset + size);
+    PIKA_TEST(std::equal(
+        src.begin() + offset, src.end(), dest.begin() + offset));
+    PIKA_TEST(dest.back() == sentinel);
+}
+
+template <typename T, typename ExPolicy>
+void test_fill(ExPolicy policy, std::size_t size, std::size_t offset)
+{
+    T const value = make_value<T>(42);
+    T const sentinel = make_value<T>(-1);
+
+    std::vector<T> c(offset + size + 1, sentinel);
+    test::run<ExPolicy>([&] {
+        return pika::fill(
+            policy, c.begin() + offset, c.begin() + offset + size, value);
+    });
+
+    PIKA_TEST(std::all_of(c.begin() + offset, c.end() - 1,
+        [&](T const& v) { return v == value; }));
+    PIKA_TEST(c.back() == sentinel);
+
+    std::vector<T> d(offset + size + 1, sentinel);
+    auto result = test::run<ExPolicy>(
+        [&] { return pika::fill_n(policy, d.begin() + offset, size, value); });
+
+    PIKA_TEST(result == d.begin() + offset + size);
+    PIKA_TEST(std::all_of(d.begin() + offset, d.end() - 1,
+        [&](T const& v) { return v == value; }));
+    PIKA_TEST(d.back() == sentinel);
+}
+
+template <typename T, typename ExPolicy>
+void test_transform(ExPolicy policy, std::size_t size, std::size_t offset)
+{
+    std::uniform_int_distribution<int> dis(0, 1000);
+    std::vector<T> a(offset + size);
+    std::vector<T> b(offset + size);
+    std::generate(a.begin(), a.end(), [&] { return make_value<T>(dis(gen)); });
+    std::generate(b.begin(), b.end(), [&] { return make_value<T>(dis(gen)); });
+
+    T const sentinel = make_value<T>(-1);
+    std::vector<T> c(offset + size + 1, sentinel);
+
+    // STREAM scale
+    auto scale = [](T v) { return static_cast<T>(3 * v); };
+    auto result = test::run<ExPolicy>([&] {
+        return pika::transform(policy, a.begin() + offset, a.end(),
+            c.begin() + offset, scale);
+    });
+
+    PIKA_TEST(result == c.begin() + offset + size);
+    for (std::size_t i = offset; i != offset + size; ++i)
+    {
+        PIKA_TEST_EQ(c[i], scale(a[i]));
+    }
+    PIKA_TEST_EQ(c.back(), sentinel);
+
+    // STREAM triad
+    auto triad = [](T v, T w) { return static_cast<T>(v + 3 * w); };
+    auto result2 = test::run<ExPolicy>([&] {
+        return pika::transform(policy, a.begin() + offset, a.end(),
+            b.begin() + offset, c.begin() + offset, triad);
+    });
+
+    PIKA_TEST(result2 == c.begin() + offset + size);
+    for (std::size_t i = offset; i != offset + size; ++i)
+    {
+        PIKA_TEST_EQ(c[i], triad(a[i], b[i]));
+    }
+    PIKA_TEST_EQ(c.back(), sentinel);
+}
+
+template <typename T, typename ExPolicy>
+void test_uninitialized_fill(
+    ExPolicy policy, std::size_t size, std::size_t offset)
+{
+    T const value = make_value<T>(42);
+    T const sentinel = make_value<T>(-1);
+
+    std::vector<T> c(offset + size + 1, sentinel);
+    test::run<ExPolicy>([&] {
+        return pika::uninitialized_fill(
+            policy, c.begin() + offset, c.begin() + offset + size, value);
+    });
+
+    PIKA_TEST(std::all_of(c.begin() + offset, c.end() - 1,
+        [&](T const& v) { return v == value; }));
+    PIKA_TEST(c.back() == sentinel);
+
+    std::vector<T> d(offset + size + 1, sentinel);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::uninitialized_fill_n(
+            policy, d.begin() + offset, size, value);
+    });
+
+    PIKA_TEST(result == d.begin() + offset + size);
+    PIKA_TEST(std::all_of(d.begin() + offset, d.end() - 1,
+        [&](T const& v) { return v == value; }));
+    PIKA_TEST(d.back() == sentinel);
+}
+
+template <typename T, typename ExPolicy>
+void test_non_temporal_stores(ExPolicy policy)
+{
+    for (std::size_t size : {0, 1, 7, 100007})
+    {
+        for (std::size_t offset : {0, 1, 3})
+        {
+            test_copy<T>(policy, size, offset);
+            test_fill<T>(policy, size, offset);
+            test_uninitialized_fill<T>(policy, size, offset);
+        }
+    }
+}
+
+template <typename T>
+void test_non_temporal_stores()
+{
+    using namespace pika::execution;
+    non_temporal_stores const nt{};
+
+    test_non_temporal_stores<T>(seq.with(nt));
+    test_non_temporal_stores<T>(par.with(nt));
+    test_non_temporal_stores<T>(par_unseq.with(nt));
+    test_non_temporal_stores<T>(par(task).with(nt));
+}
+
+template <typename T>
+void test_non_temporal_transform()
+{
+    using namespace pika::execution;
+    non_temporal_stores const nt{};
+
+    for (std::size_t size : {0, 1, 7, 100007})
+    {
+        for (std::size_t offset : {0, 1, 3})
+        {
+            test_transform<T>(seq.with(nt), size, offset);
+            test_transform<T>(par.with(nt), size, offset);
+            test_transform<T>(par(task).with(nt), size, offset);
+        }
+    }
+}
+
+void non_temporal_stores_test()
+{
+    test_non_temporal_stores<char>();
+    test_non_temporal_stores<int>();
+    test_non_temporal_stores<double>();
+    test_non_temporal_stores<triple>();
+
+    test_non_temporal_transform<int>();
+    test_non_temporal_transform<float>();
+    test_non_temporal_transform<double>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    non_temporal_stores_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -262,6 +262,38 @@ void test_nth_element_async(ExPolicy p, IteratorTag)
     }
 }
 
+// large enough for the selection to partition in parallel, the values are
+// drawn from a small set to get many duplicates of the selected element
+template <typename ExPolicy>
+void test_nth_element_large(ExPolicy policy, std::size_t max_value)
+{
+    std::size_t const size = 1 << 21;
+
+    std::vector<std::size_t> c(size);
+    std::uniform_int_distribution<std::size_t> dis(0, max_value);
+    std::generate(std::begin(c), std::end(c), [&]() { return dis(gen); });
+
+    std::vector<std::size_t> sorted = c;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    // the median and some percentiles
+    for (std::size_t nth : {std::size_t(0), size / 100, size / 2,
+             size - size / 100, size - 1})
+    {
+        std::vector<std::size_t> d = c;
+        test::run<ExPolicy>([&] {
+            return pika::nth_element(
+                policy, std::begin(d), std::begin(d) + nth, std::end(d));
+        });
+
+        PIKA_TEST_EQ(d[nth], sorted[nth]);
+        PIKA_TEST(std::all_of(std::begin(d), std::begin(d) + nth,
+            [&](std::size_t v) { return v <= d[nth]; }));
+        PIKA_TEST(std::all_of(std::begin(d) + nth, std::end(d),
+            [&](std::size_t v) { return d[nth] <= v; }));
+    }
+}
+
 template <typename IteratorTag>
 void test_nth_element()
 {
@@ -275,9 +307,21 @@ void test_nth_element()
     test_nth_element_async(par(task), IteratorTag());
 }
 
+void test_nth_element_large()
+{
+    using namespace pika::execution;
+    for (std::size_t max_value : {std::size_t(10), std::size_t(1) << 40})
+    {
+        test_nth_element_large(seq, max_value);
+        test_nth_element_large(par, max_value);
+        test_nth_element_large(par(task), max_value);
+    }
+}
+
 void nth_element_test()
 {
     test_nth_element<std::random_access_iterator_tag>();
+    test_nth_element_large();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/out_of_core_policy.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// The elements of a temporary file mapped into memory, or of a vector if the
+// file can not be mapped.
+class mapped_values
+{
+public:
+    explicit mapped_values(std::size_t size)
+      : size_(size)
+    {
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+        if (std::FILE* file = std::tmpfile())
+        {
+            std::size_t const bytes =
+                (std::max)(size * sizeof(std::int64_t), std::size_t(1));
+            if (::ftruncate(::fileno(file), static_cast<off_t>(bytes)) == 0)
+            {
+                void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_SHARED, ::fileno(file), 0);
+                if (p != MAP_FAILED)
+                {
+                    data_ = static_cast<std::int64_t*>(p);
+                }
+            }
+            std::fclose(file);
+        }
+#endif
+        if (data_ == nullptr)
+        {
+            fallback_.resize(size);
+            data_ = fallback_.data();
+        }
+    }
+
+    mapped_values(mapped_values const&) = delete;
+    mapped_values& operator=(mapped_values const&) = delete;
+
+    ~mapped_values()
+    {
+#if defined(PIKA_ALGORITHMS_HAVE_OUT_OF_CORE_MMAP)
+        if (fallback_.empty() && data_ != nullptr)
+        {
+            ::munmap(data_,
+                (std::max)(size_ * sizeof(std::int64_t), std::size_t(1)));
+        }
+#endif
+    }
+
+    std::int64_t* begin() const noexcept
+    {
+        return data_;
+    }
+
+    std::int64_t* end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+private:
+    std::size_t size_;
+    std::int64_t* data_ = nullptr;
+    std::vector<std::int64_t> fallback_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy>
+void test_out_of_core(
+    pika::execution::out_of_core_policy<Policy> const& policy, std::size_t size)
+{
+    mapped_values values(size);
+    std::uniform_int_distribution<std::int64_t> dist(-1000, 1000);
+    std::generate(values.begin(), values.end(), [&] { return dist(gen); });
+    std::vector<std::int64_t> expected(values.begin(), values.end());
+
+    // init is reduced only once, not once per window
+    PIKA_TEST_EQ(
+        pika::reduce(policy, values.begin(), values.end(), std::int64_t(7)),
+        std::accumulate(expected.begin(), expected.end(), std::int64_t(7)));
+    PIKA_TEST_EQ(pika::reduce(policy, values.begin(), values.end()),
+        std::accumulate(expected.begin(), expected.end(), std::int64_t(0)));
+    PIKA_TEST_EQ(pika::transform_reduce(policy, values.begin(), values.end(),
+                     std::int64_t(3), std::plus<>(),
+                     [](std::int64_t value) { return value * value; }),
+        std::transform_reduce(expected.begin(), expected.end(),
+            std::int64_t(3), std::plus<>(),
+            [](std::int64_t value) { return value * value; }));
+
+    pika::for_each(policy, values.begin(), values.end(),
+        [](std::int64_t& value) { value *= 2; });
+    for (auto& value : expected)
+    {
+        value *= 2;
+    }
+    PIKA_TEST(std::equal(values.begin(), values.end(), expected.begin()));
+
+    // the windows are sorted and merged through a temporary file
+    pika::sort(policy, values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(std::equal(values.begin(), values.end(), expected.begin()));
+
+    pika::sort(policy, values.begin(), values.end(), std::greater<>());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    PIKA_TEST(std::equal(values.begin(), values.end(), expected.begin()));
+}
+
+void test_out_of_core_strings(std::size_t size, std::size_t window_bytes)
+{
+    // elements which are not trivially copyable
+    std::vector<std::string> values(size);
+    std::generate(values.begin(), values.end(),
+        [&] { return std::to_string(gen()) + std::string(32, 'x'); });
+    std::vector<std::string> expected = values;
+
+    pika::execution::out_of_core_policy<> policy(
+        pika::execution::par, window_bytes);
+    pika::sort(policy, values.data(), values.data() + size);
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(values == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    for (std::size_t size : {0, 1, 1000, 100003})
+    {
+        // many windows, a single element per window, a single window
+        for (std::size_t window_bytes :
+            {std::size_t(4096), std::size_t(1), std::size_t(1) << 24})
+        {
+            if (window_bytes == 1 && size > 1000)
+            {
+                continue;
+            }
+            test_out_of_core(pika::execution::out_of_core_policy<>(
+                                 pika::execution::par, window_bytes),
+                size);
+            test_out_of_core(
+                pika::execution::out_of_core_policy<
+                    pika::execution::sequenced_policy>(
+                    pika::execution::seq, window_bytes),
+                size);
+        }
+        test_out_of_core_strings(size, 4096);
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::printf("using seed: %u\n", seed);
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
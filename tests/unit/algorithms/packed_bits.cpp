@@ -0,0 +1,217 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/all_any_none.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/count.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/find.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+std::vector<bool> random_bits(std::size_t size, int density)
+{
+    std::vector<bool> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = std::rand() % density == 0;
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the searches start and end in the middle of words
+template <typename ExPolicy>
+void test_packed_bits_search(ExPolicy policy, std::size_t size, int density)
+{
+    std::vector<bool> const c = random_bits(size, density);
+    std::size_t const skip = size == 0 ? 0 : std::rand() % (size / 4 + 1);
+    auto const first = c.begin() + skip;
+    auto const last = c.end() - skip / 2;
+
+    auto counted = test::run<ExPolicy>(
+        [&] { return pika::count(policy, first, last, true); });
+    PIKA_TEST_EQ(counted, std::count(first, last, true));
+
+    counted = test::run<ExPolicy>([&] {
+        return pika::count_if(policy, first, last, [](bool b) { return !b; });
+    });
+    PIKA_TEST_EQ(counted, std::count(first, last, false));
+
+    // values other than 0 and 1 compare equal to no bit
+    counted = test::run<ExPolicy>(
+        [&] { return pika::count(policy, first, last, 2); });
+    PIKA_TEST_EQ(counted, 0);
+
+    for (bool value : {false, true})
+    {
+        auto found = test::run<ExPolicy>(
+            [&] { return pika::find(policy, first, last, value); });
+        PIKA_TEST(found == std::find(first, last, value));
+
+        found = test::run<ExPolicy>([&] {
+            return pika::find_if(
+                policy, first, last, [value](bool b) { return b == value; });
+        });
+        PIKA_TEST(found == std::find(first, last, value));
+
+        found = test::run<ExPolicy>([&] {
+            return pika::find_if_not(
+                policy, first, last, [value](bool b) { return b == value; });
+        });
+        PIKA_TEST(found == std::find(first, last, !value));
+
+        auto is_value = [value](bool b) { return b == value; };
+        PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+            return pika::all_of(policy, first, last, is_value);
+        }),
+            std::all_of(first, last, is_value));
+        PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+            return pika::any_of(policy, first, last, is_value);
+        }),
+            std::any_of(first, last, is_value));
+        PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+            return pika::none_of(policy, first, last, is_value);
+        }),
+            std::none_of(first, last, is_value));
+    }
+}
+
+// no two chunks write the same word
+template <typename ExPolicy>
+void test_packed_bits_fill_copy(ExPolicy policy, std::size_t size)
+{
+    std::vector<bool> const c = random_bits(size, 2);
+    std::size_t const skip = size == 0 ? 0 : std::rand() % (size / 4 + 1);
+
+    for (bool value : {false, true})
+    {
+        std::vector<bool> d = c;
+        std::vector<bool> expected = c;
+        std::fill(expected.begin() + skip, expected.end() - skip / 2, value);
+
+        test::run<ExPolicy>([&] {
+            return pika::fill(
+                policy, d.begin() + skip, d.end() - skip / 2, value);
+        });
+        PIKA_TEST(d == expected);
+
+        d = c;
+        auto result = test::run<ExPolicy>([&] {
+            return pika::fill_n(
+                policy, d.begin() + skip, size - skip - skip / 2, value);
+        });
+        PIKA_TEST(result == d.end() - skip / 2);
+        PIKA_TEST(d == expected);
+    }
+
+    // copy between different offsets into the words
+    std::vector<bool> d = random_bits(size + 100, 3);
+    std::size_t const offset = std::rand() % 100;
+    std::vector<bool> expected = d;
+    std::copy(c.begin() + skip, c.end(), expected.begin() + offset);
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::copy(policy, c.cbegin() + skip, c.cend(),
+            d.begin() + std::ptrdiff_t(offset));
+    });
+    PIKA_TEST(result == d.begin() + std::ptrdiff_t(offset + size - skip));
+    PIKA_TEST(d == expected);
+
+    std::vector<bool> e = random_bits(size + 100, 3);
+    expected = e;
+    std::copy_n(c.begin(), size, expected.begin() + offset);
+
+    result = test::run<ExPolicy>([&] {
+        return pika::copy_n(
+            policy, c.begin(), size, e.begin() + std::ptrdiff_t(offset));
+    });
+    PIKA_TEST(result == e.begin() + std::ptrdiff_t(offset + size));
+    PIKA_TEST(e == expected);
+}
+
+void packed_bits_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 1000, 100007})
+    {
+        for (int density : {1, 2, 1000000})
+        {
+            test_packed_bits_search(seq, size, density);
+            test_packed_bits_search(par, size, density);
+            test_packed_bits_search(par_unseq, size, density);
+            test_packed_bits_search(par(task), size, density);
+        }
+
+        test_packed_bits_fill_copy(seq, size);
+        test_packed_bits_fill_copy(par, size);
+        test_packed_bits_fill_copy(par_unseq, size);
+        test_packed_bits_fill_copy(par(task), size);
+    }
+
+    // sequential overloads
+    std::vector<bool> c = random_bits(1000, 5);
+    PIKA_TEST_EQ(pika::count(c.begin(), c.end(), true),
+        std::count(c.begin(), c.end(), true));
+    PIKA_TEST(pika::find(c.begin(), c.end(), true) ==
+        std::find(c.begin(), c.end(), true));
+
+    pika::fill(c.begin() + 3, c.end() - 5, true);
+    PIKA_TEST(
+        pika::all_of(c.begin() + 3, c.end() - 5, [](bool b) { return b; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    packed_bits_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include <pika/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <random>
@@ -109,6 +110,36 @@ void test_partial_sort_async(ExPolicy p, IteratorTag)
     }
 }
 
+// large enough for the smallest elements to be selected in parallel
+template <typename ExPolicy>
+void test_partial_sort_large(ExPolicy p)
+{
+    using compare_t = std::less<std::uint64_t>;
+
+    std::size_t const size = 1 << 21;
+    std::vector<std::uint64_t> A(size), B;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        A[i] = i % 100003;
+    }
+    std::shuffle(A.begin(), A.end(), gen);
+
+    std::vector<std::uint64_t> expected = A;
+    std::sort(expected.begin(), expected.end());
+
+    for (std::size_t middle : {std::size_t(1), std::size_t(1000), size / 3,
+             size - 1, size})
+    {
+        B = A;
+        test::run<ExPolicy>([&] {
+            return pika::partial_sort(
+                p, B.begin(), B.begin() + middle, B.end(), compare_t());
+        });
+
+        PIKA_TEST(std::equal(B.begin(), B.begin() + middle, expected.begin()));
+    }
+}
+
 template <typename IteratorTag>
 void test_partial_sort()
 {
@@ -120,6 +151,10 @@ void test_partial_sort()
 
     test_partial_sort_async(seq(task), IteratorTag());
     test_partial_sort_async(par(task), IteratorTag());
+
+    test_partial_sort_large(seq);
+    test_partial_sort_large(par);
+    test_partial_sort_large(par(task));
 }
 
 void partial_sort_test()
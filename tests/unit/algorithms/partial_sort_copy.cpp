@@ -15,6 +15,7 @@
 #include <pika/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <list>
@@ -484,6 +485,46 @@ void partial_sort_test3()
     test_partial_sort_copy3<std::forward_iterator_tag>();
 }
 
+// large enough for the smallest elements of the chunks of the input to be
+// selected independently
+template <typename ExPolicy, typename Container>
+void test_partial_sort_copy_large(ExPolicy policy, Container const& input,
+    std::vector<std::uint64_t> const& expected)
+{
+    using compare_t = std::less<std::uint64_t>;
+
+    for (std::size_t count : {std::size_t(1), std::size_t(100),
+             std::size_t(10000), expected.size() / 3})
+    {
+        std::vector<std::uint64_t> A(count);
+        auto result = pika::partial_sort_copy(policy, input.begin(),
+            input.end(), A.begin(), A.end(), compare_t());
+
+        PIKA_TEST(result == A.end());
+        PIKA_TEST(std::equal(A.begin(), A.end(), expected.begin()));
+    }
+}
+
+void partial_sort_test_large()
+{
+    using namespace pika::execution;
+
+    std::vector<std::uint64_t> A(1 << 21);
+    for (std::size_t i = 0; i < A.size(); ++i)
+    {
+        A[i] = i % 100003;
+    }
+    std::shuffle(A.begin(), A.end(), gen);
+    std::list<std::uint64_t> lst(A.begin(), A.end());
+
+    std::vector<std::uint64_t> expected = A;
+    std::sort(expected.begin(), expected.end());
+
+    test_partial_sort_copy_large(par, A, expected);
+    test_partial_sort_copy_large(par_unseq, A, expected);
+    test_partial_sort_copy_large(par, lst, expected);
+}
+
 int pika_main(pika::program_options::variables_map& vm)
 {
     if (vm.count("seed"))
@@ -495,6 +536,7 @@ int pika_main(pika::program_options::variables_map& vm)
     partial_sort_test1();
     partial_sort_test2();
     partial_sort_test3();
+    partial_sort_test_large();
 
     return pika::finalize();
 }
@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<int> make_values(std::size_t size, int range)
+{
+    std::vector<int> values(size);
+    for (int& value : values)
+    {
+        value = static_cast<int>(gen() % range);
+    }
+    return values;
+}
+
+template <typename Iter>
+void check_partition3(std::pair<Iter, Iter> const& result, Iter first,
+    Iter last, int pivot)
+{
+    for (Iter it = first; it != result.first; ++it)
+    {
+        PIKA_TEST(*it < pivot);
+    }
+    for (Iter it = result.first; it != result.second; ++it)
+    {
+        PIKA_TEST(*it == pivot);
+    }
+    for (Iter it = result.second; it != last; ++it)
+    {
+        PIKA_TEST(*it > pivot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Container>
+void test_partition3(ExPolicy policy, std::vector<int> const& values, int pivot)
+{
+    Container c(values.begin(), values.end());
+
+    auto less = [pivot](int value) { return value < pivot; };
+    auto equal = [pivot](int value) { return value == pivot; };
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::partition3(policy, c.begin(), c.end(), less, equal);
+    });
+    check_partition3(result, c.begin(), c.end(), pivot);
+
+    // the elements of the range are only permuted
+    std::vector<int> sorted(c.begin(), c.end());
+    std::vector<int> expected = values;
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(sorted == expected);
+}
+
+template <typename Container>
+void test_partition3()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007, 1000003})
+    {
+        for (int range : {1, 3, 1000})
+        {
+            std::vector<int> const values = make_values(size, range);
+            int const pivot = static_cast<int>(gen() % range);
+
+            {
+                Container c(values.begin(), values.end());
+                auto result = pika::partition3(c.begin(), c.end(),
+                    [pivot](int value) { return value < pivot; },
+                    [pivot](int value) { return value == pivot; });
+                check_partition3(result, c.begin(), c.end(), pivot);
+            }
+
+            test_partition3<sequenced_policy, Container>(seq, values, pivot);
+            test_partition3<parallel_policy, Container>(par, values, pivot);
+            test_partition3<parallel_unsequenced_policy, Container>(
+                par_unseq, values, pivot);
+            test_partition3<sequenced_task_policy, Container>(
+                seq(task), values, pivot);
+            test_partition3<parallel_task_policy, Container>(
+                par(task), values, pivot);
+        }
+    }
+}
+
+void partition3_test()
+{
+    test_partition3<std::vector<int>>();
+    test_partition3<std::forward_list<int>>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// sort separates the keys equal to the pivot if there are many of them
+void sort_equal_keys_test()
+{
+    using namespace pika::execution;
+
+    for (int range : {1, 2, 10, 100})
+    {
+        std::vector<int> values = make_values(std::size_t(1) << 22, range);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        // a comparison function object prevents using the radix sort
+        pika::sort(
+            par, values.begin(), values.end(), [](int lhs, int rhs) {
+                return lhs < rhs;
+            });
+        PIKA_TEST(values == expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partition3_test();
+    sort_equal_keys_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
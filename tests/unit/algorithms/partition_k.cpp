@@ -0,0 +1,145 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    int key;
+    std::size_t index;
+};
+
+bool operator==(element const& lhs, element const& rhs)
+{
+    return lhs.key == rhs.key && lhs.index == rhs.index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partition_k(ExPolicy policy, std::size_t size, std::size_t k)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{static_cast<int>(gen() % 100000), i};
+    }
+
+    auto classifier = [k](int key) { return std::size_t(key) % k; };
+
+    // the elements of a bucket keep their order
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [&](element const& lhs, element const& rhs) {
+            return classifier(lhs.key) < classifier(rhs.key);
+        });
+
+    std::vector<std::size_t> offsets(k + 1);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::partition_k(policy, c.begin(), c.end(), k, classifier,
+            offsets.begin(), &element::key);
+    });
+    PIKA_TEST(result == offsets.end());
+    PIKA_TEST(c == expected);
+
+    PIKA_TEST_EQ(offsets.front(), std::size_t(0));
+    PIKA_TEST_EQ(offsets.back(), size);
+    for (std::size_t b = 0; b != k; ++b)
+    {
+        for (std::size_t i = offsets[b]; i != offsets[b + 1]; ++i)
+        {
+            PIKA_TEST_EQ(classifier(c[i].key), b);
+        }
+    }
+}
+
+void partition_k_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007, 1000003})
+    {
+        for (std::size_t k : {1, 2, 3, 256, 10000})
+        {
+            {
+                std::vector<int> c(size);
+                std::generate(c.begin(), c.end(),
+                    [&]() { return static_cast<int>(gen() % 1000); });
+                std::vector<std::size_t> offsets(k + 1);
+                pika::partition_k(c.begin(), c.end(), k,
+                    [k](int value) { return std::size_t(value) % k; },
+                    offsets.begin());
+                PIKA_TEST_EQ(offsets.back(), size);
+                for (std::size_t b = 0; b != k; ++b)
+                {
+                    for (std::size_t i = offsets[b]; i != offsets[b + 1]; ++i)
+                    {
+                        PIKA_TEST_EQ(std::size_t(c[i]) % k, b);
+                    }
+                }
+            }
+
+            test_partition_k(seq, size, k);
+            test_partition_k(par, size, k);
+            test_partition_k(par_unseq, size, k);
+            test_partition_k(seq(task), size, k);
+            test_partition_k(par(task), size, k);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partition_k_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/util/partition_cache_size.hpp>
 #include <pika/testing.hpp>
 #include <pika/type_support/unused.hpp>
 
@@ -476,6 +477,18 @@ void test_partition()
         par_unseq, IteratorTag(), user_defined_type(),
         [](user_defined_type const&) -> bool { return false; }, rand_base);
 
+    ////////// Test cases for blocks sized to a given cache.
+    test_partition(
+        par.with(partition_cache_size(1)), IteratorTag(), int(),
+        [rand_base](const int n) -> bool { return n < rand_base; }, 123456,
+        random_fill(rand_base, 12345));
+    test_partition(
+        par.with(partition_cache_size(std::size_t(1) << 24)), IteratorTag(),
+        user_defined_type(),
+        [rand_base](
+            user_defined_type const& t) -> bool { return t < rand_base; },
+        123456, random_fill(rand_base, 12345));
+
     ////////// Many test cases for meticulous tests.
 #if !defined(PIKA_ALGORITHMS_DEBUG) && !defined(PIKA_HAVE_SANITIZERS) &&       \
     !defined(PIKA_ALGORITHMS_HAVE_SANITIZERS)
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/precompiled.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_precompiled(ExPolicy const& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> sorted = c;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<T> d = c;
+    pika::precompiled::sort(policy, d.data(), d.data() + size);
+    PIKA_TEST(d == sorted);
+
+    d = c;
+    pika::precompiled::stable_sort(policy, d.data(), d.data() + size);
+    PIKA_TEST(d == sorted);
+
+    // the sums are exact for all types, they stay below 2^24 and wrap
+    // around for std::uint8_t
+    PIKA_TEST_EQ(pika::precompiled::reduce(
+                     policy, c.data(), c.data() + size, T(1)),
+        std::accumulate(c.begin(), c.end(), T(1)));
+
+    std::vector<T> e(size);
+    std::vector<T> expected(size);
+    std::partial_sum(c.begin(), c.end(), expected.begin());
+    PIKA_TEST(pika::precompiled::inclusive_scan(policy, c.data(),
+                  c.data() + size, e.data()) == e.data() + size);
+    PIKA_TEST(e == expected);
+
+    std::fill(e.begin(), e.end(), T(0));
+    auto const is_odd = [](T value) { return int(value) % 2 != 0; };
+    auto const count = std::count_if(c.begin(), c.end(), is_odd);
+    T* const result = pika::precompiled::copy_if(
+        policy, c.data(), c.data() + size, e.data(), is_odd);
+    PIKA_TEST(result == e.data() + count);
+    PIKA_TEST(std::all_of(e.data(), result, is_odd));
+}
+
+template <typename ExPolicy>
+void test_precompiled(ExPolicy const& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        test_precompiled<ExPolicy, std::int32_t>(policy, size);
+        test_precompiled<ExPolicy, std::int64_t>(policy, size);
+        test_precompiled<ExPolicy, float>(policy, size);
+        test_precompiled<ExPolicy, double>(policy, size);
+        test_precompiled<ExPolicy, std::uint8_t>(policy, size);
+    }
+}
+
+void precompiled_test()
+{
+    using namespace pika::execution;
+
+    test_precompiled(seq);
+    test_precompiled(par);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    precompiled_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -4,15 +4,18 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <pika/execution.hpp>
 #include <pika/init.hpp>
 #include <pika/parallel/algorithms/reduce.hpp>
 #include <pika/testing.hpp>
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
 #include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -104,6 +107,7 @@ void reduce_test1()
 {
     test_reduce1<std::random_access_iterator_tag>();
     test_reduce1<std::forward_iterator_tag>();
+    test_reduce1<std::input_iterator_tag>();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -183,6 +187,7 @@ void reduce_test2()
 {
     test_reduce2<std::random_access_iterator_tag>();
     test_reduce2<std::forward_iterator_tag>();
+    test_reduce2<std::input_iterator_tag>();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -262,6 +267,7 @@ void reduce_test3()
 {
     test_reduce3<std::random_access_iterator_tag>();
     test_reduce3<std::forward_iterator_tag>();
+    test_reduce3<std::input_iterator_tag>();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -448,6 +454,44 @@ void reduce_bad_alloc_test()
 {
     test_reduce_bad_alloc<std::random_access_iterator_tag>();
     test_reduce_bad_alloc<std::forward_iterator_tag>();
+    test_reduce_bad_alloc<std::input_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// single pass ranges are reduced in batches which are read ahead
+template <typename ExPolicy>
+void test_reduce_stream(ExPolicy policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::iota(std::begin(c), std::end(c), int(gen() % 1000));
+
+    std::stringstream ss;
+    for (int v : c)
+    {
+        ss << v << ' ';
+    }
+
+    int const expected = std::accumulate(std::begin(c), std::end(c), 42);
+
+    int r = test::run<ExPolicy>([&] {
+        return pika::reduce(policy, std::istream_iterator<int>(ss),
+            std::istream_iterator<int>(), 42, std::plus<>());
+    });
+    PIKA_TEST_EQ(r, expected);
+}
+
+void reduce_stream_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 4096, 4097, 100007})
+    {
+        test_reduce_stream(seq, size);
+        test_reduce_stream(par, size);
+        test_reduce_stream(par_unseq, size);
+        test_reduce_stream(par(task), size);
+        test_reduce_stream(par.with(static_chunk_size(100)), size);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -463,6 +507,7 @@ int pika_main(pika::program_options::variables_map& vm)
     reduce_test1();
     reduce_test2();
     reduce_test3();
+    reduce_stream_test();
 
     reduce_exception_test();
     reduce_bad_alloc_test();
@@ -11,8 +11,12 @@
 #include <pika/testing.hpp>
 #include <pika/testing/performance.hpp>
 //
+#include <cstddef>
+#include <functional>
 #include <iomanip>
+#include <numeric>
 #include <random>
+#include <string>
 #include <utility>
 #include <vector>
 #ifdef EXTRA_DEBUG
@@ -486,6 +490,92 @@ void test_reduce_by_key1()
         [](double a) { return std::floor(a); });
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// reduces the runs of equal keys one after the other
+template <typename Key, typename Value, typename Op>
+std::pair<std::vector<Key>, std::vector<Value>> reduce_by_key_reference(
+    std::vector<Key> const& keys, std::vector<Value> const& values, Op op)
+{
+    std::pair<std::vector<Key>, std::vector<Value>> result;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        if (i == 0 || keys[i - 1] != keys[i])
+        {
+            result.first.push_back(keys[i]);
+            result.second.push_back(values[i]);
+        }
+        else
+        {
+            result.second.back() = op(result.second.back(), values[i]);
+        }
+    }
+    return result;
+}
+
+template <typename ExPolicy, typename Key, typename Value, typename Op>
+void test_reduce_by_key_runs(ExPolicy&& policy, std::vector<Key> const& keys,
+    std::vector<Value> const& values, Op op)
+{
+    auto const expected = reduce_by_key_reference(keys, values, op);
+
+    std::vector<Key> keys_out(keys.size());
+    std::vector<Value> values_out(values.size());
+    auto r = test::run<ExPolicy>([&] {
+        return pika::reduce_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), keys_out.begin(), values_out.begin(),
+            std::equal_to<Key>(), op);
+    });
+    keys_out.erase(r.in, keys_out.end());
+    values_out.erase(r.out, values_out.end());
+
+    PIKA_TEST(keys_out == expected.first);
+    PIKA_TEST(values_out == expected.second);
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_runs(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+
+    // a run spanning several chunks between short runs
+    std::vector<int> keys(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = (i < size / 4 || i >= 3 * size / 4) ? int(i / 3) : -1;
+    }
+    test_reduce_by_key_runs(policy, keys, values, std::plus<int>());
+
+    // the whole input is a single run
+    std::fill(keys.begin(), keys.end(), 7);
+    test_reduce_by_key_runs(policy, keys, values, std::plus<int>());
+
+    // every key is unique
+    std::iota(keys.begin(), keys.end(), 0);
+    test_reduce_by_key_runs(policy, keys, values, std::plus<int>());
+
+    // the values of a run have to be combined in order
+    std::vector<std::string> strings(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = i < size / 2 ? int(i / 1000) : -1;
+        strings[i] = std::string(1, char('a' + i % 26));
+    }
+    test_reduce_by_key_runs(policy, keys, strings,
+        [](std::string const& lhs, std::string const& rhs) {
+            return lhs + rhs;
+        });
+}
+
+void test_reduce_by_key_runs()
+{
+    using namespace pika::execution;
+
+    test_reduce_by_key_runs(par);
+    test_reduce_by_key_runs(par(task));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int pika_main(pika::program_options::variables_map& vm)
 {
@@ -497,6 +587,7 @@ int pika_main(pika::program_options::variables_map& vm)
     gen.seed(seed);
 
     test_reduce_by_key1();
+    test_reduce_by_key_runs();
     //    test_reduce_by_key2();
     return pika::finalize();
 }
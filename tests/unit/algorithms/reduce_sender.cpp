@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+namespace ex = pika::execution::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_reduce_sender(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&] { return dis(gen); });
+    int const expected = std::accumulate(c.begin(), c.end(), 42);
+
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(c.begin(), c.end(), 42, std::plus<>()) |
+                     pika::reduce(policy)),
+        expected);
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(c.begin(), c.end(), 42) |
+                     pika::reduce(policy)),
+        expected);
+    PIKA_TEST_EQ(
+        tt::sync_wait(ex::just(c.begin(), c.end()) | pika::reduce(policy)),
+        expected - 42);
+
+    // the result is passed on to the next stage of the pipeline
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(c.begin(), c.end(), 42) |
+                     pika::reduce(policy) |
+                     ex::then([](int r) { return 2 * r; })),
+        2 * expected);
+}
+
+// the reductions of a simple solver iteration: dot products whose results
+// are used to update the vectors
+template <typename ExPolicy>
+void test_transform_reduce_sender(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-8, 8);
+    std::vector<double> x(size);
+    std::vector<double> y(size);
+    std::generate(x.begin(), x.end(), [&] { return double(dis(gen)); });
+    std::generate(y.begin(), y.end(), [&] { return double(dis(gen)); });
+    double const expected =
+        std::inner_product(x.begin(), x.end(), y.begin(), 0.5);
+
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(x.begin(), x.end(), y.begin(), 0.5) |
+                     pika::transform_reduce(policy)),
+        expected);
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(x.begin(), x.end(), y.begin(), 0.5,
+                                   std::plus<>(), std::multiplies<>()) |
+                     pika::transform_reduce(policy)),
+        expected);
+
+    auto axpy = [&](double alpha) {
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            y[i] += alpha * x[i];
+        }
+        return ex::just(y.begin(), y.end(), y.begin(), 0.0);
+    };
+
+    double const alpha = 2.0;
+    std::vector<double> z = y;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        z[i] += alpha * x[i];
+    }
+    double const expected_norm =
+        std::inner_product(z.begin(), z.end(), z.begin(), 0.0);
+
+    PIKA_TEST_EQ(tt::sync_wait(ex::just(alpha) | ex::let_value(axpy) |
+                     pika::transform_reduce(policy)),
+        expected_norm);
+}
+
+// sequences which are not random access are reduced by the algorithm with a
+// task policy, the results are the same
+template <typename ExPolicy>
+void test_reduce_sender_forward(ExPolicy&& policy)
+{
+    std::list<int> c(10007);
+    std::iota(c.begin(), c.end(), 0);
+    int const expected = std::accumulate(c.begin(), c.end(), 0);
+
+    PIKA_TEST_EQ(
+        tt::sync_wait(ex::just(c.begin(), c.end()) | pika::reduce(policy)),
+        expected);
+}
+
+template <typename ExPolicy>
+void test_reduce_sender_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        tt::sync_wait(ex::just(c.begin(), c.end(), 0,
+                          [](int, int) -> int {
+                              throw std::runtime_error("test");
+                          }) |
+            pika::reduce(policy));
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void reduce_sender_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_reduce_sender(seq, size);
+        test_reduce_sender(par, size);
+        test_reduce_sender(par_unseq, size);
+        test_reduce_sender(par(task), size);
+
+        test_transform_reduce_sender(seq, size);
+        test_transform_reduce_sender(par, size);
+        test_transform_reduce_sender(par(task), size);
+    }
+
+    test_reduce_sender_forward(seq);
+    test_reduce_sender_forward(par);
+
+    test_reduce_sender_exception(seq);
+    test_reduce_sender_exception(par);
+    test_reduce_sender_exception(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    reduce_sender_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
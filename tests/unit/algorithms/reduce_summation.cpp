@@ -0,0 +1,252 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/util/summation.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the bound of the error of a sum of values with the given sum of absolute
+// values
+double error_bound(pika::execution::summation_mode mode, std::size_t size,
+    double abs_sum)
+{
+    double const eps = std::numeric_limits<float>::epsilon();
+    if (mode == pika::execution::summation_mode::compensated)
+    {
+        return 2 * eps * abs_sum;
+    }
+    return (128 + std::log2(double(size) + 1) + 2) * eps * abs_sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the float results are compared with sums computed in double precision
+template <typename ExPolicy>
+void test_summation_float(ExPolicy&& policy, std::size_t size)
+{
+    auto const mode = policy.parameters().get_summation_mode();
+
+    std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+    std::vector<float> c(size);
+    std::vector<float> d(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = dis(gen);
+        d[i] = dis(gen);
+    }
+
+    double sum = 1.0;
+    double sum_third = 1.0;
+    double sum_products = 1.0;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum += c[i];
+        sum_third += c[i] / 3.0f;
+        sum_products += c[i] * d[i];
+    }
+
+    // reduce
+    {
+        float r = test::run<ExPolicy>([&] {
+            return pika::reduce(
+                policy, c.begin(), c.end(), 1.0f, std::plus<>());
+        });
+        PIKA_TEST_LTE(std::abs(r - sum), error_bound(mode, size, sum));
+    }
+
+    // transform_reduce
+    {
+        float r = test::run<ExPolicy>([&] {
+            return pika::transform_reduce(policy, c.begin(), c.end(), 1.0f,
+                std::plus<float>(), [](float x) { return x / 3.0f; });
+        });
+        PIKA_TEST_LTE(
+            std::abs(r - sum_third), error_bound(mode, size, sum_third));
+    }
+
+    // transform_reduce_binary
+    {
+        float r = test::run<ExPolicy>([&] {
+            return pika::transform_reduce(policy, c.begin(), c.end(), d.begin(),
+                1.0f, std::plus<>(), std::multiplies<>());
+        });
+        PIKA_TEST_LTE(
+            std::abs(r - sum_products), error_bound(mode, size, sum_products));
+    }
+}
+
+// the large values cancel out, the compensated sum retains the small ones
+// independently of how the values are split into chunks
+template <typename ExPolicy>
+void test_summation_cancellation(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> c(4 * size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[4 * i] = 1.0;
+        c[4 * i + 1] = 1e100;
+        c[4 * i + 2] = 1.0;
+        c[4 * i + 3] = -1e100;
+    }
+
+    double r = test::run<ExPolicy>([&] {
+        return pika::reduce(
+            policy, c.begin(), c.end(), 0.5, std::plus<double>());
+    });
+    PIKA_TEST_EQ(r, 2.0 * double(size) + 0.5);
+
+    r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(policy, c.begin(), c.end(), 0.0,
+            std::plus<>(), [](double x) { return 2 * x; });
+    });
+    PIKA_TEST_EQ(r, 4.0 * double(size));
+}
+
+// the results do not depend on the policy and the chunks used to compute
+// them
+template <typename ExPolicy>
+void test_summation_reproducible(ExPolicy&& policy, std::size_t size)
+{
+    using namespace pika::execution;
+    summation const reproducible(summation_mode::reproducible);
+
+    // values spanning many orders of magnitude make the result depend on
+    // the order of the additions
+    std::uniform_real_distribution<double> dis(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<double> c(size);
+    std::vector<double> d(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = std::ldexp(dis(gen), exponent(gen));
+        d[i] = dis(gen);
+    }
+
+    double const expected = pika::reduce(
+        seq.with(reproducible), c.begin(), c.end(), 1.0, std::plus<>());
+    double r = test::run<ExPolicy>([&] {
+        return pika::reduce(policy, c.begin(), c.end(), 1.0, std::plus<>());
+    });
+    PIKA_TEST_EQ(r, expected);
+
+    double const expected_products =
+        pika::transform_reduce(seq.with(reproducible), c.begin(), c.end(),
+            d.begin(), 0.0, std::plus<>(), std::multiplies<>());
+    r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(policy, c.begin(), c.end(), d.begin(),
+            0.0, std::plus<>(), std::multiplies<>());
+    });
+    PIKA_TEST_EQ(r, expected_products);
+}
+
+// other reductions are not affected
+template <typename ExPolicy>
+void test_summation_other(ExPolicy&& policy)
+{
+    std::vector<double> c(10007, 2.0);
+    double r = test::run<ExPolicy>([&] {
+        return pika::reduce(policy, c.begin(), c.end(), 1.0,
+            [](double x, double y) { return (std::max)(x, y); });
+    });
+    PIKA_TEST_EQ(r, 2.0);
+
+    std::vector<int> i(10007, 1);
+    int n = test::run<ExPolicy>([&] {
+        return pika::reduce(policy, i.begin(), i.end(), 0, std::plus<>());
+    });
+    PIKA_TEST_EQ(n, 10007);
+}
+
+void test_summation()
+{
+    using namespace pika::execution;
+
+    for (summation_mode mode : {summation_mode::compensated,
+             summation_mode::pairwise, summation_mode::reproducible})
+    {
+        summation const s(mode);
+        for (std::size_t size : {0, 1, 1000, 100007, 1000000})
+        {
+            test_summation_float(seq.with(s), size);
+            test_summation_float(par.with(s), size);
+            test_summation_float(par_unseq.with(s), size);
+            test_summation_float(par(task).with(s), size);
+        }
+
+        test_summation_other(seq.with(s));
+        test_summation_other(par.with(s));
+    }
+
+    summation const compensated(summation_mode::compensated);
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_summation_cancellation(seq.with(compensated), size);
+        test_summation_cancellation(par.with(compensated), size);
+        test_summation_cancellation(par(task).with(compensated), size);
+    }
+
+    summation const reproducible(summation_mode::reproducible);
+    for (std::size_t size : {0, 1, 4096, 4097, 100007, 1000000})
+    {
+        test_summation_reproducible(par.with(reproducible), size);
+        test_summation_reproducible(par_unseq.with(reproducible), size);
+        test_summation_reproducible(par(task).with(reproducible), size);
+    }
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_summation();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/run_length_encode.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// Runs with lengths up to twice the given average length
+std::vector<int> make_runs(std::size_t size, std::size_t run_length)
+{
+    std::uniform_int_distribution<std::size_t> length(1, 2 * run_length);
+    std::uniform_int_distribution<int> value(0, 3);
+
+    std::vector<int> v;
+    v.reserve(size);
+    while (v.size() != size)
+    {
+        // adjacent runs may have the same value and are merged then
+        std::size_t const n = (std::min)(length(gen), size - v.size());
+        v.insert(v.end(), n, value(gen));
+    }
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_run_length_encode(ExPolicy&& policy, std::vector<int> const& v)
+{
+    std::vector<int> expected_values;
+    std::vector<std::size_t> expected_counts;
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        if (i == 0 || v[i] != v[i - 1])
+        {
+            expected_values.push_back(v[i]);
+            expected_counts.push_back(0);
+        }
+        ++expected_counts.back();
+    }
+
+    std::vector<int> values(v.size());
+    std::vector<std::size_t> counts(v.size());
+    auto r1 = test::run<ExPolicy>([&] {
+        return pika::run_length_encode(
+            policy, v.begin(), v.end(), values.begin(), counts.begin());
+    });
+
+    std::size_t const num_runs = expected_values.size();
+    PIKA_TEST(r1.in == v.end());
+    PIKA_TEST(r1.out1 == values.begin() + num_runs);
+    PIKA_TEST(r1.out2 == counts.begin() + num_runs);
+    values.resize(num_runs);
+    counts.resize(num_runs);
+    PIKA_TEST(values == expected_values);
+    PIKA_TEST(counts == expected_counts);
+
+    std::vector<int> d(v.size() + 1, -1);
+    auto r2 = test::run<ExPolicy>([&] {
+        return pika::run_length_decode(
+            policy, values.begin(), values.end(), counts.begin(), d.begin());
+    });
+    PIKA_TEST(r2 == d.begin() + v.size());
+    PIKA_TEST(std::equal(v.begin(), v.end(), d.begin()));
+    PIKA_TEST_EQ(d.back(), -1);
+}
+
+template <typename ExPolicy>
+void test_run_length_encode_pred(ExPolicy&& policy)
+{
+    // elements with the same parity belong to the same run
+    std::vector<int> v = {1, 3, 5, 2, 4, 7, 8, 10, 12, 9};
+    std::vector<int> values(v.size());
+    std::vector<int> counts(v.size());
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::run_length_encode(policy, v.begin(), v.end(),
+            values.begin(), counts.begin(),
+            [](int lhs, int rhs) { return lhs % 2 == rhs % 2; });
+    });
+    PIKA_TEST(r.out1 == values.begin() + 5);
+    values.resize(5);
+    counts.resize(5);
+    PIKA_TEST(values == (std::vector<int>{1, 2, 7, 8, 9}));
+    PIKA_TEST(counts == (std::vector<int>{3, 2, 1, 3, 1}));
+
+    // runs with lengths of zero or less are skipped when decoding
+    std::vector<int> lengths = {2, 0, -1, 3};
+    std::vector<int> d(5);
+    auto r2 = test::run<ExPolicy>([&] {
+        return pika::run_length_decode(policy, values.begin(),
+            values.begin() + 4, lengths.begin(), d.begin());
+    });
+    PIKA_TEST(r2 == d.end());
+    PIKA_TEST(d == (std::vector<int>{1, 1, 8, 8, 8}));
+}
+
+template <typename ExPolicy>
+void test_run_length_encode_exception(ExPolicy&& policy)
+{
+    std::vector<int> v = make_runs(100007, 10);
+    std::vector<int> values(v.size());
+    std::vector<std::size_t> counts(v.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::run_length_encode(policy, v.begin(), v.end(),
+                values.begin(), counts.begin(),
+                [](int, int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_run_length_encode()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 1000, 100007, 1000003})
+    {
+        for (std::size_t run_length : {1, 10, 10000})
+        {
+            std::vector<int> v = make_runs(size, run_length);
+
+            test_run_length_encode(seq, v);
+            test_run_length_encode(par, v);
+            test_run_length_encode(par_unseq, v);
+            test_run_length_encode(par(task), v);
+        }
+    }
+
+    // a single run spanning all chunks
+    std::vector<int> v(1000003, 42);
+    test_run_length_encode(par, v);
+
+    test_run_length_encode_pred(seq);
+    test_run_length_encode_pred(par);
+
+    test_run_length_encode_exception(par);
+    test_run_length_encode_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_run_length_encode();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
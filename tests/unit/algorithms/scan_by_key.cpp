@@ -0,0 +1,259 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/scan_by_key.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// The affine functions x -> a * x + b, combined by composition. This is
+// associative but not commutative, the values have to be combined in the
+// order of the sequence.
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+};
+
+bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{lhs.a * rhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+// The keys are the row indices of a sparse matrix with the given average
+// number of entries per row, some of the rows are empty.
+std::vector<std::size_t> make_keys(std::size_t size, std::size_t row_length)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, 2 * row_length);
+
+    std::vector<std::size_t> keys(size);
+    std::size_t row = 0;
+    std::size_t remaining = dis(gen);
+    for (auto& key : keys)
+    {
+        while (remaining == 0)
+        {
+            ++row;
+            remaining = dis(gen);
+        }
+        key = row;
+        --remaining;
+    }
+    return keys;
+}
+
+std::vector<affine> make_values(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+
+    std::vector<affine> values(size);
+    for (auto& f : values)
+    {
+        f = affine{2 * dis(gen) + 1, dis(gen)};
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Values>
+void test_scan_by_key(ExPolicy&& policy, std::vector<std::size_t> const& keys,
+    Values const& values)
+{
+    std::size_t const size = keys.size();
+    affine const init{3, 5};
+
+    std::vector<affine> expected(size);
+    std::vector<affine> d(size);
+
+    // inclusive_scan_by_key
+    affine sum;
+    auto it = values.begin();
+    for (std::size_t i = 0; i != size; ++i, ++it)
+    {
+        sum = (i == 0 || keys[i] != keys[i - 1]) ? *it : compose()(sum, *it);
+        expected[i] = sum;
+    }
+
+    auto r1 = test::run<ExPolicy>([&] {
+        return pika::inclusive_scan_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), d.begin(), std::equal_to<std::size_t>(), compose());
+    });
+    PIKA_TEST(r1 == d.end());
+    PIKA_TEST(d == expected);
+
+    // exclusive_scan_by_key
+    it = values.begin();
+    for (std::size_t i = 0; i != size; ++i, ++it)
+    {
+        if (i == 0 || keys[i] != keys[i - 1])
+        {
+            sum = init;
+        }
+        expected[i] = sum;
+        sum = compose()(sum, *it);
+    }
+
+    auto r2 = test::run<ExPolicy>([&] {
+        return pika::exclusive_scan_by_key(policy, keys.begin(), keys.end(),
+            values.begin(), d.begin(), init, std::equal_to<std::size_t>(),
+            compose());
+    });
+    PIKA_TEST(r2 == d.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_scan_by_key_default(ExPolicy&& policy)
+{
+    std::vector<int> keys = {0, 0, 0, 1, 2, 2, 3, 3, 3, 3};
+    std::vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<int> d(values.size());
+
+    pika::inclusive_scan_by_key(
+        policy, keys.begin(), keys.end(), values.begin(), d.begin());
+    PIKA_TEST(d == (std::vector<int>{1, 3, 6, 4, 5, 11, 7, 15, 24, 34}));
+
+    pika::exclusive_scan_by_key(
+        policy, keys.begin(), keys.end(), values.begin(), d.begin(), 0);
+    PIKA_TEST(d == (std::vector<int>{0, 1, 3, 0, 0, 5, 0, 7, 15, 24}));
+
+    // in place
+    pika::exclusive_scan_by_key(
+        policy, keys.begin(), keys.end(), values.begin(), values.begin(), 1);
+    PIKA_TEST(values == (std::vector<int>{1, 2, 4, 1, 1, 6, 1, 8, 16, 25}));
+}
+
+template <typename ExPolicy>
+void test_scan_by_key_exception(ExPolicy&& policy)
+{
+    std::vector<std::size_t> keys = make_keys(100007, 10);
+    std::vector<std::uint64_t> values(keys.size(), 1);
+    std::vector<std::uint64_t> d(values.size());
+    // the failing value is combined with the one before it
+    std::size_t const failing = values.size() / 2;
+    keys[failing] = keys[failing - 1];
+    values[failing] = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::inclusive_scan_by_key(policy, keys.begin(), keys.end(),
+                values.begin(), d.begin(), std::equal_to<std::size_t>(),
+                [](std::uint64_t lhs, std::uint64_t rhs) {
+                    if (rhs == 0)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                    return lhs + rhs;
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_scan_by_key()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {1, 2, 3, 1000, 100007, 1000003})
+    {
+        for (std::size_t row_length : {1, 10, 10000})
+        {
+            std::vector<std::size_t> keys = make_keys(size, row_length);
+            std::vector<affine> values = make_values(size);
+
+            test_scan_by_key(seq, keys, values);
+            test_scan_by_key(par, keys, values);
+            test_scan_by_key(par_unseq, keys, values);
+            test_scan_by_key(par(task), keys, values);
+
+            // explicitly given chunk sizes and forward iterators use the
+            // three pass scan
+            test_scan_by_key(
+                par.with(static_chunk_size(1000)), keys, values);
+            std::list<affine> l(values.begin(), values.end());
+            test_scan_by_key(par, keys, l);
+        }
+    }
+
+    test_scan_by_key_default(seq);
+    test_scan_by_key_default(par);
+
+    test_scan_by_key_exception(par);
+    test_scan_by_key_exception(par(task));
+    test_scan_by_key_exception(par.with(static_chunk_size(1000)));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_scan_by_key();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/exclusive_scan.hpp>
+#include <pika/parallel/algorithms/inclusive_scan.hpp>
+#include <pika/parallel/algorithms/transform_exclusive_scan.hpp>
+#include <pika/parallel/algorithms/transform_inclusive_scan.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// The affine functions x -> a * x + b, combined by composition. This is
+// associative but not commutative, the scan has to combine the chunks in
+// the order of the sequence.
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+};
+
+bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{lhs.a * rhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+std::vector<affine> make_input(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+
+    std::vector<affine> c(size);
+    for (auto& f : c)
+    {
+        f = affine{2 * dis(gen) + 1, dis(gen)};
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_scan_look_back(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<affine> c = make_input(size);
+    affine const init{3, 5};
+
+    std::vector<affine> expected(size);
+    std::vector<affine> d(size);
+
+    // inclusive_scan
+    affine sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum = compose()(sum, c[i]);
+        expected[i] = sum;
+    }
+    auto r1 = pika::inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), init);
+    PIKA_TEST(r1 == d.end());
+    PIKA_TEST(d == expected);
+
+    // exclusive_scan
+    sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[i] = sum;
+        sum = compose()(sum, c[i]);
+    }
+    auto r2 = pika::exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose());
+    PIKA_TEST(r2 == d.end());
+    PIKA_TEST(d == expected);
+
+    // transform_inclusive_scan
+    auto conv = [](affine f) { return affine{f.a, f.b + 1}; };
+    sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum = compose()(sum, conv(c[i]));
+        expected[i] = sum;
+    }
+    auto r3 = pika::transform_inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), conv, init);
+    PIKA_TEST(r3 == d.end());
+    PIKA_TEST(d == expected);
+
+    // transform_exclusive_scan
+    sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[i] = sum;
+        sum = compose()(sum, conv(c[i]));
+    }
+    auto r4 = pika::transform_exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose(), conv);
+    PIKA_TEST(r4 == d.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_scan_look_back_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::uint64_t> c(size);
+    std::uniform_int_distribution<std::uint64_t> dis(0, 1000);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+
+    std::vector<std::uint64_t> expected(size);
+    std::vector<std::uint64_t> d(size);
+
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum += c[i];
+        expected[i] = sum;
+    }
+
+    auto f = pika::inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST(f.get() == d.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_scan_look_back_exception(ExPolicy&& policy)
+{
+    std::vector<std::uint64_t> c(1000003, 1);
+    std::vector<std::uint64_t> d(c.size());
+    c[c.size() / 2] = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+                [](std::uint64_t lhs, std::uint64_t rhs) {
+                    if (rhs == 0)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                    return lhs + rhs;
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_scan_look_back()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {1, 2, 1000, 4097, 100007, 1000003})
+    {
+        test_scan_look_back(par, size);
+        test_scan_look_back(par_unseq, size);
+    }
+
+    test_scan_look_back_async(par(task), 1000003);
+
+    test_scan_look_back_exception(par);
+    test_scan_look_back_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_scan_look_back();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
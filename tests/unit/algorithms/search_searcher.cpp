@@ -0,0 +1,170 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/find.hpp>
+#include <pika/parallel/algorithms/search.hpp>
+#include <pika/parallel/util/searchers.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// a small alphabet makes for many partial matches
+template <typename T>
+std::vector<T> make_text(std::size_t size, int alphabet)
+{
+    std::vector<T> text;
+    text.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        char const c = static_cast<char>('a' + gen() % alphabet);
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            text.push_back(std::string(3, c));
+        }
+        else
+        {
+            text.push_back(T(c));
+        }
+    }
+    return text;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_search_searcher(ExPolicy policy, std::vector<T> const& text,
+    std::vector<T> const& pattern)
+{
+    auto const first = text.begin();
+    auto const last = text.end();
+
+    pika::boyer_moore_horspool_searcher searcher(
+        pattern.begin(), pattern.end());
+
+    auto const expected =
+        std::search(first, last, pattern.begin(), pattern.end());
+    auto const result = test::run<ExPolicy>(
+        [&] { return pika::search(policy, first, last, searcher); });
+    PIKA_TEST(result == expected);
+
+    // search_n returns first if the pattern is not found
+    auto const result_n = test::run<ExPolicy>([&] {
+        return pika::search_n(policy, first, text.size(), searcher);
+    });
+    PIKA_TEST(result_n == (expected == last ? first : expected));
+
+    auto const expected_end =
+        std::find_end(first, last, pattern.begin(), pattern.end());
+    auto const result_end = test::run<ExPolicy>(
+        [&] { return pika::find_end(policy, first, last, searcher); });
+    PIKA_TEST(result_end == expected_end);
+
+    // searchers not exposing the length of their pattern are run on the
+    // whole sequence
+    std::default_searcher<typename std::vector<T>::const_iterator>
+        std_searcher(pattern.begin(), pattern.end());
+    auto const result_std = test::run<ExPolicy>(
+        [&] { return pika::search(policy, first, last, std_searcher); });
+    PIKA_TEST(result_std == expected);
+}
+
+template <typename T>
+void test_search_searcher()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        for (int alphabet : {2, 4, 26})
+        {
+            std::vector<T> const text = make_text<T>(size, alphabet);
+
+            for (std::size_t pattern_size : {0, 1, 3, 8, 20})
+            {
+                std::vector<T> pattern = make_text<T>(pattern_size, alphabet);
+
+                // make sure the pattern occurs at least once in most cases
+                if (pattern_size != 0 && pattern_size <= size && gen() % 2)
+                {
+                    std::size_t const pos = gen() % (size - pattern_size + 1);
+                    pattern.assign(text.begin() + pos,
+                        text.begin() + pos + pattern_size);
+                }
+
+                pika::boyer_moore_horspool_searcher searcher(
+                    pattern.begin(), pattern.end());
+                PIKA_TEST_EQ(searcher.pattern_size(), pattern_size);
+                PIKA_TEST(pika::search(text.begin(), text.end(), searcher) ==
+                    std::search(text.begin(), text.end(), pattern.begin(),
+                        pattern.end()));
+
+                test_search_searcher(seq, text, pattern);
+                test_search_searcher(par, text, pattern);
+                test_search_searcher(par_unseq, text, pattern);
+                test_search_searcher(seq(task), text, pattern);
+                test_search_searcher(par(task), text, pattern);
+            }
+        }
+    }
+}
+
+void search_searcher_test()
+{
+    // char patterns use an array as skip table, all others a hash map
+    test_search_searcher<char>();
+    test_search_searcher<int>();
+    test_search_searcher<std::string>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    search_searcher_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/find.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/container_algorithms/for_each.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// A deque holding the values offset, offset + 1, ... whose first element is
+// not at the start of a block.
+template <typename T = int>
+std::deque<T> make_deque(std::size_t size, int offset)
+{
+    std::deque<T> d(size);
+    std::iota(d.begin(), d.end(), T(offset));
+    for (int i = 0; i != 3; ++i)
+    {
+        d.push_front(T(-1));
+    }
+    d.erase(d.begin(), d.begin() + 3);
+    return d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_segmented_iterators(ExPolicy policy, std::size_t size)
+{
+    int const offset = static_cast<int>(gen() % 1000);
+    std::deque<int> d = make_deque(size, offset);
+
+    // for_each, with and without projection
+    auto result_for_each = test::run<ExPolicy>([&] {
+        return pika::for_each(
+            policy, d.begin(), d.end(), [](int& value) { value *= 2; });
+    });
+    PIKA_TEST(result_for_each == d.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], 2 * (offset + static_cast<int>(i)));
+    }
+
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(
+            policy, d.begin(), d.end(), [](int& value) { value /= 2; },
+            [](int& value) -> int& { return value; });
+    });
+    PIKA_TEST(d == make_deque(size, offset));
+
+    // transform from a deque into a deque and into a vector
+    std::deque<double> halves(size + 1, -1.0);
+    auto result_transform = test::run<ExPolicy>([&] {
+        return pika::transform(policy, d.begin(), d.end(), halves.begin(),
+            [](int value) { return value / 2.0; });
+    });
+    PIKA_TEST(result_transform == halves.begin() + size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(halves[i], (offset + static_cast<int>(i)) / 2.0);
+    }
+    PIKA_TEST_EQ(halves[size], -1.0);
+
+    std::vector<int> v(size);
+    test::run<ExPolicy>([&] {
+        return pika::transform(policy, d.cbegin(), d.cend(), v.begin(),
+            [](int value) { return value + 1; });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(v[i], d[i] + 1);
+    }
+
+    // reduce
+    int const sum = test::run<ExPolicy>(
+        [&] { return pika::reduce(policy, d.cbegin(), d.cend(), 7); });
+    PIKA_TEST_EQ(sum, std::accumulate(d.begin(), d.end(), 7));
+
+    // find, every element is found at its position
+    if (size != 0)
+    {
+        std::size_t const pos = gen() % size;
+        auto found = test::run<ExPolicy>([&] {
+            return pika::find(policy, d.begin(), d.end(), d[pos]);
+        });
+        PIKA_TEST(found == d.begin() + pos);
+    }
+    auto not_found = test::run<ExPolicy>(
+        [&] { return pika::find(policy, d.begin(), d.end(), -1); });
+    PIKA_TEST(not_found == d.end());
+
+    // fill, the element following the sequence is not written
+    std::deque<int> filled = make_deque(size + 1, 0);
+    test::run<ExPolicy>([&] {
+        return pika::fill(policy, filled.begin(), filled.end() - 1, 42);
+    });
+    PIKA_TEST_EQ(static_cast<std::size_t>(
+                     std::count(filled.begin(), filled.end(), 42)),
+        size);
+    PIKA_TEST_EQ(filled[size], static_cast<int>(size));
+
+    // copy elements which are not trivially copyable
+    std::deque<std::string> strings(size);
+    std::transform(d.begin(), d.end(), strings.begin(),
+        [](int value) { return std::to_string(value); });
+    std::deque<std::string> copied(size + 1, "x");
+    auto result_copy = test::run<ExPolicy>([&] {
+        return pika::copy(
+            policy, strings.begin(), strings.end(), copied.begin() + 1);
+    });
+    PIKA_TEST(result_copy == copied.end());
+    PIKA_TEST(std::equal(strings.begin(), strings.end(), copied.begin() + 1));
+    PIKA_TEST_EQ(copied[0], std::string("x"));
+}
+
+void segmented_iterators_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 127, 129, 100007})
+    {
+        test_segmented_iterators(seq, size);
+        test_segmented_iterators(par, size);
+        test_segmented_iterators(par_unseq, size);
+        test_segmented_iterators(seq(task), size);
+        test_segmented_iterators(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    segmented_iterators_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/segmented_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// Creates the row offsets of a matrix whose row lengths follow a power law:
+// most rows are short or empty, a few hold a large part of the nonzero
+// elements. The first few elements are not part of any row.
+std::vector<std::size_t> make_offsets(std::size_t num_rows, double exponent)
+{
+    std::uniform_real_distribution<double> dis(0.0, 1.0);
+
+    std::vector<std::size_t> offsets(num_rows + 1);
+    offsets[0] = 3;
+    for (std::size_t i = 0; i != num_rows; ++i)
+    {
+        // the length of the row is 1 / u^exponent - 1 for u uniform in (0, 1]
+        double const u = 1.0 - dis(gen);
+        double const length = std::min(std::pow(u, -exponent) - 1.0, 1e5);
+        offsets[i + 1] = offsets[i] + std::size_t(length);
+    }
+    return offsets;
+}
+
+template <typename ExPolicy>
+void test_spmv(ExPolicy policy, std::vector<std::size_t> const& offsets)
+{
+    std::size_t const num_rows = offsets.size() - 1;
+    std::size_t const num_columns = 1000;
+
+    // small integral values such that the sums are exact
+    std::uniform_int_distribution<int> dis(-10, 10);
+    std::uniform_int_distribution<std::size_t> column_dis(0, num_columns - 1);
+
+    std::vector<std::size_t> columns(offsets.back());
+    std::vector<double> values(offsets.back());
+    std::generate(
+        columns.begin(), columns.end(), [&] { return column_dis(gen); });
+    std::generate(values.begin(), values.end(), [&] { return dis(gen); });
+
+    std::vector<double> x(num_columns);
+    std::generate(x.begin(), x.end(), [&] { return dis(gen); });
+
+    std::vector<double> expected(num_rows, 0.0);
+    for (std::size_t i = 0; i != num_rows; ++i)
+    {
+        for (std::size_t j = offsets[i]; j != offsets[i + 1]; ++j)
+        {
+            expected[i] += values[j] * x[columns[j]];
+        }
+    }
+
+    std::vector<double> y(num_rows, -1.0);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::spmv(policy, offsets.begin(), offsets.end(),
+            columns.begin(), values.begin(), x.begin(), y.begin());
+    });
+    PIKA_TEST(result == y.end());
+    PIKA_TEST(y == expected);
+}
+
+// the elements of every segment are combined in order
+template <typename ExPolicy>
+void test_segmented_reduce_ordered(
+    ExPolicy policy, std::vector<std::size_t> const& offsets)
+{
+    std::size_t const num_segments = offsets.size() - 1;
+
+    std::vector<std::string> c(offsets.back());
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = std::string(1, char('a' + i % 26));
+    }
+
+    std::vector<std::string> expected(num_segments);
+    for (std::size_t i = 0; i != num_segments; ++i)
+    {
+        expected[i] = "<";
+        for (std::size_t j = offsets[i]; j != offsets[i + 1]; ++j)
+        {
+            expected[i] += c[j];
+        }
+    }
+
+    std::vector<std::string> d(num_segments);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::segmented_reduce(policy, c.begin(), offsets.begin(),
+            offsets.end(), d.begin(), std::string("<"), std::plus<>());
+    });
+    PIKA_TEST(result == d.end());
+    PIKA_TEST(d == expected);
+
+    // the lengths of the segments
+    std::vector<std::size_t> lengths(num_segments);
+    test::run<ExPolicy>([&] {
+        return pika::segmented_transform_reduce(policy, c.begin(),
+            offsets.begin(), offsets.end(), lengths.begin(), std::size_t(0),
+            std::plus<>(), [](std::string const&) { return std::size_t(1); });
+    });
+    for (std::size_t i = 0; i != num_segments; ++i)
+    {
+        PIKA_TEST_EQ(lengths[i], offsets[i + 1] - offsets[i]);
+    }
+}
+
+template <typename ExPolicy>
+void test_segmented_reduce(ExPolicy policy)
+{
+    // no segments at all, only empty segments and a single element
+    for (auto const& offsets : {std::vector<std::size_t>{0},
+             std::vector<std::size_t>(100, 5), std::vector<std::size_t>{2, 3}})
+    {
+        test_spmv(policy, offsets);
+        test_segmented_reduce_ordered(policy, offsets);
+    }
+
+    // from almost uniform to very skewed row lengths
+    for (double exponent : {0.5, 1.0, 1.5})
+    {
+        test_spmv(policy, make_offsets(10000, exponent));
+        test_segmented_reduce_ordered(policy, make_offsets(10000, exponent));
+    }
+
+    // a single row holding all nonzero elements between many empty ones
+    std::vector<std::size_t> offsets(1000, 0);
+    offsets.resize(2000, 1000000);
+    test_spmv(policy, offsets);
+}
+
+void test_segmented_reduce()
+{
+    using namespace pika::execution;
+
+    test_segmented_reduce(seq);
+    test_segmented_reduce(par);
+    test_segmented_reduce(par_unseq);
+    test_segmented_reduce(par(task));
+
+    // sequential overloads
+    std::vector<std::size_t> const offsets = make_offsets(1000, 1.0);
+    std::vector<int> c(offsets.back(), 1);
+    std::vector<int> d(offsets.size() - 1);
+    PIKA_TEST(pika::segmented_reduce(c.begin(), offsets.begin(),
+                  offsets.end(), d.begin(), 0) == d.end());
+    for (std::size_t i = 0; i != d.size(); ++i)
+    {
+        PIKA_TEST_EQ(std::size_t(d[i]), offsets[i + 1] - offsets[i]);
+    }
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_segmented_reduce();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
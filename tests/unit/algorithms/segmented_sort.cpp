@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/segmented_sort.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// Creates offsets for segments of random sizes in [0, max_size], the first
+// and the last few elements are not part of any segment
+std::vector<std::size_t> make_offsets(
+    std::size_t num_segments, std::size_t max_size)
+{
+    std::uniform_int_distribution<std::size_t> dis(0, max_size);
+
+    std::vector<std::size_t> offsets(num_segments + 1);
+    offsets[0] = 3;
+    for (std::size_t i = 0; i != num_segments; ++i)
+    {
+        offsets[i + 1] = offsets[i] + dis(gen);
+    }
+    return offsets;
+}
+
+template <typename ExPolicy, typename Compare>
+void test_segmented_sort(ExPolicy&& policy,
+    std::vector<std::size_t> const& offsets, Compare comp)
+{
+    std::uniform_int_distribution<int> dis(0, 1000);
+
+    std::vector<int> c((offsets.empty() ? 0 : offsets.back()) + 3);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    std::vector<int> expected = c;
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+    {
+        std::sort(expected.begin() + offsets[i],
+            expected.begin() + offsets[i + 1], comp);
+    }
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::segmented_sort(
+            policy, c.begin(), c.end(), offsets.begin(), offsets.end(), comp);
+    });
+    PIKA_TEST(result == c.end());
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_segmented_sort(ExPolicy&& policy)
+{
+    // no segments at all, tiny, small and mixed segment sizes
+    test_segmented_sort(policy, std::vector<std::size_t>{}, std::less<>());
+    test_segmented_sort(policy, std::vector<std::size_t>{0}, std::less<>());
+    test_segmented_sort(policy, make_offsets(100000, 16), std::less<>());
+    test_segmented_sort(policy, make_offsets(10000, 300), std::greater<>());
+    test_segmented_sort(policy, make_offsets(10, 100000), std::less<>());
+
+    // a single segment which is sorted by the parallel sort between small
+    // ones
+    std::vector<std::size_t> offsets = make_offsets(1000, 20);
+    offsets.push_back(offsets.back() + 1000000);
+    for (std::size_t size : {7, 0, 300})
+    {
+        offsets.push_back(offsets.back() + size);
+    }
+    test_segmented_sort(policy, offsets, std::less<>());
+}
+
+template <typename ExPolicy>
+void test_segmented_sort_exception(ExPolicy&& policy)
+{
+    std::vector<std::size_t> offsets = make_offsets(10000, 100);
+    std::vector<int> c(offsets.back());
+    std::generate(c.begin(), c.end(), [&]() { return int(gen() % 1000); });
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::segmented_sort(policy, c.begin(), c.end(),
+                offsets.begin(), offsets.end(),
+                [](int, int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_segmented_sort()
+{
+    using namespace pika::execution;
+
+    test_segmented_sort(seq);
+    test_segmented_sort(par);
+    test_segmented_sort(par_unseq);
+    test_segmented_sort(par(task));
+
+    test_segmented_sort_exception(par);
+    test_segmented_sort_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_segmented_sort();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
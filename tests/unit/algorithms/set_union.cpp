@@ -8,6 +8,7 @@
 #include <pika/parallel/algorithms/set_union.hpp>
 #include <pika/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
@@ -222,6 +223,52 @@ void set_union_test2()
     test_set_union2<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The second sequence is much shorter than the first one and both hold long
+// runs of equivalent elements, which must not be split between chunks.
+template <typename ExPolicy>
+void test_set_union3(ExPolicy&& policy, std::size_t size1, std::size_t size2,
+    std::size_t num_values)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c1 = test::random_fill(size1);
+    std::vector<std::size_t> c2 = test::random_fill(size2);
+    for (auto& v : c1)
+        v %= num_values;
+    for (auto& v : c2)
+        v %= num_values;
+
+    std::sort(std::begin(c1), std::end(c1));
+    std::sort(std::begin(c2), std::end(c2));
+
+    std::vector<std::size_t> c3(size1 + size2), c4(size1 + size2);
+
+    auto result = pika::set_union(policy, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c3));
+    auto expected = std::set_union(std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2), std::begin(c4));
+
+    // verify values
+    PIKA_TEST_EQ(std::distance(std::begin(c3), result),
+        std::distance(std::begin(c4), expected));
+    PIKA_TEST(std::equal(std::begin(c3), std::end(c3), std::begin(c4)));
+}
+
+void set_union_test3()
+{
+    using namespace pika::execution;
+
+    for (std::size_t num_values : {1, 10, 1000000})
+    {
+        test_set_union3(par, 1000003, 0, num_values);
+        test_set_union3(par, 1000003, 7, num_values);
+        test_set_union3(par, 7, 1000003, num_values);
+        test_set_union3(par_unseq, 100007, 100007, num_values);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_set_union_exception(IteratorTag)
@@ -534,6 +581,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     set_union_test1();
     set_union_test2();
+    set_union_test3();
     set_union_exception_test();
     set_union_bad_alloc_test();
     return pika::finalize();
@@ -0,0 +1,188 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/rotate.hpp>
+#include <pika/parallel/algorithms/shift_left.hpp>
+#include <pika/parallel/algorithms/shift_right.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// The trivially copyable elements of contiguous sequences are moved by the
+// parallel memmove, the shifts cover the moves in waves (large shifts) and
+// in segments (small shifts).
+std::size_t const size = std::size_t(1) << 20;
+
+template <typename T>
+std::vector<T> make_sequence()
+{
+    std::vector<T> c(size);
+    std::iota(c.begin(), c.end(), static_cast<T>(gen() % 1000));
+    return c;
+}
+
+std::vector<std::size_t> shifts()
+{
+    std::uniform_int_distribution<std::size_t> dis(1, size - 1);
+    return {1, 3, 1000, size / 16 + 1, size / 4, size / 2 + 7, size - 1,
+        dis(gen)};
+}
+
+template <typename T, typename ExPolicy>
+void test_shift_left(ExPolicy policy)
+{
+    for (std::size_t n : shifts())
+    {
+        std::vector<T> c = make_sequence<T>();
+        std::vector<T> d = c;
+
+        auto result = test::run<ExPolicy>(
+            [&] { return pika::shift_left(policy, c.begin(), c.end(), n); });
+
+        PIKA_TEST(result == c.begin() + (size - n));
+        PIKA_TEST(std::equal(d.begin() + n, d.end(), c.begin()));
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_shift_right(ExPolicy policy)
+{
+    for (std::size_t n : shifts())
+    {
+        std::vector<T> c = make_sequence<T>();
+        std::vector<T> d = c;
+
+        auto result = test::run<ExPolicy>(
+            [&] { return pika::shift_right(policy, c.begin(), c.end(), n); });
+
+        PIKA_TEST(result == c.begin() + n);
+        PIKA_TEST(std::equal(d.begin(), d.end() - n, c.begin() + n));
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_rotate(ExPolicy policy)
+{
+    std::vector<std::size_t> points = shifts();
+    points.push_back(0);
+    points.push_back(size);
+
+    for (std::size_t n : points)
+    {
+        std::vector<T> c = make_sequence<T>();
+        std::vector<T> d = c;
+
+        test::run<ExPolicy>([&] {
+            return pika::rotate(policy, c.begin(), c.begin() + n, c.end());
+        });
+        std::rotate(d.begin(), d.begin() + n, d.end());
+
+        PIKA_TEST(c == d);
+    }
+}
+
+// Elements which are moved without throwing are rotated through a buffer
+// holding the shorter part and the longer part is moved by the parallel
+// element-wise move.
+template <typename ExPolicy>
+void test_rotate_strings(ExPolicy policy)
+{
+    std::vector<std::size_t> points = shifts();
+    points.push_back(0);
+    points.push_back(size);
+
+    std::vector<int> const values = make_sequence<int>();
+    for (std::size_t n : points)
+    {
+        std::vector<std::string> c(size);
+        std::transform(values.begin(), values.end(), c.begin(),
+            [](int i) { return std::to_string(i); });
+        std::vector<std::string> d = c;
+
+        auto result = test::run<ExPolicy>([&] {
+            return pika::rotate(policy, c.begin(), c.begin() + n, c.end());
+        });
+        std::rotate(d.begin(), d.begin() + n, d.end());
+
+        PIKA_TEST(result == c.begin() + (size - n));
+        PIKA_TEST(c == d);
+    }
+}
+
+template <typename T>
+void test_shift_rotate_memmove()
+{
+    using namespace pika::execution;
+
+    test_shift_left<T>(par);
+    test_shift_left<T>(par(task));
+    test_shift_right<T>(par);
+    test_shift_right<T>(par(task));
+    test_rotate<T>(par);
+    test_rotate<T>(par(task));
+}
+
+void shift_rotate_memmove_test()
+{
+    test_shift_rotate_memmove<char>();
+    test_shift_rotate_memmove<int>();
+    test_shift_rotate_memmove<double>();
+
+    using namespace pika::execution;
+    test_rotate_strings(par);
+    test_rotate_strings(par(task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    shift_rotate_memmove_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/shuffle.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_shuffle(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> expected(size);
+    std::iota(expected.begin(), expected.end(), std::size_t(0));
+    pika::shuffle(expected.begin(), expected.end(), seed);
+
+    // the permutation does not depend on the execution policy
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+    auto result = test::run<ExPolicy>(
+        [&] { return pika::shuffle(policy, c.begin(), c.end(), seed); });
+    PIKA_TEST(result == c.end());
+    PIKA_TEST(c == expected);
+
+    std::sort(c.begin(), c.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(c[i], i);
+    }
+
+    // elements are moved, not copied
+    std::vector<std::string> s(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        s[i] = std::to_string(i);
+    }
+    test::run<ExPolicy>(
+        [&] { return pika::shuffle(policy, s.begin(), s.end(), seed); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(s[i], std::to_string(expected[i]));
+    }
+}
+
+// all permutations of a small range appear about equally often
+void test_shuffle_uniform()
+{
+    std::map<std::vector<int>, std::size_t> counts;
+    std::size_t const rounds = 24000;
+    for (std::size_t i = 0; i != rounds; ++i)
+    {
+        std::vector<int> c = {0, 1, 2, 3};
+        pika::shuffle(pika::execution::par, c.begin(), c.end(), seed + i);
+        ++counts[c];
+    }
+
+    PIKA_TEST_EQ(counts.size(), std::size_t(24));
+    for (auto const& count : counts)
+    {
+        PIKA_TEST(count.second > 800 && count.second < 1200);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sample(ExPolicy policy, std::size_t size, std::size_t count)
+{
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    std::vector<std::size_t> expected;
+    pika::sample(c.begin(), c.end(), std::back_inserter(expected), count,
+        seed);
+    PIKA_TEST_EQ(expected.size(), (std::min)(size, count));
+
+    // the selected elements keep their order
+    PIKA_TEST(std::is_sorted(expected.begin(), expected.end()));
+    PIKA_TEST(std::adjacent_find(expected.begin(), expected.end()) ==
+        expected.end());
+
+    std::vector<std::size_t> d(count);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::sample(policy, c.begin(), c.end(), d.begin(), count,
+            seed);
+    });
+    PIKA_TEST(result == d.begin() + expected.size());
+    d.resize(expected.size());
+    PIKA_TEST(d == expected);
+}
+
+void shuffle_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 1000, 32768, 32769, 100007, 1000003})
+    {
+        test_shuffle(seq, size);
+        test_shuffle(par, size);
+        test_shuffle(par_unseq, size);
+        test_shuffle(seq(task), size);
+        test_shuffle(par(task), size);
+    }
+
+    test_shuffle_uniform();
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        for (std::size_t count : {0, 1, 10, 5000, 200000})
+        {
+            test_sample(seq, size, count);
+            test_sample(par, size, count);
+            test_sample(seq(task), size, count);
+            test_sample(par(task), size, count);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    shuffle_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,247 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sketch.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the rank of the quantiles is within the error guarantee of the sketch
+template <typename ExPolicy, typename Container>
+void test_quantile_sketch(ExPolicy&& policy, Container const& c)
+{
+    std::vector<double> sorted(c.begin(), c.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    auto sketch = test::run<ExPolicy>(
+        [&] { return pika::make_quantile_sketch(policy, c.begin(), c.end()); });
+    PIKA_TEST_EQ(sketch.count(), std::uint64_t(c.size()));
+    if (c.empty())
+    {
+        PIKA_TEST(sketch.empty());
+        PIKA_TEST_EQ(sketch.rank(0.0), 0.0);
+        return;
+    }
+
+    PIKA_TEST_EQ(sketch.quantile(0.0), sorted.front());
+    PIKA_TEST_EQ(sketch.quantile(1.0), sorted.back());
+
+    double const n = double(sorted.size());
+    for (double q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99})
+    {
+        double const value = sketch.quantile(q);
+        double const rank =
+            double(std::lower_bound(sorted.begin(), sorted.end(), value) -
+                sorted.begin()) /
+            n;
+        PIKA_TEST_LTE(std::abs(rank - q), 0.03 + 1.0 / n);
+
+        double const expected =
+            double(std::lower_bound(sorted.begin(), sorted.end(),
+                       sorted[std::size_t(q * n)]) -
+                sorted.begin()) /
+            n;
+        PIKA_TEST_LTE(
+            std::abs(sketch.rank(sorted[std::size_t(q * n)]) - expected),
+            0.03);
+    }
+
+    // the memory of the sketch is independent of the number of elements
+    PIKA_TEST_LTE(sketch.retained(), std::size_t(4000));
+}
+
+void test_quantile_sketch_merge()
+{
+    std::uniform_real_distribution<double> dis(0.0, 1.0);
+
+    pika::quantile_sketch<double> all;
+    pika::quantile_sketch<double> even;
+    pika::quantile_sketch<double> odd;
+    for (std::size_t i = 0; i != 100000; ++i)
+    {
+        double const v = dis(gen);
+        all.update(v);
+        (i % 2 == 0 ? even : odd).update(v);
+    }
+    even.merge(odd);
+    PIKA_TEST_EQ(even.count(), all.count());
+    PIKA_TEST_LTE(std::abs(even.quantile(0.5) - 0.5), 0.03);
+    PIKA_TEST_LTE(std::abs(all.quantile(0.5) - 0.5), 0.03);
+
+    // the ordering is used for all queries
+    std::vector<int> c(100007);
+    std::iota(c.begin(), c.end(), 0);
+    auto desc = pika::make_quantile_sketch(
+        pika::execution::par, c.begin(), c.end(), 400, std::greater<>());
+    PIKA_TEST_EQ(desc.k(), std::size_t(400));
+    PIKA_TEST_EQ(desc.quantile(0.0), 100006);
+    PIKA_TEST_EQ(desc.quantile(1.0), 0);
+    PIKA_TEST_LTE(std::abs(desc.quantile(0.9) - 10000), 2000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Container>
+void test_distinct_count_sketch(
+    ExPolicy&& policy, Container const& c, std::size_t distinct)
+{
+    auto sketch = test::run<ExPolicy>([&] {
+        return pika::make_distinct_count_sketch(policy, c.begin(), c.end());
+    });
+    PIKA_TEST_EQ(sketch.precision(), 14u);
+
+    double const error = std::abs(sketch.estimate() - double(distinct));
+    PIKA_TEST_LTE(error, 0.05 * double(distinct) + 1.0);
+}
+
+void test_distinct_count_sketch_merge()
+{
+    // overlapping halves count the union
+    std::vector<std::string> c(60000);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = "user-" + std::to_string(i % 40000);
+    }
+
+    auto first = pika::make_distinct_count_sketch(
+        pika::execution::par, c.begin(), c.begin() + 30000, 12);
+    auto second = pika::make_distinct_count_sketch(
+        pika::execution::par, c.begin() + 30000, c.end(), 12);
+    first.merge(second);
+    PIKA_TEST_EQ(first.precision(), 12u);
+    PIKA_TEST_LTE(std::abs(first.estimate() - 40000.0), 0.1 * 40000.0);
+
+    // small counts are nearly exact
+    pika::distinct_count_sketch<int> small;
+    for (int i = 0; i != 100; ++i)
+    {
+        small.update(i % 10);
+    }
+    PIKA_TEST_LTE(std::abs(small.estimate() - 10.0), 1.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sketch_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(100007, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        auto r = pika::make_distinct_count_sketch(policy, c.begin(), c.end(),
+            14, [](int) -> std::size_t { throw std::runtime_error("test"); });
+        test::run<ExPolicy>([&] { return PIKA_MOVE(r); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_sketches()
+{
+    using namespace pika::execution;
+
+    std::uniform_real_distribution<double> dis(0.0, 1000.0);
+    for (std::size_t size : {0, 1, 1000, 1000007})
+    {
+        std::vector<double> c(size);
+        for (auto& v : c)
+        {
+            v = dis(gen);
+        }
+
+        test_quantile_sketch(seq, c);
+        test_quantile_sketch(par, c);
+        test_quantile_sketch(par_unseq, c);
+        test_quantile_sketch(par(task), c);
+
+        std::list<double> l(c.begin(), c.end());
+        test_quantile_sketch(par, l);
+    }
+    test_quantile_sketch_merge();
+
+    for (std::size_t distinct : {1, 1000, 100000})
+    {
+        std::vector<std::uint64_t> c(300007);
+        for (std::size_t i = 0; i != c.size(); ++i)
+        {
+            c[i] = i % distinct;
+        }
+        std::shuffle(c.begin(), c.end(), gen);
+
+        test_distinct_count_sketch(seq, c, distinct);
+        test_distinct_count_sketch(par, c, distinct);
+        test_distinct_count_sketch(par(task), c, distinct);
+    }
+    test_distinct_count_sketch_merge();
+
+    test_sketch_exception(par);
+    test_sketch_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sketches();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
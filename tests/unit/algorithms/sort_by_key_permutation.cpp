@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort_by_key.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// a value which is expensive to swap along with the keys
+struct payload
+{
+    std::array<double, 16> data;
+    std::string name;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key>
+std::vector<Key> make_keys(std::size_t size, int max_key)
+{
+    std::uniform_int_distribution<int> dis(-max_key, max_key);
+
+    std::vector<Key> keys(size);
+    std::generate(keys.begin(), keys.end(), [&]() { return Key(dis(gen)); });
+    return keys;
+}
+
+template <typename Key>
+std::vector<payload> make_values(std::vector<Key> const& keys)
+{
+    std::vector<payload> values(keys.size());
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        values[i].data.fill(double(keys[i]));
+        values[i].name = std::to_string(double(keys[i]));
+    }
+    return values;
+}
+
+template <typename Key>
+void verify(std::vector<Key> const& keys, std::vector<payload> const& values)
+{
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        PIKA_TEST_EQ(values[i].data[0], double(keys[i]));
+        PIKA_TEST_EQ(values[i].data[15], double(keys[i]));
+        PIKA_TEST_EQ(values[i].name, std::to_string(double(keys[i])));
+    }
+}
+
+template <typename Key, typename ExPolicy, typename Compare>
+void test_sort_by_key_permutation(
+    ExPolicy&& policy, std::size_t size, int max_key, Compare comp)
+{
+    std::vector<Key> keys = make_keys<Key>(size, max_key);
+    std::vector<payload> values = make_values(keys);
+
+    auto result = pika::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin(), comp);
+
+    PIKA_TEST(result.first == keys.end());
+    PIKA_TEST(result.second == values.end());
+    PIKA_TEST(std::is_sorted(keys.begin(), keys.end(), comp));
+    verify(keys, values);
+}
+
+template <typename Key, typename ExPolicy>
+void test_sort_by_key_permutation_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<Key> keys = make_keys<Key>(size, 1000);
+    std::vector<payload> values = make_values(keys);
+
+    auto f =
+        pika::sort_by_key(policy, keys.begin(), keys.end(), values.begin());
+    auto result = f.get();
+
+    PIKA_TEST(result.first == keys.end());
+    PIKA_TEST(result.second == values.end());
+    PIKA_TEST(std::is_sorted(keys.begin(), keys.end()));
+    verify(keys, values);
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_permutation(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        // arithmetic keys are sorted by the radix sort engine
+        test_sort_by_key_permutation<int>(policy, size, 1000, std::less<>());
+        test_sort_by_key_permutation<double>(
+            policy, size, 1000000, std::greater<>());
+
+        // a comparator which is not one of the standard ones
+        test_sort_by_key_permutation<int>(
+            policy, size, 10, [](int lhs, int rhs) { return lhs < rhs; });
+    }
+}
+
+void test_sort_by_key_permutation()
+{
+    using namespace pika::execution;
+
+    test_sort_by_key_permutation(seq);
+    test_sort_by_key_permutation(par);
+    test_sort_by_key_permutation(par_unseq);
+
+    test_sort_by_key_permutation_async<int>(seq(task), 100007);
+    test_sort_by_key_permutation_async<double>(par(task), 100007);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_by_key_permutation();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/util/cache_projected_keys.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the key of an element has to be parsed from its text
+struct element
+{
+    std::string text;
+    std::size_t index;
+};
+
+std::atomic<std::size_t> projections(0);
+
+struct parse_key
+{
+    long operator()(element const& e) const
+    {
+        ++projections;
+        return std::stol(e.text);
+    }
+};
+
+std::vector<element> make_elements(std::size_t size)
+{
+    // few distinct keys, to check the stability of stable_sort
+    std::uniform_int_distribution<long> dis(-500, 500);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i].text = std::to_string(dis(gen));
+        c[i].index = i;
+    }
+    return c;
+}
+
+template <typename Result>
+void wait_for(Result&& result)
+{
+    if constexpr (!std::is_same_v<std::decay_t<Result>,
+                      std::vector<element>::iterator>)
+    {
+        result.get();
+    }
+}
+
+template <typename ExPolicy, typename Comp>
+void test_sort_cached_keys(ExPolicy&& policy, std::size_t size, Comp comp)
+{
+    std::vector<element> c = make_elements(size);
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [&](element const& lhs, element const& rhs) {
+            return comp(std::stol(lhs.text), std::stol(rhs.text));
+        });
+
+    projections = 0;
+    wait_for(pika::sort(policy, c.begin(), c.end(), comp, parse_key()));
+    PIKA_TEST_EQ(projections.load(), size < 2 ? 0 : size);
+    PIKA_TEST(std::equal(c.begin(), c.end(), expected.begin(),
+        expected.end(), [](element const& lhs, element const& rhs) {
+            return lhs.text == rhs.text;
+        }));
+
+    c = make_elements(size);
+    expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [&](element const& lhs, element const& rhs) {
+            return comp(std::stol(lhs.text), std::stol(rhs.text));
+        });
+
+    projections = 0;
+    wait_for(pika::stable_sort(policy, c.begin(), c.end(), comp, parse_key()));
+    PIKA_TEST_EQ(projections.load(), size < 2 ? 0 : size);
+    PIKA_TEST(std::equal(c.begin(), c.end(), expected.begin(),
+        expected.end(), [](element const& lhs, element const& rhs) {
+            return lhs.index == rhs.index;
+        }));
+}
+
+template <typename ExPolicy>
+void test_sort_cached_keys(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        // the radix sort engine sorts the keys compared by std::less
+        test_sort_cached_keys(policy, size, std::less<>());
+        test_sort_cached_keys(policy, size, [](long lhs, long rhs) {
+            return lhs % 100 < rhs % 100 ||
+                (lhs % 100 == rhs % 100 && lhs > rhs);
+        });
+    }
+}
+
+void test_sort_cached_keys()
+{
+    using namespace pika::execution;
+
+    cache_projected_keys const cache;
+
+    test_sort_cached_keys(seq.with(cache));
+    test_sort_cached_keys(par.with(cache));
+    test_sort_cached_keys(par_unseq.with(cache));
+    test_sort_cached_keys(seq(task).with(cache));
+    test_sort_cached_keys(par(task).with(cache));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_cached_keys();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/make_heap.hpp>
+#include <pika/parallel/algorithms/sort_heap.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::vector<int> make_values(std::size_t size)
+{
+    std::vector<int> values(size);
+    for (int& value : values)
+    {
+        value = static_cast<int>(gen() % 10007);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Comp>
+void test_sort_heap(ExPolicy policy, std::vector<int> values, Comp comp)
+{
+    if (!std::is_heap(values.begin(), values.end(), comp))
+    {
+        std::make_heap(values.begin(), values.end(), comp);
+    }
+
+    std::vector<int> expected = values;
+    std::sort_heap(expected.begin(), expected.end(), comp);
+
+    test::run<ExPolicy>([&] {
+        return pika::sort_heap(policy, values.begin(), values.end(), comp);
+    });
+    PIKA_TEST(values == expected);
+}
+
+void sort_heap_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 7, 1000, 100007})
+    {
+        std::vector<int> const values = make_values(size);
+
+        std::vector<int> sorted = values;
+        std::make_heap(sorted.begin(), sorted.end());
+        pika::sort_heap(sorted.begin(), sorted.end());
+        PIKA_TEST(std::is_sorted(sorted.begin(), sorted.end()));
+
+        test_sort_heap(seq, values, std::less<int>());
+        test_sort_heap(par, values, std::less<int>());
+        test_sort_heap(par_unseq, values, std::less<int>());
+        test_sort_heap(seq(task), values, std::less<int>());
+        test_sort_heap(par(task), values, std::less<int>());
+        test_sort_heap(par, values, std::greater<int>());
+
+        // a range sorted in descending order is a heap which is reversed
+        std::vector<int> descending = values;
+        std::sort(descending.begin(), descending.end(), std::greater<int>());
+        test_sort_heap(seq, descending, std::less<int>());
+        test_sort_heap(par, descending, std::less<int>());
+        test_sort_heap(par(task), descending, std::less<int>());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Comp>
+void test_push_heap_n(ExPolicy policy, std::size_t size, std::size_t count,
+    Comp comp)
+{
+    std::vector<int> values = make_values(size + count);
+    std::make_heap(values.begin(), values.begin() + size, comp);
+
+    std::vector<int> expected = values;
+
+    test::run<ExPolicy>([&] {
+        return pika::push_heap_n(
+            policy, values.begin(), values.end(), count, comp);
+    });
+    PIKA_TEST(std::is_heap(values.begin(), values.end(), comp));
+
+    // the elements of the range are only permuted
+    std::sort(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(values == expected);
+}
+
+void push_heap_n_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 5, 1000, 1 << 18})
+    {
+        for (std::size_t count : {0, 1, 3, 100, 100000})
+        {
+            std::vector<int> values = make_values(size + count);
+            std::make_heap(values.begin(), values.begin() + size);
+            pika::push_heap_n(values.begin(), values.end(), count);
+            PIKA_TEST(std::is_heap(values.begin(), values.end()));
+
+            test_push_heap_n(seq, size, count, std::less<int>());
+            test_push_heap_n(par, size, count, std::less<int>());
+            test_push_heap_n(par_unseq, size, count, std::less<int>());
+            test_push_heap_n(seq(task), size, count, std::less<int>());
+            test_push_heap_n(par(task), size, count, std::less<int>());
+            test_push_heap_n(par, size, count, std::greater<int>());
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    sort_heap_test();
+    push_heap_n_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/util/indirect_sort_selection.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// large enough to be sorted indirectly by default
+struct element
+{
+    int key;
+    std::size_t index;
+    std::uint64_t payload[30];
+};
+
+std::vector<element> make_elements(std::size_t size)
+{
+    // few distinct keys, to check the stability of stable_sort
+    std::uniform_int_distribution<int> dis(0, 99);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i].key = dis(gen);
+        c[i].index = i;
+        std::fill(std::begin(c[i].payload), std::end(c[i].payload),
+            std::uint64_t(i));
+    }
+    return c;
+}
+
+// every element is still present, in its original state
+void check_permutation(std::vector<element> const& c)
+{
+    std::vector<bool> seen(c.size(), false);
+    for (element const& e : c)
+    {
+        PIKA_TEST(e.index < c.size() && !seen[e.index]);
+        seen[e.index] = true;
+        PIKA_TEST(std::all_of(std::begin(e.payload), std::end(e.payload),
+            [&](std::uint64_t v) { return v == e.index; }));
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_indirect(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_elements(size);
+    auto const comp = [](element const& lhs, element const& rhs) {
+        return lhs.key < rhs.key;
+    };
+
+    auto result = test::run<ExPolicy>(
+        [&] { return pika::sort(policy, c.begin(), c.end(), comp); });
+    PIKA_TEST(result == c.end());
+
+    PIKA_TEST(std::is_sorted(c.begin(), c.end(), comp));
+    check_permutation(c);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_indirect(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_elements(size);
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::stable_sort(policy, c.begin(), c.end(), std::less<>(),
+            [](element const& e) { return e.key; });
+    });
+    PIKA_TEST(result == c.end());
+
+    PIKA_TEST(std::is_sorted(
+        c.begin(), c.end(), [](element const& lhs, element const& rhs) {
+            return lhs.key < rhs.key ||
+                (lhs.key == rhs.key && lhs.index < rhs.index);
+        }));
+    check_permutation(c);
+}
+
+template <typename ExPolicy>
+void test_sort_indirect(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        test_sort_indirect(policy, size);
+        test_stable_sort_indirect(policy, size);
+    }
+}
+
+void test_sort_indirect()
+{
+    using namespace pika::execution;
+
+    indirect_sort_selection const automatic(indirect_sort_mode::automatic);
+    indirect_sort_selection const always(indirect_sort_mode::always);
+    indirect_sort_selection const never(indirect_sort_mode::never);
+
+    test_sort_indirect(seq);
+    test_sort_indirect(seq.with(always));
+    test_sort_indirect(par);
+    test_sort_indirect(par.with(always));
+    test_sort_indirect(par.with(never));
+    test_sort_indirect(par_unseq.with(automatic));
+
+    test_sort_indirect(seq(task).with(always));
+    test_sort_indirect(par(task));
+    test_sort_indirect(par(task).with(always));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_indirect();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/sort_by_key.hpp>
+#include <pika/parallel/util/sort_key_range.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+enum class category : std::uint8_t
+{
+    none,
+    small,
+    medium,
+    large
+};
+
+struct element
+{
+    int key;
+    std::size_t index;
+};
+
+bool operator==(element const& lhs, element const& rhs)
+{
+    return lhs.key == rhs.key && lhs.index == rhs.index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Comp>
+void test_sort_key_range(ExPolicy&& policy, std::size_t size, int min_key,
+    int max_key, pika::execution::sort_key_range range, Comp comp)
+{
+    std::uniform_int_distribution<int> dis(min_key, max_key);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{dis(gen), i};
+    }
+
+    // equal keys keep their order, which the counting sort guarantees
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [&](element const& lhs, element const& rhs) {
+            return comp(lhs.key, rhs.key);
+        });
+
+    pika::sort(policy.with(range), c.begin(), c.end(), comp, &element::key);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(c[i].key, expected[i].key);
+    }
+    // the counting sort is used if the range holds all keys and at most as
+    // many keys as there are elements
+    std::size_t const num_keys =
+        std::size_t(range.get_max_key() - range.get_min_key()) + 1;
+    if (range.get_min_key() <= min_key && max_key <= range.get_max_key() &&
+        num_keys <= size)
+    {
+        PIKA_TEST(c == expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_key_range(ExPolicy&& policy)
+{
+    using pika::execution::sort_key_range;
+
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        test_sort_key_range(
+            policy, size, -10, 100, sort_key_range(-10, 100), std::less<>());
+        test_sort_key_range(policy, size, 0, 65535, sort_key_range(0, 65535),
+            std::greater<>());
+
+        // some keys lie outside of the range, or there are too many keys
+        test_sort_key_range(
+            policy, size, 0, 100, sort_key_range(0, 50), std::less<>());
+        test_sort_key_range(
+            policy, size, 0, 100, sort_key_range(0, 1000000), std::less<>());
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_key_range_enum(ExPolicy&& policy)
+{
+    std::vector<category> c(100007);
+    std::generate(
+        c.begin(), c.end(), [&]() { return category(gen() % 4); });
+
+    std::vector<category> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    pika::sort(policy.with(pika::execution::sort_key_range(0, 3)), c.begin(),
+        c.end());
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_key_range(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<std::uint16_t> keys(size);
+    std::generate(
+        keys.begin(), keys.end(), [&]() { return std::uint16_t(gen() % 300); });
+    std::vector<std::size_t> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = std::size_t(keys[i]) * size + i;
+    }
+
+    pika::sort_by_key(policy.with(pika::execution::sort_key_range(0, 299)),
+        keys.begin(), keys.end(), values.begin());
+
+    PIKA_TEST(std::is_sorted(keys.begin(), keys.end()));
+    PIKA_TEST(std::is_sorted(values.begin(), values.end()));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(values[i] / size, std::size_t(keys[i]));
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_key_range_async(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    std::generate(c.begin(), c.end(), [&]() { return int(gen() % 1000); });
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = pika::sort(
+        policy.with(pika::execution::sort_key_range(0, 999)), c.begin(),
+        c.end());
+    f.wait();
+    PIKA_TEST(c == expected);
+}
+
+void test_sort_key_range()
+{
+    using namespace pika::execution;
+
+    test_sort_key_range(seq);
+    test_sort_key_range(par);
+    test_sort_key_range(par_unseq);
+
+    test_sort_key_range_enum(seq);
+    test_sort_key_range_enum(par);
+
+    test_sort_by_key_key_range(seq);
+    test_sort_by_key_key_range(par);
+
+    test_sort_key_range_async(seq(task));
+    test_sort_key_range_async(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_key_range();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the comparator is not known to the radix sort engine, which makes sure the
+// comparison based sort is exercised
+struct compare_less
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+struct compare_greater
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_pattern(std::string const& pattern, std::size_t size)
+{
+    std::vector<int> c(size);
+    int const n = static_cast<int>(size);
+
+    if (pattern == "sorted")
+    {
+        std::iota(c.begin(), c.end(), 0);
+    }
+    else if (pattern == "reversed")
+    {
+        std::iota(c.rbegin(), c.rend(), 0);
+    }
+    else if (pattern == "equal")
+    {
+        std::fill(c.begin(), c.end(), 42);
+    }
+    else if (pattern == "organ_pipe")
+    {
+        for (int i = 0; i != n; ++i)
+        {
+            c[i] = i < n / 2 ? i : n - i;
+        }
+    }
+    else if (pattern == "sawtooth")
+    {
+        for (int i = 0; i != n; ++i)
+        {
+            c[i] = i % 1024;
+        }
+    }
+    else if (pattern == "few_unique")
+    {
+        std::uniform_int_distribution<int> dis(0, 3);
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    else if (pattern == "sorted_but_last")
+    {
+        // not sorted, but every section which does not include the end is
+        std::iota(c.begin(), c.end(), 0);
+        c.back() = -1;
+    }
+    else if (pattern == "sorted_with_noise")
+    {
+        std::iota(c.begin(), c.end(), 0);
+        std::uniform_int_distribution<std::size_t> dis(0, size - 1);
+        for (std::size_t i = 0; i != size / 100; ++i)
+        {
+            std::swap(c[dis(gen)], c[dis(gen)]);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<int> dis;
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    return c;
+}
+
+template <typename ExPolicy>
+void test_sort_patterns(ExPolicy&& policy)
+{
+    for (std::string const pattern : {"sorted", "reversed", "equal",
+             "organ_pipe", "sawtooth", "few_unique", "sorted_with_noise",
+             "random"})
+    {
+        for (std::size_t size : {2, 23, 24, 1000, 100007, 500000})
+        {
+            std::vector<int> c = make_pattern(pattern, size);
+            std::vector<int> expected = c;
+            std::sort(expected.begin(), expected.end());
+
+            pika::sort(policy, c.begin(), c.end(), compare_less());
+            PIKA_TEST_MSG(c == expected, pattern);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_patterns_async(ExPolicy&& policy)
+{
+    // the top level sections of sequences of this size are partitioned in
+    // parallel
+    for (std::string const pattern : {"organ_pipe", "few_unique", "random"})
+    {
+        std::vector<int> c = make_pattern(pattern, 4000000);
+        std::vector<int> expected = c;
+        std::sort(expected.begin(), expected.end());
+
+        auto f = pika::sort(policy, c.begin(), c.end(), compare_less());
+        f.wait();
+        PIKA_TEST_MSG(c == expected, pattern);
+    }
+}
+
+// The input is checked for being sorted once, before the sequence is split
+// into sections of at least sort_limit_per_task() elements
+template <typename ExPolicy>
+void test_sort_presorted(ExPolicy&& policy)
+{
+    std::size_t const limit = pika::parallel::detail::sort_limit_per_task();
+    for (std::string const pattern :
+        {"sorted", "reversed", "sorted_but_last", "sorted_with_noise"})
+    {
+        for (std::size_t size : {limit + 1, 4 * limit + 7, 16 * limit})
+        {
+            std::vector<int> c = make_pattern(pattern, size);
+            std::vector<int> expected = c;
+            std::sort(expected.begin(), expected.end());
+
+            auto r = test::run<ExPolicy>([&] {
+                return pika::sort(policy, c.begin(), c.end(), compare_less());
+            });
+            PIKA_TEST(r == c.end());
+            PIKA_TEST_MSG(c == expected, pattern);
+
+            // sorting in the opposite order reverses the sequence
+            std::reverse(expected.begin(), expected.end());
+            test::run<ExPolicy>([&] {
+                return pika::sort(
+                    policy, c.begin(), c.end(), compare_greater());
+            });
+            PIKA_TEST_MSG(c == expected, pattern);
+        }
+    }
+}
+
+void test_sort_patterns()
+{
+    using namespace pika::execution;
+
+    test_sort_patterns(seq);
+    test_sort_patterns(par);
+    test_sort_patterns(par_unseq);
+
+    test_sort_patterns_async(seq(task));
+    test_sort_patterns_async(par(task));
+
+    test_sort_presorted(par);
+    test_sort_presorted(par_unseq);
+    test_sort_presorted(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_patterns();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
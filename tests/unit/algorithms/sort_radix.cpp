@@ -0,0 +1,262 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/sort_by_key.hpp>
+#include <pika/parallel/util/radix_sort_selection.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_keys(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<long long> dis(
+            (long long) (std::numeric_limits<T>::min)(),
+            (long long) (std::numeric_limits<T>::max)() / 2);
+        std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+    }
+
+    if (size > 2)
+    {
+        c[0] = (std::numeric_limits<T>::max)();
+        c[1] = std::numeric_limits<T>::lowest();
+        c[2] = T(0);
+    }
+    return c;
+}
+
+template <typename T, typename ExPolicy, typename Comp>
+void test_sort_radix(ExPolicy&& policy, std::size_t size, Comp comp)
+{
+    std::vector<T> c = make_keys<T>(size);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    pika::sort(policy, c.begin(), c.end(), comp);
+    PIKA_TEST(c == expected);
+}
+
+template <typename T, typename ExPolicy>
+void test_sort_radix(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        test_sort_radix<T>(policy, size, std::less<>());
+        test_sort_radix<T>(policy, size, std::greater<T>());
+        test_sort_radix<T>(policy, size, pika::parallel::detail::less());
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_radix(ExPolicy&& policy)
+{
+    test_sort_radix<std::uint8_t>(policy);
+    test_sort_radix<std::int16_t>(policy);
+    test_sort_radix<std::int32_t>(policy);
+    test_sort_radix<std::uint32_t>(policy);
+    test_sort_radix<std::int64_t>(policy);
+    test_sort_radix<std::uint64_t>(policy);
+    test_sort_radix<float>(policy);
+    test_sort_radix<double>(policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the radix sort engine places -0.0 before +0.0, the comparison based sort
+// keeps them in an unspecified order
+template <typename T, typename ExPolicy, typename Comp>
+void test_sort_radix_signed_zeros(
+    ExPolicy&& policy, Comp comp, bool ordered_by_sign)
+{
+    std::size_t const size = 100007;
+
+    std::uniform_int_distribution<int> dis(0, 3);
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() {
+        T const values[] = {T(-0.0), T(0.0), T(-1.0), T(1.0)};
+        return values[dis(gen)];
+    });
+    auto const negative_zeros = std::count_if(c.begin(), c.end(),
+        [](T v) { return v == T(0) && std::signbit(v); });
+
+    pika::sort(policy, c.begin(), c.end(), comp);
+
+    PIKA_TEST(std::is_sorted(c.begin(), c.end(), comp));
+    PIKA_TEST_EQ(std::count_if(c.begin(), c.end(),
+                     [](T v) { return v == T(0) && std::signbit(v); }),
+        negative_zeros);
+
+    if (ordered_by_sign)
+    {
+        // the zeros are ordered as if -0.0 < +0.0
+        bool const descending = comp(T(1), T(0));
+        auto zeros = std::equal_range(c.begin(), c.end(), T(0), comp);
+        PIKA_TEST(std::is_partitioned(zeros.first, zeros.second,
+            [&](T v) { return std::signbit(v) != descending; }));
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_radix_signed_zeros(ExPolicy&& policy, bool ordered_by_sign)
+{
+    test_sort_radix_signed_zeros<float>(
+        policy, std::less<>(), ordered_by_sign);
+    test_sort_radix_signed_zeros<float>(
+        policy, std::greater<float>(), ordered_by_sign);
+    test_sort_radix_signed_zeros<double>(
+        policy, std::less<>(), ordered_by_sign);
+    test_sort_radix_signed_zeros<double>(
+        policy, std::greater<double>(), ordered_by_sign);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::int64_t key;
+    std::size_t index;
+};
+
+template <typename ExPolicy>
+void test_sort_radix_projection(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<std::int64_t> keys = make_keys<std::int64_t>(size);
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{keys[i], i};
+    }
+
+    pika::sort(policy, c.begin(), c.end(), std::less<>(), &element::key);
+
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(c[i].key, keys[i]);
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_radix(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<double> keys = make_keys<double>(size);
+    std::vector<double> values = keys;
+    std::transform(values.begin(), values.end(), values.begin(),
+        [](double v) { return -v; });
+
+    pika::sort_by_key(policy, keys.begin(), keys.end(), values.begin());
+
+    PIKA_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(values[i], -keys[i]);
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_radix_async(ExPolicy&& policy)
+{
+    std::vector<std::uint64_t> c = make_keys<std::uint64_t>(100007);
+    std::vector<std::uint64_t> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = pika::sort(policy, c.begin(), c.end());
+    f.wait();
+    PIKA_TEST(c == expected);
+}
+
+void test_sort_radix()
+{
+    using namespace pika::execution;
+
+    radix_sort_selection const automatic(radix_sort_mode::automatic);
+    radix_sort_selection const always(radix_sort_mode::always);
+    radix_sort_selection const never(radix_sort_mode::never);
+
+    test_sort_radix(par);
+    test_sort_radix(par.with(always));
+    test_sort_radix(par.with(never));
+    test_sort_radix(par_unseq.with(automatic));
+
+    // the sequences are long enough for the radix sort engine to be selected
+    test_sort_radix_signed_zeros(par, true);
+    test_sort_radix_signed_zeros(par.with(automatic), true);
+    test_sort_radix_signed_zeros(par.with(radix_sort_selection()), true);
+    test_sort_radix_signed_zeros(par.with(always), true);
+    test_sort_radix_signed_zeros(par.with(never), false);
+
+    test_sort_radix_projection(par);
+    test_sort_radix_projection(par.with(always));
+
+    test_sort_by_key_radix(par);
+    test_sort_by_key_radix(par.with(always));
+
+    test_sort_radix_async(par(task));
+    test_sort_radix_async(par(task).with(always));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_radix();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
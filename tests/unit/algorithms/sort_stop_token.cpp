@@ -0,0 +1,214 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/nth_element.hpp>
+#include <pika/parallel/algorithms/partial_sort.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/util/sort_stop_token.hpp>
+#include <pika/runtime.hpp>
+#include <pika/synchronization/stop_token.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// returns whether running f reported a cancelled algorithm
+template <typename ExPolicy, typename F>
+bool is_cancelled(F&& f)
+{
+    try
+    {
+        test::run<ExPolicy>(f);
+    }
+    catch (pika::exception_list const&)
+    {
+        return true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    return false;
+}
+
+std::vector<int> make_values(std::size_t size)
+{
+    std::vector<int> values(size);
+    for (auto& value : values)
+    {
+        value = int(gen() % 100000);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_stop_token_not_stopped(ExPolicy policy)
+{
+    pika::stop_source source;
+    auto p = policy.with(pika::execution::sort_stop_token(source.get_token()));
+
+    for (std::size_t size : {0, 1000, 100007})
+    {
+        std::vector<int> values = make_values(size);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> v = values;
+        test::run<ExPolicy>([&] { return pika::sort(p, v.begin(), v.end()); });
+        PIKA_TEST(v == expected);
+
+        v = values;
+        test::run<ExPolicy>(
+            [&] { return pika::stable_sort(p, v.begin(), v.end()); });
+        PIKA_TEST(v == expected);
+
+        if (size != 0)
+        {
+            v = values;
+            test::run<ExPolicy>([&] {
+                return pika::nth_element(
+                    p, v.begin(), v.begin() + size / 3, v.end());
+            });
+            PIKA_TEST(v[size / 3] == expected[size / 3]);
+
+            v = values;
+            test::run<ExPolicy>([&] {
+                return pika::partial_sort(
+                    p, v.begin(), v.begin() + size / 3, v.end());
+            });
+            PIKA_TEST(std::equal(
+                v.begin(), v.begin() + size / 3, expected.begin()));
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_stop_token_stopped(ExPolicy policy)
+{
+    pika::stop_source source;
+    source.request_stop();
+    auto p = policy.with(pika::execution::sort_stop_token(source.get_token()));
+
+    std::vector<int> values = make_values(100007);
+    std::vector<int> v = values;
+
+    PIKA_TEST(is_cancelled<ExPolicy>(
+        [&] { return pika::sort(p, v.begin(), v.end()); }));
+    PIKA_TEST(is_cancelled<ExPolicy>(
+        [&] { return pika::stable_sort(p, v.begin(), v.end()); }));
+    PIKA_TEST(is_cancelled<ExPolicy>([&] {
+        return pika::nth_element(p, v.begin(), v.begin() + 10, v.end());
+    }));
+    PIKA_TEST(is_cancelled<ExPolicy>([&] {
+        return pika::partial_sort(p, v.begin(), v.begin() + 10, v.end());
+    }));
+
+    // the cancelled algorithms leave a permutation of the elements
+    std::sort(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    PIKA_TEST(v == values);
+}
+
+// the stop is requested by the comparisons of the first partitioning step,
+// none of the spawned sections is sorted anymore
+template <typename ExPolicy>
+void test_sort_stop_token_running(ExPolicy policy)
+{
+    pika::stop_source source;
+    auto p = policy.with(pika::execution::sort_stop_token(source.get_token()));
+
+    std::vector<int> values = make_values(1000007);
+    std::vector<int> v = values;
+
+    std::atomic<std::size_t> comparisons(0);
+    auto comp = [&](int lhs, int rhs) {
+        if (++comparisons == 1000)
+        {
+            source.request_stop();
+        }
+        return lhs < rhs;
+    };
+
+    PIKA_TEST(is_cancelled<ExPolicy>(
+        [&] { return pika::sort(p, v.begin(), v.end(), comp); }));
+    PIKA_TEST(comparisons < 4 * v.size());
+
+    std::sort(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    PIKA_TEST(v == values);
+}
+
+void sort_stop_token_test()
+{
+    using namespace pika::execution;
+
+    test_sort_stop_token_not_stopped(par);
+    test_sort_stop_token_not_stopped(par(task));
+
+    test_sort_stop_token_stopped(par);
+    test_sort_stop_token_stopped(par(task));
+
+    // a single thread sorts the whole sequence in one section
+    if (pika::get_num_worker_threads() > 1)
+    {
+        test_sort_stop_token_running(par);
+        test_sort_stop_token_running(par(task));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    sort_stop_token_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
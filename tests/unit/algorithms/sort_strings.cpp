@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// Keys sharing long prefixes, keys which are prefixes of others and keys
+// containing '\0' characters.
+std::string make_key()
+{
+    static char const* const prefixes[] = {
+        "", "a", "http://www.example.org/", "http://www.example.org/index"};
+
+    std::string key = prefixes[gen() % 4];
+    std::size_t const size = gen() % 12;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        key.push_back(gen() % 4 == 0 ? '\0' : char('a' + gen() % 3));
+    }
+    return key;
+}
+
+struct element
+{
+    std::string key;
+    std::size_t index;
+};
+
+template <typename Result, typename Iter>
+void test_result(Result&& result, Iter last)
+{
+    if constexpr (std::is_same_v<std::decay_t<Result>, Iter>)
+    {
+        PIKA_TEST(result == last);
+    }
+    else
+    {
+        PIKA_TEST(result.get() == last);
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_strings(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::string> c(size);
+    std::generate(c.begin(), c.end(), make_key);
+    std::vector<std::string> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    test_result(pika::sort(policy, c.begin(), c.end()), c.end());
+    PIKA_TEST(c == expected);
+
+    std::shuffle(c.begin(), c.end(), gen);
+    test_result(
+        pika::sort(policy, c.begin(), c.end(), std::less<std::string>()),
+        c.end());
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_strings(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{make_key(), i};
+    }
+
+    test_result(pika::stable_sort(policy, c.begin(), c.end(), std::less<>(),
+                    &element::key),
+        c.end());
+    PIKA_TEST(std::is_sorted(
+        c.begin(), c.end(), [](element const& lhs, element const& rhs) {
+            return lhs.key < rhs.key ||
+                (lhs.key == rhs.key && lhs.index < rhs.index);
+        }));
+
+    // the projection may yield a view of the key
+    std::shuffle(c.begin(), c.end(), gen);
+    test_result(pika::sort(policy, c.begin(), c.end(), std::less<>(),
+                    [](element const& e) { return std::string_view(e.key); }),
+        c.end());
+    PIKA_TEST(std::is_sorted(
+        c.begin(), c.end(), [](element const& lhs, element const& rhs) {
+            return lhs.key < rhs.key;
+        }));
+}
+
+template <typename ExPolicy>
+void test_sort_strings(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        test_sort_strings(policy, size);
+        test_stable_sort_strings(policy, size);
+    }
+}
+
+void test_sort_strings()
+{
+    using namespace pika::execution;
+
+    test_sort_strings(seq);
+    test_sort_strings(par);
+    test_sort_strings(par_unseq);
+
+    test_sort_strings(seq(task));
+    test_sort_strings(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_strings();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
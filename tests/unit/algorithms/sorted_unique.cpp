@@ -0,0 +1,194 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/sorted_unique.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sorted_unique(ExPolicy&& policy, std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&] { return dis(gen); });
+    std::sort(c.begin(), c.end());
+
+    std::vector<int> expected_values;
+    std::vector<std::size_t> expected_counts;
+    for (auto it = c.begin(); it != c.end(); /**/)
+    {
+        auto next = std::upper_bound(it, c.end(), *it);
+        expected_values.push_back(*it);
+        expected_counts.push_back(next - it);
+        it = next;
+    }
+    std::size_t const groups = expected_values.size();
+
+    std::vector<int> values(size + 1, -1);
+    auto r = test::run<ExPolicy>([&] {
+        return pika::sorted_unique_copy(
+            policy, c.begin(), c.end(), values.begin());
+    });
+    PIKA_TEST(r == values.begin() + groups);
+    PIKA_TEST(std::equal(
+        expected_values.begin(), expected_values.end(), values.begin()));
+    PIKA_TEST_EQ(values[groups], -1);
+
+    std::fill(values.begin(), values.end(), -1);
+    std::vector<std::size_t> counts(size + 1, 0);
+    auto rc = test::run<ExPolicy>([&] {
+        return pika::sorted_unique_count(
+            policy, c.begin(), c.end(), values.begin(), counts.begin());
+    });
+    PIKA_TEST(rc.in == c.end());
+    PIKA_TEST(rc.out1 == values.begin() + groups);
+    PIKA_TEST(rc.out2 == counts.begin() + groups);
+    PIKA_TEST(std::equal(
+        expected_values.begin(), expected_values.end(), values.begin()));
+    PIKA_TEST(std::equal(
+        expected_counts.begin(), expected_counts.end(), counts.begin()));
+    PIKA_TEST_EQ(counts[groups], std::size_t(0));
+}
+
+template <typename ExPolicy>
+void test_sorted_unique_greater(ExPolicy&& policy)
+{
+    // groups of equivalent elements with different values
+    std::vector<std::pair<int, int>> c(100007);
+    std::uniform_int_distribution<int> dis(0, 100);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = std::make_pair(dis(gen), int(i));
+    }
+
+    auto comp = [](auto const& lhs, auto const& rhs) {
+        return lhs.first > rhs.first;
+    };
+    std::stable_sort(c.begin(), c.end(), comp);
+
+    // the first element of each group is copied
+    std::vector<std::pair<int, int>> expected;
+    std::unique_copy(c.begin(), c.end(), std::back_inserter(expected),
+        [](auto const& lhs, auto const& rhs) {
+            return lhs.first == rhs.first;
+        });
+
+    std::vector<std::pair<int, int>> values(c.size());
+    auto r = test::run<ExPolicy>([&] {
+        return pika::sorted_unique_copy(
+            policy, c.begin(), c.end(), values.begin(), comp);
+    });
+    PIKA_TEST(r == values.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), values.begin()));
+}
+
+template <typename ExPolicy>
+void test_sorted_unique_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    std::vector<int> d(c.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::sorted_unique_copy(policy, c.begin(), c.end(),
+                d.begin(),
+                [](int, int) -> bool { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_sorted_unique()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 2, 1000, 100007})
+    {
+        // a single group, long groups and mostly unique elements
+        for (int max_value : {0, 10, 1000000})
+        {
+            test_sorted_unique(seq, size, max_value);
+            test_sorted_unique(par, size, max_value);
+            test_sorted_unique(par_unseq, size, max_value);
+            test_sorted_unique(par(task), size, max_value);
+        }
+    }
+
+    test_sorted_unique_greater(seq);
+    test_sorted_unique_greater(par);
+
+    test_sorted_unique_exception(par);
+    test_sorted_unique_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sorted_unique();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
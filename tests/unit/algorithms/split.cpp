@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/split.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// a CSV-like buffer of the given size, quotes are rare
+std::string make_buffer(std::size_t size)
+{
+    std::string buffer(size, 'x');
+    for (char& c : buffer)
+    {
+        std::size_t const r = gen() % 40;
+        c = r == 0 ? '"' : r < 4 ? ',' : r == 4 ? '\n' : 'x';
+    }
+    return buffer;
+}
+
+auto const is_delimiter = [](char c) { return c == ',' || c == '\n'; };
+auto const is_quote = [](char c) { return c == '"'; };
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_split(ExPolicy policy, std::string const& buffer)
+{
+    std::vector<std::size_t> expected;
+    std::vector<std::size_t> expected_quoted;
+    bool quoted = false;
+    for (std::size_t i = 0; i != buffer.size(); ++i)
+    {
+        if (is_quote(buffer[i]))
+        {
+            quoted = !quoted;
+        }
+        else if (is_delimiter(buffer[i]))
+        {
+            expected.push_back(i);
+            if (!quoted)
+            {
+                expected_quoted.push_back(i);
+            }
+        }
+    }
+
+    std::vector<std::size_t> positions(buffer.size() + 1, std::size_t(-1));
+    auto result = test::run<ExPolicy>([&] {
+        return pika::split(policy, buffer.begin(), buffer.end(), is_delimiter,
+            positions.begin());
+    });
+
+    PIKA_TEST(result == positions.begin() + expected.size());
+    PIKA_TEST(std::equal(expected.begin(), expected.end(), positions.begin()));
+    PIKA_TEST_EQ(*result, std::size_t(-1));
+
+    std::fill(positions.begin(), positions.end(), std::size_t(-1));
+    result = test::run<ExPolicy>([&] {
+        return pika::split_quoted(policy, buffer.begin(), buffer.end(),
+            is_delimiter, is_quote, positions.begin());
+    });
+
+    PIKA_TEST(result == positions.begin() + expected_quoted.size());
+    PIKA_TEST(std::equal(
+        expected_quoted.begin(), expected_quoted.end(), positions.begin()));
+    PIKA_TEST_EQ(*result, std::size_t(-1));
+
+    // forward iterators are examined in blocks as well
+    std::list<char> const list(buffer.begin(), buffer.end());
+    std::fill(positions.begin(), positions.end(), std::size_t(-1));
+    result = test::run<ExPolicy>([&] {
+        return pika::split_quoted(policy, list.begin(), list.end(),
+            is_delimiter, is_quote, positions.begin());
+    });
+
+    PIKA_TEST(result == positions.begin() + expected_quoted.size());
+    PIKA_TEST(std::equal(
+        expected_quoted.begin(), expected_quoted.end(), positions.begin()));
+}
+
+void split_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 4096, 100007})
+    {
+        std::string const buffer = make_buffer(size);
+
+        test_split(seq, buffer);
+        test_split(par, buffer);
+        test_split(par_unseq, buffer);
+        test_split(seq(task), buffer);
+        test_split(par(task), buffer);
+    }
+
+    // a quoted section spanning most of the buffer, with escaped quotes
+    std::string buffer = make_buffer(100007);
+    buffer[10] = '"';
+    buffer[50000] = '"';
+    buffer[50001] = '"';
+    buffer[90000] = '"';
+    std::replace(buffer.begin() + 11, buffer.begin() + 50000, '"', 'x');
+    std::replace(buffer.begin() + 50002, buffer.begin() + 90000, '"', 'x');
+    test_split(par, buffer);
+
+    // sequential overloads
+    std::vector<std::size_t> positions;
+    pika::split_quoted(buffer.begin(), buffer.end(), is_delimiter, is_quote,
+        std::back_inserter(positions));
+    PIKA_TEST(std::none_of(positions.begin(), positions.end(),
+        [](std::size_t pos) { return pos > 10 && pos < 90000; }));
+
+    positions.clear();
+    pika::split(buffer.begin(), buffer.end(), is_delimiter,
+        std::back_inserter(positions));
+    PIKA_TEST_EQ(positions.size(),
+        std::size_t(
+            std::count_if(buffer.begin(), buffer.end(), is_delimiter)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    split_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/util/stream_compaction.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the values paired with their original positions to check stability
+std::vector<std::pair<int, std::size_t>> make_values(std::size_t size)
+{
+    std::vector<std::pair<int, std::size_t>> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = std::make_pair(static_cast<int>(gen() % 100), i);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_partition_buffer(ExPolicy policy,
+    std::vector<std::pair<int, std::size_t>> const& values, int pivot)
+{
+    std::vector<std::pair<int, std::size_t>> c = values;
+    std::vector<std::pair<int, std::size_t>> buffer(c.size());
+
+    auto pred = [pivot](int value) { return value < pivot; };
+    auto proj = [](std::pair<int, std::size_t> const& p) { return p.first; };
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::stable_partition(
+            policy, c.begin(), c.end(), pred, buffer.begin(), proj);
+    });
+
+    std::vector<std::pair<int, std::size_t>> expected = values;
+    auto expected_result = std::stable_partition(expected.begin(),
+        expected.end(), [&](auto const& p) { return pred(p.first); });
+
+    PIKA_TEST(result - c.begin() == expected_result - expected.begin());
+    PIKA_TEST(c == expected);
+}
+
+void stable_partition_buffer_test()
+{
+    using namespace pika::execution;
+
+    stream_compaction const flags(stream_compaction_mode::flags);
+    stream_compaction const recompute(stream_compaction_mode::recompute);
+
+    for (std::size_t size : {0, 1, 7, 4096, 100007, 1000003})
+    {
+        std::vector<std::pair<int, std::size_t>> const values =
+            make_values(size);
+
+        for (int pivot : {0, 30, 100})
+        {
+            test_stable_partition_buffer(seq, values, pivot);
+            test_stable_partition_buffer(par, values, pivot);
+            test_stable_partition_buffer(par_unseq, values, pivot);
+            test_stable_partition_buffer(seq(task), values, pivot);
+            test_stable_partition_buffer(par(task), values, pivot);
+            test_stable_partition_buffer(par.with(flags), values, pivot);
+            test_stable_partition_buffer(par.with(recompute), values, pivot);
+            test_stable_partition_buffer(par(task).with(flags), values, pivot);
+        }
+    }
+}
+
+// bidirectional iterators are partitioned sequentially
+void stable_partition_buffer_list_test()
+{
+    using namespace pika::execution;
+
+    std::vector<std::pair<int, std::size_t>> const values = make_values(10007);
+    std::list<std::pair<int, std::size_t>> c(values.begin(), values.end());
+    std::vector<std::pair<int, std::size_t>> buffer(c.size());
+
+    auto pred = [](std::pair<int, std::size_t> const& p) {
+        return p.first % 2 == 0;
+    };
+
+    auto result =
+        pika::stable_partition(par, c.begin(), c.end(), pred, buffer.begin());
+
+    std::vector<std::pair<int, std::size_t>> expected = values;
+    auto expected_result =
+        std::stable_partition(expected.begin(), expected.end(), pred);
+
+    PIKA_TEST(std::distance(c.begin(), result) ==
+        std::distance(expected.begin(), expected_result));
+    PIKA_TEST(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    stable_partition_buffer_test();
+    stable_partition_buffer_list_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
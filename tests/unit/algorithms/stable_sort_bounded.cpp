@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/util/stable_sort_memory_limit.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    int key;
+    std::size_t index;
+};
+
+bool operator==(element const& lhs, element const& rhs)
+{
+    return lhs.key == rhs.key && lhs.index == rhs.index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort_bounded(ExPolicy&& policy, std::size_t size, int keys)
+{
+    std::uniform_int_distribution<int> dis(0, keys - 1);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{dis(gen), i};
+    }
+
+    auto comp = [](element const& lhs, element const& rhs) {
+        return lhs.key < rhs.key;
+    };
+
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    pika::stable_sort(policy, c.begin(), c.end(), comp);
+    PIKA_TEST(c == expected);
+
+    // sorting the keys using a projection has to keep the order again
+    pika::stable_sort(policy, c.begin(), c.end(), std::less<>(),
+        [](element const& e) { return e.key / 2; });
+    std::stable_sort(expected.begin(), expected.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key / 2 < rhs.key / 2;
+        });
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_bounded(ExPolicy&& policy)
+{
+    using pika::execution::stable_sort_memory_limit;
+
+    for (std::size_t size : {0, 1, 2, 1000, 100007, 1000000})
+    {
+        // the default buffer of sqrt(N) elements, a tiny one and none at all
+        test_stable_sort_bounded(
+            policy.with(stable_sort_memory_limit()), size, 10);
+        test_stable_sort_bounded(
+            policy.with(stable_sort_memory_limit(16)), size, 1000000);
+        test_stable_sort_bounded(
+            policy.with(stable_sort_memory_limit(1)), size, 100);
+    }
+}
+
+template <typename ExPolicy>
+void test_stable_sort_bounded_exception(ExPolicy&& policy)
+{
+    using pika::execution::stable_sort_memory_limit;
+
+    std::vector<int> c(1000000);
+    std::generate(c.begin(), c.end(), [&]() { return int(gen() % 1000); });
+    c[c.size() / 3] = -1;
+
+    // every element is compared at least once
+    bool caught_exception = false;
+    try
+    {
+        pika::stable_sort(policy.with(stable_sort_memory_limit()), c.begin(),
+            c.end(), [](int lhs, int rhs) -> bool {
+                if (lhs == -1 || rhs == -1)
+                {
+                    throw std::runtime_error("test");
+                }
+                return lhs < rhs;
+            });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_stable_sort_bounded()
+{
+    using namespace pika::execution;
+
+    test_stable_sort_bounded(seq);
+    test_stable_sort_bounded(par);
+    test_stable_sort_bounded(par_unseq);
+
+    test_stable_sort_bounded_exception(par);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_stable_sort_bounded();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
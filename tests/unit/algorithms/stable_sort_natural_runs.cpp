@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    int key;
+    std::size_t index;
+};
+
+bool operator==(element const& lhs, element const& rhs)
+{
+    return lhs.key == rhs.key && lhs.index == rhs.index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the keys of the inputs consisting of few natural runs
+int natural_runs_key(int kind, std::size_t i, std::size_t size)
+{
+    switch (kind)
+    {
+    case 0:
+        // sorted, with equal keys
+        return int(i / 3);
+    case 1:
+        // strictly descending
+        return int(size - i);
+    case 2:
+        // sorted, with a few elements out of place
+        return gen() % 1000 == 0 ? int(gen() % size) : int(i);
+    case 3:
+        // alternating ascending and descending blocks
+        return (i / 1000) % 2 != 0 ? int(size - i) : int(i);
+    case 4:
+        // concatenated sorted sequences
+        return int(i % 5000);
+    default:
+        // random, sorted the usual way
+        return int(gen() % 1000);
+    }
+}
+
+template <typename ExPolicy>
+void test_stable_sort_natural_runs(
+    ExPolicy&& policy, std::size_t size, int kind)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{natural_runs_key(kind, i, size), i};
+    }
+
+    auto comp = [](element const& lhs, element const& rhs) {
+        return lhs.key < rhs.key;
+    };
+
+    std::vector<element> expected = c;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    pika::stable_sort(policy, c.begin(), c.end(), comp);
+    PIKA_TEST(c == expected);
+
+    // the sorted sequence is a single run of equal projected keys
+    pika::stable_sort(policy, c.begin(), c.end(), std::greater<>(),
+        [](element const& e) { return e.key / 100; });
+    std::stable_sort(expected.begin(), expected.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key / 100 > rhs.key / 100;
+        });
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_natural_runs(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 4096, 10007, 1000000})
+    {
+        for (int kind = 0; kind != 6; ++kind)
+        {
+            test_stable_sort_natural_runs(policy, size, kind);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_stable_sort_natural_runs_async(ExPolicy&& policy)
+{
+    std::vector<int> c(100007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = int(i % 1000);
+    }
+
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = pika::stable_sort(policy, c.begin(), c.end());
+    f.get();
+    PIKA_TEST(c == expected);
+}
+
+void test_stable_sort_natural_runs()
+{
+    using namespace pika::execution;
+
+    test_stable_sort_natural_runs(seq);
+    test_stable_sort_natural_runs(par);
+    test_stable_sort_natural_runs(par_unseq);
+
+    test_stable_sort_natural_runs_async(seq(task));
+    test_stable_sort_natural_runs_async(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_stable_sort_natural_runs();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/stencil.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// an asymmetric stencil on integers, which detects any point read from
+// the wrong neighbour or time step
+struct stencil_op
+{
+    std::size_t radius;
+
+    long operator()(long const* center) const
+    {
+        long value = 3 * center[0];
+        for (long k = 1; k <= static_cast<long>(radius); ++k)
+        {
+            value += center[-k] - 2 * center[k] + (k ^ center[k]);
+        }
+        return value % 100003;
+    }
+};
+
+std::vector<long> stencil_reference(std::vector<long> values,
+    std::size_t radius, std::size_t steps, pika::stencil_boundary boundary)
+{
+    std::size_t const size = values.size();
+    stencil_op const op{radius};
+
+    std::vector<long> extended(size + 2 * radius);
+    for (std::size_t step = 0; step != steps; ++step)
+    {
+        for (std::size_t j = 0; j != extended.size(); ++j)
+        {
+            extended[j] = values[(j + size * (radius + 1) - radius) % size];
+        }
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            if (boundary == pika::stencil_boundary::fixed &&
+                (i < radius || i + radius >= size))
+            {
+                continue;
+            }
+            values[i] = op(extended.data() + i + radius);
+        }
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stencil(ExPolicy&& policy, pika::stencil_boundary boundary)
+{
+    for (std::size_t radius : {0, 1, 3})
+    {
+        for (std::size_t size : {1, 5, 1000, 100007})
+        {
+            for (std::size_t steps : {0, 1, 40})
+            {
+                std::vector<long> values(size);
+                for (long& value : values)
+                {
+                    value = static_cast<long>(gen() % 1000);
+                }
+                std::vector<long> const expected =
+                    stencil_reference(values, radius, steps, boundary);
+
+                test::run<ExPolicy>([&] {
+                    return pika::stencil(policy, values.begin(),
+                        values.end(), radius, stencil_op{radius}, steps,
+                        boundary);
+                });
+                PIKA_TEST(values == expected);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_stencil_exception(ExPolicy&& policy)
+{
+    std::vector<long> values(100007, 0);
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::stencil(policy, values.begin(), values.end(), 1,
+                [](long const*) -> long { throw std::runtime_error("test"); },
+                10);
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void stencil_test()
+{
+    using namespace pika::execution;
+
+    for (pika::stencil_boundary boundary :
+        {pika::stencil_boundary::fixed, pika::stencil_boundary::periodic})
+    {
+        test_stencil(seq, boundary);
+        test_stencil(par, boundary);
+        test_stencil(par(task), boundary);
+
+        // single points, tiles smaller than their halos, a single tile
+        test_stencil(par.with(stencil_blocking(1, 1)), boundary);
+        test_stencil(par.with(stencil_blocking(3, 5)), boundary);
+        test_stencil(par.with(stencil_blocking(200000, 7)), boundary);
+    }
+
+    // the overloads without a boundary keep the ends of the grid
+    std::vector<long> values(1000, 1);
+    values.front() = 0;
+    pika::stencil(values.begin(), values.end(), 1,
+        [](long const* center) { return center[-1]; }, 5);
+    PIKA_TEST_EQ(values[0], 0L);
+    PIKA_TEST_EQ(values[5], 0L);
+    PIKA_TEST_EQ(values[6], 1L);
+
+    test_stencil_exception(seq);
+    test_stencil_exception(par);
+    test_stencil_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    stencil_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
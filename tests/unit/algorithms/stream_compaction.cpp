@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/remove.hpp>
+#include <pika/parallel/algorithms/unique.hpp>
+#include <pika/parallel/util/stream_compaction.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// short runs of equal strings, long enough not to fit the small string buffer
+std::vector<std::string> make_input(std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 3);
+
+    std::vector<std::string> c(size);
+    for (auto& s : c)
+    {
+        s = std::string(32, 'a') + std::to_string(dis(gen));
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stream_compaction(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::string> const c = make_input(size);
+    auto pred = [](std::string const& s) { return s.back() == '0'; };
+
+    // copy_if
+    {
+        std::vector<std::string> expected;
+        std::copy_if(c.begin(), c.end(), std::back_inserter(expected), pred);
+
+        std::vector<std::string> d(size);
+        auto r = test::run<ExPolicy>([&] {
+            return pika::copy_if(policy, c.begin(), c.end(), d.begin(), pred);
+        });
+        PIKA_TEST(r == d.begin() + expected.size());
+        d.resize(expected.size());
+        PIKA_TEST(d == expected);
+    }
+
+    // remove_if
+    {
+        std::vector<std::string> expected = c;
+        expected.erase(std::remove_if(expected.begin(), expected.end(), pred),
+            expected.end());
+
+        std::vector<std::string> d = c;
+        auto r = test::run<ExPolicy>(
+            [&] { return pika::remove_if(policy, d.begin(), d.end(), pred); });
+        PIKA_TEST(r == d.begin() + expected.size());
+        d.resize(expected.size());
+        PIKA_TEST(d == expected);
+    }
+
+    // unique
+    {
+        std::vector<std::string> expected = c;
+        expected.erase(
+            std::unique(expected.begin(), expected.end()), expected.end());
+
+        std::vector<std::string> d = c;
+        auto r = test::run<ExPolicy>(
+            [&] { return pika::unique(policy, d.begin(), d.end()); });
+        PIKA_TEST(r == d.begin() + expected.size());
+        d.resize(expected.size());
+        PIKA_TEST(d == expected);
+    }
+}
+
+// nothing is removed, copied or moved
+template <typename ExPolicy>
+void test_stream_compaction_unique_elements(ExPolicy&& policy)
+{
+    std::vector<std::string> c(100007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = std::to_string(i);
+    }
+
+    std::vector<std::string> d = c;
+    auto r1 = test::run<ExPolicy>(
+        [&] { return pika::unique(policy, d.begin(), d.end()); });
+    PIKA_TEST(r1 == d.end());
+    PIKA_TEST(d == c);
+
+    auto r2 = test::run<ExPolicy>([&] {
+        return pika::remove_if(policy, d.begin(), d.end(),
+            [](std::string const&) { return false; });
+    });
+    PIKA_TEST(r2 == d.end());
+    PIKA_TEST(d == c);
+}
+
+void test_stream_compaction()
+{
+    using namespace pika::execution;
+
+    stream_compaction const flags(stream_compaction_mode::flags);
+    stream_compaction const recompute(stream_compaction_mode::recompute);
+    stream_compaction const staging(stream_compaction_mode::staging);
+
+    for (std::size_t size : {1, 10, 5000, 100007})
+    {
+        test_stream_compaction(par, size);
+        test_stream_compaction(par.with(flags), size);
+        test_stream_compaction(par.with(recompute), size);
+        test_stream_compaction(par.with(staging), size);
+        test_stream_compaction(par_unseq.with(staging), size);
+        test_stream_compaction(par(task).with(recompute), size);
+        test_stream_compaction(par(task).with(staging), size);
+    }
+
+    test_stream_compaction_unique_elements(par.with(recompute));
+    test_stream_compaction_unique_elements(par.with(staging));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_stream_compaction();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
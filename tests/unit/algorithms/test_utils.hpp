@@ -17,6 +17,7 @@
 #include <iterator>
 #include <numeric>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 namespace test {
@@ -292,4 +293,20 @@ namespace test {
 
         return std::equal(first1, last1, first2);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs the algorithm invoked by f and waits for its result if the policy
+    // is asynchronous
+    template <typename ExPolicy, typename F>
+    decltype(auto) run(F&& f)
+    {
+        if constexpr (pika::is_async_execution_policy_v<std::decay_t<ExPolicy>>)
+        {
+            return f().get();
+        }
+        else
+        {
+            return f();
+        }
+    }
 }    // namespace test
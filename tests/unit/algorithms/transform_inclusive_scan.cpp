@@ -8,6 +8,7 @@
 #include <pika/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <pika/testing.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
@@ -248,6 +249,50 @@ void transform_inclusive_scan_test2()
     test_transform_inclusive_scan2<std::forward_iterator_tag>();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The conversion is applied exactly once per element, the second pass over a
+// partition only combines the partial results with the partition's prefix.
+template <typename ExPolicy, typename IteratorTag>
+void test_transform_inclusive_scan_conv_count(ExPolicy policy, IteratorTag)
+{
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::size_t> c(100007);
+    std::vector<std::size_t> d(c.size());
+    std::iota(std::begin(c), std::end(c), std::size_t(0));
+
+    std::atomic<std::size_t> num_conv(0);
+    auto op = [](std::size_t v1, std::size_t v2) { return v1 + v2; };
+    auto conv = [&num_conv](std::size_t val) {
+        ++num_conv;
+        return 2 * val;
+    };
+
+    test::run<ExPolicy>([&] {
+        return pika::transform_inclusive_scan(policy, iterator(std::begin(c)),
+            iterator(std::end(c)), std::begin(d), op, conv, std::size_t(0));
+    });
+    PIKA_TEST_EQ(num_conv.load(), c.size());
+}
+
+template <typename IteratorTag>
+void test_transform_inclusive_scan_conv_count()
+{
+    using namespace pika::execution;
+
+    test_transform_inclusive_scan_conv_count(seq, IteratorTag());
+    test_transform_inclusive_scan_conv_count(par, IteratorTag());
+    test_transform_inclusive_scan_conv_count(par_unseq, IteratorTag());
+    test_transform_inclusive_scan_conv_count(par(task), IteratorTag());
+}
+
+void transform_inclusive_scan_conv_count_test()
+{
+    test_transform_inclusive_scan_conv_count<std::random_access_iterator_tag>();
+    test_transform_inclusive_scan_conv_count<std::forward_iterator_tag>();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_transform_inclusive_scan_exception(ExPolicy policy, IteratorTag)
@@ -460,6 +505,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     transform_inclusive_scan_test1();
     transform_inclusive_scan_test2();
+    transform_inclusive_scan_conv_count_test();
 
     transform_inclusive_scan_exception_test();
     transform_inclusive_scan_bad_alloc_test();
@@ -33,6 +33,14 @@ void transform_reduce_binary_test()
 {
     test_transform_reduce_binary<std::random_access_iterator_tag>();
     test_transform_reduce_binary<std::forward_iterator_tag>();
+
+    using namespace pika::execution;
+
+    test_transform_reduce_binary_dot(seq, float());
+    test_transform_reduce_binary_dot(seq, double());
+    test_transform_reduce_binary_dot(par, float());
+    test_transform_reduce_binary_dot(par, double());
+    test_transform_reduce_binary_dot(par_unseq, double());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
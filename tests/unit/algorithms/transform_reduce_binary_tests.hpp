@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -78,3 +79,37 @@ void test_transform_reduce_binary_async(ExPolicy&& p, IteratorTag)
     PIKA_TEST_EQ(fut_r.get(),
         std::inner_product(std::begin(c), std::end(c), std::begin(d), init));
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous sequences of floating point values are reduced by a dedicated
+// kernel. The small integral values make the results exact, independently
+// of the order of the additions.
+template <typename ExPolicy, typename T>
+void test_transform_reduce_binary_dot(ExPolicy&& policy, T)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t size : {0, 1, 7, 8, 9, 63, 64, 65, 1007, 100007})
+    {
+        // the second sequence starts at an offset from the first one
+        std::vector<T> c(size);
+        std::vector<T> d(size + 1);
+        std::generate(std::begin(c), std::end(c),
+            [] { return T(std::rand() % 17 - 8); });
+        std::generate(std::begin(d), std::end(d),
+            [] { return T(std::rand() % 17 - 8); });
+        T const init = T(0.5);
+
+        T const expected = std::inner_product(
+            std::begin(c), std::end(c), std::begin(d) + 1, init);
+
+        T r = pika::transform_reduce(policy, std::begin(c), std::end(c),
+            std::begin(d) + 1, init);
+        PIKA_TEST_EQ(r, expected);
+
+        r = pika::transform_reduce(policy, c.data(), c.data() + size,
+            d.data() + 1, init, std::plus<T>(), std::multiplies<T>());
+        PIKA_TEST_EQ(r, expected);
+    }
+}
@@ -0,0 +1,216 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// integral values make the sums independent of the order of the additions
+std::vector<double> make_input(std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+
+    std::vector<double> c(size);
+    std::generate(c.begin(), c.end(), [&] { return double(dis(gen)); });
+    return c;
+}
+
+auto make_statistics()
+{
+    return std::make_tuple(
+        pika::transform_reduction(
+            0.0, std::plus<>(), [](double x) { return x; }),
+        pika::transform_reduction(
+            0.0, std::plus<>(), [](double x) { return x * x; }),
+        pika::transform_reduction(std::numeric_limits<double>::max(),
+            [](double a, double b) { return (std::min)(a, b); },
+            [](double x) { return x; }),
+        pika::transform_reduction(std::numeric_limits<double>::lowest(),
+            [](double a, double b) { return (std::max)(a, b); },
+            [](double x) { return x; }),
+        pika::transform_reduction(std::size_t(0), std::plus<>(),
+            [](double x) { return x < 0 ? 1 : 0; }));
+}
+
+template <typename Iter>
+std::tuple<double, double, double, double, std::size_t> expected_statistics(
+    Iter first, Iter last)
+{
+    std::tuple<double, double, double, double, std::size_t> expected(
+        0.0, 0.0, std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest(), 0);
+    for (/* */; first != last; ++first)
+    {
+        double const x = *first;
+        std::get<0>(expected) += x;
+        std::get<1>(expected) += x * x;
+        std::get<2>(expected) = (std::min)(std::get<2>(expected), x);
+        std::get<3>(expected) = (std::max)(std::get<3>(expected), x);
+        std::get<4>(expected) += x < 0 ? 1 : 0;
+    }
+    return expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_transform_reduce_multi(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> const c = make_input(size);
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(
+            policy, c.begin(), c.end(), make_statistics());
+    });
+
+    static_assert(std::is_same_v<decltype(r),
+        std::tuple<double, double, double, double, std::size_t>>);
+    PIKA_TEST(r == expected_statistics(c.begin(), c.end()));
+}
+
+template <typename ExPolicy>
+void test_transform_reduce_multi_forward(ExPolicy&& policy)
+{
+    std::vector<double> const v = make_input(10007);
+    std::list<double> const c(v.begin(), v.end());
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(
+            policy, c.begin(), c.end(), make_statistics());
+    });
+    PIKA_TEST(r == expected_statistics(c.begin(), c.end()));
+}
+
+// the initial values are taken into account once
+void test_transform_reduce_multi_init()
+{
+    using namespace pika::execution;
+
+    std::vector<int> c(100007, 1);
+    auto reductions = std::make_tuple(
+        pika::transform_reduction(
+            100, std::plus<>(), [](int x) { return 2 * x; }),
+        pika::transform_reduction(
+            1, std::multiplies<>(), [](int x) { return x; }));
+
+    auto r = pika::transform_reduce(seq, c.begin(), c.end(), reductions);
+    PIKA_TEST(r == std::make_tuple(100 + 2 * 100007, 1));
+
+    r = pika::transform_reduce(par, c.begin(), c.end(), reductions);
+    PIKA_TEST(r == std::make_tuple(100 + 2 * 100007, 1));
+
+    r = pika::transform_reduce(c.begin(), c.end(), reductions);
+    PIKA_TEST(r == std::make_tuple(100 + 2 * 100007, 1));
+}
+
+template <typename ExPolicy>
+void test_transform_reduce_multi_exception(ExPolicy&& policy)
+{
+    std::vector<double> const c = make_input(100007);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::transform_reduce(policy, c.begin(), c.end(),
+                std::make_tuple(pika::transform_reduction(0.0, std::plus<>(),
+                                    [](double x) { return x; }),
+                    pika::transform_reduction(
+                        0.0, std::plus<>(), [](double) -> double {
+                            throw std::runtime_error("test");
+                        })));
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_transform_reduce_multi()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_transform_reduce_multi(seq, size);
+        test_transform_reduce_multi(par, size);
+        test_transform_reduce_multi(par_unseq, size);
+        test_transform_reduce_multi(seq(task), size);
+        test_transform_reduce_multi(par(task), size);
+    }
+
+    test_transform_reduce_multi_forward(seq);
+    test_transform_reduce_multi_forward(par);
+
+    test_transform_reduce_multi_init();
+
+    test_transform_reduce_multi_exception(seq);
+    test_transform_reduce_multi_exception(par);
+    test_transform_reduce_multi_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_transform_reduce_multi();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transpose.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the sizes cover single elements, partial register blocks, partial tiles
+// and several tiles per core
+std::size_t const sizes[] = {1, 3, 8, 33, 100, 257, 1031};
+
+template <typename Container, typename ExPolicy>
+void test_transpose(ExPolicy&& policy)
+{
+    using value_type = typename Container::value_type;
+
+    for (std::size_t rows : sizes)
+    {
+        for (std::size_t cols : sizes)
+        {
+            Container in(rows * cols);
+            for (auto& value : in)
+            {
+                value = static_cast<value_type>(gen() % 10007);
+            }
+            Container out(rows * cols, value_type(-1));
+
+            auto const result = test::run<ExPolicy>([&] {
+                return pika::transpose(
+                    policy, in.begin(), out.begin(), rows, cols);
+            });
+            PIKA_TEST(result == out.end());
+
+            bool equal = true;
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                for (std::size_t j = 0; j != cols; ++j)
+                {
+                    equal = equal && out[j * rows + i] == in[i * cols + j];
+                }
+            }
+            PIKA_TEST(equal);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_transpose(ExPolicy&& policy)
+{
+    // float and double are transposed in registers
+    test_transpose<std::vector<float>>(policy);
+    test_transpose<std::vector<double>>(policy);
+    test_transpose<std::vector<int>>(policy);
+    test_transpose<std::deque<double>>(policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct throwing
+{
+    throwing() = default;
+    throwing(throwing const&) = default;
+
+    throwing& operator=(throwing const&)
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+template <typename ExPolicy>
+void test_transpose_exception(ExPolicy&& policy)
+{
+    std::vector<throwing> in(1000 * 1000);
+    std::vector<throwing> out(in.size());
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::transpose(
+                policy, in.begin(), out.begin(), 1000, 1000);
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void transpose_test()
+{
+    using namespace pika::execution;
+
+    test_transpose(seq);
+    test_transpose(par);
+    test_transpose(par_unseq);
+    test_transpose(par(task));
+
+    // the overload without a policy and empty matrices
+    std::vector<int> in = {1, 2, 3, 4, 5, 6};
+    std::vector<int> out(6);
+    PIKA_TEST(pika::transpose(in.begin(), out.begin(), 2, 3) == out.end());
+    PIKA_TEST(out == (std::vector<int>{1, 4, 2, 5, 3, 6}));
+    PIKA_TEST(pika::transpose(par, in.begin(), out.begin(), 0, 3) ==
+        out.begin());
+
+    test_transpose_exception(seq);
+    test_transpose_exception(par);
+    test_transpose_exception(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    transpose_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,325 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/uninitialized_relocate.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::atomic<std::ptrdiff_t> instances(0);
+
+// relocated by copying its bytes, see the specialization below
+struct owner
+{
+    explicit owner(int i)
+      : p(new int(i))
+    {
+    }
+
+    int value() const
+    {
+        return *p;
+    }
+
+    std::unique_ptr<int> p;
+};
+
+template <>
+struct pika::traits::is_trivially_relocatable<owner> : std::true_type
+{
+};
+
+// relocated in a single pass
+struct counted
+{
+    explicit counted(int i)
+      : v(i)
+    {
+        ++instances;
+    }
+
+    counted(counted&& rhs) noexcept
+      : v(rhs.v)
+    {
+        ++instances;
+    }
+
+    ~counted()
+    {
+        --instances;
+    }
+
+    int value() const
+    {
+        return v;
+    }
+
+    int v;
+};
+
+// moved first, destroyed afterwards
+struct throwing
+{
+    explicit throwing(int i)
+      : v(i)
+    {
+        ++instances;
+    }
+
+    throwing(throwing&& rhs)
+      : v(rhs.v)
+    {
+        if (v == throw_at)
+        {
+            throw std::runtime_error("throwing");
+        }
+        ++instances;
+    }
+
+    ~throwing()
+    {
+        --instances;
+    }
+
+    int value() const
+    {
+        return v;
+    }
+
+    static int throw_at;
+    int v;
+};
+
+int throwing::throw_at = -1;
+
+static_assert(pika::traits::is_trivially_relocatable_v<int>);
+static_assert(pika::traits::is_trivially_relocatable_v<owner>);
+static_assert(!pika::traits::is_trivially_relocatable_v<counted>);
+
+template <typename T>
+T* make_uninitialized(std::size_t size)
+{
+    return std::allocator<T>{}.allocate(size);
+}
+
+template <typename T>
+void free_uninitialized(T* p, std::size_t size)
+{
+    std::allocator<T>{}.deallocate(p, size);
+}
+
+template <typename T>
+int value_of(T const& t)
+{
+    if constexpr (std::is_same_v<T, int>)
+    {
+        return t;
+    }
+    else
+    {
+        return t.value();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_uninitialized_relocate(ExPolicy policy, std::size_t size)
+{
+    int const offset = static_cast<int>(gen() % 1000);
+
+    T* src = make_uninitialized<T>(size);
+    T* dest = make_uninitialized<T>(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        ::new (src + i) T(offset + static_cast<int>(i));
+    }
+    std::ptrdiff_t const live = instances;
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::uninitialized_relocate(policy, src, src + size, dest);
+    });
+
+    PIKA_TEST(result == dest + size);
+    PIKA_TEST_EQ(instances.load(), live);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(value_of(dest[i]), offset + static_cast<int>(i));
+    }
+
+    // relocate the elements back
+    auto result_n = test::run<ExPolicy>([&] {
+        return pika::uninitialized_relocate_n(policy, dest, size, src);
+    });
+
+    PIKA_TEST(result_n.first == dest + size);
+    PIKA_TEST(result_n.second == src + size);
+    PIKA_TEST_EQ(instances.load(), live);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(value_of(src[i]), offset + static_cast<int>(i));
+        src[i].~T();
+    }
+
+    free_uninitialized(src, size);
+    free_uninitialized(dest, size);
+}
+
+template <typename T>
+void test_uninitialized_relocate()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 100007})
+    {
+        T* src = make_uninitialized<T>(size);
+        T* dest = make_uninitialized<T>(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            ::new (src + i) T(static_cast<int>(i));
+        }
+
+        auto result = pika::uninitialized_relocate(src, src + size, dest);
+        PIKA_TEST(result == dest + size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            PIKA_TEST_EQ(value_of(dest[i]), static_cast<int>(i));
+            dest[i].~T();
+        }
+
+        free_uninitialized(src, size);
+        free_uninitialized(dest, size);
+
+        test_uninitialized_relocate<T>(seq, size);
+        test_uninitialized_relocate<T>(par, size);
+        test_uninitialized_relocate<T>(par_unseq, size);
+        test_uninitialized_relocate<T>(seq(task), size);
+        test_uninitialized_relocate<T>(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// If moving an element throws, the source elements are not destroyed and the
+// destination range holds no objects.
+template <typename ExPolicy>
+void test_uninitialized_relocate_exception(ExPolicy policy)
+{
+    std::size_t const size = 10007;
+    throwing::throw_at = static_cast<int>(gen() % size);
+
+    throwing* src = make_uninitialized<throwing>(size);
+    throwing* dest = make_uninitialized<throwing>(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        ::new (src + i) throwing(static_cast<int>(i));
+    }
+    std::ptrdiff_t const live = instances;
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::uninitialized_relocate(
+                policy, src, src + size, dest);
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+    PIKA_TEST_EQ(instances.load(), live);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        src[i].~throwing();
+    }
+
+    free_uninitialized(src, size);
+    free_uninitialized(dest, size);
+    throwing::throw_at = -1;
+}
+
+void uninitialized_relocate_exception_test()
+{
+    using namespace pika::execution;
+
+    test_uninitialized_relocate_exception(seq);
+    test_uninitialized_relocate_exception(par);
+    test_uninitialized_relocate_exception(seq(task));
+    test_uninitialized_relocate_exception(par(task));
+}
+
+void uninitialized_relocate_test()
+{
+    test_uninitialized_relocate<int>();
+    test_uninitialized_relocate<owner>();
+    test_uninitialized_relocate<counted>();
+    test_uninitialized_relocate<throwing>();
+
+    PIKA_TEST_EQ(instances.load(), std::ptrdiff_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    uninitialized_relocate_test();
+    uninitialized_relocate_exception_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/uninitialized_transform.hpp>
+#include <pika/parallel/util/default_init_allocator.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+// counts the living instances
+struct counted
+{
+    static std::atomic<std::size_t> instances;
+
+    explicit counted(std::size_t value)
+      : value(std::to_string(value))
+    {
+        ++instances;
+    }
+    counted(counted const& rhs)
+      : value(rhs.value)
+    {
+        ++instances;
+    }
+    ~counted()
+    {
+        --instances;
+    }
+
+    std::string value;
+};
+
+std::atomic<std::size_t> counted::instances(0);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_uninitialized_transform(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    std::allocator<counted> alloc;
+    counted* d = alloc.allocate(size + 1);
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::uninitialized_transform(policy, c.begin(), c.end(), d,
+            [](std::size_t value) { return counted(2 * value); });
+    });
+    PIKA_TEST(result == d + size);
+    PIKA_TEST_EQ(counted::instances.load(), size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i].value, std::to_string(2 * i));
+    }
+    std::destroy(d, d + size);
+
+    result = test::run<ExPolicy>([&] {
+        return pika::uninitialized_transform_n(policy, c.begin(), size, d,
+            [](std::size_t value) { return counted(value + 1); });
+    });
+    PIKA_TEST(result == d + size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i].value, std::to_string(i + 1));
+    }
+    std::destroy(d, d + size);
+    PIKA_TEST_EQ(counted::instances.load(), std::size_t(0));
+
+    // negative counts do nothing
+    result = test::run<ExPolicy>([&] {
+        return pika::uninitialized_transform_n(policy, c.begin(), -1, d,
+            [](std::size_t value) { return counted(value); });
+    });
+    PIKA_TEST(result == d);
+
+    alloc.deallocate(d, size + 1);
+}
+
+template <typename ExPolicy>
+void test_uninitialized_transform_exception(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    std::allocator<counted> alloc;
+    counted* d = alloc.allocate(size);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::uninitialized_transform(policy, c.begin(), c.end(), d,
+                [size](std::size_t value) {
+                    if (value == size / 2)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                    return counted(value);
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+
+    // the elements constructed before the exception have been destroyed
+    PIKA_TEST(caught_exception);
+    PIKA_TEST_EQ(counted::instances.load(), std::size_t(0));
+
+    alloc.deallocate(d, size);
+}
+
+void test_default_init_allocator()
+{
+    using namespace pika::execution;
+
+    // default inserted elements are left uninitialized and can be written
+    // by the algorithm
+    std::size_t const size = 100007;
+    std::vector<double> c(size);
+    std::iota(c.begin(), c.end(), 0.0);
+
+    pika::default_init_vector<double> d;
+    d.resize(size);
+    pika::uninitialized_transform(
+        par, c.begin(), c.end(), d.begin(), [](double x) { return x * x; });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], double(i) * double(i));
+    }
+
+    // other constructions are forwarded
+    pika::default_init_vector<std::string> s(3, std::string("abc"));
+    s.emplace_back(2, 'x');
+    s.resize(5);
+    PIKA_TEST_EQ(s[0], std::string("abc"));
+    PIKA_TEST_EQ(s[3], std::string("xx"));
+    PIKA_TEST(s[4].empty());
+
+    // rebinding keeps the adaptor
+    using rebound = std::allocator_traits<
+        pika::default_init_allocator<int>>::rebind_alloc<double>;
+    static_assert(
+        std::is_same_v<rebound, pika::default_init_allocator<double>>);
+    PIKA_TEST(rebound(pika::default_init_allocator<int>()) ==
+        pika::default_init_allocator<double>());
+}
+
+void uninitialized_transform_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        test_uninitialized_transform(seq, size);
+        test_uninitialized_transform(par, size);
+        test_uninitialized_transform(par_unseq, size);
+        test_uninitialized_transform(seq(task), size);
+        test_uninitialized_transform(par(task), size);
+    }
+
+    for (std::size_t size : {1, 1000, 100007})
+    {
+        test_uninitialized_transform_exception(seq, size);
+        test_uninitialized_transform_exception(par, size);
+        test_uninitialized_transform_exception(seq(task), size);
+        test_uninitialized_transform_exception(par(task), size);
+    }
+
+    // sequential overloads
+    {
+        std::vector<int> c = {1, 2, 3};
+        std::allocator<counted> alloc;
+        counted* d = alloc.allocate(c.size());
+        counted* result = pika::uninitialized_transform(c.begin(), c.end(), d,
+            [](int value) { return counted(std::size_t(value) * 10); });
+        PIKA_TEST(result == d + 3);
+        PIKA_TEST_EQ(d[2].value, std::string("30"));
+        std::destroy(d, result);
+
+        result = pika::uninitialized_transform_n(c.begin(), 2, d,
+            [](int value) { return counted(std::size_t(value)); });
+        PIKA_TEST(result == d + 2);
+        PIKA_TEST_EQ(d[1].value, std::string("2"));
+        std::destroy(d, result);
+        alloc.deallocate(d, c.size());
+    }
+
+    test_default_init_allocator();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    uninitialized_transform_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/unordered_compaction.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+struct element
+{
+    int key;
+    std::string name;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_unordered_copy_if(ExPolicy policy, std::size_t size, int mod)
+{
+    std::vector<int> c(size);
+    std::generate(
+        c.begin(), c.end(), [&]() { return static_cast<int>(gen() % 100000); });
+    auto pred = [mod](int value) { return value % mod == 0; };
+
+    std::vector<int> expected;
+    std::copy_if(c.begin(), c.end(), std::back_inserter(expected), pred);
+
+    std::vector<int> d(size);
+    auto result = test::run<ExPolicy>([&] {
+        return pika::unordered_copy_if(
+            policy, c.begin(), c.end(), d.begin(), pred);
+    });
+    PIKA_TEST(result == d.begin() + expected.size());
+
+    // the same elements, in any order
+    d.erase(result, d.end());
+    std::sort(d.begin(), d.end());
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_unordered_remove_if(ExPolicy policy, std::size_t size, int mod)
+{
+    std::vector<element> c(size);
+    for (element& e : c)
+    {
+        e.key = static_cast<int>(gen() % 100000);
+        e.name = std::to_string(e.key);
+    }
+    auto pred = [mod](int key) { return key % mod == 0; };
+
+    std::vector<int> expected;
+    for (element const& e : c)
+    {
+        if (!pred(e.key))
+        {
+            expected.push_back(e.key);
+        }
+    }
+
+    auto result = test::run<ExPolicy>([&] {
+        return pika::unordered_remove_if(
+            policy, c.begin(), c.end(), pred, &element::key);
+    });
+    PIKA_TEST(result == c.begin() + expected.size());
+
+    // the remaining elements were moved as a whole
+    std::vector<int> keys;
+    for (auto it = c.begin(); it != result; ++it)
+    {
+        PIKA_TEST_EQ(it->name, std::to_string(it->key));
+        keys.push_back(it->key);
+    }
+    std::sort(keys.begin(), keys.end());
+    std::sort(expected.begin(), expected.end());
+    PIKA_TEST(keys == expected);
+}
+
+void unordered_compaction_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 1000, 100007, 1000003})
+    {
+        for (int mod : {1, 2, 7, 1000000})
+        {
+            test_unordered_copy_if(seq, size, mod);
+            test_unordered_copy_if(par, size, mod);
+            test_unordered_copy_if(par_unseq, size, mod);
+            test_unordered_copy_if(seq(task), size, mod);
+            test_unordered_copy_if(par(task), size, mod);
+
+            test_unordered_remove_if(seq, size, mod);
+            test_unordered_remove_if(par, size, mod);
+            test_unordered_remove_if(par_unseq, size, mod);
+            test_unordered_remove_if(seq(task), size, mod);
+            test_unordered_remove_if(par(task), size, mod);
+        }
+    }
+
+    // the sequential overloads keep the order
+    {
+        std::vector<int> c(10007);
+        std::generate(
+            c.begin(), c.end(), [&]() { return static_cast<int>(gen() % 10); });
+
+        std::vector<int> expected;
+        std::copy_if(c.begin(), c.end(), std::back_inserter(expected),
+            [](int value) { return value != 3; });
+
+        std::vector<int> d;
+        pika::unordered_copy_if(c.begin(), c.end(), std::back_inserter(d),
+            [](int value) { return value != 3; });
+        PIKA_TEST(d == expected);
+
+        auto result = pika::unordered_remove(c.begin(), c.end(), 3);
+        PIKA_TEST(std::vector<int>(c.begin(), result) == expected);
+    }
+
+    {
+        std::vector<int> c(100007);
+        std::generate(
+            c.begin(), c.end(), [&]() { return static_cast<int>(gen() % 10); });
+        std::size_t const expected =
+            c.size() - std::size_t(std::count(c.begin(), c.end(), 3));
+
+        auto result = pika::unordered_remove(par, c.begin(), c.end(), 3);
+        PIKA_TEST_EQ(std::size_t(result - c.begin()), expected);
+        PIKA_TEST(std::find(c.begin(), result, 3) == result);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    unordered_compaction_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/adaptive_chunk_size.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chunk_size_from_cost()
+{
+    using pika::parallel::detail::adaptive_chunk_size_from_cost;
+
+    // 10ns per iteration and 1000ns per chunk gives 100 iterations per chunk
+    PIKA_TEST_EQ(adaptive_chunk_size_from_cost(10.0, 1000, 10000),
+        std::size_t(100));
+
+    // chunks are never larger than the number of remaining iterations
+    PIKA_TEST_EQ(
+        adaptive_chunk_size_from_cost(1.0, 1000000, 1000), std::size_t(1000));
+
+    // very expensive iterations result in one iteration per chunk
+    PIKA_TEST_EQ(adaptive_chunk_size_from_cost(1.0e9, 1000, 1000),
+        std::size_t(1));
+
+    // degenerate inputs
+    PIKA_TEST_EQ(
+        adaptive_chunk_size_from_cost(0.0, 1000, 1000), std::size_t(1000));
+    PIKA_TEST_EQ(adaptive_chunk_size_from_cost(10.0, 1000, 0), std::size_t(1));
+}
+
+// the probe of expensive iterations results in small chunks, not in an even
+// distribution of the iterations over the cores
+void test_costly_iterations()
+{
+    using namespace std::chrono_literals;
+
+    pika::execution::adaptive_chunk_size acs(100us, 10);
+
+    std::size_t const count = 10000;
+    std::size_t remaining = count;
+    auto probe = [&](std::size_t n) {
+        // 50 microseconds per iteration
+        auto const end = std::chrono::steady_clock::now() + n * 50us;
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+        remaining -= n;
+        return n;
+    };
+
+    std::size_t const chunk_size = acs.get_chunk_size(
+        pika::execution::parallel_executor(), probe, 4, count);
+    PIKA_TEST_LT(remaining, count);
+    PIKA_TEST_LTE(chunk_size, std::size_t(2));
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    // partition
+    std::uint64_t const sum =
+        pika::reduce(policy, c.begin(), c.end(), std::uint64_t(0));
+    PIKA_TEST_EQ(sum, std::uint64_t(size * (size - 1) / 2));
+
+    // foreach_partitioner
+    std::vector<std::uint64_t> d(size, 0);
+    pika::for_each(policy, d.begin(), d.end(), [](std::uint64_t& v) { ++v; });
+    PIKA_TEST_EQ(std::count(d.begin(), d.end(), std::uint64_t(1)),
+        std::ptrdiff_t(size));
+
+    // partition_with_index
+    pika::for_loop(
+        policy, std::size_t(0), size, [&](std::size_t i) { d[i] = i; });
+    PIKA_TEST(std::equal(c.begin(), c.end(), d.begin()));
+
+    // scan_partitioner
+    std::vector<std::uint64_t> e(size);
+    pika::inclusive_scan(policy, c.begin(), c.end(), e.begin());
+
+    std::vector<std::uint64_t> expected(size);
+    std::partial_sum(c.begin(), c.end(), expected.begin());
+    PIKA_TEST(std::equal(e.begin(), e.end(), expected.begin()));
+}
+
+void test_adaptive_chunk_size()
+{
+    using namespace std::chrono_literals;
+
+    pika::execution::adaptive_chunk_size acs;
+    test_algorithms(pika::execution::par.with(acs));
+
+    pika::execution::adaptive_chunk_size acs_short(1us);
+    test_algorithms(pika::execution::par.with(acs_short));
+
+    pika::execution::adaptive_chunk_size acs_probe(10ms, 1000);
+    test_algorithms(pika::execution::par.with(acs_probe));
+}
+
+int pika_main()
+{
+    test_chunk_size_from_cost();
+    test_costly_iterations();
+    test_adaptive_chunk_size();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/affinity_partitioner.hpp>
+#include <pika/testing.hpp>
+#include <pika/thread.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_recorded_workers(pika::execution::affinity_partitioner const& ap,
+    std::size_t num_chunks)
+{
+    std::size_t const num_threads = pika::get_os_thread_count();
+    for (std::size_t i = 0; i != num_chunks; ++i)
+    {
+        PIKA_TEST_LT(ap.get_chunk_worker(i, num_threads), num_threads);
+    }
+    PIKA_TEST_EQ(ap.get_chunk_worker(num_chunks, num_threads),
+        pika::execution::affinity_partitioner::no_worker);
+}
+
+template <typename ExPolicy>
+void test_sweeps(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> a(size, 1.0);
+
+    // repeated sweeps over the same data, as in a time stepping loop
+    for (int step = 0; step != 10; ++step)
+    {
+        pika::for_each(policy, a.begin(), a.end(), [](double& v) { v *= 2; });
+        double const norm = pika::transform_reduce(policy, a.begin(),
+            a.end(), 0.0, std::plus<>(), [](double v) { return v; });
+        PIKA_TEST_EQ(norm, double(size) * double(1 << (step + 1)));
+    }
+}
+
+void test_affinity_partitioner()
+{
+    using namespace pika::execution;
+
+    std::size_t const num_threads = pika::get_os_thread_count();
+    std::size_t const size = 10000;
+
+    // all copies share the recorded placement
+    affinity_partitioner ap;
+    test_sweeps(par.with(ap), size);
+    test_recorded_workers(ap, 4 * num_threads);
+
+    // a different number of iterations discards the recorded placement
+    test_sweeps(par.with(ap), size / 10);
+    test_recorded_workers(ap, 4 * num_threads);
+
+    affinity_partitioner ap1(1);
+    test_sweeps(par.with(ap1), size);
+    test_recorded_workers(ap1, num_threads);
+
+    // asynchronous policies record the placement as well
+    affinity_partitioner ap_task;
+    std::vector<int> c(size, 1);
+    auto f = pika::reduce(par(task).with(ap_task), c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(f.get(), int(size));
+    test_recorded_workers(ap_task, 4 * num_threads);
+
+    // exceptions are reported as usual
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(par.with(ap), c.begin(), c.end(),
+            [](int) { throw std::runtime_error("test"); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    PIKA_TEST(caught_exception);
+}
+
+int pika_main()
+{
+    test_affinity_partitioner();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
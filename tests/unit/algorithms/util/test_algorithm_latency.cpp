@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/algorithm_latency.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using pika::parallel::util::algorithm_latency;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<algorithm_latency> get_latencies(std::string const& name)
+{
+    std::vector<algorithm_latency> latencies;
+    for (auto& l : pika::parallel::util::get_algorithm_latencies())
+    {
+        if (l.name == name)
+            latencies.push_back(l);
+    }
+    return latencies;
+}
+
+void test_buckets()
+{
+    for (std::uint64_t ns : {std::uint64_t(0), std::uint64_t(15),
+             std::uint64_t(16), std::uint64_t(17), std::uint64_t(1000),
+             std::uint64_t(123456789), ~std::uint64_t(0)})
+    {
+        std::size_t const b = algorithm_latency::bucket(ns);
+        PIKA_TEST(b < algorithm_latency::num_buckets);
+        PIKA_TEST(algorithm_latency::bucket_min_ns(b) <= ns);
+        if (b + 1 != algorithm_latency::num_buckets)
+        {
+            PIKA_TEST(algorithm_latency::bucket_min_ns(b + 1) > ns);
+        }
+    }
+}
+
+void test_algorithm_latency()
+{
+    using namespace pika::execution;
+    using namespace pika::parallel::util;
+
+    std::vector<int> c(1000);
+    std::iota(c.rbegin(), c.rend(), 0);
+
+    clear_algorithm_latencies();
+    enable_algorithm_latency();
+    PIKA_TEST(algorithm_latency_enabled());
+
+    pika::sort(par, c.begin(), c.end());
+    pika::sort(seq, c.begin(), c.end());
+    pika::reduce(par, c.begin(), c.begin() + 10);
+
+    // the calls are grouped by algorithm and input size
+    auto const sorts = get_latencies("sort");
+    PIKA_TEST_EQ(sorts.size(), std::size_t(1));
+    PIKA_TEST_EQ(sorts[0].calls, std::uint64_t(2));
+    PIKA_TEST_EQ(sorts[0].min_size, std::size_t(512));
+    PIKA_TEST_EQ(sorts[0].max_size, std::size_t(1023));
+    PIKA_TEST(sorts[0].percentile(0.5) <= sorts[0].percentile(0.99));
+
+    auto const reduces = get_latencies("reduce");
+    PIKA_TEST_EQ(reduces.size(), std::size_t(1));
+    PIKA_TEST_EQ(reduces[0].calls, std::uint64_t(1));
+    PIKA_TEST_EQ(reduces[0].min_size, std::size_t(8));
+
+    std::ostringstream out;
+    write_algorithm_latencies(out);
+    PIKA_TEST(out.str().find("\"name\":\"sort\"") != std::string::npos);
+
+    // asynchronous calls are not recorded
+    clear_algorithm_latencies();
+    pika::reduce(par(task), c.begin(), c.end()).get();
+    PIKA_TEST(get_latencies("reduce").empty());
+
+    enable_algorithm_latency(false);
+    pika::reduce(par, c.begin(), c.end());
+    PIKA_TEST(get_latencies("reduce").empty());
+}
+
+int pika_main()
+{
+    test_buckets();
+    test_algorithm_latency();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
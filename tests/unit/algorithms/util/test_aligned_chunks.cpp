@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+#include <pika/parallel/util/aligned_chunks.hpp>
+#include <pika/parallel/util/detail/chunk_size.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Returns the offsets of the chunks of the shape of the given iterator,
+// starting with the head run right away (if any)
+template <typename ExPolicy, typename FwdIter>
+std::vector<std::size_t> get_chunk_offsets(
+    ExPolicy&& policy, FwdIter first, std::size_t count)
+{
+    std::vector<std::size_t> offsets;
+    std::size_t head = 0;
+
+    std::vector<pika::future<void>> workitems;
+    auto f1 = [&](FwdIter, std::size_t size) { head += size; };
+
+    FwdIter begin = first;
+    std::size_t remaining = count;
+    auto shape = pika::parallel::detail::get_bulk_iteration_shape(
+        std::false_type{}, policy, workitems, f1, begin, remaining, 1);
+
+    if (head != 0)
+    {
+        offsets.push_back(0);
+    }
+
+    std::size_t total = head;
+    for (auto const& chunk : shape)
+    {
+        offsets.push_back(total);
+        total += std::get<1>(chunk);
+    }
+    PIKA_TEST_EQ(total, count);
+    return offsets;
+}
+
+template <typename T>
+std::size_t get_misalignment(T const* p, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment;
+}
+
+void test_chunk_boundaries()
+{
+    using namespace pika::execution;
+
+    std::vector<float> c(100007);
+    for (std::size_t offset : {0, 1, 3, 15})
+    {
+        float* first = c.data() + offset;
+        std::size_t const count = c.size() - offset;
+
+        // all boundaries but the first are aligned to the cache lines
+        auto offsets = get_chunk_offsets(par.with(aligned_chunks()), first,
+            count);
+        PIKA_TEST_LT(std::size_t(1), offsets.size());
+        for (std::size_t i = 1; i != offsets.size(); ++i)
+        {
+            PIKA_TEST_EQ(get_misalignment(first + offsets[i],
+                             pika::concurrency::detail::get_cache_line_size()),
+                std::size_t(0));
+        }
+
+        // the destination of a zip_iterator is its last range
+        std::vector<int> d(c.size());
+        auto zip_first = pika::util::make_zip_iterator(d.begin() + 2, first);
+        offsets = get_chunk_offsets(par.with(aligned_chunks(32)), zip_first,
+            count);
+        for (std::size_t i = 1; i != offsets.size(); ++i)
+        {
+            PIKA_TEST_EQ(get_misalignment(first + offsets[i], 32),
+                std::size_t(0));
+        }
+    }
+
+    // elements larger than the alignment are partitioned as usual
+    struct large
+    {
+        char data[128];
+    };
+    std::vector<large> l(1000);
+    PIKA_TEST(get_chunk_offsets(par.with(aligned_chunks(64)), l.data(),
+                  l.size()) == get_chunk_offsets(par, l.data(), l.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_algorithms()
+{
+    using namespace pika::execution;
+
+    std::vector<char> c(100007);
+    std::iota(c.begin(), c.end(), char(0));
+
+    for (std::size_t offset : {0, 1, 7})
+    {
+        std::vector<char> d(c.size(), 0);
+        pika::transform(par.with(aligned_chunks()), c.begin(), c.end() - offset,
+            d.begin() + offset, [](char v) { return char(v + 1); });
+        for (std::size_t i = 0; i != c.size() - offset; ++i)
+        {
+            PIKA_TEST_EQ(d[i + offset], char(c[i] + 1));
+        }
+
+        pika::fill(par.with(aligned_chunks(16)), d.begin() + offset, d.end(),
+            char(42));
+        for (std::size_t i = offset; i != d.size(); ++i)
+        {
+            PIKA_TEST_EQ(d[i], char(42));
+        }
+
+        pika::for_each(par.with(aligned_chunks()), d.begin() + offset,
+            d.end(), [](char& v) { ++v; });
+        for (std::size_t i = offset; i != d.size(); ++i)
+        {
+            PIKA_TEST_EQ(d[i], char(43));
+        }
+    }
+}
+
+int pika_main()
+{
+    test_chunk_boundaries();
+    test_algorithms();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
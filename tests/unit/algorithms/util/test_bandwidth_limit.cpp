@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/bandwidth_limit.hpp>
+#include <pika/parallel/util/calibrate_tunables.hpp>
+#include <pika/parallel/util/tunables.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using pika::parallel::util::set_tunable;
+using pika::parallel::util::tunable;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chunk_sizes()
+{
+    auto const exec = pika::execution::par.executor();
+    auto test_function = [](std::size_t) { return 0; };
+
+    pika::execution::bandwidth_limit bl(2);
+    PIKA_TEST_EQ(bl.get_cores(8), std::size_t(2));
+    PIKA_TEST_EQ(bl.get_cores(1), std::size_t(1));
+    PIKA_TEST_EQ(bl.maximal_number_of_chunks(exec, 2, 1000), std::size_t(2));
+    PIKA_TEST_EQ(
+        bl.get_chunk_size(exec, test_function, 2, 1001), std::size_t(501));
+    PIKA_TEST_EQ(bl.get_chunk_size(exec, test_function, 2, 0), std::size_t(1));
+
+    // as long as it is not calibrated all cores are used
+    pika::execution::bandwidth_limit const calibrated;
+    PIKA_TEST_EQ(calibrated.get_cores(8), std::size_t(8));
+
+    set_tunable(tunable::bandwidth_bound_cores, 3);
+    PIKA_TEST_EQ(calibrated.get_cores(8), std::size_t(3));
+    PIKA_TEST_EQ(bl.get_cores(8), std::size_t(2));
+    pika::parallel::util::reset_tunables();
+}
+
+// the number of distinct threads running the elements of a transform
+template <typename ExPolicy>
+std::size_t count_transform_threads(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+    std::vector<std::uint64_t> d(size);
+
+    std::mutex mtx;
+    std::set<std::thread::id> threads;
+    pika::transform(
+        policy, c.begin(), c.end(), d.begin(), [&](std::uint64_t v) {
+            std::lock_guard<std::mutex> l(mtx);
+            threads.insert(std::this_thread::get_id());
+            return v + 1;
+        });
+
+    PIKA_TEST(std::equal(c.begin(), c.end(), d.begin(),
+        [](std::uint64_t v, std::uint64_t w) { return w == v + 1; }));
+    return threads.size();
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    // the bandwidth bound algorithms
+    std::vector<std::uint64_t> d(size);
+    pika::copy(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST(c == d);
+
+    pika::fill(policy, d.begin(), d.end(), std::uint64_t(42));
+    PIKA_TEST(std::all_of(d.begin(), d.end(),
+        [](std::uint64_t v) { return v == 42; }));
+
+    pika::fill_n(policy, d.begin(), size / 2, std::uint64_t(0));
+    PIKA_TEST_EQ(std::size_t(std::count(d.begin(), d.end(), 0)), size / 2);
+
+    pika::move(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST(c == d);
+
+    // the other algorithms use the default parameters
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_each(policy, c.begin(), c.end(),
+        [&](std::uint64_t v) { ++visited[v]; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& v) { return v.load() == 1; }));
+
+    std::uint64_t const sum =
+        pika::reduce(policy, c.begin(), c.end(), std::uint64_t(0));
+    PIKA_TEST_EQ(sum, std::uint64_t(size * (size - 1) / 2));
+}
+
+void test_bandwidth_limit()
+{
+    using namespace pika::execution;
+
+    test_chunk_sizes();
+
+    test_algorithms(par.with(bandwidth_limit()));
+    test_algorithms(par.with(bandwidth_limit(2)));
+    test_algorithms(par_unseq.with(bandwidth_limit(1)));
+
+    PIKA_TEST_LTE(count_transform_threads(par.with(bandwidth_limit(2))),
+        std::size_t(2));
+
+    // the calibrated number of cores is used by default
+    set_tunable(tunable::bandwidth_bound_cores, 1);
+    PIKA_TEST_EQ(
+        count_transform_threads(par.with(bandwidth_limit())), std::size_t(1));
+    pika::parallel::util::reset_tunables();
+
+    std::vector<int> c(10007, 1);
+    std::vector<int> d(c.size());
+    auto f = pika::copy(
+        par(task).with(bandwidth_limit(2)), c.begin(), c.end(), d.begin());
+    f.get();
+    PIKA_TEST(c == d);
+
+    // the calibration picks a number of cores and stores it
+    pika::parallel::util::bandwidth_calibration_options options;
+    options.size = 1 << 16;
+    options.repetitions = 1;
+    std::size_t const cores =
+        pika::parallel::util::calibrate_bandwidth_limit(options);
+    PIKA_TEST_LTE(std::size_t(1), cores);
+    PIKA_TEST_LTE(cores,
+        pika::parallel::execution::processing_units_count(
+            par.parameters(), par.executor()));
+    PIKA_TEST_EQ(pika::parallel::util::get_tunable(
+                     tunable::bandwidth_bound_cores),
+        cores);
+    pika::parallel::util::reset_tunables();
+}
+
+int pika_main()
+{
+    test_bandwidth_limit();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_early_exit(ExPolicy&& policy)
+{
+    std::size_t const size = 1000007;
+
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    // the element is found in the first chunk, the remaining chunks are
+    // either skipped or return immediately
+    std::atomic<std::size_t> num_invocations(0);
+    auto it = pika::find_if(policy, c.begin(), c.end(), [&](std::size_t v) {
+        ++num_invocations;
+        return v == 10;
+    });
+    PIKA_TEST(it == c.begin() + 10);
+    PIKA_TEST_LT(num_invocations.load(), size / 2);
+
+    // the first of multiple matches is found wherever it is
+    for (std::size_t pos : {std::size_t(0), size / 3, size - 1})
+    {
+        PIKA_TEST(pika::find(policy, c.begin(), c.end(), pos) ==
+            c.begin() + pos);
+        PIKA_TEST(pika::find_if_not(policy, c.begin(), c.end(),
+                      [&](std::size_t v) { return v < pos; }) ==
+            c.begin() + pos);
+    }
+    PIKA_TEST(pika::find(policy, c.begin(), c.end(), size) == c.end());
+
+    PIKA_TEST(pika::any_of(
+        policy, c.begin(), c.end(), [](std::size_t v) { return v == 10; }));
+    PIKA_TEST(!pika::all_of(
+        policy, c.begin(), c.end(), [](std::size_t v) { return v != 10; }));
+    PIKA_TEST(!pika::none_of(
+        policy, c.begin(), c.end(), [](std::size_t v) { return v == 10; }));
+    PIKA_TEST(pika::all_of(
+        policy, c.begin(), c.end(), [](std::size_t v) { return v < size; }));
+
+    std::vector<std::size_t> d = c;
+    PIKA_TEST(pika::equal(policy, c.begin(), c.end(), d.begin()));
+    d[size / 2] = 0;
+    PIKA_TEST(!pika::equal(policy, c.begin(), c.end(), d.begin()));
+
+    auto mm = pika::mismatch(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST(mm.first == c.begin() + size / 2);
+    PIKA_TEST(mm.second == d.begin() + size / 2);
+}
+
+template <typename ExPolicy>
+void test_exceptions(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 0);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::find_if(policy, c.begin(), c.end(),
+            [](int) -> bool { throw std::runtime_error("test"); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+void test_cancellable_partition()
+{
+    using namespace pika::execution;
+
+    test_early_exit(par);
+    test_early_exit(par.with(static_chunk_size(100)));
+    test_early_exit(par_unseq);
+    test_exceptions(par);
+    test_exceptions(par.with(static_chunk_size(100)));
+}
+
+int pika_main()
+{
+    test_cancellable_partition();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
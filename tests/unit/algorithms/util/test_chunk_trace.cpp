@@ -0,0 +1,121 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace util = pika::parallel::util;
+
+///////////////////////////////////////////////////////////////////////////////
+// Returns the number of iterations recorded for chunks of the given kind
+std::size_t traced_count(char const* name)
+{
+    std::size_t count = 0;
+    for (auto const& e : util::get_chunk_trace())
+    {
+        if (std::strcmp(e.name, name) == 0)
+        {
+            PIKA_TEST(e.start <= e.end);
+            count += e.count;
+        }
+    }
+    return count;
+}
+
+template <typename ExPolicy>
+void test_chunk_trace(ExPolicy&& policy, bool single_pass_scan)
+{
+    std::size_t const size = 10007;
+
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), 0);
+
+    util::clear_chunk_trace();
+    util::enable_chunk_tracing();
+
+    // every element is visited by exactly one of the recorded chunks
+    pika::for_each(policy, c.begin(), c.end(), [](int) {});
+    PIKA_TEST_EQ(traced_count("foreach"), size);
+
+    util::clear_chunk_trace();
+    PIKA_TEST(util::get_chunk_trace().empty());
+
+    auto sum = pika::reduce(policy, c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(sum, int(size * (size - 1) / 2));
+    PIKA_TEST_EQ(traced_count("partition"), size);
+
+    util::clear_chunk_trace();
+
+    std::vector<int> d(size);
+    pika::inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST_EQ(d.back(), sum);
+    if (single_pass_scan)
+    {
+        // every element is scanned by exactly one chunk, the chunks which
+        // did not know their prefix right away are fixed up afterwards
+        PIKA_TEST_EQ(
+            traced_count("scan_single_pass") + traced_count("scan_local"),
+            size);
+        PIKA_TEST_EQ(traced_count("scan_fixup"), traced_count("scan_local"));
+    }
+    else
+    {
+        PIKA_TEST_EQ(traced_count("scan_f1"), size);
+        PIKA_TEST_EQ(traced_count("scan_f3"), size);
+    }
+
+    std::ostringstream os;
+    util::write_chunk_trace(os);
+    std::string const trace = os.str();
+    PIKA_TEST(trace.find("\"traceEvents\"") != std::string::npos);
+    PIKA_TEST(trace.find(single_pass_scan ? "\"scan_single_pass\"" :
+                                            "\"scan_f1\"") !=
+        std::string::npos);
+
+    // nothing is recorded while tracing is disabled
+    util::enable_chunk_tracing(false);
+    util::clear_chunk_trace();
+
+    pika::for_each(policy, c.begin(), c.end(), [](int) {});
+    PIKA_TEST(util::get_chunk_trace().empty());
+}
+
+int pika_main()
+{
+    // explicitly given chunk sizes are honored by the three pass scan
+    test_chunk_trace(pika::execution::par, true);
+    test_chunk_trace(pika::execution::par.with(
+                         pika::execution::static_chunk_size(100)),
+        false);
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
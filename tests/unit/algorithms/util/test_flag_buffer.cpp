@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// The stream compaction algorithms keep one bit per element in words of 64
+// bits, the words at the ends of a chunk are shared with the neighbouring
+// chunks unless the chunk sizes are multiples of 64.
+template <typename ExPolicy>
+void test_flag_buffer(ExPolicy&& policy, std::size_t size)
+{
+    // short runs of equal values for unique
+    std::vector<int> c(size);
+    std::uniform_int_distribution<int> dis(0, 3);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    auto pred = [](int v) { return v % 2 == 0; };
+
+    {
+        std::vector<int> d(size);
+        auto r = test::run<ExPolicy>([&] {
+            return pika::copy_if(policy, c.begin(), c.end(), d.begin(), pred);
+        });
+        std::vector<int> expected(size);
+        auto e = std::copy_if(c.begin(), c.end(), expected.begin(), pred);
+        PIKA_TEST(std::equal(d.begin(), r, expected.begin(), e));
+    }
+
+    {
+        std::vector<int> d = c;
+        auto r = test::run<ExPolicy>(
+            [&] { return pika::remove_if(policy, d.begin(), d.end(), pred); });
+        std::vector<int> expected = c;
+        auto e = std::remove_if(expected.begin(), expected.end(), pred);
+        PIKA_TEST(std::equal(d.begin(), r, expected.begin(), e));
+    }
+
+    {
+        std::vector<int> d = c;
+        auto r = test::run<ExPolicy>(
+            [&] { return pika::unique(policy, d.begin(), d.end()); });
+        std::vector<int> expected = c;
+        auto e = std::unique(expected.begin(), expected.end());
+        PIKA_TEST(std::equal(d.begin(), r, expected.begin(), e));
+    }
+
+    {
+        std::vector<int> d(size);
+        auto r = test::run<ExPolicy>([&] {
+            return pika::unique_copy(policy, c.begin(), c.end(), d.begin());
+        });
+        std::vector<int> expected(size);
+        auto e = std::unique_copy(c.begin(), c.end(), expected.begin());
+        PIKA_TEST(std::equal(d.begin(), r, expected.begin(), e));
+    }
+
+    {
+        std::vector<int> d_true(size);
+        std::vector<int> d_false(size);
+        auto r = test::run<ExPolicy>([&] {
+            return pika::partition_copy(policy, c.begin(), c.end(),
+                d_true.begin(), d_false.begin(), pred);
+        });
+        std::vector<int> expected_true(size);
+        std::vector<int> expected_false(size);
+        auto e = std::partition_copy(c.begin(), c.end(),
+            expected_true.begin(), expected_false.begin(), pred);
+        PIKA_TEST(std::equal(
+            d_true.begin(), r.first, expected_true.begin(), e.first));
+        PIKA_TEST(std::equal(
+            d_false.begin(), r.second, expected_false.begin(), e.second));
+    }
+}
+
+template <typename ExPolicy>
+void test_flag_buffer(ExPolicy&& policy)
+{
+    // the inputs shorter than flag_buffer_sequential_limit are compacted
+    // sequentially
+    for (std::size_t size : {4095, 4096, 4097, 4159, 10007})
+    {
+        test_flag_buffer(policy, size);
+    }
+}
+
+void test_flag_buffer()
+{
+    using namespace pika::execution;
+
+    test_flag_buffer(par);
+    test_flag_buffer(par(task));
+    for (std::size_t chunk_size : {1, 3, 63, 65, 1000})
+    {
+        test_flag_buffer(par.with(static_chunk_size(chunk_size)));
+        test_flag_buffer(par(task).with(static_chunk_size(chunk_size)));
+    }
+}
+
+int pika_main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_flag_buffer();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
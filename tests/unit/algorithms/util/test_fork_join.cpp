@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/execution.hpp>
+#include <pika/parallel/util/detail/fork_join.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+std::size_t fibonacci(ExPolicy& policy, std::size_t n)
+{
+    if (n < 2)
+    {
+        return n;
+    }
+
+    std::size_t left = 0;
+    std::size_t right = 0;
+    pika::parallel::detail::fork_join(
+        policy, [&]() { left = fibonacci(policy, n - 1); },
+        [&]() { right = fibonacci(policy, n - 2); });
+    return left + right;
+}
+
+void test_fork_join()
+{
+    auto policy = pika::execution::par;
+    PIKA_TEST_EQ(fibonacci(policy, 20), std::size_t(6765));
+
+    // both branches run exactly once
+    std::atomic<int> spawned(0);
+    std::atomic<int> inlined(0);
+    for (int i = 0; i != 1000; ++i)
+    {
+        pika::parallel::detail::fork_join(
+            policy, [&]() { ++spawned; }, [&]() { ++inlined; });
+    }
+    PIKA_TEST_EQ(spawned.load(), 1000);
+    PIKA_TEST_EQ(inlined.load(), 1000);
+}
+
+void test_fork_join_exceptions()
+{
+    auto policy = pika::execution::par;
+
+    for (int throwing : {1, 2, 3})
+    {
+        bool spawned_run = false;
+        bool inline_run = false;
+        bool caught_exception = false;
+        try
+        {
+            pika::parallel::detail::fork_join(
+                policy,
+                [&]() {
+                    spawned_run = true;
+                    if (throwing & 1)
+                        throw std::runtime_error("spawned");
+                },
+                [&]() {
+                    inline_run = true;
+                    if (throwing & 2)
+                        throw std::runtime_error("inline");
+                });
+            PIKA_TEST(false);
+        }
+        catch (pika::exception_list const& e)
+        {
+            caught_exception = true;
+            PIKA_TEST_EQ(e.size(), std::size_t(throwing == 3 ? 2 : 1));
+        }
+        catch (...)
+        {
+            PIKA_TEST(false);
+        }
+
+        // the other branch has finished nevertheless
+        PIKA_TEST(caught_exception);
+        PIKA_TEST(spawned_run);
+        PIKA_TEST(inline_run);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    test_fork_join();
+    test_fork_join_exceptions();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
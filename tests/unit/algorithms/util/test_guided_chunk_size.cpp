@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/guided_chunk_size.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chunk_sizes()
+{
+    pika::execution::guided_chunk_size gcs(10);
+    auto const exec = pika::execution::par.executor();
+    auto test_function = [](std::size_t) { return 0; };
+
+    // the chunk sizes decrease with the remaining number of iterations
+    std::size_t remaining = 10000;
+    std::size_t previous = remaining;
+    std::vector<std::size_t> chunk_sizes;
+    while (remaining != 0)
+    {
+        std::size_t const chunk_size =
+            gcs.get_chunk_size(exec, test_function, 4, remaining);
+        PIKA_TEST_LTE(chunk_size, previous);
+        PIKA_TEST_LTE(std::size_t(10), chunk_size);
+
+        chunk_sizes.push_back(chunk_size);
+        previous = chunk_size;
+        remaining -= (std::min)(chunk_size, remaining);
+    }
+    PIKA_TEST_EQ(chunk_sizes.front(), std::size_t(2500));
+    PIKA_TEST_EQ(chunk_sizes.back(), std::size_t(10));
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_each(policy, c.begin(), c.end(),
+        [&](std::uint64_t v) { ++visited[v]; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& v) { return v.load() == 1; }));
+
+    std::uint64_t const sum =
+        pika::reduce(policy, c.begin(), c.end(), std::uint64_t(0));
+    PIKA_TEST_EQ(sum, std::uint64_t(size * (size - 1) / 2));
+
+    std::vector<std::uint64_t> d(size);
+    pika::inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    PIKA_TEST_EQ(d.back(), sum);
+
+    auto it = pika::find(policy, c.begin(), c.end(), std::uint64_t(size / 2));
+    PIKA_TEST(it == c.begin() + size / 2);
+}
+
+void test_guided_chunk_size()
+{
+    using namespace pika::execution;
+
+    test_chunk_sizes();
+
+    test_algorithms(par.with(guided_chunk_size()));
+    test_algorithms(par.with(guided_chunk_size(100)));
+
+    std::vector<int> c(10007, 1);
+    auto f = pika::reduce(
+        par(task).with(guided_chunk_size()), c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(f.get(), 10007);
+}
+
+int pika_main()
+{
+    test_guided_chunk_size();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
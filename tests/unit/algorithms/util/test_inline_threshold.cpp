@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/inline_threshold.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_inline_threshold(ExPolicy&& policy, std::size_t size, bool inlined)
+{
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), 0);
+
+    // all elements are visited by the calling thread if the algorithm runs
+    // inline
+    auto const id = pika::this_thread::get_id();
+    std::atomic<std::size_t> visited(0);
+    std::atomic<std::size_t> elsewhere(0);
+    test::run<ExPolicy>([&] {
+        return pika::for_each(policy, c.begin(), c.end(), [&](int) {
+            ++visited;
+            if (pika::this_thread::get_id() != id)
+                ++elsewhere;
+        });
+    });
+    PIKA_TEST_EQ(visited.load(), size);
+    if (inlined)
+    {
+        PIKA_TEST_EQ(elsewhere.load(), std::size_t(0));
+    }
+
+    int const sum = test::run<ExPolicy>(
+        [&] { return pika::reduce(policy, c.begin(), c.end()); });
+    PIKA_TEST_EQ(sum, std::accumulate(c.begin(), c.end(), 0));
+
+    std::vector<int> d(size);
+    test::run<ExPolicy>(
+        [&] { return pika::copy(policy, c.begin(), c.end(), d.begin()); });
+    PIKA_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_inline_threshold_exception(ExPolicy&& policy)
+{
+    std::vector<int> c(10, 0);
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::for_each(policy, c.begin(), c.end(),
+                [](int) { throw std::runtime_error("test"); });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST_EQ(e.size(), std::size_t(1));
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+// the whole input counts against the threshold
+void test_inline_count()
+{
+    using iterator = std::vector<int>::iterator;
+    using pika::parallel::detail::in_in_out_result;
+    using pika::parallel::detail::in_out_result;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(3);
+    std::vector<int> e(c.size() + d.size());
+
+    using rotate = pika::parallel::detail::rotate<
+        in_out_result<iterator, iterator>>;
+    PIKA_TEST_EQ(rotate::get_inline_count(c.begin(), c.begin() + 1, c.end()),
+        c.size());
+
+    using merge = pika::parallel::detail::merge<
+        in_in_out_result<iterator, iterator, iterator>>;
+    PIKA_TEST_EQ(merge::get_inline_count(
+                     d.begin(), d.end(), c.begin(), c.end(), e.begin()),
+        e.size());
+}
+
+void test_inline_threshold()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 100})
+    {
+        test_inline_threshold(par.with(inline_threshold(100)), size, true);
+        test_inline_threshold(
+            par_unseq.with(inline_threshold(100)), size, true);
+        test_inline_threshold(
+            par(task).with(inline_threshold(100)), size, true);
+    }
+
+    // above the threshold the algorithms run in parallel
+    test_inline_threshold(par.with(inline_threshold(100)), 10007, false);
+    test_inline_threshold(par(task).with(inline_threshold(100)), 10007, false);
+
+    test_inline_threshold_exception(par.with(inline_threshold(100)));
+    test_inline_threshold_exception(par(task).with(inline_threshold(100)));
+}
+
+int pika_main()
+{
+    test_inline_count();
+    test_inline_threshold();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
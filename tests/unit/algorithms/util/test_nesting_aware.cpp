@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/nesting_aware.hpp>
+#include <pika/testing.hpp>
+#include <pika/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using pika::parallel::util::nesting_depth;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_nesting_depth()
+{
+    using namespace pika::execution;
+
+    PIKA_TEST_EQ(nesting_depth(), std::size_t(0));
+
+    std::vector<int> c(10007);
+    std::iota(c.begin(), c.end(), 0);
+
+    // the chunks of an algorithm are one level deeper than its caller
+    std::atomic<bool> nested_once(true);
+    std::atomic<bool> nested_twice(true);
+    pika::for_each(par, c.begin(), c.begin() + 16, [&](int) {
+        if (nesting_depth() != 1)
+            nested_once = false;
+
+        pika::for_each(par, c.begin(), c.begin() + 16, [&](int) {
+            if (nesting_depth() != 2)
+                nested_twice = false;
+        });
+
+        // the depth is restored after waiting for the nested algorithm
+        if (nesting_depth() != 1)
+            nested_once = false;
+    });
+    PIKA_TEST(nested_once);
+    PIKA_TEST(nested_twice);
+
+    PIKA_TEST_EQ(nesting_depth(), std::size_t(0));
+
+    // tasks launched by other means do not inherit the depth
+    std::atomic<bool> outside(true);
+    pika::for_each(par, c.begin(), c.begin() + 16, [&](int) {
+        pika::parallel::execution::async_execute(par.executor(), [&] {
+            if (nesting_depth() != 0)
+                outside = false;
+        }).get();
+    });
+    PIKA_TEST(outside);
+}
+
+template <typename ExPolicy>
+void test_nested_algorithms(ExPolicy&& policy, std::size_t nested_cores)
+{
+    std::size_t const cores =
+        pika::parallel::execution::processing_units_count(
+            pika::execution::par.parameters(),
+            pika::execution::par.executor());
+
+    // outside of any algorithm all cores are used
+    PIKA_TEST_EQ(
+        policy.parameters().processing_units_count(policy.executor()), cores);
+    PIKA_TEST(!policy.parameters().run_inline());
+
+    std::size_t const size = 1007;
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    std::vector<std::uint64_t> sums(64);
+    std::atomic<bool> capped(true);
+    std::atomic<bool> inlined(true);
+    pika::for_loop(policy, std::size_t(0), sums.size(), [&](std::size_t i) {
+        if (policy.parameters().processing_units_count(policy.executor()) !=
+            (std::min)(nested_cores, cores))
+        {
+            capped = false;
+        }
+
+        // the nested algorithm is run by the calling task if it is inline
+        auto const id = pika::this_thread::get_id();
+        sums[i] = pika::transform_reduce(policy, c.begin(), c.end(),
+            std::uint64_t(0), std::plus<>(), [&](std::uint64_t v) {
+                if (pika::this_thread::get_id() != id)
+                    inlined = false;
+                return v * i;
+            });
+    });
+
+    PIKA_TEST(capped);
+    PIKA_TEST(nested_cores != 1 || inlined);
+    for (std::size_t i = 0; i != sums.size(); ++i)
+    {
+        PIKA_TEST_EQ(sums[i], std::uint64_t(i * size * (size - 1) / 2));
+    }
+}
+
+void test_nesting_aware()
+{
+    using namespace pika::execution;
+
+    test_nesting_depth();
+
+    test_nested_algorithms(par.with(nesting_aware()), 1);
+    test_nested_algorithms(par.with(nesting_aware(0)), 1);
+    test_nested_algorithms(par.with(nesting_aware(2)), 2);
+    test_nested_algorithms(par_unseq.with(nesting_aware()), 1);
+
+    // exceptions thrown by inline nested algorithms are reported as for
+    // the parallel execution
+    std::vector<int> c(100, 0);
+    bool caught = false;
+    try
+    {
+        pika::for_each(par.with(nesting_aware()), c.begin(), c.begin() + 1,
+            [&](int) {
+                pika::for_each(par.with(nesting_aware()), c.begin(), c.end(),
+                    [](int) { throw std::runtime_error("test"); });
+            });
+    }
+    catch (pika::exception_list const&)
+    {
+        caught = true;
+    }
+    PIKA_TEST(caught);
+}
+
+int pika_main()
+{
+    test_nesting_aware();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
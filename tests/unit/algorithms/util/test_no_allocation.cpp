@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/algorithms/reduce_by_key.hpp>
+#include <pika/parallel/util/no_allocation.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// counts the allocations made by the current thread while it is armed
+thread_local bool allocations_armed = false;
+thread_local std::size_t allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    if (allocations_armed)
+    {
+        ++allocations;
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// runs f and checks that it did not allocate any memory
+template <typename F>
+void check_no_allocation(F&& f)
+{
+    allocations = 0;
+    allocations_armed = true;
+    f();
+    allocations_armed = false;
+    PIKA_TEST_EQ(allocations, std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_no_allocation(ExPolicy const& policy, std::size_t size)
+{
+    // long runs of equal values, half of them odd
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = int(i / 7);
+    }
+    auto const is_odd = [](int v) { return v % 2 != 0; };
+
+    std::vector<int> d = c;
+    std::vector<int> e(size);
+    std::vector<int> f(size);
+    std::vector<int> expected(size);
+
+    // unique, unique_copy
+    auto const unique_end =
+        std::unique_copy(c.begin(), c.end(), expected.begin());
+    std::vector<int>::iterator result;
+    check_no_allocation(
+        [&] { result = pika::unique(policy, d.begin(), d.end()); });
+    PIKA_TEST(std::equal(d.begin(), result, expected.begin(), unique_end));
+
+    check_no_allocation([&] {
+        result = pika::unique_copy(policy, c.begin(), c.end(), e.begin());
+    });
+    PIKA_TEST(std::equal(e.begin(), result, expected.begin(), unique_end));
+
+    // copy_if, remove_if, partition_copy, partition
+    auto const odd_end =
+        std::copy_if(c.begin(), c.end(), expected.begin(), is_odd);
+    check_no_allocation([&] {
+        result = pika::copy_if(policy, c.begin(), c.end(), e.begin(), is_odd);
+    });
+    PIKA_TEST(std::equal(e.begin(), result, expected.begin(), odd_end));
+
+    d = c;
+    auto const even_end = std::remove_copy_if(
+        c.begin(), c.end(), expected.begin(), is_odd);
+    check_no_allocation(
+        [&] { result = pika::remove_if(policy, d.begin(), d.end(), is_odd); });
+    PIKA_TEST(std::equal(d.begin(), result, expected.begin(), even_end));
+
+    check_no_allocation([&] {
+        pika::partition_copy(
+            policy, c.begin(), c.end(), e.begin(), f.begin(), is_odd);
+    });
+    PIKA_TEST(std::equal(e.begin(),
+        std::next(e.begin(), std::count_if(c.begin(), c.end(), is_odd)),
+        expected.begin(), odd_end));
+
+    d = c;
+    check_no_allocation(
+        [&] { result = pika::partition(policy, d.begin(), d.end(), is_odd); });
+    PIKA_TEST(std::all_of(d.begin(), result, is_odd));
+    PIKA_TEST(std::none_of(result, d.end(), is_odd));
+
+    // set_union, set_intersection of the input and its odd elements
+    std::vector<int> const odd(expected.begin(), odd_end);
+    std::vector<int> g(2 * size);
+    std::vector<int> expected2(2 * size);
+    auto const union_end = std::set_union(
+        c.begin(), c.end(), odd.begin(), odd.end(), expected2.begin());
+    check_no_allocation([&] {
+        result = pika::set_union(
+            policy, c.begin(), c.end(), odd.begin(), odd.end(), g.begin());
+    });
+    PIKA_TEST(std::equal(g.begin(), result, expected2.begin(), union_end));
+
+    auto const intersection_end = std::set_intersection(
+        c.begin(), c.end(), odd.begin(), odd.end(), expected2.begin());
+    check_no_allocation([&] {
+        result = pika::set_intersection(
+            policy, c.begin(), c.end(), odd.begin(), odd.end(), g.begin());
+    });
+    PIKA_TEST(
+        std::equal(g.begin(), result, expected2.begin(), intersection_end));
+
+    // reduce_by_key, the runs of seven equal keys are summed up
+    if (size == 0)
+    {
+        return;
+    }
+
+    std::vector<int> const values(size, 1);
+    check_no_allocation([&] {
+        auto const r = pika::reduce_by_key(policy, c.begin(), c.end(),
+            values.begin(), e.begin(), f.begin());
+        result = r.in;
+    });
+    PIKA_TEST(result == std::next(e.begin(), (size + 6) / 7));
+    for (std::size_t i = 0; i != size / 7; ++i)
+    {
+        PIKA_TEST_EQ(e[i], int(i));
+        PIKA_TEST_EQ(f[i], 7);
+    }
+}
+
+void test_no_allocation()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 100, 100007})
+    {
+        test_no_allocation(seq.with(no_allocation()), size);
+        test_no_allocation(par.with(no_allocation()), size);
+        test_no_allocation(par_unseq.with(no_allocation()), size);
+    }
+}
+
+int pika_main()
+{
+    test_no_allocation();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/util/nothrow_chunks.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_detection()
+{
+    using namespace pika::execution;
+    using pika::parallel::util::detail::use_nothrow_chunks_v;
+
+    auto nothrow_f = [](int*, std::size_t) noexcept {};
+    auto f = [](int*, std::size_t) {};
+
+    static_assert(use_nothrow_chunks_v<decltype(par), decltype(nothrow_f),
+        int*, std::size_t>);
+    static_assert(
+        !use_nothrow_chunks_v<decltype(par), decltype(f), int*, std::size_t>);
+    static_assert(use_nothrow_chunks_v<decltype(par.with(nothrow_chunks())),
+        decltype(f), int*, std::size_t>);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_algorithms(ExPolicy policy)
+{
+    std::vector<std::size_t> c(100007);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+
+    // for_each detects the noexcept element function
+    pika::for_each(policy, c.begin(), c.end(), [](std::size_t& v) noexcept {
+        v = 2 * v;
+    });
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        PIKA_TEST_EQ(c[i], 2 * i);
+    }
+
+    std::vector<std::size_t> d(c.size());
+    pika::transform(policy.with(pika::execution::nothrow_chunks()), c.begin(),
+        c.end(), d.begin(), [](std::size_t v) { return v + 1; });
+    for (std::size_t i = 0; i != d.size(); ++i)
+    {
+        PIKA_TEST_EQ(d[i], 2 * i + 1);
+    }
+
+    PIKA_TEST(pika::any_of(policy.with(pika::execution::nothrow_chunks()),
+        d.begin(), d.end(), [](std::size_t v) { return v == 1001; }));
+    PIKA_TEST(!pika::any_of(policy.with(pika::execution::nothrow_chunks()),
+        d.begin(), d.end(), [](std::size_t v) { return v % 2 == 0; }));
+    PIKA_TEST_EQ(pika::count_if(policy.with(pika::execution::nothrow_chunks()),
+                     c.begin(), c.end(),
+                     [](std::size_t v) { return v % 4 == 0; }),
+        std::ptrdiff_t((c.size() + 1) / 2));
+}
+
+// the exceptions of functions which may throw are reported as usual
+void test_exceptions()
+{
+    using namespace pika::execution;
+
+    std::vector<int> c(10007);
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(par, c.begin(), c.end(), [](int&) {
+            throw std::runtime_error("test");
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST_LT(std::size_t(0), e.size());
+    }
+    PIKA_TEST(caught_exception);
+}
+
+int pika_main()
+{
+    using namespace pika::execution;
+
+    test_detection();
+    test_algorithms(par);
+    test_algorithms(par_unseq);
+    test_exceptions();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/memory.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/container_memory.hpp>
+#include <pika/parallel/util/numa_chunk_placement.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chunk_mapping()
+{
+    pika::execution::numa_chunk_placement ncp;
+    PIKA_TEST_EQ(ncp.get_chunk_size(pika::execution::par.executor(),
+                     [](std::size_t) { return 0; }, 4, 10007),
+        std::size_t(2502));
+    PIKA_TEST_EQ(ncp.get_chunk_size(pika::execution::par.executor(),
+                     [](std::size_t) { return 0; }, 4, 0),
+        std::size_t(1));
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        PIKA_TEST_EQ(ncp.get_chunk_worker(i, 4), i % 4);
+    }
+
+    pika::execution::numa_chunk_placement ncp2(2);
+    PIKA_TEST_EQ(ncp2.get_chunk_size(pika::execution::par.executor(),
+                     [](std::size_t) { return 0; }, 4, 10007),
+        std::size_t(1251));
+    for (std::size_t i = 0; i != 16; ++i)
+    {
+        PIKA_TEST_EQ(ncp2.get_chunk_worker(i, 4), (i / 2) % 4);
+    }
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    // first touch through uninitialized_fill
+    std::allocator<double> alloc;
+    double* p = alloc.allocate(size);
+    pika::uninitialized_fill(policy, p, p + size, 1.0);
+
+    pika::transform(policy, p, p + size, p, [](double v) { return 2.0 * v; });
+    PIKA_TEST(std::all_of(p, p + size, [](double v) { return v == 2.0; }));
+
+    double const sum = pika::reduce(policy, p, p + size, 0.0);
+    PIKA_TEST_EQ(sum, 2.0 * size);
+
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_loop(
+        policy, std::size_t(0), size, [&](std::size_t i) { ++visited[i]; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& v) { return v.load() == 1; }));
+
+    std::destroy(p, p + size);
+    alloc.deallocate(p, size);
+}
+
+template <typename ExPolicy>
+void test_exceptions(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 0);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(policy, c.begin(), c.end(),
+            [](int) { throw std::runtime_error("test"); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+struct counter
+{
+    counter() = default;
+    explicit counter(int v)
+      : value(v)
+    {
+    }
+    ~counter() {}
+
+    int value = 7;
+};
+
+void test_numa_vector()
+{
+    using namespace pika::execution;
+    std::size_t const size = 10007;
+
+    numa_chunk_placement ncp(2);
+    pika::numa_vector<double> a = pika::make_numa_vector<double>(size, ncp);
+    pika::numa_vector<double> b = pika::make_numa_vector(size, 2.0, ncp);
+    pika::numa_vector<double> c = pika::make_numa_vector(size, 3.0, ncp);
+
+    PIKA_TEST_EQ(a.size(), size);
+    PIKA_TEST(std::all_of(a.begin(), a.end(), [](double v) { return v == 0; }));
+    PIKA_TEST(std::all_of(b.begin(), b.end(), [](double v) { return v == 2; }));
+
+    // STREAM triad using the chunk placement of the allocator
+    auto policy = par.with(a.get_allocator().placement());
+    pika::transform(policy, b.begin(), b.end(), c.begin(), a.begin(),
+        [](double x, double y) { return x + 3.0 * y; });
+    PIKA_TEST(
+        std::all_of(a.begin(), a.end(), [](double v) { return v == 11.0; }));
+
+    // copies keep the allocator
+    pika::numa_vector<double> d = a;
+    PIKA_TEST(d == a);
+    d.resize(2 * size);
+    PIKA_TEST_EQ(d.size(), 2 * size);
+
+    // not trivially destructible, constructed and assigned
+    pika::numa_vector<counter> e = pika::make_numa_vector<counter>(size, ncp);
+    PIKA_TEST(std::all_of(
+        e.begin(), e.end(), [](counter const& v) { return v.value == 7; }));
+
+    pika::numa_vector<counter> f = pika::make_numa_vector(size, counter(42));
+    PIKA_TEST(std::all_of(
+        f.begin(), f.end(), [](counter const& v) { return v.value == 42; }));
+}
+
+// trivially default constructible values are not written, the placed
+// chunks only touch their pages
+void test_first_touch()
+{
+    using namespace pika::execution;
+    std::size_t const size = 1000003;
+
+    std::int32_t* p =
+        static_cast<std::int32_t*>(std::malloc(size * sizeof(std::int32_t)));
+    std::memset(static_cast<void*>(p), 0xcd, size * sizeof(std::int32_t));
+
+    numa_chunk_placement ncp;
+    std::int32_t* result =
+        pika::uninitialized_default_construct_n(par.with(ncp), p, size);
+    PIKA_TEST(result == p + size);
+    pika::uninitialized_default_construct(par.with(ncp), p, p + size);
+    pika::uninitialized_default_construct(par, p, p + size);
+
+    auto f = pika::uninitialized_default_construct_n(
+        par(task).with(ncp), p + 1, size - 1);
+    PIKA_TEST(f.get() == p + size);
+
+    PIKA_TEST(std::all_of(p, p + size,
+        [](std::int32_t v) { return v == std::int32_t(0xcdcdcdcd); }));
+
+    PIKA_TEST(pika::destroy_n(par.with(ncp), p, size) == p + size);
+    pika::destroy(par, p, p + size);
+
+    std::free(p);
+}
+
+void test_numa_chunk_placement()
+{
+    using namespace pika::execution;
+
+    test_chunk_mapping();
+
+    numa_chunk_placement ncp;
+    test_algorithms(par.with(ncp));
+    test_exceptions(par.with(ncp));
+
+    numa_chunk_placement ncp2(4);
+    test_algorithms(par.with(ncp2));
+    test_exceptions(par.with(ncp2));
+
+    // asynchronous policies use the same chunk placement
+    std::vector<int> c(10007, 1);
+    auto f = pika::reduce(par(task).with(ncp), c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(f.get(), 10007);
+
+    test_numa_vector();
+    test_first_touch();
+}
+
+int pika_main()
+{
+    test_numa_chunk_placement();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
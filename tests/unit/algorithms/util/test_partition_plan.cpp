@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/util/chunk_trace.hpp>
+#include <pika/parallel/util/inline_threshold.hpp>
+#include <pika/parallel/util/partition_plan.hpp>
+#include <pika/parallel/util/work_stealing_chunk_size.hpp>
+#include <pika/parallel/util/worker_subset.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace util = pika::parallel::util;
+
+///////////////////////////////////////////////////////////////////////////////
+// The chunks of a plan are contiguous and cover the iterations after the
+// probe
+void check_coverage(util::partition_plan const& plan, std::size_t count)
+{
+    std::size_t first = plan.probe_count;
+    for (auto const& chunk : plan.chunks)
+    {
+        PIKA_TEST_EQ(chunk.first, first);
+        PIKA_TEST_NEQ(chunk.count, std::size_t(0));
+        if (!plan.work_stealing)
+        {
+            PIKA_TEST_LTE(chunk.count, plan.chunk_size);
+        }
+        first += chunk.count;
+    }
+    PIKA_TEST_EQ(first, count);
+}
+
+void test_inline()
+{
+    using namespace pika::execution;
+
+    auto plan = util::plan_partition(seq, 1000);
+    PIKA_TEST(plan.runs_inline);
+    PIKA_TEST_EQ(plan.chunks.size(), std::size_t(1));
+    check_coverage(plan, 1000);
+
+    plan = util::plan_partition(par.with(inline_threshold(1000)), 500);
+    PIKA_TEST(plan.runs_inline);
+    check_coverage(plan, 500);
+
+    plan = util::plan_partition(par.with(inline_threshold(1000)), 5000);
+    PIKA_TEST(!plan.runs_inline);
+    check_coverage(plan, 5000);
+
+    plan = util::plan_partition(par, 0);
+    PIKA_TEST(plan.chunks.empty());
+}
+
+void test_static_chunks()
+{
+    using namespace pika::execution;
+
+    auto plan = util::plan_partition(par.with(static_chunk_size(100)), 1000);
+    PIKA_TEST(!plan.runs_inline);
+    PIKA_TEST(!plan.work_stealing);
+    PIKA_TEST_EQ(plan.chunk_size, std::size_t(100));
+    PIKA_TEST_EQ(plan.probe_count, std::size_t(0));
+    PIKA_TEST_EQ(plan.chunks.size(), std::size_t(10));
+    check_coverage(plan, 1000);
+    for (auto const& chunk : plan.chunks)
+    {
+        PIKA_TEST_EQ(chunk.worker, std::size_t(-1));
+    }
+
+    // the chunk sizes are multiples of the stride, except for the last one
+    plan = util::plan_partition(par.with(static_chunk_size(100)), 1000, 7);
+    PIKA_TEST_EQ(plan.chunk_size % 7, std::size_t(0));
+    check_coverage(plan, 1000);
+
+    for (std::size_t count : {1, 17, 1000, 100007})
+    {
+        check_coverage(util::plan_partition(par, count), count);
+        check_coverage(util::plan_partition(par, count, 3), count);
+    }
+}
+
+void test_placement()
+{
+    using namespace pika::execution;
+
+    worker_subset ws(1, 2, 2);
+    auto plan = util::plan_partition(par.with(ws), 10007);
+    PIKA_TEST_EQ(plan.cores, std::size_t(2));
+    PIKA_TEST_EQ(plan.max_chunks, std::size_t(4));
+    PIKA_TEST_EQ(plan.chunks.size(), std::size_t(4));
+    check_coverage(plan, 10007);
+    for (std::size_t i = 0; i != plan.chunks.size(); ++i)
+    {
+        PIKA_TEST_EQ(plan.chunks[i].worker, ws.get_chunk_worker(i, 2));
+    }
+}
+
+void test_work_stealing()
+{
+    using namespace pika::execution;
+
+    auto plan =
+        util::plan_partition(par.with(work_stealing_chunk_size()), 100007);
+    PIKA_TEST(plan.work_stealing);
+    PIKA_TEST_NEQ(plan.chunk_size, std::size_t(0));
+    PIKA_TEST_LTE(plan.chunks.size(), plan.cores);
+    check_coverage(plan, 100007);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The plan matches the chunks the partitioner creates when running the
+// algorithm
+void test_matches_trace()
+{
+    using namespace pika::execution;
+
+    std::vector<int> c(10007);
+    auto policy = par.with(static_chunk_size(100));
+    auto const plan = util::plan_partition(policy, c.size());
+
+    util::enable_chunk_tracing(true);
+    util::clear_chunk_trace();
+
+    pika::for_each(policy, c.begin(), c.end(), [](int& v) { v = 1; });
+
+    std::size_t chunks = 0;
+    std::size_t count = 0;
+    for (auto const& e : util::get_chunk_trace())
+    {
+        if (std::strcmp(e.name, "partition") == 0)
+        {
+            ++chunks;
+            count += e.count;
+        }
+    }
+    util::enable_chunk_tracing(false);
+    util::clear_chunk_trace();
+
+    PIKA_TEST_EQ(chunks, plan.chunks.size());
+    PIKA_TEST_EQ(count, c.size());
+}
+
+int pika_main()
+{
+    test_inline();
+    test_static_chunks();
+    test_placement();
+    test_work_stealing();
+    test_matches_trace();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    auto num_even = pika::count_if(
+        policy, c.begin(), c.end(), [](std::uint64_t v) { return v % 2 == 0; });
+    PIKA_TEST_EQ(num_even, std::ptrdiff_t((size + 1) / 2));
+
+    std::uint64_t const sum =
+        pika::reduce(policy, c.begin(), c.end(), std::uint64_t(0));
+    PIKA_TEST_EQ(sum, std::uint64_t(size * (size - 1) / 2));
+
+    std::uint64_t const sum2 = pika::transform_reduce(policy, c.begin(),
+        c.end(), std::uint64_t(0), std::plus<>(),
+        [](std::uint64_t v) { return 2 * v; });
+    PIKA_TEST_EQ(sum2, std::uint64_t(size * (size - 1)));
+
+    // the chunk results of bool reductions are not stored in a bit-packed
+    // array written by several chunks at once
+    std::vector<bool> flags(size, false);
+    flags[size - 1] = true;
+    PIKA_TEST(pika::reduce(
+        policy, flags.begin(), flags.end(), false, std::logical_or<>()));
+    PIKA_TEST(pika::transform_reduce(policy, c.begin(), c.end(), false,
+        std::logical_or<>(), [](std::uint64_t v) { return v == 17; }));
+
+    c[size / 2] = std::uint64_t(size);
+    PIKA_TEST(pika::min_element(policy, c.begin(), c.end()) == c.begin());
+    PIKA_TEST(
+        pika::max_element(policy, c.begin(), c.end()) == c.begin() + size / 2);
+    auto mm = pika::minmax_element(policy, c.begin(), c.end());
+    PIKA_TEST(mm.min == c.begin());
+    PIKA_TEST(mm.max == c.begin() + size / 2);
+}
+
+template <typename ExPolicy>
+void test_exceptions(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::count_if(policy, c.begin(), c.end(), [](int) -> bool {
+            throw std::runtime_error("test");
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+void test_partition_values()
+{
+    using namespace pika::execution;
+
+    test_algorithms(seq);
+    test_algorithms(par);
+    test_algorithms(par.with(static_chunk_size(1)));
+    test_algorithms(par_unseq);
+
+    test_exceptions(par);
+    test_exceptions(par.with(static_chunk_size(1)));
+}
+
+int pika_main()
+{
+    test_partition_values();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
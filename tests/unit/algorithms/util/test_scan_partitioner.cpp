@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../test_utils.hpp"
+
+// The affine functions x -> a * x + b, combined by composition. This is
+// associative but not commutative, the partitions have to be combined in
+// the order of the sequence.
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+};
+
+bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{lhs.a * rhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// The executor parameters select the scan_partitioner, the chunk sizes
+// decide whether the partitions are chained or swept.
+template <typename ExPolicy, typename Container>
+void test_scan_partitioner(ExPolicy&& policy, Container const& c)
+{
+    std::size_t const size = c.size();
+    affine const init{3, 5};
+
+    std::vector<affine> expected(size);
+    std::vector<affine> d(size);
+
+    affine sum = init;
+    std::size_t i = 0;
+    for (auto const& f : c)
+    {
+        sum = compose()(sum, f);
+        expected[i++] = sum;
+    }
+    auto r1 = pika::inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), init);
+    PIKA_TEST(r1 == d.end());
+    PIKA_TEST(d == expected);
+
+    sum = init;
+    i = 0;
+    for (auto const& f : c)
+    {
+        expected[i++] = sum;
+        sum = compose()(sum, f);
+    }
+    auto r2 = pika::exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose());
+    PIKA_TEST(r2 == d.end());
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_scan_partitioner_exception(ExPolicy&& policy)
+{
+    std::vector<std::uint64_t> c(100007, 1);
+    std::vector<std::uint64_t> d(c.size());
+    c[c.size() / 2] = 0;
+
+    bool caught_exception = false;
+    try
+    {
+        test::run<ExPolicy>([&] {
+            return pika::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+                [](std::uint64_t lhs, std::uint64_t rhs) {
+                    if (rhs == 0)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                    return lhs + rhs;
+                });
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+
+    PIKA_TEST(caught_exception);
+}
+
+void test_scan_partitioner()
+{
+    using namespace pika::execution;
+
+    std::vector<affine> c(100007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = affine{2 * (i % 7) + 1, i % 13};
+    }
+    std::list<affine> l(c.begin(), c.end());
+
+    // few partitions are chained, many partitions are swept
+    for (std::size_t chunk_size : {1000007, 10000, 1000, 10})
+    {
+        test_scan_partitioner(par.with(static_chunk_size(chunk_size)), c);
+        test_scan_partitioner(par.with(static_chunk_size(chunk_size)), l);
+    }
+
+    // the first partition is used for measuring the time per iteration
+    test_scan_partitioner(par.with(auto_chunk_size()), c);
+    test_scan_partitioner(par.with(auto_chunk_size()), l);
+
+    test_scan_partitioner_exception(par.with(static_chunk_size(10000)));
+    test_scan_partitioner_exception(par.with(static_chunk_size(10)));
+    test_scan_partitioner_exception(par(task).with(static_chunk_size(10)));
+}
+
+int pika_main()
+{
+    test_scan_partitioner();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/util/scratch_memory_limit.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using pika::parallel::util::scratch_memory_usage;
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::uint32_t key;
+    std::size_t index;
+};
+
+std::vector<element> make_elements(std::size_t size)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{std::uint32_t((i * 7919) % 1013), i};
+    }
+    return c;
+}
+
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c = make_elements(size);
+
+    pika::stable_sort(policy, c.begin(), c.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key < rhs.key;
+        });
+
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        PIKA_TEST(c[i - 1].key < c[i].key ||
+            (c[i - 1].key == c[i].key && c[i - 1].index < c[i].index));
+    }
+}
+
+void test_stable_sort()
+{
+    using namespace pika::execution;
+
+    std::size_t const size = 100007;
+
+    // without a budget the buffer of half of the elements is reported
+    scratch_memory_usage usage;
+    test_stable_sort(seq.with(scratch_memory_limit(usage)), size);
+    test_stable_sort(par.with(scratch_memory_limit(usage)), size);
+    PIKA_TEST_EQ(usage.peak_bytes(), ((size + 1) / 2) * sizeof(element));
+    PIKA_TEST_EQ(usage.current_bytes(), std::size_t(0));
+    PIKA_TEST_EQ(usage.fallbacks(), std::size_t(0));
+
+    // within a small budget the merges use a bounded buffer
+    std::size_t const budget = 1000 * sizeof(element);
+    usage.reset();
+    test_stable_sort(seq.with(scratch_memory_limit(budget, usage)), size);
+    test_stable_sort(par.with(scratch_memory_limit(budget, usage)), size);
+    PIKA_TEST_LTE(usage.peak_bytes(), budget);
+    PIKA_TEST_EQ(usage.current_bytes(), std::size_t(0));
+    PIKA_TEST_EQ(usage.fallbacks(), std::size_t(2));
+
+    // a budget below a single element still sorts using one element
+    usage.reset();
+    test_stable_sort(par.with(scratch_memory_limit(1, usage)), size);
+    PIKA_TEST_LTE(usage.peak_bytes(), sizeof(element));
+
+    // the budget bounds each call if there is no usage object
+    test_stable_sort(par.with(scratch_memory_limit(budget)), size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unique()
+{
+    using namespace pika::execution;
+
+    std::vector<int> c(100007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = static_cast<int>(i / 3);
+    }
+
+    std::vector<int> expected = c;
+    expected.erase(
+        std::unique(expected.begin(), expected.end()), expected.end());
+
+    // the flags of the elements are reported
+    scratch_memory_usage usage;
+    {
+        std::vector<int> d = c;
+        auto it = pika::unique(
+            par.with(scratch_memory_limit(usage)), d.begin(), d.end());
+        PIKA_TEST(std::equal(d.begin(), it, expected.begin(), expected.end()));
+        PIKA_TEST_LT(std::size_t(0), usage.peak_bytes());
+        PIKA_TEST_EQ(usage.current_bytes(), std::size_t(0));
+    }
+
+    // without memory for the flags the elements are compacted sequentially
+    usage.reset();
+    {
+        std::vector<int> d = c;
+        auto it = pika::unique(
+            par.with(scratch_memory_limit(16, usage)), d.begin(), d.end());
+        PIKA_TEST(std::equal(d.begin(), it, expected.begin(), expected.end()));
+
+        std::vector<int> e(c.size());
+        auto dest = pika::unique_copy(par.with(scratch_memory_limit(16, usage)),
+            c.begin(), c.end(), e.begin());
+        PIKA_TEST(
+            std::equal(e.begin(), dest, expected.begin(), expected.end()));
+
+        PIKA_TEST_EQ(usage.peak_bytes(), std::size_t(0));
+        PIKA_TEST_EQ(usage.fallbacks(), std::size_t(2));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reduce_by_key()
+{
+    using namespace pika::execution;
+
+    std::vector<int> keys(100007);
+    std::vector<int> values(keys.size(), 1);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        keys[i] = static_cast<int>(i / 10);
+    }
+
+    for (std::size_t budget : {std::size_t(-1), std::size_t(0)})
+    {
+        scratch_memory_usage usage;
+        std::vector<int> keys_out(keys.size());
+        std::vector<int> values_out(values.size());
+        auto result =
+            pika::reduce_by_key(par.with(scratch_memory_limit(budget, usage)),
+                keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+                values_out.begin());
+
+        std::size_t const count = std::distance(keys_out.begin(), result.in);
+        PIKA_TEST_EQ(count, (keys.size() + 9) / 10);
+        for (std::size_t i = 0; i + 1 < count; ++i)
+        {
+            PIKA_TEST_EQ(keys_out[i], static_cast<int>(i));
+            PIKA_TEST_EQ(values_out[i], 10);
+        }
+        PIKA_TEST_EQ(values_out[count - 1], 7);
+        PIKA_TEST_EQ(usage.current_bytes(), std::size_t(0));
+    }
+}
+
+void test_set_union()
+{
+    using namespace pika::execution;
+
+    std::vector<int> c1(100007);
+    std::vector<int> c2(50003);
+    for (std::size_t i = 0; i != c1.size(); ++i)
+    {
+        c1[i] = static_cast<int>(2 * i);
+    }
+    for (std::size_t i = 0; i != c2.size(); ++i)
+    {
+        c2[i] = static_cast<int>(3 * i);
+    }
+
+    std::vector<int> expected;
+    std::set_union(c1.begin(), c1.end(), c2.begin(), c2.end(),
+        std::back_inserter(expected));
+
+    for (std::size_t budget : {std::size_t(-1), std::size_t(0)})
+    {
+        scratch_memory_usage usage;
+        std::vector<int> d(c1.size() + c2.size());
+        auto it = pika::set_union(par.with(scratch_memory_limit(budget, usage)),
+            c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+        PIKA_TEST(std::equal(d.begin(), it, expected.begin(), expected.end()));
+        PIKA_TEST_EQ(usage.current_bytes(), std::size_t(0));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    test_stable_sort();
+    test_unique();
+    test_reduce_by_key();
+    test_set_union();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/algorithms/detail/sorting_network.hpp>
+#include <pika/parallel/util/compare_projected.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace pika::parallel::detail;
+
+using int_iterator = std::vector<int>::iterator;
+using double_iterator = std::vector<double>::iterator;
+
+static_assert(use_sorting_network_v<int_iterator, less>);
+static_assert(use_sorting_network_v<double_iterator, std::greater<>>);
+static_assert(use_sorting_network_v<int_iterator,
+    compare_projected<std::less<int>&, projection_identity&>>);
+static_assert(!use_sorting_network_v<std::vector<std::string>::iterator, less>);
+static_assert(!use_stable_sorting_network_v<double_iterator, less>);
+static_assert(use_stable_sorting_network_v<int_iterator, greater>);
+
+std::mt19937 gen(0);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Comp>
+void test_small_sort(std::size_t size, T max_value, Comp comp)
+{
+    std::uniform_int_distribution<int> dis(0, int(max_value));
+
+    for (int i = 0; i != 100; ++i)
+    {
+        std::vector<T> c(size);
+        std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+
+        std::vector<T> expected = c;
+        std::sort(expected.begin(), expected.end(), comp);
+
+        std::vector<T> d = c;
+        small_sort(c.begin(), c.end(), comp);
+        PIKA_TEST(c == expected);
+
+        small_stable_sort(d.begin(), d.end(), comp);
+        PIKA_TEST(d == expected);
+    }
+}
+
+// all sequences of zeros and ones are sorted if and only if the network sorts
+// every sequence
+void test_zero_one_principle(std::size_t size)
+{
+    for (std::uint32_t bits = 0; bits != (std::uint32_t(1) << size); ++bits)
+    {
+        std::vector<int> c(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            c[i] = (bits >> i) & 1;
+        }
+
+        less comp;
+        small_sort(c.begin(), c.end(), comp);
+        PIKA_TEST(std::is_sorted(c.begin(), c.end()));
+    }
+}
+
+// the order of equal elements is preserved unless they are arithmetic values
+void test_small_stable_sort()
+{
+    std::vector<std::pair<int, int>> c;
+    for (int i = 0; i != 32; ++i)
+    {
+        c.emplace_back(i % 4, i);
+    }
+
+    auto comp = [](auto const& lhs, auto const& rhs) {
+        return lhs.first < rhs.first;
+    };
+    std::vector<std::pair<int, int>> expected = c;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    small_stable_sort(c.begin(), c.end(), comp);
+    PIKA_TEST(c == expected);
+}
+
+int main(int, char*[])
+{
+    for (std::size_t size = 0; size <= 40; ++size)
+    {
+        test_small_sort<int>(size, 1000, less());
+        test_small_sort<int>(size, 3, std::greater<>());
+        test_small_sort<double>(size, 1000, std::less<double>());
+        test_small_sort<std::uint8_t>(size, 255, greater());
+    }
+
+    for (std::size_t size = 2; size <= 20; ++size)
+    {
+        test_zero_one_principle(size);
+    }
+
+    test_small_stable_sort();
+
+    return 0;
+}
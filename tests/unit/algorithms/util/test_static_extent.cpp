@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithms/traits/static_extent.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/container_algorithms/fill.hpp>
+#include <pika/parallel/container_algorithms/for_each.hpp>
+#include <pika/parallel/container_algorithms/reduce.hpp>
+#include <pika/parallel/container_algorithms/transform.hpp>
+#include <pika/parallel/container_algorithms/transform_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+#include "../test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+static_assert(pika::traits::static_extent_v<std::array<int, 16>> == 16);
+static_assert(pika::traits::static_extent_v<std::array<int, 16> const&> == 16);
+static_assert(pika::traits::static_extent_v<int (&)[7]> == 7);
+static_assert(pika::traits::static_extent_v<std::vector<int>> ==
+    pika::traits::dynamic_extent);
+#if defined(__cpp_lib_span)
+static_assert(pika::traits::static_extent_v<std::span<int, 4>> == 4);
+static_assert(pika::traits::static_extent_v<std::span<int>> ==
+    pika::traits::dynamic_extent);
+#endif
+
+template <typename ExPolicy, typename Rng>
+void test_static_extent(ExPolicy&& policy, Rng& rng, bool inlined)
+{
+    using value_type = std::decay_t<decltype(*std::begin(rng))>;
+    std::size_t const size = std::size(rng);
+
+    test::run<ExPolicy>(
+        [&] { return pika::ranges::fill(policy, rng, value_type(3)); });
+    for (auto const& value : rng)
+    {
+        PIKA_TEST_EQ(value, value_type(3));
+    }
+
+    // all elements are visited by the calling thread if the algorithm runs
+    // inline
+    auto const id = pika::this_thread::get_id();
+    std::atomic<std::size_t> visited(0);
+    std::atomic<std::size_t> elsewhere(0);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(policy, rng, [&](value_type& value) {
+            value += value_type(visited++ % 100);
+            if (pika::this_thread::get_id() != id)
+                ++elsewhere;
+        });
+    });
+    PIKA_TEST_EQ(visited.load(), size);
+    if (inlined)
+    {
+        PIKA_TEST_EQ(elsewhere.load(), std::size_t(0));
+    }
+
+    value_type const expected = std::accumulate(
+        std::begin(rng), std::end(rng), value_type(0));
+    PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+        return pika::ranges::reduce(policy, rng, value_type(0));
+    }),
+        expected);
+    PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+        return pika::ranges::transform_reduce(policy, rng, value_type(0),
+            std::plus<>(), [](value_type value) { return 2 * value; });
+    }),
+        2 * expected);
+
+    std::vector<value_type> d(size);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::transform(policy, rng, d.begin(),
+            [](value_type value) { return value + 1; });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], std::data(rng)[i] + 1);
+    }
+}
+
+template <typename ExPolicy>
+void test_static_extent(ExPolicy&& policy)
+{
+    std::array<int, 0> a0;
+    std::array<int, 13> a13;
+    std::array<double, 256> a256;
+    int b[64];
+    test_static_extent(policy, a0, true);
+    test_static_extent(policy, a13, true);
+    test_static_extent(policy, a256, true);
+    test_static_extent(policy, b, true);
+
+#if defined(__cpp_lib_span)
+    std::vector<int> v(100);
+    std::span<int, 100> s(v.data(), 100);
+    test_static_extent(policy, s, true);
+#endif
+
+    // above the threshold the algorithms run as usual
+    std::vector<int> large(100007);
+    test_static_extent(policy, large, false);
+    std::array<int, 4096> a4096;
+    test_static_extent(policy, a4096, false);
+}
+
+void test_static_extent()
+{
+    using namespace pika::execution;
+
+    test_static_extent(seq);
+    test_static_extent(par);
+    test_static_extent(par_unseq);
+    test_static_extent(seq(task));
+    test_static_extent(par(task));
+}
+
+int pika_main()
+{
+    test_static_extent();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/detail/synchronous_bulk_partition.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = pika::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_selection()
+{
+    using pika::parallel::detail::use_synchronous_bulk_partition_v;
+    using iterator = std::vector<int>::iterator;
+
+    ex::fork_join_executor exec;
+    using fork_join_policy = decltype(pika::execution::par.on(exec));
+    static_assert(use_synchronous_bulk_partition_v<fork_join_policy, iterator>);
+    static_assert(!use_synchronous_bulk_partition_v<
+                  pika::execution::parallel_policy, iterator>);
+}
+
+void test_algorithms(std::size_t size)
+{
+    ex::fork_join_executor exec;
+    auto policy = pika::execution::par.on(exec);
+
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_each(policy, visited.begin(), visited.end(),
+        [](std::atomic<int>& value) { ++value; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& value) { return value.load() == 1; }));
+
+    std::vector<std::size_t> v(size);
+    std::iota(v.begin(), v.end(), std::size_t(0));
+    PIKA_TEST_EQ(pika::reduce(policy, v.begin(), v.end(), std::size_t(0)),
+        size * (size - 1) / 2);
+    PIKA_TEST_EQ(pika::count_if(policy, v.begin(), v.end(),
+                     [](std::size_t value) { return value % 2 == 0; }),
+        std::ptrdiff_t((size + 1) / 2));
+
+    // bool chunk results go through futures instead of a std::vector<bool>
+    PIKA_TEST_EQ(pika::transform_reduce(policy, v.begin(), v.end(), false,
+                     std::logical_or<>(),
+                     [size](std::size_t value) { return value + 1 == size; }),
+        size != 0);
+
+    std::vector<std::size_t> w(size);
+    pika::transform(policy, v.begin(), v.end(), w.begin(),
+        [](std::size_t value) { return value + 1; });
+    PIKA_TEST(std::equal(v.begin(), v.end(), w.begin(),
+        [](std::size_t lhs, std::size_t rhs) { return lhs + 1 == rhs; }));
+}
+
+void test_exceptions()
+{
+    ex::fork_join_executor exec;
+    auto policy = pika::execution::par.on(exec);
+
+    std::size_t const size = 10007;
+    std::vector<int> v(size, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(policy, v.begin(), v.end(), [](int value) {
+            if (value == 1)
+                throw std::runtime_error("test");
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        pika::reduce(policy, v.begin(), v.end(), 0, [](int lhs, int rhs) {
+            if (rhs == 1)
+                throw std::runtime_error("test");
+            return lhs + rhs;
+        });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const& e)
+    {
+        caught_exception = true;
+        PIKA_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    test_selection();
+    for (std::size_t size : {0, 1, 17, 10007, 1000003})
+    {
+        test_algorithms(size);
+    }
+    test_exceptions();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/numa_chunk_placement.hpp>
+#include <pika/parallel/util/task_hints.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ex = pika::execution::experimental;
+namespace tt = pika::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_properties()
+{
+    using namespace pika::execution;
+
+    auto p1 = with_task_priority(par, thread_priority::high);
+    PIKA_TEST(ex::get_priority(p1.executor()) == thread_priority::high);
+
+    auto p2 = with_task_stacksize(p1, thread_stacksize::small_);
+    PIKA_TEST(ex::get_priority(p2.executor()) == thread_priority::high);
+    PIKA_TEST(ex::get_stacksize(p2.executor()) == thread_stacksize::small_);
+
+    auto p3 = with_task_hint(p2(task), thread_schedule_hint(0));
+    PIKA_TEST(ex::get_priority(p3.executor()) == thread_priority::high);
+    PIKA_TEST(ex::get_hint(p3.executor()).hint == 0);
+    static_assert(
+        pika::is_async_execution_policy_v<std::decay_t<decltype(p3)>>);
+
+    // the executor parameters are kept
+    auto p4 = with_task_priority(
+        par.with(numa_chunk_placement()), thread_priority::low);
+    using parameters_type = typename decltype(p4)::executor_parameters_type;
+    static_assert(std::is_same_v<parameters_type, numa_chunk_placement>);
+    PIKA_TEST(ex::get_priority(p4.executor()) == thread_priority::low);
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 100007;
+
+    std::vector<int> v(size);
+    std::iota(v.rbegin(), v.rend(), 0);
+
+    pika::sort(policy, v.begin(), v.end());
+    PIKA_TEST(std::is_sorted(v.begin(), v.end()));
+
+    pika::stable_sort(policy, v.begin(), v.end(), std::greater<>());
+    PIKA_TEST(std::is_sorted(v.rbegin(), v.rend()));
+
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_each(policy, visited.begin(), visited.end(),
+        [](std::atomic<int>& value) { ++value; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& value) { return value.load() == 1; }));
+
+    PIKA_TEST_EQ(pika::reduce(policy, v.begin(), v.end(), std::size_t(0)),
+        size * (size - 1) / 2);
+
+    // the bulk operation of the algorithms sent by a predecessor sender
+    std::vector<int> w(size);
+    tt::sync_wait(ex::just(v.begin(), v.end(), w.begin(),
+                      [](int value) { return value + 1; }) |
+        pika::transform(policy));
+    PIKA_TEST(w[0] == int(size));
+}
+
+void test_task_hints()
+{
+    using namespace pika::execution;
+
+    test_properties();
+
+    test_algorithms(with_task_priority(par, thread_priority::high));
+    test_algorithms(with_task_priority(par, thread_priority::low));
+    test_algorithms(with_task_stacksize(par, thread_stacksize::small_));
+    test_algorithms(with_task_hint(par, thread_schedule_hint(0)));
+    test_algorithms(with_task_priority(
+        par.with(numa_chunk_placement()), thread_priority::high));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main()
+{
+    test_task_hints();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
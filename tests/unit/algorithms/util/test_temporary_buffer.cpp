@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/util/temporary_buffer.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using pika::parallel::util::temporary_buffer_arena;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_thread_local_cache()
+{
+    namespace detail = pika::parallel::util::detail;
+
+    // a released buffer is handed out again for a request it can satisfy
+    void* p = detail::allocate_temporary_buffer(4096);
+    detail::deallocate_temporary_buffer(p);
+
+    void* q = detail::allocate_temporary_buffer(1024);
+    PIKA_TEST_EQ(p, q);
+
+    // but not while it is in use
+    void* r = detail::allocate_temporary_buffer(1024);
+    PIKA_TEST_NEQ(q, r);
+
+    detail::deallocate_temporary_buffer(r);
+    detail::deallocate_temporary_buffer(q);
+}
+
+void test_arena()
+{
+    namespace detail = pika::parallel::util::detail;
+
+    temporary_buffer_arena arena(1024);
+    PIKA_TEST_EQ(arena.capacity(), std::size_t(1024));
+
+    // the block grows to the largest request and is reused afterwards
+    void* p = detail::allocate_temporary_buffer(4096, &arena);
+    PIKA_TEST_EQ(arena.capacity(), std::size_t(4096));
+    detail::deallocate_temporary_buffer(p, &arena);
+
+    void* q = detail::allocate_temporary_buffer(2048, &arena);
+    PIKA_TEST_EQ(p, q);
+    PIKA_TEST_EQ(arena.capacity(), std::size_t(4096));
+
+    // requests made while the block is in use are served elsewhere
+    void* r = detail::allocate_temporary_buffer(2048, &arena);
+    PIKA_TEST_NEQ(q, r);
+
+    detail::deallocate_temporary_buffer(r, &arena);
+    detail::deallocate_temporary_buffer(q, &arena);
+}
+
+void test_caller_provided_arena()
+{
+    namespace detail = pika::parallel::util::detail;
+
+    // the block of the caller is used but never grown or released
+    std::vector<char> block(4096);
+    {
+        temporary_buffer_arena arena(block.data(), block.size());
+        PIKA_TEST_EQ(arena.capacity(), block.size());
+
+        void* p = detail::allocate_temporary_buffer(2048, &arena);
+        PIKA_TEST_EQ(p, static_cast<void*>(block.data()));
+        detail::deallocate_temporary_buffer(p, &arena);
+
+        void* q = detail::allocate_temporary_buffer(8192, &arena);
+        PIKA_TEST_NEQ(q, static_cast<void*>(block.data()));
+        PIKA_TEST_EQ(arena.capacity(), block.size());
+        detail::deallocate_temporary_buffer(q, &arena);
+    }
+}
+
+void test_huge_pages()
+{
+    namespace detail = pika::parallel::util::detail;
+
+    // large buffers are aligned to huge pages where available, the buffer
+    // follows the header
+    std::size_t const bytes = 2 * detail::scratch_huge_page_threshold;
+    char* p = static_cast<char*>(detail::allocate_temporary_buffer(bytes));
+    std::fill(p, p + bytes, char(1));
+    PIKA_TEST_EQ(std::count(p, p + bytes, char(1)),
+        static_cast<std::ptrdiff_t>(bytes));
+    detail::deallocate_temporary_buffer(p);
+
+    temporary_buffer_arena arena(bytes);
+    PIKA_TEST_EQ(arena.capacity(), bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::uint32_t key;
+    std::size_t index;
+};
+
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = element{std::uint32_t((i * 7919) % 1013), i};
+    }
+
+    pika::stable_sort(policy, c.begin(), c.end(),
+        [](element const& lhs, element const& rhs) {
+            return lhs.key < rhs.key;
+        });
+
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        PIKA_TEST(c[i - 1].key < c[i].key ||
+            (c[i - 1].key == c[i].key && c[i - 1].index < c[i].index));
+    }
+}
+
+void test_stable_sort()
+{
+    using namespace pika::execution;
+
+    temporary_buffer_arena arena;
+    for (std::size_t size : {1000, 100007, 1000000})
+    {
+        test_stable_sort(seq, size);
+        test_stable_sort(par, size);
+        test_stable_sort(seq.with(temporary_buffer(arena)), size);
+        test_stable_sort(par.with(temporary_buffer(arena)), size);
+    }
+
+    // the arena has been used for the temporary buffers
+    PIKA_TEST_LT(std::size_t(0), arena.capacity());
+    PIKA_TEST_LTE(arena.capacity(), 1000000 * sizeof(element));
+
+    // sorting again does not grow the arena
+    std::size_t const capacity = arena.capacity();
+    test_stable_sort(par.with(temporary_buffer(arena)), 1000000);
+    PIKA_TEST_EQ(arena.capacity(), capacity);
+}
+
+int pika_main()
+{
+    test_thread_local_cache();
+    test_arena();
+    test_caller_provided_arena();
+    test_huge_pages();
+    test_stable_sort();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
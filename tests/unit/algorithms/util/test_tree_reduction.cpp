@@ -0,0 +1,182 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/algorithms/traits/use_tree_reduction.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// associative, but not commutative
+struct concatenate
+{
+    std::string operator()(std::string const& lhs, std::string const& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+using histogram = std::array<std::size_t, 16>;
+
+struct merge_histograms
+{
+    histogram operator()(histogram lhs, histogram const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+            lhs[i] += rhs[i];
+        return lhs;
+    }
+};
+
+struct either
+{
+    bool operator()(bool lhs, bool rhs) const
+    {
+        return lhs || rhs;
+    }
+};
+
+struct throwing_plus
+{
+    int operator()(int, int) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+template <>
+struct pika::traits::use_tree_reduction<concatenate> : std::true_type
+{
+};
+
+template <>
+struct pika::traits::use_tree_reduction<merge_histograms> : std::true_type
+{
+};
+
+template <>
+struct pika::traits::use_tree_reduction<either> : std::true_type
+{
+};
+
+template <>
+struct pika::traits::use_tree_reduction<throwing_plus> : std::true_type
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_reduce(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::string> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::string(1, char('a' + i % 26));
+
+    std::string const expected =
+        std::accumulate(c.begin(), c.end(), std::string("init"), concatenate());
+
+    PIKA_TEST(pika::reduce(policy, c.begin(), c.end(), std::string("init"),
+                  concatenate()) == expected);
+    PIKA_TEST(pika::transform_reduce(policy, c.begin(), c.end(),
+                  std::string("init"), concatenate(),
+                  [](std::string const& s) { return s; }) == expected);
+
+    // bool results are combined on the calling thread, the chunks of the
+    // tree would write to shared words of a std::vector<bool>
+    std::vector<bool> flags(size, false);
+    flags[size / 2] = true;
+    PIKA_TEST(
+        pika::reduce(policy, flags.begin(), flags.end(), false, either()));
+}
+
+template <typename ExPolicy>
+void test_for_loop_reduction(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    histogram h{};
+    pika::for_loop(policy, std::size_t(0), size,
+        pika::reduction(h, histogram{}, merge_histograms()),
+        [](std::size_t i, histogram& view) { ++view[i % 16]; });
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != h.size(); ++i)
+    {
+        PIKA_TEST_EQ(h[i], size / 16 + (i < size % 16 ? 1 : 0));
+        total += h[i];
+    }
+    PIKA_TEST_EQ(total, size);
+}
+
+template <typename ExPolicy>
+void test_exceptions(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 1);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::reduce(policy, c.begin(), c.end(), 0, throwing_plus());
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+void test_tree_reduction()
+{
+    using namespace pika::execution;
+
+    test_reduce(par);
+    test_reduce(par.with(static_chunk_size(1)));
+    test_reduce(par(task));
+
+    test_for_loop_reduction(seq);
+    test_for_loop_reduction(par);
+
+    test_exceptions(par);
+}
+
+int pika_main()
+{
+    test_tree_reduction();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
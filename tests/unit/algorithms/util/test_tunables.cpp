@@ -0,0 +1,153 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/parallel/util/calibrate_tunables.hpp>
+#include <pika/parallel/util/tunables.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using pika::parallel::util::get_tunable;
+using pika::parallel::util::set_tunable;
+using pika::parallel::util::tunable;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_profile()
+{
+    using namespace pika::parallel::util;
+
+    reset_tunables();
+    PIKA_TEST_EQ(get_tunable(tunable::sort_limit_per_task),
+        get_tunable_default(tunable::sort_limit_per_task));
+
+    // values below the minimum are raised to it
+    set_tunable(tunable::inplace_merge_threshold, 0);
+    PIKA_TEST_EQ(get_tunable(tunable::inplace_merge_threshold), 5u);
+
+    // missing and unknown names are ignored
+    std::istringstream in(
+        "{ \"sort_limit_per_task\" : 1024, \"unknown\" : 1 }");
+    PIKA_TEST(read_tunables(in));
+    PIKA_TEST_EQ(get_tunable(tunable::sort_limit_per_task), 1024u);
+    PIKA_TEST_EQ(get_tunable(tunable::inplace_merge_threshold), 5u);
+
+    // malformed profiles change nothing
+    std::istringstream malformed(
+        "{ \"stable_sort_limit_per_task\" : 1, \"sort_limit_per_task\" }");
+    PIKA_TEST(!read_tunables(malformed));
+    PIKA_TEST_EQ(get_tunable(tunable::stable_sort_limit_per_task),
+        get_tunable_default(tunable::stable_sort_limit_per_task));
+
+    // a written profile reads back the same values
+    std::ostringstream out;
+    write_tunables(out);
+    reset_tunables();
+    std::istringstream written(out.str());
+    PIKA_TEST(read_tunables(written));
+    PIKA_TEST_EQ(get_tunable(tunable::sort_limit_per_task), 1024u);
+    PIKA_TEST_EQ(get_tunable(tunable::inplace_merge_threshold), 5u);
+
+    reset_tunables();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the algorithms are correct for small values of the tunables
+void test_algorithms(std::size_t limit)
+{
+    using pika::execution::par;
+
+    set_tunable(tunable::sort_limit_per_task, limit);
+    set_tunable(tunable::stable_sort_limit_per_task, limit);
+    set_tunable(tunable::sample_sort_limit_per_task, limit);
+    set_tunable(tunable::inplace_merge_threshold, limit);
+
+    std::mt19937 gen(limit);
+    std::uniform_int_distribution<int> dis(0, 1000);
+    std::vector<int> input(10007);
+    std::generate(input.begin(), input.end(), [&]() { return dis(gen); });
+    std::vector<int> expected(input);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> c(input);
+    pika::sort(par, c.begin(), c.end());
+    PIKA_TEST(c == expected);
+
+    c = input;
+    pika::partial_sort(par, c.begin(), c.begin() + 100, c.end());
+    PIKA_TEST(std::equal(c.begin(), c.begin() + 100, expected.begin()));
+
+    c = input;
+    pika::stable_sort(par, c.begin(), c.end());
+    PIKA_TEST(c == expected);
+
+    c = input;
+    pika::parallel::detail::sample_sort(
+        pika::execution::parallel_executor(), c.begin(), c.end());
+    PIKA_TEST(c == expected);
+
+    c = input;
+    auto const middle = c.begin() + c.size() / 3;
+    std::sort(c.begin(), middle);
+    std::sort(middle, c.end());
+    pika::inplace_merge(par, c.begin(), middle, c.end());
+    PIKA_TEST(c == expected);
+
+    pika::parallel::util::reset_tunables();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_calibrate()
+{
+    pika::parallel::util::tunables_calibration_options options;
+    options.size = 10007;
+    options.candidates = {64, 1024};
+    options.repetitions = 1;
+    pika::parallel::util::calibrate_tunables(options);
+
+    for (tunable t : {tunable::sort_limit_per_task,
+             tunable::stable_sort_limit_per_task,
+             tunable::sample_sort_limit_per_task,
+             tunable::inplace_merge_threshold})
+    {
+        std::size_t const value = get_tunable(t);
+        PIKA_TEST(value == 64 || value == 1024);
+    }
+
+    pika::parallel::util::reset_tunables();
+}
+
+int pika_main()
+{
+    test_profile();
+    test_algorithms(5);
+    test_algorithms(100);
+    test_calibrate();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
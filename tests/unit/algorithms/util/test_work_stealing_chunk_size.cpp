@@ -0,0 +1,136 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/work_stealing_chunk_size.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::uint64_t> c(size);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+
+    // for_each with an irregular per-element cost
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_each(policy, c.begin(), c.end(), [&](std::uint64_t v) {
+        if (v % 1000 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        ++visited[v];
+    });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& v) { return v.load() == 1; }));
+
+    // count
+    auto num_even = pika::count_if(
+        policy, c.begin(), c.end(), [](std::uint64_t v) { return v % 2 == 0; });
+    PIKA_TEST_EQ(num_even, std::ptrdiff_t((size + 1) / 2));
+
+    // transform_reduce
+    std::uint64_t const sum = pika::transform_reduce(policy, c.begin(),
+        c.end(), std::uint64_t(0), std::plus<>(),
+        [](std::uint64_t v) { return 2 * v; });
+    PIKA_TEST_EQ(sum, std::uint64_t(size * (size - 1)));
+
+    // the chunk results are presented in order, which is required by the
+    // reduction step of find
+    c[size / 3] = c[2 * size / 3] = std::uint64_t(-1);
+    auto it = pika::find(policy, c.begin(), c.end(), std::uint64_t(-1));
+    PIKA_TEST(it == c.begin() + size / 3);
+
+    // strided for_loop
+    std::vector<int> d(size, 0);
+    pika::for_loop_strided(
+        policy, std::size_t(0), size, 3, [&](std::size_t i) { ++d[i]; });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], i % 3 == 0 ? 1 : 0);
+    }
+}
+
+template <typename ExPolicy>
+void test_exceptions(ExPolicy&& policy)
+{
+    std::vector<int> c(10007, 0);
+
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(policy, c.begin(), c.end(),
+            [](int) { throw std::runtime_error("test"); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    PIKA_TEST(caught_exception);
+}
+
+void test_work_stealing_chunk_size()
+{
+    pika::execution::work_stealing_chunk_size wscs;
+    test_algorithms(pika::execution::par.with(wscs));
+    test_exceptions(pika::execution::par.with(wscs));
+
+    pika::execution::work_stealing_chunk_size wscs_small(1);
+    test_algorithms(pika::execution::par.with(wscs_small));
+    test_exceptions(pika::execution::par.with(wscs_small));
+
+    // asynchronous policies fall back to the static partitioning
+    pika::execution::work_stealing_chunk_size wscs_task;
+    std::vector<int> c(10007, 1);
+    auto f = pika::reduce(pika::execution::par(pika::execution::task)
+                              .with(wscs_task),
+        c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(f.get(), 10007);
+}
+
+int pika_main()
+{
+    test_work_stealing_chunk_size();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
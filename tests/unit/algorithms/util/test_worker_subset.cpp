@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+
+#include <pika/algorithm.hpp>
+#include <pika/execution.hpp>
+#include <pika/numeric.hpp>
+#include <pika/parallel/util/worker_subset.hpp>
+#include <pika/runtime.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_chunk_mapping()
+{
+    using namespace pika::execution;
+
+    worker_subset ws(2, 2);
+    PIKA_TEST(ws.workers() == (std::vector<std::size_t>{2, 3}));
+    PIKA_TEST_EQ(ws.processing_units_count(par.executor()), std::size_t(2));
+    PIKA_TEST_EQ(ws.get_chunk_size(
+                     par.executor(), [](std::size_t) { return 0; }, 2, 10007),
+        std::size_t(5004));
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        PIKA_TEST_EQ(ws.get_chunk_worker(i, 2), 2 + i % 2);
+    }
+
+    // masks are sorted, duplicates are ignored
+    worker_subset ws2(std::vector<std::size_t>{3, 1, 3}, 2);
+    PIKA_TEST(ws2.workers() == (std::vector<std::size_t>{1, 3}));
+    PIKA_TEST_EQ(ws2.maximal_number_of_chunks(par.executor(), 2, 10007),
+        std::size_t(4));
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        PIKA_TEST_EQ(ws2.get_chunk_worker(i, 2), (i / 2) % 2 == 0 ? 1 : 3);
+    }
+
+    worker_subset ws3(std::vector<std::size_t>{});
+    PIKA_TEST(ws3.workers() == (std::vector<std::size_t>{0}));
+}
+
+template <typename ExPolicy>
+void test_algorithms(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<double> c(size);
+    std::iota(c.begin(), c.end(), 0.0);
+
+    pika::transform(policy, c.begin(), c.end(), c.begin(),
+        [](double v) { return 2.0 * v; });
+    double const sum = pika::reduce(policy, c.begin(), c.end(), 0.0);
+    PIKA_TEST_EQ(sum, double(size) * double(size - 1));
+
+    std::vector<std::atomic<int>> visited(size);
+    pika::for_loop(
+        policy, std::size_t(0), size, [&](std::size_t i) { ++visited[i]; });
+    PIKA_TEST(std::all_of(visited.begin(), visited.end(),
+        [](std::atomic<int> const& v) { return v.load() == 1; }));
+
+    pika::sort(policy, c.begin(), c.end(), std::greater<>());
+    PIKA_TEST(std::is_sorted(c.begin(), c.end(), std::greater<>()));
+
+    bool caught_exception = false;
+    try
+    {
+        pika::for_each(policy, c.begin(), c.end(),
+            [](double) { throw std::runtime_error("test"); });
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    PIKA_TEST(caught_exception);
+}
+
+void test_worker_subset()
+{
+    using namespace pika::execution;
+
+    test_chunk_mapping();
+
+    std::size_t const threads = pika::get_num_worker_threads();
+
+    // the upper half of the worker threads
+    worker_subset ws(threads / 2, threads - threads / 2);
+    test_algorithms(par.with(ws));
+    test_algorithms(par_unseq.with(ws));
+
+    // every other worker thread, four chunks each
+    std::vector<std::size_t> mask;
+    for (std::size_t i = 0; i < threads; i += 2)
+    {
+        mask.push_back(i);
+    }
+    worker_subset ws2(mask, 4);
+    test_algorithms(par.with(ws2));
+
+    std::vector<int> c(10007, 1);
+    auto f = pika::reduce(par(task).with(ws2), c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(f.get(), 10007);
+
+    // named thread pools, combined with a subset of the pool
+    test_algorithms(with_thread_pool(par, "default"));
+    test_algorithms(with_thread_pool(par.with(ws), "default"));
+}
+
+int pika_main()
+{
+    test_worker_subset();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
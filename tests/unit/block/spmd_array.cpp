@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/spmd_array.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t num_images = 10;
+std::size_t iterations = 20;
+
+// the slices cover the array in the order of the images
+void check_layout(pika::spmd_array<double> const& a)
+{
+    std::size_t offset = 0;
+    for (std::size_t image = 0; image != a.num_images(); ++image)
+    {
+        PIKA_TEST_EQ(a.local_offset(image), offset);
+        PIKA_TEST(a.local_size(image) + 1 >= a.size() / a.num_images());
+        PIKA_TEST(a.local_size(image) <= a.size() / a.num_images() + 1);
+
+        for (std::size_t i = 0; i != a.local_size(image); ++i)
+        {
+            PIKA_TEST_EQ(a.owner(offset + i), image);
+            PIKA_TEST(&a[offset + i] == a.local_begin(image) + i);
+        }
+        offset += a.local_size(image);
+
+        // the segments of the images do not overlap
+        if (image + 1 != a.num_images())
+        {
+            PIKA_TEST(a.right_ghost(image) + a.ghost_width() <=
+                a.left_ghost(image + 1));
+        }
+    }
+    PIKA_TEST_EQ(offset, a.size());
+}
+
+// three point stencil, the first and the last element are kept constant
+std::vector<double> stencil_reference(std::size_t size)
+{
+    std::vector<double> current(size), next(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        current[i] = static_cast<double>(i % 7);
+    }
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        next = current;
+        for (std::size_t i = 1; i + 1 < size; ++i)
+        {
+            next[i] = (current[i - 1] + current[i] + current[i + 1]) / 3;
+        }
+        std::swap(current, next);
+    }
+    return current;
+}
+
+void stencil_test_function(pika::spmd_block block,
+    pika::spmd_array<double>* values, pika::spmd_array<std::string>* names)
+{
+    std::size_t const image = block.this_image();
+    std::size_t const offset = values->local_offset(image);
+    std::size_t const size = values->local_size(image);
+
+    values->initialize(block, -1.0);
+    names->initialize(block);
+
+    double* local = values->local_begin(image);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        local[i] = static_cast<double>((offset + i) % 7);
+        names->local_begin(image)[i] = std::to_string(offset + i);
+    }
+
+    std::vector<double> next(size);
+    for (std::size_t it = 0; it != iterations; ++it)
+    {
+        values->exchange_ghosts(block);
+
+        // the left neighbour of the first element is a ghost element
+        double const* left = values->left_ghost(image);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            std::size_t const index = offset + i;
+            if (index == 0 || index + 1 == values->size())
+            {
+                next[i] = local[i];
+            }
+            else
+            {
+                next[i] = (left[i] + local[i] + local[i + 1]) / 3;
+            }
+        }
+        std::copy(next.begin(), next.end(), local);
+    }
+    block.sync_all();
+}
+
+void spmd_array_test(std::size_t images, std::size_t size)
+{
+    pika::spmd_array<double> values(images, size, 1);
+    pika::spmd_array<std::string> names(images, size);
+    check_layout(values);
+
+    pika::define_spmd_block(images, stencil_test_function, &values, &names);
+
+    std::vector<double> const expected = stencil_reference(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(values[i], expected[i]);
+        PIKA_TEST_EQ(names[i], std::to_string(i));
+    }
+}
+
+int pika_main()
+{
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        spmd_array_test(num_images, size);
+        spmd_array_test(1, size);
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    PIKA_TEST_EQ(pika::init(pika_main, argc, argv), 0);
+    return 0;
+}
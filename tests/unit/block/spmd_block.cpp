@@ -9,6 +9,7 @@
 #include <pika/parallel/spmd_block.hpp>
 #include <pika/testing.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -84,6 +85,91 @@ void bulk_test_function(pika::spmd_block block, std::atomic<std::size_t>* c)
     {
         PIKA_TEST_EQ(c[3], (std::size_t) 8);
     }
+
+    // Test sync_images() with a team created once
+    pika::spmd_block::team const evens = block.make_team(
+        std::vector<std::size_t>{0, 2, 4, 6, 8});
+    PIKA_TEST_EQ(evens.size(), (std::size_t) 5);
+    PIKA_TEST_EQ(evens.contains_this_image(), image_id % 2 == 0);
+
+    for (std::size_t i = 1; i <= iterations; ++i)
+    {
+        if (image_id % 2 == 0)
+        {
+            ++c[4];
+        }
+        block.sync_images(evens);
+        if (image_id % 2 == 0)
+        {
+            PIKA_TEST_EQ(c[4], 5 * i);
+        }
+        block.sync_images(evens);
+    }
+}
+
+// Every image writes its slot and reads the slots its neighbours wrote in
+// the same step.
+void neighbor_test_function(pika::spmd_block block, std::size_t* values)
+{
+    std::size_t const image_id = block.this_image();
+    std::size_t const n = block.get_num_images();
+
+    for (std::size_t step = 1; step <= iterations; ++step)
+    {
+        values[(step % 2) * n + image_id] = step * n + image_id;
+        block.sync_neighbors();
+
+        if (image_id != 0)
+        {
+            PIKA_TEST_EQ(values[(step % 2) * n + image_id - 1],
+                step * n + image_id - 1);
+        }
+        if (image_id + 1 != n)
+        {
+            PIKA_TEST_EQ(values[(step % 2) * n + image_id + 1],
+                step * n + image_id + 1);
+        }
+    }
+
+    // the last image waits for the epoch the first one publishes last
+    if (image_id == 0)
+    {
+        values[2 * n] = 42;
+        block.notify();
+    }
+    else if (image_id + 1 == n)
+    {
+        block.wait_for(0, iterations + 1);
+        PIKA_TEST_EQ(values[2 * n], (std::size_t) 42);
+    }
+}
+
+// Every image contributes its id, the collectives combine the ids of all
+// images or of the images below.
+void collectives_test_function(pika::spmd_block block)
+{
+    std::size_t const image_id = block.this_image();
+    std::size_t const n = block.get_num_images();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        PIKA_TEST_EQ(block.all_reduce(image_id + i, std::plus<>()),
+            n * (n - 1) / 2 + n * i);
+        PIKA_TEST_EQ(block.all_reduce(image_id,
+                         [](std::size_t a, std::size_t b) {
+                             return (std::max)(a, b);
+                         }),
+            n - 1);
+
+        PIKA_TEST_EQ(block.inclusive_scan(image_id, std::plus<>()),
+            image_id * (image_id + 1) / 2);
+        PIKA_TEST_EQ(
+            block.exclusive_scan(image_id, std::size_t(100), std::plus<>()),
+            100 + (image_id == 0 ? 0 : image_id * (image_id - 1) / 2));
+
+        std::size_t const root = i % n;
+        PIKA_TEST_EQ(block.broadcast(2.5 * image_id, root), 2.5 * root);
+    }
 }
 
 int pika_main()
@@ -95,11 +181,11 @@ int pika_main()
         bulk_test_function(std::move(block), c);
     };
 
-    std::array<std::atomic<std::size_t>, 4> c1, c2, c3;
+    std::array<std::atomic<std::size_t>, 5> c1, c2, c3, c4, c5;
 
-    for (std::size_t i = 0; i < 4; i++)
+    for (std::size_t i = 0; i < 5; i++)
     {
-        c1[i] = c2[i] = c3[i] = (std::size_t) 0;
+        c1[i] = c2[i] = c3[i] = c4[i] = c5[i] = (std::size_t) 0;
     }
 
     pika::define_spmd_block(num_images, bulk_test, c1.data());
@@ -111,6 +197,23 @@ int pika_main()
 
     pika::define_spmd_block(num_images, bulk_test_function, c3.data());
 
+    // sync_all spinning before it yields
+    using pika::execution::spmd_spin_barrier;
+    pika::define_spmd_block(
+        par.with(spmd_spin_barrier()), num_images, bulk_test, c4.data());
+
+    std::vector<pika::future<void>> join_spin =
+        pika::define_spmd_block(par(task).with(spmd_spin_barrier(16)),
+            num_images, bulk_test, c5.data());
+
+    pika::wait_all(join_spin);
+
+    std::vector<std::size_t> values(2 * num_images + 1, 0);
+    pika::define_spmd_block(num_images, neighbor_test_function, values.data());
+
+    pika::define_spmd_block(num_images, collectives_test_function);
+    pika::define_spmd_block(1, collectives_test_function);
+
     return pika::finalize();
 }
 
@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/parallel/spmd_graph.hpp>
+#include <pika/parallel/util/spmd_spin_barrier.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+std::size_t num_images = 10;
+
+// Replays a relaxation u = (u + 1) / 2 followed by the sum of the values
+// and compares the results with a sequential loop.
+template <typename Graph>
+void graph_test(Graph& graph, std::size_t size)
+{
+    std::size_t const images = graph.num_images();
+    std::vector<long> u(size), v(size);
+    std::iota(u.begin(), u.end(), 0L);
+    long sum = -1;
+    std::size_t steps = 0;
+    std::atomic<std::size_t> calls(0);
+
+    graph.transform(u.begin(), u.end(), v.begin(),
+        [](long value) { return value + 1; });
+    graph.for_each(v.begin(), v.end(), [](long& value) { value /= 2; });
+    graph.transform_reduce(
+        v.begin(), v.end(), sum, 0L, std::plus<>(), [](long value) {
+            return value;
+        });
+    graph.add([&](pika::spmd_block const& block) {
+        ++calls;
+        if (block.this_image() == 0)
+        {
+            ++steps;
+        }
+
+        // the images continue their collectives across replays
+        PIKA_TEST_EQ(block.all_reduce(std::size_t(1), std::plus<>()), images);
+    });
+    graph.transform(v.begin(), v.end(), u.begin(),
+        [](long value) { return value; });
+    PIKA_TEST_EQ(graph.num_steps(), std::size_t(5));
+
+    graph.replay(3);
+    graph.replay(0);
+    graph.replay(2);
+
+    std::vector<long> expected(size);
+    std::iota(expected.begin(), expected.end(), 0L);
+    long expected_sum = 0;
+    for (int i = 0; i != 5; ++i)
+    {
+        expected_sum = 0;
+        for (long& value : expected)
+        {
+            value = (value + 1) / 2;
+            expected_sum += value;
+        }
+    }
+
+    PIKA_TEST(u == expected);
+    PIKA_TEST_EQ(sum, expected_sum);
+    PIKA_TEST_EQ(steps, std::size_t(5));
+    PIKA_TEST_EQ(calls.load(), 5 * images);
+}
+
+int pika_main()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        for (std::size_t images : {num_images, std::size_t(1)})
+        {
+            pika::spmd_graph<> graph(images);
+            graph_test(graph, size);
+        }
+
+        // the images wait in a spinning barrier
+        pika::spmd_graph graph(4, par.with(spmd_spin_barrier()));
+        graph_test(graph, size);
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    PIKA_TEST_EQ(pika::init(pika_main, argc, argv), 0);
+    return 0;
+}
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/spmd_array.hpp>
+#include <pika/parallel/spmd_block.hpp>
+#include <pika/parallel/spmd_team_policy.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+std::size_t num_images = 10;
+
+void team_test_function(pika::spmd_block block, std::vector<long>* values,
+    std::vector<long>* results, pika::spmd_array<long> const* layout)
+{
+    pika::execution::spmd_team_policy team(block);
+    std::size_t const size = values->size();
+
+    pika::fill(team, values->begin(), values->end(), 1L);
+    for (long value : *values)
+    {
+        PIKA_TEST_EQ(value, 1L);
+    }
+    block.sync_all();
+
+    pika::for_each(team, values->begin(), values->end(),
+        [](long& value) { value = 3; });
+    auto it = pika::for_each_n(
+        team, values->begin(), size, [](long& value) { ++value; });
+    PIKA_TEST(it == values->end());
+    for (long value : *values)
+    {
+        PIKA_TEST_EQ(value, 4L);
+    }
+    block.sync_all();
+
+    // every image processes the part it owns in an spmd_array of the same
+    // size
+    pika::for_each(team, values->begin(), values->end(),
+        [&](long& value) { value = static_cast<long>(block.this_image()); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(static_cast<std::size_t>((*values)[i]), layout->owner(i));
+    }
+    block.sync_all();
+
+    pika::for_each(team, values->begin(), values->end(),
+        [first = values->data()](long& value) { value = &value - first; });
+
+    auto dest = pika::transform(team, values->begin(), values->end(),
+        results->begin(), [](long value) { return 2 * value; });
+    PIKA_TEST(dest == results->end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ((*results)[i], 2 * static_cast<long>(i));
+    }
+
+    long const sum =
+        std::accumulate(values->begin(), values->end(), 5L, std::plus<>());
+    PIKA_TEST_EQ(
+        pika::reduce(team, values->begin(), values->end(), 5L, std::plus<>()),
+        sum);
+
+    auto square = [](long value) { return value * value; };
+    long const squares = std::inner_product(
+        values->begin(), values->end(), values->begin(), 0L);
+    PIKA_TEST_EQ(pika::transform_reduce(team, values->begin(), values->end(),
+                     0L, std::plus<>(), square),
+        squares);
+
+    auto last =
+        pika::copy(team, results->begin(), results->end(), values->begin());
+    PIKA_TEST(last == values->end());
+    PIKA_TEST(*values == *results);
+    block.sync_all();
+}
+
+void team_test(std::size_t images, std::size_t size)
+{
+    std::vector<long> values(size), results(size);
+    pika::spmd_array<long> const layout(images, size);
+
+    pika::define_spmd_block(
+        images, team_test_function, &values, &results, &layout);
+}
+
+int pika_main()
+{
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        team_test(num_images, size);
+        team_test(1, size);
+    }
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    PIKA_TEST_EQ(pika::init(pika_main, argc, argv), 0);
+    return 0;
+}
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <numeric>
 #include <random>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -358,4 +359,20 @@ namespace test {
 
         return std::equal(first1, last1, first2);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs the algorithm invoked by f and waits for its result if the policy
+    // is asynchronous
+    template <typename ExPolicy, typename F>
+    decltype(auto) run(F&& f)
+    {
+        if constexpr (pika::is_async_execution_policy_v<std::decay_t<ExPolicy>>)
+        {
+            return f().get();
+        }
+        else
+        {
+            return f();
+        }
+    }
 }    // namespace test
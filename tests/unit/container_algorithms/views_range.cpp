@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/container_algorithms/for_each.hpp>
+#include <pika/parallel/container_algorithms/reduce.hpp>
+#include <pika/parallel/container_algorithms/transform_reduce.hpp>
+#include <pika/parallel/container_algorithms/views.hpp>
+#include <pika/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_views(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(1 + gen() % 1000));
+
+    // transformed
+    auto squares = pika::ranges::transformed(
+        c, [](std::size_t value) { return value * value; });
+    std::size_t expected = std::transform_reduce(c.begin(), c.end(),
+        std::size_t(1), std::plus<>(),
+        [](std::size_t value) { return value * value; });
+    PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+        return pika::ranges::reduce(policy, squares, std::size_t(1));
+    }),
+        expected);
+    PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+        return pika::ranges::transform_reduce(policy, squares,
+            std::size_t(0), std::plus<>(),
+            [](std::size_t value) { return value + 1; });
+    }),
+        expected - 1 + size);
+
+    // strided, the last stride is partial
+    std::size_t const stride = 7;
+    auto every_seventh = pika::ranges::strided(c, stride);
+    PIKA_TEST_EQ(
+        static_cast<std::size_t>(
+            std::distance(every_seventh.begin(), every_seventh.end())),
+        (size + stride - 1) / stride);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(
+            policy, every_seventh, [](std::size_t& value) { value = 0; });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(c[i] == 0, i % stride == 0);
+    }
+
+    // iota
+    auto indices = pika::ranges::iota(std::size_t(0), size);
+    std::atomic<std::size_t> sum(0);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(
+            policy, indices, [&](std::size_t i) { sum += i; });
+    });
+    PIKA_TEST_EQ(sum.load(), size * (size - 1) / 2);
+
+    // filtered, for_each runs over the base range
+    std::vector<int> d(size);
+    std::iota(d.begin(), d.end(), 0);
+    auto odd = pika::ranges::filtered(d, [](int value) { return value % 2; });
+    auto last = test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(
+            policy, odd, [](int& value) { value = -value; });
+    });
+    PIKA_TEST(last == odd.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], i % 2 ? -int(i) : int(i));
+    }
+
+    // zipped, the view is as long as the shorter range
+    std::vector<int> e(size + 3, 1);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(policy, pika::ranges::zipped(d, e),
+            [](auto t) { std::get<1>(t) += std::get<0>(t); });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(e[i], d[i] + 1);
+    }
+    PIKA_TEST_EQ(e[size], 1);
+
+    // views of views
+    auto odd_squares = pika::ranges::transformed(
+        pika::ranges::filtered(c, [](std::size_t value) { return value % 2; }),
+        [](std::size_t value) { return value * value; });
+    std::size_t expected_odd = 0;
+    for (std::size_t value : c)
+    {
+        expected_odd += value % 2 ? value * value : 0;
+    }
+    PIKA_TEST_EQ(test::run<ExPolicy>([&] {
+        return pika::ranges::reduce(policy, odd_squares, std::size_t(0));
+    }),
+        expected_odd);
+}
+
+void test_views_sequential()
+{
+    // views of ranges which are not random access
+    std::list<int> l(100);
+    std::iota(l.begin(), l.end(), 0);
+    auto even =
+        pika::ranges::filtered(l, [](int value) { return value % 2 == 0; });
+    PIKA_TEST_EQ(std::accumulate(even.begin(), even.end(), 0), 2450);
+
+    auto doubled =
+        pika::ranges::transformed(l, [](int value) { return 2 * value; });
+    PIKA_TEST_EQ(pika::ranges::reduce(doubled, 0), 9900);
+}
+
+void views_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100003})
+    {
+        test_views(seq, size);
+        test_views(par, size);
+        test_views(par_unseq, size);
+        test_views(seq(task), size);
+        test_views(par(task), size);
+    }
+
+    test_views_sequential();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    views_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/adjacent_find.hpp>
+#include <pika/parallel/algorithms/is_sorted.hpp>
+#include <pika/parallel/algorithms/sort.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// A sorted range in which the element at the given position is ordered after
+// its successor, a position of size leaves it sorted.
+template <typename T>
+std::vector<T> make_input(std::size_t size, std::size_t pos)
+{
+    std::vector<T> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = T(i * 250 / size);
+    }
+    if (pos + 1 < size)
+    {
+        c[pos] = T(c[pos + 1] + 1);
+    }
+    return c;
+}
+
+template <typename ExPolicy, typename T>
+void test_adjacent_find(ExPolicy&& policy, std::size_t size, std::size_t pos)
+{
+    std::vector<T> const c = make_input<T>(size, pos);
+
+    auto r = test::run<ExPolicy>(
+        [&] { return pika::is_sorted_until(policy, c.begin(), c.end()); });
+    PIKA_TEST(r == std::is_sorted_until(c.begin(), c.end()));
+    r = test::run<ExPolicy>([&] {
+        return pika::is_sorted_until(
+            policy, c.begin(), c.end(), std::greater<T>());
+    });
+    PIKA_TEST(r == std::is_sorted_until(c.begin(), c.end(), std::greater<T>()));
+    bool const sorted = test::run<ExPolicy>(
+        [&] { return pika::is_sorted(policy, c.begin(), c.end()); });
+    PIKA_TEST_EQ(sorted, std::is_sorted(c.begin(), c.end()));
+
+    // a single pair of equal neighbours at the given position
+    std::vector<T> d(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        d[i] = T(i % 2);
+    }
+    if (pos + 1 < size)
+    {
+        d[pos + 1] = d[pos];
+    }
+
+    auto it = test::run<ExPolicy>(
+        [&] { return pika::adjacent_find(policy, d.begin(), d.end()); });
+    PIKA_TEST(it == std::adjacent_find(d.begin(), d.end()));
+    it = test::run<ExPolicy>([&] {
+        return pika::adjacent_find(policy, d.begin(), d.end(), std::less<T>());
+    });
+    PIKA_TEST(it == std::adjacent_find(d.begin(), d.end(), std::less<T>()));
+}
+
+template <typename ExPolicy, typename T>
+void test_adjacent_find(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 2, 3, 17, 1000, 100007})
+    {
+        std::size_t const last_pair = size < 2 ? 0 : size - 2;
+        for (std::size_t pos : {std::size_t(0), size / 3, last_pair, size})
+        {
+            test_adjacent_find<ExPolicy, T>(policy, size, pos);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_adjacent_find(ExPolicy&& policy)
+{
+    test_adjacent_find<ExPolicy, std::uint8_t>(policy);
+    test_adjacent_find<ExPolicy, int>(policy);
+    test_adjacent_find<ExPolicy, double>(policy);
+}
+
+// sort returns early for sorted input
+template <typename ExPolicy>
+void test_sort_sorted(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        std::vector<int> c = make_input<int>(size, size);
+        std::vector<int> const expected = c;
+        test::run<ExPolicy>(
+            [&] { return pika::sort(policy, c.begin(), c.end()); });
+        PIKA_TEST(c == expected);
+
+        if (size > 1)
+        {
+            std::swap(c[size / 2], c[size / 2 + 1]);
+            test::run<ExPolicy>(
+                [&] { return pika::sort(policy, c.begin(), c.end()); });
+            PIKA_TEST(c == expected);
+        }
+    }
+}
+
+void adjacent_find_test()
+{
+    using namespace pika::execution;
+
+    test_adjacent_find(simd);
+    test_adjacent_find(par_simd);
+
+    test_adjacent_find(simd(task));
+    test_adjacent_find(par_simd(task));
+
+    test_sort_sorted(simd);
+    test_sort_sorted(par_simd);
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    adjacent_find_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
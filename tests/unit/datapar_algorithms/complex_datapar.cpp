@@ -0,0 +1,197 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<std::complex<T>> make_complex(std::size_t size)
+{
+    std::vector<std::complex<T>> c(size);
+    for (auto& z : c)
+    {
+        z = std::complex<T>(T(std::rand()) / T(RAND_MAX) - T(0.5),
+            T(std::rand()) / T(RAND_MAX) - T(0.5));
+    }
+    return c;
+}
+
+template <typename T>
+bool close(std::complex<T> lhs, std::complex<T> rhs, T tolerance)
+{
+    return std::abs(lhs - rhs) <= tolerance * (T(1) + std::abs(rhs));
+}
+
+template <typename T>
+T tolerance(std::size_t size)
+{
+    return T(16) * std::numeric_limits<T>::epsilon() * T(size + 1);
+}
+
+// the functions are invoked with complex packs and with std::complex alike
+template <typename T, typename ExPolicy>
+void test_transform_complex(ExPolicy&& policy, std::size_t size)
+{
+    using complex_type = std::complex<T>;
+    auto const c1 = make_complex<T>(size);
+    auto const c2 = make_complex<T>(size);
+
+    // complex results are interleaved again
+    std::vector<complex_type> d(size);
+    pika::transform(policy, c1.begin(), c1.end(), d.begin(),
+        [](auto z) { return z * z + complex_type(T(1), T(-1)); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST(close(d[i], c1[i] * c1[i] + complex_type(T(1), T(-1)),
+            tolerance<T>(1)));
+    }
+
+    // real results are stored as they are
+    std::vector<T> n(size);
+    pika::transform(policy, c1.begin(), c1.end(), n.begin(),
+        [](auto z) { return norm(z); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_LTE(std::abs(n[i] - std::norm(c1[i])), tolerance<T>(1));
+    }
+
+    pika::transform(policy, c1.begin(), c1.end(), c2.begin(), d.begin(),
+        [](auto z1, auto z2) { return z1 * conj(z2) - z2; });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST(close(
+            d[i], c1[i] * std::conj(c2[i]) - c2[i], tolerance<T>(1)));
+    }
+
+    // functions accepting std::complex only are applied element-wise
+    pika::transform(policy, c1.begin(), c1.end(), d.begin(),
+        [](complex_type z) { return std::exp(z); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST(close(d[i], std::exp(c1[i]), tolerance<T>(1)));
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_for_each_complex(ExPolicy&& policy, std::size_t size)
+{
+    using complex_type = std::complex<T>;
+    auto const c = make_complex<T>(size);
+
+    auto d = c;
+    pika::for_each(policy, d.begin(), d.end(),
+        [](auto& z) { z = z * complex_type(T(0), T(2)) + T(1); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST(close(d[i], c[i] * complex_type(T(0), T(2)) + T(1),
+            tolerance<T>(1)));
+    }
+}
+
+template <typename T, typename ExPolicy>
+void test_reduce_complex(ExPolicy&& policy, std::size_t size)
+{
+    using complex_type = std::complex<T>;
+    auto const c1 = make_complex<T>(size);
+    auto const c2 = make_complex<T>(size);
+
+    complex_type const init(T(0.5), T(-0.5));
+    complex_type sum = init;
+    complex_type squares = init;
+    complex_type dot = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum += c1[i];
+        squares += c1[i] * c1[i];
+        dot += c1[i] * c2[i];
+    }
+
+    complex_type r = pika::reduce(policy, c1.begin(), c1.end(), init);
+    PIKA_TEST(close(r, sum, tolerance<T>(size)));
+
+    r = pika::transform_reduce(policy, c1.begin(), c1.end(), init,
+        std::plus<>(), [](auto z) { return z * z; });
+    PIKA_TEST(close(r, squares, tolerance<T>(size)));
+
+    r = pika::transform_reduce(
+        policy, c1.begin(), c1.end(), c2.begin(), init);
+    PIKA_TEST(close(r, dot, tolerance<T>(size)));
+}
+
+template <typename T>
+void test_complex()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 16, 1007, 100007})
+    {
+        test_transform_complex<T>(simd, size);
+        test_transform_complex<T>(par_simd, size);
+
+        test_for_each_complex<T>(simd, size);
+        test_for_each_complex<T>(par_simd, size);
+
+        test_reduce_complex<T>(simd, size);
+        test_reduce_complex<T>(par_simd, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_complex<float>();
+    test_complex<double>();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
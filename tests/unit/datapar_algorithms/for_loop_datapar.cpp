@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/algorithm.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// the loop variable, the induction and the reduction values are packs with
+// the same number of elements
+template <typename ExPolicy>
+void test_for_loop_idx(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::int64_t> c(size, -1);
+    std::int64_t sum = 0;
+    std::int64_t count = 7;
+
+    test::run<ExPolicy>([&] {
+        return pika::for_loop(policy, std::int64_t(0), std::int64_t(size),
+            pika::induction(count, 3), pika::reduction_plus(sum),
+            [&](auto i, auto k, auto& s) {
+                PIKA_TEST_EQ(i.size(), k.size());
+                PIKA_TEST_EQ(i.size(), s.size());
+                for (std::size_t l = 0; l != i.size(); ++l)
+                {
+                    c[i[l]] = k[l];
+                }
+                s += i * 2;
+            });
+    });
+
+    std::int64_t expected_sum = 0;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(c[i], std::int64_t(7 + 3 * i));
+        expected_sum += 2 * std::int64_t(i);
+    }
+    PIKA_TEST_EQ(sum, expected_sum);
+    PIKA_TEST_EQ(count, std::int64_t(7 + 3 * size));
+}
+
+template <typename ExPolicy>
+void test_for_loop_iter(ExPolicy&& policy, std::size_t size)
+{
+    // start at an unaligned element
+    std::vector<double> c(size + 1);
+    std::uniform_real_distribution<double> dis(-100.0, 100.0);
+    for (double& d : c)
+    {
+        d = dis(gen);
+    }
+    std::vector<double> const expected = c;
+
+    double max_value = -1000.0;
+    test::run<ExPolicy>([&] {
+        return pika::for_loop(policy, c.begin() + 1, c.end(),
+            pika::induction(0.0, 2), pika::reduction_max(max_value),
+            [](auto it, auto k, auto& m) {
+                for (std::size_t l = 0; l != m.size(); ++l)
+                {
+                    if (m[l] < (*it)[l])
+                        m[l] = (*it)[l];
+                }
+                *it = *it + k;
+            });
+    });
+
+    double expected_max = -1000.0;
+    for (std::size_t i = 1; i != size + 1; ++i)
+    {
+        PIKA_TEST_EQ(c[i], expected[i] + 2.0 * double(i - 1));
+        expected_max = (std::max)(expected_max, expected[i]);
+    }
+    PIKA_TEST_EQ(c[0], expected[0]);
+    PIKA_TEST_EQ(max_value, expected_max);
+}
+
+// reductions on non-arithmetic types are invoked one element at a time
+template <typename ExPolicy>
+void test_for_loop_scalar(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::size_t> hist(16, 0);
+    test::run<ExPolicy>([&] {
+        return pika::for_loop(policy, std::size_t(0), size,
+            pika::reduction_array(
+                hist.data(), hist.size(), std::size_t(0), std::plus<>()),
+            [](std::size_t i, std::size_t* h) { ++h[i % 16]; });
+    });
+
+    for (std::size_t b = 0; b != 16; ++b)
+    {
+        PIKA_TEST_EQ(hist[b], size / 16 + (b < size % 16 ? 1 : 0));
+    }
+}
+
+void for_loop_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 8, 9, 1000, 100007})
+    {
+        test_for_loop_idx(simd, size);
+        test_for_loop_idx(par_simd, size);
+        test_for_loop_idx(simd(task), size);
+        test_for_loop_idx(par_simd(task), size);
+
+        test_for_loop_iter(simd, size);
+        test_for_loop_iter(par_simd, size);
+        test_for_loop_iter(par_simd(task), size);
+
+        test_for_loop_scalar(simd, size);
+        test_for_loop_scalar(par_simd, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_loop_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Writes twice the index to the contiguous element, the datapar loops invoke
+// this with packs of consecutive indices.
+struct assign_index
+{
+    template <typename Tuple>
+    void operator()(Tuple&& t) const
+    {
+        std::get<1>(t) = std::get<0>(t) + std::get<0>(t);
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_for_each_counting(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+    T const base = T(dis(gen));
+
+    std::vector<T> d(size);
+    auto first = pika::util::make_zip_iterator(
+        pika::util::make_counting_iterator(base), d.begin());
+    auto last = pika::util::make_zip_iterator(
+        pika::util::make_counting_iterator(T(base + T(size))), d.end());
+
+    test::run<ExPolicy>(
+        [&] { return pika::for_each(policy, first, last, assign_index()); });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], T(2 * (base + T(i))));
+    }
+}
+
+// The index spaces not zipped with other sequences, the loops of the non
+// vectorizing policies run over the integers directly.
+template <typename ExPolicy, typename T>
+void test_for_each_index_space(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<T> d(size);
+    test::run<ExPolicy>([&] {
+        return pika::for_each(policy, pika::util::make_counting_iterator(T(0)),
+            pika::util::make_counting_iterator(T(size)),
+            [&](T i) { d[std::size_t(i)] = T(i + 1); });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], T(i + 1));
+    }
+}
+
+template <typename ExPolicy>
+void test_for_each_counting(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_for_each_counting<ExPolicy, int>(policy, size);
+        test_for_each_counting<ExPolicy, std::int64_t>(policy, size);
+    }
+}
+
+template <typename ExPolicy>
+void test_for_each_index_space(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_for_each_index_space<ExPolicy, int>(policy, size);
+        test_for_each_index_space<ExPolicy, std::size_t>(policy, size);
+    }
+}
+
+void for_each_counting_test()
+{
+    using namespace pika::execution;
+
+    test_for_each_counting(simd);
+    test_for_each_counting(par_simd);
+
+    test_for_each_counting(simd(task));
+    test_for_each_counting(par_simd(task));
+
+    test_for_each_index_space(seq);
+    test_for_each_index_space(par);
+    test_for_each_index_space(par(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_each_counting_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
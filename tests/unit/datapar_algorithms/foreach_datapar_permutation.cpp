@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/iterator_support/zip_iterator.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/parallel/util/permutation_iterator.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Reads the gathered element and writes the contiguous one.
+struct gather_twice
+{
+    template <typename Tuple>
+    void operator()(Tuple&& t) const
+    {
+        std::get<1>(t) = std::get<0>(t) + std::get<0>(t);
+    }
+};
+
+// Writes the scattered element from the contiguous one.
+struct scatter_incremented
+{
+    template <typename Tuple>
+    void operator()(Tuple&& t) const
+    {
+        std::get<0>(t) = std::get<1>(t) + 1;
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_for_each_permutation(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    // a permutation, such that the scattered elements are distinct
+    std::vector<std::size_t> indices(size);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    std::shuffle(indices.begin(), indices.end(), gen);
+
+    std::vector<T> d(size);
+    {
+        auto first = pika::util::make_zip_iterator(
+            pika::util::make_permutation_iterator(c.begin(), indices.begin()),
+            d.begin());
+        auto last = pika::util::make_zip_iterator(
+            pika::util::make_permutation_iterator(c.begin(), indices.end()),
+            d.end());
+
+        test::run<ExPolicy>([&] {
+            return pika::for_each(policy, first, last, gather_twice());
+        });
+    }
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], T(c[indices[i]] + c[indices[i]]));
+    }
+
+    std::vector<T> e(size);
+    {
+        auto first = pika::util::make_zip_iterator(
+            pika::util::make_permutation_iterator(e.begin(), indices.begin()),
+            c.begin());
+        auto last = pika::util::make_zip_iterator(
+            pika::util::make_permutation_iterator(e.begin(), indices.end()),
+            c.end());
+
+        test::run<ExPolicy>([&] {
+            return pika::for_each(policy, first, last, scatter_incremented());
+        });
+    }
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(e[indices[i]], T(c[i] + 1));
+    }
+}
+
+template <typename ExPolicy>
+void test_for_each_permutation(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_for_each_permutation<ExPolicy, int>(policy, size);
+        test_for_each_permutation<ExPolicy, float>(policy, size);
+        test_for_each_permutation<ExPolicy, double>(policy, size);
+    }
+}
+
+void for_each_permutation_test()
+{
+    using namespace pika::execution;
+
+    test_for_each_permutation(simd);
+    test_for_each_permutation(par_simd);
+
+    test_for_each_permutation(simd(task));
+    test_for_each_permutation(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    for_each_permutation_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
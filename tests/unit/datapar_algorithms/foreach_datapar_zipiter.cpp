@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,17 @@ struct set_42
     }
 };
 
+struct update_members
+{
+    template <typename Tuple>
+    void operator()(Tuple&& t)
+    {
+        std::get<0>(t) += 1;
+        std::get<1>(t) *= 2;
+        std::get<2>(t) = 3;
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void for_each_zipiter_test(ExPolicy&& policy, IteratorTag)
@@ -84,6 +96,36 @@ void for_each_zipiter_test(ExPolicy&& policy, IteratorTag)
         "foo");*/
 }
 
+// The native packs of the element types differ in size, every element has to
+// be visited exactly once nevertheless.
+template <typename ExPolicy>
+void for_each_zipiter_mixed_test(ExPolicy&& policy)
+{
+    std::vector<int> c(10007);
+    std::vector<double> d(10007);
+    std::vector<char> e(10007);
+    std::iota(std::begin(c), std::end(c), std::rand() % 1000);
+    std::iota(std::begin(d), std::end(d), double(std::rand() % 1000));
+
+    std::vector<int> const c_orig = c;
+    std::vector<double> const d_orig = d;
+
+    auto begin = pika::util::make_zip_iterator(
+        std::begin(c), std::begin(d), std::begin(e));
+    auto end =
+        pika::util::make_zip_iterator(std::end(c), std::end(d), std::end(e));
+
+    pika::for_each(
+        std::forward<ExPolicy>(policy), begin, end, update_members());
+
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        PIKA_TEST_EQ(c[i], c_orig[i] + 1);
+        PIKA_TEST_EQ(d[i], 2 * d_orig[i]);
+        PIKA_TEST_EQ(e[i], char(3));
+    }
+}
+
 template <typename IteratorTag>
 void for_each_zipiter_test()
 {
@@ -96,6 +138,8 @@ void for_each_zipiter_test()
 void for_each_zipiter_test()
 {
     for_each_zipiter_test<std::random_access_iterator_tag>();
+    for_each_zipiter_mixed_test(pika::execution::simd);
+    for_each_zipiter_mixed_test(pika::execution::par_simd);
     //    for_each_zipiter_test<std::forward_iterator_tag>();
     //    for_each_zipiter_test<std::input_iterator_tag>();
 }
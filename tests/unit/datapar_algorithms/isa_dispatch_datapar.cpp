@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_reduce.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace detail = pika::parallel::detail;
+namespace traits = pika::parallel::traits::detail;
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+struct selected_isa_kernel
+{
+    template <detail::datapar_isa Isa>
+    static detail::datapar_isa call()
+    {
+        return Isa;
+    }
+};
+
+template <typename T>
+struct sum_kernel
+{
+    template <detail::datapar_isa Isa>
+    static T call(T const* p, std::size_t count)
+    {
+        using V = detail::datapar_isa_pack_t<T, Isa>;
+        constexpr std::size_t size = traits::vector_pack_size<V>::value;
+
+        V sum(T(0));
+        std::size_t i = 0;
+        for (/**/; count - i >= size; i += size)
+        {
+            sum = sum + traits::vector_pack_load<V, T>::unaligned(p + i);
+        }
+
+        T result = traits::reduce(sum, std::plus<>());
+        for (/**/; i != count; ++i)
+        {
+            result += p[i];
+        }
+        return result;
+    }
+};
+
+template <typename T>
+void test_isa_dispatch(std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    // the integer sums are exact for any order of evaluation
+    using dispatch =
+        detail::datapar_isa_dispatch<sum_kernel<T>, T, T const*, std::size_t>;
+    T const expected = sum_kernel<T>::template call<
+        detail::datapar_isa::baseline>(c.data(), size);
+
+    PIKA_TEST_EQ(dispatch::call(c.data(), size), expected);
+
+    // the variant is cached, the second call takes the same path
+    PIKA_TEST_EQ(dispatch::call(c.data(), size), expected);
+}
+
+void isa_dispatch_test()
+{
+    using dispatch =
+        detail::datapar_isa_dispatch<selected_isa_kernel, detail::datapar_isa>;
+
+    detail::datapar_isa const isa = dispatch::call();
+    std::cout << "selected isa: " << static_cast<int>(isa) << std::endl;
+    PIKA_TEST(isa == detail::detected_datapar_isa());
+    PIKA_TEST(dispatch::call() == isa);
+
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_isa_dispatch<std::int32_t>(size);
+        test_isa_dispatch<std::int64_t>(size);
+        test_isa_dispatch<std::uint8_t>(size);
+    }
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    isa_dispatch_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
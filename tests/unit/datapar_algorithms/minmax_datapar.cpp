@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/minmax.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are drawn from a small range, so that the smallest and the
+// largest value occur several times. The results have to be the same
+// elements as the ones found by the scalar algorithms.
+template <typename ExPolicy, typename T>
+void test_minmax_element(ExPolicy&& policy, std::size_t size, int range)
+{
+    std::uniform_int_distribution<int> dis(0, range);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    using pika::execution::seq;
+
+    auto min = test::run<ExPolicy>(
+        [&] { return pika::min_element(policy, c.begin(), c.end()); });
+    PIKA_TEST(min == pika::min_element(seq, c.begin(), c.end()));
+
+    auto max = test::run<ExPolicy>(
+        [&] { return pika::max_element(policy, c.begin(), c.end()); });
+    PIKA_TEST(max == pika::max_element(seq, c.begin(), c.end()));
+
+    auto minmax = test::run<ExPolicy>(
+        [&] { return pika::minmax_element(policy, c.begin(), c.end()); });
+    auto expected = pika::minmax_element(seq, c.begin(), c.end());
+    PIKA_TEST(minmax.min == expected.min);
+    PIKA_TEST(minmax.max == expected.max);
+
+    auto min_less = test::run<ExPolicy>([&] {
+        return pika::min_element(policy, c.begin(), c.end(), std::less<T>());
+    });
+    PIKA_TEST(min_less == min);
+}
+
+template <typename ExPolicy, typename T>
+void test_minmax_element(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_minmax_element<ExPolicy, T>(policy, size, 3);
+        test_minmax_element<ExPolicy, T>(policy, size, 100);
+    }
+}
+
+template <typename ExPolicy>
+void test_minmax_element(ExPolicy&& policy)
+{
+    test_minmax_element<ExPolicy, std::uint8_t>(policy);
+    test_minmax_element<ExPolicy, int>(policy);
+    test_minmax_element<ExPolicy, float>(policy);
+    test_minmax_element<ExPolicy, double>(policy);
+}
+
+void minmax_element_test()
+{
+    using namespace pika::execution;
+
+    test_minmax_element(simd);
+    test_minmax_element(par_simd);
+
+    test_minmax_element(simd(task));
+    test_minmax_element(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
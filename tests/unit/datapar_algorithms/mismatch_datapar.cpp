@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/ends_with.hpp>
+#include <pika/parallel/algorithms/equal.hpp>
+#include <pika/parallel/algorithms/lexicographical_compare.hpp>
+#include <pika/parallel/algorithms/mismatch.hpp>
+#include <pika/parallel/algorithms/starts_with.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Compares a range with a copy which differs at the given position only, a
+// position of size leaves both equal.
+template <typename ExPolicy, typename T>
+void test_mismatch(ExPolicy&& policy, std::size_t size, std::size_t pos)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> d = c;
+    if (pos != size)
+    {
+        d[pos] = T(c[pos] + 1);
+    }
+
+    auto r1 = test::run<ExPolicy>([&] {
+        return pika::mismatch(policy, c.begin(), c.end(), d.begin(), d.end());
+    });
+    PIKA_TEST(r1.first == std::next(c.begin(), pos));
+    PIKA_TEST(r1.second == std::next(d.begin(), pos));
+
+    auto r2 = test::run<ExPolicy>(
+        [&] { return pika::mismatch(policy, c.begin(), c.end(), d.begin()); });
+    PIKA_TEST(r2.first == std::next(c.begin(), pos));
+    PIKA_TEST(r2.second == std::next(d.begin(), pos));
+
+    // a shorter second range stops the comparison early
+    if (size != 0)
+    {
+        auto r3 = test::run<ExPolicy>([&] {
+            return pika::mismatch(
+                policy, c.begin(), c.end(), d.begin(), std::prev(d.end()));
+        });
+        std::size_t const expected = (std::min)(pos, size - 1);
+        PIKA_TEST(r3.first == std::next(c.begin(), expected));
+    }
+
+    bool const equal = pos == size;
+    bool r = test::run<ExPolicy>([&] {
+        return pika::equal(policy, c.begin(), c.end(), d.begin(), d.end());
+    });
+    PIKA_TEST_EQ(r, equal);
+    r = test::run<ExPolicy>(
+        [&] { return pika::equal(policy, c.begin(), c.end(), d.begin()); });
+    PIKA_TEST_EQ(r, equal);
+    r = test::run<ExPolicy>([&] {
+        return pika::equal(policy, c.begin(), c.end(), d.begin(), d.end(),
+            std::equal_to<T>());
+    });
+    PIKA_TEST_EQ(r, equal);
+
+    r = test::run<ExPolicy>([&] {
+        return pika::lexicographical_compare(
+            policy, c.begin(), c.end(), d.begin(), d.end());
+    });
+    PIKA_TEST_EQ(r,
+        std::lexicographical_compare(c.begin(), c.end(), d.begin(), d.end()));
+    r = test::run<ExPolicy>([&] {
+        return pika::lexicographical_compare(
+            policy, d.begin(), d.end(), c.begin(), c.end());
+    });
+    PIKA_TEST_EQ(r,
+        std::lexicographical_compare(d.begin(), d.end(), c.begin(), c.end()));
+
+    // prefixes and suffixes
+    std::size_t const half = size / 2;
+    r = test::run<ExPolicy>([&] {
+        return pika::starts_with(policy, c.begin(), c.end(), d.begin(),
+            std::next(d.begin(), half));
+    });
+    PIKA_TEST_EQ(r, pos >= half);
+    r = test::run<ExPolicy>([&] {
+        return pika::ends_with(policy, c.begin(), c.end(),
+            std::next(d.begin(), half), d.end());
+    });
+    PIKA_TEST_EQ(r, pos < half || pos == size);
+}
+
+template <typename ExPolicy, typename T>
+void test_mismatch(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 3, 17, 1000, 100007})
+    {
+        for (std::size_t pos : {std::size_t(0), size / 3, size - 1, size})
+        {
+            if (pos <= size)
+            {
+                test_mismatch<ExPolicy, T>(policy, size, pos);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_mismatch(ExPolicy&& policy)
+{
+    test_mismatch<ExPolicy, std::uint8_t>(policy);
+    test_mismatch<ExPolicy, int>(policy);
+    test_mismatch<ExPolicy, double>(policy);
+}
+
+void mismatch_test()
+{
+    using namespace pika::execution;
+
+    test_mismatch(simd);
+    test_mismatch(par_simd);
+
+    test_mismatch(simd(task));
+    test_mismatch(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    mismatch_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/remove.hpp>
+#include <pika/parallel/algorithms/remove_copy.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Small value ranges produce packs which are removed or kept as a whole as
+// well as packs which are partially compacted.
+template <typename ExPolicy, typename T>
+void test_remove(ExPolicy&& policy, std::size_t size, int range)
+{
+    std::uniform_int_distribution<int> dis(0, range);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> expected;
+    for (auto const& v : c)
+    {
+        if (v != T(0))
+            expected.push_back(v);
+    }
+
+    std::vector<T> d = c;
+    auto result = test::run<ExPolicy>(
+        [&] { return pika::remove(policy, d.begin(), d.end(), T(0)); });
+    PIKA_TEST(result == d.begin() + expected.size());
+    PIKA_TEST(std::equal(d.begin(), result, expected.begin()));
+
+    std::vector<T> e(size);
+    auto dest = test::run<ExPolicy>([&] {
+        return pika::remove_copy(policy, c.begin(), c.end(), e.begin(), T(0));
+    });
+    PIKA_TEST(dest == e.begin() + expected.size());
+    PIKA_TEST(std::equal(e.begin(), dest, expected.begin()));
+
+    // with a predicate which can be invoked with vector packs
+    auto pred = [](auto const& v) { return v == T(0); };
+
+    d = c;
+    result = test::run<ExPolicy>(
+        [&] { return pika::remove_if(policy, d.begin(), d.end(), pred); });
+    PIKA_TEST(result == d.begin() + expected.size());
+    PIKA_TEST(std::equal(d.begin(), result, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_remove(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 3, 17, 1000, 100007})
+    {
+        for (int range : {0, 1, 100})
+        {
+            test_remove<ExPolicy, std::uint8_t>(policy, size, range);
+            test_remove<ExPolicy, int>(policy, size, range);
+            test_remove<ExPolicy, double>(policy, size, range);
+        }
+    }
+}
+
+void remove_test()
+{
+    using namespace pika::execution;
+
+    test_remove(simd);
+    test_remove(par_simd);
+
+    test_remove(simd(task));
+    test_remove(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    remove_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/replace.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_replace(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 9);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> expected = c;
+    for (auto& v : expected)
+    {
+        if (v == T(3))
+            v = T(42);
+    }
+
+    std::vector<T> d = c;
+    test::run<ExPolicy>(
+        [&] { return pika::replace(policy, d.begin(), d.end(), T(3), T(42)); });
+    PIKA_TEST(d == expected);
+
+    // vectorized, the predicate can be invoked with vector packs
+    expected = c;
+    for (auto& v : expected)
+    {
+        if (v > T(6))
+            v = T(0);
+    }
+
+    auto pred = [](auto const& v) { return v > T(6); };
+
+    d = c;
+    test::run<ExPolicy>([&] {
+        return pika::replace_if(policy, d.begin(), d.end(), pred, T(0));
+    });
+    PIKA_TEST(d == expected);
+
+    // not vectorized, the predicate takes the elements by their type
+    auto scalar_pred = [](T const& v) -> bool { return v > T(6); };
+
+    d = c;
+    test::run<ExPolicy>([&] {
+        return pika::replace_if(policy, d.begin(), d.end(), scalar_pred, T(0));
+    });
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_replace(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 3, 17, 1000, 100007})
+    {
+        test_replace<ExPolicy, std::uint8_t>(policy, size);
+        test_replace<ExPolicy, int>(policy, size);
+        test_replace<ExPolicy, double>(policy, size);
+    }
+}
+
+void replace_test()
+{
+    using namespace pika::execution;
+
+    test_replace(simd);
+    test_replace(par_simd);
+
+    test_replace(simd(task));
+    test_replace(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    replace_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reverse.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_reverse(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> expected = c;
+    std::reverse(expected.begin(), expected.end());
+
+    std::vector<T> d = c;
+    auto r = test::run<ExPolicy>(
+        [&] { return pika::reverse(policy, d.begin(), d.end()); });
+    PIKA_TEST(r == d.end());
+    PIKA_TEST(d == expected);
+
+    std::vector<T> e(size);
+    r = test::run<ExPolicy>([&] {
+        return pika::reverse_copy(policy, c.begin(), c.end(), e.begin());
+    });
+    PIKA_TEST(r == e.end());
+    PIKA_TEST(e == expected);
+}
+
+template <typename ExPolicy>
+void test_reverse(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 3, 17, 1000, 100007})
+    {
+        test_reverse<ExPolicy, std::uint8_t>(policy, size);
+        test_reverse<ExPolicy, int>(policy, size);
+        test_reverse<ExPolicy, double>(policy, size);
+    }
+}
+
+void reverse_test()
+{
+    using namespace pika::execution;
+
+    test_reverse(simd);
+    test_reverse(par_simd);
+
+    test_reverse(simd(task));
+    test_reverse(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    reverse_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
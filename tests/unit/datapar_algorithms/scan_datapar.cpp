@@ -0,0 +1,131 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/exclusive_scan.hpp>
+#include <pika/parallel/algorithms/inclusive_scan.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename Op>
+void test_scan(ExPolicy&& policy, std::size_t size, T init, Op op)
+{
+    std::uniform_int_distribution<int> dis(1, 7);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    // the unsigned integer results are exact for any order of evaluation
+    std::vector<T> expected(size);
+    T sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        sum = op(sum, c[i]);
+        expected[i] = sum;
+    }
+
+    std::vector<T> d(size);
+    test::run<ExPolicy>([&] {
+        return pika::inclusive_scan(
+            policy, c.begin(), c.end(), d.begin(), op, init);
+    });
+    PIKA_TEST(d == expected);
+
+    sum = init;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[i] = sum;
+        sum = op(sum, c[i]);
+    }
+
+    // in place
+    test::run<ExPolicy>([&] {
+        return pika::exclusive_scan(
+            policy, c.begin(), c.end(), c.begin(), init, op);
+    });
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_scan(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 3, 17, 1000, 100007})
+    {
+        test_scan(policy, size, std::uint32_t(5), std::plus<>());
+        test_scan(policy, size, std::uint64_t(0), std::plus<std::uint64_t>());
+        test_scan(policy, size, std::uint32_t(1), std::multiplies<>());
+        test_scan(
+            policy, size, std::uint16_t(3), std::multiplies<std::uint16_t>());
+
+        // not vectorized
+        test_scan(policy, size, std::uint32_t(0),
+            [](std::uint32_t a, std::uint32_t b) { return a ^ b; });
+    }
+}
+
+void scan_test()
+{
+    using namespace pika::execution;
+
+    test_scan(simd);
+    test_scan(par_simd);
+
+    test_scan(simd(task));
+    test_scan(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    scan_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
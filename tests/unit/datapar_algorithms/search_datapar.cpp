@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/find.hpp>
+#include <pika/parallel/algorithms/search.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Searches a range of few distinct values for a sequence which is copied into
+// it at pos, such that many candidates pass the first and last element test.
+template <typename ExPolicy, typename T>
+void test_search(ExPolicy&& policy, std::size_t size, std::size_t pos,
+    std::size_t s_size)
+{
+    std::uniform_int_distribution<int> dis(0, 3);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> s(s_size);
+    for (auto& v : s)
+    {
+        v = T(dis(gen));
+    }
+    std::copy(s.begin(), s.end(), std::next(c.begin(), pos));
+
+    auto const expected = std::search(c.begin(), c.end(), s.begin(), s.end());
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::search(policy, c.begin(), c.end(), s.begin(), s.end());
+    });
+    PIKA_TEST(r == expected);
+
+    r = test::run<ExPolicy>([&] {
+        return pika::search(policy, c.begin(), c.end(), s.begin(), s.end(),
+            std::equal_to<T>());
+    });
+    PIKA_TEST(r == expected);
+
+    r = test::run<ExPolicy>([&] {
+        return pika::search_n(policy, c.begin(), size, s.begin(), s.end());
+    });
+    PIKA_TEST(r == expected);
+}
+
+// Looks for the first element of a small set which is placed at pos, a
+// position of size leaves the range without any of them.
+template <typename ExPolicy, typename T>
+void test_find_first_of(ExPolicy&& policy, std::size_t size, std::size_t pos,
+    std::size_t s_size)
+{
+    std::uniform_int_distribution<int> dis(0, 50);
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    std::vector<T> s(s_size);
+    for (std::size_t i = 0; i != s_size; ++i)
+    {
+        s[i] = T(100 + i);
+    }
+    if (pos != size && s_size != 0)
+    {
+        c[pos] = s[pos % s_size];
+    }
+
+    auto const expected = std::next(c.begin(), s_size != 0 ? pos : size);
+    auto r = test::run<ExPolicy>([&] {
+        return pika::find_first_of(
+            policy, c.begin(), c.end(), s.begin(), s.end());
+    });
+    PIKA_TEST(r == expected);
+
+    r = test::run<ExPolicy>([&] {
+        return pika::find_first_of(policy, c.begin(), c.end(), s.begin(),
+            s.end(), std::equal_to<T>());
+    });
+    PIKA_TEST(r == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_search(ExPolicy&& policy)
+{
+    for (std::size_t size : {1, 3, 17, 1000, 100007})
+    {
+        for (std::size_t s_size : {1, 2, 3, 16, 37})
+        {
+            if (s_size > size)
+            {
+                continue;
+            }
+
+            for (std::size_t pos : {std::size_t(0), (size - s_size) / 3,
+                     size - s_size})
+            {
+                test_search<ExPolicy, T>(policy, size, pos, s_size);
+            }
+        }
+
+        for (std::size_t s_size : {0, 1, 4, 23})
+        {
+            for (std::size_t pos : {std::size_t(0), size / 3, size - 1, size})
+            {
+                test_find_first_of<ExPolicy, T>(policy, size, pos, s_size);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_search(ExPolicy&& policy)
+{
+    test_search<ExPolicy, char>(policy);
+    test_search<ExPolicy, std::uint8_t>(policy);
+    test_search<ExPolicy, int>(policy);
+    test_search<ExPolicy, double>(policy);
+}
+
+void search_test()
+{
+    using namespace pika::execution;
+
+    test_search(simd);
+    test_search(par_simd);
+
+    test_search(simd(task));
+    test_search(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    search_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/algorithms/traits/datapar_tail_strategy.hpp>
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+// Process the elements which do not fill a whole pack with masked loads and
+// stores wherever the target supports it.
+namespace pika::traits {
+    template <>
+    struct datapar_tail_strategy<pika::execution::simd_policy>
+      : std::integral_constant<datapar_tail, datapar_tail::masked>
+    {
+    };
+
+    template <>
+    struct datapar_tail_strategy<pika::execution::simd_task_policy>
+      : std::integral_constant<datapar_tail, datapar_tail::masked>
+    {
+    };
+
+    template <>
+    struct datapar_tail_strategy<pika::execution::par_simd_policy>
+      : std::integral_constant<datapar_tail, datapar_tail::masked>
+    {
+    };
+
+    template <>
+    struct datapar_tail_strategy<pika::execution::par_simd_task_policy>
+      : std::integral_constant<datapar_tail, datapar_tail::masked>
+    {
+    };
+}    // namespace pika::traits
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// The ranges start at every offset into a pack and are surrounded by
+// elements which must not be written.
+template <typename ExPolicy, typename T>
+void test_transform_masked(ExPolicy&& policy, std::size_t offset,
+    std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(1, 100);
+    std::vector<T> c(offset + size + 64);
+    std::vector<T> c2(c.size());
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = T(dis(gen));
+        c2[i] = T(dis(gen));
+    }
+
+    std::vector<T> d(c.size(), T(0));
+    std::vector<T> expected(c.size(), T(0));
+    for (std::size_t i = offset; i != offset + size; ++i)
+    {
+        expected[i] = T(c[i] + T(1));
+    }
+
+    auto first = c.begin() + offset;
+    auto last = first + size;
+    auto unary = [](auto const& v) { return v + T(1); };
+
+    test::run<ExPolicy>([&] {
+        return pika::transform(policy, first, last, d.begin() + offset, unary);
+    });
+    PIKA_TEST(d == expected);
+
+    std::fill(d.begin(), d.end(), T(0));
+    for (std::size_t i = offset; i != offset + size; ++i)
+    {
+        expected[i] = T(c[i] * c2[i]);
+    }
+
+    auto first2 = c2.begin() + offset;
+    auto binary = [](auto const& v1, auto const& v2) { return v1 * v2; };
+
+    test::run<ExPolicy>([&] {
+        return pika::transform(
+            policy, first, last, first2, d.begin() + offset, binary);
+    });
+    PIKA_TEST(d == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_transform_masked(ExPolicy&& policy)
+{
+    for (std::size_t offset = 0; offset != 9; ++offset)
+    {
+        for (std::size_t size : {0, 1, 3, 7, 15, 16, 17, 63, 100, 10007})
+        {
+            test_transform_masked<ExPolicy, T>(policy, offset, size);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_transform_masked(ExPolicy&& policy)
+{
+    test_transform_masked<ExPolicy, std::uint8_t>(policy);
+    test_transform_masked<ExPolicy, int>(policy);
+    test_transform_masked<ExPolicy, float>(policy);
+    test_transform_masked<ExPolicy, double>(policy);
+}
+
+void transform_masked_test()
+{
+    using namespace pika::execution;
+
+    test_transform_masked(simd);
+    test_transform_masked(par_simd);
+
+    test_transform_masked(simd(task));
+    test_transform_masked(par_simd(task));
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    transform_masked_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
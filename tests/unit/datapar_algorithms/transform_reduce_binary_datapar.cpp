@@ -7,6 +7,8 @@
 #include <pika/init.hpp>
 #include <pika/parallel/datapar.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -26,10 +28,52 @@ void test_transform_reduce_binary()
     test_transform_reduce_binary_async(par_simd(task), IteratorTag());
 }
 
+// The reductions which are done horizontally by the simd backend and one
+// which is not.
+template <typename ExPolicy, typename Reduce>
+void test_transform_reduce_binary_op(ExPolicy&& policy, Reduce reduce)
+{
+    std::vector<unsigned int> c = test::random_iota<unsigned int>(1007);
+    std::vector<unsigned int> d = test::random_iota<unsigned int>(1007);
+    unsigned int init = unsigned(std::rand() % 1007);    //-V101
+
+    unsigned int r = pika::transform_reduce(policy, std::begin(c),
+        std::end(c), std::begin(d), init, reduce, std::bit_xor<>());
+
+    unsigned int expected = init;
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        expected = reduce(expected, c[i] ^ d[i]);
+    }
+    PIKA_TEST_EQ(r, expected);
+}
+
+template <typename ExPolicy>
+void test_transform_reduce_binary_op(ExPolicy&& policy)
+{
+    test_transform_reduce_binary_op(policy, std::plus<unsigned int>());
+    test_transform_reduce_binary_op(policy, std::multiplies<>());
+    test_transform_reduce_binary_op(policy, std::bit_and<>());
+    test_transform_reduce_binary_op(policy, std::bit_or<unsigned int>());
+    test_transform_reduce_binary_op(policy, std::bit_xor<>());
+    test_transform_reduce_binary_op(
+        policy, [](unsigned int a, unsigned int b) { return a ^ b; });
+}
+
 void transform_reduce_binary_test()
 {
     test_transform_reduce_binary<std::random_access_iterator_tag>();
     test_transform_reduce_binary<std::forward_iterator_tag>();
+
+    using namespace pika::execution;
+
+    test_transform_reduce_binary_op(simd);
+    test_transform_reduce_binary_op(par_simd);
+
+    test_transform_reduce_binary_dot(simd, float());
+    test_transform_reduce_binary_dot(simd, double());
+    test_transform_reduce_binary_dot(par_simd, float());
+    test_transform_reduce_binary_dot(par_simd, double());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// all reductions produce values of the value type of the sequence, the
+// integral values make the sums independent of the order of the additions
+template <typename ExPolicy>
+void test_transform_reduce_multi(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+    // start at an unaligned element
+    std::vector<double> c(size + 1);
+    std::generate(c.begin(), c.end(), [&] { return double(dis(gen)); });
+
+    // the functions are invoked with packs of elements and with single
+    // elements
+    auto reductions = std::make_tuple(
+        pika::transform_reduction(
+            0.0, std::plus<>(), [](auto x) { return x; }),
+        pika::transform_reduction(
+            0.0, std::plus<>(), [](auto x) { return x * x; }),
+        pika::transform_reduction(
+            0.0, std::plus<>(), [](auto x) { return x * x * x; }));
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(
+            policy, c.begin() + 1, c.end(), reductions);
+    });
+    auto expected = pika::transform_reduce(
+        pika::execution::seq, c.begin() + 1, c.end(), reductions);
+    PIKA_TEST(r == expected);
+}
+
+// reductions producing values of a different type are not vectorized
+template <typename ExPolicy>
+void test_transform_reduce_multi_mixed(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&] { return dis(gen); });
+
+    auto reductions = std::make_tuple(
+        pika::transform_reduction(std::int64_t(0), std::plus<>(),
+            [](int x) { return std::int64_t(x); }),
+        pika::transform_reduction(std::size_t(0), std::plus<>(),
+            [](int x) { return x < 0 ? 1 : 0; }));
+
+    auto r = test::run<ExPolicy>([&] {
+        return pika::transform_reduce(policy, c.begin(), c.end(), reductions);
+    });
+    auto expected = pika::transform_reduce(
+        pika::execution::seq, c.begin(), c.end(), reductions);
+    PIKA_TEST(r == expected);
+}
+
+void transform_reduce_multi_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 8, 9, 1000, 100007})
+    {
+        test_transform_reduce_multi(simd, size);
+        test_transform_reduce_multi(par_simd, size);
+        test_transform_reduce_multi(simd(task), size);
+        test_transform_reduce_multi(par_simd(task), size);
+
+        test_transform_reduce_multi_mixed(simd, size);
+        test_transform_reduce_multi_mixed(par_simd, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    transform_reduce_multi_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// float elements accumulated into double
+template <typename ExPolicy>
+void test_reduce_float_double(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<float> c(size);
+    for (float& value : c)
+    {
+        value = float(std::rand()) / float(RAND_MAX);
+    }
+
+    double expected = 0.5;
+    double expected_squares = 0.0;
+    for (float value : c)
+    {
+        expected += value;
+        expected_squares += double(value) * double(value);
+    }
+
+    double const tolerance = 1e-12 * double(size + 1);
+
+    double r = pika::reduce(policy, c.begin(), c.end(), 0.5);
+    PIKA_TEST(std::abs(r - expected) <= tolerance * expected);
+
+    // the elements are squared at the precision of the accumulator
+    double squares = pika::transform_reduce(policy, c.begin(), c.end(), 0.0,
+        std::plus<>(), [](auto value) { return value * value; });
+    PIKA_TEST(
+        std::abs(squares - expected_squares) <= tolerance * expected_squares);
+}
+
+// the sum of the elements does not fit the type of the elements
+template <typename ExPolicy>
+void test_reduce_int16_int32(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::int16_t> c(size);
+    for (std::int16_t& value : c)
+    {
+        value = std::int16_t(std::rand() % 30000);
+    }
+
+    std::int32_t expected = 0;
+    for (std::int16_t value : c)
+    {
+        expected += value;
+    }
+
+    std::int32_t r =
+        pika::reduce(policy, c.begin(), c.end(), std::int32_t(0));
+    PIKA_TEST_EQ(r, expected);
+
+    std::int32_t doubled = pika::transform_reduce(policy, c.begin(), c.end(),
+        std::int32_t(0), std::plus<std::int32_t>(),
+        [](auto value) { return value + value; });
+    PIKA_TEST_EQ(doubled, 2 * expected);
+}
+
+template <typename ExPolicy>
+void test_reduce_uint8_uint32_or(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::uint8_t> c(size);
+    for (std::uint8_t& value : c)
+    {
+        value = std::uint8_t(std::rand() % 256);
+    }
+
+    std::uint32_t expected = 0;
+    for (std::uint8_t value : c)
+    {
+        expected |= std::uint32_t(value) << 12;
+    }
+
+    std::uint32_t r = pika::transform_reduce(policy, c.begin(), c.end(),
+        std::uint32_t(0), std::bit_or<>(),
+        [](auto value) { return value << 12; });
+    PIKA_TEST_EQ(r, expected);
+}
+
+void transform_reduce_widening_test()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 16, 1007, 100007})
+    {
+        test_reduce_float_double(simd, size);
+        test_reduce_float_double(par_simd, size);
+
+        test_reduce_int16_int32(simd, size);
+        test_reduce_int16_int32(par_simd, size);
+
+        test_reduce_uint8_uint32_or(simd, size);
+        test_reduce_uint8_uint32_or(par_simd, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    transform_reduce_widening_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
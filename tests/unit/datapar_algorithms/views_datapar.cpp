@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 ETH Zurich
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/container_algorithms/for_each.hpp>
+#include <pika/parallel/container_algorithms/reduce.hpp>
+#include <pika/parallel/container_algorithms/views.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// Writes the computed element to the contiguous one, the datapar loops
+// invoke this with packs.
+struct assign_computed
+{
+    template <typename Tuple>
+    void operator()(Tuple&& t) const
+    {
+        std::get<1>(t) = std::get<0>(t);
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_views_datapar(ExPolicy&& policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = T(dis(gen));
+    }
+
+    // the function maps packs to packs, whole packs are computed
+    std::vector<T> d(size);
+    auto doubled = pika::ranges::zipped(
+        pika::ranges::transformed(c, [](auto x) { return x + x; }), d);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(policy, doubled, assign_computed());
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], T(c[i] + c[i]));
+    }
+
+    // the function takes single elements, the packs are gathered
+    std::vector<T> e(size);
+    auto incremented = pika::ranges::zipped(
+        pika::ranges::transformed(c, [](T x) { return T(x + 1); }), e);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(policy, incremented, assign_computed());
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(e[i], T(c[i] + 1));
+    }
+
+    // iota and strided views
+    std::vector<T> f(size);
+    auto indices = pika::ranges::zipped(pika::ranges::iota(T(0), T(size)), f);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(policy, indices, assign_computed());
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(f[i], T(i));
+    }
+
+    auto every_third = pika::ranges::strided(f, 3);
+    test::run<ExPolicy>([&] {
+        return pika::ranges::for_each(
+            policy, every_third, [](auto& x) { x = 0; });
+    });
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(f[i], i % 3 == 0 ? T(0) : T(i));
+    }
+}
+
+template <typename ExPolicy>
+void test_views_datapar(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 7, 100, 1000, 100007})
+    {
+        test_views_datapar<ExPolicy, int>(policy, size);
+        test_views_datapar<ExPolicy, float>(policy, size);
+        test_views_datapar<ExPolicy, double>(policy, size);
+    }
+}
+
+void test_reduce_transformed()
+{
+    std::vector<int> c(100007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        c[i] = int(i % 100);
+    }
+
+    auto tripled = pika::ranges::transformed(c, [](auto x) { return 3 * x; });
+    PIKA_TEST_EQ(pika::ranges::reduce(pika::execution::par_simd, tripled, 0),
+        3 * std::accumulate(c.begin(), c.end(), 0));
+}
+
+void views_datapar_test()
+{
+    using namespace pika::execution;
+
+    test_views_datapar(simd);
+    test_views_datapar(par_simd);
+
+    test_views_datapar(simd(task));
+    test_views_datapar(par_simd(task));
+
+    test_reduce_transformed();
+}
+
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    views_datapar_test();
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -173,11 +173,19 @@ def plot():
     help="List of \
     references for all corresponding results",
 )
-def compare(output, references, results):
+@args.arg(
+    "--mode",
+    default="bootstrap",
+    choices=["bootstrap", "overlap"],
+    help="bootstrap classifies the bootstrapped difference of the medians, "
+    "overlap only flags a change if the confidence intervals of the medians "
+    "do not overlap",
+)
+def compare(output, references, results, mode):
     mkdirp(output)
     from perftest import plot
 
-    exitcode = plot.compare_all(results, references, output)
+    exitcode = plot.compare_all(results, references, output, mode)
     print("exit code in compare function " + str(exitcode))
     raise SystemExit(exitcode)
 
@@ -205,6 +213,35 @@ def history(h_output, h_input, date, limit):
     plot.history([plot._load_json(i) for i in h_input], h_output, date, limit)
 
 
+@plot.command(description="plot strong and weak scaling curves")
+@args.arg("--output", "-o", required=True, help="output directory")
+@args.arg("--input", "-i", required=True, nargs="+", help="any number of input files")
+def scaling(output, input):
+    from perftest import plot
+
+    plot.scaling([plot._load_json(i) for i in input], output)
+
+
+@plot.command(description="plot throughput against the memory bandwidth roof")
+@args.arg("--output", "-o", required=True, help="output directory")
+@args.arg("--input", "-i", required=True, nargs="+", help="any number of input files")
+@args.arg(
+    "--peak-bandwidth",
+    type=float,
+    help="peak memory bandwidth in GB/s (default: taken from --stream)",
+)
+@args.arg("--stream", help="stream_report result providing the peak bandwidth")
+def roofline(output, input, peak_bandwidth, stream):
+    from perftest import plot
+
+    plot.roofline(
+        [plot._load_json(i) for i in input],
+        output,
+        peak_bandwidth,
+        plot._load_json(stream) if stream else None,
+    )
+
+
 @plot.command(description="plot backends comparison")
 @args.arg("--output", "-o", required=True, help="output directory")
 @args.arg("--input", "-i", required=True, nargs="+", help="any number of input files")
@@ -37,12 +37,22 @@ class _OutputKey(typing.NamedTuple):
         executor = self.executor.upper()
         return f"{name} ({executor})"
 
+    @classmethod
+    def _key(cls, o):
+        fields = ("series", "statistics", "counters", "throughput")
+        return cls(**{k: v for k, v in o.items() if k not in fields})
+
     @classmethod
     def outputs_by_key(cls, data):
-        def split_output(o):
-            return cls(**{k: v for k, v in o.items() if k != "series"}), o["series"]
+        return {cls._key(o): o["series"] for o in data["outputs"]}
 
-        return dict(split_output(o) for o in data["outputs"])
+    @classmethod
+    def statistics_by_key(cls, data):
+        return {cls._key(o): o.get("statistics") for o in data["outputs"]}
+
+    @classmethod
+    def counters_by_key(cls, data):
+        return {cls._key(o): o["counters"] for o in data["outputs"] if "counters" in o}
 
 
 class _ConfidenceInterval(typing.NamedTuple):
@@ -123,6 +133,58 @@ class _ConfidenceInterval(typing.NamedTuple):
         return cls(*ci)
 
 
+def _reject_outliers(series, threshold=3.5):
+    # modified z-score based on the median absolute deviation, as in
+    # perftests_report
+    series = np.asarray(series)
+    median = np.median(series)
+    mad = np.median(np.abs(series - median))
+    if threshold <= 0 or mad == 0:
+        return series
+    return series[0.6745 * np.abs(series - median) / mad <= threshold]
+
+
+def _median_interval(series, statistics, n=1000, alpha=0.05):
+    # the interval reported by perftests_report if the output has one,
+    # older outputs (e.g. the references) are bootstrapped here
+    if statistics is not None and "ci_lower" in statistics:
+        return statistics["ci_lower"], statistics["ci_upper"]
+
+    series = _reject_outliers(series)
+    samples = np.random.choice(series, (series.size, n))
+    return tuple(np.quantile(np.median(samples, axis=0), [alpha / 2, 1 - alpha / 2]))
+
+
+class _IntervalOverlap(typing.NamedTuple):
+    before: tuple
+    after: tuple
+
+    def classify(self):
+        # a change is only reported if the confidence intervals of the
+        # medians are disjoint
+        if self.after[0] > self.before[1]:
+            return "-"
+        if self.after[1] < self.before[0]:
+            return "+"
+        return "="
+
+    def significant(self):
+        return "=" not in self.classify()
+
+    def __str__(self):
+        def fmt(interval):
+            return f"{interval[0] * 1000:.4f} - {interval[1] * 1000:.4f} ms"
+
+        return f"{fmt(self.before)} -> {fmt(self.after)}"
+
+    @classmethod
+    def compare(cls, before, before_stats, after, after_stats):
+        return cls(
+            _median_interval(before, before_stats),
+            _median_interval(after, after_stats),
+        )
+
+
 def _add_comparison_table(report, cis):
     names = list(sorted(set(k.name for k in cis.keys())))
     executors = list(sorted(set(k.executor for k in cis.keys())))
@@ -173,7 +235,17 @@ def _add_comparison_table(report, cis):
     return exitcode
 
 
-def _add_explanation_of_symbols(report):
+def _add_explanation_of_symbols(report, mode):
+    if mode == "overlap":
+        with report.table("Explanation of Symbols") as table:
+            with table.row() as row:
+                row.fill("Symbol", "MEANING")
+            with table.row() as row:
+                row.fill("=", "Confidence intervals of the medians overlap")
+            with table.row() as row:
+                row.fill("+/-", "Faster/slower, the confidence intervals are disjoint")
+        return
+
     with report.table("Explanation of Symbols") as table:
 
         def add_help(string, meaning):
@@ -222,6 +294,39 @@ def _add_comparison_plots(report, before_outs, after_outs, cis):
             _histogram_plot(title, before_outs[k], after_outs[k], grid.image())
 
 
+def _add_counters_table(report, labels, data):
+    # medians over the measurements of the hardware counters captured by
+    # perftests_report, misses are given per thousand instructions
+    def derived(counters):
+        instructions = np.asarray(counters["instructions"], dtype=float)
+        safe = np.where(instructions > 0, instructions, np.nan)
+        return (
+            np.nanmedian(instructions / np.asarray(counters["cycles"], dtype=float)),
+            np.nanmedian(1000 * np.asarray(counters["llc_misses"]) / safe),
+            np.nanmedian(1000 * np.asarray(counters["branch_misses"]) / safe),
+        )
+
+    outputs = [_OutputKey.counters_by_key(d) for d in data]
+    keys = sorted(set.union(*(set(o.keys()) for o in outputs)))
+    if not keys:
+        return
+
+    metrics = ("IPC", "LLC MPKI", "BRANCH MPKI")
+    with report.table("Hardware Counters") as table:
+        with table.row() as row:
+            row.fill(
+                "BENCHMARK",
+                *(f"{metric} ({label})" for metric in metrics for label in labels),
+            )
+
+        for k in keys:
+            values = [derived(o[k]) if k in o else (np.nan,) * 3 for o in outputs]
+            with table.row() as row:
+                row.fill(str(k), *(f"{v[i]:.3f}" for i in range(3) for v in values))
+
+    log.debug("Generated hardware counters table")
+
+
 def _add_info(report, labels, data):
     with report.table("Info") as table:
         with table.row() as row:
@@ -240,32 +345,46 @@ def _add_info(report, labels, data):
                     row.cell(d["environment"].get(k, "—"))
 
 
-def compare_one(report, before, after, output):
+def compare_one(report, before, after, output, mode="bootstrap"):
     before_outs = _OutputKey.outputs_by_key(before)
     after_outs = _OutputKey.outputs_by_key(after)
-    cis = {
-        k: _ConfidenceInterval.compare_medians(before_outs[k], v)
-        for k, v in after_outs.items()
-        if k in before_outs
-    }
+    if mode == "overlap":
+        before_stats = _OutputKey.statistics_by_key(before)
+        after_stats = _OutputKey.statistics_by_key(after)
+        cis = {
+            k: _IntervalOverlap.compare(
+                before_outs[k], before_stats[k], v, after_stats[k]
+            )
+            for k, v in after_outs.items()
+            if k in before_outs
+        }
+    else:
+        cis = {
+            k: _ConfidenceInterval.compare_medians(before_outs[k], v)
+            for k, v in after_outs.items()
+            if k in before_outs
+        }
     # Fill report
     exitcode = _add_comparison_table(report, cis)
     _add_comparison_plots(report, before_outs, after_outs, cis)
+    _add_counters_table(report, ["Before", "After"], [before, after])
     _add_info(report, ["Before", "After"], [before, after])
     return exitcode
 
 
-def compare_all(results, references, output):
+def compare_all(results, references, output, mode="bootstrap"):
     index = 0
     global_exitcode = 0
     title = var._project_name + " Performance"
     with html.Report(output, title) as report:
         for res in results:
             ref = references[index]
-            exitcode = compare_one(report, _load_json(ref), _load_json(res), output)
+            exitcode = compare_one(
+                report, _load_json(ref), _load_json(res), output, mode
+            )
             global_exitcode = global_exitcode or exitcode
             index += 1
-        _add_explanation_of_symbols(report)
+        _add_explanation_of_symbols(report, mode)
     return global_exitcode
 
 
@@ -412,3 +531,141 @@ def compare_executors(data, output):
     with html.Report(output, title) as report:
         _add_executor_comparison_plots(report, data)
         _add_info(report, [f"Configuration {i + 1}" for i in range(len(data))], data)
+
+
+def _scaling_plot(title, curves, key, ylabel, ideal, output):
+    fig, ax = plt.subplots(figsize=(10, 5))
+    threads = sorted({t for c in curves for t in c["threads"]})
+    for curve in curves:
+        ax.plot(curve["threads"], curve[key], "o-", label=f"Size {curve['size']}")
+    ax.plot(threads, [ideal(threads[0], t) for t in threads], "k--", label="Ideal")
+    ax.set_xscale("log", base=2)
+    ax.set_xticks(threads)
+    ax.set_xticklabels([str(t) for t in threads])
+    ax.set_xlabel("Threads")
+    ax.set_ylabel(ylabel)
+    ax.set_ylim(bottom=0)
+    ax.set_title(title)
+    ax.legend(loc="upper left")
+    fig.tight_layout()
+    fig.savefig(output, dpi=300)
+    log.debug(f"Successfully written scaling plot to {output}")
+    plt.close(fig)
+
+
+def scaling(data, output):
+    # the curves written by perftests_scaling, grouped by benchmark and mode
+    title = var._project_name + " Scaling"
+    with html.Report(output, title) as report:
+        groups = {}
+        for d in data:
+            for curve in d.get("scaling", []):
+                benchmark = curve["name"].rsplit("/", 2)[0]
+                groups.setdefault((benchmark, curve["mode"]), []).append(curve)
+
+        for (benchmark, mode), curves in sorted(groups.items()):
+            name = f"{benchmark.replace('_', ' ').title()} ({mode} scaling)"
+            with report.image_grid(name) as grid:
+                if mode == "strong":
+                    _scaling_plot(
+                        name,
+                        curves,
+                        "speedup",
+                        "Speedup",
+                        lambda t0, t: t / t0,
+                        grid.image(),
+                    )
+                _scaling_plot(
+                    name,
+                    curves,
+                    "efficiency",
+                    "Parallel efficiency",
+                    lambda t0, t: 1.0,
+                    grid.image(),
+                )
+
+        _add_info(report, [f"Run {i + 1}" for i in range(len(data))], data)
+
+
+def _stream_peak_bandwidth(data):
+    # the best triad bandwidth of a stream_report run
+    return max(
+        (
+            o["throughput"]["gbytes_per_s"]
+            for o in data["outputs"]
+            if "triad" in o["name"].lower() and "throughput" in o
+        ),
+        default=0.0,
+    )
+
+
+def _roofline_plot(title, points, peak_bandwidth, output):
+    fig, ax = plt.subplots(figsize=(10, 5))
+    for label, (intensity, gops) in sorted(points.items()):
+        ax.plot(intensity, gops, "o", label=label)
+    intensities = [i for i, _ in points.values()]
+    if peak_bandwidth and intensities:
+        x = np.logspace(
+            np.log10(min(intensities) / 2), np.log10(max(intensities) * 2), 50
+        )
+        ax.plot(x, x * peak_bandwidth, "k--", label="Memory bandwidth roof")
+    ax.set_xscale("log")
+    ax.set_yscale("log")
+    ax.set_xlabel("Arithmetic intensity [op/byte]")
+    ax.set_ylabel("Throughput [Gop/s]")
+    ax.set_title(title)
+    ax.legend(loc="upper left", fontsize="small")
+    fig.tight_layout()
+    fig.savefig(output, dpi=300)
+    log.debug(f"Successfully written roofline plot to {output}")
+    plt.close(fig)
+
+
+def roofline(data, output, peak_bandwidth=None, stream=None):
+    # the throughput reported by perftests_report against the memory
+    # bandwidth roof, taken from the arguments, a stream_report run or the
+    # peak stored in the reports
+    if not peak_bandwidth and stream is not None:
+        peak_bandwidth = _stream_peak_bandwidth(stream)
+
+    title = var._project_name + " Roofline"
+    with html.Report(output, title) as report:
+        outputs = [
+            (_OutputKey._key(o), o["throughput"])
+            for d in data
+            for o in d["outputs"]
+            if "throughput" in o
+        ]
+        if not peak_bandwidth:
+            peak_bandwidth = max(
+                (t.get("peak_gbytes_per_s", 0.0) for _, t in outputs), default=0.0
+            )
+
+        with report.table("Throughput") as table:
+            with table.row() as row:
+                row.fill("BENCHMARK", "GB/s", "GOP/S", "OP/BYTE", "OF PEAK")
+            for k, t in sorted(outputs, key=lambda kt: kt[0]):
+                fraction = (
+                    f"{100 * t['gbytes_per_s'] / peak_bandwidth:.1f}%"
+                    if peak_bandwidth
+                    else "—"
+                )
+                with table.row() as row:
+                    row.fill(
+                        str(k),
+                        f"{t['gbytes_per_s']:.2f}",
+                        f"{t['gops_per_s']:.3f}",
+                        f"{t.get('arithmetic_intensity', 0.0):.3f}",
+                        fraction,
+                    )
+
+        points = {
+            str(k): (t["arithmetic_intensity"], t["gops_per_s"])
+            for k, t in outputs
+            if t.get("arithmetic_intensity", 0.0) > 0 and t["gops_per_s"] > 0
+        }
+        if points:
+            with report.image_grid("Roofline") as grid:
+                _roofline_plot(title, points, peak_bandwidth, grid.image())
+
+        _add_info(report, [f"Run {i + 1}" for i in range(len(data))], data)